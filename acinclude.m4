@@ -4,7 +4,22 @@ dnl Version: 20190317
 
 dnl Function to detect if assorted tools dependencies are available
 AC_DEFUN([AX_ASSORTED_TOOLS_CHECK_LOCAL],
-  [AC_CHECK_HEADERS([math.h])
+  [AC_CHECK_HEADERS([dirent.h fcntl.h math.h sched.h sys/mman.h sys/resource.h sys/stat.h sys/time.h time.h unistd.h])
+
+  dnl Functions used by the benchmark tools
+  AC_CHECK_FUNCS([clock_gettime getrusage gettimeofday])
+
+  dnl Functions used to map input files into memory
+  AC_CHECK_FUNCS([madvise mmap])
+
+  dnl Functions used to map output files into memory
+  AC_CHECK_FUNCS([ftruncate posix_fallocate])
+
+  dnl Functions used to read directories in batch mode
+  AC_CHECK_FUNCS([opendir])
+
+  dnl Functions used to bind the threads of the worker pool to CPUs
+  AC_CHECK_FUNCS([sched_getaffinity sched_setaffinity])
 
   AC_CHECK_LIB(
     m,
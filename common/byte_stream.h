@@ -23,15 +23,47 @@
 #define _BYTE_STREAM_H
 
 #include "common.h"
+#include "memory.h"
 #include "types.h"
 
 #if defined( __cplusplus )
 extern "C" {
 #endif
 
+/* Determine the byte order of the host at compile time if the compiler defines it
+ */
+#if defined( __BYTE_ORDER__ ) && defined( __ORDER_BIG_ENDIAN__ ) && defined( __ORDER_LITTLE_ENDIAN__ )
+#if __BYTE_ORDER__ == __ORDER_BIG_ENDIAN__
+#define _BYTE_STREAM_HOST_ENDIAN_BIG
+#elif __BYTE_ORDER__ == __ORDER_LITTLE_ENDIAN__
+#define _BYTE_STREAM_HOST_ENDIAN_LITTLE
+#endif
+
+#elif defined( _MSC_VER ) && ( defined( _M_IX86 ) || defined( _M_X64 ) || defined( _M_ARM ) || defined( _M_ARM64 ) )
+#define _BYTE_STREAM_HOST_ENDIAN_LITTLE
+
+#elif defined( __BIG_ENDIAN__ ) && !defined( __LITTLE_ENDIAN__ )
+#define _BYTE_STREAM_HOST_ENDIAN_BIG
+
+#elif defined( __LITTLE_ENDIAN__ ) && !defined( __BIG_ENDIAN__ )
+#define _BYTE_STREAM_HOST_ENDIAN_LITTLE
+#endif
+
+#if defined( _BYTE_STREAM_HOST_ENDIAN_BIG )
+#define _BYTE_STREAM_HOST_IS_ENDIAN_BIG		1
+#define _BYTE_STREAM_HOST_IS_ENDIAN_LITTLE	0
+#define _BYTE_STREAM_HOST_IS_ENDIAN_MIDDLE	0
+
+#elif defined( _BYTE_STREAM_HOST_ENDIAN_LITTLE )
+#define _BYTE_STREAM_HOST_IS_ENDIAN_BIG		0
+#define _BYTE_STREAM_HOST_IS_ENDIAN_LITTLE	1
+#define _BYTE_STREAM_HOST_IS_ENDIAN_MIDDLE	0
+
+#else
 #define _BYTE_STREAM_HOST_IS_ENDIAN_BIG		( *((uint32_t *) "\x01\x02\x03\x04" ) == 0x01020304 )
 #define _BYTE_STREAM_HOST_IS_ENDIAN_LITTLE	( *((uint32_t *) "\x01\x02\x03\x04" ) == 0x04030201 )
 #define _BYTE_STREAM_HOST_IS_ENDIAN_MIDDLE	( *((uint32_t *) "\x01\x02\x03\x04" ) == 0x02010403 )
+#endif
 
 #define _BYTE_STREAM_ENDIAN_BIG			(uint8_t) 'b'
 #define _BYTE_STREAM_ENDIAN_LITTLE		(uint8_t) 'l'
@@ -51,27 +83,140 @@ typedef union byte_stream_float64
 
 } byte_stream_float64_t;
 
+#if defined( _MSC_VER ) || defined( __BORLANDC__ )
+#define BYTE_STREAM_INLINE __inline
+
+#elif defined( __GNUC__ )
+#define BYTE_STREAM_INLINE __inline__
+
+#else
+#define BYTE_STREAM_INLINE
+#endif
+
+/* The byte swap intrinsics
+ */
+#if defined( __clang__ ) || ( defined( __GNUC__ ) && ( ( __GNUC__ > 4 ) || ( ( __GNUC__ == 4 ) && ( __GNUC_MINOR__ >= 8 ) ) ) )
+#define byte_stream_swap_uint16( value ) \
+	__builtin_bswap16( value )
+
+#define byte_stream_swap_uint32( value ) \
+	__builtin_bswap32( value )
+
+#define byte_stream_swap_uint64( value ) \
+	__builtin_bswap64( value )
+
+#define HAVE_BYTE_STREAM_SWAP
+
+#elif defined( _MSC_VER ) && ( _MSC_VER >= 1300 )
+#define byte_stream_swap_uint16( value ) \
+	_byteswap_ushort( value )
+
+#define byte_stream_swap_uint32( value ) \
+	_byteswap_ulong( value )
+
+#define byte_stream_swap_uint64( value ) \
+	_byteswap_uint64( value )
+
+#define HAVE_BYTE_STREAM_SWAP
+#endif
+
+/* The 16-bit, 32-bit and 64-bit values are copied using a single, possibly
+ * unaligned, load or store and a byte swap if the byte order of the host
+ * is known at compile time, otherwise the values are copied a byte at a time
+ */
+#if ( defined( _BYTE_STREAM_HOST_ENDIAN_BIG ) || defined( _BYTE_STREAM_HOST_ENDIAN_LITTLE ) ) && defined( HAVE_BYTE_STREAM_SWAP ) && ( defined( HAVE_MEMCPY ) || defined( WINAPI ) )
+#define HAVE_BYTE_STREAM_WORD_ACCESS
+#endif
+
+#if defined( HAVE_BYTE_STREAM_WORD_ACCESS )
+
+#if defined( _BYTE_STREAM_HOST_ENDIAN_BIG )
+#define byte_stream_host_to_big_endian_uint16( value )		( value )
+#define byte_stream_host_to_big_endian_uint32( value )		( value )
+#define byte_stream_host_to_big_endian_uint64( value )		( value )
+#define byte_stream_host_to_little_endian_uint16( value )	byte_stream_swap_uint16( value )
+#define byte_stream_host_to_little_endian_uint32( value )	byte_stream_swap_uint32( value )
+#define byte_stream_host_to_little_endian_uint64( value )	byte_stream_swap_uint64( value )
+#else
+#define byte_stream_host_to_big_endian_uint16( value )		byte_stream_swap_uint16( value )
+#define byte_stream_host_to_big_endian_uint32( value )		byte_stream_swap_uint32( value )
+#define byte_stream_host_to_big_endian_uint64( value )		byte_stream_swap_uint64( value )
+#define byte_stream_host_to_little_endian_uint16( value )	( value )
+#define byte_stream_host_to_little_endian_uint32( value )	( value )
+#define byte_stream_host_to_little_endian_uint64( value )	( value )
+#endif
+
+static BYTE_STREAM_INLINE uint16_t byte_stream_load_uint16( const uint8_t *byte_stream )
+{
+	uint16_t value;
+
+	memory_copy( &value, byte_stream, sizeof( uint16_t ) );
+
+	return( value );
+}
+
+static BYTE_STREAM_INLINE uint32_t byte_stream_load_uint32( const uint8_t *byte_stream )
+{
+	uint32_t value;
+
+	memory_copy( &value, byte_stream, sizeof( uint32_t ) );
+
+	return( value );
+}
+
+static BYTE_STREAM_INLINE uint64_t byte_stream_load_uint64( const uint8_t *byte_stream )
+{
+	uint64_t value;
+
+	memory_copy( &value, byte_stream, sizeof( uint64_t ) );
+
+	return( value );
+}
+
+static BYTE_STREAM_INLINE void byte_stream_store_uint16( uint8_t *byte_stream, uint16_t value )
+{
+	memory_copy( byte_stream, &value, sizeof( uint16_t ) );
+}
+
+static BYTE_STREAM_INLINE void byte_stream_store_uint32( uint8_t *byte_stream, uint32_t value )
+{
+	memory_copy( byte_stream, &value, sizeof( uint32_t ) );
+}
+
+static BYTE_STREAM_INLINE void byte_stream_store_uint64( uint8_t *byte_stream, uint64_t value )
+{
+	memory_copy( byte_stream, &value, sizeof( uint64_t ) );
+}
+
+#endif /* defined( HAVE_BYTE_STREAM_WORD_ACCESS ) */
+
+#if defined( HAVE_BYTE_STREAM_WORD_ACCESS )
 #define byte_stream_copy_to_uint16_big_endian( byte_stream, value ) \
-	( value )   = ( byte_stream )[ 0 ]; \
-	( value ) <<= 8; \
-	( value )  |= ( byte_stream )[ 1 ];
+	( value ) = byte_stream_host_to_big_endian_uint16( byte_stream_load_uint16( (const uint8_t *) ( byte_stream ) ) );
 
 #define byte_stream_copy_to_uint16_little_endian( byte_stream, value ) \
-	( value )   = ( byte_stream )[ 1 ]; \
-	( value ) <<= 8; \
-	( value )  |= ( byte_stream )[ 0 ];
+	( value ) = byte_stream_host_to_little_endian_uint16( byte_stream_load_uint16( (const uint8_t *) ( byte_stream ) ) );
 
-#define byte_stream_copy_to_uint24_big_endian( byte_stream, value ) \
+#define byte_stream_copy_to_uint32_big_endian( byte_stream, value ) \
+	( value ) = byte_stream_host_to_big_endian_uint32( byte_stream_load_uint32( (const uint8_t *) ( byte_stream ) ) );
+
+#define byte_stream_copy_to_uint32_little_endian( byte_stream, value ) \
+	( value ) = byte_stream_host_to_little_endian_uint32( byte_stream_load_uint32( (const uint8_t *) ( byte_stream ) ) );
+
+#define byte_stream_copy_to_uint64_big_endian( byte_stream, value ) \
+	( value ) = byte_stream_host_to_big_endian_uint64( byte_stream_load_uint64( (const uint8_t *) ( byte_stream ) ) );
+
+#define byte_stream_copy_to_uint64_little_endian( byte_stream, value ) \
+	( value ) = byte_stream_host_to_little_endian_uint64( byte_stream_load_uint64( (const uint8_t *) ( byte_stream ) ) );
+
+#else
+#define byte_stream_copy_to_uint16_big_endian( byte_stream, value ) \
 	( value )   = ( byte_stream )[ 0 ]; \
 	( value ) <<= 8; \
-	( value )  |= ( byte_stream )[ 1 ]; \
-	( value ) <<= 8; \
-	( value )  |= ( byte_stream )[ 2 ];
+	( value )  |= ( byte_stream )[ 1 ];
 
-#define byte_stream_copy_to_uint24_little_endian( byte_stream, value ) \
-	( value )   = ( byte_stream )[ 2 ]; \
-	( value ) <<= 8; \
-	( value )  |= ( byte_stream )[ 1 ]; \
+#define byte_stream_copy_to_uint16_little_endian( byte_stream, value ) \
+	( value )   = ( byte_stream )[ 1 ]; \
 	( value ) <<= 8; \
 	( value )  |= ( byte_stream )[ 0 ];
 
@@ -93,7 +238,7 @@ typedef union byte_stream_float64
 	( value ) <<= 8; \
 	( value )  |= ( byte_stream )[ 0 ];
 
-#define byte_stream_copy_to_uint48_big_endian( byte_stream, value ) \
+#define byte_stream_copy_to_uint64_big_endian( byte_stream, value ) \
 	( value )   = ( byte_stream )[ 0 ]; \
 	( value ) <<= 8; \
 	( value )  |= ( byte_stream )[ 1 ]; \
@@ -104,9 +249,17 @@ typedef union byte_stream_float64
 	( value ) <<= 8; \
 	( value )  |= ( byte_stream )[ 4 ]; \
 	( value ) <<= 8; \
-	( value )  |= ( byte_stream )[ 5 ];
+	( value )  |= ( byte_stream )[ 5 ]; \
+	( value ) <<= 8; \
+	( value )  |= ( byte_stream )[ 6 ]; \
+	( value ) <<= 8; \
+	( value )  |= ( byte_stream )[ 7 ];
 
-#define byte_stream_copy_to_uint48_little_endian( byte_stream, value ) \
+#define byte_stream_copy_to_uint64_little_endian( byte_stream, value ) \
+	( value )   = ( byte_stream )[ 7 ]; \
+	( value ) <<= 8; \
+	( value )  |= ( byte_stream )[ 6 ]; \
+	( value ) <<= 8; \
 	( value )  |= ( byte_stream )[ 5 ]; \
 	( value ) <<= 8; \
 	( value )  |= ( byte_stream )[ 4 ]; \
@@ -119,29 +272,37 @@ typedef union byte_stream_float64
 	( value ) <<= 8; \
 	( value )  |= ( byte_stream )[ 0 ];
 
-#define byte_stream_copy_to_uint64_big_endian( byte_stream, value ) \
+#endif /* defined( HAVE_BYTE_STREAM_WORD_ACCESS ) */
+
+#define byte_stream_copy_to_uint24_big_endian( byte_stream, value ) \
 	( value )   = ( byte_stream )[ 0 ]; \
 	( value ) <<= 8; \
 	( value )  |= ( byte_stream )[ 1 ]; \
 	( value ) <<= 8; \
-	( value )  |= ( byte_stream )[ 2 ]; \
+	( value )  |= ( byte_stream )[ 2 ];
+
+#define byte_stream_copy_to_uint24_little_endian( byte_stream, value ) \
+	( value )   = ( byte_stream )[ 2 ]; \
 	( value ) <<= 8; \
-	( value )  |= ( byte_stream )[ 3 ]; \
+	( value )  |= ( byte_stream )[ 1 ]; \
 	( value ) <<= 8; \
-	( value )  |= ( byte_stream )[ 4 ]; \
+	( value )  |= ( byte_stream )[ 0 ];
+
+#define byte_stream_copy_to_uint48_big_endian( byte_stream, value ) \
+	( value )   = ( byte_stream )[ 0 ]; \
 	( value ) <<= 8; \
-	( value )  |= ( byte_stream )[ 5 ]; \
+	( value )  |= ( byte_stream )[ 1 ]; \
 	( value ) <<= 8; \
-	( value )  |= ( byte_stream )[ 6 ]; \
+	( value )  |= ( byte_stream )[ 2 ]; \
 	( value ) <<= 8; \
-	( value )  |= ( byte_stream )[ 7 ];
-
-#define byte_stream_copy_to_uint64_little_endian( byte_stream, value ) \
-	( value )   = ( byte_stream )[ 7 ]; \
+	( value )  |= ( byte_stream )[ 3 ]; \
 	( value ) <<= 8; \
-	( value )  |= ( byte_stream )[ 6 ]; \
+	( value )  |= ( byte_stream )[ 4 ]; \
 	( value ) <<= 8; \
-	( value )  |= ( byte_stream )[ 5 ]; \
+	( value )  |= ( byte_stream )[ 5 ];
+
+#define byte_stream_copy_to_uint48_little_endian( byte_stream, value ) \
+	( value )   = ( byte_stream )[ 5 ]; \
 	( value ) <<= 8; \
 	( value )  |= ( byte_stream )[ 4 ]; \
 	( value ) <<= 8; \
@@ -153,21 +314,31 @@ typedef union byte_stream_float64
 	( value ) <<= 8; \
 	( value )  |= ( byte_stream )[ 0 ];
 
+#if defined( HAVE_BYTE_STREAM_WORD_ACCESS )
 #define byte_stream_copy_from_uint16_big_endian( byte_stream, value ) \
-	( byte_stream )[ 0 ] = (uint8_t) ( ( ( value ) >> 8 ) & 0x0ff ); \
-	( byte_stream )[ 1 ] = (uint8_t) ( ( value ) & 0x0ff )
+	byte_stream_store_uint16( (uint8_t *) ( byte_stream ), byte_stream_host_to_big_endian_uint16( (uint16_t) ( value ) ) )
 
 #define byte_stream_copy_from_uint16_little_endian( byte_stream, value ) \
-	( byte_stream )[ 1 ] = (uint8_t) ( ( ( value ) >> 8 ) & 0x0ff ); \
-	( byte_stream )[ 0 ] = (uint8_t) ( ( value ) & 0x0ff )
+	byte_stream_store_uint16( (uint8_t *) ( byte_stream ), byte_stream_host_to_little_endian_uint16( (uint16_t) ( value ) ) )
 
-#define byte_stream_copy_from_uint24_big_endian( byte_stream, value ) \
-	( byte_stream )[ 0 ] = (uint8_t) ( ( ( value ) >> 16 ) & 0x0ff ); \
-	( byte_stream )[ 1 ] = (uint8_t) ( ( ( value ) >> 8 ) & 0x0ff ); \
-	( byte_stream )[ 2 ] = (uint8_t) ( ( value ) & 0x0ff )
+#define byte_stream_copy_from_uint32_big_endian( byte_stream, value ) \
+	byte_stream_store_uint32( (uint8_t *) ( byte_stream ), byte_stream_host_to_big_endian_uint32( (uint32_t) ( value ) ) )
 
-#define byte_stream_copy_from_uint24_little_endian( byte_stream, value ) \
-	( byte_stream )[ 2 ] = (uint8_t) ( ( ( value ) >> 16 ) & 0x0ff ); \
+#define byte_stream_copy_from_uint32_little_endian( byte_stream, value ) \
+	byte_stream_store_uint32( (uint8_t *) ( byte_stream ), byte_stream_host_to_little_endian_uint32( (uint32_t) ( value ) ) )
+
+#define byte_stream_copy_from_uint64_big_endian( byte_stream, value ) \
+	byte_stream_store_uint64( (uint8_t *) ( byte_stream ), byte_stream_host_to_big_endian_uint64( (uint64_t) ( value ) ) )
+
+#define byte_stream_copy_from_uint64_little_endian( byte_stream, value ) \
+	byte_stream_store_uint64( (uint8_t *) ( byte_stream ), byte_stream_host_to_little_endian_uint64( (uint64_t) ( value ) ) )
+
+#else
+#define byte_stream_copy_from_uint16_big_endian( byte_stream, value ) \
+	( byte_stream )[ 0 ] = (uint8_t) ( ( ( value ) >> 8 ) & 0x0ff ); \
+	( byte_stream )[ 1 ] = (uint8_t) ( ( value ) & 0x0ff )
+
+#define byte_stream_copy_from_uint16_little_endian( byte_stream, value ) \
 	( byte_stream )[ 1 ] = (uint8_t) ( ( ( value ) >> 8 ) & 0x0ff ); \
 	( byte_stream )[ 0 ] = (uint8_t) ( ( value ) & 0x0ff )
 
@@ -183,22 +354,6 @@ typedef union byte_stream_float64
 	( byte_stream )[ 1 ] = (uint8_t) ( ( ( value ) >> 8 ) & 0x0ff ); \
 	( byte_stream )[ 0 ] = (uint8_t) ( ( value ) & 0x0ff )
 
-#define byte_stream_copy_from_uint48_big_endian( byte_stream, value ) \
-	( byte_stream )[ 0 ] = (uint8_t) ( ( ( value ) >> 40 ) & 0x0ff ); \
-	( byte_stream )[ 1 ] = (uint8_t) ( ( ( value ) >> 32 ) & 0x0ff ); \
-	( byte_stream )[ 2 ] = (uint8_t) ( ( ( value ) >> 24 ) & 0x0ff ); \
-	( byte_stream )[ 3 ] = (uint8_t) ( ( ( value ) >> 16 ) & 0x0ff ); \
-	( byte_stream )[ 4 ] = (uint8_t) ( ( ( value ) >> 8 ) & 0x0ff ); \
-	( byte_stream )[ 5 ] = (uint8_t) ( ( value ) & 0x0ff )
-
-#define byte_stream_copy_from_uint48_little_endian( byte_stream, value ) \
-	( byte_stream )[ 5 ] = (uint8_t) ( ( ( value ) >> 40 ) & 0x0ff ); \
-	( byte_stream )[ 4 ] = (uint8_t) ( ( ( value ) >> 32 ) & 0x0ff ); \
-	( byte_stream )[ 3 ] = (uint8_t) ( ( ( value ) >> 24 ) & 0x0ff ); \
-	( byte_stream )[ 2 ] = (uint8_t) ( ( ( value ) >> 16 ) & 0x0ff ); \
-	( byte_stream )[ 1 ] = (uint8_t) ( ( ( value ) >> 8 ) & 0x0ff ); \
-	( byte_stream )[ 0 ] = (uint8_t) ( ( value ) & 0x0ff )
-
 #define byte_stream_copy_from_uint64_big_endian( byte_stream, value ) \
 	( byte_stream )[ 0 ] = (uint8_t) ( ( ( value ) >> 56 ) & 0x0ff ); \
 	( byte_stream )[ 1 ] = (uint8_t) ( ( ( value ) >> 48 ) & 0x0ff ); \
@@ -219,6 +374,34 @@ typedef union byte_stream_float64
 	( byte_stream )[ 1 ] = (uint8_t) ( ( ( value ) >> 8 ) & 0x0ff ); \
 	( byte_stream )[ 0 ] = (uint8_t) ( ( value ) & 0x0ff )
 
+#endif /* defined( HAVE_BYTE_STREAM_WORD_ACCESS ) */
+
+#define byte_stream_copy_from_uint24_big_endian( byte_stream, value ) \
+	( byte_stream )[ 0 ] = (uint8_t) ( ( ( value ) >> 16 ) & 0x0ff ); \
+	( byte_stream )[ 1 ] = (uint8_t) ( ( ( value ) >> 8 ) & 0x0ff ); \
+	( byte_stream )[ 2 ] = (uint8_t) ( ( value ) & 0x0ff )
+
+#define byte_stream_copy_from_uint24_little_endian( byte_stream, value ) \
+	( byte_stream )[ 2 ] = (uint8_t) ( ( ( value ) >> 16 ) & 0x0ff ); \
+	( byte_stream )[ 1 ] = (uint8_t) ( ( ( value ) >> 8 ) & 0x0ff ); \
+	( byte_stream )[ 0 ] = (uint8_t) ( ( value ) & 0x0ff )
+
+#define byte_stream_copy_from_uint48_big_endian( byte_stream, value ) \
+	( byte_stream )[ 0 ] = (uint8_t) ( ( ( value ) >> 40 ) & 0x0ff ); \
+	( byte_stream )[ 1 ] = (uint8_t) ( ( ( value ) >> 32 ) & 0x0ff ); \
+	( byte_stream )[ 2 ] = (uint8_t) ( ( ( value ) >> 24 ) & 0x0ff ); \
+	( byte_stream )[ 3 ] = (uint8_t) ( ( ( value ) >> 16 ) & 0x0ff ); \
+	( byte_stream )[ 4 ] = (uint8_t) ( ( ( value ) >> 8 ) & 0x0ff ); \
+	( byte_stream )[ 5 ] = (uint8_t) ( ( value ) & 0x0ff )
+
+#define byte_stream_copy_from_uint48_little_endian( byte_stream, value ) \
+	( byte_stream )[ 5 ] = (uint8_t) ( ( ( value ) >> 40 ) & 0x0ff ); \
+	( byte_stream )[ 4 ] = (uint8_t) ( ( ( value ) >> 32 ) & 0x0ff ); \
+	( byte_stream )[ 3 ] = (uint8_t) ( ( ( value ) >> 24 ) & 0x0ff ); \
+	( byte_stream )[ 2 ] = (uint8_t) ( ( ( value ) >> 16 ) & 0x0ff ); \
+	( byte_stream )[ 1 ] = (uint8_t) ( ( ( value ) >> 8 ) & 0x0ff ); \
+	( byte_stream )[ 0 ] = (uint8_t) ( ( value ) & 0x0ff )
+
 #define byte_stream_bit_rotate_left_8bit( byte_stream, number_of_bits ) \
 	( ( ( byte_stream ) << ( number_of_bits ) ) | ( ( byte_stream ) >> ( 8 - ( number_of_bits ) ) ) )
 
@@ -0,0 +1,160 @@
+/*
+ * LZ match copy functions
+ *
+ * Copyright (C) 2008-2019, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This software is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This software is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this software.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#if !defined( _LZ_MATCH_H )
+#define _LZ_MATCH_H
+
+#include "common.h"
+#include "memory.h"
+#include "types.h"
+
+#if defined( __cplusplus )
+extern "C" {
+#endif
+
+#if defined( _MSC_VER ) || defined( __BORLANDC__ )
+#define LZ_MATCH_INLINE __inline
+
+#elif defined( __GNUC__ )
+#define LZ_MATCH_INLINE __inline__
+
+#else
+#define LZ_MATCH_INLINE
+#endif
+
+/* The number of bytes after the end of a match that the wide copies can overwrite
+ */
+#define LZ_MATCH_COPY_SLACK_SIZE	32
+
+/* Copies a match of match_size bytes that starts distance bytes before data_offset to data_offset
+ * The copied bytes can overlap the bytes of the match, as defined by LZ77
+ * The caller must ensure that 0 < distance <= data_offset and that
+ * data_offset + match_size <= data_size
+ *
+ * If there are at least LZ_MATCH_COPY_SLACK_SIZE bytes after the end of the match
+ * the match is copied using wide copies, which can overwrite the bytes after
+ * the end of the match, otherwise the match is copied a byte at a time
+ */
+static LZ_MATCH_INLINE void lz_match_copy(
+                             uint8_t *data,
+                             size_t data_size,
+                             size_t data_offset,
+                             size_t distance,
+                             size_t match_size )
+{
+	uint8_t pattern[ 8 ];
+
+	uint8_t *destination  = &( data[ data_offset ] );
+	uint8_t *source       = &( data[ data_offset - distance ] );
+	uint8_t *end          = &( destination[ match_size ] );
+	size_t pattern_index  = 0;
+	size_t pattern_stride = 0;
+
+	if( ( data_size - data_offset - match_size ) < LZ_MATCH_COPY_SLACK_SIZE )
+	{
+		while( destination < end )
+		{
+			*destination++ = *source++;
+		}
+	}
+	else if( distance >= 32 )
+	{
+		do
+		{
+			memory_copy(
+			 destination,
+			 source,
+			 32 );
+
+			destination += 32;
+			source      += 32;
+		}
+		while( destination < end );
+	}
+	else if( distance >= 16 )
+	{
+		do
+		{
+			memory_copy(
+			 destination,
+			 source,
+			 16 );
+
+			destination += 16;
+			source      += 16;
+		}
+		while( destination < end );
+	}
+	else if( distance >= 8 )
+	{
+		do
+		{
+			memory_copy(
+			 destination,
+			 source,
+			 8 );
+
+			destination += 8;
+			source      += 8;
+		}
+		while( destination < end );
+	}
+	else if( distance == 1 )
+	{
+		memory_set(
+		 destination,
+		 *source,
+		 match_size );
+	}
+	else
+	{
+		/* Expand the repeating bytes of the match into an 8-byte pattern
+		 * and store it with a stride that is a multiple of the distance
+		 * e.g. 8 for distances 2 and 4, so that every store starts
+		 * at the same point in the pattern
+		 */
+		for( pattern_index = 0;
+		     pattern_index < 8;
+		     pattern_index++ )
+		{
+			pattern[ pattern_index ] = source[ pattern_index % distance ];
+		}
+		pattern_stride = 8 - ( 8 % distance );
+
+		do
+		{
+			memory_copy(
+			 destination,
+			 pattern,
+			 8 );
+
+			destination += pattern_stride;
+		}
+		while( destination < end );
+	}
+}
+
+#if defined( __cplusplus )
+}
+#endif
+
+#endif /* !defined( _LZ_MATCH_H ) */
+
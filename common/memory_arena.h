@@ -0,0 +1,501 @@
+/*
+ * Memory arena functions
+ *
+ * Copyright (C) 2008-2019, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This software is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This software is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this software.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#if !defined( _MEMORY_ARENA_H )
+#define _MEMORY_ARENA_H
+
+#include "common.h"
+#include "memory.h"
+#include "types.h"
+
+#if defined( HAVE_SYS_MMAN_H ) && !defined( WINAPI )
+#include <sys/mman.h>
+#endif
+
+#if defined( __cplusplus )
+extern "C" {
+#endif
+
+#if defined( _MSC_VER ) || defined( __BORLANDC__ )
+#define MEMORY_ARENA_INLINE __inline
+
+#elif defined( __GNUC__ )
+#define MEMORY_ARENA_INLINE __inline__
+
+#else
+#define MEMORY_ARENA_INLINE
+#endif
+
+/* The arena backs its blocks with huge pages if supported, e.g. when
+ * mmap with MAP_HUGETLB or MADV_HUGEPAGE, or VirtualAlloc with
+ * MEM_LARGE_PAGES is available
+ */
+#if defined( WINAPI ) && ( WINVER >= 0x0600 )
+#define HAVE_MEMORY_ARENA_HUGE_PAGES
+
+#elif !defined( WINAPI ) && defined( HAVE_MMAP ) && ( defined( MAP_ANONYMOUS ) || defined( MAP_ANON ) )
+#define HAVE_MEMORY_ARENA_HUGE_PAGES
+#endif
+
+#if !defined( MAP_ANONYMOUS ) && defined( MAP_ANON )
+#define MAP_ANONYMOUS	MAP_ANON
+#endif
+
+/* The alignment of the allocations, which is the size of a cache line
+ * and suffices for the widest SIMD loads and stores
+ */
+#define MEMORY_ARENA_ALIGNMENT		64
+
+/* The size of a huge page, to which the size of huge page backed blocks is rounded up
+ */
+#define MEMORY_ARENA_HUGE_PAGE_SIZE	( 2 * 1024 * 1024 )
+
+/* The arena flags
+ */
+enum MEMORY_ARENA_FLAGS
+{
+	MEMORY_ARENA_FLAG_HUGE_PAGES	= 0x01
+};
+
+typedef struct memory_arena_block memory_arena_block_t;
+
+/* A block is a single allocation of which the header is stored at the start
+ */
+struct memory_arena_block
+{
+	/* The previous block
+	 */
+	memory_arena_block_t *previous_block;
+
+	/* The data
+	 */
+	uint8_t *data;
+
+	/* The data size
+	 */
+	size_t data_size;
+
+	/* The allocation size
+	 */
+	size_t allocation_size;
+
+	/* Value to indicate the block was mapped instead of allocated
+	 */
+	uint8_t is_mapped;
+};
+
+typedef struct memory_arena memory_arena_t;
+
+/* An arena hands out memory from a block by advancing an offset, a block
+ * is added when an allocation does not fit, all allocations are released
+ * at once by a reset
+ */
+struct memory_arena
+{
+	/* The current, most recent, block
+	 */
+	memory_arena_block_t *current_block;
+
+	/* The offset in the current block
+	 */
+	size_t offset;
+
+	/* The minimum data size of a block
+	 */
+	size_t block_size;
+
+	/* The total size allocated since the last reset
+	 */
+	size_t allocated_size;
+
+	/* The flags
+	 */
+	uint8_t flags;
+};
+
+typedef struct memory_arena_mark memory_arena_mark_t;
+
+/* A mark is a position in an arena to which it can be rewound
+ */
+struct memory_arena_mark
+{
+	/* The block
+	 */
+	memory_arena_block_t *block;
+
+	/* The offset in the block
+	 */
+	size_t offset;
+
+	/* The total size allocated since the last reset
+	 */
+	size_t allocated_size;
+};
+
+/* Creates a block with at least data_size bytes of data
+ * Huge page backing is a hint, if huge pages are not available
+ * the block is allocated from the heap
+ * Returns a pointer to the block or NULL on error
+ */
+static MEMORY_ARENA_INLINE memory_arena_block_t *memory_arena_block_allocate(
+                                                  size_t data_size,
+                                                  uint8_t flags )
+{
+	memory_arena_block_t *block = NULL;
+	uint8_t *allocation         = NULL;
+	size_t allocation_size      = 0;
+	size_t header_size          = 0;
+	uint8_t is_mapped           = 0;
+
+#if !defined( HAVE_MEMORY_ARENA_HUGE_PAGES )
+	( void ) flags;
+#endif
+	header_size = ( sizeof( memory_arena_block_t ) + MEMORY_ARENA_ALIGNMENT - 1 ) & ~( (size_t) MEMORY_ARENA_ALIGNMENT - 1 );
+
+	if( data_size > ( (size_t) SSIZE_MAX - header_size - MEMORY_ARENA_HUGE_PAGE_SIZE ) )
+	{
+		return( NULL );
+	}
+	/* Mapped memory is page aligned, allocated memory is aligned by the extra bytes
+	 */
+	allocation_size = header_size + data_size + MEMORY_ARENA_ALIGNMENT;
+
+#if defined( HAVE_MEMORY_ARENA_HUGE_PAGES )
+	if( ( flags & MEMORY_ARENA_FLAG_HUGE_PAGES ) != 0 )
+	{
+		allocation_size = ( allocation_size + MEMORY_ARENA_HUGE_PAGE_SIZE - 1 ) & ~( (size_t) MEMORY_ARENA_HUGE_PAGE_SIZE - 1 );
+
+#if defined( WINAPI )
+		/* Large pages require the SeLockMemoryPrivilege, without it
+		 * the memory is mapped using regular pages
+		 */
+		if( GetLargePageMinimum() == MEMORY_ARENA_HUGE_PAGE_SIZE )
+		{
+			allocation = (uint8_t *) VirtualAlloc(
+			                          NULL,
+			                          (SIZE_T) allocation_size,
+			                          MEM_COMMIT | MEM_RESERVE | MEM_LARGE_PAGES,
+			                          PAGE_READWRITE );
+		}
+		if( allocation == NULL )
+		{
+			allocation = (uint8_t *) VirtualAlloc(
+			                          NULL,
+			                          (SIZE_T) allocation_size,
+			                          MEM_COMMIT | MEM_RESERVE,
+			                          PAGE_READWRITE );
+		}
+#else
+#if defined( MAP_HUGETLB )
+		/* Explicit huge pages are only available if they were reserved
+		 */
+		allocation = (uint8_t *) mmap(
+		                          NULL,
+		                          allocation_size,
+		                          PROT_READ | PROT_WRITE,
+		                          MAP_PRIVATE | MAP_ANONYMOUS | MAP_HUGETLB,
+		                          -1,
+		                          0 );
+
+		if( allocation == (uint8_t *) MAP_FAILED )
+		{
+			allocation = NULL;
+		}
+#endif
+		if( allocation == NULL )
+		{
+			allocation = (uint8_t *) mmap(
+			                          NULL,
+			                          allocation_size,
+			                          PROT_READ | PROT_WRITE,
+			                          MAP_PRIVATE | MAP_ANONYMOUS,
+			                          -1,
+			                          0 );
+
+			if( allocation == (uint8_t *) MAP_FAILED )
+			{
+				allocation = NULL;
+			}
+#if defined( HAVE_MADVISE ) && defined( MADV_HUGEPAGE )
+			/* The advice is only a hint, hence failure is ignored
+			 */
+			else
+			{
+				madvise(
+				 (void *) allocation,
+				 allocation_size,
+				 MADV_HUGEPAGE );
+			}
+#endif
+		}
+#endif /* defined( WINAPI ) */
+
+		if( allocation != NULL )
+		{
+			is_mapped = 1;
+		}
+	}
+#endif /* defined( HAVE_MEMORY_ARENA_HUGE_PAGES ) */
+
+	if( allocation == NULL )
+	{
+		allocation = (uint8_t *) memory_allocate(
+		                          allocation_size );
+
+		if( allocation == NULL )
+		{
+			return( NULL );
+		}
+	}
+	block = (memory_arena_block_t *) allocation;
+
+	block->previous_block  = NULL;
+	block->data            = (uint8_t *) ( ( (intptr_t) &( allocation[ header_size ] ) + MEMORY_ARENA_ALIGNMENT - 1 ) & ~( (intptr_t) MEMORY_ARENA_ALIGNMENT - 1 ) );
+	block->data_size       = allocation_size - (size_t) ( block->data - allocation );
+	block->allocation_size = allocation_size;
+	block->is_mapped       = is_mapped;
+
+	return( block );
+}
+
+/* Frees a block
+ */
+static MEMORY_ARENA_INLINE void memory_arena_block_free(
+                                 memory_arena_block_t *block )
+{
+	if( block == NULL )
+	{
+		return;
+	}
+#if defined( HAVE_MEMORY_ARENA_HUGE_PAGES )
+	if( block->is_mapped != 0 )
+	{
+#if defined( WINAPI )
+		VirtualFree(
+		 (LPVOID) block,
+		 0,
+		 MEM_RELEASE );
+#else
+		munmap(
+		 (void *) block,
+		 block->allocation_size );
+#endif
+		return;
+	}
+#endif
+	memory_free(
+	 block );
+}
+
+/* Initializes an arena with a first block of at least block_size bytes
+ * Returns 1 if successful or -1 on error
+ */
+static MEMORY_ARENA_INLINE int memory_arena_initialize(
+                                memory_arena_t *arena,
+                                size_t block_size,
+                                uint8_t flags )
+{
+	if( ( arena == NULL )
+	 || ( block_size == 0 ) )
+	{
+		return( -1 );
+	}
+	arena->current_block = memory_arena_block_allocate(
+	                        block_size,
+	                        flags );
+
+	if( arena->current_block == NULL )
+	{
+		return( -1 );
+	}
+	arena->offset         = 0;
+	arena->block_size     = block_size;
+	arena->allocated_size = 0;
+	arena->flags          = flags;
+
+	return( 1 );
+}
+
+/* Frees the blocks of an arena
+ */
+static MEMORY_ARENA_INLINE void memory_arena_free(
+                                 memory_arena_t *arena )
+{
+	memory_arena_block_t *block = NULL;
+
+	if( arena == NULL )
+	{
+		return;
+	}
+	while( arena->current_block != NULL )
+	{
+		block = arena->current_block;
+
+		arena->current_block = block->previous_block;
+
+		memory_arena_block_free(
+		 block );
+	}
+	arena->offset         = 0;
+	arena->allocated_size = 0;
+}
+
+/* Allocates size bytes from an arena aligned to MEMORY_ARENA_ALIGNMENT
+ * The memory is valid until the arena is reset, rewound to a preceding
+ * mark or freed, and is not initialized
+ * Returns a pointer to the memory or NULL on error
+ */
+static MEMORY_ARENA_INLINE void *memory_arena_allocate(
+                                  memory_arena_t *arena,
+                                  size_t size )
+{
+	memory_arena_block_t *block = NULL;
+	uint8_t *data               = NULL;
+	size_t aligned_size         = 0;
+
+	if( ( arena == NULL )
+	 || ( size > ( (size_t) SSIZE_MAX - MEMORY_ARENA_ALIGNMENT ) ) )
+	{
+		return( NULL );
+	}
+	aligned_size = ( size + MEMORY_ARENA_ALIGNMENT - 1 ) & ~( (size_t) MEMORY_ARENA_ALIGNMENT - 1 );
+
+	block = arena->current_block;
+
+	if( ( block == NULL )
+	 || ( aligned_size > ( block->data_size - arena->offset ) ) )
+	{
+		block = memory_arena_block_allocate(
+		         ( aligned_size > arena->block_size ) ? aligned_size : arena->block_size,
+		         arena->flags );
+
+		if( block == NULL )
+		{
+			return( NULL );
+		}
+		block->previous_block = arena->current_block;
+
+		arena->current_block = block;
+		arena->offset        = 0;
+	}
+	data = &( block->data[ arena->offset ] );
+
+	arena->offset         += aligned_size;
+	arena->allocated_size += aligned_size;
+
+	return( (void *) data );
+}
+
+/* Resets an arena, which releases all allocations
+ * If the allocations since the previous reset required multiple blocks
+ * these are replaced by a single block that fits all of them, hence
+ * a recurring pattern of allocations does not add blocks once the arena
+ * is large enough
+ * Returns 1 if successful or -1 on error
+ */
+static MEMORY_ARENA_INLINE int memory_arena_reset(
+                                memory_arena_t *arena )
+{
+	size_t allocated_size = 0;
+
+	if( arena == NULL )
+	{
+		return( -1 );
+	}
+	if( ( arena->current_block != NULL )
+	 && ( arena->current_block->previous_block == NULL ) )
+	{
+		arena->offset         = 0;
+		arena->allocated_size = 0;
+
+		return( 1 );
+	}
+	allocated_size = arena->allocated_size;
+
+	memory_arena_free(
+	 arena );
+
+	if( allocated_size > arena->block_size )
+	{
+		arena->block_size = allocated_size;
+	}
+	arena->current_block = memory_arena_block_allocate(
+	                        arena->block_size,
+	                        arena->flags );
+
+	if( arena->current_block == NULL )
+	{
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Retrieves the current position of an arena
+ */
+static MEMORY_ARENA_INLINE void memory_arena_get_mark(
+                                 memory_arena_t *arena,
+                                 memory_arena_mark_t *mark )
+{
+	if( ( arena == NULL )
+	 || ( mark == NULL ) )
+	{
+		return;
+	}
+	mark->block          = arena->current_block;
+	mark->offset         = arena->offset;
+	mark->allocated_size = arena->allocated_size;
+}
+
+/* Rewinds an arena to a mark, which releases the allocations made after the mark
+ * Blocks that were added after the mark are freed
+ * The mark must have been retrieved after the last reset
+ */
+static MEMORY_ARENA_INLINE void memory_arena_rewind(
+                                 memory_arena_t *arena,
+                                 memory_arena_mark_t *mark )
+{
+	memory_arena_block_t *block = NULL;
+
+	if( ( arena == NULL )
+	 || ( mark == NULL ) )
+	{
+		return;
+	}
+	while( ( arena->current_block != NULL )
+	    && ( arena->current_block != mark->block ) )
+	{
+		block = arena->current_block;
+
+		arena->current_block = block->previous_block;
+
+		memory_arena_block_free(
+		 block );
+	}
+	arena->offset         = mark->offset;
+	arena->allocated_size = mark->allocated_size;
+}
+
+#if defined( __cplusplus )
+}
+#endif
+
+#endif /* !defined( _MEMORY_ARENA_H ) */
+
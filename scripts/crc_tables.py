@@ -0,0 +1,193 @@
+#!/usr/bin/python
+# -*- coding: utf-8 -*-
+"""Script to generate the static CRC-32 and CRC-64 lookup tables.
+
+Usage: crc_tables.py [crc32|crc64] > src/crc32_tables.c
+"""
+
+from __future__ import print_function
+from __future__ import unicode_literals
+
+import sys
+
+
+CRC32_POLYNOMIALS = [
+    ('rfc1952', 0xedb88320, 'RFC 1952'),
+    ('castagnoli', 0x82f63b78, 'Castagnoli (CRC-32C)')]
+
+CRC64_POLYNOMIALS = [
+    ('default', 0x9a6c9329ac4bc9b5, 'default, as used by crc64_calculate_2'),
+    ('ecma182', 0xc96c5795d7870f42, 'ECMA-182 (CRC-64/XZ)')]
+
+LICENSE = """/*
+ * {0:s}
+ *
+ * This file was generated by scripts/crc_tables.py, do not edit.
+ *
+ * Copyright (C) 2008-2019, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This software is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This software is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this software.  If not, see <http://www.gnu.org/licenses/>.
+ */
+"""
+
+
+def reverse_bits(value, number_of_bits):
+  """Reverses the bit order of a value."""
+  reversed_value = 0
+  for _ in range(0, number_of_bits):
+    reversed_value = (reversed_value << 1) | (value & 1)
+    value >>= 1
+  return reversed_value
+
+
+def calculate_slicing_tables(polynomial, number_of_tables):
+  """Calculates the slicing tables of a reversed polynomial."""
+  table = []
+  for table_index in range(0, 256):
+    checksum = table_index
+    for _ in range(0, 8):
+      if checksum & 1:
+        checksum = polynomial ^ (checksum >> 1)
+      else:
+        checksum = checksum >> 1
+    table.append(checksum)
+
+  tables = [table]
+  for _ in range(1, number_of_tables):
+    previous_table = tables[-1]
+    tables.append([
+        table[checksum & 0xff] ^ (checksum >> 8) for checksum in previous_table])
+
+  return tables
+
+
+def calculate_remainder(polynomial, number_of_bits, exponent):
+  """Calculates x^exponent mod P(x) with a normal polynomial."""
+  mask = (1 << number_of_bits) - 1
+  remainder = 1
+  for _ in range(0, exponent):
+    if remainder & (1 << (number_of_bits - 1)):
+      remainder = ((remainder << 1) ^ polynomial) & mask
+    else:
+      remainder = (remainder << 1) & mask
+  return remainder
+
+
+def calculate_crc32_folding_constants(polynomial):
+  """Calculates the CRC-32 folding constants of a reversed polynomial."""
+  polynomial = reverse_bits(polynomial, 32)
+  constants = [
+      reverse_bits(calculate_remainder(polynomial, 32, exponent), 32) << 1
+      for exponent in ((4 * 128) + 32, (4 * 128) - 32, 128 + 32, 128 - 32, 64)]
+  constants.append(0)
+
+  full_polynomial = 0x100000000 | polynomial
+  quotient = 0
+  remainder = 1 << 64
+  for bit_index in range(64, 31, -1):
+    if remainder & (1 << bit_index):
+      remainder ^= full_polynomial << (bit_index - 32)
+      quotient |= 1 << (bit_index - 32)
+
+  constants.append(reverse_bits(full_polynomial, 33))
+  constants.append(reverse_bits(quotient, 33))
+  return constants
+
+
+def calculate_crc64_folding_constants(polynomial):
+  """Calculates the CRC-64 folding constants of a reversed polynomial."""
+  polynomial = reverse_bits(polynomial, 64)
+  return [
+      reverse_bits(calculate_remainder(polynomial, 64, exponent), 64)
+      for exponent in ((4 * 128) + 63, (4 * 128) - 1, 128 + 63, 128 - 1)]
+
+
+def print_values(values, value_format, values_per_line, indentation):
+  """Prints values as the body of an array initializer."""
+  for value_index in range(0, len(values), values_per_line):
+    line_values = values[value_index:value_index + values_per_line]
+    line = ', '.join([value_format.format(value) for value in line_values])
+    if value_index + values_per_line < len(values):
+      line = '{0:s},'.format(line)
+    print('{0:s}{1:s}'.format(indentation, line))
+
+
+def print_tables(
+    bits, polynomials, number_of_tables, calculate_folding_constants):
+  """Prints the tables of a CRC."""
+  if bits == 32:
+    value_type = 'uint32_t'
+    value_format = '0x{0:08x}UL'
+  else:
+    value_type = 'uint64_t'
+    value_format = '0x{0:016x}ULL'
+
+  print(LICENSE.format('CRC-{0:d} lookup tables'.format(bits)))
+  print('#include <common.h>')
+  print('#include <types.h>')
+  print('')
+  print('#include "crc{0:d}_tables.h"'.format(bits))
+
+  for name, polynomial, description in polynomials:
+    tables = calculate_slicing_tables(polynomial, number_of_tables)
+    constants = calculate_folding_constants(polynomial)
+
+    print('')
+    print('/* The slicing tables of the {0:s} polynomial'.format(description))
+    print(' * Polynomial: 0x{0:0{1:d}x}'.format(polynomial, bits // 4))
+    print(' */')
+    print('const {0:s} crc{1:d}_slicing_tables_{2:s}[ {3:d} ][ 256 ] = {{'.format(
+        value_type, bits, name, number_of_tables))
+
+    for table_index, table in enumerate(tables):
+      print('\t{')
+      print_values(table, value_format, 4, '\t\t')
+      if table_index + 1 < number_of_tables:
+        print('\t},')
+      else:
+        print('\t}')
+
+    print('};')
+    print('')
+    print('/* The folding constants of the {0:s} polynomial'.format(description))
+    print(' */')
+    print('const uint64_t crc{0:d}_folding_constants_{1:s}[ {2:d} ] = {{'.format(
+        bits, name, len(constants)))
+    print_values(constants, '0x{0:016x}ULL', 2, '\t')
+    print('};')
+
+  print('')
+
+
+def Main():
+  """The main program function."""
+  if len(sys.argv) != 2 or sys.argv[1] not in ('crc32', 'crc64'):
+    print(__doc__)
+    return False
+
+  if sys.argv[1] == 'crc32':
+    print_tables(32, CRC32_POLYNOMIALS, 16, calculate_crc32_folding_constants)
+  else:
+    print_tables(64, CRC64_POLYNOMIALS, 8, calculate_crc64_folding_constants)
+
+  return True
+
+
+if __name__ == '__main__':
+  if not Main():
+    sys.exit(1)
+  else:
+    sys.exit(0)
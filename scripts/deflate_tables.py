@@ -0,0 +1,158 @@
+#!/usr/bin/python
+# -*- coding: utf-8 -*-
+"""Script to generate the static deflate fixed Huffman tables.
+
+Usage: deflate_tables.py > src/deflate_tables.c
+"""
+
+from __future__ import print_function
+from __future__ import unicode_literals
+
+import sys
+
+
+# The number of bits used to index the primary Huffman lookup table,
+# the codes of the fixed Huffman tables are at most 9 bits and only
+# require the primary table.
+LOOKUP_TABLE_NUMBER_OF_BITS = 9
+
+MAXIMUM_NUMBER_OF_BITS = 15
+
+LICENSE = """/*
+ * {0:s}
+ *
+ * This file was generated by scripts/deflate_tables.py, do not edit.
+ *
+ * Copyright (C) 2008-2019, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This software is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This software is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this software.  If not, see <http://www.gnu.org/licenses/>.
+ */
+"""
+
+
+def reverse_bits(value, number_of_bits):
+  """Reverses the bit order of a value."""
+  reversed_value = 0
+  for _ in range(0, number_of_bits):
+    reversed_value = (reversed_value << 1) | (value & 1)
+    value >>= 1
+  return reversed_value
+
+
+def get_fixed_code_sizes():
+  """Retrieves the code sizes of the fixed Huffman literals and distances."""
+  literals_code_sizes = (
+      [8] * (144 - 0) + [9] * (256 - 144) + [7] * (280 - 256) +
+      [8] * (288 - 280))
+  distances_code_sizes = [5] * 30
+  return literals_code_sizes, distances_code_sizes
+
+
+def construct_table(code_sizes):
+  """Constructs a Huffman table as deflate_huffman_table_construct does."""
+  code_counts = [0] * 16
+  for code_size in code_sizes:
+    code_counts[code_size] += 1
+
+  codes = sorted(
+      [symbol for symbol, code_size in enumerate(code_sizes) if code_size],
+      key=lambda symbol: (code_sizes[symbol], symbol))
+  codes.extend([0] * (288 - len(codes)))
+
+  lookup_table = [0] * (1 << LOOKUP_TABLE_NUMBER_OF_BITS)
+  huffman_code = 0
+  code_index = 0
+  for code_size in range(1, MAXIMUM_NUMBER_OF_BITS + 1):
+    for _ in range(0, code_counts[code_size]):
+      if code_size > LOOKUP_TABLE_NUMBER_OF_BITS:
+        raise ValueError('Unsupported code size: {0:d}'.format(code_size))
+
+      symbol = codes[code_index]
+      code_index += 1
+
+      lookup_value = (code_size << 9) | symbol
+      reversed_huffman_code = reverse_bits(huffman_code, code_size)
+      for lookup_table_index in range(
+          reversed_huffman_code, len(lookup_table), 1 << code_size):
+        lookup_table[lookup_table_index] = lookup_value
+
+      huffman_code += 1
+    huffman_code <<= 1
+
+  return codes, code_counts, lookup_table
+
+
+def print_values(values, value_format, values_per_line, indentation):
+  """Prints values as the body of an array initializer."""
+  for value_index in range(0, len(values), values_per_line):
+    line_values = values[value_index:value_index + values_per_line]
+    line = ', '.join([value_format.format(value) for value in line_values])
+    if value_index + values_per_line < len(values):
+      line = '{0:s},'.format(line)
+    print('{0:s}{1:s}'.format(indentation, line))
+
+
+def print_table(name, description, code_sizes):
+  """Prints a Huffman table."""
+  codes, code_counts, lookup_table = construct_table(code_sizes)
+
+  print('')
+  print('/* The fixed Huffman {0:s} table'.format(description))
+  print(' * The secondary lookup tables are not used since the codes are at most 9 bits')
+  print(' */')
+  print('const deflate_huffman_table_t deflate_fixed_huffman_{0:s}_table = {{'.format(
+      name))
+  print('\t{0:d},'.format(MAXIMUM_NUMBER_OF_BITS))
+  print('\t{')
+  print_values(codes, '{0:d}', 16, '\t\t')
+  print('\t},')
+  print('\t{')
+  print_values(code_counts, '{0:d}', 16, '\t\t')
+  print('\t},')
+  print('\t{0:d},'.format(MAXIMUM_NUMBER_OF_BITS + 1))
+  print('\t{')
+  print_values(lookup_table, '0x{0:04x}', 8, '\t\t')
+  print('\t}')
+  print('};')
+
+
+def Main():
+  """The main program function."""
+  if len(sys.argv) != 1:
+    print(__doc__)
+    return False
+
+  literals_code_sizes, distances_code_sizes = get_fixed_code_sizes()
+
+  print(LICENSE.format('Deflate fixed Huffman tables'))
+  print('#include <common.h>')
+  print('#include <types.h>')
+  print('')
+  print('#include "deflate.h"')
+  print('#include "deflate_tables.h"')
+
+  print_table('literals', 'literals and lengths', literals_code_sizes)
+  print_table('distances', 'distances', distances_code_sizes)
+  print('')
+
+  return True
+
+
+if __name__ == '__main__':
+  if not Main():
+    sys.exit(1)
+  else:
+    sys.exit(0)
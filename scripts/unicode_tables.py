@@ -0,0 +1,365 @@
+#!/usr/bin/python
+# -*- coding: utf-8 -*-
+"""Script to generate the static Unicode case folding and NFD tables.
+
+Usage: unicode_tables.py [UCD_DIRECTORY] > src/unicode_tables.c
+
+The tables are generated from CaseFolding.txt and UnicodeData.txt in
+UCD_DIRECTORY. If no directory is specified the tables are generated from
+the Unicode database of the Python unicodedata module, where the simple
+case folding is derived from str.casefold() and str.lower().
+"""
+
+from __future__ import print_function
+from __future__ import unicode_literals
+
+import os
+import re
+import sys
+
+# Prevent scripts/unicodedata.py from shadowing the Python unicodedata module.
+sys.path = [
+    path for path in sys.path
+    if os.path.abspath(path or '.') != os.path.dirname(os.path.abspath(__file__))]
+
+import unicodedata  # pylint: disable=wrong-import-position
+
+
+# The number of Unicode characters per block of the second stage tables.
+BLOCK_SIZE = 256
+
+MAXIMUM_UNICODE_CHARACTER = 0x0010ffff
+
+# The Hangul syllables are decomposed algorithmically.
+HANGUL_SYLLABLES_FIRST = 0x0000ac00
+HANGUL_SYLLABLES_LAST = 0x0000d7a3
+
+LICENSE = """/*
+ * {0:s}
+ *
+ * This file was generated by scripts/unicode_tables.py, do not edit.
+ * Unicode version: {1:s}
+ *
+ * Copyright (C) 2008-2019, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This software is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This software is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this software.  If not, see <http://www.gnu.org/licenses/>.
+ */
+"""
+
+
+def get_unicode_characters():
+  """Retrieves all Unicode characters except the surrogates."""
+  for unicode_character in range(0, MAXIMUM_UNICODE_CHARACTER + 1):
+    if 0x0000d800 <= unicode_character <= 0x0000dfff:
+      continue
+    yield unicode_character
+
+
+def read_ucd_file(path):
+  """Reads the semicolon separated fields of an UCD file."""
+  with open(path, 'r') as file_object:
+    for line in file_object.readlines():
+      line = line.split('#', 1)[0].strip()
+      if not line:
+        continue
+
+      yield [field.strip() for field in line.split(';')]
+
+
+def get_ucd_version(ucd_directory):
+  """Retrieves the Unicode version from the header of CaseFolding.txt."""
+  path = os.path.join(ucd_directory, 'CaseFolding.txt')
+  with open(path, 'r') as file_object:
+    match = re.match(r'# CaseFolding-([0-9.]+)\.txt', file_object.readline())
+
+  if not match:
+    return 'unknown'
+
+  return match.group(1)
+
+
+def read_case_folding(ucd_directory):
+  """Reads the simple case folding mappings."""
+  case_folding = {}
+
+  if ucd_directory:
+    path = os.path.join(ucd_directory, 'CaseFolding.txt')
+    for fields in read_ucd_file(path):
+      if fields[1] not in ('C', 'S'):
+        continue
+
+      case_folding[int(fields[0], 16)] = int(fields[2], 16)
+
+  else:
+    for unicode_character in get_unicode_characters():
+      unicode_string = chr(unicode_character)
+
+      mapped_string = unicode_string.casefold()
+      if len(mapped_string) != 1:
+        # The full case folding maps to multiple characters, where
+        # the simple case folding if present is the lower case.
+        mapped_string = unicode_string.lower()
+
+      if len(mapped_string) == 1 and mapped_string != unicode_string:
+        case_folding[unicode_character] = ord(mapped_string)
+
+  return case_folding
+
+
+def read_decompositions(ucd_directory):
+  """Reads the canonical decompositions and combining classes."""
+  combining_classes = {}
+  decompositions = {}
+
+  if ucd_directory:
+    path = os.path.join(ucd_directory, 'UnicodeData.txt')
+    for fields in read_ucd_file(path):
+      unicode_character = int(fields[0], 16)
+
+      combining_class = int(fields[3], 10)
+      if combining_class != 0:
+        combining_classes[unicode_character] = combining_class
+
+      if fields[5] and fields[5][0] != '<':
+        decompositions[unicode_character] = [
+            int(value, 16) for value in fields[5].split(' ')]
+
+  else:
+    for unicode_character in get_unicode_characters():
+      unicode_string = chr(unicode_character)
+
+      combining_class = unicodedata.combining(unicode_string)
+      if combining_class != 0:
+        combining_classes[unicode_character] = combining_class
+
+      decomposition = unicodedata.decomposition(unicode_string)
+      if decomposition and decomposition[0] != '<':
+        decompositions[unicode_character] = [
+            int(value, 16) for value in decomposition.split(' ')]
+
+  return combining_classes, decompositions
+
+
+def get_nfd_decomposition(unicode_character, combining_classes, decompositions):
+  """Determines the full canonical decomposition of an Unicode character."""
+  decomposition = decompositions.get(unicode_character, None)
+  if decomposition is None:
+    return [unicode_character]
+
+  nfd_decomposition = []
+  for decomposed_character in decomposition:
+    nfd_decomposition.extend(get_nfd_decomposition(
+        decomposed_character, combining_classes, decompositions))
+
+  # Apply the canonical ordering to the combining characters, the sort is
+  # stable and characters with combining class 0 are never reordered.
+  start_index = 0
+  while start_index < len(nfd_decomposition):
+    end_index = start_index
+    while (end_index < len(nfd_decomposition) and
+           combining_classes.get(nfd_decomposition[end_index], 0) != 0):
+      end_index += 1
+
+    if end_index > start_index + 1:
+      nfd_decomposition[start_index:end_index] = sorted(
+          nfd_decomposition[start_index:end_index],
+          key=lambda character: combining_classes.get(character, 0))
+
+    start_index = end_index + 1
+
+  return nfd_decomposition
+
+
+def build_two_stage_table(values, default_value):
+  """Builds a two-stage table with deduplicated blocks.
+
+  Returns the block index of every block of Unicode characters up to the last
+  block that contains a value other than the default value and the blocks.
+  """
+  last_unicode_character = max(values.keys())
+  number_of_pages = (last_unicode_character // BLOCK_SIZE) + 1
+
+  blocks = []
+  block_indexes = {}
+  pages = []
+  for page_index in range(0, number_of_pages):
+    first_unicode_character = page_index * BLOCK_SIZE
+    block = tuple([
+        values.get(first_unicode_character + block_offset, default_value)
+        for block_offset in range(0, BLOCK_SIZE)])
+
+    block_index = block_indexes.get(block, None)
+    if block_index is None:
+      block_index = len(blocks)
+      block_indexes[block] = block_index
+      blocks.append(block)
+
+    pages.append(block_index)
+
+  return pages, blocks
+
+
+def print_values(values, value_format, values_per_line, indentation):
+  """Prints values as the body of an array initializer."""
+  for value_index in range(0, len(values), values_per_line):
+    line_values = values[value_index:value_index + values_per_line]
+    line = ', '.join([value_format.format(value) for value in line_values])
+    if value_index + values_per_line < len(values):
+      line = '{0:s},'.format(line)
+    print('{0:s}{1:s}'.format(indentation, line))
+
+
+def print_array(value_type, name, values, value_format, values_per_line):
+  """Prints an array."""
+  print('')
+  print('const {0:s} {1:s}[ {2:d} ] = {{'.format(value_type, name, len(values)))
+  print_values(values, value_format, values_per_line, '\t')
+  print('};')
+
+
+def print_case_folding_tables(case_folding):
+  """Prints the case folding tables.
+
+  The blocks contain an index into the deltas, which are the differences
+  between the case folded and the original Unicode character.
+  """
+  deltas = [0]
+  delta_indexes = {0: 0}
+  values = {}
+  for unicode_character, mapped_character in case_folding.items():
+    delta = mapped_character - unicode_character
+    delta_index = delta_indexes.get(delta, None)
+    if delta_index is None:
+      delta_index = len(deltas)
+      delta_indexes[delta] = delta_index
+      deltas.append(delta)
+
+    values[unicode_character] = delta_index
+
+  if len(deltas) > 256:
+    raise ValueError('Unsupported number of case folding deltas: {0:d}'.format(
+        len(deltas)))
+
+  pages, blocks = build_two_stage_table(values, 0)
+
+  print('')
+  print('/* The case folding tables')
+  print(' * The {0:d} pages map a block of {1:d} Unicode characters onto one of the {2:d} distinct blocks'.format(
+      len(pages), BLOCK_SIZE, len(blocks)))
+  print(' * and the blocks contain the index of the difference between the case folded and the Unicode character')
+  print(' */')
+  print('const uint32_t unicode_tables_case_folding_number_of_pages = {0:d};'.format(
+      len(pages)))
+
+  print_array(
+      'uint8_t', 'unicode_tables_case_folding_pages', pages, '{0:d}', 16)
+  print_array(
+      'uint8_t', 'unicode_tables_case_folding_blocks',
+      [value for block in blocks for value in block], '{0:d}', 16)
+  print_array(
+      'int32_t', 'unicode_tables_case_folding_deltas', deltas, '{0:d}', 8)
+
+
+def print_nfd_tables(combining_classes, decompositions):
+  """Prints the NFD tables.
+
+  The blocks contain an index into the sequences, where a sequence consists
+  of the number of characters followed by the characters of the decomposition.
+  Index 0 represents that the Unicode character has no decomposition.
+  """
+  maximum_decomposition_length = 0
+  sequences = [0]
+  values = {}
+  for unicode_character in sorted(decompositions.keys()):
+    if HANGUL_SYLLABLES_FIRST <= unicode_character <= HANGUL_SYLLABLES_LAST:
+      continue
+
+    nfd_decomposition = get_nfd_decomposition(
+        unicode_character, combining_classes, decompositions)
+
+    maximum_decomposition_length = max(
+        maximum_decomposition_length, len(nfd_decomposition))
+
+    values[unicode_character] = len(sequences)
+    sequences.append(len(nfd_decomposition))
+    sequences.extend(nfd_decomposition)
+
+  if len(sequences) > 65536:
+    raise ValueError('Unsupported size of NFD sequences: {0:d}'.format(
+        len(sequences)))
+
+  pages, blocks = build_two_stage_table(values, 0)
+
+  if len(blocks) > 256:
+    raise ValueError('Unsupported number of NFD blocks: {0:d}'.format(
+        len(blocks)))
+
+  print('')
+  print('/* The NFD tables')
+  print(' * The {0:d} pages map a block of {1:d} Unicode characters onto one of the {2:d} distinct blocks'.format(
+      len(pages), BLOCK_SIZE, len(blocks)))
+  print(' * and the blocks contain the index of the decomposition in the sequences')
+  print(' * The longest decomposition consists of {0:d} characters'.format(
+      maximum_decomposition_length))
+  print(' */')
+  print('const uint32_t unicode_tables_nfd_number_of_pages = {0:d};'.format(
+      len(pages)))
+
+  print_array('uint8_t', 'unicode_tables_nfd_pages', pages, '{0:d}', 16)
+  print_array(
+      'uint16_t', 'unicode_tables_nfd_blocks',
+      [value for block in blocks for value in block], '{0:d}', 16)
+  print_array(
+      'uint32_t', 'unicode_tables_nfd_sequences', sequences, '0x{0:04x}', 8)
+
+
+def Main():
+  """The main program function."""
+  if len(sys.argv) > 2:
+    print(__doc__)
+    return False
+
+  ucd_directory = None
+  if len(sys.argv) == 2:
+    ucd_directory = sys.argv[1]
+
+  if ucd_directory:
+    unicode_version = get_ucd_version(ucd_directory)
+  else:
+    unicode_version = '{0:s} (Python unicodedata)'.format(
+        unicodedata.unidata_version)
+
+  case_folding = read_case_folding(ucd_directory)
+  combining_classes, decompositions = read_decompositions(ucd_directory)
+
+  print(LICENSE.format('Unicode case folding and NFD tables', unicode_version))
+  print('#include <common.h>')
+  print('#include <types.h>')
+  print('')
+  print('#include "unicode_tables.h"')
+
+  print_case_folding_tables(case_folding)
+  print_nfd_tables(combining_classes, decompositions)
+  print('')
+
+  return True
+
+
+if __name__ == '__main__':
+  if not Main():
+    sys.exit(1)
+  else:
+    sys.exit(0)
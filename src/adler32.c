@@ -29,13 +29,15 @@
 
 #include "adler32.h"
 #include "assorted_libcerror.h"
+#include "cpu_features.h"
 
-typedef union
-{
-	uint8_t vector __attribute__ ((vector_size (8)));
-	uint8_t integer[ 8 ];
+#if defined( HAVE_CPU_FEATURES_X86 )
+#include <immintrin.h>
+
+#elif defined( HAVE_CPU_FEATURES_ARM64 )
+#include <arm_neon.h>
 
-} adler32_8byte_vector_t;
+#endif
 
 /* The largest primary (or scalar) available
  * supported by a single load and store instruction
@@ -101,9 +103,10 @@ int checksum_calculate_adler32_basic1(
 		lower_word += buffer[ buffer_index ];
 		upper_word += lower_word;
 
-		if( ( buffer_index != 0 )
-		 && ( ( ( buffer_index % 0x15b0 ) == 0 )
-		  || ( buffer_index == size - 1 ) ) )
+		/* The modulo calculation is needed per 5552 (0x15b0) bytes
+		 */
+		if( ( ( ( buffer_index + 1 ) % 0x15b0 ) == 0 )
+		 || ( buffer_index == size - 1 ) )
 		{
 			lower_word = lower_word % 0xfff1;
 			upper_word = upper_word % 0xfff1;
@@ -173,8 +176,9 @@ int checksum_calculate_adler32_basic2(
 			lower_word += buffer[ buffer_offset ];
 			upper_word += lower_word;
 
-			if( ( buffer_offset != 0 )
-			 && ( ( buffer_offset % 0x15b0 ) == 0 ) )
+			/* The modulo calculation is needed per 5552 (0x15b0) bytes
+			 */
+			if( ( ( buffer_offset + 1 ) % 0x15b0 ) == 0 )
 			{
 				lower_word %= 0xfff1;
 				upper_word %= 0xfff1;
@@ -1356,7 +1360,613 @@ int checksum_calculate_adler32_cpu_aligned(
 	return( 1 );
 }
 
+#if defined( HAVE_CPU_FEATURES_X86 ) || defined( HAVE_CPU_FEATURES_ARM64 )
+
+/* The multipliers of the upper word (s2) of the bytes in a 64, 32 or 16 byte block
+ */
+static const uint8_t adler32_simd_multipliers[ 64 ] = {
+	64, 63, 62, 61, 60, 59, 58, 57, 56, 55, 54, 53, 52, 51, 50, 49,
+	48, 47, 46, 45, 44, 43, 42, 41, 40, 39, 38, 37, 36, 35, 34, 33,
+	32, 31, 30, 29, 28, 27, 26, 25, 24, 23, 22, 21, 20, 19, 18, 17,
+	16, 15, 14, 13, 12, 11, 10,  9,  8,  7,  6,  5,  4,  3,  2,  1 };
+
+#endif /* defined( HAVE_CPU_FEATURES_X86 ) || defined( HAVE_CPU_FEATURES_ARM64 ) */
+
+#if defined( HAVE_CPU_FEATURES_X86 )
+
+/* Calculates the Adler-32 of a buffer using SSSE3
+ * The size must be a multiple of 32
+ * Returns the Adler-32
+ */
+CPU_FEATURES_TARGET( "ssse3" )
+static uint32_t adler32_calculate_ssse3(
+                 uint32_t checksum_value,
+                 const uint8_t *buffer,
+                 size_t size )
+{
+	__m128i lower_word_sums;
+	__m128i multipliers1;
+	__m128i multipliers2;
+	__m128i ones;
+	__m128i previous_lower_word_sums;
+	__m128i upper_word_sums;
+	__m128i value1;
+	__m128i value2;
+	__m128i zero;
+
+	size_t number_of_blocks = 0;
+	uint32_t lower_word     = 0;
+	uint32_t upper_word     = 0;
+
+	lower_word = checksum_value & 0xffff;
+	upper_word = ( checksum_value >> 16 ) & 0xffff;
+
+	multipliers1 = _mm_loadu_si128(
+	                (const __m128i *) &( adler32_simd_multipliers[ 32 ] ) );
+	multipliers2 = _mm_loadu_si128(
+	                (const __m128i *) &( adler32_simd_multipliers[ 48 ] ) );
+
+	ones = _mm_set1_epi16( 1 );
+	zero = _mm_setzero_si128();
+
+	while( size > 0 )
+	{
+		/* The modulo calculation is needed per 5552 (0x15b0) bytes
+		 * 5552 / 32 = 173
+		 */
+		number_of_blocks = size / 32;
+
+		if( number_of_blocks > 173 )
+		{
+			number_of_blocks = 173;
+		}
+		size -= number_of_blocks * 32;
+
+		/* The lower word is added to the upper word for every byte
+		 */
+		previous_lower_word_sums = _mm_set_epi32(
+		                            0,
+		                            0,
+		                            0,
+		                            (int) ( lower_word * number_of_blocks ) );
+
+		upper_word_sums = _mm_set_epi32(
+		                   0,
+		                   0,
+		                   0,
+		                   (int) upper_word );
+
+		lower_word_sums = _mm_setzero_si128();
+
+		while( number_of_blocks > 0 )
+		{
+			value1 = _mm_loadu_si128(
+			          (const __m128i *) buffer );
+			value2 = _mm_loadu_si128(
+			          (const __m128i *) &( buffer[ 16 ] ) );
+
+			previous_lower_word_sums = _mm_add_epi32(
+			                            previous_lower_word_sums,
+			                            lower_word_sums );
+
+			lower_word_sums = _mm_add_epi32(
+			                   lower_word_sums,
+			                   _mm_sad_epu8(
+			                    value1,
+			                    zero ) );
+
+			upper_word_sums = _mm_add_epi32(
+			                   upper_word_sums,
+			                   _mm_madd_epi16(
+			                    _mm_maddubs_epi16(
+			                     value1,
+			                     multipliers1 ),
+			                    ones ) );
+
+			lower_word_sums = _mm_add_epi32(
+			                   lower_word_sums,
+			                   _mm_sad_epu8(
+			                    value2,
+			                    zero ) );
+
+			upper_word_sums = _mm_add_epi32(
+			                   upper_word_sums,
+			                   _mm_madd_epi16(
+			                    _mm_maddubs_epi16(
+			                     value2,
+			                     multipliers2 ),
+			                    ones ) );
+
+			buffer           += 32;
+			number_of_blocks -= 1;
+		}
+		upper_word_sums = _mm_add_epi32(
+		                   upper_word_sums,
+		                   _mm_slli_epi32(
+		                    previous_lower_word_sums,
+		                    5 ) );
+
+		/* Add the 32-bit integers of the sums
+		 */
+		lower_word_sums = _mm_add_epi32(
+		                   lower_word_sums,
+		                   _mm_shuffle_epi32(
+		                    lower_word_sums,
+		                    _MM_SHUFFLE( 1, 0, 3, 2 ) ) );
+
+		lower_word += (uint32_t) _mm_cvtsi128_si32(
+		                          lower_word_sums );
+
+		upper_word_sums = _mm_add_epi32(
+		                   upper_word_sums,
+		                   _mm_shuffle_epi32(
+		                    upper_word_sums,
+		                    _MM_SHUFFLE( 2, 3, 0, 1 ) ) );
+
+		upper_word_sums = _mm_add_epi32(
+		                   upper_word_sums,
+		                   _mm_shuffle_epi32(
+		                    upper_word_sums,
+		                    _MM_SHUFFLE( 1, 0, 3, 2 ) ) );
+
+		upper_word = (uint32_t) _mm_cvtsi128_si32(
+		                         upper_word_sums );
+
+		lower_word %= 0xfff1;
+		upper_word %= 0xfff1;
+	}
+	return( ( upper_word << 16 ) | lower_word );
+}
+
+/* Calculates the Adler-32 of a buffer using AVX2
+ * The size must be a multiple of 32
+ * Returns the Adler-32
+ */
+CPU_FEATURES_TARGET( "avx2" )
+static uint32_t adler32_calculate_avx2(
+                 uint32_t checksum_value,
+                 const uint8_t *buffer,
+                 size_t size )
+{
+	__m256i lower_word_sums;
+	__m256i multipliers;
+	__m256i ones;
+	__m256i previous_lower_word_sums;
+	__m256i upper_word_sums;
+	__m256i value;
+	__m256i zero;
+	__m128i sums;
+
+	size_t number_of_blocks = 0;
+	uint32_t lower_word     = 0;
+	uint32_t upper_word     = 0;
+
+	lower_word = checksum_value & 0xffff;
+	upper_word = ( checksum_value >> 16 ) & 0xffff;
+
+	multipliers = _mm256_loadu_si256(
+	               (const __m256i *) &( adler32_simd_multipliers[ 32 ] ) );
+
+	ones = _mm256_set1_epi16( 1 );
+	zero = _mm256_setzero_si256();
+
+	while( size > 0 )
+	{
+		/* The modulo calculation is needed per 5552 (0x15b0) bytes
+		 * 5552 / 32 = 173
+		 */
+		number_of_blocks = size / 32;
+
+		if( number_of_blocks > 173 )
+		{
+			number_of_blocks = 173;
+		}
+		size -= number_of_blocks * 32;
+
+		/* The lower word is added to the upper word for every byte
+		 */
+		previous_lower_word_sums = _mm256_set_epi32(
+		                            0,
+		                            0,
+		                            0,
+		                            0,
+		                            0,
+		                            0,
+		                            0,
+		                            (int) ( lower_word * number_of_blocks ) );
+
+		upper_word_sums = _mm256_set_epi32(
+		                   0,
+		                   0,
+		                   0,
+		                   0,
+		                   0,
+		                   0,
+		                   0,
+		                   (int) upper_word );
+
+		lower_word_sums = _mm256_setzero_si256();
+
+		while( number_of_blocks > 0 )
+		{
+			value = _mm256_loadu_si256(
+			         (const __m256i *) buffer );
+
+			previous_lower_word_sums = _mm256_add_epi32(
+			                            previous_lower_word_sums,
+			                            lower_word_sums );
+
+			lower_word_sums = _mm256_add_epi32(
+			                   lower_word_sums,
+			                   _mm256_sad_epu8(
+			                    value,
+			                    zero ) );
+
+			upper_word_sums = _mm256_add_epi32(
+			                   upper_word_sums,
+			                   _mm256_madd_epi16(
+			                    _mm256_maddubs_epi16(
+			                     value,
+			                     multipliers ),
+			                    ones ) );
+
+			buffer           += 32;
+			number_of_blocks -= 1;
+		}
+		upper_word_sums = _mm256_add_epi32(
+		                   upper_word_sums,
+		                   _mm256_slli_epi32(
+		                    previous_lower_word_sums,
+		                    5 ) );
+
+		/* Add the 32-bit integers of the sums
+		 */
+		sums = _mm_add_epi32(
+		        _mm256_castsi256_si128(
+		         lower_word_sums ),
+		        _mm256_extracti128_si256(
+		         lower_word_sums,
+		         1 ) );
+
+		sums = _mm_add_epi32(
+		        sums,
+		        _mm_shuffle_epi32(
+		         sums,
+		         _MM_SHUFFLE( 1, 0, 3, 2 ) ) );
+
+		lower_word += (uint32_t) _mm_cvtsi128_si32(
+		                          sums );
+
+		sums = _mm_add_epi32(
+		        _mm256_castsi256_si128(
+		         upper_word_sums ),
+		        _mm256_extracti128_si256(
+		         upper_word_sums,
+		         1 ) );
+
+		sums = _mm_add_epi32(
+		        sums,
+		        _mm_shuffle_epi32(
+		         sums,
+		         _MM_SHUFFLE( 2, 3, 0, 1 ) ) );
+
+		sums = _mm_add_epi32(
+		        sums,
+		        _mm_shuffle_epi32(
+		         sums,
+		         _MM_SHUFFLE( 1, 0, 3, 2 ) ) );
+
+		upper_word = (uint32_t) _mm_cvtsi128_si32(
+		                         sums );
+
+		lower_word %= 0xfff1;
+		upper_word %= 0xfff1;
+	}
+	return( ( upper_word << 16 ) | lower_word );
+}
+
+/* Calculates the Adler-32 of a buffer using AVX-512BW
+ * The size must be a multiple of 64
+ * Returns the Adler-32
+ */
+CPU_FEATURES_TARGET( "avx512f,avx512bw" )
+static uint32_t adler32_calculate_avx512bw(
+                 uint32_t checksum_value,
+                 const uint8_t *buffer,
+                 size_t size )
+{
+	__m512i lower_word_sums;
+	__m512i multipliers;
+	__m512i ones;
+	__m512i previous_lower_word_sums;
+	__m512i upper_word_sums;
+	__m512i value;
+	__m512i zero;
+	__m256i sums_256bit;
+	__m128i sums;
+
+	size_t number_of_blocks = 0;
+	uint32_t lower_word     = 0;
+	uint32_t upper_word     = 0;
+
+	lower_word = checksum_value & 0xffff;
+	upper_word = ( checksum_value >> 16 ) & 0xffff;
+
+	multipliers = _mm512_loadu_si512(
+	               (const void *) adler32_simd_multipliers );
+
+	ones = _mm512_set1_epi16( 1 );
+	zero = _mm512_setzero_si512();
+
+	while( size > 0 )
+	{
+		/* The modulo calculation is needed per 5552 (0x15b0) bytes
+		 * 5552 / 64 = 86
+		 */
+		number_of_blocks = size / 64;
+
+		if( number_of_blocks > 86 )
+		{
+			number_of_blocks = 86;
+		}
+		size -= number_of_blocks * 64;
+
+		/* The lower word is added to the upper word for every byte
+		 */
+		previous_lower_word_sums = _mm512_maskz_set1_epi32(
+		                            0x0001,
+		                            (int) ( lower_word * number_of_blocks ) );
+
+		upper_word_sums = _mm512_maskz_set1_epi32(
+		                   0x0001,
+		                   (int) upper_word );
+
+		lower_word_sums = _mm512_setzero_si512();
+
+		while( number_of_blocks > 0 )
+		{
+			value = _mm512_loadu_si512(
+			         (const void *) buffer );
+
+			previous_lower_word_sums = _mm512_add_epi32(
+			                            previous_lower_word_sums,
+			                            lower_word_sums );
+
+			lower_word_sums = _mm512_add_epi32(
+			                   lower_word_sums,
+			                   _mm512_sad_epu8(
+			                    value,
+			                    zero ) );
+
+			upper_word_sums = _mm512_add_epi32(
+			                   upper_word_sums,
+			                   _mm512_madd_epi16(
+			                    _mm512_maddubs_epi16(
+			                     value,
+			                     multipliers ),
+			                    ones ) );
+
+			buffer           += 64;
+			number_of_blocks -= 1;
+		}
+		upper_word_sums = _mm512_add_epi32(
+		                   upper_word_sums,
+		                   _mm512_slli_epi32(
+		                    previous_lower_word_sums,
+		                    6 ) );
+
+		/* Add the 32-bit integers of the sums
+		 */
+		sums_256bit = _mm256_add_epi32(
+		               _mm512_castsi512_si256(
+		                lower_word_sums ),
+		               _mm512_extracti64x4_epi64(
+		                lower_word_sums,
+		                1 ) );
+
+		sums = _mm_add_epi32(
+		        _mm256_castsi256_si128(
+		         sums_256bit ),
+		        _mm256_extracti128_si256(
+		         sums_256bit,
+		         1 ) );
+
+		sums = _mm_add_epi32(
+		        sums,
+		        _mm_shuffle_epi32(
+		         sums,
+		         _MM_SHUFFLE( 1, 0, 3, 2 ) ) );
+
+		lower_word += (uint32_t) _mm_cvtsi128_si32(
+		                          sums );
+
+		sums_256bit = _mm256_add_epi32(
+		               _mm512_castsi512_si256(
+		                upper_word_sums ),
+		               _mm512_extracti64x4_epi64(
+		                upper_word_sums,
+		                1 ) );
+
+		sums = _mm_add_epi32(
+		        _mm256_castsi256_si128(
+		         sums_256bit ),
+		        _mm256_extracti128_si256(
+		         sums_256bit,
+		         1 ) );
+
+		sums = _mm_add_epi32(
+		        sums,
+		        _mm_shuffle_epi32(
+		         sums,
+		         _MM_SHUFFLE( 2, 3, 0, 1 ) ) );
+
+		sums = _mm_add_epi32(
+		        sums,
+		        _mm_shuffle_epi32(
+		         sums,
+		         _MM_SHUFFLE( 1, 0, 3, 2 ) ) );
+
+		upper_word = (uint32_t) _mm_cvtsi128_si32(
+		                         sums );
+
+		lower_word %= 0xfff1;
+		upper_word %= 0xfff1;
+	}
+	return( ( upper_word << 16 ) | lower_word );
+}
+
+#elif defined( HAVE_CPU_FEATURES_ARM64 )
+
+/* Calculates the Adler-32 of a buffer using NEON (Advanced SIMD)
+ * The size must be a multiple of 32
+ * Returns the Adler-32
+ */
+static uint32_t adler32_calculate_neon(
+                 uint32_t checksum_value,
+                 const uint8_t *buffer,
+                 size_t size )
+{
+	uint8x16_t value1;
+	uint8x16_t value2;
+	uint16x8_t column_sums1;
+	uint16x8_t column_sums2;
+	uint16x8_t column_sums3;
+	uint16x8_t column_sums4;
+	uint16x8_t multipliers1;
+	uint16x8_t multipliers2;
+	uint16x8_t multipliers3;
+	uint16x8_t multipliers4;
+	uint32x4_t lower_word_sums;
+	uint32x4_t upper_word_sums;
+
+	size_t number_of_blocks = 0;
+	uint32_t lower_word     = 0;
+	uint32_t upper_word     = 0;
+
+	lower_word = checksum_value & 0xffff;
+	upper_word = ( checksum_value >> 16 ) & 0xffff;
+
+	multipliers1 = vmovl_u8(
+	                vld1_u8( &( adler32_simd_multipliers[ 32 ] ) ) );
+	multipliers2 = vmovl_u8(
+	                vld1_u8( &( adler32_simd_multipliers[ 40 ] ) ) );
+	multipliers3 = vmovl_u8(
+	                vld1_u8( &( adler32_simd_multipliers[ 48 ] ) ) );
+	multipliers4 = vmovl_u8(
+	                vld1_u8( &( adler32_simd_multipliers[ 56 ] ) ) );
+
+	while( size > 0 )
+	{
+		/* The modulo calculation is needed per 5552 (0x15b0) bytes
+		 * 5552 / 32 = 173
+		 */
+		number_of_blocks = size / 32;
+
+		if( number_of_blocks > 173 )
+		{
+			number_of_blocks = 173;
+		}
+		size -= number_of_blocks * 32;
+
+		/* The lower word is added to the upper word for every byte
+		 */
+		upper_word_sums = vsetq_lane_u32(
+		                   (uint32_t) ( lower_word * number_of_blocks ),
+		                   vdupq_n_u32( 0 ),
+		                   0 );
+
+		lower_word_sums = vdupq_n_u32( 0 );
+
+		column_sums1 = vdupq_n_u16( 0 );
+		column_sums2 = vdupq_n_u16( 0 );
+		column_sums3 = vdupq_n_u16( 0 );
+		column_sums4 = vdupq_n_u16( 0 );
+
+		while( number_of_blocks > 0 )
+		{
+			value1 = vld1q_u8( buffer );
+			value2 = vld1q_u8( &( buffer[ 16 ] ) );
+
+			upper_word_sums = vaddq_u32(
+			                   upper_word_sums,
+			                   lower_word_sums );
+
+			lower_word_sums = vpadalq_u16(
+			                   lower_word_sums,
+			                   vpadalq_u8(
+			                    vpaddlq_u8( value1 ),
+			                    value2 ) );
+
+			column_sums1 = vaddw_u8(
+			                column_sums1,
+			                vget_low_u8( value1 ) );
+			column_sums2 = vaddw_u8(
+			                column_sums2,
+			                vget_high_u8( value1 ) );
+			column_sums3 = vaddw_u8(
+			                column_sums3,
+			                vget_low_u8( value2 ) );
+			column_sums4 = vaddw_u8(
+			                column_sums4,
+			                vget_high_u8( value2 ) );
+
+			buffer           += 32;
+			number_of_blocks -= 1;
+		}
+		upper_word_sums = vshlq_n_u32(
+		                   upper_word_sums,
+		                   5 );
+
+		upper_word_sums = vmlal_u16(
+		                   upper_word_sums,
+		                   vget_low_u16( column_sums1 ),
+		                   vget_low_u16( multipliers1 ) );
+		upper_word_sums = vmlal_u16(
+		                   upper_word_sums,
+		                   vget_high_u16( column_sums1 ),
+		                   vget_high_u16( multipliers1 ) );
+		upper_word_sums = vmlal_u16(
+		                   upper_word_sums,
+		                   vget_low_u16( column_sums2 ),
+		                   vget_low_u16( multipliers2 ) );
+		upper_word_sums = vmlal_u16(
+		                   upper_word_sums,
+		                   vget_high_u16( column_sums2 ),
+		                   vget_high_u16( multipliers2 ) );
+		upper_word_sums = vmlal_u16(
+		                   upper_word_sums,
+		                   vget_low_u16( column_sums3 ),
+		                   vget_low_u16( multipliers3 ) );
+		upper_word_sums = vmlal_u16(
+		                   upper_word_sums,
+		                   vget_high_u16( column_sums3 ),
+		                   vget_high_u16( multipliers3 ) );
+		upper_word_sums = vmlal_u16(
+		                   upper_word_sums,
+		                   vget_low_u16( column_sums4 ),
+		                   vget_low_u16( multipliers4 ) );
+		upper_word_sums = vmlal_u16(
+		                   upper_word_sums,
+		                   vget_high_u16( column_sums4 ),
+		                   vget_high_u16( multipliers4 ) );
+
+		lower_word += vaddvq_u32( lower_word_sums );
+		upper_word += vaddvq_u32( upper_word_sums );
+
+		lower_word %= 0xfff1;
+		upper_word %= 0xfff1;
+	}
+	return( ( upper_word << 16 ) | lower_word );
+}
+
+#endif /* defined( HAVE_CPU_FEATURES_X86 ) */
+
 /* Calculates the Adler-32 of a buffer
+ * Uses the SIMD instructions of the CPU if available, otherwise falls back to the CPU aligned variant
+ *
+ * On x86 AVX-512BW, AVX2 or SSSE3 is used and on ARMv8 NEON (Advanced SIMD).
+ * The data that remains after the last SIMD block is calculated with the CPU aligned variant.
+ *
  * It uses the initial value to calculate a new Adler-32
  * Returns 1 if successful or -1 on error
  */
@@ -1367,16 +1977,10 @@ int checksum_calculate_adler32_simd(
      uint32_t initial_value,
      libcerror_error_t **error )
 {
-	adler32_8byte_vector_t value_8byte;
-	adler32_8byte_vector_t upper_word_8byte_multiplier;
-	adler32_8byte_vector_t upper_word_8byte_value;
-
 	static char *function = "checksum_calculate_adler32_simd";
 	size_t buffer_offset  = 0;
-	uint32_t lower_word   = 0;
-	uint32_t upper_word   = 0;
-	int block_index       = 0;
-	int number_of_blocks  = 0;
+	size_t block_size     = 0;
+	uint32_t value_32bit  = 0;
 
 	if( checksum_value == NULL )
 	{
@@ -1411,143 +2015,140 @@ int checksum_calculate_adler32_simd(
 
 		return( -1 );
 	}
-	lower_word = initial_value & 0xffff;
-	upper_word = ( initial_value >> 16 ) & 0xffff;
+	value_32bit = initial_value;
 
-	upper_word_8byte_multiplier.integer[ 0 ] = 8;
-	upper_word_8byte_multiplier.integer[ 1 ] = 7;
-	upper_word_8byte_multiplier.integer[ 2 ] = 6;
-	upper_word_8byte_multiplier.integer[ 3 ] = 5;
-	upper_word_8byte_multiplier.integer[ 4 ] = 4;
-	upper_word_8byte_multiplier.integer[ 5 ] = 3;
-	upper_word_8byte_multiplier.integer[ 6 ] = 2;
-	upper_word_8byte_multiplier.integer[ 7 ] = 1;
-
-	upper_word_8byte_value.integer[ 0 ] = 0;
-	upper_word_8byte_value.integer[ 1 ] = 0;
-	upper_word_8byte_value.integer[ 2 ] = 0;
-	upper_word_8byte_value.integer[ 3 ] = 0;
-	upper_word_8byte_value.integer[ 4 ] = 0;
-	upper_word_8byte_value.integer[ 5 ] = 0;
-	upper_word_8byte_value.integer[ 6 ] = 0;
-	upper_word_8byte_value.integer[ 7 ] = 0;
+#if defined( HAVE_CPU_FEATURES_X86 )
+	if( ( size >= 64 )
+	 && ( cpu_features_has(
+	       CPU_FEATURE_FLAG_AVX512BW ) != 0 ) )
+	{
+		block_size = size & ~( (size_t) 63 );
 
-	while( size >= 0x15b0 )
+		value_32bit = adler32_calculate_avx512bw(
+		               value_32bit,
+		               buffer,
+		               block_size );
+
+		buffer_offset = block_size;
+	}
+	if( ( size - buffer_offset ) >= 32 )
 	{
-		/* The modulo calculation is needed per 5552 (0x15b0) bytes
-		 * 5552 / 16 = 347
-		 */
-		number_of_blocks = 347 * 2;
+		block_size = ( size - buffer_offset ) & ~( (size_t) 31 );
 
-		for( block_index = 0;
-		     block_index < number_of_blocks;
-		     block_index++ )
+		if( cpu_features_has(
+		     CPU_FEATURE_FLAG_AVX2 ) != 0 )
 		{
-			value_8byte.integer[ 0 ] = buffer[ buffer_offset++ ];
-			value_8byte.integer[ 1 ] = buffer[ buffer_offset++ ];
-			value_8byte.integer[ 2 ] = buffer[ buffer_offset++ ];
-			value_8byte.integer[ 3 ] = buffer[ buffer_offset++ ];
-			value_8byte.integer[ 4 ] = buffer[ buffer_offset++ ];
-			value_8byte.integer[ 5 ] = buffer[ buffer_offset++ ];
-			value_8byte.integer[ 6 ] = buffer[ buffer_offset++ ];
-			value_8byte.integer[ 7 ] = buffer[ buffer_offset++ ];
-
-/* TODO
-			upper_word_8byte_value.vector = __builtin_mulv8qi(
-			                                 value_8byte.vector,
-			                                 upper_word_8byte_multiplier.vector );
-*/
-
-			upper_word += 8 * lower_word
-			            + upper_word_8byte_value.integer[ 0 ]
-			            + upper_word_8byte_value.integer[ 1 ]
-			            + upper_word_8byte_value.integer[ 2 ]
-			            + upper_word_8byte_value.integer[ 3 ]
-			            + upper_word_8byte_value.integer[ 4 ]
-			            + upper_word_8byte_value.integer[ 5 ]
-			            + upper_word_8byte_value.integer[ 6 ]
-			            + upper_word_8byte_value.integer[ 7 ];
-
-			lower_word += value_8byte.integer[ 0 ]
-			            + value_8byte.integer[ 1 ]
-			            + value_8byte.integer[ 2 ]
-			            + value_8byte.integer[ 3 ]
-			            + value_8byte.integer[ 4 ]
-			            + value_8byte.integer[ 5 ]
-			            + value_8byte.integer[ 6 ]
-			            + value_8byte.integer[ 7 ];
+			value_32bit = adler32_calculate_avx2(
+			               value_32bit,
+			               &( buffer[ buffer_offset ] ),
+			               block_size );
 
+			buffer_offset += block_size;
 		}
-		lower_word %= 0xfff1;
-		upper_word %= 0xfff1;
+		else if( cpu_features_has(
+		          CPU_FEATURE_FLAG_SSSE3 ) != 0 )
+		{
+			value_32bit = adler32_calculate_ssse3(
+			               value_32bit,
+			               &( buffer[ buffer_offset ] ),
+			               block_size );
 
-		size -= 0x15b0;
+			buffer_offset += block_size;
+		}
 	}
-	if( size > 0 )
+#elif defined( HAVE_CPU_FEATURES_ARM64 )
+	if( ( size >= 32 )
+	 && ( cpu_features_has(
+	       CPU_FEATURE_FLAG_NEON ) != 0 ) )
 	{
-		while( size > 16 )
-		{
-			lower_word += buffer[ buffer_offset++ ];
-			upper_word += lower_word;
+		block_size = size & ~( (size_t) 31 );
 
-			lower_word += buffer[ buffer_offset++ ];
-			upper_word += lower_word;
-
-			lower_word += buffer[ buffer_offset++ ];
-			upper_word += lower_word;
-
-			lower_word += buffer[ buffer_offset++ ];
-			upper_word += lower_word;
-
-			lower_word += buffer[ buffer_offset++ ];
-			upper_word += lower_word;
-
-			lower_word += buffer[ buffer_offset++ ];
-			upper_word += lower_word;
-
-			lower_word += buffer[ buffer_offset++ ];
-			upper_word += lower_word;
-
-			lower_word += buffer[ buffer_offset++ ];
-			upper_word += lower_word;
+		value_32bit = adler32_calculate_neon(
+		               value_32bit,
+		               buffer,
+		               block_size );
 
-			lower_word += buffer[ buffer_offset++ ];
-			upper_word += lower_word;
+		buffer_offset = block_size;
+	}
+#endif
+	/* Calculate the remaining data using the CPU aligned variant
+	 */
+	if( checksum_calculate_adler32_cpu_aligned(
+	     &value_32bit,
+	     &( buffer[ buffer_offset ] ),
+	     size - buffer_offset,
+	     value_32bit,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GENERIC,
+		 "%s: unable to calculate Adler-32 of remaining data.",
+		 function );
 
-			lower_word += buffer[ buffer_offset++ ];
-			upper_word += lower_word;
+		return( -1 );
+	}
+	*checksum_value = value_32bit;
 
-			lower_word += buffer[ buffer_offset++ ];
-			upper_word += lower_word;
+	return( 1 );
+}
 
-			lower_word += buffer[ buffer_offset++ ];
-			upper_word += lower_word;
 
-			lower_word += buffer[ buffer_offset++ ];
-			upper_word += lower_word;
+/* Combines the Adler-32 of two consecutive buffers into the Adler-32 of both buffers
+ * The lower word of the combined Adler-32 is the sum of the lower words minus the
+ * initial value of 1, the upper word also contains the lower word of the first
+ * buffer for every byte of the second buffer, all modulo 65521
+ * Returns 1 if successful or -1 on error
+ */
+int checksum_combine_adler32(
+     uint32_t *adler32,
+     uint32_t first_adler32,
+     uint32_t second_adler32,
+     size64_t second_size,
+     libcerror_error_t **error )
+{
+	static char *function = "checksum_combine_adler32";
+	uint32_t lower_word   = 0;
+	uint32_t remainder    = 0;
+	uint32_t upper_word   = 0;
 
-			lower_word += buffer[ buffer_offset++ ];
-			upper_word += lower_word;
+	if( adler32 == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid Adler-32.",
+		 function );
 
-			lower_word += buffer[ buffer_offset++ ];
-			upper_word += lower_word;
+		return( -1 );
+	}
+	remainder = (uint32_t) ( second_size % 65521 );
 
-			lower_word += buffer[ buffer_offset++ ];
-			upper_word += lower_word;
+	lower_word = first_adler32 & 0x0000ffffUL;
+	upper_word = ( remainder * lower_word ) % 65521;
 
-			size          -= 16;
-		}
-		while( size > 0 )
-		{
-			lower_word += buffer[ buffer_offset++ ];
-			upper_word += lower_word;
+	lower_word += ( second_adler32 & 0x0000ffffUL ) + 65521 - 1;
+	upper_word += ( first_adler32 >> 16 ) + ( second_adler32 >> 16 ) + 65521 - remainder;
 
-			size--;
-		}
-		lower_word %= 0xfff1;
-		upper_word %= 0xfff1;
+	if( lower_word >= 65521 )
+	{
+		lower_word -= 65521;
 	}
-	*checksum_value = ( upper_word << 16 ) | lower_word;
+	if( lower_word >= 65521 )
+	{
+		lower_word -= 65521;
+	}
+	if( upper_word >= ( 2 * 65521 ) )
+	{
+		upper_word -= 2 * 65521;
+	}
+	if( upper_word >= 65521 )
+	{
+		upper_word -= 65521;
+	}
+	*adler32 = ( upper_word << 16 ) | lower_word;
 
 	return( 1 );
 }
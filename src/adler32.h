@@ -101,6 +101,13 @@ int checksum_calculate_adler32_simd(
      uint32_t initial_value,
      libcerror_error_t **error );
 
+int checksum_combine_adler32(
+     uint32_t *adler32,
+     uint32_t first_adler32,
+     uint32_t second_adler32,
+     size64_t second_size,
+     libcerror_error_t **error );
+
 #if defined( __cplusplus )
 }
 #endif
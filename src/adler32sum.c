@@ -35,11 +35,37 @@
 #endif
 
 #include "adler32.h"
+#include "assorted_batch.h"
+#include "assorted_calibrate.h"
 #include "assorted_getopt.h"
+#include "assorted_input_file.h"
 #include "assorted_libcerror.h"
 #include "assorted_libcfile.h"
 #include "assorted_libcnotify.h"
+#include "assorted_libcthreads.h"
 #include "assorted_output.h"
+#include "assorted_worker_pool.h"
+
+/* The size of the buffer used to read the source data
+ */
+#define ADLER32SUM_BUFFER_SIZE		( 4 * 1024 * 1024 )
+
+/* The maximum number of threads
+ */
+#define ADLER32SUM_MAXIMUM_NUMBER_OF_THREADS	64
+
+/* The minimum size of the range of data calculated by a thread
+ */
+#define ADLER32SUM_MINIMUM_THREAD_RANGE_SIZE	( 256 * 1024 )
+
+/* The calculation methods considered when calibrating
+ */
+static const int adler32sum_calculation_methods[] = {
+#if defined( HAVE_ZLIB_ADLER32 )
+	1, 2, 3, 4, 5 };
+#else
+	1, 2, 3, 4 };
+#endif
 
 /* Prints the executable usage information
  */
@@ -52,25 +78,480 @@ void usage_fprint(
 	}
 	fprintf( stream, "Use adler32sum to calculate an Adler-32 of file data.\n\n" );
 
-	fprintf( stream, "Usage: adler32sum [ -i initial_value ] [ -o offset ] [ -s size ]\n"
-	                 "                  [ -12345hvV ] source\n\n" );
+	fprintf( stream, "Usage: adler32sum [ -C checksum_list ] [ -i initial_value ]\n"
+	                 "                  [ -j threads ] [ -o offset ] [ -s size ]\n"
+	                 "                  [ -S format ] [ -t threads ] [ -u block_size ]\n"
+	                 "                  [ -12345bhvV ] source ...\n\n" );
 
-	fprintf( stream, "\tsource: the source file\n\n" );
+	fprintf( stream, "\tsource: the source file, in batch mode the source files and\n"
+	                 "\t        directories, where - reads the paths from stdin\n\n" );
 
 	fprintf( stream, "\t-1:     use the basic calculation method\n" );
-	fprintf( stream, "\t-2:     use the unfolded calculation method (default)\n" );
+	fprintf( stream, "\t-2:     use the unfolded calculation method\n" );
 	fprintf( stream, "\t-3:     use the cpu-aligned calculation method\n" );
 	fprintf( stream, "\t-4:     use the SIMD calculation method\n" );
 	fprintf( stream, "\t-5:     use the zlib calculation method\n" );
+	fprintf( stream, "\t        by default the fastest calculation method is selected\n"
+	                 "\t        by calibrating all methods before a large source is read,\n"
+	                 "\t        otherwise the SIMD calculation method is used\n" );
+	fprintf( stream, "\t-b:     batch mode, calculates the Adler-32 of every source file and\n"
+	                 "\t        of every file in the source directories, or of the files\n"
+	                 "\t        of which the paths are read from stdin if no source is\n"
+	                 "\t        provided, and prints a line per file in the format of\n"
+	                 "\t        sha256sum, implied when multiple sources are provided\n" );
+	fprintf( stream, "\t-C:     verify the Adler-32 of the files in a checksum list in\n"
+	                 "\t        the format of sha256sum, where - reads the list from stdin,\n"
+	                 "\t        implies -b\n" );
 	fprintf( stream, "\t-h:     shows this help\n" );
 	fprintf( stream, "\t-i:     initial Adler-32 (default is 0)\n" );
+	fprintf( stream, "\t-j:     number of threads used in batch mode (default is %d)\n",
+	 ASSORTED_BATCH_DEFAULT_NUMBER_OF_THREADS );
 	fprintf( stream, "\t-o:     data offset (default is 0)\n" );
 	fprintf( stream, "\t-s:     size of data (default is the file size)\n" );
+	fprintf( stream, "\t-S:     print timing and throughput statistics of the open,\n"
+	                 "\t        read, compute and write phases and the peak memory\n"
+	                 "\t        size to stderr in the format: text or json\n" );
+	fprintf( stream, "\t-t:     number of threads (default is 1), the data is split\n"
+	                 "\t        into ranges of which the Adler-32 are calculated in\n"
+	                 "\t        parallel and combined afterwards\n" );
+	fprintf( stream, "\t-u:     read the source unbuffered using direct I/O in blocks of\n"
+	                 "\t        block_size bytes, which must be a multiple of %d, to\n"
+	                 "\t        bypass the system cache, e.g. when reading a device\n",
+	 ASSORTED_INPUT_FILE_DIRECT_IO_ALIGNMENT );
 	fprintf( stream, "\t-v:     verbose output to stderr\n" );
 	fprintf( stream, "\t-V:     print version\n" );
 	fprintf( stream, "\n" );
 }
 
+/* Calculates the Adler-32 of a buffer using a specific calculation method
+ * Returns 1 if successful or -1 on error
+ */
+int adler32sum_calculate(
+     int calculation_method,
+     uint32_t *checksum_value,
+     uint8_t *buffer,
+     size_t size,
+     uint32_t initial_value,
+     libcerror_error_t **error )
+{
+	static char *function = "adler32sum_calculate";
+	int result            = -1;
+
+	if( checksum_value == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid checksum value.",
+		 function );
+
+		return( -1 );
+	}
+	if( calculation_method == 1 )
+	{
+		result = checksum_calculate_adler32_basic2(
+		          checksum_value,
+		          buffer,
+		          size,
+		          initial_value,
+		          error );
+	}
+	else if( calculation_method == 2 )
+	{
+		/* The unfolded4_2 variant is slower than the unfolded4_1 variant
+		 */
+		/* Fastest to slowest variant
+		 * - checksum_calculate_adler32_unfolded16_4
+		 * - checksum_calculate_adler32_unfolded16_2
+		 * - checksum_calculate_adler32_unfolded16_1
+		 * - checksum_calculate_adler32_unfolded16_3
+		 */
+		result = checksum_calculate_adler32_unfolded16_4(
+		          checksum_value,
+		          buffer,
+		          size,
+		          initial_value,
+		          error );
+	}
+	else if( calculation_method == 3 )
+	{
+		/* The unfolded variants seems to be faster then the CPU aligned
+		 */
+		result = checksum_calculate_adler32_cpu_aligned(
+		          checksum_value,
+		          buffer,
+		          size,
+		          initial_value,
+		          error );
+	}
+	else if( calculation_method == 4 )
+	{
+		result = checksum_calculate_adler32_simd(
+		          checksum_value,
+		          buffer,
+		          size,
+		          initial_value,
+		          error );
+	}
+#if defined( HAVE_ZLIB_ADLER32 )
+	else if( calculation_method == 5 )
+	{
+		*checksum_value = (uint32_t) adler32(
+		                              (uLong) initial_value,
+		                              buffer,
+		                              (uInt) size );
+
+		result = 1;
+	}
+#endif
+	else
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_UNSUPPORTED_VALUE,
+		 "%s: unsupported calculation method: %d.",
+		 function,
+		 calculation_method );
+
+		return( -1 );
+	}
+	return( result );
+}
+
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+
+typedef struct adler32sum_thread_range adler32sum_thread_range_t;
+
+struct adler32sum_thread_range
+{
+	/* The calculation method
+	 */
+	int calculation_method;
+
+	/* The data of the range
+	 */
+	uint8_t *buffer;
+
+	/* The size of the range
+	 */
+	size_t size;
+
+	/* The initial value
+	 */
+	uint32_t initial_value;
+
+	/* The calculated Adler-32 of the range
+	 */
+	uint32_t checksum_value;
+
+	/* The result of the calculation
+	 */
+	int result;
+};
+
+/* Calculates the Adler-32 of a range, used as the task function of the worker pool
+ * Returns 1 if successful or -1 on error
+ */
+int adler32sum_thread_range_calculate(
+     void *arguments,
+     uint8_t *worker_buffer,
+     size_t worker_buffer_size )
+{
+	adler32sum_thread_range_t *thread_range = NULL;
+
+	( void ) worker_buffer;
+	( void ) worker_buffer_size;
+
+	if( arguments == NULL )
+	{
+		return( -1 );
+	}
+	thread_range = (adler32sum_thread_range_t *) arguments;
+
+	thread_range->result = adler32sum_calculate(
+	                        thread_range->calculation_method,
+	                        &( thread_range->checksum_value ),
+	                        thread_range->buffer,
+	                        thread_range->size,
+	                        thread_range->initial_value,
+	                        NULL );
+
+	return( thread_range->result );
+}
+
+/* Calculates the Adler-32 of a buffer using the worker pool
+ * The buffer is split into a range per worker, of which the Adler-32 is calculated
+ * in parallel, the Adler-32 of the ranges are combined into the Adler-32 of the buffer
+ * Returns 1 if successful or -1 on error
+ */
+int adler32sum_calculate_parallel(
+     int calculation_method,
+     uint32_t *checksum_value,
+     uint8_t *buffer,
+     size_t size,
+     uint32_t initial_value,
+     assorted_worker_pool_t *worker_pool,
+     libcerror_error_t **error )
+{
+	adler32sum_thread_range_t *thread_ranges = NULL;
+	static char *function                    = "adler32sum_calculate_parallel";
+	size_t range_offset                      = 0;
+	size_t range_size                        = 0;
+	int number_of_ranges                     = 0;
+	int range_index                          = 0;
+	int result                               = 1;
+
+	if( checksum_value == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid Adler-32.",
+		 function );
+
+		return( -1 );
+	}
+	if( worker_pool == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid worker pool.",
+		 function );
+
+		return( -1 );
+	}
+	/* Do not use more workers than ranges of the minimum size
+	 */
+	number_of_ranges = worker_pool->number_of_workers;
+
+	if( ( size / ADLER32SUM_MINIMUM_THREAD_RANGE_SIZE ) < (size_t) number_of_ranges )
+	{
+		number_of_ranges = (int) ( size / ADLER32SUM_MINIMUM_THREAD_RANGE_SIZE );
+	}
+	if( number_of_ranges <= 1 )
+	{
+		return( adler32sum_calculate(
+		         calculation_method,
+		         checksum_value,
+		         buffer,
+		         size,
+		         initial_value,
+		         error ) );
+	}
+	thread_ranges = (adler32sum_thread_range_t *) memory_allocate(
+	                                               sizeof( adler32sum_thread_range_t ) * number_of_ranges );
+
+	if( thread_ranges == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create thread ranges.",
+		 function );
+
+		goto on_error;
+	}
+	/* Keep the ranges a multiple of 64 bytes so that every range starts aligned
+	 * to the same extent as the buffer
+	 */
+	range_size  = size / number_of_ranges;
+	range_size -= range_size % 64;
+
+	for( range_index = 0;
+	     range_index < number_of_ranges;
+	     range_index++ )
+	{
+		thread_ranges[ range_index ].calculation_method = calculation_method;
+		thread_ranges[ range_index ].buffer             = &( buffer[ range_offset ] );
+		thread_ranges[ range_index ].size               = range_size;
+		thread_ranges[ range_index ].initial_value      = 1;
+		thread_ranges[ range_index ].checksum_value     = 0;
+		thread_ranges[ range_index ].result             = 0;
+
+		range_offset += range_size;
+	}
+	/* The Adler-32 of a range that is combined with the Adler-32 of the preceding
+	 * data starts with the default initial value of 1
+	 */
+	thread_ranges[ 0 ].initial_value = initial_value;
+
+	thread_ranges[ number_of_ranges - 1 ].size += size - range_offset;
+
+	for( range_index = 0;
+	     range_index < number_of_ranges;
+	     range_index++ )
+	{
+		if( assorted_worker_pool_push(
+		     worker_pool,
+		     adler32sum_thread_range_calculate,
+		     (void *) &( thread_ranges[ range_index ] ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+			 "%s: unable to push range: %d onto worker pool.",
+			 function,
+			 range_index );
+
+			result = -1;
+
+			break;
+		}
+	}
+	/* Wait for the ranges that were pushed, also on error, since they
+	 * reference the thread ranges
+	 */
+	if( assorted_worker_pool_wait(
+	     worker_pool,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to wait for worker pool.",
+		 function );
+
+		result = -1;
+	}
+	if( result != 1 )
+	{
+		goto on_error;
+	}
+	for( range_index = 0;
+	     range_index < number_of_ranges;
+	     range_index++ )
+	{
+		if( thread_ranges[ range_index ].result != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GENERIC,
+			 "%s: unable to calculate Adler-32 of range: %d.",
+			 function,
+			 range_index );
+
+			goto on_error;
+		}
+		if( range_index == 0 )
+		{
+			*checksum_value = thread_ranges[ range_index ].checksum_value;
+		}
+		else if( checksum_combine_adler32(
+		          checksum_value,
+		          *checksum_value,
+		          thread_ranges[ range_index ].checksum_value,
+		          (size64_t) thread_ranges[ range_index ].size,
+		          error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GENERIC,
+			 "%s: unable to combine Adler-32 of range: %d.",
+			 function,
+			 range_index );
+
+			goto on_error;
+		}
+	}
+	memory_free(
+	 thread_ranges );
+
+	return( 1 );
+
+on_error:
+	if( thread_ranges != NULL )
+	{
+		memory_free(
+		 thread_ranges );
+	}
+	return( -1 );
+}
+
+#endif /* defined( HAVE_MULTI_THREAD_SUPPORT ) */
+
+/* Calculates the Adler-32 of a buffer to calibrate a calculation method
+ * Returns 1 if successful or -1 on error
+ */
+int adler32sum_calibrate_calculate(
+     int calculation_method,
+     uint8_t *buffer,
+     size_t size,
+     libcerror_error_t **error )
+{
+	uint32_t checksum_value = 0;
+
+	return( adler32sum_calculate(
+	         calculation_method,
+	         &checksum_value,
+	         buffer,
+	         size,
+	         1,
+	         error ) );
+}
+
+/* Calculates the Adler-32 of a buffer in batch mode
+ * The arguments contain the calculation method
+ * Returns 1 if successful or -1 on error
+ */
+int adler32sum_batch_calculate(
+     void *arguments,
+     uint64_t *checksum_value,
+     uint8_t *buffer,
+     size_t size,
+     libcerror_error_t **error )
+{
+	static char *function         = "adler32sum_batch_calculate";
+	uint32_t checksum_value_32bit = 0;
+	int result                    = 0;
+
+	if( arguments == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid arguments.",
+		 function );
+
+		return( -1 );
+	}
+	if( checksum_value == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid checksum value.",
+		 function );
+
+		return( -1 );
+	}
+	checksum_value_32bit = (uint32_t) *checksum_value;
+
+	result = adler32sum_calculate(
+	          *( (int *) arguments ),
+	          &checksum_value_32bit,
+	          buffer,
+	          size,
+	          checksum_value_32bit,
+	          error );
+
+	*checksum_value = (uint64_t) checksum_value_32bit;
+
+	return( result );
+}
+
 /* The main program
  */
 #if defined( HAVE_WIDE_SYSTEM_CHARACTER )
@@ -79,34 +560,47 @@ int wmain( int argc, wchar_t * const argv[] )
 int main( int argc, char * const argv[] )
 #endif
 {
-	libcerror_error_t *error     = NULL;
-	libcfile_file_t *source_file = NULL;
-	system_character_t *source   = NULL;
-	uint8_t *buffer              = NULL;
-	char *program                = "adler32sum";
-	system_integer_t option      = 0;
-	size64_t source_size         = 0;
-	ssize_t read_count           = 0;
-	off_t source_offset          = 0;
-	uint32_t checksum_value      = 0;
-	uint32_t initial_value       = 0;
-	int calculation_method       = 2;
-	int result                   = 0;
-	int verbose                  = 0;
-
-	assorted_output_version_fprint(
-	 stdout,
-	 program );
+	assorted_batch_t *batch                      = NULL;
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+	assorted_worker_pool_t *worker_pool          = NULL;
+#endif
+	libcerror_error_t *error                     = NULL;
+	assorted_input_file_t *source_file           = NULL;
+	system_character_t *option_statistics_format = NULL;
+	system_character_t *source                   = NULL;
+	system_character_t *checksum_list            = NULL;
+	uint8_t *buffer                              = NULL;
+	char *program                                = "adler32sum";
+	system_integer_t option                      = 0;
+	size64_t remaining_size                      = 0;
+	size64_t source_size                         = 0;
+	size_t buffer_size                           = 0;
+	size_t direct_io_block_size                  = 0;
+	size_t read_size                             = 0;
+	ssize_t read_count                           = 0;
+	off_t source_offset                          = 0;
+	uint32_t checksum_value                      = 0;
+	uint32_t initial_value                       = 0;
+	uint8_t batch_mode                           = 0;
+	int calculation_method                       = 0;
+	int number_of_threads                        = 1;
+	int number_of_batch_threads                  = ASSORTED_BATCH_DEFAULT_NUMBER_OF_THREADS;
+	int result                                   = 0;
+	int verbose                                  = 0;
 
 	while( ( option = assorted_getopt(
 	                   argc,
 	                   argv,
-	                   _SYSTEM_STRING( "12345hi:o:s:vV" ) ) ) != (system_integer_t) -1 )
+	                   _SYSTEM_STRING( "12345bC:hi:j:o:s:S:t:u:vV" ) ) ) != (system_integer_t) -1 )
 	{
 		switch( option )
 		{
 			case '?':
 			default:
+				assorted_output_version_fprint(
+				 stdout,
+				 program );
+
 				fprintf(
 				 stderr,
 				 "Invalid argument: %" PRIs_SYSTEM "\n",
@@ -142,7 +636,22 @@ int main( int argc, char * const argv[] )
 
 				break;
 
+			case 'b':
+				batch_mode = 1;
+
+				break;
+
+			case 'C':
+				checksum_list = optarg;
+				batch_mode    = 1;
+
+				break;
+
 			case 'h':
+				assorted_output_version_fprint(
+				 stdout,
+				 program );
+
 				usage_fprint(
 				 stdout );
 
@@ -153,6 +662,11 @@ int main( int argc, char * const argv[] )
 
 				break;
 
+			case 'j':
+				number_of_batch_threads = (int) atol( optarg );
+
+				break;
+
 			case 'o':
 				source_offset = atol( optarg );
 
@@ -163,19 +677,49 @@ int main( int argc, char * const argv[] )
 
 				break;
 
+			case 'S':
+				option_statistics_format = optarg;
+
+				break;
+
+			case 't':
+				number_of_threads = (int) atol( optarg );
+
+				break;
+
+			case 'u':
+				direct_io_block_size = (size_t) atol( optarg );
+
+				break;
+
 			case 'v':
 				verbose = 1;
 
 				break;
 
 			case 'V':
+				assorted_output_version_fprint(
+				 stdout,
+				 program );
+
 				assorted_output_copyright_fprint(
 				 stdout );
 
 				return( EXIT_SUCCESS );
 		}
 	}
-	if( optind == argc )
+	if( ( argc - optind ) > 1 )
+	{
+		batch_mode = 1;
+	}
+	if( batch_mode == 0 )
+	{
+		assorted_output_version_fprint(
+		 stdout,
+		 program );
+	}
+	if( ( batch_mode == 0 )
+	 && ( optind == argc ) )
 	{
 		fprintf(
 		 stderr,
@@ -188,15 +732,128 @@ int main( int argc, char * const argv[] )
 	}
 	source = argv[ optind ];
 
+	if( ( number_of_threads <= 0 )
+	 || ( number_of_threads > ADLER32SUM_MAXIMUM_NUMBER_OF_THREADS ) )
+	{
+		fprintf(
+		 stderr,
+		 "Unsupported number of threads, value must be between 1 and %d.\n",
+		 ADLER32SUM_MAXIMUM_NUMBER_OF_THREADS );
+
+		return( EXIT_FAILURE );
+	}
+#if !defined( HAVE_MULTI_THREAD_SUPPORT )
+	if( number_of_threads > 1 )
+	{
+		fprintf(
+		 stderr,
+		 "Multi-threading not supported, using a single thread.\n" );
+
+		number_of_threads = 1;
+	}
+#endif
 	libcnotify_stream_set(
 	 stderr,
 	 NULL );
 	libcnotify_verbose_set(
 	 verbose );
 
+	if( assorted_output_statistics_initialize(
+	     option_statistics_format,
+	     &error ) != 1 )
+	{
+		fprintf(
+		 stderr,
+		 "Unable to initialize statistics.\n" );
+
+		goto on_error;
+	}
+
+	if( batch_mode != 0 )
+	{
+		if( ( source_offset != 0 )
+		 || ( source_size != 0 ) )
+		{
+			fprintf(
+			 stderr,
+			 "Offset and size are not supported in batch mode.\n" );
+
+			return( EXIT_FAILURE );
+		}
+		if( direct_io_block_size != 0 )
+		{
+			fprintf(
+			 stderr,
+			 "Direct I/O is not supported in batch mode.\n" );
+
+			return( EXIT_FAILURE );
+		}
+		if( ( number_of_batch_threads <= 0 )
+		 || ( number_of_batch_threads > ASSORTED_BATCH_MAXIMUM_NUMBER_OF_THREADS ) )
+		{
+			fprintf(
+			 stderr,
+			 "Unsupported number of threads, value must be between 1 and %d.\n",
+			 ASSORTED_BATCH_MAXIMUM_NUMBER_OF_THREADS );
+
+			return( EXIT_FAILURE );
+		}
+		/* The methods are not calibrated since the size of the files is not known in advance
+		 */
+		if( calculation_method == 0 )
+		{
+			calculation_method = 4;
+		}
+		if( assorted_batch_initialize(
+		     &batch,
+		     adler32sum_batch_calculate,
+		     (void *) &calculation_method,
+		     (uint64_t) initial_value,
+		     4,
+		     number_of_batch_threads,
+		     &error ) != 1 )
+		{
+			fprintf(
+			 stderr,
+			 "Unable to create batch.\n" );
+
+			goto on_error;
+		}
+		result = assorted_batch_process(
+		          batch,
+		          argc - optind,
+		          &( argv[ optind ] ),
+		          checksum_list,
+		          &error );
+
+		if( result == -1 )
+		{
+			fprintf(
+			 stderr,
+			 "Unable to process batch.\n" );
+
+			goto on_error;
+		}
+		if( assorted_batch_free(
+		     &batch,
+		     &error ) != 1 )
+		{
+			fprintf(
+			 stderr,
+			 "Unable to free batch.\n" );
+
+			goto on_error;
+		}
+		if( result != 1 )
+		{
+			return( EXIT_FAILURE );
+		}
+		return( EXIT_SUCCESS );
+	}
+
 	/* Open the source file
 	 */
-	if( libcfile_file_initialize(
+	if( assorted_input_file_initialize(
 	     &source_file,
 	     &error ) != 1 )
 	{
@@ -206,10 +863,20 @@ int main( int argc, char * const argv[] )
 
 		goto on_error;
 	}
-	if( libcfile_file_open(
+	if( assorted_input_file_set_direct_io(
+	     source_file,
+	     direct_io_block_size,
+	     &error ) != 1 )
+	{
+		fprintf(
+		 stderr,
+		 "Unable to set direct I/O block size of source file.\n" );
+
+		goto on_error;
+	}
+	if( assorted_input_file_open(
 	     source_file,
 	     source,
-	     LIBCFILE_OPEN_READ,
 	     &error ) != 1 )
 	{
 		fprintf(
@@ -220,7 +887,7 @@ int main( int argc, char * const argv[] )
 	}
 	if( source_size == 0 )
 	{
-		if( libcfile_file_get_size(
+		if( assorted_input_file_get_size(
 		     source_file,
 		     &source_size,
 		     &error ) == -1 )
@@ -240,28 +907,17 @@ int main( int argc, char * const argv[] )
 
 		goto on_error;
 	}
-	if( source_size > (size64_t) SSIZE_MAX )
-	{
-		fprintf(
-		 stderr,
-		 "Invalid source size value exceeds maximum.\n" );
-
-		goto on_error;
-	}
-	buffer = (uint8_t *) memory_allocate(
-	                      sizeof( uint8_t ) * source_size );
+	/* Read a block per thread at once so that the block can be split into ranges
+	 */
+	buffer_size = ADLER32SUM_BUFFER_SIZE * (size_t) number_of_threads;
 
-	if( buffer == NULL )
+	if( (size64_t) buffer_size > source_size )
 	{
-		fprintf(
-		 stderr,
-		 "Unable to create buffer.\n" );
-
-		goto on_error;
+		buffer_size = (size_t) source_size;
 	}
 	/* Position the source file at the right offset
 	 */
-	if( libcfile_file_seek_offset(
+	if( assorted_input_file_seek_offset(
 	     source_file,
 	     source_offset,
 	     SEEK_SET,
@@ -273,130 +929,188 @@ int main( int argc, char * const argv[] )
 
 		goto on_error;
 	}
-	read_count = libcfile_file_read_buffer(
-		      source_file,
-		      buffer,
-		      source_size,
-	              &error );
-
-	if( read_count != (ssize_t) source_size )
-	{
-		fprintf(
-		 stderr,
-		 "Unable to read from source file.\n" );
-
-		goto on_error;
-	}
-	/* Clean up
+	/* Read the next blocks ahead while the current block is processed
 	 */
-	if( libcfile_file_close(
+	if( assorted_input_file_set_read_ahead(
 	     source_file,
-	     &error ) != 0 )
-	{
-		fprintf(
-		 stderr,
-		 "Unable to close source file.\n" );
-
-		goto on_error;
-	}
-	if( libcfile_file_free(
-	     &source_file,
+	     buffer_size,
+	     ASSORTED_INPUT_FILE_DEFAULT_NUMBER_OF_READ_AHEAD_BLOCKS,
 	     &error ) != 1 )
 	{
 		fprintf(
 		 stderr,
-		 "Unable to free source file.\n" );
+		 "Unable to set read-ahead of source file.\n" );
 
 		goto on_error;
 	}
-	if( calculation_method == 1 )
+	if( calculation_method == 0 )
 	{
-		result = checksum_calculate_adler32_basic2(
-		          &checksum_value,
-		          buffer,
-		          source_size,
-		          initial_value,
-		          &error );
+		calculation_method = 4;
+
+		if( source_size >= ASSORTED_CALIBRATE_MINIMUM_DATA_SIZE )
+		{
+			if( assorted_calibrate_select_calculation_method(
+			     adler32sum_calibrate_calculate,
+			     adler32sum_calculation_methods,
+			     (int) ( sizeof( adler32sum_calculation_methods ) / sizeof( int ) ),
+			     &calculation_method,
+			     &error ) != 1 )
+			{
+				fprintf(
+				 stderr,
+				 "Unable to calibrate calculation methods.\n" );
+
+				goto on_error;
+			}
+		}
+		if( verbose != 0 )
+		{
+			fprintf(
+			 stderr,
+			 "Selected calculation method: %d\n",
+			 calculation_method );
+		}
 	}
-	else if( calculation_method == 2 )
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+	/* The workers are started once and bound to the CPUs so that they
+	 * keep running on the same NUMA node for all the blocks
+	 */
+	if( number_of_threads > 1 )
 	{
-		/* The unfolded4_2 variant is slower than the unfolded4_1 variant
-		 */
-		/* Fastest to slowest variant
-		 * - checksum_calculate_adler32_unfolded16_4
-		 * - checksum_calculate_adler32_unfolded16_2
-		 * - checksum_calculate_adler32_unfolded16_1
-		 * - checksum_calculate_adler32_unfolded16_3
-		 */
-		result = checksum_calculate_adler32_unfolded16_4(
-		          &checksum_value,
-		          buffer,
-		          source_size,
-		          initial_value,
-		          &error );
+		if( assorted_worker_pool_initialize(
+		     &worker_pool,
+		     number_of_threads,
+		     0,
+		     ASSORTED_WORKER_POOL_FLAG_CPU_AFFINITY,
+		     &error ) != 1 )
+		{
+			fprintf(
+			 stderr,
+			 "Unable to create worker pool.\n" );
+
+			goto on_error;
+		}
 	}
-	else if( calculation_method == 3 )
+#endif
+	/* Read the source data in blocks and pass the Adler-32 of the previous
+	 * blocks as the initial value of the next block
+	 */
+	checksum_value = initial_value;
+	remaining_size = source_size;
+
+	while( remaining_size > 0 )
 	{
-		/* The unfolded variants seems to be faster then the CPU aligned
-		 */
-		result = checksum_calculate_adler32_cpu_aligned(
-		          &checksum_value,
-		          buffer,
-		          source_size,
-		          initial_value,
-		          &error );
+		read_size = buffer_size;
+
+		if( (size64_t) read_size > remaining_size )
+		{
+			read_size = (size_t) remaining_size;
+		}
+		read_count = assorted_input_file_read_data(
+		              source_file,
+		              &buffer,
+		              read_size,
+		              &error );
+
+		if( read_count != (ssize_t) read_size )
+		{
+			fprintf(
+			 stderr,
+			 "Unable to read from source file.\n" );
+
+			goto on_error;
+		}
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+		if( number_of_threads > 1 )
+		{
+			result = adler32sum_calculate_parallel(
+			          calculation_method,
+			          &checksum_value,
+			          buffer,
+			          read_size,
+			          checksum_value,
+			          worker_pool,
+			          &error );
+		}
+		else
+#endif
+		{
+			result = adler32sum_calculate(
+			          calculation_method,
+			          &checksum_value,
+			          buffer,
+			          read_size,
+			          checksum_value,
+			          &error );
+		}
+		if( result != 1 )
+		{
+			fprintf(
+			 stderr,
+			 "Unable to calculate Adler-32.\n" );
+
+			goto on_error;
+		}
+		if( libcnotify_verbose != 0 )
+		{
+			libcnotify_print_data(
+			 buffer,
+			 read_size,
+			 0 );
+		}
+		remaining_size -= read_size;
 	}
-	else if( calculation_method == 4 )
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+	if( worker_pool != NULL )
 	{
-/* TODO experimental */
-		result = checksum_calculate_adler32_simd(
-		          &checksum_value,
-		          buffer,
-		          source_size,
-		          initial_value,
-		          &error );
+		if( assorted_worker_pool_free(
+		     &worker_pool,
+		     &error ) != 1 )
+		{
+			fprintf(
+			 stderr,
+			 "Unable to free worker pool.\n" );
+
+			goto on_error;
+		}
 	}
-	else if( calculation_method == 5 )
+#endif
+	/* Clean up
+	 */
+	if( assorted_input_file_close(
+	     source_file,
+	     &error ) != 0 )
 	{
-#if !defined( HAVE_ZLIB_ADLER32 )
 		fprintf(
 		 stderr,
-		 "Missing zlib Adler-32 support.\n" );
+		 "Unable to close source file.\n" );
 
 		goto on_error;
-#else
-		checksum_value = adler32(
-		                  initial_value,
-		                  buffer,
-		                  source_size );
-
-		result = 1;
-#endif
 	}
-	if( result != 1 )
+	if( assorted_input_file_free(
+	     &source_file,
+	     &error ) != 1 )
 	{
 		fprintf(
 		 stderr,
-		 "Unable to calculate Adler-32.\n" );
+		 "Unable to free source file.\n" );
 
 		goto on_error;
 	}
-	if( libcnotify_verbose != 0 )
-	{
-		libcnotify_print_data(
-		 buffer,
-		 source_size,
-		 0 );
-	}
-	memory_free(
-	 buffer );
-
 	fprintf(
 	 stdout,
 	 "Calculated Adler-32: %" PRIu32 " (0x%08" PRIx32 ")\n",
 	 checksum_value,
 	 checksum_value );
 
+	assorted_output_statistics_fprint(
+	 stderr,
+	 program,
+	 1,
+	 NULL );
+	assorted_output_statistics_free(
+	 NULL );
+
 	return( EXIT_SUCCESS );
 
 on_error:
@@ -407,14 +1121,30 @@ on_error:
 		libcerror_error_free(
 		 &error );
 	}
-	if( buffer != NULL )
+	assorted_output_statistics_fprint(
+	 stderr,
+	 program,
+	 -1,
+	 NULL );
+	assorted_output_statistics_free(
+	 NULL );
+	if( batch != NULL )
+	{
+		assorted_batch_free(
+		 &batch,
+		 NULL );
+	}
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+	if( worker_pool != NULL )
 	{
-		memory_free(
-		 buffer );
+		assorted_worker_pool_free(
+		 &worker_pool,
+		 NULL );
 	}
+#endif
 	if( source_file != NULL )
 	{
-		libcfile_file_free(
+		assorted_input_file_free(
 		 &source_file,
 		 NULL );
 	}
@@ -20,10 +20,16 @@
  */
 
 #include <common.h>
+#include <byte_stream.h>
 #include <types.h>
 
 #include "assorted_libcerror.h"
 #include "ascii7.h"
+#include "cpu_features.h"
+
+#if defined( HAVE_CPU_FEATURES_X86 )
+#include <immintrin.h>
+#endif
 
 /* Determines the uncompressed data size from the ASCII 7-bit compressed data
  * Return 1 on success or -1 on error
@@ -69,7 +75,7 @@ int ascii7_get_uncompressed_data_size(
 
 		return( -1 );
 	}
-	if( compressed_data_size <= 1 )
+	if( compressed_data_size == 0 )
 	{
 		libcerror_error_set(
 		 error,
@@ -85,6 +91,76 @@ int ascii7_get_uncompressed_data_size(
 	return( 1 );
 }
 
+#if defined( HAVE_CPU_FEATURES_X86 )
+
+/* Decompresses blocks of 14 bytes of ASCII 7-bit compressed data into 16 bytes using SSSE3
+ * Every 16-bit lane is filled with the 2 bytes that contain the 7 bits of an uncompressed byte,
+ * the bits are moved into the upper byte of the lane by a multiplication and then shifted
+ * back into the lower byte. Note that every block reads 2 bytes beyond the end of the block
+ */
+CPU_FEATURES_TARGET( "ssse3" )
+static void ascii7_decompress_ssse3(
+             uint8_t *uncompressed_data,
+             const uint8_t *compressed_data,
+             size_t number_of_blocks )
+{
+	__m128i lower_shuffle;
+	__m128i mask;
+	__m128i multipliers;
+	__m128i upper_shuffle;
+	__m128i value;
+	__m128i values1;
+	__m128i values2;
+
+	lower_shuffle = _mm_setr_epi8(
+	                 0, 1, 0, 1, 1, 2, 2, 3, 3, 4, 4, 5, 5, 6, 6, -1 );
+	upper_shuffle = _mm_setr_epi8(
+	                 7, 8, 7, 8, 8, 9, 9, 10, 10, 11, 11, 12, 12, 13, 13, -1 );
+	multipliers   = _mm_setr_epi16(
+	                 256, 2, 4, 8, 16, 32, 64, 128 );
+	mask          = _mm_set1_epi16(
+	                 0x007f );
+
+	while( number_of_blocks > 0 )
+	{
+		value = _mm_loadu_si128(
+		         (const __m128i *) compressed_data );
+
+		values1 = _mm_and_si128(
+		           _mm_srli_epi16(
+		            _mm_mullo_epi16(
+		             _mm_shuffle_epi8(
+		              value,
+		              lower_shuffle ),
+		             multipliers ),
+		            8 ),
+		           mask );
+
+		values2 = _mm_and_si128(
+		           _mm_srli_epi16(
+		            _mm_mullo_epi16(
+		             _mm_shuffle_epi8(
+		              value,
+		              upper_shuffle ),
+		             multipliers ),
+		            8 ),
+		           mask );
+
+		_mm_storeu_si128(
+		 (__m128i *) uncompressed_data,
+		 _mm_packus_epi16(
+		  values1,
+		  values2 ) );
+
+		compressed_data   += 14;
+		uncompressed_data += 16;
+
+		number_of_blocks--;
+	}
+}
+
+#endif /* defined( HAVE_CPU_FEATURES_X86 ) */
+
 /* Decompresses data using ASCII 7-bit compression
  * Returns 1 on success or -1 on error
  */
@@ -98,8 +174,14 @@ int ascii7_decompress(
 	static char *function             = "ascii7_decompress";
 	size_t compressed_data_iterator   = 0;
 	size_t uncompressed_data_iterator = 0;
+	uint64_t value_64bit              = 0;
 	uint16_t value_16bit              = 0;
 	uint8_t bit_index                 = 0;
+	uint8_t byte_index                = 0;
+
+#if defined( HAVE_CPU_FEATURES_X86 )
+	size_t number_of_blocks           = 0;
+#endif
 
 	if( uncompressed_data == NULL )
 	{
@@ -145,6 +227,17 @@ int ascii7_decompress(
 
 		return( -1 );
 	}
+	if( compressed_data_size == 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_TOO_SMALL,
+		 "%s: compressed data size value too small.",
+		 function );
+
+		return( -1 );
+	}
 	if( uncompressed_data_size < ( 1 + ( ( compressed_data_size - 1 ) * 8 ) / 7 ) )
 	{
 		libcerror_error_set(
@@ -158,7 +251,50 @@ int ascii7_decompress(
 	}
 	uncompressed_data[ uncompressed_data_iterator++ ] = compressed_data[ 0 ];
 
-	for( compressed_data_iterator = 1;
+	compressed_data_iterator = 1;
+
+	/* Every 7 bytes of compressed data contain exactly 8 bytes of uncompressed data
+	 * hence the compressed data can be decompressed in groups of 7 bytes
+	 */
+#if defined( HAVE_CPU_FEATURES_X86 )
+	if( ( compressed_data_size >= 17 )
+	 && ( cpu_features_has(
+	       CPU_FEATURE_FLAG_SSSE3 ) != 0 ) )
+	{
+		/* The last block must be followed by 2 bytes of compressed data
+		 */
+		number_of_blocks = ( compressed_data_size - 3 ) / 14;
+
+		ascii7_decompress_ssse3(
+		 &( uncompressed_data[ uncompressed_data_iterator ] ),
+		 &( compressed_data[ compressed_data_iterator ] ),
+		 number_of_blocks );
+
+		compressed_data_iterator   += number_of_blocks * 14;
+		uncompressed_data_iterator += number_of_blocks * 16;
+	}
+#endif
+	/* Decompress groups of 7 bytes using 8-byte reads
+	 */
+	while( ( compressed_data_size - compressed_data_iterator ) >= 8 )
+	{
+		byte_stream_copy_to_uint64_little_endian(
+		 &( compressed_data[ compressed_data_iterator ] ),
+		 value_64bit );
+
+		for( byte_index = 0;
+		     byte_index < 8;
+		     byte_index++ )
+		{
+			uncompressed_data[ uncompressed_data_iterator++ ] = (uint8_t) ( value_64bit & 0x7f );
+
+			value_64bit >>= 7;
+		}
+		compressed_data_iterator += 7;
+	}
+	/* Decompress the remaining bytes
+	 */
+	for( ;
 	     compressed_data_iterator < compressed_data_size;
 	     compressed_data_iterator++ )
 	{
@@ -179,10 +315,315 @@ int ascii7_decompress(
 			bit_index = 0;
 		}
 	}
-	if( value_16bit != 0 )
+	if( ( value_16bit != 0 )
+	 && ( uncompressed_data_iterator < uncompressed_data_size ) )
 	{
 		uncompressed_data[ uncompressed_data_iterator++ ] = value_16bit & 0x7f;
 	}
 	return( 1 );
 }
 
+/* Determines the compressed data size of data to be compressed using ASCII 7-bit compression
+ * Return 1 on success or -1 on error
+ */
+int ascii7_get_compressed_data_size(
+     const uint8_t *uncompressed_data,
+     size_t uncompressed_data_size,
+     size_t *compressed_data_size,
+     libcerror_error_t **error )
+{
+	static char *function    = "ascii7_get_compressed_data_size";
+	size_t number_of_septets = 0;
+
+	if( uncompressed_data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid uncompressed data.",
+		 function );
+
+		return( -1 );
+	}
+	if( uncompressed_data_size > (size_t) SSIZE_MAX )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid uncompressed data size value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	if( compressed_data_size == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid compressed data size.",
+		 function );
+
+		return( -1 );
+	}
+	if( uncompressed_data_size == 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_TOO_SMALL,
+		 "%s: uncompressed data size value too small.",
+		 function );
+
+		return( -1 );
+	}
+	/* The first byte is stored as-is and every other byte is stored as 7 bits
+	 */
+	number_of_septets = uncompressed_data_size - 1;
+
+	*compressed_data_size = 1 + ( ( number_of_septets / 8 ) * 7 ) + ( ( ( number_of_septets % 8 ) * 7 ) + 7 ) / 8;
+
+	return( 1 );
+}
+
+#if defined( HAVE_CPU_FEATURES_X86 )
+
+/* Compresses blocks of 16 bytes of uncompressed data into 14 bytes of ASCII 7-bit compressed data using SSE2
+ * Every 64-bit lane is packed into 56 bits by merging the 7 bits of adjacent bytes, then pairs of
+ * 14 bits and then pairs of 28 bits. Note that every block writes 1 byte beyond the end of the block
+ */
+CPU_FEATURES_TARGET( "sse2" )
+static void ascii7_compress_sse2(
+             uint8_t *compressed_data,
+             const uint8_t *uncompressed_data,
+             size_t number_of_blocks )
+{
+	__m128i lower_mask7;
+	__m128i lower_mask14;
+	__m128i lower_mask28;
+	__m128i upper_mask7;
+	__m128i upper_mask14;
+	__m128i upper_mask28;
+	__m128i value;
+
+	lower_mask7  = _mm_set1_epi16(
+	                0x007f );
+	upper_mask7  = _mm_set1_epi16(
+	                0x7f00 );
+	lower_mask14 = _mm_set1_epi32(
+	                0x00003fffUL );
+	upper_mask14 = _mm_set1_epi32(
+	                0x3fff0000UL );
+	lower_mask28 = _mm_set_epi32(
+	                0, 0x0fffffffUL, 0, 0x0fffffffUL );
+	upper_mask28 = _mm_set_epi32(
+	                0x0fffffffUL, 0, 0x0fffffffUL, 0 );
+
+	while( number_of_blocks > 0 )
+	{
+		value = _mm_loadu_si128(
+		         (const __m128i *) uncompressed_data );
+
+		value = _mm_or_si128(
+		         _mm_and_si128(
+		          value,
+		          lower_mask7 ),
+		         _mm_srli_epi16(
+		          _mm_and_si128(
+		           value,
+		           upper_mask7 ),
+		          1 ) );
+
+		value = _mm_or_si128(
+		         _mm_and_si128(
+		          value,
+		          lower_mask14 ),
+		         _mm_srli_epi32(
+		          _mm_and_si128(
+		           value,
+		           upper_mask14 ),
+		          2 ) );
+
+		value = _mm_or_si128(
+		         _mm_and_si128(
+		          value,
+		          lower_mask28 ),
+		         _mm_srli_epi64(
+		          _mm_and_si128(
+		           value,
+		           upper_mask28 ),
+		          4 ) );
+
+		/* The upper byte of the first lane is 0 and is overwritten by the second lane
+		 */
+		_mm_storel_epi64(
+		 (__m128i *) compressed_data,
+		 value );
+
+		_mm_storel_epi64(
+		 (__m128i *) &( compressed_data[ 7 ] ),
+		 _mm_unpackhi_epi64(
+		  value,
+		  value ) );
+
+		compressed_data   += 14;
+		uncompressed_data += 16;
+
+		number_of_blocks--;
+	}
+}
+
+#endif /* defined( HAVE_CPU_FEATURES_X86 ) */
+
+/* Compresses data using ASCII 7-bit compression
+ * The first byte is stored as-is, the most significant bit of the other bytes is discarded
+ * Returns 1 on success or -1 on error
+ */
+int ascii7_compress(
+     uint8_t *compressed_data,
+     size_t compressed_data_size,
+     const uint8_t *uncompressed_data,
+     size_t uncompressed_data_size,
+     libcerror_error_t **error )
+{
+	static char *function             = "ascii7_compress";
+	size_t compressed_data_iterator   = 0;
+	size_t required_compressed_size   = 0;
+	size_t uncompressed_data_iterator = 0;
+	uint64_t value_64bit              = 0;
+	uint16_t value_16bit              = 0;
+	uint8_t bit_index                 = 0;
+
+#if defined( HAVE_CPU_FEATURES_X86 )
+	size_t number_of_blocks           = 0;
+#endif
+
+	if( compressed_data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid compressed data.",
+		 function );
+
+		return( -1 );
+	}
+	if( compressed_data_size > (size_t) SSIZE_MAX )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid compressed data size value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	if( ascii7_get_compressed_data_size(
+	     uncompressed_data,
+	     uncompressed_data_size,
+	     &required_compressed_size,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to determine compressed data size.",
+		 function );
+
+		return( -1 );
+	}
+	if( compressed_data_size < required_compressed_size )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_TOO_SMALL,
+		 "%s: compressed data size value too small.",
+		 function );
+
+		return( -1 );
+	}
+	compressed_data[ compressed_data_iterator++ ] = uncompressed_data[ 0 ];
+
+	uncompressed_data_iterator = 1;
+
+	/* Every 8 bytes of uncompressed data are packed into exactly 7 bytes of compressed data
+	 * hence the uncompressed data can be compressed in groups of 8 bytes
+	 */
+#if defined( HAVE_CPU_FEATURES_X86 )
+	if( ( ( uncompressed_data_size - uncompressed_data_iterator ) >= 32 )
+	 && ( cpu_features_has(
+	       CPU_FEATURE_FLAG_SSE2 ) != 0 ) )
+	{
+		number_of_blocks = ( uncompressed_data_size - uncompressed_data_iterator ) / 16;
+
+		/* The last block must be followed by 1 byte of compressed data
+		 */
+		if( ( number_of_blocks * 14 ) >= ( required_compressed_size - compressed_data_iterator ) )
+		{
+			number_of_blocks--;
+		}
+		ascii7_compress_sse2(
+		 &( compressed_data[ compressed_data_iterator ] ),
+		 &( uncompressed_data[ uncompressed_data_iterator ] ),
+		 number_of_blocks );
+
+		compressed_data_iterator   += number_of_blocks * 14;
+		uncompressed_data_iterator += number_of_blocks * 16;
+	}
+#endif
+	/* Compress groups of 8 bytes using 8-byte writes, of which the last byte
+	 * is overwritten by the next group
+	 */
+	while( ( ( uncompressed_data_size - uncompressed_data_iterator ) >= 8 )
+	    && ( ( required_compressed_size - compressed_data_iterator ) >= 8 ) )
+	{
+		byte_stream_copy_to_uint64_little_endian(
+		 &( uncompressed_data[ uncompressed_data_iterator ] ),
+		 value_64bit );
+
+		value_64bit = ( value_64bit & 0x007f007f007f007fULL )
+		            | ( ( value_64bit & 0x7f007f007f007f00ULL ) >> 1 );
+		value_64bit = ( value_64bit & 0x00003fff00003fffULL )
+		            | ( ( value_64bit & 0x3fff00003fff0000ULL ) >> 2 );
+		value_64bit = ( value_64bit & 0x000000000fffffffULL )
+		            | ( ( value_64bit & 0x0fffffff00000000ULL ) >> 4 );
+
+		byte_stream_copy_from_uint64_little_endian(
+		 &( compressed_data[ compressed_data_iterator ] ),
+		 value_64bit );
+
+		compressed_data_iterator   += 7;
+		uncompressed_data_iterator += 8;
+	}
+	/* Compress the remaining bytes
+	 */
+	for( ;
+	     uncompressed_data_iterator < uncompressed_data_size;
+	     uncompressed_data_iterator++ )
+	{
+		value_16bit |= (uint16_t) ( uncompressed_data[ uncompressed_data_iterator ] & 0x7f ) << bit_index;
+
+		bit_index += 7;
+
+		if( bit_index >= 8 )
+		{
+			compressed_data[ compressed_data_iterator++ ] = (uint8_t) ( value_16bit & 0xff );
+
+			value_16bit >>= 8;
+
+			bit_index -= 8;
+		}
+	}
+	if( bit_index > 0 )
+	{
+		compressed_data[ compressed_data_iterator++ ] = (uint8_t) ( value_16bit & 0xff );
+	}
+	return( 1 );
+}
+
@@ -44,6 +44,19 @@ int ascii7_decompress(
      size_t compressed_data_size,
      libcerror_error_t **error );
 
+int ascii7_get_compressed_data_size(
+     const uint8_t *uncompressed_data,
+     size_t uncompressed_data_size,
+     size_t *compressed_data_size,
+     libcerror_error_t **error );
+
+int ascii7_compress(
+     uint8_t *compressed_data,
+     size_t compressed_data_size,
+     const uint8_t *uncompressed_data,
+     size_t uncompressed_data_size,
+     libcerror_error_t **error );
+
 #if defined( __cplusplus )
 }
 #endif
@@ -0,0 +1,549 @@
+/*
+ * Compresses data using 7-bit ASCII compression
+ *
+ * Copyright (C) 2008-2019, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This software is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This software is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this software.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <file_stream.h>
+#include <memory.h>
+#include <system_string.h>
+#include <types.h>
+
+#if defined( HAVE_STDLIB_H )
+#include <stdlib.h>
+#endif
+
+#include "ascii7.h"
+#include "assorted_getopt.h"
+#include "assorted_input_file.h"
+#include "assorted_libcerror.h"
+#include "assorted_libcfile.h"
+#include "assorted_libcnotify.h"
+#include "assorted_output.h"
+#include "assorted_output_file.h"
+
+/* Prints the executable usage information
+ */
+void usage_fprint(
+      FILE *stream )
+{
+	if( stream == NULL )
+	{
+		return;
+	}
+	fprintf( stream, "Use ascii7compress to compress data using 7-bit ASCII compression.\n\n" );
+
+	fprintf( stream, "Usage: ascii7compress [ -D window ] [ -o offset ] [ -s size ]\n"
+	                 "                      [ -S format ] [ -t target ] [ -hvV ] source\n\n" );
+
+	fprintf( stream, "\tsource: the source file\n\n" );
+
+	fprintf( stream, "\t-D:     limit the hexadecimal representation of the data to\n"
+	                 "\t        a window formatted as offset:size or offset relative\n"
+	                 "\t        to the start of the data (default is all data)\n" );
+	fprintf( stream, "\t-h:     shows this help\n" );
+	fprintf( stream, "\t-o:     data offset (default is 0)\n" );
+	fprintf( stream, "\t-s:     size of data (default is the file size)\n" );
+	fprintf( stream, "\t-S:     print timing and throughput statistics of the open,\n"
+	                 "\t        read, compute and write phases and the peak memory\n"
+	                 "\t        size to stderr in the format: text or json\n" );
+	fprintf( stream, "\t-t:     specify the target file to write the output data,\n"
+	                 "\t        by default the data will be written to stdout in\n"
+	                 "\t        hexadecimal representation\n" );
+	fprintf( stream, "\t-v:     verbose output to stderr\n" );
+	fprintf( stream, "\t-V:     print version\n" );
+	fprintf( stream, "\n" );
+}
+
+/* The main program
+ */
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+int wmain( int argc, wchar_t * const argv[] )
+#else
+int main( int argc, char * const argv[] )
+#endif
+{
+	libcerror_error_t *error                     = NULL;
+	assorted_input_file_t *source_file           = NULL;
+	assorted_output_file_t *destination_file     = NULL;
+	system_character_t *option_hexdump_window    = NULL;
+	system_character_t *option_statistics_format = NULL;
+	system_character_t *option_target_path       = NULL;
+	system_character_t *source                   = NULL;
+	uint8_t *buffer                              = NULL;
+	uint8_t *compressed_data                     = NULL;
+	char *program                                = "ascii7compress";
+	system_integer_t option                      = 0;
+	size64_t source_size                         = 0;
+	size_t compressed_data_size                  = 0;
+	ssize_t read_count                           = 0;
+	ssize_t write_count                          = 0;
+	off_t source_offset                          = 0;
+	int is_mapped                                = 0;
+	int verbose                                  = 0;
+
+	assorted_output_version_fprint(
+	 stdout,
+	 program );
+
+	while( ( option = assorted_getopt(
+	                   argc,
+	                   argv,
+	                   _SYSTEM_STRING( "D:ho:s:S:t:vV" ) ) ) != (system_integer_t) -1 )
+	{
+		switch( option )
+		{
+			case (system_integer_t) '?':
+			default:
+				fprintf(
+				 stderr,
+				 "Invalid argument: %" PRIs_SYSTEM "\n",
+				 argv[ optind ] );
+
+				usage_fprint(
+				 stdout );
+
+				return( EXIT_FAILURE );
+
+			case (system_integer_t) 'D':
+				option_hexdump_window = optarg;
+
+				break;
+
+			case (system_integer_t) 'h':
+				usage_fprint(
+				 stdout );
+
+				return( EXIT_SUCCESS );
+
+			case (system_integer_t) 'o':
+				source_offset = atol( optarg );
+
+				break;
+
+			case (system_integer_t) 's':
+				source_size = atol( optarg );
+
+				break;
+
+			case (system_integer_t) 'S':
+				option_statistics_format = optarg;
+
+				break;
+
+			case (system_integer_t) 't':
+				option_target_path = optarg;
+
+				break;
+
+			case (system_integer_t) 'v':
+				verbose = 1;
+
+				break;
+
+			case (system_integer_t) 'V':
+				assorted_output_copyright_fprint(
+				 stdout );
+
+				return( EXIT_SUCCESS );
+		}
+	}
+	if( optind == argc )
+	{
+		fprintf(
+		 stderr,
+		 "Missing source file.\n" );
+
+		usage_fprint(
+		 stdout );
+
+		return( EXIT_FAILURE );
+	}
+	source = argv[ optind ];
+
+	libcnotify_stream_set(
+	 stderr,
+	 NULL );
+	libcnotify_verbose_set(
+	 verbose );
+
+	if( assorted_output_statistics_initialize(
+	     option_statistics_format,
+	     &error ) != 1 )
+	{
+		fprintf(
+		 stderr,
+		 "Unable to initialize statistics.\n" );
+
+		goto on_error;
+	}
+	if( option_hexdump_window != NULL )
+	{
+		if( assorted_output_hexdump_window_set(
+		     option_hexdump_window,
+		     &error ) != 1 )
+		{
+			fprintf(
+			 stderr,
+			 "Unsupported hexdump window.\n" );
+
+			goto on_error;
+		}
+	}
+	/* Open the source file
+	 */
+	if( assorted_input_file_initialize(
+	     &source_file,
+	     &error ) != 1 )
+	{
+		fprintf(
+		 stderr,
+		 "Unable to create source file.\n" );
+
+		goto on_error;
+	}
+	if( assorted_input_file_open(
+	     source_file,
+	     source,
+	     &error ) != 1 )
+	{
+		fprintf(
+		 stderr,
+		 "Unable to open source file.\n" );
+
+		goto on_error;
+	}
+	if( source_size == 0 )
+	{
+		if( assorted_input_file_get_size(
+		     source_file,
+		     &source_size,
+		     &error ) == -1 )
+		{
+			fprintf(
+			 stderr,
+			 "Unable to determine size of source file.\n" );
+
+			goto on_error;
+		}
+		if( source_size <= (size64_t) source_offset )
+		{
+			fprintf(
+			 stderr,
+			 "Invalid source size value is less equal than source offset.\n" );
+
+			goto on_error;
+		}
+		source_size -= source_offset;
+	}
+	if( source_size == 0 )
+	{
+		fprintf(
+		 stderr,
+		 "Invalid source size value is zero.\n" );
+
+		goto on_error;
+	}
+	if( source_size > (size_t) SSIZE_MAX )
+	{
+		fprintf(
+		 stderr,
+		 "Invalid source size value exceeds maximum.\n" );
+
+		goto on_error;
+	}
+	/* Position the source file at the right offset
+	 */
+	if( assorted_input_file_seek_offset(
+	     source_file,
+	     source_offset,
+	     SEEK_SET,
+	     &error ) == -1 )
+	{
+		fprintf(
+		 stderr,
+		 "Unable to seek offset in source file.\n" );
+
+		goto on_error;
+	}
+	fprintf(
+	 stdout,
+	 "Starting 7-bit ASCII compression of: %" PRIs_SYSTEM " at offset: %" PRIjd " (0x%08" PRIjx ").\n",
+	 source,
+	 source_offset,
+	 source_offset );
+
+	read_count = assorted_input_file_read_data(
+	              source_file,
+	              &buffer,
+	              (size_t) source_size,
+	              &error );
+
+	if( read_count != (ssize_t) source_size )
+	{
+		fprintf(
+		 stderr,
+		 "Unable to read from source file.\n" );
+
+		goto on_error;
+	}
+	if( ascii7_get_compressed_data_size(
+	     buffer,
+	     (size_t) source_size,
+	     &compressed_data_size,
+	     &error ) != 1 )
+	{
+		fprintf(
+		 stderr,
+		 "Unable to determine compressed data size.\n" );
+
+		goto on_error;
+	}
+	/* Open the destination file, if it can be mapped the data is compressed
+	 * directly into the destination file instead of a compressed data buffer
+	 */
+	if( option_target_path != NULL )
+	{
+		if( assorted_output_file_initialize(
+		     &destination_file,
+		     &error ) != 1 )
+		{
+			fprintf(
+			 stderr,
+			 "Unable to create destination file.\n" );
+
+			goto on_error;
+		}
+		if( assorted_output_file_open(
+		     destination_file,
+		     option_target_path,
+		     compressed_data_size,
+		     &error ) != 1 )
+		{
+			fprintf(
+			 stderr,
+			 "Unable to open destination file.\n" );
+
+			goto on_error;
+		}
+		is_mapped = assorted_output_file_get_mapped_data(
+		             destination_file,
+		             &compressed_data,
+		             &compressed_data_size,
+		             &error );
+
+		if( is_mapped == -1 )
+		{
+			fprintf(
+			 stderr,
+			 "Unable to retrieve mapped destination data.\n" );
+
+			goto on_error;
+		}
+	}
+	if( is_mapped == 0 )
+	{
+		compressed_data = (uint8_t *) memory_allocate(
+		                               sizeof( uint8_t ) * compressed_data_size );
+
+		if( compressed_data == NULL )
+		{
+			fprintf(
+			 stderr,
+			 "Unable to create compressed data buffer.\n" );
+
+			goto on_error;
+		}
+	}
+	/* Compress the data
+	 */
+	if( option_target_path == NULL )
+	{
+		fprintf(
+		 stderr,
+		 "Uncompressed data:\n" );
+
+		if( assorted_output_data_fprint(
+		     stderr,
+		     buffer,
+		     source_size,
+		     0,
+		     &error ) != 1 )
+		{
+			fprintf(
+			 stderr,
+			 "Unable to print uncompressed data.\n" );
+
+			goto on_error;
+		}
+	}
+	if( ascii7_compress(
+	     compressed_data,
+	     compressed_data_size,
+	     buffer,
+	     (size_t) source_size,
+	     &error ) != 1 )
+	{
+		fprintf(
+		 stderr,
+		 "Unable to compress data.\n" );
+
+		goto on_error;
+	}
+	if( option_target_path == NULL )
+	{
+		fprintf(
+		 stderr,
+		 "Compressed data:\n" );
+
+		if( assorted_output_data_fprint(
+		     stderr,
+		     compressed_data,
+		     compressed_data_size,
+		     0,
+		     &error ) != 1 )
+		{
+			fprintf(
+			 stderr,
+			 "Unable to print compressed data.\n" );
+
+			goto on_error;
+		}
+	}
+	else
+	{
+		write_count = assorted_output_file_write_data(
+			       destination_file,
+			       compressed_data,
+			       compressed_data_size,
+			       &error );
+
+		if( write_count != (ssize_t) compressed_data_size )
+		{
+			fprintf(
+			 stderr,
+			 "Unable to write to destination file.\n" );
+
+			goto on_error;
+		}
+		if( assorted_output_file_close(
+		     destination_file,
+		     &error ) != 0 )
+		{
+			fprintf(
+			 stderr,
+			 "Unable to close destination file.\n" );
+
+			goto on_error;
+		}
+		if( assorted_output_file_free(
+		     &destination_file,
+		     &error ) != 1 )
+		{
+			fprintf(
+			 stderr,
+			 "Unable to free destination file.\n" );
+
+			goto on_error;
+		}
+	}
+	/* Clean up
+	 */
+	if( assorted_input_file_close(
+	     source_file,
+	     &error ) != 0 )
+	{
+		fprintf(
+		 stderr,
+		 "Unable to close source file.\n" );
+
+		goto on_error;
+	}
+	if( assorted_input_file_free(
+	     &source_file,
+	     &error ) != 1 )
+	{
+		fprintf(
+		 stderr,
+		 "Unable to free source file.\n" );
+
+		goto on_error;
+	}
+	if( is_mapped == 0 )
+	{
+		memory_free(
+		 compressed_data );
+	}
+	compressed_data = NULL;
+
+	fprintf(
+	 stdout,
+	 "7-bit ASCII compression:\tSUCCESS\n" );
+
+	assorted_output_statistics_fprint(
+	 stderr,
+	 program,
+	 1,
+	 NULL );
+	assorted_output_statistics_free(
+	 NULL );
+
+	return( EXIT_SUCCESS );
+
+on_error:
+	if( error != NULL )
+	{
+		libcnotify_print_error_backtrace(
+		 error );
+		libcerror_error_free(
+		 &error );
+	}
+	assorted_output_statistics_fprint(
+	 stderr,
+	 program,
+	 -1,
+	 NULL );
+	assorted_output_statistics_free(
+	 NULL );
+
+	if( destination_file != NULL )
+	{
+		assorted_output_file_free(
+		 &destination_file,
+		 NULL );
+	}
+	if( ( compressed_data != NULL )
+	 && ( is_mapped == 0 ) )
+	{
+		memory_free(
+		 compressed_data );
+	}
+	if( source_file != NULL )
+	{
+		assorted_input_file_free(
+		 &source_file,
+		 NULL );
+	}
+	fprintf(
+	 stdout,
+	 "7-bit ASCII compression:\tFAILURE\n" );
+
+	return( EXIT_FAILURE );
+}
+
@@ -32,6 +32,7 @@
 
 #include "ascii7.h"
 #include "assorted_getopt.h"
+#include "assorted_input_file.h"
 #include "assorted_libcerror.h"
 #include "assorted_libcfile.h"
 #include "assorted_libcnotify.h"
@@ -48,13 +49,20 @@ void usage_fprint(
 	}
 	fprintf( stream, "Use ascii7decompress to decompress 7-bit ASCII compressed data.\n\n" );
 
-	fprintf( stream, "Usage: ascii7decompress [ -o offset ] [ -s size ] [ -hvV ] source\n\n" );
+	fprintf( stream, "Usage: ascii7decompress [ -D window ] [ -o offset ] [ -s size ]\n"
+	                 "                        [ -S format ] [ -hvV ] source\n\n" );
 
 	fprintf( stream, "\tsource: the source file\n\n" );
 
+	fprintf( stream, "\t-D:     limit the hexadecimal representation of the data to\n"
+	                 "\t        a window formatted as offset:size or offset relative\n"
+	                 "\t        to the start of the data (default is all data)\n" );
 	fprintf( stream, "\t-h:     shows this help\n" );
 	fprintf( stream, "\t-o:     data offset (default is 0)\n" );
 	fprintf( stream, "\t-s:     size of data (default is the file size)\n" );
+	fprintf( stream, "\t-S:     print timing and throughput statistics of the open,\n"
+	                 "\t        read, compute and write phases and the peak memory\n"
+	                 "\t        size to stderr in the format: text or json\n" );
 	fprintf( stream, "\t-v:     verbose output to stderr\n" );
 	fprintf( stream, "\t-V:     print version\n" );
 	fprintf( stream, "\n" );
@@ -70,20 +78,21 @@ int main( int argc, char * const argv[] )
 {
 	char destination[ 128 ];
 
-	libcerror_error_t *error      = NULL;
-	libcfile_file_t *source_file  = NULL;
-	system_character_t *source    = NULL;
-	uint8_t *buffer               = NULL;
-	uint8_t *uncompressed_data    = NULL;
-	char *program                 = "ascii7decompress";
-	system_integer_t option       = 0;
-	size64_t source_size          = 0;
-	size_t buffer_size            = 0;
-	size_t uncompressed_data_size = 0;
-	ssize_t read_count            = 0;
-	off_t source_offset           = 0;
-	int print_count               = 0;
-	int verbose                   = 0;
+	libcerror_error_t *error                     = NULL;
+	assorted_input_file_t *source_file           = NULL;
+	system_character_t *option_hexdump_window    = NULL;
+	system_character_t *option_statistics_format = NULL;
+	system_character_t *source                   = NULL;
+	uint8_t *buffer                              = NULL;
+	uint8_t *uncompressed_data                   = NULL;
+	char *program                                = "ascii7decompress";
+	system_integer_t option                      = 0;
+	size64_t source_size                         = 0;
+	size_t uncompressed_data_size                = 0;
+	ssize_t read_count                           = 0;
+	off_t source_offset                          = 0;
+	int print_count                              = 0;
+	int verbose                                  = 0;
 
 	assorted_output_version_fprint(
 	 stdout,
@@ -92,7 +101,7 @@ int main( int argc, char * const argv[] )
 	while( ( option = assorted_getopt(
 	                   argc,
 	                   argv,
-	                   _SYSTEM_STRING( "ho:s:vV" ) ) ) != (system_integer_t) -1 )
+	                   _SYSTEM_STRING( "D:ho:s:S:vV" ) ) ) != (system_integer_t) -1 )
 	{
 		switch( option )
 		{
@@ -108,6 +117,11 @@ int main( int argc, char * const argv[] )
 
 				return( EXIT_FAILURE );
 
+			case 'D':
+				option_hexdump_window = optarg;
+
+				break;
+
 			case 'h':
 				usage_fprint(
 				 stdout );
@@ -124,6 +138,11 @@ int main( int argc, char * const argv[] )
 
 				break;
 
+			case 'S':
+				option_statistics_format = optarg;
+
+				break;
+
 			case 'v':
 				verbose = 1;
 
@@ -155,9 +174,33 @@ int main( int argc, char * const argv[] )
 	libcnotify_verbose_set(
 	 verbose );
 
+	if( assorted_output_statistics_initialize(
+	     option_statistics_format,
+	     &error ) != 1 )
+	{
+		fprintf(
+		 stderr,
+		 "Unable to initialize statistics.\n" );
+
+		goto on_error;
+	}
+	if( option_hexdump_window != NULL )
+	{
+		if( assorted_output_hexdump_window_set(
+		     option_hexdump_window,
+		     &error ) != 1 )
+		{
+			fprintf(
+			 stderr,
+			 "Unsupported hexdump window.\n" );
+
+			goto on_error;
+		}
+	}
+
 	/* Open the source file
 	 */
-	if( libcfile_file_initialize(
+	if( assorted_input_file_initialize(
 	     &source_file,
 	     &error ) != 1 )
 	{
@@ -167,10 +210,9 @@ int main( int argc, char * const argv[] )
 
 		goto on_error;
 	}
-	if( libcfile_file_open(
+	if( assorted_input_file_open(
 	     source_file,
 	     source,
-	     LIBCFILE_OPEN_READ,
 	     &error ) != 1 )
 	{
 		fprintf(
@@ -181,7 +223,7 @@ int main( int argc, char * const argv[] )
 	}
 	if( source_size == 0 )
 	{
-		if( libcfile_file_get_size(
+		if( assorted_input_file_get_size(
 		     source_file,
 		     &source_size,
 		     &error ) == -1 )
@@ -209,21 +251,6 @@ int main( int argc, char * const argv[] )
 
 		goto on_error;
 	}
-	/* Create the input buffer
-	 */
-	buffer_size = source_size;
-
-	buffer = (uint8_t *) memory_allocate(
-	                      sizeof( uint8_t ) * buffer_size );
-
-	if( buffer == NULL )
-	{
-		fprintf(
-		 stderr,
-		 "Unable to create buffer.\n" );
-
-		return( EXIT_FAILURE );
-	}
 	uncompressed_data_size = 1 + ( ( ( source_size - 1 ) * 8 ) / 7 );
 
 	uncompressed_data = (uint8_t *) memory_allocate(
@@ -239,7 +266,7 @@ int main( int argc, char * const argv[] )
 	}
 	/* Position the source file at the right offset
 	 */
-	if( libcfile_file_seek_offset(
+	if( assorted_input_file_seek_offset(
 	     source_file,
 	     source_offset,
 	     SEEK_SET,
@@ -266,8 +293,6 @@ int main( int argc, char * const argv[] )
 
 		memory_free(
 		 uncompressed_data );
-		memory_free(
-		 buffer );
 
 		return( EXIT_FAILURE );
 	}
@@ -278,10 +303,10 @@ int main( int argc, char * const argv[] )
 	 source_offset,
 	 source_offset );
 
-	read_count = libcfile_file_read_buffer(
-		      source_file,
-		      buffer,
-		      source_size,
+	read_count = assorted_input_file_read_data(
+	              source_file,
+	              &buffer,
+	              (size_t) source_size,
 	              &error );
 
 	if( read_count != (ssize_t) source_size )
@@ -298,10 +323,19 @@ int main( int argc, char * const argv[] )
 	 stderr,
 	 "Compressed data:\n" );
 
-	libcnotify_print_data(
-	 buffer,
-	 source_size,
-	 0 );
+	if( assorted_output_data_fprint(
+	     stderr,
+	     buffer,
+	     source_size,
+	     0,
+	     &error ) != 1 )
+	{
+		fprintf(
+		 stderr,
+		 "Unable to print compressed data.\n" );
+
+		goto on_error;
+	}
 
 	if( ascii7_decompress(
 	     uncompressed_data,
@@ -320,10 +354,19 @@ int main( int argc, char * const argv[] )
 	 stderr,
 	 "Uncompressed data:\n" );
 
-	libcnotify_print_data(
-	 uncompressed_data,
-	 uncompressed_data_size,
-	 0 );
+	if( assorted_output_data_fprint(
+	     stderr,
+	     uncompressed_data,
+	     uncompressed_data_size,
+	     0,
+	     &error ) != 1 )
+	{
+		fprintf(
+		 stderr,
+		 "Unable to print uncompressed data.\n" );
+
+		goto on_error;
+	}
 
 	source_offset += source_size;
 	source_size   -= source_size;
@@ -401,7 +444,7 @@ int main( int argc, char * const argv[] )
 #endif
 	/* Clean up
 	 */
-	if( libcfile_file_close(
+	if( assorted_input_file_close(
 	     source_file,
 	     &error ) != 0 )
 	{
@@ -411,7 +454,7 @@ int main( int argc, char * const argv[] )
 
 		goto on_error;
 	}
-	if( libcfile_file_free(
+	if( assorted_input_file_free(
 	     &source_file,
 	     &error ) != 1 )
 	{
@@ -428,8 +471,13 @@ int main( int argc, char * const argv[] )
 	memory_free(
 	 uncompressed_data );
 
-	memory_free(
-	 buffer );
+	assorted_output_statistics_fprint(
+	 stderr,
+	 program,
+	 1,
+	 NULL );
+	assorted_output_statistics_free(
+	 NULL );
 
 	return( EXIT_SUCCESS );
 
@@ -441,6 +489,13 @@ on_error:
 		libcerror_error_free(
 		 &error );
 	}
+	assorted_output_statistics_fprint(
+	 stderr,
+	 program,
+	 -1,
+	 NULL );
+	assorted_output_statistics_free(
+	 NULL );
 #ifdef NOWRITE
 	if( destination_file != NULL )
 	{
@@ -454,14 +509,9 @@ on_error:
 		memory_free(
 		 uncompressed_data );
 	}
-	if( buffer != NULL )
-	{
-		memory_free(
-		 buffer );
-	}
 	if( source_file != NULL )
 	{
-		libcfile_file_free(
+		assorted_input_file_free(
 		 &source_file,
 		 NULL );
 	}
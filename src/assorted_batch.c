@@ -0,0 +1,2092 @@
+/*
+ * Batch functions for the assorted
+ *
+ * Copyright (C) 2008-2019, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This software is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This software is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this software.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <file_stream.h>
+#include <memory.h>
+#include <system_string.h>
+#include <types.h>
+
+#if defined( HAVE_SYS_STAT_H )
+#include <sys/stat.h>
+#endif
+
+#if defined( HAVE_DIRENT_H ) && !defined( WINAPI )
+#include <dirent.h>
+#endif
+
+#include "assorted_batch.h"
+#include "assorted_input_file.h"
+#include "assorted_libcerror.h"
+#include "assorted_libcnotify.h"
+#include "assorted_libcthreads.h"
+
+#if defined( WINAPI )
+#define ASSORTED_BATCH_PATH_SEPARATOR	'\\'
+#else
+#define ASSORTED_BATCH_PATH_SEPARATOR	'/'
+#endif
+
+/* Creates a batch file
+ * Make sure the value batch_file is referencing, is set to NULL
+ * Returns 1 if successful or -1 on error
+ */
+int assorted_batch_file_initialize(
+     assorted_batch_file_t **batch_file,
+     const system_character_t *path,
+     size_t path_length,
+     libcerror_error_t **error )
+{
+	static char *function = "assorted_batch_file_initialize";
+
+	if( batch_file == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid batch file.",
+		 function );
+
+		return( -1 );
+	}
+	if( *batch_file != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid batch file value already set.",
+		 function );
+
+		return( -1 );
+	}
+	if( path == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid path.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( path_length == 0 )
+	 || ( path_length >= (size_t) ( SSIZE_MAX / sizeof( system_character_t ) ) ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid path length value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	*batch_file = memory_allocate_structure(
+	               assorted_batch_file_t );
+
+	if( *batch_file == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create batch file.",
+		 function );
+
+		goto on_error;
+	}
+	if( memory_set(
+	     *batch_file,
+	     0,
+	     sizeof( assorted_batch_file_t ) ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear batch file.",
+		 function );
+
+		memory_free(
+		 *batch_file );
+
+		*batch_file = NULL;
+
+		return( -1 );
+	}
+	( *batch_file )->path = system_string_allocate(
+	                         path_length + 1 );
+
+	if( ( *batch_file )->path == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create path.",
+		 function );
+
+		goto on_error;
+	}
+	if( system_string_copy(
+	     ( *batch_file )->path,
+	     path,
+	     path_length ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+		 "%s: unable to copy path.",
+		 function );
+
+		goto on_error;
+	}
+	( *batch_file )->path[ path_length ] = 0;
+
+	return( 1 );
+
+on_error:
+	if( *batch_file != NULL )
+	{
+		if( ( *batch_file )->path != NULL )
+		{
+			memory_free(
+			 ( *batch_file )->path );
+		}
+		memory_free(
+		 *batch_file );
+
+		*batch_file = NULL;
+	}
+	return( -1 );
+}
+
+/* Frees a batch file
+ * Returns 1 if successful or -1 on error
+ */
+int assorted_batch_file_free(
+     assorted_batch_file_t **batch_file,
+     libcerror_error_t **error )
+{
+	static char *function = "assorted_batch_file_free";
+
+	if( batch_file == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid batch file.",
+		 function );
+
+		return( -1 );
+	}
+	if( *batch_file != NULL )
+	{
+		if( ( *batch_file )->path != NULL )
+		{
+			memory_free(
+			 ( *batch_file )->path );
+		}
+		memory_free(
+		 *batch_file );
+
+		*batch_file = NULL;
+	}
+	return( 1 );
+}
+
+/* Creates a batch
+ * Make sure the value batch is referencing, is set to NULL
+ * Returns 1 if successful or -1 on error
+ */
+int assorted_batch_initialize(
+     assorted_batch_t **batch,
+     assorted_batch_calculate_function_t calculate_function,
+     void *calculate_function_arguments,
+     uint64_t initial_value,
+     uint8_t checksum_value_size,
+     int number_of_threads,
+     libcerror_error_t **error )
+{
+	static char *function = "assorted_batch_initialize";
+
+	if( batch == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid batch.",
+		 function );
+
+		return( -1 );
+	}
+	if( *batch != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid batch value already set.",
+		 function );
+
+		return( -1 );
+	}
+	if( calculate_function == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid calculate function.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( checksum_value_size != 4 )
+	 && ( checksum_value_size != 8 ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_UNSUPPORTED_VALUE,
+		 "%s: unsupported checksum value size.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( number_of_threads <= 0 )
+	 || ( number_of_threads > ASSORTED_BATCH_MAXIMUM_NUMBER_OF_THREADS ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid number of threads value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	*batch = memory_allocate_structure(
+	          assorted_batch_t );
+
+	if( *batch == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create batch.",
+		 function );
+
+		goto on_error;
+	}
+	if( memory_set(
+	     *batch,
+	     0,
+	     sizeof( assorted_batch_t ) ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear batch.",
+		 function );
+
+		goto on_error;
+	}
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+	if( number_of_threads > 1 )
+	{
+		if( libcthreads_mutex_initialize(
+		     &( ( *batch )->mutex ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+			 "%s: unable to create mutex.",
+			 function );
+
+			goto on_error;
+		}
+	}
+#else
+	/* Without multi-threading support all files are calculated by the calling thread
+	 */
+	number_of_threads = 1;
+#endif
+	( *batch )->calculate_function           = calculate_function;
+	( *batch )->calculate_function_arguments = calculate_function_arguments;
+	( *batch )->initial_value                = initial_value;
+	( *batch )->checksum_value_size          = checksum_value_size;
+	( *batch )->number_of_threads            = number_of_threads;
+
+	return( 1 );
+
+on_error:
+	if( *batch != NULL )
+	{
+		memory_free(
+		 *batch );
+
+		*batch = NULL;
+	}
+	return( -1 );
+}
+
+/* Frees a batch
+ * Returns 1 if successful or -1 on error
+ */
+int assorted_batch_free(
+     assorted_batch_t **batch,
+     libcerror_error_t **error )
+{
+	static char *function = "assorted_batch_free";
+	int result            = 1;
+
+	if( batch == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid batch.",
+		 function );
+
+		return( -1 );
+	}
+	if( *batch != NULL )
+	{
+		if( assorted_batch_stop(
+		     *batch,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to stop batch.",
+			 function );
+
+			result = -1;
+		}
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+		if( ( *batch )->mutex != NULL )
+		{
+			if( libcthreads_mutex_free(
+			     &( ( *batch )->mutex ),
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+				 "%s: unable to free mutex.",
+				 function );
+
+				result = -1;
+			}
+		}
+#endif
+		memory_free(
+		 *batch );
+
+		*batch = NULL;
+	}
+	return( result );
+}
+
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+
+/* Calculates the checksum of a batch file, used as the callback function of the thread pool
+ * The batch file is freed afterwards
+ * Returns 1 if successful or -1 on error
+ */
+int assorted_batch_thread_pool_calculate(
+     intptr_t *value,
+     void *arguments )
+{
+	assorted_batch_file_t *batch_file = NULL;
+	libcerror_error_t *error          = NULL;
+	int result                        = 0;
+
+	if( ( value == NULL )
+	 || ( arguments == NULL ) )
+	{
+		return( -1 );
+	}
+	batch_file = (assorted_batch_file_t *) value;
+
+	result = assorted_batch_calculate_file(
+	          (assorted_batch_t *) arguments,
+	          batch_file,
+	          &error );
+
+	if( result != 1 )
+	{
+		libcnotify_print_error_backtrace(
+		 error );
+		libcerror_error_free(
+		 &error );
+	}
+	assorted_batch_file_free(
+	 &batch_file,
+	 NULL );
+
+	return( result );
+}
+
+#endif /* defined( HAVE_MULTI_THREAD_SUPPORT ) */
+
+/* Starts a batch
+ * When multiple threads are used the files are calculated by a thread pool
+ * Returns 1 if successful or -1 on error
+ */
+int assorted_batch_start(
+     assorted_batch_t *batch,
+     libcerror_error_t **error )
+{
+	static char *function = "assorted_batch_start";
+
+	if( batch == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid batch.",
+		 function );
+
+		return( -1 );
+	}
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+	if( batch->thread_pool != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid batch - thread pool value already set.",
+		 function );
+
+		return( -1 );
+	}
+	if( batch->number_of_threads > 1 )
+	{
+		/* The size of the queue bounds the number of files that are open at the same time
+		 */
+		if( libcthreads_thread_pool_create(
+		     &( batch->thread_pool ),
+		     NULL,
+		     batch->number_of_threads,
+		     batch->number_of_threads * ASSORTED_BATCH_MAXIMUM_NUMBER_OF_QUEUED_FILES,
+		     assorted_batch_thread_pool_calculate,
+		     (void *) batch,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+			 "%s: unable to create thread pool.",
+			 function );
+
+			return( -1 );
+		}
+	}
+#endif
+	return( 1 );
+}
+
+/* Stops a batch
+ * Waits until the checksums of all the files that were added have been calculated
+ * Returns 1 if successful or -1 on error
+ */
+int assorted_batch_stop(
+     assorted_batch_t *batch,
+     libcerror_error_t **error )
+{
+	static char *function = "assorted_batch_stop";
+
+	if( batch == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid batch.",
+		 function );
+
+		return( -1 );
+	}
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+	if( batch->thread_pool != NULL )
+	{
+		if( libcthreads_thread_pool_join(
+		     &( batch->thread_pool ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to join thread pool.",
+			 function );
+
+			return( -1 );
+		}
+	}
+#endif
+	return( 1 );
+}
+
+/* Calculates the checksum of the data of a file
+ * Returns 1 if successful or -1 on error
+ */
+int assorted_batch_calculate_file_checksum(
+     assorted_batch_t *batch,
+     const system_character_t *path,
+     uint64_t *checksum_value,
+     libcerror_error_t **error )
+{
+	assorted_input_file_t *input_file = NULL;
+	uint8_t *buffer                   = NULL;
+	static char *function             = "assorted_batch_calculate_file_checksum";
+	size64_t remaining_size           = 0;
+	size_t read_size                  = 0;
+	ssize_t read_count                = 0;
+
+	if( batch == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid batch.",
+		 function );
+
+		return( -1 );
+	}
+	if( checksum_value == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid checksum value.",
+		 function );
+
+		return( -1 );
+	}
+	if( assorted_input_file_initialize(
+	     &input_file,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create input file.",
+		 function );
+
+		goto on_error;
+	}
+	if( assorted_input_file_open(
+	     input_file,
+	     path,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_OPEN_FAILED,
+		 "%s: unable to open input file.",
+		 function );
+
+		goto on_error;
+	}
+	if( assorted_input_file_get_size(
+	     input_file,
+	     &remaining_size,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve size of input file.",
+		 function );
+
+		goto on_error;
+	}
+	*checksum_value = batch->initial_value;
+
+	while( remaining_size > 0 )
+	{
+		read_size = ASSORTED_BATCH_BUFFER_SIZE;
+
+		if( (size64_t) read_size > remaining_size )
+		{
+			read_size = (size_t) remaining_size;
+		}
+		read_count = assorted_input_file_read_data(
+		              input_file,
+		              &buffer,
+		              read_size,
+		              error );
+
+		if( read_count != (ssize_t) read_size )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_READ_FAILED,
+			 "%s: unable to read from input file.",
+			 function );
+
+			goto on_error;
+		}
+		if( batch->calculate_function(
+		     batch->calculate_function_arguments,
+		     checksum_value,
+		     buffer,
+		     read_size,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GENERIC,
+			 "%s: unable to calculate checksum.",
+			 function );
+
+			goto on_error;
+		}
+		remaining_size -= read_size;
+	}
+	if( assorted_input_file_close(
+	     input_file,
+	     error ) != 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_CLOSE_FAILED,
+		 "%s: unable to close input file.",
+		 function );
+
+		goto on_error;
+	}
+	if( assorted_input_file_free(
+	     &input_file,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+		 "%s: unable to free input file.",
+		 function );
+
+		goto on_error;
+	}
+	return( 1 );
+
+on_error:
+	if( input_file != NULL )
+	{
+		assorted_input_file_free(
+		 &input_file,
+		 NULL );
+	}
+	return( -1 );
+}
+
+/* Counts a file or directory that could not be read
+ * Returns 1 if successful or -1 on error
+ */
+int assorted_batch_count_error(
+     assorted_batch_t *batch,
+     libcerror_error_t **error )
+{
+	static char *function = "assorted_batch_count_error";
+
+	if( batch == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid batch.",
+		 function );
+
+		return( -1 );
+	}
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+	if( batch->mutex != NULL )
+	{
+		if( libcthreads_mutex_grab(
+		     batch->mutex,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to grab mutex.",
+			 function );
+
+			return( -1 );
+		}
+	}
+#endif
+	batch->number_of_errors += 1;
+
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+	if( batch->mutex != NULL )
+	{
+		if( libcthreads_mutex_release(
+		     batch->mutex,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to release mutex.",
+			 function );
+
+			return( -1 );
+		}
+	}
+#endif
+	return( 1 );
+}
+
+/* Calculates the checksum of a batch file and prints the result
+ * A file that cannot be read is reported and counted but is not considered an error
+ * Returns 1 if successful or -1 on error
+ */
+int assorted_batch_calculate_file(
+     assorted_batch_t *batch,
+     assorted_batch_file_t *batch_file,
+     libcerror_error_t **error )
+{
+	libcerror_error_t *file_error = NULL;
+	static char *function         = "assorted_batch_calculate_file";
+	uint64_t checksum_value       = 0;
+	int result                    = 0;
+
+	if( batch == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid batch.",
+		 function );
+
+		return( -1 );
+	}
+	if( batch_file == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid batch file.",
+		 function );
+
+		return( -1 );
+	}
+	result = assorted_batch_calculate_file_checksum(
+	          batch,
+	          batch_file->path,
+	          &checksum_value,
+	          &file_error );
+
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+	if( batch->mutex != NULL )
+	{
+		if( libcthreads_mutex_grab(
+		     batch->mutex,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to grab mutex.",
+			 function );
+
+			goto on_error;
+		}
+	}
+#endif
+	batch->number_of_files += 1;
+
+	if( result != 1 )
+	{
+		batch->number_of_errors += 1;
+
+		if( batch_file->has_expected_checksum_value != 0 )
+		{
+			fprintf(
+			 stdout,
+			 "%" PRIs_SYSTEM ": FAILED open or read\n",
+			 batch_file->path );
+		}
+		fprintf(
+		 stderr,
+		 "Unable to calculate checksum of: %" PRIs_SYSTEM "\n",
+		 batch_file->path );
+
+		if( libcnotify_verbose != 0 )
+		{
+			libcnotify_print_error_backtrace(
+			 file_error );
+		}
+	}
+	else if( batch_file->has_expected_checksum_value != 0 )
+	{
+		if( checksum_value != batch_file->expected_checksum_value )
+		{
+			batch->number_of_mismatches += 1;
+
+			fprintf(
+			 stdout,
+			 "%" PRIs_SYSTEM ": FAILED\n",
+			 batch_file->path );
+		}
+		else
+		{
+			fprintf(
+			 stdout,
+			 "%" PRIs_SYSTEM ": OK\n",
+			 batch_file->path );
+		}
+	}
+	else
+	{
+		fprintf(
+		 stdout,
+		 "%0*" PRIx64 "  %" PRIs_SYSTEM "\n",
+		 (int) batch->checksum_value_size * 2,
+		 checksum_value,
+		 batch_file->path );
+	}
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+	if( batch->mutex != NULL )
+	{
+		if( libcthreads_mutex_release(
+		     batch->mutex,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to release mutex.",
+			 function );
+
+			goto on_error;
+		}
+	}
+#endif
+	if( file_error != NULL )
+	{
+		libcerror_error_free(
+		 &file_error );
+	}
+	return( 1 );
+
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+on_error:
+	if( file_error != NULL )
+	{
+		libcerror_error_free(
+		 &file_error );
+	}
+	return( -1 );
+#endif
+}
+
+/* Adds a file to a batch
+ * The batch takes over the batch file, it is freed after its checksum was calculated,
+ * also on error
+ * Returns 1 if successful or -1 on error
+ */
+int assorted_batch_add_file(
+     assorted_batch_t *batch,
+     assorted_batch_file_t *batch_file,
+     libcerror_error_t **error )
+{
+	static char *function = "assorted_batch_add_file";
+	int result            = 0;
+
+	if( batch == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid batch.",
+		 function );
+
+		goto on_error;
+	}
+	if( batch_file == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid batch file.",
+		 function );
+
+		return( -1 );
+	}
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+	if( batch->thread_pool != NULL )
+	{
+		/* Blocks while the queue of the thread pool is full
+		 */
+		if( libcthreads_thread_pool_push(
+		     batch->thread_pool,
+		     (intptr_t *) batch_file,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+			 "%s: unable to push batch file onto thread pool.",
+			 function );
+
+			goto on_error;
+		}
+		return( 1 );
+	}
+#endif
+	result = assorted_batch_calculate_file(
+	          batch,
+	          batch_file,
+	          error );
+
+	if( result != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GENERIC,
+		 "%s: unable to calculate batch file.",
+		 function );
+	}
+	assorted_batch_file_free(
+	 &batch_file,
+	 NULL );
+
+	return( result );
+
+on_error:
+	assorted_batch_file_free(
+	 &batch_file,
+	 NULL );
+
+	return( -1 );
+}
+
+#if defined( HAVE_ASSORTED_BATCH_DIRECTORY_SUPPORT )
+
+/* Adds the files in a directory and its sub directories to a batch
+ * Directories that are symbolic links or reparse points are not followed
+ * to prevent loops, entries that cannot be read are reported and counted
+ * Returns 1 if successful or -1 on error
+ */
+int assorted_batch_add_directory(
+     assorted_batch_t *batch,
+     const system_character_t *path,
+     size_t path_length,
+     libcerror_error_t **error )
+{
+#if defined( WINAPI )
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+	WIN32_FIND_DATAW find_data;
+#else
+	WIN32_FIND_DATAA find_data;
+#endif
+	HANDLE find_handle                = INVALID_HANDLE_VALUE;
+#else
+	struct stat file_statistics;
+
+	struct dirent *directory_entry    = NULL;
+	DIR *directory                    = NULL;
+#endif
+	assorted_batch_file_t *batch_file = NULL;
+	system_character_t *entry_path    = NULL;
+	const system_character_t *name    = NULL;
+	static char *function             = "assorted_batch_add_directory";
+	size_t entry_path_length          = 0;
+	size_t entry_path_size            = 0;
+	size_t name_length                = 0;
+	int is_directory                  = 0;
+	int is_file                       = 0;
+
+	if( batch == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid batch.",
+		 function );
+
+		return( -1 );
+	}
+	if( path == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid path.",
+		 function );
+
+		return( -1 );
+	}
+	/* Ignore a trailing path separator
+	 */
+	while( ( path_length > 1 )
+	    && ( path[ path_length - 1 ] == (system_character_t) ASSORTED_BATCH_PATH_SEPARATOR ) )
+	{
+		path_length--;
+	}
+	/* The entry path consists of the path, a path separator and the entry name
+	 * or the wildcard used to find the entries
+	 */
+	entry_path_size = path_length + 2;
+
+	entry_path = system_string_allocate(
+	              entry_path_size + 1 );
+
+	if( entry_path == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create entry path.",
+		 function );
+
+		goto on_error;
+	}
+	if( system_string_copy(
+	     entry_path,
+	     path,
+	     path_length ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+		 "%s: unable to copy path.",
+		 function );
+
+		goto on_error;
+	}
+	entry_path[ path_length ] = (system_character_t) ASSORTED_BATCH_PATH_SEPARATOR;
+
+#if defined( WINAPI )
+	entry_path[ path_length + 1 ] = (system_character_t) '*';
+	entry_path[ path_length + 2 ] = 0;
+
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+	find_handle = FindFirstFileW(
+	               (LPCWSTR) entry_path,
+	               &find_data );
+#else
+	find_handle = FindFirstFileA(
+	               (LPCSTR) entry_path,
+	               &find_data );
+#endif
+	if( find_handle == INVALID_HANDLE_VALUE )
+#else
+	directory = opendir(
+	             (char *) path );
+
+	if( directory == NULL )
+#endif
+	{
+		fprintf(
+		 stderr,
+		 "Unable to open directory: %" PRIs_SYSTEM "\n",
+		 path );
+
+		if( assorted_batch_count_error(
+		     batch,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to count error.",
+			 function );
+
+			goto on_error;
+		}
+		memory_free(
+		 entry_path );
+
+		return( 1 );
+	}
+	do
+	{
+#if defined( WINAPI )
+		name = (const system_character_t *) find_data.cFileName;
+#else
+		directory_entry = readdir(
+		                   directory );
+
+		if( directory_entry == NULL )
+		{
+			break;
+		}
+		name = (const system_character_t *) directory_entry->d_name;
+#endif
+		name_length = system_string_length(
+		               name );
+
+		if( ( name_length == 0 )
+		 || ( ( name_length == 1 )
+		  &&  ( name[ 0 ] == (system_character_t) '.' ) )
+		 || ( ( name_length == 2 )
+		  &&  ( name[ 0 ] == (system_character_t) '.' )
+		  &&  ( name[ 1 ] == (system_character_t) '.' ) ) )
+		{
+			continue;
+		}
+		entry_path_length = path_length + 1 + name_length;
+
+		if( entry_path_length > entry_path_size )
+		{
+			memory_free(
+			 entry_path );
+
+			entry_path_size = entry_path_length;
+
+			entry_path = system_string_allocate(
+			              entry_path_size + 1 );
+
+			if( entry_path == NULL )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_MEMORY,
+				 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+				 "%s: unable to create entry path.",
+				 function );
+
+				goto on_error;
+			}
+			if( system_string_copy(
+			     entry_path,
+			     path,
+			     path_length ) == NULL )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_MEMORY,
+				 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+				 "%s: unable to copy path.",
+				 function );
+
+				goto on_error;
+			}
+			entry_path[ path_length ] = (system_character_t) ASSORTED_BATCH_PATH_SEPARATOR;
+		}
+		if( system_string_copy(
+		     &( entry_path[ path_length + 1 ] ),
+		     name,
+		     name_length ) == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+			 "%s: unable to copy entry name.",
+			 function );
+
+			goto on_error;
+		}
+		entry_path[ entry_path_length ] = 0;
+
+#if defined( WINAPI )
+		is_directory = 0;
+		is_file      = 0;
+
+		if( ( find_data.dwFileAttributes & FILE_ATTRIBUTE_DIRECTORY ) == 0 )
+		{
+			is_file = 1;
+		}
+		else if( ( find_data.dwFileAttributes & FILE_ATTRIBUTE_REPARSE_POINT ) == 0 )
+		{
+			is_directory = 1;
+		}
+#else
+		is_directory = 0;
+		is_file      = 0;
+
+		if( lstat(
+		     entry_path,
+		     &file_statistics ) != 0 )
+		{
+			fprintf(
+			 stderr,
+			 "Unable to determine type of: %s\n",
+			 entry_path );
+
+			if( assorted_batch_count_error(
+			     batch,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+				 "%s: unable to count error.",
+				 function );
+
+				goto on_error;
+			}
+			continue;
+		}
+		/* Only symbolic links to files are followed
+		 */
+		if( S_ISLNK( file_statistics.st_mode ) )
+		{
+			if( ( stat(
+			       entry_path,
+			       &file_statistics ) == 0 )
+			 && S_ISREG( file_statistics.st_mode ) )
+			{
+				is_file = 1;
+			}
+		}
+		else if( S_ISDIR( file_statistics.st_mode ) )
+		{
+			is_directory = 1;
+		}
+		else if( S_ISREG( file_statistics.st_mode ) )
+		{
+			is_file = 1;
+		}
+#endif
+		if( is_directory != 0 )
+		{
+			if( assorted_batch_add_directory(
+			     batch,
+			     entry_path,
+			     entry_path_length,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+				 "%s: unable to add directory: %" PRIs_SYSTEM ".",
+				 function,
+				 entry_path );
+
+				goto on_error;
+			}
+		}
+		else if( is_file != 0 )
+		{
+			if( assorted_batch_file_initialize(
+			     &batch_file,
+			     entry_path,
+			     entry_path_length,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+				 "%s: unable to create batch file.",
+				 function );
+
+				goto on_error;
+			}
+			/* The batch takes over the batch file, also on error
+			 */
+			if( assorted_batch_add_file(
+			     batch,
+			     batch_file,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+				 "%s: unable to add file: %" PRIs_SYSTEM ".",
+				 function,
+				 entry_path );
+
+				batch_file = NULL;
+
+				goto on_error;
+			}
+			batch_file = NULL;
+		}
+	}
+#if defined( WINAPI )
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+	while( FindNextFileW(
+	        find_handle,
+	        &find_data ) != 0 );
+#else
+	while( FindNextFileA(
+	        find_handle,
+	        &find_data ) != 0 );
+#endif
+	FindClose(
+	 find_handle );
+#else
+	while( directory_entry != NULL );
+
+	closedir(
+	 directory );
+#endif
+	memory_free(
+	 entry_path );
+
+	return( 1 );
+
+on_error:
+#if defined( WINAPI )
+	if( find_handle != INVALID_HANDLE_VALUE )
+	{
+		FindClose(
+		 find_handle );
+	}
+#else
+	if( directory != NULL )
+	{
+		closedir(
+		 directory );
+	}
+#endif
+	if( entry_path != NULL )
+	{
+		memory_free(
+		 entry_path );
+	}
+	return( -1 );
+}
+
+#endif /* defined( HAVE_ASSORTED_BATCH_DIRECTORY_SUPPORT ) */
+
+/* Adds a path to a batch
+ * If the path is a directory its files are added recursively
+ * Returns 1 if successful or -1 on error
+ */
+int assorted_batch_add_path(
+     assorted_batch_t *batch,
+     const system_character_t *path,
+     libcerror_error_t **error )
+{
+#if defined( HAVE_ASSORTED_BATCH_DIRECTORY_SUPPORT ) && !defined( WINAPI )
+	struct stat file_statistics;
+#endif
+	assorted_batch_file_t *batch_file = NULL;
+	static char *function             = "assorted_batch_add_path";
+	size_t path_length                = 0;
+
+	if( path == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid path.",
+		 function );
+
+		return( -1 );
+	}
+	path_length = system_string_length(
+	               path );
+
+#if defined( HAVE_ASSORTED_BATCH_DIRECTORY_SUPPORT )
+#if defined( WINAPI )
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+	if( ( GetFileAttributesW(
+	       (LPCWSTR) path ) & FILE_ATTRIBUTE_DIRECTORY ) != 0 )
+#else
+	if( ( GetFileAttributesA(
+	       (LPCSTR) path ) & FILE_ATTRIBUTE_DIRECTORY ) != 0 )
+#endif
+#else
+	if( ( stat(
+	       path,
+	       &file_statistics ) == 0 )
+	 && S_ISDIR( file_statistics.st_mode ) )
+#endif
+	{
+		/* Note that INVALID_FILE_ATTRIBUTES has all bits set, in which case
+		 * opening the directory fails and is reported
+		 */
+		if( assorted_batch_add_directory(
+		     batch,
+		     path,
+		     path_length,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+			 "%s: unable to add directory.",
+			 function );
+
+			return( -1 );
+		}
+		return( 1 );
+	}
+#endif /* defined( HAVE_ASSORTED_BATCH_DIRECTORY_SUPPORT ) */
+
+	if( assorted_batch_file_initialize(
+	     &batch_file,
+	     path,
+	     path_length,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create batch file.",
+		 function );
+
+		return( -1 );
+	}
+	if( assorted_batch_add_file(
+	     batch,
+	     batch_file,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+		 "%s: unable to add file.",
+		 function );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Reads a line from a stream without the end-of-line characters
+ * Returns 1 if successful, 0 if no more lines are available or -1 on error
+ */
+int assorted_batch_read_line(
+     FILE *stream,
+     system_character_t *line,
+     size_t line_size,
+     size_t *line_length,
+     libcerror_error_t **error )
+{
+	static char *function = "assorted_batch_read_line";
+
+	if( stream == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid stream.",
+		 function );
+
+		return( -1 );
+	}
+	if( line == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid line.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( line_size < 2 )
+	 || ( line_size > (size_t) INT_MAX ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid line size value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( line_length == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid line length.",
+		 function );
+
+		return( -1 );
+	}
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+	if( file_stream_get_string_wide(
+	     stream,
+	     line,
+	     (int) line_size ) == NULL )
+#else
+	if( file_stream_get_string(
+	     stream,
+	     line,
+	     (int) line_size ) == NULL )
+#endif
+	{
+		return( 0 );
+	}
+	*line_length = system_string_length(
+	                line );
+
+	if( ( *line_length == ( line_size - 1 ) )
+	 && ( line[ *line_length - 1 ] != (system_character_t) '\n' ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid line value exceeds maximum size.",
+		 function );
+
+		return( -1 );
+	}
+	while( ( *line_length > 0 )
+	    && ( ( line[ *line_length - 1 ] == (system_character_t) '\n' )
+	     ||  ( line[ *line_length - 1 ] == (system_character_t) '\r' ) ) )
+	{
+		*line_length -= 1;
+	}
+	line[ *line_length ] = 0;
+
+	return( 1 );
+}
+
+/* Reads a list of paths, one per line, and adds them to a batch
+ * Returns 1 if successful or -1 on error
+ */
+int assorted_batch_read_file_list(
+     assorted_batch_t *batch,
+     FILE *stream,
+     libcerror_error_t **error )
+{
+	system_character_t *line = NULL;
+	static char *function    = "assorted_batch_read_file_list";
+	size_t line_length       = 0;
+	int result               = 0;
+
+	line = system_string_allocate(
+	        ASSORTED_BATCH_MAXIMUM_LINE_SIZE );
+
+	if( line == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create line.",
+		 function );
+
+		goto on_error;
+	}
+	do
+	{
+		result = assorted_batch_read_line(
+		          stream,
+		          line,
+		          ASSORTED_BATCH_MAXIMUM_LINE_SIZE,
+		          &line_length,
+		          error );
+
+		if( result == -1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_READ_FAILED,
+			 "%s: unable to read line.",
+			 function );
+
+			goto on_error;
+		}
+		else if( ( result != 0 )
+		      && ( line_length > 0 ) )
+		{
+			if( assorted_batch_add_path(
+			     batch,
+			     line,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+				 "%s: unable to add path: %" PRIs_SYSTEM ".",
+				 function,
+				 line );
+
+				goto on_error;
+			}
+		}
+	}
+	while( result != 0 );
+
+	memory_free(
+	 line );
+
+	return( 1 );
+
+on_error:
+	if( line != NULL )
+	{
+		memory_free(
+		 line );
+	}
+	return( -1 );
+}
+
+/* Reads a checksum list and adds the files to a batch so that their checksums are verified
+ * Every line consists of the checksum as a hexadecimal value followed by two spaces,
+ * or a space and an asterisk, and the path, as written by sha256sum and similar tools
+ * Lines that are improperly formatted are counted and ignored
+ * Returns 1 if successful or -1 on error
+ */
+int assorted_batch_read_checksum_list(
+     assorted_batch_t *batch,
+     FILE *stream,
+     libcerror_error_t **error )
+{
+	assorted_batch_file_t *batch_file = NULL;
+	system_character_t *line          = NULL;
+	static char *function             = "assorted_batch_read_checksum_list";
+	size_t line_index                 = 0;
+	size_t line_length                = 0;
+	size_t number_of_digits           = 0;
+	uint64_t checksum_value           = 0;
+	uint8_t digit_value               = 0;
+	int result                        = 0;
+
+	if( batch == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid batch.",
+		 function );
+
+		return( -1 );
+	}
+	number_of_digits = (size_t) batch->checksum_value_size * 2;
+
+	line = system_string_allocate(
+	        ASSORTED_BATCH_MAXIMUM_LINE_SIZE );
+
+	if( line == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create line.",
+		 function );
+
+		goto on_error;
+	}
+	do
+	{
+		result = assorted_batch_read_line(
+		          stream,
+		          line,
+		          ASSORTED_BATCH_MAXIMUM_LINE_SIZE,
+		          &line_length,
+		          error );
+
+		if( result == -1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_READ_FAILED,
+			 "%s: unable to read line.",
+			 function );
+
+			goto on_error;
+		}
+		else if( ( result == 0 )
+		      || ( line_length == 0 ) )
+		{
+			continue;
+		}
+		checksum_value = 0;
+
+		for( line_index = 0;
+		     line_index < line_length;
+		     line_index++ )
+		{
+			if( ( line[ line_index ] >= (system_character_t) '0' )
+			 && ( line[ line_index ] <= (system_character_t) '9' ) )
+			{
+				digit_value = (uint8_t) ( line[ line_index ] - (system_character_t) '0' );
+			}
+			else if( ( line[ line_index ] >= (system_character_t) 'a' )
+			      && ( line[ line_index ] <= (system_character_t) 'f' ) )
+			{
+				digit_value = (uint8_t) ( line[ line_index ] - (system_character_t) 'a' + 10 );
+			}
+			else if( ( line[ line_index ] >= (system_character_t) 'A' )
+			      && ( line[ line_index ] <= (system_character_t) 'F' ) )
+			{
+				digit_value = (uint8_t) ( line[ line_index ] - (system_character_t) 'A' + 10 );
+			}
+			else
+			{
+				break;
+			}
+			if( line_index >= number_of_digits )
+			{
+				break;
+			}
+			checksum_value <<= 4;
+			checksum_value  |= digit_value;
+		}
+		if( ( line_index != number_of_digits )
+		 || ( ( line_index + 2 ) >= line_length )
+		 || ( line[ line_index ] != (system_character_t) ' ' )
+		 || ( ( line[ line_index + 1 ] != (system_character_t) ' ' )
+		  &&  ( line[ line_index + 1 ] != (system_character_t) '*' ) ) )
+		{
+			batch->number_of_improper_lines += 1;
+
+			continue;
+		}
+		line_index += 2;
+
+		if( assorted_batch_file_initialize(
+		     &batch_file,
+		     &( line[ line_index ] ),
+		     line_length - line_index,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+			 "%s: unable to create batch file.",
+			 function );
+
+			goto on_error;
+		}
+		batch_file->expected_checksum_value     = checksum_value;
+		batch_file->has_expected_checksum_value = 1;
+
+		/* The batch takes over the batch file, also on error
+		 */
+		if( assorted_batch_add_file(
+		     batch,
+		     batch_file,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+			 "%s: unable to add file: %" PRIs_SYSTEM ".",
+			 function,
+			 &( line[ line_index ] ) );
+
+			batch_file = NULL;
+
+			goto on_error;
+		}
+		batch_file = NULL;
+	}
+	while( result != 0 );
+
+	memory_free(
+	 line );
+
+	return( 1 );
+
+on_error:
+	if( line != NULL )
+	{
+		memory_free(
+		 line );
+	}
+	return( -1 );
+}
+
+/* Determines if a source is the standard input, which is indicated by "-"
+ * Returns 1 if the source is the standard input or 0 if not
+ */
+int assorted_batch_source_is_standard_input(
+     const system_character_t *source )
+{
+	if( ( source != NULL )
+	 && ( source[ 0 ] == (system_character_t) '-' )
+	 && ( source[ 1 ] == 0 ) )
+	{
+		return( 1 );
+	}
+	return( 0 );
+}
+
+/* Processes the sources of a batch
+ * If a checksum list is provided the checksums of the files in the list are verified,
+ * otherwise the checksums of the sources are calculated. If no sources are provided
+ * or a source is "-" the paths are read from the standard input
+ * Returns 1 if successful, 0 if not all files could be read or verified or -1 on error
+ */
+int assorted_batch_process(
+     assorted_batch_t *batch,
+     int number_of_sources,
+     system_character_t * const sources[],
+     const system_character_t *checksum_list,
+     libcerror_error_t **error )
+{
+	FILE *stream          = NULL;
+	static char *function = "assorted_batch_process";
+	int source_index      = 0;
+	int result            = 0;
+
+	if( batch == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid batch.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( number_of_sources > 0 )
+	 && ( sources == NULL ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid sources.",
+		 function );
+
+		return( -1 );
+	}
+	if( assorted_batch_start(
+	     batch,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to start batch.",
+		 function );
+
+		goto on_error;
+	}
+	if( checksum_list != NULL )
+	{
+		if( assorted_batch_source_is_standard_input(
+		     checksum_list ) != 0 )
+		{
+			stream = stdin;
+		}
+		else
+		{
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+			stream = file_stream_open_wide(
+			          checksum_list,
+			          _WIDE_STRING( FILE_STREAM_OPEN_READ ) );
+#else
+			stream = file_stream_open(
+			          checksum_list,
+			          FILE_STREAM_OPEN_READ );
+#endif
+			if( stream == NULL )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_IO,
+				 LIBCERROR_IO_ERROR_OPEN_FAILED,
+				 "%s: unable to open checksum list: %" PRIs_SYSTEM ".",
+				 function,
+				 checksum_list );
+
+				goto on_error;
+			}
+		}
+		result = assorted_batch_read_checksum_list(
+		          batch,
+		          stream,
+		          error );
+
+		if( stream != stdin )
+		{
+			file_stream_close(
+			 stream );
+		}
+		stream = NULL;
+
+		if( result != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_READ_FAILED,
+			 "%s: unable to read checksum list.",
+			 function );
+
+			goto on_error;
+		}
+	}
+	else if( number_of_sources == 0 )
+	{
+		if( assorted_batch_read_file_list(
+		     batch,
+		     stdin,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_READ_FAILED,
+			 "%s: unable to read file list from standard input.",
+			 function );
+
+			goto on_error;
+		}
+	}
+	else
+	{
+		for( source_index = 0;
+		     source_index < number_of_sources;
+		     source_index++ )
+		{
+			if( assorted_batch_source_is_standard_input(
+			     sources[ source_index ] ) != 0 )
+			{
+				result = assorted_batch_read_file_list(
+				          batch,
+				          stdin,
+				          error );
+			}
+			else
+			{
+				result = assorted_batch_add_path(
+				          batch,
+				          sources[ source_index ],
+				          error );
+			}
+			if( result != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+				 "%s: unable to add source: %" PRIs_SYSTEM ".",
+				 function,
+				 sources[ source_index ] );
+
+				goto on_error;
+			}
+		}
+	}
+	if( assorted_batch_stop(
+	     batch,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+		 "%s: unable to stop batch.",
+		 function );
+
+		goto on_error;
+	}
+	if( batch->number_of_improper_lines > 0 )
+	{
+		fprintf(
+		 stderr,
+		 "WARNING: %d line(s) of the checksum list are improperly formatted.\n",
+		 batch->number_of_improper_lines );
+	}
+	if( batch->number_of_errors > 0 )
+	{
+		fprintf(
+		 stderr,
+		 "WARNING: %d file(s) could not be read.\n",
+		 batch->number_of_errors );
+	}
+	if( batch->number_of_mismatches > 0 )
+	{
+		fprintf(
+		 stderr,
+		 "WARNING: %d of %d computed checksum(s) did NOT match.\n",
+		 batch->number_of_mismatches,
+		 batch->number_of_files );
+	}
+	if( ( batch->number_of_errors > 0 )
+	 || ( batch->number_of_mismatches > 0 ) )
+	{
+		return( 0 );
+	}
+	return( 1 );
+
+on_error:
+	assorted_batch_stop(
+	 batch,
+	 NULL );
+
+	return( -1 );
+}
+
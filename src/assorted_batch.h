@@ -0,0 +1,246 @@
+/*
+ * Batch functions for the assorted
+ *
+ * Copyright (C) 2008-2019, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This software is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This software is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this software.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#if !defined( _ASSORTED_BATCH_H )
+#define _ASSORTED_BATCH_H
+
+#include <common.h>
+#include <file_stream.h>
+#include <types.h>
+
+#include "assorted_libcerror.h"
+#include "assorted_libcthreads.h"
+
+#if defined( __cplusplus )
+extern "C" {
+#endif
+
+#if defined( WINAPI ) || ( defined( HAVE_DIRENT_H ) && defined( HAVE_OPENDIR ) && !defined( HAVE_WIDE_SYSTEM_CHARACTER ) )
+#define HAVE_ASSORTED_BATCH_DIRECTORY_SUPPORT
+#endif
+
+/* The size of the buffer used to read the data of a file
+ */
+#define ASSORTED_BATCH_BUFFER_SIZE			( 4 * 1024 * 1024 )
+
+/* The default number of threads
+ */
+#define ASSORTED_BATCH_DEFAULT_NUMBER_OF_THREADS	4
+
+/* The maximum number of threads
+ */
+#define ASSORTED_BATCH_MAXIMUM_NUMBER_OF_THREADS	64
+
+/* The maximum number of files queued per thread, which bounds
+ * the number of files that are open at the same time
+ */
+#define ASSORTED_BATCH_MAXIMUM_NUMBER_OF_QUEUED_FILES	2
+
+/* The maximum size of a line of a file or checksum list
+ */
+#define ASSORTED_BATCH_MAXIMUM_LINE_SIZE		32768
+
+/* Calculates the checksum of a buffer
+ * The checksum value contains the checksum of the preceding data or
+ * the initial value and is updated with the checksum of the buffer
+ */
+typedef int (*assorted_batch_calculate_function_t)(
+               void *arguments,
+               uint64_t *checksum_value,
+               uint8_t *buffer,
+               size_t size,
+               libcerror_error_t **error );
+
+typedef struct assorted_batch_file assorted_batch_file_t;
+
+struct assorted_batch_file
+{
+	/* The path
+	 */
+	system_character_t *path;
+
+	/* The expected checksum value
+	 */
+	uint64_t expected_checksum_value;
+
+	/* Value to indicate the expected checksum value is set
+	 */
+	uint8_t has_expected_checksum_value;
+};
+
+typedef struct assorted_batch assorted_batch_t;
+
+struct assorted_batch
+{
+	/* The calculate function
+	 */
+	assorted_batch_calculate_function_t calculate_function;
+
+	/* The arguments of the calculate function
+	 */
+	void *calculate_function_arguments;
+
+	/* The initial checksum value
+	 */
+	uint64_t initial_value;
+
+	/* The size of the checksum value in bytes
+	 */
+	uint8_t checksum_value_size;
+
+	/* The number of threads
+	 */
+	int number_of_threads;
+
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+	/* The thread pool
+	 */
+	libcthreads_thread_pool_t *thread_pool;
+
+	/* The mutex that serializes the output and the counters
+	 */
+	libcthreads_mutex_t *mutex;
+#endif
+
+	/* The number of files
+	 */
+	int number_of_files;
+
+	/* The number of files that could not be read
+	 */
+	int number_of_errors;
+
+	/* The number of files of which the checksum did not match
+	 */
+	int number_of_mismatches;
+
+	/* The number of improperly formatted lines of a checksum list
+	 */
+	int number_of_improper_lines;
+};
+
+int assorted_batch_file_initialize(
+     assorted_batch_file_t **batch_file,
+     const system_character_t *path,
+     size_t path_length,
+     libcerror_error_t **error );
+
+int assorted_batch_file_free(
+     assorted_batch_file_t **batch_file,
+     libcerror_error_t **error );
+
+int assorted_batch_initialize(
+     assorted_batch_t **batch,
+     assorted_batch_calculate_function_t calculate_function,
+     void *calculate_function_arguments,
+     uint64_t initial_value,
+     uint8_t checksum_value_size,
+     int number_of_threads,
+     libcerror_error_t **error );
+
+int assorted_batch_free(
+     assorted_batch_t **batch,
+     libcerror_error_t **error );
+
+int assorted_batch_start(
+     assorted_batch_t *batch,
+     libcerror_error_t **error );
+
+int assorted_batch_stop(
+     assorted_batch_t *batch,
+     libcerror_error_t **error );
+
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+
+int assorted_batch_thread_pool_calculate(
+     intptr_t *value,
+     void *arguments );
+
+#endif /* defined( HAVE_MULTI_THREAD_SUPPORT ) */
+
+int assorted_batch_calculate_file_checksum(
+     assorted_batch_t *batch,
+     const system_character_t *path,
+     uint64_t *checksum_value,
+     libcerror_error_t **error );
+
+int assorted_batch_count_error(
+     assorted_batch_t *batch,
+     libcerror_error_t **error );
+
+int assorted_batch_calculate_file(
+     assorted_batch_t *batch,
+     assorted_batch_file_t *batch_file,
+     libcerror_error_t **error );
+
+int assorted_batch_add_file(
+     assorted_batch_t *batch,
+     assorted_batch_file_t *batch_file,
+     libcerror_error_t **error );
+
+#if defined( HAVE_ASSORTED_BATCH_DIRECTORY_SUPPORT )
+
+int assorted_batch_add_directory(
+     assorted_batch_t *batch,
+     const system_character_t *path,
+     size_t path_length,
+     libcerror_error_t **error );
+
+#endif /* defined( HAVE_ASSORTED_BATCH_DIRECTORY_SUPPORT ) */
+
+int assorted_batch_add_path(
+     assorted_batch_t *batch,
+     const system_character_t *path,
+     libcerror_error_t **error );
+
+int assorted_batch_read_line(
+     FILE *stream,
+     system_character_t *line,
+     size_t line_size,
+     size_t *line_length,
+     libcerror_error_t **error );
+
+int assorted_batch_read_file_list(
+     assorted_batch_t *batch,
+     FILE *stream,
+     libcerror_error_t **error );
+
+int assorted_batch_read_checksum_list(
+     assorted_batch_t *batch,
+     FILE *stream,
+     libcerror_error_t **error );
+
+int assorted_batch_source_is_standard_input(
+     const system_character_t *source );
+
+int assorted_batch_process(
+     assorted_batch_t *batch,
+     int number_of_sources,
+     system_character_t * const sources[],
+     const system_character_t *checksum_list,
+     libcerror_error_t **error );
+
+#if defined( __cplusplus )
+}
+#endif
+
+#endif /* !defined( _ASSORTED_BATCH_H ) */
+
@@ -0,0 +1,196 @@
+/*
+ * Calibration functions for the assorted
+ *
+ * Copyright (C) 2008-2019, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This software is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This software is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this software.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <memory.h>
+#include <types.h>
+
+#include "assorted_calibrate.h"
+#include "assorted_libcerror.h"
+#include "assorted_libcnotify.h"
+#include "assorted_timer.h"
+
+/* The number of times a calculation method is timed
+ */
+#define ASSORTED_CALIBRATE_NUMBER_OF_RUNS	3
+
+/* Selects the fastest calculation method by timing each of the calculation methods
+ * over the same buffer of pseudo random data
+ * The calculation method is the fastest calculation method on return
+ * Returns 1 if successful or -1 on error
+ */
+int assorted_calibrate_select_calculation_method(
+     assorted_calibrate_calculate_function_t calculate_function,
+     const int *calculation_methods,
+     int number_of_calculation_methods,
+     int *calculation_method,
+     libcerror_error_t **error )
+{
+	uint8_t *buffer       = NULL;
+	static char *function = "assorted_calibrate_select_calculation_method";
+	size_t buffer_offset  = 0;
+	uint64_t elapsed_time = 0;
+	uint64_t fastest_time = 0;
+	uint64_t method_time  = 0;
+	uint64_t start_time   = 0;
+	uint32_t random_value = 0x12345678UL;
+	int fastest_method    = 0;
+	int method_index      = 0;
+	int run_index         = 0;
+
+	if( calculate_function == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid calculate function.",
+		 function );
+
+		return( -1 );
+	}
+	if( calculation_methods == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid calculation methods.",
+		 function );
+
+		return( -1 );
+	}
+	if( number_of_calculation_methods <= 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_ZERO_OR_LESS,
+		 "%s: invalid number of calculation methods value zero or less.",
+		 function );
+
+		return( -1 );
+	}
+	if( calculation_method == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid calculation method.",
+		 function );
+
+		return( -1 );
+	}
+	buffer = (uint8_t *) memory_allocate(
+	                      sizeof( uint8_t ) * ASSORTED_CALIBRATE_BUFFER_SIZE );
+
+	if( buffer == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create buffer.",
+		 function );
+
+		goto on_error;
+	}
+	for( buffer_offset = 0;
+	     buffer_offset < ASSORTED_CALIBRATE_BUFFER_SIZE;
+	     buffer_offset++ )
+	{
+		random_value = ( random_value * 1103515245UL ) + 12345;
+
+		buffer[ buffer_offset ] = (uint8_t) ( random_value >> 16 );
+	}
+	fastest_method = calculation_methods[ 0 ];
+
+	for( method_index = 0;
+	     method_index < number_of_calculation_methods;
+	     method_index++ )
+	{
+		/* The first run warms up the caches and is not timed
+		 */
+		method_time = 0;
+
+		for( run_index = 0;
+		     run_index <= ASSORTED_CALIBRATE_NUMBER_OF_RUNS;
+		     run_index++ )
+		{
+			start_time = assorted_timer_get_nanoseconds();
+
+			if( calculate_function(
+			     calculation_methods[ method_index ],
+			     buffer,
+			     ASSORTED_CALIBRATE_BUFFER_SIZE,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_GENERIC,
+				 "%s: unable to calculate using method: %d.",
+				 function,
+				 calculation_methods[ method_index ] );
+
+				goto on_error;
+			}
+			elapsed_time = assorted_timer_get_nanoseconds() - start_time;
+
+			if( ( run_index > 0 )
+			 && ( ( method_time == 0 )
+			  || ( elapsed_time < method_time ) ) )
+			{
+				method_time = elapsed_time;
+			}
+		}
+		if( libcnotify_verbose != 0 )
+		{
+			libcnotify_printf(
+			 "%s: calculation method: %d took %" PRIu64 " ns\n",
+			 function,
+			 calculation_methods[ method_index ],
+			 method_time );
+		}
+		if( ( method_index == 0 )
+		 || ( method_time < fastest_time ) )
+		{
+			fastest_method = calculation_methods[ method_index ];
+			fastest_time   = method_time;
+		}
+	}
+	memory_free(
+	 buffer );
+
+	*calculation_method = fastest_method;
+
+	return( 1 );
+
+on_error:
+	if( buffer != NULL )
+	{
+		memory_free(
+		 buffer );
+	}
+	return( -1 );
+}
+
@@ -0,0 +1,60 @@
+/*
+ * Calibration functions for the assorted
+ *
+ * Copyright (C) 2008-2019, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This software is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This software is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this software.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#if !defined( _ASSORTED_CALIBRATE_H )
+#define _ASSORTED_CALIBRATE_H
+
+#include <common.h>
+#include <types.h>
+
+#include "assorted_libcerror.h"
+
+#if defined( __cplusplus )
+extern "C" {
+#endif
+
+/* The size of the buffer used to calibrate the calculation methods
+ */
+#define ASSORTED_CALIBRATE_BUFFER_SIZE		( 64 * 1024 )
+
+/* The minimum size of the data for which the calibration is worth its cost
+ */
+#define ASSORTED_CALIBRATE_MINIMUM_DATA_SIZE	( 16 * 1024 * 1024 )
+
+typedef int (*assorted_calibrate_calculate_function_t)(
+               int calculation_method,
+               uint8_t *buffer,
+               size_t size,
+               libcerror_error_t **error );
+
+int assorted_calibrate_select_calculation_method(
+     assorted_calibrate_calculate_function_t calculate_function,
+     const int *calculation_methods,
+     int number_of_calculation_methods,
+     int *calculation_method,
+     libcerror_error_t **error );
+
+#if defined( __cplusplus )
+}
+#endif
+
+#endif /* !defined( _ASSORTED_CALIBRATE_H ) */
+
@@ -0,0 +1,2419 @@
+/*
+ * Input file functions
+ *
+ * Copyright (C) 2008-2019, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This software is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This software is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this software.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+/* O_DIRECT is only defined by glibc if _GNU_SOURCE is defined
+ */
+#if defined( __linux__ ) && !defined( _GNU_SOURCE )
+#define _GNU_SOURCE
+#endif
+
+#include <common.h>
+#include <memory.h>
+#include <types.h>
+
+#if defined( HAVE_FCNTL_H )
+#include <fcntl.h>
+#endif
+
+#if defined( HAVE_SYS_STAT_H )
+#include <sys/stat.h>
+#endif
+
+#if defined( HAVE_SYS_MMAN_H )
+#include <sys/mman.h>
+#endif
+
+#if defined( HAVE_UNISTD_H )
+#include <unistd.h>
+#endif
+
+#include "assorted_input_file.h"
+#include "assorted_libcerror.h"
+#include "assorted_libcfile.h"
+#include "assorted_output.h"
+
+#if !defined( O_BINARY )
+#define O_BINARY	0
+#endif
+
+/* Creates an input file
+ * Make sure the value input_file is referencing, is set to NULL
+ * Returns 1 if successful or -1 on error
+ */
+int assorted_input_file_initialize(
+     assorted_input_file_t **input_file,
+     libcerror_error_t **error )
+{
+	static char *function = "assorted_input_file_initialize";
+
+	if( input_file == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid input file.",
+		 function );
+
+		return( -1 );
+	}
+	if( *input_file != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid input file value already set.",
+		 function );
+
+		return( -1 );
+	}
+	*input_file = memory_allocate_structure(
+	               assorted_input_file_t );
+
+	if( *input_file == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create input file.",
+		 function );
+
+		goto on_error;
+	}
+	if( memory_set(
+	     *input_file,
+	     0,
+	     sizeof( assorted_input_file_t ) ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear input file.",
+		 function );
+
+		goto on_error;
+	}
+#if defined( WINAPI )
+	( *input_file )->file_handle    = INVALID_HANDLE_VALUE;
+	( *input_file )->mapping_handle = NULL;
+
+#elif defined( HAVE_ASSORTED_INPUT_FILE_MAPPING )
+	( *input_file )->descriptor = -1;
+#endif
+
+#if defined( HAVE_ASSORTED_INPUT_FILE_DIRECT_IO )
+#if defined( WINAPI )
+	( *input_file )->direct_io_file_handle = INVALID_HANDLE_VALUE;
+#else
+	( *input_file )->direct_io_descriptor = -1;
+#endif
+#endif
+	return( 1 );
+
+on_error:
+	if( *input_file != NULL )
+	{
+		memory_free(
+		 *input_file );
+
+		*input_file = NULL;
+	}
+	return( -1 );
+}
+
+/* Frees an input file
+ * The input file is closed if necessary
+ * Returns 1 if successful or -1 on error
+ */
+int assorted_input_file_free(
+     assorted_input_file_t **input_file,
+     libcerror_error_t **error )
+{
+	static char *function = "assorted_input_file_free";
+	int result            = 1;
+
+	if( input_file == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid input file.",
+		 function );
+
+		return( -1 );
+	}
+	if( *input_file != NULL )
+	{
+		if( ( ( *input_file )->file != NULL )
+		 || ( ( *input_file )->mapped_data != NULL ) )
+		{
+			if( assorted_input_file_close(
+			     *input_file,
+			     error ) != 0 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_IO,
+				 LIBCERROR_IO_ERROR_CLOSE_FAILED,
+				 "%s: unable to close input file.",
+				 function );
+
+				result = -1;
+			}
+		}
+		if( ( *input_file )->buffer != NULL )
+		{
+			memory_free(
+			 ( *input_file )->buffer );
+		}
+#if defined( HAVE_ASSORTED_INPUT_FILE_DIRECT_IO )
+		if( ( *input_file )->direct_io_allocation != NULL )
+		{
+			memory_free(
+			 ( *input_file )->direct_io_allocation );
+		}
+#endif
+		memory_free(
+		 *input_file );
+
+		*input_file = NULL;
+	}
+	return( result );
+}
+
+#if defined( HAVE_ASSORTED_INPUT_FILE_MAPPING )
+
+/* Maps a file into memory
+ * Returns 1 if successful, 0 if the file cannot be mapped or -1 on error
+ */
+int assorted_input_file_open_mapped(
+     assorted_input_file_t *input_file,
+     const system_character_t *filename,
+     libcerror_error_t **error )
+{
+#if defined( WINAPI )
+	LARGE_INTEGER file_size;
+#else
+	struct stat file_statistics;
+#endif
+
+	static char *function = "assorted_input_file_open_mapped";
+
+	if( input_file == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid input file.",
+		 function );
+
+		return( -1 );
+	}
+#if defined( WINAPI )
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+	input_file->file_handle = CreateFileW(
+	                           (LPCWSTR) filename,
+	                           GENERIC_READ,
+	                           FILE_SHARE_READ,
+	                           NULL,
+	                           OPEN_EXISTING,
+	                           FILE_ATTRIBUTE_NORMAL | FILE_FLAG_SEQUENTIAL_SCAN,
+	                           NULL );
+#else
+	input_file->file_handle = CreateFileA(
+	                           (LPCSTR) filename,
+	                           GENERIC_READ,
+	                           FILE_SHARE_READ,
+	                           NULL,
+	                           OPEN_EXISTING,
+	                           FILE_ATTRIBUTE_NORMAL | FILE_FLAG_SEQUENTIAL_SCAN,
+	                           NULL );
+#endif
+	if( input_file->file_handle == INVALID_HANDLE_VALUE )
+	{
+		return( 0 );
+	}
+	/* Only regular files with data can be mapped, devices and pipes are read buffered
+	 */
+	if( ( GetFileType(
+	       input_file->file_handle ) != FILE_TYPE_DISK )
+	 || ( GetFileSizeEx(
+	       input_file->file_handle,
+	       &file_size ) == 0 )
+	 || ( file_size.QuadPart <= 0 )
+	 || ( (size64_t) file_size.QuadPart > (size64_t) SSIZE_MAX ) )
+	{
+		goto on_error;
+	}
+	input_file->mapping_handle = CreateFileMapping(
+	                              input_file->file_handle,
+	                              NULL,
+	                              PAGE_READONLY,
+	                              0,
+	                              0,
+	                              NULL );
+
+	if( input_file->mapping_handle == NULL )
+	{
+		goto on_error;
+	}
+	input_file->mapped_data = (uint8_t *) MapViewOfFile(
+	                                       input_file->mapping_handle,
+	                                       FILE_MAP_READ,
+	                                       0,
+	                                       0,
+	                                       0 );
+
+	if( input_file->mapped_data == NULL )
+	{
+		goto on_error;
+	}
+	input_file->mapped_data_size = (size64_t) file_size.QuadPart;
+#else
+	input_file->descriptor = open(
+	                          (char *) filename,
+	                          O_RDONLY | O_BINARY );
+
+	if( input_file->descriptor == -1 )
+	{
+		return( 0 );
+	}
+	/* Only regular files with data can be mapped, devices and pipes are read buffered
+	 */
+	if( ( fstat(
+	       input_file->descriptor,
+	       &file_statistics ) != 0 )
+	 || ( S_ISREG( file_statistics.st_mode ) == 0 )
+	 || ( file_statistics.st_size <= 0 )
+	 || ( (size64_t) file_statistics.st_size > (size64_t) SSIZE_MAX ) )
+	{
+		goto on_error;
+	}
+	input_file->mapped_data = (uint8_t *) mmap(
+	                                       NULL,
+	                                       (size_t) file_statistics.st_size,
+	                                       PROT_READ,
+	                                       MAP_PRIVATE,
+	                                       input_file->descriptor,
+	                                       0 );
+
+	if( input_file->mapped_data == (uint8_t *) MAP_FAILED )
+	{
+		input_file->mapped_data = NULL;
+
+		goto on_error;
+	}
+	input_file->mapped_data_size = (size64_t) file_statistics.st_size;
+
+#if defined( HAVE_MADVISE ) && defined( MADV_SEQUENTIAL )
+	/* The advice is only a hint, hence failure is ignored
+	 */
+	madvise(
+	 (void *) input_file->mapped_data,
+	 (size_t) input_file->mapped_data_size,
+	 MADV_SEQUENTIAL );
+#endif
+#endif /* defined( WINAPI ) */
+
+	input_file->current_offset = 0;
+
+	return( 1 );
+
+on_error:
+#if defined( WINAPI )
+	if( input_file->mapping_handle != NULL )
+	{
+		CloseHandle(
+		 input_file->mapping_handle );
+
+		input_file->mapping_handle = NULL;
+	}
+	CloseHandle(
+	 input_file->file_handle );
+
+	input_file->file_handle = INVALID_HANDLE_VALUE;
+#else
+	close(
+	 input_file->descriptor );
+
+	input_file->descriptor = -1;
+#endif
+	return( 0 );
+}
+
+#endif /* defined( HAVE_ASSORTED_INPUT_FILE_MAPPING ) */
+
+/* Sets the direct I/O block size of the input file
+ * Direct I/O reads bypass the system cache, e.g. to read a device without
+ * evicting other cached data, and is only used if supported by the file system
+ * A block size of 0 disables direct I/O
+ * Returns 1 if successful or -1 on error
+ */
+int assorted_input_file_set_direct_io(
+     assorted_input_file_t *input_file,
+     size_t block_size,
+     libcerror_error_t **error )
+{
+	static char *function = "assorted_input_file_set_direct_io";
+
+	if( input_file == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid input file.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( input_file->file != NULL )
+	 || ( input_file->mapped_data != NULL ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid input file - already open.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( block_size > (size_t) ( SSIZE_MAX - ASSORTED_INPUT_FILE_DIRECT_IO_ALIGNMENT ) )
+	 || ( ( block_size % ASSORTED_INPUT_FILE_DIRECT_IO_ALIGNMENT ) != 0 ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_UNSUPPORTED_VALUE,
+		 "%s: unsupported block size value, must be a multiple of %d.",
+		 function,
+		 ASSORTED_INPUT_FILE_DIRECT_IO_ALIGNMENT );
+
+		return( -1 );
+	}
+	input_file->direct_io_block_size = block_size;
+
+	return( 1 );
+}
+
+#if defined( HAVE_ASSORTED_INPUT_FILE_DIRECT_IO )
+
+/* Opens a file for direct I/O
+ * The file is also opened buffered to determine the size of the file,
+ * which for devices requires platform specific functions
+ * Returns 1 if successful, 0 if direct I/O is not supported or -1 on error
+ */
+int assorted_input_file_open_direct(
+     assorted_input_file_t *input_file,
+     const system_character_t *filename,
+     libcerror_error_t **error )
+{
+	static char *function = "assorted_input_file_open_direct";
+	int result            = 0;
+
+	if( input_file == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid input file.",
+		 function );
+
+		return( -1 );
+	}
+#if defined( WINAPI )
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+	input_file->direct_io_file_handle = CreateFileW(
+	                                     (LPCWSTR) filename,
+	                                     GENERIC_READ,
+	                                     FILE_SHARE_READ | FILE_SHARE_WRITE,
+	                                     NULL,
+	                                     OPEN_EXISTING,
+	                                     FILE_ATTRIBUTE_NORMAL | FILE_FLAG_NO_BUFFERING | FILE_FLAG_SEQUENTIAL_SCAN,
+	                                     NULL );
+#else
+	input_file->direct_io_file_handle = CreateFileA(
+	                                     (LPCSTR) filename,
+	                                     GENERIC_READ,
+	                                     FILE_SHARE_READ | FILE_SHARE_WRITE,
+	                                     NULL,
+	                                     OPEN_EXISTING,
+	                                     FILE_ATTRIBUTE_NORMAL | FILE_FLAG_NO_BUFFERING | FILE_FLAG_SEQUENTIAL_SCAN,
+	                                     NULL );
+#endif
+	if( input_file->direct_io_file_handle == INVALID_HANDLE_VALUE )
+	{
+		return( 0 );
+	}
+#elif defined( O_DIRECT )
+	input_file->direct_io_descriptor = open(
+	                                    (char *) filename,
+	                                    O_RDONLY | O_BINARY | O_DIRECT );
+
+	/* File systems that do not support direct I/O fail with EINVAL
+	 */
+	if( input_file->direct_io_descriptor == -1 )
+	{
+		return( 0 );
+	}
+#elif defined( F_NOCACHE )
+	input_file->direct_io_descriptor = open(
+	                                    (char *) filename,
+	                                    O_RDONLY | O_BINARY );
+
+	if( input_file->direct_io_descriptor == -1 )
+	{
+		return( 0 );
+	}
+	if( fcntl(
+	     input_file->direct_io_descriptor,
+	     F_NOCACHE,
+	     1 ) == -1 )
+	{
+		close(
+		 input_file->direct_io_descriptor );
+
+		input_file->direct_io_descriptor = -1;
+
+		return( 0 );
+	}
+#else
+	return( 0 );
+#endif
+	if( assorted_input_file_resize_direct_io_buffer(
+	     input_file,
+	     input_file->direct_io_block_size,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_RESIZE_FAILED,
+		 "%s: unable to resize direct I/O buffer.",
+		 function );
+
+		goto on_error;
+	}
+	if( libcfile_file_initialize(
+	     &( input_file->file ),
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create file.",
+		 function );
+
+		goto on_error;
+	}
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+	result = libcfile_file_open_wide(
+	          input_file->file,
+	          filename,
+	          LIBCFILE_OPEN_READ,
+	          error );
+#else
+	result = libcfile_file_open(
+	          input_file->file,
+	          filename,
+	          LIBCFILE_OPEN_READ,
+	          error );
+#endif
+	if( result != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_OPEN_FAILED,
+		 "%s: unable to open file.",
+		 function );
+
+		goto on_error;
+	}
+	input_file->direct_io_data_offset = 0;
+	input_file->direct_io_data_size   = 0;
+	input_file->current_offset        = 0;
+
+	return( 1 );
+
+on_error:
+	if( input_file->file != NULL )
+	{
+		libcfile_file_free(
+		 &( input_file->file ),
+		 NULL );
+	}
+#if defined( WINAPI )
+	CloseHandle(
+	 input_file->direct_io_file_handle );
+
+	input_file->direct_io_file_handle = INVALID_HANDLE_VALUE;
+#else
+	close(
+	 input_file->direct_io_descriptor );
+
+	input_file->direct_io_descriptor = -1;
+#endif
+	return( -1 );
+}
+
+/* Resizes the direct I/O buffer
+ * The buffer is aligned, hence the data it contains is not preserved
+ * Returns 1 if successful or -1 on error
+ */
+int assorted_input_file_resize_direct_io_buffer(
+     assorted_input_file_t *input_file,
+     size_t size,
+     libcerror_error_t **error )
+{
+	uint8_t *allocation   = NULL;
+	static char *function = "assorted_input_file_resize_direct_io_buffer";
+	intptr_t alignment    = 0;
+
+	if( input_file == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid input file.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( size == 0 )
+	 || ( size > (size_t) ( SSIZE_MAX - ASSORTED_INPUT_FILE_DIRECT_IO_ALIGNMENT ) ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid size value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( size <= input_file->direct_io_buffer_size )
+	{
+		return( 1 );
+	}
+	/* The buffer is over allocated by the alignment to be able to align its start
+	 */
+	allocation = (uint8_t *) memory_allocate(
+	                          sizeof( uint8_t ) * ( size + ASSORTED_INPUT_FILE_DIRECT_IO_ALIGNMENT ) );
+
+	if( allocation == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create direct I/O buffer.",
+		 function );
+
+		return( -1 );
+	}
+	if( input_file->direct_io_allocation != NULL )
+	{
+		memory_free(
+		 input_file->direct_io_allocation );
+	}
+	alignment = (intptr_t) allocation % ASSORTED_INPUT_FILE_DIRECT_IO_ALIGNMENT;
+
+	input_file->direct_io_allocation  = allocation;
+	input_file->direct_io_buffer      = allocation;
+	input_file->direct_io_buffer_size = size;
+	input_file->direct_io_data_offset = 0;
+	input_file->direct_io_data_size   = 0;
+
+	if( alignment != 0 )
+	{
+		input_file->direct_io_buffer += ASSORTED_INPUT_FILE_DIRECT_IO_ALIGNMENT - alignment;
+	}
+	return( 1 );
+}
+
+/* Reads data from the input file using direct I/O
+ * Direct I/O requires aligned offsets and sizes, hence the data is read
+ * in aligned blocks into the direct I/O buffer that data points to
+ * Returns the number of bytes read or -1 on error
+ */
+ssize_t assorted_input_file_read_direct_data(
+         assorted_input_file_t *input_file,
+         uint8_t **data,
+         size_t size,
+         libcerror_error_t **error )
+{
+#if defined( WINAPI )
+	LARGE_INTEGER large_integer_offset;
+
+	DWORD read_count     = 0;
+#else
+	ssize_t read_count   = 0;
+#endif
+	static char *function = "assorted_input_file_read_direct_data";
+	size_t data_offset    = 0;
+	size_t read_size      = 0;
+	off64_t aligned_end   = 0;
+	off64_t aligned_start = 0;
+
+	if( input_file == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid input file.",
+		 function );
+
+		return( -1 );
+	}
+	if( data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid data.",
+		 function );
+
+		return( -1 );
+	}
+	if( size > (size_t) ( SSIZE_MAX - ( 2 * ASSORTED_INPUT_FILE_DIRECT_IO_ALIGNMENT ) ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid size value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( input_file->current_offset < input_file->direct_io_data_offset )
+	 || ( (size64_t) ( input_file->current_offset + size ) > (size64_t) ( input_file->direct_io_data_offset + input_file->direct_io_data_size ) ) )
+	{
+		aligned_start = input_file->current_offset - ( input_file->current_offset % ASSORTED_INPUT_FILE_DIRECT_IO_ALIGNMENT );
+		aligned_end   = input_file->current_offset + (off64_t) size;
+
+		if( ( aligned_end % ASSORTED_INPUT_FILE_DIRECT_IO_ALIGNMENT ) != 0 )
+		{
+			aligned_end += ASSORTED_INPUT_FILE_DIRECT_IO_ALIGNMENT - ( aligned_end % ASSORTED_INPUT_FILE_DIRECT_IO_ALIGNMENT );
+		}
+		read_size = (size_t) ( aligned_end - aligned_start );
+
+		if( read_size < input_file->direct_io_block_size )
+		{
+			read_size = input_file->direct_io_block_size;
+		}
+		if( assorted_input_file_resize_direct_io_buffer(
+		     input_file,
+		     read_size,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_RESIZE_FAILED,
+			 "%s: unable to resize direct I/O buffer.",
+			 function );
+
+			return( -1 );
+		}
+		input_file->direct_io_data_offset = aligned_start;
+		input_file->direct_io_data_size   = 0;
+
+#if defined( WINAPI )
+		large_integer_offset.QuadPart = (LONGLONG) aligned_start;
+
+		if( SetFilePointerEx(
+		     input_file->direct_io_file_handle,
+		     large_integer_offset,
+		     NULL,
+		     FILE_BEGIN ) == 0 )
+#else
+		if( lseek(
+		     input_file->direct_io_descriptor,
+		     (off_t) aligned_start,
+		     SEEK_SET ) == (off_t) -1 )
+#endif
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_SEEK_FAILED,
+			 "%s: unable to seek offset: %" PRIi64 " in file.",
+			 function,
+			 aligned_start );
+
+			return( -1 );
+		}
+		/* A read that is not a multiple of the alignment indicates the end of the file,
+		 * reading beyond it would be unaligned
+		 */
+		while( input_file->direct_io_data_size < read_size )
+		{
+#if defined( WINAPI )
+			if( ReadFile(
+			     input_file->direct_io_file_handle,
+			     &( input_file->direct_io_buffer[ input_file->direct_io_data_size ] ),
+			     (DWORD) ( read_size - input_file->direct_io_data_size ),
+			     &read_count,
+			     NULL ) == 0 )
+#else
+			read_count = read(
+			              input_file->direct_io_descriptor,
+			              &( input_file->direct_io_buffer[ input_file->direct_io_data_size ] ),
+			              read_size - input_file->direct_io_data_size );
+
+			if( read_count < 0 )
+#endif
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_IO,
+				 LIBCERROR_IO_ERROR_READ_FAILED,
+				 "%s: unable to read data from file.",
+				 function );
+
+				input_file->direct_io_data_size = 0;
+
+				return( -1 );
+			}
+			input_file->direct_io_data_size += (size_t) read_count;
+
+			if( ( read_count == 0 )
+			 || ( ( read_count % ASSORTED_INPUT_FILE_DIRECT_IO_ALIGNMENT ) != 0 ) )
+			{
+				break;
+			}
+		}
+	}
+	data_offset = (size_t) ( input_file->current_offset - input_file->direct_io_data_offset );
+
+	if( data_offset >= input_file->direct_io_data_size )
+	{
+		*data = NULL;
+
+		return( 0 );
+	}
+	if( size > ( input_file->direct_io_data_size - data_offset ) )
+	{
+		size = input_file->direct_io_data_size - data_offset;
+	}
+	*data = &( input_file->direct_io_buffer[ data_offset ] );
+
+	input_file->current_offset += (off64_t) size;
+
+	return( (ssize_t) size );
+}
+
+#endif /* defined( HAVE_ASSORTED_INPUT_FILE_DIRECT_IO ) */
+
+/* Opens an input file
+ * If direct I/O is set and supported the file is read using direct I/O, otherwise
+ * regular files are mapped into memory if supported, otherwise the file is read buffered
+ * Returns 1 if successful or -1 on error
+ */
+int assorted_input_file_open(
+     assorted_input_file_t *input_file,
+     const system_character_t *filename,
+     libcerror_error_t **error )
+{
+	static char *function = "assorted_input_file_open";
+	uint64_t start_time   = 0;
+	int result            = 0;
+
+	if( input_file == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid input file.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( input_file->file != NULL )
+	 || ( input_file->mapped_data != NULL ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid input file - already open.",
+		 function );
+
+		return( -1 );
+	}
+	if( filename == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid filename.",
+		 function );
+
+		return( -1 );
+	}
+	start_time = assorted_output_statistics_start_phase();
+
+#if defined( HAVE_ASSORTED_INPUT_FILE_DIRECT_IO )
+	if( input_file->direct_io_block_size > 0 )
+	{
+		result = assorted_input_file_open_direct(
+		          input_file,
+		          filename,
+		          error );
+
+		if( result == -1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_OPEN_FAILED,
+			 "%s: unable to open file for direct I/O.",
+			 function );
+
+			return( -1 );
+		}
+		else if( result != 0 )
+		{
+			assorted_output_statistics_stop_phase(
+			 ASSORTED_OUTPUT_STATISTICS_PHASE_OPEN,
+			 start_time,
+			 0 );
+
+			return( 1 );
+		}
+	}
+#endif
+#if defined( HAVE_ASSORTED_INPUT_FILE_MAPPING )
+	result = assorted_input_file_open_mapped(
+	          input_file,
+	          filename,
+	          error );
+
+	if( result == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_OPEN_FAILED,
+		 "%s: unable to map file.",
+		 function );
+
+		return( -1 );
+	}
+	else if( result != 0 )
+	{
+		assorted_output_statistics_stop_phase(
+		 ASSORTED_OUTPUT_STATISTICS_PHASE_OPEN,
+		 start_time,
+		 0 );
+
+		return( 1 );
+	}
+#endif
+	if( libcfile_file_initialize(
+	     &( input_file->file ),
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create file.",
+		 function );
+
+		goto on_error;
+	}
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+	result = libcfile_file_open_wide(
+	          input_file->file,
+	          filename,
+	          LIBCFILE_OPEN_READ,
+	          error );
+#else
+	result = libcfile_file_open(
+	          input_file->file,
+	          filename,
+	          LIBCFILE_OPEN_READ,
+	          error );
+#endif
+	if( result != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_OPEN_FAILED,
+		 "%s: unable to open file.",
+		 function );
+
+		goto on_error;
+	}
+	assorted_output_statistics_stop_phase(
+	 ASSORTED_OUTPUT_STATISTICS_PHASE_OPEN,
+	 start_time,
+	 0 );
+
+	return( 1 );
+
+on_error:
+	if( input_file->file != NULL )
+	{
+		libcfile_file_free(
+		 &( input_file->file ),
+		 NULL );
+	}
+	return( -1 );
+}
+
+/* Closes an input file
+ * Returns 0 if successful or -1 on error
+ */
+int assorted_input_file_close(
+     assorted_input_file_t *input_file,
+     libcerror_error_t **error )
+{
+	static char *function = "assorted_input_file_close";
+	int result            = 0;
+
+	if( input_file == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid input file.",
+		 function );
+
+		return( -1 );
+	}
+#if defined( HAVE_ASSORTED_INPUT_FILE_MAPPING )
+	if( input_file->mapped_data != NULL )
+	{
+#if defined( WINAPI )
+		if( ( UnmapViewOfFile(
+		       input_file->mapped_data ) == 0 )
+		 || ( CloseHandle(
+		       input_file->mapping_handle ) == 0 )
+		 || ( CloseHandle(
+		       input_file->file_handle ) == 0 ) )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_CLOSE_FAILED,
+			 "%s: unable to unmap file.",
+			 function );
+
+			result = -1;
+		}
+		input_file->mapping_handle = NULL;
+		input_file->file_handle    = INVALID_HANDLE_VALUE;
+#else
+		if( ( munmap(
+		       (void *) input_file->mapped_data,
+		       (size_t) input_file->mapped_data_size ) != 0 )
+		 || ( close(
+		       input_file->descriptor ) != 0 ) )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_CLOSE_FAILED,
+			 "%s: unable to unmap file.",
+			 function );
+
+			result = -1;
+		}
+		input_file->descriptor = -1;
+#endif
+		input_file->mapped_data      = NULL;
+		input_file->mapped_data_size = 0;
+		input_file->current_offset   = 0;
+	}
+#endif /* defined( HAVE_ASSORTED_INPUT_FILE_MAPPING ) */
+
+#if defined( HAVE_ASSORTED_INPUT_FILE_DIRECT_IO )
+#if defined( WINAPI )
+	if( input_file->direct_io_file_handle != INVALID_HANDLE_VALUE )
+	{
+		if( CloseHandle(
+		     input_file->direct_io_file_handle ) == 0 )
+#else
+	if( input_file->direct_io_descriptor != -1 )
+	{
+		if( close(
+		     input_file->direct_io_descriptor ) != 0 )
+#endif
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_CLOSE_FAILED,
+			 "%s: unable to close direct I/O file.",
+			 function );
+
+			result = -1;
+		}
+#if defined( WINAPI )
+		input_file->direct_io_file_handle = INVALID_HANDLE_VALUE;
+#else
+		input_file->direct_io_descriptor = -1;
+#endif
+		input_file->direct_io_data_offset = 0;
+		input_file->direct_io_data_size   = 0;
+		input_file->current_offset        = 0;
+	}
+#endif /* defined( HAVE_ASSORTED_INPUT_FILE_DIRECT_IO ) */
+
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+	if( input_file->reader_thread != NULL )
+	{
+		if( assorted_input_file_stop_read_ahead(
+		     input_file,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to stop read-ahead.",
+			 function );
+
+			result = -1;
+		}
+	}
+#endif
+	if( input_file->file != NULL )
+	{
+		if( libcfile_file_close(
+		     input_file->file,
+		     error ) != 0 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_CLOSE_FAILED,
+			 "%s: unable to close file.",
+			 function );
+
+			result = -1;
+		}
+		if( libcfile_file_free(
+		     &( input_file->file ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free file.",
+			 function );
+
+			result = -1;
+		}
+	}
+	return( result );
+}
+
+/* Determines if the input file is mapped into memory
+ * Returns 1 if mapped, 0 if not or -1 on error
+ */
+int assorted_input_file_is_mapped(
+     assorted_input_file_t *input_file,
+     libcerror_error_t **error )
+{
+	static char *function = "assorted_input_file_is_mapped";
+
+	if( input_file == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid input file.",
+		 function );
+
+		return( -1 );
+	}
+	if( input_file->mapped_data != NULL )
+	{
+		return( 1 );
+	}
+	return( 0 );
+}
+
+/* Retrieves the size of the input file
+ * Returns 1 if successful or -1 on error
+ */
+int assorted_input_file_get_size(
+     assorted_input_file_t *input_file,
+     size64_t *size,
+     libcerror_error_t **error )
+{
+	static char *function = "assorted_input_file_get_size";
+
+	if( input_file == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid input file.",
+		 function );
+
+		return( -1 );
+	}
+	if( size == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid size.",
+		 function );
+
+		return( -1 );
+	}
+	if( input_file->mapped_data != NULL )
+	{
+		*size = input_file->mapped_data_size;
+
+		return( 1 );
+	}
+	if( libcfile_file_get_size(
+	     input_file->file,
+	     size,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve file size.",
+		 function );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Seeks a certain offset in the input file
+ * Returns the offset if the seek is successful or -1 on error
+ */
+off64_t assorted_input_file_seek_offset(
+         assorted_input_file_t *input_file,
+         off64_t offset,
+         int whence,
+         libcerror_error_t **error )
+{
+	static char *function = "assorted_input_file_seek_offset";
+
+	if( input_file == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid input file.",
+		 function );
+
+		return( -1 );
+	}
+	if( input_file->mapped_data == NULL )
+	{
+		/* Pipes cannot seek, hence seeking the current offset is skipped
+		 */
+		if( ( ( whence == SEEK_SET )
+		  &&  ( offset == input_file->current_offset ) )
+		 || ( ( whence == SEEK_CUR )
+		  &&  ( offset == 0 ) ) )
+		{
+			return( input_file->current_offset );
+		}
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+		if( input_file->reader_thread != NULL )
+		{
+			/* The file offset of the reader thread is beyond the current offset
+			 */
+			if( whence == SEEK_CUR )
+			{
+				offset += input_file->current_offset;
+				whence  = SEEK_SET;
+			}
+			if( assorted_input_file_stop_read_ahead(
+			     input_file,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+				 "%s: unable to stop read-ahead.",
+				 function );
+
+				return( -1 );
+			}
+		}
+#endif
+		offset = libcfile_file_seek_offset(
+		          input_file->file,
+		          offset,
+		          whence,
+		          error );
+
+		if( offset == -1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_SEEK_FAILED,
+			 "%s: unable to seek offset in file.",
+			 function );
+
+			return( -1 );
+		}
+		input_file->current_offset = offset;
+
+		return( offset );
+	}
+	if( whence == SEEK_CUR )
+	{
+		offset += input_file->current_offset;
+	}
+	else if( whence == SEEK_END )
+	{
+		offset += (off64_t) input_file->mapped_data_size;
+	}
+	else if( whence != SEEK_SET )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_UNSUPPORTED_VALUE,
+		 "%s: unsupported whence.",
+		 function );
+
+		return( -1 );
+	}
+	if( offset < 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid offset value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	input_file->current_offset    = offset;
+	input_file->read_ahead_offset = offset;
+
+	return( offset );
+}
+
+/* Sets the read-ahead of the input file
+ * The data of a mapped file is prefetched number of blocks x block size ahead
+ * of the data that is read, otherwise a reader thread fills a ring of number
+ * of blocks buffers of block size while the data of the previous blocks is processed
+ * A block size of 0 disables the read-ahead
+ * Returns 1 if successful or -1 on error
+ */
+int assorted_input_file_set_read_ahead(
+     assorted_input_file_t *input_file,
+     size_t block_size,
+     int number_of_blocks,
+     libcerror_error_t **error )
+{
+	static char *function = "assorted_input_file_set_read_ahead";
+
+	if( input_file == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid input file.",
+		 function );
+
+		return( -1 );
+	}
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+	if( input_file->reader_thread != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid input file - read-ahead already started.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	if( block_size > (size_t) SSIZE_MAX )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid block size value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( number_of_blocks < 2 )
+	 || ( number_of_blocks > ASSORTED_INPUT_FILE_MAXIMUM_NUMBER_OF_READ_AHEAD_BLOCKS ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid number of blocks value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	input_file->read_ahead_block_size       = block_size;
+	input_file->number_of_read_ahead_blocks = number_of_blocks;
+	input_file->read_ahead_offset           = 0;
+
+	return( 1 );
+}
+
+#if defined( HAVE_ASSORTED_INPUT_FILE_MAPPING ) && defined( HAVE_MADVISE )
+
+/* Prefetches the mapped data following the current offset
+ * The kernel reads the data asynchronously, which overlaps reading the next
+ * blocks with processing the current block, e.g. on a network file system
+ * Returns 1 if successful or -1 on error
+ */
+int assorted_input_file_prefetch_mapped_data(
+     assorted_input_file_t *input_file,
+     libcerror_error_t **error )
+{
+	static char *function    = "assorted_input_file_prefetch_mapped_data";
+	size64_t read_ahead_size = 0;
+	off64_t read_ahead_end   = 0;
+	off64_t read_ahead_start = 0;
+
+	if( input_file == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid input file.",
+		 function );
+
+		return( -1 );
+	}
+	if( input_file->mapped_data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid input file - missing mapped data.",
+		 function );
+
+		return( -1 );
+	}
+#if defined( MADV_WILLNEED )
+	read_ahead_size = (size64_t) input_file->read_ahead_block_size * input_file->number_of_read_ahead_blocks;
+
+	if( read_ahead_size > ( input_file->mapped_data_size - input_file->current_offset ) )
+	{
+		read_ahead_size = input_file->mapped_data_size - input_file->current_offset;
+	}
+	read_ahead_end   = input_file->current_offset + (off64_t) read_ahead_size;
+	read_ahead_start = input_file->read_ahead_offset;
+
+	if( read_ahead_start < input_file->current_offset )
+	{
+		read_ahead_start = input_file->current_offset;
+	}
+	/* The data is advised per block, except for the end of the mapped data
+	 */
+	if( ( read_ahead_start >= read_ahead_end )
+	 || ( ( (size64_t) ( read_ahead_end - read_ahead_start ) < input_file->read_ahead_block_size )
+	  &&  ( (size64_t) read_ahead_end < input_file->mapped_data_size ) ) )
+	{
+		return( 1 );
+	}
+	read_ahead_start -= read_ahead_start % ASSORTED_INPUT_FILE_READ_AHEAD_ALIGNMENT;
+
+	/* The advice is only a hint, hence failure is ignored
+	 */
+	madvise(
+	 (void *) &( input_file->mapped_data[ read_ahead_start ] ),
+	 (size_t) ( read_ahead_end - read_ahead_start ),
+	 MADV_WILLNEED );
+
+	input_file->read_ahead_offset = read_ahead_end;
+#endif
+	return( 1 );
+}
+
+#endif /* defined( HAVE_ASSORTED_INPUT_FILE_MAPPING ) && defined( HAVE_MADVISE ) */
+
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+
+/* Starts the reader thread of the input file
+ * The reader thread reads from the current offset of the file
+ * Returns 1 if successful or -1 on error
+ */
+int assorted_input_file_start_read_ahead(
+     assorted_input_file_t *input_file,
+     libcerror_error_t **error )
+{
+	assorted_input_file_block_t *block = NULL;
+	static char *function              = "assorted_input_file_start_read_ahead";
+	int block_index                    = 0;
+
+	if( input_file == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid input file.",
+		 function );
+
+		return( -1 );
+	}
+	if( input_file->file == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid input file - missing file.",
+		 function );
+
+		return( -1 );
+	}
+	if( input_file->reader_thread != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid input file - read-ahead already started.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( input_file->read_ahead_block_size == 0 )
+	 || ( input_file->number_of_read_ahead_blocks < 2 )
+	 || ( input_file->number_of_read_ahead_blocks > ASSORTED_INPUT_FILE_MAXIMUM_NUMBER_OF_READ_AHEAD_BLOCKS ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid input file - read-ahead not set.",
+		 function );
+
+		return( -1 );
+	}
+	input_file->read_ahead_blocks = (assorted_input_file_block_t *) memory_allocate(
+	                                                                 sizeof( assorted_input_file_block_t ) * input_file->number_of_read_ahead_blocks );
+
+	if( input_file->read_ahead_blocks == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create read-ahead blocks.",
+		 function );
+
+		goto on_error;
+	}
+	if( memory_set(
+	     input_file->read_ahead_blocks,
+	     0,
+	     sizeof( assorted_input_file_block_t ) * input_file->number_of_read_ahead_blocks ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear read-ahead blocks.",
+		 function );
+
+		memory_free(
+		 input_file->read_ahead_blocks );
+
+		input_file->read_ahead_blocks = NULL;
+
+		goto on_error;
+	}
+	for( block_index = 0;
+	     block_index < input_file->number_of_read_ahead_blocks;
+	     block_index++ )
+	{
+		block = &( input_file->read_ahead_blocks[ block_index ] );
+
+		block->data = (uint8_t *) memory_allocate(
+		                           sizeof( uint8_t ) * input_file->read_ahead_block_size );
+
+		if( block->data == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+			 "%s: unable to create read-ahead block: %d data.",
+			 function,
+			 block_index );
+
+			goto on_error;
+		}
+	}
+	if( libcthreads_queue_initialize(
+	     &( input_file->empty_blocks_queue ),
+	     input_file->number_of_read_ahead_blocks,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create empty blocks queue.",
+		 function );
+
+		goto on_error;
+	}
+	if( libcthreads_queue_initialize(
+	     &( input_file->filled_blocks_queue ),
+	     input_file->number_of_read_ahead_blocks,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create filled blocks queue.",
+		 function );
+
+		goto on_error;
+	}
+	if( libcthreads_mutex_initialize(
+	     &( input_file->read_ahead_mutex ),
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create read-ahead mutex.",
+		 function );
+
+		goto on_error;
+	}
+	for( block_index = 0;
+	     block_index < input_file->number_of_read_ahead_blocks;
+	     block_index++ )
+	{
+		if( libcthreads_queue_push(
+		     input_file->empty_blocks_queue,
+		     (intptr_t *) &( input_file->read_ahead_blocks[ block_index ] ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+			 "%s: unable to push block: %d onto empty blocks queue.",
+			 function,
+			 block_index );
+
+			goto on_error;
+		}
+	}
+	input_file->abort_read_ahead     = 0;
+	input_file->current_block        = NULL;
+	input_file->current_block_offset = 0;
+	input_file->read_ahead_finished  = 0;
+
+	if( libcthreads_thread_create(
+	     &( input_file->reader_thread ),
+	     NULL,
+	     assorted_input_file_read_ahead_thread,
+	     (void *) input_file,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create reader thread.",
+		 function );
+
+		goto on_error;
+	}
+	return( 1 );
+
+on_error:
+	if( input_file->read_ahead_mutex != NULL )
+	{
+		libcthreads_mutex_free(
+		 &( input_file->read_ahead_mutex ),
+		 NULL );
+	}
+	if( input_file->filled_blocks_queue != NULL )
+	{
+		libcthreads_queue_free(
+		 &( input_file->filled_blocks_queue ),
+		 NULL,
+		 NULL );
+	}
+	if( input_file->empty_blocks_queue != NULL )
+	{
+		libcthreads_queue_free(
+		 &( input_file->empty_blocks_queue ),
+		 NULL,
+		 NULL );
+	}
+	if( input_file->read_ahead_blocks != NULL )
+	{
+		for( block_index = 0;
+		     block_index < input_file->number_of_read_ahead_blocks;
+		     block_index++ )
+		{
+			if( input_file->read_ahead_blocks[ block_index ].data != NULL )
+			{
+				memory_free(
+				 input_file->read_ahead_blocks[ block_index ].data );
+			}
+		}
+		memory_free(
+		 input_file->read_ahead_blocks );
+
+		input_file->read_ahead_blocks = NULL;
+	}
+	return( -1 );
+}
+
+/* Stops the reader thread of the input file
+ * The blocks that were read ahead are discarded, hence the offset of the file
+ * is beyond the current offset afterwards
+ * Returns 1 if successful or -1 on error
+ */
+int assorted_input_file_stop_read_ahead(
+     assorted_input_file_t *input_file,
+     libcerror_error_t **error )
+{
+	assorted_input_file_block_t *block = NULL;
+	static char *function              = "assorted_input_file_stop_read_ahead";
+	int block_index                    = 0;
+	int result                         = 1;
+
+	if( input_file == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid input file.",
+		 function );
+
+		return( -1 );
+	}
+	if( input_file->reader_thread == NULL )
+	{
+		return( 1 );
+	}
+	if( libcthreads_mutex_grab(
+	     input_file->read_ahead_mutex,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab read-ahead mutex.",
+		 function );
+
+		return( -1 );
+	}
+	input_file->abort_read_ahead = 1;
+
+	if( libcthreads_mutex_release(
+	     input_file->read_ahead_mutex,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release read-ahead mutex.",
+		 function );
+
+		return( -1 );
+	}
+	/* The filled blocks are returned to the reader thread until it
+	 * passes its last block, so that it cannot block on a full queue
+	 */
+	block = input_file->current_block;
+
+	while( input_file->read_ahead_finished == 0 )
+	{
+		if( block != NULL )
+		{
+			if( libcthreads_queue_push(
+			     input_file->empty_blocks_queue,
+			     (intptr_t *) block,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+				 "%s: unable to push block onto empty blocks queue.",
+				 function );
+
+				return( -1 );
+			}
+		}
+		if( libcthreads_queue_pop(
+		     input_file->filled_blocks_queue,
+		     (intptr_t **) &block,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to pop block from filled blocks queue.",
+			 function );
+
+			return( -1 );
+		}
+		if( ( block->flags & ASSORTED_INPUT_FILE_BLOCK_FLAG_IS_LAST ) != 0 )
+		{
+			input_file->read_ahead_finished = 1;
+		}
+	}
+	if( libcthreads_thread_join(
+	     &( input_file->reader_thread ),
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+		 "%s: unable to join reader thread.",
+		 function );
+
+		result = -1;
+	}
+	if( libcthreads_mutex_free(
+	     &( input_file->read_ahead_mutex ),
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+		 "%s: unable to free read-ahead mutex.",
+		 function );
+
+		result = -1;
+	}
+	if( libcthreads_queue_free(
+	     &( input_file->filled_blocks_queue ),
+	     NULL,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+		 "%s: unable to free filled blocks queue.",
+		 function );
+
+		result = -1;
+	}
+	if( libcthreads_queue_free(
+	     &( input_file->empty_blocks_queue ),
+	     NULL,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+		 "%s: unable to free empty blocks queue.",
+		 function );
+
+		result = -1;
+	}
+	for( block_index = 0;
+	     block_index < input_file->number_of_read_ahead_blocks;
+	     block_index++ )
+	{
+		memory_free(
+		 input_file->read_ahead_blocks[ block_index ].data );
+	}
+	memory_free(
+	 input_file->read_ahead_blocks );
+
+	input_file->read_ahead_blocks    = NULL;
+	input_file->current_block        = NULL;
+	input_file->current_block_offset = 0;
+
+	return( result );
+}
+
+/* Fills the read-ahead blocks of the input file
+ * Callback function for the reader thread
+ * Returns 1 if successful or -1 on error
+ */
+int assorted_input_file_read_ahead_thread(
+     void *arguments )
+{
+	assorted_input_file_block_t *block = NULL;
+	assorted_input_file_t *input_file  = NULL;
+	libcerror_error_t *error           = NULL;
+	ssize_t read_count                 = 0;
+	uint8_t abort_read_ahead           = 0;
+	int result                         = 1;
+
+	if( arguments == NULL )
+	{
+		return( -1 );
+	}
+	input_file = (assorted_input_file_t *) arguments;
+
+	do
+	{
+		if( libcthreads_queue_pop(
+		     input_file->empty_blocks_queue,
+		     (intptr_t **) &block,
+		     &error ) != 1 )
+		{
+			libcerror_error_free(
+			 &error );
+
+			return( -1 );
+		}
+		block->data_size = 0;
+		block->flags     = 0;
+
+		if( libcthreads_mutex_grab(
+		     input_file->read_ahead_mutex,
+		     &error ) != 1 )
+		{
+			result = -1;
+		}
+		else
+		{
+			abort_read_ahead = input_file->abort_read_ahead;
+
+			if( libcthreads_mutex_release(
+			     input_file->read_ahead_mutex,
+			     &error ) != 1 )
+			{
+				result = -1;
+			}
+		}
+		if( result != 1 )
+		{
+			block->flags = ASSORTED_INPUT_FILE_BLOCK_FLAG_IS_LAST | ASSORTED_INPUT_FILE_BLOCK_FLAG_READ_ERROR;
+		}
+		else if( abort_read_ahead != 0 )
+		{
+			block->flags = ASSORTED_INPUT_FILE_BLOCK_FLAG_IS_LAST;
+		}
+		else
+		{
+			/* Pipes can return less data than requested, hence the block
+			 * is filled until the end of the file is reached
+			 */
+			while( block->data_size < input_file->read_ahead_block_size )
+			{
+				read_count = libcfile_file_read_buffer(
+				              input_file->file,
+				              &( block->data[ block->data_size ] ),
+				              input_file->read_ahead_block_size - block->data_size,
+				              &error );
+
+				if( read_count < 0 )
+				{
+					block->flags = ASSORTED_INPUT_FILE_BLOCK_FLAG_IS_LAST | ASSORTED_INPUT_FILE_BLOCK_FLAG_READ_ERROR;
+
+					break;
+				}
+				else if( read_count == 0 )
+				{
+					block->flags = ASSORTED_INPUT_FILE_BLOCK_FLAG_IS_LAST;
+
+					break;
+				}
+				block->data_size += (size_t) read_count;
+			}
+		}
+		if( error != NULL )
+		{
+			libcerror_error_free(
+			 &error );
+		}
+		if( libcthreads_queue_push(
+		     input_file->filled_blocks_queue,
+		     (intptr_t *) block,
+		     &error ) != 1 )
+		{
+			libcerror_error_free(
+			 &error );
+
+			return( -1 );
+		}
+	}
+	while( ( block->flags & ASSORTED_INPUT_FILE_BLOCK_FLAG_IS_LAST ) == 0 );
+
+	return( result );
+}
+
+/* Reads data from the read-ahead blocks of the input file
+ * If the data is contained in a single block data points to the block,
+ * otherwise the data is copied into a buffer that data points to
+ * Returns the number of bytes read or -1 on error
+ */
+ssize_t assorted_input_file_read_ahead_data(
+         assorted_input_file_t *input_file,
+         uint8_t **data,
+         size_t size,
+         libcerror_error_t **error )
+{
+	assorted_input_file_block_t *block = NULL;
+	uint8_t *reallocation              = NULL;
+	static char *function              = "assorted_input_file_read_ahead_data";
+	size_t available_size              = 0;
+	size_t copy_size                   = 0;
+	size_t data_offset                 = 0;
+
+	if( input_file == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid input file.",
+		 function );
+
+		return( -1 );
+	}
+	if( input_file->reader_thread == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid input file - read-ahead not started.",
+		 function );
+
+		return( -1 );
+	}
+	if( data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid data.",
+		 function );
+
+		return( -1 );
+	}
+	*data = NULL;
+
+	while( data_offset < size )
+	{
+		block = input_file->current_block;
+
+		if( ( block != NULL )
+		 && ( input_file->current_block_offset >= block->data_size ) )
+		{
+			if( ( block->flags & ASSORTED_INPUT_FILE_BLOCK_FLAG_IS_LAST ) != 0 )
+			{
+				break;
+			}
+			/* The block is returned to the reader thread once all its data
+			 * was read, which is after the data of the previous read was used
+			 */
+			if( libcthreads_queue_push(
+			     input_file->empty_blocks_queue,
+			     (intptr_t *) block,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+				 "%s: unable to push block onto empty blocks queue.",
+				 function );
+
+				return( -1 );
+			}
+			input_file->current_block = NULL;
+
+			block = NULL;
+		}
+		if( block == NULL )
+		{
+			if( libcthreads_queue_pop(
+			     input_file->filled_blocks_queue,
+			     (intptr_t **) &block,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+				 "%s: unable to pop block from filled blocks queue.",
+				 function );
+
+				return( -1 );
+			}
+			input_file->current_block        = block;
+			input_file->current_block_offset = 0;
+
+			if( ( block->flags & ASSORTED_INPUT_FILE_BLOCK_FLAG_IS_LAST ) != 0 )
+			{
+				input_file->read_ahead_finished = 1;
+			}
+			if( ( block->flags & ASSORTED_INPUT_FILE_BLOCK_FLAG_READ_ERROR ) != 0 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_IO,
+				 LIBCERROR_IO_ERROR_READ_FAILED,
+				 "%s: unable to read data from file.",
+				 function );
+
+				return( -1 );
+			}
+			continue;
+		}
+		available_size = block->data_size - input_file->current_block_offset;
+
+		if( ( data_offset == 0 )
+		 && ( available_size >= size ) )
+		{
+			*data = &( block->data[ input_file->current_block_offset ] );
+
+			input_file->current_block_offset += size;
+			data_offset                       = size;
+
+			break;
+		}
+		if( size > input_file->buffer_size )
+		{
+			reallocation = (uint8_t *) memory_reallocate(
+			                            input_file->buffer,
+			                            sizeof( uint8_t ) * size );
+
+			if( reallocation == NULL )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_MEMORY,
+				 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+				 "%s: unable to resize buffer.",
+				 function );
+
+				return( -1 );
+			}
+			input_file->buffer      = reallocation;
+			input_file->buffer_size = size;
+		}
+		copy_size = size - data_offset;
+
+		if( copy_size > available_size )
+		{
+			copy_size = available_size;
+		}
+		if( memory_copy(
+		     &( input_file->buffer[ data_offset ] ),
+		     &( block->data[ input_file->current_block_offset ] ),
+		     copy_size ) == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+			 "%s: unable to copy data.",
+			 function );
+
+			return( -1 );
+		}
+		input_file->current_block_offset += copy_size;
+		data_offset                      += copy_size;
+
+		*data = input_file->buffer;
+	}
+	input_file->current_offset += (off64_t) data_offset;
+
+	return( (ssize_t) data_offset );
+}
+
+#endif /* defined( HAVE_MULTI_THREAD_SUPPORT ) */
+
+/* Reads data from the input file
+ * If the input file is mapped data points to the mapped data,
+ * if direct I/O is used data points to the direct I/O buffer,
+ * if read-ahead is set data points to a read-ahead block or a buffer,
+ * otherwise the data is read into a buffer that data points to
+ * The data remains valid until the next read and must not be modified
+ * Returns the number of bytes read or -1 on error
+ */
+ssize_t assorted_input_file_read_data(
+         assorted_input_file_t *input_file,
+         uint8_t **data,
+         size_t size,
+         libcerror_error_t **error )
+{
+	uint8_t *reallocation = NULL;
+	static char *function = "assorted_input_file_read_data";
+	uint64_t start_time   = 0;
+	ssize_t read_count    = 0;
+
+	if( input_file == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid input file.",
+		 function );
+
+		return( -1 );
+	}
+	if( data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid data.",
+		 function );
+
+		return( -1 );
+	}
+	if( size > (size_t) SSIZE_MAX )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid size value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	/* Reads of mapped data only return a pointer, the page faults
+	 * are part of the phase that accesses the data
+	 */
+	start_time = assorted_output_statistics_start_phase();
+
+	if( input_file->mapped_data != NULL )
+	{
+		if( (size64_t) input_file->current_offset >= input_file->mapped_data_size )
+		{
+			*data = NULL;
+
+			return( 0 );
+		}
+		if( (size64_t) size > ( input_file->mapped_data_size - input_file->current_offset ) )
+		{
+			size = (size_t) ( input_file->mapped_data_size - input_file->current_offset );
+		}
+		*data = &( input_file->mapped_data[ input_file->current_offset ] );
+
+		input_file->current_offset += (off64_t) size;
+
+#if defined( HAVE_ASSORTED_INPUT_FILE_MAPPING ) && defined( HAVE_MADVISE )
+		if( input_file->read_ahead_block_size > 0 )
+		{
+			if( assorted_input_file_prefetch_mapped_data(
+			     input_file,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_IO,
+				 LIBCERROR_IO_ERROR_READ_FAILED,
+				 "%s: unable to prefetch mapped data.",
+				 function );
+
+				return( -1 );
+			}
+		}
+#endif
+		assorted_output_statistics_stop_phase(
+		 ASSORTED_OUTPUT_STATISTICS_PHASE_READ,
+		 start_time,
+		 (size64_t) size );
+
+		return( (ssize_t) size );
+	}
+#if defined( HAVE_ASSORTED_INPUT_FILE_DIRECT_IO )
+#if defined( WINAPI )
+	if( input_file->direct_io_file_handle != INVALID_HANDLE_VALUE )
+#else
+	if( input_file->direct_io_descriptor != -1 )
+#endif
+	{
+		read_count = assorted_input_file_read_direct_data(
+		              input_file,
+		              data,
+		              size,
+		              error );
+
+		if( read_count == -1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_READ_FAILED,
+			 "%s: unable to read data using direct I/O.",
+			 function );
+
+			return( -1 );
+		}
+		assorted_output_statistics_stop_phase(
+		 ASSORTED_OUTPUT_STATISTICS_PHASE_READ,
+		 start_time,
+		 (size64_t) read_count );
+
+		return( read_count );
+	}
+#endif
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+	if( input_file->read_ahead_block_size > 0 )
+	{
+		if( input_file->reader_thread == NULL )
+		{
+			if( assorted_input_file_start_read_ahead(
+			     input_file,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+				 "%s: unable to start read-ahead.",
+				 function );
+
+				return( -1 );
+			}
+		}
+		read_count = assorted_input_file_read_ahead_data(
+		              input_file,
+		              data,
+		              size,
+		              error );
+
+		if( read_count == -1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_READ_FAILED,
+			 "%s: unable to read data from read-ahead blocks.",
+			 function );
+
+			return( -1 );
+		}
+		assorted_output_statistics_stop_phase(
+		 ASSORTED_OUTPUT_STATISTICS_PHASE_READ,
+		 start_time,
+		 (size64_t) read_count );
+
+		return( read_count );
+	}
+#endif
+	if( size > input_file->buffer_size )
+	{
+		reallocation = (uint8_t *) memory_reallocate(
+		                            input_file->buffer,
+		                            sizeof( uint8_t ) * size );
+
+		if( reallocation == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+			 "%s: unable to resize buffer.",
+			 function );
+
+			return( -1 );
+		}
+		input_file->buffer      = reallocation;
+		input_file->buffer_size = size;
+	}
+	read_count = libcfile_file_read_buffer(
+	              input_file->file,
+	              input_file->buffer,
+	              size,
+	              error );
+
+	if( read_count == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_READ_FAILED,
+		 "%s: unable to read data from file.",
+		 function );
+
+		return( -1 );
+	}
+	input_file->current_offset += (off64_t) read_count;
+
+	*data = input_file->buffer;
+
+	assorted_output_statistics_stop_phase(
+	 ASSORTED_OUTPUT_STATISTICS_PHASE_READ,
+	 start_time,
+	 (size64_t) read_count );
+
+	return( read_count );
+}
+
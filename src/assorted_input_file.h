@@ -0,0 +1,329 @@
+/*
+ * Input file functions
+ *
+ * Copyright (C) 2008-2019, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This software is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This software is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this software.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#if !defined( _ASSORTED_INPUT_FILE_H )
+#define _ASSORTED_INPUT_FILE_H
+
+#include <common.h>
+#include <types.h>
+
+#include "assorted_libcerror.h"
+#include "assorted_libcfile.h"
+#include "assorted_libcthreads.h"
+
+#if defined( __cplusplus )
+extern "C" {
+#endif
+
+#if defined( WINAPI ) || ( defined( HAVE_MMAP ) && !defined( HAVE_WIDE_SYSTEM_CHARACTER ) )
+#define HAVE_ASSORTED_INPUT_FILE_MAPPING
+#endif
+
+#if defined( WINAPI ) || ( defined( HAVE_FCNTL_H ) && defined( HAVE_UNISTD_H ) && !defined( HAVE_WIDE_SYSTEM_CHARACTER ) )
+#define HAVE_ASSORTED_INPUT_FILE_DIRECT_IO
+#endif
+
+/* The alignment of the offset, size and buffer of direct I/O reads,
+ * which is a multiple of the common device sector sizes
+ */
+#define ASSORTED_INPUT_FILE_DIRECT_IO_ALIGNMENT			4096
+
+/* The default number of read-ahead blocks
+ */
+#define ASSORTED_INPUT_FILE_DEFAULT_NUMBER_OF_READ_AHEAD_BLOCKS	3
+
+/* The maximum number of read-ahead blocks
+ */
+#define ASSORTED_INPUT_FILE_MAXIMUM_NUMBER_OF_READ_AHEAD_BLOCKS	16
+
+/* The alignment of the mapped data read-ahead offset, which is a multiple
+ * of the page sizes used by the supported platforms
+ */
+#define ASSORTED_INPUT_FILE_READ_AHEAD_ALIGNMENT		65536
+
+/* The read-ahead block flags
+ */
+enum ASSORTED_INPUT_FILE_BLOCK_FLAGS
+{
+	ASSORTED_INPUT_FILE_BLOCK_FLAG_IS_LAST		= 0x01,
+	ASSORTED_INPUT_FILE_BLOCK_FLAG_READ_ERROR	= 0x02
+};
+
+typedef struct assorted_input_file_block assorted_input_file_block_t;
+
+struct assorted_input_file_block
+{
+	/* The data
+	 */
+	uint8_t *data;
+
+	/* The data size
+	 */
+	size_t data_size;
+
+	/* The flags
+	 */
+	uint8_t flags;
+};
+
+typedef struct assorted_input_file assorted_input_file_t;
+
+struct assorted_input_file
+{
+	/* The file used for buffered reads
+	 */
+	libcfile_file_t *file;
+
+#if defined( WINAPI )
+	/* The file handle of the mapped file
+	 */
+	HANDLE file_handle;
+
+	/* The file mapping handle
+	 */
+	HANDLE mapping_handle;
+
+#elif defined( HAVE_ASSORTED_INPUT_FILE_MAPPING )
+	/* The file descriptor of the mapped file
+	 */
+	int descriptor;
+#endif
+
+	/* The mapped data
+	 */
+	uint8_t *mapped_data;
+
+	/* The mapped data size
+	 */
+	size64_t mapped_data_size;
+
+	/* The current offset
+	 */
+	off64_t current_offset;
+
+	/* The buffer used for buffered reads
+	 */
+	uint8_t *buffer;
+
+	/* The buffer size
+	 */
+	size_t buffer_size;
+
+	/* The direct I/O block size
+	 */
+	size_t direct_io_block_size;
+
+#if defined( HAVE_ASSORTED_INPUT_FILE_DIRECT_IO )
+#if defined( WINAPI )
+	/* The file handle used for direct I/O
+	 */
+	HANDLE direct_io_file_handle;
+#else
+	/* The file descriptor used for direct I/O
+	 */
+	int direct_io_descriptor;
+#endif
+
+	/* The allocated direct I/O buffer
+	 */
+	uint8_t *direct_io_allocation;
+
+	/* The aligned direct I/O buffer
+	 */
+	uint8_t *direct_io_buffer;
+
+	/* The direct I/O buffer size
+	 */
+	size_t direct_io_buffer_size;
+
+	/* The file offset of the data in the direct I/O buffer
+	 */
+	off64_t direct_io_data_offset;
+
+	/* The size of the data in the direct I/O buffer
+	 */
+	size_t direct_io_data_size;
+#endif
+
+	/* The read-ahead block size
+	 */
+	size_t read_ahead_block_size;
+
+	/* The number of read-ahead blocks
+	 */
+	int number_of_read_ahead_blocks;
+
+	/* The offset up to which the mapped data was read-ahead
+	 */
+	off64_t read_ahead_offset;
+
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+	/* The read-ahead blocks
+	 */
+	assorted_input_file_block_t *read_ahead_blocks;
+
+	/* The queue of blocks that can be filled by the reader thread
+	 */
+	libcthreads_queue_t *empty_blocks_queue;
+
+	/* The queue of blocks filled by the reader thread
+	 */
+	libcthreads_queue_t *filled_blocks_queue;
+
+	/* The reader thread
+	 */
+	libcthreads_thread_t *reader_thread;
+
+	/* The mutex that protects the abort value
+	 */
+	libcthreads_mutex_t *read_ahead_mutex;
+
+	/* Value to indicate the reader thread should stop
+	 */
+	uint8_t abort_read_ahead;
+
+	/* The block the data is currently read from
+	 */
+	assorted_input_file_block_t *current_block;
+
+	/* The offset of the data in the current block
+	 */
+	size_t current_block_offset;
+
+	/* Value to indicate the last block was received from the reader thread
+	 */
+	uint8_t read_ahead_finished;
+#endif
+};
+
+int assorted_input_file_initialize(
+     assorted_input_file_t **input_file,
+     libcerror_error_t **error );
+
+int assorted_input_file_free(
+     assorted_input_file_t **input_file,
+     libcerror_error_t **error );
+
+#if defined( HAVE_ASSORTED_INPUT_FILE_MAPPING )
+
+int assorted_input_file_open_mapped(
+     assorted_input_file_t *input_file,
+     const system_character_t *filename,
+     libcerror_error_t **error );
+
+#endif /* defined( HAVE_ASSORTED_INPUT_FILE_MAPPING ) */
+
+int assorted_input_file_set_direct_io(
+     assorted_input_file_t *input_file,
+     size_t block_size,
+     libcerror_error_t **error );
+
+#if defined( HAVE_ASSORTED_INPUT_FILE_DIRECT_IO )
+
+int assorted_input_file_open_direct(
+     assorted_input_file_t *input_file,
+     const system_character_t *filename,
+     libcerror_error_t **error );
+
+int assorted_input_file_resize_direct_io_buffer(
+     assorted_input_file_t *input_file,
+     size_t size,
+     libcerror_error_t **error );
+
+ssize_t assorted_input_file_read_direct_data(
+         assorted_input_file_t *input_file,
+         uint8_t **data,
+         size_t size,
+         libcerror_error_t **error );
+
+#endif /* defined( HAVE_ASSORTED_INPUT_FILE_DIRECT_IO ) */
+
+int assorted_input_file_open(
+     assorted_input_file_t *input_file,
+     const system_character_t *filename,
+     libcerror_error_t **error );
+
+int assorted_input_file_close(
+     assorted_input_file_t *input_file,
+     libcerror_error_t **error );
+
+int assorted_input_file_is_mapped(
+     assorted_input_file_t *input_file,
+     libcerror_error_t **error );
+
+int assorted_input_file_get_size(
+     assorted_input_file_t *input_file,
+     size64_t *size,
+     libcerror_error_t **error );
+
+off64_t assorted_input_file_seek_offset(
+         assorted_input_file_t *input_file,
+         off64_t offset,
+         int whence,
+         libcerror_error_t **error );
+
+int assorted_input_file_set_read_ahead(
+     assorted_input_file_t *input_file,
+     size_t block_size,
+     int number_of_blocks,
+     libcerror_error_t **error );
+
+#if defined( HAVE_ASSORTED_INPUT_FILE_MAPPING ) && defined( HAVE_MADVISE )
+
+int assorted_input_file_prefetch_mapped_data(
+     assorted_input_file_t *input_file,
+     libcerror_error_t **error );
+
+#endif /* defined( HAVE_ASSORTED_INPUT_FILE_MAPPING ) && defined( HAVE_MADVISE ) */
+
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+
+int assorted_input_file_start_read_ahead(
+     assorted_input_file_t *input_file,
+     libcerror_error_t **error );
+
+int assorted_input_file_stop_read_ahead(
+     assorted_input_file_t *input_file,
+     libcerror_error_t **error );
+
+int assorted_input_file_read_ahead_thread(
+     void *arguments );
+
+ssize_t assorted_input_file_read_ahead_data(
+         assorted_input_file_t *input_file,
+         uint8_t **data,
+         size_t size,
+         libcerror_error_t **error );
+
+#endif /* defined( HAVE_MULTI_THREAD_SUPPORT ) */
+
+ssize_t assorted_input_file_read_data(
+         assorted_input_file_t *input_file,
+         uint8_t **data,
+         size_t size,
+         libcerror_error_t **error );
+
+#if defined( __cplusplus )
+}
+#endif
+
+#endif /* !defined( _ASSORTED_INPUT_FILE_H ) */
+
@@ -21,9 +21,100 @@
 
 #include <common.h>
 #include <file_stream.h>
+#include <memory.h>
+#include <system_string.h>
 #include <types.h>
 
+#if defined( HAVE_SYS_RESOURCE_H )
+#include <sys/resource.h>
+#endif
+
 #include "assorted_i18n.h"
+#include "assorted_libcerror.h"
+#include "assorted_libcthreads.h"
+#include "assorted_output.h"
+#include "assorted_timer.h"
+
+typedef struct assorted_output_statistics assorted_output_statistics_t;
+
+struct assorted_output_statistics
+{
+	/* The output format
+	 */
+	int format;
+
+	/* The time the statistics were initialized in nanoseconds
+	 */
+	uint64_t start_time;
+
+	/* The time spent per phase in nanoseconds
+	 */
+	uint64_t phase_times[ ASSORTED_OUTPUT_STATISTICS_NUMBER_OF_PHASES ];
+
+	/* The number of bytes processed per phase
+	 */
+	size64_t phase_number_of_bytes[ ASSORTED_OUTPUT_STATISTICS_NUMBER_OF_PHASES ];
+
+	/* The number of times a phase was entered
+	 */
+	uint64_t phase_number_of_calls[ ASSORTED_OUTPUT_STATISTICS_NUMBER_OF_PHASES ];
+
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+	/* The mutex that serializes updates from multiple threads, such as in batch mode
+	 */
+	libcthreads_mutex_t *mutex;
+#endif
+};
+
+/* The statistics of the program, which are shared by the input and output
+ * file functions hence they are not passed around
+ */
+static assorted_output_statistics_t assorted_output_statistics;
+
+/* The names of the statistics phases
+ */
+static const char *assorted_output_statistics_phase_names[ ASSORTED_OUTPUT_STATISTICS_NUMBER_OF_PHASES ] = {
+	"open",
+	"read",
+	"write" };
+
+/* The hexdump window, which limits the data printed by assorted_output_data_fprint
+ * to the bytes from the window offset up to the window offset plus size
+ */
+static uint64_t assorted_output_hexdump_window_offset = 0;
+static uint64_t assorted_output_hexdump_window_size   = (uint64_t) -1;
+
+/* The 2 digit hexadecimal representation of a byte value
+ */
+static const char *assorted_output_hexdump_hexadecimal_pairs =
+	"000102030405060708090a0b0c0d0e0f101112131415161718191a1b1c1d1e1f"
+	"202122232425262728292a2b2c2d2e2f303132333435363738393a3b3c3d3e3f"
+	"404142434445464748494a4b4c4d4e4f505152535455565758595a5b5c5d5e5f"
+	"606162636465666768696a6b6c6d6e6f707172737475767778797a7b7c7d7e7f"
+	"808182838485868788898a8b8c8d8e8f909192939495969798999a9b9c9d9e9f"
+	"a0a1a2a3a4a5a6a7a8a9aaabacadaeafb0b1b2b3b4b5b6b7b8b9babbbcbdbebf"
+	"c0c1c2c3c4c5c6c7c8c9cacbcccdcecfd0d1d2d3d4d5d6d7d8d9dadbdcdddedf"
+	"e0e1e2e3e4e5e6e7e8e9eaebecedeeeff0f1f2f3f4f5f6f7f8f9fafbfcfdfeff";
+
+/* The printable representation of a byte value, where non-printable characters are represented by '.'
+ */
+static const char assorted_output_hexdump_printable_characters[ 256 ] = {
+	'.', '.', '.', '.', '.', '.', '.', '.', '.', '.', '.', '.', '.', '.', '.', '.',
+	'.', '.', '.', '.', '.', '.', '.', '.', '.', '.', '.', '.', '.', '.', '.', '.',
+	' ', '!', '"', '#', '$', '%', '&', '\'', '(', ')', '*', '+', ',', '-', '.', '/',
+	'0', '1', '2', '3', '4', '5', '6', '7', '8', '9', ':', ';', '<', '=', '>', '?',
+	'@', 'A', 'B', 'C', 'D', 'E', 'F', 'G', 'H', 'I', 'J', 'K', 'L', 'M', 'N', 'O',
+	'P', 'Q', 'R', 'S', 'T', 'U', 'V', 'W', 'X', 'Y', 'Z', '[', '\\', ']', '^', '_',
+	'`', 'a', 'b', 'c', 'd', 'e', 'f', 'g', 'h', 'i', 'j', 'k', 'l', 'm', 'n', 'o',
+	'p', 'q', 'r', 's', 't', 'u', 'v', 'w', 'x', 'y', 'z', '{', '|', '}', '~', '.',
+	'.', '.', '.', '.', '.', '.', '.', '.', '.', '.', '.', '.', '.', '.', '.', '.',
+	'.', '.', '.', '.', '.', '.', '.', '.', '.', '.', '.', '.', '.', '.', '.', '.',
+	'.', '.', '.', '.', '.', '.', '.', '.', '.', '.', '.', '.', '.', '.', '.', '.',
+	'.', '.', '.', '.', '.', '.', '.', '.', '.', '.', '.', '.', '.', '.', '.', '.',
+	'.', '.', '.', '.', '.', '.', '.', '.', '.', '.', '.', '.', '.', '.', '.', '.',
+	'.', '.', '.', '.', '.', '.', '.', '.', '.', '.', '.', '.', '.', '.', '.', '.',
+	'.', '.', '.', '.', '.', '.', '.', '.', '.', '.', '.', '.', '.', '.', '.', '.',
+	'.', '.', '.', '.', '.', '.', '.', '.', '.', '.', '.', '.', '.', '.', '.', '.' };
 
 /* Prints the copyright information
  */
@@ -78,3 +169,769 @@ void assorted_output_version_fprint(
 	 VERSION );
 }
 
+/* Retrieves the peak resident memory size of the process in bytes
+ * Returns 1 if successful, 0 if not available or -1 on error
+ */
+int assorted_output_get_peak_memory_size(
+     size64_t *peak_memory_size,
+     libcerror_error_t **error )
+{
+#if defined( HAVE_SYS_RESOURCE_H ) && defined( HAVE_GETRUSAGE )
+	struct rusage resource_usage;
+#endif
+
+	static char *function = "assorted_output_get_peak_memory_size";
+
+	if( peak_memory_size == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid peak memory size.",
+		 function );
+
+		return( -1 );
+	}
+#if defined( HAVE_SYS_RESOURCE_H ) && defined( HAVE_GETRUSAGE )
+	if( getrusage(
+	     RUSAGE_SELF,
+	     &resource_usage ) != 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve resource usage.",
+		 function );
+
+		return( -1 );
+	}
+	/* Mac OS X reports the maximum resident set size in bytes, other systems in KiB
+	 */
+#if defined( __APPLE__ )
+	*peak_memory_size = (size64_t) resource_usage.ru_maxrss;
+#else
+	*peak_memory_size = (size64_t) resource_usage.ru_maxrss * 1024;
+#endif
+	return( 1 );
+#else
+	*peak_memory_size = 0;
+
+	return( 0 );
+#endif
+}
+
+/* Initializes the statistics and starts the statistics timer
+ * The format string is either "text" or "json", if NULL no statistics are collected
+ * Returns 1 if successful or -1 on error
+ */
+int assorted_output_statistics_initialize(
+     const system_character_t *format_string,
+     libcerror_error_t **error )
+{
+	static char *function = "assorted_output_statistics_initialize";
+	size_t string_length  = 0;
+	int format            = ASSORTED_OUTPUT_STATISTICS_FORMAT_NONE;
+
+	if( assorted_output_statistics.format != ASSORTED_OUTPUT_STATISTICS_FORMAT_NONE )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid statistics - already initialized.",
+		 function );
+
+		return( -1 );
+	}
+	if( format_string == NULL )
+	{
+		return( 1 );
+	}
+	string_length = system_string_length(
+	                 format_string );
+
+	if( ( string_length == 4 )
+	 && ( system_string_compare(
+	       format_string,
+	       _SYSTEM_STRING( "text" ),
+	       4 ) == 0 ) )
+	{
+		format = ASSORTED_OUTPUT_STATISTICS_FORMAT_TEXT;
+	}
+	else if( ( string_length == 4 )
+	      && ( system_string_compare(
+	            format_string,
+	            _SYSTEM_STRING( "json" ),
+	            4 ) == 0 ) )
+	{
+		format = ASSORTED_OUTPUT_STATISTICS_FORMAT_JSON;
+	}
+	else
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_UNSUPPORTED_VALUE,
+		 "%s: unsupported statistics format: %" PRIs_SYSTEM ".",
+		 function,
+		 format_string );
+
+		return( -1 );
+	}
+	if( memory_set(
+	     &assorted_output_statistics,
+	     0,
+	     sizeof( assorted_output_statistics_t ) ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear statistics.",
+		 function );
+
+		return( -1 );
+	}
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+	if( libcthreads_mutex_initialize(
+	     &( assorted_output_statistics.mutex ),
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create mutex.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	assorted_output_statistics.format     = format;
+	assorted_output_statistics.start_time = assorted_timer_get_nanoseconds();
+
+	return( 1 );
+}
+
+/* Frees the statistics
+ * Returns 1 if successful or -1 on error
+ */
+int assorted_output_statistics_free(
+     libcerror_error_t **error )
+{
+	static char *function = "assorted_output_statistics_free";
+	int result            = 1;
+
+	if( assorted_output_statistics.format == ASSORTED_OUTPUT_STATISTICS_FORMAT_NONE )
+	{
+		return( 1 );
+	}
+	assorted_output_statistics.format = ASSORTED_OUTPUT_STATISTICS_FORMAT_NONE;
+
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+	if( libcthreads_mutex_free(
+	     &( assorted_output_statistics.mutex ),
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+		 "%s: unable to free mutex.",
+		 function );
+
+		result = -1;
+	}
+#endif
+	return( result );
+}
+
+/* Starts a statistics phase
+ * Returns the start time of the phase or 0 if no statistics are collected
+ */
+uint64_t assorted_output_statistics_start_phase(
+          void )
+{
+	if( assorted_output_statistics.format == ASSORTED_OUTPUT_STATISTICS_FORMAT_NONE )
+	{
+		return( 0 );
+	}
+	return( assorted_timer_get_nanoseconds() );
+}
+
+/* Stops a statistics phase and adds its time and number of bytes to the phase
+ * Phases that overlap, such as reads by multiple threads, are all added
+ */
+void assorted_output_statistics_stop_phase(
+      int phase,
+      uint64_t start_time,
+      size64_t number_of_bytes )
+{
+	uint64_t stop_time = 0;
+
+	if( ( assorted_output_statistics.format == ASSORTED_OUTPUT_STATISTICS_FORMAT_NONE )
+	 || ( start_time == 0 ) )
+	{
+		return;
+	}
+	if( ( phase < 0 )
+	 || ( phase >= ASSORTED_OUTPUT_STATISTICS_NUMBER_OF_PHASES ) )
+	{
+		return;
+	}
+	stop_time = assorted_timer_get_nanoseconds();
+
+	if( stop_time < start_time )
+	{
+		stop_time = start_time;
+	}
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+	if( libcthreads_mutex_grab(
+	     assorted_output_statistics.mutex,
+	     NULL ) != 1 )
+	{
+		return;
+	}
+#endif
+	assorted_output_statistics.phase_times[ phase ]           += stop_time - start_time;
+	assorted_output_statistics.phase_number_of_bytes[ phase ] += number_of_bytes;
+	assorted_output_statistics.phase_number_of_calls[ phase ] += 1;
+
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+	libcthreads_mutex_release(
+	 assorted_output_statistics.mutex,
+	 NULL );
+#endif
+}
+
+/* Prints the statistics as a summary or as a single line JSON object
+ * The compute phase is the elapsed time not spent in the other phases
+ * Returns 1 if successful or -1 on error
+ */
+int assorted_output_statistics_fprint(
+     FILE *stream,
+     const char *program,
+     int result,
+     libcerror_error_t **error )
+{
+	static char *function        = "assorted_output_statistics_fprint";
+	size64_t peak_memory_size    = 0;
+	uint64_t compute_time        = 0;
+	uint64_t elapsed_time        = 0;
+	uint64_t phases_time         = 0;
+	uint64_t throughput          = 0;
+	int has_peak_memory_size     = 0;
+	int phase                    = 0;
+
+	if( assorted_output_statistics.format == ASSORTED_OUTPUT_STATISTICS_FORMAT_NONE )
+	{
+		return( 1 );
+	}
+	if( stream == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid stream.",
+		 function );
+
+		return( -1 );
+	}
+	if( program == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid program.",
+		 function );
+
+		return( -1 );
+	}
+	has_peak_memory_size = assorted_output_get_peak_memory_size(
+	                        &peak_memory_size,
+	                        error );
+
+	if( has_peak_memory_size == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve peak memory size.",
+		 function );
+
+		return( -1 );
+	}
+	elapsed_time = assorted_timer_get_nanoseconds();
+
+	if( elapsed_time > assorted_output_statistics.start_time )
+	{
+		elapsed_time -= assorted_output_statistics.start_time;
+	}
+	else
+	{
+		elapsed_time = 0;
+	}
+	for( phase = 0;
+	     phase < ASSORTED_OUTPUT_STATISTICS_NUMBER_OF_PHASES;
+	     phase++ )
+	{
+		phases_time += assorted_output_statistics.phase_times[ phase ];
+	}
+	/* With multiple threads the phases can overlap and add up to more than the elapsed time
+	 */
+	if( elapsed_time > phases_time )
+	{
+		compute_time = elapsed_time - phases_time;
+	}
+	if( assorted_output_statistics.format == ASSORTED_OUTPUT_STATISTICS_FORMAT_JSON )
+	{
+		fprintf(
+		 stream,
+		 "{\"program\": \"%s\", \"result\": \"%s\", \"elapsed_ns\": %" PRIu64 ", \"phases\": {",
+		 program,
+		 ( result == 1 ) ? "success" : "failure",
+		 elapsed_time );
+
+		for( phase = 0;
+		     phase < ASSORTED_OUTPUT_STATISTICS_NUMBER_OF_PHASES;
+		     phase++ )
+		{
+			fprintf(
+			 stream,
+			 "\"%s\": {\"time_ns\": %" PRIu64 ", \"bytes\": %" PRIu64 ", \"calls\": %" PRIu64 "}, ",
+			 assorted_output_statistics_phase_names[ phase ],
+			 assorted_output_statistics.phase_times[ phase ],
+			 assorted_output_statistics.phase_number_of_bytes[ phase ],
+			 assorted_output_statistics.phase_number_of_calls[ phase ] );
+		}
+		fprintf(
+		 stream,
+		 "\"compute\": {\"time_ns\": %" PRIu64 "}}",
+		 compute_time );
+
+		if( has_peak_memory_size != 0 )
+		{
+			fprintf(
+			 stream,
+			 ", \"peak_memory_size\": %" PRIu64 "",
+			 peak_memory_size );
+		}
+		fprintf(
+		 stream,
+		 "}\n" );
+	}
+	else
+	{
+		fprintf(
+		 stream,
+		 "Statistics:\n" );
+
+		for( phase = 0;
+		     phase < ASSORTED_OUTPUT_STATISTICS_NUMBER_OF_PHASES;
+		     phase++ )
+		{
+			/* The throughput is in bytes per millisecond, which is about kB/s
+			 */
+			throughput = assorted_output_statistics.phase_times[ phase ] / 1000000;
+
+			if( throughput > 0 )
+			{
+				throughput = assorted_output_statistics.phase_number_of_bytes[ phase ] / throughput;
+			}
+			fprintf(
+			 stream,
+			 "\t%-8s: %" PRIu64 ".%03" PRIu64 " ms, %" PRIu64 " bytes in %" PRIu64 " calls",
+			 assorted_output_statistics_phase_names[ phase ],
+			 assorted_output_statistics.phase_times[ phase ] / 1000000,
+			 ( assorted_output_statistics.phase_times[ phase ] / 1000 ) % 1000,
+			 assorted_output_statistics.phase_number_of_bytes[ phase ],
+			 assorted_output_statistics.phase_number_of_calls[ phase ] );
+
+			if( throughput >= 1000 )
+			{
+				fprintf(
+				 stream,
+				 " (%" PRIu64 " MB/s)",
+				 throughput / 1000 );
+			}
+			fprintf(
+			 stream,
+			 "\n" );
+		}
+		fprintf(
+		 stream,
+		 "\t%-8s: %" PRIu64 ".%03" PRIu64 " ms\n",
+		 "compute",
+		 compute_time / 1000000,
+		 ( compute_time / 1000 ) % 1000 );
+
+		fprintf(
+		 stream,
+		 "\t%-8s: %" PRIu64 ".%03" PRIu64 " ms\n",
+		 "elapsed",
+		 elapsed_time / 1000000,
+		 ( elapsed_time / 1000 ) % 1000 );
+
+		if( has_peak_memory_size != 0 )
+		{
+			fprintf(
+			 stream,
+			 "\tpeak memory size: %" PRIu64 " KiB\n",
+			 peak_memory_size / 1024 );
+		}
+	}
+	return( 1 );
+}
+
+/* Parses an unsigned decimal or 0x prefixed hexadecimal value of a hexdump window string
+ * Returns the number of characters parsed or 0 on error
+ */
+static size_t assorted_output_hexdump_window_parse_value(
+               const system_character_t *string,
+               uint64_t *value )
+{
+	uint64_t digit       = 0;
+	size_t string_index  = 0;
+	uint8_t number_base  = 10;
+
+	*value = 0;
+
+	if( ( string[ 0 ] == (system_character_t) '0' )
+	 && ( ( string[ 1 ] == (system_character_t) 'x' )
+	  ||  ( string[ 1 ] == (system_character_t) 'X' ) ) )
+	{
+		number_base  = 16;
+		string_index = 2;
+	}
+	while( string[ string_index ] != 0 )
+	{
+		if( ( string[ string_index ] >= (system_character_t) '0' )
+		 && ( string[ string_index ] <= (system_character_t) '9' ) )
+		{
+			digit = (uint64_t) ( string[ string_index ] - (system_character_t) '0' );
+		}
+		else if( ( number_base == 16 )
+		      && ( string[ string_index ] >= (system_character_t) 'a' )
+		      && ( string[ string_index ] <= (system_character_t) 'f' ) )
+		{
+			digit = (uint64_t) ( string[ string_index ] - (system_character_t) 'a' ) + 10;
+		}
+		else if( ( number_base == 16 )
+		      && ( string[ string_index ] >= (system_character_t) 'A' )
+		      && ( string[ string_index ] <= (system_character_t) 'F' ) )
+		{
+			digit = (uint64_t) ( string[ string_index ] - (system_character_t) 'A' ) + 10;
+		}
+		else
+		{
+			break;
+		}
+		if( *value > ( ( (uint64_t) -1 - digit ) / number_base ) )
+		{
+			return( 0 );
+		}
+		*value = ( *value * number_base ) + digit;
+
+		string_index++;
+	}
+	if( ( string_index == 0 )
+	 || ( ( number_base == 16 )
+	  &&  ( string_index == 2 ) ) )
+	{
+		return( 0 );
+	}
+	return( string_index );
+}
+
+/* Sets the hexdump window from a string formatted as "offset" or "offset:size"
+ * The offset and size are either decimal or 0x prefixed hexadecimal values
+ * Returns 1 if successful or -1 on error
+ */
+int assorted_output_hexdump_window_set(
+     const system_character_t *string,
+     libcerror_error_t **error )
+{
+	static char *function = "assorted_output_hexdump_window_set";
+	size_t string_index   = 0;
+	size_t value_length   = 0;
+	uint64_t offset       = 0;
+	uint64_t size         = (uint64_t) -1;
+
+	if( string == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid string.",
+		 function );
+
+		return( -1 );
+	}
+	value_length = assorted_output_hexdump_window_parse_value(
+	                string,
+	                &offset );
+
+	if( value_length == 0 )
+	{
+		goto on_error;
+	}
+	string_index = value_length;
+
+	if( string[ string_index ] == (system_character_t) ':' )
+	{
+		string_index++;
+
+		value_length = assorted_output_hexdump_window_parse_value(
+		                &( string[ string_index ] ),
+		                &size );
+
+		if( value_length == 0 )
+		{
+			goto on_error;
+		}
+		string_index += value_length;
+	}
+	if( string[ string_index ] != 0 )
+	{
+		goto on_error;
+	}
+	assorted_output_hexdump_window_offset = offset;
+	assorted_output_hexdump_window_size   = size;
+
+	return( 1 );
+
+on_error:
+	libcerror_error_set(
+	 error,
+	 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+	 LIBCERROR_ARGUMENT_ERROR_UNSUPPORTED_VALUE,
+	 "%s: unsupported hexdump window: %" PRIs_SYSTEM ".",
+	 function,
+	 string );
+
+	return( -1 );
+}
+
+/* Prints data as a hexdump of 16 bytes per line
+ * The data offset is the offset of the data relative to the start of the input, which
+ * is printed per line and used to determine the part of the data within the hexdump window
+ * Consecutive identical lines, except for the last line, are collapsed into a single "..." line
+ * Returns 1 if successful or -1 on error
+ */
+int assorted_output_data_fprint(
+     FILE *stream,
+     const uint8_t *data,
+     size_t data_size,
+     uint64_t data_offset,
+     libcerror_error_t **error )
+{
+	char output_buffer[ ASSORTED_OUTPUT_HEXDUMP_BUFFER_SIZE ];
+
+	const char *hexadecimal_pair = NULL;
+	static char *function        = "assorted_output_data_fprint";
+	size_t data_end_offset       = 0;
+	size_t data_start_offset     = 0;
+	size_t line_data_index       = 0;
+	size_t line_data_offset      = 0;
+	size_t line_size             = 0;
+	size_t output_buffer_index   = 0;
+	size_t previous_line_offset  = 0;
+	uint64_t line_offset         = 0;
+	uint64_t window_end_offset   = 0;
+	uint8_t byte_value           = 0;
+	int has_previous_line        = 0;
+	int in_group                 = 0;
+	int offset_digit_index       = 0;
+	int offset_number_of_digits  = 0;
+
+	if( stream == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid stream.",
+		 function );
+
+		return( -1 );
+	}
+	if( data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid data.",
+		 function );
+
+		return( -1 );
+	}
+	if( data_size > (size_t) SSIZE_MAX )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid data size value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	/* Determine the part of the data within the hexdump window
+	 */
+	window_end_offset = assorted_output_hexdump_window_offset + assorted_output_hexdump_window_size;
+
+	if( window_end_offset < assorted_output_hexdump_window_offset )
+	{
+		window_end_offset = (uint64_t) -1;
+	}
+	if( ( data_offset >= window_end_offset )
+	 || ( ( data_offset + data_size ) <= assorted_output_hexdump_window_offset ) )
+	{
+		return( 1 );
+	}
+	if( assorted_output_hexdump_window_offset > data_offset )
+	{
+		data_start_offset = (size_t) ( assorted_output_hexdump_window_offset - data_offset );
+	}
+	data_end_offset = data_size;
+
+	if( ( data_offset + data_size ) > window_end_offset )
+	{
+		data_end_offset = (size_t) ( window_end_offset - data_offset );
+	}
+	offset_number_of_digits = 8;
+
+	if( ( data_offset + data_end_offset ) > (uint64_t) 0xffffffffUL )
+	{
+		offset_number_of_digits = 16;
+	}
+	for( line_data_offset = data_start_offset;
+	     line_data_offset < data_end_offset;
+	     line_data_offset += 16 )
+	{
+		line_size = data_end_offset - line_data_offset;
+
+		if( line_size > 16 )
+		{
+			line_size = 16;
+		}
+		/* A line is collapsed if it is identical to the previous printed line and not the last line
+		 */
+		if( ( has_previous_line != 0 )
+		 && ( line_size == 16 )
+		 && ( ( line_data_offset + 16 ) < data_end_offset )
+		 && ( memory_compare(
+		       &( data[ previous_line_offset ] ),
+		       &( data[ line_data_offset ] ),
+		       16 ) == 0 ) )
+		{
+			if( in_group == 0 )
+			{
+				output_buffer[ output_buffer_index++ ] = '.';
+				output_buffer[ output_buffer_index++ ] = '.';
+				output_buffer[ output_buffer_index++ ] = '.';
+				output_buffer[ output_buffer_index++ ] = '\n';
+
+				in_group = 1;
+			}
+		}
+		else
+		{
+			line_offset = data_offset + line_data_offset;
+
+			output_buffer[ output_buffer_index++ ] = '0';
+			output_buffer[ output_buffer_index++ ] = 'x';
+
+			for( offset_digit_index = offset_number_of_digits - 2;
+			     offset_digit_index >= 0;
+			     offset_digit_index -= 2 )
+			{
+				hexadecimal_pair = &( assorted_output_hexdump_hexadecimal_pairs[ ( ( line_offset >> ( offset_digit_index * 4 ) ) & 0xff ) * 2 ] );
+
+				output_buffer[ output_buffer_index++ ] = hexadecimal_pair[ 0 ];
+				output_buffer[ output_buffer_index++ ] = hexadecimal_pair[ 1 ];
+			}
+			output_buffer[ output_buffer_index++ ] = ' ';
+
+			for( line_data_index = 0;
+			     line_data_index < 16;
+			     line_data_index++ )
+			{
+				if( ( line_data_index % 8 ) == 0 )
+				{
+					output_buffer[ output_buffer_index++ ] = ' ';
+				}
+				if( line_data_index < line_size )
+				{
+					byte_value       = data[ line_data_offset + line_data_index ];
+					hexadecimal_pair = &( assorted_output_hexdump_hexadecimal_pairs[ byte_value * 2 ] );
+
+					output_buffer[ output_buffer_index++ ] = hexadecimal_pair[ 0 ];
+					output_buffer[ output_buffer_index++ ] = hexadecimal_pair[ 1 ];
+				}
+				else
+				{
+					output_buffer[ output_buffer_index++ ] = ' ';
+					output_buffer[ output_buffer_index++ ] = ' ';
+				}
+				output_buffer[ output_buffer_index++ ] = ' ';
+			}
+			output_buffer[ output_buffer_index++ ] = ' ';
+
+			for( line_data_index = 0;
+			     line_data_index < line_size;
+			     line_data_index++ )
+			{
+				byte_value = data[ line_data_offset + line_data_index ];
+
+				output_buffer[ output_buffer_index++ ] = assorted_output_hexdump_printable_characters[ byte_value ];
+			}
+			output_buffer[ output_buffer_index++ ] = '\n';
+
+			has_previous_line    = 1;
+			in_group             = 0;
+			previous_line_offset = line_data_offset;
+		}
+		if( output_buffer_index > ( ASSORTED_OUTPUT_HEXDUMP_BUFFER_SIZE - ASSORTED_OUTPUT_HEXDUMP_MAXIMUM_LINE_SIZE ) )
+		{
+			if( fwrite(
+			     output_buffer,
+			     1,
+			     output_buffer_index,
+			     stream ) != output_buffer_index )
+			{
+				goto on_error;
+			}
+			output_buffer_index = 0;
+		}
+	}
+	output_buffer[ output_buffer_index++ ] = '\n';
+
+	if( fwrite(
+	     output_buffer,
+	     1,
+	     output_buffer_index,
+	     stream ) != output_buffer_index )
+	{
+		goto on_error;
+	}
+	return( 1 );
+
+on_error:
+	libcerror_error_set(
+	 error,
+	 LIBCERROR_ERROR_DOMAIN_IO,
+	 LIBCERROR_IO_ERROR_WRITE_FAILED,
+	 "%s: unable to write hexdump to stream.",
+	 function );
+
+	return( -1 );
+}
+
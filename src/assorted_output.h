@@ -26,10 +26,41 @@
 #include <file_stream.h>
 #include <types.h>
 
+#include "assorted_libcerror.h"
+
 #if defined( __cplusplus )
 extern "C" {
 #endif
 
+/* The statistics output formats
+ */
+enum ASSORTED_OUTPUT_STATISTICS_FORMATS
+{
+	ASSORTED_OUTPUT_STATISTICS_FORMAT_NONE		= 0,
+	ASSORTED_OUTPUT_STATISTICS_FORMAT_TEXT		= 1,
+	ASSORTED_OUTPUT_STATISTICS_FORMAT_JSON		= 2
+};
+
+/* The statistics phases, the time not spent in one of these phases
+ * is reported as the compute phase
+ */
+enum ASSORTED_OUTPUT_STATISTICS_PHASES
+{
+	ASSORTED_OUTPUT_STATISTICS_PHASE_OPEN		= 0,
+	ASSORTED_OUTPUT_STATISTICS_PHASE_READ		= 1,
+	ASSORTED_OUTPUT_STATISTICS_PHASE_WRITE		= 2
+};
+
+#define ASSORTED_OUTPUT_STATISTICS_NUMBER_OF_PHASES	3
+
+/* The size of the buffer used to format a hexdump before it is written
+ */
+#define ASSORTED_OUTPUT_HEXDUMP_BUFFER_SIZE		32768
+
+/* The maximum size of a formatted hexdump line
+ */
+#define ASSORTED_OUTPUT_HEXDUMP_MAXIMUM_LINE_SIZE	96
+
 void assorted_output_copyright_fprint(
       FILE *stream );
 
@@ -37,6 +68,42 @@ void assorted_output_version_fprint(
       FILE *stream,
       const char *program );
 
+int assorted_output_get_peak_memory_size(
+     size64_t *peak_memory_size,
+     libcerror_error_t **error );
+
+int assorted_output_statistics_initialize(
+     const system_character_t *format_string,
+     libcerror_error_t **error );
+
+int assorted_output_statistics_free(
+     libcerror_error_t **error );
+
+uint64_t assorted_output_statistics_start_phase(
+          void );
+
+void assorted_output_statistics_stop_phase(
+      int phase,
+      uint64_t start_time,
+      size64_t number_of_bytes );
+
+int assorted_output_statistics_fprint(
+     FILE *stream,
+     const char *program,
+     int result,
+     libcerror_error_t **error );
+
+int assorted_output_hexdump_window_set(
+     const system_character_t *string,
+     libcerror_error_t **error );
+
+int assorted_output_data_fprint(
+     FILE *stream,
+     const uint8_t *data,
+     size_t data_size,
+     uint64_t data_offset,
+     libcerror_error_t **error );
+
 #if defined( __cplusplus )
 }
 #endif
@@ -0,0 +1,892 @@
+/*
+ * Output file functions
+ *
+ * Copyright (C) 2008-2019, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This software is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This software is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this software.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <memory.h>
+#include <types.h>
+
+#if defined( HAVE_ERRNO_H )
+#include <errno.h>
+#endif
+
+#if defined( HAVE_FCNTL_H )
+#include <fcntl.h>
+#endif
+
+#if defined( HAVE_SYS_STAT_H )
+#include <sys/stat.h>
+#endif
+
+#if defined( HAVE_SYS_MMAN_H )
+#include <sys/mman.h>
+#endif
+
+#if defined( HAVE_UNISTD_H )
+#include <unistd.h>
+#endif
+
+#include "assorted_libcerror.h"
+#include "assorted_libcfile.h"
+#include "assorted_output.h"
+#include "assorted_output_file.h"
+
+#if !defined( O_BINARY )
+#define O_BINARY	0
+#endif
+
+/* Creates an output file
+ * Make sure the value output_file is referencing, is set to NULL
+ * Returns 1 if successful or -1 on error
+ */
+int assorted_output_file_initialize(
+     assorted_output_file_t **output_file,
+     libcerror_error_t **error )
+{
+	static char *function = "assorted_output_file_initialize";
+
+	if( output_file == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid output file.",
+		 function );
+
+		return( -1 );
+	}
+	if( *output_file != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid output file value already set.",
+		 function );
+
+		return( -1 );
+	}
+	*output_file = memory_allocate_structure(
+	                assorted_output_file_t );
+
+	if( *output_file == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create output file.",
+		 function );
+
+		goto on_error;
+	}
+	if( memory_set(
+	     *output_file,
+	     0,
+	     sizeof( assorted_output_file_t ) ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear output file.",
+		 function );
+
+		goto on_error;
+	}
+#if defined( WINAPI )
+	( *output_file )->file_handle    = INVALID_HANDLE_VALUE;
+	( *output_file )->mapping_handle = NULL;
+
+#elif defined( HAVE_ASSORTED_OUTPUT_FILE_MAPPING )
+	( *output_file )->descriptor = -1;
+#endif
+
+	return( 1 );
+
+on_error:
+	if( *output_file != NULL )
+	{
+		memory_free(
+		 *output_file );
+
+		*output_file = NULL;
+	}
+	return( -1 );
+}
+
+/* Frees an output file
+ * The output file is closed if necessary
+ * Returns 1 if successful or -1 on error
+ */
+int assorted_output_file_free(
+     assorted_output_file_t **output_file,
+     libcerror_error_t **error )
+{
+	static char *function = "assorted_output_file_free";
+	int result            = 1;
+
+	if( output_file == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid output file.",
+		 function );
+
+		return( -1 );
+	}
+	if( *output_file != NULL )
+	{
+		if( ( ( *output_file )->file != NULL )
+		 || ( ( *output_file )->mapped_data != NULL ) )
+		{
+			if( assorted_output_file_close(
+			     *output_file,
+			     error ) != 0 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_IO,
+				 LIBCERROR_IO_ERROR_CLOSE_FAILED,
+				 "%s: unable to close output file.",
+				 function );
+
+				result = -1;
+			}
+		}
+		memory_free(
+		 *output_file );
+
+		*output_file = NULL;
+	}
+	return( result );
+}
+
+#if defined( HAVE_ASSORTED_OUTPUT_FILE_MAPPING )
+
+/* Creates a file of the maximum data size and maps it into memory
+ * so that the data can be written, e.g. decompressed, directly into the file
+ * The file is truncated to the size of the data written when it is closed
+ * Returns 1 if successful, 0 if the file cannot be mapped or -1 on error
+ */
+int assorted_output_file_open_mapped(
+     assorted_output_file_t *output_file,
+     const system_character_t *filename,
+     size_t maximum_data_size,
+     libcerror_error_t **error )
+{
+#if defined( WINAPI )
+	LARGE_INTEGER file_size;
+#else
+	struct stat file_statistics;
+#endif
+
+	static char *function = "assorted_output_file_open_mapped";
+
+#if !defined( WINAPI ) && defined( HAVE_POSIX_FALLOCATE )
+	int result            = 0;
+#endif
+
+	if( output_file == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid output file.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( maximum_data_size == 0 )
+	 || ( maximum_data_size > (size_t) SSIZE_MAX ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid maximum data size value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+#if defined( WINAPI )
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+	output_file->file_handle = CreateFileW(
+	                            (LPCWSTR) filename,
+	                            GENERIC_READ | GENERIC_WRITE,
+	                            0,
+	                            NULL,
+	                            CREATE_ALWAYS,
+	                            FILE_ATTRIBUTE_NORMAL,
+	                            NULL );
+#else
+	output_file->file_handle = CreateFileA(
+	                            (LPCSTR) filename,
+	                            GENERIC_READ | GENERIC_WRITE,
+	                            0,
+	                            NULL,
+	                            CREATE_ALWAYS,
+	                            FILE_ATTRIBUTE_NORMAL,
+	                            NULL );
+#endif
+	if( output_file->file_handle == INVALID_HANDLE_VALUE )
+	{
+		return( 0 );
+	}
+	/* Only regular files can be mapped, devices and pipes are written buffered
+	 */
+	if( GetFileType(
+	     output_file->file_handle ) != FILE_TYPE_DISK )
+	{
+		goto on_error;
+	}
+	file_size.QuadPart = (LONGLONG) maximum_data_size;
+
+	/* Creating the mapping extends the file to the maximum data size
+	 */
+	output_file->mapping_handle = CreateFileMapping(
+	                               output_file->file_handle,
+	                               NULL,
+	                               PAGE_READWRITE,
+	                               (DWORD) file_size.HighPart,
+	                               (DWORD) file_size.LowPart,
+	                               NULL );
+
+	if( output_file->mapping_handle == NULL )
+	{
+		goto on_error;
+	}
+	output_file->mapped_data = (uint8_t *) MapViewOfFile(
+	                                        output_file->mapping_handle,
+	                                        FILE_MAP_WRITE,
+	                                        0,
+	                                        0,
+	                                        0 );
+
+	if( output_file->mapped_data == NULL )
+	{
+		goto on_error;
+	}
+#else
+	output_file->descriptor = open(
+	                           (char *) filename,
+	                           O_RDWR | O_CREAT | O_TRUNC | O_BINARY,
+	                           0644 );
+
+	if( output_file->descriptor == -1 )
+	{
+		return( 0 );
+	}
+	/* Only regular files can be mapped, devices and pipes are written buffered
+	 */
+	if( ( fstat(
+	       output_file->descriptor,
+	       &file_statistics ) != 0 )
+	 || ( S_ISREG( file_statistics.st_mode ) == 0 ) )
+	{
+		goto on_error;
+	}
+#if defined( HAVE_POSIX_FALLOCATE )
+	/* Preallocate the file so that running out of space is detected here
+	 * instead of when a page of the mapped data is written back
+	 */
+	result = posix_fallocate(
+	          output_file->descriptor,
+	          0,
+	          (off_t) maximum_data_size );
+
+	if( result == ENOSPC )
+	{
+		goto on_error;
+	}
+	else if( result != 0 )
+#endif
+	{
+		if( ftruncate(
+		     output_file->descriptor,
+		     (off_t) maximum_data_size ) != 0 )
+		{
+			goto on_error;
+		}
+	}
+	output_file->mapped_data = (uint8_t *) mmap(
+	                                        NULL,
+	                                        maximum_data_size,
+	                                        PROT_READ | PROT_WRITE,
+	                                        MAP_SHARED,
+	                                        output_file->descriptor,
+	                                        0 );
+
+	if( output_file->mapped_data == (uint8_t *) MAP_FAILED )
+	{
+		output_file->mapped_data = NULL;
+
+		goto on_error;
+	}
+#endif /* defined( WINAPI ) */
+
+	output_file->mapped_data_size = maximum_data_size;
+	output_file->data_size        = 0;
+
+	return( 1 );
+
+on_error:
+#if defined( WINAPI )
+	if( output_file->mapping_handle != NULL )
+	{
+		CloseHandle(
+		 output_file->mapping_handle );
+
+		output_file->mapping_handle = NULL;
+	}
+	CloseHandle(
+	 output_file->file_handle );
+
+	output_file->file_handle = INVALID_HANDLE_VALUE;
+#else
+	close(
+	 output_file->descriptor );
+
+	output_file->descriptor = -1;
+#endif
+	return( 0 );
+}
+
+#endif /* defined( HAVE_ASSORTED_OUTPUT_FILE_MAPPING ) */
+
+/* Opens an output file
+ * If the maximum data size is known the file is mapped into memory if supported,
+ * otherwise the data is written buffered
+ * Returns 1 if successful or -1 on error
+ */
+int assorted_output_file_open(
+     assorted_output_file_t *output_file,
+     const system_character_t *filename,
+     size_t maximum_data_size,
+     libcerror_error_t **error )
+{
+	static char *function = "assorted_output_file_open";
+	uint64_t start_time   = 0;
+	int result            = 0;
+
+	if( output_file == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid output file.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( output_file->file != NULL )
+	 || ( output_file->mapped_data != NULL ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid output file - already open.",
+		 function );
+
+		return( -1 );
+	}
+	if( filename == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid filename.",
+		 function );
+
+		return( -1 );
+	}
+	start_time = assorted_output_statistics_start_phase();
+
+#if defined( HAVE_ASSORTED_OUTPUT_FILE_MAPPING )
+	if( ( maximum_data_size > 0 )
+	 && ( maximum_data_size <= (size_t) SSIZE_MAX ) )
+	{
+		result = assorted_output_file_open_mapped(
+		          output_file,
+		          filename,
+		          maximum_data_size,
+		          error );
+
+		if( result == -1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_OPEN_FAILED,
+			 "%s: unable to map file.",
+			 function );
+
+			return( -1 );
+		}
+		else if( result != 0 )
+		{
+			assorted_output_statistics_stop_phase(
+			 ASSORTED_OUTPUT_STATISTICS_PHASE_OPEN,
+			 start_time,
+			 0 );
+
+			return( 1 );
+		}
+	}
+#endif
+	if( libcfile_file_initialize(
+	     &( output_file->file ),
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create file.",
+		 function );
+
+		goto on_error;
+	}
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+	result = libcfile_file_open_wide(
+	          output_file->file,
+	          filename,
+	          LIBCFILE_OPEN_WRITE,
+	          error );
+#else
+	result = libcfile_file_open(
+	          output_file->file,
+	          filename,
+	          LIBCFILE_OPEN_WRITE,
+	          error );
+#endif
+	if( result != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_OPEN_FAILED,
+		 "%s: unable to open file.",
+		 function );
+
+		goto on_error;
+	}
+	output_file->data_size = 0;
+
+	assorted_output_statistics_stop_phase(
+	 ASSORTED_OUTPUT_STATISTICS_PHASE_OPEN,
+	 start_time,
+	 0 );
+
+	return( 1 );
+
+on_error:
+	if( output_file->file != NULL )
+	{
+		libcfile_file_free(
+		 &( output_file->file ),
+		 NULL );
+	}
+	return( -1 );
+}
+
+/* Closes an output file
+ * A mapped file is truncated to the size of the data written
+ * Returns 0 if successful or -1 on error
+ */
+int assorted_output_file_close(
+     assorted_output_file_t *output_file,
+     libcerror_error_t **error )
+{
+#if defined( WINAPI ) && defined( HAVE_ASSORTED_OUTPUT_FILE_MAPPING )
+	LARGE_INTEGER file_offset;
+#endif
+
+	static char *function = "assorted_output_file_close";
+	uint64_t start_time   = 0;
+	int result            = 0;
+
+	if( output_file == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid output file.",
+		 function );
+
+		return( -1 );
+	}
+	/* Closing the file writes back the mapped data or flushes the buffered data
+	 */
+	start_time = assorted_output_statistics_start_phase();
+
+#if defined( HAVE_ASSORTED_OUTPUT_FILE_MAPPING )
+	if( output_file->mapped_data != NULL )
+	{
+#if defined( WINAPI )
+		file_offset.QuadPart = (LONGLONG) output_file->data_size;
+
+		if( ( UnmapViewOfFile(
+		       output_file->mapped_data ) == 0 )
+		 || ( CloseHandle(
+		       output_file->mapping_handle ) == 0 ) )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_CLOSE_FAILED,
+			 "%s: unable to unmap file.",
+			 function );
+
+			result = -1;
+		}
+		else if( ( SetFilePointerEx(
+		            output_file->file_handle,
+		            file_offset,
+		            NULL,
+		            FILE_BEGIN ) == 0 )
+		      || ( SetEndOfFile(
+		            output_file->file_handle ) == 0 ) )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_RESIZE_FAILED,
+			 "%s: unable to truncate file.",
+			 function );
+
+			result = -1;
+		}
+		if( CloseHandle(
+		     output_file->file_handle ) == 0 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_CLOSE_FAILED,
+			 "%s: unable to close file.",
+			 function );
+
+			result = -1;
+		}
+		output_file->mapping_handle = NULL;
+		output_file->file_handle    = INVALID_HANDLE_VALUE;
+#else
+		if( munmap(
+		     (void *) output_file->mapped_data,
+		     output_file->mapped_data_size ) != 0 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_CLOSE_FAILED,
+			 "%s: unable to unmap file.",
+			 function );
+
+			result = -1;
+		}
+		else if( ftruncate(
+		          output_file->descriptor,
+		          (off_t) output_file->data_size ) != 0 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_RESIZE_FAILED,
+			 "%s: unable to truncate file.",
+			 function );
+
+			result = -1;
+		}
+		if( close(
+		     output_file->descriptor ) != 0 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_CLOSE_FAILED,
+			 "%s: unable to close file.",
+			 function );
+
+			result = -1;
+		}
+		output_file->descriptor = -1;
+#endif
+		output_file->mapped_data      = NULL;
+		output_file->mapped_data_size = 0;
+	}
+#endif /* defined( HAVE_ASSORTED_OUTPUT_FILE_MAPPING ) */
+
+	if( output_file->file != NULL )
+	{
+		if( libcfile_file_close(
+		     output_file->file,
+		     error ) != 0 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_CLOSE_FAILED,
+			 "%s: unable to close file.",
+			 function );
+
+			result = -1;
+		}
+		if( libcfile_file_free(
+		     &( output_file->file ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free file.",
+			 function );
+
+			result = -1;
+		}
+	}
+	output_file->data_size = 0;
+
+	assorted_output_statistics_stop_phase(
+	 ASSORTED_OUTPUT_STATISTICS_PHASE_WRITE,
+	 start_time,
+	 0 );
+
+	return( result );
+}
+
+/* Determines if the output file is mapped into memory
+ * Returns 1 if mapped, 0 if not or -1 on error
+ */
+int assorted_output_file_is_mapped(
+     assorted_output_file_t *output_file,
+     libcerror_error_t **error )
+{
+	static char *function = "assorted_output_file_is_mapped";
+
+	if( output_file == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid output file.",
+		 function );
+
+		return( -1 );
+	}
+	if( output_file->mapped_data != NULL )
+	{
+		return( 1 );
+	}
+	return( 0 );
+}
+
+/* Retrieves the mapped data of the output file
+ * Data that is written into the mapped data is passed back to
+ * assorted_output_file_write_data, which then does not copy it
+ * Returns 1 if successful, 0 if the output file is not mapped or -1 on error
+ */
+int assorted_output_file_get_mapped_data(
+     assorted_output_file_t *output_file,
+     uint8_t **data,
+     size_t *data_size,
+     libcerror_error_t **error )
+{
+	static char *function = "assorted_output_file_get_mapped_data";
+
+	if( output_file == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid output file.",
+		 function );
+
+		return( -1 );
+	}
+	if( data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid data.",
+		 function );
+
+		return( -1 );
+	}
+	if( data_size == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid data size.",
+		 function );
+
+		return( -1 );
+	}
+	if( output_file->mapped_data == NULL )
+	{
+		return( 0 );
+	}
+	*data      = &( output_file->mapped_data[ output_file->data_size ] );
+	*data_size = output_file->mapped_data_size - output_file->data_size;
+
+	return( 1 );
+}
+
+/* Writes data to the output file
+ * If the data was written into the mapped data it is not copied
+ * Returns the number of bytes written or -1 on error
+ */
+ssize_t assorted_output_file_write_data(
+         assorted_output_file_t *output_file,
+         const uint8_t *data,
+         size_t size,
+         libcerror_error_t **error )
+{
+	static char *function = "assorted_output_file_write_data";
+	uint64_t start_time   = 0;
+	ssize_t write_count   = 0;
+
+	if( output_file == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid output file.",
+		 function );
+
+		return( -1 );
+	}
+	if( data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid data.",
+		 function );
+
+		return( -1 );
+	}
+	if( size > (size_t) SSIZE_MAX )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid size value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	start_time = assorted_output_statistics_start_phase();
+
+	if( output_file->mapped_data != NULL )
+	{
+		if( size > ( output_file->mapped_data_size - output_file->data_size ) )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+			 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+			 "%s: invalid size value out of bounds.",
+			 function );
+
+			return( -1 );
+		}
+		if( data != &( output_file->mapped_data[ output_file->data_size ] ) )
+		{
+			if( memory_copy(
+			     &( output_file->mapped_data[ output_file->data_size ] ),
+			     data,
+			     size ) == NULL )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_MEMORY,
+				 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+				 "%s: unable to copy data to mapped data.",
+				 function );
+
+				return( -1 );
+			}
+		}
+		output_file->data_size += size;
+
+		assorted_output_statistics_stop_phase(
+		 ASSORTED_OUTPUT_STATISTICS_PHASE_WRITE,
+		 start_time,
+		 (size64_t) size );
+
+		return( (ssize_t) size );
+	}
+	if( output_file->file == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid output file - not open.",
+		 function );
+
+		return( -1 );
+	}
+	write_count = libcfile_file_write_buffer(
+	               output_file->file,
+	               data,
+	               size,
+	               error );
+
+	if( write_count != (ssize_t) size )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_WRITE_FAILED,
+		 "%s: unable to write data.",
+		 function );
+
+		return( -1 );
+	}
+	output_file->data_size += size;
+
+	assorted_output_statistics_stop_phase(
+	 ASSORTED_OUTPUT_STATISTICS_PHASE_WRITE,
+	 start_time,
+	 (size64_t) write_count );
+
+	return( write_count );
+}
+
@@ -0,0 +1,124 @@
+/*
+ * Output file functions
+ *
+ * Copyright (C) 2008-2019, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This software is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This software is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this software.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#if !defined( _ASSORTED_OUTPUT_FILE_H )
+#define _ASSORTED_OUTPUT_FILE_H
+
+#include <common.h>
+#include <types.h>
+
+#include "assorted_libcerror.h"
+#include "assorted_libcfile.h"
+
+#if defined( __cplusplus )
+extern "C" {
+#endif
+
+#if defined( WINAPI ) || ( defined( HAVE_MMAP ) && defined( HAVE_FTRUNCATE ) && !defined( HAVE_WIDE_SYSTEM_CHARACTER ) )
+#define HAVE_ASSORTED_OUTPUT_FILE_MAPPING
+#endif
+
+typedef struct assorted_output_file assorted_output_file_t;
+
+struct assorted_output_file
+{
+	/* The file used for buffered writes
+	 */
+	libcfile_file_t *file;
+
+#if defined( WINAPI )
+	/* The file handle of the mapped file
+	 */
+	HANDLE file_handle;
+
+	/* The file mapping handle
+	 */
+	HANDLE mapping_handle;
+
+#elif defined( HAVE_ASSORTED_OUTPUT_FILE_MAPPING )
+	/* The file descriptor of the mapped file
+	 */
+	int descriptor;
+#endif
+
+	/* The mapped data
+	 */
+	uint8_t *mapped_data;
+
+	/* The mapped data size
+	 */
+	size_t mapped_data_size;
+
+	/* The size of the data written
+	 */
+	size_t data_size;
+};
+
+int assorted_output_file_initialize(
+     assorted_output_file_t **output_file,
+     libcerror_error_t **error );
+
+int assorted_output_file_free(
+     assorted_output_file_t **output_file,
+     libcerror_error_t **error );
+
+#if defined( HAVE_ASSORTED_OUTPUT_FILE_MAPPING )
+
+int assorted_output_file_open_mapped(
+     assorted_output_file_t *output_file,
+     const system_character_t *filename,
+     size_t maximum_data_size,
+     libcerror_error_t **error );
+
+#endif /* defined( HAVE_ASSORTED_OUTPUT_FILE_MAPPING ) */
+
+int assorted_output_file_open(
+     assorted_output_file_t *output_file,
+     const system_character_t *filename,
+     size_t maximum_data_size,
+     libcerror_error_t **error );
+
+int assorted_output_file_close(
+     assorted_output_file_t *output_file,
+     libcerror_error_t **error );
+
+int assorted_output_file_is_mapped(
+     assorted_output_file_t *output_file,
+     libcerror_error_t **error );
+
+int assorted_output_file_get_mapped_data(
+     assorted_output_file_t *output_file,
+     uint8_t **data,
+     size_t *data_size,
+     libcerror_error_t **error );
+
+ssize_t assorted_output_file_write_data(
+         assorted_output_file_t *output_file,
+         const uint8_t *data,
+         size_t size,
+         libcerror_error_t **error );
+
+#if defined( __cplusplus )
+}
+#endif
+
+#endif /* !defined( _ASSORTED_OUTPUT_FILE_H ) */
+
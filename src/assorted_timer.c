@@ -0,0 +1,113 @@
+/*
+ * Timer functions for the assorted
+ *
+ * Copyright (C) 2008-2019, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This software is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This software is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this software.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <types.h>
+
+#if defined( HAVE_SYS_TIME_H )
+#include <sys/time.h>
+#endif
+
+#if defined( HAVE_TIME_H ) || defined( WINAPI )
+#include <time.h>
+#endif
+
+#include "assorted_timer.h"
+#include "cpu_features.h"
+
+#if defined( HAVE_CPU_FEATURES_X86 )
+#if defined( _MSC_VER )
+#include <intrin.h>
+#else
+#include <x86intrin.h>
+#endif
+#endif
+
+/* Retrieves the current value of a monotonic clock in nanoseconds
+ * The value is only meaningful relative to another value of the same clock
+ * Returns the number of nanoseconds
+ */
+uint64_t assorted_timer_get_nanoseconds(
+          void )
+{
+#if defined( WINAPI )
+	LARGE_INTEGER counter;
+	LARGE_INTEGER frequency;
+
+	uint64_t nanoseconds = 0;
+
+	if( ( QueryPerformanceFrequency(
+	       &frequency ) == 0 )
+	 || ( QueryPerformanceCounter(
+	       &counter ) == 0 ) )
+	{
+		return( (uint64_t) GetTickCount() * 1000000 );
+	}
+	/* Split the calculation to prevent the multiplication from overflowing
+	 */
+	nanoseconds  = ( (uint64_t) counter.QuadPart / (uint64_t) frequency.QuadPart ) * 1000000000UL;
+	nanoseconds += ( ( (uint64_t) counter.QuadPart % (uint64_t) frequency.QuadPart ) * 1000000000UL ) / (uint64_t) frequency.QuadPart;
+
+	return( nanoseconds );
+
+#elif defined( HAVE_CLOCK_GETTIME ) && defined( CLOCK_MONOTONIC )
+	struct timespec time_value;
+
+	if( clock_gettime(
+	     CLOCK_MONOTONIC,
+	     &time_value ) != 0 )
+	{
+		return( 0 );
+	}
+	return( ( (uint64_t) time_value.tv_sec * 1000000000UL ) + (uint64_t) time_value.tv_nsec );
+
+#elif defined( HAVE_GETTIMEOFDAY )
+	struct timeval time_value;
+
+	if( gettimeofday(
+	     &time_value,
+	     NULL ) != 0 )
+	{
+		return( 0 );
+	}
+	return( ( (uint64_t) time_value.tv_sec * 1000000000UL ) + ( (uint64_t) time_value.tv_usec * 1000 ) );
+
+#else
+	return( ( (uint64_t) clock() * 1000000000UL ) / CLOCKS_PER_SEC );
+
+#endif
+}
+
+/* Retrieves the current value of the CPU time stamp counter
+ * Note that on modern CPUs the time stamp counter runs at a constant rate
+ * that can differ from the actual core clock
+ * Returns the number of cycles or 0 if not supported
+ */
+uint64_t assorted_timer_get_cycles(
+          void )
+{
+#if defined( HAVE_CPU_FEATURES_X86 )
+	return( (uint64_t) __rdtsc() );
+#else
+	return( 0 );
+#endif
+}
+
@@ -0,0 +1,1388 @@
+/*
+ * Worker pool functions for the assorted
+ *
+ * Copyright (C) 2008-2019, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This software is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This software is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this software.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+/* CPU_SET and sched_setaffinity are only defined by glibc if _GNU_SOURCE is defined
+ */
+#if defined( __linux__ ) && !defined( _GNU_SOURCE )
+#define _GNU_SOURCE
+#endif
+
+#include <common.h>
+#include <memory.h>
+#include <narrow_string.h>
+#include <types.h>
+
+#if defined( HAVE_SCHED_H )
+#include <sched.h>
+#endif
+
+#if defined( HAVE_UNISTD_H )
+#include <unistd.h>
+#endif
+
+#include "assorted_libcerror.h"
+#include "assorted_libcthreads.h"
+#include "assorted_worker_pool.h"
+
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+
+#if defined( WINAPI ) && ( WINVER >= 0x0600 )
+#define HAVE_ASSORTED_WORKER_POOL_CPU_AFFINITY
+
+/* The maximum number of CPUs of a processor group
+ */
+#define ASSORTED_WORKER_POOL_MAXIMUM_NUMBER_OF_CPUS	( 8 * sizeof( DWORD_PTR ) )
+
+#elif defined( __linux__ ) && defined( HAVE_SCHED_GETAFFINITY ) && defined( HAVE_SCHED_SETAFFINITY ) && defined( CPU_SETSIZE )
+#define HAVE_ASSORTED_WORKER_POOL_CPU_AFFINITY
+
+#define ASSORTED_WORKER_POOL_MAXIMUM_NUMBER_OF_CPUS	CPU_SETSIZE
+
+/* The maximum number of NUMA nodes that is looked for
+ */
+#define ASSORTED_WORKER_POOL_MAXIMUM_NUMBER_OF_NODES	64
+#endif
+
+#if defined( HAVE_ASSORTED_WORKER_POOL_CPU_AFFINITY )
+
+/* Retrieves the CPUs the process is allowed to run on
+ * Returns 1 if successful, 0 if not available or -1 on error
+ */
+static int assorted_worker_pool_get_cpu_numbers(
+            int *cpu_numbers,
+            int maximum_number_of_cpus,
+            int *number_of_cpus )
+{
+#if defined( WINAPI )
+	DWORD_PTR process_affinity_mask = 0;
+	DWORD_PTR system_affinity_mask  = 0;
+#else
+	cpu_set_t cpu_set;
+#endif
+	int cpu_number                  = 0;
+
+	if( ( cpu_numbers == NULL )
+	 || ( maximum_number_of_cpus <= 0 )
+	 || ( number_of_cpus == NULL ) )
+	{
+		return( -1 );
+	}
+	*number_of_cpus = 0;
+
+#if defined( WINAPI )
+	if( GetProcessAffinityMask(
+	     GetCurrentProcess(),
+	     &process_affinity_mask,
+	     &system_affinity_mask ) == 0 )
+	{
+		return( 0 );
+	}
+	for( cpu_number = 0;
+	     cpu_number < (int) ASSORTED_WORKER_POOL_MAXIMUM_NUMBER_OF_CPUS;
+	     cpu_number++ )
+	{
+		if( ( process_affinity_mask & ( (DWORD_PTR) 1 << cpu_number ) ) != 0 )
+		{
+			if( *number_of_cpus >= maximum_number_of_cpus )
+			{
+				break;
+			}
+			cpu_numbers[ *number_of_cpus ] = cpu_number;
+
+			*number_of_cpus += 1;
+		}
+	}
+#else
+	CPU_ZERO(
+	 &cpu_set );
+
+	if( sched_getaffinity(
+	     0,
+	     sizeof( cpu_set_t ),
+	     &cpu_set ) != 0 )
+	{
+		return( 0 );
+	}
+	for( cpu_number = 0;
+	     cpu_number < CPU_SETSIZE;
+	     cpu_number++ )
+	{
+		if( CPU_ISSET(
+		     cpu_number,
+		     &cpu_set ) )
+		{
+			if( *number_of_cpus >= maximum_number_of_cpus )
+			{
+				break;
+			}
+			cpu_numbers[ *number_of_cpus ] = cpu_number;
+
+			*number_of_cpus += 1;
+		}
+	}
+#endif
+	if( *number_of_cpus == 0 )
+	{
+		return( 0 );
+	}
+	return( 1 );
+}
+
+/* Binds the calling thread to a CPU
+ * Returns 1 if successful or -1 on error
+ */
+static int assorted_worker_pool_bind_thread(
+            int cpu_number )
+{
+#if !defined( WINAPI )
+	cpu_set_t cpu_set;
+#endif
+
+	if( ( cpu_number < 0 )
+	 || ( cpu_number >= (int) ASSORTED_WORKER_POOL_MAXIMUM_NUMBER_OF_CPUS ) )
+	{
+		return( -1 );
+	}
+#if defined( WINAPI )
+	if( SetThreadAffinityMask(
+	     GetCurrentThread(),
+	     (DWORD_PTR) 1 << cpu_number ) == 0 )
+	{
+		return( -1 );
+	}
+#else
+	CPU_ZERO(
+	 &cpu_set );
+
+	CPU_SET(
+	 cpu_number,
+	 &cpu_set );
+
+	/* A thread identifier of 0 refers to the calling thread
+	 */
+	if( sched_setaffinity(
+	     0,
+	     sizeof( cpu_set_t ),
+	     &cpu_set ) != 0 )
+	{
+		return( -1 );
+	}
+#endif
+	return( 1 );
+}
+
+/* Determines the NUMA node of a CPU
+ * Returns the node number or 0 if not available
+ */
+static int assorted_worker_pool_get_node_number(
+            int cpu_number )
+{
+#if defined( WINAPI )
+	UCHAR node_number = 0;
+
+	if( GetNumaProcessorNode(
+	     (UCHAR) cpu_number,
+	     &node_number ) == 0 )
+	{
+		return( 0 );
+	}
+	return( (int) node_number );
+#else
+	char path[ 64 ];
+
+	int node_number = 0;
+
+	/* The sysfs directory of a CPU contains a link to its node
+	 */
+	for( node_number = 0;
+	     node_number < ASSORTED_WORKER_POOL_MAXIMUM_NUMBER_OF_NODES;
+	     node_number++ )
+	{
+		if( narrow_string_snprintf(
+		     path,
+		     64,
+		     "/sys/devices/system/cpu/cpu%d/node%d",
+		     cpu_number,
+		     node_number ) < 0 )
+		{
+			break;
+		}
+		if( access(
+		     path,
+		     F_OK ) == 0 )
+		{
+			return( node_number );
+		}
+	}
+	return( 0 );
+#endif
+}
+
+#endif /* defined( HAVE_ASSORTED_WORKER_POOL_CPU_AFFINITY ) */
+
+/* Pushes a task onto the queue of a worker
+ * Returns 1 if successful or -1 on error
+ */
+static int assorted_worker_pool_worker_push_task(
+            assorted_worker_pool_worker_t *worker,
+            assorted_worker_pool_task_t *task,
+            libcerror_error_t **error )
+{
+	assorted_worker_pool_task_t *tasks = NULL;
+	static char *function              = "assorted_worker_pool_worker_push_task";
+	int maximum_number_of_tasks        = 0;
+	int task_index                     = 0;
+	int result                         = 1;
+
+	if( libcthreads_mutex_grab(
+	     worker->mutex,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab mutex.",
+		 function );
+
+		return( -1 );
+	}
+	if( worker->number_of_tasks >= worker->maximum_number_of_tasks )
+	{
+		maximum_number_of_tasks = worker->maximum_number_of_tasks * 2;
+
+		tasks = (assorted_worker_pool_task_t *) memory_allocate(
+		                                         sizeof( assorted_worker_pool_task_t ) * maximum_number_of_tasks );
+
+		if( tasks == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+			 "%s: unable to create tasks.",
+			 function );
+
+			result = -1;
+		}
+		else
+		{
+			/* Unwrap the circular buffer when copying the tasks
+			 */
+			for( task_index = 0;
+			     task_index < worker->number_of_tasks;
+			     task_index++ )
+			{
+				tasks[ task_index ] = worker->tasks[ ( worker->first_task_index + task_index ) % worker->maximum_number_of_tasks ];
+			}
+			memory_free(
+			 worker->tasks );
+
+			worker->tasks                   = tasks;
+			worker->maximum_number_of_tasks = maximum_number_of_tasks;
+			worker->first_task_index        = 0;
+		}
+	}
+	if( result == 1 )
+	{
+		task_index = ( worker->first_task_index + worker->number_of_tasks ) % worker->maximum_number_of_tasks;
+
+		worker->tasks[ task_index ] = *task;
+
+		worker->number_of_tasks += 1;
+	}
+	if( libcthreads_mutex_release(
+	     worker->mutex,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release mutex.",
+		 function );
+
+		return( -1 );
+	}
+	return( result );
+}
+
+/* Takes a task from the queue of a worker
+ * The owner takes the most recent task, other workers steal the oldest task
+ * Returns 1 if successful, 0 if the queue is empty or -1 on error
+ */
+static int assorted_worker_pool_worker_take_task(
+            assorted_worker_pool_worker_t *worker,
+            assorted_worker_pool_task_t *task,
+            uint8_t steal )
+{
+	int result     = 0;
+	int task_index = 0;
+
+	if( libcthreads_mutex_grab(
+	     worker->mutex,
+	     NULL ) != 1 )
+	{
+		return( -1 );
+	}
+	if( worker->number_of_tasks > 0 )
+	{
+		if( steal != 0 )
+		{
+			task_index = worker->first_task_index;
+
+			worker->first_task_index = ( worker->first_task_index + 1 ) % worker->maximum_number_of_tasks;
+		}
+		else
+		{
+			task_index = ( worker->first_task_index + worker->number_of_tasks - 1 ) % worker->maximum_number_of_tasks;
+		}
+		*task = worker->tasks[ task_index ];
+
+		worker->number_of_tasks -= 1;
+
+		result = 1;
+	}
+	if( libcthreads_mutex_release(
+	     worker->mutex,
+	     NULL ) != 1 )
+	{
+		return( -1 );
+	}
+	return( result );
+}
+
+/* Finds a task for a worker, from its own queue or stolen from another worker
+ * Workers on the same NUMA node are stolen from before workers on other nodes
+ * Returns 1 if successful, 0 if no task was found or -1 on error
+ */
+static int assorted_worker_pool_worker_find_task(
+            assorted_worker_pool_worker_t *worker,
+            assorted_worker_pool_task_t *task )
+{
+	assorted_worker_pool_t *pool         = NULL;
+	assorted_worker_pool_worker_t *other = NULL;
+	int other_index                      = 0;
+	int pass                             = 0;
+	int result                           = 0;
+
+	pool = worker->pool;
+
+	result = assorted_worker_pool_worker_take_task(
+	          worker,
+	          task,
+	          0 );
+
+	for( pass = 0;
+	     ( result == 0 ) && ( pass < 2 );
+	     pass++ )
+	{
+		for( other_index = 1;
+		     ( result == 0 ) && ( other_index < pool->number_of_workers );
+		     other_index++ )
+		{
+			other = &( pool->workers[ ( worker->worker_index + other_index ) % pool->number_of_workers ] );
+
+			if( ( pass == 0 ) != ( other->node_number == worker->node_number ) )
+			{
+				continue;
+			}
+			result = assorted_worker_pool_worker_take_task(
+			          other,
+			          task,
+			          1 );
+		}
+	}
+	return( result );
+}
+
+/* Runs the tasks of a worker, used as the callback function of a thread
+ * Returns 1 if successful or -1 on error
+ */
+static int assorted_worker_pool_worker_run(
+            void *arguments )
+{
+	assorted_worker_pool_task_t task;
+
+	assorted_worker_pool_t *pool          = NULL;
+	assorted_worker_pool_worker_t *worker = NULL;
+	int result                            = 1;
+	int task_result                       = 0;
+	uint8_t stop                          = 0;
+
+	if( arguments == NULL )
+	{
+		return( -1 );
+	}
+	worker = (assorted_worker_pool_worker_t *) arguments;
+	pool   = worker->pool;
+
+#if defined( HAVE_ASSORTED_WORKER_POOL_CPU_AFFINITY )
+	if( worker->cpu_number >= 0 )
+	{
+		if( assorted_worker_pool_bind_thread(
+		     worker->cpu_number ) == 1 )
+		{
+			worker->node_number = assorted_worker_pool_get_node_number(
+			                       worker->cpu_number );
+		}
+		else
+		{
+			worker->cpu_number = -1;
+		}
+	}
+#endif
+	/* The buffer is allocated and cleared by the worker once it is bound
+	 * so that on first touch the pages are placed on its NUMA node
+	 */
+	if( pool->buffer_size > 0 )
+	{
+		worker->buffer = (uint8_t *) memory_allocate(
+		                              sizeof( uint8_t ) * pool->buffer_size );
+
+		if( worker->buffer == NULL )
+		{
+			result = -1;
+		}
+		else if( memory_set(
+		          worker->buffer,
+		          0,
+		          pool->buffer_size ) == NULL )
+		{
+			result = -1;
+		}
+	}
+	if( libcthreads_mutex_grab(
+	     pool->mutex,
+	     NULL ) != 1 )
+	{
+		return( -1 );
+	}
+	if( result == 1 )
+	{
+		pool->number_of_ready_workers += 1;
+	}
+	else
+	{
+		pool->number_of_failed_workers += 1;
+	}
+	libcthreads_condition_broadcast(
+	 pool->done_condition,
+	 NULL );
+
+	libcthreads_condition_broadcast(
+	 pool->task_condition,
+	 NULL );
+
+	/* Wait for the other workers so that their NUMA node is known before stealing
+	 */
+	while( ( result == 1 )
+	    && ( ( pool->number_of_ready_workers + pool->number_of_failed_workers ) < pool->number_of_workers )
+	    && ( pool->stop == 0 ) )
+	{
+		if( libcthreads_condition_wait(
+		     pool->task_condition,
+		     pool->mutex,
+		     NULL ) != 1 )
+		{
+			result = -1;
+		}
+	}
+	if( libcthreads_mutex_release(
+	     pool->mutex,
+	     NULL ) != 1 )
+	{
+		return( -1 );
+	}
+	if( result != 1 )
+	{
+		return( -1 );
+	}
+	while( stop == 0 )
+	{
+		result = assorted_worker_pool_worker_find_task(
+		          worker,
+		          &task );
+
+		if( result == -1 )
+		{
+			return( -1 );
+		}
+		if( libcthreads_mutex_grab(
+		     pool->mutex,
+		     NULL ) != 1 )
+		{
+			return( -1 );
+		}
+		if( result == 1 )
+		{
+			pool->number_of_queued_tasks -= 1;
+		}
+		else
+		{
+			while( ( pool->number_of_queued_tasks == 0 )
+			    && ( pool->stop == 0 ) )
+			{
+				if( libcthreads_condition_wait(
+				     pool->task_condition,
+				     pool->mutex,
+				     NULL ) != 1 )
+				{
+					libcthreads_mutex_release(
+					 pool->mutex,
+					 NULL );
+
+					return( -1 );
+				}
+			}
+			if( ( pool->stop != 0 )
+			 && ( pool->number_of_queued_tasks == 0 ) )
+			{
+				stop = 1;
+			}
+		}
+		if( libcthreads_mutex_release(
+		     pool->mutex,
+		     NULL ) != 1 )
+		{
+			return( -1 );
+		}
+		if( result != 1 )
+		{
+			continue;
+		}
+		task_result = task.task_function(
+		               task.arguments,
+		               worker->buffer,
+		               pool->buffer_size );
+
+		if( libcthreads_mutex_grab(
+		     pool->mutex,
+		     NULL ) != 1 )
+		{
+			return( -1 );
+		}
+		if( task_result != 1 )
+		{
+			pool->number_of_failed_tasks += 1;
+		}
+		pool->number_of_pending_tasks -= 1;
+
+		if( pool->number_of_pending_tasks == 0 )
+		{
+			libcthreads_condition_broadcast(
+			 pool->done_condition,
+			 NULL );
+		}
+		if( libcthreads_mutex_release(
+		     pool->mutex,
+		     NULL ) != 1 )
+		{
+			return( -1 );
+		}
+	}
+	return( 1 );
+}
+
+/* Creates a worker pool
+ * Make sure the value pool is referencing, is set to NULL
+ * The buffer size is the size of the buffer of every worker, or 0 if the workers need no buffer
+ * Returns 1 if successful or -1 on error
+ */
+int assorted_worker_pool_initialize(
+     assorted_worker_pool_t **pool,
+     int number_of_workers,
+     size_t buffer_size,
+     uint8_t flags,
+     libcerror_error_t **error )
+{
+	assorted_worker_pool_worker_t *worker = NULL;
+	int *cpu_numbers                      = NULL;
+	static char *function                 = "assorted_worker_pool_initialize";
+	int number_of_cpus                    = 0;
+	int worker_index                      = 0;
+
+	if( pool == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid pool.",
+		 function );
+
+		return( -1 );
+	}
+	if( *pool != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid pool value already set.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( number_of_workers <= 0 )
+	 || ( number_of_workers > ASSORTED_WORKER_POOL_MAXIMUM_NUMBER_OF_WORKERS ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid number of workers value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( buffer_size > (size_t) SSIZE_MAX )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid buffer size value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	*pool = memory_allocate_structure(
+	         assorted_worker_pool_t );
+
+	if( *pool == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create pool.",
+		 function );
+
+		goto on_error;
+	}
+	if( memory_set(
+	     *pool,
+	     0,
+	     sizeof( assorted_worker_pool_t ) ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear pool.",
+		 function );
+
+		memory_free(
+		 *pool );
+
+		*pool = NULL;
+
+		return( -1 );
+	}
+	( *pool )->buffer_size = buffer_size;
+	( *pool )->flags       = flags;
+
+	( *pool )->workers = (assorted_worker_pool_worker_t *) memory_allocate(
+	                                                        sizeof( assorted_worker_pool_worker_t ) * number_of_workers );
+
+	if( ( *pool )->workers == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create workers.",
+		 function );
+
+		goto on_error;
+	}
+	if( memory_set(
+	     ( *pool )->workers,
+	     0,
+	     sizeof( assorted_worker_pool_worker_t ) * number_of_workers ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear workers.",
+		 function );
+
+		memory_free(
+		 ( *pool )->workers );
+
+		( *pool )->workers = NULL;
+
+		goto on_error;
+	}
+	( *pool )->number_of_workers = number_of_workers;
+
+	if( libcthreads_mutex_initialize(
+	     &( ( *pool )->mutex ),
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create mutex.",
+		 function );
+
+		goto on_error;
+	}
+	if( libcthreads_condition_initialize(
+	     &( ( *pool )->task_condition ),
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create task condition.",
+		 function );
+
+		goto on_error;
+	}
+	if( libcthreads_condition_initialize(
+	     &( ( *pool )->done_condition ),
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create done condition.",
+		 function );
+
+		goto on_error;
+	}
+#if defined( HAVE_ASSORTED_WORKER_POOL_CPU_AFFINITY )
+	if( ( flags & ASSORTED_WORKER_POOL_FLAG_CPU_AFFINITY ) != 0 )
+	{
+		cpu_numbers = (int *) memory_allocate(
+		                       sizeof( int ) * ASSORTED_WORKER_POOL_MAXIMUM_NUMBER_OF_CPUS );
+
+		if( cpu_numbers == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+			 "%s: unable to create CPU numbers.",
+			 function );
+
+			goto on_error;
+		}
+		/* Without the allowed CPUs the workers are not bound
+		 */
+		if( assorted_worker_pool_get_cpu_numbers(
+		     cpu_numbers,
+		     (int) ASSORTED_WORKER_POOL_MAXIMUM_NUMBER_OF_CPUS,
+		     &number_of_cpus ) != 1 )
+		{
+			number_of_cpus = 0;
+		}
+	}
+#endif
+	for( worker_index = 0;
+	     worker_index < number_of_workers;
+	     worker_index++ )
+	{
+		worker = &( ( *pool )->workers[ worker_index ] );
+
+		worker->pool         = *pool;
+		worker->worker_index = worker_index;
+		worker->cpu_number   = -1;
+
+		/* Spread the workers over all the allowed CPUs, e.g. over both
+		 * sockets of a dual-socket system, instead of filling the first ones
+		 */
+		if( number_of_cpus > 0 )
+		{
+			worker->cpu_number = cpu_numbers[ ( worker_index * number_of_cpus ) / number_of_workers ];
+		}
+		if( libcthreads_mutex_initialize(
+		     &( worker->mutex ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+			 "%s: unable to create mutex of worker: %d.",
+			 function,
+			 worker_index );
+
+			goto on_error;
+		}
+		worker->tasks = (assorted_worker_pool_task_t *) memory_allocate(
+		                                                 sizeof( assorted_worker_pool_task_t ) * ASSORTED_WORKER_POOL_INITIAL_NUMBER_OF_TASKS );
+
+		if( worker->tasks == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+			 "%s: unable to create tasks of worker: %d.",
+			 function,
+			 worker_index );
+
+			goto on_error;
+		}
+		worker->maximum_number_of_tasks = ASSORTED_WORKER_POOL_INITIAL_NUMBER_OF_TASKS;
+	}
+	if( cpu_numbers != NULL )
+	{
+		memory_free(
+		 cpu_numbers );
+
+		cpu_numbers = NULL;
+	}
+	for( worker_index = 0;
+	     worker_index < number_of_workers;
+	     worker_index++ )
+	{
+		worker = &( ( *pool )->workers[ worker_index ] );
+
+		if( libcthreads_thread_create(
+		     &( worker->thread ),
+		     NULL,
+		     assorted_worker_pool_worker_run,
+		     (void *) worker,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+			 "%s: unable to create thread of worker: %d.",
+			 function,
+			 worker_index );
+
+			goto on_error;
+		}
+		( *pool )->number_of_started_workers += 1;
+	}
+	/* Wait until all workers are bound and have their buffer
+	 */
+	if( libcthreads_mutex_grab(
+	     ( *pool )->mutex,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab mutex.",
+		 function );
+
+		goto on_error;
+	}
+	while( ( ( *pool )->number_of_ready_workers + ( *pool )->number_of_failed_workers ) < number_of_workers )
+	{
+		if( libcthreads_condition_wait(
+		     ( *pool )->done_condition,
+		     ( *pool )->mutex,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to wait for workers.",
+			 function );
+
+			libcthreads_mutex_release(
+			 ( *pool )->mutex,
+			 NULL );
+
+			goto on_error;
+		}
+	}
+	if( libcthreads_mutex_release(
+	     ( *pool )->mutex,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release mutex.",
+		 function );
+
+		goto on_error;
+	}
+	if( ( *pool )->number_of_failed_workers > 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to start %d workers.",
+		 function,
+		 ( *pool )->number_of_failed_workers );
+
+		goto on_error;
+	}
+	return( 1 );
+
+on_error:
+	if( cpu_numbers != NULL )
+	{
+		memory_free(
+		 cpu_numbers );
+	}
+	if( *pool != NULL )
+	{
+		assorted_worker_pool_free(
+		 pool,
+		 NULL );
+	}
+	return( -1 );
+}
+
+/* Frees a worker pool
+ * The workers finish the tasks that are queued before they stop
+ * Returns 1 if successful or -1 on error
+ */
+int assorted_worker_pool_free(
+     assorted_worker_pool_t **pool,
+     libcerror_error_t **error )
+{
+	assorted_worker_pool_worker_t *worker = NULL;
+	static char *function                 = "assorted_worker_pool_free";
+	int result                            = 1;
+	int worker_index                      = 0;
+
+	if( pool == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid pool.",
+		 function );
+
+		return( -1 );
+	}
+	if( *pool == NULL )
+	{
+		return( 1 );
+	}
+	if( ( *pool )->number_of_started_workers > 0 )
+	{
+		if( libcthreads_mutex_grab(
+		     ( *pool )->mutex,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to grab mutex.",
+			 function );
+
+			return( -1 );
+		}
+		( *pool )->stop = 1;
+
+		if( libcthreads_condition_broadcast(
+		     ( *pool )->task_condition,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to broadcast task condition.",
+			 function );
+
+			result = -1;
+		}
+		if( libcthreads_mutex_release(
+		     ( *pool )->mutex,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to release mutex.",
+			 function );
+
+			return( -1 );
+		}
+		if( result != 1 )
+		{
+			return( -1 );
+		}
+	}
+	if( ( *pool )->workers != NULL )
+	{
+		/* All threads are joined before the queues are freed, since
+		 * a running worker can steal from the queue of any other worker
+		 */
+		for( worker_index = 0;
+		     worker_index < ( *pool )->number_of_workers;
+		     worker_index++ )
+		{
+			worker = &( ( *pool )->workers[ worker_index ] );
+
+			if( worker->thread != NULL )
+			{
+				if( libcthreads_thread_join(
+				     &( worker->thread ),
+				     error ) != 1 )
+				{
+					libcerror_error_set(
+					 error,
+					 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+					 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+					 "%s: unable to join thread of worker: %d.",
+					 function,
+					 worker_index );
+
+					result = -1;
+				}
+			}
+		}
+		for( worker_index = 0;
+		     worker_index < ( *pool )->number_of_workers;
+		     worker_index++ )
+		{
+			worker = &( ( *pool )->workers[ worker_index ] );
+
+			if( worker->mutex != NULL )
+			{
+				if( libcthreads_mutex_free(
+				     &( worker->mutex ),
+				     error ) != 1 )
+				{
+					libcerror_error_set(
+					 error,
+					 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+					 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+					 "%s: unable to free mutex of worker: %d.",
+					 function,
+					 worker_index );
+
+					result = -1;
+				}
+			}
+			if( worker->tasks != NULL )
+			{
+				memory_free(
+				 worker->tasks );
+			}
+			if( worker->buffer != NULL )
+			{
+				memory_free(
+				 worker->buffer );
+			}
+		}
+		memory_free(
+		 ( *pool )->workers );
+	}
+	if( ( *pool )->done_condition != NULL )
+	{
+		if( libcthreads_condition_free(
+		     &( ( *pool )->done_condition ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free done condition.",
+			 function );
+
+			result = -1;
+		}
+	}
+	if( ( *pool )->task_condition != NULL )
+	{
+		if( libcthreads_condition_free(
+		     &( ( *pool )->task_condition ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free task condition.",
+			 function );
+
+			result = -1;
+		}
+	}
+	if( ( *pool )->mutex != NULL )
+	{
+		if( libcthreads_mutex_free(
+		     &( ( *pool )->mutex ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free mutex.",
+			 function );
+
+			result = -1;
+		}
+	}
+	memory_free(
+	 *pool );
+
+	*pool = NULL;
+
+	return( result );
+}
+
+/* Pushes a task onto the pool
+ * The tasks are distributed round-robin over the queues of the workers
+ * Returns 1 if successful or -1 on error
+ */
+int assorted_worker_pool_push(
+     assorted_worker_pool_t *pool,
+     assorted_worker_pool_task_function_t task_function,
+     void *arguments,
+     libcerror_error_t **error )
+{
+	assorted_worker_pool_task_t task;
+
+	static char *function = "assorted_worker_pool_push";
+	int result            = 1;
+	int worker_index      = 0;
+
+	if( pool == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid pool.",
+		 function );
+
+		return( -1 );
+	}
+	if( task_function == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid task function.",
+		 function );
+
+		return( -1 );
+	}
+	task.task_function = task_function;
+	task.arguments     = arguments;
+
+	/* The task is counted before it is queued so that a worker that
+	 * takes it can never make the number of pending tasks drop below 0
+	 */
+	if( libcthreads_mutex_grab(
+	     pool->mutex,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab mutex.",
+		 function );
+
+		return( -1 );
+	}
+	worker_index = pool->next_worker_index;
+
+	pool->next_worker_index        = ( pool->next_worker_index + 1 ) % pool->number_of_workers;
+	pool->number_of_queued_tasks  += 1;
+	pool->number_of_pending_tasks += 1;
+
+	if( libcthreads_mutex_release(
+	     pool->mutex,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release mutex.",
+		 function );
+
+		return( -1 );
+	}
+	if( assorted_worker_pool_worker_push_task(
+	     &( pool->workers[ worker_index ] ),
+	     &task,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+		 "%s: unable to push task onto queue of worker: %d.",
+		 function,
+		 worker_index );
+
+		result = -1;
+	}
+	if( libcthreads_mutex_grab(
+	     pool->mutex,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab mutex.",
+		 function );
+
+		return( -1 );
+	}
+	if( result != 1 )
+	{
+		pool->number_of_queued_tasks  -= 1;
+		pool->number_of_pending_tasks -= 1;
+	}
+	else if( libcthreads_condition_signal(
+	          pool->task_condition,
+	          error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to signal task condition.",
+		 function );
+
+		result = -1;
+	}
+	if( libcthreads_mutex_release(
+	     pool->mutex,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release mutex.",
+		 function );
+
+		return( -1 );
+	}
+	return( result );
+}
+
+/* Waits until all tasks that were pushed onto the pool are done
+ * Returns 1 if successful or -1 on error, which includes a task that failed
+ */
+int assorted_worker_pool_wait(
+     assorted_worker_pool_t *pool,
+     libcerror_error_t **error )
+{
+	static char *function      = "assorted_worker_pool_wait";
+	int number_of_failed_tasks = 0;
+
+	if( pool == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid pool.",
+		 function );
+
+		return( -1 );
+	}
+	if( libcthreads_mutex_grab(
+	     pool->mutex,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab mutex.",
+		 function );
+
+		return( -1 );
+	}
+	while( pool->number_of_pending_tasks > 0 )
+	{
+		if( libcthreads_condition_wait(
+		     pool->done_condition,
+		     pool->mutex,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to wait for tasks.",
+			 function );
+
+			libcthreads_mutex_release(
+			 pool->mutex,
+			 NULL );
+
+			return( -1 );
+		}
+	}
+	number_of_failed_tasks = pool->number_of_failed_tasks;
+
+	pool->number_of_failed_tasks = 0;
+
+	if( libcthreads_mutex_release(
+	     pool->mutex,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release mutex.",
+		 function );
+
+		return( -1 );
+	}
+	if( number_of_failed_tasks > 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GENERIC,
+		 "%s: %d tasks failed.",
+		 function,
+		 number_of_failed_tasks );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+#endif /* defined( HAVE_MULTI_THREAD_SUPPORT ) */
+
@@ -0,0 +1,225 @@
+/*
+ * Worker pool functions for the assorted
+ *
+ * Copyright (C) 2008-2019, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This software is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This software is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this software.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#if !defined( _ASSORTED_WORKER_POOL_H )
+#define _ASSORTED_WORKER_POOL_H
+
+#include <common.h>
+#include <types.h>
+
+#include "assorted_libcerror.h"
+#include "assorted_libcthreads.h"
+
+#if defined( __cplusplus )
+extern "C" {
+#endif
+
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+
+/* The maximum number of workers
+ */
+#define ASSORTED_WORKER_POOL_MAXIMUM_NUMBER_OF_WORKERS	64
+
+/* The initial number of tasks a worker queue can hold, the queue grows when full
+ */
+#define ASSORTED_WORKER_POOL_INITIAL_NUMBER_OF_TASKS	16
+
+/* The worker pool flags
+ */
+enum ASSORTED_WORKER_POOL_FLAGS
+{
+	/* Bind every worker to a CPU, the workers are spread evenly
+	 * over the CPUs the process is allowed to run on
+	 */
+	ASSORTED_WORKER_POOL_FLAG_CPU_AFFINITY	= 0x01
+};
+
+/* Runs a task
+ * The buffer is the buffer of the worker that runs the task, which is
+ * allocated on the NUMA node of the worker, or NULL if the pool has no
+ * worker buffers
+ * Returns 1 if successful or -1 on error
+ */
+typedef int (*assorted_worker_pool_task_function_t)(
+               void *arguments,
+               uint8_t *buffer,
+               size_t buffer_size );
+
+typedef struct assorted_worker_pool_task assorted_worker_pool_task_t;
+
+struct assorted_worker_pool_task
+{
+	/* The task function
+	 */
+	assorted_worker_pool_task_function_t task_function;
+
+	/* The arguments of the task function
+	 */
+	void *arguments;
+};
+
+typedef struct assorted_worker_pool assorted_worker_pool_t;
+
+typedef struct assorted_worker_pool_worker assorted_worker_pool_worker_t;
+
+/* A worker runs the tasks of its own queue last in first out and
+ * when its queue is empty, steals the oldest task of the queue of
+ * another worker, preferably one on the same NUMA node
+ */
+struct assorted_worker_pool_worker
+{
+	/* The pool
+	 */
+	assorted_worker_pool_t *pool;
+
+	/* The index of the worker
+	 */
+	int worker_index;
+
+	/* The thread
+	 */
+	libcthreads_thread_t *thread;
+
+	/* The mutex that protects the queue
+	 */
+	libcthreads_mutex_t *mutex;
+
+	/* The queue of tasks, which is a circular buffer
+	 */
+	assorted_worker_pool_task_t *tasks;
+
+	/* The maximum number of tasks in the queue
+	 */
+	int maximum_number_of_tasks;
+
+	/* The index of the oldest task in the queue
+	 */
+	int first_task_index;
+
+	/* The number of tasks in the queue
+	 */
+	int number_of_tasks;
+
+	/* The CPU the worker is bound to or -1 if not bound
+	 */
+	int cpu_number;
+
+	/* The NUMA node the worker runs on
+	 */
+	int node_number;
+
+	/* The buffer, which is allocated by the worker itself
+	 */
+	uint8_t *buffer;
+};
+
+struct assorted_worker_pool
+{
+	/* The workers
+	 */
+	assorted_worker_pool_worker_t *workers;
+
+	/* The number of workers
+	 */
+	int number_of_workers;
+
+	/* The number of workers that have been started
+	 */
+	int number_of_started_workers;
+
+	/* The number of workers that are ready to run tasks
+	 */
+	int number_of_ready_workers;
+
+	/* The number of workers that failed to start
+	 */
+	int number_of_failed_workers;
+
+	/* The size of the buffer of every worker
+	 */
+	size_t buffer_size;
+
+	/* The flags
+	 */
+	uint8_t flags;
+
+	/* The mutex that protects the counters and conditions
+	 */
+	libcthreads_mutex_t *mutex;
+
+	/* The condition that is signalled when a task is pushed or the pool stops
+	 */
+	libcthreads_condition_t *task_condition;
+
+	/* The condition that is signalled when a worker is ready or all tasks are done
+	 */
+	libcthreads_condition_t *done_condition;
+
+	/* The index of the worker to push the next task to
+	 */
+	int next_worker_index;
+
+	/* The number of tasks that are queued and not yet taken by a worker
+	 */
+	int number_of_queued_tasks;
+
+	/* The number of tasks that are queued or running
+	 */
+	int number_of_pending_tasks;
+
+	/* The number of tasks that failed since the last wait
+	 */
+	int number_of_failed_tasks;
+
+	/* Value to indicate the workers should stop
+	 */
+	uint8_t stop;
+};
+
+int assorted_worker_pool_initialize(
+     assorted_worker_pool_t **pool,
+     int number_of_workers,
+     size_t buffer_size,
+     uint8_t flags,
+     libcerror_error_t **error );
+
+int assorted_worker_pool_free(
+     assorted_worker_pool_t **pool,
+     libcerror_error_t **error );
+
+int assorted_worker_pool_push(
+     assorted_worker_pool_t *pool,
+     assorted_worker_pool_task_function_t task_function,
+     void *arguments,
+     libcerror_error_t **error );
+
+int assorted_worker_pool_wait(
+     assorted_worker_pool_t *pool,
+     libcerror_error_t **error );
+
+#endif /* defined( HAVE_MULTI_THREAD_SUPPORT ) */
+
+#if defined( __cplusplus )
+}
+#endif
+
+#endif /* !defined( _ASSORTED_WORKER_POOL_H ) */
+
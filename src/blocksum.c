@@ -0,0 +1,1941 @@
+/*
+ * Calculates the checksums of the blocks of file data and writes them to a manifest
+ * so that the data can be verified incrementally and an interrupted run can be resumed
+ *
+ * Copyright (C) 2008-2019, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This software is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This software is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this software.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <file_stream.h>
+#include <memory.h>
+#include <narrow_string.h>
+#include <system_string.h>
+#include <types.h>
+
+#if defined( HAVE_STDLIB_H )
+#include <stdlib.h>
+#endif
+
+#if defined( HAVE_SYS_STAT_H )
+#include <sys/stat.h>
+#endif
+
+#include "adler32.h"
+#include "assorted_getopt.h"
+#include "assorted_input_file.h"
+#include "assorted_libcerror.h"
+#include "assorted_libcnotify.h"
+#include "assorted_output.h"
+#include "crc32.h"
+
+/* The default size of a block
+ */
+#define BLOCKSUM_DEFAULT_BLOCK_SIZE		( 1024 * 1024 )
+
+/* The maximum size of a block
+ */
+#define BLOCKSUM_MAXIMUM_BLOCK_SIZE		( 64 * 1024 * 1024 )
+
+/* The maximum size of a line of the manifest
+ */
+#define BLOCKSUM_MAXIMUM_LINE_SIZE		128
+
+/* The signature, which is the first line of the manifest
+ */
+#define BLOCKSUM_MANIFEST_SIGNATURE		"blocksum manifest version 1"
+
+enum BLOCKSUM_DIGEST_TYPES
+{
+	BLOCKSUM_DIGEST_TYPE_ADLER32	= 1,
+	BLOCKSUM_DIGEST_TYPE_CRC32
+};
+
+enum BLOCKSUM_MODES
+{
+	BLOCKSUM_MODE_CREATE		= 0,
+	BLOCKSUM_MODE_CHECK,
+	BLOCKSUM_MODE_RESUME
+};
+
+typedef struct blocksum_digest_definition blocksum_digest_definition_t;
+
+struct blocksum_digest_definition
+{
+	/* The digest type
+	 */
+	int digest_type;
+
+	/* The digest name, as used on the command line
+	 */
+	const system_character_t *name;
+
+	/* The digest name, as used in the manifest
+	 */
+	const char *manifest_name;
+
+	/* The digest description, as used in the output
+	 */
+	const char *description;
+};
+
+/* The supported digests, terminated by an empty entry
+ */
+blocksum_digest_definition_t blocksum_digest_definitions[] = {
+	{ BLOCKSUM_DIGEST_TYPE_ADLER32, _SYSTEM_STRING( "adler32" ), "adler32", "Adler-32" },
+	{ BLOCKSUM_DIGEST_TYPE_CRC32, _SYSTEM_STRING( "crc32" ), "crc32", "CRC-32" },
+	{ 0, NULL, NULL, NULL } };
+
+typedef struct blocksum_manifest blocksum_manifest_t;
+
+struct blocksum_manifest
+{
+	/* The digest definition
+	 */
+	const blocksum_digest_definition_t *definition;
+
+	/* The size of a block
+	 */
+	size_t block_size;
+
+	/* The size of the source
+	 */
+	size64_t source_size;
+
+	/* The modification time of the source in seconds since January 1, 1970
+	 */
+	uint64_t modification_time;
+
+	/* The block values
+	 */
+	uint32_t *block_values;
+
+	/* The number of block values
+	 */
+	uint64_t number_of_blocks;
+
+	/* The maximum number of block values before the block values are resized
+	 */
+	uint64_t maximum_number_of_blocks;
+
+	/* The value of the data of the blocks, which is the combination of the block values
+	 */
+	uint32_t value;
+
+	/* Value to indicate the manifest contains the values of all the blocks
+	 */
+	uint8_t is_complete;
+};
+
+/* Prints the executable usage information
+ */
+void usage_fprint(
+      FILE *stream )
+{
+	if( stream == NULL )
+	{
+		return;
+	}
+	fprintf( stream, "Use blocksum to calculate the checksums of the blocks of file data\n"
+	                 "and write them to a manifest, to verify the data against the manifest\n"
+	                 "or to resume an interrupted calculation.\n\n" );
+
+	fprintf( stream, "Usage: blocksum [ -b block_size ] [ -d digest ] [ -m manifest ]\n"
+	                 "                [ -S format ] [ -u block_size ] [ -cfhrvV ] source\n\n" );
+
+	fprintf( stream, "\tsource: the source file\n\n" );
+
+	fprintf( stream, "\t-b:     size of the blocks of which the checksums are stored\n"
+	                 "\t        in the manifest (default is %d)\n",
+	 BLOCKSUM_DEFAULT_BLOCK_SIZE );
+	fprintf( stream, "\t-c:     check the source against the manifest, the blocks are only\n"
+	                 "\t        verified if the size or modification time of the source\n"
+	                 "\t        differ from the manifest\n" );
+	fprintf( stream, "\t-d:     digest to calculate, options: adler32, crc32 (default)\n" );
+	fprintf( stream, "\t-f:     verify all the blocks when checking the source, even\n"
+	                 "\t        if its size and modification time match the manifest\n" );
+	fprintf( stream, "\t-h:     shows this help\n" );
+	fprintf( stream, "\t-m:     the manifest (default is the source with the extension\n"
+	                 "\t        .blocksum)\n" );
+	fprintf( stream, "\t-r:     resume the calculation from the last block in the manifest\n" );
+	fprintf( stream, "\t-S:     print timing and throughput statistics of the open,\n"
+	                 "\t        read, compute and write phases and the peak memory\n"
+	                 "\t        size to stderr in the format: text or json\n" );
+	fprintf( stream, "\t-u:     read the source unbuffered using direct I/O in blocks of\n"
+	                 "\t        block_size bytes, which must be a multiple of %d, to\n"
+	                 "\t        bypass the system cache, e.g. when reading a device\n",
+	 ASSORTED_INPUT_FILE_DIRECT_IO_ALIGNMENT );
+	fprintf( stream, "\t-v:     verbose output to stderr\n" );
+	fprintf( stream, "\t-V:     print version\n" );
+	fprintf( stream, "\n" );
+	fprintf( stream, "The Adler-32 is calculated with an initial value of 1, as in zlib,\n"
+	                 "and the CRC-32 as in RFC 1952. The value of the entire data is\n"
+	                 "combined from the block values.\n" );
+	fprintf( stream, "\n" );
+}
+
+/* Creates a manifest
+ * Make sure the value manifest is referencing, is set to NULL
+ * Returns 1 if successful or -1 on error
+ */
+int blocksum_manifest_initialize(
+     blocksum_manifest_t **manifest,
+     libcerror_error_t **error )
+{
+	static char *function = "blocksum_manifest_initialize";
+
+	if( manifest == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid manifest.",
+		 function );
+
+		return( -1 );
+	}
+	if( *manifest != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid manifest value already set.",
+		 function );
+
+		return( -1 );
+	}
+	*manifest = memory_allocate_structure(
+	             blocksum_manifest_t );
+
+	if( *manifest == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create manifest.",
+		 function );
+
+		goto on_error;
+	}
+	if( memory_set(
+	     *manifest,
+	     0,
+	     sizeof( blocksum_manifest_t ) ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear manifest.",
+		 function );
+
+		goto on_error;
+	}
+	return( 1 );
+
+on_error:
+	if( *manifest != NULL )
+	{
+		memory_free(
+		 *manifest );
+
+		*manifest = NULL;
+	}
+	return( -1 );
+}
+
+/* Frees a manifest
+ * Returns 1 if successful or -1 on error
+ */
+int blocksum_manifest_free(
+     blocksum_manifest_t **manifest,
+     libcerror_error_t **error )
+{
+	static char *function = "blocksum_manifest_free";
+
+	if( manifest == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid manifest.",
+		 function );
+
+		return( -1 );
+	}
+	if( *manifest != NULL )
+	{
+		if( ( *manifest )->block_values != NULL )
+		{
+			memory_free(
+			 ( *manifest )->block_values );
+		}
+		memory_free(
+		 *manifest );
+
+		*manifest = NULL;
+	}
+	return( 1 );
+}
+
+/* Calculates the value of a block
+ * Returns 1 if successful or -1 on error
+ */
+int blocksum_calculate_block_value(
+     int digest_type,
+     uint8_t *buffer,
+     size_t size,
+     uint32_t *block_value,
+     libcerror_error_t **error )
+{
+	static char *function = "blocksum_calculate_block_value";
+	int result            = -1;
+
+	switch( digest_type )
+	{
+		case BLOCKSUM_DIGEST_TYPE_ADLER32:
+			result = checksum_calculate_adler32_simd(
+			          block_value,
+			          buffer,
+			          size,
+			          1,
+			          error );
+			break;
+
+		case BLOCKSUM_DIGEST_TYPE_CRC32:
+			result = crc32_calculate_hardware(
+			          block_value,
+			          buffer,
+			          size,
+			          0,
+			          0,
+			          error );
+			break;
+
+		default:
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+			 LIBCERROR_ARGUMENT_ERROR_UNSUPPORTED_VALUE,
+			 "%s: unsupported digest type: %d.",
+			 function,
+			 digest_type );
+
+			return( -1 );
+	}
+	return( result );
+}
+
+/* Appends a block value to the value of the preceding blocks
+ * Returns 1 if successful or -1 on error
+ */
+int blocksum_append_block_value(
+     int digest_type,
+     uint32_t *value,
+     uint64_t block_index,
+     uint32_t block_value,
+     size_t block_size,
+     libcerror_error_t **error )
+{
+	static char *function = "blocksum_append_block_value";
+	int result            = -1;
+
+	if( value == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid value.",
+		 function );
+
+		return( -1 );
+	}
+	if( block_index == 0 )
+	{
+		*value = block_value;
+
+		return( 1 );
+	}
+	switch( digest_type )
+	{
+		case BLOCKSUM_DIGEST_TYPE_ADLER32:
+			result = checksum_combine_adler32(
+			          value,
+			          *value,
+			          block_value,
+			          (size64_t) block_size,
+			          error );
+			break;
+
+		case BLOCKSUM_DIGEST_TYPE_CRC32:
+			result = crc32_combine_values(
+			          value,
+			          *value,
+			          block_value,
+			          (size64_t) block_size,
+			          error );
+			break;
+
+		default:
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+			 LIBCERROR_ARGUMENT_ERROR_UNSUPPORTED_VALUE,
+			 "%s: unsupported digest type: %d.",
+			 function,
+			 digest_type );
+
+			return( -1 );
+	}
+	return( result );
+}
+
+/* Appends a block value to the manifest
+ * Returns 1 if successful or -1 on error
+ */
+int blocksum_manifest_append_block_value(
+     blocksum_manifest_t *manifest,
+     uint32_t block_value,
+     libcerror_error_t **error )
+{
+	uint32_t *block_values            = NULL;
+	static char *function             = "blocksum_manifest_append_block_value";
+	uint64_t maximum_number_of_blocks = 0;
+	size64_t block_offset             = 0;
+	size_t block_size                 = 0;
+
+	if( manifest == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid manifest.",
+		 function );
+
+		return( -1 );
+	}
+	if( manifest->definition == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid manifest - missing definition.",
+		 function );
+
+		return( -1 );
+	}
+	if( manifest->block_size == 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid manifest - missing block size.",
+		 function );
+
+		return( -1 );
+	}
+	block_offset = (size64_t) manifest->number_of_blocks * manifest->block_size;
+
+	if( block_offset >= manifest->source_size )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid manifest - number of blocks value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	block_size = manifest->block_size;
+
+	if( (size64_t) block_size > ( manifest->source_size - block_offset ) )
+	{
+		block_size = (size_t) ( manifest->source_size - block_offset );
+	}
+	if( manifest->number_of_blocks >= manifest->maximum_number_of_blocks )
+	{
+		maximum_number_of_blocks = manifest->maximum_number_of_blocks * 2;
+
+		if( maximum_number_of_blocks == 0 )
+		{
+			maximum_number_of_blocks = 1024;
+		}
+		if( maximum_number_of_blocks > ( (uint64_t) SSIZE_MAX / sizeof( uint32_t ) ) )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_VALUE_EXCEEDS_MAXIMUM,
+			 "%s: invalid maximum number of blocks value exceeds maximum.",
+			 function );
+
+			return( -1 );
+		}
+		block_values = (uint32_t *) memory_reallocate(
+		                             manifest->block_values,
+		                             sizeof( uint32_t ) * (size_t) maximum_number_of_blocks );
+
+		if( block_values == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+			 "%s: unable to resize block values.",
+			 function );
+
+			return( -1 );
+		}
+		manifest->block_values             = block_values;
+		manifest->maximum_number_of_blocks = maximum_number_of_blocks;
+	}
+	if( blocksum_append_block_value(
+	     manifest->definition->digest_type,
+	     &( manifest->value ),
+	     manifest->number_of_blocks,
+	     block_value,
+	     block_size,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+		 "%s: unable to append block value.",
+		 function );
+
+		return( -1 );
+	}
+	manifest->block_values[ manifest->number_of_blocks ] = block_value;
+
+	manifest->number_of_blocks += 1;
+
+	return( 1 );
+}
+
+/* Parses a decimal or, if prefixed with 0x, hexadecimal integer value
+ * Returns 1 if successful or -1 on error
+ */
+int blocksum_parse_integer(
+     const char *string,
+     size_t string_length,
+     uint64_t *value,
+     libcerror_error_t **error )
+{
+	static char *function = "blocksum_parse_integer";
+	size_t string_index   = 0;
+	uint64_t base         = 10;
+	uint64_t digit_value  = 0;
+	char character        = 0;
+
+	if( string == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid string.",
+		 function );
+
+		return( -1 );
+	}
+	if( value == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid value.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( string_length > 2 )
+	 && ( string[ 0 ] == '0' )
+	 && ( string[ 1 ] == 'x' ) )
+	{
+		base         = 16;
+		string_index = 2;
+	}
+	if( string_index >= string_length )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_TOO_SMALL,
+		 "%s: invalid string value too small.",
+		 function );
+
+		return( -1 );
+	}
+	*value = 0;
+
+	while( string_index < string_length )
+	{
+		character = string[ string_index++ ];
+
+		if( ( character >= '0' )
+		 && ( character <= '9' ) )
+		{
+			digit_value = (uint64_t) ( character - '0' );
+		}
+		else if( ( base == 16 )
+		      && ( character >= 'a' )
+		      && ( character <= 'f' ) )
+		{
+			digit_value = (uint64_t) ( character - 'a' + 10 );
+		}
+		else
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_UNSUPPORTED_VALUE,
+			 "%s: unsupported character: %c.",
+			 function,
+			 character );
+
+			return( -1 );
+		}
+		if( *value > ( ( UINT64_MAX - digit_value ) / base ) )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_VALUE_EXCEEDS_MAXIMUM,
+			 "%s: invalid value exceeds maximum.",
+			 function );
+
+			return( -1 );
+		}
+		*value = ( *value * base ) + digit_value;
+	}
+	return( 1 );
+}
+
+/* Reads a manifest
+ * Every line of the manifest, after the signature, consists of a name followed by a colon,
+ * a space and the value, and the manifest ends with the value of the entire data.
+ * A last line without end-of-line character, that was written by an interrupted run,
+ * is ignored
+ * Returns 1 if successful or -1 on error
+ */
+int blocksum_manifest_read(
+     blocksum_manifest_t *manifest,
+     FILE *stream,
+     libcerror_error_t **error )
+{
+	char line[ BLOCKSUM_MAXIMUM_LINE_SIZE ];
+
+	const blocksum_digest_definition_t *definition = NULL;
+	const char *line_value                         = NULL;
+	static char *function                          = "blocksum_manifest_read";
+	size_t index_length                            = 0;
+	size_t line_length                             = 0;
+	size_t line_value_length                       = 0;
+	size_t name_length                             = 0;
+	uint64_t block_index                           = 0;
+	uint64_t line_number                           = 0;
+	uint64_t value_64bit                           = 0;
+
+	if( manifest == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid manifest.",
+		 function );
+
+		return( -1 );
+	}
+	if( stream == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid stream.",
+		 function );
+
+		return( -1 );
+	}
+	while( file_stream_get_string(
+	        stream,
+	        line,
+	        BLOCKSUM_MAXIMUM_LINE_SIZE ) != NULL )
+	{
+		line_number++;
+
+		line_length = narrow_string_length(
+		               line );
+
+		if( ( line_length == 0 )
+		 || ( line[ line_length - 1 ] != '\n' ) )
+		{
+			if( line_length == ( BLOCKSUM_MAXIMUM_LINE_SIZE - 1 ) )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_VALUE_EXCEEDS_MAXIMUM,
+				 "%s: invalid line: %" PRIu64 " value exceeds maximum size.",
+				 function,
+				 line_number );
+
+				return( -1 );
+			}
+			break;
+		}
+		while( ( line_length > 0 )
+		    && ( ( line[ line_length - 1 ] == '\n' )
+		     ||  ( line[ line_length - 1 ] == '\r' ) ) )
+		{
+			line_length--;
+		}
+		line[ line_length ] = 0;
+
+		if( line_number == 1 )
+		{
+			if( ( line_length != ( sizeof( BLOCKSUM_MANIFEST_SIGNATURE ) - 1 ) )
+			 || ( narrow_string_compare(
+			       line,
+			       BLOCKSUM_MANIFEST_SIGNATURE,
+			       line_length ) != 0 ) )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_UNSUPPORTED_VALUE,
+				 "%s: unsupported manifest signature.",
+				 function );
+
+				return( -1 );
+			}
+			continue;
+		}
+		if( manifest->is_complete != 0 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_UNSUPPORTED_VALUE,
+			 "%s: unsupported line: %" PRIu64 " after value of entire data.",
+			 function,
+			 line_number );
+
+			return( -1 );
+		}
+		for( name_length = 0;
+		     name_length < line_length;
+		     name_length++ )
+		{
+			if( line[ name_length ] == ':' )
+			{
+				break;
+			}
+		}
+		if( ( ( name_length + 2 ) >= line_length )
+		 || ( line[ name_length + 1 ] != ' ' ) )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_UNSUPPORTED_VALUE,
+			 "%s: unsupported line: %" PRIu64 ".",
+			 function,
+			 line_number );
+
+			return( -1 );
+		}
+		line_value        = &( line[ name_length + 2 ] );
+		line_value_length = line_length - ( name_length + 2 );
+
+		/* The header values cannot change after the first block value
+		 */
+		if( ( manifest->number_of_blocks != 0 )
+		 && ( ( name_length != 5 )
+		  ||  ( ( narrow_string_compare(
+		           line,
+		           "block",
+		           5 ) != 0 )
+		   &&   ( narrow_string_compare(
+		           line,
+		           "value",
+		           5 ) != 0 ) ) ) )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_UNSUPPORTED_VALUE,
+			 "%s: unsupported line: %" PRIu64 " after block values.",
+			 function,
+			 line_number );
+
+			return( -1 );
+		}
+
+		if( ( name_length == 6 )
+		 && ( narrow_string_compare(
+		       line,
+		       "digest",
+		       6 ) == 0 ) )
+		{
+			for( definition = blocksum_digest_definitions;
+			     definition->manifest_name != NULL;
+			     definition++ )
+			{
+				if( ( narrow_string_length(
+				       definition->manifest_name ) == line_value_length )
+				 && ( narrow_string_compare(
+				       definition->manifest_name,
+				       line_value,
+				       line_value_length ) == 0 ) )
+				{
+					break;
+				}
+			}
+			if( definition->manifest_name == NULL )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_UNSUPPORTED_VALUE,
+				 "%s: unsupported digest: %s.",
+				 function,
+				 line_value );
+
+				return( -1 );
+			}
+			manifest->definition = definition;
+
+			continue;
+		}
+		/* The block lines contain the block index followed by a space and the block value
+		 */
+		if( ( name_length == 5 )
+		 && ( narrow_string_compare(
+		       line,
+		       "block",
+		       5 ) == 0 ) )
+		{
+			for( index_length = 0;
+			     index_length < line_value_length;
+			     index_length++ )
+			{
+				if( line_value[ index_length ] == ' ' )
+				{
+					break;
+				}
+			}
+			if( index_length >= line_value_length )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_UNSUPPORTED_VALUE,
+				 "%s: unsupported block line: %" PRIu64 ".",
+				 function,
+				 line_number );
+
+				return( -1 );
+			}
+			if( blocksum_parse_integer(
+			     line_value,
+			     index_length,
+			     &block_index,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+				 "%s: unable to parse block index of line: %" PRIu64 ".",
+				 function,
+				 line_number );
+
+				return( -1 );
+			}
+			if( block_index != manifest->number_of_blocks )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+				 "%s: invalid block index of line: %" PRIu64 " value out of bounds.",
+				 function,
+				 line_number );
+
+				return( -1 );
+			}
+			line_value        += index_length + 1;
+			line_value_length -= index_length + 1;
+		}
+		if( blocksum_parse_integer(
+		     line_value,
+		     line_value_length,
+		     &value_64bit,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to parse value of line: %" PRIu64 ".",
+			 function,
+			 line_number );
+
+			return( -1 );
+		}
+		if( ( name_length == 10 )
+		 && ( narrow_string_compare(
+		       line,
+		       "block size",
+		       10 ) == 0 ) )
+		{
+			if( ( value_64bit == 0 )
+			 || ( value_64bit > BLOCKSUM_MAXIMUM_BLOCK_SIZE ) )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+				 "%s: invalid block size value out of bounds.",
+				 function );
+
+				return( -1 );
+			}
+			manifest->block_size = (size_t) value_64bit;
+		}
+		else if( ( name_length == 11 )
+		      && ( narrow_string_compare(
+		            line,
+		            "source size",
+		            11 ) == 0 ) )
+		{
+			manifest->source_size = (size64_t) value_64bit;
+		}
+		else if( ( name_length == 17 )
+		      && ( narrow_string_compare(
+		            line,
+		            "modification time",
+		            17 ) == 0 ) )
+		{
+			manifest->modification_time = value_64bit;
+		}
+		else if( ( name_length == 5 )
+		      && ( narrow_string_compare(
+		            line,
+		            "value",
+		            5 ) == 0 ) )
+		{
+			if( ( value_64bit > (uint64_t) UINT32_MAX )
+			 || ( (uint32_t) value_64bit != manifest->value ) )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+				 "%s: value of entire data does not match the block values.",
+				 function );
+
+				return( -1 );
+			}
+			if( ( (size64_t) manifest->number_of_blocks * manifest->block_size ) < manifest->source_size )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+				 "%s: missing block values.",
+				 function );
+
+				return( -1 );
+			}
+			manifest->is_complete = 1;
+		}
+		else if( value_64bit > (uint64_t) UINT32_MAX )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+			 "%s: invalid block value of line: %" PRIu64 " value out of bounds.",
+			 function,
+			 line_number );
+
+			return( -1 );
+		}
+		else if( blocksum_manifest_append_block_value(
+		          manifest,
+		          (uint32_t) value_64bit,
+		          error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+			 "%s: unable to append block value of line: %" PRIu64 ".",
+			 function,
+			 line_number );
+
+			return( -1 );
+		}
+	}
+	if( line_number == 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: missing manifest signature.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( manifest->definition == NULL )
+	 || ( manifest->block_size == 0 )
+	 || ( manifest->source_size == 0 ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: missing digest, block size or source size.",
+		 function );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Writes the header of a manifest
+ * Returns 1 if successful or -1 on error
+ */
+int blocksum_manifest_write_header(
+     blocksum_manifest_t *manifest,
+     FILE *stream,
+     libcerror_error_t **error )
+{
+	static char *function = "blocksum_manifest_write_header";
+
+	if( manifest == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid manifest.",
+		 function );
+
+		return( -1 );
+	}
+	if( manifest->definition == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid manifest - missing definition.",
+		 function );
+
+		return( -1 );
+	}
+	if( stream == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid stream.",
+		 function );
+
+		return( -1 );
+	}
+	if( fprintf(
+	     stream,
+	     "%s\n"
+	     "digest: %s\n"
+	     "block size: %" PRIzd "\n"
+	     "source size: %" PRIu64 "\n"
+	     "modification time: %" PRIu64 "\n",
+	     BLOCKSUM_MANIFEST_SIGNATURE,
+	     manifest->definition->manifest_name,
+	     manifest->block_size,
+	     manifest->source_size,
+	     manifest->modification_time ) < 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_WRITE_FAILED,
+		 "%s: unable to write header.",
+		 function );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Writes a block value to a manifest
+ * The stream is flushed so that an interrupted run can be resumed from the block
+ * Returns 1 if successful or -1 on error
+ */
+int blocksum_manifest_write_block_value(
+     FILE *stream,
+     uint64_t block_index,
+     uint32_t block_value,
+     libcerror_error_t **error )
+{
+	static char *function = "blocksum_manifest_write_block_value";
+
+	if( stream == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid stream.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( fprintf(
+	       stream,
+	       "block: %" PRIu64 " 0x%08" PRIx32 "\n",
+	       block_index,
+	       block_value ) < 0 )
+	 || ( fflush(
+	       stream ) != 0 ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_WRITE_FAILED,
+		 "%s: unable to write block: %" PRIu64 " value.",
+		 function,
+		 block_index );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Retrieves the modification time of a file in seconds since January 1, 1970
+ * Returns 1 if successful or -1 on error
+ */
+int blocksum_get_modification_time(
+     const system_character_t *filename,
+     uint64_t *modification_time,
+     libcerror_error_t **error )
+{
+#if defined( WINAPI )
+	struct _stat64 file_statistics;
+#else
+	struct stat file_statistics;
+#endif
+
+	static char *function = "blocksum_get_modification_time";
+	int result            = 0;
+
+	if( filename == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid filename.",
+		 function );
+
+		return( -1 );
+	}
+	if( modification_time == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid modification time.",
+		 function );
+
+		return( -1 );
+	}
+#if defined( WINAPI ) && defined( HAVE_WIDE_SYSTEM_CHARACTER )
+	result = _wstat64(
+	          filename,
+	          &file_statistics );
+#elif defined( WINAPI )
+	result = _stat64(
+	          filename,
+	          &file_statistics );
+#else
+	result = stat(
+	          filename,
+	          &file_statistics );
+#endif
+	if( result != 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve file statistics.",
+		 function );
+
+		return( -1 );
+	}
+	*modification_time = (uint64_t) file_statistics.st_mtime;
+
+	return( 1 );
+}
+
+/* The main program
+ */
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+int wmain( int argc, wchar_t * const argv[] )
+#else
+int main( int argc, char * const argv[] )
+#endif
+{
+	const blocksum_digest_definition_t *definition = NULL;
+	blocksum_manifest_t *manifest                  = NULL;
+	libcerror_error_t *error                       = NULL;
+	assorted_input_file_t *source_file             = NULL;
+	system_character_t *manifest_filename          = NULL;
+	system_character_t *option_manifest            = NULL;
+	system_character_t *option_statistics_format   = NULL;
+	system_character_t *source                     = NULL;
+	FILE *stream                                   = NULL;
+	uint8_t *buffer                                = NULL;
+	char *program                                  = "blocksum";
+	system_integer_t option                        = 0;
+	size64_t block_offset                          = 0;
+	size64_t source_size                           = 0;
+	size_t block_size                              = BLOCKSUM_DEFAULT_BLOCK_SIZE;
+	size_t direct_io_block_size                    = 0;
+	size_t name_length                             = 0;
+	size_t read_size                               = 0;
+	size_t source_length                           = 0;
+	ssize_t read_count                             = 0;
+	uint64_t block_index                           = 0;
+	uint64_t modification_time                     = 0;
+	uint64_t number_of_differing_blocks            = 0;
+	uint32_t block_value                           = 0;
+	uint32_t value                                 = 0;
+	uint8_t full_check                             = 0;
+	uint8_t write_manifest                         = 0;
+	int mode                                       = BLOCKSUM_MODE_CREATE;
+	int verbose                                    = 0;
+
+	assorted_output_version_fprint(
+	 stdout,
+	 program );
+
+	definition = &( blocksum_digest_definitions[ 1 ] );
+
+	while( ( option = assorted_getopt(
+	                   argc,
+	                   argv,
+	                   _SYSTEM_STRING( "b:cd:fhm:rS:u:vV" ) ) ) != (system_integer_t) -1 )
+	{
+		switch( option )
+		{
+			case '?':
+			default:
+				fprintf(
+				 stderr,
+				 "Invalid argument: %" PRIs_SYSTEM "\n",
+				 argv[ optind ] );
+
+				usage_fprint(
+				 stdout );
+
+				return( EXIT_FAILURE );
+
+			case 'b':
+				block_size = (size_t) atol( optarg );
+
+				break;
+
+			case 'c':
+				mode = BLOCKSUM_MODE_CHECK;
+
+				break;
+
+			case 'd':
+				name_length = system_string_length(
+				               optarg );
+
+				for( definition = blocksum_digest_definitions;
+				     definition->name != NULL;
+				     definition++ )
+				{
+					if( ( system_string_length(
+					       definition->name ) == name_length )
+					 && ( system_string_compare(
+					       definition->name,
+					       optarg,
+					       name_length ) == 0 ) )
+					{
+						break;
+					}
+				}
+				if( definition->name == NULL )
+				{
+					fprintf(
+					 stderr,
+					 "Unsupported digest: %" PRIs_SYSTEM "\n",
+					 optarg );
+
+					usage_fprint(
+					 stdout );
+
+					return( EXIT_FAILURE );
+				}
+				break;
+
+			case 'f':
+				full_check = 1;
+
+				break;
+
+			case 'h':
+				usage_fprint(
+				 stdout );
+
+				return( EXIT_SUCCESS );
+
+			case 'm':
+				option_manifest = optarg;
+
+				break;
+
+			case 'r':
+				mode = BLOCKSUM_MODE_RESUME;
+
+				break;
+
+			case 'S':
+				option_statistics_format = optarg;
+
+				break;
+
+			case 'u':
+				direct_io_block_size = (size_t) atol( optarg );
+
+				break;
+
+			case 'v':
+				verbose = 1;
+
+				break;
+
+			case 'V':
+				assorted_output_copyright_fprint(
+				 stdout );
+
+				return( EXIT_SUCCESS );
+		}
+	}
+	if( optind == argc )
+	{
+		fprintf(
+		 stderr,
+		 "Missing source file.\n" );
+
+		usage_fprint(
+		 stdout );
+
+		return( EXIT_FAILURE );
+	}
+	source = argv[ optind ];
+
+	if( ( block_size == 0 )
+	 || ( block_size > BLOCKSUM_MAXIMUM_BLOCK_SIZE ) )
+	{
+		fprintf(
+		 stderr,
+		 "Unsupported block size, value must be between 1 and %d.\n",
+		 BLOCKSUM_MAXIMUM_BLOCK_SIZE );
+
+		return( EXIT_FAILURE );
+	}
+	libcnotify_stream_set(
+	 stderr,
+	 NULL );
+	libcnotify_verbose_set(
+	 verbose );
+
+	if( assorted_output_statistics_initialize(
+	     option_statistics_format,
+	     &error ) != 1 )
+	{
+		fprintf(
+		 stderr,
+		 "Unable to initialize statistics.\n" );
+
+		goto on_error;
+	}
+	initialize_crc32_table(
+	 0xedb88320UL );
+
+	/* Determine the manifest filename, which defaults to: source.blocksum
+	 */
+	if( option_manifest == NULL )
+	{
+		source_length = system_string_length(
+		                 source );
+
+		manifest_filename = system_string_allocate(
+		                     source_length + 10 );
+
+		if( manifest_filename == NULL )
+		{
+			fprintf(
+			 stderr,
+			 "Unable to create manifest filename.\n" );
+
+			goto on_error;
+		}
+		if( system_string_copy(
+		     manifest_filename,
+		     source,
+		     source_length ) == NULL )
+		{
+			fprintf(
+			 stderr,
+			 "Unable to copy source to manifest filename.\n" );
+
+			goto on_error;
+		}
+		if( system_string_copy(
+		     &( manifest_filename[ source_length ] ),
+		     _SYSTEM_STRING( ".blocksum" ),
+		     9 ) == NULL )
+		{
+			fprintf(
+			 stderr,
+			 "Unable to copy extension to manifest filename.\n" );
+
+			goto on_error;
+		}
+		manifest_filename[ source_length + 9 ] = 0;
+
+		option_manifest = manifest_filename;
+	}
+	if( blocksum_manifest_initialize(
+	     &manifest,
+	     &error ) != 1 )
+	{
+		fprintf(
+		 stderr,
+		 "Unable to create manifest.\n" );
+
+		goto on_error;
+	}
+	/* Read the existing manifest when checking or resuming
+	 */
+	if( mode != BLOCKSUM_MODE_CREATE )
+	{
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+		stream = file_stream_open_wide(
+		          option_manifest,
+		          _WIDE_STRING( FILE_STREAM_OPEN_READ ) );
+#else
+		stream = file_stream_open(
+		          option_manifest,
+		          FILE_STREAM_OPEN_READ );
+#endif
+		if( stream == NULL )
+		{
+			fprintf(
+			 stderr,
+			 "Unable to open manifest: %" PRIs_SYSTEM ".\n",
+			 option_manifest );
+
+			goto on_error;
+		}
+		if( blocksum_manifest_read(
+		     manifest,
+		     stream,
+		     &error ) != 1 )
+		{
+			fprintf(
+			 stderr,
+			 "Unable to read manifest.\n" );
+
+			goto on_error;
+		}
+		file_stream_close(
+		 stream );
+
+		stream = NULL;
+
+		definition = manifest->definition;
+		block_size = manifest->block_size;
+	}
+	/* Open the source file
+	 */
+	if( blocksum_get_modification_time(
+	     source,
+	     &modification_time,
+	     &error ) != 1 )
+	{
+		fprintf(
+		 stderr,
+		 "Unable to determine modification time of source file.\n" );
+
+		goto on_error;
+	}
+	if( assorted_input_file_initialize(
+	     &source_file,
+	     &error ) != 1 )
+	{
+		fprintf(
+		 stderr,
+		 "Unable to create source file.\n" );
+
+		goto on_error;
+	}
+	if( assorted_input_file_set_direct_io(
+	     source_file,
+	     direct_io_block_size,
+	     &error ) != 1 )
+	{
+		fprintf(
+		 stderr,
+		 "Unable to set direct I/O block size of source file.\n" );
+
+		goto on_error;
+	}
+	if( assorted_input_file_open(
+	     source_file,
+	     source,
+	     &error ) != 1 )
+	{
+		fprintf(
+		 stderr,
+		 "Unable to open source file.\n" );
+
+		goto on_error;
+	}
+	if( assorted_input_file_get_size(
+	     source_file,
+	     &source_size,
+	     &error ) == -1 )
+	{
+		fprintf(
+		 stderr,
+		 "Unable to determine size of source file.\n" );
+
+		goto on_error;
+	}
+	if( source_size == 0 )
+	{
+		fprintf(
+		 stderr,
+		 "Invalid source size value is zero.\n" );
+
+		goto on_error;
+	}
+	if( mode == BLOCKSUM_MODE_CHECK )
+	{
+		if( manifest->is_complete == 0 )
+		{
+			fprintf(
+			 stderr,
+			 "Manifest is incomplete, use -r to resume the calculation.\n" );
+
+			goto on_error;
+		}
+		/* The size and modification time of the source indicate if it changed
+		 */
+		if( ( full_check == 0 )
+		 && ( source_size == manifest->source_size )
+		 && ( modification_time == manifest->modification_time ) )
+		{
+			fprintf(
+			 stdout,
+			 "Size and modification time of source match the manifest, blocks not verified.\n" );
+
+			block_index  = manifest->number_of_blocks;
+			block_offset = source_size;
+			value        = manifest->value;
+		}
+	}
+	else if( mode == BLOCKSUM_MODE_RESUME )
+	{
+		if( ( source_size != manifest->source_size )
+		 || ( modification_time != manifest->modification_time ) )
+		{
+			fprintf(
+			 stderr,
+			 "Source changed since the manifest was written, unable to resume.\n" );
+
+			goto on_error;
+		}
+		block_index  = manifest->number_of_blocks;
+		block_offset = (size64_t) block_index * block_size;
+		value        = manifest->value;
+
+		/* The manifest is written again, without a last line that was not completely written
+		 */
+		if( manifest->is_complete == 0 )
+		{
+			write_manifest = 1;
+		}
+		if( verbose != 0 )
+		{
+			fprintf(
+			 stderr,
+			 "Resuming at block: %" PRIu64 " of manifest.\n",
+			 block_index );
+		}
+	}
+	else
+	{
+		manifest->definition        = definition;
+		manifest->block_size        = block_size;
+		manifest->source_size       = source_size;
+		manifest->modification_time = modification_time;
+
+		write_manifest = 1;
+	}
+	if( write_manifest != 0 )
+	{
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+		stream = file_stream_open_wide(
+		          option_manifest,
+		          _WIDE_STRING( FILE_STREAM_OPEN_WRITE ) );
+#else
+		stream = file_stream_open(
+		          option_manifest,
+		          FILE_STREAM_OPEN_WRITE );
+#endif
+		if( stream == NULL )
+		{
+			fprintf(
+			 stderr,
+			 "Unable to open manifest: %" PRIs_SYSTEM ".\n",
+			 option_manifest );
+
+			goto on_error;
+		}
+		if( blocksum_manifest_write_header(
+		     manifest,
+		     stream,
+		     &error ) != 1 )
+		{
+			fprintf(
+			 stderr,
+			 "Unable to write manifest header.\n" );
+
+			goto on_error;
+		}
+		for( block_index = 0;
+		     block_index < manifest->number_of_blocks;
+		     block_index++ )
+		{
+			if( blocksum_manifest_write_block_value(
+			     stream,
+			     block_index,
+			     manifest->block_values[ block_index ],
+			     &error ) != 1 )
+			{
+				fprintf(
+				 stderr,
+				 "Unable to write manifest block value.\n" );
+
+				goto on_error;
+			}
+		}
+	}
+	if( block_offset < source_size )
+	{
+		/* Position the source file at the offset of the first block to calculate
+		 */
+		if( assorted_input_file_seek_offset(
+		     source_file,
+		     (off64_t) block_offset,
+		     SEEK_SET,
+		     &error ) == -1 )
+		{
+			fprintf(
+			 stderr,
+			 "Unable to seek offset in source file.\n" );
+
+			goto on_error;
+		}
+		/* Read the next blocks ahead while the current block is processed
+		 */
+		if( assorted_input_file_set_read_ahead(
+		     source_file,
+		     block_size,
+		     ASSORTED_INPUT_FILE_DEFAULT_NUMBER_OF_READ_AHEAD_BLOCKS,
+		     &error ) != 1 )
+		{
+			fprintf(
+			 stderr,
+			 "Unable to set read-ahead of source file.\n" );
+
+			goto on_error;
+		}
+	}
+	while( block_offset < source_size )
+	{
+		read_size = block_size;
+
+		if( (size64_t) read_size > ( source_size - block_offset ) )
+		{
+			read_size = (size_t) ( source_size - block_offset );
+		}
+		read_count = assorted_input_file_read_data(
+		              source_file,
+		              &buffer,
+		              read_size,
+		              &error );
+
+		if( read_count != (ssize_t) read_size )
+		{
+			fprintf(
+			 stderr,
+			 "Unable to read from source file.\n" );
+
+			goto on_error;
+		}
+		if( blocksum_calculate_block_value(
+		     definition->digest_type,
+		     buffer,
+		     read_size,
+		     &block_value,
+		     &error ) != 1 )
+		{
+			fprintf(
+			 stderr,
+			 "Unable to calculate %s of block: %" PRIu64 ".\n",
+			 definition->description,
+			 block_index );
+
+			goto on_error;
+		}
+		if( blocksum_append_block_value(
+		     definition->digest_type,
+		     &value,
+		     block_index,
+		     block_value,
+		     read_size,
+		     &error ) != 1 )
+		{
+			fprintf(
+			 stderr,
+			 "Unable to combine %s of block: %" PRIu64 ".\n",
+			 definition->description,
+			 block_index );
+
+			goto on_error;
+		}
+		if( mode == BLOCKSUM_MODE_CHECK )
+		{
+			if( block_index >= manifest->number_of_blocks )
+			{
+				fprintf(
+				 stdout,
+				 "Block: %" PRIu64 " at offset: %" PRIu64 " is not in the manifest.\n",
+				 block_index,
+				 block_offset );
+
+				number_of_differing_blocks++;
+			}
+			else if( block_value != manifest->block_values[ block_index ] )
+			{
+				fprintf(
+				 stdout,
+				 "Block: %" PRIu64 " at offset: %" PRIu64 " differs, calculated %s: 0x%08" PRIx32 ", stored: 0x%08" PRIx32 ".\n",
+				 block_index,
+				 block_offset,
+				 definition->description,
+				 block_value,
+				 manifest->block_values[ block_index ] );
+
+				number_of_differing_blocks++;
+			}
+		}
+		else if( blocksum_manifest_write_block_value(
+		          stream,
+		          block_index,
+		          block_value,
+		          &error ) != 1 )
+		{
+			fprintf(
+			 stderr,
+			 "Unable to write manifest block value.\n" );
+
+			goto on_error;
+		}
+		block_offset += read_size;
+		block_index++;
+	}
+	if( stream != NULL )
+	{
+		if( fprintf(
+		     stream,
+		     "value: 0x%08" PRIx32 "\n",
+		     value ) < 0 )
+		{
+			fprintf(
+			 stderr,
+			 "Unable to write manifest value.\n" );
+
+			goto on_error;
+		}
+		if( file_stream_close(
+		     stream ) != 0 )
+		{
+			stream = NULL;
+
+			fprintf(
+			 stderr,
+			 "Unable to close manifest.\n" );
+
+			goto on_error;
+		}
+		stream = NULL;
+	}
+	/* Clean up
+	 */
+	if( assorted_input_file_close(
+	     source_file,
+	     &error ) != 0 )
+	{
+		fprintf(
+		 stderr,
+		 "Unable to close source file.\n" );
+
+		goto on_error;
+	}
+	if( assorted_input_file_free(
+	     &source_file,
+	     &error ) != 1 )
+	{
+		fprintf(
+		 stderr,
+		 "Unable to free source file.\n" );
+
+		goto on_error;
+	}
+	fprintf(
+	 stdout,
+	 "Calculated %s: %" PRIu32 " (0x%08" PRIx32 ")\n",
+	 definition->description,
+	 value,
+	 value );
+
+	if( mode == BLOCKSUM_MODE_CHECK )
+	{
+		if( block_index < manifest->number_of_blocks )
+		{
+			fprintf(
+			 stdout,
+			 "Number of blocks in manifest: %" PRIu64 " exceeds number of blocks in source: %" PRIu64 ".\n",
+			 manifest->number_of_blocks,
+			 block_index );
+
+			number_of_differing_blocks += manifest->number_of_blocks - block_index;
+		}
+		fprintf(
+		 stdout,
+		 "Number of differing blocks: %" PRIu64 "\n",
+		 number_of_differing_blocks );
+	}
+	if( blocksum_manifest_free(
+	     &manifest,
+	     &error ) != 1 )
+	{
+		fprintf(
+		 stderr,
+		 "Unable to free manifest.\n" );
+
+		goto on_error;
+	}
+	if( manifest_filename != NULL )
+	{
+		memory_free(
+		 manifest_filename );
+	}
+	assorted_output_statistics_fprint(
+	 stderr,
+	 program,
+	 1,
+	 NULL );
+	assorted_output_statistics_free(
+	 NULL );
+
+	if( number_of_differing_blocks != 0 )
+	{
+		return( EXIT_FAILURE );
+	}
+	return( EXIT_SUCCESS );
+
+on_error:
+	if( error != NULL )
+	{
+		libcnotify_print_error_backtrace(
+		 error );
+		libcerror_error_free(
+		 &error );
+	}
+	assorted_output_statistics_fprint(
+	 stderr,
+	 program,
+	 -1,
+	 NULL );
+	assorted_output_statistics_free(
+	 NULL );
+	if( stream != NULL )
+	{
+		file_stream_close(
+		 stream );
+	}
+	if( source_file != NULL )
+	{
+		assorted_input_file_free(
+		 &source_file,
+		 NULL );
+	}
+	if( manifest != NULL )
+	{
+		blocksum_manifest_free(
+		 &manifest,
+		 NULL );
+	}
+	if( manifest_filename != NULL )
+	{
+		memory_free(
+		 manifest_filename );
+	}
+	return( EXIT_FAILURE );
+}
+
@@ -0,0 +1,507 @@
+/*
+ * Cabinet (CAB) archive functions
+ *
+ * Copyright (C) 2008-2019, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This software is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This software is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this software.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <byte_stream.h>
+#include <memory.h>
+#include <types.h>
+
+#include "assorted_libcerror.h"
+#include "cab_archive.h"
+#include "xor32.h"
+
+/* Reads the cabinet header
+ * The data must contain the header including the reserved area and cabinet names
+ * Returns 1 if successful or -1 on error
+ */
+int cab_archive_read_header(
+     cab_archive_header_t *header,
+     const uint8_t *data,
+     size_t data_size,
+     libcerror_error_t **error )
+{
+	static char *function         = "cab_archive_read_header";
+	size_t data_offset            = 0;
+	uint16_t header_reserved_size = 0;
+	int number_of_names           = 0;
+
+	if( header == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid header.",
+		 function );
+
+		return( -1 );
+	}
+	if( data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid data.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( data_size < CAB_ARCHIVE_HEADER_SIZE )
+	 || ( data_size > (size_t) SSIZE_MAX ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid data size value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( data[ 0 ] != 'M' )
+	 || ( data[ 1 ] != 'S' )
+	 || ( data[ 2 ] != 'C' )
+	 || ( data[ 3 ] != 'F' ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_UNSUPPORTED_VALUE,
+		 "%s: unsupported cabinet header signature.",
+		 function );
+
+		return( -1 );
+	}
+	byte_stream_copy_to_uint32_little_endian(
+	 &( data[ 8 ] ),
+	 header->cabinet_size );
+
+	byte_stream_copy_to_uint16_little_endian(
+	 &( data[ 26 ] ),
+	 header->number_of_folders );
+
+	byte_stream_copy_to_uint16_little_endian(
+	 &( data[ 28 ] ),
+	 header->number_of_files );
+
+	byte_stream_copy_to_uint16_little_endian(
+	 &( data[ 30 ] ),
+	 header->flags );
+
+	header->folder_reserved_size     = 0;
+	header->data_block_reserved_size = 0;
+
+	data_offset = CAB_ARCHIVE_HEADER_SIZE;
+
+	if( ( header->flags & CAB_ARCHIVE_FLAG_RESERVE_PRESENT ) != 0 )
+	{
+		if( ( data_size - data_offset ) < 4 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+			 "%s: invalid data size value too small for reserved area sizes.",
+			 function );
+
+			return( -1 );
+		}
+		byte_stream_copy_to_uint16_little_endian(
+		 &( data[ data_offset ] ),
+		 header_reserved_size );
+
+		header->folder_reserved_size     = data[ data_offset + 2 ];
+		header->data_block_reserved_size = data[ data_offset + 3 ];
+
+		data_offset += 4;
+
+		if( (size_t) header_reserved_size > ( data_size - data_offset ) )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+			 "%s: invalid header reserved size value out of bounds.",
+			 function );
+
+			return( -1 );
+		}
+		data_offset += header_reserved_size;
+	}
+	/* The name of the cabinet and the disk are stored for the previous and the next cabinet
+	 */
+	if( ( header->flags & CAB_ARCHIVE_FLAG_PREVIOUS_CABINET ) != 0 )
+	{
+		number_of_names += 2;
+	}
+	if( ( header->flags & CAB_ARCHIVE_FLAG_NEXT_CABINET ) != 0 )
+	{
+		number_of_names += 2;
+	}
+	while( number_of_names > 0 )
+	{
+		while( ( data_offset < data_size )
+		    && ( data[ data_offset ] != 0 ) )
+		{
+			data_offset++;
+		}
+		if( data_offset >= data_size )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+			 "%s: invalid cabinet name value out of bounds.",
+			 function );
+
+			return( -1 );
+		}
+		data_offset++;
+
+		number_of_names--;
+	}
+	header->header_size = data_offset;
+
+	return( 1 );
+}
+
+/* Reads a folder entry
+ * Returns 1 if successful or -1 on error
+ */
+int cab_archive_folder_read(
+     cab_archive_folder_t *folder,
+     const uint8_t *data,
+     size_t data_size,
+     libcerror_error_t **error )
+{
+	static char *function = "cab_archive_folder_read";
+
+	if( folder == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid folder.",
+		 function );
+
+		return( -1 );
+	}
+	if( data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid data.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( data_size < CAB_ARCHIVE_FOLDER_SIZE )
+	 || ( data_size > (size_t) SSIZE_MAX ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid data size value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	byte_stream_copy_to_uint32_little_endian(
+	 &( data[ 0 ] ),
+	 folder->data_offset );
+
+	byte_stream_copy_to_uint16_little_endian(
+	 &( data[ 4 ] ),
+	 folder->number_of_data_blocks );
+
+	byte_stream_copy_to_uint16_little_endian(
+	 &( data[ 6 ] ),
+	 folder->compression_type );
+
+	return( 1 );
+}
+
+/* Reads a data block header
+ * The data must contain the reserved area of the data block header, if present,
+ * since it is included in the checksum
+ * Returns 1 if successful or -1 on error
+ */
+int cab_archive_data_block_read_header(
+     cab_archive_data_block_t *data_block,
+     const uint8_t *data,
+     size_t data_size,
+     libcerror_error_t **error )
+{
+	static char *function = "cab_archive_data_block_read_header";
+
+	if( data_block == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid data block.",
+		 function );
+
+		return( -1 );
+	}
+	if( data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid data.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( data_size < CAB_ARCHIVE_DATA_BLOCK_HEADER_SIZE )
+	 || ( data_size > (size_t) SSIZE_MAX ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid data size value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	byte_stream_copy_to_uint32_little_endian(
+	 &( data[ 0 ] ),
+	 data_block->checksum );
+
+	byte_stream_copy_to_uint16_little_endian(
+	 &( data[ 4 ] ),
+	 data_block->compressed_size );
+
+	byte_stream_copy_to_uint16_little_endian(
+	 &( data[ 6 ] ),
+	 data_block->uncompressed_size );
+
+	if( data_block->compressed_size > CAB_ARCHIVE_MAXIMUM_COMPRESSED_BLOCK_SIZE )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid compressed size value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( data_block->uncompressed_size > CAB_ARCHIVE_MAXIMUM_UNCOMPRESSED_BLOCK_SIZE )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid uncompressed size value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	/* The checksum of the compressed and uncompressed size and the reserved area
+	 */
+	if( cab_archive_calculate_checksum(
+	     &( data_block->header_checksum ),
+	     &( data[ 4 ] ),
+	     data_size - 4,
+	     0,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GENERIC,
+		 "%s: unable to calculate header checksum.",
+		 function );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Calculates the checksum of data block data
+ * The checksum is the XOR of the 32-bit little-endian values of the data, where
+ * the remaining 1 to 3 bytes are combined in big-endian order into the last value
+ * The 32-bit values are calculated with the SIMD XOR-32 variant
+ * It uses the initial value to calculate a new checksum
+ * Returns 1 if successful or -1 on error
+ */
+int cab_archive_calculate_checksum(
+     uint32_t *checksum_value,
+     const uint8_t *data,
+     size_t data_size,
+     uint32_t initial_value,
+     libcerror_error_t **error )
+{
+	static char *function = "cab_archive_calculate_checksum";
+	size_t aligned_size   = 0;
+	uint32_t value_32bit  = 0;
+
+	if( checksum_value == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid checksum value.",
+		 function );
+
+		return( -1 );
+	}
+	if( data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid data.",
+		 function );
+
+		return( -1 );
+	}
+	if( data_size > (size_t) SSIZE_MAX )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid data size value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	aligned_size = data_size & ~( (size_t) 3 );
+
+	if( checksum_calculate_little_endian_xor32_simd(
+	     checksum_value,
+	     data,
+	     aligned_size,
+	     initial_value,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GENERIC,
+		 "%s: unable to calculate XOR-32.",
+		 function );
+
+		return( -1 );
+	}
+	switch( data_size - aligned_size )
+	{
+		case 3:
+			value_32bit = ( (uint32_t) data[ aligned_size ] << 16 )
+			            | ( (uint32_t) data[ aligned_size + 1 ] << 8 )
+			            | data[ aligned_size + 2 ];
+			break;
+
+		case 2:
+			value_32bit = ( (uint32_t) data[ aligned_size ] << 8 )
+			            | data[ aligned_size + 1 ];
+			break;
+
+		case 1:
+			value_32bit = data[ aligned_size ];
+			break;
+
+		default:
+			break;
+	}
+	*checksum_value ^= value_32bit;
+
+	return( 1 );
+}
+
+/* Verifies the checksum of a data block
+ * The checksum of the compressed data is combined with the checksum of the data block
+ * header, that was calculated when the header was read
+ * Returns 1 if the checksum matches or the data block has no checksum, 0 if not or -1 on error
+ */
+int cab_archive_data_block_verify_checksum(
+     const cab_archive_data_block_t *data_block,
+     const uint8_t *compressed_data,
+     size_t compressed_data_size,
+     libcerror_error_t **error )
+{
+	static char *function        = "cab_archive_data_block_verify_checksum";
+	uint32_t calculated_checksum = 0;
+
+	if( data_block == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid data block.",
+		 function );
+
+		return( -1 );
+	}
+	if( compressed_data_size != (size_t) data_block->compressed_size )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid compressed data size value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( data_block->checksum == 0 )
+	{
+		return( 1 );
+	}
+	if( cab_archive_calculate_checksum(
+	     &calculated_checksum,
+	     compressed_data,
+	     compressed_data_size,
+	     0,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GENERIC,
+		 "%s: unable to calculate checksum.",
+		 function );
+
+		return( -1 );
+	}
+	calculated_checksum ^= data_block->header_checksum;
+
+	if( calculated_checksum != data_block->checksum )
+	{
+		return( 0 );
+	}
+	return( 1 );
+}
+
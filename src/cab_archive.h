@@ -0,0 +1,189 @@
+/*
+ * Cabinet (CAB) archive functions
+ *
+ * Copyright (C) 2008-2019, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This software is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This software is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this software.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+
+#if !defined( _CAB_ARCHIVE_H )
+#define _CAB_ARCHIVE_H
+
+#include <common.h>
+#include <types.h>
+
+#include "assorted_libcerror.h"
+
+#if defined( __cplusplus )
+extern "C" {
+#endif
+
+/* The size of the cabinet header without the reserved area sizes, reserved area and cabinet names
+ */
+#define CAB_ARCHIVE_HEADER_SIZE				36
+
+/* The maximum size of the cabinet header including the reserved area sizes, a reserved area
+ * of at most 65535 bytes and the 4 names of the previous and next cabinet and disk
+ */
+#define CAB_ARCHIVE_MAXIMUM_HEADER_SIZE \
+	( CAB_ARCHIVE_HEADER_SIZE + 4 + 65535 + ( 4 * 256 ) )
+
+/* The size of a folder entry without the reserved area
+ */
+#define CAB_ARCHIVE_FOLDER_SIZE				8
+
+/* The size of a data block header without the reserved area
+ */
+#define CAB_ARCHIVE_DATA_BLOCK_HEADER_SIZE		8
+
+/* The maximum size of the uncompressed data of a data block
+ */
+#define CAB_ARCHIVE_MAXIMUM_UNCOMPRESSED_BLOCK_SIZE	32768
+
+/* The maximum size of the compressed data of a data block
+ */
+#define CAB_ARCHIVE_MAXIMUM_COMPRESSED_BLOCK_SIZE	( 32768 + 6144 )
+
+/* The header flags
+ */
+enum CAB_ARCHIVE_FLAGS
+{
+	CAB_ARCHIVE_FLAG_PREVIOUS_CABINET		= 0x0001,
+	CAB_ARCHIVE_FLAG_NEXT_CABINET			= 0x0002,
+	CAB_ARCHIVE_FLAG_RESERVE_PRESENT		= 0x0004
+};
+
+/* The compression types, which are stored in the lower 4 bits of the folder compression type
+ */
+enum CAB_ARCHIVE_COMPRESSION_TYPES
+{
+	CAB_ARCHIVE_COMPRESSION_TYPE_NONE		= 0,
+	CAB_ARCHIVE_COMPRESSION_TYPE_MSZIP		= 1,
+	CAB_ARCHIVE_COMPRESSION_TYPE_QUANTUM		= 2,
+	CAB_ARCHIVE_COMPRESSION_TYPE_LZX		= 3
+};
+
+typedef struct cab_archive_header cab_archive_header_t;
+
+struct cab_archive_header
+{
+	/* The size of the cabinet
+	 */
+	uint32_t cabinet_size;
+
+	/* The number of folders
+	 */
+	uint16_t number_of_folders;
+
+	/* The number of files
+	 */
+	uint16_t number_of_files;
+
+	/* The flags
+	 */
+	uint16_t flags;
+
+	/* The size of the reserved area of every folder entry
+	 */
+	uint8_t folder_reserved_size;
+
+	/* The size of the reserved area of every data block header
+	 */
+	uint8_t data_block_reserved_size;
+
+	/* The size of the header including the reserved area and cabinet names,
+	 * which is the offset of the first folder entry
+	 */
+	size_t header_size;
+};
+
+typedef struct cab_archive_folder cab_archive_folder_t;
+
+struct cab_archive_folder
+{
+	/* The offset of the first data block
+	 */
+	uint32_t data_offset;
+
+	/* The number of data blocks
+	 */
+	uint16_t number_of_data_blocks;
+
+	/* The compression type
+	 */
+	uint16_t compression_type;
+};
+
+typedef struct cab_archive_data_block cab_archive_data_block_t;
+
+struct cab_archive_data_block
+{
+	/* The checksum, where 0 represents no checksum
+	 */
+	uint32_t checksum;
+
+	/* The size of the compressed data
+	 */
+	uint16_t compressed_size;
+
+	/* The size of the uncompressed data
+	 */
+	uint16_t uncompressed_size;
+
+	/* The checksum of the data block header following the checksum,
+	 * which includes the reserved area
+	 */
+	uint32_t header_checksum;
+};
+
+int cab_archive_read_header(
+     cab_archive_header_t *header,
+     const uint8_t *data,
+     size_t data_size,
+     libcerror_error_t **error );
+
+int cab_archive_folder_read(
+     cab_archive_folder_t *folder,
+     const uint8_t *data,
+     size_t data_size,
+     libcerror_error_t **error );
+
+int cab_archive_data_block_read_header(
+     cab_archive_data_block_t *data_block,
+     const uint8_t *data,
+     size_t data_size,
+     libcerror_error_t **error );
+
+int cab_archive_calculate_checksum(
+     uint32_t *checksum_value,
+     const uint8_t *data,
+     size_t data_size,
+     uint32_t initial_value,
+     libcerror_error_t **error );
+
+int cab_archive_data_block_verify_checksum(
+     const cab_archive_data_block_t *data_block,
+     const uint8_t *compressed_data,
+     size_t compressed_data_size,
+     libcerror_error_t **error );
+
+#if defined( __cplusplus )
+}
+#endif
+
+#endif /* !defined( _CAB_ARCHIVE_H ) */
+
@@ -0,0 +1,1035 @@
+/*
+ * Benchmarks the checksum calculation methods
+ *
+ * Copyright (C) 2008-2019, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This software is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This software is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this software.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <file_stream.h>
+#include <memory.h>
+#include <system_string.h>
+#include <types.h>
+
+#if defined( HAVE_STDLIB_H )
+#include <stdlib.h>
+#endif
+
+#if defined( HAVE_ZLIB ) || defined( ZLIB_DLL )
+#include <zlib.h>
+#endif
+
+#include "adler32.h"
+#include "assorted_getopt.h"
+#include "assorted_libcerror.h"
+#include "assorted_libcnotify.h"
+#include "assorted_output.h"
+#include "assorted_timer.h"
+#include "crc32.h"
+#include "crc64.h"
+#include "fletcher32.h"
+#include "fletcher64.h"
+#include "xor32.h"
+#include "xor64.h"
+
+/* The maximum number of buffer sizes and alignments
+ */
+#define CHECKSUMBENCH_MAXIMUM_NUMBER_OF_VALUES	16
+
+/* The maximum size of the buffer
+ */
+#define CHECKSUMBENCH_MAXIMUM_BUFFER_SIZE	( 1024 * 1024 * 1024 )
+
+/* The default amount of data processed per measurement
+ */
+#define CHECKSUMBENCH_DEFAULT_TOTAL_SIZE	( 64 * 1024 * 1024 )
+
+enum CHECKSUMBENCH_CHECKSUM_TYPES
+{
+	CHECKSUMBENCH_CHECKSUM_TYPE_ADLER32	= 1,
+	CHECKSUMBENCH_CHECKSUM_TYPE_CRC32,
+	CHECKSUMBENCH_CHECKSUM_TYPE_CRC64,
+	CHECKSUMBENCH_CHECKSUM_TYPE_FLETCHER32,
+	CHECKSUMBENCH_CHECKSUM_TYPE_FLETCHER64,
+	CHECKSUMBENCH_CHECKSUM_TYPE_XOR32,
+	CHECKSUMBENCH_CHECKSUM_TYPE_XOR64
+};
+
+typedef struct checksumbench_method checksumbench_method_t;
+
+struct checksumbench_method
+{
+	/* The checksum type
+	 */
+	int checksum_type;
+
+	/* The checksum name
+	 */
+	const system_character_t *checksum_name;
+
+	/* The calculation method
+	 */
+	int calculation_method;
+
+	/* The calculation method name
+	 */
+	const char *method_name;
+};
+
+/* The checksum calculation methods, terminated by an empty entry
+ */
+checksumbench_method_t checksumbench_methods[] = {
+	{ CHECKSUMBENCH_CHECKSUM_TYPE_ADLER32, _SYSTEM_STRING( "adler32" ), 1, "basic1" },
+	{ CHECKSUMBENCH_CHECKSUM_TYPE_ADLER32, _SYSTEM_STRING( "adler32" ), 2, "basic2" },
+	{ CHECKSUMBENCH_CHECKSUM_TYPE_ADLER32, _SYSTEM_STRING( "adler32" ), 3, "unfolded4_1" },
+	{ CHECKSUMBENCH_CHECKSUM_TYPE_ADLER32, _SYSTEM_STRING( "adler32" ), 4, "unfolded4_2" },
+	{ CHECKSUMBENCH_CHECKSUM_TYPE_ADLER32, _SYSTEM_STRING( "adler32" ), 5, "unfolded16_1" },
+	{ CHECKSUMBENCH_CHECKSUM_TYPE_ADLER32, _SYSTEM_STRING( "adler32" ), 6, "unfolded16_2" },
+	{ CHECKSUMBENCH_CHECKSUM_TYPE_ADLER32, _SYSTEM_STRING( "adler32" ), 7, "unfolded16_3" },
+	{ CHECKSUMBENCH_CHECKSUM_TYPE_ADLER32, _SYSTEM_STRING( "adler32" ), 8, "unfolded16_4" },
+	{ CHECKSUMBENCH_CHECKSUM_TYPE_ADLER32, _SYSTEM_STRING( "adler32" ), 9, "cpu_aligned" },
+	{ CHECKSUMBENCH_CHECKSUM_TYPE_ADLER32, _SYSTEM_STRING( "adler32" ), 10, "simd" },
+#if defined( HAVE_ZLIB_ADLER32 )
+	{ CHECKSUMBENCH_CHECKSUM_TYPE_ADLER32, _SYSTEM_STRING( "adler32" ), 11, "zlib" },
+#endif
+	{ CHECKSUMBENCH_CHECKSUM_TYPE_CRC32, _SYSTEM_STRING( "crc32" ), 1, "modulo2" },
+	{ CHECKSUMBENCH_CHECKSUM_TYPE_CRC32, _SYSTEM_STRING( "crc32" ), 2, "table" },
+	{ CHECKSUMBENCH_CHECKSUM_TYPE_CRC32, _SYSTEM_STRING( "crc32" ), 3, "slicing_by_8" },
+	{ CHECKSUMBENCH_CHECKSUM_TYPE_CRC32, _SYSTEM_STRING( "crc32" ), 4, "slicing_by_16" },
+	{ CHECKSUMBENCH_CHECKSUM_TYPE_CRC32, _SYSTEM_STRING( "crc32" ), 5, "hardware" },
+	{ CHECKSUMBENCH_CHECKSUM_TYPE_CRC64, _SYSTEM_STRING( "crc64" ), 1, "table1" },
+	{ CHECKSUMBENCH_CHECKSUM_TYPE_CRC64, _SYSTEM_STRING( "crc64" ), 2, "table2" },
+	{ CHECKSUMBENCH_CHECKSUM_TYPE_CRC64, _SYSTEM_STRING( "crc64" ), 3, "slicing_by_8" },
+	{ CHECKSUMBENCH_CHECKSUM_TYPE_CRC64, _SYSTEM_STRING( "crc64" ), 4, "hardware" },
+	{ CHECKSUMBENCH_CHECKSUM_TYPE_FLETCHER32, _SYSTEM_STRING( "fletcher32" ), 1, "basic" },
+	{ CHECKSUMBENCH_CHECKSUM_TYPE_FLETCHER32, _SYSTEM_STRING( "fletcher32" ), 2, "deferred" },
+	{ CHECKSUMBENCH_CHECKSUM_TYPE_FLETCHER32, _SYSTEM_STRING( "fletcher32" ), 3, "simd" },
+	{ CHECKSUMBENCH_CHECKSUM_TYPE_FLETCHER64, _SYSTEM_STRING( "fletcher64" ), 1, "basic" },
+	{ CHECKSUMBENCH_CHECKSUM_TYPE_FLETCHER64, _SYSTEM_STRING( "fletcher64" ), 2, "simd" },
+	{ CHECKSUMBENCH_CHECKSUM_TYPE_XOR32, _SYSTEM_STRING( "xor32" ), 1, "basic" },
+	{ CHECKSUMBENCH_CHECKSUM_TYPE_XOR32, _SYSTEM_STRING( "xor32" ), 2, "cpu_aligned" },
+	{ CHECKSUMBENCH_CHECKSUM_TYPE_XOR32, _SYSTEM_STRING( "xor32" ), 3, "simd" },
+	{ CHECKSUMBENCH_CHECKSUM_TYPE_XOR64, _SYSTEM_STRING( "xor64" ), 1, "basic" },
+	{ CHECKSUMBENCH_CHECKSUM_TYPE_XOR64, _SYSTEM_STRING( "xor64" ), 2, "cpu_aligned" },
+	{ CHECKSUMBENCH_CHECKSUM_TYPE_XOR64, _SYSTEM_STRING( "xor64" ), 3, "simd" },
+	{ 0, NULL, 0, NULL } };
+
+/* Prints the executable usage information
+ */
+void usage_fprint(
+      FILE *stream )
+{
+	if( stream == NULL )
+	{
+		return;
+	}
+	fprintf( stream, "Use checksumbench to benchmark the checksum calculation methods.\n\n" );
+
+	fprintf( stream, "Usage: checksumbench [ -a alignment ] [ -c checksum ] [ -s size ]\n"
+	                 "                     [ -S format ] [ -t total_size ] [ -hvV ]\n\n" );
+
+	fprintf( stream, "\t-a:     offset of the buffer relative to a 64-byte boundary,\n"
+	                 "\t        can be specified multiple times (default is 0)\n" );
+	fprintf( stream, "\t-c:     only benchmark a specific checksum, options: adler32,\n"
+	                 "\t        crc32, crc64, fletcher32, fletcher64, xor32, xor64\n" );
+	fprintf( stream, "\t-h:     shows this help\n" );
+	fprintf( stream, "\t-s:     size of the buffer, can be specified multiple times\n"
+	                 "\t        (default is 64, 4096, 65536 and 1048576)\n" );
+	fprintf( stream, "\t-S:     print timing and throughput statistics of the open,\n"
+	                 "\t        read, compute and write phases and the peak memory\n"
+	                 "\t        size to stderr in the format: text or json\n" );
+	fprintf( stream, "\t-t:     amount of data to process per measurement\n"
+	                 "\t        (default is 67108864)\n" );
+	fprintf( stream, "\t-v:     verbose output to stderr\n" );
+	fprintf( stream, "\t-V:     print version\n" );
+	fprintf( stream, "\n" );
+}
+
+/* Calculates the checksum of a buffer using a specific calculation method
+ * The checksum value is used as the initial value and contains the calculated checksum on return
+ * Returns 1 if successful or -1 on error
+ */
+int checksumbench_calculate(
+     int checksum_type,
+     int calculation_method,
+     uint8_t *buffer,
+     size_t size,
+     uint64_t *checksum_value,
+     libcerror_error_t **error )
+{
+	static char *function = "checksumbench_calculate";
+	uint64_t value_64bit  = 0;
+	uint32_t value_32bit  = 0;
+	int result            = -1;
+
+	if( checksum_value == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid checksum value.",
+		 function );
+
+		return( -1 );
+	}
+	value_32bit = (uint32_t) *checksum_value;
+	value_64bit = *checksum_value;
+
+	switch( checksum_type )
+	{
+		case CHECKSUMBENCH_CHECKSUM_TYPE_ADLER32:
+			switch( calculation_method )
+			{
+				case 1:
+					result = checksum_calculate_adler32_basic1(
+					          &value_32bit,
+					          buffer,
+					          size,
+					          value_32bit,
+					          error );
+					break;
+
+				case 2:
+					result = checksum_calculate_adler32_basic2(
+					          &value_32bit,
+					          buffer,
+					          size,
+					          value_32bit,
+					          error );
+					break;
+
+				case 3:
+					result = checksum_calculate_adler32_unfolded4_1(
+					          &value_32bit,
+					          buffer,
+					          size,
+					          value_32bit,
+					          error );
+					break;
+
+				case 4:
+					result = checksum_calculate_adler32_unfolded4_2(
+					          &value_32bit,
+					          buffer,
+					          size,
+					          value_32bit,
+					          error );
+					break;
+
+				case 5:
+					result = checksum_calculate_adler32_unfolded16_1(
+					          &value_32bit,
+					          buffer,
+					          size,
+					          value_32bit,
+					          error );
+					break;
+
+				case 6:
+					result = checksum_calculate_adler32_unfolded16_2(
+					          &value_32bit,
+					          buffer,
+					          size,
+					          value_32bit,
+					          error );
+					break;
+
+				case 7:
+					result = checksum_calculate_adler32_unfolded16_3(
+					          &value_32bit,
+					          buffer,
+					          size,
+					          value_32bit,
+					          error );
+					break;
+
+				case 8:
+					result = checksum_calculate_adler32_unfolded16_4(
+					          &value_32bit,
+					          buffer,
+					          size,
+					          value_32bit,
+					          error );
+					break;
+
+				case 9:
+					result = checksum_calculate_adler32_cpu_aligned(
+					          &value_32bit,
+					          buffer,
+					          size,
+					          value_32bit,
+					          error );
+					break;
+
+				case 10:
+					result = checksum_calculate_adler32_simd(
+					          &value_32bit,
+					          buffer,
+					          size,
+					          value_32bit,
+					          error );
+					break;
+
+#if defined( HAVE_ZLIB_ADLER32 )
+				case 11:
+					value_32bit = (uint32_t) adler32(
+					                          (uLong) value_32bit,
+					                          buffer,
+					                          (uInt) size );
+
+					result = 1;
+
+					break;
+#endif
+			}
+			value_64bit = (uint64_t) value_32bit;
+
+			break;
+
+		case CHECKSUMBENCH_CHECKSUM_TYPE_CRC32:
+			switch( calculation_method )
+			{
+				case 1:
+					result = crc32_calculate_modulo2(
+					          &value_32bit,
+					          buffer,
+					          size,
+					          value_32bit,
+					          0,
+					          error );
+					break;
+
+				case 2:
+					result = crc32_calculate(
+					          &value_32bit,
+					          buffer,
+					          size,
+					          value_32bit,
+					          0,
+					          error );
+					break;
+
+				case 3:
+					result = crc32_calculate_slicing_by_8(
+					          &value_32bit,
+					          buffer,
+					          size,
+					          value_32bit,
+					          0,
+					          error );
+					break;
+
+				case 4:
+					result = crc32_calculate_slicing_by_16(
+					          &value_32bit,
+					          buffer,
+					          size,
+					          value_32bit,
+					          0,
+					          error );
+					break;
+
+				case 5:
+					result = crc32_calculate_hardware(
+					          &value_32bit,
+					          buffer,
+					          size,
+					          value_32bit,
+					          0,
+					          error );
+					break;
+			}
+			value_64bit = (uint64_t) value_32bit;
+
+			break;
+
+		case CHECKSUMBENCH_CHECKSUM_TYPE_CRC64:
+			switch( calculation_method )
+			{
+				case 1:
+					result = crc64_calculate_1(
+					          &value_64bit,
+					          buffer,
+					          size,
+					          value_64bit,
+					          error );
+					break;
+
+				case 2:
+					result = crc64_calculate_2(
+					          &value_64bit,
+					          buffer,
+					          size,
+					          value_64bit,
+					          error );
+					break;
+
+				case 3:
+					result = crc64_calculate_slicing_by_8(
+					          &value_64bit,
+					          buffer,
+					          size,
+					          value_64bit,
+					          error );
+					break;
+
+				case 4:
+					result = crc64_calculate_hardware(
+					          &value_64bit,
+					          buffer,
+					          size,
+					          value_64bit,
+					          error );
+					break;
+			}
+			break;
+
+		case CHECKSUMBENCH_CHECKSUM_TYPE_FLETCHER32:
+			if( calculation_method == 1 )
+			{
+				result = fletcher32_calculate(
+				          value_32bit,
+				          buffer,
+				          size,
+				          &value_32bit,
+				          error );
+			}
+			else if( calculation_method == 2 )
+			{
+				result = fletcher32_calculate_deferred(
+				          value_32bit,
+				          buffer,
+				          size,
+				          &value_32bit,
+				          error );
+			}
+			else if( calculation_method == 3 )
+			{
+				result = fletcher32_calculate_simd(
+				          value_32bit,
+				          buffer,
+				          size,
+				          &value_32bit,
+				          error );
+			}
+			value_64bit = (uint64_t) value_32bit;
+
+			break;
+
+		case CHECKSUMBENCH_CHECKSUM_TYPE_FLETCHER64:
+			if( calculation_method == 1 )
+			{
+				result = fletcher64_calculate(
+				          value_64bit,
+				          buffer,
+				          size,
+				          &value_64bit,
+				          error );
+			}
+			else if( calculation_method == 2 )
+			{
+				result = fletcher64_calculate_simd(
+				          value_64bit,
+				          buffer,
+				          size,
+				          &value_64bit,
+				          error );
+			}
+			break;
+
+		case CHECKSUMBENCH_CHECKSUM_TYPE_XOR32:
+			if( calculation_method == 1 )
+			{
+				result = checksum_calculate_little_endian_xor32_basic(
+				          &value_32bit,
+				          buffer,
+				          size,
+				          value_32bit,
+				          error );
+			}
+			else if( calculation_method == 2 )
+			{
+				result = checksum_calculate_little_endian_xor32_cpu_aligned(
+				          &value_32bit,
+				          buffer,
+				          size,
+				          value_32bit,
+				          error );
+			}
+			else if( calculation_method == 3 )
+			{
+				result = checksum_calculate_little_endian_xor32_simd(
+				          &value_32bit,
+				          buffer,
+				          size,
+				          value_32bit,
+				          error );
+			}
+			value_64bit = (uint64_t) value_32bit;
+
+			break;
+
+		case CHECKSUMBENCH_CHECKSUM_TYPE_XOR64:
+			if( calculation_method == 1 )
+			{
+				result = checksum_calculate_little_endian_xor64_basic(
+				          &value_64bit,
+				          buffer,
+				          size,
+				          value_64bit,
+				          error );
+			}
+			else if( calculation_method == 2 )
+			{
+				result = checksum_calculate_little_endian_xor64_cpu_aligned(
+				          &value_64bit,
+				          buffer,
+				          size,
+				          value_64bit,
+				          error );
+			}
+			else if( calculation_method == 3 )
+			{
+				result = checksum_calculate_little_endian_xor64_simd(
+				          &value_64bit,
+				          buffer,
+				          size,
+				          value_64bit,
+				          error );
+			}
+			break;
+	}
+	if( result != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GENERIC,
+		 "%s: unable to calculate checksum.",
+		 function );
+
+		return( -1 );
+	}
+	*checksum_value = value_64bit;
+
+	return( 1 );
+}
+
+/* Measures the throughput of a checksum calculation method
+ * Returns 1 if successful or -1 on error
+ */
+int checksumbench_measure(
+     checksumbench_method_t *method,
+     uint8_t *buffer,
+     size_t size,
+     size64_t total_size,
+     double *megabytes_per_second,
+     double *cycles_per_byte,
+     libcerror_error_t **error )
+{
+	static char *function         = "checksumbench_measure";
+	uint64_t checksum_value       = 0;
+	uint64_t end_cycles           = 0;
+	uint64_t end_time             = 0;
+	uint64_t number_of_iterations = 0;
+	uint64_t iteration            = 0;
+	uint64_t start_cycles         = 0;
+	uint64_t start_time           = 0;
+	double number_of_bytes        = 0.0;
+
+	if( method == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid method.",
+		 function );
+
+		return( -1 );
+	}
+	if( size == 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_ZERO_OR_LESS,
+		 "%s: invalid size value zero or less.",
+		 function );
+
+		return( -1 );
+	}
+	if( megabytes_per_second == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid megabytes per second.",
+		 function );
+
+		return( -1 );
+	}
+	if( cycles_per_byte == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid cycles per byte.",
+		 function );
+
+		return( -1 );
+	}
+	number_of_iterations = (uint64_t) ( total_size / size );
+
+	if( number_of_iterations == 0 )
+	{
+		number_of_iterations = 1;
+	}
+	/* Warm up the caches and the lazy initialization of the calculation method
+	 */
+	if( checksumbench_calculate(
+	     method->checksum_type,
+	     method->calculation_method,
+	     buffer,
+	     size,
+	     &checksum_value,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GENERIC,
+		 "%s: unable to calculate checksum.",
+		 function );
+
+		return( -1 );
+	}
+	start_time   = assorted_timer_get_nanoseconds();
+	start_cycles = assorted_timer_get_cycles();
+
+	/* The checksum of the previous iteration is passed as the initial value
+	 * so that the calculations depend on each other
+	 */
+	for( iteration = 0;
+	     iteration < number_of_iterations;
+	     iteration++ )
+	{
+		if( checksumbench_calculate(
+		     method->checksum_type,
+		     method->calculation_method,
+		     buffer,
+		     size,
+		     &checksum_value,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GENERIC,
+			 "%s: unable to calculate checksum.",
+			 function );
+
+			return( -1 );
+		}
+	}
+	end_cycles = assorted_timer_get_cycles();
+	end_time   = assorted_timer_get_nanoseconds();
+
+	number_of_bytes = (double) number_of_iterations * (double) size;
+
+	if( end_time > start_time )
+	{
+		*megabytes_per_second = ( number_of_bytes * 1000.0 ) / (double) ( end_time - start_time );
+	}
+	else
+	{
+		*megabytes_per_second = 0.0;
+	}
+	if( end_cycles > start_cycles )
+	{
+		*cycles_per_byte = (double) ( end_cycles - start_cycles ) / number_of_bytes;
+	}
+	else
+	{
+		*cycles_per_byte = 0.0;
+	}
+	if( libcnotify_verbose != 0 )
+	{
+		libcnotify_printf(
+		 "%s: %" PRIs_SYSTEM " %s checksum: 0x%08" PRIx64 "\n",
+		 function,
+		 method->checksum_name,
+		 method->method_name,
+		 checksum_value );
+	}
+	return( 1 );
+}
+
+/* The main program
+ */
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+int wmain( int argc, wchar_t * const argv[] )
+#else
+int main( int argc, char * const argv[] )
+#endif
+{
+	size_t alignments[ CHECKSUMBENCH_MAXIMUM_NUMBER_OF_VALUES ];
+	size_t sizes[ CHECKSUMBENCH_MAXIMUM_NUMBER_OF_VALUES ];
+
+	checksumbench_method_t *method               = NULL;
+	libcerror_error_t *error                     = NULL;
+	system_character_t *option_statistics_format = NULL;
+	system_character_t *checksum_name            = NULL;
+	uint8_t *aligned_buffer                      = NULL;
+	uint8_t *buffer                              = NULL;
+	char *program                                = "checksumbench";
+	system_integer_t option                      = 0;
+	size64_t total_size                          = CHECKSUMBENCH_DEFAULT_TOTAL_SIZE;
+	size_t buffer_offset                         = 0;
+	size_t checksum_name_length                  = 0;
+	size_t maximum_alignment                     = 0;
+	size_t maximum_size                          = 0;
+	double cycles_per_byte                       = 0.0;
+	double megabytes_per_second                  = 0.0;
+	uint32_t random_value                        = 0x12345678UL;
+	int alignment_index                          = 0;
+	int number_of_alignments                     = 0;
+	int number_of_sizes                          = 0;
+	int size_index                               = 0;
+	int verbose                                  = 0;
+
+	assorted_output_version_fprint(
+	 stdout,
+	 program );
+
+	while( ( option = assorted_getopt(
+	                   argc,
+	                   argv,
+	                   _SYSTEM_STRING( "a:c:hs:S:t:vV" ) ) ) != (system_integer_t) -1 )
+	{
+		switch( option )
+		{
+			case '?':
+			default:
+				fprintf(
+				 stderr,
+				 "Invalid argument: %" PRIs_SYSTEM "\n",
+				 argv[ optind ] );
+
+				usage_fprint(
+				 stdout );
+
+				return( EXIT_FAILURE );
+
+			case 'a':
+				if( number_of_alignments >= CHECKSUMBENCH_MAXIMUM_NUMBER_OF_VALUES )
+				{
+					fprintf(
+					 stderr,
+					 "Too many alignments.\n" );
+
+					return( EXIT_FAILURE );
+				}
+				alignments[ number_of_alignments++ ] = (size_t) atol( optarg );
+
+				break;
+
+			case 'c':
+				checksum_name = optarg;
+
+				break;
+
+			case 'h':
+				usage_fprint(
+				 stdout );
+
+				return( EXIT_SUCCESS );
+
+			case 's':
+				if( number_of_sizes >= CHECKSUMBENCH_MAXIMUM_NUMBER_OF_VALUES )
+				{
+					fprintf(
+					 stderr,
+					 "Too many sizes.\n" );
+
+					return( EXIT_FAILURE );
+				}
+				sizes[ number_of_sizes++ ] = (size_t) atol( optarg );
+
+				break;
+
+			case 'S':
+				option_statistics_format = optarg;
+
+				break;
+
+			case 't':
+				total_size = (size64_t) atol( optarg );
+
+				break;
+
+			case 'v':
+				verbose = 1;
+
+				break;
+
+			case 'V':
+				assorted_output_copyright_fprint(
+				 stdout );
+
+				return( EXIT_SUCCESS );
+		}
+	}
+	libcnotify_stream_set(
+	 stderr,
+	 NULL );
+	libcnotify_verbose_set(
+	 verbose );
+
+	if( assorted_output_statistics_initialize(
+	     option_statistics_format,
+	     &error ) != 1 )
+	{
+		fprintf(
+		 stderr,
+		 "Unable to initialize statistics.\n" );
+
+		goto on_error;
+	}
+
+	if( number_of_alignments == 0 )
+	{
+		alignments[ number_of_alignments++ ] = 0;
+	}
+	if( number_of_sizes == 0 )
+	{
+		sizes[ number_of_sizes++ ] = 64;
+		sizes[ number_of_sizes++ ] = 4096;
+		sizes[ number_of_sizes++ ] = 65536;
+		sizes[ number_of_sizes++ ] = 1048576;
+	}
+	for( alignment_index = 0;
+	     alignment_index < number_of_alignments;
+	     alignment_index++ )
+	{
+		if( alignments[ alignment_index ] >= 64 )
+		{
+			fprintf(
+			 stderr,
+			 "Invalid alignment value exceeds maximum.\n" );
+
+			goto on_error;
+		}
+		if( alignments[ alignment_index ] > maximum_alignment )
+		{
+			maximum_alignment = alignments[ alignment_index ];
+		}
+	}
+	for( size_index = 0;
+	     size_index < number_of_sizes;
+	     size_index++ )
+	{
+		if( ( sizes[ size_index ] == 0 )
+		 || ( sizes[ size_index ] > (size_t) CHECKSUMBENCH_MAXIMUM_BUFFER_SIZE ) )
+		{
+			fprintf(
+			 stderr,
+			 "Invalid size value out of bounds.\n" );
+
+			goto on_error;
+		}
+		if( sizes[ size_index ] > maximum_size )
+		{
+			maximum_size = sizes[ size_index ];
+		}
+	}
+	if( checksum_name != NULL )
+	{
+		checksum_name_length = system_string_length(
+		                        checksum_name );
+
+		for( method = checksumbench_methods;
+		     method->checksum_name != NULL;
+		     method++ )
+		{
+			if( ( system_string_length(
+			       method->checksum_name ) == checksum_name_length )
+			 && ( system_string_compare(
+			       method->checksum_name,
+			       checksum_name,
+			       checksum_name_length ) == 0 ) )
+			{
+				break;
+			}
+		}
+		if( method->checksum_name == NULL )
+		{
+			fprintf(
+			 stderr,
+			 "Unsupported checksum: %" PRIs_SYSTEM "\n",
+			 checksum_name );
+
+			goto on_error;
+		}
+	}
+	/* Allocate additional space to align the buffer to a 64-byte boundary
+	 */
+	buffer = (uint8_t *) memory_allocate(
+	                      sizeof( uint8_t ) * ( maximum_size + 128 ) );
+
+	if( buffer == NULL )
+	{
+		fprintf(
+		 stderr,
+		 "Unable to create buffer.\n" );
+
+		goto on_error;
+	}
+	/* Fill the buffer with pseudo random data
+	 */
+	for( buffer_offset = 0;
+	     buffer_offset < maximum_size + 128;
+	     buffer_offset++ )
+	{
+		random_value = ( random_value * 1103515245UL ) + 12345;
+
+		buffer[ buffer_offset ] = (uint8_t) ( random_value >> 16 );
+	}
+	aligned_buffer = &( buffer[ 64 - ( (intptr_t) buffer % 64 ) ] );
+
+	initialize_crc32_table(
+	 0xedb88320UL );
+
+	initialize_crc64_table(
+	 0x9a6c9329ac4bc9b5ULL );
+
+	fprintf(
+	 stdout,
+	 "%-10s %-14s %10s %9s %10s %11s\n",
+	 "checksum",
+	 "method",
+	 "size",
+	 "alignment",
+	 "MB/s",
+	 "cycles/byte" );
+
+	for( method = checksumbench_methods;
+	     method->checksum_name != NULL;
+	     method++ )
+	{
+		if( checksum_name != NULL )
+		{
+			if( ( system_string_length(
+			       method->checksum_name ) != checksum_name_length )
+			 || ( system_string_compare(
+			       method->checksum_name,
+			       checksum_name,
+			       checksum_name_length ) != 0 ) )
+			{
+				continue;
+			}
+		}
+		for( size_index = 0;
+		     size_index < number_of_sizes;
+		     size_index++ )
+		{
+			for( alignment_index = 0;
+			     alignment_index < number_of_alignments;
+			     alignment_index++ )
+			{
+				if( checksumbench_measure(
+				     method,
+				     &( aligned_buffer[ alignments[ alignment_index ] ] ),
+				     sizes[ size_index ],
+				     total_size,
+				     &megabytes_per_second,
+				     &cycles_per_byte,
+				     &error ) != 1 )
+				{
+					fprintf(
+					 stderr,
+					 "Unable to measure %" PRIs_SYSTEM " %s.\n",
+					 method->checksum_name,
+					 method->method_name );
+
+					goto on_error;
+				}
+				fprintf(
+				 stdout,
+				 "%-10" PRIs_SYSTEM " %-14s %10" PRIzd " %9" PRIzd " %10.1f ",
+				 method->checksum_name,
+				 method->method_name,
+				 sizes[ size_index ],
+				 alignments[ alignment_index ],
+				 megabytes_per_second );
+
+				if( cycles_per_byte > 0.0 )
+				{
+					fprintf(
+					 stdout,
+					 "%11.2f\n",
+					 cycles_per_byte );
+				}
+				else
+				{
+					fprintf(
+					 stdout,
+					 "%11s\n",
+					 "n/a" );
+				}
+			}
+		}
+	}
+	memory_free(
+	 buffer );
+
+	assorted_output_statistics_fprint(
+	 stderr,
+	 program,
+	 1,
+	 NULL );
+	assorted_output_statistics_free(
+	 NULL );
+
+	return( EXIT_SUCCESS );
+
+on_error:
+	if( error != NULL )
+	{
+		libcnotify_print_error_backtrace(
+		 error );
+		libcerror_error_free(
+		 &error );
+	}
+	assorted_output_statistics_fprint(
+	 stderr,
+	 program,
+	 -1,
+	 NULL );
+	assorted_output_statistics_free(
+	 NULL );
+	if( buffer != NULL )
+	{
+		memory_free(
+		 buffer );
+	}
+	return( EXIT_FAILURE );
+}
+
@@ -0,0 +1,266 @@
+/*
+ * CPU feature detection functions
+ *
+ * Copyright (C) 2019, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This software is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This software is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this software.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <types.h>
+
+#include "cpu_features.h"
+
+#if defined( HAVE_CPU_FEATURES_X86 ) && defined( _MSC_VER )
+#include <intrin.h>
+#include <immintrin.h>
+
+#elif defined( HAVE_CPU_FEATURES_X86 )
+#include <cpuid.h>
+
+#elif defined( HAVE_CPU_FEATURES_ARM64 ) && defined( __linux__ )
+#include <sys/auxv.h>
+
+#endif
+
+/* The detected CPU features
+ * The value is read and written atomically since cpu_features_get can be called
+ * by multiple threads concurrently. Every thread determines the same features,
+ * so the first threads can determine them at the same time.
+ */
+static uint32_t cpu_features = 0;
+
+#if defined( __GNUC__ ) || defined( __clang__ )
+#define cpu_features_load() \
+	__atomic_load_n( &cpu_features, __ATOMIC_ACQUIRE )
+
+#define cpu_features_store( features ) \
+	__atomic_store_n( &cpu_features, features, __ATOMIC_RELEASE )
+
+#elif defined( _MSC_VER )
+#define cpu_features_load() \
+	(uint32_t) InterlockedCompareExchange( (volatile LONG *) &cpu_features, 0, 0 )
+
+#define cpu_features_store( features ) \
+	InterlockedExchange( (volatile LONG *) &cpu_features, (LONG) features )
+
+#else
+#define cpu_features_load() \
+	cpu_features
+
+#define cpu_features_store( features ) \
+	cpu_features = features
+
+#endif
+
+#if defined( HAVE_CPU_FEATURES_X86 )
+
+/* Retrieves the values of a CPUID leaf
+ * Returns 1 if successful or 0 if the leaf is not supported
+ */
+static int cpu_features_cpuid(
+            uint32_t leaf,
+            uint32_t sub_leaf,
+            uint32_t registers[ 4 ] )
+{
+#if defined( _MSC_VER )
+	int cpu_info[ 4 ];
+
+	__cpuid(
+	 cpu_info,
+	 0 );
+
+	if( (uint32_t) cpu_info[ 0 ] < leaf )
+	{
+		return( 0 );
+	}
+	__cpuidex(
+	 cpu_info,
+	 (int) leaf,
+	 (int) sub_leaf );
+
+	registers[ 0 ] = (uint32_t) cpu_info[ 0 ];
+	registers[ 1 ] = (uint32_t) cpu_info[ 1 ];
+	registers[ 2 ] = (uint32_t) cpu_info[ 2 ];
+	registers[ 3 ] = (uint32_t) cpu_info[ 3 ];
+#else
+	unsigned int eax = 0;
+	unsigned int ebx = 0;
+	unsigned int ecx = 0;
+	unsigned int edx = 0;
+
+	if( __get_cpuid_max(
+	     0,
+	     NULL ) < leaf )
+	{
+		return( 0 );
+	}
+	__cpuid_count(
+	 leaf,
+	 sub_leaf,
+	 eax,
+	 ebx,
+	 ecx,
+	 edx );
+
+	registers[ 0 ] = (uint32_t) eax;
+	registers[ 1 ] = (uint32_t) ebx;
+	registers[ 2 ] = (uint32_t) ecx;
+	registers[ 3 ] = (uint32_t) edx;
+#endif
+	return( 1 );
+}
+
+/* Retrieves the extended control register 0 (XCR0)
+ * Only call this function if the OSXSAVE CPUID flag is set
+ */
+static uint64_t cpu_features_xgetbv(
+                 void )
+{
+#if defined( _MSC_VER )
+	return( (uint64_t) _xgetbv( 0 ) );
+#else
+	uint32_t eax = 0;
+	uint32_t edx = 0;
+
+	__asm__ __volatile__ (
+	 "xgetbv"
+	 : "=a" ( eax ), "=d" ( edx )
+	 : "c" ( 0 ) );
+
+	return( ( (uint64_t) edx << 32 ) | eax );
+#endif
+}
+
+#endif /* defined( HAVE_CPU_FEATURES_X86 ) */
+
+/* Retrieves the features supported by the CPU
+ * The features are determined on the first call, this function can be called
+ * by multiple threads concurrently
+ * Returns the CPU feature flags
+ */
+uint32_t cpu_features_get(
+          void )
+{
+#if defined( HAVE_CPU_FEATURES_X86 )
+	uint32_t registers[ 4 ];
+
+	uint64_t extended_control_register = 0;
+#endif
+	uint32_t features                  = 0;
+
+	features = cpu_features_load();
+
+	if( features != 0 )
+	{
+		return( features );
+	}
+	features = CPU_FEATURE_FLAG_DETECTED;
+
+#if defined( HAVE_CPU_FEATURES_X86 )
+	if( cpu_features_cpuid(
+	     1,
+	     0,
+	     registers ) != 0 )
+	{
+		if( ( registers[ 3 ] & 0x04000000UL ) != 0 )
+		{
+			features |= CPU_FEATURE_FLAG_SSE2;
+		}
+		if( ( registers[ 2 ] & 0x00000200UL ) != 0 )
+		{
+			features |= CPU_FEATURE_FLAG_SSSE3;
+		}
+		if( ( registers[ 2 ] & 0x00080000UL ) != 0 )
+		{
+			features |= CPU_FEATURE_FLAG_SSE4_1;
+		}
+		if( ( registers[ 2 ] & 0x00100000UL ) != 0 )
+		{
+			features |= CPU_FEATURE_FLAG_SSE4_2;
+		}
+		if( ( registers[ 2 ] & 0x00000002UL ) != 0 )
+		{
+			features |= CPU_FEATURE_FLAG_PCLMULQDQ;
+		}
+		/* The AVX registers are only usable if the operating system saves them (OSXSAVE)
+		 */
+		if( ( registers[ 2 ] & 0x08000000UL ) != 0 )
+		{
+			extended_control_register = cpu_features_xgetbv();
+		}
+		if( ( ( extended_control_register & 0x06 ) == 0x06 )
+		 && ( cpu_features_cpuid(
+		       7,
+		       0,
+		       registers ) != 0 ) )
+		{
+			if( ( registers[ 1 ] & 0x00000020UL ) != 0 )
+			{
+				features |= CPU_FEATURE_FLAG_AVX2;
+			}
+			if( ( ( extended_control_register & 0xe6 ) == 0xe6 )
+			 && ( ( registers[ 1 ] & 0x00010000UL ) != 0 )
+			 && ( ( registers[ 1 ] & 0x40000000UL ) != 0 ) )
+			{
+				features |= CPU_FEATURE_FLAG_AVX512BW;
+			}
+		}
+	}
+#elif defined( HAVE_CPU_FEATURES_ARM64 )
+	/* NEON (Advanced SIMD) is mandatory on ARMv8-A
+	 */
+	features |= CPU_FEATURE_FLAG_NEON;
+
+#if defined( __ARM_FEATURE_CRC32 )
+	features |= CPU_FEATURE_FLAG_ARM_CRC32;
+
+#elif defined( __linux__ ) && defined( HWCAP_CRC32 )
+	if( ( getauxval( AT_HWCAP ) & HWCAP_CRC32 ) != 0 )
+	{
+		features |= CPU_FEATURE_FLAG_ARM_CRC32;
+	}
+#endif
+#if defined( __ARM_FEATURE_CRYPTO ) || defined( __ARM_FEATURE_AES )
+	features |= CPU_FEATURE_FLAG_ARM_PMULL;
+
+#elif defined( __linux__ ) && defined( HWCAP_PMULL )
+	if( ( getauxval( AT_HWCAP ) & HWCAP_PMULL ) != 0 )
+	{
+		features |= CPU_FEATURE_FLAG_ARM_PMULL;
+	}
+#endif
+#endif /* defined( HAVE_CPU_FEATURES_X86 ) */
+
+	cpu_features_store(
+	 features );
+
+	return( features );
+}
+
+/* Determines if the CPU supports all of the features
+ * Returns 1 if the features are supported or 0 if not
+ */
+int cpu_features_has(
+     uint32_t feature_flags )
+{
+	if( ( cpu_features_get() & feature_flags ) != feature_flags )
+	{
+		return( 0 );
+	}
+	return( 1 );
+}
+
@@ -0,0 +1,82 @@
+/*
+ * CPU feature detection functions
+ *
+ * Copyright (C) 2019, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This software is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This software is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this software.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#if !defined( _CPU_FEATURES_H )
+#define _CPU_FEATURES_H
+
+#include <common.h>
+#include <types.h>
+
+#if defined( __cplusplus )
+extern "C" {
+#endif
+
+/* Determine if the compiler supports the x86 intrinsics
+ * CPU_FEATURES_TARGET is used to compile a single function for a specific instruction set
+ */
+#if ( defined( __GNUC__ ) || defined( __clang__ ) ) && ( defined( __x86_64__ ) || defined( __i386__ ) )
+#define HAVE_CPU_FEATURES_X86			1
+#define CPU_FEATURES_TARGET( instruction_set )	__attribute__(( target( instruction_set ) ))
+
+#elif defined( _MSC_VER ) && ( _MSC_VER >= 1600 ) && ( defined( _M_X64 ) || defined( _M_IX86 ) )
+#define HAVE_CPU_FEATURES_X86			1
+#define CPU_FEATURES_TARGET( instruction_set )
+
+#endif
+
+/* Determine if the compiler supports the ARMv8 intrinsics
+ */
+#if defined( __aarch64__ ) || defined( _M_ARM64 )
+#define HAVE_CPU_FEATURES_ARM64			1
+
+#endif
+
+enum CPU_FEATURE_FLAGS
+{
+	CPU_FEATURE_FLAG_SSE2			= 0x00000001UL,
+	CPU_FEATURE_FLAG_SSSE3			= 0x00000002UL,
+	CPU_FEATURE_FLAG_SSE4_1			= 0x00000004UL,
+	CPU_FEATURE_FLAG_SSE4_2			= 0x00000008UL,
+	CPU_FEATURE_FLAG_PCLMULQDQ		= 0x00000010UL,
+	CPU_FEATURE_FLAG_AVX2			= 0x00000020UL,
+	CPU_FEATURE_FLAG_AVX512BW		= 0x00000040UL,
+
+	CPU_FEATURE_FLAG_NEON			= 0x00000100UL,
+	CPU_FEATURE_FLAG_ARM_CRC32		= 0x00000200UL,
+	CPU_FEATURE_FLAG_ARM_PMULL		= 0x00000400UL,
+
+	/* Flag to indicate the features were determined
+	 */
+	CPU_FEATURE_FLAG_DETECTED		= 0x80000000UL
+};
+
+uint32_t cpu_features_get(
+          void );
+
+int cpu_features_has(
+     uint32_t feature_flags );
+
+#if defined( __cplusplus )
+}
+#endif
+
+#endif /* !defined( _CPU_FEATURES_H ) */
+
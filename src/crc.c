@@ -0,0 +1,675 @@
+/*
+ * Generic CRC functions
+ *
+ * Copyright (C) 2008-2019, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This software is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This software is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this software.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <byte_stream.h>
+#include <memory.h>
+#include <types.h>
+
+#include "assorted_libcerror.h"
+#include "cpu_features.h"
+#include "crc.h"
+
+#if defined( HAVE_CPU_FEATURES_X86 )
+#include <immintrin.h>
+#endif
+
+/* The named CRC parameters, terminated by an empty entry
+ * The names and check values are those of the catalogue of parametrised CRC algorithms
+ */
+const crc_parameters_t crc_presets[] = {
+	{ "crc-8/smbus", 8, 0x07ULL, 0, 0x00ULL, 0x00ULL, 0xf4ULL },
+	{ "crc-16/arc", 16, 0x8005ULL, 1, 0x0000ULL, 0x0000ULL, 0xbb3dULL },
+	{ "crc-16/ccitt", 16, 0x1021ULL, 1, 0x0000ULL, 0x0000ULL, 0x2189ULL },
+	{ "crc-16/ccitt-false", 16, 0x1021ULL, 0, 0xffffULL, 0x0000ULL, 0x29b1ULL },
+	{ "crc-16/x-25", 16, 0x1021ULL, 1, 0xffffULL, 0xffffULL, 0x906eULL },
+	{ "crc-32", 32, 0x04c11db7ULL, 1, 0xffffffffULL, 0xffffffffULL, 0xcbf43926ULL },
+	{ "crc-32/bzip2", 32, 0x04c11db7ULL, 0, 0xffffffffULL, 0xffffffffULL, 0xfc891918ULL },
+	{ "crc-32c", 32, 0x1edc6f41ULL, 1, 0xffffffffULL, 0xffffffffULL, 0xe3069283ULL },
+	{ "crc-64/ecma-182", 64, 0x42f0e1eba9ea3693ULL, 0, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x6c40df5f0b497347ULL },
+	{ "crc-64/go-iso", 64, 0x000000000000001bULL, 1, 0xffffffffffffffffULL, 0xffffffffffffffffULL, 0xb90956c775a41001ULL },
+	{ "crc-64/xz", 64, 0x42f0e1eba9ea3693ULL, 1, 0xffffffffffffffffULL, 0xffffffffffffffffULL, 0x995dc9bbdf1939faULL },
+	{ NULL, 0, 0, 0, 0, 0, 0 } };
+
+/* Reverses the bit order of the width least significant bits of a value
+ * Returns the reversed value
+ */
+static uint64_t crc_reverse_bits(
+                 uint64_t value,
+                 uint8_t width )
+{
+	uint64_t reversed_value = 0;
+	uint8_t bit_index       = 0;
+
+	for( bit_index = 0;
+	     bit_index < width;
+	     bit_index++ )
+	{
+		reversed_value <<= 1;
+		reversed_value  |= value & 1;
+		value          >>= 1;
+	}
+	return( reversed_value );
+}
+
+/* Calculates a folding constant: x^exponent mod P(x) in reversed bit order
+ * Use the normal 64-bit polynomial, without the x^64 term
+ * Returns the folding constant
+ */
+static uint64_t crc_calculate_folding_constant(
+                 uint64_t polynomial,
+                 uint16_t exponent )
+{
+	uint64_t remainder = 1;
+
+	while( exponent > 0 )
+	{
+		if( ( remainder & 0x8000000000000000ULL ) != 0 )
+		{
+			remainder = ( remainder << 1 ) ^ polynomial;
+		}
+		else
+		{
+			remainder <<= 1;
+		}
+		exponent--;
+	}
+	return( crc_reverse_bits(
+	         remainder,
+	         64 ) );
+}
+
+/* Creates an engine
+ * Make sure the value engine is referencing, is set to NULL
+ * Returns 1 if successful or -1 on error
+ */
+int crc_engine_initialize(
+     crc_engine_t **engine,
+     const crc_parameters_t *parameters,
+     libcerror_error_t **error )
+{
+	static char *function       = "crc_engine_initialize";
+	uint64_t crc                = 0;
+	uint64_t mask               = 0;
+	uint64_t polynomial         = 0;
+	uint16_t table_index        = 0;
+	uint8_t bit_iterator        = 0;
+	uint8_t slicing_table_index = 0;
+
+	if( engine == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid engine.",
+		 function );
+
+		return( -1 );
+	}
+	if( *engine != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid engine value already set.",
+		 function );
+
+		return( -1 );
+	}
+	if( parameters == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid parameters.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( parameters->width < CRC_MINIMUM_WIDTH )
+	 || ( parameters->width > CRC_MAXIMUM_WIDTH ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_UNSUPPORTED_VALUE,
+		 "%s: unsupported width: %" PRIu8 ".",
+		 function,
+		 parameters->width );
+
+		return( -1 );
+	}
+	mask = 0xffffffffffffffffULL >> ( 64 - parameters->width );
+
+	if( ( parameters->polynomial & ~mask ) != 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid polynomial value exceeds width.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( parameters->initial_value & ~mask ) != 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid initial value exceeds width.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( parameters->xor_value & ~mask ) != 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid XOR value exceeds width.",
+		 function );
+
+		return( -1 );
+	}
+	*engine = memory_allocate_structure(
+	           crc_engine_t );
+
+	if( *engine == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create engine.",
+		 function );
+
+		return( -1 );
+	}
+	( *engine )->width     = parameters->width;
+	( *engine )->reflected = parameters->reflected;
+	( *engine )->xor_value = parameters->xor_value;
+	( *engine )->mask      = mask;
+
+	/* The CRC is calculated as a 64-bit CRC with the polynomial multiplied by x^(64 - width)
+	 * the remainder of which is the CRC multiplied by x^(64 - width). In reversed bit order
+	 * the CRC is stored in the least significant bits and otherwise in the most significant bits
+	 */
+	polynomial = parameters->polynomial << ( 64 - parameters->width );
+
+	if( parameters->reflected != 0 )
+	{
+		( *engine )->empty_data_crc = crc_reverse_bits(
+		                               parameters->initial_value,
+		                               parameters->width );
+
+		polynomial = crc_reverse_bits(
+		              polynomial,
+		              64 );
+
+		for( table_index = 0;
+		     table_index < 256;
+		     table_index++ )
+		{
+			crc = (uint64_t) table_index;
+
+			for( bit_iterator = 0;
+			     bit_iterator < 8;
+			     bit_iterator++ )
+			{
+				if( ( crc & 0x0000000000000001ULL ) != 0 )
+				{
+					crc = ( crc >> 1 ) ^ polynomial;
+				}
+				else
+				{
+					crc >>= 1;
+				}
+			}
+			( *engine )->slicing_tables[ 0 ][ table_index ] = crc;
+		}
+		for( table_index = 0;
+		     table_index < 256;
+		     table_index++ )
+		{
+			crc = ( *engine )->slicing_tables[ 0 ][ table_index ];
+
+			for( slicing_table_index = 1;
+			     slicing_table_index < 8;
+			     slicing_table_index++ )
+			{
+				crc = ( *engine )->slicing_tables[ 0 ][ crc & 0x00000000000000ffULL ] ^ ( crc >> 8 );
+
+				( *engine )->slicing_tables[ slicing_table_index ][ table_index ] = crc;
+			}
+		}
+		/* The folding distances are 4 x 128-bit and 128-bit, 63 is added to compensate
+		 * for the bit offset of a carry-less multiplication in reversed bit order
+		 */
+		polynomial = parameters->polynomial << ( 64 - parameters->width );
+
+		( *engine )->folding_constants[ 0 ] = crc_calculate_folding_constant( polynomial, ( 4 * 128 ) + 63 );
+		( *engine )->folding_constants[ 1 ] = crc_calculate_folding_constant( polynomial, ( 4 * 128 ) - 1 );
+		( *engine )->folding_constants[ 2 ] = crc_calculate_folding_constant( polynomial, 128 + 63 );
+		( *engine )->folding_constants[ 3 ] = crc_calculate_folding_constant( polynomial, 128 - 1 );
+	}
+	else
+	{
+		( *engine )->empty_data_crc = parameters->initial_value;
+
+		for( table_index = 0;
+		     table_index < 256;
+		     table_index++ )
+		{
+			crc = (uint64_t) table_index << 56;
+
+			for( bit_iterator = 0;
+			     bit_iterator < 8;
+			     bit_iterator++ )
+			{
+				if( ( crc & 0x8000000000000000ULL ) != 0 )
+				{
+					crc = ( crc << 1 ) ^ polynomial;
+				}
+				else
+				{
+					crc <<= 1;
+				}
+			}
+			( *engine )->slicing_tables[ 0 ][ table_index ] = crc;
+		}
+		for( table_index = 0;
+		     table_index < 256;
+		     table_index++ )
+		{
+			crc = ( *engine )->slicing_tables[ 0 ][ table_index ];
+
+			for( slicing_table_index = 1;
+			     slicing_table_index < 8;
+			     slicing_table_index++ )
+			{
+				crc = ( *engine )->slicing_tables[ 0 ][ crc >> 56 ] ^ ( crc << 8 );
+
+				( *engine )->slicing_tables[ slicing_table_index ][ table_index ] = crc;
+			}
+		}
+		/* Folding is only supported in reversed bit order
+		 */
+		( *engine )->folding_constants[ 0 ] = 0;
+		( *engine )->folding_constants[ 1 ] = 0;
+		( *engine )->folding_constants[ 2 ] = 0;
+		( *engine )->folding_constants[ 3 ] = 0;
+	}
+	( *engine )->empty_data_crc ^= parameters->xor_value;
+
+	return( 1 );
+}
+
+/* Frees an engine
+ * Returns 1 if successful or -1 on error
+ */
+int crc_engine_free(
+     crc_engine_t **engine,
+     libcerror_error_t **error )
+{
+	static char *function = "crc_engine_free";
+
+	if( engine == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid engine.",
+		 function );
+
+		return( -1 );
+	}
+	if( *engine != NULL )
+	{
+		memory_free(
+		 *engine );
+
+		*engine = NULL;
+	}
+	return( 1 );
+}
+
+/* Updates a reflected CRC with the data of a buffer using the slicing-by-8 lookup tables
+ * The CRC is the internal value, e.g. without the XOR value
+ * Returns the CRC
+ */
+static uint64_t crc_engine_slicing_by_8_update_reflected(
+                 crc_engine_t *engine,
+                 uint64_t crc,
+                 const uint8_t *buffer,
+                 size_t size )
+{
+	uint64_t value_64bit = 0;
+
+	while( size >= 8 )
+	{
+		byte_stream_copy_to_uint64_little_endian(
+		 buffer,
+		 value_64bit );
+
+		value_64bit ^= crc;
+
+		crc = engine->slicing_tables[ 7 ][ value_64bit & 0x00000000000000ffULL ]
+		    ^ engine->slicing_tables[ 6 ][ ( value_64bit >> 8 ) & 0x00000000000000ffULL ]
+		    ^ engine->slicing_tables[ 5 ][ ( value_64bit >> 16 ) & 0x00000000000000ffULL ]
+		    ^ engine->slicing_tables[ 4 ][ ( value_64bit >> 24 ) & 0x00000000000000ffULL ]
+		    ^ engine->slicing_tables[ 3 ][ ( value_64bit >> 32 ) & 0x00000000000000ffULL ]
+		    ^ engine->slicing_tables[ 2 ][ ( value_64bit >> 40 ) & 0x00000000000000ffULL ]
+		    ^ engine->slicing_tables[ 1 ][ ( value_64bit >> 48 ) & 0x00000000000000ffULL ]
+		    ^ engine->slicing_tables[ 0 ][ value_64bit >> 56 ];
+
+		buffer += 8;
+		size   -= 8;
+	}
+	while( size > 0 )
+	{
+		crc = engine->slicing_tables[ 0 ][ ( crc ^ *buffer ) & 0x00000000000000ffULL ] ^ ( crc >> 8 );
+
+		buffer += 1;
+		size   -= 1;
+	}
+	return( crc );
+}
+
+/* Updates a CRC that is not reflected with the data of a buffer using the slicing-by-8 lookup tables
+ * The CRC is the internal value, e.g. without the XOR value, stored in the most significant bits
+ * Returns the CRC
+ */
+static uint64_t crc_engine_slicing_by_8_update_normal(
+                 crc_engine_t *engine,
+                 uint64_t crc,
+                 const uint8_t *buffer,
+                 size_t size )
+{
+	uint64_t value_64bit = 0;
+
+	while( size >= 8 )
+	{
+		byte_stream_copy_to_uint64_big_endian(
+		 buffer,
+		 value_64bit );
+
+		value_64bit ^= crc;
+
+		crc = engine->slicing_tables[ 7 ][ value_64bit >> 56 ]
+		    ^ engine->slicing_tables[ 6 ][ ( value_64bit >> 48 ) & 0x00000000000000ffULL ]
+		    ^ engine->slicing_tables[ 5 ][ ( value_64bit >> 40 ) & 0x00000000000000ffULL ]
+		    ^ engine->slicing_tables[ 4 ][ ( value_64bit >> 32 ) & 0x00000000000000ffULL ]
+		    ^ engine->slicing_tables[ 3 ][ ( value_64bit >> 24 ) & 0x00000000000000ffULL ]
+		    ^ engine->slicing_tables[ 2 ][ ( value_64bit >> 16 ) & 0x00000000000000ffULL ]
+		    ^ engine->slicing_tables[ 1 ][ ( value_64bit >> 8 ) & 0x00000000000000ffULL ]
+		    ^ engine->slicing_tables[ 0 ][ value_64bit & 0x00000000000000ffULL ];
+
+		buffer += 8;
+		size   -= 8;
+	}
+	while( size > 0 )
+	{
+		crc = engine->slicing_tables[ 0 ][ ( crc >> 56 ) ^ *buffer ] ^ ( crc << 8 );
+
+		buffer += 1;
+		size   -= 1;
+	}
+	return( crc );
+}
+
+#if defined( HAVE_CPU_FEATURES_X86 )
+
+/* Folds the data of a buffer using carry-less multiplication (PCLMULQDQ)
+ * The size must be at least 64 and a multiple of 16
+ * The CRC is the internal value of a reflected CRC, e.g. without the XOR value
+ * The result is a 128-bit remainder that is congruent to the data, which is stored
+ * in the remainder buffer and is to be reduced by a table based calculation
+ */
+CPU_FEATURES_TARGET( "sse2,pclmul" )
+static void crc_engine_fold_pclmulqdq(
+             crc_engine_t *engine,
+             uint64_t crc,
+             const uint8_t *buffer,
+             size_t size,
+             uint8_t remainder[ 16 ] )
+{
+	__m128i constants;
+	__m128i value1;
+	__m128i value2;
+	__m128i value3;
+	__m128i value4;
+	__m128i value5;
+	__m128i value6;
+	__m128i value7;
+	__m128i value8;
+
+	/* Load the first 64 bytes and the initial value into 4 lanes
+	 */
+	value1 = _mm_loadu_si128( (const __m128i *) &( buffer[ 0 ] ) );
+	value2 = _mm_loadu_si128( (const __m128i *) &( buffer[ 16 ] ) );
+	value3 = _mm_loadu_si128( (const __m128i *) &( buffer[ 32 ] ) );
+	value4 = _mm_loadu_si128( (const __m128i *) &( buffer[ 48 ] ) );
+
+	value1 = _mm_xor_si128( value1, _mm_set_epi32( 0, 0, (int) ( crc >> 32 ), (int) ( crc & 0xffffffffUL ) ) );
+
+	constants = _mm_loadu_si128( (const __m128i *) &( engine->folding_constants[ 0 ] ) );
+
+	buffer += 64;
+	size   -= 64;
+
+	/* Fold 64 bytes per iteration
+	 */
+	while( size >= 64 )
+	{
+		value5 = _mm_clmulepi64_si128( value1, constants, 0x00 );
+		value6 = _mm_clmulepi64_si128( value2, constants, 0x00 );
+		value7 = _mm_clmulepi64_si128( value3, constants, 0x00 );
+		value8 = _mm_clmulepi64_si128( value4, constants, 0x00 );
+
+		value1 = _mm_clmulepi64_si128( value1, constants, 0x11 );
+		value2 = _mm_clmulepi64_si128( value2, constants, 0x11 );
+		value3 = _mm_clmulepi64_si128( value3, constants, 0x11 );
+		value4 = _mm_clmulepi64_si128( value4, constants, 0x11 );
+
+		value1 = _mm_xor_si128( value1, value5 );
+		value2 = _mm_xor_si128( value2, value6 );
+		value3 = _mm_xor_si128( value3, value7 );
+		value4 = _mm_xor_si128( value4, value8 );
+
+		value1 = _mm_xor_si128( value1, _mm_loadu_si128( (const __m128i *) &( buffer[ 0 ] ) ) );
+		value2 = _mm_xor_si128( value2, _mm_loadu_si128( (const __m128i *) &( buffer[ 16 ] ) ) );
+		value3 = _mm_xor_si128( value3, _mm_loadu_si128( (const __m128i *) &( buffer[ 32 ] ) ) );
+		value4 = _mm_xor_si128( value4, _mm_loadu_si128( (const __m128i *) &( buffer[ 48 ] ) ) );
+
+		buffer += 64;
+		size   -= 64;
+	}
+	/* Fold the 4 lanes into 1
+	 */
+	constants = _mm_loadu_si128( (const __m128i *) &( engine->folding_constants[ 2 ] ) );
+
+	value5 = _mm_clmulepi64_si128( value1, constants, 0x00 );
+	value1 = _mm_clmulepi64_si128( value1, constants, 0x11 );
+	value1 = _mm_xor_si128( value1, value2 );
+	value1 = _mm_xor_si128( value1, value5 );
+
+	value5 = _mm_clmulepi64_si128( value1, constants, 0x00 );
+	value1 = _mm_clmulepi64_si128( value1, constants, 0x11 );
+	value1 = _mm_xor_si128( value1, value3 );
+	value1 = _mm_xor_si128( value1, value5 );
+
+	value5 = _mm_clmulepi64_si128( value1, constants, 0x00 );
+	value1 = _mm_clmulepi64_si128( value1, constants, 0x11 );
+	value1 = _mm_xor_si128( value1, value4 );
+	value1 = _mm_xor_si128( value1, value5 );
+
+	/* Fold the remaining 16 byte blocks
+	 */
+	while( size >= 16 )
+	{
+		value5 = _mm_clmulepi64_si128( value1, constants, 0x00 );
+		value1 = _mm_clmulepi64_si128( value1, constants, 0x11 );
+		value1 = _mm_xor_si128( value1, _mm_loadu_si128( (const __m128i *) buffer ) );
+		value1 = _mm_xor_si128( value1, value5 );
+
+		buffer += 16;
+		size   -= 16;
+	}
+	_mm_storeu_si128(
+	 (__m128i *) remainder,
+	 value1 );
+}
+
+#endif /* defined( HAVE_CPU_FEATURES_X86 ) */
+
+/* Calculates the CRC of a buffer
+ * A reflected CRC uses carry-less multiplication (PCLMULQDQ) if available,
+ * otherwise the CRC is calculated using the slicing-by-8 lookup tables
+ * The initial value is the CRC of the preceding data, use the CRC
+ * of empty data of the engine to calculate a new CRC
+ * Returns 1 if successful or -1 on error
+ */
+int crc_engine_calculate(
+     crc_engine_t *engine,
+     uint64_t *crc,
+     const uint8_t *buffer,
+     size_t size,
+     uint64_t initial_value,
+     libcerror_error_t **error )
+{
+#if defined( HAVE_CPU_FEATURES_X86 )
+	uint8_t remainder[ 16 ];
+#endif
+
+	static char *function = "crc_engine_calculate";
+	size_t buffer_offset  = 0;
+	uint64_t value_64bit  = 0;
+
+	if( engine == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid engine.",
+		 function );
+
+		return( -1 );
+	}
+	if( crc == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid CRC.",
+		 function );
+
+		return( -1 );
+	}
+	if( buffer == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid buffer.",
+		 function );
+
+		return( -1 );
+	}
+	if( size > (size_t) SSIZE_MAX )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid size value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( initial_value & ~( engine->mask ) ) != 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid initial value exceeds width.",
+		 function );
+
+		return( -1 );
+	}
+	value_64bit = initial_value ^ engine->xor_value;
+
+	if( engine->reflected != 0 )
+	{
+#if defined( HAVE_CPU_FEATURES_X86 )
+		if( ( size >= 64 )
+		 && ( cpu_features_has(
+		       CPU_FEATURE_FLAG_SSE2 | CPU_FEATURE_FLAG_PCLMULQDQ ) != 0 ) )
+		{
+			buffer_offset = size & ~( (size_t) 15 );
+
+			crc_engine_fold_pclmulqdq(
+			 engine,
+			 value_64bit,
+			 buffer,
+			 buffer_offset,
+			 remainder );
+
+			/* The CRC of the remainder with an initial value of 0 is the CRC of the folded data
+			 */
+			value_64bit = crc_engine_slicing_by_8_update_reflected(
+			               engine,
+			               0,
+			               remainder,
+			               16 );
+		}
+#endif
+		value_64bit = crc_engine_slicing_by_8_update_reflected(
+		               engine,
+		               value_64bit,
+		               &( buffer[ buffer_offset ] ),
+		               size - buffer_offset );
+	}
+	else
+	{
+		value_64bit = crc_engine_slicing_by_8_update_normal(
+		               engine,
+		               value_64bit << ( 64 - engine->width ),
+		               buffer,
+		               size );
+
+		value_64bit >>= 64 - engine->width;
+	}
+	*crc = value_64bit ^ engine->xor_value;
+
+	return( 1 );
+}
+
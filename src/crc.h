@@ -0,0 +1,136 @@
+/*
+ * Generic CRC functions
+ *
+ * Copyright (C) 2008-2019, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This software is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This software is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this software.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#if !defined( _CRC_H )
+#define _CRC_H
+
+#include <common.h>
+#include <types.h>
+
+#include "assorted_libcerror.h"
+
+#if defined( __cplusplus )
+extern "C" {
+#endif
+
+/* The minimum and maximum width of a CRC in bits
+ */
+#define CRC_MINIMUM_WIDTH	8
+#define CRC_MAXIMUM_WIDTH	64
+
+typedef struct crc_parameters crc_parameters_t;
+
+/* The parameters of a CRC, as in the Rocksoft model
+ * The input and output are either both reflected or both not reflected
+ */
+struct crc_parameters
+{
+	/* The name, as used on the command line
+	 */
+	const char *name;
+
+	/* The width in bits
+	 */
+	uint8_t width;
+
+	/* The polynomial in normal bit order, without the x^width term
+	 */
+	uint64_t polynomial;
+
+	/* Value to indicate the input and output are reflected
+	 */
+	uint8_t reflected;
+
+	/* The initial value of the register, in normal bit order
+	 */
+	uint64_t initial_value;
+
+	/* The value the output is XOR-ed with
+	 */
+	uint64_t xor_value;
+
+	/* The CRC of the ASCII string "123456789"
+	 */
+	uint64_t check_value;
+};
+
+typedef struct crc_engine crc_engine_t;
+
+struct crc_engine
+{
+	/* The width in bits
+	 */
+	uint8_t width;
+
+	/* Value to indicate the input and output are reflected
+	 */
+	uint8_t reflected;
+
+	/* The value the output is XOR-ed with
+	 */
+	uint64_t xor_value;
+
+	/* The mask of the width bits
+	 */
+	uint64_t mask;
+
+	/* The CRC of empty data, which is used as the initial value to calculate a new CRC
+	 */
+	uint64_t empty_data_crc;
+
+	/* The tables of the CRC of all 8-bit messages followed by 0 up to 7 zero bytes
+	 * A reflected CRC is stored in the least significant bits of the table values
+	 * and a CRC that is not reflected in the most significant bits
+	 */
+	uint64_t slicing_tables[ 8 ][ 256 ];
+
+	/* The constants used to fold a reflected CRC with carry-less multiplication
+	 * Consists of x^575, x^511, x^191 and x^127 modulo the polynomial multiplied
+	 * by x^(64 - width) in reversed bit order
+	 */
+	uint64_t folding_constants[ 4 ];
+};
+
+extern const crc_parameters_t crc_presets[];
+
+int crc_engine_initialize(
+     crc_engine_t **engine,
+     const crc_parameters_t *parameters,
+     libcerror_error_t **error );
+
+int crc_engine_free(
+     crc_engine_t **engine,
+     libcerror_error_t **error );
+
+int crc_engine_calculate(
+     crc_engine_t *engine,
+     uint64_t *crc,
+     const uint8_t *buffer,
+     size_t size,
+     uint64_t initial_value,
+     libcerror_error_t **error );
+
+#if defined( __cplusplus )
+}
+#endif
+
+#endif /* !defined( _CRC_H ) */
+
@@ -20,10 +20,22 @@
  */
 
 #include <common.h>
+#include <byte_stream.h>
+#include <memory.h>
 #include <types.h>
 
 #include "assorted_libcerror.h"
+#include "cpu_features.h"
 #include "crc32.h"
+#include "crc32_tables.h"
+
+#if defined( HAVE_CPU_FEATURES_X86 )
+#include <immintrin.h>
+
+#elif defined( HAVE_CPU_FEATURES_ARM64 ) && defined( __ARM_FEATURE_CRC32 )
+#include <arm_acle.h>
+
+#endif
 
 /* Polynomials
  *
@@ -43,47 +55,189 @@
  * reverse of reciprocal: 0xba0dc66b
  */
 
-/* Table of the CRC-32 of all 8-bit messages.
+/* Tables of the CRC-32 of all 8-bit messages followed by 0 up to 15 zero bytes
+ * and the folding constants for a custom polynomial
+ */
+uint32_t crc32_custom_slicing_tables[ 16 ][ 256 ];
+uint64_t crc32_custom_folding_constants[ 8 ];
+
+/* The tables of the CRC-32 of all 8-bit messages followed by 0 up to 15 zero bytes
+ * These tables are used to process 1, 8 or 16 bytes per iteration (slicing-by-8 and -16)
+ * The tables of the RFC 1952 and Castagnoli polynomials are static, refer to crc32_tables.c
+ */
+const uint32_t (*crc32_slicing_tables)[ 256 ] = crc32_slicing_tables_rfc1952;
+
+/* The constants used to fold the CRC-32 with carry-less multiplication
+ * Consists of k1, k2, k3, k4, k5, 0, P' and mu' as described in
+ * "Fast CRC Computation for Generic Polynomials Using PCLMULQDQ Instruction"
+ */
+const uint64_t *crc32_folding_constants = crc32_folding_constants_rfc1952;
+
+/* The (reversed) polynomial of the CRC-32 tables
+ */
+uint32_t crc32_table_polynomial = 0xedb88320UL;
+
+/* Reverses the bit order of a value
+ * Returns the reversed value
+ */
+static uint64_t crc32_reverse_bits(
+                 uint64_t value,
+                 uint8_t number_of_bits )
+{
+	uint64_t reversed_value = 0;
+	uint8_t bit_index       = 0;
+
+	for( bit_index = 0;
+	     bit_index < number_of_bits;
+	     bit_index++ )
+	{
+		reversed_value <<= 1;
+		reversed_value  |= value & 1;
+		value          >>= 1;
+	}
+	return( reversed_value );
+}
+
+/* Calculates a folding constant: ( x^exponent mod P(x) ) in reversed bit order shifted by 1
+ * Use the normal polynomial, without the x^32 term
+ * Returns the folding constant
  */
-uint32_t crc32_table[ 256 ];
+static uint64_t crc32_calculate_folding_constant(
+                 uint32_t polynomial,
+                 uint16_t exponent )
+{
+	uint32_t remainder = 1;
+
+	while( exponent > 0 )
+	{
+		if( ( remainder & 0x80000000UL ) != 0 )
+		{
+			remainder = ( remainder << 1 ) ^ polynomial;
+		}
+		else
+		{
+			remainder <<= 1;
+		}
+		exponent--;
+	}
+	return( crc32_reverse_bits(
+	         (uint64_t) remainder,
+	         32 ) << 1 );
+}
 
-/* Value to indicate the CRC-32 table been computed
+/* Initializes the CRC-32 folding constants of a custom polynomial
+ * Use the reversed polynomial
  */
-int crc32_table_computed = 0;
+static void initialize_crc32_folding_constants(
+             uint32_t polynomial )
+{
+	uint64_t full_polynomial = 0;
+	uint64_t quotient        = 0;
+	uint64_t remainder       = 0;
+	uint8_t bit_index        = 0;
+
+	polynomial      = (uint32_t) crc32_reverse_bits( (uint64_t) polynomial, 32 );
+	full_polynomial = 0x100000000ULL | polynomial;
 
-/* Initializes the internal CRC-32 table
- * The table speeds up the CRC-32 calculation
+	crc32_custom_folding_constants[ 0 ] = crc32_calculate_folding_constant( polynomial, ( 4 * 128 ) + 32 );
+	crc32_custom_folding_constants[ 1 ] = crc32_calculate_folding_constant( polynomial, ( 4 * 128 ) - 32 );
+	crc32_custom_folding_constants[ 2 ] = crc32_calculate_folding_constant( polynomial, 128 + 32 );
+	crc32_custom_folding_constants[ 3 ] = crc32_calculate_folding_constant( polynomial, 128 - 32 );
+	crc32_custom_folding_constants[ 4 ] = crc32_calculate_folding_constant( polynomial, 64 );
+	crc32_custom_folding_constants[ 5 ] = 0;
+
+	/* Calculate the Barrett reduction constant mu = x^64 / P(x)
+	 */
+	quotient  = 0x100000000ULL;
+	remainder = (uint64_t) polynomial << 32;
+
+	for( bit_index = 63;
+	     bit_index >= 32;
+	     bit_index-- )
+	{
+		if( ( ( remainder >> bit_index ) & 1 ) != 0 )
+		{
+			remainder ^= full_polynomial << ( bit_index - 32 );
+			quotient  |= (uint64_t) 1 << ( bit_index - 32 );
+		}
+	}
+	crc32_custom_folding_constants[ 6 ] = crc32_reverse_bits( full_polynomial, 33 );
+	crc32_custom_folding_constants[ 7 ] = crc32_reverse_bits( quotient, 33 );
+}
+
+/* Initializes the internal CRC-32 tables
+ * The tables speed up the CRC-32 calculation
+ * Static tables are used for the RFC 1952 and Castagnoli polynomials,
+ * for other polynomials the tables are computed
  * Use the reversed polynomial
  */
 void initialize_crc32_table(
       uint32_t polynomial )
 {
-	uint32_t crc32             = 0;
-	uint32_t crc32_table_index = 0;
-	uint8_t bit_iterator       = 0;
+	uint32_t crc32              = 0;
+	uint32_t crc32_table_index  = 0;
+	uint8_t bit_iterator        = 0;
+	uint8_t slicing_table_index = 0;
 
-	for( crc32_table_index = 0;
-	     crc32_table_index < 256;
-	     crc32_table_index++ )
+	if( polynomial == crc32_table_polynomial )
 	{
-		crc32 = (uint32_t) crc32_table_index;
-
-		for( bit_iterator = 0;
-		     bit_iterator < 8;
-		     bit_iterator++ )
+		return;
+	}
+	if( polynomial == 0xedb88320UL )
+	{
+		crc32_slicing_tables    = crc32_slicing_tables_rfc1952;
+		crc32_folding_constants = crc32_folding_constants_rfc1952;
+	}
+	else if( polynomial == 0x82f63b78UL )
+	{
+		crc32_slicing_tables    = crc32_slicing_tables_castagnoli;
+		crc32_folding_constants = crc32_folding_constants_castagnoli;
+	}
+	else
+	{
+		for( crc32_table_index = 0;
+		     crc32_table_index < 256;
+		     crc32_table_index++ )
 		{
-			if( crc32 & 1 )
+			crc32 = (uint32_t) crc32_table_index;
+
+			for( bit_iterator = 0;
+			     bit_iterator < 8;
+			     bit_iterator++ )
 			{
-				crc32 = polynomial ^ ( crc32 >> 1 );
+				if( crc32 & 1 )
+				{
+					crc32 = polynomial ^ ( crc32 >> 1 );
+				}
+				else
+				{
+					crc32 = crc32 >> 1;
+				}
 			}
-			else
+			crc32_custom_slicing_tables[ 0 ][ crc32_table_index ] = crc32;
+		}
+		for( crc32_table_index = 0;
+		     crc32_table_index < 256;
+		     crc32_table_index++ )
+		{
+			crc32 = crc32_custom_slicing_tables[ 0 ][ crc32_table_index ];
+
+			for( slicing_table_index = 1;
+			     slicing_table_index < 16;
+			     slicing_table_index++ )
 			{
-				crc32 = crc32 >> 1;
+				crc32 = crc32_custom_slicing_tables[ 0 ][ crc32 & 0x000000ffUL ] ^ ( crc32 >> 8 );
+
+				crc32_custom_slicing_tables[ slicing_table_index ][ crc32_table_index ] = crc32;
 			}
 		}
-		crc32_table[ crc32_table_index ] = crc32;
+		initialize_crc32_folding_constants(
+		 polynomial );
+
+		crc32_slicing_tables    = (const uint32_t (*)[ 256 ]) crc32_custom_slicing_tables;
+		crc32_folding_constants = crc32_custom_folding_constants;
 	}
-	crc32_table_computed = 1;
+	crc32_table_polynomial = polynomial;
 }
 
 /* Calculates the CRC-32 of a buffer
@@ -141,11 +295,24 @@ int crc32_calculate_modulo2(
 
 		return( -1 );
 	}
-	*crc32 = initial_value;
-
 	if( weak_crc == 0 )
 	{
-		*crc32 ^= (uint32_t) 0xffffffffUL;
+		initial_value ^= (uint32_t) 0xffffffffUL;
+	}
+	/* Mirror the bit order of the initial value from the center
+	 * so that a previously calculated CRC-32 can be continued
+	 */
+	*crc32 = 0;
+
+	for( bit_index = 0;
+	     bit_index < 32;
+	     bit_index++ )
+	{
+		if( ( initial_value & 0x00000001UL ) != 0 )
+		{
+			*crc32 |= (uint32_t) 1 << ( 31 - bit_index );
+		}
+		initial_value >>= 1;
 	}
 	/* Perform a byte for byte modulo-2 division
 	 */
@@ -189,13 +356,15 @@ int crc32_calculate_modulo2(
 	}
 	/* Mirror the bit order of the CRC-32 value from the center
 	 */
+	mirror_value = 0;
+
 	for( bit_index = 0;
 	     bit_index < 32;
 	     bit_index++ )
 	{
 		if( ( *crc32 & 0x00000001UL ) != 0 )
 		{
-			mirror_value |= ( 1 << ( 31 - bit_index ) );
+			mirror_value |= (uint32_t) 1 << ( 31 - bit_index );
 		}
 		*crc32 = *crc32 >> 1;
 	}
@@ -257,11 +426,6 @@ int crc32_calculate(
 
 		return( -1 );
 	}
-        if( crc32_table_computed == 0 )
-	{
-		initialize_crc32_table(
-		 0xedb88320UL );
-	}
 	*crc32 = initial_value;
 
 	if( weak_crc == 0 )
@@ -274,7 +438,7 @@ int crc32_calculate(
 	{
 		crc32_table_index = ( *crc32 ^ buffer[ buffer_offset ] ) & 0x000000ffUL;
 
-		*crc32 = crc32_table[ crc32_table_index ] ^ ( *crc32 >> 8 );
+		*crc32 = crc32_slicing_tables[ 0 ][ crc32_table_index ] ^ ( *crc32 >> 8 );
         }
 	if( weak_crc == 0 )
 	{
@@ -283,64 +447,126 @@ int crc32_calculate(
 	return( 1 );
 }
 
-/* Check the CRC-32 checksum for single-bit errors
- * Returns 1 if successful, 0 if no error was found or -1 on error
+/* Calculates the CRC-32 of a buffer
+ * Uses the slicing-by-8 lookup tables to process 8 bytes per iteration
+ * Use a previous key of 0 to calculate a new CRC-32
+ * Returns 1 if successful or -1 on error
  */
-int crc32_validate(
-     uint32_t crc32,
-     uint32_t calculated_crc32,
-     uint8_t *bit_index,
+int crc32_calculate_slicing_by_8(
+     uint32_t *crc32,
+     uint8_t *buffer,
+     size_t size,
+     uint32_t initial_value,
+     uint8_t weak_crc,
      libcerror_error_t **error )
 {
-	static char *function      = "crc32_validate";
-	uint32_t crc32_xor_pattern = 0;
-	
-	if( bit_index == NULL )
+	static char *function      = "crc32_calculate_slicing_by_8";
+	size_t buffer_offset       = 0;
+	uint32_t crc32_table_index = 0;
+	uint32_t value_32bit       = 0;
+
+	if( crc32 == NULL )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
 		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
-		 "%s: invalid bit index.",
+		 "%s: invalid CRC-32.",
 		 function );
 
 		return( -1 );
 	}
-	crc32 ^= calculated_crc32;
+	if( buffer == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid buffer.",
+		 function );
 
-	crc32_xor_pattern = 1;
+		return( -1 );
+	}
+	if( size > (size_t) SSIZE_MAX )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid size value exceeds maximum.",
+		 function );
 
-        for( *bit_index = 0;
-	     *bit_index < 32;
-	     *bit_index += 1 )
+		return( -1 );
+	}
+	*crc32 = initial_value;
+
+	if( weak_crc == 0 )
 	{
-		if( crc32_xor_pattern == crc32 )
-		{
-			return( 1 );
-		}
-		crc32_xor_pattern = ( crc32_xor_pattern << 1 ) ^ ( 0x04c11db7UL & ( crc32_xor_pattern >> 31 ) );
+		*crc32 ^= (uint32_t) 0xffffffffUL;
 	}
-	return( 0 );
+	while( ( size - buffer_offset ) >= 8 )
+	{
+		byte_stream_copy_to_uint32_little_endian(
+		 &( buffer[ buffer_offset ] ),
+		 value_32bit );
+
+		value_32bit ^= *crc32;
+
+		*crc32 = crc32_slicing_tables[ 7 ][ value_32bit & 0x000000ffUL ]
+		       ^ crc32_slicing_tables[ 6 ][ ( value_32bit >> 8 ) & 0x000000ffUL ]
+		       ^ crc32_slicing_tables[ 5 ][ ( value_32bit >> 16 ) & 0x000000ffUL ]
+		       ^ crc32_slicing_tables[ 4 ][ value_32bit >> 24 ]
+		       ^ crc32_slicing_tables[ 3 ][ buffer[ buffer_offset + 4 ] ]
+		       ^ crc32_slicing_tables[ 2 ][ buffer[ buffer_offset + 5 ] ]
+		       ^ crc32_slicing_tables[ 1 ][ buffer[ buffer_offset + 6 ] ]
+		       ^ crc32_slicing_tables[ 0 ][ buffer[ buffer_offset + 7 ] ];
+
+		buffer_offset += 8;
+	}
+	while( buffer_offset < size )
+	{
+		crc32_table_index = ( *crc32 ^ buffer[ buffer_offset ] ) & 0x000000ffUL;
+
+		*crc32 = crc32_slicing_tables[ 0 ][ crc32_table_index ] ^ ( *crc32 >> 8 );
+
+		buffer_offset++;
+	}
+	if( weak_crc == 0 )
+	{
+		*crc32 ^= 0xffffffffUL;
+	}
+	return( 1 );
 }
 
-/* Tries to locate the error offset using a CRC-32
- * Returns 1 if successful, 0 if no error was found or -1 on error
+/* Calculates the CRC-32 of a buffer
+ * Uses the slicing-by-16 lookup tables to process 16 bytes per iteration
+ * Use a previous key of 0 to calculate a new CRC-32
+ * Returns 1 if successful or -1 on error
  */
-int crc32_locate_error_offset(
-     uint32_t crc32,
-     uint32_t calculated_crc32,
+int crc32_calculate_slicing_by_16(
+     uint32_t *crc32,
      uint8_t *buffer,
      size_t size,
      uint32_t initial_value,
+     uint8_t weak_crc,
      libcerror_error_t **error )
 {
-	static char *function      = "crc32_locate_error_offset";
+	static char *function      = "crc32_calculate_slicing_by_16";
 	size_t buffer_offset       = 0;
-	uint32_t crc32_xor_pattern = 0;
-	uint32_t mirror_value      = 0;
-	uint8_t bit_index          = 0;
-	uint8_t byte_value         = 0;
+	uint32_t crc32_table_index = 0;
+	uint32_t value_32bit       = 0;
+
+	if( crc32 == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid CRC-32.",
+		 function );
 
+		return( -1 );
+	}
 	if( buffer == NULL )
 	{
 		libcerror_error_set(
@@ -363,70 +589,1094 @@ int crc32_locate_error_offset(
 
 		return( -1 );
 	}
-	crc32_xor_pattern = crc32 ^ calculated_crc32;
+	*crc32 = initial_value;
+
+	if( weak_crc == 0 )
+	{
+		*crc32 ^= (uint32_t) 0xffffffffUL;
+	}
+	while( ( size - buffer_offset ) >= 16 )
+	{
+		byte_stream_copy_to_uint32_little_endian(
+		 &( buffer[ buffer_offset ] ),
+		 value_32bit );
 
-	calculated_crc32 = initial_value ^ (uint32_t) 0xffffffffUL;
+		value_32bit ^= *crc32;
 
-	/* Perform a byte for byte modulo-2 division
+		*crc32 = crc32_slicing_tables[ 15 ][ value_32bit & 0x000000ffUL ]
+		       ^ crc32_slicing_tables[ 14 ][ ( value_32bit >> 8 ) & 0x000000ffUL ]
+		       ^ crc32_slicing_tables[ 13 ][ ( value_32bit >> 16 ) & 0x000000ffUL ]
+		       ^ crc32_slicing_tables[ 12 ][ value_32bit >> 24 ]
+		       ^ crc32_slicing_tables[ 11 ][ buffer[ buffer_offset + 4 ] ]
+		       ^ crc32_slicing_tables[ 10 ][ buffer[ buffer_offset + 5 ] ]
+		       ^ crc32_slicing_tables[ 9 ][ buffer[ buffer_offset + 6 ] ]
+		       ^ crc32_slicing_tables[ 8 ][ buffer[ buffer_offset + 7 ] ]
+		       ^ crc32_slicing_tables[ 7 ][ buffer[ buffer_offset + 8 ] ]
+		       ^ crc32_slicing_tables[ 6 ][ buffer[ buffer_offset + 9 ] ]
+		       ^ crc32_slicing_tables[ 5 ][ buffer[ buffer_offset + 10 ] ]
+		       ^ crc32_slicing_tables[ 4 ][ buffer[ buffer_offset + 11 ] ]
+		       ^ crc32_slicing_tables[ 3 ][ buffer[ buffer_offset + 12 ] ]
+		       ^ crc32_slicing_tables[ 2 ][ buffer[ buffer_offset + 13 ] ]
+		       ^ crc32_slicing_tables[ 1 ][ buffer[ buffer_offset + 14 ] ]
+		       ^ crc32_slicing_tables[ 0 ][ buffer[ buffer_offset + 15 ] ];
+
+		buffer_offset += 16;
+	}
+	while( buffer_offset < size )
+	{
+		crc32_table_index = ( *crc32 ^ buffer[ buffer_offset ] ) & 0x000000ffUL;
+
+		*crc32 = crc32_slicing_tables[ 0 ][ crc32_table_index ] ^ ( *crc32 >> 8 );
+
+		buffer_offset++;
+	}
+	if( weak_crc == 0 )
+	{
+		*crc32 ^= 0xffffffffUL;
+	}
+	return( 1 );
+}
+
+#if defined( HAVE_CPU_FEATURES_X86 )
+
+/* Folds the CRC-32 of a buffer using carry-less multiplication (PCLMULQDQ)
+ * The size must be at least 64 and a multiple of 16
+ * The CRC-32 is the internal value, e.g. without the pre and post conditioning
+ * Returns the CRC-32
+ */
+CPU_FEATURES_TARGET( "sse4.1,pclmul" )
+static uint32_t crc32_fold_pclmulqdq(
+                 uint32_t crc32,
+                 const uint8_t *buffer,
+                 size_t size )
+{
+	__m128i constants;
+	__m128i lower_mask;
+	__m128i value1;
+	__m128i value2;
+	__m128i value3;
+	__m128i value4;
+	__m128i value5;
+	__m128i value6;
+	__m128i value7;
+	__m128i value8;
+
+	/* Load the first 64 bytes and the initial value into 4 lanes
 	 */
-        for( buffer_offset = 0;
-	     buffer_offset < size;
-	     buffer_offset++ )
+	value1 = _mm_loadu_si128( (const __m128i *) &( buffer[ 0 ] ) );
+	value2 = _mm_loadu_si128( (const __m128i *) &( buffer[ 16 ] ) );
+	value3 = _mm_loadu_si128( (const __m128i *) &( buffer[ 32 ] ) );
+	value4 = _mm_loadu_si128( (const __m128i *) &( buffer[ 48 ] ) );
+
+	value1 = _mm_xor_si128( value1, _mm_cvtsi32_si128( (int) crc32 ) );
+
+	constants = _mm_loadu_si128( (const __m128i *) &( crc32_folding_constants[ 0 ] ) );
+
+	buffer += 64;
+	size   -= 64;
+
+	/* Fold 64 bytes per iteration
+	 */
+	while( size >= 64 )
 	{
-		byte_value   = buffer[ buffer_offset ];
-		mirror_value = 0;
+		value5 = _mm_clmulepi64_si128( value1, constants, 0x00 );
+		value6 = _mm_clmulepi64_si128( value2, constants, 0x00 );
+		value7 = _mm_clmulepi64_si128( value3, constants, 0x00 );
+		value8 = _mm_clmulepi64_si128( value4, constants, 0x00 );
 
-		/* Mirror the bit order of the byte value from the center
-		 */
-		for( bit_index = 0;
-		     bit_index < 8;
-		     bit_index++ )
-		{
-			if( ( byte_value & 0x01 ) != 0 )
-			{
-				mirror_value |= ( 1 << ( 7 - bit_index ) );
-			}
-			byte_value = byte_value >> 1;
-		}
-		calculated_crc32 ^= mirror_value << 24;
+		value1 = _mm_clmulepi64_si128( value1, constants, 0x11 );
+		value2 = _mm_clmulepi64_si128( value2, constants, 0x11 );
+		value3 = _mm_clmulepi64_si128( value3, constants, 0x11 );
+		value4 = _mm_clmulepi64_si128( value4, constants, 0x11 );
 
-		/* Perform a bit for bit modulo-2 division
-		*/
-		for( bit_index = 0;
-		     bit_index < 8;
-		     bit_index++ )
-		{
-			if( ( calculated_crc32 & 0x80000000UL ) != 0 )
-			{
-				calculated_crc32 <<= 1;
-				calculated_crc32  ^= 0x04c11db7UL;
+		value1 = _mm_xor_si128( value1, value5 );
+		value2 = _mm_xor_si128( value2, value6 );
+		value3 = _mm_xor_si128( value3, value7 );
+		value4 = _mm_xor_si128( value4, value8 );
 
-				crc32_xor_pattern <<= 1;
-				crc32_xor_pattern  ^= 0x04c11db7UL;
-			}
-			else
-			{
-				calculated_crc32 <<= 1;
+		value1 = _mm_xor_si128( value1, _mm_loadu_si128( (const __m128i *) &( buffer[ 0 ] ) ) );
+		value2 = _mm_xor_si128( value2, _mm_loadu_si128( (const __m128i *) &( buffer[ 16 ] ) ) );
+		value3 = _mm_xor_si128( value3, _mm_loadu_si128( (const __m128i *) &( buffer[ 32 ] ) ) );
+		value4 = _mm_xor_si128( value4, _mm_loadu_si128( (const __m128i *) &( buffer[ 48 ] ) ) );
 
-				crc32_xor_pattern <<= 1;
-			}
-			crc32_xor_pattern <<= 1;
-		}
+		buffer += 64;
+		size   -= 64;
 	}
-	/* Mirror the bit order of the CRC-32 value from the center
+	/* Fold the 4 lanes into 1
 	 */
-	for( bit_index = 0;
-	     bit_index < 32;
-	     bit_index++ )
+	constants = _mm_loadu_si128( (const __m128i *) &( crc32_folding_constants[ 2 ] ) );
+
+	value5 = _mm_clmulepi64_si128( value1, constants, 0x00 );
+	value1 = _mm_clmulepi64_si128( value1, constants, 0x11 );
+	value1 = _mm_xor_si128( value1, value2 );
+	value1 = _mm_xor_si128( value1, value5 );
+
+	value5 = _mm_clmulepi64_si128( value1, constants, 0x00 );
+	value1 = _mm_clmulepi64_si128( value1, constants, 0x11 );
+	value1 = _mm_xor_si128( value1, value3 );
+	value1 = _mm_xor_si128( value1, value5 );
+
+	value5 = _mm_clmulepi64_si128( value1, constants, 0x00 );
+	value1 = _mm_clmulepi64_si128( value1, constants, 0x11 );
+	value1 = _mm_xor_si128( value1, value4 );
+	value1 = _mm_xor_si128( value1, value5 );
+
+	/* Fold the remaining 16 byte blocks
+	 */
+	while( size >= 16 )
 	{
-		if( ( calculated_crc32 & 0x00000001UL ) != 0 )
-		{
-			mirror_value |= ( 1 << ( 31 - bit_index ) );
-		}
-		calculated_crc32 = calculated_crc32 >> 1;
+		value5 = _mm_clmulepi64_si128( value1, constants, 0x00 );
+		value1 = _mm_clmulepi64_si128( value1, constants, 0x11 );
+		value1 = _mm_xor_si128( value1, _mm_loadu_si128( (const __m128i *) buffer ) );
+		value1 = _mm_xor_si128( value1, value5 );
+
+		buffer += 16;
+		size   -= 16;
+	}
+	/* Fold 128-bit into 64-bit
+	 */
+	lower_mask = _mm_setr_epi32( ~0, 0, ~0, 0 );
+
+	value2 = _mm_clmulepi64_si128( value1, constants, 0x10 );
+	value1 = _mm_srli_si128( value1, 8 );
+	value1 = _mm_xor_si128( value1, value2 );
+
+	constants = _mm_loadl_epi64( (const __m128i *) &( crc32_folding_constants[ 4 ] ) );
+
+	value2 = _mm_srli_si128( value1, 4 );
+	value1 = _mm_and_si128( value1, lower_mask );
+	value1 = _mm_clmulepi64_si128( value1, constants, 0x00 );
+	value1 = _mm_xor_si128( value1, value2 );
+
+	/* Barrett reduce 64-bit into 32-bit
+	 */
+	constants = _mm_loadu_si128( (const __m128i *) &( crc32_folding_constants[ 6 ] ) );
+
+	value2 = _mm_and_si128( value1, lower_mask );
+	value2 = _mm_clmulepi64_si128( value2, constants, 0x10 );
+	value2 = _mm_and_si128( value2, lower_mask );
+	value2 = _mm_clmulepi64_si128( value2, constants, 0x00 );
+	value1 = _mm_xor_si128( value1, value2 );
+
+	return( (uint32_t) _mm_extract_epi32( value1, 1 ) );
+}
+
+/* Calculates the CRC-32C (Castagnoli) of a buffer using the SSE4.2 crc32 instruction
+ * The CRC-32 is the internal value, e.g. without the pre and post conditioning
+ * Returns the CRC-32
+ */
+CPU_FEATURES_TARGET( "sse4.2" )
+static uint32_t crc32_castagnoli_sse42(
+                 uint32_t crc32,
+                 const uint8_t *buffer,
+                 size_t size )
+{
+#if defined( __x86_64__ ) || defined( _M_X64 )
+	uint64_t crc64       = (uint64_t) crc32;
+	uint64_t value_64bit = 0;
+
+	while( size >= 8 )
+	{
+		byte_stream_copy_to_uint64_little_endian(
+		 buffer,
+		 value_64bit );
+
+		crc64 = _mm_crc32_u64( crc64, value_64bit );
+
+		buffer += 8;
+		size   -= 8;
+	}
+	crc32 = (uint32_t) crc64;
+#else
+	uint32_t value_32bit = 0;
+
+	while( size >= 4 )
+	{
+		byte_stream_copy_to_uint32_little_endian(
+		 buffer,
+		 value_32bit );
+
+		crc32 = _mm_crc32_u32( crc32, value_32bit );
+
+		buffer += 4;
+		size   -= 4;
+	}
+#endif
+	while( size > 0 )
+	{
+		crc32 = _mm_crc32_u8( crc32, *buffer );
+
+		buffer += 1;
+		size   -= 1;
 	}
-	calculated_crc32 = mirror_value ^ (uint32_t) 0xffffffffUL;
+	return( crc32 );
+}
+
+#elif defined( HAVE_CPU_FEATURES_ARM64 ) && defined( __ARM_FEATURE_CRC32 )
 
+/* Calculates the CRC-32 or CRC-32C (Castagnoli) of a buffer using the ARMv8 crc32 instructions
+ * The CRC-32 is the internal value, e.g. without the pre and post conditioning
+ * Returns the CRC-32
+ */
+static uint32_t crc32_calculate_arm_crc32(
+                 uint32_t crc32,
+                 const uint8_t *buffer,
+                 size_t size,
+                 uint8_t castagnoli )
+{
+	uint64_t value_64bit = 0;
+
+	while( size >= 8 )
+	{
+		byte_stream_copy_to_uint64_little_endian(
+		 buffer,
+		 value_64bit );
+
+		if( castagnoli != 0 )
+		{
+			crc32 = __crc32cd( crc32, value_64bit );
+		}
+		else
+		{
+			crc32 = __crc32d( crc32, value_64bit );
+		}
+		buffer += 8;
+		size   -= 8;
+	}
+	while( size > 0 )
+	{
+		if( castagnoli != 0 )
+		{
+			crc32 = __crc32cb( crc32, *buffer );
+		}
+		else
+		{
+			crc32 = __crc32b( crc32, *buffer );
+		}
+		buffer += 1;
+		size   -= 1;
+	}
+	return( crc32 );
+}
+
+#endif /* defined( HAVE_CPU_FEATURES_X86 ) */
+
+/* Calculates the CRC-32 of a buffer
+ * Uses the CRC instructions of the CPU if available, otherwise falls back to slicing-by-16
+ *
+ * On x86 carry-less multiplication (PCLMULQDQ) is used to fold the CRC-32 for any
+ * polynomial and the SSE4.2 crc32 instruction for the CRC-32C (Castagnoli) polynomial.
+ * On ARMv8 the crc32 instructions are used for the RFC 1952 and Castagnoli polynomials.
+ *
+ * Use a previous key of 0 to calculate a new CRC-32
+ * Returns 1 if successful or -1 on error
+ */
+int crc32_calculate_hardware(
+     uint32_t *crc32,
+     uint8_t *buffer,
+     size_t size,
+     uint32_t initial_value,
+     uint8_t weak_crc,
+     libcerror_error_t **error )
+{
+	static char *function = "crc32_calculate_hardware";
+	size_t buffer_offset  = 0;
+	uint32_t value_32bit  = 0;
+
+	if( crc32 == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid CRC-32.",
+		 function );
+
+		return( -1 );
+	}
+	if( buffer == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid buffer.",
+		 function );
+
+		return( -1 );
+	}
+	if( size > (size_t) SSIZE_MAX )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid size value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	value_32bit = initial_value;
+
+	if( weak_crc == 0 )
+	{
+		value_32bit ^= (uint32_t) 0xffffffffUL;
+	}
+#if defined( HAVE_CPU_FEATURES_X86 )
+	if( ( size >= 64 )
+	 && ( cpu_features_has(
+	       CPU_FEATURE_FLAG_SSE4_1 | CPU_FEATURE_FLAG_PCLMULQDQ ) != 0 ) )
+	{
+		buffer_offset = size & ~( (size_t) 15 );
+
+		value_32bit = crc32_fold_pclmulqdq(
+		               value_32bit,
+		               buffer,
+		               buffer_offset );
+	}
+	if( ( crc32_table_polynomial == 0x82f63b78UL )
+	 && ( cpu_features_has(
+	       CPU_FEATURE_FLAG_SSE4_2 ) != 0 ) )
+	{
+		value_32bit = crc32_castagnoli_sse42(
+		               value_32bit,
+		               &( buffer[ buffer_offset ] ),
+		               size - buffer_offset );
+
+		buffer_offset = size;
+	}
+#elif defined( HAVE_CPU_FEATURES_ARM64 ) && defined( __ARM_FEATURE_CRC32 )
+	if( ( crc32_table_polynomial == 0xedb88320UL )
+	 || ( crc32_table_polynomial == 0x82f63b78UL ) )
+	{
+		value_32bit = crc32_calculate_arm_crc32(
+		               value_32bit,
+		               buffer,
+		               size,
+		               (uint8_t) ( crc32_table_polynomial == 0x82f63b78UL ) );
+
+		buffer_offset = size;
+	}
+#endif
+	/* Calculate the remaining data with the internal value using slicing-by-16
+	 */
+	if( crc32_calculate_slicing_by_16(
+	     &value_32bit,
+	     &( buffer[ buffer_offset ] ),
+	     size - buffer_offset,
+	     value_32bit,
+	     1,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GENERIC,
+		 "%s: unable to calculate CRC-32 of remaining data.",
+		 function );
+
+		return( -1 );
+	}
+	if( weak_crc == 0 )
+	{
+		value_32bit ^= 0xffffffffUL;
+	}
+	*crc32 = value_32bit;
+
+	return( 1 );
+}
+
+/* Multiplies two polynomials modulo the (reversed) polynomial of the CRC-32 tables
+ * The polynomials are in reversed bit order, where the most significant bit is x^0
+ * Returns the product
+ */
+static uint32_t crc32_multiply_modulo(
+                 uint32_t first_polynomial,
+                 uint32_t second_polynomial )
+{
+	uint32_t bit_mask = 0x80000000UL;
+	uint32_t product  = 0;
+
+	while( bit_mask != 0 )
+	{
+		if( ( first_polynomial & bit_mask ) != 0 )
+		{
+			product ^= second_polynomial;
+		}
+		if( ( second_polynomial & 1 ) != 0 )
+		{
+			second_polynomial = ( second_polynomial >> 1 ) ^ crc32_table_polynomial;
+		}
+		else
+		{
+			second_polynomial >>= 1;
+		}
+		bit_mask >>= 1;
+	}
+	return( product );
+}
+
+/* Combines the CRC-32 of 2 consecutive buffers into the CRC-32 of both buffers
+ * The CRC-32 of the second buffer must be calculated with a previous key of 0
+ * The combination shifts the first CRC-32 over the size of the second buffer,
+ * by multiplying it with x^( 8 * second_size ) modulo the polynomial,
+ * so the combined CRC-32 can be determined without the data of the first buffer
+ * Uses the polynomial of the CRC-32 tables, refer to initialize_crc32_table
+ * Returns 1 if successful or -1 on error
+ */
+int crc32_combine_values(
+     uint32_t *crc32,
+     uint32_t first_crc32,
+     uint32_t second_crc32,
+     size64_t second_size,
+     libcerror_error_t **error )
+{
+	static char *function   = "crc32_combine_values";
+	uint32_t power_of_x     = 0x40000000UL;
+	uint32_t shift_multiple = 0x80000000UL;
+	uint64_t number_of_bits = 0;
+
+	if( crc32 == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid CRC-32.",
+		 function );
+
+		return( -1 );
+	}
+	if( second_size > ( (size64_t) UINT64_MAX / 8 ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid second size value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	/* Determine x^( 8 * second_size ) by square-and-multiply where
+	 * power_of_x contains x^( 2^bit_index )
+	 */
+	number_of_bits = (uint64_t) second_size * 8;
+
+	while( number_of_bits != 0 )
+	{
+		if( ( number_of_bits & 1 ) != 0 )
+		{
+			shift_multiple = crc32_multiply_modulo(
+			                  shift_multiple,
+			                  power_of_x );
+		}
+		power_of_x = crc32_multiply_modulo(
+		              power_of_x,
+		              power_of_x );
+
+		number_of_bits >>= 1;
+	}
+	*crc32 = crc32_multiply_modulo(
+	          shift_multiple,
+	          first_crc32 ) ^ second_crc32;
+
+	return( 1 );
+}
+
+/* Check the CRC-32 checksum for single-bit errors
+ * A single-bit error in the CRC-32 itself results in a difference of a single bit
+ * Returns 1 if successful, 0 if no error was found or -1 on error
+ */
+int crc32_validate(
+     uint32_t crc32,
+     uint32_t calculated_crc32,
+     uint8_t *bit_index,
+     libcerror_error_t **error )
+{
+	static char *function = "crc32_validate";
+
+	if( bit_index == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid bit index.",
+		 function );
+
+		return( -1 );
+	}
+	crc32 ^= calculated_crc32;
+
+	*bit_index = 32;
+
+	if( ( crc32 == 0 )
+	 || ( ( crc32 & ( crc32 - 1 ) ) != 0 ) )
+	{
+		return( 0 );
+	}
+	for( *bit_index = 0;
+	     *bit_index < 32;
+	     *bit_index += 1 )
+	{
+		if( ( crc32 & 1 ) != 0 )
+		{
+			break;
+		}
+		crc32 >>= 1;
+	}
+	return( 1 );
+}
+
+/* Determines the syndrome of a single-bit error at the next bit distance
+ * The syndrome is the CRC-32 of the error pattern, which only depends on
+ * the distance of the error bit from the end of the data
+ * Returns the syndrome
+ */
+static uint32_t crc32_get_next_syndrome(
+                 uint32_t syndrome,
+                 uint32_t polynomial )
+{
+	if( ( syndrome & 1 ) != 0 )
+	{
+		return( ( syndrome >> 1 ) ^ polynomial );
+	}
+	return( syndrome >> 1 );
+}
+
+/* Tries to locate the offset of a single-bit error using a CRC-32
+ * The CRC-32 is linear, hence the difference between the CRC-32 values
+ * only depends on the error and not on the data, the initial value or
+ * the weak CRC setting. The bit offset is relative to the start of the data
+ * where bit offset % 8 is the bit in the byte, with 0 the least significant bit
+ * Uses the polynomial of the CRC-32 tables, refer to initialize_crc32_table
+ * Returns 1 if successful, 0 if no error was found or -1 on error
+ */
+int crc32_locate_error_offset(
+     uint32_t crc32,
+     uint32_t calculated_crc32,
+     size_t size,
+     uint64_t *bit_offset,
+     libcerror_error_t **error )
+{
+	static char *function   = "crc32_locate_error_offset";
+	uint64_t bit_distance   = 0;
+	uint64_t number_of_bits = 0;
+	uint32_t syndrome       = 0;
+
+	if( size > (size_t) SSIZE_MAX )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid size value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	if( bit_offset == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid bit offset.",
+		 function );
+
+		return( -1 );
+	}
+	crc32 ^= calculated_crc32;
+
+	if( crc32 == 0 )
+	{
+		return( 0 );
+	}
+	number_of_bits = (uint64_t) size * 8;
+
+	/* The syndrome of an error in the last bit of the data is the polynomial
+	 */
+	syndrome = crc32_table_polynomial;
+
+	for( bit_distance = 0;
+	     bit_distance < number_of_bits;
+	     bit_distance++ )
+	{
+		if( syndrome == crc32 )
+		{
+			*bit_offset = number_of_bits - 1 - bit_distance;
+
+			return( 1 );
+		}
+		syndrome = crc32_get_next_syndrome(
+		            syndrome,
+		            crc32_table_polynomial );
+	}
+	return( 0 );
+}
+
+/* Determines the index of a syndrome in the syndrome table
+ * Returns the index
+ */
+static uint32_t crc32_syndrome_table_get_index(
+                 crc32_syndrome_table_t *syndrome_table,
+                 uint32_t syndrome )
+{
+	return( (uint32_t) ( syndrome * (uint32_t) 0x9e3779b1UL ) >> ( 32 - syndrome_table->number_of_index_bits ) );
+}
+
+/* Looks up the bit distance of a syndrome in the syndrome table
+ * Returns 1 if successful or 0 if no such syndrome
+ */
+static int crc32_syndrome_table_get_bit_distance(
+            crc32_syndrome_table_t *syndrome_table,
+            uint32_t syndrome,
+            uint32_t *bit_distance )
+{
+	uint32_t entry_index = 0;
+	uint32_t index_mask  = 0;
+
+	index_mask  = syndrome_table->number_of_entries - 1;
+	entry_index = crc32_syndrome_table_get_index(
+	               syndrome_table,
+	               syndrome );
+
+	/* A value of 0 marks an unused entry since the stored value is the bit distance + 1
+	 */
+	while( syndrome_table->bit_distances[ entry_index ] != 0 )
+	{
+		if( syndrome_table->syndromes[ entry_index ] == syndrome )
+		{
+			*bit_distance = syndrome_table->bit_distances[ entry_index ] - 1;
+
+			return( 1 );
+		}
+		entry_index = ( entry_index + 1 ) & index_mask;
+	}
+	return( 0 );
+}
+
+/* Creates a syndrome table
+ * The table contains the syndromes of the single-bit errors in data
+ * of up to maximum data size bytes, so that the error offset can
+ * be looked up directly from the difference of the CRC-32 values
+ * Uses the polynomial of the CRC-32 tables, refer to initialize_crc32_table
+ * Make sure the value syndrome_table is referencing, is set to NULL
+ * Returns 1 if successful or -1 on error
+ */
+int crc32_syndrome_table_initialize(
+     crc32_syndrome_table_t **syndrome_table,
+     size_t maximum_data_size,
+     libcerror_error_t **error )
+{
+	static char *function = "crc32_syndrome_table_initialize";
+	uint32_t bit_distance = 0;
+	uint32_t entry_index  = 0;
+	uint32_t index_mask   = 0;
+	uint32_t syndrome     = 0;
+
+	if( syndrome_table == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid syndrome table.",
+		 function );
+
+		return( -1 );
+	}
+	if( *syndrome_table != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid syndrome table value already set.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( maximum_data_size == 0 )
+	 || ( maximum_data_size > (size_t) CRC32_SYNDROME_TABLE_MAXIMUM_DATA_SIZE ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid maximum data size value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	*syndrome_table = memory_allocate_structure(
+	                   crc32_syndrome_table_t );
+
+	if( *syndrome_table == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create syndrome table.",
+		 function );
+
+		goto on_error;
+	}
+	if( memory_set(
+	     *syndrome_table,
+	     0,
+	     sizeof( crc32_syndrome_table_t ) ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear syndrome table.",
+		 function );
+
+		memory_free(
+		 *syndrome_table );
+
+		*syndrome_table = NULL;
+
+		return( -1 );
+	}
+	( *syndrome_table )->polynomial             = crc32_table_polynomial;
+	( *syndrome_table )->maximum_number_of_bits = (uint32_t) maximum_data_size * 8;
+
+	/* Use at least twice the number of entries as there are syndromes
+	 * to keep the number of entries that need to be probed small
+	 */
+	( *syndrome_table )->number_of_index_bits = 1;
+
+	while( ( (uint32_t) 1 << ( *syndrome_table )->number_of_index_bits ) < ( 2 * ( *syndrome_table )->maximum_number_of_bits ) )
+	{
+		( *syndrome_table )->number_of_index_bits += 1;
+	}
+	( *syndrome_table )->number_of_entries = (uint32_t) 1 << ( *syndrome_table )->number_of_index_bits;
+
+	( *syndrome_table )->syndromes = (uint32_t *) memory_allocate(
+	                                               sizeof( uint32_t ) * ( *syndrome_table )->number_of_entries );
+
+	if( ( *syndrome_table )->syndromes == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create syndromes.",
+		 function );
+
+		goto on_error;
+	}
+	( *syndrome_table )->bit_distances = (uint32_t *) memory_allocate(
+	                                                   sizeof( uint32_t ) * ( *syndrome_table )->number_of_entries );
+
+	if( ( *syndrome_table )->bit_distances == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create bit distances.",
+		 function );
+
+		goto on_error;
+	}
+	if( memory_set(
+	     ( *syndrome_table )->bit_distances,
+	     0,
+	     sizeof( uint32_t ) * ( *syndrome_table )->number_of_entries ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear bit distances.",
+		 function );
+
+		goto on_error;
+	}
+	index_mask = ( *syndrome_table )->number_of_entries - 1;
+	syndrome   = crc32_table_polynomial;
+
+	for( bit_distance = 0;
+	     bit_distance < ( *syndrome_table )->maximum_number_of_bits;
+	     bit_distance++ )
+	{
+		entry_index = crc32_syndrome_table_get_index(
+		               *syndrome_table,
+		               syndrome );
+
+		while( ( *syndrome_table )->bit_distances[ entry_index ] != 0 )
+		{
+			entry_index = ( entry_index + 1 ) & index_mask;
+		}
+		( *syndrome_table )->syndromes[ entry_index ]     = syndrome;
+		( *syndrome_table )->bit_distances[ entry_index ] = bit_distance + 1;
+
+		syndrome = crc32_get_next_syndrome(
+		            syndrome,
+		            crc32_table_polynomial );
+	}
+	return( 1 );
+
+on_error:
+	if( *syndrome_table != NULL )
+	{
+		if( ( *syndrome_table )->bit_distances != NULL )
+		{
+			memory_free(
+			 ( *syndrome_table )->bit_distances );
+		}
+		if( ( *syndrome_table )->syndromes != NULL )
+		{
+			memory_free(
+			 ( *syndrome_table )->syndromes );
+		}
+		memory_free(
+		 *syndrome_table );
+
+		*syndrome_table = NULL;
+	}
+	return( -1 );
+}
+
+/* Frees a syndrome table
+ * Returns 1 if successful or -1 on error
+ */
+int crc32_syndrome_table_free(
+     crc32_syndrome_table_t **syndrome_table,
+     libcerror_error_t **error )
+{
+	static char *function = "crc32_syndrome_table_free";
+
+	if( syndrome_table == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid syndrome table.",
+		 function );
+
+		return( -1 );
+	}
+	if( *syndrome_table != NULL )
+	{
+		if( ( *syndrome_table )->bit_distances != NULL )
+		{
+			memory_free(
+			 ( *syndrome_table )->bit_distances );
+		}
+		if( ( *syndrome_table )->syndromes != NULL )
+		{
+			memory_free(
+			 ( *syndrome_table )->syndromes );
+		}
+		memory_free(
+		 *syndrome_table );
+
+		*syndrome_table = NULL;
+	}
+	return( 1 );
+}
+
+/* Checks the arguments of the syndrome table locate functions
+ * Returns 1 if successful or -1 on error
+ */
+static int crc32_syndrome_table_check_arguments(
+            crc32_syndrome_table_t *syndrome_table,
+            size_t size,
+            const char *function,
+            libcerror_error_t **error )
+{
+	if( syndrome_table == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid syndrome table.",
+		 function );
+
+		return( -1 );
+	}
+	if( syndrome_table->polynomial != crc32_table_polynomial )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid syndrome table - polynomial does not match the CRC-32 tables.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( size > (size_t) CRC32_SYNDROME_TABLE_MAXIMUM_DATA_SIZE )
+	 || ( ( (uint32_t) size * 8 ) > syndrome_table->maximum_number_of_bits ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid size value exceeds maximum data size of syndrome table.",
+		 function );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Tries to locate the offset of a single-bit error using a syndrome table
+ * The bit offset is relative to the start of the data,
+ * refer to crc32_locate_error_offset
+ * Returns 1 if successful, 0 if no error was found or -1 on error
+ */
+int crc32_syndrome_table_locate_error_offset(
+     crc32_syndrome_table_t *syndrome_table,
+     uint32_t crc32,
+     uint32_t calculated_crc32,
+     size_t size,
+     uint64_t *bit_offset,
+     libcerror_error_t **error )
+{
+	static char *function   = "crc32_syndrome_table_locate_error_offset";
+	uint32_t bit_distance   = 0;
+	uint32_t number_of_bits = 0;
+
+	if( crc32_syndrome_table_check_arguments(
+	     syndrome_table,
+	     size,
+	     function,
+	     error ) != 1 )
+	{
+		return( -1 );
+	}
+	if( bit_offset == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid bit offset.",
+		 function );
+
+		return( -1 );
+	}
+	crc32 ^= calculated_crc32;
+
+	if( crc32 == 0 )
+	{
+		return( 0 );
+	}
+	number_of_bits = (uint32_t) size * 8;
+
+	if( crc32_syndrome_table_get_bit_distance(
+	     syndrome_table,
+	     crc32,
+	     &bit_distance ) == 0 )
+	{
+		return( 0 );
+	}
+	if( bit_distance >= number_of_bits )
+	{
+		return( 0 );
+	}
+	*bit_offset = (uint64_t) ( number_of_bits - 1 - bit_distance );
+
+	return( 1 );
+}
+
+/* Tries to locate the offsets of a double-bit error using a syndrome table
+ * The syndrome of a double-bit error is the syndrome of the first error
+ * XOR the syndrome of the second error, hence for every possible first error
+ * the second error can be looked up in the syndrome table
+ * The bit offsets are relative to the start of the data,
+ * refer to crc32_locate_error_offset, where the first bit offset is the smallest
+ * Returns 1 if successful, 0 if no error was found or -1 on error
+ */
+int crc32_syndrome_table_locate_double_error_offsets(
+     crc32_syndrome_table_t *syndrome_table,
+     uint32_t crc32,
+     uint32_t calculated_crc32,
+     size_t size,
+     uint64_t *first_bit_offset,
+     uint64_t *second_bit_offset,
+     libcerror_error_t **error )
+{
+	static char *function        = "crc32_syndrome_table_locate_double_error_offsets";
+	uint32_t first_bit_distance  = 0;
+	uint32_t first_syndrome      = 0;
+	uint32_t number_of_bits      = 0;
+	uint32_t second_bit_distance = 0;
+
+	if( crc32_syndrome_table_check_arguments(
+	     syndrome_table,
+	     size,
+	     function,
+	     error ) != 1 )
+	{
+		return( -1 );
+	}
+	if( first_bit_offset == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid first bit offset.",
+		 function );
+
+		return( -1 );
+	}
+	if( second_bit_offset == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid second bit offset.",
+		 function );
+
+		return( -1 );
+	}
+	crc32 ^= calculated_crc32;
+
+	if( crc32 == 0 )
+	{
+		return( 0 );
+	}
+	number_of_bits = (uint32_t) size * 8;
+	first_syndrome = crc32_table_polynomial;
+
+	/* The first error is the one closest to the end of the data
+	 * hence only second errors further from the end need to be considered
+	 */
+	for( first_bit_distance = 0;
+	     first_bit_distance < number_of_bits;
+	     first_bit_distance++ )
+	{
+		if( crc32_syndrome_table_get_bit_distance(
+		     syndrome_table,
+		     crc32 ^ first_syndrome,
+		     &second_bit_distance ) != 0 )
+		{
+			if( ( second_bit_distance > first_bit_distance )
+			 && ( second_bit_distance < number_of_bits ) )
+			{
+				*first_bit_offset  = (uint64_t) ( number_of_bits - 1 - second_bit_distance );
+				*second_bit_offset = (uint64_t) ( number_of_bits - 1 - first_bit_distance );
+
+				return( 1 );
+			}
+		}
+		first_syndrome = crc32_get_next_syndrome(
+		                  first_syndrome,
+		                  crc32_table_polynomial );
+	}
 	return( 0 );
 }
 
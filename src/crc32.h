@@ -31,6 +31,40 @@
 extern "C" {
 #endif
 
+/* The maximum data size supported by the syndrome table
+ */
+#define CRC32_SYNDROME_TABLE_MAXIMUM_DATA_SIZE	( 1024 * 1024 )
+
+typedef struct crc32_syndrome_table crc32_syndrome_table_t;
+
+struct crc32_syndrome_table
+{
+	/* The polynomial of the CRC-32 tables used to determine the syndromes
+	 */
+	uint32_t polynomial;
+
+	/* The maximum number of bits, which is the number of syndromes
+	 */
+	uint32_t maximum_number_of_bits;
+
+	/* The number of bits of an entry index
+	 */
+	uint8_t number_of_index_bits;
+
+	/* The number of entries, which is a power of 2
+	 */
+	uint32_t number_of_entries;
+
+	/* The syndromes of the entries
+	 */
+	uint32_t *syndromes;
+
+	/* The bit distance from the end of the data + 1 of the entries
+	 * where 0 represents an unused entry
+	 */
+	uint32_t *bit_distances;
+};
+
 void initialize_crc32_table(
       uint32_t polynomial );
 
@@ -50,6 +84,37 @@ int crc32_calculate(
      uint8_t weak_crc,
      libcerror_error_t **error );
 
+int crc32_calculate_slicing_by_8(
+     uint32_t *crc32,
+     uint8_t *buffer,
+     size_t size,
+     uint32_t initial_value,
+     uint8_t weak_crc,
+     libcerror_error_t **error );
+
+int crc32_calculate_slicing_by_16(
+     uint32_t *crc32,
+     uint8_t *buffer,
+     size_t size,
+     uint32_t initial_value,
+     uint8_t weak_crc,
+     libcerror_error_t **error );
+
+int crc32_calculate_hardware(
+     uint32_t *crc32,
+     uint8_t *buffer,
+     size_t size,
+     uint32_t initial_value,
+     uint8_t weak_crc,
+     libcerror_error_t **error );
+
+int crc32_combine_values(
+     uint32_t *crc32,
+     uint32_t first_crc32,
+     uint32_t second_crc32,
+     size64_t second_size,
+     libcerror_error_t **error );
+
 int crc32_validate(
      uint32_t crc32,
      uint32_t calculated_crc32,
@@ -59,9 +124,34 @@ int crc32_validate(
 int crc32_locate_error_offset(
      uint32_t crc32,
      uint32_t calculated_crc32,
-     uint8_t *buffer,
      size_t size,
-     uint32_t initial_value,
+     uint64_t *bit_offset,
+     libcerror_error_t **error );
+
+int crc32_syndrome_table_initialize(
+     crc32_syndrome_table_t **syndrome_table,
+     size_t maximum_data_size,
+     libcerror_error_t **error );
+
+int crc32_syndrome_table_free(
+     crc32_syndrome_table_t **syndrome_table,
+     libcerror_error_t **error );
+
+int crc32_syndrome_table_locate_error_offset(
+     crc32_syndrome_table_t *syndrome_table,
+     uint32_t crc32,
+     uint32_t calculated_crc32,
+     size_t size,
+     uint64_t *bit_offset,
+     libcerror_error_t **error );
+
+int crc32_syndrome_table_locate_double_error_offsets(
+     crc32_syndrome_table_t *syndrome_table,
+     uint32_t crc32,
+     uint32_t calculated_crc32,
+     size_t size,
+     uint64_t *first_bit_offset,
+     uint64_t *second_bit_offset,
      libcerror_error_t **error );
 
 #if defined( __cplusplus )
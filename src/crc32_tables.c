@@ -0,0 +1,2170 @@
+/*
+ * CRC-32 lookup tables
+ *
+ * This file was generated by scripts/crc_tables.py, do not edit.
+ *
+ * Copyright (C) 2008-2019, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This software is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This software is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this software.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <types.h>
+
+#include "crc32_tables.h"
+
+/* The slicing tables of the RFC 1952 polynomial
+ * Polynomial: 0xedb88320
+ */
+const uint32_t crc32_slicing_tables_rfc1952[ 16 ][ 256 ] = {
+	{
+		0x00000000UL, 0x77073096UL, 0xee0e612cUL, 0x990951baUL,
+		0x076dc419UL, 0x706af48fUL, 0xe963a535UL, 0x9e6495a3UL,
+		0x0edb8832UL, 0x79dcb8a4UL, 0xe0d5e91eUL, 0x97d2d988UL,
+		0x09b64c2bUL, 0x7eb17cbdUL, 0xe7b82d07UL, 0x90bf1d91UL,
+		0x1db71064UL, 0x6ab020f2UL, 0xf3b97148UL, 0x84be41deUL,
+		0x1adad47dUL, 0x6ddde4ebUL, 0xf4d4b551UL, 0x83d385c7UL,
+		0x136c9856UL, 0x646ba8c0UL, 0xfd62f97aUL, 0x8a65c9ecUL,
+		0x14015c4fUL, 0x63066cd9UL, 0xfa0f3d63UL, 0x8d080df5UL,
+		0x3b6e20c8UL, 0x4c69105eUL, 0xd56041e4UL, 0xa2677172UL,
+		0x3c03e4d1UL, 0x4b04d447UL, 0xd20d85fdUL, 0xa50ab56bUL,
+		0x35b5a8faUL, 0x42b2986cUL, 0xdbbbc9d6UL, 0xacbcf940UL,
+		0x32d86ce3UL, 0x45df5c75UL, 0xdcd60dcfUL, 0xabd13d59UL,
+		0x26d930acUL, 0x51de003aUL, 0xc8d75180UL, 0xbfd06116UL,
+		0x21b4f4b5UL, 0x56b3c423UL, 0xcfba9599UL, 0xb8bda50fUL,
+		0x2802b89eUL, 0x5f058808UL, 0xc60cd9b2UL, 0xb10be924UL,
+		0x2f6f7c87UL, 0x58684c11UL, 0xc1611dabUL, 0xb6662d3dUL,
+		0x76dc4190UL, 0x01db7106UL, 0x98d220bcUL, 0xefd5102aUL,
+		0x71b18589UL, 0x06b6b51fUL, 0x9fbfe4a5UL, 0xe8b8d433UL,
+		0x7807c9a2UL, 0x0f00f934UL, 0x9609a88eUL, 0xe10e9818UL,
+		0x7f6a0dbbUL, 0x086d3d2dUL, 0x91646c97UL, 0xe6635c01UL,
+		0x6b6b51f4UL, 0x1c6c6162UL, 0x856530d8UL, 0xf262004eUL,
+		0x6c0695edUL, 0x1b01a57bUL, 0x8208f4c1UL, 0xf50fc457UL,
+		0x65b0d9c6UL, 0x12b7e950UL, 0x8bbeb8eaUL, 0xfcb9887cUL,
+		0x62dd1ddfUL, 0x15da2d49UL, 0x8cd37cf3UL, 0xfbd44c65UL,
+		0x4db26158UL, 0x3ab551ceUL, 0xa3bc0074UL, 0xd4bb30e2UL,
+		0x4adfa541UL, 0x3dd895d7UL, 0xa4d1c46dUL, 0xd3d6f4fbUL,
+		0x4369e96aUL, 0x346ed9fcUL, 0xad678846UL, 0xda60b8d0UL,
+		0x44042d73UL, 0x33031de5UL, 0xaa0a4c5fUL, 0xdd0d7cc9UL,
+		0x5005713cUL, 0x270241aaUL, 0xbe0b1010UL, 0xc90c2086UL,
+		0x5768b525UL, 0x206f85b3UL, 0xb966d409UL, 0xce61e49fUL,
+		0x5edef90eUL, 0x29d9c998UL, 0xb0d09822UL, 0xc7d7a8b4UL,
+		0x59b33d17UL, 0x2eb40d81UL, 0xb7bd5c3bUL, 0xc0ba6cadUL,
+		0xedb88320UL, 0x9abfb3b6UL, 0x03b6e20cUL, 0x74b1d29aUL,
+		0xead54739UL, 0x9dd277afUL, 0x04db2615UL, 0x73dc1683UL,
+		0xe3630b12UL, 0x94643b84UL, 0x0d6d6a3eUL, 0x7a6a5aa8UL,
+		0xe40ecf0bUL, 0x9309ff9dUL, 0x0a00ae27UL, 0x7d079eb1UL,
+		0xf00f9344UL, 0x8708a3d2UL, 0x1e01f268UL, 0x6906c2feUL,
+		0xf762575dUL, 0x806567cbUL, 0x196c3671UL, 0x6e6b06e7UL,
+		0xfed41b76UL, 0x89d32be0UL, 0x10da7a5aUL, 0x67dd4accUL,
+		0xf9b9df6fUL, 0x8ebeeff9UL, 0x17b7be43UL, 0x60b08ed5UL,
+		0xd6d6a3e8UL, 0xa1d1937eUL, 0x38d8c2c4UL, 0x4fdff252UL,
+		0xd1bb67f1UL, 0xa6bc5767UL, 0x3fb506ddUL, 0x48b2364bUL,
+		0xd80d2bdaUL, 0xaf0a1b4cUL, 0x36034af6UL, 0x41047a60UL,
+		0xdf60efc3UL, 0xa867df55UL, 0x316e8eefUL, 0x4669be79UL,
+		0xcb61b38cUL, 0xbc66831aUL, 0x256fd2a0UL, 0x5268e236UL,
+		0xcc0c7795UL, 0xbb0b4703UL, 0x220216b9UL, 0x5505262fUL,
+		0xc5ba3bbeUL, 0xb2bd0b28UL, 0x2bb45a92UL, 0x5cb36a04UL,
+		0xc2d7ffa7UL, 0xb5d0cf31UL, 0x2cd99e8bUL, 0x5bdeae1dUL,
+		0x9b64c2b0UL, 0xec63f226UL, 0x756aa39cUL, 0x026d930aUL,
+		0x9c0906a9UL, 0xeb0e363fUL, 0x72076785UL, 0x05005713UL,
+		0x95bf4a82UL, 0xe2b87a14UL, 0x7bb12baeUL, 0x0cb61b38UL,
+		0x92d28e9bUL, 0xe5d5be0dUL, 0x7cdcefb7UL, 0x0bdbdf21UL,
+		0x86d3d2d4UL, 0xf1d4e242UL, 0x68ddb3f8UL, 0x1fda836eUL,
+		0x81be16cdUL, 0xf6b9265bUL, 0x6fb077e1UL, 0x18b74777UL,
+		0x88085ae6UL, 0xff0f6a70UL, 0x66063bcaUL, 0x11010b5cUL,
+		0x8f659effUL, 0xf862ae69UL, 0x616bffd3UL, 0x166ccf45UL,
+		0xa00ae278UL, 0xd70dd2eeUL, 0x4e048354UL, 0x3903b3c2UL,
+		0xa7672661UL, 0xd06016f7UL, 0x4969474dUL, 0x3e6e77dbUL,
+		0xaed16a4aUL, 0xd9d65adcUL, 0x40df0b66UL, 0x37d83bf0UL,
+		0xa9bcae53UL, 0xdebb9ec5UL, 0x47b2cf7fUL, 0x30b5ffe9UL,
+		0xbdbdf21cUL, 0xcabac28aUL, 0x53b39330UL, 0x24b4a3a6UL,
+		0xbad03605UL, 0xcdd70693UL, 0x54de5729UL, 0x23d967bfUL,
+		0xb3667a2eUL, 0xc4614ab8UL, 0x5d681b02UL, 0x2a6f2b94UL,
+		0xb40bbe37UL, 0xc30c8ea1UL, 0x5a05df1bUL, 0x2d02ef8dUL
+	},
+	{
+		0x00000000UL, 0x191b3141UL, 0x32366282UL, 0x2b2d53c3UL,
+		0x646cc504UL, 0x7d77f445UL, 0x565aa786UL, 0x4f4196c7UL,
+		0xc8d98a08UL, 0xd1c2bb49UL, 0xfaefe88aUL, 0xe3f4d9cbUL,
+		0xacb54f0cUL, 0xb5ae7e4dUL, 0x9e832d8eUL, 0x87981ccfUL,
+		0x4ac21251UL, 0x53d92310UL, 0x78f470d3UL, 0x61ef4192UL,
+		0x2eaed755UL, 0x37b5e614UL, 0x1c98b5d7UL, 0x05838496UL,
+		0x821b9859UL, 0x9b00a918UL, 0xb02dfadbUL, 0xa936cb9aUL,
+		0xe6775d5dUL, 0xff6c6c1cUL, 0xd4413fdfUL, 0xcd5a0e9eUL,
+		0x958424a2UL, 0x8c9f15e3UL, 0xa7b24620UL, 0xbea97761UL,
+		0xf1e8e1a6UL, 0xe8f3d0e7UL, 0xc3de8324UL, 0xdac5b265UL,
+		0x5d5daeaaUL, 0x44469febUL, 0x6f6bcc28UL, 0x7670fd69UL,
+		0x39316baeUL, 0x202a5aefUL, 0x0b07092cUL, 0x121c386dUL,
+		0xdf4636f3UL, 0xc65d07b2UL, 0xed705471UL, 0xf46b6530UL,
+		0xbb2af3f7UL, 0xa231c2b6UL, 0x891c9175UL, 0x9007a034UL,
+		0x179fbcfbUL, 0x0e848dbaUL, 0x25a9de79UL, 0x3cb2ef38UL,
+		0x73f379ffUL, 0x6ae848beUL, 0x41c51b7dUL, 0x58de2a3cUL,
+		0xf0794f05UL, 0xe9627e44UL, 0xc24f2d87UL, 0xdb541cc6UL,
+		0x94158a01UL, 0x8d0ebb40UL, 0xa623e883UL, 0xbf38d9c2UL,
+		0x38a0c50dUL, 0x21bbf44cUL, 0x0a96a78fUL, 0x138d96ceUL,
+		0x5ccc0009UL, 0x45d73148UL, 0x6efa628bUL, 0x77e153caUL,
+		0xbabb5d54UL, 0xa3a06c15UL, 0x888d3fd6UL, 0x91960e97UL,
+		0xded79850UL, 0xc7cca911UL, 0xece1fad2UL, 0xf5facb93UL,
+		0x7262d75cUL, 0x6b79e61dUL, 0x4054b5deUL, 0x594f849fUL,
+		0x160e1258UL, 0x0f152319UL, 0x243870daUL, 0x3d23419bUL,
+		0x65fd6ba7UL, 0x7ce65ae6UL, 0x57cb0925UL, 0x4ed03864UL,
+		0x0191aea3UL, 0x188a9fe2UL, 0x33a7cc21UL, 0x2abcfd60UL,
+		0xad24e1afUL, 0xb43fd0eeUL, 0x9f12832dUL, 0x8609b26cUL,
+		0xc94824abUL, 0xd05315eaUL, 0xfb7e4629UL, 0xe2657768UL,
+		0x2f3f79f6UL, 0x362448b7UL, 0x1d091b74UL, 0x04122a35UL,
+		0x4b53bcf2UL, 0x52488db3UL, 0x7965de70UL, 0x607eef31UL,
+		0xe7e6f3feUL, 0xfefdc2bfUL, 0xd5d0917cUL, 0xcccba03dUL,
+		0x838a36faUL, 0x9a9107bbUL, 0xb1bc5478UL, 0xa8a76539UL,
+		0x3b83984bUL, 0x2298a90aUL, 0x09b5fac9UL, 0x10aecb88UL,
+		0x5fef5d4fUL, 0x46f46c0eUL, 0x6dd93fcdUL, 0x74c20e8cUL,
+		0xf35a1243UL, 0xea412302UL, 0xc16c70c1UL, 0xd8774180UL,
+		0x9736d747UL, 0x8e2de606UL, 0xa500b5c5UL, 0xbc1b8484UL,
+		0x71418a1aUL, 0x685abb5bUL, 0x4377e898UL, 0x5a6cd9d9UL,
+		0x152d4f1eUL, 0x0c367e5fUL, 0x271b2d9cUL, 0x3e001cddUL,
+		0xb9980012UL, 0xa0833153UL, 0x8bae6290UL, 0x92b553d1UL,
+		0xddf4c516UL, 0xc4eff457UL, 0xefc2a794UL, 0xf6d996d5UL,
+		0xae07bce9UL, 0xb71c8da8UL, 0x9c31de6bUL, 0x852aef2aUL,
+		0xca6b79edUL, 0xd37048acUL, 0xf85d1b6fUL, 0xe1462a2eUL,
+		0x66de36e1UL, 0x7fc507a0UL, 0x54e85463UL, 0x4df36522UL,
+		0x02b2f3e5UL, 0x1ba9c2a4UL, 0x30849167UL, 0x299fa026UL,
+		0xe4c5aeb8UL, 0xfdde9ff9UL, 0xd6f3cc3aUL, 0xcfe8fd7bUL,
+		0x80a96bbcUL, 0x99b25afdUL, 0xb29f093eUL, 0xab84387fUL,
+		0x2c1c24b0UL, 0x350715f1UL, 0x1e2a4632UL, 0x07317773UL,
+		0x4870e1b4UL, 0x516bd0f5UL, 0x7a468336UL, 0x635db277UL,
+		0xcbfad74eUL, 0xd2e1e60fUL, 0xf9ccb5ccUL, 0xe0d7848dUL,
+		0xaf96124aUL, 0xb68d230bUL, 0x9da070c8UL, 0x84bb4189UL,
+		0x03235d46UL, 0x1a386c07UL, 0x31153fc4UL, 0x280e0e85UL,
+		0x674f9842UL, 0x7e54a903UL, 0x5579fac0UL, 0x4c62cb81UL,
+		0x8138c51fUL, 0x9823f45eUL, 0xb30ea79dUL, 0xaa1596dcUL,
+		0xe554001bUL, 0xfc4f315aUL, 0xd7626299UL, 0xce7953d8UL,
+		0x49e14f17UL, 0x50fa7e56UL, 0x7bd72d95UL, 0x62cc1cd4UL,
+		0x2d8d8a13UL, 0x3496bb52UL, 0x1fbbe891UL, 0x06a0d9d0UL,
+		0x5e7ef3ecUL, 0x4765c2adUL, 0x6c48916eUL, 0x7553a02fUL,
+		0x3a1236e8UL, 0x230907a9UL, 0x0824546aUL, 0x113f652bUL,
+		0x96a779e4UL, 0x8fbc48a5UL, 0xa4911b66UL, 0xbd8a2a27UL,
+		0xf2cbbce0UL, 0xebd08da1UL, 0xc0fdde62UL, 0xd9e6ef23UL,
+		0x14bce1bdUL, 0x0da7d0fcUL, 0x268a833fUL, 0x3f91b27eUL,
+		0x70d024b9UL, 0x69cb15f8UL, 0x42e6463bUL, 0x5bfd777aUL,
+		0xdc656bb5UL, 0xc57e5af4UL, 0xee530937UL, 0xf7483876UL,
+		0xb809aeb1UL, 0xa1129ff0UL, 0x8a3fcc33UL, 0x9324fd72UL
+	},
+	{
+		0x00000000UL, 0x01c26a37UL, 0x0384d46eUL, 0x0246be59UL,
+		0x0709a8dcUL, 0x06cbc2ebUL, 0x048d7cb2UL, 0x054f1685UL,
+		0x0e1351b8UL, 0x0fd13b8fUL, 0x0d9785d6UL, 0x0c55efe1UL,
+		0x091af964UL, 0x08d89353UL, 0x0a9e2d0aUL, 0x0b5c473dUL,
+		0x1c26a370UL, 0x1de4c947UL, 0x1fa2771eUL, 0x1e601d29UL,
+		0x1b2f0bacUL, 0x1aed619bUL, 0x18abdfc2UL, 0x1969b5f5UL,
+		0x1235f2c8UL, 0x13f798ffUL, 0x11b126a6UL, 0x10734c91UL,
+		0x153c5a14UL, 0x14fe3023UL, 0x16b88e7aUL, 0x177ae44dUL,
+		0x384d46e0UL, 0x398f2cd7UL, 0x3bc9928eUL, 0x3a0bf8b9UL,
+		0x3f44ee3cUL, 0x3e86840bUL, 0x3cc03a52UL, 0x3d025065UL,
+		0x365e1758UL, 0x379c7d6fUL, 0x35dac336UL, 0x3418a901UL,
+		0x3157bf84UL, 0x3095d5b3UL, 0x32d36beaUL, 0x331101ddUL,
+		0x246be590UL, 0x25a98fa7UL, 0x27ef31feUL, 0x262d5bc9UL,
+		0x23624d4cUL, 0x22a0277bUL, 0x20e69922UL, 0x2124f315UL,
+		0x2a78b428UL, 0x2bbade1fUL, 0x29fc6046UL, 0x283e0a71UL,
+		0x2d711cf4UL, 0x2cb376c3UL, 0x2ef5c89aUL, 0x2f37a2adUL,
+		0x709a8dc0UL, 0x7158e7f7UL, 0x731e59aeUL, 0x72dc3399UL,
+		0x7793251cUL, 0x76514f2bUL, 0x7417f172UL, 0x75d59b45UL,
+		0x7e89dc78UL, 0x7f4bb64fUL, 0x7d0d0816UL, 0x7ccf6221UL,
+		0x798074a4UL, 0x78421e93UL, 0x7a04a0caUL, 0x7bc6cafdUL,
+		0x6cbc2eb0UL, 0x6d7e4487UL, 0x6f38fadeUL, 0x6efa90e9UL,
+		0x6bb5866cUL, 0x6a77ec5bUL, 0x68315202UL, 0x69f33835UL,
+		0x62af7f08UL, 0x636d153fUL, 0x612bab66UL, 0x60e9c151UL,
+		0x65a6d7d4UL, 0x6464bde3UL, 0x662203baUL, 0x67e0698dUL,
+		0x48d7cb20UL, 0x4915a117UL, 0x4b531f4eUL, 0x4a917579UL,
+		0x4fde63fcUL, 0x4e1c09cbUL, 0x4c5ab792UL, 0x4d98dda5UL,
+		0x46c49a98UL, 0x4706f0afUL, 0x45404ef6UL, 0x448224c1UL,
+		0x41cd3244UL, 0x400f5873UL, 0x4249e62aUL, 0x438b8c1dUL,
+		0x54f16850UL, 0x55330267UL, 0x5775bc3eUL, 0x56b7d609UL,
+		0x53f8c08cUL, 0x523aaabbUL, 0x507c14e2UL, 0x51be7ed5UL,
+		0x5ae239e8UL, 0x5b2053dfUL, 0x5966ed86UL, 0x58a487b1UL,
+		0x5deb9134UL, 0x5c29fb03UL, 0x5e6f455aUL, 0x5fad2f6dUL,
+		0xe1351b80UL, 0xe0f771b7UL, 0xe2b1cfeeUL, 0xe373a5d9UL,
+		0xe63cb35cUL, 0xe7fed96bUL, 0xe5b86732UL, 0xe47a0d05UL,
+		0xef264a38UL, 0xeee4200fUL, 0xeca29e56UL, 0xed60f461UL,
+		0xe82fe2e4UL, 0xe9ed88d3UL, 0xebab368aUL, 0xea695cbdUL,
+		0xfd13b8f0UL, 0xfcd1d2c7UL, 0xfe976c9eUL, 0xff5506a9UL,
+		0xfa1a102cUL, 0xfbd87a1bUL, 0xf99ec442UL, 0xf85cae75UL,
+		0xf300e948UL, 0xf2c2837fUL, 0xf0843d26UL, 0xf1465711UL,
+		0xf4094194UL, 0xf5cb2ba3UL, 0xf78d95faUL, 0xf64fffcdUL,
+		0xd9785d60UL, 0xd8ba3757UL, 0xdafc890eUL, 0xdb3ee339UL,
+		0xde71f5bcUL, 0xdfb39f8bUL, 0xddf521d2UL, 0xdc374be5UL,
+		0xd76b0cd8UL, 0xd6a966efUL, 0xd4efd8b6UL, 0xd52db281UL,
+		0xd062a404UL, 0xd1a0ce33UL, 0xd3e6706aUL, 0xd2241a5dUL,
+		0xc55efe10UL, 0xc49c9427UL, 0xc6da2a7eUL, 0xc7184049UL,
+		0xc25756ccUL, 0xc3953cfbUL, 0xc1d382a2UL, 0xc011e895UL,
+		0xcb4dafa8UL, 0xca8fc59fUL, 0xc8c97bc6UL, 0xc90b11f1UL,
+		0xcc440774UL, 0xcd866d43UL, 0xcfc0d31aUL, 0xce02b92dUL,
+		0x91af9640UL, 0x906dfc77UL, 0x922b422eUL, 0x93e92819UL,
+		0x96a63e9cUL, 0x976454abUL, 0x9522eaf2UL, 0x94e080c5UL,
+		0x9fbcc7f8UL, 0x9e7eadcfUL, 0x9c381396UL, 0x9dfa79a1UL,
+		0x98b56f24UL, 0x99770513UL, 0x9b31bb4aUL, 0x9af3d17dUL,
+		0x8d893530UL, 0x8c4b5f07UL, 0x8e0de15eUL, 0x8fcf8b69UL,
+		0x8a809decUL, 0x8b42f7dbUL, 0x89044982UL, 0x88c623b5UL,
+		0x839a6488UL, 0x82580ebfUL, 0x801eb0e6UL, 0x81dcdad1UL,
+		0x8493cc54UL, 0x8551a663UL, 0x8717183aUL, 0x86d5720dUL,
+		0xa9e2d0a0UL, 0xa820ba97UL, 0xaa6604ceUL, 0xaba46ef9UL,
+		0xaeeb787cUL, 0xaf29124bUL, 0xad6fac12UL, 0xacadc625UL,
+		0xa7f18118UL, 0xa633eb2fUL, 0xa4755576UL, 0xa5b73f41UL,
+		0xa0f829c4UL, 0xa13a43f3UL, 0xa37cfdaaUL, 0xa2be979dUL,
+		0xb5c473d0UL, 0xb40619e7UL, 0xb640a7beUL, 0xb782cd89UL,
+		0xb2cddb0cUL, 0xb30fb13bUL, 0xb1490f62UL, 0xb08b6555UL,
+		0xbbd72268UL, 0xba15485fUL, 0xb853f606UL, 0xb9919c31UL,
+		0xbcde8ab4UL, 0xbd1ce083UL, 0xbf5a5edaUL, 0xbe9834edUL
+	},
+	{
+		0x00000000UL, 0xb8bc6765UL, 0xaa09c88bUL, 0x12b5afeeUL,
+		0x8f629757UL, 0x37def032UL, 0x256b5fdcUL, 0x9dd738b9UL,
+		0xc5b428efUL, 0x7d084f8aUL, 0x6fbde064UL, 0xd7018701UL,
+		0x4ad6bfb8UL, 0xf26ad8ddUL, 0xe0df7733UL, 0x58631056UL,
+		0x5019579fUL, 0xe8a530faUL, 0xfa109f14UL, 0x42acf871UL,
+		0xdf7bc0c8UL, 0x67c7a7adUL, 0x75720843UL, 0xcdce6f26UL,
+		0x95ad7f70UL, 0x2d111815UL, 0x3fa4b7fbUL, 0x8718d09eUL,
+		0x1acfe827UL, 0xa2738f42UL, 0xb0c620acUL, 0x087a47c9UL,
+		0xa032af3eUL, 0x188ec85bUL, 0x0a3b67b5UL, 0xb28700d0UL,
+		0x2f503869UL, 0x97ec5f0cUL, 0x8559f0e2UL, 0x3de59787UL,
+		0x658687d1UL, 0xdd3ae0b4UL, 0xcf8f4f5aUL, 0x7733283fUL,
+		0xeae41086UL, 0x525877e3UL, 0x40edd80dUL, 0xf851bf68UL,
+		0xf02bf8a1UL, 0x48979fc4UL, 0x5a22302aUL, 0xe29e574fUL,
+		0x7f496ff6UL, 0xc7f50893UL, 0xd540a77dUL, 0x6dfcc018UL,
+		0x359fd04eUL, 0x8d23b72bUL, 0x9f9618c5UL, 0x272a7fa0UL,
+		0xbafd4719UL, 0x0241207cUL, 0x10f48f92UL, 0xa848e8f7UL,
+		0x9b14583dUL, 0x23a83f58UL, 0x311d90b6UL, 0x89a1f7d3UL,
+		0x1476cf6aUL, 0xaccaa80fUL, 0xbe7f07e1UL, 0x06c36084UL,
+		0x5ea070d2UL, 0xe61c17b7UL, 0xf4a9b859UL, 0x4c15df3cUL,
+		0xd1c2e785UL, 0x697e80e0UL, 0x7bcb2f0eUL, 0xc377486bUL,
+		0xcb0d0fa2UL, 0x73b168c7UL, 0x6104c729UL, 0xd9b8a04cUL,
+		0x446f98f5UL, 0xfcd3ff90UL, 0xee66507eUL, 0x56da371bUL,
+		0x0eb9274dUL, 0xb6054028UL, 0xa4b0efc6UL, 0x1c0c88a3UL,
+		0x81dbb01aUL, 0x3967d77fUL, 0x2bd27891UL, 0x936e1ff4UL,
+		0x3b26f703UL, 0x839a9066UL, 0x912f3f88UL, 0x299358edUL,
+		0xb4446054UL, 0x0cf80731UL, 0x1e4da8dfUL, 0xa6f1cfbaUL,
+		0xfe92dfecUL, 0x462eb889UL, 0x549b1767UL, 0xec277002UL,
+		0x71f048bbUL, 0xc94c2fdeUL, 0xdbf98030UL, 0x6345e755UL,
+		0x6b3fa09cUL, 0xd383c7f9UL, 0xc1366817UL, 0x798a0f72UL,
+		0xe45d37cbUL, 0x5ce150aeUL, 0x4e54ff40UL, 0xf6e89825UL,
+		0xae8b8873UL, 0x1637ef16UL, 0x048240f8UL, 0xbc3e279dUL,
+		0x21e91f24UL, 0x99557841UL, 0x8be0d7afUL, 0x335cb0caUL,
+		0xed59b63bUL, 0x55e5d15eUL, 0x47507eb0UL, 0xffec19d5UL,
+		0x623b216cUL, 0xda874609UL, 0xc832e9e7UL, 0x708e8e82UL,
+		0x28ed9ed4UL, 0x9051f9b1UL, 0x82e4565fUL, 0x3a58313aUL,
+		0xa78f0983UL, 0x1f336ee6UL, 0x0d86c108UL, 0xb53aa66dUL,
+		0xbd40e1a4UL, 0x05fc86c1UL, 0x1749292fUL, 0xaff54e4aUL,
+		0x322276f3UL, 0x8a9e1196UL, 0x982bbe78UL, 0x2097d91dUL,
+		0x78f4c94bUL, 0xc048ae2eUL, 0xd2fd01c0UL, 0x6a4166a5UL,
+		0xf7965e1cUL, 0x4f2a3979UL, 0x5d9f9697UL, 0xe523f1f2UL,
+		0x4d6b1905UL, 0xf5d77e60UL, 0xe762d18eUL, 0x5fdeb6ebUL,
+		0xc2098e52UL, 0x7ab5e937UL, 0x680046d9UL, 0xd0bc21bcUL,
+		0x88df31eaUL, 0x3063568fUL, 0x22d6f961UL, 0x9a6a9e04UL,
+		0x07bda6bdUL, 0xbf01c1d8UL, 0xadb46e36UL, 0x15080953UL,
+		0x1d724e9aUL, 0xa5ce29ffUL, 0xb77b8611UL, 0x0fc7e174UL,
+		0x9210d9cdUL, 0x2aacbea8UL, 0x38191146UL, 0x80a57623UL,
+		0xd8c66675UL, 0x607a0110UL, 0x72cfaefeUL, 0xca73c99bUL,
+		0x57a4f122UL, 0xef189647UL, 0xfdad39a9UL, 0x45115eccUL,
+		0x764dee06UL, 0xcef18963UL, 0xdc44268dUL, 0x64f841e8UL,
+		0xf92f7951UL, 0x41931e34UL, 0x5326b1daUL, 0xeb9ad6bfUL,
+		0xb3f9c6e9UL, 0x0b45a18cUL, 0x19f00e62UL, 0xa14c6907UL,
+		0x3c9b51beUL, 0x842736dbUL, 0x96929935UL, 0x2e2efe50UL,
+		0x2654b999UL, 0x9ee8defcUL, 0x8c5d7112UL, 0x34e11677UL,
+		0xa9362eceUL, 0x118a49abUL, 0x033fe645UL, 0xbb838120UL,
+		0xe3e09176UL, 0x5b5cf613UL, 0x49e959fdUL, 0xf1553e98UL,
+		0x6c820621UL, 0xd43e6144UL, 0xc68bceaaUL, 0x7e37a9cfUL,
+		0xd67f4138UL, 0x6ec3265dUL, 0x7c7689b3UL, 0xc4caeed6UL,
+		0x591dd66fUL, 0xe1a1b10aUL, 0xf3141ee4UL, 0x4ba87981UL,
+		0x13cb69d7UL, 0xab770eb2UL, 0xb9c2a15cUL, 0x017ec639UL,
+		0x9ca9fe80UL, 0x241599e5UL, 0x36a0360bUL, 0x8e1c516eUL,
+		0x866616a7UL, 0x3eda71c2UL, 0x2c6fde2cUL, 0x94d3b949UL,
+		0x090481f0UL, 0xb1b8e695UL, 0xa30d497bUL, 0x1bb12e1eUL,
+		0x43d23e48UL, 0xfb6e592dUL, 0xe9dbf6c3UL, 0x516791a6UL,
+		0xccb0a91fUL, 0x740cce7aUL, 0x66b96194UL, 0xde0506f1UL
+	},
+	{
+		0x00000000UL, 0x3d6029b0UL, 0x7ac05360UL, 0x47a07ad0UL,
+		0xf580a6c0UL, 0xc8e08f70UL, 0x8f40f5a0UL, 0xb220dc10UL,
+		0x30704bc1UL, 0x0d106271UL, 0x4ab018a1UL, 0x77d03111UL,
+		0xc5f0ed01UL, 0xf890c4b1UL, 0xbf30be61UL, 0x825097d1UL,
+		0x60e09782UL, 0x5d80be32UL, 0x1a20c4e2UL, 0x2740ed52UL,
+		0x95603142UL, 0xa80018f2UL, 0xefa06222UL, 0xd2c04b92UL,
+		0x5090dc43UL, 0x6df0f5f3UL, 0x2a508f23UL, 0x1730a693UL,
+		0xa5107a83UL, 0x98705333UL, 0xdfd029e3UL, 0xe2b00053UL,
+		0xc1c12f04UL, 0xfca106b4UL, 0xbb017c64UL, 0x866155d4UL,
+		0x344189c4UL, 0x0921a074UL, 0x4e81daa4UL, 0x73e1f314UL,
+		0xf1b164c5UL, 0xccd14d75UL, 0x8b7137a5UL, 0xb6111e15UL,
+		0x0431c205UL, 0x3951ebb5UL, 0x7ef19165UL, 0x4391b8d5UL,
+		0xa121b886UL, 0x9c419136UL, 0xdbe1ebe6UL, 0xe681c256UL,
+		0x54a11e46UL, 0x69c137f6UL, 0x2e614d26UL, 0x13016496UL,
+		0x9151f347UL, 0xac31daf7UL, 0xeb91a027UL, 0xd6f18997UL,
+		0x64d15587UL, 0x59b17c37UL, 0x1e1106e7UL, 0x23712f57UL,
+		0x58f35849UL, 0x659371f9UL, 0x22330b29UL, 0x1f532299UL,
+		0xad73fe89UL, 0x9013d739UL, 0xd7b3ade9UL, 0xead38459UL,
+		0x68831388UL, 0x55e33a38UL, 0x124340e8UL, 0x2f236958UL,
+		0x9d03b548UL, 0xa0639cf8UL, 0xe7c3e628UL, 0xdaa3cf98UL,
+		0x3813cfcbUL, 0x0573e67bUL, 0x42d39cabUL, 0x7fb3b51bUL,
+		0xcd93690bUL, 0xf0f340bbUL, 0xb7533a6bUL, 0x8a3313dbUL,
+		0x0863840aUL, 0x3503adbaUL, 0x72a3d76aUL, 0x4fc3fedaUL,
+		0xfde322caUL, 0xc0830b7aUL, 0x872371aaUL, 0xba43581aUL,
+		0x9932774dUL, 0xa4525efdUL, 0xe3f2242dUL, 0xde920d9dUL,
+		0x6cb2d18dUL, 0x51d2f83dUL, 0x167282edUL, 0x2b12ab5dUL,
+		0xa9423c8cUL, 0x9422153cUL, 0xd3826fecUL, 0xeee2465cUL,
+		0x5cc29a4cUL, 0x61a2b3fcUL, 0x2602c92cUL, 0x1b62e09cUL,
+		0xf9d2e0cfUL, 0xc4b2c97fUL, 0x8312b3afUL, 0xbe729a1fUL,
+		0x0c52460fUL, 0x31326fbfUL, 0x7692156fUL, 0x4bf23cdfUL,
+		0xc9a2ab0eUL, 0xf4c282beUL, 0xb362f86eUL, 0x8e02d1deUL,
+		0x3c220dceUL, 0x0142247eUL, 0x46e25eaeUL, 0x7b82771eUL,
+		0xb1e6b092UL, 0x8c869922UL, 0xcb26e3f2UL, 0xf646ca42UL,
+		0x44661652UL, 0x79063fe2UL, 0x3ea64532UL, 0x03c66c82UL,
+		0x8196fb53UL, 0xbcf6d2e3UL, 0xfb56a833UL, 0xc6368183UL,
+		0x74165d93UL, 0x49767423UL, 0x0ed60ef3UL, 0x33b62743UL,
+		0xd1062710UL, 0xec660ea0UL, 0xabc67470UL, 0x96a65dc0UL,
+		0x248681d0UL, 0x19e6a860UL, 0x5e46d2b0UL, 0x6326fb00UL,
+		0xe1766cd1UL, 0xdc164561UL, 0x9bb63fb1UL, 0xa6d61601UL,
+		0x14f6ca11UL, 0x2996e3a1UL, 0x6e369971UL, 0x5356b0c1UL,
+		0x70279f96UL, 0x4d47b626UL, 0x0ae7ccf6UL, 0x3787e546UL,
+		0x85a73956UL, 0xb8c710e6UL, 0xff676a36UL, 0xc2074386UL,
+		0x4057d457UL, 0x7d37fde7UL, 0x3a978737UL, 0x07f7ae87UL,
+		0xb5d77297UL, 0x88b75b27UL, 0xcf1721f7UL, 0xf2770847UL,
+		0x10c70814UL, 0x2da721a4UL, 0x6a075b74UL, 0x576772c4UL,
+		0xe547aed4UL, 0xd8278764UL, 0x9f87fdb4UL, 0xa2e7d404UL,
+		0x20b743d5UL, 0x1dd76a65UL, 0x5a7710b5UL, 0x67173905UL,
+		0xd537e515UL, 0xe857cca5UL, 0xaff7b675UL, 0x92979fc5UL,
+		0xe915e8dbUL, 0xd475c16bUL, 0x93d5bbbbUL, 0xaeb5920bUL,
+		0x1c954e1bUL, 0x21f567abUL, 0x66551d7bUL, 0x5b3534cbUL,
+		0xd965a31aUL, 0xe4058aaaUL, 0xa3a5f07aUL, 0x9ec5d9caUL,
+		0x2ce505daUL, 0x11852c6aUL, 0x562556baUL, 0x6b457f0aUL,
+		0x89f57f59UL, 0xb49556e9UL, 0xf3352c39UL, 0xce550589UL,
+		0x7c75d999UL, 0x4115f029UL, 0x06b58af9UL, 0x3bd5a349UL,
+		0xb9853498UL, 0x84e51d28UL, 0xc34567f8UL, 0xfe254e48UL,
+		0x4c059258UL, 0x7165bbe8UL, 0x36c5c138UL, 0x0ba5e888UL,
+		0x28d4c7dfUL, 0x15b4ee6fUL, 0x521494bfUL, 0x6f74bd0fUL,
+		0xdd54611fUL, 0xe03448afUL, 0xa794327fUL, 0x9af41bcfUL,
+		0x18a48c1eUL, 0x25c4a5aeUL, 0x6264df7eUL, 0x5f04f6ceUL,
+		0xed242adeUL, 0xd044036eUL, 0x97e479beUL, 0xaa84500eUL,
+		0x4834505dUL, 0x755479edUL, 0x32f4033dUL, 0x0f942a8dUL,
+		0xbdb4f69dUL, 0x80d4df2dUL, 0xc774a5fdUL, 0xfa148c4dUL,
+		0x78441b9cUL, 0x4524322cUL, 0x028448fcUL, 0x3fe4614cUL,
+		0x8dc4bd5cUL, 0xb0a494ecUL, 0xf704ee3cUL, 0xca64c78cUL
+	},
+	{
+		0x00000000UL, 0xcb5cd3a5UL, 0x4dc8a10bUL, 0x869472aeUL,
+		0x9b914216UL, 0x50cd91b3UL, 0xd659e31dUL, 0x1d0530b8UL,
+		0xec53826dUL, 0x270f51c8UL, 0xa19b2366UL, 0x6ac7f0c3UL,
+		0x77c2c07bUL, 0xbc9e13deUL, 0x3a0a6170UL, 0xf156b2d5UL,
+		0x03d6029bUL, 0xc88ad13eUL, 0x4e1ea390UL, 0x85427035UL,
+		0x9847408dUL, 0x531b9328UL, 0xd58fe186UL, 0x1ed33223UL,
+		0xef8580f6UL, 0x24d95353UL, 0xa24d21fdUL, 0x6911f258UL,
+		0x7414c2e0UL, 0xbf481145UL, 0x39dc63ebUL, 0xf280b04eUL,
+		0x07ac0536UL, 0xccf0d693UL, 0x4a64a43dUL, 0x81387798UL,
+		0x9c3d4720UL, 0x57619485UL, 0xd1f5e62bUL, 0x1aa9358eUL,
+		0xebff875bUL, 0x20a354feUL, 0xa6372650UL, 0x6d6bf5f5UL,
+		0x706ec54dUL, 0xbb3216e8UL, 0x3da66446UL, 0xf6fab7e3UL,
+		0x047a07adUL, 0xcf26d408UL, 0x49b2a6a6UL, 0x82ee7503UL,
+		0x9feb45bbUL, 0x54b7961eUL, 0xd223e4b0UL, 0x197f3715UL,
+		0xe82985c0UL, 0x23755665UL, 0xa5e124cbUL, 0x6ebdf76eUL,
+		0x73b8c7d6UL, 0xb8e41473UL, 0x3e7066ddUL, 0xf52cb578UL,
+		0x0f580a6cUL, 0xc404d9c9UL, 0x4290ab67UL, 0x89cc78c2UL,
+		0x94c9487aUL, 0x5f959bdfUL, 0xd901e971UL, 0x125d3ad4UL,
+		0xe30b8801UL, 0x28575ba4UL, 0xaec3290aUL, 0x659ffaafUL,
+		0x789aca17UL, 0xb3c619b2UL, 0x35526b1cUL, 0xfe0eb8b9UL,
+		0x0c8e08f7UL, 0xc7d2db52UL, 0x4146a9fcUL, 0x8a1a7a59UL,
+		0x971f4ae1UL, 0x5c439944UL, 0xdad7ebeaUL, 0x118b384fUL,
+		0xe0dd8a9aUL, 0x2b81593fUL, 0xad152b91UL, 0x6649f834UL,
+		0x7b4cc88cUL, 0xb0101b29UL, 0x36846987UL, 0xfdd8ba22UL,
+		0x08f40f5aUL, 0xc3a8dcffUL, 0x453cae51UL, 0x8e607df4UL,
+		0x93654d4cUL, 0x58399ee9UL, 0xdeadec47UL, 0x15f13fe2UL,
+		0xe4a78d37UL, 0x2ffb5e92UL, 0xa96f2c3cUL, 0x6233ff99UL,
+		0x7f36cf21UL, 0xb46a1c84UL, 0x32fe6e2aUL, 0xf9a2bd8fUL,
+		0x0b220dc1UL, 0xc07ede64UL, 0x46eaaccaUL, 0x8db67f6fUL,
+		0x90b34fd7UL, 0x5bef9c72UL, 0xdd7beedcUL, 0x16273d79UL,
+		0xe7718facUL, 0x2c2d5c09UL, 0xaab92ea7UL, 0x61e5fd02UL,
+		0x7ce0cdbaUL, 0xb7bc1e1fUL, 0x31286cb1UL, 0xfa74bf14UL,
+		0x1eb014d8UL, 0xd5ecc77dUL, 0x5378b5d3UL, 0x98246676UL,
+		0x852156ceUL, 0x4e7d856bUL, 0xc8e9f7c5UL, 0x03b52460UL,
+		0xf2e396b5UL, 0x39bf4510UL, 0xbf2b37beUL, 0x7477e41bUL,
+		0x6972d4a3UL, 0xa22e0706UL, 0x24ba75a8UL, 0xefe6a60dUL,
+		0x1d661643UL, 0xd63ac5e6UL, 0x50aeb748UL, 0x9bf264edUL,
+		0x86f75455UL, 0x4dab87f0UL, 0xcb3ff55eUL, 0x006326fbUL,
+		0xf135942eUL, 0x3a69478bUL, 0xbcfd3525UL, 0x77a1e680UL,
+		0x6aa4d638UL, 0xa1f8059dUL, 0x276c7733UL, 0xec30a496UL,
+		0x191c11eeUL, 0xd240c24bUL, 0x54d4b0e5UL, 0x9f886340UL,
+		0x828d53f8UL, 0x49d1805dUL, 0xcf45f2f3UL, 0x04192156UL,
+		0xf54f9383UL, 0x3e134026UL, 0xb8873288UL, 0x73dbe12dUL,
+		0x6eded195UL, 0xa5820230UL, 0x2316709eUL, 0xe84aa33bUL,
+		0x1aca1375UL, 0xd196c0d0UL, 0x5702b27eUL, 0x9c5e61dbUL,
+		0x815b5163UL, 0x4a0782c6UL, 0xcc93f068UL, 0x07cf23cdUL,
+		0xf6999118UL, 0x3dc542bdUL, 0xbb513013UL, 0x700de3b6UL,
+		0x6d08d30eUL, 0xa65400abUL, 0x20c07205UL, 0xeb9ca1a0UL,
+		0x11e81eb4UL, 0xdab4cd11UL, 0x5c20bfbfUL, 0x977c6c1aUL,
+		0x8a795ca2UL, 0x41258f07UL, 0xc7b1fda9UL, 0x0ced2e0cUL,
+		0xfdbb9cd9UL, 0x36e74f7cUL, 0xb0733dd2UL, 0x7b2fee77UL,
+		0x662adecfUL, 0xad760d6aUL, 0x2be27fc4UL, 0xe0beac61UL,
+		0x123e1c2fUL, 0xd962cf8aUL, 0x5ff6bd24UL, 0x94aa6e81UL,
+		0x89af5e39UL, 0x42f38d9cUL, 0xc467ff32UL, 0x0f3b2c97UL,
+		0xfe6d9e42UL, 0x35314de7UL, 0xb3a53f49UL, 0x78f9ececUL,
+		0x65fcdc54UL, 0xaea00ff1UL, 0x28347d5fUL, 0xe368aefaUL,
+		0x16441b82UL, 0xdd18c827UL, 0x5b8cba89UL, 0x90d0692cUL,
+		0x8dd55994UL, 0x46898a31UL, 0xc01df89fUL, 0x0b412b3aUL,
+		0xfa1799efUL, 0x314b4a4aUL, 0xb7df38e4UL, 0x7c83eb41UL,
+		0x6186dbf9UL, 0xaada085cUL, 0x2c4e7af2UL, 0xe712a957UL,
+		0x15921919UL, 0xdececabcUL, 0x585ab812UL, 0x93066bb7UL,
+		0x8e035b0fUL, 0x455f88aaUL, 0xc3cbfa04UL, 0x089729a1UL,
+		0xf9c19b74UL, 0x329d48d1UL, 0xb4093a7fUL, 0x7f55e9daUL,
+		0x6250d962UL, 0xa90c0ac7UL, 0x2f987869UL, 0xe4c4abccUL
+	},
+	{
+		0x00000000UL, 0xa6770bb4UL, 0x979f1129UL, 0x31e81a9dUL,
+		0xf44f2413UL, 0x52382fa7UL, 0x63d0353aUL, 0xc5a73e8eUL,
+		0x33ef4e67UL, 0x959845d3UL, 0xa4705f4eUL, 0x020754faUL,
+		0xc7a06a74UL, 0x61d761c0UL, 0x503f7b5dUL, 0xf64870e9UL,
+		0x67de9cceUL, 0xc1a9977aUL, 0xf0418de7UL, 0x56368653UL,
+		0x9391b8ddUL, 0x35e6b369UL, 0x040ea9f4UL, 0xa279a240UL,
+		0x5431d2a9UL, 0xf246d91dUL, 0xc3aec380UL, 0x65d9c834UL,
+		0xa07ef6baUL, 0x0609fd0eUL, 0x37e1e793UL, 0x9196ec27UL,
+		0xcfbd399cUL, 0x69ca3228UL, 0x582228b5UL, 0xfe552301UL,
+		0x3bf21d8fUL, 0x9d85163bUL, 0xac6d0ca6UL, 0x0a1a0712UL,
+		0xfc5277fbUL, 0x5a257c4fUL, 0x6bcd66d2UL, 0xcdba6d66UL,
+		0x081d53e8UL, 0xae6a585cUL, 0x9f8242c1UL, 0x39f54975UL,
+		0xa863a552UL, 0x0e14aee6UL, 0x3ffcb47bUL, 0x998bbfcfUL,
+		0x5c2c8141UL, 0xfa5b8af5UL, 0xcbb39068UL, 0x6dc49bdcUL,
+		0x9b8ceb35UL, 0x3dfbe081UL, 0x0c13fa1cUL, 0xaa64f1a8UL,
+		0x6fc3cf26UL, 0xc9b4c492UL, 0xf85cde0fUL, 0x5e2bd5bbUL,
+		0x440b7579UL, 0xe27c7ecdUL, 0xd3946450UL, 0x75e36fe4UL,
+		0xb044516aUL, 0x16335adeUL, 0x27db4043UL, 0x81ac4bf7UL,
+		0x77e43b1eUL, 0xd19330aaUL, 0xe07b2a37UL, 0x460c2183UL,
+		0x83ab1f0dUL, 0x25dc14b9UL, 0x14340e24UL, 0xb2430590UL,
+		0x23d5e9b7UL, 0x85a2e203UL, 0xb44af89eUL, 0x123df32aUL,
+		0xd79acda4UL, 0x71edc610UL, 0x4005dc8dUL, 0xe672d739UL,
+		0x103aa7d0UL, 0xb64dac64UL, 0x87a5b6f9UL, 0x21d2bd4dUL,
+		0xe47583c3UL, 0x42028877UL, 0x73ea92eaUL, 0xd59d995eUL,
+		0x8bb64ce5UL, 0x2dc14751UL, 0x1c295dccUL, 0xba5e5678UL,
+		0x7ff968f6UL, 0xd98e6342UL, 0xe86679dfUL, 0x4e11726bUL,
+		0xb8590282UL, 0x1e2e0936UL, 0x2fc613abUL, 0x89b1181fUL,
+		0x4c162691UL, 0xea612d25UL, 0xdb8937b8UL, 0x7dfe3c0cUL,
+		0xec68d02bUL, 0x4a1fdb9fUL, 0x7bf7c102UL, 0xdd80cab6UL,
+		0x1827f438UL, 0xbe50ff8cUL, 0x8fb8e511UL, 0x29cfeea5UL,
+		0xdf879e4cUL, 0x79f095f8UL, 0x48188f65UL, 0xee6f84d1UL,
+		0x2bc8ba5fUL, 0x8dbfb1ebUL, 0xbc57ab76UL, 0x1a20a0c2UL,
+		0x8816eaf2UL, 0x2e61e146UL, 0x1f89fbdbUL, 0xb9fef06fUL,
+		0x7c59cee1UL, 0xda2ec555UL, 0xebc6dfc8UL, 0x4db1d47cUL,
+		0xbbf9a495UL, 0x1d8eaf21UL, 0x2c66b5bcUL, 0x8a11be08UL,
+		0x4fb68086UL, 0xe9c18b32UL, 0xd82991afUL, 0x7e5e9a1bUL,
+		0xefc8763cUL, 0x49bf7d88UL, 0x78576715UL, 0xde206ca1UL,
+		0x1b87522fUL, 0xbdf0599bUL, 0x8c184306UL, 0x2a6f48b2UL,
+		0xdc27385bUL, 0x7a5033efUL, 0x4bb82972UL, 0xedcf22c6UL,
+		0x28681c48UL, 0x8e1f17fcUL, 0xbff70d61UL, 0x198006d5UL,
+		0x47abd36eUL, 0xe1dcd8daUL, 0xd034c247UL, 0x7643c9f3UL,
+		0xb3e4f77dUL, 0x1593fcc9UL, 0x247be654UL, 0x820cede0UL,
+		0x74449d09UL, 0xd23396bdUL, 0xe3db8c20UL, 0x45ac8794UL,
+		0x800bb91aUL, 0x267cb2aeUL, 0x1794a833UL, 0xb1e3a387UL,
+		0x20754fa0UL, 0x86024414UL, 0xb7ea5e89UL, 0x119d553dUL,
+		0xd43a6bb3UL, 0x724d6007UL, 0x43a57a9aUL, 0xe5d2712eUL,
+		0x139a01c7UL, 0xb5ed0a73UL, 0x840510eeUL, 0x22721b5aUL,
+		0xe7d525d4UL, 0x41a22e60UL, 0x704a34fdUL, 0xd63d3f49UL,
+		0xcc1d9f8bUL, 0x6a6a943fUL, 0x5b828ea2UL, 0xfdf58516UL,
+		0x3852bb98UL, 0x9e25b02cUL, 0xafcdaab1UL, 0x09baa105UL,
+		0xfff2d1ecUL, 0x5985da58UL, 0x686dc0c5UL, 0xce1acb71UL,
+		0x0bbdf5ffUL, 0xadcafe4bUL, 0x9c22e4d6UL, 0x3a55ef62UL,
+		0xabc30345UL, 0x0db408f1UL, 0x3c5c126cUL, 0x9a2b19d8UL,
+		0x5f8c2756UL, 0xf9fb2ce2UL, 0xc813367fUL, 0x6e643dcbUL,
+		0x982c4d22UL, 0x3e5b4696UL, 0x0fb35c0bUL, 0xa9c457bfUL,
+		0x6c636931UL, 0xca146285UL, 0xfbfc7818UL, 0x5d8b73acUL,
+		0x03a0a617UL, 0xa5d7ada3UL, 0x943fb73eUL, 0x3248bc8aUL,
+		0xf7ef8204UL, 0x519889b0UL, 0x6070932dUL, 0xc6079899UL,
+		0x304fe870UL, 0x9638e3c4UL, 0xa7d0f959UL, 0x01a7f2edUL,
+		0xc400cc63UL, 0x6277c7d7UL, 0x539fdd4aUL, 0xf5e8d6feUL,
+		0x647e3ad9UL, 0xc209316dUL, 0xf3e12bf0UL, 0x55962044UL,
+		0x90311ecaUL, 0x3646157eUL, 0x07ae0fe3UL, 0xa1d90457UL,
+		0x579174beUL, 0xf1e67f0aUL, 0xc00e6597UL, 0x66796e23UL,
+		0xa3de50adUL, 0x05a95b19UL, 0x34414184UL, 0x92364a30UL
+	},
+	{
+		0x00000000UL, 0xccaa009eUL, 0x4225077dUL, 0x8e8f07e3UL,
+		0x844a0efaUL, 0x48e00e64UL, 0xc66f0987UL, 0x0ac50919UL,
+		0xd3e51bb5UL, 0x1f4f1b2bUL, 0x91c01cc8UL, 0x5d6a1c56UL,
+		0x57af154fUL, 0x9b0515d1UL, 0x158a1232UL, 0xd92012acUL,
+		0x7cbb312bUL, 0xb01131b5UL, 0x3e9e3656UL, 0xf23436c8UL,
+		0xf8f13fd1UL, 0x345b3f4fUL, 0xbad438acUL, 0x767e3832UL,
+		0xaf5e2a9eUL, 0x63f42a00UL, 0xed7b2de3UL, 0x21d12d7dUL,
+		0x2b142464UL, 0xe7be24faUL, 0x69312319UL, 0xa59b2387UL,
+		0xf9766256UL, 0x35dc62c8UL, 0xbb53652bUL, 0x77f965b5UL,
+		0x7d3c6cacUL, 0xb1966c32UL, 0x3f196bd1UL, 0xf3b36b4fUL,
+		0x2a9379e3UL, 0xe639797dUL, 0x68b67e9eUL, 0xa41c7e00UL,
+		0xaed97719UL, 0x62737787UL, 0xecfc7064UL, 0x205670faUL,
+		0x85cd537dUL, 0x496753e3UL, 0xc7e85400UL, 0x0b42549eUL,
+		0x01875d87UL, 0xcd2d5d19UL, 0x43a25afaUL, 0x8f085a64UL,
+		0x562848c8UL, 0x9a824856UL, 0x140d4fb5UL, 0xd8a74f2bUL,
+		0xd2624632UL, 0x1ec846acUL, 0x9047414fUL, 0x5ced41d1UL,
+		0x299dc2edUL, 0xe537c273UL, 0x6bb8c590UL, 0xa712c50eUL,
+		0xadd7cc17UL, 0x617dcc89UL, 0xeff2cb6aUL, 0x2358cbf4UL,
+		0xfa78d958UL, 0x36d2d9c6UL, 0xb85dde25UL, 0x74f7debbUL,
+		0x7e32d7a2UL, 0xb298d73cUL, 0x3c17d0dfUL, 0xf0bdd041UL,
+		0x5526f3c6UL, 0x998cf358UL, 0x1703f4bbUL, 0xdba9f425UL,
+		0xd16cfd3cUL, 0x1dc6fda2UL, 0x9349fa41UL, 0x5fe3fadfUL,
+		0x86c3e873UL, 0x4a69e8edUL, 0xc4e6ef0eUL, 0x084cef90UL,
+		0x0289e689UL, 0xce23e617UL, 0x40ace1f4UL, 0x8c06e16aUL,
+		0xd0eba0bbUL, 0x1c41a025UL, 0x92cea7c6UL, 0x5e64a758UL,
+		0x54a1ae41UL, 0x980baedfUL, 0x1684a93cUL, 0xda2ea9a2UL,
+		0x030ebb0eUL, 0xcfa4bb90UL, 0x412bbc73UL, 0x8d81bcedUL,
+		0x8744b5f4UL, 0x4beeb56aUL, 0xc561b289UL, 0x09cbb217UL,
+		0xac509190UL, 0x60fa910eUL, 0xee7596edUL, 0x22df9673UL,
+		0x281a9f6aUL, 0xe4b09ff4UL, 0x6a3f9817UL, 0xa6959889UL,
+		0x7fb58a25UL, 0xb31f8abbUL, 0x3d908d58UL, 0xf13a8dc6UL,
+		0xfbff84dfUL, 0x37558441UL, 0xb9da83a2UL, 0x7570833cUL,
+		0x533b85daUL, 0x9f918544UL, 0x111e82a7UL, 0xddb48239UL,
+		0xd7718b20UL, 0x1bdb8bbeUL, 0x95548c5dUL, 0x59fe8cc3UL,
+		0x80de9e6fUL, 0x4c749ef1UL, 0xc2fb9912UL, 0x0e51998cUL,
+		0x04949095UL, 0xc83e900bUL, 0x46b197e8UL, 0x8a1b9776UL,
+		0x2f80b4f1UL, 0xe32ab46fUL, 0x6da5b38cUL, 0xa10fb312UL,
+		0xabcaba0bUL, 0x6760ba95UL, 0xe9efbd76UL, 0x2545bde8UL,
+		0xfc65af44UL, 0x30cfafdaUL, 0xbe40a839UL, 0x72eaa8a7UL,
+		0x782fa1beUL, 0xb485a120UL, 0x3a0aa6c3UL, 0xf6a0a65dUL,
+		0xaa4de78cUL, 0x66e7e712UL, 0xe868e0f1UL, 0x24c2e06fUL,
+		0x2e07e976UL, 0xe2ade9e8UL, 0x6c22ee0bUL, 0xa088ee95UL,
+		0x79a8fc39UL, 0xb502fca7UL, 0x3b8dfb44UL, 0xf727fbdaUL,
+		0xfde2f2c3UL, 0x3148f25dUL, 0xbfc7f5beUL, 0x736df520UL,
+		0xd6f6d6a7UL, 0x1a5cd639UL, 0x94d3d1daUL, 0x5879d144UL,
+		0x52bcd85dUL, 0x9e16d8c3UL, 0x1099df20UL, 0xdc33dfbeUL,
+		0x0513cd12UL, 0xc9b9cd8cUL, 0x4736ca6fUL, 0x8b9ccaf1UL,
+		0x8159c3e8UL, 0x4df3c376UL, 0xc37cc495UL, 0x0fd6c40bUL,
+		0x7aa64737UL, 0xb60c47a9UL, 0x3883404aUL, 0xf42940d4UL,
+		0xfeec49cdUL, 0x32464953UL, 0xbcc94eb0UL, 0x70634e2eUL,
+		0xa9435c82UL, 0x65e95c1cUL, 0xeb665bffUL, 0x27cc5b61UL,
+		0x2d095278UL, 0xe1a352e6UL, 0x6f2c5505UL, 0xa386559bUL,
+		0x061d761cUL, 0xcab77682UL, 0x44387161UL, 0x889271ffUL,
+		0x825778e6UL, 0x4efd7878UL, 0xc0727f9bUL, 0x0cd87f05UL,
+		0xd5f86da9UL, 0x19526d37UL, 0x97dd6ad4UL, 0x5b776a4aUL,
+		0x51b26353UL, 0x9d1863cdUL, 0x1397642eUL, 0xdf3d64b0UL,
+		0x83d02561UL, 0x4f7a25ffUL, 0xc1f5221cUL, 0x0d5f2282UL,
+		0x079a2b9bUL, 0xcb302b05UL, 0x45bf2ce6UL, 0x89152c78UL,
+		0x50353ed4UL, 0x9c9f3e4aUL, 0x121039a9UL, 0xdeba3937UL,
+		0xd47f302eUL, 0x18d530b0UL, 0x965a3753UL, 0x5af037cdUL,
+		0xff6b144aUL, 0x33c114d4UL, 0xbd4e1337UL, 0x71e413a9UL,
+		0x7b211ab0UL, 0xb78b1a2eUL, 0x39041dcdUL, 0xf5ae1d53UL,
+		0x2c8e0fffUL, 0xe0240f61UL, 0x6eab0882UL, 0xa201081cUL,
+		0xa8c40105UL, 0x646e019bUL, 0xeae10678UL, 0x264b06e6UL
+	},
+	{
+		0x00000000UL, 0x177b1443UL, 0x2ef62886UL, 0x398d3cc5UL,
+		0x5dec510cUL, 0x4a97454fUL, 0x731a798aUL, 0x64616dc9UL,
+		0xbbd8a218UL, 0xaca3b65bUL, 0x952e8a9eUL, 0x82559eddUL,
+		0xe634f314UL, 0xf14fe757UL, 0xc8c2db92UL, 0xdfb9cfd1UL,
+		0xacc04271UL, 0xbbbb5632UL, 0x82366af7UL, 0x954d7eb4UL,
+		0xf12c137dUL, 0xe657073eUL, 0xdfda3bfbUL, 0xc8a12fb8UL,
+		0x1718e069UL, 0x0063f42aUL, 0x39eec8efUL, 0x2e95dcacUL,
+		0x4af4b165UL, 0x5d8fa526UL, 0x640299e3UL, 0x73798da0UL,
+		0x82f182a3UL, 0x958a96e0UL, 0xac07aa25UL, 0xbb7cbe66UL,
+		0xdf1dd3afUL, 0xc866c7ecUL, 0xf1ebfb29UL, 0xe690ef6aUL,
+		0x392920bbUL, 0x2e5234f8UL, 0x17df083dUL, 0x00a41c7eUL,
+		0x64c571b7UL, 0x73be65f4UL, 0x4a335931UL, 0x5d484d72UL,
+		0x2e31c0d2UL, 0x394ad491UL, 0x00c7e854UL, 0x17bcfc17UL,
+		0x73dd91deUL, 0x64a6859dUL, 0x5d2bb958UL, 0x4a50ad1bUL,
+		0x95e962caUL, 0x82927689UL, 0xbb1f4a4cUL, 0xac645e0fUL,
+		0xc80533c6UL, 0xdf7e2785UL, 0xe6f31b40UL, 0xf1880f03UL,
+		0xde920307UL, 0xc9e91744UL, 0xf0642b81UL, 0xe71f3fc2UL,
+		0x837e520bUL, 0x94054648UL, 0xad887a8dUL, 0xbaf36eceUL,
+		0x654aa11fUL, 0x7231b55cUL, 0x4bbc8999UL, 0x5cc79ddaUL,
+		0x38a6f013UL, 0x2fdde450UL, 0x1650d895UL, 0x012bccd6UL,
+		0x72524176UL, 0x65295535UL, 0x5ca469f0UL, 0x4bdf7db3UL,
+		0x2fbe107aUL, 0x38c50439UL, 0x014838fcUL, 0x16332cbfUL,
+		0xc98ae36eUL, 0xdef1f72dUL, 0xe77ccbe8UL, 0xf007dfabUL,
+		0x9466b262UL, 0x831da621UL, 0xba909ae4UL, 0xadeb8ea7UL,
+		0x5c6381a4UL, 0x4b1895e7UL, 0x7295a922UL, 0x65eebd61UL,
+		0x018fd0a8UL, 0x16f4c4ebUL, 0x2f79f82eUL, 0x3802ec6dUL,
+		0xe7bb23bcUL, 0xf0c037ffUL, 0xc94d0b3aUL, 0xde361f79UL,
+		0xba5772b0UL, 0xad2c66f3UL, 0x94a15a36UL, 0x83da4e75UL,
+		0xf0a3c3d5UL, 0xe7d8d796UL, 0xde55eb53UL, 0xc92eff10UL,
+		0xad4f92d9UL, 0xba34869aUL, 0x83b9ba5fUL, 0x94c2ae1cUL,
+		0x4b7b61cdUL, 0x5c00758eUL, 0x658d494bUL, 0x72f65d08UL,
+		0x169730c1UL, 0x01ec2482UL, 0x38611847UL, 0x2f1a0c04UL,
+		0x6655004fUL, 0x712e140cUL, 0x48a328c9UL, 0x5fd83c8aUL,
+		0x3bb95143UL, 0x2cc24500UL, 0x154f79c5UL, 0x02346d86UL,
+		0xdd8da257UL, 0xcaf6b614UL, 0xf37b8ad1UL, 0xe4009e92UL,
+		0x8061f35bUL, 0x971ae718UL, 0xae97dbddUL, 0xb9eccf9eUL,
+		0xca95423eUL, 0xddee567dUL, 0xe4636ab8UL, 0xf3187efbUL,
+		0x97791332UL, 0x80020771UL, 0xb98f3bb4UL, 0xaef42ff7UL,
+		0x714de026UL, 0x6636f465UL, 0x5fbbc8a0UL, 0x48c0dce3UL,
+		0x2ca1b12aUL, 0x3bdaa569UL, 0x025799acUL, 0x152c8defUL,
+		0xe4a482ecUL, 0xf3df96afUL, 0xca52aa6aUL, 0xdd29be29UL,
+		0xb948d3e0UL, 0xae33c7a3UL, 0x97befb66UL, 0x80c5ef25UL,
+		0x5f7c20f4UL, 0x480734b7UL, 0x718a0872UL, 0x66f11c31UL,
+		0x029071f8UL, 0x15eb65bbUL, 0x2c66597eUL, 0x3b1d4d3dUL,
+		0x4864c09dUL, 0x5f1fd4deUL, 0x6692e81bUL, 0x71e9fc58UL,
+		0x15889191UL, 0x02f385d2UL, 0x3b7eb917UL, 0x2c05ad54UL,
+		0xf3bc6285UL, 0xe4c776c6UL, 0xdd4a4a03UL, 0xca315e40UL,
+		0xae503389UL, 0xb92b27caUL, 0x80a61b0fUL, 0x97dd0f4cUL,
+		0xb8c70348UL, 0xafbc170bUL, 0x96312bceUL, 0x814a3f8dUL,
+		0xe52b5244UL, 0xf2504607UL, 0xcbdd7ac2UL, 0xdca66e81UL,
+		0x031fa150UL, 0x1464b513UL, 0x2de989d6UL, 0x3a929d95UL,
+		0x5ef3f05cUL, 0x4988e41fUL, 0x7005d8daUL, 0x677ecc99UL,
+		0x14074139UL, 0x037c557aUL, 0x3af169bfUL, 0x2d8a7dfcUL,
+		0x49eb1035UL, 0x5e900476UL, 0x671d38b3UL, 0x70662cf0UL,
+		0xafdfe321UL, 0xb8a4f762UL, 0x8129cba7UL, 0x9652dfe4UL,
+		0xf233b22dUL, 0xe548a66eUL, 0xdcc59aabUL, 0xcbbe8ee8UL,
+		0x3a3681ebUL, 0x2d4d95a8UL, 0x14c0a96dUL, 0x03bbbd2eUL,
+		0x67dad0e7UL, 0x70a1c4a4UL, 0x492cf861UL, 0x5e57ec22UL,
+		0x81ee23f3UL, 0x969537b0UL, 0xaf180b75UL, 0xb8631f36UL,
+		0xdc0272ffUL, 0xcb7966bcUL, 0xf2f45a79UL, 0xe58f4e3aUL,
+		0x96f6c39aUL, 0x818dd7d9UL, 0xb800eb1cUL, 0xaf7bff5fUL,
+		0xcb1a9296UL, 0xdc6186d5UL, 0xe5ecba10UL, 0xf297ae53UL,
+		0x2d2e6182UL, 0x3a5575c1UL, 0x03d84904UL, 0x14a35d47UL,
+		0x70c2308eUL, 0x67b924cdUL, 0x5e341808UL, 0x494f0c4bUL
+	},
+	{
+		0x00000000UL, 0xefc26b3eUL, 0x04f5d03dUL, 0xeb37bb03UL,
+		0x09eba07aUL, 0xe629cb44UL, 0x0d1e7047UL, 0xe2dc1b79UL,
+		0x13d740f4UL, 0xfc152bcaUL, 0x172290c9UL, 0xf8e0fbf7UL,
+		0x1a3ce08eUL, 0xf5fe8bb0UL, 0x1ec930b3UL, 0xf10b5b8dUL,
+		0x27ae81e8UL, 0xc86cead6UL, 0x235b51d5UL, 0xcc993aebUL,
+		0x2e452192UL, 0xc1874aacUL, 0x2ab0f1afUL, 0xc5729a91UL,
+		0x3479c11cUL, 0xdbbbaa22UL, 0x308c1121UL, 0xdf4e7a1fUL,
+		0x3d926166UL, 0xd2500a58UL, 0x3967b15bUL, 0xd6a5da65UL,
+		0x4f5d03d0UL, 0xa09f68eeUL, 0x4ba8d3edUL, 0xa46ab8d3UL,
+		0x46b6a3aaUL, 0xa974c894UL, 0x42437397UL, 0xad8118a9UL,
+		0x5c8a4324UL, 0xb348281aUL, 0x587f9319UL, 0xb7bdf827UL,
+		0x5561e35eUL, 0xbaa38860UL, 0x51943363UL, 0xbe56585dUL,
+		0x68f38238UL, 0x8731e906UL, 0x6c065205UL, 0x83c4393bUL,
+		0x61182242UL, 0x8eda497cUL, 0x65edf27fUL, 0x8a2f9941UL,
+		0x7b24c2ccUL, 0x94e6a9f2UL, 0x7fd112f1UL, 0x901379cfUL,
+		0x72cf62b6UL, 0x9d0d0988UL, 0x763ab28bUL, 0x99f8d9b5UL,
+		0x9eba07a0UL, 0x71786c9eUL, 0x9a4fd79dUL, 0x758dbca3UL,
+		0x9751a7daUL, 0x7893cce4UL, 0x93a477e7UL, 0x7c661cd9UL,
+		0x8d6d4754UL, 0x62af2c6aUL, 0x89989769UL, 0x665afc57UL,
+		0x8486e72eUL, 0x6b448c10UL, 0x80733713UL, 0x6fb15c2dUL,
+		0xb9148648UL, 0x56d6ed76UL, 0xbde15675UL, 0x52233d4bUL,
+		0xb0ff2632UL, 0x5f3d4d0cUL, 0xb40af60fUL, 0x5bc89d31UL,
+		0xaac3c6bcUL, 0x4501ad82UL, 0xae361681UL, 0x41f47dbfUL,
+		0xa32866c6UL, 0x4cea0df8UL, 0xa7ddb6fbUL, 0x481fddc5UL,
+		0xd1e70470UL, 0x3e256f4eUL, 0xd512d44dUL, 0x3ad0bf73UL,
+		0xd80ca40aUL, 0x37cecf34UL, 0xdcf97437UL, 0x333b1f09UL,
+		0xc2304484UL, 0x2df22fbaUL, 0xc6c594b9UL, 0x2907ff87UL,
+		0xcbdbe4feUL, 0x24198fc0UL, 0xcf2e34c3UL, 0x20ec5ffdUL,
+		0xf6498598UL, 0x198beea6UL, 0xf2bc55a5UL, 0x1d7e3e9bUL,
+		0xffa225e2UL, 0x10604edcUL, 0xfb57f5dfUL, 0x14959ee1UL,
+		0xe59ec56cUL, 0x0a5cae52UL, 0xe16b1551UL, 0x0ea97e6fUL,
+		0xec756516UL, 0x03b70e28UL, 0xe880b52bUL, 0x0742de15UL,
+		0xe6050901UL, 0x09c7623fUL, 0xe2f0d93cUL, 0x0d32b202UL,
+		0xefeea97bUL, 0x002cc245UL, 0xeb1b7946UL, 0x04d91278UL,
+		0xf5d249f5UL, 0x1a1022cbUL, 0xf12799c8UL, 0x1ee5f2f6UL,
+		0xfc39e98fUL, 0x13fb82b1UL, 0xf8cc39b2UL, 0x170e528cUL,
+		0xc1ab88e9UL, 0x2e69e3d7UL, 0xc55e58d4UL, 0x2a9c33eaUL,
+		0xc8402893UL, 0x278243adUL, 0xccb5f8aeUL, 0x23779390UL,
+		0xd27cc81dUL, 0x3dbea323UL, 0xd6891820UL, 0x394b731eUL,
+		0xdb976867UL, 0x34550359UL, 0xdf62b85aUL, 0x30a0d364UL,
+		0xa9580ad1UL, 0x469a61efUL, 0xadaddaecUL, 0x426fb1d2UL,
+		0xa0b3aaabUL, 0x4f71c195UL, 0xa4467a96UL, 0x4b8411a8UL,
+		0xba8f4a25UL, 0x554d211bUL, 0xbe7a9a18UL, 0x51b8f126UL,
+		0xb364ea5fUL, 0x5ca68161UL, 0xb7913a62UL, 0x5853515cUL,
+		0x8ef68b39UL, 0x6134e007UL, 0x8a035b04UL, 0x65c1303aUL,
+		0x871d2b43UL, 0x68df407dUL, 0x83e8fb7eUL, 0x6c2a9040UL,
+		0x9d21cbcdUL, 0x72e3a0f3UL, 0x99d41bf0UL, 0x761670ceUL,
+		0x94ca6bb7UL, 0x7b080089UL, 0x903fbb8aUL, 0x7ffdd0b4UL,
+		0x78bf0ea1UL, 0x977d659fUL, 0x7c4ade9cUL, 0x9388b5a2UL,
+		0x7154aedbUL, 0x9e96c5e5UL, 0x75a17ee6UL, 0x9a6315d8UL,
+		0x6b684e55UL, 0x84aa256bUL, 0x6f9d9e68UL, 0x805ff556UL,
+		0x6283ee2fUL, 0x8d418511UL, 0x66763e12UL, 0x89b4552cUL,
+		0x5f118f49UL, 0xb0d3e477UL, 0x5be45f74UL, 0xb426344aUL,
+		0x56fa2f33UL, 0xb938440dUL, 0x520fff0eUL, 0xbdcd9430UL,
+		0x4cc6cfbdUL, 0xa304a483UL, 0x48331f80UL, 0xa7f174beUL,
+		0x452d6fc7UL, 0xaaef04f9UL, 0x41d8bffaUL, 0xae1ad4c4UL,
+		0x37e20d71UL, 0xd820664fUL, 0x3317dd4cUL, 0xdcd5b672UL,
+		0x3e09ad0bUL, 0xd1cbc635UL, 0x3afc7d36UL, 0xd53e1608UL,
+		0x24354d85UL, 0xcbf726bbUL, 0x20c09db8UL, 0xcf02f686UL,
+		0x2ddeedffUL, 0xc21c86c1UL, 0x292b3dc2UL, 0xc6e956fcUL,
+		0x104c8c99UL, 0xff8ee7a7UL, 0x14b95ca4UL, 0xfb7b379aUL,
+		0x19a72ce3UL, 0xf66547ddUL, 0x1d52fcdeUL, 0xf29097e0UL,
+		0x039bcc6dUL, 0xec59a753UL, 0x076e1c50UL, 0xe8ac776eUL,
+		0x0a706c17UL, 0xe5b20729UL, 0x0e85bc2aUL, 0xe147d714UL
+	},
+	{
+		0x00000000UL, 0xc18edfc0UL, 0x586cb9c1UL, 0x99e26601UL,
+		0xb0d97382UL, 0x7157ac42UL, 0xe8b5ca43UL, 0x293b1583UL,
+		0xbac3e145UL, 0x7b4d3e85UL, 0xe2af5884UL, 0x23218744UL,
+		0x0a1a92c7UL, 0xcb944d07UL, 0x52762b06UL, 0x93f8f4c6UL,
+		0xaef6c4cbUL, 0x6f781b0bUL, 0xf69a7d0aUL, 0x3714a2caUL,
+		0x1e2fb749UL, 0xdfa16889UL, 0x46430e88UL, 0x87cdd148UL,
+		0x1435258eUL, 0xd5bbfa4eUL, 0x4c599c4fUL, 0x8dd7438fUL,
+		0xa4ec560cUL, 0x656289ccUL, 0xfc80efcdUL, 0x3d0e300dUL,
+		0x869c8fd7UL, 0x47125017UL, 0xdef03616UL, 0x1f7ee9d6UL,
+		0x3645fc55UL, 0xf7cb2395UL, 0x6e294594UL, 0xafa79a54UL,
+		0x3c5f6e92UL, 0xfdd1b152UL, 0x6433d753UL, 0xa5bd0893UL,
+		0x8c861d10UL, 0x4d08c2d0UL, 0xd4eaa4d1UL, 0x15647b11UL,
+		0x286a4b1cUL, 0xe9e494dcUL, 0x7006f2ddUL, 0xb1882d1dUL,
+		0x98b3389eUL, 0x593de75eUL, 0xc0df815fUL, 0x01515e9fUL,
+		0x92a9aa59UL, 0x53277599UL, 0xcac51398UL, 0x0b4bcc58UL,
+		0x2270d9dbUL, 0xe3fe061bUL, 0x7a1c601aUL, 0xbb92bfdaUL,
+		0xd64819efUL, 0x17c6c62fUL, 0x8e24a02eUL, 0x4faa7feeUL,
+		0x66916a6dUL, 0xa71fb5adUL, 0x3efdd3acUL, 0xff730c6cUL,
+		0x6c8bf8aaUL, 0xad05276aUL, 0x34e7416bUL, 0xf5699eabUL,
+		0xdc528b28UL, 0x1ddc54e8UL, 0x843e32e9UL, 0x45b0ed29UL,
+		0x78bedd24UL, 0xb93002e4UL, 0x20d264e5UL, 0xe15cbb25UL,
+		0xc867aea6UL, 0x09e97166UL, 0x900b1767UL, 0x5185c8a7UL,
+		0xc27d3c61UL, 0x03f3e3a1UL, 0x9a1185a0UL, 0x5b9f5a60UL,
+		0x72a44fe3UL, 0xb32a9023UL, 0x2ac8f622UL, 0xeb4629e2UL,
+		0x50d49638UL, 0x915a49f8UL, 0x08b82ff9UL, 0xc936f039UL,
+		0xe00de5baUL, 0x21833a7aUL, 0xb8615c7bUL, 0x79ef83bbUL,
+		0xea17777dUL, 0x2b99a8bdUL, 0xb27bcebcUL, 0x73f5117cUL,
+		0x5ace04ffUL, 0x9b40db3fUL, 0x02a2bd3eUL, 0xc32c62feUL,
+		0xfe2252f3UL, 0x3fac8d33UL, 0xa64eeb32UL, 0x67c034f2UL,
+		0x4efb2171UL, 0x8f75feb1UL, 0x169798b0UL, 0xd7194770UL,
+		0x44e1b3b6UL, 0x856f6c76UL, 0x1c8d0a77UL, 0xdd03d5b7UL,
+		0xf438c034UL, 0x35b61ff4UL, 0xac5479f5UL, 0x6ddaa635UL,
+		0x77e1359fUL, 0xb66fea5fUL, 0x2f8d8c5eUL, 0xee03539eUL,
+		0xc738461dUL, 0x06b699ddUL, 0x9f54ffdcUL, 0x5eda201cUL,
+		0xcd22d4daUL, 0x0cac0b1aUL, 0x954e6d1bUL, 0x54c0b2dbUL,
+		0x7dfba758UL, 0xbc757898UL, 0x25971e99UL, 0xe419c159UL,
+		0xd917f154UL, 0x18992e94UL, 0x817b4895UL, 0x40f59755UL,
+		0x69ce82d6UL, 0xa8405d16UL, 0x31a23b17UL, 0xf02ce4d7UL,
+		0x63d41011UL, 0xa25acfd1UL, 0x3bb8a9d0UL, 0xfa367610UL,
+		0xd30d6393UL, 0x1283bc53UL, 0x8b61da52UL, 0x4aef0592UL,
+		0xf17dba48UL, 0x30f36588UL, 0xa9110389UL, 0x689fdc49UL,
+		0x41a4c9caUL, 0x802a160aUL, 0x19c8700bUL, 0xd846afcbUL,
+		0x4bbe5b0dUL, 0x8a3084cdUL, 0x13d2e2ccUL, 0xd25c3d0cUL,
+		0xfb67288fUL, 0x3ae9f74fUL, 0xa30b914eUL, 0x62854e8eUL,
+		0x5f8b7e83UL, 0x9e05a143UL, 0x07e7c742UL, 0xc6691882UL,
+		0xef520d01UL, 0x2edcd2c1UL, 0xb73eb4c0UL, 0x76b06b00UL,
+		0xe5489fc6UL, 0x24c64006UL, 0xbd242607UL, 0x7caaf9c7UL,
+		0x5591ec44UL, 0x941f3384UL, 0x0dfd5585UL, 0xcc738a45UL,
+		0xa1a92c70UL, 0x6027f3b0UL, 0xf9c595b1UL, 0x384b4a71UL,
+		0x11705ff2UL, 0xd0fe8032UL, 0x491ce633UL, 0x889239f3UL,
+		0x1b6acd35UL, 0xdae412f5UL, 0x430674f4UL, 0x8288ab34UL,
+		0xabb3beb7UL, 0x6a3d6177UL, 0xf3df0776UL, 0x3251d8b6UL,
+		0x0f5fe8bbUL, 0xced1377bUL, 0x5733517aUL, 0x96bd8ebaUL,
+		0xbf869b39UL, 0x7e0844f9UL, 0xe7ea22f8UL, 0x2664fd38UL,
+		0xb59c09feUL, 0x7412d63eUL, 0xedf0b03fUL, 0x2c7e6fffUL,
+		0x05457a7cUL, 0xc4cba5bcUL, 0x5d29c3bdUL, 0x9ca71c7dUL,
+		0x2735a3a7UL, 0xe6bb7c67UL, 0x7f591a66UL, 0xbed7c5a6UL,
+		0x97ecd025UL, 0x56620fe5UL, 0xcf8069e4UL, 0x0e0eb624UL,
+		0x9df642e2UL, 0x5c789d22UL, 0xc59afb23UL, 0x041424e3UL,
+		0x2d2f3160UL, 0xeca1eea0UL, 0x754388a1UL, 0xb4cd5761UL,
+		0x89c3676cUL, 0x484db8acUL, 0xd1afdeadUL, 0x1021016dUL,
+		0x391a14eeUL, 0xf894cb2eUL, 0x6176ad2fUL, 0xa0f872efUL,
+		0x33008629UL, 0xf28e59e9UL, 0x6b6c3fe8UL, 0xaae2e028UL,
+		0x83d9f5abUL, 0x42572a6bUL, 0xdbb54c6aUL, 0x1a3b93aaUL
+	},
+	{
+		0x00000000UL, 0x9ba54c6fUL, 0xec3b9e9fUL, 0x779ed2f0UL,
+		0x03063b7fUL, 0x98a37710UL, 0xef3da5e0UL, 0x7498e98fUL,
+		0x060c76feUL, 0x9da93a91UL, 0xea37e861UL, 0x7192a40eUL,
+		0x050a4d81UL, 0x9eaf01eeUL, 0xe931d31eUL, 0x72949f71UL,
+		0x0c18edfcUL, 0x97bda193UL, 0xe0237363UL, 0x7b863f0cUL,
+		0x0f1ed683UL, 0x94bb9aecUL, 0xe325481cUL, 0x78800473UL,
+		0x0a149b02UL, 0x91b1d76dUL, 0xe62f059dUL, 0x7d8a49f2UL,
+		0x0912a07dUL, 0x92b7ec12UL, 0xe5293ee2UL, 0x7e8c728dUL,
+		0x1831dbf8UL, 0x83949797UL, 0xf40a4567UL, 0x6faf0908UL,
+		0x1b37e087UL, 0x8092ace8UL, 0xf70c7e18UL, 0x6ca93277UL,
+		0x1e3dad06UL, 0x8598e169UL, 0xf2063399UL, 0x69a37ff6UL,
+		0x1d3b9679UL, 0x869eda16UL, 0xf10008e6UL, 0x6aa54489UL,
+		0x14293604UL, 0x8f8c7a6bUL, 0xf812a89bUL, 0x63b7e4f4UL,
+		0x172f0d7bUL, 0x8c8a4114UL, 0xfb1493e4UL, 0x60b1df8bUL,
+		0x122540faUL, 0x89800c95UL, 0xfe1ede65UL, 0x65bb920aUL,
+		0x11237b85UL, 0x8a8637eaUL, 0xfd18e51aUL, 0x66bda975UL,
+		0x3063b7f0UL, 0xabc6fb9fUL, 0xdc58296fUL, 0x47fd6500UL,
+		0x33658c8fUL, 0xa8c0c0e0UL, 0xdf5e1210UL, 0x44fb5e7fUL,
+		0x366fc10eUL, 0xadca8d61UL, 0xda545f91UL, 0x41f113feUL,
+		0x3569fa71UL, 0xaeccb61eUL, 0xd95264eeUL, 0x42f72881UL,
+		0x3c7b5a0cUL, 0xa7de1663UL, 0xd040c493UL, 0x4be588fcUL,
+		0x3f7d6173UL, 0xa4d82d1cUL, 0xd346ffecUL, 0x48e3b383UL,
+		0x3a772cf2UL, 0xa1d2609dUL, 0xd64cb26dUL, 0x4de9fe02UL,
+		0x3971178dUL, 0xa2d45be2UL, 0xd54a8912UL, 0x4eefc57dUL,
+		0x28526c08UL, 0xb3f72067UL, 0xc469f297UL, 0x5fccbef8UL,
+		0x2b545777UL, 0xb0f11b18UL, 0xc76fc9e8UL, 0x5cca8587UL,
+		0x2e5e1af6UL, 0xb5fb5699UL, 0xc2658469UL, 0x59c0c806UL,
+		0x2d582189UL, 0xb6fd6de6UL, 0xc163bf16UL, 0x5ac6f379UL,
+		0x244a81f4UL, 0xbfefcd9bUL, 0xc8711f6bUL, 0x53d45304UL,
+		0x274cba8bUL, 0xbce9f6e4UL, 0xcb772414UL, 0x50d2687bUL,
+		0x2246f70aUL, 0xb9e3bb65UL, 0xce7d6995UL, 0x55d825faUL,
+		0x2140cc75UL, 0xbae5801aUL, 0xcd7b52eaUL, 0x56de1e85UL,
+		0x60c76fe0UL, 0xfb62238fUL, 0x8cfcf17fUL, 0x1759bd10UL,
+		0x63c1549fUL, 0xf86418f0UL, 0x8ffaca00UL, 0x145f866fUL,
+		0x66cb191eUL, 0xfd6e5571UL, 0x8af08781UL, 0x1155cbeeUL,
+		0x65cd2261UL, 0xfe686e0eUL, 0x89f6bcfeUL, 0x1253f091UL,
+		0x6cdf821cUL, 0xf77ace73UL, 0x80e41c83UL, 0x1b4150ecUL,
+		0x6fd9b963UL, 0xf47cf50cUL, 0x83e227fcUL, 0x18476b93UL,
+		0x6ad3f4e2UL, 0xf176b88dUL, 0x86e86a7dUL, 0x1d4d2612UL,
+		0x69d5cf9dUL, 0xf27083f2UL, 0x85ee5102UL, 0x1e4b1d6dUL,
+		0x78f6b418UL, 0xe353f877UL, 0x94cd2a87UL, 0x0f6866e8UL,
+		0x7bf08f67UL, 0xe055c308UL, 0x97cb11f8UL, 0x0c6e5d97UL,
+		0x7efac2e6UL, 0xe55f8e89UL, 0x92c15c79UL, 0x09641016UL,
+		0x7dfcf999UL, 0xe659b5f6UL, 0x91c76706UL, 0x0a622b69UL,
+		0x74ee59e4UL, 0xef4b158bUL, 0x98d5c77bUL, 0x03708b14UL,
+		0x77e8629bUL, 0xec4d2ef4UL, 0x9bd3fc04UL, 0x0076b06bUL,
+		0x72e22f1aUL, 0xe9476375UL, 0x9ed9b185UL, 0x057cfdeaUL,
+		0x71e41465UL, 0xea41580aUL, 0x9ddf8afaUL, 0x067ac695UL,
+		0x50a4d810UL, 0xcb01947fUL, 0xbc9f468fUL, 0x273a0ae0UL,
+		0x53a2e36fUL, 0xc807af00UL, 0xbf997df0UL, 0x243c319fUL,
+		0x56a8aeeeUL, 0xcd0de281UL, 0xba933071UL, 0x21367c1eUL,
+		0x55ae9591UL, 0xce0bd9feUL, 0xb9950b0eUL, 0x22304761UL,
+		0x5cbc35ecUL, 0xc7197983UL, 0xb087ab73UL, 0x2b22e71cUL,
+		0x5fba0e93UL, 0xc41f42fcUL, 0xb381900cUL, 0x2824dc63UL,
+		0x5ab04312UL, 0xc1150f7dUL, 0xb68bdd8dUL, 0x2d2e91e2UL,
+		0x59b6786dUL, 0xc2133402UL, 0xb58de6f2UL, 0x2e28aa9dUL,
+		0x489503e8UL, 0xd3304f87UL, 0xa4ae9d77UL, 0x3f0bd118UL,
+		0x4b933897UL, 0xd03674f8UL, 0xa7a8a608UL, 0x3c0dea67UL,
+		0x4e997516UL, 0xd53c3979UL, 0xa2a2eb89UL, 0x3907a7e6UL,
+		0x4d9f4e69UL, 0xd63a0206UL, 0xa1a4d0f6UL, 0x3a019c99UL,
+		0x448dee14UL, 0xdf28a27bUL, 0xa8b6708bUL, 0x33133ce4UL,
+		0x478bd56bUL, 0xdc2e9904UL, 0xabb04bf4UL, 0x3015079bUL,
+		0x428198eaUL, 0xd924d485UL, 0xaeba0675UL, 0x351f4a1aUL,
+		0x4187a395UL, 0xda22effaUL, 0xadbc3d0aUL, 0x36197165UL
+	},
+	{
+		0x00000000UL, 0xdd96d985UL, 0x605cb54bUL, 0xbdca6cceUL,
+		0xc0b96a96UL, 0x1d2fb313UL, 0xa0e5dfddUL, 0x7d730658UL,
+		0x5a03d36dUL, 0x87950ae8UL, 0x3a5f6626UL, 0xe7c9bfa3UL,
+		0x9abab9fbUL, 0x472c607eUL, 0xfae60cb0UL, 0x2770d535UL,
+		0xb407a6daUL, 0x69917f5fUL, 0xd45b1391UL, 0x09cdca14UL,
+		0x74becc4cUL, 0xa92815c9UL, 0x14e27907UL, 0xc974a082UL,
+		0xee0475b7UL, 0x3392ac32UL, 0x8e58c0fcUL, 0x53ce1979UL,
+		0x2ebd1f21UL, 0xf32bc6a4UL, 0x4ee1aa6aUL, 0x937773efUL,
+		0xb37e4bf5UL, 0x6ee89270UL, 0xd322febeUL, 0x0eb4273bUL,
+		0x73c72163UL, 0xae51f8e6UL, 0x139b9428UL, 0xce0d4dadUL,
+		0xe97d9898UL, 0x34eb411dUL, 0x89212dd3UL, 0x54b7f456UL,
+		0x29c4f20eUL, 0xf4522b8bUL, 0x49984745UL, 0x940e9ec0UL,
+		0x0779ed2fUL, 0xdaef34aaUL, 0x67255864UL, 0xbab381e1UL,
+		0xc7c087b9UL, 0x1a565e3cUL, 0xa79c32f2UL, 0x7a0aeb77UL,
+		0x5d7a3e42UL, 0x80ece7c7UL, 0x3d268b09UL, 0xe0b0528cUL,
+		0x9dc354d4UL, 0x40558d51UL, 0xfd9fe19fUL, 0x2009381aUL,
+		0xbd8d91abUL, 0x601b482eUL, 0xddd124e0UL, 0x0047fd65UL,
+		0x7d34fb3dUL, 0xa0a222b8UL, 0x1d684e76UL, 0xc0fe97f3UL,
+		0xe78e42c6UL, 0x3a189b43UL, 0x87d2f78dUL, 0x5a442e08UL,
+		0x27372850UL, 0xfaa1f1d5UL, 0x476b9d1bUL, 0x9afd449eUL,
+		0x098a3771UL, 0xd41ceef4UL, 0x69d6823aUL, 0xb4405bbfUL,
+		0xc9335de7UL, 0x14a58462UL, 0xa96fe8acUL, 0x74f93129UL,
+		0x5389e41cUL, 0x8e1f3d99UL, 0x33d55157UL, 0xee4388d2UL,
+		0x93308e8aUL, 0x4ea6570fUL, 0xf36c3bc1UL, 0x2efae244UL,
+		0x0ef3da5eUL, 0xd36503dbUL, 0x6eaf6f15UL, 0xb339b690UL,
+		0xce4ab0c8UL, 0x13dc694dUL, 0xae160583UL, 0x7380dc06UL,
+		0x54f00933UL, 0x8966d0b6UL, 0x34acbc78UL, 0xe93a65fdUL,
+		0x944963a5UL, 0x49dfba20UL, 0xf415d6eeUL, 0x29830f6bUL,
+		0xbaf47c84UL, 0x6762a501UL, 0xdaa8c9cfUL, 0x073e104aUL,
+		0x7a4d1612UL, 0xa7dbcf97UL, 0x1a11a359UL, 0xc7877adcUL,
+		0xe0f7afe9UL, 0x3d61766cUL, 0x80ab1aa2UL, 0x5d3dc327UL,
+		0x204ec57fUL, 0xfdd81cfaUL, 0x40127034UL, 0x9d84a9b1UL,
+		0xa06a2517UL, 0x7dfcfc92UL, 0xc036905cUL, 0x1da049d9UL,
+		0x60d34f81UL, 0xbd459604UL, 0x008ffacaUL, 0xdd19234fUL,
+		0xfa69f67aUL, 0x27ff2fffUL, 0x9a354331UL, 0x47a39ab4UL,
+		0x3ad09cecUL, 0xe7464569UL, 0x5a8c29a7UL, 0x871af022UL,
+		0x146d83cdUL, 0xc9fb5a48UL, 0x74313686UL, 0xa9a7ef03UL,
+		0xd4d4e95bUL, 0x094230deUL, 0xb4885c10UL, 0x691e8595UL,
+		0x4e6e50a0UL, 0x93f88925UL, 0x2e32e5ebUL, 0xf3a43c6eUL,
+		0x8ed73a36UL, 0x5341e3b3UL, 0xee8b8f7dUL, 0x331d56f8UL,
+		0x13146ee2UL, 0xce82b767UL, 0x7348dba9UL, 0xaede022cUL,
+		0xd3ad0474UL, 0x0e3bddf1UL, 0xb3f1b13fUL, 0x6e6768baUL,
+		0x4917bd8fUL, 0x9481640aUL, 0x294b08c4UL, 0xf4ddd141UL,
+		0x89aed719UL, 0x54380e9cUL, 0xe9f26252UL, 0x3464bbd7UL,
+		0xa713c838UL, 0x7a8511bdUL, 0xc74f7d73UL, 0x1ad9a4f6UL,
+		0x67aaa2aeUL, 0xba3c7b2bUL, 0x07f617e5UL, 0xda60ce60UL,
+		0xfd101b55UL, 0x2086c2d0UL, 0x9d4cae1eUL, 0x40da779bUL,
+		0x3da971c3UL, 0xe03fa846UL, 0x5df5c488UL, 0x80631d0dUL,
+		0x1de7b4bcUL, 0xc0716d39UL, 0x7dbb01f7UL, 0xa02dd872UL,
+		0xdd5ede2aUL, 0x00c807afUL, 0xbd026b61UL, 0x6094b2e4UL,
+		0x47e467d1UL, 0x9a72be54UL, 0x27b8d29aUL, 0xfa2e0b1fUL,
+		0x875d0d47UL, 0x5acbd4c2UL, 0xe701b80cUL, 0x3a976189UL,
+		0xa9e01266UL, 0x7476cbe3UL, 0xc9bca72dUL, 0x142a7ea8UL,
+		0x695978f0UL, 0xb4cfa175UL, 0x0905cdbbUL, 0xd493143eUL,
+		0xf3e3c10bUL, 0x2e75188eUL, 0x93bf7440UL, 0x4e29adc5UL,
+		0x335aab9dUL, 0xeecc7218UL, 0x53061ed6UL, 0x8e90c753UL,
+		0xae99ff49UL, 0x730f26ccUL, 0xcec54a02UL, 0x13539387UL,
+		0x6e2095dfUL, 0xb3b64c5aUL, 0x0e7c2094UL, 0xd3eaf911UL,
+		0xf49a2c24UL, 0x290cf5a1UL, 0x94c6996fUL, 0x495040eaUL,
+		0x342346b2UL, 0xe9b59f37UL, 0x547ff3f9UL, 0x89e92a7cUL,
+		0x1a9e5993UL, 0xc7088016UL, 0x7ac2ecd8UL, 0xa754355dUL,
+		0xda273305UL, 0x07b1ea80UL, 0xba7b864eUL, 0x67ed5fcbUL,
+		0x409d8afeUL, 0x9d0b537bUL, 0x20c13fb5UL, 0xfd57e630UL,
+		0x8024e068UL, 0x5db239edUL, 0xe0785523UL, 0x3dee8ca6UL
+	},
+	{
+		0x00000000UL, 0x9d0fe176UL, 0xe16ec4adUL, 0x7c6125dbUL,
+		0x19ac8f1bUL, 0x84a36e6dUL, 0xf8c24bb6UL, 0x65cdaac0UL,
+		0x33591e36UL, 0xae56ff40UL, 0xd237da9bUL, 0x4f383bedUL,
+		0x2af5912dUL, 0xb7fa705bUL, 0xcb9b5580UL, 0x5694b4f6UL,
+		0x66b23c6cUL, 0xfbbddd1aUL, 0x87dcf8c1UL, 0x1ad319b7UL,
+		0x7f1eb377UL, 0xe2115201UL, 0x9e7077daUL, 0x037f96acUL,
+		0x55eb225aUL, 0xc8e4c32cUL, 0xb485e6f7UL, 0x298a0781UL,
+		0x4c47ad41UL, 0xd1484c37UL, 0xad2969ecUL, 0x3026889aUL,
+		0xcd6478d8UL, 0x506b99aeUL, 0x2c0abc75UL, 0xb1055d03UL,
+		0xd4c8f7c3UL, 0x49c716b5UL, 0x35a6336eUL, 0xa8a9d218UL,
+		0xfe3d66eeUL, 0x63328798UL, 0x1f53a243UL, 0x825c4335UL,
+		0xe791e9f5UL, 0x7a9e0883UL, 0x06ff2d58UL, 0x9bf0cc2eUL,
+		0xabd644b4UL, 0x36d9a5c2UL, 0x4ab88019UL, 0xd7b7616fUL,
+		0xb27acbafUL, 0x2f752ad9UL, 0x53140f02UL, 0xce1bee74UL,
+		0x988f5a82UL, 0x0580bbf4UL, 0x79e19e2fUL, 0xe4ee7f59UL,
+		0x8123d599UL, 0x1c2c34efUL, 0x604d1134UL, 0xfd42f042UL,
+		0x41b9f7f1UL, 0xdcb61687UL, 0xa0d7335cUL, 0x3dd8d22aUL,
+		0x581578eaUL, 0xc51a999cUL, 0xb97bbc47UL, 0x24745d31UL,
+		0x72e0e9c7UL, 0xefef08b1UL, 0x938e2d6aUL, 0x0e81cc1cUL,
+		0x6b4c66dcUL, 0xf64387aaUL, 0x8a22a271UL, 0x172d4307UL,
+		0x270bcb9dUL, 0xba042aebUL, 0xc6650f30UL, 0x5b6aee46UL,
+		0x3ea74486UL, 0xa3a8a5f0UL, 0xdfc9802bUL, 0x42c6615dUL,
+		0x1452d5abUL, 0x895d34ddUL, 0xf53c1106UL, 0x6833f070UL,
+		0x0dfe5ab0UL, 0x90f1bbc6UL, 0xec909e1dUL, 0x719f7f6bUL,
+		0x8cdd8f29UL, 0x11d26e5fUL, 0x6db34b84UL, 0xf0bcaaf2UL,
+		0x95710032UL, 0x087ee144UL, 0x741fc49fUL, 0xe91025e9UL,
+		0xbf84911fUL, 0x228b7069UL, 0x5eea55b2UL, 0xc3e5b4c4UL,
+		0xa6281e04UL, 0x3b27ff72UL, 0x4746daa9UL, 0xda493bdfUL,
+		0xea6fb345UL, 0x77605233UL, 0x0b0177e8UL, 0x960e969eUL,
+		0xf3c33c5eUL, 0x6eccdd28UL, 0x12adf8f3UL, 0x8fa21985UL,
+		0xd936ad73UL, 0x44394c05UL, 0x385869deUL, 0xa55788a8UL,
+		0xc09a2268UL, 0x5d95c31eUL, 0x21f4e6c5UL, 0xbcfb07b3UL,
+		0x8373efe2UL, 0x1e7c0e94UL, 0x621d2b4fUL, 0xff12ca39UL,
+		0x9adf60f9UL, 0x07d0818fUL, 0x7bb1a454UL, 0xe6be4522UL,
+		0xb02af1d4UL, 0x2d2510a2UL, 0x51443579UL, 0xcc4bd40fUL,
+		0xa9867ecfUL, 0x34899fb9UL, 0x48e8ba62UL, 0xd5e75b14UL,
+		0xe5c1d38eUL, 0x78ce32f8UL, 0x04af1723UL, 0x99a0f655UL,
+		0xfc6d5c95UL, 0x6162bde3UL, 0x1d039838UL, 0x800c794eUL,
+		0xd698cdb8UL, 0x4b972cceUL, 0x37f60915UL, 0xaaf9e863UL,
+		0xcf3442a3UL, 0x523ba3d5UL, 0x2e5a860eUL, 0xb3556778UL,
+		0x4e17973aUL, 0xd318764cUL, 0xaf795397UL, 0x3276b2e1UL,
+		0x57bb1821UL, 0xcab4f957UL, 0xb6d5dc8cUL, 0x2bda3dfaUL,
+		0x7d4e890cUL, 0xe041687aUL, 0x9c204da1UL, 0x012facd7UL,
+		0x64e20617UL, 0xf9ede761UL, 0x858cc2baUL, 0x188323ccUL,
+		0x28a5ab56UL, 0xb5aa4a20UL, 0xc9cb6ffbUL, 0x54c48e8dUL,
+		0x3109244dUL, 0xac06c53bUL, 0xd067e0e0UL, 0x4d680196UL,
+		0x1bfcb560UL, 0x86f35416UL, 0xfa9271cdUL, 0x679d90bbUL,
+		0x02503a7bUL, 0x9f5fdb0dUL, 0xe33efed6UL, 0x7e311fa0UL,
+		0xc2ca1813UL, 0x5fc5f965UL, 0x23a4dcbeUL, 0xbeab3dc8UL,
+		0xdb669708UL, 0x4669767eUL, 0x3a0853a5UL, 0xa707b2d3UL,
+		0xf1930625UL, 0x6c9ce753UL, 0x10fdc288UL, 0x8df223feUL,
+		0xe83f893eUL, 0x75306848UL, 0x09514d93UL, 0x945eace5UL,
+		0xa478247fUL, 0x3977c509UL, 0x4516e0d2UL, 0xd81901a4UL,
+		0xbdd4ab64UL, 0x20db4a12UL, 0x5cba6fc9UL, 0xc1b58ebfUL,
+		0x97213a49UL, 0x0a2edb3fUL, 0x764ffee4UL, 0xeb401f92UL,
+		0x8e8db552UL, 0x13825424UL, 0x6fe371ffUL, 0xf2ec9089UL,
+		0x0fae60cbUL, 0x92a181bdUL, 0xeec0a466UL, 0x73cf4510UL,
+		0x1602efd0UL, 0x8b0d0ea6UL, 0xf76c2b7dUL, 0x6a63ca0bUL,
+		0x3cf77efdUL, 0xa1f89f8bUL, 0xdd99ba50UL, 0x40965b26UL,
+		0x255bf1e6UL, 0xb8541090UL, 0xc435354bUL, 0x593ad43dUL,
+		0x691c5ca7UL, 0xf413bdd1UL, 0x8872980aUL, 0x157d797cUL,
+		0x70b0d3bcUL, 0xedbf32caUL, 0x91de1711UL, 0x0cd1f667UL,
+		0x5a454291UL, 0xc74aa3e7UL, 0xbb2b863cUL, 0x2624674aUL,
+		0x43e9cd8aUL, 0xdee62cfcUL, 0xa2870927UL, 0x3f88e851UL
+	},
+	{
+		0x00000000UL, 0xb9fbdbe8UL, 0xa886b191UL, 0x117d6a79UL,
+		0x8a7c6563UL, 0x3387be8bUL, 0x22fad4f2UL, 0x9b010f1aUL,
+		0xcf89cc87UL, 0x7672176fUL, 0x670f7d16UL, 0xdef4a6feUL,
+		0x45f5a9e4UL, 0xfc0e720cUL, 0xed731875UL, 0x5488c39dUL,
+		0x44629f4fUL, 0xfd9944a7UL, 0xece42edeUL, 0x551ff536UL,
+		0xce1efa2cUL, 0x77e521c4UL, 0x66984bbdUL, 0xdf639055UL,
+		0x8beb53c8UL, 0x32108820UL, 0x236de259UL, 0x9a9639b1UL,
+		0x019736abUL, 0xb86ced43UL, 0xa911873aUL, 0x10ea5cd2UL,
+		0x88c53e9eUL, 0x313ee576UL, 0x20438f0fUL, 0x99b854e7UL,
+		0x02b95bfdUL, 0xbb428015UL, 0xaa3fea6cUL, 0x13c43184UL,
+		0x474cf219UL, 0xfeb729f1UL, 0xefca4388UL, 0x56319860UL,
+		0xcd30977aUL, 0x74cb4c92UL, 0x65b626ebUL, 0xdc4dfd03UL,
+		0xcca7a1d1UL, 0x755c7a39UL, 0x64211040UL, 0xdddacba8UL,
+		0x46dbc4b2UL, 0xff201f5aUL, 0xee5d7523UL, 0x57a6aecbUL,
+		0x032e6d56UL, 0xbad5b6beUL, 0xaba8dcc7UL, 0x1253072fUL,
+		0x89520835UL, 0x30a9d3ddUL, 0x21d4b9a4UL, 0x982f624cUL,
+		0xcafb7b7dUL, 0x7300a095UL, 0x627dcaecUL, 0xdb861104UL,
+		0x40871e1eUL, 0xf97cc5f6UL, 0xe801af8fUL, 0x51fa7467UL,
+		0x0572b7faUL, 0xbc896c12UL, 0xadf4066bUL, 0x140fdd83UL,
+		0x8f0ed299UL, 0x36f50971UL, 0x27886308UL, 0x9e73b8e0UL,
+		0x8e99e432UL, 0x37623fdaUL, 0x261f55a3UL, 0x9fe48e4bUL,
+		0x04e58151UL, 0xbd1e5ab9UL, 0xac6330c0UL, 0x1598eb28UL,
+		0x411028b5UL, 0xf8ebf35dUL, 0xe9969924UL, 0x506d42ccUL,
+		0xcb6c4dd6UL, 0x7297963eUL, 0x63eafc47UL, 0xda1127afUL,
+		0x423e45e3UL, 0xfbc59e0bUL, 0xeab8f472UL, 0x53432f9aUL,
+		0xc8422080UL, 0x71b9fb68UL, 0x60c49111UL, 0xd93f4af9UL,
+		0x8db78964UL, 0x344c528cUL, 0x253138f5UL, 0x9ccae31dUL,
+		0x07cbec07UL, 0xbe3037efUL, 0xaf4d5d96UL, 0x16b6867eUL,
+		0x065cdaacUL, 0xbfa70144UL, 0xaeda6b3dUL, 0x1721b0d5UL,
+		0x8c20bfcfUL, 0x35db6427UL, 0x24a60e5eUL, 0x9d5dd5b6UL,
+		0xc9d5162bUL, 0x702ecdc3UL, 0x6153a7baUL, 0xd8a87c52UL,
+		0x43a97348UL, 0xfa52a8a0UL, 0xeb2fc2d9UL, 0x52d41931UL,
+		0x4e87f0bbUL, 0xf77c2b53UL, 0xe601412aUL, 0x5ffa9ac2UL,
+		0xc4fb95d8UL, 0x7d004e30UL, 0x6c7d2449UL, 0xd586ffa1UL,
+		0x810e3c3cUL, 0x38f5e7d4UL, 0x29888dadUL, 0x90735645UL,
+		0x0b72595fUL, 0xb28982b7UL, 0xa3f4e8ceUL, 0x1a0f3326UL,
+		0x0ae56ff4UL, 0xb31eb41cUL, 0xa263de65UL, 0x1b98058dUL,
+		0x80990a97UL, 0x3962d17fUL, 0x281fbb06UL, 0x91e460eeUL,
+		0xc56ca373UL, 0x7c97789bUL, 0x6dea12e2UL, 0xd411c90aUL,
+		0x4f10c610UL, 0xf6eb1df8UL, 0xe7967781UL, 0x5e6dac69UL,
+		0xc642ce25UL, 0x7fb915cdUL, 0x6ec47fb4UL, 0xd73fa45cUL,
+		0x4c3eab46UL, 0xf5c570aeUL, 0xe4b81ad7UL, 0x5d43c13fUL,
+		0x09cb02a2UL, 0xb030d94aUL, 0xa14db333UL, 0x18b668dbUL,
+		0x83b767c1UL, 0x3a4cbc29UL, 0x2b31d650UL, 0x92ca0db8UL,
+		0x8220516aUL, 0x3bdb8a82UL, 0x2aa6e0fbUL, 0x935d3b13UL,
+		0x085c3409UL, 0xb1a7efe1UL, 0xa0da8598UL, 0x19215e70UL,
+		0x4da99dedUL, 0xf4524605UL, 0xe52f2c7cUL, 0x5cd4f794UL,
+		0xc7d5f88eUL, 0x7e2e2366UL, 0x6f53491fUL, 0xd6a892f7UL,
+		0x847c8bc6UL, 0x3d87502eUL, 0x2cfa3a57UL, 0x9501e1bfUL,
+		0x0e00eea5UL, 0xb7fb354dUL, 0xa6865f34UL, 0x1f7d84dcUL,
+		0x4bf54741UL, 0xf20e9ca9UL, 0xe373f6d0UL, 0x5a882d38UL,
+		0xc1892222UL, 0x7872f9caUL, 0x690f93b3UL, 0xd0f4485bUL,
+		0xc01e1489UL, 0x79e5cf61UL, 0x6898a518UL, 0xd1637ef0UL,
+		0x4a6271eaUL, 0xf399aa02UL, 0xe2e4c07bUL, 0x5b1f1b93UL,
+		0x0f97d80eUL, 0xb66c03e6UL, 0xa711699fUL, 0x1eeab277UL,
+		0x85ebbd6dUL, 0x3c106685UL, 0x2d6d0cfcUL, 0x9496d714UL,
+		0x0cb9b558UL, 0xb5426eb0UL, 0xa43f04c9UL, 0x1dc4df21UL,
+		0x86c5d03bUL, 0x3f3e0bd3UL, 0x2e4361aaUL, 0x97b8ba42UL,
+		0xc33079dfUL, 0x7acba237UL, 0x6bb6c84eUL, 0xd24d13a6UL,
+		0x494c1cbcUL, 0xf0b7c754UL, 0xe1caad2dUL, 0x583176c5UL,
+		0x48db2a17UL, 0xf120f1ffUL, 0xe05d9b86UL, 0x59a6406eUL,
+		0xc2a74f74UL, 0x7b5c949cUL, 0x6a21fee5UL, 0xd3da250dUL,
+		0x8752e690UL, 0x3ea93d78UL, 0x2fd45701UL, 0x962f8ce9UL,
+		0x0d2e83f3UL, 0xb4d5581bUL, 0xa5a83262UL, 0x1c53e98aUL
+	},
+	{
+		0x00000000UL, 0xae689191UL, 0x87a02563UL, 0x29c8b4f2UL,
+		0xd4314c87UL, 0x7a59dd16UL, 0x539169e4UL, 0xfdf9f875UL,
+		0x73139f4fUL, 0xdd7b0edeUL, 0xf4b3ba2cUL, 0x5adb2bbdUL,
+		0xa722d3c8UL, 0x094a4259UL, 0x2082f6abUL, 0x8eea673aUL,
+		0xe6273e9eUL, 0x484faf0fUL, 0x61871bfdUL, 0xcfef8a6cUL,
+		0x32167219UL, 0x9c7ee388UL, 0xb5b6577aUL, 0x1bdec6ebUL,
+		0x9534a1d1UL, 0x3b5c3040UL, 0x129484b2UL, 0xbcfc1523UL,
+		0x4105ed56UL, 0xef6d7cc7UL, 0xc6a5c835UL, 0x68cd59a4UL,
+		0x173f7b7dUL, 0xb957eaecUL, 0x909f5e1eUL, 0x3ef7cf8fUL,
+		0xc30e37faUL, 0x6d66a66bUL, 0x44ae1299UL, 0xeac68308UL,
+		0x642ce432UL, 0xca4475a3UL, 0xe38cc151UL, 0x4de450c0UL,
+		0xb01da8b5UL, 0x1e753924UL, 0x37bd8dd6UL, 0x99d51c47UL,
+		0xf11845e3UL, 0x5f70d472UL, 0x76b86080UL, 0xd8d0f111UL,
+		0x25290964UL, 0x8b4198f5UL, 0xa2892c07UL, 0x0ce1bd96UL,
+		0x820bdaacUL, 0x2c634b3dUL, 0x05abffcfUL, 0xabc36e5eUL,
+		0x563a962bUL, 0xf85207baUL, 0xd19ab348UL, 0x7ff222d9UL,
+		0x2e7ef6faUL, 0x8016676bUL, 0xa9ded399UL, 0x07b64208UL,
+		0xfa4fba7dUL, 0x54272becUL, 0x7def9f1eUL, 0xd3870e8fUL,
+		0x5d6d69b5UL, 0xf305f824UL, 0xdacd4cd6UL, 0x74a5dd47UL,
+		0x895c2532UL, 0x2734b4a3UL, 0x0efc0051UL, 0xa09491c0UL,
+		0xc859c864UL, 0x663159f5UL, 0x4ff9ed07UL, 0xe1917c96UL,
+		0x1c6884e3UL, 0xb2001572UL, 0x9bc8a180UL, 0x35a03011UL,
+		0xbb4a572bUL, 0x1522c6baUL, 0x3cea7248UL, 0x9282e3d9UL,
+		0x6f7b1bacUL, 0xc1138a3dUL, 0xe8db3ecfUL, 0x46b3af5eUL,
+		0x39418d87UL, 0x97291c16UL, 0xbee1a8e4UL, 0x10893975UL,
+		0xed70c100UL, 0x43185091UL, 0x6ad0e463UL, 0xc4b875f2UL,
+		0x4a5212c8UL, 0xe43a8359UL, 0xcdf237abUL, 0x639aa63aUL,
+		0x9e635e4fUL, 0x300bcfdeUL, 0x19c37b2cUL, 0xb7abeabdUL,
+		0xdf66b319UL, 0x710e2288UL, 0x58c6967aUL, 0xf6ae07ebUL,
+		0x0b57ff9eUL, 0xa53f6e0fUL, 0x8cf7dafdUL, 0x229f4b6cUL,
+		0xac752c56UL, 0x021dbdc7UL, 0x2bd50935UL, 0x85bd98a4UL,
+		0x784460d1UL, 0xd62cf140UL, 0xffe445b2UL, 0x518cd423UL,
+		0x5cfdedf4UL, 0xf2957c65UL, 0xdb5dc897UL, 0x75355906UL,
+		0x88cca173UL, 0x26a430e2UL, 0x0f6c8410UL, 0xa1041581UL,
+		0x2fee72bbUL, 0x8186e32aUL, 0xa84e57d8UL, 0x0626c649UL,
+		0xfbdf3e3cUL, 0x55b7afadUL, 0x7c7f1b5fUL, 0xd2178aceUL,
+		0xbadad36aUL, 0x14b242fbUL, 0x3d7af609UL, 0x93126798UL,
+		0x6eeb9fedUL, 0xc0830e7cUL, 0xe94bba8eUL, 0x47232b1fUL,
+		0xc9c94c25UL, 0x67a1ddb4UL, 0x4e696946UL, 0xe001f8d7UL,
+		0x1df800a2UL, 0xb3909133UL, 0x9a5825c1UL, 0x3430b450UL,
+		0x4bc29689UL, 0xe5aa0718UL, 0xcc62b3eaUL, 0x620a227bUL,
+		0x9ff3da0eUL, 0x319b4b9fUL, 0x1853ff6dUL, 0xb63b6efcUL,
+		0x38d109c6UL, 0x96b99857UL, 0xbf712ca5UL, 0x1119bd34UL,
+		0xece04541UL, 0x4288d4d0UL, 0x6b406022UL, 0xc528f1b3UL,
+		0xade5a817UL, 0x038d3986UL, 0x2a458d74UL, 0x842d1ce5UL,
+		0x79d4e490UL, 0xd7bc7501UL, 0xfe74c1f3UL, 0x501c5062UL,
+		0xdef63758UL, 0x709ea6c9UL, 0x5956123bUL, 0xf73e83aaUL,
+		0x0ac77bdfUL, 0xa4afea4eUL, 0x8d675ebcUL, 0x230fcf2dUL,
+		0x72831b0eUL, 0xdceb8a9fUL, 0xf5233e6dUL, 0x5b4baffcUL,
+		0xa6b25789UL, 0x08dac618UL, 0x211272eaUL, 0x8f7ae37bUL,
+		0x01908441UL, 0xaff815d0UL, 0x8630a122UL, 0x285830b3UL,
+		0xd5a1c8c6UL, 0x7bc95957UL, 0x5201eda5UL, 0xfc697c34UL,
+		0x94a42590UL, 0x3accb401UL, 0x130400f3UL, 0xbd6c9162UL,
+		0x40956917UL, 0xeefdf886UL, 0xc7354c74UL, 0x695ddde5UL,
+		0xe7b7badfUL, 0x49df2b4eUL, 0x60179fbcUL, 0xce7f0e2dUL,
+		0x3386f658UL, 0x9dee67c9UL, 0xb426d33bUL, 0x1a4e42aaUL,
+		0x65bc6073UL, 0xcbd4f1e2UL, 0xe21c4510UL, 0x4c74d481UL,
+		0xb18d2cf4UL, 0x1fe5bd65UL, 0x362d0997UL, 0x98459806UL,
+		0x16afff3cUL, 0xb8c76eadUL, 0x910fda5fUL, 0x3f674bceUL,
+		0xc29eb3bbUL, 0x6cf6222aUL, 0x453e96d8UL, 0xeb560749UL,
+		0x839b5eedUL, 0x2df3cf7cUL, 0x043b7b8eUL, 0xaa53ea1fUL,
+		0x57aa126aUL, 0xf9c283fbUL, 0xd00a3709UL, 0x7e62a698UL,
+		0xf088c1a2UL, 0x5ee05033UL, 0x7728e4c1UL, 0xd9407550UL,
+		0x24b98d25UL, 0x8ad11cb4UL, 0xa319a846UL, 0x0d7139d7UL
+	}
+};
+
+/* The folding constants of the RFC 1952 polynomial
+ */
+const uint64_t crc32_folding_constants_rfc1952[ 8 ] = {
+	0x0000000154442bd4ULL, 0x00000001c6e41596ULL,
+	0x00000001751997d0ULL, 0x00000000ccaa009eULL,
+	0x0000000163cd6124ULL, 0x0000000000000000ULL,
+	0x00000001db710641ULL, 0x00000001f7011641ULL
+};
+
+/* The slicing tables of the Castagnoli (CRC-32C) polynomial
+ * Polynomial: 0x82f63b78
+ */
+const uint32_t crc32_slicing_tables_castagnoli[ 16 ][ 256 ] = {
+	{
+		0x00000000UL, 0xf26b8303UL, 0xe13b70f7UL, 0x1350f3f4UL,
+		0xc79a971fUL, 0x35f1141cUL, 0x26a1e7e8UL, 0xd4ca64ebUL,
+		0x8ad958cfUL, 0x78b2dbccUL, 0x6be22838UL, 0x9989ab3bUL,
+		0x4d43cfd0UL, 0xbf284cd3UL, 0xac78bf27UL, 0x5e133c24UL,
+		0x105ec76fUL, 0xe235446cUL, 0xf165b798UL, 0x030e349bUL,
+		0xd7c45070UL, 0x25afd373UL, 0x36ff2087UL, 0xc494a384UL,
+		0x9a879fa0UL, 0x68ec1ca3UL, 0x7bbcef57UL, 0x89d76c54UL,
+		0x5d1d08bfUL, 0xaf768bbcUL, 0xbc267848UL, 0x4e4dfb4bUL,
+		0x20bd8edeUL, 0xd2d60dddUL, 0xc186fe29UL, 0x33ed7d2aUL,
+		0xe72719c1UL, 0x154c9ac2UL, 0x061c6936UL, 0xf477ea35UL,
+		0xaa64d611UL, 0x580f5512UL, 0x4b5fa6e6UL, 0xb93425e5UL,
+		0x6dfe410eUL, 0x9f95c20dUL, 0x8cc531f9UL, 0x7eaeb2faUL,
+		0x30e349b1UL, 0xc288cab2UL, 0xd1d83946UL, 0x23b3ba45UL,
+		0xf779deaeUL, 0x05125dadUL, 0x1642ae59UL, 0xe4292d5aUL,
+		0xba3a117eUL, 0x4851927dUL, 0x5b016189UL, 0xa96ae28aUL,
+		0x7da08661UL, 0x8fcb0562UL, 0x9c9bf696UL, 0x6ef07595UL,
+		0x417b1dbcUL, 0xb3109ebfUL, 0xa0406d4bUL, 0x522bee48UL,
+		0x86e18aa3UL, 0x748a09a0UL, 0x67dafa54UL, 0x95b17957UL,
+		0xcba24573UL, 0x39c9c670UL, 0x2a993584UL, 0xd8f2b687UL,
+		0x0c38d26cUL, 0xfe53516fUL, 0xed03a29bUL, 0x1f682198UL,
+		0x5125dad3UL, 0xa34e59d0UL, 0xb01eaa24UL, 0x42752927UL,
+		0x96bf4dccUL, 0x64d4cecfUL, 0x77843d3bUL, 0x85efbe38UL,
+		0xdbfc821cUL, 0x2997011fUL, 0x3ac7f2ebUL, 0xc8ac71e8UL,
+		0x1c661503UL, 0xee0d9600UL, 0xfd5d65f4UL, 0x0f36e6f7UL,
+		0x61c69362UL, 0x93ad1061UL, 0x80fde395UL, 0x72966096UL,
+		0xa65c047dUL, 0x5437877eUL, 0x4767748aUL, 0xb50cf789UL,
+		0xeb1fcbadUL, 0x197448aeUL, 0x0a24bb5aUL, 0xf84f3859UL,
+		0x2c855cb2UL, 0xdeeedfb1UL, 0xcdbe2c45UL, 0x3fd5af46UL,
+		0x7198540dUL, 0x83f3d70eUL, 0x90a324faUL, 0x62c8a7f9UL,
+		0xb602c312UL, 0x44694011UL, 0x5739b3e5UL, 0xa55230e6UL,
+		0xfb410cc2UL, 0x092a8fc1UL, 0x1a7a7c35UL, 0xe811ff36UL,
+		0x3cdb9bddUL, 0xceb018deUL, 0xdde0eb2aUL, 0x2f8b6829UL,
+		0x82f63b78UL, 0x709db87bUL, 0x63cd4b8fUL, 0x91a6c88cUL,
+		0x456cac67UL, 0xb7072f64UL, 0xa457dc90UL, 0x563c5f93UL,
+		0x082f63b7UL, 0xfa44e0b4UL, 0xe9141340UL, 0x1b7f9043UL,
+		0xcfb5f4a8UL, 0x3dde77abUL, 0x2e8e845fUL, 0xdce5075cUL,
+		0x92a8fc17UL, 0x60c37f14UL, 0x73938ce0UL, 0x81f80fe3UL,
+		0x55326b08UL, 0xa759e80bUL, 0xb4091bffUL, 0x466298fcUL,
+		0x1871a4d8UL, 0xea1a27dbUL, 0xf94ad42fUL, 0x0b21572cUL,
+		0xdfeb33c7UL, 0x2d80b0c4UL, 0x3ed04330UL, 0xccbbc033UL,
+		0xa24bb5a6UL, 0x502036a5UL, 0x4370c551UL, 0xb11b4652UL,
+		0x65d122b9UL, 0x97baa1baUL, 0x84ea524eUL, 0x7681d14dUL,
+		0x2892ed69UL, 0xdaf96e6aUL, 0xc9a99d9eUL, 0x3bc21e9dUL,
+		0xef087a76UL, 0x1d63f975UL, 0x0e330a81UL, 0xfc588982UL,
+		0xb21572c9UL, 0x407ef1caUL, 0x532e023eUL, 0xa145813dUL,
+		0x758fe5d6UL, 0x87e466d5UL, 0x94b49521UL, 0x66df1622UL,
+		0x38cc2a06UL, 0xcaa7a905UL, 0xd9f75af1UL, 0x2b9cd9f2UL,
+		0xff56bd19UL, 0x0d3d3e1aUL, 0x1e6dcdeeUL, 0xec064eedUL,
+		0xc38d26c4UL, 0x31e6a5c7UL, 0x22b65633UL, 0xd0ddd530UL,
+		0x0417b1dbUL, 0xf67c32d8UL, 0xe52cc12cUL, 0x1747422fUL,
+		0x49547e0bUL, 0xbb3ffd08UL, 0xa86f0efcUL, 0x5a048dffUL,
+		0x8ecee914UL, 0x7ca56a17UL, 0x6ff599e3UL, 0x9d9e1ae0UL,
+		0xd3d3e1abUL, 0x21b862a8UL, 0x32e8915cUL, 0xc083125fUL,
+		0x144976b4UL, 0xe622f5b7UL, 0xf5720643UL, 0x07198540UL,
+		0x590ab964UL, 0xab613a67UL, 0xb831c993UL, 0x4a5a4a90UL,
+		0x9e902e7bUL, 0x6cfbad78UL, 0x7fab5e8cUL, 0x8dc0dd8fUL,
+		0xe330a81aUL, 0x115b2b19UL, 0x020bd8edUL, 0xf0605beeUL,
+		0x24aa3f05UL, 0xd6c1bc06UL, 0xc5914ff2UL, 0x37faccf1UL,
+		0x69e9f0d5UL, 0x9b8273d6UL, 0x88d28022UL, 0x7ab90321UL,
+		0xae7367caUL, 0x5c18e4c9UL, 0x4f48173dUL, 0xbd23943eUL,
+		0xf36e6f75UL, 0x0105ec76UL, 0x12551f82UL, 0xe03e9c81UL,
+		0x34f4f86aUL, 0xc69f7b69UL, 0xd5cf889dUL, 0x27a40b9eUL,
+		0x79b737baUL, 0x8bdcb4b9UL, 0x988c474dUL, 0x6ae7c44eUL,
+		0xbe2da0a5UL, 0x4c4623a6UL, 0x5f16d052UL, 0xad7d5351UL
+	},
+	{
+		0x00000000UL, 0x13a29877UL, 0x274530eeUL, 0x34e7a899UL,
+		0x4e8a61dcUL, 0x5d28f9abUL, 0x69cf5132UL, 0x7a6dc945UL,
+		0x9d14c3b8UL, 0x8eb65bcfUL, 0xba51f356UL, 0xa9f36b21UL,
+		0xd39ea264UL, 0xc03c3a13UL, 0xf4db928aUL, 0xe7790afdUL,
+		0x3fc5f181UL, 0x2c6769f6UL, 0x1880c16fUL, 0x0b225918UL,
+		0x714f905dUL, 0x62ed082aUL, 0x560aa0b3UL, 0x45a838c4UL,
+		0xa2d13239UL, 0xb173aa4eUL, 0x859402d7UL, 0x96369aa0UL,
+		0xec5b53e5UL, 0xfff9cb92UL, 0xcb1e630bUL, 0xd8bcfb7cUL,
+		0x7f8be302UL, 0x6c297b75UL, 0x58ced3ecUL, 0x4b6c4b9bUL,
+		0x310182deUL, 0x22a31aa9UL, 0x1644b230UL, 0x05e62a47UL,
+		0xe29f20baUL, 0xf13db8cdUL, 0xc5da1054UL, 0xd6788823UL,
+		0xac154166UL, 0xbfb7d911UL, 0x8b507188UL, 0x98f2e9ffUL,
+		0x404e1283UL, 0x53ec8af4UL, 0x670b226dUL, 0x74a9ba1aUL,
+		0x0ec4735fUL, 0x1d66eb28UL, 0x298143b1UL, 0x3a23dbc6UL,
+		0xdd5ad13bUL, 0xcef8494cUL, 0xfa1fe1d5UL, 0xe9bd79a2UL,
+		0x93d0b0e7UL, 0x80722890UL, 0xb4958009UL, 0xa737187eUL,
+		0xff17c604UL, 0xecb55e73UL, 0xd852f6eaUL, 0xcbf06e9dUL,
+		0xb19da7d8UL, 0xa23f3fafUL, 0x96d89736UL, 0x857a0f41UL,
+		0x620305bcUL, 0x71a19dcbUL, 0x45463552UL, 0x56e4ad25UL,
+		0x2c896460UL, 0x3f2bfc17UL, 0x0bcc548eUL, 0x186eccf9UL,
+		0xc0d23785UL, 0xd370aff2UL, 0xe797076bUL, 0xf4359f1cUL,
+		0x8e585659UL, 0x9dface2eUL, 0xa91d66b7UL, 0xbabffec0UL,
+		0x5dc6f43dUL, 0x4e646c4aUL, 0x7a83c4d3UL, 0x69215ca4UL,
+		0x134c95e1UL, 0x00ee0d96UL, 0x3409a50fUL, 0x27ab3d78UL,
+		0x809c2506UL, 0x933ebd71UL, 0xa7d915e8UL, 0xb47b8d9fUL,
+		0xce1644daUL, 0xddb4dcadUL, 0xe9537434UL, 0xfaf1ec43UL,
+		0x1d88e6beUL, 0x0e2a7ec9UL, 0x3acdd650UL, 0x296f4e27UL,
+		0x53028762UL, 0x40a01f15UL, 0x7447b78cUL, 0x67e52ffbUL,
+		0xbf59d487UL, 0xacfb4cf0UL, 0x981ce469UL, 0x8bbe7c1eUL,
+		0xf1d3b55bUL, 0xe2712d2cUL, 0xd69685b5UL, 0xc5341dc2UL,
+		0x224d173fUL, 0x31ef8f48UL, 0x050827d1UL, 0x16aabfa6UL,
+		0x6cc776e3UL, 0x7f65ee94UL, 0x4b82460dUL, 0x5820de7aUL,
+		0xfbc3faf9UL, 0xe861628eUL, 0xdc86ca17UL, 0xcf245260UL,
+		0xb5499b25UL, 0xa6eb0352UL, 0x920cabcbUL, 0x81ae33bcUL,
+		0x66d73941UL, 0x7575a136UL, 0x419209afUL, 0x523091d8UL,
+		0x285d589dUL, 0x3bffc0eaUL, 0x0f186873UL, 0x1cbaf004UL,
+		0xc4060b78UL, 0xd7a4930fUL, 0xe3433b96UL, 0xf0e1a3e1UL,
+		0x8a8c6aa4UL, 0x992ef2d3UL, 0xadc95a4aUL, 0xbe6bc23dUL,
+		0x5912c8c0UL, 0x4ab050b7UL, 0x7e57f82eUL, 0x6df56059UL,
+		0x1798a91cUL, 0x043a316bUL, 0x30dd99f2UL, 0x237f0185UL,
+		0x844819fbUL, 0x97ea818cUL, 0xa30d2915UL, 0xb0afb162UL,
+		0xcac27827UL, 0xd960e050UL, 0xed8748c9UL, 0xfe25d0beUL,
+		0x195cda43UL, 0x0afe4234UL, 0x3e19eaadUL, 0x2dbb72daUL,
+		0x57d6bb9fUL, 0x447423e8UL, 0x70938b71UL, 0x63311306UL,
+		0xbb8de87aUL, 0xa82f700dUL, 0x9cc8d894UL, 0x8f6a40e3UL,
+		0xf50789a6UL, 0xe6a511d1UL, 0xd242b948UL, 0xc1e0213fUL,
+		0x26992bc2UL, 0x353bb3b5UL, 0x01dc1b2cUL, 0x127e835bUL,
+		0x68134a1eUL, 0x7bb1d269UL, 0x4f567af0UL, 0x5cf4e287UL,
+		0x04d43cfdUL, 0x1776a48aUL, 0x23910c13UL, 0x30339464UL,
+		0x4a5e5d21UL, 0x59fcc556UL, 0x6d1b6dcfUL, 0x7eb9f5b8UL,
+		0x99c0ff45UL, 0x8a626732UL, 0xbe85cfabUL, 0xad2757dcUL,
+		0xd74a9e99UL, 0xc4e806eeUL, 0xf00fae77UL, 0xe3ad3600UL,
+		0x3b11cd7cUL, 0x28b3550bUL, 0x1c54fd92UL, 0x0ff665e5UL,
+		0x759baca0UL, 0x663934d7UL, 0x52de9c4eUL, 0x417c0439UL,
+		0xa6050ec4UL, 0xb5a796b3UL, 0x81403e2aUL, 0x92e2a65dUL,
+		0xe88f6f18UL, 0xfb2df76fUL, 0xcfca5ff6UL, 0xdc68c781UL,
+		0x7b5fdfffUL, 0x68fd4788UL, 0x5c1aef11UL, 0x4fb87766UL,
+		0x35d5be23UL, 0x26772654UL, 0x12908ecdUL, 0x013216baUL,
+		0xe64b1c47UL, 0xf5e98430UL, 0xc10e2ca9UL, 0xd2acb4deUL,
+		0xa8c17d9bUL, 0xbb63e5ecUL, 0x8f844d75UL, 0x9c26d502UL,
+		0x449a2e7eUL, 0x5738b609UL, 0x63df1e90UL, 0x707d86e7UL,
+		0x0a104fa2UL, 0x19b2d7d5UL, 0x2d557f4cUL, 0x3ef7e73bUL,
+		0xd98eedc6UL, 0xca2c75b1UL, 0xfecbdd28UL, 0xed69455fUL,
+		0x97048c1aUL, 0x84a6146dUL, 0xb041bcf4UL, 0xa3e32483UL
+	},
+	{
+		0x00000000UL, 0xa541927eUL, 0x4f6f520dUL, 0xea2ec073UL,
+		0x9edea41aUL, 0x3b9f3664UL, 0xd1b1f617UL, 0x74f06469UL,
+		0x38513ec5UL, 0x9d10acbbUL, 0x773e6cc8UL, 0xd27ffeb6UL,
+		0xa68f9adfUL, 0x03ce08a1UL, 0xe9e0c8d2UL, 0x4ca15aacUL,
+		0x70a27d8aUL, 0xd5e3eff4UL, 0x3fcd2f87UL, 0x9a8cbdf9UL,
+		0xee7cd990UL, 0x4b3d4beeUL, 0xa1138b9dUL, 0x045219e3UL,
+		0x48f3434fUL, 0xedb2d131UL, 0x079c1142UL, 0xa2dd833cUL,
+		0xd62de755UL, 0x736c752bUL, 0x9942b558UL, 0x3c032726UL,
+		0xe144fb14UL, 0x4405696aUL, 0xae2ba919UL, 0x0b6a3b67UL,
+		0x7f9a5f0eUL, 0xdadbcd70UL, 0x30f50d03UL, 0x95b49f7dUL,
+		0xd915c5d1UL, 0x7c5457afUL, 0x967a97dcUL, 0x333b05a2UL,
+		0x47cb61cbUL, 0xe28af3b5UL, 0x08a433c6UL, 0xade5a1b8UL,
+		0x91e6869eUL, 0x34a714e0UL, 0xde89d493UL, 0x7bc846edUL,
+		0x0f382284UL, 0xaa79b0faUL, 0x40577089UL, 0xe516e2f7UL,
+		0xa9b7b85bUL, 0x0cf62a25UL, 0xe6d8ea56UL, 0x43997828UL,
+		0x37691c41UL, 0x92288e3fUL, 0x78064e4cUL, 0xdd47dc32UL,
+		0xc76580d9UL, 0x622412a7UL, 0x880ad2d4UL, 0x2d4b40aaUL,
+		0x59bb24c3UL, 0xfcfab6bdUL, 0x16d476ceUL, 0xb395e4b0UL,
+		0xff34be1cUL, 0x5a752c62UL, 0xb05bec11UL, 0x151a7e6fUL,
+		0x61ea1a06UL, 0xc4ab8878UL, 0x2e85480bUL, 0x8bc4da75UL,
+		0xb7c7fd53UL, 0x12866f2dUL, 0xf8a8af5eUL, 0x5de93d20UL,
+		0x29195949UL, 0x8c58cb37UL, 0x66760b44UL, 0xc337993aUL,
+		0x8f96c396UL, 0x2ad751e8UL, 0xc0f9919bUL, 0x65b803e5UL,
+		0x1148678cUL, 0xb409f5f2UL, 0x5e273581UL, 0xfb66a7ffUL,
+		0x26217bcdUL, 0x8360e9b3UL, 0x694e29c0UL, 0xcc0fbbbeUL,
+		0xb8ffdfd7UL, 0x1dbe4da9UL, 0xf7908ddaUL, 0x52d11fa4UL,
+		0x1e704508UL, 0xbb31d776UL, 0x511f1705UL, 0xf45e857bUL,
+		0x80aee112UL, 0x25ef736cUL, 0xcfc1b31fUL, 0x6a802161UL,
+		0x56830647UL, 0xf3c29439UL, 0x19ec544aUL, 0xbcadc634UL,
+		0xc85da25dUL, 0x6d1c3023UL, 0x8732f050UL, 0x2273622eUL,
+		0x6ed23882UL, 0xcb93aafcUL, 0x21bd6a8fUL, 0x84fcf8f1UL,
+		0xf00c9c98UL, 0x554d0ee6UL, 0xbf63ce95UL, 0x1a225cebUL,
+		0x8b277743UL, 0x2e66e53dUL, 0xc448254eUL, 0x6109b730UL,
+		0x15f9d359UL, 0xb0b84127UL, 0x5a968154UL, 0xffd7132aUL,
+		0xb3764986UL, 0x1637dbf8UL, 0xfc191b8bUL, 0x595889f5UL,
+		0x2da8ed9cUL, 0x88e97fe2UL, 0x62c7bf91UL, 0xc7862defUL,
+		0xfb850ac9UL, 0x5ec498b7UL, 0xb4ea58c4UL, 0x11abcabaUL,
+		0x655baed3UL, 0xc01a3cadUL, 0x2a34fcdeUL, 0x8f756ea0UL,
+		0xc3d4340cUL, 0x6695a672UL, 0x8cbb6601UL, 0x29faf47fUL,
+		0x5d0a9016UL, 0xf84b0268UL, 0x1265c21bUL, 0xb7245065UL,
+		0x6a638c57UL, 0xcf221e29UL, 0x250cde5aUL, 0x804d4c24UL,
+		0xf4bd284dUL, 0x51fcba33UL, 0xbbd27a40UL, 0x1e93e83eUL,
+		0x5232b292UL, 0xf77320ecUL, 0x1d5de09fUL, 0xb81c72e1UL,
+		0xccec1688UL, 0x69ad84f6UL, 0x83834485UL, 0x26c2d6fbUL,
+		0x1ac1f1ddUL, 0xbf8063a3UL, 0x55aea3d0UL, 0xf0ef31aeUL,
+		0x841f55c7UL, 0x215ec7b9UL, 0xcb7007caUL, 0x6e3195b4UL,
+		0x2290cf18UL, 0x87d15d66UL, 0x6dff9d15UL, 0xc8be0f6bUL,
+		0xbc4e6b02UL, 0x190ff97cUL, 0xf321390fUL, 0x5660ab71UL,
+		0x4c42f79aUL, 0xe90365e4UL, 0x032da597UL, 0xa66c37e9UL,
+		0xd29c5380UL, 0x77ddc1feUL, 0x9df3018dUL, 0x38b293f3UL,
+		0x7413c95fUL, 0xd1525b21UL, 0x3b7c9b52UL, 0x9e3d092cUL,
+		0xeacd6d45UL, 0x4f8cff3bUL, 0xa5a23f48UL, 0x00e3ad36UL,
+		0x3ce08a10UL, 0x99a1186eUL, 0x738fd81dUL, 0xd6ce4a63UL,
+		0xa23e2e0aUL, 0x077fbc74UL, 0xed517c07UL, 0x4810ee79UL,
+		0x04b1b4d5UL, 0xa1f026abUL, 0x4bdee6d8UL, 0xee9f74a6UL,
+		0x9a6f10cfUL, 0x3f2e82b1UL, 0xd50042c2UL, 0x7041d0bcUL,
+		0xad060c8eUL, 0x08479ef0UL, 0xe2695e83UL, 0x4728ccfdUL,
+		0x33d8a894UL, 0x96993aeaUL, 0x7cb7fa99UL, 0xd9f668e7UL,
+		0x9557324bUL, 0x3016a035UL, 0xda386046UL, 0x7f79f238UL,
+		0x0b899651UL, 0xaec8042fUL, 0x44e6c45cUL, 0xe1a75622UL,
+		0xdda47104UL, 0x78e5e37aUL, 0x92cb2309UL, 0x378ab177UL,
+		0x437ad51eUL, 0xe63b4760UL, 0x0c158713UL, 0xa954156dUL,
+		0xe5f54fc1UL, 0x40b4ddbfUL, 0xaa9a1dccUL, 0x0fdb8fb2UL,
+		0x7b2bebdbUL, 0xde6a79a5UL, 0x3444b9d6UL, 0x91052ba8UL
+	},
+	{
+		0x00000000UL, 0xdd45aab8UL, 0xbf672381UL, 0x62228939UL,
+		0x7b2231f3UL, 0xa6679b4bUL, 0xc4451272UL, 0x1900b8caUL,
+		0xf64463e6UL, 0x2b01c95eUL, 0x49234067UL, 0x9466eadfUL,
+		0x8d665215UL, 0x5023f8adUL, 0x32017194UL, 0xef44db2cUL,
+		0xe964b13dUL, 0x34211b85UL, 0x560392bcUL, 0x8b463804UL,
+		0x924680ceUL, 0x4f032a76UL, 0x2d21a34fUL, 0xf06409f7UL,
+		0x1f20d2dbUL, 0xc2657863UL, 0xa047f15aUL, 0x7d025be2UL,
+		0x6402e328UL, 0xb9474990UL, 0xdb65c0a9UL, 0x06206a11UL,
+		0xd725148bUL, 0x0a60be33UL, 0x6842370aUL, 0xb5079db2UL,
+		0xac072578UL, 0x71428fc0UL, 0x136006f9UL, 0xce25ac41UL,
+		0x2161776dUL, 0xfc24ddd5UL, 0x9e0654ecUL, 0x4343fe54UL,
+		0x5a43469eUL, 0x8706ec26UL, 0xe524651fUL, 0x3861cfa7UL,
+		0x3e41a5b6UL, 0xe3040f0eUL, 0x81268637UL, 0x5c632c8fUL,
+		0x45639445UL, 0x98263efdUL, 0xfa04b7c4UL, 0x27411d7cUL,
+		0xc805c650UL, 0x15406ce8UL, 0x7762e5d1UL, 0xaa274f69UL,
+		0xb327f7a3UL, 0x6e625d1bUL, 0x0c40d422UL, 0xd1057e9aUL,
+		0xaba65fe7UL, 0x76e3f55fUL, 0x14c17c66UL, 0xc984d6deUL,
+		0xd0846e14UL, 0x0dc1c4acUL, 0x6fe34d95UL, 0xb2a6e72dUL,
+		0x5de23c01UL, 0x80a796b9UL, 0xe2851f80UL, 0x3fc0b538UL,
+		0x26c00df2UL, 0xfb85a74aUL, 0x99a72e73UL, 0x44e284cbUL,
+		0x42c2eedaUL, 0x9f874462UL, 0xfda5cd5bUL, 0x20e067e3UL,
+		0x39e0df29UL, 0xe4a57591UL, 0x8687fca8UL, 0x5bc25610UL,
+		0xb4868d3cUL, 0x69c32784UL, 0x0be1aebdUL, 0xd6a40405UL,
+		0xcfa4bccfUL, 0x12e11677UL, 0x70c39f4eUL, 0xad8635f6UL,
+		0x7c834b6cUL, 0xa1c6e1d4UL, 0xc3e468edUL, 0x1ea1c255UL,
+		0x07a17a9fUL, 0xdae4d027UL, 0xb8c6591eUL, 0x6583f3a6UL,
+		0x8ac7288aUL, 0x57828232UL, 0x35a00b0bUL, 0xe8e5a1b3UL,
+		0xf1e51979UL, 0x2ca0b3c1UL, 0x4e823af8UL, 0x93c79040UL,
+		0x95e7fa51UL, 0x48a250e9UL, 0x2a80d9d0UL, 0xf7c57368UL,
+		0xeec5cba2UL, 0x3380611aUL, 0x51a2e823UL, 0x8ce7429bUL,
+		0x63a399b7UL, 0xbee6330fUL, 0xdcc4ba36UL, 0x0181108eUL,
+		0x1881a844UL, 0xc5c402fcUL, 0xa7e68bc5UL, 0x7aa3217dUL,
+		0x52a0c93fUL, 0x8fe56387UL, 0xedc7eabeUL, 0x30824006UL,
+		0x2982f8ccUL, 0xf4c75274UL, 0x96e5db4dUL, 0x4ba071f5UL,
+		0xa4e4aad9UL, 0x79a10061UL, 0x1b838958UL, 0xc6c623e0UL,
+		0xdfc69b2aUL, 0x02833192UL, 0x60a1b8abUL, 0xbde41213UL,
+		0xbbc47802UL, 0x6681d2baUL, 0x04a35b83UL, 0xd9e6f13bUL,
+		0xc0e649f1UL, 0x1da3e349UL, 0x7f816a70UL, 0xa2c4c0c8UL,
+		0x4d801be4UL, 0x90c5b15cUL, 0xf2e73865UL, 0x2fa292ddUL,
+		0x36a22a17UL, 0xebe780afUL, 0x89c50996UL, 0x5480a32eUL,
+		0x8585ddb4UL, 0x58c0770cUL, 0x3ae2fe35UL, 0xe7a7548dUL,
+		0xfea7ec47UL, 0x23e246ffUL, 0x41c0cfc6UL, 0x9c85657eUL,
+		0x73c1be52UL, 0xae8414eaUL, 0xcca69dd3UL, 0x11e3376bUL,
+		0x08e38fa1UL, 0xd5a62519UL, 0xb784ac20UL, 0x6ac10698UL,
+		0x6ce16c89UL, 0xb1a4c631UL, 0xd3864f08UL, 0x0ec3e5b0UL,
+		0x17c35d7aUL, 0xca86f7c2UL, 0xa8a47efbUL, 0x75e1d443UL,
+		0x9aa50f6fUL, 0x47e0a5d7UL, 0x25c22ceeUL, 0xf8878656UL,
+		0xe1873e9cUL, 0x3cc29424UL, 0x5ee01d1dUL, 0x83a5b7a5UL,
+		0xf90696d8UL, 0x24433c60UL, 0x4661b559UL, 0x9b241fe1UL,
+		0x8224a72bUL, 0x5f610d93UL, 0x3d4384aaUL, 0xe0062e12UL,
+		0x0f42f53eUL, 0xd2075f86UL, 0xb025d6bfUL, 0x6d607c07UL,
+		0x7460c4cdUL, 0xa9256e75UL, 0xcb07e74cUL, 0x16424df4UL,
+		0x106227e5UL, 0xcd278d5dUL, 0xaf050464UL, 0x7240aedcUL,
+		0x6b401616UL, 0xb605bcaeUL, 0xd4273597UL, 0x09629f2fUL,
+		0xe6264403UL, 0x3b63eebbUL, 0x59416782UL, 0x8404cd3aUL,
+		0x9d0475f0UL, 0x4041df48UL, 0x22635671UL, 0xff26fcc9UL,
+		0x2e238253UL, 0xf36628ebUL, 0x9144a1d2UL, 0x4c010b6aUL,
+		0x5501b3a0UL, 0x88441918UL, 0xea669021UL, 0x37233a99UL,
+		0xd867e1b5UL, 0x05224b0dUL, 0x6700c234UL, 0xba45688cUL,
+		0xa345d046UL, 0x7e007afeUL, 0x1c22f3c7UL, 0xc167597fUL,
+		0xc747336eUL, 0x1a0299d6UL, 0x782010efUL, 0xa565ba57UL,
+		0xbc65029dUL, 0x6120a825UL, 0x0302211cUL, 0xde478ba4UL,
+		0x31035088UL, 0xec46fa30UL, 0x8e647309UL, 0x5321d9b1UL,
+		0x4a21617bUL, 0x9764cbc3UL, 0xf54642faUL, 0x2803e842UL
+	},
+	{
+		0x00000000UL, 0x38116facUL, 0x7022df58UL, 0x4833b0f4UL,
+		0xe045beb0UL, 0xd854d11cUL, 0x906761e8UL, 0xa8760e44UL,
+		0xc5670b91UL, 0xfd76643dUL, 0xb545d4c9UL, 0x8d54bb65UL,
+		0x2522b521UL, 0x1d33da8dUL, 0x55006a79UL, 0x6d1105d5UL,
+		0x8f2261d3UL, 0xb7330e7fUL, 0xff00be8bUL, 0xc711d127UL,
+		0x6f67df63UL, 0x5776b0cfUL, 0x1f45003bUL, 0x27546f97UL,
+		0x4a456a42UL, 0x725405eeUL, 0x3a67b51aUL, 0x0276dab6UL,
+		0xaa00d4f2UL, 0x9211bb5eUL, 0xda220baaUL, 0xe2336406UL,
+		0x1ba8b557UL, 0x23b9dafbUL, 0x6b8a6a0fUL, 0x539b05a3UL,
+		0xfbed0be7UL, 0xc3fc644bUL, 0x8bcfd4bfUL, 0xb3debb13UL,
+		0xdecfbec6UL, 0xe6ded16aUL, 0xaeed619eUL, 0x96fc0e32UL,
+		0x3e8a0076UL, 0x069b6fdaUL, 0x4ea8df2eUL, 0x76b9b082UL,
+		0x948ad484UL, 0xac9bbb28UL, 0xe4a80bdcUL, 0xdcb96470UL,
+		0x74cf6a34UL, 0x4cde0598UL, 0x04edb56cUL, 0x3cfcdac0UL,
+		0x51eddf15UL, 0x69fcb0b9UL, 0x21cf004dUL, 0x19de6fe1UL,
+		0xb1a861a5UL, 0x89b90e09UL, 0xc18abefdUL, 0xf99bd151UL,
+		0x37516aaeUL, 0x0f400502UL, 0x4773b5f6UL, 0x7f62da5aUL,
+		0xd714d41eUL, 0xef05bbb2UL, 0xa7360b46UL, 0x9f2764eaUL,
+		0xf236613fUL, 0xca270e93UL, 0x8214be67UL, 0xba05d1cbUL,
+		0x1273df8fUL, 0x2a62b023UL, 0x625100d7UL, 0x5a406f7bUL,
+		0xb8730b7dUL, 0x806264d1UL, 0xc851d425UL, 0xf040bb89UL,
+		0x5836b5cdUL, 0x6027da61UL, 0x28146a95UL, 0x10050539UL,
+		0x7d1400ecUL, 0x45056f40UL, 0x0d36dfb4UL, 0x3527b018UL,
+		0x9d51be5cUL, 0xa540d1f0UL, 0xed736104UL, 0xd5620ea8UL,
+		0x2cf9dff9UL, 0x14e8b055UL, 0x5cdb00a1UL, 0x64ca6f0dUL,
+		0xccbc6149UL, 0xf4ad0ee5UL, 0xbc9ebe11UL, 0x848fd1bdUL,
+		0xe99ed468UL, 0xd18fbbc4UL, 0x99bc0b30UL, 0xa1ad649cUL,
+		0x09db6ad8UL, 0x31ca0574UL, 0x79f9b580UL, 0x41e8da2cUL,
+		0xa3dbbe2aUL, 0x9bcad186UL, 0xd3f96172UL, 0xebe80edeUL,
+		0x439e009aUL, 0x7b8f6f36UL, 0x33bcdfc2UL, 0x0badb06eUL,
+		0x66bcb5bbUL, 0x5eadda17UL, 0x169e6ae3UL, 0x2e8f054fUL,
+		0x86f90b0bUL, 0xbee864a7UL, 0xf6dbd453UL, 0xcecabbffUL,
+		0x6ea2d55cUL, 0x56b3baf0UL, 0x1e800a04UL, 0x269165a8UL,
+		0x8ee76becUL, 0xb6f60440UL, 0xfec5b4b4UL, 0xc6d4db18UL,
+		0xabc5decdUL, 0x93d4b161UL, 0xdbe70195UL, 0xe3f66e39UL,
+		0x4b80607dUL, 0x73910fd1UL, 0x3ba2bf25UL, 0x03b3d089UL,
+		0xe180b48fUL, 0xd991db23UL, 0x91a26bd7UL, 0xa9b3047bUL,
+		0x01c50a3fUL, 0x39d46593UL, 0x71e7d567UL, 0x49f6bacbUL,
+		0x24e7bf1eUL, 0x1cf6d0b2UL, 0x54c56046UL, 0x6cd40feaUL,
+		0xc4a201aeUL, 0xfcb36e02UL, 0xb480def6UL, 0x8c91b15aUL,
+		0x750a600bUL, 0x4d1b0fa7UL, 0x0528bf53UL, 0x3d39d0ffUL,
+		0x954fdebbUL, 0xad5eb117UL, 0xe56d01e3UL, 0xdd7c6e4fUL,
+		0xb06d6b9aUL, 0x887c0436UL, 0xc04fb4c2UL, 0xf85edb6eUL,
+		0x5028d52aUL, 0x6839ba86UL, 0x200a0a72UL, 0x181b65deUL,
+		0xfa2801d8UL, 0xc2396e74UL, 0x8a0ade80UL, 0xb21bb12cUL,
+		0x1a6dbf68UL, 0x227cd0c4UL, 0x6a4f6030UL, 0x525e0f9cUL,
+		0x3f4f0a49UL, 0x075e65e5UL, 0x4f6dd511UL, 0x777cbabdUL,
+		0xdf0ab4f9UL, 0xe71bdb55UL, 0xaf286ba1UL, 0x9739040dUL,
+		0x59f3bff2UL, 0x61e2d05eUL, 0x29d160aaUL, 0x11c00f06UL,
+		0xb9b60142UL, 0x81a76eeeUL, 0xc994de1aUL, 0xf185b1b6UL,
+		0x9c94b463UL, 0xa485dbcfUL, 0xecb66b3bUL, 0xd4a70497UL,
+		0x7cd10ad3UL, 0x44c0657fUL, 0x0cf3d58bUL, 0x34e2ba27UL,
+		0xd6d1de21UL, 0xeec0b18dUL, 0xa6f30179UL, 0x9ee26ed5UL,
+		0x36946091UL, 0x0e850f3dUL, 0x46b6bfc9UL, 0x7ea7d065UL,
+		0x13b6d5b0UL, 0x2ba7ba1cUL, 0x63940ae8UL, 0x5b856544UL,
+		0xf3f36b00UL, 0xcbe204acUL, 0x83d1b458UL, 0xbbc0dbf4UL,
+		0x425b0aa5UL, 0x7a4a6509UL, 0x3279d5fdUL, 0x0a68ba51UL,
+		0xa21eb415UL, 0x9a0fdbb9UL, 0xd23c6b4dUL, 0xea2d04e1UL,
+		0x873c0134UL, 0xbf2d6e98UL, 0xf71ede6cUL, 0xcf0fb1c0UL,
+		0x6779bf84UL, 0x5f68d028UL, 0x175b60dcUL, 0x2f4a0f70UL,
+		0xcd796b76UL, 0xf56804daUL, 0xbd5bb42eUL, 0x854adb82UL,
+		0x2d3cd5c6UL, 0x152dba6aUL, 0x5d1e0a9eUL, 0x650f6532UL,
+		0x081e60e7UL, 0x300f0f4bUL, 0x783cbfbfUL, 0x402dd013UL,
+		0xe85bde57UL, 0xd04ab1fbUL, 0x9879010fUL, 0xa0686ea3UL
+	},
+	{
+		0x00000000UL, 0xef306b19UL, 0xdb8ca0c3UL, 0x34bccbdaUL,
+		0xb2f53777UL, 0x5dc55c6eUL, 0x697997b4UL, 0x8649fcadUL,
+		0x6006181fUL, 0x8f367306UL, 0xbb8ab8dcUL, 0x54bad3c5UL,
+		0xd2f32f68UL, 0x3dc34471UL, 0x097f8fabUL, 0xe64fe4b2UL,
+		0xc00c303eUL, 0x2f3c5b27UL, 0x1b8090fdUL, 0xf4b0fbe4UL,
+		0x72f90749UL, 0x9dc96c50UL, 0xa975a78aUL, 0x4645cc93UL,
+		0xa00a2821UL, 0x4f3a4338UL, 0x7b8688e2UL, 0x94b6e3fbUL,
+		0x12ff1f56UL, 0xfdcf744fUL, 0xc973bf95UL, 0x2643d48cUL,
+		0x85f4168dUL, 0x6ac47d94UL, 0x5e78b64eUL, 0xb148dd57UL,
+		0x370121faUL, 0xd8314ae3UL, 0xec8d8139UL, 0x03bdea20UL,
+		0xe5f20e92UL, 0x0ac2658bUL, 0x3e7eae51UL, 0xd14ec548UL,
+		0x570739e5UL, 0xb83752fcUL, 0x8c8b9926UL, 0x63bbf23fUL,
+		0x45f826b3UL, 0xaac84daaUL, 0x9e748670UL, 0x7144ed69UL,
+		0xf70d11c4UL, 0x183d7addUL, 0x2c81b107UL, 0xc3b1da1eUL,
+		0x25fe3eacUL, 0xcace55b5UL, 0xfe729e6fUL, 0x1142f576UL,
+		0x970b09dbUL, 0x783b62c2UL, 0x4c87a918UL, 0xa3b7c201UL,
+		0x0e045bebUL, 0xe13430f2UL, 0xd588fb28UL, 0x3ab89031UL,
+		0xbcf16c9cUL, 0x53c10785UL, 0x677dcc5fUL, 0x884da746UL,
+		0x6e0243f4UL, 0x813228edUL, 0xb58ee337UL, 0x5abe882eUL,
+		0xdcf77483UL, 0x33c71f9aUL, 0x077bd440UL, 0xe84bbf59UL,
+		0xce086bd5UL, 0x213800ccUL, 0x1584cb16UL, 0xfab4a00fUL,
+		0x7cfd5ca2UL, 0x93cd37bbUL, 0xa771fc61UL, 0x48419778UL,
+		0xae0e73caUL, 0x413e18d3UL, 0x7582d309UL, 0x9ab2b810UL,
+		0x1cfb44bdUL, 0xf3cb2fa4UL, 0xc777e47eUL, 0x28478f67UL,
+		0x8bf04d66UL, 0x64c0267fUL, 0x507ceda5UL, 0xbf4c86bcUL,
+		0x39057a11UL, 0xd6351108UL, 0xe289dad2UL, 0x0db9b1cbUL,
+		0xebf65579UL, 0x04c63e60UL, 0x307af5baUL, 0xdf4a9ea3UL,
+		0x5903620eUL, 0xb6330917UL, 0x828fc2cdUL, 0x6dbfa9d4UL,
+		0x4bfc7d58UL, 0xa4cc1641UL, 0x9070dd9bUL, 0x7f40b682UL,
+		0xf9094a2fUL, 0x16392136UL, 0x2285eaecUL, 0xcdb581f5UL,
+		0x2bfa6547UL, 0xc4ca0e5eUL, 0xf076c584UL, 0x1f46ae9dUL,
+		0x990f5230UL, 0x763f3929UL, 0x4283f2f3UL, 0xadb399eaUL,
+		0x1c08b7d6UL, 0xf338dccfUL, 0xc7841715UL, 0x28b47c0cUL,
+		0xaefd80a1UL, 0x41cdebb8UL, 0x75712062UL, 0x9a414b7bUL,
+		0x7c0eafc9UL, 0x933ec4d0UL, 0xa7820f0aUL, 0x48b26413UL,
+		0xcefb98beUL, 0x21cbf3a7UL, 0x1577387dUL, 0xfa475364UL,
+		0xdc0487e8UL, 0x3334ecf1UL, 0x0788272bUL, 0xe8b84c32UL,
+		0x6ef1b09fUL, 0x81c1db86UL, 0xb57d105cUL, 0x5a4d7b45UL,
+		0xbc029ff7UL, 0x5332f4eeUL, 0x678e3f34UL, 0x88be542dUL,
+		0x0ef7a880UL, 0xe1c7c399UL, 0xd57b0843UL, 0x3a4b635aUL,
+		0x99fca15bUL, 0x76ccca42UL, 0x42700198UL, 0xad406a81UL,
+		0x2b09962cUL, 0xc439fd35UL, 0xf08536efUL, 0x1fb55df6UL,
+		0xf9fab944UL, 0x16cad25dUL, 0x22761987UL, 0xcd46729eUL,
+		0x4b0f8e33UL, 0xa43fe52aUL, 0x90832ef0UL, 0x7fb345e9UL,
+		0x59f09165UL, 0xb6c0fa7cUL, 0x827c31a6UL, 0x6d4c5abfUL,
+		0xeb05a612UL, 0x0435cd0bUL, 0x308906d1UL, 0xdfb96dc8UL,
+		0x39f6897aUL, 0xd6c6e263UL, 0xe27a29b9UL, 0x0d4a42a0UL,
+		0x8b03be0dUL, 0x6433d514UL, 0x508f1eceUL, 0xbfbf75d7UL,
+		0x120cec3dUL, 0xfd3c8724UL, 0xc9804cfeUL, 0x26b027e7UL,
+		0xa0f9db4aUL, 0x4fc9b053UL, 0x7b757b89UL, 0x94451090UL,
+		0x720af422UL, 0x9d3a9f3bUL, 0xa98654e1UL, 0x46b63ff8UL,
+		0xc0ffc355UL, 0x2fcfa84cUL, 0x1b736396UL, 0xf443088fUL,
+		0xd200dc03UL, 0x3d30b71aUL, 0x098c7cc0UL, 0xe6bc17d9UL,
+		0x60f5eb74UL, 0x8fc5806dUL, 0xbb794bb7UL, 0x544920aeUL,
+		0xb206c41cUL, 0x5d36af05UL, 0x698a64dfUL, 0x86ba0fc6UL,
+		0x00f3f36bUL, 0xefc39872UL, 0xdb7f53a8UL, 0x344f38b1UL,
+		0x97f8fab0UL, 0x78c891a9UL, 0x4c745a73UL, 0xa344316aUL,
+		0x250dcdc7UL, 0xca3da6deUL, 0xfe816d04UL, 0x11b1061dUL,
+		0xf7fee2afUL, 0x18ce89b6UL, 0x2c72426cUL, 0xc3422975UL,
+		0x450bd5d8UL, 0xaa3bbec1UL, 0x9e87751bUL, 0x71b71e02UL,
+		0x57f4ca8eUL, 0xb8c4a197UL, 0x8c786a4dUL, 0x63480154UL,
+		0xe501fdf9UL, 0x0a3196e0UL, 0x3e8d5d3aUL, 0xd1bd3623UL,
+		0x37f2d291UL, 0xd8c2b988UL, 0xec7e7252UL, 0x034e194bUL,
+		0x8507e5e6UL, 0x6a378effUL, 0x5e8b4525UL, 0xb1bb2e3cUL
+	},
+	{
+		0x00000000UL, 0x68032cc8UL, 0xd0065990UL, 0xb8057558UL,
+		0xa5e0c5d1UL, 0xcde3e919UL, 0x75e69c41UL, 0x1de5b089UL,
+		0x4e2dfd53UL, 0x262ed19bUL, 0x9e2ba4c3UL, 0xf628880bUL,
+		0xebcd3882UL, 0x83ce144aUL, 0x3bcb6112UL, 0x53c84ddaUL,
+		0x9c5bfaa6UL, 0xf458d66eUL, 0x4c5da336UL, 0x245e8ffeUL,
+		0x39bb3f77UL, 0x51b813bfUL, 0xe9bd66e7UL, 0x81be4a2fUL,
+		0xd27607f5UL, 0xba752b3dUL, 0x02705e65UL, 0x6a7372adUL,
+		0x7796c224UL, 0x1f95eeecUL, 0xa7909bb4UL, 0xcf93b77cUL,
+		0x3d5b83bdUL, 0x5558af75UL, 0xed5dda2dUL, 0x855ef6e5UL,
+		0x98bb466cUL, 0xf0b86aa4UL, 0x48bd1ffcUL, 0x20be3334UL,
+		0x73767eeeUL, 0x1b755226UL, 0xa370277eUL, 0xcb730bb6UL,
+		0xd696bb3fUL, 0xbe9597f7UL, 0x0690e2afUL, 0x6e93ce67UL,
+		0xa100791bUL, 0xc90355d3UL, 0x7106208bUL, 0x19050c43UL,
+		0x04e0bccaUL, 0x6ce39002UL, 0xd4e6e55aUL, 0xbce5c992UL,
+		0xef2d8448UL, 0x872ea880UL, 0x3f2bddd8UL, 0x5728f110UL,
+		0x4acd4199UL, 0x22ce6d51UL, 0x9acb1809UL, 0xf2c834c1UL,
+		0x7ab7077aUL, 0x12b42bb2UL, 0xaab15eeaUL, 0xc2b27222UL,
+		0xdf57c2abUL, 0xb754ee63UL, 0x0f519b3bUL, 0x6752b7f3UL,
+		0x349afa29UL, 0x5c99d6e1UL, 0xe49ca3b9UL, 0x8c9f8f71UL,
+		0x917a3ff8UL, 0xf9791330UL, 0x417c6668UL, 0x297f4aa0UL,
+		0xe6ecfddcUL, 0x8eefd114UL, 0x36eaa44cUL, 0x5ee98884UL,
+		0x430c380dUL, 0x2b0f14c5UL, 0x930a619dUL, 0xfb094d55UL,
+		0xa8c1008fUL, 0xc0c22c47UL, 0x78c7591fUL, 0x10c475d7UL,
+		0x0d21c55eUL, 0x6522e996UL, 0xdd279cceUL, 0xb524b006UL,
+		0x47ec84c7UL, 0x2fefa80fUL, 0x97eadd57UL, 0xffe9f19fUL,
+		0xe20c4116UL, 0x8a0f6ddeUL, 0x320a1886UL, 0x5a09344eUL,
+		0x09c17994UL, 0x61c2555cUL, 0xd9c72004UL, 0xb1c40cccUL,
+		0xac21bc45UL, 0xc422908dUL, 0x7c27e5d5UL, 0x1424c91dUL,
+		0xdbb77e61UL, 0xb3b452a9UL, 0x0bb127f1UL, 0x63b20b39UL,
+		0x7e57bbb0UL, 0x16549778UL, 0xae51e220UL, 0xc652cee8UL,
+		0x959a8332UL, 0xfd99affaUL, 0x459cdaa2UL, 0x2d9ff66aUL,
+		0x307a46e3UL, 0x58796a2bUL, 0xe07c1f73UL, 0x887f33bbUL,
+		0xf56e0ef4UL, 0x9d6d223cUL, 0x25685764UL, 0x4d6b7bacUL,
+		0x508ecb25UL, 0x388de7edUL, 0x808892b5UL, 0xe88bbe7dUL,
+		0xbb43f3a7UL, 0xd340df6fUL, 0x6b45aa37UL, 0x034686ffUL,
+		0x1ea33676UL, 0x76a01abeUL, 0xcea56fe6UL, 0xa6a6432eUL,
+		0x6935f452UL, 0x0136d89aUL, 0xb933adc2UL, 0xd130810aUL,
+		0xccd53183UL, 0xa4d61d4bUL, 0x1cd36813UL, 0x74d044dbUL,
+		0x27180901UL, 0x4f1b25c9UL, 0xf71e5091UL, 0x9f1d7c59UL,
+		0x82f8ccd0UL, 0xeafbe018UL, 0x52fe9540UL, 0x3afdb988UL,
+		0xc8358d49UL, 0xa036a181UL, 0x1833d4d9UL, 0x7030f811UL,
+		0x6dd54898UL, 0x05d66450UL, 0xbdd31108UL, 0xd5d03dc0UL,
+		0x8618701aUL, 0xee1b5cd2UL, 0x561e298aUL, 0x3e1d0542UL,
+		0x23f8b5cbUL, 0x4bfb9903UL, 0xf3feec5bUL, 0x9bfdc093UL,
+		0x546e77efUL, 0x3c6d5b27UL, 0x84682e7fUL, 0xec6b02b7UL,
+		0xf18eb23eUL, 0x998d9ef6UL, 0x2188ebaeUL, 0x498bc766UL,
+		0x1a438abcUL, 0x7240a674UL, 0xca45d32cUL, 0xa246ffe4UL,
+		0xbfa34f6dUL, 0xd7a063a5UL, 0x6fa516fdUL, 0x07a63a35UL,
+		0x8fd9098eUL, 0xe7da2546UL, 0x5fdf501eUL, 0x37dc7cd6UL,
+		0x2a39cc5fUL, 0x423ae097UL, 0xfa3f95cfUL, 0x923cb907UL,
+		0xc1f4f4ddUL, 0xa9f7d815UL, 0x11f2ad4dUL, 0x79f18185UL,
+		0x6414310cUL, 0x0c171dc4UL, 0xb412689cUL, 0xdc114454UL,
+		0x1382f328UL, 0x7b81dfe0UL, 0xc384aab8UL, 0xab878670UL,
+		0xb66236f9UL, 0xde611a31UL, 0x66646f69UL, 0x0e6743a1UL,
+		0x5daf0e7bUL, 0x35ac22b3UL, 0x8da957ebUL, 0xe5aa7b23UL,
+		0xf84fcbaaUL, 0x904ce762UL, 0x2849923aUL, 0x404abef2UL,
+		0xb2828a33UL, 0xda81a6fbUL, 0x6284d3a3UL, 0x0a87ff6bUL,
+		0x17624fe2UL, 0x7f61632aUL, 0xc7641672UL, 0xaf673abaUL,
+		0xfcaf7760UL, 0x94ac5ba8UL, 0x2ca92ef0UL, 0x44aa0238UL,
+		0x594fb2b1UL, 0x314c9e79UL, 0x8949eb21UL, 0xe14ac7e9UL,
+		0x2ed97095UL, 0x46da5c5dUL, 0xfedf2905UL, 0x96dc05cdUL,
+		0x8b39b544UL, 0xe33a998cUL, 0x5b3fecd4UL, 0x333cc01cUL,
+		0x60f48dc6UL, 0x08f7a10eUL, 0xb0f2d456UL, 0xd8f1f89eUL,
+		0xc5144817UL, 0xad1764dfUL, 0x15121187UL, 0x7d113d4fUL
+	},
+	{
+		0x00000000UL, 0x493c7d27UL, 0x9278fa4eUL, 0xdb448769UL,
+		0x211d826dUL, 0x6821ff4aUL, 0xb3657823UL, 0xfa590504UL,
+		0x423b04daUL, 0x0b0779fdUL, 0xd043fe94UL, 0x997f83b3UL,
+		0x632686b7UL, 0x2a1afb90UL, 0xf15e7cf9UL, 0xb86201deUL,
+		0x847609b4UL, 0xcd4a7493UL, 0x160ef3faUL, 0x5f328eddUL,
+		0xa56b8bd9UL, 0xec57f6feUL, 0x37137197UL, 0x7e2f0cb0UL,
+		0xc64d0d6eUL, 0x8f717049UL, 0x5435f720UL, 0x1d098a07UL,
+		0xe7508f03UL, 0xae6cf224UL, 0x7528754dUL, 0x3c14086aUL,
+		0x0d006599UL, 0x443c18beUL, 0x9f789fd7UL, 0xd644e2f0UL,
+		0x2c1de7f4UL, 0x65219ad3UL, 0xbe651dbaUL, 0xf759609dUL,
+		0x4f3b6143UL, 0x06071c64UL, 0xdd439b0dUL, 0x947fe62aUL,
+		0x6e26e32eUL, 0x271a9e09UL, 0xfc5e1960UL, 0xb5626447UL,
+		0x89766c2dUL, 0xc04a110aUL, 0x1b0e9663UL, 0x5232eb44UL,
+		0xa86bee40UL, 0xe1579367UL, 0x3a13140eUL, 0x732f6929UL,
+		0xcb4d68f7UL, 0x827115d0UL, 0x593592b9UL, 0x1009ef9eUL,
+		0xea50ea9aUL, 0xa36c97bdUL, 0x782810d4UL, 0x31146df3UL,
+		0x1a00cb32UL, 0x533cb615UL, 0x8878317cUL, 0xc1444c5bUL,
+		0x3b1d495fUL, 0x72213478UL, 0xa965b311UL, 0xe059ce36UL,
+		0x583bcfe8UL, 0x1107b2cfUL, 0xca4335a6UL, 0x837f4881UL,
+		0x79264d85UL, 0x301a30a2UL, 0xeb5eb7cbUL, 0xa262caecUL,
+		0x9e76c286UL, 0xd74abfa1UL, 0x0c0e38c8UL, 0x453245efUL,
+		0xbf6b40ebUL, 0xf6573dccUL, 0x2d13baa5UL, 0x642fc782UL,
+		0xdc4dc65cUL, 0x9571bb7bUL, 0x4e353c12UL, 0x07094135UL,
+		0xfd504431UL, 0xb46c3916UL, 0x6f28be7fUL, 0x2614c358UL,
+		0x1700aeabUL, 0x5e3cd38cUL, 0x857854e5UL, 0xcc4429c2UL,
+		0x361d2cc6UL, 0x7f2151e1UL, 0xa465d688UL, 0xed59abafUL,
+		0x553baa71UL, 0x1c07d756UL, 0xc743503fUL, 0x8e7f2d18UL,
+		0x7426281cUL, 0x3d1a553bUL, 0xe65ed252UL, 0xaf62af75UL,
+		0x9376a71fUL, 0xda4ada38UL, 0x010e5d51UL, 0x48322076UL,
+		0xb26b2572UL, 0xfb575855UL, 0x2013df3cUL, 0x692fa21bUL,
+		0xd14da3c5UL, 0x9871dee2UL, 0x4335598bUL, 0x0a0924acUL,
+		0xf05021a8UL, 0xb96c5c8fUL, 0x6228dbe6UL, 0x2b14a6c1UL,
+		0x34019664UL, 0x7d3deb43UL, 0xa6796c2aUL, 0xef45110dUL,
+		0x151c1409UL, 0x5c20692eUL, 0x8764ee47UL, 0xce589360UL,
+		0x763a92beUL, 0x3f06ef99UL, 0xe44268f0UL, 0xad7e15d7UL,
+		0x572710d3UL, 0x1e1b6df4UL, 0xc55fea9dUL, 0x8c6397baUL,
+		0xb0779fd0UL, 0xf94be2f7UL, 0x220f659eUL, 0x6b3318b9UL,
+		0x916a1dbdUL, 0xd856609aUL, 0x0312e7f3UL, 0x4a2e9ad4UL,
+		0xf24c9b0aUL, 0xbb70e62dUL, 0x60346144UL, 0x29081c63UL,
+		0xd3511967UL, 0x9a6d6440UL, 0x4129e329UL, 0x08159e0eUL,
+		0x3901f3fdUL, 0x703d8edaUL, 0xab7909b3UL, 0xe2457494UL,
+		0x181c7190UL, 0x51200cb7UL, 0x8a648bdeUL, 0xc358f6f9UL,
+		0x7b3af727UL, 0x32068a00UL, 0xe9420d69UL, 0xa07e704eUL,
+		0x5a27754aUL, 0x131b086dUL, 0xc85f8f04UL, 0x8163f223UL,
+		0xbd77fa49UL, 0xf44b876eUL, 0x2f0f0007UL, 0x66337d20UL,
+		0x9c6a7824UL, 0xd5560503UL, 0x0e12826aUL, 0x472eff4dUL,
+		0xff4cfe93UL, 0xb67083b4UL, 0x6d3404ddUL, 0x240879faUL,
+		0xde517cfeUL, 0x976d01d9UL, 0x4c2986b0UL, 0x0515fb97UL,
+		0x2e015d56UL, 0x673d2071UL, 0xbc79a718UL, 0xf545da3fUL,
+		0x0f1cdf3bUL, 0x4620a21cUL, 0x9d642575UL, 0xd4585852UL,
+		0x6c3a598cUL, 0x250624abUL, 0xfe42a3c2UL, 0xb77edee5UL,
+		0x4d27dbe1UL, 0x041ba6c6UL, 0xdf5f21afUL, 0x96635c88UL,
+		0xaa7754e2UL, 0xe34b29c5UL, 0x380faeacUL, 0x7133d38bUL,
+		0x8b6ad68fUL, 0xc256aba8UL, 0x19122cc1UL, 0x502e51e6UL,
+		0xe84c5038UL, 0xa1702d1fUL, 0x7a34aa76UL, 0x3308d751UL,
+		0xc951d255UL, 0x806daf72UL, 0x5b29281bUL, 0x1215553cUL,
+		0x230138cfUL, 0x6a3d45e8UL, 0xb179c281UL, 0xf845bfa6UL,
+		0x021cbaa2UL, 0x4b20c785UL, 0x906440ecUL, 0xd9583dcbUL,
+		0x613a3c15UL, 0x28064132UL, 0xf342c65bUL, 0xba7ebb7cUL,
+		0x4027be78UL, 0x091bc35fUL, 0xd25f4436UL, 0x9b633911UL,
+		0xa777317bUL, 0xee4b4c5cUL, 0x350fcb35UL, 0x7c33b612UL,
+		0x866ab316UL, 0xcf56ce31UL, 0x14124958UL, 0x5d2e347fUL,
+		0xe54c35a1UL, 0xac704886UL, 0x7734cfefUL, 0x3e08b2c8UL,
+		0xc451b7ccUL, 0x8d6dcaebUL, 0x56294d82UL, 0x1f1530a5UL
+	},
+	{
+		0x00000000UL, 0xf43ed648UL, 0xed91da61UL, 0x19af0c29UL,
+		0xdecfc233UL, 0x2af1147bUL, 0x335e1852UL, 0xc760ce1aUL,
+		0xb873f297UL, 0x4c4d24dfUL, 0x55e228f6UL, 0xa1dcfebeUL,
+		0x66bc30a4UL, 0x9282e6ecUL, 0x8b2deac5UL, 0x7f133c8dUL,
+		0x750b93dfUL, 0x81354597UL, 0x989a49beUL, 0x6ca49ff6UL,
+		0xabc451ecUL, 0x5ffa87a4UL, 0x46558b8dUL, 0xb26b5dc5UL,
+		0xcd786148UL, 0x3946b700UL, 0x20e9bb29UL, 0xd4d76d61UL,
+		0x13b7a37bUL, 0xe7897533UL, 0xfe26791aUL, 0x0a18af52UL,
+		0xea1727beUL, 0x1e29f1f6UL, 0x0786fddfUL, 0xf3b82b97UL,
+		0x34d8e58dUL, 0xc0e633c5UL, 0xd9493fecUL, 0x2d77e9a4UL,
+		0x5264d529UL, 0xa65a0361UL, 0xbff50f48UL, 0x4bcbd900UL,
+		0x8cab171aUL, 0x7895c152UL, 0x613acd7bUL, 0x95041b33UL,
+		0x9f1cb461UL, 0x6b226229UL, 0x728d6e00UL, 0x86b3b848UL,
+		0x41d37652UL, 0xb5eda01aUL, 0xac42ac33UL, 0x587c7a7bUL,
+		0x276f46f6UL, 0xd35190beUL, 0xcafe9c97UL, 0x3ec04adfUL,
+		0xf9a084c5UL, 0x0d9e528dUL, 0x14315ea4UL, 0xe00f88ecUL,
+		0xd1c2398dUL, 0x25fcefc5UL, 0x3c53e3ecUL, 0xc86d35a4UL,
+		0x0f0dfbbeUL, 0xfb332df6UL, 0xe29c21dfUL, 0x16a2f797UL,
+		0x69b1cb1aUL, 0x9d8f1d52UL, 0x8420117bUL, 0x701ec733UL,
+		0xb77e0929UL, 0x4340df61UL, 0x5aefd348UL, 0xaed10500UL,
+		0xa4c9aa52UL, 0x50f77c1aUL, 0x49587033UL, 0xbd66a67bUL,
+		0x7a066861UL, 0x8e38be29UL, 0x9797b200UL, 0x63a96448UL,
+		0x1cba58c5UL, 0xe8848e8dUL, 0xf12b82a4UL, 0x051554ecUL,
+		0xc2759af6UL, 0x364b4cbeUL, 0x2fe44097UL, 0xdbda96dfUL,
+		0x3bd51e33UL, 0xcfebc87bUL, 0xd644c452UL, 0x227a121aUL,
+		0xe51adc00UL, 0x11240a48UL, 0x088b0661UL, 0xfcb5d029UL,
+		0x83a6eca4UL, 0x77983aecUL, 0x6e3736c5UL, 0x9a09e08dUL,
+		0x5d692e97UL, 0xa957f8dfUL, 0xb0f8f4f6UL, 0x44c622beUL,
+		0x4ede8decUL, 0xbae05ba4UL, 0xa34f578dUL, 0x577181c5UL,
+		0x90114fdfUL, 0x642f9997UL, 0x7d8095beUL, 0x89be43f6UL,
+		0xf6ad7f7bUL, 0x0293a933UL, 0x1b3ca51aUL, 0xef027352UL,
+		0x2862bd48UL, 0xdc5c6b00UL, 0xc5f36729UL, 0x31cdb161UL,
+		0xa66805ebUL, 0x5256d3a3UL, 0x4bf9df8aUL, 0xbfc709c2UL,
+		0x78a7c7d8UL, 0x8c991190UL, 0x95361db9UL, 0x6108cbf1UL,
+		0x1e1bf77cUL, 0xea252134UL, 0xf38a2d1dUL, 0x07b4fb55UL,
+		0xc0d4354fUL, 0x34eae307UL, 0x2d45ef2eUL, 0xd97b3966UL,
+		0xd3639634UL, 0x275d407cUL, 0x3ef24c55UL, 0xcacc9a1dUL,
+		0x0dac5407UL, 0xf992824fUL, 0xe03d8e66UL, 0x1403582eUL,
+		0x6b1064a3UL, 0x9f2eb2ebUL, 0x8681bec2UL, 0x72bf688aUL,
+		0xb5dfa690UL, 0x41e170d8UL, 0x584e7cf1UL, 0xac70aab9UL,
+		0x4c7f2255UL, 0xb841f41dUL, 0xa1eef834UL, 0x55d02e7cUL,
+		0x92b0e066UL, 0x668e362eUL, 0x7f213a07UL, 0x8b1fec4fUL,
+		0xf40cd0c2UL, 0x0032068aUL, 0x199d0aa3UL, 0xeda3dcebUL,
+		0x2ac312f1UL, 0xdefdc4b9UL, 0xc752c890UL, 0x336c1ed8UL,
+		0x3974b18aUL, 0xcd4a67c2UL, 0xd4e56bebUL, 0x20dbbda3UL,
+		0xe7bb73b9UL, 0x1385a5f1UL, 0x0a2aa9d8UL, 0xfe147f90UL,
+		0x8107431dUL, 0x75399555UL, 0x6c96997cUL, 0x98a84f34UL,
+		0x5fc8812eUL, 0xabf65766UL, 0xb2595b4fUL, 0x46678d07UL,
+		0x77aa3c66UL, 0x8394ea2eUL, 0x9a3be607UL, 0x6e05304fUL,
+		0xa965fe55UL, 0x5d5b281dUL, 0x44f42434UL, 0xb0caf27cUL,
+		0xcfd9cef1UL, 0x3be718b9UL, 0x22481490UL, 0xd676c2d8UL,
+		0x11160cc2UL, 0xe528da8aUL, 0xfc87d6a3UL, 0x08b900ebUL,
+		0x02a1afb9UL, 0xf69f79f1UL, 0xef3075d8UL, 0x1b0ea390UL,
+		0xdc6e6d8aUL, 0x2850bbc2UL, 0x31ffb7ebUL, 0xc5c161a3UL,
+		0xbad25d2eUL, 0x4eec8b66UL, 0x5743874fUL, 0xa37d5107UL,
+		0x641d9f1dUL, 0x90234955UL, 0x898c457cUL, 0x7db29334UL,
+		0x9dbd1bd8UL, 0x6983cd90UL, 0x702cc1b9UL, 0x841217f1UL,
+		0x4372d9ebUL, 0xb74c0fa3UL, 0xaee3038aUL, 0x5addd5c2UL,
+		0x25cee94fUL, 0xd1f03f07UL, 0xc85f332eUL, 0x3c61e566UL,
+		0xfb012b7cUL, 0x0f3ffd34UL, 0x1690f11dUL, 0xe2ae2755UL,
+		0xe8b68807UL, 0x1c885e4fUL, 0x05275266UL, 0xf119842eUL,
+		0x36794a34UL, 0xc2479c7cUL, 0xdbe89055UL, 0x2fd6461dUL,
+		0x50c57a90UL, 0xa4fbacd8UL, 0xbd54a0f1UL, 0x496a76b9UL,
+		0x8e0ab8a3UL, 0x7a346eebUL, 0x639b62c2UL, 0x97a5b48aUL
+	},
+	{
+		0x00000000UL, 0xcb567ba5UL, 0x934081bbUL, 0x5816fa1eUL,
+		0x236d7587UL, 0xe83b0e22UL, 0xb02df43cUL, 0x7b7b8f99UL,
+		0x46daeb0eUL, 0x8d8c90abUL, 0xd59a6ab5UL, 0x1ecc1110UL,
+		0x65b79e89UL, 0xaee1e52cUL, 0xf6f71f32UL, 0x3da16497UL,
+		0x8db5d61cUL, 0x46e3adb9UL, 0x1ef557a7UL, 0xd5a32c02UL,
+		0xaed8a39bUL, 0x658ed83eUL, 0x3d982220UL, 0xf6ce5985UL,
+		0xcb6f3d12UL, 0x003946b7UL, 0x582fbca9UL, 0x9379c70cUL,
+		0xe8024895UL, 0x23543330UL, 0x7b42c92eUL, 0xb014b28bUL,
+		0x1e87dac9UL, 0xd5d1a16cUL, 0x8dc75b72UL, 0x469120d7UL,
+		0x3deaaf4eUL, 0xf6bcd4ebUL, 0xaeaa2ef5UL, 0x65fc5550UL,
+		0x585d31c7UL, 0x930b4a62UL, 0xcb1db07cUL, 0x004bcbd9UL,
+		0x7b304440UL, 0xb0663fe5UL, 0xe870c5fbUL, 0x2326be5eUL,
+		0x93320cd5UL, 0x58647770UL, 0x00728d6eUL, 0xcb24f6cbUL,
+		0xb05f7952UL, 0x7b0902f7UL, 0x231ff8e9UL, 0xe849834cUL,
+		0xd5e8e7dbUL, 0x1ebe9c7eUL, 0x46a86660UL, 0x8dfe1dc5UL,
+		0xf685925cUL, 0x3dd3e9f9UL, 0x65c513e7UL, 0xae936842UL,
+		0x3d0fb592UL, 0xf659ce37UL, 0xae4f3429UL, 0x65194f8cUL,
+		0x1e62c015UL, 0xd534bbb0UL, 0x8d2241aeUL, 0x46743a0bUL,
+		0x7bd55e9cUL, 0xb0832539UL, 0xe895df27UL, 0x23c3a482UL,
+		0x58b82b1bUL, 0x93ee50beUL, 0xcbf8aaa0UL, 0x00aed105UL,
+		0xb0ba638eUL, 0x7bec182bUL, 0x23fae235UL, 0xe8ac9990UL,
+		0x93d71609UL, 0x58816dacUL, 0x009797b2UL, 0xcbc1ec17UL,
+		0xf6608880UL, 0x3d36f325UL, 0x6520093bUL, 0xae76729eUL,
+		0xd50dfd07UL, 0x1e5b86a2UL, 0x464d7cbcUL, 0x8d1b0719UL,
+		0x23886f5bUL, 0xe8de14feUL, 0xb0c8eee0UL, 0x7b9e9545UL,
+		0x00e51adcUL, 0xcbb36179UL, 0x93a59b67UL, 0x58f3e0c2UL,
+		0x65528455UL, 0xae04fff0UL, 0xf61205eeUL, 0x3d447e4bUL,
+		0x463ff1d2UL, 0x8d698a77UL, 0xd57f7069UL, 0x1e290bccUL,
+		0xae3db947UL, 0x656bc2e2UL, 0x3d7d38fcUL, 0xf62b4359UL,
+		0x8d50ccc0UL, 0x4606b765UL, 0x1e104d7bUL, 0xd54636deUL,
+		0xe8e75249UL, 0x23b129ecUL, 0x7ba7d3f2UL, 0xb0f1a857UL,
+		0xcb8a27ceUL, 0x00dc5c6bUL, 0x58caa675UL, 0x939cddd0UL,
+		0x7a1f6b24UL, 0xb1491081UL, 0xe95fea9fUL, 0x2209913aUL,
+		0x59721ea3UL, 0x92246506UL, 0xca329f18UL, 0x0164e4bdUL,
+		0x3cc5802aUL, 0xf793fb8fUL, 0xaf850191UL, 0x64d37a34UL,
+		0x1fa8f5adUL, 0xd4fe8e08UL, 0x8ce87416UL, 0x47be0fb3UL,
+		0xf7aabd38UL, 0x3cfcc69dUL, 0x64ea3c83UL, 0xafbc4726UL,
+		0xd4c7c8bfUL, 0x1f91b31aUL, 0x47874904UL, 0x8cd132a1UL,
+		0xb1705636UL, 0x7a262d93UL, 0x2230d78dUL, 0xe966ac28UL,
+		0x921d23b1UL, 0x594b5814UL, 0x015da20aUL, 0xca0bd9afUL,
+		0x6498b1edUL, 0xafceca48UL, 0xf7d83056UL, 0x3c8e4bf3UL,
+		0x47f5c46aUL, 0x8ca3bfcfUL, 0xd4b545d1UL, 0x1fe33e74UL,
+		0x22425ae3UL, 0xe9142146UL, 0xb102db58UL, 0x7a54a0fdUL,
+		0x012f2f64UL, 0xca7954c1UL, 0x926faedfUL, 0x5939d57aUL,
+		0xe92d67f1UL, 0x227b1c54UL, 0x7a6de64aUL, 0xb13b9defUL,
+		0xca401276UL, 0x011669d3UL, 0x590093cdUL, 0x9256e868UL,
+		0xaff78cffUL, 0x64a1f75aUL, 0x3cb70d44UL, 0xf7e176e1UL,
+		0x8c9af978UL, 0x47cc82ddUL, 0x1fda78c3UL, 0xd48c0366UL,
+		0x4710deb6UL, 0x8c46a513UL, 0xd4505f0dUL, 0x1f0624a8UL,
+		0x647dab31UL, 0xaf2bd094UL, 0xf73d2a8aUL, 0x3c6b512fUL,
+		0x01ca35b8UL, 0xca9c4e1dUL, 0x928ab403UL, 0x59dccfa6UL,
+		0x22a7403fUL, 0xe9f13b9aUL, 0xb1e7c184UL, 0x7ab1ba21UL,
+		0xcaa508aaUL, 0x01f3730fUL, 0x59e58911UL, 0x92b3f2b4UL,
+		0xe9c87d2dUL, 0x229e0688UL, 0x7a88fc96UL, 0xb1de8733UL,
+		0x8c7fe3a4UL, 0x47299801UL, 0x1f3f621fUL, 0xd46919baUL,
+		0xaf129623UL, 0x6444ed86UL, 0x3c521798UL, 0xf7046c3dUL,
+		0x5997047fUL, 0x92c17fdaUL, 0xcad785c4UL, 0x0181fe61UL,
+		0x7afa71f8UL, 0xb1ac0a5dUL, 0xe9baf043UL, 0x22ec8be6UL,
+		0x1f4def71UL, 0xd41b94d4UL, 0x8c0d6ecaUL, 0x475b156fUL,
+		0x3c209af6UL, 0xf776e153UL, 0xaf601b4dUL, 0x643660e8UL,
+		0xd422d263UL, 0x1f74a9c6UL, 0x476253d8UL, 0x8c34287dUL,
+		0xf74fa7e4UL, 0x3c19dc41UL, 0x640f265fUL, 0xaf595dfaUL,
+		0x92f8396dUL, 0x59ae42c8UL, 0x01b8b8d6UL, 0xcaeec373UL,
+		0xb1954ceaUL, 0x7ac3374fUL, 0x22d5cd51UL, 0xe983b6f4UL
+	},
+	{
+		0x00000000UL, 0x9771f7c1UL, 0x2b0f9973UL, 0xbc7e6eb2UL,
+		0x561f32e6UL, 0xc16ec527UL, 0x7d10ab95UL, 0xea615c54UL,
+		0xac3e65ccUL, 0x3b4f920dUL, 0x8731fcbfUL, 0x10400b7eUL,
+		0xfa21572aUL, 0x6d50a0ebUL, 0xd12ece59UL, 0x465f3998UL,
+		0x5d90bd69UL, 0xcae14aa8UL, 0x769f241aUL, 0xe1eed3dbUL,
+		0x0b8f8f8fUL, 0x9cfe784eUL, 0x208016fcUL, 0xb7f1e13dUL,
+		0xf1aed8a5UL, 0x66df2f64UL, 0xdaa141d6UL, 0x4dd0b617UL,
+		0xa7b1ea43UL, 0x30c01d82UL, 0x8cbe7330UL, 0x1bcf84f1UL,
+		0xbb217ad2UL, 0x2c508d13UL, 0x902ee3a1UL, 0x075f1460UL,
+		0xed3e4834UL, 0x7a4fbff5UL, 0xc631d147UL, 0x51402686UL,
+		0x171f1f1eUL, 0x806ee8dfUL, 0x3c10866dUL, 0xab6171acUL,
+		0x41002df8UL, 0xd671da39UL, 0x6a0fb48bUL, 0xfd7e434aUL,
+		0xe6b1c7bbUL, 0x71c0307aUL, 0xcdbe5ec8UL, 0x5acfa909UL,
+		0xb0aef55dUL, 0x27df029cUL, 0x9ba16c2eUL, 0x0cd09befUL,
+		0x4a8fa277UL, 0xddfe55b6UL, 0x61803b04UL, 0xf6f1ccc5UL,
+		0x1c909091UL, 0x8be16750UL, 0x379f09e2UL, 0xa0eefe23UL,
+		0x73ae8355UL, 0xe4df7494UL, 0x58a11a26UL, 0xcfd0ede7UL,
+		0x25b1b1b3UL, 0xb2c04672UL, 0x0ebe28c0UL, 0x99cfdf01UL,
+		0xdf90e699UL, 0x48e11158UL, 0xf49f7feaUL, 0x63ee882bUL,
+		0x898fd47fUL, 0x1efe23beUL, 0xa2804d0cUL, 0x35f1bacdUL,
+		0x2e3e3e3cUL, 0xb94fc9fdUL, 0x0531a74fUL, 0x9240508eUL,
+		0x78210cdaUL, 0xef50fb1bUL, 0x532e95a9UL, 0xc45f6268UL,
+		0x82005bf0UL, 0x1571ac31UL, 0xa90fc283UL, 0x3e7e3542UL,
+		0xd41f6916UL, 0x436e9ed7UL, 0xff10f065UL, 0x686107a4UL,
+		0xc88ff987UL, 0x5ffe0e46UL, 0xe38060f4UL, 0x74f19735UL,
+		0x9e90cb61UL, 0x09e13ca0UL, 0xb59f5212UL, 0x22eea5d3UL,
+		0x64b19c4bUL, 0xf3c06b8aUL, 0x4fbe0538UL, 0xd8cff2f9UL,
+		0x32aeaeadUL, 0xa5df596cUL, 0x19a137deUL, 0x8ed0c01fUL,
+		0x951f44eeUL, 0x026eb32fUL, 0xbe10dd9dUL, 0x29612a5cUL,
+		0xc3007608UL, 0x547181c9UL, 0xe80fef7bUL, 0x7f7e18baUL,
+		0x39212122UL, 0xae50d6e3UL, 0x122eb851UL, 0x855f4f90UL,
+		0x6f3e13c4UL, 0xf84fe405UL, 0x44318ab7UL, 0xd3407d76UL,
+		0xe75d06aaUL, 0x702cf16bUL, 0xcc529fd9UL, 0x5b236818UL,
+		0xb142344cUL, 0x2633c38dUL, 0x9a4dad3fUL, 0x0d3c5afeUL,
+		0x4b636366UL, 0xdc1294a7UL, 0x606cfa15UL, 0xf71d0dd4UL,
+		0x1d7c5180UL, 0x8a0da641UL, 0x3673c8f3UL, 0xa1023f32UL,
+		0xbacdbbc3UL, 0x2dbc4c02UL, 0x91c222b0UL, 0x06b3d571UL,
+		0xecd28925UL, 0x7ba37ee4UL, 0xc7dd1056UL, 0x50ace797UL,
+		0x16f3de0fUL, 0x818229ceUL, 0x3dfc477cUL, 0xaa8db0bdUL,
+		0x40ecece9UL, 0xd79d1b28UL, 0x6be3759aUL, 0xfc92825bUL,
+		0x5c7c7c78UL, 0xcb0d8bb9UL, 0x7773e50bUL, 0xe00212caUL,
+		0x0a634e9eUL, 0x9d12b95fUL, 0x216cd7edUL, 0xb61d202cUL,
+		0xf04219b4UL, 0x6733ee75UL, 0xdb4d80c7UL, 0x4c3c7706UL,
+		0xa65d2b52UL, 0x312cdc93UL, 0x8d52b221UL, 0x1a2345e0UL,
+		0x01ecc111UL, 0x969d36d0UL, 0x2ae35862UL, 0xbd92afa3UL,
+		0x57f3f3f7UL, 0xc0820436UL, 0x7cfc6a84UL, 0xeb8d9d45UL,
+		0xadd2a4ddUL, 0x3aa3531cUL, 0x86dd3daeUL, 0x11acca6fUL,
+		0xfbcd963bUL, 0x6cbc61faUL, 0xd0c20f48UL, 0x47b3f889UL,
+		0x94f385ffUL, 0x0382723eUL, 0xbffc1c8cUL, 0x288deb4dUL,
+		0xc2ecb719UL, 0x559d40d8UL, 0xe9e32e6aUL, 0x7e92d9abUL,
+		0x38cde033UL, 0xafbc17f2UL, 0x13c27940UL, 0x84b38e81UL,
+		0x6ed2d2d5UL, 0xf9a32514UL, 0x45dd4ba6UL, 0xd2acbc67UL,
+		0xc9633896UL, 0x5e12cf57UL, 0xe26ca1e5UL, 0x751d5624UL,
+		0x9f7c0a70UL, 0x080dfdb1UL, 0xb4739303UL, 0x230264c2UL,
+		0x655d5d5aUL, 0xf22caa9bUL, 0x4e52c429UL, 0xd92333e8UL,
+		0x33426fbcUL, 0xa433987dUL, 0x184df6cfUL, 0x8f3c010eUL,
+		0x2fd2ff2dUL, 0xb8a308ecUL, 0x04dd665eUL, 0x93ac919fUL,
+		0x79cdcdcbUL, 0xeebc3a0aUL, 0x52c254b8UL, 0xc5b3a379UL,
+		0x83ec9ae1UL, 0x149d6d20UL, 0xa8e30392UL, 0x3f92f453UL,
+		0xd5f3a807UL, 0x42825fc6UL, 0xfefc3174UL, 0x698dc6b5UL,
+		0x72424244UL, 0xe533b585UL, 0x594ddb37UL, 0xce3c2cf6UL,
+		0x245d70a2UL, 0xb32c8763UL, 0x0f52e9d1UL, 0x98231e10UL,
+		0xde7c2788UL, 0x490dd049UL, 0xf573befbUL, 0x6202493aUL,
+		0x8863156eUL, 0x1f12e2afUL, 0xa36c8c1dUL, 0x341d7bdcUL
+	},
+	{
+		0x00000000UL, 0x3171d430UL, 0x62e3a860UL, 0x53927c50UL,
+		0xc5c750c0UL, 0xf4b684f0UL, 0xa724f8a0UL, 0x96552c90UL,
+		0x8e62d771UL, 0xbf130341UL, 0xec817f11UL, 0xddf0ab21UL,
+		0x4ba587b1UL, 0x7ad45381UL, 0x29462fd1UL, 0x1837fbe1UL,
+		0x1929d813UL, 0x28580c23UL, 0x7bca7073UL, 0x4abba443UL,
+		0xdcee88d3UL, 0xed9f5ce3UL, 0xbe0d20b3UL, 0x8f7cf483UL,
+		0x974b0f62UL, 0xa63adb52UL, 0xf5a8a702UL, 0xc4d97332UL,
+		0x528c5fa2UL, 0x63fd8b92UL, 0x306ff7c2UL, 0x011e23f2UL,
+		0x3253b026UL, 0x03226416UL, 0x50b01846UL, 0x61c1cc76UL,
+		0xf794e0e6UL, 0xc6e534d6UL, 0x95774886UL, 0xa4069cb6UL,
+		0xbc316757UL, 0x8d40b367UL, 0xded2cf37UL, 0xefa31b07UL,
+		0x79f63797UL, 0x4887e3a7UL, 0x1b159ff7UL, 0x2a644bc7UL,
+		0x2b7a6835UL, 0x1a0bbc05UL, 0x4999c055UL, 0x78e81465UL,
+		0xeebd38f5UL, 0xdfccecc5UL, 0x8c5e9095UL, 0xbd2f44a5UL,
+		0xa518bf44UL, 0x94696b74UL, 0xc7fb1724UL, 0xf68ac314UL,
+		0x60dfef84UL, 0x51ae3bb4UL, 0x023c47e4UL, 0x334d93d4UL,
+		0x64a7604cUL, 0x55d6b47cUL, 0x0644c82cUL, 0x37351c1cUL,
+		0xa160308cUL, 0x9011e4bcUL, 0xc38398ecUL, 0xf2f24cdcUL,
+		0xeac5b73dUL, 0xdbb4630dUL, 0x88261f5dUL, 0xb957cb6dUL,
+		0x2f02e7fdUL, 0x1e7333cdUL, 0x4de14f9dUL, 0x7c909badUL,
+		0x7d8eb85fUL, 0x4cff6c6fUL, 0x1f6d103fUL, 0x2e1cc40fUL,
+		0xb849e89fUL, 0x89383cafUL, 0xdaaa40ffUL, 0xebdb94cfUL,
+		0xf3ec6f2eUL, 0xc29dbb1eUL, 0x910fc74eUL, 0xa07e137eUL,
+		0x362b3feeUL, 0x075aebdeUL, 0x54c8978eUL, 0x65b943beUL,
+		0x56f4d06aUL, 0x6785045aUL, 0x3417780aUL, 0x0566ac3aUL,
+		0x933380aaUL, 0xa242549aUL, 0xf1d028caUL, 0xc0a1fcfaUL,
+		0xd896071bUL, 0xe9e7d32bUL, 0xba75af7bUL, 0x8b047b4bUL,
+		0x1d5157dbUL, 0x2c2083ebUL, 0x7fb2ffbbUL, 0x4ec32b8bUL,
+		0x4fdd0879UL, 0x7eacdc49UL, 0x2d3ea019UL, 0x1c4f7429UL,
+		0x8a1a58b9UL, 0xbb6b8c89UL, 0xe8f9f0d9UL, 0xd98824e9UL,
+		0xc1bfdf08UL, 0xf0ce0b38UL, 0xa35c7768UL, 0x922da358UL,
+		0x04788fc8UL, 0x35095bf8UL, 0x669b27a8UL, 0x57eaf398UL,
+		0xc94ec098UL, 0xf83f14a8UL, 0xabad68f8UL, 0x9adcbcc8UL,
+		0x0c899058UL, 0x3df84468UL, 0x6e6a3838UL, 0x5f1bec08UL,
+		0x472c17e9UL, 0x765dc3d9UL, 0x25cfbf89UL, 0x14be6bb9UL,
+		0x82eb4729UL, 0xb39a9319UL, 0xe008ef49UL, 0xd1793b79UL,
+		0xd067188bUL, 0xe116ccbbUL, 0xb284b0ebUL, 0x83f564dbUL,
+		0x15a0484bUL, 0x24d19c7bUL, 0x7743e02bUL, 0x4632341bUL,
+		0x5e05cffaUL, 0x6f741bcaUL, 0x3ce6679aUL, 0x0d97b3aaUL,
+		0x9bc29f3aUL, 0xaab34b0aUL, 0xf921375aUL, 0xc850e36aUL,
+		0xfb1d70beUL, 0xca6ca48eUL, 0x99fed8deUL, 0xa88f0ceeUL,
+		0x3eda207eUL, 0x0fabf44eUL, 0x5c39881eUL, 0x6d485c2eUL,
+		0x757fa7cfUL, 0x440e73ffUL, 0x179c0fafUL, 0x26eddb9fUL,
+		0xb0b8f70fUL, 0x81c9233fUL, 0xd25b5f6fUL, 0xe32a8b5fUL,
+		0xe234a8adUL, 0xd3457c9dUL, 0x80d700cdUL, 0xb1a6d4fdUL,
+		0x27f3f86dUL, 0x16822c5dUL, 0x4510500dUL, 0x7461843dUL,
+		0x6c567fdcUL, 0x5d27abecUL, 0x0eb5d7bcUL, 0x3fc4038cUL,
+		0xa9912f1cUL, 0x98e0fb2cUL, 0xcb72877cUL, 0xfa03534cUL,
+		0xade9a0d4UL, 0x9c9874e4UL, 0xcf0a08b4UL, 0xfe7bdc84UL,
+		0x682ef014UL, 0x595f2424UL, 0x0acd5874UL, 0x3bbc8c44UL,
+		0x238b77a5UL, 0x12faa395UL, 0x4168dfc5UL, 0x70190bf5UL,
+		0xe64c2765UL, 0xd73df355UL, 0x84af8f05UL, 0xb5de5b35UL,
+		0xb4c078c7UL, 0x85b1acf7UL, 0xd623d0a7UL, 0xe7520497UL,
+		0x71072807UL, 0x4076fc37UL, 0x13e48067UL, 0x22955457UL,
+		0x3aa2afb6UL, 0x0bd37b86UL, 0x584107d6UL, 0x6930d3e6UL,
+		0xff65ff76UL, 0xce142b46UL, 0x9d865716UL, 0xacf78326UL,
+		0x9fba10f2UL, 0xaecbc4c2UL, 0xfd59b892UL, 0xcc286ca2UL,
+		0x5a7d4032UL, 0x6b0c9402UL, 0x389ee852UL, 0x09ef3c62UL,
+		0x11d8c783UL, 0x20a913b3UL, 0x733b6fe3UL, 0x424abbd3UL,
+		0xd41f9743UL, 0xe56e4373UL, 0xb6fc3f23UL, 0x878deb13UL,
+		0x8693c8e1UL, 0xb7e21cd1UL, 0xe4706081UL, 0xd501b4b1UL,
+		0x43549821UL, 0x72254c11UL, 0x21b73041UL, 0x10c6e471UL,
+		0x08f11f90UL, 0x3980cba0UL, 0x6a12b7f0UL, 0x5b6363c0UL,
+		0xcd364f50UL, 0xfc479b60UL, 0xafd5e730UL, 0x9ea43300UL
+	},
+	{
+		0x00000000UL, 0x30d23865UL, 0x61a470caUL, 0x517648afUL,
+		0xc348e194UL, 0xf39ad9f1UL, 0xa2ec915eUL, 0x923ea93bUL,
+		0x837db5d9UL, 0xb3af8dbcUL, 0xe2d9c513UL, 0xd20bfd76UL,
+		0x4035544dUL, 0x70e76c28UL, 0x21912487UL, 0x11431ce2UL,
+		0x03171d43UL, 0x33c52526UL, 0x62b36d89UL, 0x526155ecUL,
+		0xc05ffcd7UL, 0xf08dc4b2UL, 0xa1fb8c1dUL, 0x9129b478UL,
+		0x806aa89aUL, 0xb0b890ffUL, 0xe1ced850UL, 0xd11ce035UL,
+		0x4322490eUL, 0x73f0716bUL, 0x228639c4UL, 0x125401a1UL,
+		0x062e3a86UL, 0x36fc02e3UL, 0x678a4a4cUL, 0x57587229UL,
+		0xc566db12UL, 0xf5b4e377UL, 0xa4c2abd8UL, 0x941093bdUL,
+		0x85538f5fUL, 0xb581b73aUL, 0xe4f7ff95UL, 0xd425c7f0UL,
+		0x461b6ecbUL, 0x76c956aeUL, 0x27bf1e01UL, 0x176d2664UL,
+		0x053927c5UL, 0x35eb1fa0UL, 0x649d570fUL, 0x544f6f6aUL,
+		0xc671c651UL, 0xf6a3fe34UL, 0xa7d5b69bUL, 0x97078efeUL,
+		0x8644921cUL, 0xb696aa79UL, 0xe7e0e2d6UL, 0xd732dab3UL,
+		0x450c7388UL, 0x75de4bedUL, 0x24a80342UL, 0x147a3b27UL,
+		0x0c5c750cUL, 0x3c8e4d69UL, 0x6df805c6UL, 0x5d2a3da3UL,
+		0xcf149498UL, 0xffc6acfdUL, 0xaeb0e452UL, 0x9e62dc37UL,
+		0x8f21c0d5UL, 0xbff3f8b0UL, 0xee85b01fUL, 0xde57887aUL,
+		0x4c692141UL, 0x7cbb1924UL, 0x2dcd518bUL, 0x1d1f69eeUL,
+		0x0f4b684fUL, 0x3f99502aUL, 0x6eef1885UL, 0x5e3d20e0UL,
+		0xcc0389dbUL, 0xfcd1b1beUL, 0xada7f911UL, 0x9d75c174UL,
+		0x8c36dd96UL, 0xbce4e5f3UL, 0xed92ad5cUL, 0xdd409539UL,
+		0x4f7e3c02UL, 0x7fac0467UL, 0x2eda4cc8UL, 0x1e0874adUL,
+		0x0a724f8aUL, 0x3aa077efUL, 0x6bd63f40UL, 0x5b040725UL,
+		0xc93aae1eUL, 0xf9e8967bUL, 0xa89eded4UL, 0x984ce6b1UL,
+		0x890ffa53UL, 0xb9ddc236UL, 0xe8ab8a99UL, 0xd879b2fcUL,
+		0x4a471bc7UL, 0x7a9523a2UL, 0x2be36b0dUL, 0x1b315368UL,
+		0x096552c9UL, 0x39b76aacUL, 0x68c12203UL, 0x58131a66UL,
+		0xca2db35dUL, 0xfaff8b38UL, 0xab89c397UL, 0x9b5bfbf2UL,
+		0x8a18e710UL, 0xbacadf75UL, 0xebbc97daUL, 0xdb6eafbfUL,
+		0x49500684UL, 0x79823ee1UL, 0x28f4764eUL, 0x18264e2bUL,
+		0x18b8ea18UL, 0x286ad27dUL, 0x791c9ad2UL, 0x49cea2b7UL,
+		0xdbf00b8cUL, 0xeb2233e9UL, 0xba547b46UL, 0x8a864323UL,
+		0x9bc55fc1UL, 0xab1767a4UL, 0xfa612f0bUL, 0xcab3176eUL,
+		0x588dbe55UL, 0x685f8630UL, 0x3929ce9fUL, 0x09fbf6faUL,
+		0x1baff75bUL, 0x2b7dcf3eUL, 0x7a0b8791UL, 0x4ad9bff4UL,
+		0xd8e716cfUL, 0xe8352eaaUL, 0xb9436605UL, 0x89915e60UL,
+		0x98d24282UL, 0xa8007ae7UL, 0xf9763248UL, 0xc9a40a2dUL,
+		0x5b9aa316UL, 0x6b489b73UL, 0x3a3ed3dcUL, 0x0aecebb9UL,
+		0x1e96d09eUL, 0x2e44e8fbUL, 0x7f32a054UL, 0x4fe09831UL,
+		0xddde310aUL, 0xed0c096fUL, 0xbc7a41c0UL, 0x8ca879a5UL,
+		0x9deb6547UL, 0xad395d22UL, 0xfc4f158dUL, 0xcc9d2de8UL,
+		0x5ea384d3UL, 0x6e71bcb6UL, 0x3f07f419UL, 0x0fd5cc7cUL,
+		0x1d81cdddUL, 0x2d53f5b8UL, 0x7c25bd17UL, 0x4cf78572UL,
+		0xdec92c49UL, 0xee1b142cUL, 0xbf6d5c83UL, 0x8fbf64e6UL,
+		0x9efc7804UL, 0xae2e4061UL, 0xff5808ceUL, 0xcf8a30abUL,
+		0x5db49990UL, 0x6d66a1f5UL, 0x3c10e95aUL, 0x0cc2d13fUL,
+		0x14e49f14UL, 0x2436a771UL, 0x7540efdeUL, 0x4592d7bbUL,
+		0xd7ac7e80UL, 0xe77e46e5UL, 0xb6080e4aUL, 0x86da362fUL,
+		0x97992acdUL, 0xa74b12a8UL, 0xf63d5a07UL, 0xc6ef6262UL,
+		0x54d1cb59UL, 0x6403f33cUL, 0x3575bb93UL, 0x05a783f6UL,
+		0x17f38257UL, 0x2721ba32UL, 0x7657f29dUL, 0x4685caf8UL,
+		0xd4bb63c3UL, 0xe4695ba6UL, 0xb51f1309UL, 0x85cd2b6cUL,
+		0x948e378eUL, 0xa45c0febUL, 0xf52a4744UL, 0xc5f87f21UL,
+		0x57c6d61aUL, 0x6714ee7fUL, 0x3662a6d0UL, 0x06b09eb5UL,
+		0x12caa592UL, 0x22189df7UL, 0x736ed558UL, 0x43bced3dUL,
+		0xd1824406UL, 0xe1507c63UL, 0xb02634ccUL, 0x80f40ca9UL,
+		0x91b7104bUL, 0xa165282eUL, 0xf0136081UL, 0xc0c158e4UL,
+		0x52fff1dfUL, 0x622dc9baUL, 0x335b8115UL, 0x0389b970UL,
+		0x11ddb8d1UL, 0x210f80b4UL, 0x7079c81bUL, 0x40abf07eUL,
+		0xd2955945UL, 0xe2476120UL, 0xb331298fUL, 0x83e311eaUL,
+		0x92a00d08UL, 0xa272356dUL, 0xf3047dc2UL, 0xc3d645a7UL,
+		0x51e8ec9cUL, 0x613ad4f9UL, 0x304c9c56UL, 0x009ea433UL
+	},
+	{
+		0x00000000UL, 0x54075546UL, 0xa80eaa8cUL, 0xfc09ffcaUL,
+		0x55f123e9UL, 0x01f676afUL, 0xfdff8965UL, 0xa9f8dc23UL,
+		0xabe247d2UL, 0xffe51294UL, 0x03eced5eUL, 0x57ebb818UL,
+		0xfe13643bUL, 0xaa14317dUL, 0x561dceb7UL, 0x021a9bf1UL,
+		0x5228f955UL, 0x062fac13UL, 0xfa2653d9UL, 0xae21069fUL,
+		0x07d9dabcUL, 0x53de8ffaUL, 0xafd77030UL, 0xfbd02576UL,
+		0xf9cabe87UL, 0xadcdebc1UL, 0x51c4140bUL, 0x05c3414dUL,
+		0xac3b9d6eUL, 0xf83cc828UL, 0x043537e2UL, 0x503262a4UL,
+		0xa451f2aaUL, 0xf056a7ecUL, 0x0c5f5826UL, 0x58580d60UL,
+		0xf1a0d143UL, 0xa5a78405UL, 0x59ae7bcfUL, 0x0da92e89UL,
+		0x0fb3b578UL, 0x5bb4e03eUL, 0xa7bd1ff4UL, 0xf3ba4ab2UL,
+		0x5a429691UL, 0x0e45c3d7UL, 0xf24c3c1dUL, 0xa64b695bUL,
+		0xf6790bffUL, 0xa27e5eb9UL, 0x5e77a173UL, 0x0a70f435UL,
+		0xa3882816UL, 0xf78f7d50UL, 0x0b86829aUL, 0x5f81d7dcUL,
+		0x5d9b4c2dUL, 0x099c196bUL, 0xf595e6a1UL, 0xa192b3e7UL,
+		0x086a6fc4UL, 0x5c6d3a82UL, 0xa064c548UL, 0xf463900eUL,
+		0x4d4f93a5UL, 0x1948c6e3UL, 0xe5413929UL, 0xb1466c6fUL,
+		0x18beb04cUL, 0x4cb9e50aUL, 0xb0b01ac0UL, 0xe4b74f86UL,
+		0xe6add477UL, 0xb2aa8131UL, 0x4ea37efbUL, 0x1aa42bbdUL,
+		0xb35cf79eUL, 0xe75ba2d8UL, 0x1b525d12UL, 0x4f550854UL,
+		0x1f676af0UL, 0x4b603fb6UL, 0xb769c07cUL, 0xe36e953aUL,
+		0x4a964919UL, 0x1e911c5fUL, 0xe298e395UL, 0xb69fb6d3UL,
+		0xb4852d22UL, 0xe0827864UL, 0x1c8b87aeUL, 0x488cd2e8UL,
+		0xe1740ecbUL, 0xb5735b8dUL, 0x497aa447UL, 0x1d7df101UL,
+		0xe91e610fUL, 0xbd193449UL, 0x4110cb83UL, 0x15179ec5UL,
+		0xbcef42e6UL, 0xe8e817a0UL, 0x14e1e86aUL, 0x40e6bd2cUL,
+		0x42fc26ddUL, 0x16fb739bUL, 0xeaf28c51UL, 0xbef5d917UL,
+		0x170d0534UL, 0x430a5072UL, 0xbf03afb8UL, 0xeb04fafeUL,
+		0xbb36985aUL, 0xef31cd1cUL, 0x133832d6UL, 0x473f6790UL,
+		0xeec7bbb3UL, 0xbac0eef5UL, 0x46c9113fUL, 0x12ce4479UL,
+		0x10d4df88UL, 0x44d38aceUL, 0xb8da7504UL, 0xecdd2042UL,
+		0x4525fc61UL, 0x1122a927UL, 0xed2b56edUL, 0xb92c03abUL,
+		0x9a9f274aUL, 0xce98720cUL, 0x32918dc6UL, 0x6696d880UL,
+		0xcf6e04a3UL, 0x9b6951e5UL, 0x6760ae2fUL, 0x3367fb69UL,
+		0x317d6098UL, 0x657a35deUL, 0x9973ca14UL, 0xcd749f52UL,
+		0x648c4371UL, 0x308b1637UL, 0xcc82e9fdUL, 0x9885bcbbUL,
+		0xc8b7de1fUL, 0x9cb08b59UL, 0x60b97493UL, 0x34be21d5UL,
+		0x9d46fdf6UL, 0xc941a8b0UL, 0x3548577aUL, 0x614f023cUL,
+		0x635599cdUL, 0x3752cc8bUL, 0xcb5b3341UL, 0x9f5c6607UL,
+		0x36a4ba24UL, 0x62a3ef62UL, 0x9eaa10a8UL, 0xcaad45eeUL,
+		0x3eced5e0UL, 0x6ac980a6UL, 0x96c07f6cUL, 0xc2c72a2aUL,
+		0x6b3ff609UL, 0x3f38a34fUL, 0xc3315c85UL, 0x973609c3UL,
+		0x952c9232UL, 0xc12bc774UL, 0x3d2238beUL, 0x69256df8UL,
+		0xc0ddb1dbUL, 0x94dae49dUL, 0x68d31b57UL, 0x3cd44e11UL,
+		0x6ce62cb5UL, 0x38e179f3UL, 0xc4e88639UL, 0x90efd37fUL,
+		0x39170f5cUL, 0x6d105a1aUL, 0x9119a5d0UL, 0xc51ef096UL,
+		0xc7046b67UL, 0x93033e21UL, 0x6f0ac1ebUL, 0x3b0d94adUL,
+		0x92f5488eUL, 0xc6f21dc8UL, 0x3afbe202UL, 0x6efcb744UL,
+		0xd7d0b4efUL, 0x83d7e1a9UL, 0x7fde1e63UL, 0x2bd94b25UL,
+		0x82219706UL, 0xd626c240UL, 0x2a2f3d8aUL, 0x7e2868ccUL,
+		0x7c32f33dUL, 0x2835a67bUL, 0xd43c59b1UL, 0x803b0cf7UL,
+		0x29c3d0d4UL, 0x7dc48592UL, 0x81cd7a58UL, 0xd5ca2f1eUL,
+		0x85f84dbaUL, 0xd1ff18fcUL, 0x2df6e736UL, 0x79f1b270UL,
+		0xd0096e53UL, 0x840e3b15UL, 0x7807c4dfUL, 0x2c009199UL,
+		0x2e1a0a68UL, 0x7a1d5f2eUL, 0x8614a0e4UL, 0xd213f5a2UL,
+		0x7beb2981UL, 0x2fec7cc7UL, 0xd3e5830dUL, 0x87e2d64bUL,
+		0x73814645UL, 0x27861303UL, 0xdb8fecc9UL, 0x8f88b98fUL,
+		0x267065acUL, 0x727730eaUL, 0x8e7ecf20UL, 0xda799a66UL,
+		0xd8630197UL, 0x8c6454d1UL, 0x706dab1bUL, 0x246afe5dUL,
+		0x8d92227eUL, 0xd9957738UL, 0x259c88f2UL, 0x719bddb4UL,
+		0x21a9bf10UL, 0x75aeea56UL, 0x89a7159cUL, 0xdda040daUL,
+		0x74589cf9UL, 0x205fc9bfUL, 0xdc563675UL, 0x88516333UL,
+		0x8a4bf8c2UL, 0xde4cad84UL, 0x2245524eUL, 0x76420708UL,
+		0xdfbadb2bUL, 0x8bbd8e6dUL, 0x77b471a7UL, 0x23b324e1UL
+	},
+	{
+		0x00000000UL, 0x678efd01UL, 0xcf1dfa02UL, 0xa8930703UL,
+		0x9bd782f5UL, 0xfc597ff4UL, 0x54ca78f7UL, 0x334485f6UL,
+		0x3243731bUL, 0x55cd8e1aUL, 0xfd5e8919UL, 0x9ad07418UL,
+		0xa994f1eeUL, 0xce1a0cefUL, 0x66890becUL, 0x0107f6edUL,
+		0x6486e636UL, 0x03081b37UL, 0xab9b1c34UL, 0xcc15e135UL,
+		0xff5164c3UL, 0x98df99c2UL, 0x304c9ec1UL, 0x57c263c0UL,
+		0x56c5952dUL, 0x314b682cUL, 0x99d86f2fUL, 0xfe56922eUL,
+		0xcd1217d8UL, 0xaa9cead9UL, 0x020feddaUL, 0x658110dbUL,
+		0xc90dcc6cUL, 0xae83316dUL, 0x0610366eUL, 0x619ecb6fUL,
+		0x52da4e99UL, 0x3554b398UL, 0x9dc7b49bUL, 0xfa49499aUL,
+		0xfb4ebf77UL, 0x9cc04276UL, 0x34534575UL, 0x53ddb874UL,
+		0x60993d82UL, 0x0717c083UL, 0xaf84c780UL, 0xc80a3a81UL,
+		0xad8b2a5aUL, 0xca05d75bUL, 0x6296d058UL, 0x05182d59UL,
+		0x365ca8afUL, 0x51d255aeUL, 0xf94152adUL, 0x9ecfafacUL,
+		0x9fc85941UL, 0xf846a440UL, 0x50d5a343UL, 0x375b5e42UL,
+		0x041fdbb4UL, 0x639126b5UL, 0xcb0221b6UL, 0xac8cdcb7UL,
+		0x97f7ee29UL, 0xf0791328UL, 0x58ea142bUL, 0x3f64e92aUL,
+		0x0c206cdcUL, 0x6bae91ddUL, 0xc33d96deUL, 0xa4b36bdfUL,
+		0xa5b49d32UL, 0xc23a6033UL, 0x6aa96730UL, 0x0d279a31UL,
+		0x3e631fc7UL, 0x59ede2c6UL, 0xf17ee5c5UL, 0x96f018c4UL,
+		0xf371081fUL, 0x94fff51eUL, 0x3c6cf21dUL, 0x5be20f1cUL,
+		0x68a68aeaUL, 0x0f2877ebUL, 0xa7bb70e8UL, 0xc0358de9UL,
+		0xc1327b04UL, 0xa6bc8605UL, 0x0e2f8106UL, 0x69a17c07UL,
+		0x5ae5f9f1UL, 0x3d6b04f0UL, 0x95f803f3UL, 0xf276fef2UL,
+		0x5efa2245UL, 0x3974df44UL, 0x91e7d847UL, 0xf6692546UL,
+		0xc52da0b0UL, 0xa2a35db1UL, 0x0a305ab2UL, 0x6dbea7b3UL,
+		0x6cb9515eUL, 0x0b37ac5fUL, 0xa3a4ab5cUL, 0xc42a565dUL,
+		0xf76ed3abUL, 0x90e02eaaUL, 0x387329a9UL, 0x5ffdd4a8UL,
+		0x3a7cc473UL, 0x5df23972UL, 0xf5613e71UL, 0x92efc370UL,
+		0xa1ab4686UL, 0xc625bb87UL, 0x6eb6bc84UL, 0x09384185UL,
+		0x083fb768UL, 0x6fb14a69UL, 0xc7224d6aUL, 0xa0acb06bUL,
+		0x93e8359dUL, 0xf466c89cUL, 0x5cf5cf9fUL, 0x3b7b329eUL,
+		0x2a03aaa3UL, 0x4d8d57a2UL, 0xe51e50a1UL, 0x8290ada0UL,
+		0xb1d42856UL, 0xd65ad557UL, 0x7ec9d254UL, 0x19472f55UL,
+		0x1840d9b8UL, 0x7fce24b9UL, 0xd75d23baUL, 0xb0d3debbUL,
+		0x83975b4dUL, 0xe419a64cUL, 0x4c8aa14fUL, 0x2b045c4eUL,
+		0x4e854c95UL, 0x290bb194UL, 0x8198b697UL, 0xe6164b96UL,
+		0xd552ce60UL, 0xb2dc3361UL, 0x1a4f3462UL, 0x7dc1c963UL,
+		0x7cc63f8eUL, 0x1b48c28fUL, 0xb3dbc58cUL, 0xd455388dUL,
+		0xe711bd7bUL, 0x809f407aUL, 0x280c4779UL, 0x4f82ba78UL,
+		0xe30e66cfUL, 0x84809bceUL, 0x2c139ccdUL, 0x4b9d61ccUL,
+		0x78d9e43aUL, 0x1f57193bUL, 0xb7c41e38UL, 0xd04ae339UL,
+		0xd14d15d4UL, 0xb6c3e8d5UL, 0x1e50efd6UL, 0x79de12d7UL,
+		0x4a9a9721UL, 0x2d146a20UL, 0x85876d23UL, 0xe2099022UL,
+		0x878880f9UL, 0xe0067df8UL, 0x48957afbUL, 0x2f1b87faUL,
+		0x1c5f020cUL, 0x7bd1ff0dUL, 0xd342f80eUL, 0xb4cc050fUL,
+		0xb5cbf3e2UL, 0xd2450ee3UL, 0x7ad609e0UL, 0x1d58f4e1UL,
+		0x2e1c7117UL, 0x49928c16UL, 0xe1018b15UL, 0x868f7614UL,
+		0xbdf4448aUL, 0xda7ab98bUL, 0x72e9be88UL, 0x15674389UL,
+		0x2623c67fUL, 0x41ad3b7eUL, 0xe93e3c7dUL, 0x8eb0c17cUL,
+		0x8fb73791UL, 0xe839ca90UL, 0x40aacd93UL, 0x27243092UL,
+		0x1460b564UL, 0x73ee4865UL, 0xdb7d4f66UL, 0xbcf3b267UL,
+		0xd972a2bcUL, 0xbefc5fbdUL, 0x166f58beUL, 0x71e1a5bfUL,
+		0x42a52049UL, 0x252bdd48UL, 0x8db8da4bUL, 0xea36274aUL,
+		0xeb31d1a7UL, 0x8cbf2ca6UL, 0x242c2ba5UL, 0x43a2d6a4UL,
+		0x70e65352UL, 0x1768ae53UL, 0xbffba950UL, 0xd8755451UL,
+		0x74f988e6UL, 0x137775e7UL, 0xbbe472e4UL, 0xdc6a8fe5UL,
+		0xef2e0a13UL, 0x88a0f712UL, 0x2033f011UL, 0x47bd0d10UL,
+		0x46bafbfdUL, 0x213406fcUL, 0x89a701ffUL, 0xee29fcfeUL,
+		0xdd6d7908UL, 0xbae38409UL, 0x1270830aUL, 0x75fe7e0bUL,
+		0x107f6ed0UL, 0x77f193d1UL, 0xdf6294d2UL, 0xb8ec69d3UL,
+		0x8ba8ec25UL, 0xec261124UL, 0x44b51627UL, 0x233beb26UL,
+		0x223c1dcbUL, 0x45b2e0caUL, 0xed21e7c9UL, 0x8aaf1ac8UL,
+		0xb9eb9f3eUL, 0xde65623fUL, 0x76f6653cUL, 0x1178983dUL
+	},
+	{
+		0x00000000UL, 0xf20c0dfeUL, 0xe1f46d0dUL, 0x13f860f3UL,
+		0xc604acebUL, 0x3408a115UL, 0x27f0c1e6UL, 0xd5fccc18UL,
+		0x89e52f27UL, 0x7be922d9UL, 0x6811422aUL, 0x9a1d4fd4UL,
+		0x4fe183ccUL, 0xbded8e32UL, 0xae15eec1UL, 0x5c19e33fUL,
+		0x162628bfUL, 0xe42a2541UL, 0xf7d245b2UL, 0x05de484cUL,
+		0xd0228454UL, 0x222e89aaUL, 0x31d6e959UL, 0xc3dae4a7UL,
+		0x9fc30798UL, 0x6dcf0a66UL, 0x7e376a95UL, 0x8c3b676bUL,
+		0x59c7ab73UL, 0xabcba68dUL, 0xb833c67eUL, 0x4a3fcb80UL,
+		0x2c4c517eUL, 0xde405c80UL, 0xcdb83c73UL, 0x3fb4318dUL,
+		0xea48fd95UL, 0x1844f06bUL, 0x0bbc9098UL, 0xf9b09d66UL,
+		0xa5a97e59UL, 0x57a573a7UL, 0x445d1354UL, 0xb6511eaaUL,
+		0x63add2b2UL, 0x91a1df4cUL, 0x8259bfbfUL, 0x7055b241UL,
+		0x3a6a79c1UL, 0xc866743fUL, 0xdb9e14ccUL, 0x29921932UL,
+		0xfc6ed52aUL, 0x0e62d8d4UL, 0x1d9ab827UL, 0xef96b5d9UL,
+		0xb38f56e6UL, 0x41835b18UL, 0x527b3bebUL, 0xa0773615UL,
+		0x758bfa0dUL, 0x8787f7f3UL, 0x947f9700UL, 0x66739afeUL,
+		0x5898a2fcUL, 0xaa94af02UL, 0xb96ccff1UL, 0x4b60c20fUL,
+		0x9e9c0e17UL, 0x6c9003e9UL, 0x7f68631aUL, 0x8d646ee4UL,
+		0xd17d8ddbUL, 0x23718025UL, 0x3089e0d6UL, 0xc285ed28UL,
+		0x17792130UL, 0xe5752cceUL, 0xf68d4c3dUL, 0x048141c3UL,
+		0x4ebe8a43UL, 0xbcb287bdUL, 0xaf4ae74eUL, 0x5d46eab0UL,
+		0x88ba26a8UL, 0x7ab62b56UL, 0x694e4ba5UL, 0x9b42465bUL,
+		0xc75ba564UL, 0x3557a89aUL, 0x26afc869UL, 0xd4a3c597UL,
+		0x015f098fUL, 0xf3530471UL, 0xe0ab6482UL, 0x12a7697cUL,
+		0x74d4f382UL, 0x86d8fe7cUL, 0x95209e8fUL, 0x672c9371UL,
+		0xb2d05f69UL, 0x40dc5297UL, 0x53243264UL, 0xa1283f9aUL,
+		0xfd31dca5UL, 0x0f3dd15bUL, 0x1cc5b1a8UL, 0xeec9bc56UL,
+		0x3b35704eUL, 0xc9397db0UL, 0xdac11d43UL, 0x28cd10bdUL,
+		0x62f2db3dUL, 0x90fed6c3UL, 0x8306b630UL, 0x710abbceUL,
+		0xa4f677d6UL, 0x56fa7a28UL, 0x45021adbUL, 0xb70e1725UL,
+		0xeb17f41aUL, 0x191bf9e4UL, 0x0ae39917UL, 0xf8ef94e9UL,
+		0x2d1358f1UL, 0xdf1f550fUL, 0xcce735fcUL, 0x3eeb3802UL,
+		0xb13145f8UL, 0x433d4806UL, 0x50c528f5UL, 0xa2c9250bUL,
+		0x7735e913UL, 0x8539e4edUL, 0x96c1841eUL, 0x64cd89e0UL,
+		0x38d46adfUL, 0xcad86721UL, 0xd92007d2UL, 0x2b2c0a2cUL,
+		0xfed0c634UL, 0x0cdccbcaUL, 0x1f24ab39UL, 0xed28a6c7UL,
+		0xa7176d47UL, 0x551b60b9UL, 0x46e3004aUL, 0xb4ef0db4UL,
+		0x6113c1acUL, 0x931fcc52UL, 0x80e7aca1UL, 0x72eba15fUL,
+		0x2ef24260UL, 0xdcfe4f9eUL, 0xcf062f6dUL, 0x3d0a2293UL,
+		0xe8f6ee8bUL, 0x1afae375UL, 0x09028386UL, 0xfb0e8e78UL,
+		0x9d7d1486UL, 0x6f711978UL, 0x7c89798bUL, 0x8e857475UL,
+		0x5b79b86dUL, 0xa975b593UL, 0xba8dd560UL, 0x4881d89eUL,
+		0x14983ba1UL, 0xe694365fUL, 0xf56c56acUL, 0x07605b52UL,
+		0xd29c974aUL, 0x20909ab4UL, 0x3368fa47UL, 0xc164f7b9UL,
+		0x8b5b3c39UL, 0x795731c7UL, 0x6aaf5134UL, 0x98a35ccaUL,
+		0x4d5f90d2UL, 0xbf539d2cUL, 0xacabfddfUL, 0x5ea7f021UL,
+		0x02be131eUL, 0xf0b21ee0UL, 0xe34a7e13UL, 0x114673edUL,
+		0xc4babff5UL, 0x36b6b20bUL, 0x254ed2f8UL, 0xd742df06UL,
+		0xe9a9e704UL, 0x1ba5eafaUL, 0x085d8a09UL, 0xfa5187f7UL,
+		0x2fad4befUL, 0xdda14611UL, 0xce5926e2UL, 0x3c552b1cUL,
+		0x604cc823UL, 0x9240c5ddUL, 0x81b8a52eUL, 0x73b4a8d0UL,
+		0xa64864c8UL, 0x54446936UL, 0x47bc09c5UL, 0xb5b0043bUL,
+		0xff8fcfbbUL, 0x0d83c245UL, 0x1e7ba2b6UL, 0xec77af48UL,
+		0x398b6350UL, 0xcb876eaeUL, 0xd87f0e5dUL, 0x2a7303a3UL,
+		0x766ae09cUL, 0x8466ed62UL, 0x979e8d91UL, 0x6592806fUL,
+		0xb06e4c77UL, 0x42624189UL, 0x519a217aUL, 0xa3962c84UL,
+		0xc5e5b67aUL, 0x37e9bb84UL, 0x2411db77UL, 0xd61dd689UL,
+		0x03e11a91UL, 0xf1ed176fUL, 0xe215779cUL, 0x10197a62UL,
+		0x4c00995dUL, 0xbe0c94a3UL, 0xadf4f450UL, 0x5ff8f9aeUL,
+		0x8a0435b6UL, 0x78083848UL, 0x6bf058bbUL, 0x99fc5545UL,
+		0xd3c39ec5UL, 0x21cf933bUL, 0x3237f3c8UL, 0xc03bfe36UL,
+		0x15c7322eUL, 0xe7cb3fd0UL, 0xf4335f23UL, 0x063f52ddUL,
+		0x5a26b1e2UL, 0xa82abc1cUL, 0xbbd2dcefUL, 0x49ded111UL,
+		0x9c221d09UL, 0x6e2e10f7UL, 0x7dd67004UL, 0x8fda7dfaUL
+	}
+};
+
+/* The folding constants of the Castagnoli (CRC-32C) polynomial
+ */
+const uint64_t crc32_folding_constants_castagnoli[ 8 ] = {
+	0x00000000740eef02ULL, 0x000000009e4addf8ULL,
+	0x00000000f20c0dfeULL, 0x000000014cd00bd6ULL,
+	0x00000000dd45aab8ULL, 0x0000000000000000ULL,
+	0x0000000105ec76f1ULL, 0x00000000dea713f1ULL
+};
+
@@ -0,0 +1,45 @@
+/*
+ * CRC-32 lookup tables
+ *
+ * Copyright (C) 2008-2019, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This software is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This software is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this software.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#if !defined( _CRC32_TABLES_H )
+#define _CRC32_TABLES_H
+
+#include <common.h>
+#include <types.h>
+
+#if defined( __cplusplus )
+extern "C" {
+#endif
+
+extern const uint32_t crc32_slicing_tables_rfc1952[ 16 ][ 256 ];
+
+extern const uint64_t crc32_folding_constants_rfc1952[ 8 ];
+
+extern const uint32_t crc32_slicing_tables_castagnoli[ 16 ][ 256 ];
+
+extern const uint64_t crc32_folding_constants_castagnoli[ 8 ];
+
+#if defined( __cplusplus )
+}
+#endif
+
+#endif /* !defined( _CRC32_TABLES_H ) */
+
@@ -29,13 +29,36 @@
 #include <stdlib.h>
 #endif
 
+#include "assorted_batch.h"
+#include "assorted_calibrate.h"
 #include "assorted_getopt.h"
+#include "assorted_input_file.h"
 #include "assorted_libcerror.h"
 #include "assorted_libcfile.h"
 #include "assorted_libcnotify.h"
+#include "assorted_libcthreads.h"
 #include "assorted_output.h"
+#include "assorted_worker_pool.h"
 #include "crc32.h"
 
+/* The size of the buffer used to read the source data
+ */
+#define CRC32SUM_BUFFER_SIZE		( 4 * 1024 * 1024 )
+
+/* The maximum number of threads
+ */
+#define CRC32SUM_MAXIMUM_NUMBER_OF_THREADS	64
+
+/* The minimum size of the range of data calculated by a thread
+ */
+#define CRC32SUM_MINIMUM_THREAD_RANGE_SIZE	( 256 * 1024 )
+
+/* The calculation methods considered when calibrating
+ * The modulo-2 calculation method is too slow to be considered
+ */
+static const int crc32sum_calculation_methods[] = {
+	2, 3, 4, 5 };
+
 /* Prints the executable usage information
  */
 void usage_fprint(
@@ -47,20 +70,51 @@ void usage_fprint(
 	}
 	fprintf( stream, "Use crc32sum to calculate a CRC-32 of file data.\n\n" );
 
-	fprintf( stream, "Usage: crc32sum [ -c crc ] [ -i initial_value ] [ -o offset ]\n"
-	                 "                [ -p polynomial ] [ -s size ] [ -12hvVw ] source\n\n" );
+	fprintf( stream, "Usage: crc32sum [ -c crc ] [ -C checksum_list ] [ -i initial_value ]\n"
+	                 "                [ -j threads ] [ -o offset ] [ -p polynomial ]\n"
+	                 "                [ -s size ] [ -S format ] [ -t threads ]\n"
+	                 "                [ -u block_size ] [ -12345bhvVw ] source ...\n\n" );
 
-	fprintf( stream, "\tsource: the source file\n\n" );
+	fprintf( stream, "\tsource: the source file, in batch mode the source files and\n"
+	                 "\t        directories, where - reads the paths from stdin\n\n" );
 
 	fprintf( stream, "\t-1:     use the modulo-2 calculation method\n" );
-	fprintf( stream, "\t-2:     use the table lookup calculation method (default)\n" );
+	fprintf( stream, "\t-2:     use the table lookup calculation method\n" );
+	fprintf( stream, "\t-3:     use the slicing-by-8 table lookup calculation method\n" );
+	fprintf( stream, "\t-4:     use the slicing-by-16 table lookup calculation method\n" );
+	fprintf( stream, "\t-5:     use the CRC instructions of the CPU if available\n"
+	                 "\t        (PCLMULQDQ, SSE4.2 or ARMv8 CRC) otherwise falls back\n"
+	                 "\t        to slicing-by-16\n" );
+	fprintf( stream, "\t        by default the fastest calculation method is selected\n"
+	                 "\t        by calibrating the methods 2 to 5 before a large source\n"
+	                 "\t        is read, otherwise the calculation method 5 is used\n" );
+	fprintf( stream, "\t-b:     batch mode, calculates the CRC-32 of every source file and\n"
+	                 "\t        of every file in the source directories, or of the files\n"
+	                 "\t        of which the paths are read from stdin if no source is\n"
+	                 "\t        provided, and prints a line per file in the format of\n"
+	                 "\t        sha256sum, implied when multiple sources are provided\n" );
+	fprintf( stream, "\t-C:     verify the CRC-32 of the files in a checksum list in\n"
+	                 "\t        the format of sha256sum, where - reads the list from stdin,\n"
+	                 "\t        implies -b\n" );
 	fprintf( stream, "\t-c:     check the calculated CRC-32 with the one provided.\n"
 	                 "\t        On a mismatch crc32 will try to locate the error.\n" );
 	fprintf( stream, "\t-h:     shows this help\n" );
 	fprintf( stream, "\t-i:     initial value (default is 0)\n" );
+	fprintf( stream, "\t-j:     number of threads used in batch mode (default is %d)\n",
+	 ASSORTED_BATCH_DEFAULT_NUMBER_OF_THREADS );
 	fprintf( stream, "\t-o:     data offset (default is 0)\n" );
 	fprintf( stream, "\t-p:     polynomial (default is 0xedb88320)\n" );
 	fprintf( stream, "\t-s:     size of data (default is the file size)\n" );
+	fprintf( stream, "\t-S:     print timing and throughput statistics of the open,\n"
+	                 "\t        read, compute and write phases and the peak memory\n"
+	                 "\t        size to stderr in the format: text or json\n" );
+	fprintf( stream, "\t-t:     number of threads (default is 1), the data is split\n"
+	                 "\t        into ranges of which the CRC-32 are calculated in\n"
+	                 "\t        parallel and combined afterwards\n" );
+	fprintf( stream, "\t-u:     read the source unbuffered using direct I/O in blocks of\n"
+	                 "\t        block_size bytes, which must be a multiple of %d, to\n"
+	                 "\t        bypass the system cache, e.g. when reading a device\n",
+	 ASSORTED_INPUT_FILE_DIRECT_IO_ALIGNMENT );
 	fprintf( stream, "\t-v:     verbose output to stderr\n" );
 	fprintf( stream, "\t-V:     print version\n" );
 	fprintf( stream, "\t-w:     use weak CRC calculation, without the initial and\n"
@@ -68,6 +122,451 @@ void usage_fprint(
 	fprintf( stream, "\n" );
 }
 
+/* Calculates the CRC-32 of a buffer using a specific calculation method
+ * Returns 1 if successful or -1 on error
+ */
+int crc32sum_calculate(
+     int calculation_method,
+     uint32_t *crc32,
+     uint8_t *buffer,
+     size_t size,
+     uint32_t initial_value,
+     uint8_t weak_crc,
+     libcerror_error_t **error )
+{
+	static char *function = "crc32sum_calculate";
+	int result            = -1;
+
+	if( crc32 == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid CRC-32.",
+		 function );
+
+		return( -1 );
+	}
+	if( calculation_method == 1 )
+	{
+		result = crc32_calculate_modulo2(
+		          crc32,
+		          buffer,
+		          size,
+		          initial_value,
+		          weak_crc,
+		          error );
+	}
+	else if( calculation_method == 2 )
+	{
+		result = crc32_calculate(
+		          crc32,
+		          buffer,
+		          size,
+		          initial_value,
+		          weak_crc,
+		          error );
+	}
+	else if( calculation_method == 3 )
+	{
+		result = crc32_calculate_slicing_by_8(
+		          crc32,
+		          buffer,
+		          size,
+		          initial_value,
+		          weak_crc,
+		          error );
+	}
+	else if( calculation_method == 4 )
+	{
+		result = crc32_calculate_slicing_by_16(
+		          crc32,
+		          buffer,
+		          size,
+		          initial_value,
+		          weak_crc,
+		          error );
+	}
+	else if( calculation_method == 5 )
+	{
+		result = crc32_calculate_hardware(
+		          crc32,
+		          buffer,
+		          size,
+		          initial_value,
+		          weak_crc,
+		          error );
+	}
+	else
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_UNSUPPORTED_VALUE,
+		 "%s: unsupported calculation method: %d.",
+		 function,
+		 calculation_method );
+
+		return( -1 );
+	}
+	return( result );
+}
+
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+
+typedef struct crc32sum_thread_range crc32sum_thread_range_t;
+
+struct crc32sum_thread_range
+{
+	/* The calculation method
+	 */
+	int calculation_method;
+
+	/* The data of the range
+	 */
+	uint8_t *buffer;
+
+	/* The size of the range
+	 */
+	size_t size;
+
+	/* The initial value
+	 */
+	uint32_t initial_value;
+
+	/* Value to indicate a weak CRC-32 should be calculated
+	 */
+	uint8_t weak_crc;
+
+	/* The calculated CRC-32 of the range
+	 */
+	uint32_t crc32;
+
+	/* The result of the calculation
+	 */
+	int result;
+};
+
+/* Calculates the CRC-32 of a range, used as the task function of the worker pool
+ * Returns 1 if successful or -1 on error
+ */
+int crc32sum_thread_range_calculate(
+     void *arguments,
+     uint8_t *worker_buffer,
+     size_t worker_buffer_size )
+{
+	crc32sum_thread_range_t *thread_range = NULL;
+
+	( void ) worker_buffer;
+	( void ) worker_buffer_size;
+
+	if( arguments == NULL )
+	{
+		return( -1 );
+	}
+	thread_range = (crc32sum_thread_range_t *) arguments;
+
+	thread_range->result = crc32sum_calculate(
+	                        thread_range->calculation_method,
+	                        &( thread_range->crc32 ),
+	                        thread_range->buffer,
+	                        thread_range->size,
+	                        thread_range->initial_value,
+	                        thread_range->weak_crc,
+	                        NULL );
+
+	return( thread_range->result );
+}
+
+/* Calculates the CRC-32 of a buffer using the worker pool
+ * The buffer is split into a range per worker, of which the CRC-32 is calculated
+ * in parallel, the CRC-32 of the ranges are combined into the CRC-32 of the buffer
+ * Returns 1 if successful or -1 on error
+ */
+int crc32sum_calculate_parallel(
+     int calculation_method,
+     uint32_t *crc32,
+     uint8_t *buffer,
+     size_t size,
+     uint32_t initial_value,
+     uint8_t weak_crc,
+     assorted_worker_pool_t *worker_pool,
+     libcerror_error_t **error )
+{
+	crc32sum_thread_range_t *thread_ranges = NULL;
+	static char *function                  = "crc32sum_calculate_parallel";
+	size_t range_offset                    = 0;
+	size_t range_size                      = 0;
+	int number_of_ranges                   = 0;
+	int range_index                        = 0;
+	int result                             = 1;
+
+	if( crc32 == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid CRC-32.",
+		 function );
+
+		return( -1 );
+	}
+	if( worker_pool == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid worker pool.",
+		 function );
+
+		return( -1 );
+	}
+	/* Do not use more workers than ranges of the minimum size
+	 */
+	number_of_ranges = worker_pool->number_of_workers;
+
+	if( ( size / CRC32SUM_MINIMUM_THREAD_RANGE_SIZE ) < (size_t) number_of_ranges )
+	{
+		number_of_ranges = (int) ( size / CRC32SUM_MINIMUM_THREAD_RANGE_SIZE );
+	}
+	if( number_of_ranges <= 1 )
+	{
+		return( crc32sum_calculate(
+		         calculation_method,
+		         crc32,
+		         buffer,
+		         size,
+		         initial_value,
+		         weak_crc,
+		         error ) );
+	}
+	thread_ranges = (crc32sum_thread_range_t *) memory_allocate(
+	                                             sizeof( crc32sum_thread_range_t ) * number_of_ranges );
+
+	if( thread_ranges == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create thread ranges.",
+		 function );
+
+		goto on_error;
+	}
+	/* Keep the ranges a multiple of 64 bytes so that every range starts aligned
+	 * to the same extent as the buffer
+	 */
+	range_size  = size / number_of_ranges;
+	range_size -= range_size % 64;
+
+	for( range_index = 0;
+	     range_index < number_of_ranges;
+	     range_index++ )
+	{
+		thread_ranges[ range_index ].calculation_method = calculation_method;
+		thread_ranges[ range_index ].buffer             = &( buffer[ range_offset ] );
+		thread_ranges[ range_index ].size               = range_size;
+		thread_ranges[ range_index ].initial_value      = 0;
+		thread_ranges[ range_index ].weak_crc           = weak_crc;
+		thread_ranges[ range_index ].crc32              = 0;
+		thread_ranges[ range_index ].result             = 0;
+
+		range_offset += range_size;
+	}
+	thread_ranges[ 0 ].initial_value = initial_value;
+
+	thread_ranges[ number_of_ranges - 1 ].size += size - range_offset;
+
+	for( range_index = 0;
+	     range_index < number_of_ranges;
+	     range_index++ )
+	{
+		if( assorted_worker_pool_push(
+		     worker_pool,
+		     crc32sum_thread_range_calculate,
+		     (void *) &( thread_ranges[ range_index ] ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+			 "%s: unable to push range: %d onto worker pool.",
+			 function,
+			 range_index );
+
+			result = -1;
+
+			break;
+		}
+	}
+	/* Wait for the ranges that were pushed, also on error, since they
+	 * reference the thread ranges
+	 */
+	if( assorted_worker_pool_wait(
+	     worker_pool,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to wait for worker pool.",
+		 function );
+
+		result = -1;
+	}
+	if( result != 1 )
+	{
+		goto on_error;
+	}
+	for( range_index = 0;
+	     range_index < number_of_ranges;
+	     range_index++ )
+	{
+		if( thread_ranges[ range_index ].result != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GENERIC,
+			 "%s: unable to calculate CRC-32 of range: %d.",
+			 function,
+			 range_index );
+
+			goto on_error;
+		}
+		if( range_index == 0 )
+		{
+			*crc32 = thread_ranges[ range_index ].crc32;
+		}
+		else if( crc32_combine_values(
+		          crc32,
+		          *crc32,
+		          thread_ranges[ range_index ].crc32,
+		          (size64_t) thread_ranges[ range_index ].size,
+		          error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GENERIC,
+			 "%s: unable to combine CRC-32 of range: %d.",
+			 function,
+			 range_index );
+
+			goto on_error;
+		}
+	}
+	memory_free(
+	 thread_ranges );
+
+	return( 1 );
+
+on_error:
+	if( thread_ranges != NULL )
+	{
+		memory_free(
+		 thread_ranges );
+	}
+	return( -1 );
+}
+
+#endif /* defined( HAVE_MULTI_THREAD_SUPPORT ) */
+
+/* Calculates the CRC-32 of a buffer to calibrate a calculation method
+ * Returns 1 if successful or -1 on error
+ */
+int crc32sum_calibrate_calculate(
+     int calculation_method,
+     uint8_t *buffer,
+     size_t size,
+     libcerror_error_t **error )
+{
+	uint32_t crc32 = 0;
+
+	return( crc32sum_calculate(
+	         calculation_method,
+	         &crc32,
+	         buffer,
+	         size,
+	         0,
+	         0,
+	         error ) );
+}
+
+typedef struct crc32sum_batch_arguments crc32sum_batch_arguments_t;
+
+struct crc32sum_batch_arguments
+{
+	/* The calculation method
+	 */
+	int calculation_method;
+
+	/* Value to indicate a weak CRC-32 should be calculated
+	 */
+	uint8_t weak_crc;
+};
+
+/* Calculates the CRC-32 of a buffer in batch mode
+ * The arguments contain the calculation method and weak CRC flag
+ * Returns 1 if successful or -1 on error
+ */
+int crc32sum_batch_calculate(
+     void *arguments,
+     uint64_t *checksum_value,
+     uint8_t *buffer,
+     size_t size,
+     libcerror_error_t **error )
+{
+	crc32sum_batch_arguments_t *batch_arguments = NULL;
+	static char *function                       = "crc32sum_batch_calculate";
+	uint32_t checksum_value_32bit               = 0;
+	int result                                  = 0;
+
+	if( arguments == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid arguments.",
+		 function );
+
+		return( -1 );
+	}
+	if( checksum_value == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid checksum value.",
+		 function );
+
+		return( -1 );
+	}
+	batch_arguments      = (crc32sum_batch_arguments_t *) arguments;
+	checksum_value_32bit = (uint32_t) *checksum_value;
+
+	result = crc32sum_calculate(
+	          batch_arguments->calculation_method,
+	          &checksum_value_32bit,
+	          buffer,
+	          size,
+	          checksum_value_32bit,
+	          batch_arguments->weak_crc,
+	          error );
+
+	*checksum_value = (uint64_t) checksum_value_32bit;
+
+	return( result );
+}
+
 /* The main program
  */
 #if defined( HAVE_WIDE_SYSTEM_CHARACTER )
@@ -76,39 +575,57 @@ int wmain( int argc, wchar_t * const argv[] )
 int main( int argc, char * const argv[] )
 #endif
 {
-	libcerror_error_t *error     = NULL;
-	libcfile_file_t *source_file = NULL;
-	system_character_t *source   = NULL;
-	uint8_t *buffer              = NULL;
-	char *program                = "crc32sum";
-	system_integer_t option      = 0;
-	size64_t source_size         = 0;
-	ssize_t read_count           = 0;
-	off_t source_offset          = 0;
-	uint32_t calculated_crc32    = 0;
-	uint32_t crc32               = 0;
-	uint32_t initial_value       = 0;
-	uint32_t polynomial          = 0xedb88320UL;
-	uint8_t bit_index            = 0;
-	uint8_t weak_crc             = 0;
-	int calculation_method       = 2;
-	int result                   = 0;
-	int validate_crc             = 0;
-	int verbose                  = 0;
-
-	assorted_output_version_fprint(
-	 stdout,
-	 program );
+	crc32sum_batch_arguments_t batch_arguments;
+
+	assorted_batch_t *batch                      = NULL;
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+	assorted_worker_pool_t *worker_pool          = NULL;
+#endif
+	libcerror_error_t *error                     = NULL;
+	assorted_input_file_t *source_file           = NULL;
+	crc32_syndrome_table_t *syndrome_table       = NULL;
+	system_character_t *option_statistics_format = NULL;
+	system_character_t *source                   = NULL;
+	system_character_t *checksum_list            = NULL;
+	uint8_t *buffer                              = NULL;
+	char *program                                = "crc32sum";
+	system_integer_t option                      = 0;
+	size64_t remaining_size                      = 0;
+	size64_t source_size                         = 0;
+	size_t buffer_size                           = 0;
+	size_t direct_io_block_size                  = 0;
+	size_t read_size                             = 0;
+	ssize_t read_count                           = 0;
+	off_t source_offset                          = 0;
+	uint64_t first_bit_offset                    = 0;
+	uint64_t second_bit_offset                   = 0;
+	uint32_t calculated_crc32                    = 0;
+	uint32_t crc32                               = 0;
+	uint32_t initial_value                       = 0;
+	uint32_t polynomial                          = 0xedb88320UL;
+	uint8_t bit_index                            = 0;
+	uint8_t weak_crc                             = 0;
+	uint8_t batch_mode                           = 0;
+	int calculation_method                       = 0;
+	int number_of_threads                        = 1;
+	int number_of_batch_threads                  = ASSORTED_BATCH_DEFAULT_NUMBER_OF_THREADS;
+	int result                                   = 0;
+	int validate_crc                             = 0;
+	int verbose                                  = 0;
 
 	while( ( option = assorted_getopt(
 	                   argc,
 	                   argv,
-	                   _SYSTEM_STRING( "12c:hi:o:p:s:vVw" ) ) ) != (system_integer_t) -1 )
+	                   _SYSTEM_STRING( "12345bC:c:hi:j:o:p:s:S:t:u:vVw" ) ) ) != (system_integer_t) -1 )
 	{
 		switch( option )
 		{
 			case '?':
 			default:
+				assorted_output_version_fprint(
+				 stdout,
+				 program );
+
 				fprintf(
 				 stderr,
 				 "Invalid argument: %" PRIs_SYSTEM "\n",
@@ -129,6 +646,32 @@ int main( int argc, char * const argv[] )
 
 				break;
 
+			case '3':
+				calculation_method = 3;
+
+				break;
+
+			case '4':
+				calculation_method = 4;
+
+				break;
+
+			case '5':
+				calculation_method = 5;
+
+				break;
+
+			case 'b':
+				batch_mode = 1;
+
+				break;
+
+			case 'C':
+				checksum_list = optarg;
+				batch_mode    = 1;
+
+				break;
+
 			case 'c':
 				crc32 = atol( optarg );
 
@@ -137,6 +680,10 @@ int main( int argc, char * const argv[] )
 				break;
 
 			case 'h':
+				assorted_output_version_fprint(
+				 stdout,
+				 program );
+
 				usage_fprint(
 				 stdout );
 
@@ -147,6 +694,11 @@ int main( int argc, char * const argv[] )
 
 				break;
 
+			case 'j':
+				number_of_batch_threads = (int) atol( optarg );
+
+				break;
+
 			case 'o':
 				source_offset = atol( optarg );
 
@@ -162,12 +714,31 @@ int main( int argc, char * const argv[] )
 
 				break;
 
+			case 'S':
+				option_statistics_format = optarg;
+
+				break;
+
+			case 't':
+				number_of_threads = (int) atol( optarg );
+
+				break;
+
+			case 'u':
+				direct_io_block_size = (size_t) atol( optarg );
+
+				break;
+
 			case 'v':
 				verbose = 1;
 
 				break;
 
 			case 'V':
+				assorted_output_version_fprint(
+				 stdout,
+				 program );
+
 				assorted_output_copyright_fprint(
 				 stdout );
 
@@ -179,7 +750,18 @@ int main( int argc, char * const argv[] )
 				break;
 		}
 	}
-	if( optind == argc )
+	if( ( argc - optind ) > 1 )
+	{
+		batch_mode = 1;
+	}
+	if( batch_mode == 0 )
+	{
+		assorted_output_version_fprint(
+		 stdout,
+		 program );
+	}
+	if( ( batch_mode == 0 )
+	 && ( optind == argc ) )
 	{
 		fprintf(
 		 stderr,
@@ -192,15 +774,134 @@ int main( int argc, char * const argv[] )
 	}
 	source = argv[ optind ];
 
+	if( ( number_of_threads <= 0 )
+	 || ( number_of_threads > CRC32SUM_MAXIMUM_NUMBER_OF_THREADS ) )
+	{
+		fprintf(
+		 stderr,
+		 "Unsupported number of threads, value must be between 1 and %d.\n",
+		 CRC32SUM_MAXIMUM_NUMBER_OF_THREADS );
+
+		return( EXIT_FAILURE );
+	}
+#if !defined( HAVE_MULTI_THREAD_SUPPORT )
+	if( number_of_threads > 1 )
+	{
+		fprintf(
+		 stderr,
+		 "Multi-threading not supported, using a single thread.\n" );
+
+		number_of_threads = 1;
+	}
+#endif
 	libcnotify_stream_set(
 	 stderr,
 	 NULL );
 	libcnotify_verbose_set(
 	 verbose );
 
+	if( assorted_output_statistics_initialize(
+	     option_statistics_format,
+	     &error ) != 1 )
+	{
+		fprintf(
+		 stderr,
+		 "Unable to initialize statistics.\n" );
+
+		goto on_error;
+	}
+
+	if( batch_mode != 0 )
+	{
+		if( ( source_offset != 0 )
+		 || ( source_size != 0 ) )
+		{
+			fprintf(
+			 stderr,
+			 "Offset and size are not supported in batch mode.\n" );
+
+			return( EXIT_FAILURE );
+		}
+		if( direct_io_block_size != 0 )
+		{
+			fprintf(
+			 stderr,
+			 "Direct I/O is not supported in batch mode.\n" );
+
+			return( EXIT_FAILURE );
+		}
+		if( ( number_of_batch_threads <= 0 )
+		 || ( number_of_batch_threads > ASSORTED_BATCH_MAXIMUM_NUMBER_OF_THREADS ) )
+		{
+			fprintf(
+			 stderr,
+			 "Unsupported number of threads, value must be between 1 and %d.\n",
+			 ASSORTED_BATCH_MAXIMUM_NUMBER_OF_THREADS );
+
+			return( EXIT_FAILURE );
+		}
+		/* The methods are not calibrated since the size of the files is not known in advance
+		 */
+		if( calculation_method == 0 )
+		{
+			calculation_method = 5;
+		}
+		initialize_crc32_table(
+		 polynomial );
+
+		batch_arguments.calculation_method = calculation_method;
+		batch_arguments.weak_crc           = weak_crc;
+
+		if( assorted_batch_initialize(
+		     &batch,
+		     crc32sum_batch_calculate,
+		     (void *) &batch_arguments,
+		     (uint64_t) initial_value,
+		     4,
+		     number_of_batch_threads,
+		     &error ) != 1 )
+		{
+			fprintf(
+			 stderr,
+			 "Unable to create batch.\n" );
+
+			goto on_error;
+		}
+		result = assorted_batch_process(
+		          batch,
+		          argc - optind,
+		          &( argv[ optind ] ),
+		          checksum_list,
+		          &error );
+
+		if( result == -1 )
+		{
+			fprintf(
+			 stderr,
+			 "Unable to process batch.\n" );
+
+			goto on_error;
+		}
+		if( assorted_batch_free(
+		     &batch,
+		     &error ) != 1 )
+		{
+			fprintf(
+			 stderr,
+			 "Unable to free batch.\n" );
+
+			goto on_error;
+		}
+		if( result != 1 )
+		{
+			return( EXIT_FAILURE );
+		}
+		return( EXIT_SUCCESS );
+	}
+
 	/* Open the source file
 	 */
-	if( libcfile_file_initialize(
+	if( assorted_input_file_initialize(
 	     &source_file,
 	     &error ) != 1 )
 	{
@@ -210,10 +911,20 @@ int main( int argc, char * const argv[] )
 
 		goto on_error;
 	}
-	if( libcfile_file_open(
+	if( assorted_input_file_set_direct_io(
+	     source_file,
+	     direct_io_block_size,
+	     &error ) != 1 )
+	{
+		fprintf(
+		 stderr,
+		 "Unable to set direct I/O block size of source file.\n" );
+
+		goto on_error;
+	}
+	if( assorted_input_file_open(
 	     source_file,
 	     source,
-	     LIBCFILE_OPEN_READ,
 	     &error ) != 1 )
 	{
 		fprintf(
@@ -224,7 +935,7 @@ int main( int argc, char * const argv[] )
 	}
 	if( source_size == 0 )
 	{
-		if( libcfile_file_get_size(
+		if( assorted_input_file_get_size(
 		     source_file,
 		     &source_size,
 		     &error ) == -1 )
@@ -244,28 +955,17 @@ int main( int argc, char * const argv[] )
 
 		goto on_error;
 	}
-	if( source_size > (size_t) SSIZE_MAX )
-	{
-		fprintf(
-		 stderr,
-		 "Invalid source size value exceeds maximum.\n" );
-
-		goto on_error;
-	}
-	buffer = (uint8_t *) memory_allocate(
-	                      sizeof( uint8_t ) * source_size );
+	/* Read a block per thread at once so that the block can be split into ranges
+	 */
+	buffer_size = CRC32SUM_BUFFER_SIZE * (size_t) number_of_threads;
 
-	if( buffer == NULL )
+	if( (size64_t) buffer_size > source_size )
 	{
-		fprintf(
-		 stderr,
-		 "Unable to create buffer.\n" );
-
-		goto on_error;
+		buffer_size = (size_t) source_size;
 	}
 	/* Position the source file at the right offset
 	 */
-	if( libcfile_file_seek_offset(
+	if( assorted_input_file_seek_offset(
 	     source_file,
 	     source_offset,
 	     SEEK_SET,
@@ -277,80 +977,162 @@ int main( int argc, char * const argv[] )
 
 		goto on_error;
 	}
-	read_count = libcfile_file_read_buffer(
-		      source_file,
-		      buffer,
-		      source_size,
-	              &error );
-
-	if( read_count != (ssize_t) source_size )
-	{
-		fprintf(
-		 stderr,
-		 "Unable to read from source file.\n" );
-
-		goto on_error;
-	}
-	/* Clean up
+	/* Read the next blocks ahead while the current block is processed
 	 */
-	if( libcfile_file_close(
+	if( assorted_input_file_set_read_ahead(
 	     source_file,
-	     &error ) != 0 )
+	     buffer_size,
+	     ASSORTED_INPUT_FILE_DEFAULT_NUMBER_OF_READ_AHEAD_BLOCKS,
+	     &error ) != 1 )
 	{
 		fprintf(
 		 stderr,
-		 "Unable to close source file.\n" );
+		 "Unable to set read-ahead of source file.\n" );
 
 		goto on_error;
 	}
-	if( libcfile_file_free(
-	     &source_file,
-	     &error ) != 1 )
+	/* Combining the CRC-32 of the ranges requires the polynomial of the tables
+	 */
+	if( ( calculation_method != 1 )
+	 || ( number_of_threads > 1 ) )
 	{
-		fprintf(
-		 stderr,
-		 "Unable to free source file.\n" );
-
-		goto on_error;
+		initialize_crc32_table(
+		 polynomial );
 	}
-	if( calculation_method == 1 )
+	if( calculation_method == 0 )
 	{
-		result = crc32_calculate_modulo2(
-			  &calculated_crc32,
-			  buffer,
-			  source_size,
-			  initial_value,
-			  weak_crc,
-			  &error );
+		calculation_method = 5;
+
+		if( source_size >= ASSORTED_CALIBRATE_MINIMUM_DATA_SIZE )
+		{
+			if( assorted_calibrate_select_calculation_method(
+			     crc32sum_calibrate_calculate,
+			     crc32sum_calculation_methods,
+			     (int) ( sizeof( crc32sum_calculation_methods ) / sizeof( int ) ),
+			     &calculation_method,
+			     &error ) != 1 )
+			{
+				fprintf(
+				 stderr,
+				 "Unable to calibrate calculation methods.\n" );
+
+				goto on_error;
+			}
+		}
+		if( verbose != 0 )
+		{
+			fprintf(
+			 stderr,
+			 "Selected calculation method: %d\n",
+			 calculation_method );
+		}
 	}
-	else if( calculation_method == 2 )
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+	/* The workers are started once and bound to the CPUs so that they
+	 * keep running on the same NUMA node for all the blocks
+	 */
+	if( number_of_threads > 1 )
 	{
-                initialize_crc32_table(
-                 polynomial );
+		if( assorted_worker_pool_initialize(
+		     &worker_pool,
+		     number_of_threads,
+		     0,
+		     ASSORTED_WORKER_POOL_FLAG_CPU_AFFINITY,
+		     &error ) != 1 )
+		{
+			fprintf(
+			 stderr,
+			 "Unable to create worker pool.\n" );
 
-		result = crc32_calculate(
-			  &calculated_crc32,
-			  buffer,
-			  source_size,
-			  initial_value,
-			  weak_crc,
-			  &error );
+			goto on_error;
+		}
 	}
-	if( result != 1 )
+#endif
+	/* Read the source data in blocks and pass the CRC-32 of the previous
+	 * blocks as the initial value of the next block
+	 */
+	calculated_crc32 = initial_value;
+	remaining_size   = source_size;
+
+	while( remaining_size > 0 )
 	{
-		fprintf(
-		 stderr,
-		 "Unable to calculate CRC-32.\n" );
+		read_size = buffer_size;
 
-		goto on_error;
+		if( (size64_t) read_size > remaining_size )
+		{
+			read_size = (size_t) remaining_size;
+		}
+		read_count = assorted_input_file_read_data(
+		              source_file,
+		              &buffer,
+		              read_size,
+		              &error );
+
+		if( read_count != (ssize_t) read_size )
+		{
+			fprintf(
+			 stderr,
+			 "Unable to read from source file.\n" );
+
+			goto on_error;
+		}
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+		if( number_of_threads > 1 )
+		{
+			result = crc32sum_calculate_parallel(
+			          calculation_method,
+			          &calculated_crc32,
+			          buffer,
+			          read_size,
+			          calculated_crc32,
+			          weak_crc,
+			          worker_pool,
+			          &error );
+		}
+		else
+#endif
+		{
+			result = crc32sum_calculate(
+			          calculation_method,
+			          &calculated_crc32,
+			          buffer,
+			          read_size,
+			          calculated_crc32,
+			          weak_crc,
+			          &error );
+		}
+		if( result != 1 )
+		{
+			fprintf(
+			 stderr,
+			 "Unable to calculate CRC-32.\n" );
+
+			goto on_error;
+		}
+		if( libcnotify_verbose != 0 )
+		{
+			libcnotify_print_data(
+			 buffer,
+			 read_size,
+			 0 );
+		}
+		remaining_size -= read_size;
 	}
-	if( libcnotify_verbose != 0 )
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+	if( worker_pool != NULL )
 	{
-		libcnotify_print_data(
-		 buffer,
-		 source_size,
-		 0 );
+		if( assorted_worker_pool_free(
+		     &worker_pool,
+		     &error ) != 1 )
+		{
+			fprintf(
+			 stderr,
+			 "Unable to free worker pool.\n" );
+
+			goto on_error;
+		}
 	}
+#endif
 	fprintf(
 	 stdout,
 	 "Calculated CRC-32: %" PRIu32 " (0x%08" PRIx32 ")\n",
@@ -388,21 +1170,93 @@ int main( int argc, char * const argv[] )
 				 "Single bit-error in bit: %" PRIu8 " of CRC-32\n",
 				 bit_index );
 			}
-			result = crc32_locate_error_offset(
-			          crc32,
-			          calculated_crc32,
-			          buffer,
-			          source_size,
-			          initial_value,
-			          &error );
+			/* Locating the error offset only requires the size of the data
+			 * since the difference between the CRC-32 values does not depend on the data
+			 */
+			if( ( result == 0 )
+			 && ( source_size <= (size64_t) SSIZE_MAX ) )
+			{
+				result = crc32_locate_error_offset(
+				          crc32,
+				          calculated_crc32,
+				          (size_t) source_size,
+				          &first_bit_offset,
+				          &error );
 
-			if( result == -1 )
+				if( result == -1 )
+				{
+					fprintf(
+					 stderr,
+					 "Unable to locate error.\n" );
+
+					goto on_error;
+				}
+				else if( result != 0 )
+				{
+					fprintf(
+					 stdout,
+					 "Single bit-error in bit: %" PRIu64 " of byte at offset: %" PRIi64 " (0x%08" PRIx64 ")\n",
+					 first_bit_offset % 8,
+					 (int64_t) source_offset + (int64_t) ( first_bit_offset / 8 ),
+					 (int64_t) source_offset + (int64_t) ( first_bit_offset / 8 ) );
+				}
+			}
+			/* Double-bit errors are located using a syndrome table of the single-bit errors
+			 */
+			if( ( result == 0 )
+			 && ( source_size <= (size64_t) CRC32_SYNDROME_TABLE_MAXIMUM_DATA_SIZE ) )
 			{
-				fprintf(
-				 stderr,
-				 "Unable to locate error.\n" );
+				if( crc32_syndrome_table_initialize(
+				     &syndrome_table,
+				     (size_t) source_size,
+				     &error ) != 1 )
+				{
+					fprintf(
+					 stderr,
+					 "Unable to create syndrome table.\n" );
 
-				goto on_error;
+					goto on_error;
+				}
+				result = crc32_syndrome_table_locate_double_error_offsets(
+				          syndrome_table,
+				          crc32,
+				          calculated_crc32,
+				          (size_t) source_size,
+				          &first_bit_offset,
+				          &second_bit_offset,
+				          &error );
+
+				if( result == -1 )
+				{
+					fprintf(
+					 stderr,
+					 "Unable to locate error.\n" );
+
+					goto on_error;
+				}
+				else if( result != 0 )
+				{
+					fprintf(
+					 stdout,
+					 "Double bit-error in bit: %" PRIu64 " of byte at offset: %" PRIi64 " (0x%08" PRIx64 ")"
+					 " and bit: %" PRIu64 " of byte at offset: %" PRIi64 " (0x%08" PRIx64 ")\n",
+					 first_bit_offset % 8,
+					 (int64_t) source_offset + (int64_t) ( first_bit_offset / 8 ),
+					 (int64_t) source_offset + (int64_t) ( first_bit_offset / 8 ),
+					 second_bit_offset % 8,
+					 (int64_t) source_offset + (int64_t) ( second_bit_offset / 8 ),
+					 (int64_t) source_offset + (int64_t) ( second_bit_offset / 8 ) );
+				}
+				if( crc32_syndrome_table_free(
+				     &syndrome_table,
+				     &error ) != 1 )
+				{
+					fprintf(
+					 stderr,
+					 "Unable to free syndrome table.\n" );
+
+					goto on_error;
+				}
 			}
 		}
 		else
@@ -414,8 +1268,35 @@ int main( int argc, char * const argv[] )
 			 calculated_crc32 );
 		}
 	}
-	memory_free(
-	 buffer );
+	/* Clean up
+	 */
+	if( assorted_input_file_close(
+	     source_file,
+	     &error ) != 0 )
+	{
+		fprintf(
+		 stderr,
+		 "Unable to close source file.\n" );
+
+		goto on_error;
+	}
+	if( assorted_input_file_free(
+	     &source_file,
+	     &error ) != 1 )
+	{
+		fprintf(
+		 stderr,
+		 "Unable to free source file.\n" );
+
+		goto on_error;
+	}
+	assorted_output_statistics_fprint(
+	 stderr,
+	 program,
+	 1,
+	 NULL );
+	assorted_output_statistics_free(
+	 NULL );
 
 	return( EXIT_SUCCESS );
 
@@ -427,14 +1308,36 @@ on_error:
 		libcerror_error_free(
 		 &error );
 	}
-	if( buffer != NULL )
+	assorted_output_statistics_fprint(
+	 stderr,
+	 program,
+	 -1,
+	 NULL );
+	assorted_output_statistics_free(
+	 NULL );
+	if( batch != NULL )
 	{
-		memory_free(
-		 buffer );
+		assorted_batch_free(
+		 &batch,
+		 NULL );
+	}
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+	if( worker_pool != NULL )
+	{
+		assorted_worker_pool_free(
+		 &worker_pool,
+		 NULL );
+	}
+#endif
+	if( syndrome_table != NULL )
+	{
+		crc32_syndrome_table_free(
+		 &syndrome_table,
+		 NULL );
 	}
 	if( source_file != NULL )
 	{
-		libcfile_file_free(
+		assorted_input_file_free(
 		 &source_file,
 		 NULL );
 	}
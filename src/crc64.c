@@ -20,11 +20,18 @@
  */
 
 #include <common.h>
+#include <byte_stream.h>
 #include <memory.h>
 #include <types.h>
 
 #include "assorted_libcerror.h"
+#include "cpu_features.h"
 #include "crc64.h"
+#include "crc64_tables.h"
+
+#if defined( HAVE_CPU_FEATURES_X86 )
+#include <immintrin.h>
+#endif
 
 /* Table of the CRC-64 of all 8-bit messages.
  * Polynomial: 0x92c64265d32139a4
@@ -166,59 +173,183 @@ uint64_t crc64_table2[ 256 ] = {
 	0x5dedc41a34bbeeb2ULL, 0x1f1d25f19d51d821ULL, 0xd80c07cd676f8394ULL, 0x9afce626ce85b507ULL
 };
 
-/* Value to indicate the CRC-64 table been computed
+/* Polynomials
+ *
+ * CRC-64-ECMA-182 (CRC-64/XZ)
+ * normal:                0x42f0e1eba9ea3693
+ * reversed:              0xc96c5795d7870f42
+ * reverse of reciprocal: 0xa17870f5d4f51b49
+ *
+ * CRC-64-ISO
+ * normal:                0x000000000000001b
+ * reversed:              0xd800000000000000
+ * reverse of reciprocal: 0x800000000000000d
+ *
+ * Default (as used by crc64_calculate_2)
+ * reversed:              0x9a6c9329ac4bc9b5
  */
-int crc64_table_computed = 0;
 
-/* Initializes the internal CRC-64 table
- * The table speeds up the CRC-64 calculation
+/* Tables of the CRC-64 of all 8-bit messages followed by 0 up to 7 zero bytes
+ * and the folding constants for a custom polynomial
  */
-void initialize_crc64_table(
-      uint64_t polynomial )
+uint64_t crc64_custom_slicing_tables[ 8 ][ 256 ];
+uint64_t crc64_custom_folding_constants[ 4 ];
+
+/* The tables of the CRC-64 of all 8-bit messages followed by 0 up to 7 zero bytes
+ * These tables are used to process 1 or 8 bytes per iteration (slicing-by-8)
+ * The tables of the default and ECMA-182 polynomials are static, refer to crc64_tables.c
+ */
+const uint64_t (*crc64_slicing_tables)[ 256 ] = crc64_slicing_tables_default;
+
+/* The constants used to fold the CRC-64 with carry-less multiplication
+ * Consists of x^575, x^511, x^191 and x^127 modulo the polynomial in reversed bit order
+ */
+const uint64_t *crc64_folding_constants = crc64_folding_constants_default;
+
+/* The (reversed) polynomial of the CRC-64 tables
+ */
+uint64_t crc64_table_polynomial = 0x9a6c9329ac4bc9b5ULL;
+
+/* Reverses the bit order of a 64-bit value
+ * Returns the reversed value
+ */
+static uint64_t crc64_reverse_bits(
+                 uint64_t value )
 {
-	uint64_t crc64             = 0;
-	uint64_t crc64_table_index = 0;
-	uint8_t bit_iterator       = 0;
+	uint64_t reversed_value = 0;
+	uint8_t bit_index       = 0;
 
-	memory_set(
-	 crc64_table1,
-	 0,
-	 sizeof( uint64_t ) * 256 );
+	for( bit_index = 0;
+	     bit_index < 64;
+	     bit_index++ )
+	{
+		reversed_value <<= 1;
+		reversed_value  |= value & 1;
+		value          >>= 1;
+	}
+	return( reversed_value );
+}
 
-	for( crc64_table_index = 0;
-	     crc64_table_index < 256;
-	     crc64_table_index++ )
+/* Calculates a folding constant: x^exponent mod P(x) in reversed bit order
+ * Use the normal polynomial, without the x^64 term
+ * Returns the folding constant
+ */
+static uint64_t crc64_calculate_folding_constant(
+                 uint64_t polynomial,
+                 uint16_t exponent )
+{
+	uint64_t remainder = 1;
+
+	while( exponent > 0 )
 	{
-		crc64 = (uint64_t) crc64_table_index;
+		if( ( remainder & 0x8000000000000000ULL ) != 0 )
+		{
+			remainder = ( remainder << 1 ) ^ polynomial;
+		}
+		else
+		{
+			remainder <<= 1;
+		}
+		exponent--;
+	}
+	return( crc64_reverse_bits(
+	         remainder ) );
+}
 
-		for( bit_iterator = 0;
-		     bit_iterator < 8;
-		     bit_iterator++ )
+/* Initializes the internal CRC-64 tables
+ * The tables speed up the CRC-64 calculation
+ * Static tables are used for the default and ECMA-182 polynomials,
+ * for other polynomials the tables are computed
+ * Use the reversed polynomial
+ */
+void initialize_crc64_table(
+      uint64_t polynomial )
+{
+	uint64_t crc64              = 0;
+	uint64_t crc64_table_index  = 0;
+	uint64_t normal_polynomial  = 0;
+	uint8_t bit_iterator        = 0;
+	uint8_t slicing_table_index = 0;
+
+	if( polynomial == crc64_table_polynomial )
+	{
+		return;
+	}
+	if( polynomial == 0x9a6c9329ac4bc9b5ULL )
+	{
+		crc64_slicing_tables    = crc64_slicing_tables_default;
+		crc64_folding_constants = crc64_folding_constants_default;
+	}
+	else if( polynomial == 0xc96c5795d7870f42ULL )
+	{
+		crc64_slicing_tables    = crc64_slicing_tables_ecma182;
+		crc64_folding_constants = crc64_folding_constants_ecma182;
+	}
+	else
+	{
+		for( crc64_table_index = 0;
+		     crc64_table_index < 256;
+		     crc64_table_index++ )
 		{
-			if( ( crc64 & 0x0000000000000001ULL ) != 0 )
+			crc64 = (uint64_t) crc64_table_index;
+
+			for( bit_iterator = 0;
+			     bit_iterator < 8;
+			     bit_iterator++ )
 			{
-				/* If the coefficient is set assume it gets zero'd
-				 * (by implied x^64 coefficient of dividend)
-				 * and add the rest of the divisor.
-				 */
-				crc64 >>= 1;
-				crc64  ^= polynomial;
+				if( ( crc64 & 0x0000000000000001ULL ) != 0 )
+				{
+					/* If the coefficient is set assume it gets zero'd
+					 * (by implied x^64 coefficient of dividend)
+					 * and add the rest of the divisor.
+					 */
+					crc64 >>= 1;
+					crc64  ^= polynomial;
+				}
+				else
+				{
+					crc64 >>= 1;
+				}
 			}
-			else
+			crc64_custom_slicing_tables[ 0 ][ crc64_table_index ] = crc64;
+		}
+		for( crc64_table_index = 0;
+		     crc64_table_index < 256;
+		     crc64_table_index++ )
+		{
+			crc64 = crc64_custom_slicing_tables[ 0 ][ crc64_table_index ];
+
+			for( slicing_table_index = 1;
+			     slicing_table_index < 8;
+			     slicing_table_index++ )
 			{
-				crc64 >>= 1;
+				crc64 = crc64_custom_slicing_tables[ 0 ][ crc64 & 0x00000000000000ffULL ] ^ ( crc64 >> 8 );
+
+				crc64_custom_slicing_tables[ slicing_table_index ][ crc64_table_index ] = crc64;
 			}
 		}
-		crc64_table1[ crc64_table_index ] = crc64;
+		/* The folding distances are 4 x 128-bit and 128-bit, 63 is added to compensate
+		 * for the bit offset of a carry-less multiplication in reversed bit order
+		 */
+		normal_polynomial = crc64_reverse_bits(
+		                     polynomial );
+
+		crc64_custom_folding_constants[ 0 ] = crc64_calculate_folding_constant( normal_polynomial, ( 4 * 128 ) + 63 );
+		crc64_custom_folding_constants[ 1 ] = crc64_calculate_folding_constant( normal_polynomial, ( 4 * 128 ) - 1 );
+		crc64_custom_folding_constants[ 2 ] = crc64_calculate_folding_constant( normal_polynomial, 128 + 63 );
+		crc64_custom_folding_constants[ 3 ] = crc64_calculate_folding_constant( normal_polynomial, 128 - 1 );
+
+		crc64_slicing_tables    = (const uint64_t (*)[ 256 ]) crc64_custom_slicing_tables;
+		crc64_folding_constants = crc64_custom_folding_constants;
 	}
-	crc64_table_computed = 1;
+	crc64_table_polynomial = polynomial;
 
-#ifndef DEBUG_PRINT_TABLE
+#if defined( DEBUG_PRINT_TABLE )
 	for( crc64_table_index = 0;
 	     crc64_table_index < 256;
 	     crc64_table_index++ )
 	{
-		fprintf( stdout, "0x%08" PRIx64 ",", crc64_table1[ crc64_table_index ] );
+		fprintf( stdout, "0x%016" PRIx64 "ULL,", crc64_slicing_tables[ 0 ][ crc64_table_index ] );
 
 		if( ( crc64_table_index % 4 ) == 3 )
 		{
@@ -317,7 +448,6 @@ int crc64_calculate_2(
 	static char *function      = "crc64_calculate";
 	size_t buffer_offset       = 0;
 	uint64_t crc64_table_index = 0;
-	uint64_t polynomial        = 0;
 
 	if( crc64 == NULL )
 	{
@@ -352,49 +482,328 @@ int crc64_calculate_2(
 
 		return( -1 );
 	}
-        if( crc64_table_computed == 0 )
+#ifdef WITH_XOR
+	*crc64 = initial_value ^ (uint64_t) 0xffffffffffffffffULL;
+#else
+	*crc64 = initial_value;
+#endif
+        for( buffer_offset = 0;
+	     buffer_offset < size;
+	     buffer_offset++ )
 	{
-		/* CRC-64-ECMA-182 */
-		polynomial = 0x42f0e1eba9ea3693ULL;
-		polynomial = 0xc96c5795d7870f42ULL;
-		polynomial = 0xa17870f5d4f51b49ULL;
+		crc64_table_index = ( *crc64 ^ buffer[ buffer_offset ] ) & (uint64_t) 0x00000000000000ffULL;
 
-		/* CRC-64-ISO */
-		polynomial = 0x000000000000001bULL;
-		polynomial = 0xd800000000000000ULL;
-		polynomial = 0x800000000000000dULL;
+		*crc64 = crc64_slicing_tables[ 0 ][ crc64_table_index ] ^ ( *crc64 >> 8 );
+        }
+#ifdef WITH_XOR
+	*crc64 ^= 0xffffffffffffffffULL;
+#endif
+	return( 1 );
+}
 
-		/* TEST */
-		polynomial = 0x000000000000001bULL;
-		polynomial = 0x42f0e1eba9ea3693ULL;
-		polynomial = 0x95ac9329ac4bc9b5ULL;
 
-		polynomial = 0xf6fae5c07d3274cdULL;
+/* Updates the CRC-64 with the data of a buffer using the slicing-by-8 lookup tables
+ * The CRC-64 is the internal value, e.g. without the pre and post conditioning
+ * Returns the CRC-64
+ */
+static uint64_t crc64_slicing_by_8_update(
+                 uint64_t crc64,
+                 const uint8_t *buffer,
+                 size_t size )
+{
+	uint64_t value_64bit = 0;
+
+	while( size >= 8 )
+	{
+		byte_stream_copy_to_uint64_little_endian(
+		 buffer,
+		 value_64bit );
 
-		polynomial = 0x92c64265d32139a4ULL;
-		polynomial = 0xc96c5795d7870f42ULL;
+		value_64bit ^= crc64;
 
-		polynomial = 0x9a6c9329ac4bc9b5ULL;
+		crc64 = crc64_slicing_tables[ 7 ][ value_64bit & 0x00000000000000ffULL ]
+		      ^ crc64_slicing_tables[ 6 ][ ( value_64bit >> 8 ) & 0x00000000000000ffULL ]
+		      ^ crc64_slicing_tables[ 5 ][ ( value_64bit >> 16 ) & 0x00000000000000ffULL ]
+		      ^ crc64_slicing_tables[ 4 ][ ( value_64bit >> 24 ) & 0x00000000000000ffULL ]
+		      ^ crc64_slicing_tables[ 3 ][ ( value_64bit >> 32 ) & 0x00000000000000ffULL ]
+		      ^ crc64_slicing_tables[ 2 ][ ( value_64bit >> 40 ) & 0x00000000000000ffULL ]
+		      ^ crc64_slicing_tables[ 1 ][ ( value_64bit >> 48 ) & 0x00000000000000ffULL ]
+		      ^ crc64_slicing_tables[ 0 ][ value_64bit >> 56 ];
 
-		initialize_crc64_table(
-		 polynomial );
+		buffer += 8;
+		size   -= 8;
+	}
+	while( size > 0 )
+	{
+		crc64 = crc64_slicing_tables[ 0 ][ ( crc64 ^ *buffer ) & 0x00000000000000ffULL ] ^ ( crc64 >> 8 );
+
+		buffer += 1;
+		size   -= 1;
+	}
+	return( crc64 );
+}
+
+/* Calculates the CRC-64 of a buffer
+ * Uses the slicing-by-8 lookup tables to process 8 bytes per iteration
+ * The result is equivalent to crc64_calculate_2
+ * Use a previous key of 0 to calculate a new CRC-64
+ * Returns 1 if successful or -1 on error
+ */
+int crc64_calculate_slicing_by_8(
+     uint64_t *crc64,
+     uint8_t *buffer,
+     size_t size,
+     uint64_t initial_value,
+     libcerror_error_t **error )
+{
+	static char *function = "crc64_calculate_slicing_by_8";
+
+	if( crc64 == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid CRC-64.",
+		 function );
+
+		return( -1 );
+	}
+	if( buffer == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid buffer.",
+		 function );
+
+		return( -1 );
+	}
+	if( size > (size_t) SSIZE_MAX )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid size value exceeds maximum.",
+		 function );
+
+		return( -1 );
 	}
 #ifdef WITH_XOR
 	*crc64 = initial_value ^ (uint64_t) 0xffffffffffffffffULL;
 #else
 	*crc64 = initial_value;
 #endif
-        for( buffer_offset = 0;
-	     buffer_offset < size;
-	     buffer_offset++ )
-	{
-		crc64_table_index = ( *crc64 ^ buffer[ buffer_offset ] ) & (uint64_t) 0x00000000000000ffULL;
+	*crc64 = crc64_slicing_by_8_update(
+	          *crc64,
+	          buffer,
+	          size );
 
-		*crc64 = crc64_table1[ crc64_table_index ] ^ ( *crc64 >> 8 );
-        }
 #ifdef WITH_XOR
 	*crc64 ^= 0xffffffffffffffffULL;
 #endif
 	return( 1 );
 }
 
+#if defined( HAVE_CPU_FEATURES_X86 )
+
+/* Folds the data of a buffer using carry-less multiplication (PCLMULQDQ)
+ * The size must be at least 64 and a multiple of 16
+ * The CRC-64 is the internal value, e.g. without the pre and post conditioning
+ * The result is a 128-bit remainder that is congruent to the data, which is stored
+ * in the remainder buffer and is to be reduced by a table based calculation
+ */
+CPU_FEATURES_TARGET( "sse2,pclmul" )
+static void crc64_fold_pclmulqdq(
+             uint64_t crc64,
+             const uint8_t *buffer,
+             size_t size,
+             uint8_t remainder[ 16 ] )
+{
+	__m128i constants;
+	__m128i value1;
+	__m128i value2;
+	__m128i value3;
+	__m128i value4;
+	__m128i value5;
+	__m128i value6;
+	__m128i value7;
+	__m128i value8;
+
+	/* Load the first 64 bytes and the initial value into 4 lanes
+	 */
+	value1 = _mm_loadu_si128( (const __m128i *) &( buffer[ 0 ] ) );
+	value2 = _mm_loadu_si128( (const __m128i *) &( buffer[ 16 ] ) );
+	value3 = _mm_loadu_si128( (const __m128i *) &( buffer[ 32 ] ) );
+	value4 = _mm_loadu_si128( (const __m128i *) &( buffer[ 48 ] ) );
+
+	value1 = _mm_xor_si128( value1, _mm_set_epi32( 0, 0, (int) ( crc64 >> 32 ), (int) ( crc64 & 0xffffffffUL ) ) );
+
+	constants = _mm_loadu_si128( (const __m128i *) &( crc64_folding_constants[ 0 ] ) );
+
+	buffer += 64;
+	size   -= 64;
+
+	/* Fold 64 bytes per iteration
+	 */
+	while( size >= 64 )
+	{
+		value5 = _mm_clmulepi64_si128( value1, constants, 0x00 );
+		value6 = _mm_clmulepi64_si128( value2, constants, 0x00 );
+		value7 = _mm_clmulepi64_si128( value3, constants, 0x00 );
+		value8 = _mm_clmulepi64_si128( value4, constants, 0x00 );
+
+		value1 = _mm_clmulepi64_si128( value1, constants, 0x11 );
+		value2 = _mm_clmulepi64_si128( value2, constants, 0x11 );
+		value3 = _mm_clmulepi64_si128( value3, constants, 0x11 );
+		value4 = _mm_clmulepi64_si128( value4, constants, 0x11 );
+
+		value1 = _mm_xor_si128( value1, value5 );
+		value2 = _mm_xor_si128( value2, value6 );
+		value3 = _mm_xor_si128( value3, value7 );
+		value4 = _mm_xor_si128( value4, value8 );
+
+		value1 = _mm_xor_si128( value1, _mm_loadu_si128( (const __m128i *) &( buffer[ 0 ] ) ) );
+		value2 = _mm_xor_si128( value2, _mm_loadu_si128( (const __m128i *) &( buffer[ 16 ] ) ) );
+		value3 = _mm_xor_si128( value3, _mm_loadu_si128( (const __m128i *) &( buffer[ 32 ] ) ) );
+		value4 = _mm_xor_si128( value4, _mm_loadu_si128( (const __m128i *) &( buffer[ 48 ] ) ) );
+
+		buffer += 64;
+		size   -= 64;
+	}
+	/* Fold the 4 lanes into 1
+	 */
+	constants = _mm_loadu_si128( (const __m128i *) &( crc64_folding_constants[ 2 ] ) );
+
+	value5 = _mm_clmulepi64_si128( value1, constants, 0x00 );
+	value1 = _mm_clmulepi64_si128( value1, constants, 0x11 );
+	value1 = _mm_xor_si128( value1, value2 );
+	value1 = _mm_xor_si128( value1, value5 );
+
+	value5 = _mm_clmulepi64_si128( value1, constants, 0x00 );
+	value1 = _mm_clmulepi64_si128( value1, constants, 0x11 );
+	value1 = _mm_xor_si128( value1, value3 );
+	value1 = _mm_xor_si128( value1, value5 );
+
+	value5 = _mm_clmulepi64_si128( value1, constants, 0x00 );
+	value1 = _mm_clmulepi64_si128( value1, constants, 0x11 );
+	value1 = _mm_xor_si128( value1, value4 );
+	value1 = _mm_xor_si128( value1, value5 );
+
+	/* Fold the remaining 16 byte blocks
+	 */
+	while( size >= 16 )
+	{
+		value5 = _mm_clmulepi64_si128( value1, constants, 0x00 );
+		value1 = _mm_clmulepi64_si128( value1, constants, 0x11 );
+		value1 = _mm_xor_si128( value1, _mm_loadu_si128( (const __m128i *) buffer ) );
+		value1 = _mm_xor_si128( value1, value5 );
+
+		buffer += 16;
+		size   -= 16;
+	}
+	_mm_storeu_si128(
+	 (__m128i *) remainder,
+	 value1 );
+}
+
+#endif /* defined( HAVE_CPU_FEATURES_X86 ) */
+
+/* Calculates the CRC-64 of a buffer
+ * Uses carry-less multiplication (PCLMULQDQ) if available, otherwise falls back to slicing-by-8
+ * The result is equivalent to crc64_calculate_2
+ * Use a previous key of 0 to calculate a new CRC-64
+ * Returns 1 if successful or -1 on error
+ */
+int crc64_calculate_hardware(
+     uint64_t *crc64,
+     uint8_t *buffer,
+     size_t size,
+     uint64_t initial_value,
+     libcerror_error_t **error )
+{
+#if defined( HAVE_CPU_FEATURES_X86 )
+	uint8_t remainder[ 16 ];
+#endif
+
+	static char *function = "crc64_calculate_hardware";
+	size_t buffer_offset  = 0;
+	uint64_t value_64bit  = 0;
+
+	if( crc64 == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid CRC-64.",
+		 function );
+
+		return( -1 );
+	}
+	if( buffer == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid buffer.",
+		 function );
+
+		return( -1 );
+	}
+	if( size > (size_t) SSIZE_MAX )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid size value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+#ifdef WITH_XOR
+	value_64bit = initial_value ^ (uint64_t) 0xffffffffffffffffULL;
+#else
+	value_64bit = initial_value;
+#endif
+
+#if defined( HAVE_CPU_FEATURES_X86 )
+	if( ( size >= 64 )
+	 && ( cpu_features_has(
+	       CPU_FEATURE_FLAG_SSE2 | CPU_FEATURE_FLAG_PCLMULQDQ ) != 0 ) )
+	{
+		buffer_offset = size & ~( (size_t) 15 );
+
+		crc64_fold_pclmulqdq(
+		 value_64bit,
+		 buffer,
+		 buffer_offset,
+		 remainder );
+
+		/* The CRC-64 of the remainder with an initial value of 0 is the CRC-64 of the folded data
+		 */
+		value_64bit = crc64_slicing_by_8_update(
+		               0,
+		               remainder,
+		               16 );
+	}
+#endif
+	/* Calculate the remaining data using slicing-by-8
+	 */
+	value_64bit = crc64_slicing_by_8_update(
+	               value_64bit,
+	               &( buffer[ buffer_offset ] ),
+	               size - buffer_offset );
+
+#ifdef WITH_XOR
+	value_64bit ^= 0xffffffffffffffffULL;
+#endif
+	*crc64 = value_64bit;
+
+	return( 1 );
+}
+
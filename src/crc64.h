@@ -48,6 +48,20 @@ int crc64_calculate_2(
      uint64_t initial_value,
      libcerror_error_t **error );
 
+int crc64_calculate_slicing_by_8(
+     uint64_t *crc64,
+     uint8_t *buffer,
+     size_t size,
+     uint64_t initial_value,
+     libcerror_error_t **error );
+
+int crc64_calculate_hardware(
+     uint64_t *crc64,
+     uint8_t *buffer,
+     size_t size,
+     uint64_t initial_value,
+     libcerror_error_t **error );
+
 #if defined( __cplusplus )
 }
 #endif
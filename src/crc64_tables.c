@@ -0,0 +1,1110 @@
+/*
+ * CRC-64 lookup tables
+ *
+ * This file was generated by scripts/crc_tables.py, do not edit.
+ *
+ * Copyright (C) 2008-2019, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This software is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This software is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this software.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <types.h>
+
+#include "crc64_tables.h"
+
+/* The slicing tables of the default, as used by crc64_calculate_2 polynomial
+ * Polynomial: 0x9a6c9329ac4bc9b5
+ */
+const uint64_t crc64_slicing_tables_default[ 8 ][ 256 ] = {
+	{
+		0x0000000000000000ULL, 0x7f6ef0c830358979ULL, 0xfedde190606b12f2ULL, 0x81b31158505e9b8bULL,
+		0xc962e5739841b68fULL, 0xb60c15bba8743ff6ULL, 0x37bf04e3f82aa47dULL, 0x48d1f42bc81f2d04ULL,
+		0xa61cecb46814fe75ULL, 0xd9721c7c5821770cULL, 0x58c10d24087fec87ULL, 0x27affdec384a65feULL,
+		0x6f7e09c7f05548faULL, 0x1010f90fc060c183ULL, 0x91a3e857903e5a08ULL, 0xeecd189fa00bd371ULL,
+		0x78e0ff3b88be6f81ULL, 0x078e0ff3b88be6f8ULL, 0x863d1eabe8d57d73ULL, 0xf953ee63d8e0f40aULL,
+		0xb1821a4810ffd90eULL, 0xceecea8020ca5077ULL, 0x4f5ffbd87094cbfcULL, 0x30310b1040a14285ULL,
+		0xdefc138fe0aa91f4ULL, 0xa192e347d09f188dULL, 0x2021f21f80c18306ULL, 0x5f4f02d7b0f40a7fULL,
+		0x179ef6fc78eb277bULL, 0x68f0063448deae02ULL, 0xe943176c18803589ULL, 0x962de7a428b5bcf0ULL,
+		0xf1c1fe77117cdf02ULL, 0x8eaf0ebf2149567bULL, 0x0f1c1fe77117cdf0ULL, 0x7072ef2f41224489ULL,
+		0x38a31b04893d698dULL, 0x47cdebccb908e0f4ULL, 0xc67efa94e9567b7fULL, 0xb9100a5cd963f206ULL,
+		0x57dd12c379682177ULL, 0x28b3e20b495da80eULL, 0xa900f35319033385ULL, 0xd66e039b2936bafcULL,
+		0x9ebff7b0e12997f8ULL, 0xe1d10778d11c1e81ULL, 0x606216208142850aULL, 0x1f0ce6e8b1770c73ULL,
+		0x8921014c99c2b083ULL, 0xf64ff184a9f739faULL, 0x77fce0dcf9a9a271ULL, 0x08921014c99c2b08ULL,
+		0x4043e43f0183060cULL, 0x3f2d14f731b68f75ULL, 0xbe9e05af61e814feULL, 0xc1f0f56751dd9d87ULL,
+		0x2f3dedf8f1d64ef6ULL, 0x50531d30c1e3c78fULL, 0xd1e00c6891bd5c04ULL, 0xae8efca0a188d57dULL,
+		0xe65f088b6997f879ULL, 0x9931f84359a27100ULL, 0x1882e91b09fcea8bULL, 0x67ec19d339c963f2ULL,
+		0xd75adabd7a6e2d6fULL, 0xa8342a754a5ba416ULL, 0x29873b2d1a053f9dULL, 0x56e9cbe52a30b6e4ULL,
+		0x1e383fcee22f9be0ULL, 0x6156cf06d21a1299ULL, 0xe0e5de5e82448912ULL, 0x9f8b2e96b271006bULL,
+		0x71463609127ad31aULL, 0x0e28c6c1224f5a63ULL, 0x8f9bd7997211c1e8ULL, 0xf0f5275142244891ULL,
+		0xb824d37a8a3b6595ULL, 0xc74a23b2ba0eececULL, 0x46f932eaea507767ULL, 0x3997c222da65fe1eULL,
+		0xafba2586f2d042eeULL, 0xd0d4d54ec2e5cb97ULL, 0x5167c41692bb501cULL, 0x2e0934dea28ed965ULL,
+		0x66d8c0f56a91f461ULL, 0x19b6303d5aa47d18ULL, 0x980521650afae693ULL, 0xe76bd1ad3acf6feaULL,
+		0x09a6c9329ac4bc9bULL, 0x76c839faaaf135e2ULL, 0xf77b28a2faafae69ULL, 0x8815d86aca9a2710ULL,
+		0xc0c42c4102850a14ULL, 0xbfaadc8932b0836dULL, 0x3e19cdd162ee18e6ULL, 0x41773d1952db919fULL,
+		0x269b24ca6b12f26dULL, 0x59f5d4025b277b14ULL, 0xd846c55a0b79e09fULL, 0xa72835923b4c69e6ULL,
+		0xeff9c1b9f35344e2ULL, 0x90973171c366cd9bULL, 0x1124202993385610ULL, 0x6e4ad0e1a30ddf69ULL,
+		0x8087c87e03060c18ULL, 0xffe938b633338561ULL, 0x7e5a29ee636d1eeaULL, 0x0134d92653589793ULL,
+		0x49e52d0d9b47ba97ULL, 0x368bddc5ab7233eeULL, 0xb738cc9dfb2ca865ULL, 0xc8563c55cb19211cULL,
+		0x5e7bdbf1e3ac9decULL, 0x21152b39d3991495ULL, 0xa0a63a6183c78f1eULL, 0xdfc8caa9b3f20667ULL,
+		0x97193e827bed2b63ULL, 0xe877ce4a4bd8a21aULL, 0x69c4df121b863991ULL, 0x16aa2fda2bb3b0e8ULL,
+		0xf86737458bb86399ULL, 0x8709c78dbb8deae0ULL, 0x06bad6d5ebd3716bULL, 0x79d4261ddbe6f812ULL,
+		0x3105d23613f9d516ULL, 0x4e6b22fe23cc5c6fULL, 0xcfd833a67392c7e4ULL, 0xb0b6c36e43a74e9dULL,
+		0x9a6c9329ac4bc9b5ULL, 0xe50263e19c7e40ccULL, 0x64b172b9cc20db47ULL, 0x1bdf8271fc15523eULL,
+		0x530e765a340a7f3aULL, 0x2c608692043ff643ULL, 0xadd397ca54616dc8ULL, 0xd2bd67026454e4b1ULL,
+		0x3c707f9dc45f37c0ULL, 0x431e8f55f46abeb9ULL, 0xc2ad9e0da4342532ULL, 0xbdc36ec59401ac4bULL,
+		0xf5129aee5c1e814fULL, 0x8a7c6a266c2b0836ULL, 0x0bcf7b7e3c7593bdULL, 0x74a18bb60c401ac4ULL,
+		0xe28c6c1224f5a634ULL, 0x9de29cda14c02f4dULL, 0x1c518d82449eb4c6ULL, 0x633f7d4a74ab3dbfULL,
+		0x2bee8961bcb410bbULL, 0x548079a98c8199c2ULL, 0xd53368f1dcdf0249ULL, 0xaa5d9839ecea8b30ULL,
+		0x449080a64ce15841ULL, 0x3bfe706e7cd4d138ULL, 0xba4d61362c8a4ab3ULL, 0xc52391fe1cbfc3caULL,
+		0x8df265d5d4a0eeceULL, 0xf29c951de49567b7ULL, 0x732f8445b4cbfc3cULL, 0x0c41748d84fe7545ULL,
+		0x6bad6d5ebd3716b7ULL, 0x14c39d968d029fceULL, 0x95708ccedd5c0445ULL, 0xea1e7c06ed698d3cULL,
+		0xa2cf882d2576a038ULL, 0xdda178e515432941ULL, 0x5c1269bd451db2caULL, 0x237c997575283bb3ULL,
+		0xcdb181ead523e8c2ULL, 0xb2df7122e51661bbULL, 0x336c607ab548fa30ULL, 0x4c0290b2857d7349ULL,
+		0x04d364994d625e4dULL, 0x7bbd94517d57d734ULL, 0xfa0e85092d094cbfULL, 0x856075c11d3cc5c6ULL,
+		0x134d926535897936ULL, 0x6c2362ad05bcf04fULL, 0xed9073f555e26bc4ULL, 0x92fe833d65d7e2bdULL,
+		0xda2f7716adc8cfb9ULL, 0xa54187de9dfd46c0ULL, 0x24f29686cda3dd4bULL, 0x5b9c664efd965432ULL,
+		0xb5517ed15d9d8743ULL, 0xca3f8e196da80e3aULL, 0x4b8c9f413df695b1ULL, 0x34e26f890dc31cc8ULL,
+		0x7c339ba2c5dc31ccULL, 0x035d6b6af5e9b8b5ULL, 0x82ee7a32a5b7233eULL, 0xfd808afa9582aa47ULL,
+		0x4d364994d625e4daULL, 0x3258b95ce6106da3ULL, 0xb3eba804b64ef628ULL, 0xcc8558cc867b7f51ULL,
+		0x8454ace74e645255ULL, 0xfb3a5c2f7e51db2cULL, 0x7a894d772e0f40a7ULL, 0x05e7bdbf1e3ac9deULL,
+		0xeb2aa520be311aafULL, 0x944455e88e0493d6ULL, 0x15f744b0de5a085dULL, 0x6a99b478ee6f8124ULL,
+		0x224840532670ac20ULL, 0x5d26b09b16452559ULL, 0xdc95a1c3461bbed2ULL, 0xa3fb510b762e37abULL,
+		0x35d6b6af5e9b8b5bULL, 0x4ab846676eae0222ULL, 0xcb0b573f3ef099a9ULL, 0xb465a7f70ec510d0ULL,
+		0xfcb453dcc6da3dd4ULL, 0x83daa314f6efb4adULL, 0x0269b24ca6b12f26ULL, 0x7d0742849684a65fULL,
+		0x93ca5a1b368f752eULL, 0xeca4aad306bafc57ULL, 0x6d17bb8b56e467dcULL, 0x12794b4366d1eea5ULL,
+		0x5aa8bf68aecec3a1ULL, 0x25c64fa09efb4ad8ULL, 0xa4755ef8cea5d153ULL, 0xdb1bae30fe90582aULL,
+		0xbcf7b7e3c7593bd8ULL, 0xc399472bf76cb2a1ULL, 0x422a5673a732292aULL, 0x3d44a6bb9707a053ULL,
+		0x759552905f188d57ULL, 0x0afba2586f2d042eULL, 0x8b48b3003f739fa5ULL, 0xf42643c80f4616dcULL,
+		0x1aeb5b57af4dc5adULL, 0x6585ab9f9f784cd4ULL, 0xe436bac7cf26d75fULL, 0x9b584a0fff135e26ULL,
+		0xd389be24370c7322ULL, 0xace74eec0739fa5bULL, 0x2d545fb4576761d0ULL, 0x523aaf7c6752e8a9ULL,
+		0xc41748d84fe75459ULL, 0xbb79b8107fd2dd20ULL, 0x3acaa9482f8c46abULL, 0x45a459801fb9cfd2ULL,
+		0x0d75adabd7a6e2d6ULL, 0x721b5d63e7936bafULL, 0xf3a84c3bb7cdf024ULL, 0x8cc6bcf387f8795dULL,
+		0x620ba46c27f3aa2cULL, 0x1d6554a417c62355ULL, 0x9cd645fc4798b8deULL, 0xe3b8b53477ad31a7ULL,
+		0xab69411fbfb21ca3ULL, 0xd407b1d78f8795daULL, 0x55b4a08fdfd90e51ULL, 0x2ada5047efec8728ULL
+	},
+	{
+		0x0000000000000000ULL, 0x8776a97d73bddf69ULL, 0x3a3474a9bfec2db9ULL, 0xbd42ddd4cc51f2d0ULL,
+		0x7468e9537fd85b72ULL, 0xf31e402e0c65841bULL, 0x4e5c9dfac03476cbULL, 0xc92a3487b389a9a2ULL,
+		0xe8d1d2a6ffb0b6e4ULL, 0x6fa77bdb8c0d698dULL, 0xd2e5a60f405c9b5dULL, 0x55930f7233e14434ULL,
+		0x9cb93bf58068ed96ULL, 0x1bcf9288f3d532ffULL, 0xa68d4f5c3f84c02fULL, 0x21fbe6214c391f46ULL,
+		0xe57a831ea7f6fea3ULL, 0x620c2a63d44b21caULL, 0xdf4ef7b7181ad31aULL, 0x58385eca6ba70c73ULL,
+		0x91126a4dd82ea5d1ULL, 0x1664c330ab937ab8ULL, 0xab261ee467c28868ULL, 0x2c50b799147f5701ULL,
+		0x0dab51b858464847ULL, 0x8addf8c52bfb972eULL, 0x379f2511e7aa65feULL, 0xb0e98c6c9417ba97ULL,
+		0x79c3b8eb279e1335ULL, 0xfeb511965423cc5cULL, 0x43f7cc4298723e8cULL, 0xc481653febcfe1e5ULL,
+		0xfe2c206e177a6e2dULL, 0x795a891364c7b144ULL, 0xc41854c7a8964394ULL, 0x436efdbadb2b9cfdULL,
+		0x8a44c93d68a2355fULL, 0x0d3260401b1fea36ULL, 0xb070bd94d74e18e6ULL, 0x370614e9a4f3c78fULL,
+		0x16fdf2c8e8cad8c9ULL, 0x918b5bb59b7707a0ULL, 0x2cc986615726f570ULL, 0xabbf2f1c249b2a19ULL,
+		0x62951b9b971283bbULL, 0xe5e3b2e6e4af5cd2ULL, 0x58a16f3228feae02ULL, 0xdfd7c64f5b43716bULL,
+		0x1b56a370b08c908eULL, 0x9c200a0dc3314fe7ULL, 0x2162d7d90f60bd37ULL, 0xa6147ea47cdd625eULL,
+		0x6f3e4a23cf54cbfcULL, 0xe848e35ebce91495ULL, 0x550a3e8a70b8e645ULL, 0xd27c97f70305392cULL,
+		0xf38771d64f3c266aULL, 0x74f1d8ab3c81f903ULL, 0xc9b3057ff0d00bd3ULL, 0x4ec5ac02836dd4baULL,
+		0x87ef988530e47d18ULL, 0x009931f84359a271ULL, 0xbddbec2c8f0850a1ULL, 0x3aad4551fcb58fc8ULL,
+		0xc881668f76634f31ULL, 0x4ff7cff205de9058ULL, 0xf2b51226c98f6288ULL, 0x75c3bb5bba32bde1ULL,
+		0xbce98fdc09bb1443ULL, 0x3b9f26a17a06cb2aULL, 0x86ddfb75b65739faULL, 0x01ab5208c5eae693ULL,
+		0x2050b42989d3f9d5ULL, 0xa7261d54fa6e26bcULL, 0x1a64c080363fd46cULL, 0x9d1269fd45820b05ULL,
+		0x54385d7af60ba2a7ULL, 0xd34ef40785b67dceULL, 0x6e0c29d349e78f1eULL, 0xe97a80ae3a5a5077ULL,
+		0x2dfbe591d195b192ULL, 0xaa8d4ceca2286efbULL, 0x17cf91386e799c2bULL, 0x90b938451dc44342ULL,
+		0x59930cc2ae4deae0ULL, 0xdee5a5bfddf03589ULL, 0x63a7786b11a1c759ULL, 0xe4d1d116621c1830ULL,
+		0xc52a37372e250776ULL, 0x425c9e4a5d98d81fULL, 0xff1e439e91c92acfULL, 0x7868eae3e274f5a6ULL,
+		0xb142de6451fd5c04ULL, 0x363477192240836dULL, 0x8b76aacdee1171bdULL, 0x0c0003b09dacaed4ULL,
+		0x36ad46e16119211cULL, 0xb1dbef9c12a4fe75ULL, 0x0c993248def50ca5ULL, 0x8bef9b35ad48d3ccULL,
+		0x42c5afb21ec17a6eULL, 0xc5b306cf6d7ca507ULL, 0x78f1db1ba12d57d7ULL, 0xff877266d29088beULL,
+		0xde7c94479ea997f8ULL, 0x590a3d3aed144891ULL, 0xe448e0ee2145ba41ULL, 0x633e499352f86528ULL,
+		0xaa147d14e171cc8aULL, 0x2d62d46992cc13e3ULL, 0x902009bd5e9de133ULL, 0x1756a0c02d203e5aULL,
+		0xd3d7c5ffc6efdfbfULL, 0x54a16c82b55200d6ULL, 0xe9e3b1567903f206ULL, 0x6e95182b0abe2d6fULL,
+		0xa7bf2cacb93784cdULL, 0x20c985d1ca8a5ba4ULL, 0x9d8b580506dba974ULL, 0x1afdf1787566761dULL,
+		0x3b061759395f695bULL, 0xbc70be244ae2b632ULL, 0x013263f086b344e2ULL, 0x8644ca8df50e9b8bULL,
+		0x4f6efe0a46873229ULL, 0xc8185777353aed40ULL, 0x755a8aa3f96b1f90ULL, 0xf22c23de8ad6c0f9ULL,
+		0xa5dbeb4db4510d09ULL, 0x22ad4230c7ecd260ULL, 0x9fef9fe40bbd20b0ULL, 0x189936997800ffd9ULL,
+		0xd1b3021ecb89567bULL, 0x56c5ab63b8348912ULL, 0xeb8776b774657bc2ULL, 0x6cf1dfca07d8a4abULL,
+		0x4d0a39eb4be1bbedULL, 0xca7c9096385c6484ULL, 0x773e4d42f40d9654ULL, 0xf048e43f87b0493dULL,
+		0x3962d0b83439e09fULL, 0xbe1479c547843ff6ULL, 0x0356a4118bd5cd26ULL, 0x84200d6cf868124fULL,
+		0x40a1685313a7f3aaULL, 0xc7d7c12e601a2cc3ULL, 0x7a951cfaac4bde13ULL, 0xfde3b587dff6017aULL,
+		0x34c981006c7fa8d8ULL, 0xb3bf287d1fc277b1ULL, 0x0efdf5a9d3938561ULL, 0x898b5cd4a02e5a08ULL,
+		0xa870baf5ec17454eULL, 0x2f0613889faa9a27ULL, 0x9244ce5c53fb68f7ULL, 0x153267212046b79eULL,
+		0xdc1853a693cf1e3cULL, 0x5b6efadbe072c155ULL, 0xe62c270f2c233385ULL, 0x615a8e725f9eececULL,
+		0x5bf7cb23a32b6324ULL, 0xdc81625ed096bc4dULL, 0x61c3bf8a1cc74e9dULL, 0xe6b516f76f7a91f4ULL,
+		0x2f9f2270dcf33856ULL, 0xa8e98b0daf4ee73fULL, 0x15ab56d9631f15efULL, 0x92ddffa410a2ca86ULL,
+		0xb32619855c9bd5c0ULL, 0x3450b0f82f260aa9ULL, 0x89126d2ce377f879ULL, 0x0e64c45190ca2710ULL,
+		0xc74ef0d623438eb2ULL, 0x403859ab50fe51dbULL, 0xfd7a847f9cafa30bULL, 0x7a0c2d02ef127c62ULL,
+		0xbe8d483d04dd9d87ULL, 0x39fbe140776042eeULL, 0x84b93c94bb31b03eULL, 0x03cf95e9c88c6f57ULL,
+		0xcae5a16e7b05c6f5ULL, 0x4d93081308b8199cULL, 0xf0d1d5c7c4e9eb4cULL, 0x77a77cbab7543425ULL,
+		0x565c9a9bfb6d2b63ULL, 0xd12a33e688d0f40aULL, 0x6c68ee32448106daULL, 0xeb1e474f373cd9b3ULL,
+		0x223473c884b57011ULL, 0xa542dab5f708af78ULL, 0x180007613b595da8ULL, 0x9f76ae1c48e482c1ULL,
+		0x6d5a8dc2c2324238ULL, 0xea2c24bfb18f9d51ULL, 0x576ef96b7dde6f81ULL, 0xd01850160e63b0e8ULL,
+		0x19326491bdea194aULL, 0x9e44cdecce57c623ULL, 0x23061038020634f3ULL, 0xa470b94571bbeb9aULL,
+		0x858b5f643d82f4dcULL, 0x02fdf6194e3f2bb5ULL, 0xbfbf2bcd826ed965ULL, 0x38c982b0f1d3060cULL,
+		0xf1e3b637425aafaeULL, 0x76951f4a31e770c7ULL, 0xcbd7c29efdb68217ULL, 0x4ca16be38e0b5d7eULL,
+		0x88200edc65c4bc9bULL, 0x0f56a7a1167963f2ULL, 0xb2147a75da289122ULL, 0x3562d308a9954e4bULL,
+		0xfc48e78f1a1ce7e9ULL, 0x7b3e4ef269a13880ULL, 0xc67c9326a5f0ca50ULL, 0x410a3a5bd64d1539ULL,
+		0x60f1dc7a9a740a7fULL, 0xe7877507e9c9d516ULL, 0x5ac5a8d3259827c6ULL, 0xddb301ae5625f8afULL,
+		0x14993529e5ac510dULL, 0x93ef9c5496118e64ULL, 0x2ead41805a407cb4ULL, 0xa9dbe8fd29fda3ddULL,
+		0x9376adacd5482c15ULL, 0x140004d1a6f5f37cULL, 0xa942d9056aa401acULL, 0x2e3470781919dec5ULL,
+		0xe71e44ffaa907767ULL, 0x6068ed82d92da80eULL, 0xdd2a3056157c5adeULL, 0x5a5c992b66c185b7ULL,
+		0x7ba77f0a2af89af1ULL, 0xfcd1d67759454598ULL, 0x41930ba39514b748ULL, 0xc6e5a2dee6a96821ULL,
+		0x0fcf96595520c183ULL, 0x88b93f24269d1eeaULL, 0x35fbe2f0eaccec3aULL, 0xb28d4b8d99713353ULL,
+		0x760c2eb272bed2b6ULL, 0xf17a87cf01030ddfULL, 0x4c385a1bcd52ff0fULL, 0xcb4ef366beef2066ULL,
+		0x0264c7e10d6689c4ULL, 0x85126e9c7edb56adULL, 0x3850b348b28aa47dULL, 0xbf261a35c1377b14ULL,
+		0x9eddfc148d0e6452ULL, 0x19ab5569feb3bb3bULL, 0xa4e988bd32e249ebULL, 0x239f21c0415f9682ULL,
+		0xeab51547f2d63f20ULL, 0x6dc3bc3a816be049ULL, 0xd08161ee4d3a1299ULL, 0x57f7c8933e87cdf0ULL
+	},
+	{
+		0x0000000000000000ULL, 0xff6e4e1f4e4038beULL, 0xca05ba6dc417e217ULL, 0x356bf4728a57daa9ULL,
+		0xa0d25288d0b85745ULL, 0x5fbc1c979ef86ffbULL, 0x6ad7e8e514afb552ULL, 0x95b9a6fa5aef8decULL,
+		0x757d8342f9e73de1ULL, 0x8a13cd5db7a7055fULL, 0xbf78392f3df0dff6ULL, 0x4016773073b0e748ULL,
+		0xd5afd1ca295f6aa4ULL, 0x2ac19fd5671f521aULL, 0x1faa6ba7ed4888b3ULL, 0xe0c425b8a308b00dULL,
+		0xeafb0685f3ce7bc2ULL, 0x1595489abd8e437cULL, 0x20febce837d999d5ULL, 0xdf90f2f77999a16bULL,
+		0x4a29540d23762c87ULL, 0xb5471a126d361439ULL, 0x802cee60e761ce90ULL, 0x7f42a07fa921f62eULL,
+		0x9f8685c70a294623ULL, 0x60e8cbd844697e9dULL, 0x55833faace3ea434ULL, 0xaaed71b5807e9c8aULL,
+		0x3f54d74fda911166ULL, 0xc03a995094d129d8ULL, 0xf5516d221e86f371ULL, 0x0a3f233d50c6cbcfULL,
+		0xe12f2b58bf0b64efULL, 0x1e416547f14b5c51ULL, 0x2b2a91357b1c86f8ULL, 0xd444df2a355cbe46ULL,
+		0x41fd79d06fb333aaULL, 0xbe9337cf21f30b14ULL, 0x8bf8c3bdaba4d1bdULL, 0x74968da2e5e4e903ULL,
+		0x9452a81a46ec590eULL, 0x6b3ce60508ac61b0ULL, 0x5e57127782fbbb19ULL, 0xa1395c68ccbb83a7ULL,
+		0x3480fa9296540e4bULL, 0xcbeeb48dd81436f5ULL, 0xfe8540ff5243ec5cULL, 0x01eb0ee01c03d4e2ULL,
+		0x0bd42ddd4cc51f2dULL, 0xf4ba63c202852793ULL, 0xc1d197b088d2fd3aULL, 0x3ebfd9afc692c584ULL,
+		0xab067f559c7d4868ULL, 0x5468314ad23d70d6ULL, 0x6103c538586aaa7fULL, 0x9e6d8b27162a92c1ULL,
+		0x7ea9ae9fb52222ccULL, 0x81c7e080fb621a72ULL, 0xb4ac14f27135c0dbULL, 0x4bc25aed3f75f865ULL,
+		0xde7bfc17659a7589ULL, 0x2115b2082bda4d37ULL, 0x147e467aa18d979eULL, 0xeb100865efcdaf20ULL,
+		0xf68770e226815ab5ULL, 0x09e93efd68c1620bULL, 0x3c82ca8fe296b8a2ULL, 0xc3ec8490acd6801cULL,
+		0x5655226af6390df0ULL, 0xa93b6c75b879354eULL, 0x9c509807322eefe7ULL, 0x633ed6187c6ed759ULL,
+		0x83faf3a0df666754ULL, 0x7c94bdbf91265feaULL, 0x49ff49cd1b718543ULL, 0xb69107d25531bdfdULL,
+		0x2328a1280fde3011ULL, 0xdc46ef37419e08afULL, 0xe92d1b45cbc9d206ULL, 0x1643555a8589eab8ULL,
+		0x1c7c7667d54f2177ULL, 0xe31238789b0f19c9ULL, 0xd679cc0a1158c360ULL, 0x291782155f18fbdeULL,
+		0xbcae24ef05f77632ULL, 0x43c06af04bb74e8cULL, 0x76ab9e82c1e09425ULL, 0x89c5d09d8fa0ac9bULL,
+		0x6901f5252ca81c96ULL, 0x966fbb3a62e82428ULL, 0xa3044f48e8bffe81ULL, 0x5c6a0157a6ffc63fULL,
+		0xc9d3a7adfc104bd3ULL, 0x36bde9b2b250736dULL, 0x03d61dc03807a9c4ULL, 0xfcb853df7647917aULL,
+		0x17a85bba998a3e5aULL, 0xe8c615a5d7ca06e4ULL, 0xddade1d75d9ddc4dULL, 0x22c3afc813dde4f3ULL,
+		0xb77a09324932691fULL, 0x4814472d077251a1ULL, 0x7d7fb35f8d258b08ULL, 0x8211fd40c365b3b6ULL,
+		0x62d5d8f8606d03bbULL, 0x9dbb96e72e2d3b05ULL, 0xa8d06295a47ae1acULL, 0x57be2c8aea3ad912ULL,
+		0xc2078a70b0d554feULL, 0x3d69c46ffe956c40ULL, 0x0802301d74c2b6e9ULL, 0xf76c7e023a828e57ULL,
+		0xfd535d3f6a444598ULL, 0x023d132024047d26ULL, 0x3756e752ae53a78fULL, 0xc838a94de0139f31ULL,
+		0x5d810fb7bafc12ddULL, 0xa2ef41a8f4bc2a63ULL, 0x9784b5da7eebf0caULL, 0x68eafbc530abc874ULL,
+		0x882ede7d93a37879ULL, 0x77409062dde340c7ULL, 0x422b641057b49a6eULL, 0xbd452a0f19f4a2d0ULL,
+		0x28fc8cf5431b2f3cULL, 0xd792c2ea0d5b1782ULL, 0xe2f93698870ccd2bULL, 0x1d977887c94cf595ULL,
+		0xd9d7c79715952601ULL, 0x26b989885bd51ebfULL, 0x13d27dfad182c416ULL, 0xecbc33e59fc2fca8ULL,
+		0x7905951fc52d7144ULL, 0x866bdb008b6d49faULL, 0xb3002f72013a9353ULL, 0x4c6e616d4f7aabedULL,
+		0xacaa44d5ec721be0ULL, 0x53c40acaa232235eULL, 0x66affeb82865f9f7ULL, 0x99c1b0a76625c149ULL,
+		0x0c78165d3cca4ca5ULL, 0xf3165842728a741bULL, 0xc67dac30f8ddaeb2ULL, 0x3913e22fb69d960cULL,
+		0x332cc112e65b5dc3ULL, 0xcc428f0da81b657dULL, 0xf9297b7f224cbfd4ULL, 0x064735606c0c876aULL,
+		0x93fe939a36e30a86ULL, 0x6c90dd8578a33238ULL, 0x59fb29f7f2f4e891ULL, 0xa69567e8bcb4d02fULL,
+		0x465142501fbc6022ULL, 0xb93f0c4f51fc589cULL, 0x8c54f83ddbab8235ULL, 0x733ab62295ebba8bULL,
+		0xe68310d8cf043767ULL, 0x19ed5ec781440fd9ULL, 0x2c86aab50b13d570ULL, 0xd3e8e4aa4553edceULL,
+		0x38f8eccfaa9e42eeULL, 0xc796a2d0e4de7a50ULL, 0xf2fd56a26e89a0f9ULL, 0x0d9318bd20c99847ULL,
+		0x982abe477a2615abULL, 0x6744f05834662d15ULL, 0x522f042abe31f7bcULL, 0xad414a35f071cf02ULL,
+		0x4d856f8d53797f0fULL, 0xb2eb21921d3947b1ULL, 0x8780d5e0976e9d18ULL, 0x78ee9bffd92ea5a6ULL,
+		0xed573d0583c1284aULL, 0x1239731acd8110f4ULL, 0x2752876847d6ca5dULL, 0xd83cc9770996f2e3ULL,
+		0xd203ea4a5950392cULL, 0x2d6da45517100192ULL, 0x180650279d47db3bULL, 0xe7681e38d307e385ULL,
+		0x72d1b8c289e86e69ULL, 0x8dbff6ddc7a856d7ULL, 0xb8d402af4dff8c7eULL, 0x47ba4cb003bfb4c0ULL,
+		0xa77e6908a0b704cdULL, 0x58102717eef73c73ULL, 0x6d7bd36564a0e6daULL, 0x92159d7a2ae0de64ULL,
+		0x07ac3b80700f5388ULL, 0xf8c2759f3e4f6b36ULL, 0xcda981edb418b19fULL, 0x32c7cff2fa588921ULL,
+		0x2f50b77533147cb4ULL, 0xd03ef96a7d54440aULL, 0xe5550d18f7039ea3ULL, 0x1a3b4307b943a61dULL,
+		0x8f82e5fde3ac2bf1ULL, 0x70ecabe2adec134fULL, 0x45875f9027bbc9e6ULL, 0xbae9118f69fbf158ULL,
+		0x5a2d3437caf34155ULL, 0xa5437a2884b379ebULL, 0x90288e5a0ee4a342ULL, 0x6f46c04540a49bfcULL,
+		0xfaff66bf1a4b1610ULL, 0x059128a0540b2eaeULL, 0x30fadcd2de5cf407ULL, 0xcf9492cd901cccb9ULL,
+		0xc5abb1f0c0da0776ULL, 0x3ac5ffef8e9a3fc8ULL, 0x0fae0b9d04cde561ULL, 0xf0c045824a8ddddfULL,
+		0x6579e37810625033ULL, 0x9a17ad675e22688dULL, 0xaf7c5915d475b224ULL, 0x5012170a9a358a9aULL,
+		0xb0d632b2393d3a97ULL, 0x4fb87cad777d0229ULL, 0x7ad388dffd2ad880ULL, 0x85bdc6c0b36ae03eULL,
+		0x1004603ae9856dd2ULL, 0xef6a2e25a7c5556cULL, 0xda01da572d928fc5ULL, 0x256f944863d2b77bULL,
+		0xce7f9c2d8c1f185bULL, 0x3111d232c25f20e5ULL, 0x047a26404808fa4cULL, 0xfb14685f0648c2f2ULL,
+		0x6eadcea55ca74f1eULL, 0x91c380ba12e777a0ULL, 0xa4a874c898b0ad09ULL, 0x5bc63ad7d6f095b7ULL,
+		0xbb021f6f75f825baULL, 0x446c51703bb81d04ULL, 0x7107a502b1efc7adULL, 0x8e69eb1dffafff13ULL,
+		0x1bd04de7a54072ffULL, 0xe4be03f8eb004a41ULL, 0xd1d5f78a615790e8ULL, 0x2ebbb9952f17a856ULL,
+		0x24849aa87fd16399ULL, 0xdbead4b731915b27ULL, 0xee8120c5bbc6818eULL, 0x11ef6edaf586b930ULL,
+		0x8456c820af6934dcULL, 0x7b38863fe1290c62ULL, 0x4e53724d6b7ed6cbULL, 0xb13d3c52253eee75ULL,
+		0x51f919ea86365e78ULL, 0xae9757f5c87666c6ULL, 0x9bfca3874221bc6fULL, 0x6492ed980c6184d1ULL,
+		0xf12b4b62568e093dULL, 0x0e45057d18ce3183ULL, 0x3b2ef10f9299eb2aULL, 0xc440bf10dcd9d394ULL
+	},
+	{
+		0x0000000000000000ULL, 0x8211147cbaf96306ULL, 0x30fb0eaa2d655567ULL, 0xb2ea1ad6979c3661ULL,
+		0x61f61d545acaaaceULL, 0xe3e70928e033c9c8ULL, 0x510d13fe77afffa9ULL, 0xd31c0782cd569cafULL,
+		0xc3ec3aa8b595559cULL, 0x41fd2ed40f6c369aULL, 0xf317340298f000fbULL, 0x7106207e220963fdULL,
+		0xa21a27fcef5fff52ULL, 0x200b338055a69c54ULL, 0x92e12956c23aaa35ULL, 0x10f03d2a78c3c933ULL,
+		0xb301530233bd3853ULL, 0x3110477e89445b55ULL, 0x83fa5da81ed86d34ULL, 0x01eb49d4a4210e32ULL,
+		0xd2f74e566977929dULL, 0x50e65a2ad38ef19bULL, 0xe20c40fc4412c7faULL, 0x601d5480feeba4fcULL,
+		0x70ed69aa86286dcfULL, 0xf2fc7dd63cd10ec9ULL, 0x40166700ab4d38a8ULL, 0xc207737c11b45baeULL,
+		0x111b74fedce2c701ULL, 0x930a6082661ba407ULL, 0x21e07a54f1879266ULL, 0xa3f16e284b7ef160ULL,
+		0x52db80573fede3cdULL, 0xd0ca942b851480cbULL, 0x62208efd1288b6aaULL, 0xe0319a81a871d5acULL,
+		0x332d9d0365274903ULL, 0xb13c897fdfde2a05ULL, 0x03d693a948421c64ULL, 0x81c787d5f2bb7f62ULL,
+		0x9137baff8a78b651ULL, 0x1326ae833081d557ULL, 0xa1ccb455a71de336ULL, 0x23dda0291de48030ULL,
+		0xf0c1a7abd0b21c9fULL, 0x72d0b3d76a4b7f99ULL, 0xc03aa901fdd749f8ULL, 0x422bbd7d472e2afeULL,
+		0xe1dad3550c50db9eULL, 0x63cbc729b6a9b898ULL, 0xd121ddff21358ef9ULL, 0x5330c9839bccedffULL,
+		0x802cce01569a7150ULL, 0x023dda7dec631256ULL, 0xb0d7c0ab7bff2437ULL, 0x32c6d4d7c1064731ULL,
+		0x2236e9fdb9c58e02ULL, 0xa027fd81033ced04ULL, 0x12cde75794a0db65ULL, 0x90dcf32b2e59b863ULL,
+		0x43c0f4a9e30f24ccULL, 0xc1d1e0d559f647caULL, 0x733bfa03ce6a71abULL, 0xf12aee7f749312adULL,
+		0xa5b700ae7fdbc79aULL, 0x27a614d2c522a49cULL, 0x954c0e0452be92fdULL, 0x175d1a78e847f1fbULL,
+		0xc4411dfa25116d54ULL, 0x465009869fe80e52ULL, 0xf4ba135008743833ULL, 0x76ab072cb28d5b35ULL,
+		0x665b3a06ca4e9206ULL, 0xe44a2e7a70b7f100ULL, 0x56a034ace72bc761ULL, 0xd4b120d05dd2a467ULL,
+		0x07ad2752908438c8ULL, 0x85bc332e2a7d5bceULL, 0x375629f8bde16dafULL, 0xb5473d8407180ea9ULL,
+		0x16b653ac4c66ffc9ULL, 0x94a747d0f69f9ccfULL, 0x264d5d066103aaaeULL, 0xa45c497adbfac9a8ULL,
+		0x77404ef816ac5507ULL, 0xf5515a84ac553601ULL, 0x47bb40523bc90060ULL, 0xc5aa542e81306366ULL,
+		0xd55a6904f9f3aa55ULL, 0x574b7d78430ac953ULL, 0xe5a167aed496ff32ULL, 0x67b073d26e6f9c34ULL,
+		0xb4ac7450a339009bULL, 0x36bd602c19c0639dULL, 0x84577afa8e5c55fcULL, 0x06466e8634a536faULL,
+		0xf76c80f940362457ULL, 0x757d9485facf4751ULL, 0xc7978e536d537130ULL, 0x45869a2fd7aa1236ULL,
+		0x969a9dad1afc8e99ULL, 0x148b89d1a005ed9fULL, 0xa66193073799dbfeULL, 0x2470877b8d60b8f8ULL,
+		0x3480ba51f5a371cbULL, 0xb691ae2d4f5a12cdULL, 0x047bb4fbd8c624acULL, 0x866aa087623f47aaULL,
+		0x5576a705af69db05ULL, 0xd767b3791590b803ULL, 0x658da9af820c8e62ULL, 0xe79cbdd338f5ed64ULL,
+		0x446dd3fb738b1c04ULL, 0xc67cc787c9727f02ULL, 0x7496dd515eee4963ULL, 0xf687c92de4172a65ULL,
+		0x259bceaf2941b6caULL, 0xa78adad393b8d5ccULL, 0x1560c0050424e3adULL, 0x9771d479bedd80abULL,
+		0x8781e953c61e4998ULL, 0x0590fd2f7ce72a9eULL, 0xb77ae7f9eb7b1cffULL, 0x356bf38551827ff9ULL,
+		0xe677f4079cd4e356ULL, 0x6466e07b262d8050ULL, 0xd68cfaadb1b1b631ULL, 0x549deed10b48d537ULL,
+		0x7fb7270fa7201c5fULL, 0xfda633731dd97f59ULL, 0x4f4c29a58a454938ULL, 0xcd5d3dd930bc2a3eULL,
+		0x1e413a5bfdeab691ULL, 0x9c502e274713d597ULL, 0x2eba34f1d08fe3f6ULL, 0xacab208d6a7680f0ULL,
+		0xbc5b1da712b549c3ULL, 0x3e4a09dba84c2ac5ULL, 0x8ca0130d3fd01ca4ULL, 0x0eb1077185297fa2ULL,
+		0xddad00f3487fe30dULL, 0x5fbc148ff286800bULL, 0xed560e59651ab66aULL, 0x6f471a25dfe3d56cULL,
+		0xccb6740d949d240cULL, 0x4ea760712e64470aULL, 0xfc4d7aa7b9f8716bULL, 0x7e5c6edb0301126dULL,
+		0xad406959ce578ec2ULL, 0x2f517d2574aeedc4ULL, 0x9dbb67f3e332dba5ULL, 0x1faa738f59cbb8a3ULL,
+		0x0f5a4ea521087190ULL, 0x8d4b5ad99bf11296ULL, 0x3fa1400f0c6d24f7ULL, 0xbdb05473b69447f1ULL,
+		0x6eac53f17bc2db5eULL, 0xecbd478dc13bb858ULL, 0x5e575d5b56a78e39ULL, 0xdc464927ec5eed3fULL,
+		0x2d6ca75898cdff92ULL, 0xaf7db32422349c94ULL, 0x1d97a9f2b5a8aaf5ULL, 0x9f86bd8e0f51c9f3ULL,
+		0x4c9aba0cc207555cULL, 0xce8bae7078fe365aULL, 0x7c61b4a6ef62003bULL, 0xfe70a0da559b633dULL,
+		0xee809df02d58aa0eULL, 0x6c91898c97a1c908ULL, 0xde7b935a003dff69ULL, 0x5c6a8726bac49c6fULL,
+		0x8f7680a4779200c0ULL, 0x0d6794d8cd6b63c6ULL, 0xbf8d8e0e5af755a7ULL, 0x3d9c9a72e00e36a1ULL,
+		0x9e6df45aab70c7c1ULL, 0x1c7ce0261189a4c7ULL, 0xae96faf0861592a6ULL, 0x2c87ee8c3cecf1a0ULL,
+		0xff9be90ef1ba6d0fULL, 0x7d8afd724b430e09ULL, 0xcf60e7a4dcdf3868ULL, 0x4d71f3d866265b6eULL,
+		0x5d81cef21ee5925dULL, 0xdf90da8ea41cf15bULL, 0x6d7ac0583380c73aULL, 0xef6bd4248979a43cULL,
+		0x3c77d3a6442f3893ULL, 0xbe66c7dafed65b95ULL, 0x0c8cdd0c694a6df4ULL, 0x8e9dc970d3b30ef2ULL,
+		0xda0027a1d8fbdbc5ULL, 0x581133dd6202b8c3ULL, 0xeafb290bf59e8ea2ULL, 0x68ea3d774f67eda4ULL,
+		0xbbf63af58231710bULL, 0x39e72e8938c8120dULL, 0x8b0d345faf54246cULL, 0x091c202315ad476aULL,
+		0x19ec1d096d6e8e59ULL, 0x9bfd0975d797ed5fULL, 0x291713a3400bdb3eULL, 0xab0607dffaf2b838ULL,
+		0x781a005d37a42497ULL, 0xfa0b14218d5d4791ULL, 0x48e10ef71ac171f0ULL, 0xcaf01a8ba03812f6ULL,
+		0x690174a3eb46e396ULL, 0xeb1060df51bf8090ULL, 0x59fa7a09c623b6f1ULL, 0xdbeb6e757cdad5f7ULL,
+		0x08f769f7b18c4958ULL, 0x8ae67d8b0b752a5eULL, 0x380c675d9ce91c3fULL, 0xba1d732126107f39ULL,
+		0xaaed4e0b5ed3b60aULL, 0x28fc5a77e42ad50cULL, 0x9a1640a173b6e36dULL, 0x180754ddc94f806bULL,
+		0xcb1b535f04191cc4ULL, 0x490a4723bee07fc2ULL, 0xfbe05df5297c49a3ULL, 0x79f1498993852aa5ULL,
+		0x88dba7f6e7163808ULL, 0x0acab38a5def5b0eULL, 0xb820a95cca736d6fULL, 0x3a31bd20708a0e69ULL,
+		0xe92dbaa2bddc92c6ULL, 0x6b3caede0725f1c0ULL, 0xd9d6b40890b9c7a1ULL, 0x5bc7a0742a40a4a7ULL,
+		0x4b379d5e52836d94ULL, 0xc9268922e87a0e92ULL, 0x7bcc93f47fe638f3ULL, 0xf9dd8788c51f5bf5ULL,
+		0x2ac1800a0849c75aULL, 0xa8d09476b2b0a45cULL, 0x1a3a8ea0252c923dULL, 0x982b9adc9fd5f13bULL,
+		0x3bdaf4f4d4ab005bULL, 0xb9cbe0886e52635dULL, 0x0b21fa5ef9ce553cULL, 0x8930ee224337363aULL,
+		0x5a2ce9a08e61aa95ULL, 0xd83dfddc3498c993ULL, 0x6ad7e70aa304fff2ULL, 0xe8c6f37619fd9cf4ULL,
+		0xf836ce5c613e55c7ULL, 0x7a27da20dbc736c1ULL, 0xc8cdc0f64c5b00a0ULL, 0x4adcd48af6a263a6ULL,
+		0x99c0d3083bf4ff09ULL, 0x1bd1c774810d9c0fULL, 0xa93bdda21691aa6eULL, 0x2b2ac9deac68c968ULL
+	},
+	{
+		0x0000000000000000ULL, 0x373d15f784905d1eULL, 0x6e7a2bef0920ba3cULL, 0x59473e188db0e722ULL,
+		0xdcf457de12417478ULL, 0xebc9422996d12966ULL, 0xb28e7c311b61ce44ULL, 0x85b369c69ff1935aULL,
+		0x8d3189ef7c157b9bULL, 0xba0c9c18f8852685ULL, 0xe34ba2007535c1a7ULL, 0xd476b7f7f1a59cb9ULL,
+		0x51c5de316e540fe3ULL, 0x66f8cbc6eac452fdULL, 0x3fbff5de6774b5dfULL, 0x0882e029e3e4e8c1ULL,
+		0x2eba358da0bd645dULL, 0x1987207a242d3943ULL, 0x40c01e62a99dde61ULL, 0x77fd0b952d0d837fULL,
+		0xf24e6253b2fc1025ULL, 0xc57377a4366c4d3bULL, 0x9c3449bcbbdcaa19ULL, 0xab095c4b3f4cf707ULL,
+		0xa38bbc62dca81fc6ULL, 0x94b6a995583842d8ULL, 0xcdf1978dd588a5faULL, 0xfacc827a5118f8e4ULL,
+		0x7f7febbccee96bbeULL, 0x4842fe4b4a7936a0ULL, 0x1105c053c7c9d182ULL, 0x2638d5a443598c9cULL,
+		0x5d746b1b417ac8baULL, 0x6a497eecc5ea95a4ULL, 0x330e40f4485a7286ULL, 0x04335503ccca2f98ULL,
+		0x81803cc5533bbcc2ULL, 0xb6bd2932d7abe1dcULL, 0xeffa172a5a1b06feULL, 0xd8c702ddde8b5be0ULL,
+		0xd045e2f43d6fb321ULL, 0xe778f703b9ffee3fULL, 0xbe3fc91b344f091dULL, 0x8902dcecb0df5403ULL,
+		0x0cb1b52a2f2ec759ULL, 0x3b8ca0ddabbe9a47ULL, 0x62cb9ec5260e7d65ULL, 0x55f68b32a29e207bULL,
+		0x73ce5e96e1c7ace7ULL, 0x44f34b616557f1f9ULL, 0x1db47579e8e716dbULL, 0x2a89608e6c774bc5ULL,
+		0xaf3a0948f386d89fULL, 0x98071cbf77168581ULL, 0xc14022a7faa662a3ULL, 0xf67d37507e363fbdULL,
+		0xfeffd7799dd2d77cULL, 0xc9c2c28e19428a62ULL, 0x9085fc9694f26d40ULL, 0xa7b8e9611062305eULL,
+		0x220b80a78f93a304ULL, 0x153695500b03fe1aULL, 0x4c71ab4886b31938ULL, 0x7b4cbebf02234426ULL,
+		0xbae8d63682f59174ULL, 0x8dd5c3c10665cc6aULL, 0xd492fdd98bd52b48ULL, 0xe3afe82e0f457656ULL,
+		0x661c81e890b4e50cULL, 0x5121941f1424b812ULL, 0x0866aa0799945f30ULL, 0x3f5bbff01d04022eULL,
+		0x37d95fd9fee0eaefULL, 0x00e44a2e7a70b7f1ULL, 0x59a37436f7c050d3ULL, 0x6e9e61c173500dcdULL,
+		0xeb2d0807eca19e97ULL, 0xdc101df06831c389ULL, 0x855723e8e58124abULL, 0xb26a361f611179b5ULL,
+		0x9452e3bb2248f529ULL, 0xa36ff64ca6d8a837ULL, 0xfa28c8542b684f15ULL, 0xcd15dda3aff8120bULL,
+		0x48a6b46530098151ULL, 0x7f9ba192b499dc4fULL, 0x26dc9f8a39293b6dULL, 0x11e18a7dbdb96673ULL,
+		0x19636a545e5d8eb2ULL, 0x2e5e7fa3dacdd3acULL, 0x771941bb577d348eULL, 0x4024544cd3ed6990ULL,
+		0xc5973d8a4c1cfacaULL, 0xf2aa287dc88ca7d4ULL, 0xabed1665453c40f6ULL, 0x9cd00392c1ac1de8ULL,
+		0xe79cbd2dc38f59ceULL, 0xd0a1a8da471f04d0ULL, 0x89e696c2caafe3f2ULL, 0xbedb83354e3fbeecULL,
+		0x3b68eaf3d1ce2db6ULL, 0x0c55ff04555e70a8ULL, 0x5512c11cd8ee978aULL, 0x622fd4eb5c7eca94ULL,
+		0x6aad34c2bf9a2255ULL, 0x5d9021353b0a7f4bULL, 0x04d71f2db6ba9869ULL, 0x33ea0ada322ac577ULL,
+		0xb659631caddb562dULL, 0x816476eb294b0b33ULL, 0xd82348f3a4fbec11ULL, 0xef1e5d04206bb10fULL,
+		0xc92688a063323d93ULL, 0xfe1b9d57e7a2608dULL, 0xa75ca34f6a1287afULL, 0x9061b6b8ee82dab1ULL,
+		0x15d2df7e717349ebULL, 0x22efca89f5e314f5ULL, 0x7ba8f4917853f3d7ULL, 0x4c95e166fcc3aec9ULL,
+		0x4417014f1f274608ULL, 0x732a14b89bb71b16ULL, 0x2a6d2aa01607fc34ULL, 0x1d503f579297a12aULL,
+		0x98e356910d663270ULL, 0xafde436689f66f6eULL, 0xf6997d7e0446884cULL, 0xc1a4688980d6d552ULL,
+		0x41088a3e5d7cb183ULL, 0x76359fc9d9ecec9dULL, 0x2f72a1d1545c0bbfULL, 0x184fb426d0cc56a1ULL,
+		0x9dfcdde04f3dc5fbULL, 0xaac1c817cbad98e5ULL, 0xf386f60f461d7fc7ULL, 0xc4bbe3f8c28d22d9ULL,
+		0xcc3903d12169ca18ULL, 0xfb041626a5f99706ULL, 0xa243283e28497024ULL, 0x957e3dc9acd92d3aULL,
+		0x10cd540f3328be60ULL, 0x27f041f8b7b8e37eULL, 0x7eb77fe03a08045cULL, 0x498a6a17be985942ULL,
+		0x6fb2bfb3fdc1d5deULL, 0x588faa44795188c0ULL, 0x01c8945cf4e16fe2ULL, 0x36f581ab707132fcULL,
+		0xb346e86def80a1a6ULL, 0x847bfd9a6b10fcb8ULL, 0xdd3cc382e6a01b9aULL, 0xea01d67562304684ULL,
+		0xe283365c81d4ae45ULL, 0xd5be23ab0544f35bULL, 0x8cf91db388f41479ULL, 0xbbc408440c644967ULL,
+		0x3e7761829395da3dULL, 0x094a747517058723ULL, 0x500d4a6d9ab56001ULL, 0x67305f9a1e253d1fULL,
+		0x1c7ce1251c067939ULL, 0x2b41f4d298962427ULL, 0x7206caca1526c305ULL, 0x453bdf3d91b69e1bULL,
+		0xc088b6fb0e470d41ULL, 0xf7b5a30c8ad7505fULL, 0xaef29d140767b77dULL, 0x99cf88e383f7ea63ULL,
+		0x914d68ca601302a2ULL, 0xa6707d3de4835fbcULL, 0xff3743256933b89eULL, 0xc80a56d2eda3e580ULL,
+		0x4db93f14725276daULL, 0x7a842ae3f6c22bc4ULL, 0x23c314fb7b72cce6ULL, 0x14fe010cffe291f8ULL,
+		0x32c6d4a8bcbb1d64ULL, 0x05fbc15f382b407aULL, 0x5cbcff47b59ba758ULL, 0x6b81eab0310bfa46ULL,
+		0xee328376aefa691cULL, 0xd90f96812a6a3402ULL, 0x8048a899a7dad320ULL, 0xb775bd6e234a8e3eULL,
+		0xbff75d47c0ae66ffULL, 0x88ca48b0443e3be1ULL, 0xd18d76a8c98edcc3ULL, 0xe6b0635f4d1e81ddULL,
+		0x63030a99d2ef1287ULL, 0x543e1f6e567f4f99ULL, 0x0d792176dbcfa8bbULL, 0x3a4434815f5ff5a5ULL,
+		0xfbe05c08df8920f7ULL, 0xccdd49ff5b197de9ULL, 0x959a77e7d6a99acbULL, 0xa2a762105239c7d5ULL,
+		0x27140bd6cdc8548fULL, 0x10291e2149580991ULL, 0x496e2039c4e8eeb3ULL, 0x7e5335ce4078b3adULL,
+		0x76d1d5e7a39c5b6cULL, 0x41ecc010270c0672ULL, 0x18abfe08aabce150ULL, 0x2f96ebff2e2cbc4eULL,
+		0xaa258239b1dd2f14ULL, 0x9d1897ce354d720aULL, 0xc45fa9d6b8fd9528ULL, 0xf362bc213c6dc836ULL,
+		0xd55a69857f3444aaULL, 0xe2677c72fba419b4ULL, 0xbb20426a7614fe96ULL, 0x8c1d579df284a388ULL,
+		0x09ae3e5b6d7530d2ULL, 0x3e932bace9e56dccULL, 0x67d415b464558aeeULL, 0x50e90043e0c5d7f0ULL,
+		0x586be06a03213f31ULL, 0x6f56f59d87b1622fULL, 0x3611cb850a01850dULL, 0x012cde728e91d813ULL,
+		0x849fb7b411604b49ULL, 0xb3a2a24395f01657ULL, 0xeae59c5b1840f175ULL, 0xddd889ac9cd0ac6bULL,
+		0xa69437139ef3e84dULL, 0x91a922e41a63b553ULL, 0xc8ee1cfc97d35271ULL, 0xffd3090b13430f6fULL,
+		0x7a6060cd8cb29c35ULL, 0x4d5d753a0822c12bULL, 0x141a4b2285922609ULL, 0x23275ed501027b17ULL,
+		0x2ba5befce2e693d6ULL, 0x1c98ab0b6676cec8ULL, 0x45df9513ebc629eaULL, 0x72e280e46f5674f4ULL,
+		0xf751e922f0a7e7aeULL, 0xc06cfcd57437bab0ULL, 0x992bc2cdf9875d92ULL, 0xae16d73a7d17008cULL,
+		0x882e029e3e4e8c10ULL, 0xbf131769baded10eULL, 0xe6542971376e362cULL, 0xd1693c86b3fe6b32ULL,
+		0x54da55402c0ff868ULL, 0x63e740b7a89fa576ULL, 0x3aa07eaf252f4254ULL, 0x0d9d6b58a1bf1f4aULL,
+		0x051f8b71425bf78bULL, 0x32229e86c6cbaa95ULL, 0x6b65a09e4b7b4db7ULL, 0x5c58b569cfeb10a9ULL,
+		0xd9ebdcaf501a83f3ULL, 0xeed6c958d48adeedULL, 0xb791f740593a39cfULL, 0x80ace2b7ddaa64d1ULL
+	},
+	{
+		0x0000000000000000ULL, 0xe9742a79ef04a5d4ULL, 0xe63172a0869ed8c3ULL, 0x0f4558d9699a7d17ULL,
+		0xf8bbc31255aa22edULL, 0x11cfe96bbaae8739ULL, 0x1e8ab1b2d334fa2eULL, 0xf7fe9bcb3c305ffaULL,
+		0xc5aea077f3c3d6b1ULL, 0x2cda8a0e1cc77365ULL, 0x239fd2d7755d0e72ULL, 0xcaebf8ae9a59aba6ULL,
+		0x3d156365a669f45cULL, 0xd461491c496d5188ULL, 0xdb2411c520f72c9fULL, 0x32503bbccff3894bULL,
+		0xbf8466bcbf103e09ULL, 0x56f04cc550149bddULL, 0x59b5141c398ee6caULL, 0xb0c13e65d68a431eULL,
+		0x473fa5aeeaba1ce4ULL, 0xae4b8fd705beb930ULL, 0xa10ed70e6c24c427ULL, 0x487afd77832061f3ULL,
+		0x7a2ac6cb4cd3e8b8ULL, 0x935eecb2a3d74d6cULL, 0x9c1bb46bca4d307bULL, 0x756f9e12254995afULL,
+		0x829105d91979ca55ULL, 0x6be52fa0f67d6f81ULL, 0x64a077799fe71296ULL, 0x8dd45d0070e3b742ULL,
+		0x4bd1eb2a26b7ef79ULL, 0xa2a5c153c9b34aadULL, 0xade0998aa02937baULL, 0x4494b3f34f2d926eULL,
+		0xb36a2838731dcd94ULL, 0x5a1e02419c196840ULL, 0x555b5a98f5831557ULL, 0xbc2f70e11a87b083ULL,
+		0x8e7f4b5dd57439c8ULL, 0x670b61243a709c1cULL, 0x684e39fd53eae10bULL, 0x813a1384bcee44dfULL,
+		0x76c4884f80de1b25ULL, 0x9fb0a2366fdabef1ULL, 0x90f5faef0640c3e6ULL, 0x7981d096e9446632ULL,
+		0xf4558d9699a7d170ULL, 0x1d21a7ef76a374a4ULL, 0x1264ff361f3909b3ULL, 0xfb10d54ff03dac67ULL,
+		0x0cee4e84cc0df39dULL, 0xe59a64fd23095649ULL, 0xeadf3c244a932b5eULL, 0x03ab165da5978e8aULL,
+		0x31fb2de16a6407c1ULL, 0xd88f07988560a215ULL, 0xd7ca5f41ecfadf02ULL, 0x3ebe753803fe7ad6ULL,
+		0xc940eef33fce252cULL, 0x2034c48ad0ca80f8ULL, 0x2f719c53b950fdefULL, 0xc605b62a5654583bULL,
+		0x97a3d6544d6fdef2ULL, 0x7ed7fc2da26b7b26ULL, 0x7192a4f4cbf10631ULL, 0x98e68e8d24f5a3e5ULL,
+		0x6f18154618c5fc1fULL, 0x866c3f3ff7c159cbULL, 0x892967e69e5b24dcULL, 0x605d4d9f715f8108ULL,
+		0x520d7623beac0843ULL, 0xbb795c5a51a8ad97ULL, 0xb43c04833832d080ULL, 0x5d482efad7367554ULL,
+		0xaab6b531eb062aaeULL, 0x43c29f4804028f7aULL, 0x4c87c7916d98f26dULL, 0xa5f3ede8829c57b9ULL,
+		0x2827b0e8f27fe0fbULL, 0xc1539a911d7b452fULL, 0xce16c24874e13838ULL, 0x2762e8319be59decULL,
+		0xd09c73faa7d5c216ULL, 0x39e8598348d167c2ULL, 0x36ad015a214b1ad5ULL, 0xdfd92b23ce4fbf01ULL,
+		0xed89109f01bc364aULL, 0x04fd3ae6eeb8939eULL, 0x0bb8623f8722ee89ULL, 0xe2cc484668264b5dULL,
+		0x1532d38d541614a7ULL, 0xfc46f9f4bb12b173ULL, 0xf303a12dd288cc64ULL, 0x1a778b543d8c69b0ULL,
+		0xdc723d7e6bd8318bULL, 0x3506170784dc945fULL, 0x3a434fdeed46e948ULL, 0xd33765a702424c9cULL,
+		0x24c9fe6c3e721366ULL, 0xcdbdd415d176b6b2ULL, 0xc2f88cccb8eccba5ULL, 0x2b8ca6b557e86e71ULL,
+		0x19dc9d09981be73aULL, 0xf0a8b770771f42eeULL, 0xffedefa91e853ff9ULL, 0x1699c5d0f1819a2dULL,
+		0xe1675e1bcdb1c5d7ULL, 0x0813746222b56003ULL, 0x07562cbb4b2f1d14ULL, 0xee2206c2a42bb8c0ULL,
+		0x63f65bc2d4c80f82ULL, 0x8a8271bb3bccaa56ULL, 0x85c729625256d741ULL, 0x6cb3031bbd527295ULL,
+		0x9b4d98d081622d6fULL, 0x7239b2a96e6688bbULL, 0x7d7cea7007fcf5acULL, 0x9408c009e8f85078ULL,
+		0xa658fbb5270bd933ULL, 0x4f2cd1ccc80f7ce7ULL, 0x40698915a19501f0ULL, 0xa91da36c4e91a424ULL,
+		0x5ee338a772a1fbdeULL, 0xb79712de9da55e0aULL, 0xb8d24a07f43f231dULL, 0x51a6607e1b3b86c9ULL,
+		0x1b9e8afbc2482e8fULL, 0xf2eaa0822d4c8b5bULL, 0xfdaff85b44d6f64cULL, 0x14dbd222abd25398ULL,
+		0xe32549e997e20c62ULL, 0x0a51639078e6a9b6ULL, 0x05143b49117cd4a1ULL, 0xec601130fe787175ULL,
+		0xde302a8c318bf83eULL, 0x374400f5de8f5deaULL, 0x3801582cb71520fdULL, 0xd175725558118529ULL,
+		0x268be99e6421dad3ULL, 0xcfffc3e78b257f07ULL, 0xc0ba9b3ee2bf0210ULL, 0x29ceb1470dbba7c4ULL,
+		0xa41aec477d581086ULL, 0x4d6ec63e925cb552ULL, 0x422b9ee7fbc6c845ULL, 0xab5fb49e14c26d91ULL,
+		0x5ca12f5528f2326bULL, 0xb5d5052cc7f697bfULL, 0xba905df5ae6ceaa8ULL, 0x53e4778c41684f7cULL,
+		0x61b44c308e9bc637ULL, 0x88c06649619f63e3ULL, 0x87853e9008051ef4ULL, 0x6ef114e9e701bb20ULL,
+		0x990f8f22db31e4daULL, 0x707ba55b3435410eULL, 0x7f3efd825daf3c19ULL, 0x964ad7fbb2ab99cdULL,
+		0x504f61d1e4ffc1f6ULL, 0xb93b4ba80bfb6422ULL, 0xb67e137162611935ULL, 0x5f0a39088d65bce1ULL,
+		0xa8f4a2c3b155e31bULL, 0x418088ba5e5146cfULL, 0x4ec5d06337cb3bd8ULL, 0xa7b1fa1ad8cf9e0cULL,
+		0x95e1c1a6173c1747ULL, 0x7c95ebdff838b293ULL, 0x73d0b30691a2cf84ULL, 0x9aa4997f7ea66a50ULL,
+		0x6d5a02b4429635aaULL, 0x842e28cdad92907eULL, 0x8b6b7014c408ed69ULL, 0x621f5a6d2b0c48bdULL,
+		0xefcb076d5befffffULL, 0x06bf2d14b4eb5a2bULL, 0x09fa75cddd71273cULL, 0xe08e5fb4327582e8ULL,
+		0x1770c47f0e45dd12ULL, 0xfe04ee06e14178c6ULL, 0xf141b6df88db05d1ULL, 0x18359ca667dfa005ULL,
+		0x2a65a71aa82c294eULL, 0xc3118d6347288c9aULL, 0xcc54d5ba2eb2f18dULL, 0x2520ffc3c1b65459ULL,
+		0xd2de6408fd860ba3ULL, 0x3baa4e711282ae77ULL, 0x34ef16a87b18d360ULL, 0xdd9b3cd1941c76b4ULL,
+		0x8c3d5caf8f27f07dULL, 0x654976d6602355a9ULL, 0x6a0c2e0f09b928beULL, 0x83780476e6bd8d6aULL,
+		0x74869fbdda8dd290ULL, 0x9df2b5c435897744ULL, 0x92b7ed1d5c130a53ULL, 0x7bc3c764b317af87ULL,
+		0x4993fcd87ce426ccULL, 0xa0e7d6a193e08318ULL, 0xafa28e78fa7afe0fULL, 0x46d6a401157e5bdbULL,
+		0xb1283fca294e0421ULL, 0x585c15b3c64aa1f5ULL, 0x57194d6aafd0dce2ULL, 0xbe6d671340d47936ULL,
+		0x33b93a133037ce74ULL, 0xdacd106adf336ba0ULL, 0xd58848b3b6a916b7ULL, 0x3cfc62ca59adb363ULL,
+		0xcb02f901659dec99ULL, 0x2276d3788a99494dULL, 0x2d338ba1e303345aULL, 0xc447a1d80c07918eULL,
+		0xf6179a64c3f418c5ULL, 0x1f63b01d2cf0bd11ULL, 0x1026e8c4456ac006ULL, 0xf952c2bdaa6e65d2ULL,
+		0x0eac5976965e3a28ULL, 0xe7d8730f795a9ffcULL, 0xe89d2bd610c0e2ebULL, 0x01e901afffc4473fULL,
+		0xc7ecb785a9901f04ULL, 0x2e989dfc4694bad0ULL, 0x21ddc5252f0ec7c7ULL, 0xc8a9ef5cc00a6213ULL,
+		0x3f577497fc3a3de9ULL, 0xd6235eee133e983dULL, 0xd96606377aa4e52aULL, 0x30122c4e95a040feULL,
+		0x024217f25a53c9b5ULL, 0xeb363d8bb5576c61ULL, 0xe4736552dccd1176ULL, 0x0d074f2b33c9b4a2ULL,
+		0xfaf9d4e00ff9eb58ULL, 0x138dfe99e0fd4e8cULL, 0x1cc8a6408967339bULL, 0xf5bc8c396663964fULL,
+		0x7868d1391680210dULL, 0x911cfb40f98484d9ULL, 0x9e59a399901ef9ceULL, 0x772d89e07f1a5c1aULL,
+		0x80d3122b432a03e0ULL, 0x69a73852ac2ea634ULL, 0x66e2608bc5b4db23ULL, 0x8f964af22ab07ef7ULL,
+		0xbdc6714ee543f7bcULL, 0x54b25b370a475268ULL, 0x5bf703ee63dd2f7fULL, 0xb28329978cd98aabULL,
+		0x457db25cb0e9d551ULL, 0xac0998255fed7085ULL, 0xa34cc0fc36770d92ULL, 0x4a38ea85d973a846ULL
+	},
+	{
+		0x0000000000000000ULL, 0xfc5d27f6bf353971ULL, 0xcc6369be26fde189ULL, 0x303e4e4899c8d8f8ULL,
+		0xac1ff52f156c5079ULL, 0x5042d2d9aa596908ULL, 0x607c9c913391b1f0ULL, 0x9c21bb678ca48881ULL,
+		0x6ce6cc0d724f3399ULL, 0x90bbebfbcd7a0ae8ULL, 0xa085a5b354b2d210ULL, 0x5cd88245eb87eb61ULL,
+		0xc0f93922672363e0ULL, 0x3ca41ed4d8165a91ULL, 0x0c9a509c41de8269ULL, 0xf0c7776afeebbb18ULL,
+		0xd9cd981ae49e6732ULL, 0x2590bfec5bab5e43ULL, 0x15aef1a4c26386bbULL, 0xe9f3d6527d56bfcaULL,
+		0x75d26d35f1f2374bULL, 0x898f4ac34ec70e3aULL, 0xb9b1048bd70fd6c2ULL, 0x45ec237d683aefb3ULL,
+		0xb52b541796d154abULL, 0x497673e129e46ddaULL, 0x79483da9b02cb522ULL, 0x85151a5f0f198c53ULL,
+		0x1934a13883bd04d2ULL, 0xe56986ce3c883da3ULL, 0xd557c886a540e55bULL, 0x290aef701a75dc2aULL,
+		0x8742166691ab5d0fULL, 0x7b1f31902e9e647eULL, 0x4b217fd8b756bc86ULL, 0xb77c582e086385f7ULL,
+		0x2b5de34984c70d76ULL, 0xd700c4bf3bf23407ULL, 0xe73e8af7a23aecffULL, 0x1b63ad011d0fd58eULL,
+		0xeba4da6be3e46e96ULL, 0x17f9fd9d5cd157e7ULL, 0x27c7b3d5c5198f1fULL, 0xdb9a94237a2cb66eULL,
+		0x47bb2f44f6883eefULL, 0xbbe608b249bd079eULL, 0x8bd846fad075df66ULL, 0x7785610c6f40e617ULL,
+		0x5e8f8e7c75353a3dULL, 0xa2d2a98aca00034cULL, 0x92ece7c253c8dbb4ULL, 0x6eb1c034ecfde2c5ULL,
+		0xf2907b5360596a44ULL, 0x0ecd5ca5df6c5335ULL, 0x3ef312ed46a48bcdULL, 0xc2ae351bf991b2bcULL,
+		0x32694271077a09a4ULL, 0xce346587b84f30d5ULL, 0xfe0a2bcf2187e82dULL, 0x02570c399eb2d15cULL,
+		0x9e76b75e121659ddULL, 0x622b90a8ad2360acULL, 0x5215dee034ebb854ULL, 0xae48f9168bde8125ULL,
+		0x3a5d0a9e7bc12975ULL, 0xc6002d68c4f41004ULL, 0xf63e63205d3cc8fcULL, 0x0a6344d6e209f18dULL,
+		0x9642ffb16ead790cULL, 0x6a1fd847d198407dULL, 0x5a21960f48509885ULL, 0xa67cb1f9f765a1f4ULL,
+		0x56bbc693098e1aecULL, 0xaae6e165b6bb239dULL, 0x9ad8af2d2f73fb65ULL, 0x668588db9046c214ULL,
+		0xfaa433bc1ce24a95ULL, 0x06f9144aa3d773e4ULL, 0x36c75a023a1fab1cULL, 0xca9a7df4852a926dULL,
+		0xe39092849f5f4e47ULL, 0x1fcdb572206a7736ULL, 0x2ff3fb3ab9a2afceULL, 0xd3aedccc069796bfULL,
+		0x4f8f67ab8a331e3eULL, 0xb3d2405d3506274fULL, 0x83ec0e15acceffb7ULL, 0x7fb129e313fbc6c6ULL,
+		0x8f765e89ed107ddeULL, 0x732b797f522544afULL, 0x43153737cbed9c57ULL, 0xbf4810c174d8a526ULL,
+		0x2369aba6f87c2da7ULL, 0xdf348c50474914d6ULL, 0xef0ac218de81cc2eULL, 0x1357e5ee61b4f55fULL,
+		0xbd1f1cf8ea6a747aULL, 0x41423b0e555f4d0bULL, 0x717c7546cc9795f3ULL, 0x8d2152b073a2ac82ULL,
+		0x1100e9d7ff062403ULL, 0xed5dce2140331d72ULL, 0xdd638069d9fbc58aULL, 0x213ea79f66cefcfbULL,
+		0xd1f9d0f5982547e3ULL, 0x2da4f70327107e92ULL, 0x1d9ab94bbed8a66aULL, 0xe1c79ebd01ed9f1bULL,
+		0x7de625da8d49179aULL, 0x81bb022c327c2eebULL, 0xb1854c64abb4f613ULL, 0x4dd86b921481cf62ULL,
+		0x64d284e20ef41348ULL, 0x988fa314b1c12a39ULL, 0xa8b1ed5c2809f2c1ULL, 0x54eccaaa973ccbb0ULL,
+		0xc8cd71cd1b984331ULL, 0x3490563ba4ad7a40ULL, 0x04ae18733d65a2b8ULL, 0xf8f33f8582509bc9ULL,
+		0x083448ef7cbb20d1ULL, 0xf4696f19c38e19a0ULL, 0xc45721515a46c158ULL, 0x380a06a7e573f829ULL,
+		0xa42bbdc069d770a8ULL, 0x58769a36d6e249d9ULL, 0x6848d47e4f2a9121ULL, 0x9415f388f01fa850ULL,
+		0x74ba153cf78252eaULL, 0x88e732ca48b76b9bULL, 0xb8d97c82d17fb363ULL, 0x44845b746e4a8a12ULL,
+		0xd8a5e013e2ee0293ULL, 0x24f8c7e55ddb3be2ULL, 0x14c689adc413e31aULL, 0xe89bae5b7b26da6bULL,
+		0x185cd93185cd6173ULL, 0xe401fec73af85802ULL, 0xd43fb08fa33080faULL, 0x286297791c05b98bULL,
+		0xb4432c1e90a1310aULL, 0x481e0be82f94087bULL, 0x782045a0b65cd083ULL, 0x847d62560969e9f2ULL,
+		0xad778d26131c35d8ULL, 0x512aaad0ac290ca9ULL, 0x6114e49835e1d451ULL, 0x9d49c36e8ad4ed20ULL,
+		0x01687809067065a1ULL, 0xfd355fffb9455cd0ULL, 0xcd0b11b7208d8428ULL, 0x315636419fb8bd59ULL,
+		0xc191412b61530641ULL, 0x3dcc66ddde663f30ULL, 0x0df2289547aee7c8ULL, 0xf1af0f63f89bdeb9ULL,
+		0x6d8eb404743f5638ULL, 0x91d393f2cb0a6f49ULL, 0xa1edddba52c2b7b1ULL, 0x5db0fa4cedf78ec0ULL,
+		0xf3f8035a66290fe5ULL, 0x0fa524acd91c3694ULL, 0x3f9b6ae440d4ee6cULL, 0xc3c64d12ffe1d71dULL,
+		0x5fe7f67573455f9cULL, 0xa3bad183cc7066edULL, 0x93849fcb55b8be15ULL, 0x6fd9b83dea8d8764ULL,
+		0x9f1ecf5714663c7cULL, 0x6343e8a1ab53050dULL, 0x537da6e9329bddf5ULL, 0xaf20811f8daee484ULL,
+		0x33013a78010a6c05ULL, 0xcf5c1d8ebe3f5574ULL, 0xff6253c627f78d8cULL, 0x033f743098c2b4fdULL,
+		0x2a359b4082b768d7ULL, 0xd668bcb63d8251a6ULL, 0xe656f2fea44a895eULL, 0x1a0bd5081b7fb02fULL,
+		0x862a6e6f97db38aeULL, 0x7a77499928ee01dfULL, 0x4a4907d1b126d927ULL, 0xb61420270e13e056ULL,
+		0x46d3574df0f85b4eULL, 0xba8e70bb4fcd623fULL, 0x8ab03ef3d605bac7ULL, 0x76ed1905693083b6ULL,
+		0xeacca262e5940b37ULL, 0x169185945aa13246ULL, 0x26afcbdcc369eabeULL, 0xdaf2ec2a7c5cd3cfULL,
+		0x4ee71fa28c437b9fULL, 0xb2ba3854337642eeULL, 0x8284761caabe9a16ULL, 0x7ed951ea158ba367ULL,
+		0xe2f8ea8d992f2be6ULL, 0x1ea5cd7b261a1297ULL, 0x2e9b8333bfd2ca6fULL, 0xd2c6a4c500e7f31eULL,
+		0x2201d3affe0c4806ULL, 0xde5cf45941397177ULL, 0xee62ba11d8f1a98fULL, 0x123f9de767c490feULL,
+		0x8e1e2680eb60187fULL, 0x724301765455210eULL, 0x427d4f3ecd9df9f6ULL, 0xbe2068c872a8c087ULL,
+		0x972a87b868dd1cadULL, 0x6b77a04ed7e825dcULL, 0x5b49ee064e20fd24ULL, 0xa714c9f0f115c455ULL,
+		0x3b3572977db14cd4ULL, 0xc7685561c28475a5ULL, 0xf7561b295b4cad5dULL, 0x0b0b3cdfe479942cULL,
+		0xfbcc4bb51a922f34ULL, 0x07916c43a5a71645ULL, 0x37af220b3c6fcebdULL, 0xcbf205fd835af7ccULL,
+		0x57d3be9a0ffe7f4dULL, 0xab8e996cb0cb463cULL, 0x9bb0d72429039ec4ULL, 0x67edf0d29636a7b5ULL,
+		0xc9a509c41de82690ULL, 0x35f82e32a2dd1fe1ULL, 0x05c6607a3b15c719ULL, 0xf99b478c8420fe68ULL,
+		0x65bafceb088476e9ULL, 0x99e7db1db7b14f98ULL, 0xa9d995552e799760ULL, 0x5584b2a3914cae11ULL,
+		0xa543c5c96fa71509ULL, 0x591ee23fd0922c78ULL, 0x6920ac77495af480ULL, 0x957d8b81f66fcdf1ULL,
+		0x095c30e67acb4570ULL, 0xf5011710c5fe7c01ULL, 0xc53f59585c36a4f9ULL, 0x39627eaee3039d88ULL,
+		0x106891def97641a2ULL, 0xec35b628464378d3ULL, 0xdc0bf860df8ba02bULL, 0x2056df9660be995aULL,
+		0xbc7764f1ec1a11dbULL, 0x402a4307532f28aaULL, 0x70140d4fcae7f052ULL, 0x8c492ab975d2c923ULL,
+		0x7c8e5dd38b39723bULL, 0x80d37a25340c4b4aULL, 0xb0ed346dadc493b2ULL, 0x4cb0139b12f1aac3ULL,
+		0xd091a8fc9e552242ULL, 0x2ccc8f0a21601b33ULL, 0x1cf2c142b8a8c3cbULL, 0xe0afe6b4079dfabaULL
+	},
+	{
+		0x0000000000000000ULL, 0x21e9761e252621acULL, 0x43d2ec3c4a4c4358ULL, 0x623b9a226f6a62f4ULL,
+		0x87a5d878949886b0ULL, 0xa64cae66b1bea71cULL, 0xc4773444ded4c5e8ULL, 0xe59e425afbf2e444ULL,
+		0x3b9296a271a69e0bULL, 0x1a7be0bc5480bfa7ULL, 0x78407a9e3beadd53ULL, 0x59a90c801eccfcffULL,
+		0xbc374edae53e18bbULL, 0x9dde38c4c0183917ULL, 0xffe5a2e6af725be3ULL, 0xde0cd4f88a547a4fULL,
+		0x77252d44e34d3c16ULL, 0x56cc5b5ac66b1dbaULL, 0x34f7c178a9017f4eULL, 0x151eb7668c275ee2ULL,
+		0xf080f53c77d5baa6ULL, 0xd169832252f39b0aULL, 0xb35219003d99f9feULL, 0x92bb6f1e18bfd852ULL,
+		0x4cb7bbe692eba21dULL, 0x6d5ecdf8b7cd83b1ULL, 0x0f6557dad8a7e145ULL, 0x2e8c21c4fd81c0e9ULL,
+		0xcb12639e067324adULL, 0xeafb158023550501ULL, 0x88c08fa24c3f67f5ULL, 0xa929f9bc69194659ULL,
+		0xee4a5a89c69a782cULL, 0xcfa32c97e3bc5980ULL, 0xad98b6b58cd63b74ULL, 0x8c71c0aba9f01ad8ULL,
+		0x69ef82f15202fe9cULL, 0x4806f4ef7724df30ULL, 0x2a3d6ecd184ebdc4ULL, 0x0bd418d33d689c68ULL,
+		0xd5d8cc2bb73ce627ULL, 0xf431ba35921ac78bULL, 0x960a2017fd70a57fULL, 0xb7e35609d85684d3ULL,
+		0x527d145323a46097ULL, 0x7394624d0682413bULL, 0x11aff86f69e823cfULL, 0x30468e714cce0263ULL,
+		0x996f77cd25d7443aULL, 0xb88601d300f16596ULL, 0xdabd9bf16f9b0762ULL, 0xfb54edef4abd26ceULL,
+		0x1ecaafb5b14fc28aULL, 0x3f23d9ab9469e326ULL, 0x5d184389fb0381d2ULL, 0x7cf13597de25a07eULL,
+		0xa2fde16f5471da31ULL, 0x831497717157fb9dULL, 0xe12f0d531e3d9969ULL, 0xc0c67b4d3b1bb8c5ULL,
+		0x25583917c0e95c81ULL, 0x04b14f09e5cf7d2dULL, 0x668ad52b8aa51fd9ULL, 0x4763a335af833e75ULL,
+		0xe84d9340d5a36333ULL, 0xc9a4e55ef085429fULL, 0xab9f7f7c9fef206bULL, 0x8a760962bac901c7ULL,
+		0x6fe84b38413be583ULL, 0x4e013d26641dc42fULL, 0x2c3aa7040b77a6dbULL, 0x0dd3d11a2e518777ULL,
+		0xd3df05e2a405fd38ULL, 0xf23673fc8123dc94ULL, 0x900de9deee49be60ULL, 0xb1e49fc0cb6f9fccULL,
+		0x547add9a309d7b88ULL, 0x7593ab8415bb5a24ULL, 0x17a831a67ad138d0ULL, 0x364147b85ff7197cULL,
+		0x9f68be0436ee5f25ULL, 0xbe81c81a13c87e89ULL, 0xdcba52387ca21c7dULL, 0xfd53242659843dd1ULL,
+		0x18cd667ca276d995ULL, 0x392410628750f839ULL, 0x5b1f8a40e83a9acdULL, 0x7af6fc5ecd1cbb61ULL,
+		0xa4fa28a64748c12eULL, 0x85135eb8626ee082ULL, 0xe728c49a0d048276ULL, 0xc6c1b2842822a3daULL,
+		0x235ff0ded3d0479eULL, 0x02b686c0f6f66632ULL, 0x608d1ce2999c04c6ULL, 0x41646afcbcba256aULL,
+		0x0607c9c913391b1fULL, 0x27eebfd7361f3ab3ULL, 0x45d525f559755847ULL, 0x643c53eb7c5379ebULL,
+		0x81a211b187a19dafULL, 0xa04b67afa287bc03ULL, 0xc270fd8dcdeddef7ULL, 0xe3998b93e8cbff5bULL,
+		0x3d955f6b629f8514ULL, 0x1c7c297547b9a4b8ULL, 0x7e47b35728d3c64cULL, 0x5faec5490df5e7e0ULL,
+		0xba308713f60703a4ULL, 0x9bd9f10dd3212208ULL, 0xf9e26b2fbc4b40fcULL, 0xd80b1d31996d6150ULL,
+		0x7122e48df0742709ULL, 0x50cb9293d55206a5ULL, 0x32f008b1ba386451ULL, 0x13197eaf9f1e45fdULL,
+		0xf6873cf564eca1b9ULL, 0xd76e4aeb41ca8015ULL, 0xb555d0c92ea0e2e1ULL, 0x94bca6d70b86c34dULL,
+		0x4ab0722f81d2b902ULL, 0x6b590431a4f498aeULL, 0x09629e13cb9efa5aULL, 0x288be80deeb8dbf6ULL,
+		0xcd15aa57154a3fb2ULL, 0xecfcdc49306c1e1eULL, 0x8ec7466b5f067ceaULL, 0xaf2e30757a205d46ULL,
+		0xe44200d2f3d1550dULL, 0xc5ab76ccd6f774a1ULL, 0xa790eceeb99d1655ULL, 0x86799af09cbb37f9ULL,
+		0x63e7d8aa6749d3bdULL, 0x420eaeb4426ff211ULL, 0x203534962d0590e5ULL, 0x01dc42880823b149ULL,
+		0xdfd096708277cb06ULL, 0xfe39e06ea751eaaaULL, 0x9c027a4cc83b885eULL, 0xbdeb0c52ed1da9f2ULL,
+		0x58754e0816ef4db6ULL, 0x799c381633c96c1aULL, 0x1ba7a2345ca30eeeULL, 0x3a4ed42a79852f42ULL,
+		0x93672d96109c691bULL, 0xb28e5b8835ba48b7ULL, 0xd0b5c1aa5ad02a43ULL, 0xf15cb7b47ff60befULL,
+		0x14c2f5ee8404efabULL, 0x352b83f0a122ce07ULL, 0x571019d2ce48acf3ULL, 0x76f96fcceb6e8d5fULL,
+		0xa8f5bb34613af710ULL, 0x891ccd2a441cd6bcULL, 0xeb2757082b76b448ULL, 0xcace21160e5095e4ULL,
+		0x2f50634cf5a271a0ULL, 0x0eb91552d084500cULL, 0x6c828f70bfee32f8ULL, 0x4d6bf96e9ac81354ULL,
+		0x0a085a5b354b2d21ULL, 0x2be12c45106d0c8dULL, 0x49dab6677f076e79ULL, 0x6833c0795a214fd5ULL,
+		0x8dad8223a1d3ab91ULL, 0xac44f43d84f58a3dULL, 0xce7f6e1feb9fe8c9ULL, 0xef961801ceb9c965ULL,
+		0x319accf944edb32aULL, 0x1073bae761cb9286ULL, 0x724820c50ea1f072ULL, 0x53a156db2b87d1deULL,
+		0xb63f1481d075359aULL, 0x97d6629ff5531436ULL, 0xf5edf8bd9a3976c2ULL, 0xd4048ea3bf1f576eULL,
+		0x7d2d771fd6061137ULL, 0x5cc40101f320309bULL, 0x3eff9b239c4a526fULL, 0x1f16ed3db96c73c3ULL,
+		0xfa88af67429e9787ULL, 0xdb61d97967b8b62bULL, 0xb95a435b08d2d4dfULL, 0x98b335452df4f573ULL,
+		0x46bfe1bda7a08f3cULL, 0x675697a38286ae90ULL, 0x056d0d81edeccc64ULL, 0x24847b9fc8caedc8ULL,
+		0xc11a39c53338098cULL, 0xe0f34fdb161e2820ULL, 0x82c8d5f979744ad4ULL, 0xa321a3e75c526b78ULL,
+		0x0c0f93922672363eULL, 0x2de6e58c03541792ULL, 0x4fdd7fae6c3e7566ULL, 0x6e3409b0491854caULL,
+		0x8baa4beab2eab08eULL, 0xaa433df497cc9122ULL, 0xc878a7d6f8a6f3d6ULL, 0xe991d1c8dd80d27aULL,
+		0x379d053057d4a835ULL, 0x1674732e72f28999ULL, 0x744fe90c1d98eb6dULL, 0x55a69f1238becac1ULL,
+		0xb038dd48c34c2e85ULL, 0x91d1ab56e66a0f29ULL, 0xf3ea317489006dddULL, 0xd203476aac264c71ULL,
+		0x7b2abed6c53f0a28ULL, 0x5ac3c8c8e0192b84ULL, 0x38f852ea8f734970ULL, 0x191124f4aa5568dcULL,
+		0xfc8f66ae51a78c98ULL, 0xdd6610b07481ad34ULL, 0xbf5d8a921bebcfc0ULL, 0x9eb4fc8c3ecdee6cULL,
+		0x40b82874b4999423ULL, 0x61515e6a91bfb58fULL, 0x036ac448fed5d77bULL, 0x2283b256dbf3f6d7ULL,
+		0xc71df00c20011293ULL, 0xe6f486120527333fULL, 0x84cf1c306a4d51cbULL, 0xa5266a2e4f6b7067ULL,
+		0xe245c91be0e84e12ULL, 0xc3acbf05c5ce6fbeULL, 0xa1972527aaa40d4aULL, 0x807e53398f822ce6ULL,
+		0x65e011637470c8a2ULL, 0x4409677d5156e90eULL, 0x2632fd5f3e3c8bfaULL, 0x07db8b411b1aaa56ULL,
+		0xd9d75fb9914ed019ULL, 0xf83e29a7b468f1b5ULL, 0x9a05b385db029341ULL, 0xbbecc59bfe24b2edULL,
+		0x5e7287c105d656a9ULL, 0x7f9bf1df20f07705ULL, 0x1da06bfd4f9a15f1ULL, 0x3c491de36abc345dULL,
+		0x9560e45f03a57204ULL, 0xb4899241268353a8ULL, 0xd6b2086349e9315cULL, 0xf75b7e7d6ccf10f0ULL,
+		0x12c53c27973df4b4ULL, 0x332c4a39b21bd518ULL, 0x5117d01bdd71b7ecULL, 0x70fea605f8579640ULL,
+		0xaef272fd7203ec0fULL, 0x8f1b04e35725cda3ULL, 0xed209ec1384faf57ULL, 0xccc9e8df1d698efbULL,
+		0x2957aa85e69b6abfULL, 0x08bedc9bc3bd4b13ULL, 0x6a8546b9acd729e7ULL, 0x4b6c30a789f1084bULL
+	}
+};
+
+/* The folding constants of the default, as used by crc64_calculate_2 polynomial
+ */
+const uint64_t crc64_folding_constants_default[ 4 ] = {
+	0x0c32cdb31e18a84aULL, 0x62242240ace5045aULL,
+	0xeadc41fd2ba3d420ULL, 0x21e9761e252621acULL
+};
+
+/* The slicing tables of the ECMA-182 (CRC-64/XZ) polynomial
+ * Polynomial: 0xc96c5795d7870f42
+ */
+const uint64_t crc64_slicing_tables_ecma182[ 8 ][ 256 ] = {
+	{
+		0x0000000000000000ULL, 0xb32e4cbe03a75f6fULL, 0xf4843657a840a05bULL, 0x47aa7ae9abe7ff34ULL,
+		0x7bd0c384ff8f5e33ULL, 0xc8fe8f3afc28015cULL, 0x8f54f5d357cffe68ULL, 0x3c7ab96d5468a107ULL,
+		0xf7a18709ff1ebc66ULL, 0x448fcbb7fcb9e309ULL, 0x0325b15e575e1c3dULL, 0xb00bfde054f94352ULL,
+		0x8c71448d0091e255ULL, 0x3f5f08330336bd3aULL, 0x78f572daa8d1420eULL, 0xcbdb3e64ab761d61ULL,
+		0x7d9ba13851336649ULL, 0xceb5ed8652943926ULL, 0x891f976ff973c612ULL, 0x3a31dbd1fad4997dULL,
+		0x064b62bcaebc387aULL, 0xb5652e02ad1b6715ULL, 0xf2cf54eb06fc9821ULL, 0x41e11855055bc74eULL,
+		0x8a3a2631ae2dda2fULL, 0x39146a8fad8a8540ULL, 0x7ebe1066066d7a74ULL, 0xcd905cd805ca251bULL,
+		0xf1eae5b551a2841cULL, 0x42c4a90b5205db73ULL, 0x056ed3e2f9e22447ULL, 0xb6409f5cfa457b28ULL,
+		0xfb374270a266cc92ULL, 0x48190ecea1c193fdULL, 0x0fb374270a266cc9ULL, 0xbc9d3899098133a6ULL,
+		0x80e781f45de992a1ULL, 0x33c9cd4a5e4ecdceULL, 0x7463b7a3f5a932faULL, 0xc74dfb1df60e6d95ULL,
+		0x0c96c5795d7870f4ULL, 0xbfb889c75edf2f9bULL, 0xf812f32ef538d0afULL, 0x4b3cbf90f69f8fc0ULL,
+		0x774606fda2f72ec7ULL, 0xc4684a43a15071a8ULL, 0x83c230aa0ab78e9cULL, 0x30ec7c140910d1f3ULL,
+		0x86ace348f355aadbULL, 0x3582aff6f0f2f5b4ULL, 0x7228d51f5b150a80ULL, 0xc10699a158b255efULL,
+		0xfd7c20cc0cdaf4e8ULL, 0x4e526c720f7dab87ULL, 0x09f8169ba49a54b3ULL, 0xbad65a25a73d0bdcULL,
+		0x710d64410c4b16bdULL, 0xc22328ff0fec49d2ULL, 0x85895216a40bb6e6ULL, 0x36a71ea8a7ace989ULL,
+		0x0adda7c5f3c4488eULL, 0xb9f3eb7bf06317e1ULL, 0xfe5991925b84e8d5ULL, 0x4d77dd2c5823b7baULL,
+		0x64b62bcaebc387a1ULL, 0xd7986774e864d8ceULL, 0x90321d9d438327faULL, 0x231c512340247895ULL,
+		0x1f66e84e144cd992ULL, 0xac48a4f017eb86fdULL, 0xebe2de19bc0c79c9ULL, 0x58cc92a7bfab26a6ULL,
+		0x9317acc314dd3bc7ULL, 0x2039e07d177a64a8ULL, 0x67939a94bc9d9b9cULL, 0xd4bdd62abf3ac4f3ULL,
+		0xe8c76f47eb5265f4ULL, 0x5be923f9e8f53a9bULL, 0x1c4359104312c5afULL, 0xaf6d15ae40b59ac0ULL,
+		0x192d8af2baf0e1e8ULL, 0xaa03c64cb957be87ULL, 0xeda9bca512b041b3ULL, 0x5e87f01b11171edcULL,
+		0x62fd4976457fbfdbULL, 0xd1d305c846d8e0b4ULL, 0x96797f21ed3f1f80ULL, 0x2557339fee9840efULL,
+		0xee8c0dfb45ee5d8eULL, 0x5da24145464902e1ULL, 0x1a083bacedaefdd5ULL, 0xa9267712ee09a2baULL,
+		0x955cce7fba6103bdULL, 0x267282c1b9c65cd2ULL, 0x61d8f8281221a3e6ULL, 0xd2f6b4961186fc89ULL,
+		0x9f8169ba49a54b33ULL, 0x2caf25044a02145cULL, 0x6b055fede1e5eb68ULL, 0xd82b1353e242b407ULL,
+		0xe451aa3eb62a1500ULL, 0x577fe680b58d4a6fULL, 0x10d59c691e6ab55bULL, 0xa3fbd0d71dcdea34ULL,
+		0x6820eeb3b6bbf755ULL, 0xdb0ea20db51ca83aULL, 0x9ca4d8e41efb570eULL, 0x2f8a945a1d5c0861ULL,
+		0x13f02d374934a966ULL, 0xa0de61894a93f609ULL, 0xe7741b60e174093dULL, 0x545a57dee2d35652ULL,
+		0xe21ac88218962d7aULL, 0x5134843c1b317215ULL, 0x169efed5b0d68d21ULL, 0xa5b0b26bb371d24eULL,
+		0x99ca0b06e7197349ULL, 0x2ae447b8e4be2c26ULL, 0x6d4e3d514f59d312ULL, 0xde6071ef4cfe8c7dULL,
+		0x15bb4f8be788911cULL, 0xa6950335e42fce73ULL, 0xe13f79dc4fc83147ULL, 0x521135624c6f6e28ULL,
+		0x6e6b8c0f1807cf2fULL, 0xdd45c0b11ba09040ULL, 0x9aefba58b0476f74ULL, 0x29c1f6e6b3e0301bULL,
+		0xc96c5795d7870f42ULL, 0x7a421b2bd420502dULL, 0x3de861c27fc7af19ULL, 0x8ec62d7c7c60f076ULL,
+		0xb2bc941128085171ULL, 0x0192d8af2baf0e1eULL, 0x4638a2468048f12aULL, 0xf516eef883efae45ULL,
+		0x3ecdd09c2899b324ULL, 0x8de39c222b3eec4bULL, 0xca49e6cb80d9137fULL, 0x7967aa75837e4c10ULL,
+		0x451d1318d716ed17ULL, 0xf6335fa6d4b1b278ULL, 0xb199254f7f564d4cULL, 0x02b769f17cf11223ULL,
+		0xb4f7f6ad86b4690bULL, 0x07d9ba1385133664ULL, 0x4073c0fa2ef4c950ULL, 0xf35d8c442d53963fULL,
+		0xcf273529793b3738ULL, 0x7c0979977a9c6857ULL, 0x3ba3037ed17b9763ULL, 0x888d4fc0d2dcc80cULL,
+		0x435671a479aad56dULL, 0xf0783d1a7a0d8a02ULL, 0xb7d247f3d1ea7536ULL, 0x04fc0b4dd24d2a59ULL,
+		0x3886b22086258b5eULL, 0x8ba8fe9e8582d431ULL, 0xcc0284772e652b05ULL, 0x7f2cc8c92dc2746aULL,
+		0x325b15e575e1c3d0ULL, 0x8175595b76469cbfULL, 0xc6df23b2dda1638bULL, 0x75f16f0cde063ce4ULL,
+		0x498bd6618a6e9de3ULL, 0xfaa59adf89c9c28cULL, 0xbd0fe036222e3db8ULL, 0x0e21ac88218962d7ULL,
+		0xc5fa92ec8aff7fb6ULL, 0x76d4de52895820d9ULL, 0x317ea4bb22bfdfedULL, 0x8250e80521188082ULL,
+		0xbe2a516875702185ULL, 0x0d041dd676d77eeaULL, 0x4aae673fdd3081deULL, 0xf9802b81de97deb1ULL,
+		0x4fc0b4dd24d2a599ULL, 0xfceef8632775faf6ULL, 0xbb44828a8c9205c2ULL, 0x086ace348f355aadULL,
+		0x34107759db5dfbaaULL, 0x873e3be7d8faa4c5ULL, 0xc094410e731d5bf1ULL, 0x73ba0db070ba049eULL,
+		0xb86133d4dbcc19ffULL, 0x0b4f7f6ad86b4690ULL, 0x4ce50583738cb9a4ULL, 0xffcb493d702be6cbULL,
+		0xc3b1f050244347ccULL, 0x709fbcee27e418a3ULL, 0x3735c6078c03e797ULL, 0x841b8ab98fa4b8f8ULL,
+		0xadda7c5f3c4488e3ULL, 0x1ef430e13fe3d78cULL, 0x595e4a08940428b8ULL, 0xea7006b697a377d7ULL,
+		0xd60abfdbc3cbd6d0ULL, 0x6524f365c06c89bfULL, 0x228e898c6b8b768bULL, 0x91a0c532682c29e4ULL,
+		0x5a7bfb56c35a3485ULL, 0xe955b7e8c0fd6beaULL, 0xaeffcd016b1a94deULL, 0x1dd181bf68bdcbb1ULL,
+		0x21ab38d23cd56ab6ULL, 0x9285746c3f7235d9ULL, 0xd52f0e859495caedULL, 0x6601423b97329582ULL,
+		0xd041dd676d77eeaaULL, 0x636f91d96ed0b1c5ULL, 0x24c5eb30c5374ef1ULL, 0x97eba78ec690119eULL,
+		0xab911ee392f8b099ULL, 0x18bf525d915feff6ULL, 0x5f1528b43ab810c2ULL, 0xec3b640a391f4fadULL,
+		0x27e05a6e926952ccULL, 0x94ce16d091ce0da3ULL, 0xd3646c393a29f297ULL, 0x604a2087398eadf8ULL,
+		0x5c3099ea6de60cffULL, 0xef1ed5546e415390ULL, 0xa8b4afbdc5a6aca4ULL, 0x1b9ae303c601f3cbULL,
+		0x56ed3e2f9e224471ULL, 0xe5c372919d851b1eULL, 0xa26908783662e42aULL, 0x114744c635c5bb45ULL,
+		0x2d3dfdab61ad1a42ULL, 0x9e13b115620a452dULL, 0xd9b9cbfcc9edba19ULL, 0x6a978742ca4ae576ULL,
+		0xa14cb926613cf817ULL, 0x1262f598629ba778ULL, 0x55c88f71c97c584cULL, 0xe6e6c3cfcadb0723ULL,
+		0xda9c7aa29eb3a624ULL, 0x69b2361c9d14f94bULL, 0x2e184cf536f3067fULL, 0x9d36004b35545910ULL,
+		0x2b769f17cf112238ULL, 0x9858d3a9ccb67d57ULL, 0xdff2a94067518263ULL, 0x6cdce5fe64f6dd0cULL,
+		0x50a65c93309e7c0bULL, 0xe388102d33392364ULL, 0xa4226ac498dedc50ULL, 0x170c267a9b79833fULL,
+		0xdcd7181e300f9e5eULL, 0x6ff954a033a8c131ULL, 0x28532e49984f3e05ULL, 0x9b7d62f79be8616aULL,
+		0xa707db9acf80c06dULL, 0x14299724cc279f02ULL, 0x5383edcd67c06036ULL, 0xe0ada17364673f59ULL
+	},
+	{
+		0x0000000000000000ULL, 0x54e979925cd0f10dULL, 0xa9d2f324b9a1e21aULL, 0xfd3b8ab6e5711317ULL,
+		0xc17d4962dc4ddab1ULL, 0x959430f0809d2bbcULL, 0x68afba4665ec38abULL, 0x3c46c3d4393cc9a6ULL,
+		0x10223dee1795abe7ULL, 0x44cb447c4b455aeaULL, 0xb9f0cecaae3449fdULL, 0xed19b758f2e4b8f0ULL,
+		0xd15f748ccbd87156ULL, 0x85b60d1e9708805bULL, 0x788d87a87279934cULL, 0x2c64fe3a2ea96241ULL,
+		0x20447bdc2f2b57ceULL, 0x74ad024e73fba6c3ULL, 0x899688f8968ab5d4ULL, 0xdd7ff16aca5a44d9ULL,
+		0xe13932bef3668d7fULL, 0xb5d04b2cafb67c72ULL, 0x48ebc19a4ac76f65ULL, 0x1c02b80816179e68ULL,
+		0x3066463238befc29ULL, 0x648f3fa0646e0d24ULL, 0x99b4b516811f1e33ULL, 0xcd5dcc84ddcfef3eULL,
+		0xf11b0f50e4f32698ULL, 0xa5f276c2b823d795ULL, 0x58c9fc745d52c482ULL, 0x0c2085e60182358fULL,
+		0x4088f7b85e56af9cULL, 0x14618e2a02865e91ULL, 0xe95a049ce7f74d86ULL, 0xbdb37d0ebb27bc8bULL,
+		0x81f5beda821b752dULL, 0xd51cc748decb8420ULL, 0x28274dfe3bba9737ULL, 0x7cce346c676a663aULL,
+		0x50aaca5649c3047bULL, 0x0443b3c41513f576ULL, 0xf9783972f062e661ULL, 0xad9140e0acb2176cULL,
+		0x91d78334958edecaULL, 0xc53efaa6c95e2fc7ULL, 0x380570102c2f3cd0ULL, 0x6cec098270ffcdddULL,
+		0x60cc8c64717df852ULL, 0x3425f5f62dad095fULL, 0xc91e7f40c8dc1a48ULL, 0x9df706d2940ceb45ULL,
+		0xa1b1c506ad3022e3ULL, 0xf558bc94f1e0d3eeULL, 0x086336221491c0f9ULL, 0x5c8a4fb0484131f4ULL,
+		0x70eeb18a66e853b5ULL, 0x2407c8183a38a2b8ULL, 0xd93c42aedf49b1afULL, 0x8dd53b3c839940a2ULL,
+		0xb193f8e8baa58904ULL, 0xe57a817ae6757809ULL, 0x18410bcc03046b1eULL, 0x4ca8725e5fd49a13ULL,
+		0x8111ef70bcad5f38ULL, 0xd5f896e2e07dae35ULL, 0x28c31c54050cbd22ULL, 0x7c2a65c659dc4c2fULL,
+		0x406ca61260e08589ULL, 0x1485df803c307484ULL, 0xe9be5536d9416793ULL, 0xbd572ca48591969eULL,
+		0x9133d29eab38f4dfULL, 0xc5daab0cf7e805d2ULL, 0x38e121ba129916c5ULL, 0x6c0858284e49e7c8ULL,
+		0x504e9bfc77752e6eULL, 0x04a7e26e2ba5df63ULL, 0xf99c68d8ced4cc74ULL, 0xad75114a92043d79ULL,
+		0xa15594ac938608f6ULL, 0xf5bced3ecf56f9fbULL, 0x088767882a27eaecULL, 0x5c6e1e1a76f71be1ULL,
+		0x6028ddce4fcbd247ULL, 0x34c1a45c131b234aULL, 0xc9fa2eeaf66a305dULL, 0x9d135778aabac150ULL,
+		0xb177a9428413a311ULL, 0xe59ed0d0d8c3521cULL, 0x18a55a663db2410bULL, 0x4c4c23f46162b006ULL,
+		0x700ae020585e79a0ULL, 0x24e399b2048e88adULL, 0xd9d81304e1ff9bbaULL, 0x8d316a96bd2f6ab7ULL,
+		0xc19918c8e2fbf0a4ULL, 0x9570615abe2b01a9ULL, 0x684bebec5b5a12beULL, 0x3ca2927e078ae3b3ULL,
+		0x00e451aa3eb62a15ULL, 0x540d28386266db18ULL, 0xa936a28e8717c80fULL, 0xfddfdb1cdbc73902ULL,
+		0xd1bb2526f56e5b43ULL, 0x85525cb4a9beaa4eULL, 0x7869d6024ccfb959ULL, 0x2c80af90101f4854ULL,
+		0x10c66c44292381f2ULL, 0x442f15d675f370ffULL, 0xb9149f60908263e8ULL, 0xedfde6f2cc5292e5ULL,
+		0xe1dd6314cdd0a76aULL, 0xb5341a8691005667ULL, 0x480f903074714570ULL, 0x1ce6e9a228a1b47dULL,
+		0x20a02a76119d7ddbULL, 0x744953e44d4d8cd6ULL, 0x8972d952a83c9fc1ULL, 0xdd9ba0c0f4ec6eccULL,
+		0xf1ff5efada450c8dULL, 0xa51627688695fd80ULL, 0x582dadde63e4ee97ULL, 0x0cc4d44c3f341f9aULL,
+		0x308217980608d63cULL, 0x646b6e0a5ad82731ULL, 0x9950e4bcbfa93426ULL, 0xcdb99d2ee379c52bULL,
+		0x90fb71cad654a0f5ULL, 0xc41208588a8451f8ULL, 0x392982ee6ff542efULL, 0x6dc0fb7c3325b3e2ULL,
+		0x518638a80a197a44ULL, 0x056f413a56c98b49ULL, 0xf854cb8cb3b8985eULL, 0xacbdb21eef686953ULL,
+		0x80d94c24c1c10b12ULL, 0xd43035b69d11fa1fULL, 0x290bbf007860e908ULL, 0x7de2c69224b01805ULL,
+		0x41a405461d8cd1a3ULL, 0x154d7cd4415c20aeULL, 0xe876f662a42d33b9ULL, 0xbc9f8ff0f8fdc2b4ULL,
+		0xb0bf0a16f97ff73bULL, 0xe4567384a5af0636ULL, 0x196df93240de1521ULL, 0x4d8480a01c0ee42cULL,
+		0x71c2437425322d8aULL, 0x252b3ae679e2dc87ULL, 0xd810b0509c93cf90ULL, 0x8cf9c9c2c0433e9dULL,
+		0xa09d37f8eeea5cdcULL, 0xf4744e6ab23aadd1ULL, 0x094fc4dc574bbec6ULL, 0x5da6bd4e0b9b4fcbULL,
+		0x61e07e9a32a7866dULL, 0x350907086e777760ULL, 0xc8328dbe8b066477ULL, 0x9cdbf42cd7d6957aULL,
+		0xd073867288020f69ULL, 0x849affe0d4d2fe64ULL, 0x79a1755631a3ed73ULL, 0x2d480cc46d731c7eULL,
+		0x110ecf10544fd5d8ULL, 0x45e7b682089f24d5ULL, 0xb8dc3c34edee37c2ULL, 0xec3545a6b13ec6cfULL,
+		0xc051bb9c9f97a48eULL, 0x94b8c20ec3475583ULL, 0x698348b826364694ULL, 0x3d6a312a7ae6b799ULL,
+		0x012cf2fe43da7e3fULL, 0x55c58b6c1f0a8f32ULL, 0xa8fe01dafa7b9c25ULL, 0xfc177848a6ab6d28ULL,
+		0xf037fdaea72958a7ULL, 0xa4de843cfbf9a9aaULL, 0x59e50e8a1e88babdULL, 0x0d0c771842584bb0ULL,
+		0x314ab4cc7b648216ULL, 0x65a3cd5e27b4731bULL, 0x989847e8c2c5600cULL, 0xcc713e7a9e159101ULL,
+		0xe015c040b0bcf340ULL, 0xb4fcb9d2ec6c024dULL, 0x49c73364091d115aULL, 0x1d2e4af655cde057ULL,
+		0x216889226cf129f1ULL, 0x7581f0b03021d8fcULL, 0x88ba7a06d550cbebULL, 0xdc53039489803ae6ULL,
+		0x11ea9eba6af9ffcdULL, 0x4503e72836290ec0ULL, 0xb8386d9ed3581dd7ULL, 0xecd1140c8f88ecdaULL,
+		0xd097d7d8b6b4257cULL, 0x847eae4aea64d471ULL, 0x794524fc0f15c766ULL, 0x2dac5d6e53c5366bULL,
+		0x01c8a3547d6c542aULL, 0x5521dac621bca527ULL, 0xa81a5070c4cdb630ULL, 0xfcf329e2981d473dULL,
+		0xc0b5ea36a1218e9bULL, 0x945c93a4fdf17f96ULL, 0x6967191218806c81ULL, 0x3d8e608044509d8cULL,
+		0x31aee56645d2a803ULL, 0x65479cf41902590eULL, 0x987c1642fc734a19ULL, 0xcc956fd0a0a3bb14ULL,
+		0xf0d3ac04999f72b2ULL, 0xa43ad596c54f83bfULL, 0x59015f20203e90a8ULL, 0x0de826b27cee61a5ULL,
+		0x218cd888524703e4ULL, 0x7565a11a0e97f2e9ULL, 0x885e2bacebe6e1feULL, 0xdcb7523eb73610f3ULL,
+		0xe0f191ea8e0ad955ULL, 0xb418e878d2da2858ULL, 0x492362ce37ab3b4fULL, 0x1dca1b5c6b7bca42ULL,
+		0x5162690234af5051ULL, 0x058b1090687fa15cULL, 0xf8b09a268d0eb24bULL, 0xac59e3b4d1de4346ULL,
+		0x901f2060e8e28ae0ULL, 0xc4f659f2b4327bedULL, 0x39cdd344514368faULL, 0x6d24aad60d9399f7ULL,
+		0x414054ec233afbb6ULL, 0x15a92d7e7fea0abbULL, 0xe892a7c89a9b19acULL, 0xbc7bde5ac64be8a1ULL,
+		0x803d1d8eff772107ULL, 0xd4d4641ca3a7d00aULL, 0x29efeeaa46d6c31dULL, 0x7d0697381a063210ULL,
+		0x712612de1b84079fULL, 0x25cf6b4c4754f692ULL, 0xd8f4e1faa225e585ULL, 0x8c1d9868fef51488ULL,
+		0xb05b5bbcc7c9dd2eULL, 0xe4b2222e9b192c23ULL, 0x1989a8987e683f34ULL, 0x4d60d10a22b8ce39ULL,
+		0x61042f300c11ac78ULL, 0x35ed56a250c15d75ULL, 0xc8d6dc14b5b04e62ULL, 0x9c3fa586e960bf6fULL,
+		0xa0796652d05c76c9ULL, 0xf4901fc08c8c87c4ULL, 0x09ab957669fd94d3ULL, 0x5d42ece4352d65deULL
+	},
+	{
+		0x0000000000000000ULL, 0x3f0be14a916a6dcbULL, 0x7e17c29522d4db96ULL, 0x411c23dfb3beb65dULL,
+		0xfc2f852a45a9b72cULL, 0xc3246460d4c3dae7ULL, 0x823847bf677d6cbaULL, 0xbd33a6f5f6170171ULL,
+		0x6a87a57f245d70ddULL, 0x558c4435b5371d16ULL, 0x149067ea0689ab4bULL, 0x2b9b86a097e3c680ULL,
+		0x96a8205561f4c7f1ULL, 0xa9a3c11ff09eaa3aULL, 0xe8bfe2c043201c67ULL, 0xd7b4038ad24a71acULL,
+		0xd50f4afe48bae1baULL, 0xea04abb4d9d08c71ULL, 0xab18886b6a6e3a2cULL, 0x94136921fb0457e7ULL,
+		0x2920cfd40d135696ULL, 0x162b2e9e9c793b5dULL, 0x57370d412fc78d00ULL, 0x683cec0bbeade0cbULL,
+		0xbf88ef816ce79167ULL, 0x80830ecbfd8dfcacULL, 0xc19f2d144e334af1ULL, 0xfe94cc5edf59273aULL,
+		0x43a76aab294e264bULL, 0x7cac8be1b8244b80ULL, 0x3db0a83e0b9afdddULL, 0x02bb49749af09016ULL,
+		0x38c63ad73e7bddf1ULL, 0x07cddb9daf11b03aULL, 0x46d1f8421caf0667ULL, 0x79da19088dc56bacULL,
+		0xc4e9bffd7bd26addULL, 0xfbe25eb7eab80716ULL, 0xbafe7d685906b14bULL, 0x85f59c22c86cdc80ULL,
+		0x52419fa81a26ad2cULL, 0x6d4a7ee28b4cc0e7ULL, 0x2c565d3d38f276baULL, 0x135dbc77a9981b71ULL,
+		0xae6e1a825f8f1a00ULL, 0x9165fbc8cee577cbULL, 0xd079d8177d5bc196ULL, 0xef72395dec31ac5dULL,
+		0xedc9702976c13c4bULL, 0xd2c29163e7ab5180ULL, 0x93deb2bc5415e7ddULL, 0xacd553f6c57f8a16ULL,
+		0x11e6f50333688b67ULL, 0x2eed1449a202e6acULL, 0x6ff1379611bc50f1ULL, 0x50fad6dc80d63d3aULL,
+		0x874ed556529c4c96ULL, 0xb845341cc3f6215dULL, 0xf95917c370489700ULL, 0xc652f689e122facbULL,
+		0x7b61507c1735fbbaULL, 0x446ab136865f9671ULL, 0x057692e935e1202cULL, 0x3a7d73a3a48b4de7ULL,
+		0x718c75ae7cf7bbe2ULL, 0x4e8794e4ed9dd629ULL, 0x0f9bb73b5e236074ULL, 0x30905671cf490dbfULL,
+		0x8da3f084395e0cceULL, 0xb2a811cea8346105ULL, 0xf3b432111b8ad758ULL, 0xccbfd35b8ae0ba93ULL,
+		0x1b0bd0d158aacb3fULL, 0x2400319bc9c0a6f4ULL, 0x651c12447a7e10a9ULL, 0x5a17f30eeb147d62ULL,
+		0xe72455fb1d037c13ULL, 0xd82fb4b18c6911d8ULL, 0x9933976e3fd7a785ULL, 0xa6387624aebdca4eULL,
+		0xa4833f50344d5a58ULL, 0x9b88de1aa5273793ULL, 0xda94fdc5169981ceULL, 0xe59f1c8f87f3ec05ULL,
+		0x58acba7a71e4ed74ULL, 0x67a75b30e08e80bfULL, 0x26bb78ef533036e2ULL, 0x19b099a5c25a5b29ULL,
+		0xce049a2f10102a85ULL, 0xf10f7b65817a474eULL, 0xb01358ba32c4f113ULL, 0x8f18b9f0a3ae9cd8ULL,
+		0x322b1f0555b99da9ULL, 0x0d20fe4fc4d3f062ULL, 0x4c3cdd90776d463fULL, 0x73373cdae6072bf4ULL,
+		0x494a4f79428c6613ULL, 0x7641ae33d3e60bd8ULL, 0x375d8dec6058bd85ULL, 0x08566ca6f132d04eULL,
+		0xb565ca530725d13fULL, 0x8a6e2b19964fbcf4ULL, 0xcb7208c625f10aa9ULL, 0xf479e98cb49b6762ULL,
+		0x23cdea0666d116ceULL, 0x1cc60b4cf7bb7b05ULL, 0x5dda28934405cd58ULL, 0x62d1c9d9d56fa093ULL,
+		0xdfe26f2c2378a1e2ULL, 0xe0e98e66b212cc29ULL, 0xa1f5adb901ac7a74ULL, 0x9efe4cf390c617bfULL,
+		0x9c4505870a3687a9ULL, 0xa34ee4cd9b5cea62ULL, 0xe252c71228e25c3fULL, 0xdd592658b98831f4ULL,
+		0x606a80ad4f9f3085ULL, 0x5f6161e7def55d4eULL, 0x1e7d42386d4beb13ULL, 0x2176a372fc2186d8ULL,
+		0xf6c2a0f82e6bf774ULL, 0xc9c941b2bf019abfULL, 0x88d5626d0cbf2ce2ULL, 0xb7de83279dd54129ULL,
+		0x0aed25d26bc24058ULL, 0x35e6c498faa82d93ULL, 0x74fae74749169bceULL, 0x4bf1060dd87cf605ULL,
+		0xe318eb5cf9ef77c4ULL, 0xdc130a1668851a0fULL, 0x9d0f29c9db3bac52ULL, 0xa204c8834a51c199ULL,
+		0x1f376e76bc46c0e8ULL, 0x203c8f3c2d2cad23ULL, 0x6120ace39e921b7eULL, 0x5e2b4da90ff876b5ULL,
+		0x899f4e23ddb20719ULL, 0xb694af694cd86ad2ULL, 0xf7888cb6ff66dc8fULL, 0xc8836dfc6e0cb144ULL,
+		0x75b0cb09981bb035ULL, 0x4abb2a430971ddfeULL, 0x0ba7099cbacf6ba3ULL, 0x34ace8d62ba50668ULL,
+		0x3617a1a2b155967eULL, 0x091c40e8203ffbb5ULL, 0x4800633793814de8ULL, 0x770b827d02eb2023ULL,
+		0xca382488f4fc2152ULL, 0xf533c5c265964c99ULL, 0xb42fe61dd628fac4ULL, 0x8b2407574742970fULL,
+		0x5c9004dd9508e6a3ULL, 0x639be59704628b68ULL, 0x2287c648b7dc3d35ULL, 0x1d8c270226b650feULL,
+		0xa0bf81f7d0a1518fULL, 0x9fb460bd41cb3c44ULL, 0xdea84362f2758a19ULL, 0xe1a3a228631fe7d2ULL,
+		0xdbded18bc794aa35ULL, 0xe4d530c156fec7feULL, 0xa5c9131ee54071a3ULL, 0x9ac2f254742a1c68ULL,
+		0x27f154a1823d1d19ULL, 0x18fab5eb135770d2ULL, 0x59e69634a0e9c68fULL, 0x66ed777e3183ab44ULL,
+		0xb15974f4e3c9dae8ULL, 0x8e5295be72a3b723ULL, 0xcf4eb661c11d017eULL, 0xf045572b50776cb5ULL,
+		0x4d76f1dea6606dc4ULL, 0x727d1094370a000fULL, 0x3361334b84b4b652ULL, 0x0c6ad20115dedb99ULL,
+		0x0ed19b758f2e4b8fULL, 0x31da7a3f1e442644ULL, 0x70c659e0adfa9019ULL, 0x4fcdb8aa3c90fdd2ULL,
+		0xf2fe1e5fca87fca3ULL, 0xcdf5ff155bed9168ULL, 0x8ce9dccae8532735ULL, 0xb3e23d8079394afeULL,
+		0x64563e0aab733b52ULL, 0x5b5ddf403a195699ULL, 0x1a41fc9f89a7e0c4ULL, 0x254a1dd518cd8d0fULL,
+		0x9879bb20eeda8c7eULL, 0xa7725a6a7fb0e1b5ULL, 0xe66e79b5cc0e57e8ULL, 0xd96598ff5d643a23ULL,
+		0x92949ef28518cc26ULL, 0xad9f7fb81472a1edULL, 0xec835c67a7cc17b0ULL, 0xd388bd2d36a67a7bULL,
+		0x6ebb1bd8c0b17b0aULL, 0x51b0fa9251db16c1ULL, 0x10acd94de265a09cULL, 0x2fa73807730fcd57ULL,
+		0xf8133b8da145bcfbULL, 0xc718dac7302fd130ULL, 0x8604f9188391676dULL, 0xb90f185212fb0aa6ULL,
+		0x043cbea7e4ec0bd7ULL, 0x3b375fed7586661cULL, 0x7a2b7c32c638d041ULL, 0x45209d785752bd8aULL,
+		0x479bd40ccda22d9cULL, 0x789035465cc84057ULL, 0x398c1699ef76f60aULL, 0x0687f7d37e1c9bc1ULL,
+		0xbbb45126880b9ab0ULL, 0x84bfb06c1961f77bULL, 0xc5a393b3aadf4126ULL, 0xfaa872f93bb52cedULL,
+		0x2d1c7173e9ff5d41ULL, 0x121790397895308aULL, 0x530bb3e6cb2b86d7ULL, 0x6c0052ac5a41eb1cULL,
+		0xd133f459ac56ea6dULL, 0xee3815133d3c87a6ULL, 0xaf2436cc8e8231fbULL, 0x902fd7861fe85c30ULL,
+		0xaa52a425bb6311d7ULL, 0x9559456f2a097c1cULL, 0xd44566b099b7ca41ULL, 0xeb4e87fa08dda78aULL,
+		0x567d210ffecaa6fbULL, 0x6976c0456fa0cb30ULL, 0x286ae39adc1e7d6dULL, 0x176102d04d7410a6ULL,
+		0xc0d5015a9f3e610aULL, 0xffdee0100e540cc1ULL, 0xbec2c3cfbdeaba9cULL, 0x81c922852c80d757ULL,
+		0x3cfa8470da97d626ULL, 0x03f1653a4bfdbbedULL, 0x42ed46e5f8430db0ULL, 0x7de6a7af6929607bULL,
+		0x7f5deedbf3d9f06dULL, 0x40560f9162b39da6ULL, 0x014a2c4ed10d2bfbULL, 0x3e41cd0440674630ULL,
+		0x83726bf1b6704741ULL, 0xbc798abb271a2a8aULL, 0xfd65a96494a49cd7ULL, 0xc26e482e05cef11cULL,
+		0x15da4ba4d78480b0ULL, 0x2ad1aaee46eeed7bULL, 0x6bcd8931f5505b26ULL, 0x54c6687b643a36edULL,
+		0xe9f5ce8e922d379cULL, 0xd6fe2fc403475a57ULL, 0x97e20c1bb0f9ec0aULL, 0xa8e9ed51219381c1ULL
+	},
+	{
+		0x0000000000000000ULL, 0x1dee8a5e222ca1dcULL, 0x3bdd14bc445943b8ULL, 0x26339ee26675e264ULL,
+		0x77ba297888b28770ULL, 0x6a54a326aa9e26acULL, 0x4c673dc4ccebc4c8ULL, 0x5189b79aeec76514ULL,
+		0xef7452f111650ee0ULL, 0xf29ad8af3349af3cULL, 0xd4a9464d553c4d58ULL, 0xc947cc137710ec84ULL,
+		0x98ce7b8999d78990ULL, 0x8520f1d7bbfb284cULL, 0xa3136f35dd8eca28ULL, 0xbefde56bffa26bf4ULL,
+		0x4c300ac98dc40345ULL, 0x51de8097afe8a299ULL, 0x77ed1e75c99d40fdULL, 0x6a03942bebb1e121ULL,
+		0x3b8a23b105768435ULL, 0x2664a9ef275a25e9ULL, 0x0057370d412fc78dULL, 0x1db9bd5363036651ULL,
+		0xa34458389ca10da5ULL, 0xbeaad266be8dac79ULL, 0x98994c84d8f84e1dULL, 0x8577c6dafad4efc1ULL,
+		0xd4fe714014138ad5ULL, 0xc910fb1e363f2b09ULL, 0xef2365fc504ac96dULL, 0xf2cdefa2726668b1ULL,
+		0x986015931b88068aULL, 0x858e9fcd39a4a756ULL, 0xa3bd012f5fd14532ULL, 0xbe538b717dfde4eeULL,
+		0xefda3ceb933a81faULL, 0xf234b6b5b1162026ULL, 0xd4072857d763c242ULL, 0xc9e9a209f54f639eULL,
+		0x771447620aed086aULL, 0x6afacd3c28c1a9b6ULL, 0x4cc953de4eb44bd2ULL, 0x5127d9806c98ea0eULL,
+		0x00ae6e1a825f8f1aULL, 0x1d40e444a0732ec6ULL, 0x3b737aa6c606cca2ULL, 0x269df0f8e42a6d7eULL,
+		0xd4501f5a964c05cfULL, 0xc9be9504b460a413ULL, 0xef8d0be6d2154677ULL, 0xf26381b8f039e7abULL,
+		0xa3ea36221efe82bfULL, 0xbe04bc7c3cd22363ULL, 0x9837229e5aa7c107ULL, 0x85d9a8c0788b60dbULL,
+		0x3b244dab87290b2fULL, 0x26cac7f5a505aaf3ULL, 0x00f95917c3704897ULL, 0x1d17d349e15ce94bULL,
+		0x4c9e64d30f9b8c5fULL, 0x5170ee8d2db72d83ULL, 0x7743706f4bc2cfe7ULL, 0x6aadfa3169ee6e3bULL,
+		0xa218840d981e1391ULL, 0xbff60e53ba32b24dULL, 0x99c590b1dc475029ULL, 0x842b1aeffe6bf1f5ULL,
+		0xd5a2ad7510ac94e1ULL, 0xc84c272b3280353dULL, 0xee7fb9c954f5d759ULL, 0xf391339776d97685ULL,
+		0x4d6cd6fc897b1d71ULL, 0x50825ca2ab57bcadULL, 0x76b1c240cd225ec9ULL, 0x6b5f481eef0eff15ULL,
+		0x3ad6ff8401c99a01ULL, 0x273875da23e53bddULL, 0x010beb384590d9b9ULL, 0x1ce5616667bc7865ULL,
+		0xee288ec415da10d4ULL, 0xf3c6049a37f6b108ULL, 0xd5f59a785183536cULL, 0xc81b102673aff2b0ULL,
+		0x9992a7bc9d6897a4ULL, 0x847c2de2bf443678ULL, 0xa24fb300d931d41cULL, 0xbfa1395efb1d75c0ULL,
+		0x015cdc3504bf1e34ULL, 0x1cb2566b2693bfe8ULL, 0x3a81c88940e65d8cULL, 0x276f42d762cafc50ULL,
+		0x76e6f54d8c0d9944ULL, 0x6b087f13ae213898ULL, 0x4d3be1f1c854dafcULL, 0x50d56bafea787b20ULL,
+		0x3a78919e8396151bULL, 0x27961bc0a1bab4c7ULL, 0x01a58522c7cf56a3ULL, 0x1c4b0f7ce5e3f77fULL,
+		0x4dc2b8e60b24926bULL, 0x502c32b8290833b7ULL, 0x761fac5a4f7dd1d3ULL, 0x6bf126046d51700fULL,
+		0xd50cc36f92f31bfbULL, 0xc8e24931b0dfba27ULL, 0xeed1d7d3d6aa5843ULL, 0xf33f5d8df486f99fULL,
+		0xa2b6ea171a419c8bULL, 0xbf586049386d3d57ULL, 0x996bfeab5e18df33ULL, 0x848574f57c347eefULL,
+		0x76489b570e52165eULL, 0x6ba611092c7eb782ULL, 0x4d958feb4a0b55e6ULL, 0x507b05b56827f43aULL,
+		0x01f2b22f86e0912eULL, 0x1c1c3871a4cc30f2ULL, 0x3a2fa693c2b9d296ULL, 0x27c12ccde095734aULL,
+		0x993cc9a61f3718beULL, 0x84d243f83d1bb962ULL, 0xa2e1dd1a5b6e5b06ULL, 0xbf0f57447942fadaULL,
+		0xee86e0de97859fceULL, 0xf3686a80b5a93e12ULL, 0xd55bf462d3dcdc76ULL, 0xc8b57e3cf1f07daaULL,
+		0xd6e9a7309f3239a7ULL, 0xcb072d6ebd1e987bULL, 0xed34b38cdb6b7a1fULL, 0xf0da39d2f947dbc3ULL,
+		0xa1538e481780bed7ULL, 0xbcbd041635ac1f0bULL, 0x9a8e9af453d9fd6fULL, 0x876010aa71f55cb3ULL,
+		0x399df5c18e573747ULL, 0x24737f9fac7b969bULL, 0x0240e17dca0e74ffULL, 0x1fae6b23e822d523ULL,
+		0x4e27dcb906e5b037ULL, 0x53c956e724c911ebULL, 0x75fac80542bcf38fULL, 0x6814425b60905253ULL,
+		0x9ad9adf912f63ae2ULL, 0x873727a730da9b3eULL, 0xa104b94556af795aULL, 0xbcea331b7483d886ULL,
+		0xed6384819a44bd92ULL, 0xf08d0edfb8681c4eULL, 0xd6be903dde1dfe2aULL, 0xcb501a63fc315ff6ULL,
+		0x75adff0803933402ULL, 0x6843755621bf95deULL, 0x4e70ebb447ca77baULL, 0x539e61ea65e6d666ULL,
+		0x0217d6708b21b372ULL, 0x1ff95c2ea90d12aeULL, 0x39cac2cccf78f0caULL, 0x24244892ed545116ULL,
+		0x4e89b2a384ba3f2dULL, 0x536738fda6969ef1ULL, 0x7554a61fc0e37c95ULL, 0x68ba2c41e2cfdd49ULL,
+		0x39339bdb0c08b85dULL, 0x24dd11852e241981ULL, 0x02ee8f674851fbe5ULL, 0x1f0005396a7d5a39ULL,
+		0xa1fde05295df31cdULL, 0xbc136a0cb7f39011ULL, 0x9a20f4eed1867275ULL, 0x87ce7eb0f3aad3a9ULL,
+		0xd647c92a1d6db6bdULL, 0xcba943743f411761ULL, 0xed9add965934f505ULL, 0xf07457c87b1854d9ULL,
+		0x02b9b86a097e3c68ULL, 0x1f5732342b529db4ULL, 0x3964acd64d277fd0ULL, 0x248a26886f0bde0cULL,
+		0x7503911281ccbb18ULL, 0x68ed1b4ca3e01ac4ULL, 0x4ede85aec595f8a0ULL, 0x53300ff0e7b9597cULL,
+		0xedcdea9b181b3288ULL, 0xf02360c53a379354ULL, 0xd610fe275c427130ULL, 0xcbfe74797e6ed0ecULL,
+		0x9a77c3e390a9b5f8ULL, 0x879949bdb2851424ULL, 0xa1aad75fd4f0f640ULL, 0xbc445d01f6dc579cULL,
+		0x74f1233d072c2a36ULL, 0x691fa96325008beaULL, 0x4f2c37814375698eULL, 0x52c2bddf6159c852ULL,
+		0x034b0a458f9ead46ULL, 0x1ea5801badb20c9aULL, 0x38961ef9cbc7eefeULL, 0x257894a7e9eb4f22ULL,
+		0x9b8571cc164924d6ULL, 0x866bfb923465850aULL, 0xa05865705210676eULL, 0xbdb6ef2e703cc6b2ULL,
+		0xec3f58b49efba3a6ULL, 0xf1d1d2eabcd7027aULL, 0xd7e24c08daa2e01eULL, 0xca0cc656f88e41c2ULL,
+		0x38c129f48ae82973ULL, 0x252fa3aaa8c488afULL, 0x031c3d48ceb16acbULL, 0x1ef2b716ec9dcb17ULL,
+		0x4f7b008c025aae03ULL, 0x52958ad220760fdfULL, 0x74a614304603edbbULL, 0x69489e6e642f4c67ULL,
+		0xd7b57b059b8d2793ULL, 0xca5bf15bb9a1864fULL, 0xec686fb9dfd4642bULL, 0xf186e5e7fdf8c5f7ULL,
+		0xa00f527d133fa0e3ULL, 0xbde1d8233113013fULL, 0x9bd246c15766e35bULL, 0x863ccc9f754a4287ULL,
+		0xec9136ae1ca42cbcULL, 0xf17fbcf03e888d60ULL, 0xd74c221258fd6f04ULL, 0xcaa2a84c7ad1ced8ULL,
+		0x9b2b1fd69416abccULL, 0x86c59588b63a0a10ULL, 0xa0f60b6ad04fe874ULL, 0xbd188134f26349a8ULL,
+		0x03e5645f0dc1225cULL, 0x1e0bee012fed8380ULL, 0x383870e3499861e4ULL, 0x25d6fabd6bb4c038ULL,
+		0x745f4d278573a52cULL, 0x69b1c779a75f04f0ULL, 0x4f82599bc12ae694ULL, 0x526cd3c5e3064748ULL,
+		0xa0a13c6791602ff9ULL, 0xbd4fb639b34c8e25ULL, 0x9b7c28dbd5396c41ULL, 0x8692a285f715cd9dULL,
+		0xd71b151f19d2a889ULL, 0xcaf59f413bfe0955ULL, 0xecc601a35d8beb31ULL, 0xf1288bfd7fa74aedULL,
+		0x4fd56e9680052119ULL, 0x523be4c8a22980c5ULL, 0x74087a2ac45c62a1ULL, 0x69e6f074e670c37dULL,
+		0x386f47ee08b7a669ULL, 0x2581cdb02a9b07b5ULL, 0x03b253524ceee5d1ULL, 0x1e5cd90c6ec2440dULL
+	},
+	{
+		0x0000000000000000ULL, 0x5c2d776033c4205eULL, 0xb85aeec0678840bcULL, 0xe47799a0544c60e2ULL,
+		0xe26d72ab601e9ffdULL, 0xbe4005cb53dabfa3ULL, 0x5a379c6b0796df41ULL, 0x061aeb0b3452ff1fULL,
+		0x56024a7d6f33217fULL, 0x0a2f3d1d5cf70121ULL, 0xee58a4bd08bb61c3ULL, 0xb275d3dd3b7f419dULL,
+		0xb46f38d60f2dbe82ULL, 0xe8424fb63ce99edcULL, 0x0c35d61668a5fe3eULL, 0x5018a1765b61de60ULL,
+		0xac0494fade6642feULL, 0xf029e39aeda262a0ULL, 0x145e7a3ab9ee0242ULL, 0x48730d5a8a2a221cULL,
+		0x4e69e651be78dd03ULL, 0x124491318dbcfd5dULL, 0xf6330891d9f09dbfULL, 0xaa1e7ff1ea34bde1ULL,
+		0xfa06de87b1556381ULL, 0xa62ba9e7829143dfULL, 0x425c3047d6dd233dULL, 0x1e714727e5190363ULL,
+		0x186bac2cd14bfc7cULL, 0x4446db4ce28fdc22ULL, 0xa03142ecb6c3bcc0ULL, 0xfc1c358c85079c9eULL,
+		0xcad186de13c29b79ULL, 0x96fcf1be2006bb27ULL, 0x728b681e744adbc5ULL, 0x2ea61f7e478efb9bULL,
+		0x28bcf47573dc0484ULL, 0x74918315401824daULL, 0x90e61ab514544438ULL, 0xcccb6dd527906466ULL,
+		0x9cd3cca37cf1ba06ULL, 0xc0febbc34f359a58ULL, 0x248922631b79fabaULL, 0x78a4550328bddae4ULL,
+		0x7ebebe081cef25fbULL, 0x2293c9682f2b05a5ULL, 0xc6e450c87b676547ULL, 0x9ac927a848a34519ULL,
+		0x66d51224cda4d987ULL, 0x3af86544fe60f9d9ULL, 0xde8ffce4aa2c993bULL, 0x82a28b8499e8b965ULL,
+		0x84b8608fadba467aULL, 0xd89517ef9e7e6624ULL, 0x3ce28e4fca3206c6ULL, 0x60cff92ff9f62698ULL,
+		0x30d75859a297f8f8ULL, 0x6cfa2f399153d8a6ULL, 0x888db699c51fb844ULL, 0xd4a0c1f9f6db981aULL,
+		0xd2ba2af2c2896705ULL, 0x8e975d92f14d475bULL, 0x6ae0c432a50127b9ULL, 0x36cdb35296c507e7ULL,
+		0x077ba297888b2877ULL, 0x5b56d5f7bb4f0829ULL, 0xbf214c57ef0368cbULL, 0xe30c3b37dcc74895ULL,
+		0xe516d03ce895b78aULL, 0xb93ba75cdb5197d4ULL, 0x5d4c3efc8f1df736ULL, 0x0161499cbcd9d768ULL,
+		0x5179e8eae7b80908ULL, 0x0d549f8ad47c2956ULL, 0xe923062a803049b4ULL, 0xb50e714ab3f469eaULL,
+		0xb3149a4187a696f5ULL, 0xef39ed21b462b6abULL, 0x0b4e7481e02ed649ULL, 0x576303e1d3eaf617ULL,
+		0xab7f366d56ed6a89ULL, 0xf752410d65294ad7ULL, 0x1325d8ad31652a35ULL, 0x4f08afcd02a10a6bULL,
+		0x491244c636f3f574ULL, 0x153f33a60537d52aULL, 0xf148aa06517bb5c8ULL, 0xad65dd6662bf9596ULL,
+		0xfd7d7c1039de4bf6ULL, 0xa1500b700a1a6ba8ULL, 0x452792d05e560b4aULL, 0x190ae5b06d922b14ULL,
+		0x1f100ebb59c0d40bULL, 0x433d79db6a04f455ULL, 0xa74ae07b3e4894b7ULL, 0xfb67971b0d8cb4e9ULL,
+		0xcdaa24499b49b30eULL, 0x91875329a88d9350ULL, 0x75f0ca89fcc1f3b2ULL, 0x29ddbde9cf05d3ecULL,
+		0x2fc756e2fb572cf3ULL, 0x73ea2182c8930cadULL, 0x979db8229cdf6c4fULL, 0xcbb0cf42af1b4c11ULL,
+		0x9ba86e34f47a9271ULL, 0xc7851954c7beb22fULL, 0x23f280f493f2d2cdULL, 0x7fdff794a036f293ULL,
+		0x79c51c9f94640d8cULL, 0x25e86bffa7a02dd2ULL, 0xc19ff25ff3ec4d30ULL, 0x9db2853fc0286d6eULL,
+		0x61aeb0b3452ff1f0ULL, 0x3d83c7d376ebd1aeULL, 0xd9f45e7322a7b14cULL, 0x85d9291311639112ULL,
+		0x83c3c21825316e0dULL, 0xdfeeb57816f54e53ULL, 0x3b992cd842b92eb1ULL, 0x67b45bb8717d0eefULL,
+		0x37acface2a1cd08fULL, 0x6b818dae19d8f0d1ULL, 0x8ff6140e4d949033ULL, 0xd3db636e7e50b06dULL,
+		0xd5c188654a024f72ULL, 0x89ecff0579c66f2cULL, 0x6d9b66a52d8a0fceULL, 0x31b611c51e4e2f90ULL,
+		0x0ef7452f111650eeULL, 0x52da324f22d270b0ULL, 0xb6adabef769e1052ULL, 0xea80dc8f455a300cULL,
+		0xec9a37847108cf13ULL, 0xb0b740e442ccef4dULL, 0x54c0d94416808fafULL, 0x08edae242544aff1ULL,
+		0x58f50f527e257191ULL, 0x04d878324de151cfULL, 0xe0afe19219ad312dULL, 0xbc8296f22a691173ULL,
+		0xba987df91e3bee6cULL, 0xe6b50a992dffce32ULL, 0x02c2933979b3aed0ULL, 0x5eefe4594a778e8eULL,
+		0xa2f3d1d5cf701210ULL, 0xfedea6b5fcb4324eULL, 0x1aa93f15a8f852acULL, 0x468448759b3c72f2ULL,
+		0x409ea37eaf6e8dedULL, 0x1cb3d41e9caaadb3ULL, 0xf8c44dbec8e6cd51ULL, 0xa4e93adefb22ed0fULL,
+		0xf4f19ba8a043336fULL, 0xa8dcecc893871331ULL, 0x4cab7568c7cb73d3ULL, 0x10860208f40f538dULL,
+		0x169ce903c05dac92ULL, 0x4ab19e63f3998cccULL, 0xaec607c3a7d5ec2eULL, 0xf2eb70a39411cc70ULL,
+		0xc426c3f102d4cb97ULL, 0x980bb4913110ebc9ULL, 0x7c7c2d31655c8b2bULL, 0x20515a515698ab75ULL,
+		0x264bb15a62ca546aULL, 0x7a66c63a510e7434ULL, 0x9e115f9a054214d6ULL, 0xc23c28fa36863488ULL,
+		0x9224898c6de7eae8ULL, 0xce09feec5e23cab6ULL, 0x2a7e674c0a6faa54ULL, 0x7653102c39ab8a0aULL,
+		0x7049fb270df97515ULL, 0x2c648c473e3d554bULL, 0xc81315e76a7135a9ULL, 0x943e628759b515f7ULL,
+		0x6822570bdcb28969ULL, 0x340f206bef76a937ULL, 0xd078b9cbbb3ac9d5ULL, 0x8c55ceab88fee98bULL,
+		0x8a4f25a0bcac1694ULL, 0xd66252c08f6836caULL, 0x3215cb60db245628ULL, 0x6e38bc00e8e07676ULL,
+		0x3e201d76b381a816ULL, 0x620d6a1680458848ULL, 0x867af3b6d409e8aaULL, 0xda5784d6e7cdc8f4ULL,
+		0xdc4d6fddd39f37ebULL, 0x806018bde05b17b5ULL, 0x6417811db4177757ULL, 0x383af67d87d35709ULL,
+		0x098ce7b8999d7899ULL, 0x55a190d8aa5958c7ULL, 0xb1d60978fe153825ULL, 0xedfb7e18cdd1187bULL,
+		0xebe19513f983e764ULL, 0xb7cce273ca47c73aULL, 0x53bb7bd39e0ba7d8ULL, 0x0f960cb3adcf8786ULL,
+		0x5f8eadc5f6ae59e6ULL, 0x03a3daa5c56a79b8ULL, 0xe7d443059126195aULL, 0xbbf93465a2e23904ULL,
+		0xbde3df6e96b0c61bULL, 0xe1cea80ea574e645ULL, 0x05b931aef13886a7ULL, 0x599446cec2fca6f9ULL,
+		0xa588734247fb3a67ULL, 0xf9a50422743f1a39ULL, 0x1dd29d8220737adbULL, 0x41ffeae213b75a85ULL,
+		0x47e501e927e5a59aULL, 0x1bc87689142185c4ULL, 0xffbfef29406de526ULL, 0xa392984973a9c578ULL,
+		0xf38a393f28c81b18ULL, 0xafa74e5f1b0c3b46ULL, 0x4bd0d7ff4f405ba4ULL, 0x17fda09f7c847bfaULL,
+		0x11e74b9448d684e5ULL, 0x4dca3cf47b12a4bbULL, 0xa9bda5542f5ec459ULL, 0xf590d2341c9ae407ULL,
+		0xc35d61668a5fe3e0ULL, 0x9f701606b99bc3beULL, 0x7b078fa6edd7a35cULL, 0x272af8c6de138302ULL,
+		0x213013cdea417c1dULL, 0x7d1d64add9855c43ULL, 0x996afd0d8dc93ca1ULL, 0xc5478a6dbe0d1cffULL,
+		0x955f2b1be56cc29fULL, 0xc9725c7bd6a8e2c1ULL, 0x2d05c5db82e48223ULL, 0x7128b2bbb120a27dULL,
+		0x773259b085725d62ULL, 0x2b1f2ed0b6b67d3cULL, 0xcf68b770e2fa1ddeULL, 0x9345c010d13e3d80ULL,
+		0x6f59f59c5439a11eULL, 0x337482fc67fd8140ULL, 0xd7031b5c33b1e1a2ULL, 0x8b2e6c3c0075c1fcULL,
+		0x8d34873734273ee3ULL, 0xd119f05707e31ebdULL, 0x356e69f753af7e5fULL, 0x69431e97606b5e01ULL,
+		0x395bbfe13b0a8061ULL, 0x6576c88108cea03fULL, 0x810151215c82c0ddULL, 0xdd2c26416f46e083ULL,
+		0xdb36cd4a5b141f9cULL, 0x871bba2a68d03fc2ULL, 0x636c238a3c9c5f20ULL, 0x3f4154ea0f587f7eULL
+	},
+	{
+		0x0000000000000000ULL, 0x6184d55f721267c6ULL, 0xc309aabee424cf8cULL, 0xa28d7fe19636a84aULL,
+		0x14cbfa566747819dULL, 0x754f2f091555e65bULL, 0xd7c250e883634e11ULL, 0xb64685b7f17129d7ULL,
+		0x2997f4acce8f033aULL, 0x481321f3bc9d64fcULL, 0xea9e5e122aabccb6ULL, 0x8b1a8b4d58b9ab70ULL,
+		0x3d5c0efaa9c882a7ULL, 0x5cd8dba5dbdae561ULL, 0xfe55a4444dec4d2bULL, 0x9fd1711b3ffe2aedULL,
+		0x532fe9599d1e0674ULL, 0x32ab3c06ef0c61b2ULL, 0x902643e7793ac9f8ULL, 0xf1a296b80b28ae3eULL,
+		0x47e4130ffa5987e9ULL, 0x2660c650884be02fULL, 0x84edb9b11e7d4865ULL, 0xe5696cee6c6f2fa3ULL,
+		0x7ab81df55391054eULL, 0x1b3cc8aa21836288ULL, 0xb9b1b74bb7b5cac2ULL, 0xd8356214c5a7ad04ULL,
+		0x6e73e7a334d684d3ULL, 0x0ff732fc46c4e315ULL, 0xad7a4d1dd0f24b5fULL, 0xccfe9842a2e02c99ULL,
+		0xa65fd2b33a3c0ce8ULL, 0xc7db07ec482e6b2eULL, 0x6556780dde18c364ULL, 0x04d2ad52ac0aa4a2ULL,
+		0xb29428e55d7b8d75ULL, 0xd310fdba2f69eab3ULL, 0x719d825bb95f42f9ULL, 0x10195704cb4d253fULL,
+		0x8fc8261ff4b30fd2ULL, 0xee4cf34086a16814ULL, 0x4cc18ca11097c05eULL, 0x2d4559fe6285a798ULL,
+		0x9b03dc4993f48e4fULL, 0xfa870916e1e6e989ULL, 0x580a76f777d041c3ULL, 0x398ea3a805c22605ULL,
+		0xf5703beaa7220a9cULL, 0x94f4eeb5d5306d5aULL, 0x367991544306c510ULL, 0x57fd440b3114a2d6ULL,
+		0xe1bbc1bcc0658b01ULL, 0x803f14e3b277ecc7ULL, 0x22b26b022441448dULL, 0x4336be5d5653234bULL,
+		0xdce7cf4669ad09a6ULL, 0xbd631a191bbf6e60ULL, 0x1fee65f88d89c62aULL, 0x7e6ab0a7ff9ba1ecULL,
+		0xc82c35100eea883bULL, 0xa9a8e04f7cf8effdULL, 0x0b259faeeace47b7ULL, 0x6aa14af198dc2071ULL,
+		0xde670a4ddb760755ULL, 0xbfe3df12a9646093ULL, 0x1d6ea0f33f52c8d9ULL, 0x7cea75ac4d40af1fULL,
+		0xcaacf01bbc3186c8ULL, 0xab282544ce23e10eULL, 0x09a55aa558154944ULL, 0x68218ffa2a072e82ULL,
+		0xf7f0fee115f9046fULL, 0x96742bbe67eb63a9ULL, 0x34f9545ff1ddcbe3ULL, 0x557d810083cfac25ULL,
+		0xe33b04b772be85f2ULL, 0x82bfd1e800ace234ULL, 0x2032ae09969a4a7eULL, 0x41b67b56e4882db8ULL,
+		0x8d48e31446680121ULL, 0xeccc364b347a66e7ULL, 0x4e4149aaa24cceadULL, 0x2fc59cf5d05ea96bULL,
+		0x99831942212f80bcULL, 0xf807cc1d533de77aULL, 0x5a8ab3fcc50b4f30ULL, 0x3b0e66a3b71928f6ULL,
+		0xa4df17b888e7021bULL, 0xc55bc2e7faf565ddULL, 0x67d6bd066cc3cd97ULL, 0x065268591ed1aa51ULL,
+		0xb014edeeefa08386ULL, 0xd19038b19db2e440ULL, 0x731d47500b844c0aULL, 0x1299920f79962bccULL,
+		0x7838d8fee14a0bbdULL, 0x19bc0da193586c7bULL, 0xbb317240056ec431ULL, 0xdab5a71f777ca3f7ULL,
+		0x6cf322a8860d8a20ULL, 0x0d77f7f7f41fede6ULL, 0xaffa8816622945acULL, 0xce7e5d49103b226aULL,
+		0x51af2c522fc50887ULL, 0x302bf90d5dd76f41ULL, 0x92a686eccbe1c70bULL, 0xf32253b3b9f3a0cdULL,
+		0x4564d6044882891aULL, 0x24e0035b3a90eedcULL, 0x866d7cbaaca64696ULL, 0xe7e9a9e5deb42150ULL,
+		0x2b1731a77c540dc9ULL, 0x4a93e4f80e466a0fULL, 0xe81e9b199870c245ULL, 0x899a4e46ea62a583ULL,
+		0x3fdccbf11b138c54ULL, 0x5e581eae6901eb92ULL, 0xfcd5614fff3743d8ULL, 0x9d51b4108d25241eULL,
+		0x0280c50bb2db0ef3ULL, 0x63041054c0c96935ULL, 0xc1896fb556ffc17fULL, 0xa00dbaea24eda6b9ULL,
+		0x164b3f5dd59c8f6eULL, 0x77cfea02a78ee8a8ULL, 0xd54295e331b840e2ULL, 0xb4c640bc43aa2724ULL,
+		0x2e16bbb019e2102fULL, 0x4f926eef6bf077e9ULL, 0xed1f110efdc6dfa3ULL, 0x8c9bc4518fd4b865ULL,
+		0x3add41e67ea591b2ULL, 0x5b5994b90cb7f674ULL, 0xf9d4eb589a815e3eULL, 0x98503e07e89339f8ULL,
+		0x07814f1cd76d1315ULL, 0x66059a43a57f74d3ULL, 0xc488e5a23349dc99ULL, 0xa50c30fd415bbb5fULL,
+		0x134ab54ab02a9288ULL, 0x72ce6015c238f54eULL, 0xd0431ff4540e5d04ULL, 0xb1c7caab261c3ac2ULL,
+		0x7d3952e984fc165bULL, 0x1cbd87b6f6ee719dULL, 0xbe30f85760d8d9d7ULL, 0xdfb42d0812cabe11ULL,
+		0x69f2a8bfe3bb97c6ULL, 0x08767de091a9f000ULL, 0xaafb0201079f584aULL, 0xcb7fd75e758d3f8cULL,
+		0x54aea6454a731561ULL, 0x352a731a386172a7ULL, 0x97a70cfbae57daedULL, 0xf623d9a4dc45bd2bULL,
+		0x40655c132d3494fcULL, 0x21e1894c5f26f33aULL, 0x836cf6adc9105b70ULL, 0xe2e823f2bb023cb6ULL,
+		0x8849690323de1cc7ULL, 0xe9cdbc5c51cc7b01ULL, 0x4b40c3bdc7fad34bULL, 0x2ac416e2b5e8b48dULL,
+		0x9c82935544999d5aULL, 0xfd06460a368bfa9cULL, 0x5f8b39eba0bd52d6ULL, 0x3e0fecb4d2af3510ULL,
+		0xa1de9dafed511ffdULL, 0xc05a48f09f43783bULL, 0x62d737110975d071ULL, 0x0353e24e7b67b7b7ULL,
+		0xb51567f98a169e60ULL, 0xd491b2a6f804f9a6ULL, 0x761ccd476e3251ecULL, 0x179818181c20362aULL,
+		0xdb66805abec01ab3ULL, 0xbae25505ccd27d75ULL, 0x186f2ae45ae4d53fULL, 0x79ebffbb28f6b2f9ULL,
+		0xcfad7a0cd9879b2eULL, 0xae29af53ab95fce8ULL, 0x0ca4d0b23da354a2ULL, 0x6d2005ed4fb13364ULL,
+		0xf2f174f6704f1989ULL, 0x9375a1a9025d7e4fULL, 0x31f8de48946bd605ULL, 0x507c0b17e679b1c3ULL,
+		0xe63a8ea017089814ULL, 0x87be5bff651affd2ULL, 0x2533241ef32c5798ULL, 0x44b7f141813e305eULL,
+		0xf071b1fdc294177aULL, 0x91f564a2b08670bcULL, 0x33781b4326b0d8f6ULL, 0x52fcce1c54a2bf30ULL,
+		0xe4ba4baba5d396e7ULL, 0x853e9ef4d7c1f121ULL, 0x27b3e11541f7596bULL, 0x4637344a33e53eadULL,
+		0xd9e645510c1b1440ULL, 0xb862900e7e097386ULL, 0x1aefefefe83fdbccULL, 0x7b6b3ab09a2dbc0aULL,
+		0xcd2dbf076b5c95ddULL, 0xaca96a58194ef21bULL, 0x0e2415b98f785a51ULL, 0x6fa0c0e6fd6a3d97ULL,
+		0xa35e58a45f8a110eULL, 0xc2da8dfb2d9876c8ULL, 0x6057f21abbaede82ULL, 0x01d32745c9bcb944ULL,
+		0xb795a2f238cd9093ULL, 0xd61177ad4adff755ULL, 0x749c084cdce95f1fULL, 0x1518dd13aefb38d9ULL,
+		0x8ac9ac0891051234ULL, 0xeb4d7957e31775f2ULL, 0x49c006b67521ddb8ULL, 0x2844d3e90733ba7eULL,
+		0x9e02565ef64293a9ULL, 0xff8683018450f46fULL, 0x5d0bfce012665c25ULL, 0x3c8f29bf60743be3ULL,
+		0x562e634ef8a81b92ULL, 0x37aab6118aba7c54ULL, 0x9527c9f01c8cd41eULL, 0xf4a31caf6e9eb3d8ULL,
+		0x42e599189fef9a0fULL, 0x23614c47edfdfdc9ULL, 0x81ec33a67bcb5583ULL, 0xe068e6f909d93245ULL,
+		0x7fb997e2362718a8ULL, 0x1e3d42bd44357f6eULL, 0xbcb03d5cd203d724ULL, 0xdd34e803a011b0e2ULL,
+		0x6b726db451609935ULL, 0x0af6b8eb2372fef3ULL, 0xa87bc70ab54456b9ULL, 0xc9ff1255c756317fULL,
+		0x05018a1765b61de6ULL, 0x64855f4817a47a20ULL, 0xc60820a98192d26aULL, 0xa78cf5f6f380b5acULL,
+		0x11ca704102f19c7bULL, 0x704ea51e70e3fbbdULL, 0xd2c3daffe6d553f7ULL, 0xb3470fa094c73431ULL,
+		0x2c967ebbab391edcULL, 0x4d12abe4d92b791aULL, 0xef9fd4054f1dd150ULL, 0x8e1b015a3d0fb696ULL,
+		0x385d84edcc7e9f41ULL, 0x59d951b2be6cf887ULL, 0xfb542e53285a50cdULL, 0x9ad0fb0c5a48370bULL
+	},
+	{
+		0x0000000000000000ULL, 0x22ef0d5934f964ecULL, 0x45de1ab269f2c9d8ULL, 0x673117eb5d0bad34ULL,
+		0x8bbc3564d3e593b0ULL, 0xa953383de71cf75cULL, 0xce622fd6ba175a68ULL, 0xec8d228f8eee3e84ULL,
+		0x85a0c5e208c539e5ULL, 0xa74fc8bb3c3c5d09ULL, 0xc07edf506137f03dULL, 0xe291d20955ce94d1ULL,
+		0x0e1cf086db20aa55ULL, 0x2cf3fddfefd9ceb9ULL, 0x4bc2ea34b2d2638dULL, 0x692de76d862b0761ULL,
+		0x999924efbe846d4fULL, 0xbb7629b68a7d09a3ULL, 0xdc473e5dd776a497ULL, 0xfea83304e38fc07bULL,
+		0x1225118b6d61feffULL, 0x30ca1cd259989a13ULL, 0x57fb0b3904933727ULL, 0x75140660306a53cbULL,
+		0x1c39e10db64154aaULL, 0x3ed6ec5482b83046ULL, 0x59e7fbbfdfb39d72ULL, 0x7b08f6e6eb4af99eULL,
+		0x9785d46965a4c71aULL, 0xb56ad930515da3f6ULL, 0xd25bcedb0c560ec2ULL, 0xf0b4c38238af6a2eULL,
+		0xa1eae6f4d206c41bULL, 0x8305ebade6ffa0f7ULL, 0xe434fc46bbf40dc3ULL, 0xc6dbf11f8f0d692fULL,
+		0x2a56d39001e357abULL, 0x08b9dec9351a3347ULL, 0x6f88c92268119e73ULL, 0x4d67c47b5ce8fa9fULL,
+		0x244a2316dac3fdfeULL, 0x06a52e4fee3a9912ULL, 0x619439a4b3313426ULL, 0x437b34fd87c850caULL,
+		0xaff6167209266e4eULL, 0x8d191b2b3ddf0aa2ULL, 0xea280cc060d4a796ULL, 0xc8c70199542dc37aULL,
+		0x3873c21b6c82a954ULL, 0x1a9ccf42587bcdb8ULL, 0x7dadd8a90570608cULL, 0x5f42d5f031890460ULL,
+		0xb3cff77fbf673ae4ULL, 0x9120fa268b9e5e08ULL, 0xf611edcdd695f33cULL, 0xd4fee094e26c97d0ULL,
+		0xbdd307f9644790b1ULL, 0x9f3c0aa050bef45dULL, 0xf80d1d4b0db55969ULL, 0xdae21012394c3d85ULL,
+		0x366f329db7a20301ULL, 0x14803fc4835b67edULL, 0x73b1282fde50cad9ULL, 0x515e2576eaa9ae35ULL,
+		0xd10d62c20b0396b3ULL, 0xf3e26f9b3ffaf25fULL, 0x94d3787062f15f6bULL, 0xb63c752956083b87ULL,
+		0x5ab157a6d8e60503ULL, 0x785e5affec1f61efULL, 0x1f6f4d14b114ccdbULL, 0x3d80404d85eda837ULL,
+		0x54ada72003c6af56ULL, 0x7642aa79373fcbbaULL, 0x1173bd926a34668eULL, 0x339cb0cb5ecd0262ULL,
+		0xdf119244d0233ce6ULL, 0xfdfe9f1de4da580aULL, 0x9acf88f6b9d1f53eULL, 0xb82085af8d2891d2ULL,
+		0x4894462db587fbfcULL, 0x6a7b4b74817e9f10ULL, 0x0d4a5c9fdc753224ULL, 0x2fa551c6e88c56c8ULL,
+		0xc32873496662684cULL, 0xe1c77e10529b0ca0ULL, 0x86f669fb0f90a194ULL, 0xa41964a23b69c578ULL,
+		0xcd3483cfbd42c219ULL, 0xefdb8e9689bba6f5ULL, 0x88ea997dd4b00bc1ULL, 0xaa059424e0496f2dULL,
+		0x4688b6ab6ea751a9ULL, 0x6467bbf25a5e3545ULL, 0x0356ac1907559871ULL, 0x21b9a14033acfc9dULL,
+		0x70e78436d90552a8ULL, 0x5208896fedfc3644ULL, 0x35399e84b0f79b70ULL, 0x17d693dd840eff9cULL,
+		0xfb5bb1520ae0c118ULL, 0xd9b4bc0b3e19a5f4ULL, 0xbe85abe0631208c0ULL, 0x9c6aa6b957eb6c2cULL,
+		0xf54741d4d1c06b4dULL, 0xd7a84c8de5390fa1ULL, 0xb0995b66b832a295ULL, 0x9276563f8ccbc679ULL,
+		0x7efb74b00225f8fdULL, 0x5c1479e936dc9c11ULL, 0x3b256e026bd73125ULL, 0x19ca635b5f2e55c9ULL,
+		0xe97ea0d967813fe7ULL, 0xcb91ad8053785b0bULL, 0xaca0ba6b0e73f63fULL, 0x8e4fb7323a8a92d3ULL,
+		0x62c295bdb464ac57ULL, 0x402d98e4809dc8bbULL, 0x271c8f0fdd96658fULL, 0x05f38256e96f0163ULL,
+		0x6cde653b6f440602ULL, 0x4e3168625bbd62eeULL, 0x29007f8906b6cfdaULL, 0x0bef72d0324fab36ULL,
+		0xe762505fbca195b2ULL, 0xc58d5d068858f15eULL, 0xa2bc4aedd5535c6aULL, 0x805347b4e1aa3886ULL,
+		0x30c26aafb90933e3ULL, 0x122d67f68df0570fULL, 0x751c701dd0fbfa3bULL, 0x57f37d44e4029ed7ULL,
+		0xbb7e5fcb6aeca053ULL, 0x999152925e15c4bfULL, 0xfea04579031e698bULL, 0xdc4f482037e70d67ULL,
+		0xb562af4db1cc0a06ULL, 0x978da21485356eeaULL, 0xf0bcb5ffd83ec3deULL, 0xd253b8a6ecc7a732ULL,
+		0x3ede9a29622999b6ULL, 0x1c31977056d0fd5aULL, 0x7b00809b0bdb506eULL, 0x59ef8dc23f223482ULL,
+		0xa95b4e40078d5eacULL, 0x8bb4431933743a40ULL, 0xec8554f26e7f9774ULL, 0xce6a59ab5a86f398ULL,
+		0x22e77b24d468cd1cULL, 0x0008767de091a9f0ULL, 0x67396196bd9a04c4ULL, 0x45d66ccf89636028ULL,
+		0x2cfb8ba20f486749ULL, 0x0e1486fb3bb103a5ULL, 0x6925911066baae91ULL, 0x4bca9c495243ca7dULL,
+		0xa747bec6dcadf4f9ULL, 0x85a8b39fe8549015ULL, 0xe299a474b55f3d21ULL, 0xc076a92d81a659cdULL,
+		0x91288c5b6b0ff7f8ULL, 0xb3c781025ff69314ULL, 0xd4f696e902fd3e20ULL, 0xf6199bb036045accULL,
+		0x1a94b93fb8ea6448ULL, 0x387bb4668c1300a4ULL, 0x5f4aa38dd118ad90ULL, 0x7da5aed4e5e1c97cULL,
+		0x148849b963cace1dULL, 0x366744e05733aaf1ULL, 0x5156530b0a3807c5ULL, 0x73b95e523ec16329ULL,
+		0x9f347cddb02f5dadULL, 0xbddb718484d63941ULL, 0xdaea666fd9dd9475ULL, 0xf8056b36ed24f099ULL,
+		0x08b1a8b4d58b9ab7ULL, 0x2a5ea5ede172fe5bULL, 0x4d6fb206bc79536fULL, 0x6f80bf5f88803783ULL,
+		0x830d9dd0066e0907ULL, 0xa1e2908932976debULL, 0xc6d387626f9cc0dfULL, 0xe43c8a3b5b65a433ULL,
+		0x8d116d56dd4ea352ULL, 0xaffe600fe9b7c7beULL, 0xc8cf77e4b4bc6a8aULL, 0xea207abd80450e66ULL,
+		0x06ad58320eab30e2ULL, 0x2442556b3a52540eULL, 0x437342806759f93aULL, 0x619c4fd953a09dd6ULL,
+		0xe1cf086db20aa550ULL, 0xc320053486f3c1bcULL, 0xa41112dfdbf86c88ULL, 0x86fe1f86ef010864ULL,
+		0x6a733d0961ef36e0ULL, 0x489c30505516520cULL, 0x2fad27bb081dff38ULL, 0x0d422ae23ce49bd4ULL,
+		0x646fcd8fbacf9cb5ULL, 0x4680c0d68e36f859ULL, 0x21b1d73dd33d556dULL, 0x035eda64e7c43181ULL,
+		0xefd3f8eb692a0f05ULL, 0xcd3cf5b25dd36be9ULL, 0xaa0de25900d8c6ddULL, 0x88e2ef003421a231ULL,
+		0x78562c820c8ec81fULL, 0x5ab921db3877acf3ULL, 0x3d883630657c01c7ULL, 0x1f673b695185652bULL,
+		0xf3ea19e6df6b5bafULL, 0xd10514bfeb923f43ULL, 0xb6340354b6999277ULL, 0x94db0e0d8260f69bULL,
+		0xfdf6e960044bf1faULL, 0xdf19e43930b29516ULL, 0xb828f3d26db93822ULL, 0x9ac7fe8b59405cceULL,
+		0x764adc04d7ae624aULL, 0x54a5d15de35706a6ULL, 0x3394c6b6be5cab92ULL, 0x117bcbef8aa5cf7eULL,
+		0x4025ee99600c614bULL, 0x62cae3c054f505a7ULL, 0x05fbf42b09fea893ULL, 0x2714f9723d07cc7fULL,
+		0xcb99dbfdb3e9f2fbULL, 0xe976d6a487109617ULL, 0x8e47c14fda1b3b23ULL, 0xaca8cc16eee25fcfULL,
+		0xc5852b7b68c958aeULL, 0xe76a26225c303c42ULL, 0x805b31c9013b9176ULL, 0xa2b43c9035c2f59aULL,
+		0x4e391e1fbb2ccb1eULL, 0x6cd613468fd5aff2ULL, 0x0be704add2de02c6ULL, 0x290809f4e627662aULL,
+		0xd9bcca76de880c04ULL, 0xfb53c72fea7168e8ULL, 0x9c62d0c4b77ac5dcULL, 0xbe8ddd9d8383a130ULL,
+		0x5200ff120d6d9fb4ULL, 0x70eff24b3994fb58ULL, 0x17dee5a0649f566cULL, 0x3531e8f950663280ULL,
+		0x5c1c0f94d64d35e1ULL, 0x7ef302cde2b4510dULL, 0x19c21526bfbffc39ULL, 0x3b2d187f8b4698d5ULL,
+		0xd7a03af005a8a651ULL, 0xf54f37a93151c2bdULL, 0x927e20426c5a6f89ULL, 0xb0912d1b58a30b65ULL
+	},
+	{
+		0x0000000000000000ULL, 0xdabe95afc7875f40ULL, 0x27a584742000a005ULL, 0xfd1b11dbe787ff45ULL,
+		0x4f4b08e84001400aULL, 0x95f59d4787861f4aULL, 0x68ee8c9c6001e00fULL, 0xb2501933a786bf4fULL,
+		0x9e9611d080028014ULL, 0x4428847f4785df54ULL, 0xb93395a4a0022011ULL, 0x638d000b67857f51ULL,
+		0xd1dd1938c003c01eULL, 0x0b638c9707849f5eULL, 0xf6789d4ce003601bULL, 0x2cc608e327843f5bULL,
+		0xaff48c8aaf0b1eadULL, 0x754a1925688c41edULL, 0x885108fe8f0bbea8ULL, 0x52ef9d51488ce1e8ULL,
+		0xe0bf8462ef0a5ea7ULL, 0x3a0111cd288d01e7ULL, 0xc71a0016cf0afea2ULL, 0x1da495b9088da1e2ULL,
+		0x31629d5a2f099eb9ULL, 0xebdc08f5e88ec1f9ULL, 0x16c7192e0f093ebcULL, 0xcc798c81c88e61fcULL,
+		0x7e2995b26f08deb3ULL, 0xa497001da88f81f3ULL, 0x598c11c64f087eb6ULL, 0x83328469888f21f6ULL,
+		0xcd31b63ef11823dfULL, 0x178f2391369f7c9fULL, 0xea94324ad11883daULL, 0x302aa7e5169fdc9aULL,
+		0x827abed6b11963d5ULL, 0x58c42b79769e3c95ULL, 0xa5df3aa29119c3d0ULL, 0x7f61af0d569e9c90ULL,
+		0x53a7a7ee711aa3cbULL, 0x89193241b69dfc8bULL, 0x7402239a511a03ceULL, 0xaebcb635969d5c8eULL,
+		0x1cecaf06311be3c1ULL, 0xc6523aa9f69cbc81ULL, 0x3b492b72111b43c4ULL, 0xe1f7beddd69c1c84ULL,
+		0x62c53ab45e133d72ULL, 0xb87baf1b99946232ULL, 0x4560bec07e139d77ULL, 0x9fde2b6fb994c237ULL,
+		0x2d8e325c1e127d78ULL, 0xf730a7f3d9952238ULL, 0x0a2bb6283e12dd7dULL, 0xd0952387f995823dULL,
+		0xfc532b64de11bd66ULL, 0x26edbecb1996e226ULL, 0xdbf6af10fe111d63ULL, 0x01483abf39964223ULL,
+		0xb318238c9e10fd6cULL, 0x69a6b6235997a22cULL, 0x94bda7f8be105d69ULL, 0x4e03325779970229ULL,
+		0x08bbc3564d3e593bULL, 0xd20556f98ab9067bULL, 0x2f1e47226d3ef93eULL, 0xf5a0d28daab9a67eULL,
+		0x47f0cbbe0d3f1931ULL, 0x9d4e5e11cab84671ULL, 0x60554fca2d3fb934ULL, 0xbaebda65eab8e674ULL,
+		0x962dd286cd3cd92fULL, 0x4c9347290abb866fULL, 0xb18856f2ed3c792aULL, 0x6b36c35d2abb266aULL,
+		0xd966da6e8d3d9925ULL, 0x03d84fc14abac665ULL, 0xfec35e1aad3d3920ULL, 0x247dcbb56aba6660ULL,
+		0xa74f4fdce2354796ULL, 0x7df1da7325b218d6ULL, 0x80eacba8c235e793ULL, 0x5a545e0705b2b8d3ULL,
+		0xe8044734a234079cULL, 0x32bad29b65b358dcULL, 0xcfa1c3408234a799ULL, 0x151f56ef45b3f8d9ULL,
+		0x39d95e0c6237c782ULL, 0xe367cba3a5b098c2ULL, 0x1e7cda7842376787ULL, 0xc4c24fd785b038c7ULL,
+		0x769256e422368788ULL, 0xac2cc34be5b1d8c8ULL, 0x5137d2900236278dULL, 0x8b89473fc5b178cdULL,
+		0xc58a7568bc267ae4ULL, 0x1f34e0c77ba125a4ULL, 0xe22ff11c9c26dae1ULL, 0x389164b35ba185a1ULL,
+		0x8ac17d80fc273aeeULL, 0x507fe82f3ba065aeULL, 0xad64f9f4dc279aebULL, 0x77da6c5b1ba0c5abULL,
+		0x5b1c64b83c24faf0ULL, 0x81a2f117fba3a5b0ULL, 0x7cb9e0cc1c245af5ULL, 0xa6077563dba305b5ULL,
+		0x14576c507c25bafaULL, 0xcee9f9ffbba2e5baULL, 0x33f2e8245c251affULL, 0xe94c7d8b9ba245bfULL,
+		0x6a7ef9e2132d6449ULL, 0xb0c06c4dd4aa3b09ULL, 0x4ddb7d96332dc44cULL, 0x9765e839f4aa9b0cULL,
+		0x2535f10a532c2443ULL, 0xff8b64a594ab7b03ULL, 0x0290757e732c8446ULL, 0xd82ee0d1b4abdb06ULL,
+		0xf4e8e832932fe45dULL, 0x2e567d9d54a8bb1dULL, 0xd34d6c46b32f4458ULL, 0x09f3f9e974a81b18ULL,
+		0xbba3e0dad32ea457ULL, 0x611d757514a9fb17ULL, 0x9c0664aef32e0452ULL, 0x46b8f10134a95b12ULL,
+		0x117786ac9a7cb276ULL, 0xcbc913035dfbed36ULL, 0x36d202d8ba7c1273ULL, 0xec6c97777dfb4d33ULL,
+		0x5e3c8e44da7df27cULL, 0x84821beb1dfaad3cULL, 0x79990a30fa7d5279ULL, 0xa3279f9f3dfa0d39ULL,
+		0x8fe1977c1a7e3262ULL, 0x555f02d3ddf96d22ULL, 0xa84413083a7e9267ULL, 0x72fa86a7fdf9cd27ULL,
+		0xc0aa9f945a7f7268ULL, 0x1a140a3b9df82d28ULL, 0xe70f1be07a7fd26dULL, 0x3db18e4fbdf88d2dULL,
+		0xbe830a263577acdbULL, 0x643d9f89f2f0f39bULL, 0x99268e5215770cdeULL, 0x43981bfdd2f0539eULL,
+		0xf1c802ce7576ecd1ULL, 0x2b769761b2f1b391ULL, 0xd66d86ba55764cd4ULL, 0x0cd3131592f11394ULL,
+		0x20151bf6b5752ccfULL, 0xfaab8e5972f2738fULL, 0x07b09f8295758ccaULL, 0xdd0e0a2d52f2d38aULL,
+		0x6f5e131ef5746cc5ULL, 0xb5e086b132f33385ULL, 0x48fb976ad574ccc0ULL, 0x924502c512f39380ULL,
+		0xdc4630926b6491a9ULL, 0x06f8a53dace3cee9ULL, 0xfbe3b4e64b6431acULL, 0x215d21498ce36eecULL,
+		0x930d387a2b65d1a3ULL, 0x49b3add5ece28ee3ULL, 0xb4a8bc0e0b6571a6ULL, 0x6e1629a1cce22ee6ULL,
+		0x42d02142eb6611bdULL, 0x986eb4ed2ce14efdULL, 0x6575a536cb66b1b8ULL, 0xbfcb30990ce1eef8ULL,
+		0x0d9b29aaab6751b7ULL, 0xd725bc056ce00ef7ULL, 0x2a3eadde8b67f1b2ULL, 0xf08038714ce0aef2ULL,
+		0x73b2bc18c46f8f04ULL, 0xa90c29b703e8d044ULL, 0x5417386ce46f2f01ULL, 0x8ea9adc323e87041ULL,
+		0x3cf9b4f0846ecf0eULL, 0xe647215f43e9904eULL, 0x1b5c3084a46e6f0bULL, 0xc1e2a52b63e9304bULL,
+		0xed24adc8446d0f10ULL, 0x379a386783ea5050ULL, 0xca8129bc646daf15ULL, 0x103fbc13a3eaf055ULL,
+		0xa26fa520046c4f1aULL, 0x78d1308fc3eb105aULL, 0x85ca2154246cef1fULL, 0x5f74b4fbe3ebb05fULL,
+		0x19cc45fad742eb4dULL, 0xc372d05510c5b40dULL, 0x3e69c18ef7424b48ULL, 0xe4d7542130c51408ULL,
+		0x56874d129743ab47ULL, 0x8c39d8bd50c4f407ULL, 0x7122c966b7430b42ULL, 0xab9c5cc970c45402ULL,
+		0x875a542a57406b59ULL, 0x5de4c18590c73419ULL, 0xa0ffd05e7740cb5cULL, 0x7a4145f1b0c7941cULL,
+		0xc8115cc217412b53ULL, 0x12afc96dd0c67413ULL, 0xefb4d8b637418b56ULL, 0x350a4d19f0c6d416ULL,
+		0xb638c9707849f5e0ULL, 0x6c865cdfbfceaaa0ULL, 0x919d4d04584955e5ULL, 0x4b23d8ab9fce0aa5ULL,
+		0xf973c1983848b5eaULL, 0x23cd5437ffcfeaaaULL, 0xded645ec184815efULL, 0x0468d043dfcf4aafULL,
+		0x28aed8a0f84b75f4ULL, 0xf2104d0f3fcc2ab4ULL, 0x0f0b5cd4d84bd5f1ULL, 0xd5b5c97b1fcc8ab1ULL,
+		0x67e5d048b84a35feULL, 0xbd5b45e77fcd6abeULL, 0x4040543c984a95fbULL, 0x9afec1935fcdcabbULL,
+		0xd4fdf3c4265ac892ULL, 0x0e43666be1dd97d2ULL, 0xf35877b0065a6897ULL, 0x29e6e21fc1dd37d7ULL,
+		0x9bb6fb2c665b8898ULL, 0x41086e83a1dcd7d8ULL, 0xbc137f58465b289dULL, 0x66adeaf781dc77ddULL,
+		0x4a6be214a6584886ULL, 0x90d577bb61df17c6ULL, 0x6dce66608658e883ULL, 0xb770f3cf41dfb7c3ULL,
+		0x0520eafce659088cULL, 0xdf9e7f5321de57ccULL, 0x22856e88c659a889ULL, 0xf83bfb2701def7c9ULL,
+		0x7b097f4e8951d63fULL, 0xa1b7eae14ed6897fULL, 0x5cacfb3aa951763aULL, 0x86126e956ed6297aULL,
+		0x344277a6c9509635ULL, 0xeefce2090ed7c975ULL, 0x13e7f3d2e9503630ULL, 0xc959667d2ed76970ULL,
+		0xe59f6e9e0953562bULL, 0x3f21fb31ced4096bULL, 0xc23aeaea2953f62eULL, 0x18847f45eed4a96eULL,
+		0xaad4667649521621ULL, 0x706af3d98ed54961ULL, 0x8d71e2026952b624ULL, 0x57cf77adaed5e964ULL
+	}
+};
+
+/* The folding constants of the ECMA-182 (CRC-64/XZ) polynomial
+ */
+const uint64_t crc64_folding_constants_ecma182[ 4 ] = {
+	0x6ae3efbb9dd441f3ULL, 0x081f6054a7842df4ULL,
+	0xe05dd497ca393ae4ULL, 0xdabe95afc7875f40ULL
+};
+
@@ -0,0 +1,45 @@
+/*
+ * CRC-64 lookup tables
+ *
+ * Copyright (C) 2008-2019, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This software is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This software is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this software.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#if !defined( _CRC64_TABLES_H )
+#define _CRC64_TABLES_H
+
+#include <common.h>
+#include <types.h>
+
+#if defined( __cplusplus )
+extern "C" {
+#endif
+
+extern const uint64_t crc64_slicing_tables_default[ 8 ][ 256 ];
+
+extern const uint64_t crc64_folding_constants_default[ 4 ];
+
+extern const uint64_t crc64_slicing_tables_ecma182[ 8 ][ 256 ];
+
+extern const uint64_t crc64_folding_constants_ecma182[ 4 ];
+
+#if defined( __cplusplus )
+}
+#endif
+
+#endif /* !defined( _CRC64_TABLES_H ) */
+
@@ -0,0 +1,843 @@
+/*
+ * Calculates a CRC of file data
+ *
+ * Copyright (C) 2008-2019, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This software is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This software is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this software.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <file_stream.h>
+#include <memory.h>
+#include <system_string.h>
+#include <types.h>
+
+#if defined( HAVE_STDLIB_H )
+#include <stdlib.h>
+#endif
+
+#include "assorted_batch.h"
+#include "assorted_getopt.h"
+#include "assorted_input_file.h"
+#include "assorted_libcerror.h"
+#include "assorted_libcfile.h"
+#include "assorted_libcnotify.h"
+#include "assorted_output.h"
+#include "crc.h"
+
+/* The size of the buffer used to read the source data
+ */
+#define CRCSUM_BUFFER_SIZE		( 4 * 1024 * 1024 )
+
+/* Prints the executable usage information
+ */
+void usage_fprint(
+      FILE *stream )
+{
+	if( stream == NULL )
+	{
+		return;
+	}
+	fprintf( stream, "Use crcsum to calculate a CRC of file data.\n\n" );
+
+	fprintf( stream, "Usage: crcsum [ -C checksum_list ] [ -i initial_value ] [ -j threads ]\n"
+	                 "              [ -m model ] [ -o offset ] [ -p polynomial ] [ -s size ]\n"
+	                 "              [ -S format ] [ -u block_size ] [ -w width ]\n"
+	                 "              [ -x xor_value ] [ -bhlrvV ] source ...\n\n" );
+
+	fprintf( stream, "\tsource: the source file, in batch mode the source files and\n"
+	                 "\t        directories, where - reads the paths from stdin\n\n" );
+
+	fprintf( stream, "\t-b:     batch mode, calculates the CRC of every source file and\n"
+	                 "\t        of every file in the source directories, or of the files\n"
+	                 "\t        of which the paths are read from stdin if no source is\n"
+	                 "\t        provided, and prints a line per file in the format of\n"
+	                 "\t        sha256sum, implied when multiple sources are provided\n" );
+	fprintf( stream, "\t-C:     verify the CRC of the files in a checksum list in\n"
+	                 "\t        the format of sha256sum, where - reads the list from stdin,\n"
+	                 "\t        implies -b\n" );
+	fprintf( stream, "\t-h:     shows this help\n" );
+	fprintf( stream, "\t-i:     initial value of the register of a custom model\n"
+	                 "\t        (default is 0)\n" );
+	fprintf( stream, "\t-j:     number of threads used in batch mode (default is %d)\n",
+	 ASSORTED_BATCH_DEFAULT_NUMBER_OF_THREADS );
+	fprintf( stream, "\t-l:     lists the models\n" );
+	fprintf( stream, "\t-m:     model, refer to -l for the options (default is crc-32)\n" );
+	fprintf( stream, "\t-o:     data offset (default is 0)\n" );
+	fprintf( stream, "\t-p:     polynomial of a custom model in normal bit order,\n"
+	                 "\t        without the x^width term\n" );
+	fprintf( stream, "\t-r:     the input and output of a custom model are reflected\n" );
+	fprintf( stream, "\t-s:     size of data (default is the file size)\n" );
+	fprintf( stream, "\t-S:     print timing and throughput statistics of the open,\n"
+	                 "\t        read, compute and write phases and the peak memory\n"
+	                 "\t        size to stderr in the format: text or json\n" );
+	fprintf( stream, "\t-u:     read the source unbuffered using direct I/O in blocks of\n"
+	                 "\t        block_size bytes, which must be a multiple of %d, to\n"
+	                 "\t        bypass the system cache, e.g. when reading a device\n",
+	 ASSORTED_INPUT_FILE_DIRECT_IO_ALIGNMENT );
+	fprintf( stream, "\t-v:     verbose output to stderr\n" );
+	fprintf( stream, "\t-V:     print version\n" );
+	fprintf( stream, "\t-w:     width of a custom model in bits, between %d and %d,\n"
+	                 "\t        which is used instead of the model\n",
+	 CRC_MINIMUM_WIDTH,
+	 CRC_MAXIMUM_WIDTH );
+	fprintf( stream, "\t-x:     value the CRC of a custom model is XOR-ed with\n"
+	                 "\t        (default is 0)\n" );
+	fprintf( stream, "\n" );
+}
+
+/* Prints the models
+ */
+void crcsum_models_fprint(
+      FILE *stream )
+{
+	const crc_parameters_t *parameters = NULL;
+	int number_of_digits               = 0;
+
+	if( stream == NULL )
+	{
+		return;
+	}
+	fprintf( stream, "Models:\n" );
+
+	for( parameters = crc_presets;
+	     parameters->name != NULL;
+	     parameters++ )
+	{
+		number_of_digits = ( parameters->width + 3 ) / 4;
+
+		fprintf(
+		 stream,
+		 "\t%s: width: %" PRIu8 ", polynomial: 0x%0*" PRIx64 ", reflected: %s, initial value: 0x%0*" PRIx64 ", XOR value: 0x%0*" PRIx64 ", check: 0x%0*" PRIx64 "\n",
+		 parameters->name,
+		 parameters->width,
+		 number_of_digits,
+		 parameters->polynomial,
+		 ( parameters->reflected != 0 ) ? "yes" : "no",
+		 number_of_digits,
+		 parameters->initial_value,
+		 number_of_digits,
+		 parameters->xor_value,
+		 number_of_digits,
+		 parameters->check_value );
+	}
+	fprintf( stream, "\n" );
+}
+
+/* Retrieves the parameters of a model
+ * Returns 1 if successful, 0 if no such model or -1 on error
+ */
+int crcsum_get_model(
+     const system_character_t *name,
+     const crc_parameters_t **parameters,
+     libcerror_error_t **error )
+{
+	const crc_parameters_t *preset = NULL;
+	static char *function          = "crcsum_get_model";
+	size_t name_index              = 0;
+
+	if( name == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid name.",
+		 function );
+
+		return( -1 );
+	}
+	if( parameters == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid parameters.",
+		 function );
+
+		return( -1 );
+	}
+	/* The names of the models are ASCII, hence they are compared per character
+	 * to support both narrow and wide system strings
+	 */
+	for( preset = crc_presets;
+	     preset->name != NULL;
+	     preset++ )
+	{
+		for( name_index = 0;
+		     preset->name[ name_index ] != 0;
+		     name_index++ )
+		{
+			if( (system_character_t) preset->name[ name_index ] != name[ name_index ] )
+			{
+				break;
+			}
+		}
+		if( ( preset->name[ name_index ] == 0 )
+		 && ( name[ name_index ] == 0 ) )
+		{
+			*parameters = preset;
+
+			return( 1 );
+		}
+	}
+	return( 0 );
+}
+
+/* Calculates the CRC of a buffer in batch mode
+ * The arguments contain the engine
+ * Returns 1 if successful or -1 on error
+ */
+int crcsum_batch_calculate(
+     void *arguments,
+     uint64_t *checksum_value,
+     uint8_t *buffer,
+     size_t size,
+     libcerror_error_t **error )
+{
+	static char *function = "crcsum_batch_calculate";
+
+	if( arguments == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid arguments.",
+		 function );
+
+		return( -1 );
+	}
+	if( checksum_value == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid checksum value.",
+		 function );
+
+		return( -1 );
+	}
+	return( crc_engine_calculate(
+	         (crc_engine_t *) arguments,
+	         checksum_value,
+	         buffer,
+	         size,
+	         *checksum_value,
+	         error ) );
+}
+
+/* The main program
+ */
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+int wmain( int argc, wchar_t * const argv[] )
+#else
+int main( int argc, char * const argv[] )
+#endif
+{
+	crc_parameters_t custom_parameters;
+
+	assorted_batch_t *batch                      = NULL;
+	const crc_parameters_t *parameters           = NULL;
+	crc_engine_t *engine                         = NULL;
+	libcerror_error_t *error                     = NULL;
+	assorted_input_file_t *source_file           = NULL;
+	system_character_t *option_model             = NULL;
+	system_character_t *option_statistics_format = NULL;
+	system_character_t *source                   = NULL;
+	system_character_t *checksum_list            = NULL;
+	uint8_t *buffer                              = NULL;
+	char *program                                = "crcsum";
+	system_integer_t option                      = 0;
+	size64_t remaining_size                      = 0;
+	size64_t source_size                         = 0;
+	size_t buffer_size                           = 0;
+	size_t direct_io_block_size                  = 0;
+	size_t read_size                             = 0;
+	ssize_t read_count                           = 0;
+	off_t source_offset                          = 0;
+	uint64_t calculated_crc                      = 0;
+	uint8_t batch_mode                           = 0;
+	uint8_t list_models                          = 0;
+	int number_of_batch_threads                  = ASSORTED_BATCH_DEFAULT_NUMBER_OF_THREADS;
+	int result                                   = 0;
+	int verbose                                  = 0;
+
+	if( memory_set(
+	     &custom_parameters,
+	     0,
+	     sizeof( crc_parameters_t ) ) == NULL )
+	{
+		fprintf(
+		 stderr,
+		 "Unable to clear custom parameters.\n" );
+
+		return( EXIT_FAILURE );
+	}
+	custom_parameters.name = "custom";
+
+	while( ( option = assorted_getopt(
+	                   argc,
+	                   argv,
+	                   _SYSTEM_STRING( "bC:hi:j:lm:o:p:rs:S:u:vVw:x:" ) ) ) != (system_integer_t) -1 )
+	{
+		switch( option )
+		{
+			case '?':
+			default:
+				assorted_output_version_fprint(
+				 stdout,
+				 program );
+
+				fprintf(
+				 stderr,
+				 "Invalid argument: %" PRIs_SYSTEM "\n",
+				 argv[ optind ] );
+
+				usage_fprint(
+				 stdout );
+
+				return( EXIT_FAILURE );
+
+			case 'b':
+				batch_mode = 1;
+
+				break;
+
+			case 'C':
+				checksum_list = optarg;
+				batch_mode    = 1;
+
+				break;
+
+			case 'h':
+				assorted_output_version_fprint(
+				 stdout,
+				 program );
+
+				usage_fprint(
+				 stdout );
+
+				return( EXIT_SUCCESS );
+
+			case 'i':
+				custom_parameters.initial_value = (uint64_t) strtoull( optarg, NULL, 0 );
+
+				break;
+
+			case 'j':
+				number_of_batch_threads = (int) atol( optarg );
+
+				break;
+
+			case 'l':
+				list_models = 1;
+
+				break;
+
+			case 'm':
+				option_model = optarg;
+
+				break;
+
+			case 'o':
+				source_offset = atol( optarg );
+
+				break;
+
+			case 'p':
+				custom_parameters.polynomial = (uint64_t) strtoull( optarg, NULL, 0 );
+
+				break;
+
+			case 'r':
+				custom_parameters.reflected = 1;
+
+				break;
+
+			case 's':
+				source_size = atol( optarg );
+
+				break;
+
+			case 'S':
+				option_statistics_format = optarg;
+
+				break;
+
+			case 'u':
+				direct_io_block_size = (size_t) atol( optarg );
+
+				break;
+
+			case 'v':
+				verbose = 1;
+
+				break;
+
+			case 'V':
+				assorted_output_version_fprint(
+				 stdout,
+				 program );
+
+				assorted_output_copyright_fprint(
+				 stdout );
+
+				return( EXIT_SUCCESS );
+
+			case 'w':
+				custom_parameters.width = (uint8_t) atol( optarg );
+
+				break;
+
+			case 'x':
+				custom_parameters.xor_value = (uint64_t) strtoull( optarg, NULL, 0 );
+
+				break;
+		}
+	}
+	if( list_models != 0 )
+	{
+		assorted_output_version_fprint(
+		 stdout,
+		 program );
+
+		crcsum_models_fprint(
+		 stdout );
+
+		return( EXIT_SUCCESS );
+	}
+	if( ( argc - optind ) > 1 )
+	{
+		batch_mode = 1;
+	}
+	if( batch_mode == 0 )
+	{
+		assorted_output_version_fprint(
+		 stdout,
+		 program );
+	}
+	if( ( batch_mode == 0 )
+	 && ( optind == argc ) )
+	{
+		fprintf(
+		 stderr,
+		 "Missing source file.\n" );
+
+		usage_fprint(
+		 stdout );
+
+		return( EXIT_FAILURE );
+	}
+	source = argv[ optind ];
+
+	libcnotify_stream_set(
+	 stderr,
+	 NULL );
+	libcnotify_verbose_set(
+	 verbose );
+
+	if( custom_parameters.width != 0 )
+	{
+		if( option_model != NULL )
+		{
+			fprintf(
+			 stderr,
+			 "Model and width cannot be combined.\n" );
+
+			return( EXIT_FAILURE );
+		}
+		parameters = &custom_parameters;
+	}
+	else if( option_model != NULL )
+	{
+		result = crcsum_get_model(
+		          option_model,
+		          &parameters,
+		          &error );
+
+		if( result == -1 )
+		{
+			fprintf(
+			 stderr,
+			 "Unable to retrieve model.\n" );
+
+			goto on_error;
+		}
+		else if( result == 0 )
+		{
+			fprintf(
+			 stderr,
+			 "Unsupported model: %" PRIs_SYSTEM "\n",
+			 option_model );
+
+			return( EXIT_FAILURE );
+		}
+	}
+	else
+	{
+		result = crcsum_get_model(
+		          _SYSTEM_STRING( "crc-32" ),
+		          &parameters,
+		          &error );
+
+		if( result != 1 )
+		{
+			fprintf(
+			 stderr,
+			 "Unable to retrieve default model.\n" );
+
+			goto on_error;
+		}
+	}
+	if( assorted_output_statistics_initialize(
+	     option_statistics_format,
+	     &error ) != 1 )
+	{
+		fprintf(
+		 stderr,
+		 "Unable to initialize statistics.\n" );
+
+		goto on_error;
+	}
+	if( crc_engine_initialize(
+	     &engine,
+	     parameters,
+	     &error ) != 1 )
+	{
+		fprintf(
+		 stderr,
+		 "Unable to create engine.\n" );
+
+		goto on_error;
+	}
+	if( batch_mode != 0 )
+	{
+		if( ( source_offset != 0 )
+		 || ( source_size != 0 ) )
+		{
+			fprintf(
+			 stderr,
+			 "Offset and size are not supported in batch mode.\n" );
+
+			goto on_error;
+		}
+		if( direct_io_block_size != 0 )
+		{
+			fprintf(
+			 stderr,
+			 "Direct I/O is not supported in batch mode.\n" );
+
+			goto on_error;
+		}
+		if( ( number_of_batch_threads <= 0 )
+		 || ( number_of_batch_threads > ASSORTED_BATCH_MAXIMUM_NUMBER_OF_THREADS ) )
+		{
+			fprintf(
+			 stderr,
+			 "Unsupported number of threads, value must be between 1 and %d.\n",
+			 ASSORTED_BATCH_MAXIMUM_NUMBER_OF_THREADS );
+
+			goto on_error;
+		}
+		/* The checksum values of a CRC of at most 32 bits are printed as 8 digits
+		 */
+		if( assorted_batch_initialize(
+		     &batch,
+		     crcsum_batch_calculate,
+		     (void *) engine,
+		     engine->empty_data_crc,
+		     ( parameters->width <= 32 ) ? 4 : 8,
+		     number_of_batch_threads,
+		     &error ) != 1 )
+		{
+			fprintf(
+			 stderr,
+			 "Unable to create batch.\n" );
+
+			goto on_error;
+		}
+		result = assorted_batch_process(
+		          batch,
+		          argc - optind,
+		          &( argv[ optind ] ),
+		          checksum_list,
+		          &error );
+
+		if( result == -1 )
+		{
+			fprintf(
+			 stderr,
+			 "Unable to process batch.\n" );
+
+			goto on_error;
+		}
+		if( assorted_batch_free(
+		     &batch,
+		     &error ) != 1 )
+		{
+			fprintf(
+			 stderr,
+			 "Unable to free batch.\n" );
+
+			goto on_error;
+		}
+		if( crc_engine_free(
+		     &engine,
+		     &error ) != 1 )
+		{
+			fprintf(
+			 stderr,
+			 "Unable to free engine.\n" );
+
+			goto on_error;
+		}
+		if( result != 1 )
+		{
+			return( EXIT_FAILURE );
+		}
+		return( EXIT_SUCCESS );
+	}
+
+	/* Open the source file
+	 */
+	if( assorted_input_file_initialize(
+	     &source_file,
+	     &error ) != 1 )
+	{
+		fprintf(
+		 stderr,
+		 "Unable to create source file.\n" );
+
+		goto on_error;
+	}
+	if( assorted_input_file_set_direct_io(
+	     source_file,
+	     direct_io_block_size,
+	     &error ) != 1 )
+	{
+		fprintf(
+		 stderr,
+		 "Unable to set direct I/O block size of source file.\n" );
+
+		goto on_error;
+	}
+	if( assorted_input_file_open(
+	     source_file,
+	     source,
+	     &error ) != 1 )
+	{
+		fprintf(
+		 stderr,
+		 "Unable to open source file.\n" );
+
+		goto on_error;
+	}
+	if( source_size == 0 )
+	{
+		if( assorted_input_file_get_size(
+		     source_file,
+		     &source_size,
+		     &error ) == -1 )
+		{
+			fprintf(
+			 stderr,
+			 "Unable to determine size of source file.\n" );
+
+			goto on_error;
+		}
+	}
+	if( source_size == 0 )
+	{
+		fprintf(
+		 stderr,
+		 "Invalid source size value is zero.\n" );
+
+		goto on_error;
+	}
+	buffer_size = CRCSUM_BUFFER_SIZE;
+
+	if( (size64_t) buffer_size > source_size )
+	{
+		buffer_size = (size_t) source_size;
+	}
+	/* Position the source file at the right offset
+	 */
+	if( assorted_input_file_seek_offset(
+	     source_file,
+	     source_offset,
+	     SEEK_SET,
+	     &error ) == -1 )
+	{
+		fprintf(
+		 stderr,
+		 "Unable to seek offset in source file.\n" );
+
+		goto on_error;
+	}
+	/* Read the next blocks ahead while the current block is processed
+	 */
+	if( assorted_input_file_set_read_ahead(
+	     source_file,
+	     buffer_size,
+	     ASSORTED_INPUT_FILE_DEFAULT_NUMBER_OF_READ_AHEAD_BLOCKS,
+	     &error ) != 1 )
+	{
+		fprintf(
+		 stderr,
+		 "Unable to set read-ahead of source file.\n" );
+
+		goto on_error;
+	}
+	/* Read the source data in blocks and pass the CRC of the previous
+	 * blocks as the initial value of the next block
+	 */
+	calculated_crc = engine->empty_data_crc;
+	remaining_size = source_size;
+
+	while( remaining_size > 0 )
+	{
+		read_size = buffer_size;
+
+		if( (size64_t) read_size > remaining_size )
+		{
+			read_size = (size_t) remaining_size;
+		}
+		read_count = assorted_input_file_read_data(
+		              source_file,
+		              &buffer,
+		              read_size,
+		              &error );
+
+		if( read_count != (ssize_t) read_size )
+		{
+			fprintf(
+			 stderr,
+			 "Unable to read from source file.\n" );
+
+			goto on_error;
+		}
+		if( crc_engine_calculate(
+		     engine,
+		     &calculated_crc,
+		     buffer,
+		     read_size,
+		     calculated_crc,
+		     &error ) != 1 )
+		{
+			fprintf(
+			 stderr,
+			 "Unable to calculate CRC.\n" );
+
+			goto on_error;
+		}
+		if( libcnotify_verbose != 0 )
+		{
+			libcnotify_print_data(
+			 buffer,
+			 read_size,
+			 0 );
+		}
+		remaining_size -= read_size;
+	}
+	/* Clean up
+	 */
+	if( assorted_input_file_close(
+	     source_file,
+	     &error ) != 0 )
+	{
+		fprintf(
+		 stderr,
+		 "Unable to close source file.\n" );
+
+		goto on_error;
+	}
+	if( assorted_input_file_free(
+	     &source_file,
+	     &error ) != 1 )
+	{
+		fprintf(
+		 stderr,
+		 "Unable to free source file.\n" );
+
+		goto on_error;
+	}
+	fprintf(
+	 stdout,
+	 "Calculated %s: %" PRIu64 " (0x%0*" PRIx64 ")\n",
+	 parameters->name,
+	 calculated_crc,
+	 ( parameters->width + 3 ) / 4,
+	 calculated_crc );
+
+	if( crc_engine_free(
+	     &engine,
+	     &error ) != 1 )
+	{
+		fprintf(
+		 stderr,
+		 "Unable to free engine.\n" );
+
+		goto on_error;
+	}
+	assorted_output_statistics_fprint(
+	 stderr,
+	 program,
+	 1,
+	 NULL );
+	assorted_output_statistics_free(
+	 NULL );
+
+	return( EXIT_SUCCESS );
+
+on_error:
+	if( error != NULL )
+	{
+		libcnotify_print_error_backtrace(
+		 error );
+		libcerror_error_free(
+		 &error );
+	}
+	assorted_output_statistics_fprint(
+	 stderr,
+	 program,
+	 -1,
+	 NULL );
+	assorted_output_statistics_free(
+	 NULL );
+	if( batch != NULL )
+	{
+		assorted_batch_free(
+		 &batch,
+		 NULL );
+	}
+	if( engine != NULL )
+	{
+		crc_engine_free(
+		 &engine,
+		 NULL );
+	}
+	if( source_file != NULL )
+	{
+		assorted_input_file_free(
+		 &source_file,
+		 NULL );
+	}
+	return( EXIT_FAILURE );
+}
+
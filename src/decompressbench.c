@@ -0,0 +1,1675 @@
+/*
+ * Benchmarks the decompression methods
+ *
+ * Copyright (C) 2008-2019, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This software is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This software is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this software.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <file_stream.h>
+#include <memory.h>
+#include <memory_arena.h>
+#include <system_string.h>
+#include <types.h>
+
+#if defined( HAVE_STDLIB_H )
+#include <stdlib.h>
+#endif
+
+#include "ascii7.h"
+#include "assorted_getopt.h"
+#include "assorted_input_file.h"
+#include "assorted_libcerror.h"
+#include "assorted_libcfile.h"
+#include "assorted_libcnotify.h"
+#include "assorted_libfwnt.h"
+#include "assorted_output.h"
+#include "assorted_timer.h"
+#include "deflate.h"
+#include "lzfu.h"
+#include "lznt1.h"
+#include "lzvn.h"
+#include "lzxpress.h"
+#include "mssearch.h"
+
+/* The maximum size of a source
+ */
+#define DECOMPRESSBENCH_MAXIMUM_SOURCE_SIZE	( 1024 * 1024 * 1024 )
+
+/* The default amount of uncompressed data produced per measurement
+ */
+#define DECOMPRESSBENCH_DEFAULT_TOTAL_SIZE	( 64 * 1024 * 1024 )
+
+/* The compression level used to compress the deflate inputs
+ */
+#define DECOMPRESSBENCH_DEFLATE_COMPRESSION_LEVEL	6
+
+enum DECOMPRESSBENCH_CODEC_TYPES
+{
+	DECOMPRESSBENCH_CODEC_TYPE_ASCII7	= 1,
+	DECOMPRESSBENCH_CODEC_TYPE_DEFLATE,
+	DECOMPRESSBENCH_CODEC_TYPE_LZFU,
+	DECOMPRESSBENCH_CODEC_TYPE_LZNT1,
+	DECOMPRESSBENCH_CODEC_TYPE_LZVN,
+	DECOMPRESSBENCH_CODEC_TYPE_LZXPRESS,
+	DECOMPRESSBENCH_CODEC_TYPE_LZXPRESS_HUFFMAN,
+	DECOMPRESSBENCH_CODEC_TYPE_LZXPRESS_HUFFMAN_LIBFWNT,
+	DECOMPRESSBENCH_CODEC_TYPE_MSSEARCH,
+	DECOMPRESSBENCH_CODEC_TYPE_MSSEARCH_BYTE_INDEX,
+	DECOMPRESSBENCH_CODEC_TYPE_MSSEARCH_RUN_LENGTH,
+	DECOMPRESSBENCH_CODEC_TYPE_MSSEARCH_RUN_LENGTH_UTF8
+};
+
+typedef struct decompressbench_codec decompressbench_codec_t;
+
+struct decompressbench_codec
+{
+	/* The codec type
+	 */
+	int codec_type;
+
+	/* The codec name
+	 */
+	const system_character_t *codec_name;
+
+	/* Value to indicate the inputs can be compressed by the benchmark
+	 * otherwise the codec requires precompressed sources
+	 */
+	uint8_t has_compressor;
+};
+
+/* The codecs, terminated by an empty entry
+ */
+decompressbench_codec_t decompressbench_codecs[] = {
+	{ DECOMPRESSBENCH_CODEC_TYPE_DEFLATE, _SYSTEM_STRING( "deflate" ), 1 },
+	{ DECOMPRESSBENCH_CODEC_TYPE_LZFU, _SYSTEM_STRING( "lzfu" ), 1 },
+	{ DECOMPRESSBENCH_CODEC_TYPE_LZNT1, _SYSTEM_STRING( "lznt1" ), 1 },
+	{ DECOMPRESSBENCH_CODEC_TYPE_LZVN, _SYSTEM_STRING( "lzvn" ), 1 },
+	{ DECOMPRESSBENCH_CODEC_TYPE_MSSEARCH, _SYSTEM_STRING( "mssearch" ), 1 },
+	{ DECOMPRESSBENCH_CODEC_TYPE_ASCII7, _SYSTEM_STRING( "ascii7" ), 0 },
+	{ DECOMPRESSBENCH_CODEC_TYPE_MSSEARCH_BYTE_INDEX, _SYSTEM_STRING( "mssearch_byte_index" ), 0 },
+	{ DECOMPRESSBENCH_CODEC_TYPE_MSSEARCH_RUN_LENGTH, _SYSTEM_STRING( "mssearch_run_length" ), 0 },
+	{ DECOMPRESSBENCH_CODEC_TYPE_MSSEARCH_RUN_LENGTH_UTF8, _SYSTEM_STRING( "mssearch_run_length_utf8" ), 0 },
+	{ DECOMPRESSBENCH_CODEC_TYPE_LZXPRESS, _SYSTEM_STRING( "lzxpress" ), 0 },
+	{ DECOMPRESSBENCH_CODEC_TYPE_LZXPRESS_HUFFMAN, _SYSTEM_STRING( "lzxpress_huffman" ), 0 },
+	{ DECOMPRESSBENCH_CODEC_TYPE_LZXPRESS_HUFFMAN_LIBFWNT, _SYSTEM_STRING( "lzxpress_huffman_libfwnt" ), 0 },
+	{ 0, NULL, 0 } };
+
+typedef struct decompressbench_input decompressbench_input_t;
+
+struct decompressbench_input
+{
+	/* The compressed data
+	 */
+	uint8_t *compressed_data;
+
+	/* The compressed data size
+	 */
+	size_t compressed_data_size;
+
+	/* The uncompressed data, which is NULL if not known
+	 */
+	const uint8_t *uncompressed_data;
+
+	/* The uncompressed data size
+	 */
+	size_t uncompressed_data_size;
+
+	/* The size of the buffer the data is decompressed into
+	 */
+	size_t uncompressed_buffer_size;
+};
+
+/* Prints the executable usage information
+ */
+void usage_fprint(
+      FILE *stream )
+{
+	if( stream == NULL )
+	{
+		return;
+	}
+	fprintf( stream, "Use decompressbench to benchmark the decompression methods.\n\n" );
+
+	fprintf( stream, "Usage: decompressbench [ -c codec ] [ -d size ] [ -n iterations ]\n"
+	                 "                       [ -s size ] [ -S format ] [ -hmpvV ] source(s)\n\n" );
+
+	fprintf( stream, "\tsource(s): the source files, which contain the uncompressed\n"
+	                 "\t           data that is compressed by the codecs that have\n"
+	                 "\t           a compressor, unless -p is specified\n\n" );
+
+	fprintf( stream, "\t-c:     only benchmark a specific codec, options: ascii7,\n"
+	                 "\t        deflate, lzfu, lznt1, lzvn, lzxpress, lzxpress_huffman,\n"
+	                 "\t        lzxpress_huffman_libfwnt, mssearch, mssearch_byte_index,\n"
+	                 "\t        mssearch_run_length, mssearch_run_length_utf8\n" );
+	fprintf( stream, "\t-d:     size of the decompressed data of precompressed sources\n"
+	                 "\t        if the codec does not store it (default is 16 times\n"
+	                 "\t        the size of the source)\n" );
+	fprintf( stream, "\t-h:     shows this help\n" );
+	fprintf( stream, "\t-m:     machine readable output, as comma separated values\n" );
+	fprintf( stream, "\t-n:     number of iterations over the inputs per measurement\n"
+	                 "\t        (default is the number needed to decompress 67108864\n"
+	                 "\t        bytes)\n" );
+	fprintf( stream, "\t-p:     the sources contain data compressed with the codec\n"
+	                 "\t        specified by -c, which is required for the codecs\n"
+	                 "\t        without a compressor\n" );
+	fprintf( stream, "\t-s:     size of the inputs the uncompressed data of a source\n"
+	                 "\t        is split into, where every input is compressed and\n"
+	                 "\t        decompressed separately (default is the source size)\n" );
+	fprintf( stream, "\t-S:     print timing and throughput statistics of the open,\n"
+	                 "\t        read, compute and write phases and the peak memory\n"
+	                 "\t        size to stderr in the format: text or json\n" );
+	fprintf( stream, "\t-v:     verbose output to stderr\n" );
+	fprintf( stream, "\t-V:     print version\n" );
+	fprintf( stream, "\n" );
+}
+
+/* Compresses data using a specific codec
+ * Returns 1 if successful or -1 on error
+ */
+int decompressbench_compress(
+     int codec_type,
+     const uint8_t *uncompressed_data,
+     size_t uncompressed_data_size,
+     uint8_t *compressed_data,
+     size_t *compressed_data_size,
+     libcerror_error_t **error )
+{
+	static char *function = "decompressbench_compress";
+	int result            = -1;
+
+	if( compressed_data_size == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid compressed data size.",
+		 function );
+
+		return( -1 );
+	}
+	switch( codec_type )
+	{
+		case DECOMPRESSBENCH_CODEC_TYPE_DEFLATE:
+			result = deflate_compress(
+			          uncompressed_data,
+			          uncompressed_data_size,
+			          DECOMPRESSBENCH_DEFLATE_COMPRESSION_LEVEL,
+			          compressed_data,
+			          compressed_data_size,
+			          error );
+			break;
+
+		case DECOMPRESSBENCH_CODEC_TYPE_LZFU:
+			result = lzfu_compress(
+			          (uint8_t *) uncompressed_data,
+			          uncompressed_data_size,
+			          compressed_data,
+			          compressed_data_size,
+			          error );
+			break;
+
+		case DECOMPRESSBENCH_CODEC_TYPE_LZNT1:
+			result = lznt1_compress(
+			          uncompressed_data,
+			          uncompressed_data_size,
+			          compressed_data,
+			          compressed_data_size,
+			          error );
+			break;
+
+		case DECOMPRESSBENCH_CODEC_TYPE_LZVN:
+			result = lzvn_compress(
+			          uncompressed_data,
+			          uncompressed_data_size,
+			          compressed_data,
+			          compressed_data_size,
+			          error );
+			break;
+
+		/* The mssearch encoding is its own inverse
+		 */
+		case DECOMPRESSBENCH_CODEC_TYPE_MSSEARCH:
+			result = mssearch_decode(
+			          compressed_data,
+			          *compressed_data_size,
+			          (uint8_t *) uncompressed_data,
+			          uncompressed_data_size,
+			          error );
+
+			if( result == 1 )
+			{
+				*compressed_data_size = uncompressed_data_size;
+			}
+			break;
+	}
+	if( result != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_COMPRESSION,
+		 LIBCERROR_COMPRESSION_ERROR_COMPRESS_FAILED,
+		 "%s: unable to compress data.",
+		 function );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Determines the uncompressed data size stored in compressed data
+ * Returns 1 if successful, 0 if the codec does not store the size or -1 on error
+ */
+int decompressbench_get_uncompressed_data_size(
+     int codec_type,
+     uint8_t *compressed_data,
+     size_t compressed_data_size,
+     size_t *uncompressed_data_size,
+     libcerror_error_t **error )
+{
+	static char *function = "decompressbench_get_uncompressed_data_size";
+	int result            = 0;
+
+	switch( codec_type )
+	{
+		case DECOMPRESSBENCH_CODEC_TYPE_ASCII7:
+			result = ascii7_get_uncompressed_data_size(
+			          compressed_data,
+			          compressed_data_size,
+			          uncompressed_data_size,
+			          error );
+			break;
+
+		case DECOMPRESSBENCH_CODEC_TYPE_LZFU:
+			result = lzfu_get_uncompressed_data_size(
+			          compressed_data,
+			          compressed_data_size,
+			          uncompressed_data_size,
+			          error );
+			break;
+
+		case DECOMPRESSBENCH_CODEC_TYPE_MSSEARCH:
+			*uncompressed_data_size = compressed_data_size;
+
+			result = 1;
+
+			break;
+
+		case DECOMPRESSBENCH_CODEC_TYPE_MSSEARCH_BYTE_INDEX:
+			result = mssearch_get_byte_index_uncompressed_data_size(
+			          compressed_data,
+			          compressed_data_size,
+			          uncompressed_data_size,
+			          error );
+			break;
+
+		case DECOMPRESSBENCH_CODEC_TYPE_MSSEARCH_RUN_LENGTH:
+			result = mssearch_get_run_length_uncompressed_utf16_string_size(
+			          compressed_data,
+			          compressed_data_size,
+			          uncompressed_data_size,
+			          error );
+			break;
+
+		case DECOMPRESSBENCH_CODEC_TYPE_MSSEARCH_RUN_LENGTH_UTF8:
+			result = mssearch_get_run_length_uncompressed_utf8_string_size(
+			          compressed_data,
+			          compressed_data_size,
+			          uncompressed_data_size,
+			          error );
+			break;
+
+		default:
+			break;
+	}
+	if( result == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve uncompressed data size.",
+		 function );
+
+		return( -1 );
+	}
+	return( result );
+}
+
+/* Decompresses data using a specific codec
+ * Returns 1 if successful or -1 on error
+ */
+int decompressbench_decompress(
+     int codec_type,
+     uint8_t *compressed_data,
+     size_t compressed_data_size,
+     uint8_t *uncompressed_data,
+     size_t *uncompressed_data_size,
+     libcerror_error_t **error )
+{
+	static char *function = "decompressbench_decompress";
+	int result            = -1;
+
+	if( uncompressed_data_size == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid uncompressed data size.",
+		 function );
+
+		return( -1 );
+	}
+	switch( codec_type )
+	{
+		case DECOMPRESSBENCH_CODEC_TYPE_ASCII7:
+			result = ascii7_decompress(
+			          uncompressed_data,
+			          *uncompressed_data_size,
+			          compressed_data,
+			          compressed_data_size,
+			          error );
+			break;
+
+		case DECOMPRESSBENCH_CODEC_TYPE_DEFLATE:
+			result = deflate_decompress(
+			          compressed_data,
+			          compressed_data_size,
+			          uncompressed_data,
+			          uncompressed_data_size,
+			          error );
+			break;
+
+		case DECOMPRESSBENCH_CODEC_TYPE_LZFU:
+			result = lzfu_decompress(
+			          compressed_data,
+			          compressed_data_size,
+			          uncompressed_data,
+			          uncompressed_data_size,
+			          error );
+			break;
+
+		case DECOMPRESSBENCH_CODEC_TYPE_LZNT1:
+			result = libfwnt_lznt1_decompress(
+			          compressed_data,
+			          compressed_data_size,
+			          uncompressed_data,
+			          uncompressed_data_size,
+			          error );
+			break;
+
+		case DECOMPRESSBENCH_CODEC_TYPE_LZVN:
+			result = lzvn_decompress(
+			          compressed_data,
+			          compressed_data_size,
+			          uncompressed_data,
+			          uncompressed_data_size,
+			          error );
+			break;
+
+		case DECOMPRESSBENCH_CODEC_TYPE_LZXPRESS:
+			result = libfwnt_lzxpress_decompress(
+			          compressed_data,
+			          compressed_data_size,
+			          uncompressed_data,
+			          uncompressed_data_size,
+			          error );
+			break;
+
+		case DECOMPRESSBENCH_CODEC_TYPE_LZXPRESS_HUFFMAN:
+			result = lzxpress_huffman_decompress(
+			          compressed_data,
+			          compressed_data_size,
+			          uncompressed_data,
+			          uncompressed_data_size,
+			          error );
+			break;
+
+		case DECOMPRESSBENCH_CODEC_TYPE_LZXPRESS_HUFFMAN_LIBFWNT:
+			result = libfwnt_lzxpress_huffman_decompress(
+			          compressed_data,
+			          compressed_data_size,
+			          uncompressed_data,
+			          uncompressed_data_size,
+			          error );
+			break;
+
+		case DECOMPRESSBENCH_CODEC_TYPE_MSSEARCH:
+			result = mssearch_decode(
+			          uncompressed_data,
+			          *uncompressed_data_size,
+			          compressed_data,
+			          compressed_data_size,
+			          error );
+
+			if( result == 1 )
+			{
+				*uncompressed_data_size = compressed_data_size;
+			}
+			break;
+
+		case DECOMPRESSBENCH_CODEC_TYPE_MSSEARCH_BYTE_INDEX:
+			result = mssearch_decompress_byte_indexed_compressed_data(
+			          uncompressed_data,
+			          uncompressed_data_size,
+			          compressed_data,
+			          compressed_data_size,
+			          error );
+			break;
+
+		case DECOMPRESSBENCH_CODEC_TYPE_MSSEARCH_RUN_LENGTH:
+			result = mssearch_decompress_run_length_compressed_utf16_string(
+			          uncompressed_data,
+			          *uncompressed_data_size,
+			          compressed_data,
+			          compressed_data_size,
+			          error );
+			break;
+
+		case DECOMPRESSBENCH_CODEC_TYPE_MSSEARCH_RUN_LENGTH_UTF8:
+			result = mssearch_decompress_run_length_compressed_utf8_string(
+			          uncompressed_data,
+			          *uncompressed_data_size,
+			          compressed_data,
+			          compressed_data_size,
+			          error );
+			break;
+	}
+	if( result != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_COMPRESSION,
+		 LIBCERROR_COMPRESSION_ERROR_DECOMPRESS_FAILED,
+		 "%s: unable to decompress data.",
+		 function );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Splits the uncompressed data of a source into inputs and compresses them
+ * If the codec has no compressor the source is used as a single precompressed input
+ * Returns 1 if successful or -1 on error
+ */
+int decompressbench_get_inputs(
+     decompressbench_codec_t *codec,
+     const uint8_t *source_data,
+     size_t source_data_size,
+     size_t input_size,
+     uint8_t precompressed,
+     size_t default_uncompressed_data_size,
+     uint8_t *compressed_data,
+     size_t compressed_data_size,
+     decompressbench_input_t *inputs,
+     int *number_of_inputs,
+     libcerror_error_t **error )
+{
+	static char *function         = "decompressbench_get_inputs";
+	size_t compressed_data_offset = 0;
+	size_t source_data_offset     = 0;
+	size_t uncompressed_data_size = 0;
+	int input_index               = 0;
+	int result                    = 0;
+
+	if( codec == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid codec.",
+		 function );
+
+		return( -1 );
+	}
+	if( number_of_inputs == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid number of inputs.",
+		 function );
+
+		return( -1 );
+	}
+	if( precompressed != 0 )
+	{
+		if( memory_copy(
+		     compressed_data,
+		     source_data,
+		     source_data_size ) == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+			 "%s: unable to copy compressed data.",
+			 function );
+
+			return( -1 );
+		}
+		result = decompressbench_get_uncompressed_data_size(
+		          codec->codec_type,
+		          compressed_data,
+		          source_data_size,
+		          &uncompressed_data_size,
+		          error );
+
+		if( result == -1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve uncompressed data size.",
+			 function );
+
+			return( -1 );
+		}
+		else if( result == 0 )
+		{
+			uncompressed_data_size = default_uncompressed_data_size;
+		}
+		inputs[ 0 ].compressed_data          = compressed_data;
+		inputs[ 0 ].compressed_data_size     = source_data_size;
+		inputs[ 0 ].uncompressed_data        = NULL;
+		inputs[ 0 ].uncompressed_data_size   = uncompressed_data_size;
+		inputs[ 0 ].uncompressed_buffer_size = uncompressed_data_size;
+
+		*number_of_inputs = 1;
+
+		return( 1 );
+	}
+	while( source_data_offset < source_data_size )
+	{
+		uncompressed_data_size = source_data_size - source_data_offset;
+
+		if( uncompressed_data_size > input_size )
+		{
+			uncompressed_data_size = input_size;
+		}
+		inputs[ input_index ].compressed_data        = &( compressed_data[ compressed_data_offset ] );
+		inputs[ input_index ].compressed_data_size   = compressed_data_size - compressed_data_offset;
+		inputs[ input_index ].uncompressed_data      = &( source_data[ source_data_offset ] );
+		inputs[ input_index ].uncompressed_data_size = uncompressed_data_size;
+
+		if( decompressbench_compress(
+		     codec->codec_type,
+		     inputs[ input_index ].uncompressed_data,
+		     uncompressed_data_size,
+		     inputs[ input_index ].compressed_data,
+		     &( inputs[ input_index ].compressed_data_size ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_COMPRESSION,
+			 LIBCERROR_COMPRESSION_ERROR_COMPRESS_FAILED,
+			 "%s: unable to compress input: %d.",
+			 function,
+			 input_index );
+
+			return( -1 );
+		}
+		/* Some codecs, like LZFu, require a buffer that is larger than the uncompressed data
+		 */
+		inputs[ input_index ].uncompressed_buffer_size = uncompressed_data_size;
+
+		result = decompressbench_get_uncompressed_data_size(
+		          codec->codec_type,
+		          inputs[ input_index ].compressed_data,
+		          inputs[ input_index ].compressed_data_size,
+		          &uncompressed_data_size,
+		          error );
+
+		if( result == -1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve uncompressed data size of input: %d.",
+			 function,
+			 input_index );
+
+			return( -1 );
+		}
+		else if( ( result != 0 )
+		      && ( uncompressed_data_size > inputs[ input_index ].uncompressed_buffer_size ) )
+		{
+			inputs[ input_index ].uncompressed_buffer_size = uncompressed_data_size;
+		}
+		compressed_data_offset += inputs[ input_index ].compressed_data_size;
+		source_data_offset     += inputs[ input_index ].uncompressed_data_size;
+
+		input_index++;
+	}
+	*number_of_inputs = input_index;
+
+	return( 1 );
+}
+
+/* Measures the throughput of a codec
+ * The inputs are decompressed once to warm up the caches, which also checks that
+ * the uncompressed data starts with the original data if available
+ * Returns 1 if successful or -1 on error
+ */
+int decompressbench_measure(
+     decompressbench_codec_t *codec,
+     decompressbench_input_t *inputs,
+     int number_of_inputs,
+     uint8_t *uncompressed_data,
+     uint64_t number_of_iterations,
+     size64_t *total_uncompressed_data_size,
+     double *megabytes_per_second,
+     double *nanoseconds_per_call,
+     libcerror_error_t **error )
+{
+	static char *function           = "decompressbench_measure";
+	size64_t safe_uncompressed_size = 0;
+	size_t uncompressed_data_size   = 0;
+	uint64_t end_time               = 0;
+	uint64_t iteration              = 0;
+	uint64_t start_time             = 0;
+	double number_of_bytes          = 0.0;
+	double number_of_calls          = 0.0;
+	int input_index                 = 0;
+
+	if( codec == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid codec.",
+		 function );
+
+		return( -1 );
+	}
+	if( inputs == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid inputs.",
+		 function );
+
+		return( -1 );
+	}
+	if( number_of_iterations == 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_ZERO_OR_LESS,
+		 "%s: invalid number of iterations value zero or less.",
+		 function );
+
+		return( -1 );
+	}
+	if( total_uncompressed_data_size == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid total uncompressed data size.",
+		 function );
+
+		return( -1 );
+	}
+	if( megabytes_per_second == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid megabytes per second.",
+		 function );
+
+		return( -1 );
+	}
+	if( nanoseconds_per_call == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid nanoseconds per call.",
+		 function );
+
+		return( -1 );
+	}
+	/* Warm up the caches and determine the actual uncompressed data sizes
+	 */
+	for( input_index = 0;
+	     input_index < number_of_inputs;
+	     input_index++ )
+	{
+		uncompressed_data_size = inputs[ input_index ].uncompressed_buffer_size;
+
+		if( decompressbench_decompress(
+		     codec->codec_type,
+		     inputs[ input_index ].compressed_data,
+		     inputs[ input_index ].compressed_data_size,
+		     uncompressed_data,
+		     &uncompressed_data_size,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_COMPRESSION,
+			 LIBCERROR_COMPRESSION_ERROR_DECOMPRESS_FAILED,
+			 "%s: unable to decompress input: %d.",
+			 function,
+			 input_index );
+
+			return( -1 );
+		}
+		if( inputs[ input_index ].uncompressed_data != NULL )
+		{
+			/* LZFu uncompressed data contains 2 trailing zero bytes
+			 */
+			if( ( uncompressed_data_size < inputs[ input_index ].uncompressed_data_size )
+			 || ( memory_compare(
+			       uncompressed_data,
+			       inputs[ input_index ].uncompressed_data,
+			       inputs[ input_index ].uncompressed_data_size ) != 0 ) )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_GENERIC,
+				 "%s: mismatch in uncompressed data of input: %d.",
+				 function,
+				 input_index );
+
+				return( -1 );
+			}
+		}
+		inputs[ input_index ].uncompressed_data_size = uncompressed_data_size;
+
+		safe_uncompressed_size += uncompressed_data_size;
+	}
+	start_time = assorted_timer_get_nanoseconds();
+
+	for( iteration = 0;
+	     iteration < number_of_iterations;
+	     iteration++ )
+	{
+		for( input_index = 0;
+		     input_index < number_of_inputs;
+		     input_index++ )
+		{
+			uncompressed_data_size = inputs[ input_index ].uncompressed_buffer_size;
+
+			if( decompressbench_decompress(
+			     codec->codec_type,
+			     inputs[ input_index ].compressed_data,
+			     inputs[ input_index ].compressed_data_size,
+			     uncompressed_data,
+			     &uncompressed_data_size,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_COMPRESSION,
+				 LIBCERROR_COMPRESSION_ERROR_DECOMPRESS_FAILED,
+				 "%s: unable to decompress input: %d.",
+				 function,
+				 input_index );
+
+				return( -1 );
+			}
+		}
+	}
+	end_time = assorted_timer_get_nanoseconds();
+
+	number_of_bytes = (double) number_of_iterations * (double) safe_uncompressed_size;
+	number_of_calls = (double) number_of_iterations * (double) number_of_inputs;
+
+	if( end_time > start_time )
+	{
+		*megabytes_per_second = ( number_of_bytes * 1000.0 ) / (double) ( end_time - start_time );
+		*nanoseconds_per_call = (double) ( end_time - start_time ) / number_of_calls;
+	}
+	else
+	{
+		*megabytes_per_second = 0.0;
+		*nanoseconds_per_call = 0.0;
+	}
+	*total_uncompressed_data_size = safe_uncompressed_size;
+
+	return( 1 );
+}
+
+/* Reads the data of a source
+ * Returns 1 if successful or -1 on error
+ */
+int decompressbench_read_source(
+     const system_character_t *source,
+     uint8_t **source_data,
+     size_t *source_data_size,
+     libcerror_error_t **error )
+{
+	assorted_input_file_t *source_file = NULL;
+	uint8_t *buffer                    = NULL;
+	uint8_t *safe_source_data          = NULL;
+	static char *function              = "decompressbench_read_source";
+	size64_t source_size               = 0;
+	ssize_t read_count                 = 0;
+
+	if( source_data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid source data.",
+		 function );
+
+		return( -1 );
+	}
+	if( source_data_size == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid source data size.",
+		 function );
+
+		return( -1 );
+	}
+	if( assorted_input_file_initialize(
+	     &source_file,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create source file.",
+		 function );
+
+		goto on_error;
+	}
+	if( assorted_input_file_open(
+	     source_file,
+	     source,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_OPEN_FAILED,
+		 "%s: unable to open source file.",
+		 function );
+
+		goto on_error;
+	}
+	if( assorted_input_file_get_size(
+	     source_file,
+	     &source_size,
+	     error ) == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve size of source file.",
+		 function );
+
+		goto on_error;
+	}
+	if( ( source_size == 0 )
+	 || ( source_size > (size64_t) DECOMPRESSBENCH_MAXIMUM_SOURCE_SIZE ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid source size value out of bounds.",
+		 function );
+
+		goto on_error;
+	}
+	/* The data is copied so that it remains available after the source file is closed
+	 */
+	safe_source_data = (uint8_t *) memory_allocate(
+	                                sizeof( uint8_t ) * (size_t) source_size );
+
+	if( safe_source_data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create source data.",
+		 function );
+
+		goto on_error;
+	}
+	read_count = assorted_input_file_read_data(
+	              source_file,
+	              &buffer,
+	              (size_t) source_size,
+	              error );
+
+	if( read_count != (ssize_t) source_size )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_READ_FAILED,
+		 "%s: unable to read source file.",
+		 function );
+
+		goto on_error;
+	}
+	if( memory_copy(
+	     safe_source_data,
+	     buffer,
+	     (size_t) source_size ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+		 "%s: unable to copy source data.",
+		 function );
+
+		goto on_error;
+	}
+	if( assorted_input_file_close(
+	     source_file,
+	     error ) != 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_CLOSE_FAILED,
+		 "%s: unable to close source file.",
+		 function );
+
+		goto on_error;
+	}
+	if( assorted_input_file_free(
+	     &source_file,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+		 "%s: unable to free source file.",
+		 function );
+
+		goto on_error;
+	}
+	*source_data      = safe_source_data;
+	*source_data_size = (size_t) source_size;
+
+	return( 1 );
+
+on_error:
+	if( safe_source_data != NULL )
+	{
+		memory_free(
+		 safe_source_data );
+	}
+	if( source_file != NULL )
+	{
+		assorted_input_file_free(
+		 &source_file,
+		 NULL );
+	}
+	return( -1 );
+}
+
+/* Benchmarks the codecs on a source
+ * Returns 1 if successful or -1 on error
+ */
+int decompressbench_benchmark_source(
+     const system_character_t *source,
+     const system_character_t *codec_name,
+     size_t input_size,
+     uint8_t precompressed,
+     size_t option_uncompressed_data_size,
+     uint64_t option_number_of_iterations,
+     uint8_t machine_readable,
+     libcerror_error_t **error )
+{
+	memory_arena_mark_t arena_mark;
+	memory_arena_t arena;
+
+	decompressbench_codec_t *codec        = NULL;
+	decompressbench_input_t *inputs       = NULL;
+	uint8_t *compressed_data              = NULL;
+	uint8_t *source_data                  = NULL;
+	uint8_t *uncompressed_data            = NULL;
+	static char *function                 = "decompressbench_benchmark_source";
+	size64_t peak_memory_size             = 0;
+	size64_t total_uncompressed_data_size = 0;
+	size_t arena_size                     = 0;
+	size_t codec_name_length              = 0;
+	size_t compressed_data_size           = 0;
+	size_t maximum_uncompressed_data_size = 0;
+	size_t source_data_size               = 0;
+	size_t total_compressed_data_size     = 0;
+	uint64_t number_of_iterations         = 0;
+	double megabytes_per_second           = 0.0;
+	double nanoseconds_per_call           = 0.0;
+	int input_index                       = 0;
+	int maximum_number_of_inputs          = 0;
+	int number_of_inputs                  = 0;
+	int result                            = 0;
+
+	arena.current_block = NULL;
+
+	if( decompressbench_read_source(
+	     source,
+	     &source_data,
+	     &source_data_size,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_READ_FAILED,
+		 "%s: unable to read source.",
+		 function );
+
+		goto on_error;
+	}
+	if( ( input_size == 0 )
+	 || ( input_size > source_data_size ) )
+	{
+		input_size = source_data_size;
+	}
+	if( option_uncompressed_data_size == 0 )
+	{
+		if( source_data_size > ( (size_t) SSIZE_MAX / 16 ) )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+			 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+			 "%s: invalid source data size value exceeds maximum.",
+			 function );
+
+			goto on_error;
+		}
+		option_uncompressed_data_size = source_data_size * 16;
+	}
+	if( ( source_data_size / input_size ) >= (size_t) INT_MAX )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid number of inputs value exceeds maximum.",
+		 function );
+
+		goto on_error;
+	}
+	maximum_number_of_inputs = (int) ( source_data_size / input_size );
+
+	if( ( source_data_size % input_size ) != 0 )
+	{
+		maximum_number_of_inputs++;
+	}
+	/* None of the compressors expands an input by more than 1 byte per 8 bytes
+	 * and a fixed amount of header and trailer data
+	 */
+	compressed_data_size = source_data_size + ( source_data_size / 8 ) + ( (size_t) maximum_number_of_inputs * 64 );
+
+	/* The inputs, the compressed data and the uncompressed data are allocated
+	 * from an arena backed by huge pages, to reduce TLB misses when the inputs
+	 * are decompressed. The arena is sized to also fit uncompressed data of
+	 * the size of the source, larger uncompressed data adds a block
+	 */
+	arena_size = ( sizeof( decompressbench_input_t ) * maximum_number_of_inputs )
+	           + compressed_data_size
+	           + source_data_size
+	           + ( 3 * MEMORY_ARENA_ALIGNMENT );
+
+	if( memory_arena_initialize(
+	     &arena,
+	     arena_size,
+	     MEMORY_ARENA_FLAG_HUGE_PAGES ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create arena.",
+		 function );
+
+		goto on_error;
+	}
+	inputs = (decompressbench_input_t *) memory_arena_allocate(
+	                                      &arena,
+	                                      sizeof( decompressbench_input_t ) * maximum_number_of_inputs );
+
+	if( inputs == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create inputs.",
+		 function );
+
+		goto on_error;
+	}
+	compressed_data = (uint8_t *) memory_arena_allocate(
+	                               &arena,
+	                               sizeof( uint8_t ) * compressed_data_size );
+
+	if( compressed_data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create compressed data.",
+		 function );
+
+		goto on_error;
+	}
+	if( codec_name != NULL )
+	{
+		codec_name_length = system_string_length(
+		                     codec_name );
+	}
+	/* The uncompressed data of every codec is released by rewinding the arena to this mark
+	 */
+	memory_arena_get_mark(
+	 &arena,
+	 &arena_mark );
+	for( codec = decompressbench_codecs;
+	     codec->codec_name != NULL;
+	     codec++ )
+	{
+		if( codec_name != NULL )
+		{
+			if( ( system_string_length(
+			       codec->codec_name ) != codec_name_length )
+			 || ( system_string_compare(
+			       codec->codec_name,
+			       codec_name,
+			       codec_name_length ) != 0 ) )
+			{
+				continue;
+			}
+		}
+		else if( codec->has_compressor == 0 )
+		{
+			continue;
+		}
+		if( decompressbench_get_inputs(
+		     codec,
+		     source_data,
+		     source_data_size,
+		     input_size,
+		     precompressed,
+		     option_uncompressed_data_size,
+		     compressed_data,
+		     compressed_data_size,
+		     inputs,
+		     &number_of_inputs,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve %" PRIs_SYSTEM " inputs.",
+			 function,
+			 codec->codec_name );
+
+			goto on_error;
+		}
+		maximum_uncompressed_data_size = 0;
+		total_compressed_data_size     = 0;
+
+		for( input_index = 0;
+		     input_index < number_of_inputs;
+		     input_index++ )
+		{
+			if( inputs[ input_index ].uncompressed_buffer_size > maximum_uncompressed_data_size )
+			{
+				maximum_uncompressed_data_size = inputs[ input_index ].uncompressed_buffer_size;
+			}
+			total_compressed_data_size += inputs[ input_index ].compressed_data_size;
+		}
+		if( ( maximum_uncompressed_data_size == 0 )
+		 || ( maximum_uncompressed_data_size > (size_t) SSIZE_MAX ) )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+			 "%s: invalid uncompressed data size value out of bounds.",
+			 function );
+
+			goto on_error;
+		}
+		uncompressed_data = (uint8_t *) memory_arena_allocate(
+		                                 &arena,
+		                                 sizeof( uint8_t ) * maximum_uncompressed_data_size );
+
+		if( uncompressed_data == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+			 "%s: unable to create uncompressed data.",
+			 function );
+
+			goto on_error;
+		}
+		number_of_iterations = option_number_of_iterations;
+
+		if( number_of_iterations == 0 )
+		{
+			number_of_iterations = (uint64_t) ( DECOMPRESSBENCH_DEFAULT_TOTAL_SIZE / source_data_size );
+
+			if( number_of_iterations == 0 )
+			{
+				number_of_iterations = 1;
+			}
+		}
+		if( decompressbench_measure(
+		     codec,
+		     inputs,
+		     number_of_inputs,
+		     uncompressed_data,
+		     number_of_iterations,
+		     &total_uncompressed_data_size,
+		     &megabytes_per_second,
+		     &nanoseconds_per_call,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GENERIC,
+			 "%s: unable to measure %" PRIs_SYSTEM ".",
+			 function,
+			 codec->codec_name );
+
+			goto on_error;
+		}
+		memory_arena_rewind(
+		 &arena,
+		 &arena_mark );
+
+		uncompressed_data = NULL;
+
+		/* The peak memory size is that of the process up to and including this measurement
+		 */
+		result = assorted_output_get_peak_memory_size(
+		          &peak_memory_size,
+		          error );
+
+		if( result == -1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve peak memory size.",
+			 function );
+
+			goto on_error;
+		}
+		if( machine_readable != 0 )
+		{
+			fprintf(
+			 stdout,
+			 "%" PRIs_SYSTEM ",%" PRIs_SYSTEM ",%d,%" PRIzd ",%" PRIu64 ",%" PRIu64 ",%.1f,%.1f,",
+			 codec->codec_name,
+			 source,
+			 number_of_inputs,
+			 total_compressed_data_size,
+			 total_uncompressed_data_size,
+			 number_of_iterations,
+			 megabytes_per_second,
+			 nanoseconds_per_call );
+
+			if( result != 0 )
+			{
+				fprintf(
+				 stdout,
+				 "%" PRIu64 "\n",
+				 peak_memory_size );
+			}
+			else
+			{
+				fprintf(
+				 stdout,
+				 "\n" );
+			}
+		}
+		else
+		{
+			fprintf(
+			 stdout,
+			 "%-19" PRIs_SYSTEM " %7d %11" PRIzd " %11" PRIu64 " %10.1f %12.1f ",
+			 codec->codec_name,
+			 number_of_inputs,
+			 total_compressed_data_size,
+			 total_uncompressed_data_size,
+			 megabytes_per_second,
+			 nanoseconds_per_call );
+
+			if( result != 0 )
+			{
+				fprintf(
+				 stdout,
+				 "%12" PRIu64 "\n",
+				 peak_memory_size / 1024 );
+			}
+			else
+			{
+				fprintf(
+				 stdout,
+				 "%12s\n",
+				 "n/a" );
+			}
+		}
+	}
+	memory_arena_free(
+	 &arena );
+	memory_free(
+	 source_data );
+
+	return( 1 );
+
+on_error:
+	memory_arena_free(
+	 &arena );
+
+	if( source_data != NULL )
+	{
+		memory_free(
+		 source_data );
+	}
+	return( -1 );
+}
+
+/* The main program
+ */
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+int wmain( int argc, wchar_t * const argv[] )
+#else
+int main( int argc, char * const argv[] )
+#endif
+{
+	decompressbench_codec_t *codec               = NULL;
+	libcerror_error_t *error                     = NULL;
+	system_character_t *option_statistics_format = NULL;
+	system_character_t *codec_name               = NULL;
+	char *program                                = "decompressbench";
+	system_integer_t option                      = 0;
+	size_t codec_name_length                     = 0;
+	size_t input_size                            = 0;
+	size_t uncompressed_data_size                = 0;
+	uint64_t number_of_iterations                = 0;
+	uint8_t machine_readable                     = 0;
+	uint8_t precompressed                        = 0;
+	int source_index                             = 0;
+	int verbose                                  = 0;
+
+	while( ( option = assorted_getopt(
+	                   argc,
+	                   argv,
+	                   _SYSTEM_STRING( "c:d:hmn:ps:S:vV" ) ) ) != (system_integer_t) -1 )
+	{
+		switch( option )
+		{
+			case '?':
+			default:
+				fprintf(
+				 stderr,
+				 "Invalid argument: %" PRIs_SYSTEM "\n",
+				 argv[ optind ] );
+
+				usage_fprint(
+				 stdout );
+
+				return( EXIT_FAILURE );
+
+			case 'c':
+				codec_name = optarg;
+
+				break;
+
+			case 'd':
+				uncompressed_data_size = (size_t) atol( optarg );
+
+				break;
+
+			case 'h':
+				usage_fprint(
+				 stdout );
+
+				return( EXIT_SUCCESS );
+
+			case 'm':
+				machine_readable = 1;
+
+				break;
+
+			case 'n':
+				number_of_iterations = (uint64_t) atol( optarg );
+
+				break;
+
+			case 'p':
+				precompressed = 1;
+
+				break;
+
+			case 's':
+				input_size = (size_t) atol( optarg );
+
+				break;
+
+			case 'S':
+				option_statistics_format = optarg;
+
+				break;
+
+			case 'v':
+				verbose = 1;
+
+				break;
+
+			case 'V':
+				assorted_output_copyright_fprint(
+				 stdout );
+
+				return( EXIT_SUCCESS );
+		}
+	}
+	if( optind == argc )
+	{
+		fprintf(
+		 stderr,
+		 "Missing source file(s).\n" );
+
+		usage_fprint(
+		 stdout );
+
+		return( EXIT_FAILURE );
+	}
+	/* The version is not printed in machine readable output
+	 */
+	if( machine_readable == 0 )
+	{
+		assorted_output_version_fprint(
+		 stdout,
+		 program );
+	}
+	libcnotify_stream_set(
+	 stderr,
+	 NULL );
+	libcnotify_verbose_set(
+	 verbose );
+
+	if( assorted_output_statistics_initialize(
+	     option_statistics_format,
+	     &error ) != 1 )
+	{
+		fprintf(
+		 stderr,
+		 "Unable to initialize statistics.\n" );
+
+		goto on_error;
+	}
+
+	if( codec_name != NULL )
+	{
+		codec_name_length = system_string_length(
+		                     codec_name );
+
+		for( codec = decompressbench_codecs;
+		     codec->codec_name != NULL;
+		     codec++ )
+		{
+			if( ( system_string_length(
+			       codec->codec_name ) == codec_name_length )
+			 && ( system_string_compare(
+			       codec->codec_name,
+			       codec_name,
+			       codec_name_length ) == 0 ) )
+			{
+				break;
+			}
+		}
+		if( codec->codec_name == NULL )
+		{
+			fprintf(
+			 stderr,
+			 "Unsupported codec: %" PRIs_SYSTEM "\n",
+			 codec_name );
+
+			goto on_error;
+		}
+		if( ( codec->has_compressor == 0 )
+		 && ( precompressed == 0 ) )
+		{
+			fprintf(
+			 stderr,
+			 "Codec: %" PRIs_SYSTEM " requires precompressed sources (-p).\n",
+			 codec_name );
+
+			goto on_error;
+		}
+	}
+	else if( precompressed != 0 )
+	{
+		fprintf(
+		 stderr,
+		 "Precompressed sources (-p) require a codec (-c).\n" );
+
+		goto on_error;
+	}
+	if( machine_readable != 0 )
+	{
+		fprintf(
+		 stdout,
+		 "codec,source,inputs,compressed_size,uncompressed_size,iterations,mb_per_second,ns_per_call,peak_memory_size\n" );
+	}
+	for( source_index = optind;
+	     source_index < argc;
+	     source_index++ )
+	{
+		if( machine_readable == 0 )
+		{
+			fprintf(
+			 stdout,
+			 "%" PRIs_SYSTEM ":\n",
+			 argv[ source_index ] );
+
+			fprintf(
+			 stdout,
+			 "%-19s %7s %11s %11s %10s %12s %12s\n",
+			 "codec",
+			 "inputs",
+			 "compressed",
+			 "size",
+			 "MB/s",
+			 "ns/call",
+			 "peak KiB" );
+		}
+		if( decompressbench_benchmark_source(
+		     argv[ source_index ],
+		     codec_name,
+		     input_size,
+		     precompressed,
+		     uncompressed_data_size,
+		     number_of_iterations,
+		     machine_readable,
+		     &error ) != 1 )
+		{
+			fprintf(
+			 stderr,
+			 "Unable to benchmark source: %" PRIs_SYSTEM ".\n",
+			 argv[ source_index ] );
+
+			goto on_error;
+		}
+	}
+	assorted_output_statistics_fprint(
+	 stderr,
+	 program,
+	 1,
+	 NULL );
+	assorted_output_statistics_free(
+	 NULL );
+
+	return( EXIT_SUCCESS );
+
+on_error:
+	if( error != NULL )
+	{
+		libcnotify_print_error_backtrace(
+		 error );
+		libcerror_error_free(
+		 &error );
+	}
+	assorted_output_statistics_fprint(
+	 stderr,
+	 program,
+	 -1,
+	 NULL );
+	assorted_output_statistics_free(
+	 NULL );
+	return( EXIT_FAILURE );
+}
+
@@ -21,14 +21,88 @@
 
 #include <common.h>
 #include <byte_stream.h>
+#include <file_stream.h>
+#include <lz_match.h>
 #include <memory.h>
 #include <types.h>
 
 #include "assorted_libcerror.h"
 #include "assorted_libcnotify.h"
 #include "deflate.h"
+#include "deflate_tables.h"
 
-/* TODO use memory alignment in bit stream */
+#if defined( HAVE_DEFLATE_STATISTICS )
+#include "assorted_timer.h"
+#endif
+
+/* The base values and number of extra bits of the literal and length codes 257 to 285
+ */
+const uint16_t deflate_literal_codes_base[ 29 ] = {
+	3, 4, 5, 6, 7, 8, 9, 10, 11, 13, 15, 17, 19, 23, 27, 31,
+	35, 43, 51, 59, 67, 83, 99, 115, 131, 163, 195, 227, 258 };
+
+const uint16_t deflate_literal_codes_number_of_extra_bits[ 29 ] = {
+	0, 0, 0, 0, 0, 0, 0, 0, 1, 1, 1, 1, 2, 2, 2, 2,
+	3, 3, 3, 3, 4, 4, 4, 4, 5, 5, 5, 5, 0 };
+
+/* The base values and number of extra bits of the distance codes 0 to 29
+ */
+const uint16_t deflate_distance_codes_base[ 30 ] = {
+	1, 2, 3, 4, 5, 7, 9, 13, 17, 25, 33, 49, 65, 97, 129, 193,
+	257, 385, 513, 769, 1025, 1537, 2049, 3073, 4097, 6145, 8193,
+	12289, 16385, 24577 };
+
+const uint16_t deflate_distance_codes_number_of_extra_bits[ 30 ] = {
+	0, 0, 0, 0, 1, 1, 2, 2, 3, 3, 4, 4, 5, 5, 6, 6,
+	7, 7, 8, 8, 9, 9, 10, 10, 11, 11, 12, 12, 13, 13 };
+
+#if defined( HAVE_DEFLATE_STATISTICS )
+
+/* The statistics collected by the decoder
+ */
+static deflate_statistics_t deflate_statistics;
+
+#endif /* defined( HAVE_DEFLATE_STATISTICS ) */
+
+/* Refills the bit buffer
+ * Reads 8 bytes at once if available, otherwise one byte at a time, until
+ * the bit buffer contains at least 56 bits or the byte stream is exhausted
+ */
+static void deflate_bit_stream_refill(
+             deflate_bit_stream_t *bit_stream )
+{
+	uint64_t value_64bit   = 0;
+	uint8_t number_of_bits = 0;
+
+	if( ( bit_stream->byte_stream_size - bit_stream->byte_stream_offset ) >= 8 )
+	{
+		byte_stream_copy_to_uint64_little_endian(
+		 &( bit_stream->byte_stream[ bit_stream->byte_stream_offset ] ),
+		 value_64bit );
+
+		/* Only add the whole bytes that fit into the bit buffer
+		 */
+		number_of_bits = ( 63 - bit_stream->bit_buffer_size ) & 0x38;
+
+		value_64bit &= ~( (uint64_t) 0xffffffffffffffffULL << number_of_bits );
+
+		bit_stream->bit_buffer         |= value_64bit << bit_stream->bit_buffer_size;
+		bit_stream->bit_buffer_size    += number_of_bits;
+		bit_stream->byte_stream_offset += number_of_bits >> 3;
+	}
+	else
+	{
+		while( ( bit_stream->bit_buffer_size < 56 )
+		    && ( bit_stream->byte_stream_offset < bit_stream->byte_stream_size ) )
+		{
+			value_64bit   = bit_stream->byte_stream[ bit_stream->byte_stream_offset++ ];
+			value_64bit <<= bit_stream->bit_buffer_size;
+
+			bit_stream->bit_buffer      |= value_64bit;
+			bit_stream->bit_buffer_size += 8;
+		}
+	}
+}
 
 /* Retrieves a value from the bit stream
  * Returns 1 on success or -1 on error
@@ -81,9 +155,12 @@ int deflate_bit_stream_get_value(
 
 		return( 1 );
 	}
-	while( bit_stream->bit_buffer_size < number_of_bits )
+	if( bit_stream->bit_buffer_size < number_of_bits )
 	{
-		if( bit_stream->byte_stream_offset >= bit_stream->byte_stream_size )
+		deflate_bit_stream_refill(
+		 bit_stream );
+
+		if( bit_stream->bit_buffer_size < number_of_bits )
 		{
 			libcerror_error_set(
 			 error,
@@ -94,28 +171,12 @@ int deflate_bit_stream_get_value(
 
 			return( -1 );
 		}
-		safe_value_32bit   = bit_stream->byte_stream[ bit_stream->byte_stream_offset++ ];
-		safe_value_32bit <<= bit_stream->bit_buffer_size;
-
-		bit_stream->bit_buffer      |= safe_value_32bit;
-		bit_stream->bit_buffer_size += 8;
 	}
-	safe_value_32bit = bit_stream->bit_buffer;
+	safe_value_32bit = (uint32_t) ( bit_stream->bit_buffer & ~( (uint64_t) 0xffffffffffffffffULL << number_of_bits ) );
 
-	if( number_of_bits < 32 )
-	{
-		/* On VS 2008 32-bit "~( 0xfffffffUL << 32 )" does not behave as expected
-		 */
-		safe_value_32bit &= ~( 0xffffffffUL << number_of_bits );
+	bit_stream->bit_buffer     >>= number_of_bits;
+	bit_stream->bit_buffer_size -= number_of_bits;
 
-		bit_stream->bit_buffer     >>= number_of_bits;
-		bit_stream->bit_buffer_size -= number_of_bits;
-	}
-	else
-	{
-		bit_stream->bit_buffer      = 0;
-		bit_stream->bit_buffer_size = 0;
-	}
 	*value_32bit = safe_value_32bit;
 
 	return( 1 );
@@ -131,13 +192,23 @@ int deflate_huffman_table_construct(
      libcerror_error_t **error )
 {
 	int code_offsets_array[ 16 ];
-
-	static char *function = "deflate_huffman_table_construct";
-	uint16_t code_size    = 0;
-	uint8_t bit_index     = 0;
-	int code_offset       = 0;
-	int left_value        = 0;
-	int symbol            = 0;
+	int remaining_code_counts_array[ 16 ];
+
+	static char *function                  = "deflate_huffman_table_construct";
+	uint32_t huffman_code                  = 0;
+	uint32_t reversed_huffman_code         = 0;
+	uint16_t code_size                     = 0;
+	uint16_t lookup_value                  = 0;
+	uint8_t bit_index                      = 0;
+	uint8_t secondary_table_number_of_bits = 0;
+	int code_index                         = 0;
+	int code_offset                        = 0;
+	int left_value                         = 0;
+	int lookup_table_index                 = 0;
+	int next_secondary_table_offset        = 0;
+	int primary_table_index                = 0;
+	int secondary_table_offset             = 0;
+	int symbol                             = 0;
 
 	if( table == NULL )
 	{
@@ -216,6 +287,20 @@ int deflate_huffman_table_construct(
 
 		return( -1 );
 	}
+	if( memory_set(
+	     &( table->lookup_table ),
+	     0,
+	     sizeof( uint16_t ) << DEFLATE_HUFFMAN_LOOKUP_TABLE_NUMBER_OF_BITS ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear primary lookup table.",
+		 function );
+
+		return( -1 );
+	}
 	for( symbol = 0;
 	     symbol < number_of_code_sizes;
 	     symbol++ )
@@ -307,6 +392,118 @@ int deflate_huffman_table_construct(
 		code_offsets_array[ code_size ]  += 1;
 		table->codes_array[ code_offset ] = symbol;
 	}
+	/* Construct the lookup table from the canonical Huffman codes
+	 * the primary table is indexed by the first 9 bits of the bit buffer
+	 * and codes larger than 9 bits are stored in a secondary table
+	 * that is indexed by the remaining bits
+	 */
+	for( bit_index = 0;
+	     bit_index < 16;
+	     bit_index++ )
+	{
+		remaining_code_counts_array[ bit_index ] = table->code_counts_array[ bit_index ];
+	}
+	primary_table_index         = -1;
+	next_secondary_table_offset = 1 << DEFLATE_HUFFMAN_LOOKUP_TABLE_NUMBER_OF_BITS;
+
+	for( code_size = 1;
+	     code_size <= (uint16_t) table->maximum_number_of_bits;
+	     code_size++ )
+	{
+		while( remaining_code_counts_array[ code_size ] > 0 )
+		{
+			symbol       = table->codes_array[ code_index++ ];
+			lookup_value = (uint16_t) ( ( code_size << 9 ) | symbol );
+
+			/* The Huffman code is stored in the bit stream with the most significant bit first
+			 */
+			reversed_huffman_code = 0;
+
+			for( bit_index = 0;
+			     bit_index < code_size;
+			     bit_index++ )
+			{
+				reversed_huffman_code <<= 1;
+				reversed_huffman_code  |= ( huffman_code >> bit_index ) & 0x00000001UL;
+			}
+			if( code_size <= DEFLATE_HUFFMAN_LOOKUP_TABLE_NUMBER_OF_BITS )
+			{
+				for( lookup_table_index = (int) reversed_huffman_code;
+				     lookup_table_index < ( 1 << DEFLATE_HUFFMAN_LOOKUP_TABLE_NUMBER_OF_BITS );
+				     lookup_table_index += 1 << code_size )
+				{
+					table->lookup_table[ lookup_table_index ] = lookup_value;
+				}
+			}
+			else
+			{
+				if( (int) ( reversed_huffman_code & 0x000001ffUL ) != primary_table_index )
+				{
+					primary_table_index = (int) ( reversed_huffman_code & 0x000001ffUL );
+
+					/* Determine the number of bits of the secondary table from the code sizes
+					 * that remain, which are stored consecutively for the same primary index
+					 */
+					secondary_table_number_of_bits = (uint8_t) ( code_size - DEFLATE_HUFFMAN_LOOKUP_TABLE_NUMBER_OF_BITS );
+
+					left_value = 1 << secondary_table_number_of_bits;
+
+					while( ( secondary_table_number_of_bits + DEFLATE_HUFFMAN_LOOKUP_TABLE_NUMBER_OF_BITS ) < table->maximum_number_of_bits )
+					{
+						left_value -= remaining_code_counts_array[ secondary_table_number_of_bits + DEFLATE_HUFFMAN_LOOKUP_TABLE_NUMBER_OF_BITS ];
+
+						if( left_value <= 0 )
+						{
+							break;
+						}
+						secondary_table_number_of_bits++;
+
+						left_value <<= 1;
+					}
+					if( ( next_secondary_table_offset + ( 1 << secondary_table_number_of_bits ) ) > DEFLATE_HUFFMAN_LOOKUP_TABLE_SIZE )
+					{
+						libcerror_error_set(
+						 error,
+						 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+						 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+						 "%s: invalid secondary lookup table offset value out of bounds.",
+						 function );
+
+						return( -1 );
+					}
+					secondary_table_offset = next_secondary_table_offset;
+
+					if( memory_set(
+					     &( table->lookup_table[ secondary_table_offset ] ),
+					     0,
+					     sizeof( uint16_t ) << secondary_table_number_of_bits ) == NULL )
+					{
+						libcerror_error_set(
+						 error,
+						 LIBCERROR_ERROR_DOMAIN_MEMORY,
+						 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+						 "%s: unable to clear secondary lookup table.",
+						 function );
+
+						return( -1 );
+					}
+					table->lookup_table[ primary_table_index ] = (uint16_t) ( 0x8000 | ( secondary_table_number_of_bits << 12 ) | secondary_table_offset );
+
+					next_secondary_table_offset += 1 << secondary_table_number_of_bits;
+				}
+				for( lookup_table_index = (int) ( reversed_huffman_code >> DEFLATE_HUFFMAN_LOOKUP_TABLE_NUMBER_OF_BITS );
+				     lookup_table_index < ( 1 << secondary_table_number_of_bits );
+				     lookup_table_index += 1 << ( code_size - DEFLATE_HUFFMAN_LOOKUP_TABLE_NUMBER_OF_BITS ) )
+				{
+					table->lookup_table[ secondary_table_offset + lookup_table_index ] = lookup_value;
+				}
+			}
+			remaining_code_counts_array[ code_size ] -= 1;
+
+			huffman_code++;
+		}
+		huffman_code <<= 1;
+	}
 /* TODO only used by dynamic Huffman
 	if( left_value > 0 )
 	{
@@ -328,20 +525,15 @@ int deflate_huffman_table_construct(
  */
 int deflate_bit_stream_get_huffman_encoded_value(
      deflate_bit_stream_t *bit_stream,
-     deflate_huffman_table_t *table,
+     const deflate_huffman_table_t *table,
      uint32_t *value_32bit,
      libcerror_error_t **error )
 {
 	static char *function     = "deflate_bit_stream_get_huffman_encoded_value";
-	uint32_t bit_buffer       = 0;
 	uint32_t safe_value_32bit = 0;
-	uint8_t bit_index         = 0;
+	uint16_t lookup_value     = 0;
 	uint8_t number_of_bits    = 0;
-	int code_size_count       = 0;
-	int first_huffman_code    = 0;
-	int first_index           = 0;
-	int huffman_code          = 0;
-	int result                = 0;
+	int lookup_table_index    = 0;
 
 	if( bit_stream == NULL )
 	{
@@ -378,56 +570,26 @@ int deflate_bit_stream_get_huffman_encoded_value(
 	}
 	/* Try to fill the bit buffer with the maximum number of bits
 	 */
-	while( bit_stream->bit_buffer_size < table->maximum_number_of_bits )
-	{
-		if( bit_stream->byte_stream_offset >= bit_stream->byte_stream_size )
-		{
-			break;
-		}
-		safe_value_32bit   = bit_stream->byte_stream[ bit_stream->byte_stream_offset++ ];
-		safe_value_32bit <<= bit_stream->bit_buffer_size;
-
-		bit_stream->bit_buffer      |= safe_value_32bit;
-		bit_stream->bit_buffer_size += 8;
-	}
-	if( table->maximum_number_of_bits < bit_stream->bit_buffer_size )
-	{
-		number_of_bits = table->maximum_number_of_bits;
-	}
-	else
+	if( bit_stream->bit_buffer_size < table->maximum_number_of_bits )
 	{
-		number_of_bits = bit_stream->bit_buffer_size;
+		deflate_bit_stream_refill(
+		 bit_stream );
 	}
-	bit_buffer = bit_stream->bit_buffer;
+	lookup_value = table->lookup_table[ bit_stream->bit_buffer & 0x000001ffUL ];
 
-	for( bit_index = 1;
-	     bit_index <= number_of_bits;
-	     bit_index++ )
+	if( ( lookup_value & 0x8000 ) != 0 )
 	{
-		huffman_code <<= 1;
-		huffman_code  |= (int) bit_buffer & 0x00000001UL;
-		bit_buffer   >>= 1;
-
-		code_size_count = table->code_counts_array[ bit_index ];
+		number_of_bits     = (uint8_t) ( ( lookup_value >> 12 ) & 0x07 );
+		lookup_table_index = (int) ( lookup_value & 0x0fff );
 
-		if( ( huffman_code - code_size_count ) < first_huffman_code )
-		{
-			safe_value_32bit = table->codes_array[ first_index + ( huffman_code - first_huffman_code ) ];
-
-			result = 1;
+		lookup_table_index += (int) ( ( bit_stream->bit_buffer >> DEFLATE_HUFFMAN_LOOKUP_TABLE_NUMBER_OF_BITS ) & ~( 0xffffffffUL << number_of_bits ) );
 
-			break;
-		}
-		first_huffman_code  += code_size_count;
-		first_huffman_code <<= 1;
-		first_index         += code_size_count;
+		lookup_value = table->lookup_table[ lookup_table_index ];
 	}
-	if( result != 0 )
-	{
-		bit_stream->bit_buffer     >>= bit_index;
-		bit_stream->bit_buffer_size -= bit_index;
-	}
-	if( result != 1 )
+	number_of_bits = (uint8_t) ( ( lookup_value >> 9 ) & 0x0f );
+
+	if( ( number_of_bits == 0 )
+	 || ( number_of_bits > bit_stream->bit_buffer_size ) )
 	{
 		libcerror_error_set(
 		 error,
@@ -438,6 +600,11 @@ int deflate_bit_stream_get_huffman_encoded_value(
 
 		return( -1 );
 	}
+	bit_stream->bit_buffer     >>= number_of_bits;
+	bit_stream->bit_buffer_size -= number_of_bits;
+
+	safe_value_32bit = (uint32_t) ( lookup_value & 0x01ff );
+
 	*value_32bit = safe_value_32bit;
 
 	return( 1 );
@@ -470,6 +637,10 @@ int deflate_initialize_dynamic_huffman_tables(
 	uint32_t symbol                   = 0;
 	uint32_t times_to_repeat          = 0;
 
+#if defined( HAVE_DEFLATE_STATISTICS )
+	uint32_t code_index               = 0;
+#endif
+
 	if( deflate_bit_stream_get_value(
 	     bit_stream,
 	     14,
@@ -758,6 +929,19 @@ int deflate_initialize_dynamic_huffman_tables(
 
 		return( -1 );
 	}
+#if defined( HAVE_DEFLATE_STATISTICS )
+	for( code_index = 0;
+	     code_index < number_of_literal_codes;
+	     code_index++ )
+	{
+		deflate_statistics.literals_code_size_histogram[ code_size_array[ code_index ] ] += 1;
+	}
+	while( code_index < number_of_code_sizes )
+	{
+		deflate_statistics.distances_code_size_histogram[ code_size_array[ code_index++ ] ] += 1;
+	}
+#endif /* defined( HAVE_DEFLATE_STATISTICS ) */
+
 	if( deflate_huffman_table_construct(
 	     literals_table,
 	     code_size_array,
@@ -863,42 +1047,69 @@ int deflate_initialize_fixed_huffman_tables(
 }
 
 /* Decodes a Huffman compressed block
- * Returns 1 on success or -1 on error
+ * If the uncompressed data is too small to contain the next literal or match
+ * the bit stream is restored to the start of that code and the uncompressed data
+ * offset is set to where decoding stopped, so that the block can be resumed
+ * after the uncompressed data has been resized
+ * Returns 1 on success, 0 if the uncompressed data is too small or -1 on error
  */
 int deflate_decode_huffman(
      deflate_bit_stream_t *bit_stream,
-     deflate_huffman_table_t *literals_table,
-     deflate_huffman_table_t *distances_table,
+     const deflate_huffman_table_t *literals_table,
+     const deflate_huffman_table_t *distances_table,
      uint8_t *uncompressed_data,
      size_t uncompressed_data_size,
      size_t *uncompressed_data_offset,
      libcerror_error_t **error )
 {
-	uint16_t literal_codes_base[ 29 ] = {
-		3, 4, 5, 6, 7, 8, 9, 10, 11, 13, 15, 17, 19, 23, 27, 31,
-		35, 43, 51, 59, 67, 83, 99, 115, 131, 163, 195, 227, 258 };
-
-	uint16_t literal_codes_number_of_extra_bits[ 29 ] = {
-		0, 0, 0, 0, 0, 0, 0, 0, 1, 1, 1, 1, 2, 2, 2, 2,
-		3, 3, 3, 3, 4, 4, 4, 4, 5, 5, 5, 5, 0 };
-
-	uint16_t distance_codes_base[ 30 ] = {
-		1, 2, 3, 4, 5, 7, 9, 13, 17, 25, 33, 49, 65, 97, 129, 193,
-		257, 385, 513, 769, 1025, 1537, 2049, 3073, 4097, 6145, 8193,
-		12289, 16385, 24577};
-
-	uint16_t distance_codes_number_of_extra_bits[ 30 ] = {
-		0, 0, 0, 0, 1, 1, 2, 2, 3, 3, 4, 4, 5, 5, 6, 6,
-		7, 7, 8, 8, 9, 9, 10, 10, 11, 11, 12, 12, 13, 13};
-
 	static char *function         = "deflate_decode_huffman";
+	size_t byte_stream_offset     = 0;
 	size_t data_offset            = 0;
+	uint64_t bit_buffer           = 0;
 	uint32_t code_value           = 0;
 	uint32_t extra_bits           = 0;
 	uint16_t compression_offset   = 0;
 	uint16_t compression_size     = 0;
 	uint16_t number_of_extra_bits = 0;
+	uint8_t bit_buffer_size       = 0;
+
+#if defined( HAVE_DEFLATE_STATISTICS )
+	uint32_t length_code          = 0;
+#endif
+
+	if( bit_stream == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid bit stream.",
+		 function );
+
+		return( -1 );
+	}
+	if( literals_table == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid literals table.",
+		 function );
+
+		return( -1 );
+	}
+	if( distances_table == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid distances table.",
+		 function );
 
+		return( -1 );
+	}
 	if( uncompressed_data == NULL )
 	{
 		libcerror_error_set(
@@ -936,6 +1147,20 @@ int deflate_decode_huffman(
 
 	do
 	{
+		/* Keep the bit stream state at the start of the code to be able to resume
+		 */
+		byte_stream_offset = bit_stream->byte_stream_offset;
+		bit_buffer         = bit_stream->bit_buffer;
+		bit_buffer_size    = bit_stream->bit_buffer_size;
+
+		/* A single refill provides enough bits for a literal and length code,
+		 * a distance code and their extra bits, which are at most 48 bits
+		 */
+		if( bit_stream->bit_buffer_size < 48 )
+		{
+			deflate_bit_stream_refill(
+			 bit_stream );
+		}
 		if( deflate_bit_stream_get_huffman_encoded_value(
 		     bit_stream,
 		     literals_table,
@@ -962,23 +1187,24 @@ int deflate_decode_huffman(
 		{
 			if( data_offset >= uncompressed_data_size )
 			{
-				libcerror_error_set(
-				 error,
-				 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
-				 LIBCERROR_ARGUMENT_ERROR_VALUE_TOO_SMALL,
-				 "%s: invalid uncompressed data value too small.",
-				 function );
-
-				return( -1 );
+				break;
 			}
 			uncompressed_data[ data_offset++ ] = (uint8_t) code_value;
+
+#if defined( HAVE_DEFLATE_STATISTICS )
+			deflate_statistics.number_of_literals += 1;
+#endif
 		}
 		else if( ( code_value > 256 )
 		      && ( code_value < 286 ) )
 		{
 			code_value -= 257;
 
-			number_of_extra_bits = literal_codes_number_of_extra_bits[ code_value ];
+#if defined( HAVE_DEFLATE_STATISTICS )
+			length_code = code_value;
+#endif
+
+			number_of_extra_bits = deflate_literal_codes_number_of_extra_bits[ code_value ];
 
 			if( deflate_bit_stream_get_value(
 			     bit_stream,
@@ -1000,14 +1226,14 @@ int deflate_decode_huffman(
 				libcnotify_printf(
 				 "%s: literal code\t\t\t\t\t\t: %" PRIu16 "\n",
 				 function,
-				 literal_codes_base[ code_value ] );
+				 deflate_literal_codes_base[ code_value ] );
 
 				libcnotify_printf(
 				 "%s: extra bits\t\t\t\t\t\t: 0x%04" PRIx16 "\n",
 				 function,
 				 extra_bits );
 			}
-			compression_size = literal_codes_base[ code_value ] + (uint16_t) extra_bits;
+			compression_size = deflate_literal_codes_base[ code_value ] + (uint16_t) extra_bits;
 
 			if( deflate_bit_stream_get_huffman_encoded_value(
 			     bit_stream,
@@ -1031,7 +1257,18 @@ int deflate_decode_huffman(
 				 function,
 				 code_value );
 			}
-			number_of_extra_bits = distance_codes_number_of_extra_bits[ code_value ];
+			if( code_value >= 30 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+				 "%s: invalid distance code value out of bounds.",
+				 function );
+
+				return( -1 );
+			}
+			number_of_extra_bits = deflate_distance_codes_number_of_extra_bits[ code_value ];
 
 			if( deflate_bit_stream_get_value(
 			     bit_stream,
@@ -1053,14 +1290,14 @@ int deflate_decode_huffman(
 				libcnotify_printf(
 				 "%s: distance code\t\t\t\t\t\t: %" PRIu16 "\n",
 				 function,
-				 distance_codes_base[ code_value ] );
+				 deflate_distance_codes_base[ code_value ] );
 
 				libcnotify_printf(
 				 "%s: extra bits\t\t\t\t\t\t: 0x%04" PRIx16 "\n",
 				 function,
 				 extra_bits );
 			}
-			compression_offset = distance_codes_base[ code_value ] + (uint16_t) extra_bits;
+			compression_offset = deflate_distance_codes_base[ code_value ] + (uint16_t) extra_bits;
 
 			if( libcnotify_verbose != 0 )
 			{
@@ -1092,22 +1329,23 @@ int deflate_decode_huffman(
 			}
 			if( ( data_offset + compression_size ) > uncompressed_data_size )
 			{
-				libcerror_error_set(
-				 error,
-				 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
-				 LIBCERROR_ARGUMENT_ERROR_VALUE_TOO_SMALL,
-				 "%s: invalid uncompressed data value too small.",
-				 function );
-
-				return( -1 );
-			}
-			while( compression_size > 0 )
-			{
-				uncompressed_data[ data_offset ] = uncompressed_data[ data_offset - compression_offset ];
-
-				data_offset++;
-				compression_size--;
+				break;
 			}
+			lz_match_copy(
+			 uncompressed_data,
+			 uncompressed_data_size,
+			 data_offset,
+			 (size_t) compression_offset,
+			 (size_t) compression_size );
+
+			data_offset += compression_size;
+
+#if defined( HAVE_DEFLATE_STATISTICS )
+			deflate_statistics.number_of_matches                      += 1;
+			deflate_statistics.number_of_match_bytes                  += compression_size;
+			deflate_statistics.match_size_histogram[ length_code ]    += 1;
+			deflate_statistics.match_distance_histogram[ code_value ] += 1;
+#endif
 		}
 		else if( code_value != 256 )
 		{
@@ -1126,6 +1364,14 @@ int deflate_decode_huffman(
 
 	*uncompressed_data_offset = data_offset;
 
+	if( code_value != 256 )
+	{
+		bit_stream->byte_stream_offset = byte_stream_offset;
+		bit_stream->bit_buffer         = bit_buffer;
+		bit_stream->bit_buffer_size    = bit_buffer_size;
+
+		return( 0 );
+	}
 	return( 1 );
 }
 
@@ -1377,52 +1623,2242 @@ int deflate_calculate_adler32(
 	return( 1 );
 }
 
-/* Compresses data using zlib compression
+/* The compression level configurations of levels 1 to 9
+ * an entry contains the maximum chain length, the good match size,
+ * the maximum lazy match size and the nice match size
+ * levels 1 to 3 use greedy matching, levels 4 to 9 lazy matching
+ */
+static const uint16_t deflate_compression_level_configurations[ 9 ][ 4 ] = {
+	{ 1, 4, 4, 8 },
+	{ 4, 4, 5, 16 },
+	{ 16, 4, 6, 32 },
+	{ 16, 4, 4, 16 },
+	{ 32, 8, 16, 32 },
+	{ 128, 8, 16, 128 },
+	{ 256, 8, 32, 128 },
+	{ 1024, 32, 128, 258 },
+	{ 4096, 32, 258, 258 } };
+
+/* The order in which the code sizes of the code sizes table are stored
+ */
+static const uint8_t deflate_code_sizes_sequence[ 19 ] = {
+	16, 17, 18, 0, 8, 7, 9, 6, 10, 5, 11, 4, 12, 3, 13, 2,
+	14, 1, 15 };
+
+/* Writes a value to the output bit stream
+ * The number of bits cannot exceed 32
  * Returns 1 on success or -1 on error
  */
-int deflate_compress(
-     const uint8_t *uncompressed_data,
-     size_t uncompressed_data_size,
-     int compression_level,
-     uint8_t *compressed_data,
-     size_t *compressed_data_size,
-     libcerror_error_t **error )
+static int deflate_output_bit_stream_put_value(
+            deflate_output_bit_stream_t *bit_stream,
+            uint32_t value_32bit,
+            uint8_t number_of_bits,
+            libcerror_error_t **error )
 {
-	static char *function = "deflate_compress";
+	static char *function = "deflate_output_bit_stream_put_value";
 
-	if( uncompressed_data == NULL )
+	bit_stream->bit_buffer      |= (uint64_t) value_32bit << bit_stream->bit_buffer_size;
+	bit_stream->bit_buffer_size += number_of_bits;
+
+	if( bit_stream->bit_buffer_size >= 32 )
 	{
-		libcerror_error_set(
-		 error,
-		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
-		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
-		 "%s: invalid uncompressed data.",
-		 function );
+		if( ( bit_stream->byte_stream_size - bit_stream->byte_stream_offset ) < 4 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+			 LIBCERROR_ARGUMENT_ERROR_VALUE_TOO_SMALL,
+			 "%s: invalid compressed data value too small.",
+			 function );
 
-		return( -1 );
+			return( -1 );
+		}
+		byte_stream_copy_from_uint32_little_endian(
+		 &( bit_stream->byte_stream[ bit_stream->byte_stream_offset ] ),
+		 (uint32_t) bit_stream->bit_buffer );
+
+		bit_stream->byte_stream_offset += 4;
+		bit_stream->bit_buffer        >>= 32;
+		bit_stream->bit_buffer_size    -= 32;
 	}
-	if( uncompressed_data_size > (size_t) SSIZE_MAX )
+	return( 1 );
+}
+
+/* Writes the bits remaining in the bit buffer to the output bit stream
+ * The last byte is padded with 0 bits, after which the output bit stream is byte aligned
+ * Returns 1 on success or -1 on error
+ */
+static int deflate_output_bit_stream_flush(
+            deflate_output_bit_stream_t *bit_stream,
+            libcerror_error_t **error )
+{
+	static char *function = "deflate_output_bit_stream_flush";
+	size_t byte_size      = 0;
+
+	byte_size = ( (size_t) bit_stream->bit_buffer_size + 7 ) / 8;
+
+	if( byte_size > ( bit_stream->byte_stream_size - bit_stream->byte_stream_offset ) )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
-		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
-		 "%s: invalid uncompressed data size value exceeds maximum.",
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_TOO_SMALL,
+		 "%s: invalid compressed data value too small.",
 		 function );
 
 		return( -1 );
 	}
-	if( compressed_data == NULL )
+	while( byte_size > 0 )
 	{
-		libcerror_error_set(
-		 error,
-		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
-		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
-		 "%s: invalid compressed data.",
-		 function );
+		bit_stream->byte_stream[ bit_stream->byte_stream_offset++ ] = (uint8_t) ( bit_stream->bit_buffer & 0xff );
+
+		bit_stream->bit_buffer >>= 8;
+
+		byte_size--;
+	}
+	bit_stream->bit_buffer      = 0;
+	bit_stream->bit_buffer_size = 0;
+
+	return( 1 );
+}
+
+/* Determines the Huffman code sizes of symbols from their frequencies
+ * The code sizes are limited to maximum_code_size bits and the resulting
+ * set of code sizes is always complete, if less than 2 symbols are used
+ * the first symbols are assigned a code size of 1
+ * Returns 1 on success or -1 on error
+ */
+static int deflate_compress_build_code_sizes(
+            const uint32_t *frequencies,
+            int number_of_symbols,
+            uint8_t maximum_code_size,
+            uint8_t *code_sizes,
+            libcerror_error_t **error )
+{
+	uint32_t sorted_frequencies[ 288 ];
+	uint16_t sorted_symbols[ 288 ];
+	int code_size_counts[ 33 ];
+
+	static char *function  = "deflate_compress_build_code_sizes";
+	uint32_t frequency     = 0;
+	uint32_t kraft_sum     = 0;
+	uint16_t symbol        = 0;
+	int code_size          = 0;
+	int leaf_index         = 0;
+	int next_index         = 0;
+	int number_of_used     = 0;
+	int number_of_assigned = 0;
+	int depth              = 0;
+	int root_index         = 0;
+	int sorted_index       = 0;
+	int used_index         = 0;
+
+	if( ( number_of_symbols < 2 )
+	 || ( number_of_symbols > 288 ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid number of symbols value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( maximum_code_size == 0 )
+	 || ( maximum_code_size > 15 ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid maximum code size value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( memory_set(
+	     code_sizes,
+	     0,
+	     sizeof( uint8_t ) * number_of_symbols ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear code sizes.",
+		 function );
+
+		return( -1 );
+	}
+	/* Sort the used symbols by ascending frequency
+	 */
+	for( symbol = 0;
+	     symbol < (uint16_t) number_of_symbols;
+	     symbol++ )
+	{
+		frequency = frequencies[ symbol ];
+
+		if( frequency == 0 )
+		{
+			continue;
+		}
+		sorted_index = number_of_used++;
+
+		while( ( sorted_index > 0 )
+		    && ( sorted_frequencies[ sorted_index - 1 ] > frequency ) )
+		{
+			sorted_frequencies[ sorted_index ] = sorted_frequencies[ sorted_index - 1 ];
+			sorted_symbols[ sorted_index ]     = sorted_symbols[ sorted_index - 1 ];
+
+			sorted_index--;
+		}
+		sorted_frequencies[ sorted_index ] = frequency;
+		sorted_symbols[ sorted_index ]     = symbol;
+	}
+	if( number_of_used < 2 )
+	{
+		/* A single code is not a complete set of code sizes, hence
+		 * the code of an otherwise unused symbol is added
+		 */
+		for( symbol = 0;
+		     symbol < (uint16_t) number_of_symbols;
+		     symbol++ )
+		{
+			if( ( frequencies[ symbol ] != 0 )
+			 || ( number_of_assigned < ( 2 - number_of_used ) ) )
+			{
+				if( frequencies[ symbol ] == 0 )
+				{
+					number_of_assigned++;
+				}
+				code_sizes[ symbol ] = 1;
+			}
+		}
+		return( 1 );
+	}
+	/* Calculate the minimum redundancy code sizes in-place,
+	 * using the algorithm of Moffat and Katajainen
+	 */
+	sorted_frequencies[ 0 ] += sorted_frequencies[ 1 ];
+
+	root_index = 0;
+	leaf_index = 2;
+
+	for( next_index = 1;
+	     next_index < ( number_of_used - 1 );
+	     next_index++ )
+	{
+		if( ( leaf_index >= number_of_used )
+		 || ( sorted_frequencies[ root_index ] < sorted_frequencies[ leaf_index ] ) )
+		{
+			sorted_frequencies[ next_index ]   = sorted_frequencies[ root_index ];
+			sorted_frequencies[ root_index++ ] = (uint32_t) next_index;
+		}
+		else
+		{
+			sorted_frequencies[ next_index ] = sorted_frequencies[ leaf_index++ ];
+		}
+		if( ( leaf_index >= number_of_used )
+		 || ( ( root_index < next_index )
+		  &&  ( sorted_frequencies[ root_index ] < sorted_frequencies[ leaf_index ] ) ) )
+		{
+			sorted_frequencies[ next_index ]  += sorted_frequencies[ root_index ];
+			sorted_frequencies[ root_index++ ] = (uint32_t) next_index;
+		}
+		else
+		{
+			sorted_frequencies[ next_index ] += sorted_frequencies[ leaf_index++ ];
+		}
+	}
+	sorted_frequencies[ number_of_used - 2 ] = 0;
+
+	for( next_index = number_of_used - 3;
+	     next_index >= 0;
+	     next_index-- )
+	{
+		sorted_frequencies[ next_index ] = sorted_frequencies[ sorted_frequencies[ next_index ] ] + 1;
+	}
+	number_of_assigned = 1;
+	depth              = 0;
+	root_index         = number_of_used - 2;
+	next_index         = number_of_used - 1;
+
+	while( number_of_assigned > 0 )
+	{
+		used_index = 0;
+
+		while( ( root_index >= 0 )
+		    && ( sorted_frequencies[ root_index ] == (uint32_t) depth ) )
+		{
+			used_index++;
+			root_index--;
+		}
+		while( number_of_assigned > used_index )
+		{
+			sorted_frequencies[ next_index-- ] = (uint32_t) depth;
+
+			number_of_assigned--;
+		}
+		number_of_assigned = 2 * used_index;
+
+		depth++;
+	}
+	/* Limit the code sizes to the maximum code size and adjust
+	 * the number of codes per code size to keep the set complete
+	 */
+	if( memory_set(
+	     code_size_counts,
+	     0,
+	     sizeof( int ) * 33 ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear code size counts.",
+		 function );
+
+		return( -1 );
+	}
+	for( sorted_index = 0;
+	     sorted_index < number_of_used;
+	     sorted_index++ )
+	{
+		code_size = (int) sorted_frequencies[ sorted_index ];
+
+		if( code_size > (int) maximum_code_size )
+		{
+			code_size = (int) maximum_code_size;
+		}
+		code_size_counts[ code_size ] += 1;
+	}
+	for( code_size = 1;
+	     code_size <= (int) maximum_code_size;
+	     code_size++ )
+	{
+		kraft_sum += (uint32_t) code_size_counts[ code_size ] << ( maximum_code_size - code_size );
+	}
+	while( kraft_sum > ( (uint32_t) 1 << maximum_code_size ) )
+	{
+		code_size_counts[ maximum_code_size ] -= 1;
+
+		for( code_size = (int) maximum_code_size - 1;
+		     code_size > 0;
+		     code_size-- )
+		{
+			if( code_size_counts[ code_size ] != 0 )
+			{
+				code_size_counts[ code_size ]     -= 1;
+				code_size_counts[ code_size + 1 ] += 2;
+
+				break;
+			}
+		}
+		kraft_sum--;
+	}
+	/* Assign the largest code sizes to the least frequent symbols
+	 */
+	sorted_index = 0;
+
+	for( code_size = (int) maximum_code_size;
+	     code_size > 0;
+	     code_size-- )
+	{
+		for( used_index = code_size_counts[ code_size ];
+		     used_index > 0;
+		     used_index-- )
+		{
+			code_sizes[ sorted_symbols[ sorted_index++ ] ] = (uint8_t) code_size;
+		}
+	}
+	return( 1 );
+}
+
+/* Determines the canonical Huffman codes from the code sizes
+ * The bits of the codes are reversed so that they can be written
+ * least significant bit first
+ */
+static void deflate_compress_build_codes(
+             const uint8_t *code_sizes,
+             int number_of_symbols,
+             uint16_t *codes )
+{
+	uint16_t next_codes[ 16 ];
+	int code_size_counts[ 16 ];
+
+	uint16_t huffman_code          = 0;
+	uint16_t reversed_huffman_code = 0;
+	uint8_t bit_index              = 0;
+	uint8_t code_size              = 0;
+	int symbol                     = 0;
+
+	for( bit_index = 0;
+	     bit_index < 16;
+	     bit_index++ )
+	{
+		code_size_counts[ bit_index ] = 0;
+	}
+	for( symbol = 0;
+	     symbol < number_of_symbols;
+	     symbol++ )
+	{
+		code_size_counts[ code_sizes[ symbol ] ] += 1;
+	}
+	code_size_counts[ 0 ] = 0;
+
+	for( bit_index = 1;
+	     bit_index < 16;
+	     bit_index++ )
+	{
+		huffman_code            = (uint16_t) ( ( huffman_code + code_size_counts[ bit_index - 1 ] ) << 1 );
+		next_codes[ bit_index ] = huffman_code;
+	}
+	for( symbol = 0;
+	     symbol < number_of_symbols;
+	     symbol++ )
+	{
+		code_size = code_sizes[ symbol ];
+
+		if( code_size == 0 )
+		{
+			codes[ symbol ] = 0;
+
+			continue;
+		}
+		huffman_code          = next_codes[ code_size ]++;
+		reversed_huffman_code = 0;
+
+		for( bit_index = 0;
+		     bit_index < code_size;
+		     bit_index++ )
+		{
+			reversed_huffman_code <<= 1;
+			reversed_huffman_code  |= huffman_code & 0x0001;
+			huffman_code          >>= 1;
+		}
+		codes[ symbol ] = reversed_huffman_code;
+	}
+}
+
+/* Initializes the compressor
+ * Returns 1 on success or -1 on error
+ */
+static int deflate_compressor_initialize(
+            deflate_compressor_t *compressor,
+            int compression_level,
+            libcerror_error_t **error )
+{
+	static char *function = "deflate_compressor_initialize";
+	size_t distance       = 0;
+	size_t match_size     = 0;
+	uint16_t symbol       = 0;
+	uint8_t code_index    = 0;
+
+	if( memory_set(
+	     compressor,
+	     0,
+	     sizeof( deflate_compressor_t ) ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear compressor.",
+		 function );
+
+		return( -1 );
+	}
+	compressor->maximum_chain_length    = (int) deflate_compression_level_configurations[ compression_level - 1 ][ 0 ];
+	compressor->good_match_size         = (size_t) deflate_compression_level_configurations[ compression_level - 1 ][ 1 ];
+	compressor->maximum_lazy_match_size = (size_t) deflate_compression_level_configurations[ compression_level - 1 ][ 2 ];
+	compressor->nice_match_size         = (size_t) deflate_compression_level_configurations[ compression_level - 1 ][ 3 ];
+	compressor->use_lazy_matching       = (uint8_t) ( compression_level >= 4 );
+
+	for( code_index = 0;
+	     code_index < 29;
+	     code_index++ )
+	{
+		for( match_size = deflate_literal_codes_base[ code_index ];
+		     match_size < (size_t) ( deflate_literal_codes_base[ code_index ] + ( 1 << deflate_literal_codes_number_of_extra_bits[ code_index ] ) );
+		     match_size++ )
+		{
+			if( match_size <= 258 )
+			{
+				compressor->length_codes[ match_size ] = code_index;
+			}
+		}
+	}
+	/* Match size 258 is not stored as code 284 with extra value 31 but as code 285
+	 */
+	compressor->length_codes[ 258 ] = 28;
+
+	for( code_index = 0;
+	     code_index < 30;
+	     code_index++ )
+	{
+		for( distance = deflate_distance_codes_base[ code_index ];
+		     distance < (size_t) ( deflate_distance_codes_base[ code_index ] + ( 1 << deflate_distance_codes_number_of_extra_bits[ code_index ] ) );
+		     distance++ )
+		{
+			if( distance <= 256 )
+			{
+				compressor->distance_codes[ distance - 1 ] = code_index;
+			}
+			else
+			{
+				compressor->distance_codes[ 256 + ( ( distance - 1 ) >> 7 ) ] = code_index;
+			}
+		}
+	}
+	for( symbol = 0;
+	     symbol < 288;
+	     symbol++ )
+	{
+		if( symbol < 144 )
+		{
+			compressor->fixed_literal_code_sizes[ symbol ] = 8;
+		}
+		else if( symbol < 256 )
+		{
+			compressor->fixed_literal_code_sizes[ symbol ] = 9;
+		}
+		else if( symbol < 280 )
+		{
+			compressor->fixed_literal_code_sizes[ symbol ] = 7;
+		}
+		else
+		{
+			compressor->fixed_literal_code_sizes[ symbol ] = 8;
+		}
+	}
+	for( symbol = 0;
+	     symbol < 30;
+	     symbol++ )
+	{
+		compressor->fixed_distance_code_sizes[ symbol ] = 5;
+	}
+	deflate_compress_build_codes(
+	 compressor->fixed_literal_code_sizes,
+	 288,
+	 compressor->fixed_literal_codes );
+
+	deflate_compress_build_codes(
+	 compressor->fixed_distance_code_sizes,
+	 30,
+	 compressor->fixed_distance_codes );
+
+	return( 1 );
+}
+
+/* Retrieves the distance code of a distance
+ * Returns the distance code
+ */
+static uint8_t deflate_compressor_get_distance_code(
+                deflate_compressor_t *compressor,
+                uint16_t distance )
+{
+	if( distance <= 256 )
+	{
+		return( compressor->distance_codes[ distance - 1 ] );
+	}
+	return( compressor->distance_codes[ 256 + ( ( distance - 1 ) >> 7 ) ] );
+}
+
+/* Writes uncompressed data as stored (uncompressed) blocks
+ * Returns 1 on success or -1 on error
+ */
+static int deflate_compress_write_stored_blocks(
+            deflate_output_bit_stream_t *bit_stream,
+            const uint8_t *uncompressed_data,
+            size_t uncompressed_data_size,
+            uint8_t last_block_flag,
+            libcerror_error_t **error )
+{
+	static char *function = "deflate_compress_write_stored_blocks";
+	size_t block_size     = 0;
+	uint8_t block_header  = 0;
+
+	do
+	{
+		block_size = uncompressed_data_size;
+
+		if( block_size > 65535 )
+		{
+			block_size = 65535;
+		}
+		block_header = DEFLATE_BLOCK_TYPE_UNCOMPRESSED << 1;
+
+		if( ( last_block_flag != 0 )
+		 && ( block_size == uncompressed_data_size ) )
+		{
+			block_header |= 0x01;
+		}
+		if( deflate_output_bit_stream_put_value(
+		     bit_stream,
+		     (uint32_t) block_header,
+		     3,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to write block header.",
+			 function );
+
+			return( -1 );
+		}
+		if( deflate_output_bit_stream_flush(
+		     bit_stream,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to flush bit stream.",
+			 function );
+
+			return( -1 );
+		}
+		if( ( block_size + 4 ) > ( bit_stream->byte_stream_size - bit_stream->byte_stream_offset ) )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+			 LIBCERROR_ARGUMENT_ERROR_VALUE_TOO_SMALL,
+			 "%s: invalid compressed data value too small.",
+			 function );
+
+			return( -1 );
+		}
+		byte_stream_copy_from_uint16_little_endian(
+		 &( bit_stream->byte_stream[ bit_stream->byte_stream_offset ] ),
+		 block_size );
+
+		byte_stream_copy_from_uint16_little_endian(
+		 &( bit_stream->byte_stream[ bit_stream->byte_stream_offset + 2 ] ),
+		 block_size ^ 0x0000ffffUL );
+
+		bit_stream->byte_stream_offset += 4;
+
+		if( block_size > 0 )
+		{
+			if( memory_copy(
+			     &( bit_stream->byte_stream[ bit_stream->byte_stream_offset ] ),
+			     uncompressed_data,
+			     block_size ) == NULL )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_MEMORY,
+				 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+				 "%s: unable to copy uncompressed block data.",
+				 function );
+
+				return( -1 );
+			}
+		}
+		bit_stream->byte_stream_offset += block_size;
+		uncompressed_data              += block_size;
+		uncompressed_data_size         -= block_size;
+	}
+	while( uncompressed_data_size > 0 );
+
+	return( 1 );
+}
+
+/* Determines the number of bits of the tokens of the current block encoded with specific Huffman code sizes
+ * Returns the number of bits
+ */
+static uint64_t deflate_compressor_get_encoded_size(
+                 deflate_compressor_t *compressor,
+                 const uint8_t *literal_code_sizes,
+                 const uint8_t *distance_code_sizes )
+{
+	uint64_t encoded_size = 0;
+	int symbol            = 0;
+
+	for( symbol = 0;
+	     symbol < 286;
+	     symbol++ )
+	{
+		encoded_size += (uint64_t) compressor->literal_frequencies[ symbol ] * literal_code_sizes[ symbol ];
+
+		if( symbol > 256 )
+		{
+			encoded_size += (uint64_t) compressor->literal_frequencies[ symbol ] * deflate_literal_codes_number_of_extra_bits[ symbol - 257 ];
+		}
+	}
+	for( symbol = 0;
+	     symbol < 30;
+	     symbol++ )
+	{
+		encoded_size += (uint64_t) compressor->distance_frequencies[ symbol ]
+		              * ( distance_code_sizes[ symbol ] + deflate_distance_codes_number_of_extra_bits[ symbol ] );
+	}
+	return( encoded_size );
+}
+
+/* Writes the tokens of the current block and the end-of-block code
+ * Returns 1 on success or -1 on error
+ */
+static int deflate_compressor_write_tokens(
+            deflate_compressor_t *compressor,
+            deflate_output_bit_stream_t *bit_stream,
+            const uint8_t *literal_code_sizes,
+            const uint16_t *literal_codes,
+            const uint8_t *distance_code_sizes,
+            const uint16_t *distance_codes,
+            libcerror_error_t **error )
+{
+	static char *function  = "deflate_compressor_write_tokens";
+	uint32_t value_32bit   = 0;
+	uint16_t distance      = 0;
+	uint16_t symbol        = 0;
+	uint16_t token_value   = 0;
+	uint8_t code_index     = 0;
+	uint8_t number_of_bits = 0;
+	int token_index        = 0;
+
+	for( token_index = 0;
+	     token_index < compressor->number_of_tokens;
+	     token_index++ )
+	{
+		token_value = compressor->token_values[ token_index ];
+		distance    = compressor->token_distances[ token_index ];
+
+		if( distance == 0 )
+		{
+			value_32bit    = literal_codes[ token_value ];
+			number_of_bits = literal_code_sizes[ token_value ];
+		}
+		else
+		{
+			/* The literal and length code and its extra bits are written at once
+			 */
+			code_index = compressor->length_codes[ token_value ];
+			symbol     = 257 + code_index;
+
+			value_32bit    = literal_codes[ symbol ];
+			number_of_bits = literal_code_sizes[ symbol ];
+
+			value_32bit    |= (uint32_t) ( token_value - deflate_literal_codes_base[ code_index ] ) << number_of_bits;
+			number_of_bits += (uint8_t) deflate_literal_codes_number_of_extra_bits[ code_index ];
+
+			if( deflate_output_bit_stream_put_value(
+			     bit_stream,
+			     value_32bit,
+			     number_of_bits,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+				 "%s: unable to write length code.",
+				 function );
+
+				return( -1 );
+			}
+			code_index = deflate_compressor_get_distance_code(
+			              compressor,
+			              distance );
+
+			value_32bit    = distance_codes[ code_index ];
+			number_of_bits = distance_code_sizes[ code_index ];
+
+			value_32bit    |= (uint32_t) ( distance - deflate_distance_codes_base[ code_index ] ) << number_of_bits;
+			number_of_bits += (uint8_t) deflate_distance_codes_number_of_extra_bits[ code_index ];
+		}
+		if( deflate_output_bit_stream_put_value(
+		     bit_stream,
+		     value_32bit,
+		     number_of_bits,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to write token.",
+			 function );
+
+			return( -1 );
+		}
+	}
+	if( deflate_output_bit_stream_put_value(
+	     bit_stream,
+	     (uint32_t) literal_codes[ 256 ],
+	     literal_code_sizes[ 256 ],
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to write end-of-block code.",
+		 function );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Writes the current block using the smallest of the uncompressed, fixed Huffman
+ * and dynamic Huffman block types and resets the block
+ * Returns 1 on success or -1 on error
+ */
+static int deflate_compressor_write_block(
+            deflate_compressor_t *compressor,
+            deflate_output_bit_stream_t *bit_stream,
+            const uint8_t *uncompressed_data,
+            uint8_t last_block_flag,
+            libcerror_error_t **error )
+{
+	uint8_t code_sizes_array[ 316 ];
+	uint8_t run_length_symbols[ 316 ];
+	uint8_t run_length_values[ 316 ];
+	uint32_t codes_frequencies[ 19 ];
+	uint16_t codes_codes[ 19 ];
+	uint16_t distance_codes[ 30 ];
+	uint16_t literal_codes[ 286 ];
+	uint8_t codes_code_sizes[ 19 ];
+	uint8_t distance_code_sizes[ 30 ];
+	uint8_t literal_code_sizes[ 286 ];
+
+	static char *function            = "deflate_compressor_write_block";
+	uint64_t dynamic_size            = 0;
+	uint64_t fixed_size              = 0;
+	uint64_t stored_size             = 0;
+	uint8_t block_type               = 0;
+	uint8_t code_size                = 0;
+	int code_size_index              = 0;
+	int number_of_code_sizes         = 0;
+	int number_of_codes_code_sizes   = 0;
+	int number_of_distance_codes     = 0;
+	int number_of_literal_codes      = 0;
+	int number_of_run_length_symbols = 0;
+	int repeat_size                  = 0;
+	int run_length                   = 0;
+	int run_length_index             = 0;
+	int symbol                       = 0;
+
+	compressor->literal_frequencies[ 256 ] = 1;
+
+	if( deflate_compress_build_code_sizes(
+	     compressor->literal_frequencies,
+	     286,
+	     15,
+	     literal_code_sizes,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to determine literal code sizes.",
+		 function );
+
+		return( -1 );
+	}
+	if( deflate_compress_build_code_sizes(
+	     compressor->distance_frequencies,
+	     30,
+	     15,
+	     distance_code_sizes,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to determine distance code sizes.",
+		 function );
+
+		return( -1 );
+	}
+	for( number_of_literal_codes = 286;
+	     number_of_literal_codes > 257;
+	     number_of_literal_codes-- )
+	{
+		if( literal_code_sizes[ number_of_literal_codes - 1 ] != 0 )
+		{
+			break;
+		}
+	}
+	for( number_of_distance_codes = 30;
+	     number_of_distance_codes > 1;
+	     number_of_distance_codes-- )
+	{
+		if( distance_code_sizes[ number_of_distance_codes - 1 ] != 0 )
+		{
+			break;
+		}
+	}
+	/* Run-length encode the literal and distance code sizes
+	 */
+	for( symbol = 0;
+	     symbol < number_of_literal_codes;
+	     symbol++ )
+	{
+		code_sizes_array[ number_of_code_sizes++ ] = literal_code_sizes[ symbol ];
+	}
+	for( symbol = 0;
+	     symbol < number_of_distance_codes;
+	     symbol++ )
+	{
+		code_sizes_array[ number_of_code_sizes++ ] = distance_code_sizes[ symbol ];
+	}
+	for( symbol = 0;
+	     symbol < 19;
+	     symbol++ )
+	{
+		codes_frequencies[ symbol ] = 0;
+	}
+	code_size_index = 0;
+
+	while( code_size_index < number_of_code_sizes )
+	{
+		code_size  = code_sizes_array[ code_size_index ];
+		run_length = 1;
+
+		while( ( ( code_size_index + run_length ) < number_of_code_sizes )
+		    && ( code_sizes_array[ code_size_index + run_length ] == code_size ) )
+		{
+			run_length++;
+		}
+		code_size_index += run_length;
+
+		if( code_size == 0 )
+		{
+			while( run_length >= 11 )
+			{
+				repeat_size = ( run_length < 138 ) ? run_length : 138;
+
+				run_length_symbols[ number_of_run_length_symbols ] = 18;
+				run_length_values[ number_of_run_length_symbols++ ] = (uint8_t) ( repeat_size - 11 );
+
+				run_length -= repeat_size;
+			}
+			if( run_length >= 3 )
+			{
+				run_length_symbols[ number_of_run_length_symbols ] = 17;
+				run_length_values[ number_of_run_length_symbols++ ] = (uint8_t) ( run_length - 3 );
+
+				run_length = 0;
+			}
+		}
+		else
+		{
+			run_length_symbols[ number_of_run_length_symbols ] = code_size;
+			run_length_values[ number_of_run_length_symbols++ ] = 0;
+
+			run_length--;
+
+			while( run_length >= 3 )
+			{
+				repeat_size = ( run_length < 6 ) ? run_length : 6;
+
+				run_length_symbols[ number_of_run_length_symbols ] = 16;
+				run_length_values[ number_of_run_length_symbols++ ] = (uint8_t) ( repeat_size - 3 );
+
+				run_length -= repeat_size;
+			}
+		}
+		while( run_length > 0 )
+		{
+			run_length_symbols[ number_of_run_length_symbols ] = code_size;
+			run_length_values[ number_of_run_length_symbols++ ] = 0;
+
+			run_length--;
+		}
+	}
+	for( run_length_index = 0;
+	     run_length_index < number_of_run_length_symbols;
+	     run_length_index++ )
+	{
+		codes_frequencies[ run_length_symbols[ run_length_index ] ] += 1;
+	}
+	if( deflate_compress_build_code_sizes(
+	     codes_frequencies,
+	     19,
+	     7,
+	     codes_code_sizes,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to determine codes code sizes.",
+		 function );
+
+		return( -1 );
+	}
+	for( number_of_codes_code_sizes = 19;
+	     number_of_codes_code_sizes > 4;
+	     number_of_codes_code_sizes-- )
+	{
+		if( codes_code_sizes[ deflate_code_sizes_sequence[ number_of_codes_code_sizes - 1 ] ] != 0 )
+		{
+			break;
+		}
+	}
+	/* Determine the size of each block type in bits
+	 */
+	dynamic_size = 3 + 5 + 5 + 4 + ( 3 * (uint64_t) number_of_codes_code_sizes )
+	             + deflate_compressor_get_encoded_size(
+	                compressor,
+	                literal_code_sizes,
+	                distance_code_sizes );
+
+	for( run_length_index = 0;
+	     run_length_index < number_of_run_length_symbols;
+	     run_length_index++ )
+	{
+		symbol = run_length_symbols[ run_length_index ];
+
+		dynamic_size += codes_code_sizes[ symbol ];
+
+		if( symbol == 16 )
+		{
+			dynamic_size += 2;
+		}
+		else if( symbol == 17 )
+		{
+			dynamic_size += 3;
+		}
+		else if( symbol == 18 )
+		{
+			dynamic_size += 7;
+		}
+	}
+	fixed_size = 3 + deflate_compressor_get_encoded_size(
+	                  compressor,
+	                  compressor->fixed_literal_code_sizes,
+	                  compressor->fixed_distance_code_sizes );
+
+	stored_size = ( ( (uint64_t) compressor->block_size + 4 ) * 8 ) + 3 + 7
+	            + ( ( (uint64_t) compressor->block_size / 65535 ) * ( 5 * 8 ) );
+
+	if( ( stored_size <= fixed_size )
+	 && ( stored_size <= dynamic_size ) )
+	{
+		block_type = DEFLATE_BLOCK_TYPE_UNCOMPRESSED;
+	}
+	else if( fixed_size <= dynamic_size )
+	{
+		block_type = DEFLATE_BLOCK_TYPE_HUFFMAN_FIXED;
+	}
+	else
+	{
+		block_type = DEFLATE_BLOCK_TYPE_HUFFMAN_DYNAMIC;
+	}
+	if( libcnotify_verbose != 0 )
+	{
+		libcnotify_printf(
+		 "%s: block type\t\t\t\t\t: %" PRIu8 "\n",
+		 function,
+		 block_type );
+
+		libcnotify_printf(
+		 "%s: block size\t\t\t\t\t: %" PRIzd "\n",
+		 function,
+		 compressor->block_size );
+
+		libcnotify_printf(
+		 "%s: number of tokens\t\t\t\t: %d\n",
+		 function,
+		 compressor->number_of_tokens );
+
+		libcnotify_printf(
+		 "\n" );
+	}
+	if( block_type == DEFLATE_BLOCK_TYPE_UNCOMPRESSED )
+	{
+		if( deflate_compress_write_stored_blocks(
+		     bit_stream,
+		     &( uncompressed_data[ compressor->block_offset ] ),
+		     compressor->block_size,
+		     last_block_flag,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to write uncompressed block.",
+			 function );
+
+			return( -1 );
+		}
+	}
+	else
+	{
+		if( deflate_output_bit_stream_put_value(
+		     bit_stream,
+		     (uint32_t) ( ( block_type << 1 ) | last_block_flag ),
+		     3,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to write block header.",
+			 function );
+
+			return( -1 );
+		}
+		if( block_type == DEFLATE_BLOCK_TYPE_HUFFMAN_FIXED )
+		{
+			if( deflate_compressor_write_tokens(
+			     compressor,
+			     bit_stream,
+			     compressor->fixed_literal_code_sizes,
+			     compressor->fixed_literal_codes,
+			     compressor->fixed_distance_code_sizes,
+			     compressor->fixed_distance_codes,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+				 "%s: unable to write fixed Huffman block.",
+				 function );
+
+				return( -1 );
+			}
+		}
+		else
+		{
+			deflate_compress_build_codes(
+			 literal_code_sizes,
+			 286,
+			 literal_codes );
+
+			deflate_compress_build_codes(
+			 distance_code_sizes,
+			 30,
+			 distance_codes );
+
+			deflate_compress_build_codes(
+			 codes_code_sizes,
+			 19,
+			 codes_codes );
+
+			if( deflate_output_bit_stream_put_value(
+			     bit_stream,
+			     (uint32_t) ( number_of_literal_codes - 257 )
+			     | ( (uint32_t) ( number_of_distance_codes - 1 ) << 5 )
+			     | ( (uint32_t) ( number_of_codes_code_sizes - 4 ) << 10 ),
+			     14,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+				 "%s: unable to write number of codes.",
+				 function );
+
+				return( -1 );
+			}
+			for( symbol = 0;
+			     symbol < number_of_codes_code_sizes;
+			     symbol++ )
+			{
+				if( deflate_output_bit_stream_put_value(
+				     bit_stream,
+				     (uint32_t) codes_code_sizes[ deflate_code_sizes_sequence[ symbol ] ],
+				     3,
+				     error ) != 1 )
+				{
+					libcerror_error_set(
+					 error,
+					 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+					 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+					 "%s: unable to write codes code size.",
+					 function );
+
+					return( -1 );
+				}
+			}
+			for( run_length_index = 0;
+			     run_length_index < number_of_run_length_symbols;
+			     run_length_index++ )
+			{
+				symbol = run_length_symbols[ run_length_index ];
+
+				if( deflate_output_bit_stream_put_value(
+				     bit_stream,
+				     (uint32_t) codes_codes[ symbol ],
+				     codes_code_sizes[ symbol ],
+				     error ) != 1 )
+				{
+					libcerror_error_set(
+					 error,
+					 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+					 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+					 "%s: unable to write code size.",
+					 function );
+
+					return( -1 );
+				}
+				if( symbol >= 16 )
+				{
+					if( deflate_output_bit_stream_put_value(
+					     bit_stream,
+					     (uint32_t) run_length_values[ run_length_index ],
+					     ( symbol == 16 ) ? 2 : ( ( symbol == 17 ) ? 3 : 7 ),
+					     error ) != 1 )
+					{
+						libcerror_error_set(
+						 error,
+						 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+						 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+						 "%s: unable to write times to repeat.",
+						 function );
+
+						return( -1 );
+					}
+				}
+			}
+			if( deflate_compressor_write_tokens(
+			     compressor,
+			     bit_stream,
+			     literal_code_sizes,
+			     literal_codes,
+			     distance_code_sizes,
+			     distance_codes,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+				 "%s: unable to write dynamic Huffman block.",
+				 function );
+
+				return( -1 );
+			}
+		}
+	}
+	compressor->block_offset    += compressor->block_size;
+	compressor->block_size       = 0;
+	compressor->number_of_tokens = 0;
+
+	if( memory_set(
+	     compressor->literal_frequencies,
+	     0,
+	     sizeof( uint32_t ) * 286 ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear literal frequencies.",
+		 function );
+
+		return( -1 );
+	}
+	if( memory_set(
+	     compressor->distance_frequencies,
+	     0,
+	     sizeof( uint32_t ) * 30 ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear distance frequencies.",
+		 function );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Adds a literal or match token to the current block
+ * A distance of 0 indicates a literal, otherwise value contains the match size
+ * The block is written once it contains the maximum number of tokens
+ * Returns 1 on success or -1 on error
+ */
+static int deflate_compressor_add_token(
+            deflate_compressor_t *compressor,
+            deflate_output_bit_stream_t *bit_stream,
+            const uint8_t *uncompressed_data,
+            uint16_t value,
+            uint16_t distance,
+            libcerror_error_t **error )
+{
+	static char *function = "deflate_compressor_add_token";
+
+	compressor->token_values[ compressor->number_of_tokens ]    = value;
+	compressor->token_distances[ compressor->number_of_tokens ] = distance;
+
+	compressor->number_of_tokens += 1;
+
+	if( distance == 0 )
+	{
+		compressor->literal_frequencies[ value ] += 1;
+		compressor->block_size                   += 1;
+	}
+	else
+	{
+		compressor->literal_frequencies[ 257 + compressor->length_codes[ value ] ] += 1;
+
+		compressor->distance_frequencies[ deflate_compressor_get_distance_code( compressor, distance ) ] += 1;
+
+		compressor->block_size += value;
+	}
+	if( compressor->number_of_tokens >= DEFLATE_COMPRESSOR_MAXIMUM_NUMBER_OF_TOKENS )
+	{
+		if( deflate_compressor_write_block(
+		     compressor,
+		     bit_stream,
+		     uncompressed_data,
+		     0,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to write block.",
+			 function );
+
+			return( -1 );
+		}
+	}
+	return( 1 );
+}
+
+/* Inserts the string at a specific offset into the hash table
+ * The caller must ensure that at least 3 bytes are available at the offset
+ * Returns the previous hash head, which is the offset + 1 of the last string with the same hash or 0 if not set
+ */
+static size_t deflate_compressor_insert_string(
+               deflate_compressor_t *compressor,
+               const uint8_t *uncompressed_data,
+               size_t uncompressed_data_offset )
+{
+	size_t hash_head = 0;
+	uint32_t hash    = 0;
+
+	hash = ( (uint32_t) uncompressed_data[ uncompressed_data_offset ] << 10 )
+	     ^ ( (uint32_t) uncompressed_data[ uncompressed_data_offset + 1 ] << 5 )
+	     ^ (uint32_t) uncompressed_data[ uncompressed_data_offset + 2 ];
+
+	hash ^= hash >> DEFLATE_COMPRESSOR_HASH_NUMBER_OF_BITS;
+	hash &= ( 1 << DEFLATE_COMPRESSOR_HASH_NUMBER_OF_BITS ) - 1;
+
+	hash_head = compressor->hash_heads[ hash ];
+
+	compressor->hash_chains[ uncompressed_data_offset & ( DEFLATE_COMPRESSOR_WINDOW_SIZE - 1 ) ] = hash_head;
+	compressor->hash_heads[ hash ]                                                                 = uncompressed_data_offset + 1;
+
+	return( hash_head );
+}
+
+/* Finds the longest match of the string at a specific offset in the hash chain
+ * Only matches larger than minimum_match_size are considered
+ * Returns the match size or 0 if no such match was found
+ */
+static size_t deflate_compressor_find_match(
+               deflate_compressor_t *compressor,
+               const uint8_t *uncompressed_data,
+               size_t uncompressed_data_size,
+               size_t uncompressed_data_offset,
+               size_t hash_head,
+               size_t minimum_match_size,
+               int maximum_chain_length,
+               uint16_t *match_distance )
+{
+	const uint8_t *match_data   = NULL;
+	const uint8_t *string_data  = NULL;
+	uint64_t match_value_64bit  = 0;
+	uint64_t string_value_64bit = 0;
+	size_t best_match_size      = 0;
+	size_t candidate_offset     = 0;
+	size_t distance             = 0;
+	size_t match_size           = 0;
+	size_t maximum_match_size   = 0;
+
+	maximum_match_size = uncompressed_data_size - uncompressed_data_offset;
+
+	if( maximum_match_size > 258 )
+	{
+		maximum_match_size = 258;
+	}
+	if( minimum_match_size >= maximum_match_size )
+	{
+		return( 0 );
+	}
+	best_match_size = minimum_match_size;
+	string_data     = &( uncompressed_data[ uncompressed_data_offset ] );
+
+	while( ( hash_head != 0 )
+	    && ( maximum_chain_length > 0 ) )
+	{
+		candidate_offset = hash_head - 1;
+
+		if( candidate_offset >= uncompressed_data_offset )
+		{
+			break;
+		}
+		distance = uncompressed_data_offset - candidate_offset;
+
+		if( distance > DEFLATE_COMPRESSOR_WINDOW_SIZE )
+		{
+			break;
+		}
+		match_data = &( uncompressed_data[ candidate_offset ] );
+
+		/* Only compare the strings if they could result in a larger match
+		 */
+		if( ( match_data[ best_match_size ] == string_data[ best_match_size ] )
+		 && ( match_data[ 0 ] == string_data[ 0 ] )
+		 && ( match_data[ 1 ] == string_data[ 1 ] ) )
+		{
+			match_size = 2;
+
+			while( ( match_size + 8 ) <= maximum_match_size )
+			{
+				memory_copy(
+				 &match_value_64bit,
+				 &( match_data[ match_size ] ),
+				 8 );
+
+				memory_copy(
+				 &string_value_64bit,
+				 &( string_data[ match_size ] ),
+				 8 );
+
+				if( match_value_64bit != string_value_64bit )
+				{
+					break;
+				}
+				match_size += 8;
+			}
+			while( ( match_size < maximum_match_size )
+			    && ( match_data[ match_size ] == string_data[ match_size ] ) )
+			{
+				match_size++;
+			}
+			if( match_size > best_match_size )
+			{
+				best_match_size = match_size;
+				*match_distance = (uint16_t) distance;
+
+				if( ( match_size >= compressor->nice_match_size )
+				 || ( match_size >= maximum_match_size ) )
+				{
+					break;
+				}
+			}
+		}
+		hash_head = compressor->hash_chains[ candidate_offset & ( DEFLATE_COMPRESSOR_WINDOW_SIZE - 1 ) ];
+
+		/* The hash chain entry was overwritten by a more recent string
+		 */
+		if( hash_head > candidate_offset )
+		{
+			break;
+		}
+		maximum_chain_length--;
+	}
+	if( best_match_size == minimum_match_size )
+	{
+		return( 0 );
+	}
+	return( best_match_size );
+}
+
+/* Compresses data using greedy or lazy matching into blocks
+ * The data before uncompressed_data_offset, upto the size of the sliding window,
+ * is used as a preset dictionary
+ * Returns 1 on success or -1 on error
+ */
+static int deflate_compressor_compress_data(
+            deflate_compressor_t *compressor,
+            deflate_output_bit_stream_t *bit_stream,
+            const uint8_t *uncompressed_data,
+            size_t uncompressed_data_size,
+            size_t uncompressed_data_offset,
+            libcerror_error_t **error )
+{
+	static char *function            = "deflate_compressor_compress_data";
+	size_t dictionary_offset         = 0;
+	size_t hash_head                 = 0;
+	size_t match_end_offset          = 0;
+	size_t match_size                = 0;
+	size_t previous_match_size       = 0;
+	uint16_t match_distance          = 0;
+	uint16_t previous_match_distance = 0;
+	uint8_t previous_literal_pending = 0;
+	int maximum_chain_length         = 0;
+
+	if( uncompressed_data_offset > DEFLATE_COMPRESSOR_WINDOW_SIZE )
+	{
+		dictionary_offset = uncompressed_data_offset - DEFLATE_COMPRESSOR_WINDOW_SIZE;
+	}
+	/* The strings of the data compressed by a previous call are already in the hash table
+	 */
+	if( dictionary_offset < compressor->hashed_offset )
+	{
+		dictionary_offset = compressor->hashed_offset;
+	}
+	while( ( dictionary_offset < uncompressed_data_offset )
+	    && ( ( uncompressed_data_size - dictionary_offset ) >= 3 ) )
+	{
+		deflate_compressor_insert_string(
+		 compressor,
+		 uncompressed_data,
+		 dictionary_offset );
+
+		dictionary_offset++;
+	}
+	/* The tokens of a previous call that have not been written yet remain part of the current block
+	 */
+	if( compressor->number_of_tokens == 0 )
+	{
+		compressor->block_offset = uncompressed_data_offset;
+	}
+	while( uncompressed_data_offset < uncompressed_data_size )
+	{
+		match_size = 0;
+
+		if( ( uncompressed_data_size - uncompressed_data_offset ) >= 3 )
+		{
+			hash_head = deflate_compressor_insert_string(
+			             compressor,
+			             uncompressed_data,
+			             uncompressed_data_offset );
+
+			if( ( hash_head != 0 )
+			 && ( ( compressor->use_lazy_matching == 0 )
+			  ||  ( previous_match_size < compressor->maximum_lazy_match_size ) ) )
+			{
+				maximum_chain_length = compressor->maximum_chain_length;
+
+				if( ( compressor->use_lazy_matching != 0 )
+				 && ( previous_match_size >= compressor->good_match_size ) )
+				{
+					maximum_chain_length >>= 2;
+				}
+				match_size = deflate_compressor_find_match(
+				              compressor,
+				              uncompressed_data,
+				              uncompressed_data_size,
+				              uncompressed_data_offset,
+				              hash_head,
+				              ( previous_match_size > 2 ) ? previous_match_size : 2,
+				              maximum_chain_length,
+				              &match_distance );
+
+				/* A match of 3 bytes at a large distance is not smaller than 3 literals
+				 */
+				if( ( match_size == 3 )
+				 && ( match_distance > 4096 ) )
+				{
+					match_size = 0;
+				}
+			}
+		}
+		if( compressor->use_lazy_matching == 0 )
+		{
+			if( match_size >= 3 )
+			{
+				if( deflate_compressor_add_token(
+				     compressor,
+				     bit_stream,
+				     uncompressed_data,
+				     (uint16_t) match_size,
+				     match_distance,
+				     error ) != 1 )
+				{
+					libcerror_error_set(
+					 error,
+					 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+					 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+					 "%s: unable to add match.",
+					 function );
+
+					return( -1 );
+				}
+				match_end_offset = uncompressed_data_offset + match_size;
+
+				/* The strings of large matches are not hashed for speed
+				 */
+				if( match_size <= compressor->maximum_lazy_match_size )
+				{
+					uncompressed_data_offset++;
+
+					while( ( uncompressed_data_offset < match_end_offset )
+					    && ( ( uncompressed_data_size - uncompressed_data_offset ) >= 3 ) )
+					{
+						deflate_compressor_insert_string(
+						 compressor,
+						 uncompressed_data,
+						 uncompressed_data_offset );
+
+						uncompressed_data_offset++;
+					}
+				}
+				uncompressed_data_offset = match_end_offset;
+			}
+			else
+			{
+				if( deflate_compressor_add_token(
+				     compressor,
+				     bit_stream,
+				     uncompressed_data,
+				     (uint16_t) uncompressed_data[ uncompressed_data_offset ],
+				     0,
+				     error ) != 1 )
+				{
+					libcerror_error_set(
+					 error,
+					 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+					 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+					 "%s: unable to add literal.",
+					 function );
+
+					return( -1 );
+				}
+				uncompressed_data_offset++;
+			}
+		}
+		/* With lazy matching the match at the previous offset is only used
+		 * if the match at the current offset is not larger
+		 */
+		else if( ( previous_match_size >= 3 )
+		      && ( match_size <= previous_match_size ) )
+		{
+			if( deflate_compressor_add_token(
+			     compressor,
+			     bit_stream,
+			     uncompressed_data,
+			     (uint16_t) previous_match_size,
+			     previous_match_distance,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+				 "%s: unable to add match.",
+				 function );
+
+				return( -1 );
+			}
+			match_end_offset = uncompressed_data_offset - 1 + previous_match_size;
+
+			uncompressed_data_offset++;
+
+			while( ( uncompressed_data_offset < match_end_offset )
+			    && ( ( uncompressed_data_size - uncompressed_data_offset ) >= 3 ) )
+			{
+				deflate_compressor_insert_string(
+				 compressor,
+				 uncompressed_data,
+				 uncompressed_data_offset );
+
+				uncompressed_data_offset++;
+			}
+			uncompressed_data_offset = match_end_offset;
+			previous_match_size      = 0;
+			previous_literal_pending = 0;
+		}
+		else
+		{
+			if( previous_literal_pending != 0 )
+			{
+				if( deflate_compressor_add_token(
+				     compressor,
+				     bit_stream,
+				     uncompressed_data,
+				     (uint16_t) uncompressed_data[ uncompressed_data_offset - 1 ],
+				     0,
+				     error ) != 1 )
+				{
+					libcerror_error_set(
+					 error,
+					 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+					 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+					 "%s: unable to add literal.",
+					 function );
+
+					return( -1 );
+				}
+			}
+			previous_match_size      = match_size;
+			previous_match_distance  = match_distance;
+			previous_literal_pending = 1;
+
+			uncompressed_data_offset++;
+		}
+	}
+	if( previous_literal_pending != 0 )
+	{
+		if( deflate_compressor_add_token(
+		     compressor,
+		     bit_stream,
+		     uncompressed_data,
+		     (uint16_t) uncompressed_data[ uncompressed_data_offset - 1 ],
+		     0,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to add literal.",
+			 function );
+
+			return( -1 );
+		}
+	}
+	if( uncompressed_data_size >= 2 )
+	{
+		compressor->hashed_offset = uncompressed_data_size - 2;
+	}
+	return( 1 );
+}
+
+/* Estimates if data is compressible from its byte histogram
+ * The collision probability of the byte values, which is the sum of the squared byte counts
+ * divided by the squared size, is 1/256 for uniformly distributed data. Data of which the
+ * collision probability is less than 9/8 of that, an order-0 entropy of more than about 7.8 bits
+ * per byte, is considered incompressible. Data that only compresses by repetition of high entropy
+ * strings, such as a duplicated encrypted block, is not detected as compressible.
+ * Data smaller than the minimum scan size is always considered compressible, data larger
+ * than the scan size is not supported
+ * Returns 1 if compressible, 0 if not or -1 on error
+ */
+int deflate_data_is_compressible(
+     const uint8_t *data,
+     size_t data_size,
+     libcerror_error_t **error )
+{
+	uint32_t byte_counts[ 4 ][ 256 ];
+
+	static char *function   = "deflate_data_is_compressible";
+	size_t data_offset      = 0;
+	uint64_t byte_count     = 0;
+	uint64_t sum_of_squares = 0;
+	uint16_t byte_value     = 0;
+
+	if( data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid data.",
+		 function );
+
+		return( -1 );
+	}
+	if( data_size > (size_t) DEFLATE_COMPRESSOR_SCAN_SIZE )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid data size value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	if( data_size < DEFLATE_COMPRESSOR_MINIMUM_SCAN_SIZE )
+	{
+		return( 1 );
+	}
+	if( memory_set(
+	     byte_counts,
+	     0,
+	     sizeof( uint32_t ) * 4 * 256 ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear byte counts.",
+		 function );
+
+		return( -1 );
+	}
+	/* Count into 4 separate histograms so that the increments of successive bytes
+	 * with the same value do not depend on each other
+	 */
+	while( ( data_offset + 4 ) <= data_size )
+	{
+		byte_counts[ 0 ][ data[ data_offset ] ]     += 1;
+		byte_counts[ 1 ][ data[ data_offset + 1 ] ] += 1;
+		byte_counts[ 2 ][ data[ data_offset + 2 ] ] += 1;
+		byte_counts[ 3 ][ data[ data_offset + 3 ] ] += 1;
+
+		data_offset += 4;
+	}
+	while( data_offset < data_size )
+	{
+		byte_counts[ 0 ][ data[ data_offset ] ] += 1;
+
+		data_offset++;
+	}
+	for( byte_value = 0;
+	     byte_value < 256;
+	     byte_value++ )
+	{
+		byte_count = (uint64_t) byte_counts[ 0 ][ byte_value ]
+		           + byte_counts[ 1 ][ byte_value ]
+		           + byte_counts[ 2 ][ byte_value ]
+		           + byte_counts[ 3 ][ byte_value ];
+
+		sum_of_squares += byte_count * byte_count;
+	}
+	/* Compare the unbiased estimate of the collision probability:
+	 * ( sum_of_squares - size ) / ( size * ( size - 1 ) ) < 9 / ( 8 * 256 )
+	 */
+	if( ( ( sum_of_squares - data_size ) * 8 * 256 ) < ( (uint64_t) data_size * ( data_size - 1 ) * 9 ) )
+	{
+		return( 0 );
+	}
+	return( 1 );
+}
+
+/* Writes the zlib header with compression method 8 and a window size of 32 KiB
+ * Returns 1 on success or -1 on error
+ */
+int deflate_write_zlib_header(
+     uint8_t *compressed_data,
+     size_t compressed_data_size,
+     int compression_level,
+     libcerror_error_t **error )
+{
+	static char *function     = "deflate_write_zlib_header";
+	uint8_t compression_flags = 0;
+
+	if( compressed_data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid compressed data.",
+		 function );
+
+		return( -1 );
+	}
+	if( compressed_data_size < 2 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_TOO_SMALL,
+		 "%s: invalid compressed data value too small.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( compression_level < -1 )
+	 || ( compression_level > 9 ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_UNSUPPORTED_VALUE,
+		 "%s: unsupported compression level: %d.",
+		 function,
+		 compression_level );
+
+		return( -1 );
+	}
+	if( ( compression_level == -1 )
+	 || ( compression_level == 6 ) )
+	{
+		compression_flags = 2;
+	}
+	else if( compression_level < 2 )
+	{
+		compression_flags = 0;
+	}
+	else if( compression_level < 6 )
+	{
+		compression_flags = 1;
+	}
+	else
+	{
+		compression_flags = 3;
+	}
+	compression_flags <<= 6;
+	compression_flags  |= (uint8_t) ( ( 31 - ( ( ( 0x78 << 8 ) | compression_flags ) % 31 ) ) % 31 );
+
+	compressed_data[ 0 ] = 0x78;
+	compressed_data[ 1 ] = compression_flags;
+
+	return( 1 );
+}
+
+/* Compresses a chunk of data as raw deflate blocks, without zlib header and checksum
+ * The chunk consists of the data from uncompressed_data_offset upto uncompressed_data_size,
+ * the data before the chunk, upto 32 KiB, is used as a preset dictionary
+ * If last_chunk_flag is not set the blocks are not marked as last and are followed
+ * by an empty uncompressed block, so that the compressed data ends on a byte boundary
+ * and the compressed data of the next chunk can be appended
+ * Regions of the data that are estimated to be incompressible are stored in uncompressed blocks
+ * The compression level ranges from 0 (uncompressed blocks only) to 9 (best compression)
+ * or -1 for the default compression level
+ * Returns 1 on success or -1 on error
+ */
+int deflate_compress_chunk(
+     const uint8_t *uncompressed_data,
+     size_t uncompressed_data_size,
+     size_t uncompressed_data_offset,
+     int compression_level,
+     uint8_t last_chunk_flag,
+     uint8_t *compressed_data,
+     size_t *compressed_data_size,
+     libcerror_error_t **error )
+{
+	deflate_output_bit_stream_t bit_stream;
+
+	deflate_compressor_t *compressor = NULL;
+	static char *function            = "deflate_compress_chunk";
+	size_t region_offset             = 0;
+	size_t region_size               = 0;
+	uint8_t last_block_flag          = 0;
+	int result                       = 1;
+
+	if( uncompressed_data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid uncompressed data.",
+		 function );
+
+		return( -1 );
+	}
+	if( uncompressed_data_size > (size_t) SSIZE_MAX )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid uncompressed data size value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	if( uncompressed_data_offset > uncompressed_data_size )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid uncompressed data offset value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( compressed_data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid compressed data.",
+		 function );
+
+		return( -1 );
+	}
+	if( compressed_data_size == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid compressed data size.",
+		 function );
+
+		return( -1 );
+	}
+	if( *compressed_data_size > (size_t) SSIZE_MAX )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid compressed data size value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	if( compression_level == -1 )
+	{
+		compression_level = 6;
+	}
+	if( ( compression_level < 0 )
+	 || ( compression_level > 9 ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_UNSUPPORTED_VALUE,
+		 "%s: unsupported compression level: %d.",
+		 function,
+		 compression_level );
 
 		return( -1 );
 	}
+	bit_stream.byte_stream        = compressed_data;
+	bit_stream.byte_stream_size   = *compressed_data_size;
+	bit_stream.byte_stream_offset = 0;
+	bit_stream.bit_buffer         = 0;
+	bit_stream.bit_buffer_size    = 0;
+
+	if( compression_level == 0 )
+	{
+		if( deflate_compress_write_stored_blocks(
+		     &bit_stream,
+		     &( uncompressed_data[ uncompressed_data_offset ] ),
+		     uncompressed_data_size - uncompressed_data_offset,
+		     last_chunk_flag,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to write uncompressed blocks.",
+			 function );
+
+			goto on_error;
+		}
+	}
+	else
+	{
+		compressor = memory_allocate_structure(
+		              deflate_compressor_t );
+
+		if( compressor == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+			 "%s: unable to create compressor.",
+			 function );
+
+			goto on_error;
+		}
+		if( deflate_compressor_initialize(
+		     compressor,
+		     compression_level,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+			 "%s: unable to initialize compressor.",
+			 function );
+
+			goto on_error;
+		}
+		/* Regions that are estimated to be incompressible, such as encrypted
+		 * or already compressed data, are stored without matching
+		 */
+		region_offset = uncompressed_data_offset;
+
+		while( region_offset < uncompressed_data_size )
+		{
+			region_size = uncompressed_data_size - region_offset;
+
+			if( region_size > DEFLATE_COMPRESSOR_SCAN_SIZE )
+			{
+				region_size = DEFLATE_COMPRESSOR_SCAN_SIZE;
+			}
+			result = deflate_data_is_compressible(
+			          &( uncompressed_data[ region_offset ] ),
+			          region_size,
+			          error );
+
+			if( result == -1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+				 "%s: unable to determine if region is compressible.",
+				 function );
+
+				goto on_error;
+			}
+			else if( result != 0 )
+			{
+				if( deflate_compressor_compress_data(
+				     compressor,
+				     &bit_stream,
+				     uncompressed_data,
+				     region_offset + region_size,
+				     region_offset,
+				     error ) != 1 )
+				{
+					libcerror_error_set(
+					 error,
+					 LIBCERROR_ERROR_DOMAIN_COMPRESSION,
+					 LIBCERROR_COMPRESSION_ERROR_COMPRESS_FAILED,
+					 "%s: unable to compress data.",
+					 function );
+
+					goto on_error;
+				}
+			}
+			else
+			{
+				if( compressor->number_of_tokens > 0 )
+				{
+					if( deflate_compressor_write_block(
+					     compressor,
+					     &bit_stream,
+					     uncompressed_data,
+					     0,
+					     error ) != 1 )
+					{
+						libcerror_error_set(
+						 error,
+						 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+						 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+						 "%s: unable to write block.",
+						 function );
+
+						goto on_error;
+					}
+				}
+				last_block_flag = 0;
+
+				if( ( region_offset + region_size ) == uncompressed_data_size )
+				{
+					last_block_flag = last_chunk_flag;
+				}
+				if( deflate_compress_write_stored_blocks(
+				     &bit_stream,
+				     &( uncompressed_data[ region_offset ] ),
+				     region_size,
+				     last_block_flag,
+				     error ) != 1 )
+				{
+					libcerror_error_set(
+					 error,
+					 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+					 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+					 "%s: unable to write uncompressed blocks.",
+					 function );
+
+					goto on_error;
+				}
+			}
+			region_offset += region_size;
+		}
+		/* The last block was already written if the last region was stored
+		 */
+		if( result != 0 )
+		{
+			if( deflate_compressor_write_block(
+			     compressor,
+			     &bit_stream,
+			     uncompressed_data,
+			     last_chunk_flag,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+				 "%s: unable to write block.",
+				 function );
+
+				goto on_error;
+			}
+		}
+		memory_free(
+		 compressor );
+
+		compressor = NULL;
+	}
+	if( last_chunk_flag == 0 )
+	{
+		/* Align the compressed data to a byte boundary with an empty uncompressed block
+		 */
+		if( deflate_compress_write_stored_blocks(
+		     &bit_stream,
+		     &( uncompressed_data[ uncompressed_data_size ] ),
+		     0,
+		     0,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to write empty uncompressed block.",
+			 function );
+
+			goto on_error;
+		}
+	}
+	else if( deflate_output_bit_stream_flush(
+	          &bit_stream,
+	          error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to flush bit stream.",
+		 function );
+
+		goto on_error;
+	}
+	*compressed_data_size = bit_stream.byte_stream_offset;
+
+	return( 1 );
+
+on_error:
+	if( compressor != NULL )
+	{
+		memory_free(
+		 compressor );
+	}
+	return( -1 );
+}
+
+/* Compresses data using zlib compression
+ * The compression level ranges from 0 (uncompressed blocks only) to 9 (best compression)
+ * or -1 for the default compression level
+ * Returns 1 on success or -1 on error
+ */
+int deflate_compress(
+     const uint8_t *uncompressed_data,
+     size_t uncompressed_data_size,
+     int compression_level,
+     uint8_t *compressed_data,
+     size_t *compressed_data_size,
+     libcerror_error_t **error )
+{
+	static char *function         = "deflate_compress";
+	size_t compressed_data_offset = 0;
+	size_t chunk_size             = 0;
+	uint32_t calculated_checksum  = 0;
+
 	if( compressed_data_size == NULL )
 	{
 		libcerror_error_set(
@@ -1445,15 +3881,79 @@ int deflate_compress(
 
 		return( -1 );
 	}
-/* TODO implement */
-	libcerror_error_set(
-	 error,
-	 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-	 LIBCERROR_RUNTIME_ERROR_GENERIC,
-	 "%s: NOT IMPLEMENTED YET",
-	 function );
+	if( deflate_write_zlib_header(
+	     compressed_data,
+	     *compressed_data_size,
+	     compression_level,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to write zlib header.",
+		 function );
 
-	return( -1 );
+		return( -1 );
+	}
+	compressed_data_offset = 2;
+	chunk_size             = *compressed_data_size - compressed_data_offset;
+
+	if( deflate_compress_chunk(
+	     uncompressed_data,
+	     uncompressed_data_size,
+	     0,
+	     compression_level,
+	     1,
+	     &( compressed_data[ compressed_data_offset ] ),
+	     &chunk_size,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_COMPRESSION,
+		 LIBCERROR_COMPRESSION_ERROR_COMPRESS_FAILED,
+		 "%s: unable to compress data.",
+		 function );
+
+		return( -1 );
+	}
+	compressed_data_offset += chunk_size;
+
+	if( deflate_calculate_adler32(
+	     &calculated_checksum,
+	     uncompressed_data,
+	     uncompressed_data_size,
+	     1,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to calculate checksum.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( *compressed_data_size - compressed_data_offset ) < 4 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_TOO_SMALL,
+		 "%s: invalid compressed data value too small.",
+		 function );
+
+		return( -1 );
+	}
+	byte_stream_copy_from_uint32_big_endian(
+	 &( compressed_data[ compressed_data_offset ] ),
+	 calculated_checksum );
+
+	*compressed_data_size = compressed_data_offset + 4;
+
+	return( 1 );
 }
 
 /* TODO split read zlib header and decompress */
@@ -1468,30 +3968,264 @@ int deflate_decompress(
      uint8_t *uncompressed_data,
      size_t *uncompressed_data_size,
      libcerror_error_t **error )
+{
+	return( deflate_decompress_with_flags(
+	         compressed_data,
+	         compressed_data_size,
+	         uncompressed_data,
+	         uncompressed_data_size,
+	         0,
+	         error ) );
+}
+
+/* Decompresses data using zlib compression
+ * The Adler-32 is calculated after every block, while the uncompressed data
+ * of the block is still cached, unless DEFLATE_DECOMPRESS_FLAG_IGNORE_CHECKSUM is set
+ * Returns 1 on success or -1 on error
+ */
+int deflate_decompress_with_flags(
+     const uint8_t *compressed_data,
+     size_t compressed_data_size,
+     uint8_t *uncompressed_data,
+     size_t *uncompressed_data_size,
+     uint8_t flags,
+     libcerror_error_t **error )
+{
+	deflate_decoder_t decoder;
+
+	return( deflate_decoder_decompress(
+	         &decoder,
+	         compressed_data,
+	         compressed_data_size,
+	         uncompressed_data,
+	         uncompressed_data_size,
+	         flags,
+	         error ) );
+}
+
+/* Creates a decoder
+ * Make sure the value decoder is referencing, is set to NULL
+ * Returns 1 if successful or -1 on error
+ */
+int deflate_decoder_initialize(
+     deflate_decoder_t **decoder,
+     libcerror_error_t **error )
+{
+	static char *function = "deflate_decoder_initialize";
+
+	if( decoder == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid decoder.",
+		 function );
+
+		return( -1 );
+	}
+	if( *decoder != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid decoder value already set.",
+		 function );
+
+		return( -1 );
+	}
+	*decoder = memory_allocate_structure(
+	            deflate_decoder_t );
+
+	if( *decoder == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create decoder.",
+		 function );
+
+		goto on_error;
+	}
+	if( memory_set(
+	     *decoder,
+	     0,
+	     sizeof( deflate_decoder_t ) ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear decoder.",
+		 function );
+
+		goto on_error;
+	}
+	return( 1 );
+
+on_error:
+	if( *decoder != NULL )
+	{
+		memory_free(
+		 *decoder );
+
+		*decoder = NULL;
+	}
+	return( -1 );
+}
+
+/* Frees a decoder
+ * Returns 1 if successful or -1 on error
+ */
+int deflate_decoder_free(
+     deflate_decoder_t **decoder,
+     libcerror_error_t **error )
+{
+	static char *function = "deflate_decoder_free";
+
+	if( decoder == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid decoder.",
+		 function );
+
+		return( -1 );
+	}
+	if( *decoder != NULL )
+	{
+		memory_free(
+		 *decoder );
+
+		*decoder = NULL;
+	}
+	return( 1 );
+}
+
+/* Resizes the uncompressed data to contain at least required size bytes
+ * The size of the uncompressed data is doubled, to prevent resizing it for
+ * every block, but limited to maximum size
+ * Returns 1 on success or -1 on error
+ */
+static int deflate_resize_uncompressed_data(
+            uint8_t **uncompressed_data,
+            size_t *uncompressed_data_size,
+            size_t required_size,
+            size_t maximum_size,
+            libcerror_error_t **error )
+{
+	uint8_t *reallocation = NULL;
+	static char *function = "deflate_resize_uncompressed_data";
+	size_t new_size       = 0;
+
+	if( required_size > maximum_size )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid required size value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	new_size = *uncompressed_data_size;
+
+	if( new_size <= ( maximum_size / 2 ) )
+	{
+		new_size *= 2;
+	}
+	else
+	{
+		new_size = maximum_size;
+	}
+	if( new_size < required_size )
+	{
+		new_size = required_size;
+	}
+	reallocation = (uint8_t *) memory_reallocate(
+	                            *uncompressed_data,
+	                            sizeof( uint8_t ) * new_size );
+
+	if( reallocation == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to resize uncompressed data.",
+		 function );
+
+		return( -1 );
+	}
+	*uncompressed_data      = reallocation;
+	*uncompressed_data_size = new_size;
+
+	return( 1 );
+}
+
+/* Decompresses data using zlib compression and the Huffman tables of the decoder
+ * The Adler-32 is calculated after every block, while the uncompressed data
+ * of the block is still cached, unless DEFLATE_DECOMPRESS_FLAG_IGNORE_CHECKSUM is set
+ * If maximum uncompressed data size is not 0 the uncompressed data is resized
+ * when needed up to that size, which requires the uncompressed data to be
+ * allocated by memory_allocate. A Huffman block that does not fit is resumed
+ * after the resize at the code where it stopped
+ * Returns 1 on success or -1 on error
+ */
+static int deflate_decoder_decompress_data(
+            deflate_decoder_t *decoder,
+            const uint8_t *compressed_data,
+            size_t compressed_data_size,
+            uint8_t **uncompressed_data,
+            size_t *uncompressed_data_size,
+            size_t maximum_uncompressed_data_size,
+            uint8_t flags,
+            libcerror_error_t **error )
 {
 	deflate_bit_stream_t bit_stream;
-	deflate_huffman_table_t dynamic_huffman_distances_table;
-	deflate_huffman_table_t dynamic_huffman_literals_table;
-	deflate_huffman_table_t fixed_huffman_distances_table;
-	deflate_huffman_table_t fixed_huffman_literals_table;
-
-	static char *function                 = "deflate_decompress";
-	size_t compressed_data_offset         = 0;
-	size_t uncompressed_data_offset       = 0;
-	uint32_t block_size                   = 0;
-	uint32_t block_size_copy              = 0;
-	uint32_t compression_window_size      = 0;
-	uint32_t calculated_checksum          = 0;
-	uint32_t preset_dictionary_identifier = 0;
-	uint32_t stored_checksum              = 0;
-	uint32_t value_32bit                  = 0;
-	uint8_t block_type                    = 0;
-	uint8_t compression_information       = 0;
-	uint8_t compression_method            = 0;
-	uint8_t compression_window_bits       = 0;
-	uint8_t last_block_flag               = 0;
-	uint8_t skip_bits                     = 0;
 
+	const deflate_huffman_table_t *distances_table = NULL;
+	const deflate_huffman_table_t *literals_table  = NULL;
+	uint8_t *output_data                           = NULL;
+	static char *function                          = "deflate_decoder_decompress_data";
+	size_t block_offset                            = 0;
+	size_t compressed_data_offset                  = 0;
+	size_t uncompressed_data_offset                = 0;
+	uint32_t block_size                            = 0;
+	uint32_t block_size_copy                       = 0;
+	uint32_t compression_window_size               = 0;
+	uint32_t calculated_checksum                   = 1;
+	uint32_t preset_dictionary_identifier          = 0;
+	uint32_t stored_checksum                       = 0;
+	uint32_t value_32bit                           = 0;
+	uint8_t block_type                             = 0;
+	uint8_t compression_information                = 0;
+	uint8_t compression_method                     = 0;
+	uint8_t compression_window_bits                = 0;
+	uint8_t last_block_flag                        = 0;
+	uint8_t skip_bits                              = 0;
+	int result                                     = 0;
+
+#if defined( HAVE_DEFLATE_STATISTICS )
+	uint64_t statistics_start_time                 = 0;
+#endif
+
+	if( decoder == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid decoder.",
+		 function );
+
+		return( -1 );
+	}
 	if( compressed_data == NULL )
 	{
 		libcerror_error_set(
@@ -1536,6 +4270,17 @@ int deflate_decompress(
 
 		return( -1 );
 	}
+	if( *uncompressed_data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid uncompressed data.",
+		 function );
+
+		return( -1 );
+	}
 	if( uncompressed_data_size == NULL )
 	{
 		libcerror_error_set(
@@ -1558,6 +4303,18 @@ int deflate_decompress(
 
 		return( -1 );
 	}
+	if( ( flags & ~( DEFLATE_DECOMPRESS_FLAG_IGNORE_CHECKSUM ) ) != 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_UNSUPPORTED_VALUE,
+		 "%s: unsupported flags: 0x%02" PRIx8 ".",
+		 function,
+		 flags );
+
+		return( -1 );
+	}
 	if( libcnotify_verbose != 0 )
 	{
 		libcnotify_printf(
@@ -1654,7 +4411,6 @@ int deflate_decompress(
 		 preset_dictionary_identifier );
 
 		compressed_data_offset += 4;
-		compressed_data_size   -= 4;
 
 		if( libcnotify_verbose != 0 )
 		{
@@ -1665,7 +4421,6 @@ int deflate_decompress(
 		}
 	}
 	compressed_data_offset += 2;
-	compressed_data_size   -= 2;
 
 	if( compression_method != 8 )
 	{
@@ -1718,29 +4473,18 @@ int deflate_decompress(
 
 		return( -1 );
 	}
+	output_data = *uncompressed_data;
+
 	bit_stream.byte_stream        = compressed_data;
 	bit_stream.byte_stream_size   = compressed_data_size;
 	bit_stream.byte_stream_offset = compressed_data_offset;
 	bit_stream.bit_buffer         = 0;
 	bit_stream.bit_buffer_size    = 0;
 
-	if( deflate_initialize_fixed_huffman_tables(
-	     &fixed_huffman_literals_table,
-	     &fixed_huffman_distances_table,
-	     error ) != 1 )
-	{
-		libcerror_error_set(
-		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
-		 "%s: unable to construct fixed Huffman tables.",
-		 function );
-
-		return( -1 );
-	}
-
-/* TODO find optimized solution to read bit stream from bytes */
-	while( bit_stream.byte_stream_offset < bit_stream.byte_stream_size )
+	/* The bit buffer can contain whole bytes that have not been read yet
+	 */
+	while( ( bit_stream.byte_stream_offset < bit_stream.byte_stream_size )
+	    || ( bit_stream.bit_buffer_size >= 8 ) )
 	{
 		if( deflate_bit_stream_get_value(
 		     &bit_stream,
@@ -1760,6 +4504,7 @@ int deflate_decompress(
 		last_block_flag = (uint8_t) ( value_32bit & 0x00000001UL );
 		value_32bit   >>= 1;
 		block_type      = (uint8_t) value_32bit;
+		block_offset    = uncompressed_data_offset;
 
 		if( libcnotify_verbose != 0 )
 		{
@@ -1805,6 +4550,9 @@ int deflate_decompress(
 		switch( block_type )
 		{
 			case DEFLATE_BLOCK_TYPE_UNCOMPRESSED:
+#if defined( HAVE_DEFLATE_STATISTICS )
+				deflate_statistics.number_of_stored_blocks += 1;
+#endif
 				/* Ignore the bits in the buffer upto the next byte
 				 */
 				skip_bits = bit_stream.bit_buffer_size & 0x07;
@@ -1834,43 +4582,47 @@ int deflate_decompress(
 						return( -1 );
 					}
 				}
-				if( deflate_bit_stream_get_value(
-				     &bit_stream,
-				     32,
-				     &block_size,
-				     error ) != 1 )
+				/* Return the bytes remaining in the bit buffer to the byte stream
+				 */
+				bit_stream.byte_stream_offset -= bit_stream.bit_buffer_size >> 3;
+				bit_stream.bit_buffer          = 0;
+				bit_stream.bit_buffer_size     = 0;
+
+				if( ( bit_stream.byte_stream_size - bit_stream.byte_stream_offset ) < 4 )
 				{
 					libcerror_error_set(
 					 error,
-					 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-					 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-					 "%s: unable to retrieve value from bit stream.",
+					 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+					 LIBCERROR_ARGUMENT_ERROR_VALUE_TOO_SMALL,
+					 "%s: invalid compressed data value too small.",
 					 function );
 
 					return( -1 );
 				}
-				block_size_copy = block_size >> 16;
-				block_size     &= 0x0000ffffUL;
+				byte_stream_copy_to_uint16_little_endian(
+				 &( compressed_data[ bit_stream.byte_stream_offset ] ),
+				 block_size );
+
+				byte_stream_copy_to_uint16_little_endian(
+				 &( compressed_data[ bit_stream.byte_stream_offset + 2 ] ),
+				 block_size_copy );
+
+				bit_stream.byte_stream_offset += 4;
 
 				if( libcnotify_verbose != 0 )
 				{
-					libcnotify_printf(
-					 "%s: block header unknown1\t\t\t\t\t: %" PRIu32 "\n",
-					 function,
-					 value_32bit );
-
 					libcnotify_printf(
 					 "%s: block header block size\t\t\t\t\t: %" PRIu32 "\n",
 					 function,
 					 block_size );
 
 					libcnotify_printf(
-					 "%s: block header block size copy\t\t\t\t: %" PRIu16 " (%" PRIu32 ")\n",
+					 "%s: block header block size copy\t\t\t\t: %" PRIu32 " (%" PRIu32 ")\n",
 					 function,
-					 block_size_copy ^ 0x0000ffffUL,
+					 (uint32_t) ( block_size_copy ^ 0x0000ffffUL ),
 					 block_size_copy );
 				}
-				block_size_copy = ( block_size >> 16 ) ^ 0x0000ffffUL;
+				block_size_copy ^= 0x0000ffffUL;
 
 				if( block_size != block_size_copy )
 				{
@@ -1902,17 +4654,37 @@ int deflate_decompress(
 				}
 				if( (size_t) block_size > ( *uncompressed_data_size - uncompressed_data_offset ) )
 				{
-					libcerror_error_set(
-					 error,
-					 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
-					 LIBCERROR_ARGUMENT_ERROR_VALUE_TOO_SMALL,
-					 "%s: invalid uncompressed data value too small.",
-					 function );
+					if( maximum_uncompressed_data_size <= *uncompressed_data_size )
+					{
+						libcerror_error_set(
+						 error,
+						 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+						 LIBCERROR_ARGUMENT_ERROR_VALUE_TOO_SMALL,
+						 "%s: invalid uncompressed data value too small.",
+						 function );
 
-					return( -1 );
+						return( -1 );
+					}
+					if( deflate_resize_uncompressed_data(
+					     uncompressed_data,
+					     uncompressed_data_size,
+					     uncompressed_data_offset + block_size,
+					     maximum_uncompressed_data_size,
+					     error ) != 1 )
+					{
+						libcerror_error_set(
+						 error,
+						 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+						 LIBCERROR_RUNTIME_ERROR_RESIZE_FAILED,
+						 "%s: unable to resize uncompressed data.",
+						 function );
+
+						return( -1 );
+					}
+					output_data = *uncompressed_data;
 				}
 				if( memory_copy(
-				     &( uncompressed_data[ uncompressed_data_offset ] ),
+				     &( output_data[ uncompressed_data_offset ] ),
 				     &( compressed_data[ bit_stream.byte_stream_offset ] ),
 				     (size_t) block_size ) == NULL )
 				{
@@ -1928,39 +4700,30 @@ int deflate_decompress(
 				bit_stream.byte_stream_offset += block_size;
 				uncompressed_data_offset      += block_size;
 
-				/* Flush the bit-stream buffer
-				 */
-				bit_stream.bit_buffer      = 0;
-				bit_stream.bit_buffer_size = 0;
-
+#if defined( HAVE_DEFLATE_STATISTICS )
+				deflate_statistics.number_of_stored_bytes += block_size;
+#endif
 				break;
 
 			case DEFLATE_BLOCK_TYPE_HUFFMAN_FIXED:
-				if( deflate_decode_huffman(
-				     &bit_stream,
-				     &fixed_huffman_literals_table,
-				     &fixed_huffman_distances_table,
-				     uncompressed_data,
-				     *uncompressed_data_size,
-				     &uncompressed_data_offset,
-				     error ) != 1 )
-				{
-					libcerror_error_set(
-					 error,
-					 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-					 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-					 "%s: unable to decode fixed Huffman encoded bit stream.",
-					 function );
+#if defined( HAVE_DEFLATE_STATISTICS )
+				deflate_statistics.number_of_fixed_huffman_blocks += 1;
+#endif
+				literals_table  = &deflate_fixed_huffman_literals_table;
+				distances_table = &deflate_fixed_huffman_distances_table;
 
-					return( -1 );
-				}
 				break;
 
 			case DEFLATE_BLOCK_TYPE_HUFFMAN_DYNAMIC:
+#if defined( HAVE_DEFLATE_STATISTICS )
+				deflate_statistics.number_of_dynamic_huffman_blocks += 1;
+
+				statistics_start_time = assorted_timer_get_nanoseconds();
+#endif
 				if( deflate_initialize_dynamic_huffman_tables(
 				     &bit_stream,
-				     &dynamic_huffman_literals_table,
-				     &dynamic_huffman_distances_table,
+				     &( decoder->dynamic_huffman_literals_table ),
+				     &( decoder->dynamic_huffman_distances_table ),
 				     error ) != 1 )
 				{
 					libcerror_error_set(
@@ -1972,36 +4735,110 @@ int deflate_decompress(
 
 					return( -1 );
 				}
-				if( deflate_decode_huffman(
-				     &bit_stream,
-				     &dynamic_huffman_literals_table,
-				     &dynamic_huffman_distances_table,
-				     uncompressed_data,
-				     *uncompressed_data_size,
-				     &uncompressed_data_offset,
-				     error ) != 1 )
+#if defined( HAVE_DEFLATE_STATISTICS )
+				deflate_statistics.dynamic_huffman_tables_time += assorted_timer_get_nanoseconds() - statistics_start_time;
+#endif
+				literals_table  = &( decoder->dynamic_huffman_literals_table );
+				distances_table = &( decoder->dynamic_huffman_distances_table );
+
+				break;
+
+			case DEFLATE_BLOCK_TYPE_RESERVED:
+			default:
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_UNSUPPORTED_VALUE,
+				 "%s: unsupported block type.",
+				 function );
+
+				return( -1 );
+		}
+		if( block_type != DEFLATE_BLOCK_TYPE_UNCOMPRESSED )
+		{
+			do
+			{
+#if defined( HAVE_DEFLATE_STATISTICS )
+				statistics_start_time = assorted_timer_get_nanoseconds();
+#endif
+				result = deflate_decode_huffman(
+				          &bit_stream,
+				          literals_table,
+				          distances_table,
+				          output_data,
+				          *uncompressed_data_size,
+				          &uncompressed_data_offset,
+				          error );
+
+#if defined( HAVE_DEFLATE_STATISTICS )
+				deflate_statistics.huffman_decode_time += assorted_timer_get_nanoseconds() - statistics_start_time;
+#endif
+				if( result == -1 )
 				{
 					libcerror_error_set(
 					 error,
 					 LIBCERROR_ERROR_DOMAIN_RUNTIME,
 					 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-					 "%s: unable to decode dynamic Huffman encoded bit stream.",
+					 "%s: unable to decode Huffman encoded bit stream.",
 					 function );
 
 					return( -1 );
 				}
-				break;
+				else if( result == 0 )
+				{
+					if( maximum_uncompressed_data_size <= *uncompressed_data_size )
+					{
+						libcerror_error_set(
+						 error,
+						 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+						 LIBCERROR_ARGUMENT_ERROR_VALUE_TOO_SMALL,
+						 "%s: invalid uncompressed data value too small.",
+						 function );
 
-			case DEFLATE_BLOCK_TYPE_RESERVED:
-			default:
+						return( -1 );
+					}
+					/* The block is resumed at the code that did not fit
+					 */
+					if( deflate_resize_uncompressed_data(
+					     uncompressed_data,
+					     uncompressed_data_size,
+					     uncompressed_data_offset + 1,
+					     maximum_uncompressed_data_size,
+					     error ) != 1 )
+					{
+						libcerror_error_set(
+						 error,
+						 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+						 LIBCERROR_RUNTIME_ERROR_RESIZE_FAILED,
+						 "%s: unable to resize uncompressed data.",
+						 function );
+
+						return( -1 );
+					}
+					output_data = *uncompressed_data;
+				}
+			}
+			while( result == 0 );
+		}
+		if( ( ( flags & DEFLATE_DECOMPRESS_FLAG_IGNORE_CHECKSUM ) == 0 )
+		 && ( uncompressed_data_offset > block_offset ) )
+		{
+			if( deflate_calculate_adler32(
+			     &calculated_checksum,
+			     &( output_data[ block_offset ] ),
+			     uncompressed_data_offset - block_offset,
+			     calculated_checksum,
+			     error ) != 1 )
+			{
 				libcerror_error_set(
 				 error,
 				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-				 LIBCERROR_RUNTIME_ERROR_UNSUPPORTED_VALUE,
-				 "%s: unsupported block type.",
+				 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+				 "%s: unable to calculate checksum.",
 				 function );
 
 				return( -1 );
+			}
 		}
 		if( libcnotify_verbose != 0 )
 		{
@@ -2013,33 +4850,19 @@ int deflate_decompress(
 			break;
 		}
 	}
-	if( ( bit_stream.byte_stream_size - bit_stream.byte_stream_offset ) >= 4 )
+	/* Return the bytes remaining in the bit buffer to the byte stream
+	 */
+	bit_stream.byte_stream_offset -= bit_stream.bit_buffer_size >> 3;
+	bit_stream.bit_buffer          = 0;
+	bit_stream.bit_buffer_size     = 0;
+
+	if( ( ( flags & DEFLATE_DECOMPRESS_FLAG_IGNORE_CHECKSUM ) == 0 )
+	 && ( ( bit_stream.byte_stream_size - bit_stream.byte_stream_offset ) >= 4 ) )
 	{
-		while( bit_stream.bit_buffer_size >= 8 )
-		{
-			bit_stream.byte_stream_offset -= 1;
-			bit_stream.bit_buffer_size    -= 8;
-		}
 		byte_stream_copy_to_uint32_big_endian(
 		 &( bit_stream.byte_stream[ bit_stream.byte_stream_offset ] ),
 		 stored_checksum );
 
-		if( deflate_calculate_adler32(
-		     &calculated_checksum,
-		     uncompressed_data,
-		     uncompressed_data_offset,
-		     1,
-		     error ) != 1 )
-		{
-			libcerror_error_set(
-			 error,
-			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
-			 "%s: unable to calculate checksum.",
-			 function );
-
-			return( -1 );
-		}
 		if( libcnotify_verbose != 0 )
 		{
 			libcnotify_printf(
@@ -2071,6 +4894,353 @@ int deflate_decompress(
 	return( 1 );
 }
 
+/* Decompresses data using zlib compression and the Huffman tables of the decoder
+ * The Adler-32 is calculated after every block, while the uncompressed data
+ * of the block is still cached, unless DEFLATE_DECOMPRESS_FLAG_IGNORE_CHECKSUM is set
+ * Returns 1 on success or -1 on error
+ */
+int deflate_decoder_decompress(
+     deflate_decoder_t *decoder,
+     const uint8_t *compressed_data,
+     size_t compressed_data_size,
+     uint8_t *uncompressed_data,
+     size_t *uncompressed_data_size,
+     uint8_t flags,
+     libcerror_error_t **error )
+{
+	return( deflate_decoder_decompress_data(
+	         decoder,
+	         compressed_data,
+	         compressed_data_size,
+	         &uncompressed_data,
+	         uncompressed_data_size,
+	         0,
+	         flags,
+	         error ) );
+}
+
+/* Decompresses data using zlib compression into a newly allocated buffer
+ * The buffer is initially sized using the uncompressed data size, if not 0,
+ * or otherwise 4 times the compressed data size. If the uncompressed data
+ * is larger the buffer is doubled in size while decompressing, without
+ * restarting the decompression
+ * The uncompressed data must be freed with memory_free
+ * Returns 1 on success or -1 on error
+ */
+int deflate_decompress_allocate(
+     const uint8_t *compressed_data,
+     size_t compressed_data_size,
+     uint8_t **uncompressed_data,
+     size_t *uncompressed_data_size,
+     uint8_t flags,
+     libcerror_error_t **error )
+{
+	deflate_decoder_t decoder;
+
+	static char *function                 = "deflate_decompress_allocate";
+	size_t maximum_uncompressed_data_size = 0;
+	size_t safe_uncompressed_data_size    = 0;
+
+	if( compressed_data_size > (size_t) SSIZE_MAX )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid compressed data size value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	if( uncompressed_data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid uncompressed data.",
+		 function );
+
+		return( -1 );
+	}
+	if( *uncompressed_data != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid uncompressed data value already set.",
+		 function );
+
+		return( -1 );
+	}
+	if( uncompressed_data_size == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid uncompressed data size.",
+		 function );
+
+		return( -1 );
+	}
+	/* A dynamic Huffman block can encode a match of 258 bytes in a single bit
+	 * hence a byte of compressed data can represent at most 8 x 258 bytes
+	 */
+	if( compressed_data_size > (size_t) ( SSIZE_MAX / 2064 ) )
+	{
+		maximum_uncompressed_data_size = (size_t) SSIZE_MAX;
+	}
+	else
+	{
+		maximum_uncompressed_data_size = compressed_data_size * 2064;
+	}
+	safe_uncompressed_data_size = *uncompressed_data_size;
+
+	if( safe_uncompressed_data_size == 0 )
+	{
+		safe_uncompressed_data_size = compressed_data_size * 4;
+	}
+	if( safe_uncompressed_data_size > maximum_uncompressed_data_size )
+	{
+		safe_uncompressed_data_size = maximum_uncompressed_data_size;
+	}
+	if( safe_uncompressed_data_size == 0 )
+	{
+		safe_uncompressed_data_size = 1;
+	}
+	*uncompressed_data = (uint8_t *) memory_allocate(
+	                                  sizeof( uint8_t ) * safe_uncompressed_data_size );
+
+	if( *uncompressed_data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create uncompressed data.",
+		 function );
+
+		goto on_error;
+	}
+	if( deflate_decoder_decompress_data(
+	     &decoder,
+	     compressed_data,
+	     compressed_data_size,
+	     uncompressed_data,
+	     &safe_uncompressed_data_size,
+	     maximum_uncompressed_data_size,
+	     flags,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_COMPRESSION,
+		 LIBCERROR_COMPRESSION_ERROR_DECOMPRESS_FAILED,
+		 "%s: unable to decompress data.",
+		 function );
+
+		goto on_error;
+	}
+	*uncompressed_data_size = safe_uncompressed_data_size;
+
+	return( 1 );
+
+on_error:
+	if( *uncompressed_data != NULL )
+	{
+		memory_free(
+		 *uncompressed_data );
+
+		*uncompressed_data = NULL;
+	}
+	return( -1 );
+}
+
+#if defined( HAVE_DEFLATE_STATISTICS )
+
+/* Resets the statistics collected by the decoder
+ */
+void deflate_statistics_reset(
+      void )
+{
+	memory_set(
+	 &deflate_statistics,
+	 0,
+	 sizeof( deflate_statistics_t ) );
+}
+
+/* Retrieves a copy of the statistics collected by the decoder
+ * Returns 1 on success or -1 on error
+ */
+int deflate_statistics_get(
+     deflate_statistics_t *statistics,
+     libcerror_error_t **error )
+{
+	static char *function = "deflate_statistics_get";
+
+	if( statistics == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid statistics.",
+		 function );
+
+		return( -1 );
+	}
+	if( memory_copy(
+	     statistics,
+	     &deflate_statistics,
+	     sizeof( deflate_statistics_t ) ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+		 "%s: unable to copy statistics.",
+		 function );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Prints the statistics collected by the decoder
+ * Returns 1 on success or -1 on error
+ */
+int deflate_statistics_fprint(
+     FILE *stream,
+     libcerror_error_t **error )
+{
+	static char *function    = "deflate_statistics_fprint";
+	uint64_t number_of_codes = 0;
+	int code_index           = 0;
+
+	if( stream == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid stream.",
+		 function );
+
+		return( -1 );
+	}
+	number_of_codes = deflate_statistics.number_of_literals + deflate_statistics.number_of_matches;
+
+	fprintf(
+	 stream,
+	 "Deflate decoder statistics:\n" );
+
+	fprintf(
+	 stream,
+	 "\tstored blocks\t\t\t: %" PRIu64 " (%" PRIu64 " bytes)\n",
+	 deflate_statistics.number_of_stored_blocks,
+	 deflate_statistics.number_of_stored_bytes );
+
+	fprintf(
+	 stream,
+	 "\tfixed Huffman blocks\t\t: %" PRIu64 "\n",
+	 deflate_statistics.number_of_fixed_huffman_blocks );
+
+	fprintf(
+	 stream,
+	 "\tdynamic Huffman blocks\t\t: %" PRIu64 "\n",
+	 deflate_statistics.number_of_dynamic_huffman_blocks );
+
+	fprintf(
+	 stream,
+	 "\tliterals\t\t\t: %" PRIu64 " (%" PRIu64 "%%)\n",
+	 deflate_statistics.number_of_literals,
+	 ( number_of_codes > 0 ) ? ( deflate_statistics.number_of_literals * 100 ) / number_of_codes : 0 );
+
+	fprintf(
+	 stream,
+	 "\tmatches\t\t\t\t: %" PRIu64 " (%" PRIu64 "%%, %" PRIu64 " bytes)\n",
+	 deflate_statistics.number_of_matches,
+	 ( number_of_codes > 0 ) ? ( deflate_statistics.number_of_matches * 100 ) / number_of_codes : 0,
+	 deflate_statistics.number_of_match_bytes );
+
+	fprintf(
+	 stream,
+	 "\tdynamic tables time\t\t: %" PRIu64 ".%03" PRIu64 " ms\n",
+	 deflate_statistics.dynamic_huffman_tables_time / 1000000,
+	 ( deflate_statistics.dynamic_huffman_tables_time / 1000 ) % 1000 );
+
+	fprintf(
+	 stream,
+	 "\tHuffman decode time\t\t: %" PRIu64 ".%03" PRIu64 " ms\n",
+	 deflate_statistics.huffman_decode_time / 1000000,
+	 ( deflate_statistics.huffman_decode_time / 1000 ) % 1000 );
+
+	fprintf(
+	 stream,
+	 "\nMatch sizes:\n" );
+
+	for( code_index = 0;
+	     code_index < 29;
+	     code_index++ )
+	{
+		if( deflate_statistics.match_size_histogram[ code_index ] != 0 )
+		{
+			fprintf(
+			 stream,
+			 "\t%" PRIu16 " - %" PRIu16 "\t\t\t: %" PRIu64 "\n",
+			 deflate_literal_codes_base[ code_index ],
+			 deflate_literal_codes_base[ code_index ] + ( 1 << deflate_literal_codes_number_of_extra_bits[ code_index ] ) - 1,
+			 deflate_statistics.match_size_histogram[ code_index ] );
+		}
+	}
+	fprintf(
+	 stream,
+	 "\nMatch distances:\n" );
+
+	for( code_index = 0;
+	     code_index < 30;
+	     code_index++ )
+	{
+		if( deflate_statistics.match_distance_histogram[ code_index ] != 0 )
+		{
+			fprintf(
+			 stream,
+			 "\t%" PRIu16 " - %" PRIu16 "\t\t\t: %" PRIu64 "\n",
+			 deflate_distance_codes_base[ code_index ],
+			 deflate_distance_codes_base[ code_index ] + ( 1 << deflate_distance_codes_number_of_extra_bits[ code_index ] ) - 1,
+			 deflate_statistics.match_distance_histogram[ code_index ] );
+		}
+	}
+	fprintf(
+	 stream,
+	 "\nDynamic Huffman code sizes:\tliterals\tdistances\n" );
+
+	for( code_index = 0;
+	     code_index < 16;
+	     code_index++ )
+	{
+		if( ( deflate_statistics.literals_code_size_histogram[ code_index ] != 0 )
+		 || ( deflate_statistics.distances_code_size_histogram[ code_index ] != 0 ) )
+		{
+			fprintf(
+			 stream,
+			 "\t%2d bits\t\t\t: %" PRIu64 "\t\t%" PRIu64 "\n",
+			 code_index,
+			 deflate_statistics.literals_code_size_histogram[ code_index ],
+			 deflate_statistics.distances_code_size_histogram[ code_index ] );
+		}
+	}
+	fprintf(
+	 stream,
+	 "\n" );
+
+	return( 1 );
+}
+
+#endif /* defined( HAVE_DEFLATE_STATISTICS ) */
+
 #ifdef TODO
 	/* Align the compressed data
 	 */
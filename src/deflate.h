@@ -23,6 +23,7 @@
 #define _DEFLATE_COMPRESSION_H
 
 #include <common.h>
+#include <file_stream.h>
 #include <types.h>
 
 #include "assorted_libcerror.h"
@@ -41,10 +42,27 @@ enum DEFLATE_BLOCK_TYPES
 	DEFLATE_BLOCK_TYPE_RESERVED		= 0x03
 };
 
-/* The largest primary (or scalar) available
- * supported by a single load and store instruction
+/* The decompression flags
  */
-typedef unsigned long int deflate_aligned_t;
+enum DEFLATE_DECOMPRESS_FLAGS
+{
+	/* Do not calculate and verify the Adler-32 of the uncompressed data
+	 * e.g. when the data is validated by a checksum of the container
+	 */
+	DEFLATE_DECOMPRESS_FLAG_IGNORE_CHECKSUM	= 0x01
+};
+
+/* The number of bits used to index the primary Huffman lookup table
+ */
+#define DEFLATE_HUFFMAN_LOOKUP_TABLE_NUMBER_OF_BITS	9
+
+/* The number of entries of the Huffman lookup table
+ * this is the primary table of 512 entries and the secondary tables
+ * for codes larger than 9 bits, which for 288 symbols and a maximum
+ * code size of 15 bits require at most 41 secondary tables of 64 entries
+ * and one table of 64 entries for an incomplete set of code sizes
+ */
+#define DEFLATE_HUFFMAN_LOOKUP_TABLE_SIZE		3200
 
 typedef struct deflate_bit_stream deflate_bit_stream_t;
 
@@ -54,10 +72,6 @@ struct deflate_bit_stream
 	 */
 	const uint8_t *byte_stream;
 
-	/* The aligned byte stream
-	 */
-	deflate_aligned_t *aligned_byte_stream;
-
 	/* The byte stream size
 	 */
 	size_t byte_stream_size;
@@ -68,7 +82,7 @@ struct deflate_bit_stream
 
 	/* The bit buffer
 	 */
-	uint32_t bit_buffer;
+	uint64_t bit_buffer;
 
 	/* The number of bits remaining in the bit buffer
 	 */
@@ -95,8 +109,245 @@ struct deflate_huffman_table
 	/* The number of codes
 	 */
 	int number_of_codes;
+
+	/* The lookup table
+	 * an entry contains the symbol in bits 0 - 8 and the code size in bits 9 - 12
+	 * or a reference to a secondary table, indicated by bit 15, with the offset
+	 * of the secondary table in bits 0 - 11 and its number of bits in bits 12 - 14
+	 * an entry of 0 indicates an invalid Huffman code
+	 */
+	uint16_t lookup_table[ DEFLATE_HUFFMAN_LOOKUP_TABLE_SIZE ];
+};
+
+typedef struct deflate_decoder deflate_decoder_t;
+
+/* The decoder contains the scratch memory of deflate_decoder_decompress
+ * so that it can be reused when decompressing many streams
+ * No state is retained between streams
+ */
+struct deflate_decoder
+{
+	/* The dynamic Huffman literals table
+	 */
+	deflate_huffman_table_t dynamic_huffman_literals_table;
+
+	/* The dynamic Huffman distances table
+	 */
+	deflate_huffman_table_t dynamic_huffman_distances_table;
+};
+
+#if defined( HAVE_DEFLATE_STATISTICS )
+
+typedef struct deflate_statistics deflate_statistics_t;
+
+/* The statistics collected by the decoder
+ * The statistics are accumulated over all decompressed streams until reset
+ * and are not synchronized, hence they are only meaningful for single threaded use
+ */
+struct deflate_statistics
+{
+	/* The number of uncompressed (stored) blocks
+	 */
+	uint64_t number_of_stored_blocks;
+
+	/* The number of fixed Huffman compressed blocks
+	 */
+	uint64_t number_of_fixed_huffman_blocks;
+
+	/* The number of dynamic Huffman compressed blocks
+	 */
+	uint64_t number_of_dynamic_huffman_blocks;
+
+	/* The number of bytes in uncompressed (stored) blocks
+	 */
+	uint64_t number_of_stored_bytes;
+
+	/* The number of literals
+	 */
+	uint64_t number_of_literals;
+
+	/* The number of matches
+	 */
+	uint64_t number_of_matches;
+
+	/* The number of bytes produced by matches
+	 */
+	uint64_t number_of_match_bytes;
+
+	/* The match size histogram, indexed by the length code (257 - 285)
+	 */
+	uint64_t match_size_histogram[ 29 ];
+
+	/* The match distance histogram, indexed by the distance code
+	 */
+	uint64_t match_distance_histogram[ 30 ];
+
+	/* The code size histogram of the dynamic Huffman literals and lengths codes
+	 */
+	uint64_t literals_code_size_histogram[ 16 ];
+
+	/* The code size histogram of the dynamic Huffman distances codes
+	 */
+	uint64_t distances_code_size_histogram[ 16 ];
+
+	/* The time spent reading the code sizes and constructing the dynamic Huffman tables in nanoseconds
+	 */
+	uint64_t dynamic_huffman_tables_time;
+
+	/* The time spent decoding Huffman compressed blocks in nanoseconds
+	 */
+	uint64_t huffman_decode_time;
+};
+
+#endif /* defined( HAVE_DEFLATE_STATISTICS ) */
+
+/* The number of bits of the string hash used by the compressor
+ */
+#define DEFLATE_COMPRESSOR_HASH_NUMBER_OF_BITS		15
+
+/* The size of the sliding window of the compressor
+ */
+#define DEFLATE_COMPRESSOR_WINDOW_SIZE			32768
+
+/* The maximum number of tokens, which are literals or matches, in a compressed block
+ */
+#define DEFLATE_COMPRESSOR_MAXIMUM_NUMBER_OF_TOKENS	16384
+
+/* The size of the regions of which the compressor estimates if the data is compressible
+ */
+#define DEFLATE_COMPRESSOR_SCAN_SIZE			65536
+
+/* The minimum size of a region that can be estimated as incompressible
+ */
+#define DEFLATE_COMPRESSOR_MINIMUM_SCAN_SIZE		4096
+
+typedef struct deflate_output_bit_stream deflate_output_bit_stream_t;
+
+struct deflate_output_bit_stream
+{
+	/* The byte stream
+	 */
+	uint8_t *byte_stream;
+
+	/* The byte stream size
+	 */
+	size_t byte_stream_size;
+
+	/* The byte stream offset
+	 */
+	size_t byte_stream_offset;
+
+	/* The bit buffer
+	 */
+	uint64_t bit_buffer;
+
+	/* The number of bits in the bit buffer
+	 */
+	uint8_t bit_buffer_size;
 };
 
+typedef struct deflate_compressor deflate_compressor_t;
+
+struct deflate_compressor
+{
+	/* The hash heads
+	 * an entry contains the offset + 1 of the last string with the hash or 0 if not set
+	 */
+	size_t hash_heads[ 1 << DEFLATE_COMPRESSOR_HASH_NUMBER_OF_BITS ];
+
+	/* The hash chains
+	 * an entry contains the offset + 1 of the previous string with the same hash
+	 * and is indexed by the offset of the string within the sliding window
+	 */
+	size_t hash_chains[ DEFLATE_COMPRESSOR_WINDOW_SIZE ];
+
+	/* The offset upto which the strings have been inserted into the hash table
+	 */
+	size_t hashed_offset;
+
+	/* The maximum number of strings in a hash chain to compare
+	 */
+	int maximum_chain_length;
+
+	/* The match size from which the lazy matching compares less strings
+	 */
+	size_t good_match_size;
+
+	/* The match size from which lazy matching is no longer attempted
+	 * and, for greedy matching, from which the strings of the match are not hashed
+	 */
+	size_t maximum_lazy_match_size;
+
+	/* The match size from which the match is considered good enough
+	 */
+	size_t nice_match_size;
+
+	/* Value to indicate lazy matching should be used
+	 */
+	uint8_t use_lazy_matching;
+
+	/* The token values, which contain the literal or the match size
+	 */
+	uint16_t token_values[ DEFLATE_COMPRESSOR_MAXIMUM_NUMBER_OF_TOKENS ];
+
+	/* The token distances, which contain the match distance or 0 for a literal
+	 */
+	uint16_t token_distances[ DEFLATE_COMPRESSOR_MAXIMUM_NUMBER_OF_TOKENS ];
+
+	/* The number of tokens
+	 */
+	int number_of_tokens;
+
+	/* The offset of the uncompressed data of the current block
+	 */
+	size_t block_offset;
+
+	/* The size of the uncompressed data of the current block
+	 */
+	size_t block_size;
+
+	/* The literal and length code frequencies of the current block
+	 */
+	uint32_t literal_frequencies[ 286 ];
+
+	/* The distance code frequencies of the current block
+	 */
+	uint32_t distance_frequencies[ 30 ];
+
+	/* The length codes of match sizes 0 to 258
+	 */
+	uint8_t length_codes[ 259 ];
+
+	/* The distance codes of distances 1 to 256 and
+	 * of the distances 257 to 32768 in steps of 128
+	 */
+	uint8_t distance_codes[ 512 ];
+
+	/* The fixed Huffman literal and length code sizes
+	 */
+	uint8_t fixed_literal_code_sizes[ 288 ];
+
+	/* The fixed Huffman literal and length codes
+	 */
+	uint16_t fixed_literal_codes[ 288 ];
+
+	/* The fixed Huffman distance code sizes
+	 */
+	uint8_t fixed_distance_code_sizes[ 30 ];
+
+	/* The fixed Huffman distance codes
+	 */
+	uint16_t fixed_distance_codes[ 30 ];
+};
+
+extern const uint16_t deflate_literal_codes_base[ 29 ];
+
+extern const uint16_t deflate_literal_codes_number_of_extra_bits[ 29 ];
+
+extern const uint16_t deflate_distance_codes_base[ 30 ];
+
+extern const uint16_t deflate_distance_codes_number_of_extra_bits[ 30 ];
+
 int deflate_bit_stream_get_value(
      deflate_bit_stream_t *bit_stream,
      uint8_t number_of_bits,
@@ -111,7 +362,7 @@ int deflate_huffman_table_construct(
 
 int deflate_bit_stream_get_huffman_encoded_value(
      deflate_bit_stream_t *bit_stream,
-     deflate_huffman_table_t *table,
+     const deflate_huffman_table_t *table,
      uint32_t *value_32bit,
      libcerror_error_t **error );
 
@@ -128,8 +379,8 @@ int deflate_initialize_fixed_huffman_tables(
 
 int deflate_decode_huffman(
      deflate_bit_stream_t *bit_stream,
-     deflate_huffman_table_t *literals_table,
-     deflate_huffman_table_t *distances_table,
+     const deflate_huffman_table_t *literals_table,
+     const deflate_huffman_table_t *distances_table,
      uint8_t *uncompressed_data,
      size_t uncompressed_data_size,
      size_t *uncompressed_data_offset,
@@ -142,6 +393,27 @@ int deflate_calculate_adler32(
      uint32_t initial_value,
      libcerror_error_t **error );
 
+int deflate_data_is_compressible(
+     const uint8_t *data,
+     size_t data_size,
+     libcerror_error_t **error );
+
+int deflate_write_zlib_header(
+     uint8_t *compressed_data,
+     size_t compressed_data_size,
+     int compression_level,
+     libcerror_error_t **error );
+
+int deflate_compress_chunk(
+     const uint8_t *uncompressed_data,
+     size_t uncompressed_data_size,
+     size_t uncompressed_data_offset,
+     int compression_level,
+     uint8_t last_chunk_flag,
+     uint8_t *compressed_data,
+     size_t *compressed_data_size,
+     libcerror_error_t **error );
+
 int deflate_compress(
      const uint8_t *uncompressed_data,
      size_t uncompressed_data_size,
@@ -150,6 +422,23 @@ int deflate_compress(
      size_t *compressed_data_size,
      libcerror_error_t **error );
 
+int deflate_decoder_initialize(
+     deflate_decoder_t **decoder,
+     libcerror_error_t **error );
+
+int deflate_decoder_free(
+     deflate_decoder_t **decoder,
+     libcerror_error_t **error );
+
+int deflate_decoder_decompress(
+     deflate_decoder_t *decoder,
+     const uint8_t *compressed_data,
+     size_t compressed_data_size,
+     uint8_t *uncompressed_data,
+     size_t *uncompressed_data_size,
+     uint8_t flags,
+     libcerror_error_t **error );
+
 int deflate_decompress(
      const uint8_t *compressed_data,
      size_t compressed_data_size,
@@ -157,6 +446,37 @@ int deflate_decompress(
      size_t *uncompressed_data_size,
      libcerror_error_t **error );
 
+int deflate_decompress_with_flags(
+     const uint8_t *compressed_data,
+     size_t compressed_data_size,
+     uint8_t *uncompressed_data,
+     size_t *uncompressed_data_size,
+     uint8_t flags,
+     libcerror_error_t **error );
+
+int deflate_decompress_allocate(
+     const uint8_t *compressed_data,
+     size_t compressed_data_size,
+     uint8_t **uncompressed_data,
+     size_t *uncompressed_data_size,
+     uint8_t flags,
+     libcerror_error_t **error );
+
+#if defined( HAVE_DEFLATE_STATISTICS )
+
+void deflate_statistics_reset(
+      void );
+
+int deflate_statistics_get(
+     deflate_statistics_t *statistics,
+     libcerror_error_t **error );
+
+int deflate_statistics_fprint(
+     FILE *stream,
+     libcerror_error_t **error );
+
+#endif /* defined( HAVE_DEFLATE_STATISTICS ) */
+
 #if defined( __cplusplus )
 }
 #endif
@@ -0,0 +1,912 @@
+/*
+ * Deflate (zlib) stream carving functions
+ *
+ * Copyright (C) 2008-2019, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This software is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This software is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this software.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <byte_stream.h>
+#include <memory.h>
+#include <types.h>
+
+#include "assorted_libcerror.h"
+#include "cpu_features.h"
+#include "deflate.h"
+#include "deflate_carve.h"
+#include "deflate_stream.h"
+
+#if defined( HAVE_CPU_FEATURES_X86 )
+#include <immintrin.h>
+#endif
+
+/* The multiplicative inverse of 31 modulo 2^16, a 16-bit value is divisible by 31
+ * if its product with the inverse modulo 2^16 does not exceed 0xffff / 31
+ */
+#define DEFLATE_CARVE_INVERSE_OF_31		0x7bdf
+#define DEFLATE_CARVE_MAXIMUM_QUOTIENT_OF_31	( 0xffff / 31 )
+
+/* The code space of a pair of 3-bit code sizes of the code sizes table,
+ * where a code size of 0 uses no code space and a code size of N uses 2^(7 - N)
+ */
+static const uint8_t deflate_carve_code_space_pairs[ 64 ] = {
+	  0,  64,  32,  16,   8,   4,   2,   1,
+	 64, 128,  96,  80,  72,  68,  66,  65,
+	 32,  96,  64,  48,  40,  36,  34,  33,
+	 16,  80,  48,  32,  24,  20,  18,  17,
+	  8,  72,  40,  24,  16,  12,  10,   9,
+	  4,  68,  36,  20,  12,   8,   6,   5,
+	  2,  66,  34,  18,  10,   6,   4,   3,
+	  1,  65,  33,  17,   9,   5,   3,   2 };
+
+/* Creates a scanner
+ * Make sure the value scanner is referencing, is set to NULL
+ * Returns 1 if successful or -1 on error
+ */
+int deflate_carve_scanner_initialize(
+     deflate_carve_scanner_t **scanner,
+     libcerror_error_t **error )
+{
+	static char *function = "deflate_carve_scanner_initialize";
+
+	if( scanner == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid scanner.",
+		 function );
+
+		return( -1 );
+	}
+	if( *scanner != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid scanner value already set.",
+		 function );
+
+		return( -1 );
+	}
+	*scanner = memory_allocate_structure(
+	            deflate_carve_scanner_t );
+
+	if( *scanner == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create scanner.",
+		 function );
+
+		goto on_error;
+	}
+	( *scanner )->stream = NULL;
+
+	if( deflate_stream_initialize(
+	     &( ( *scanner )->stream ),
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create stream.",
+		 function );
+
+		goto on_error;
+	}
+	return( 1 );
+
+on_error:
+	if( *scanner != NULL )
+	{
+		memory_free(
+		 *scanner );
+
+		*scanner = NULL;
+	}
+	return( -1 );
+}
+
+/* Frees a scanner
+ * Returns 1 if successful or -1 on error
+ */
+int deflate_carve_scanner_free(
+     deflate_carve_scanner_t **scanner,
+     libcerror_error_t **error )
+{
+	static char *function = "deflate_carve_scanner_free";
+	int result            = 1;
+
+	if( scanner == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid scanner.",
+		 function );
+
+		return( -1 );
+	}
+	if( *scanner != NULL )
+	{
+		if( deflate_stream_free(
+		     &( ( *scanner )->stream ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free stream.",
+			 function );
+
+			result = -1;
+		}
+		memory_free(
+		 *scanner );
+
+		*scanner = NULL;
+	}
+	return( result );
+}
+
+/* Checks if data starts with a plausible deflate block header
+ * Returns 1 if the block header is plausible or 0 if not
+ */
+static int deflate_carve_check_block_header_data(
+            const uint8_t *data,
+            size_t data_size,
+            uint8_t *block_type )
+{
+	uint64_t value_64bit             = 0;
+	uint32_t code_space              = 0;
+	uint16_t block_size              = 0;
+	uint16_t block_size_copy         = 0;
+	uint8_t number_of_code_sizes     = 0;
+	uint8_t number_of_distance_codes = 0;
+	uint8_t number_of_literal_codes  = 0;
+
+	if( data_size < 1 )
+	{
+		return( 0 );
+	}
+	*block_type = ( data[ 0 ] >> 1 ) & 0x03;
+
+	switch( *block_type )
+	{
+		case DEFLATE_BLOCK_TYPE_UNCOMPRESSED:
+			if( ( data_size < 5 )
+			 || ( ( data[ 0 ] & 0xf8 ) != 0 ) )
+			{
+				return( 0 );
+			}
+			byte_stream_copy_to_uint16_little_endian(
+			 &( data[ 1 ] ),
+			 block_size );
+
+			byte_stream_copy_to_uint16_little_endian(
+			 &( data[ 3 ] ),
+			 block_size_copy );
+
+			if( block_size != (uint16_t) ~block_size_copy )
+			{
+				return( 0 );
+			}
+			break;
+
+		case DEFLATE_BLOCK_TYPE_HUFFMAN_FIXED:
+			break;
+
+		case DEFLATE_BLOCK_TYPE_HUFFMAN_DYNAMIC:
+			if( data_size < DEFLATE_CARVE_BLOCK_HEADER_CHECK_SIZE )
+			{
+				return( 0 );
+			}
+			number_of_literal_codes  = data[ 0 ] >> 3;
+			number_of_distance_codes = data[ 1 ] & 0x1f;
+			number_of_code_sizes     = ( ( data[ 1 ] >> 5 ) | ( ( data[ 2 ] & 0x01 ) << 3 ) ) + 4;
+
+			if( ( number_of_literal_codes > 29 )
+			 || ( number_of_distance_codes > 29 ) )
+			{
+				return( 0 );
+			}
+			/* The code sizes of the code sizes table are stored as 3-bit values
+			 * from bit 17, a complete set of code sizes fills the code space
+			 * of 2^7
+			 */
+			byte_stream_copy_to_uint64_little_endian(
+			 &( data[ 2 ] ),
+			 value_64bit );
+
+			value_64bit >>= 1;
+			value_64bit  &= ( (uint64_t) 1 << ( number_of_code_sizes * 3 ) ) - 1;
+
+			while( value_64bit != 0 )
+			{
+				code_space  += deflate_carve_code_space_pairs[ value_64bit & 0x3f ];
+				value_64bit >>= 6;
+			}
+			if( code_space != 128 )
+			{
+				return( 0 );
+			}
+			break;
+
+		case DEFLATE_BLOCK_TYPE_RESERVED:
+		default:
+			return( 0 );
+	}
+	return( 1 );
+}
+
+#if defined( HAVE_CPU_FEATURES_X86 )
+
+/* Finds the next zlib header candidate in blocks of 16 offsets using SSE2
+ * The CMF and FLG bytes of the 8 even and 8 odd offsets are checked as
+ * 16-bit big-endian values
+ * Returns the offset of the block that contains the candidate or where the search stopped
+ */
+CPU_FEATURES_TARGET( "sse2" )
+static size_t deflate_carve_find_zlib_header_sse2(
+               const uint8_t *data,
+               size_t data_size,
+               size_t data_offset )
+{
+	__m128i check_bits;
+	__m128i check_value;
+	__m128i even_values;
+	__m128i inverse;
+	__m128i maximum_quotient;
+	__m128i odd_values;
+	__m128i zero;
+
+	unsigned int even_mask = 0;
+	unsigned int odd_mask  = 0;
+
+	check_bits       = _mm_set1_epi16(
+	                    (short) 0x8f20 );
+	check_value      = _mm_set1_epi16(
+	                    (short) 0x0800 );
+	inverse          = _mm_set1_epi16(
+	                    (short) DEFLATE_CARVE_INVERSE_OF_31 );
+	maximum_quotient = _mm_set1_epi16(
+	                    (short) DEFLATE_CARVE_MAXIMUM_QUOTIENT_OF_31 );
+	zero             = _mm_setzero_si128();
+
+	while( ( data_size - data_offset ) >= 17 )
+	{
+		even_values = _mm_loadu_si128(
+		               (const __m128i *) &( data[ data_offset ] ) );
+		odd_values  = _mm_loadu_si128(
+		               (const __m128i *) &( data[ data_offset + 1 ] ) );
+
+		even_values = _mm_or_si128(
+		               _mm_slli_epi16(
+		                even_values,
+		                8 ),
+		               _mm_srli_epi16(
+		                even_values,
+		                8 ) );
+		odd_values  = _mm_or_si128(
+		               _mm_slli_epi16(
+		                odd_values,
+		                8 ),
+		               _mm_srli_epi16(
+		                odd_values,
+		                8 ) );
+
+		/* The compression method must be 8, the window size at most 32 KiB,
+		 * the preset dictionary flag not set and the value a multiple of 31
+		 */
+		even_mask = (unsigned int) _mm_movemask_epi8(
+		                            _mm_and_si128(
+		                             _mm_cmpeq_epi16(
+		                              _mm_and_si128(
+		                               even_values,
+		                               check_bits ),
+		                              check_value ),
+		                             _mm_cmpeq_epi16(
+		                              _mm_subs_epu16(
+		                               _mm_mullo_epi16(
+		                                even_values,
+		                                inverse ),
+		                               maximum_quotient ),
+		                              zero ) ) );
+		odd_mask  = (unsigned int) _mm_movemask_epi8(
+		                            _mm_and_si128(
+		                             _mm_cmpeq_epi16(
+		                              _mm_and_si128(
+		                               odd_values,
+		                               check_bits ),
+		                              check_value ),
+		                             _mm_cmpeq_epi16(
+		                              _mm_subs_epu16(
+		                               _mm_mullo_epi16(
+		                                odd_values,
+		                                inverse ),
+		                               maximum_quotient ),
+		                              zero ) ) );
+
+		if( ( even_mask | odd_mask ) != 0 )
+		{
+			break;
+		}
+		data_offset += 16;
+	}
+	return( data_offset );
+}
+
+/* Finds the next raw block header candidate in blocks of 16 offsets using SSE2
+ * On return candidates_mask contains a bit per offset of the block that must be checked
+ * Returns the offset of the block that contains the candidate or where the search stopped
+ */
+CPU_FEATURES_TARGET( "sse2" )
+static size_t deflate_carve_find_raw_block_header_sse2(
+               const uint8_t *data,
+               size_t data_size,
+               size_t data_offset,
+               uint16_t *candidates_mask )
+{
+	__m128i all_bits;
+	__m128i distances_bits;
+	__m128i dynamic_mask;
+	__m128i stored_mask;
+	__m128i values0;
+	__m128i values1;
+	__m128i values2;
+	__m128i values3;
+	__m128i values4;
+
+	all_bits = _mm_set1_epi8(
+	            (char) 0xff );
+
+	while( ( data_size - data_offset ) >= 20 )
+	{
+		values0 = _mm_loadu_si128(
+		           (const __m128i *) &( data[ data_offset ] ) );
+		values1 = _mm_loadu_si128(
+		           (const __m128i *) &( data[ data_offset + 1 ] ) );
+		values2 = _mm_loadu_si128(
+		           (const __m128i *) &( data[ data_offset + 2 ] ) );
+		values3 = _mm_loadu_si128(
+		           (const __m128i *) &( data[ data_offset + 3 ] ) );
+		values4 = _mm_loadu_si128(
+		           (const __m128i *) &( data[ data_offset + 4 ] ) );
+
+		/* An uncompressed block with padding bits of 0 followed by
+		 * a block size and its one's complement
+		 */
+		stored_mask = _mm_and_si128(
+		               _mm_cmpeq_epi8(
+		                _mm_min_epu8(
+		                 values0,
+		                 _mm_set1_epi8(
+		                  0x01 ) ),
+		                values0 ),
+		               _mm_and_si128(
+		                _mm_cmpeq_epi8(
+		                 _mm_xor_si128(
+		                  values1,
+		                  values3 ),
+		                 all_bits ),
+		                _mm_cmpeq_epi8(
+		                 _mm_xor_si128(
+		                  values2,
+		                  values4 ),
+		                 all_bits ) ) );
+
+		/* A dynamic Huffman block with at most 286 literal and length codes
+		 * and at most 30 distance codes
+		 */
+		distances_bits = _mm_and_si128(
+		                  values1,
+		                  _mm_set1_epi8(
+		                   0x1f ) );
+
+		dynamic_mask = _mm_and_si128(
+		                _mm_cmpeq_epi8(
+		                 _mm_and_si128(
+		                  values0,
+		                  _mm_set1_epi8(
+		                   0x06 ) ),
+		                 _mm_set1_epi8(
+		                  0x04 ) ),
+		                _mm_and_si128(
+		                 _mm_cmpeq_epi8(
+		                  _mm_min_epu8(
+		                   values0,
+		                   _mm_set1_epi8(
+		                    (char) 0xef ) ),
+		                  values0 ),
+		                 _mm_cmpeq_epi8(
+		                  _mm_min_epu8(
+		                   distances_bits,
+		                   _mm_set1_epi8(
+		                    29 ) ),
+		                  distances_bits ) ) );
+
+		*candidates_mask = (uint16_t) _mm_movemask_epi8(
+		                                _mm_or_si128(
+		                                 stored_mask,
+		                                 dynamic_mask ) );
+
+		if( *candidates_mask != 0 )
+		{
+			return( data_offset );
+		}
+		data_offset += 16;
+	}
+	/* The remaining offsets are checked without SSE2
+	 */
+	*candidates_mask = 0xffff;
+
+	return( data_offset );
+}
+
+#endif /* defined( HAVE_CPU_FEATURES_X86 ) */
+
+/* Finds the next zlib header candidate
+ * A candidate has compression method 8, a window size of at most 32 KiB,
+ * no preset dictionary and valid check bits
+ * On return data_offset contains the offset of the candidate or,
+ * if no candidate was found, the first offset that was not checked
+ * Returns 1 if a candidate was found, 0 if not or -1 on error
+ */
+int deflate_carve_find_zlib_header(
+     const uint8_t *data,
+     size_t data_size,
+     size_t *data_offset,
+     libcerror_error_t **error )
+{
+	static char *function = "deflate_carve_find_zlib_header";
+	size_t search_offset  = 0;
+	uint16_t value_16bit  = 0;
+
+	if( data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid data.",
+		 function );
+
+		return( -1 );
+	}
+	if( data_size > (size_t) SSIZE_MAX )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid data size value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	if( data_offset == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid data offset.",
+		 function );
+
+		return( -1 );
+	}
+	search_offset = *data_offset;
+
+	if( ( data_size < 2 )
+	 || ( search_offset >= ( data_size - 1 ) ) )
+	{
+		return( 0 );
+	}
+#if defined( HAVE_CPU_FEATURES_X86 )
+	if( cpu_features_has(
+	     CPU_FEATURE_FLAG_SSE2 ) != 0 )
+	{
+		search_offset = deflate_carve_find_zlib_header_sse2(
+		                 data,
+		                 data_size,
+		                 search_offset );
+	}
+#endif
+	while( search_offset < ( data_size - 1 ) )
+	{
+		value_16bit = ( (uint16_t) data[ search_offset ] << 8 )
+		            | data[ search_offset + 1 ];
+
+		if( ( ( value_16bit & 0x8f20 ) == 0x0800 )
+		 && ( ( value_16bit % 31 ) == 0 ) )
+		{
+			*data_offset = search_offset;
+
+			return( 1 );
+		}
+		search_offset++;
+	}
+	*data_offset = search_offset;
+
+	return( 0 );
+}
+
+/* Finds the next raw deflate block header candidate
+ * A candidate is an uncompressed block or a dynamic Huffman block of which
+ * the block header is plausible, see deflate_carve_check_block_header
+ * Blocks that use the fixed Huffman codes are not considered since almost
+ * any data can be decoded as such a block
+ * On return data_offset contains the offset of the candidate or,
+ * if no candidate was found, the first offset that was not checked
+ * Returns 1 if a candidate was found, 0 if not or -1 on error
+ */
+int deflate_carve_find_raw_block_header(
+     const uint8_t *data,
+     size_t data_size,
+     size_t *data_offset,
+     libcerror_error_t **error )
+{
+	static char *function    = "deflate_carve_find_raw_block_header";
+	size_t check_offset      = 0;
+	size_t search_offset     = 0;
+	uint16_t candidates_mask = 0;
+	uint8_t block_type       = 0;
+
+#if defined( HAVE_CPU_FEATURES_X86 )
+	int use_sse2             = 0;
+#endif
+
+	if( data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid data.",
+		 function );
+
+		return( -1 );
+	}
+	if( data_size > (size_t) SSIZE_MAX )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid data size value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	if( data_offset == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid data offset.",
+		 function );
+
+		return( -1 );
+	}
+	search_offset = *data_offset;
+
+	/* The uncompressed block header is 5 bytes of size
+	 */
+	if( ( data_size < 5 )
+	 || ( search_offset >= ( data_size - 4 ) ) )
+	{
+		return( 0 );
+	}
+#if defined( HAVE_CPU_FEATURES_X86 )
+	use_sse2 = cpu_features_has(
+	            CPU_FEATURE_FLAG_SSE2 );
+#endif
+	while( search_offset < ( data_size - 4 ) )
+	{
+		candidates_mask = 0xffff;
+
+#if defined( HAVE_CPU_FEATURES_X86 )
+		/* Only the offsets of the block of 16 offsets that passed the SSE2 checks
+		 * are checked after which the search continues using SSE2
+		 */
+		if( use_sse2 != 0 )
+		{
+			search_offset = deflate_carve_find_raw_block_header_sse2(
+			                 data,
+			                 data_size,
+			                 search_offset,
+			                 &candidates_mask );
+		}
+#endif
+		check_offset = data_size - 4;
+
+		if( ( check_offset - search_offset ) > 16 )
+		{
+			check_offset = search_offset + 16;
+		}
+		while( search_offset < check_offset )
+		{
+			if( ( ( candidates_mask & 0x0001 ) != 0 )
+			 && ( deflate_carve_check_block_header_data(
+			       &( data[ search_offset ] ),
+			       data_size - search_offset,
+			       &block_type ) != 0 )
+			 && ( block_type != DEFLATE_BLOCK_TYPE_HUFFMAN_FIXED ) )
+			{
+				*data_offset = search_offset;
+
+				return( 1 );
+			}
+			candidates_mask >>= 1;
+
+			search_offset++;
+		}
+	}
+	*data_offset = search_offset;
+
+	return( 0 );
+}
+
+/* Checks if data starts with a plausible deflate block header
+ * An uncompressed block must have padding bits of 0 and a block size that
+ * matches its copy, a dynamic Huffman block must have a valid number of codes
+ * and a complete set of code sizes for the code sizes table, which is
+ * required to construct the dynamic Huffman tables
+ * Returns 1 if the block header is plausible, 0 if not or -1 on error
+ */
+int deflate_carve_check_block_header(
+     const uint8_t *data,
+     size_t data_size,
+     uint8_t *block_type,
+     libcerror_error_t **error )
+{
+	static char *function = "deflate_carve_check_block_header";
+
+	if( data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid data.",
+		 function );
+
+		return( -1 );
+	}
+	if( data_size > (size_t) SSIZE_MAX )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid data size value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	if( block_type == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid block type.",
+		 function );
+
+		return( -1 );
+	}
+	return( deflate_carve_check_block_header_data(
+	         data,
+	         data_size,
+	         block_type ) );
+}
+
+/* Validates a candidate stream by decoding it
+ * The uncompressed data is discarded, a zlib stream is valid if it decodes without
+ * error and its Adler-32 matches, a raw stream if it decodes without error
+ * Set DEFLATE_CARVE_FLAG_END_OF_INPUT in flags if the data contains the remainder of the input
+ * On return compressed_data_size contains the size of the stream including
+ * the zlib header and Adler-32 and uncompressed_data_size the size of its uncompressed data
+ * Returns 1 if the data contains a valid stream, 0 if more data is required
+ * or -1 if the data does not contain a valid stream or on error
+ */
+int deflate_carve_scanner_validate_stream(
+     deflate_carve_scanner_t *scanner,
+     const uint8_t *data,
+     size_t data_size,
+     int stream_type,
+     uint8_t flags,
+     size_t *compressed_data_size,
+     size64_t *uncompressed_data_size,
+     libcerror_error_t **error )
+{
+	static char *function           = "deflate_carve_scanner_validate_stream";
+	size64_t safe_uncompressed_size = 0;
+	size_t data_offset              = 0;
+	size_t read_size                = 0;
+	size_t stream_compressed_size   = 0;
+	size_t stream_uncompressed_size = 0;
+	uint8_t stream_flags            = 0;
+	int result                      = 0;
+
+	if( scanner == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid scanner.",
+		 function );
+
+		return( -1 );
+	}
+	if( data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid data.",
+		 function );
+
+		return( -1 );
+	}
+	if( data_size > (size_t) SSIZE_MAX )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid data size value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( stream_type != DEFLATE_CARVE_STREAM_TYPE_ZLIB )
+	 && ( stream_type != DEFLATE_CARVE_STREAM_TYPE_RAW ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_UNSUPPORTED_VALUE,
+		 "%s: unsupported stream type: %d.",
+		 function,
+		 stream_type );
+
+		return( -1 );
+	}
+	if( ( flags & ~( DEFLATE_CARVE_FLAG_END_OF_INPUT ) ) != 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_UNSUPPORTED_VALUE,
+		 "%s: unsupported flags: 0x%02" PRIx8 ".",
+		 function,
+		 flags );
+
+		return( -1 );
+	}
+	if( compressed_data_size == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid compressed data size.",
+		 function );
+
+		return( -1 );
+	}
+	if( uncompressed_data_size == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid uncompressed data size.",
+		 function );
+
+		return( -1 );
+	}
+	if( deflate_stream_reset(
+	     scanner->stream,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to reset stream.",
+		 function );
+
+		return( -1 );
+	}
+	if( stream_type == DEFLATE_CARVE_STREAM_TYPE_RAW )
+	{
+		stream_flags = DEFLATE_STREAM_FLAG_RAW;
+	}
+	/* Most candidates are rejected by the first call, hence only
+	 * a small part of the data is copied into the stream initially
+	 */
+	read_size = DEFLATE_CARVE_INITIAL_READ_SIZE;
+
+	while( result == 0 )
+	{
+		stream_compressed_size = data_size - data_offset;
+
+		if( stream_compressed_size > read_size )
+		{
+			stream_compressed_size = read_size;
+		}
+		else if( ( flags & DEFLATE_CARVE_FLAG_END_OF_INPUT ) != 0 )
+		{
+			stream_flags |= DEFLATE_STREAM_FLAG_END_OF_INPUT;
+		}
+		stream_uncompressed_size = DEFLATE_CARVE_UNCOMPRESSED_DATA_SIZE;
+
+		result = deflate_stream_decompress(
+		          scanner->stream,
+		          &( data[ data_offset ] ),
+		          &stream_compressed_size,
+		          scanner->uncompressed_data,
+		          &stream_uncompressed_size,
+		          stream_flags,
+		          error );
+
+		if( result == -1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_COMPRESSION,
+			 LIBCERROR_COMPRESSION_ERROR_DECOMPRESS_FAILED,
+			 "%s: unable to decompress data.",
+			 function );
+
+			return( -1 );
+		}
+		data_offset            += stream_compressed_size;
+		safe_uncompressed_size += stream_uncompressed_size;
+
+		/* The stream cannot continue without more data
+		 */
+		if( ( result == 0 )
+		 && ( stream_compressed_size == 0 )
+		 && ( stream_uncompressed_size == 0 ) )
+		{
+			return( 0 );
+		}
+		read_size = DEFLATE_STREAM_INPUT_BUFFER_SIZE;
+	}
+	/* The input buffer of the stream contains the data after the end of the stream
+	 */
+	*compressed_data_size   = data_offset
+	                        - ( scanner->stream->bit_stream.byte_stream_size - scanner->stream->bit_stream.byte_stream_offset );
+	*uncompressed_data_size = safe_uncompressed_size;
+
+	return( 1 );
+}
+
@@ -0,0 +1,121 @@
+/*
+ * Deflate (zlib) stream carving functions
+ *
+ * Copyright (C) 2008-2019, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This software is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This software is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this software.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#if !defined( _DEFLATE_CARVE_H )
+#define _DEFLATE_CARVE_H
+
+#include <common.h>
+#include <types.h>
+
+#include "assorted_libcerror.h"
+#include "deflate_stream.h"
+
+#if defined( __cplusplus )
+extern "C" {
+#endif
+
+/* The size of the compressed data passed to the stream by the first call
+ * which can contain the zlib header and the dynamic Huffman tables of the first block
+ * so that most invalid candidates are rejected without copying more data
+ */
+#define DEFLATE_CARVE_INITIAL_READ_SIZE		1024
+
+/* The size of the uncompressed data buffer of the scanner
+ */
+#define DEFLATE_CARVE_UNCOMPRESSED_DATA_SIZE	( 64 * 1024 )
+
+/* The number of bytes of a block header needed to check a candidate
+ * which is the header and code sizes of the code sizes table of a dynamic Huffman block
+ */
+#define DEFLATE_CARVE_BLOCK_HEADER_CHECK_SIZE	10
+
+/* The stream types
+ */
+enum DEFLATE_CARVE_STREAM_TYPES
+{
+	DEFLATE_CARVE_STREAM_TYPE_ZLIB		= 1,
+	DEFLATE_CARVE_STREAM_TYPE_RAW		= 2
+};
+
+/* The flags
+ */
+enum DEFLATE_CARVE_FLAGS
+{
+	/* The data contains the remainder of the input
+	 */
+	DEFLATE_CARVE_FLAG_END_OF_INPUT		= 0x01
+};
+
+typedef struct deflate_carve_scanner deflate_carve_scanner_t;
+
+struct deflate_carve_scanner
+{
+	/* The stream used to trial decode candidates
+	 */
+	deflate_stream_t *stream;
+
+	/* The uncompressed data buffer, the uncompressed data of a candidate is discarded
+	 */
+	uint8_t uncompressed_data[ DEFLATE_CARVE_UNCOMPRESSED_DATA_SIZE ];
+};
+
+int deflate_carve_scanner_initialize(
+     deflate_carve_scanner_t **scanner,
+     libcerror_error_t **error );
+
+int deflate_carve_scanner_free(
+     deflate_carve_scanner_t **scanner,
+     libcerror_error_t **error );
+
+int deflate_carve_find_zlib_header(
+     const uint8_t *data,
+     size_t data_size,
+     size_t *data_offset,
+     libcerror_error_t **error );
+
+int deflate_carve_find_raw_block_header(
+     const uint8_t *data,
+     size_t data_size,
+     size_t *data_offset,
+     libcerror_error_t **error );
+
+int deflate_carve_check_block_header(
+     const uint8_t *data,
+     size_t data_size,
+     uint8_t *block_type,
+     libcerror_error_t **error );
+
+int deflate_carve_scanner_validate_stream(
+     deflate_carve_scanner_t *scanner,
+     const uint8_t *data,
+     size_t data_size,
+     int stream_type,
+     uint8_t flags,
+     size_t *compressed_data_size,
+     size64_t *uncompressed_data_size,
+     libcerror_error_t **error );
+
+#if defined( __cplusplus )
+}
+#endif
+
+#endif /* !defined( _DEFLATE_CARVE_H ) */
+
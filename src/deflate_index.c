@@ -0,0 +1,1058 @@
+/*
+ * Deflate (zlib) random-access index functions
+ *
+ * Copyright (C) 2008-2019, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This software is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This software is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this software.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <byte_stream.h>
+#include <memory.h>
+#include <types.h>
+
+#include "assorted_libcerror.h"
+#include "deflate_index.h"
+#include "deflate_stream.h"
+
+/* The initial number of access points of the access points array
+ */
+#define DEFLATE_INDEX_INITIAL_NUMBER_OF_ACCESS_POINTS	16
+
+/* The maximum size of the access points array
+ * which also bounds the number of access points of index data that is read
+ */
+#define DEFLATE_INDEX_MAXIMUM_ACCESS_POINTS_SIZE	( 1024 * 1024 * 1024 )
+
+/* The maximum number of access points
+ */
+#define DEFLATE_INDEX_MAXIMUM_NUMBER_OF_ACCESS_POINTS	( DEFLATE_INDEX_MAXIMUM_ACCESS_POINTS_SIZE / sizeof( deflate_index_access_point_t ) )
+
+/* Creates an index
+ * The interval is the minimum distance between access points in the uncompressed data
+ * Returns 1 if successful or -1 on error
+ */
+int deflate_index_initialize(
+     deflate_index_t **index,
+     uint64_t interval,
+     libcerror_error_t **error )
+{
+	static char *function = "deflate_index_initialize";
+
+	if( index == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid index.",
+		 function );
+
+		return( -1 );
+	}
+	if( *index != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid index value already set.",
+		 function );
+
+		return( -1 );
+	}
+	if( interval == 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_ZERO_OR_LESS,
+		 "%s: invalid interval value zero or less.",
+		 function );
+
+		return( -1 );
+	}
+	*index = memory_allocate_structure(
+	          deflate_index_t );
+
+	if( *index == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create index.",
+		 function );
+
+		return( -1 );
+	}
+	( *index )->interval                        = interval;
+	( *index )->uncompressed_data_size          = 0;
+	( *index )->access_points                   = NULL;
+	( *index )->number_of_access_points         = 0;
+	( *index )->maximum_number_of_access_points = 0;
+
+	return( 1 );
+}
+
+/* Frees an index
+ * Returns 1 if successful or -1 on error
+ */
+int deflate_index_free(
+     deflate_index_t **index,
+     libcerror_error_t **error )
+{
+	static char *function = "deflate_index_free";
+
+	if( index == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid index.",
+		 function );
+
+		return( -1 );
+	}
+	if( *index != NULL )
+	{
+		if( ( *index )->access_points != NULL )
+		{
+			memory_free(
+			 ( *index )->access_points );
+		}
+		memory_free(
+		 *index );
+
+		*index = NULL;
+	}
+	return( 1 );
+}
+
+/* Resizes the access points array so that it can contain at least the number of access points
+ * Returns 1 if successful or -1 on error
+ */
+static int deflate_index_resize_access_points(
+            deflate_index_t *index,
+            uint32_t number_of_access_points,
+            libcerror_error_t **error )
+{
+	deflate_index_access_point_t *reallocation = NULL;
+	static char *function                      = "deflate_index_resize_access_points";
+	uint32_t maximum_number_of_access_points   = 0;
+
+	if( number_of_access_points <= index->maximum_number_of_access_points )
+	{
+		return( 1 );
+	}
+	if( (size_t) number_of_access_points > DEFLATE_INDEX_MAXIMUM_NUMBER_OF_ACCESS_POINTS )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid number of access points value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	/* The array is doubled in size so that appending an access point is amortized constant time
+	 */
+	maximum_number_of_access_points = index->maximum_number_of_access_points;
+
+	if( maximum_number_of_access_points < DEFLATE_INDEX_INITIAL_NUMBER_OF_ACCESS_POINTS )
+	{
+		maximum_number_of_access_points = DEFLATE_INDEX_INITIAL_NUMBER_OF_ACCESS_POINTS;
+	}
+	while( maximum_number_of_access_points < number_of_access_points )
+	{
+		if( maximum_number_of_access_points > 0x7fffffffUL )
+		{
+			break;
+		}
+		maximum_number_of_access_points *= 2;
+	}
+	if( ( maximum_number_of_access_points < number_of_access_points )
+	 || ( (size_t) maximum_number_of_access_points > DEFLATE_INDEX_MAXIMUM_NUMBER_OF_ACCESS_POINTS ) )
+	{
+		maximum_number_of_access_points = number_of_access_points;
+	}
+	reallocation = (deflate_index_access_point_t *) memory_reallocate(
+	                                                 index->access_points,
+	                                                 sizeof( deflate_index_access_point_t ) * maximum_number_of_access_points );
+
+	if( reallocation == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to resize access points.",
+		 function );
+
+		return( -1 );
+	}
+	index->access_points                   = reallocation;
+	index->maximum_number_of_access_points = maximum_number_of_access_points;
+
+	return( 1 );
+}
+
+/* Appends the access point of a stream that is at the start of a block
+ * if it is at least the interval beyond the previous access point
+ * Returns 1 if successful or -1 on error
+ */
+static int deflate_index_append_access_point(
+            deflate_index_t *index,
+            deflate_stream_t *stream,
+            libcerror_error_t **error )
+{
+	deflate_index_access_point_t *access_point = NULL;
+	static char *function                      = "deflate_index_append_access_point";
+	size_t window_size                         = 0;
+	int result                                 = 0;
+
+	if( index->number_of_access_points > 0 )
+	{
+		access_point = &( index->access_points[ index->number_of_access_points - 1 ] );
+
+		if( ( stream->uncompressed_data_offset - access_point->uncompressed_offset ) < index->interval )
+		{
+			return( 1 );
+		}
+	}
+	if( deflate_index_resize_access_points(
+	     index,
+	     index->number_of_access_points + 1,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_RESIZE_FAILED,
+		 "%s: unable to resize access points.",
+		 function );
+
+		return( -1 );
+	}
+	access_point = &( index->access_points[ index->number_of_access_points ] );
+
+	result = deflate_stream_get_access_point(
+	          stream,
+	          &( access_point->compressed_bit_offset ),
+	          &( access_point->uncompressed_offset ),
+	          access_point->window,
+	          DEFLATE_STREAM_WINDOW_SIZE,
+	          &window_size,
+	          error );
+
+	if( result == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve access point.",
+		 function );
+
+		return( -1 );
+	}
+	else if( result != 0 )
+	{
+		access_point->window_size = (uint32_t) window_size;
+
+		index->number_of_access_points += 1;
+	}
+	return( 1 );
+}
+
+/* Decompresses zlib compressed data in chunks and adds access points to the index
+ * The arguments and return value are the same as of deflate_stream_decompress
+ * An access point is added at the start of the first block and at the start of every
+ * block that is at least the interval beyond the previous access point
+ * Returns 1 if the end of the stream was reached, 0 if more input data or uncompressed data space is required or -1 on error
+ */
+int deflate_index_decompress(
+     deflate_index_t *index,
+     deflate_stream_t *stream,
+     const uint8_t *compressed_data,
+     size_t *compressed_data_size,
+     uint8_t *uncompressed_data,
+     size_t *uncompressed_data_size,
+     uint8_t flags,
+     libcerror_error_t **error )
+{
+	static char *function           = "deflate_index_decompress";
+	size_t compressed_data_offset   = 0;
+	size_t read_size                = 0;
+	size_t uncompressed_data_offset = 0;
+	size_t write_size               = 0;
+	int result                      = 0;
+
+	if( index == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid index.",
+		 function );
+
+		return( -1 );
+	}
+	if( stream == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid stream.",
+		 function );
+
+		return( -1 );
+	}
+	if( compressed_data_size == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid compressed data size.",
+		 function );
+
+		return( -1 );
+	}
+	if( uncompressed_data_size == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid uncompressed data size.",
+		 function );
+
+		return( -1 );
+	}
+	/* The stream returns at the start of every block, after which decompression is resumed
+	 * with the remainder of the compressed data and uncompressed data space
+	 */
+	do
+	{
+		read_size  = *compressed_data_size - compressed_data_offset;
+		write_size = *uncompressed_data_size - uncompressed_data_offset;
+
+		result = deflate_stream_decompress(
+		          stream,
+		          ( compressed_data != NULL ) ? &( compressed_data[ compressed_data_offset ] ) : NULL,
+		          &read_size,
+		          &( uncompressed_data[ uncompressed_data_offset ] ),
+		          &write_size,
+		          flags | DEFLATE_STREAM_FLAG_STOP_AT_BLOCK,
+		          error );
+
+		if( result == -1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_COMPRESSION,
+			 LIBCERROR_COMPRESSION_ERROR_DECOMPRESS_FAILED,
+			 "%s: unable to decompress data.",
+			 function );
+
+			return( -1 );
+		}
+		compressed_data_offset   += read_size;
+		uncompressed_data_offset += write_size;
+
+		if( stream->stopped_at_block != 0 )
+		{
+			if( deflate_index_append_access_point(
+			     index,
+			     stream,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+				 "%s: unable to append access point.",
+				 function );
+
+				return( -1 );
+			}
+		}
+	}
+	while( stream->stopped_at_block != 0 );
+
+	if( result == 1 )
+	{
+		index->uncompressed_data_size = stream->uncompressed_data_offset;
+	}
+	*compressed_data_size   = compressed_data_offset;
+	*uncompressed_data_size = uncompressed_data_offset;
+
+	return( result );
+}
+
+/* Decompresses uncompressed data at a specific offset using the index
+ * The compressed data must contain the whole stream the index was built from
+ * Decompression starts at the last access point before the offset, the uncompressed
+ * data between the access point and the offset is decompressed into the uncompressed
+ * data buffer and discarded
+ * Returns the number of bytes decompressed or -1 on error
+ */
+ssize_t deflate_index_decompress_at_offset(
+         deflate_index_t *index,
+         deflate_stream_t *stream,
+         const uint8_t *compressed_data,
+         size_t compressed_data_size,
+         uint64_t uncompressed_offset,
+         uint8_t *uncompressed_data,
+         size_t uncompressed_data_size,
+         libcerror_error_t **error )
+{
+	deflate_index_access_point_t *access_point = NULL;
+	static char *function                      = "deflate_index_decompress_at_offset";
+	size_t buffer_offset                       = 0;
+	size_t compressed_data_offset              = 0;
+	size_t read_size                           = 0;
+	size_t uncompressed_data_offset            = 0;
+	size_t write_size                          = 0;
+	uint64_t skip_size                         = 0;
+	uint32_t access_point_index                = 0;
+	uint32_t first_index                       = 0;
+	uint32_t last_index                        = 0;
+	uint8_t first_byte                         = 0;
+	int result                                 = 0;
+
+	if( index == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid index.",
+		 function );
+
+		return( -1 );
+	}
+	if( index->number_of_access_points == 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid index - missing access points.",
+		 function );
+
+		return( -1 );
+	}
+	if( stream == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid stream.",
+		 function );
+
+		return( -1 );
+	}
+	if( compressed_data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid compressed data.",
+		 function );
+
+		return( -1 );
+	}
+	if( uncompressed_data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid uncompressed data.",
+		 function );
+
+		return( -1 );
+	}
+	if( uncompressed_data_size > (size_t) SSIZE_MAX )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid uncompressed data size value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( uncompressed_data_size == 0 )
+	 || ( ( index->uncompressed_data_size > 0 )
+	  &&  ( uncompressed_offset >= index->uncompressed_data_size ) ) )
+	{
+		return( 0 );
+	}
+	/* Find the last access point at or before the offset
+	 */
+	first_index = 0;
+	last_index  = index->number_of_access_points - 1;
+
+	while( first_index < last_index )
+	{
+		access_point_index = last_index - ( ( last_index - first_index ) / 2 );
+
+		if( index->access_points[ access_point_index ].uncompressed_offset <= uncompressed_offset )
+		{
+			first_index = access_point_index;
+		}
+		else
+		{
+			last_index = access_point_index - 1;
+		}
+	}
+	access_point = &( index->access_points[ first_index ] );
+
+	if( access_point->uncompressed_offset > uncompressed_offset )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid uncompressed offset value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	compressed_data_offset = (size_t) ( access_point->compressed_bit_offset >> 3 );
+
+	if( ( access_point->compressed_bit_offset >> 3 ) >= (uint64_t) compressed_data_size )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_TOO_SMALL,
+		 "%s: invalid compressed data size value too small.",
+		 function );
+
+		return( -1 );
+	}
+	/* The bits of the first byte that precede the block are discarded
+	 */
+	if( ( access_point->compressed_bit_offset & 0x07 ) != 0 )
+	{
+		first_byte              = compressed_data[ compressed_data_offset ];
+		compressed_data_offset += 1;
+	}
+	if( deflate_stream_set_access_point(
+	     stream,
+	     access_point->compressed_bit_offset,
+	     access_point->uncompressed_offset,
+	     first_byte,
+	     access_point->window,
+	     (size_t) access_point->window_size,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to set access point.",
+		 function );
+
+		return( -1 );
+	}
+	while( ( result == 0 )
+	    && ( uncompressed_data_offset < uncompressed_data_size ) )
+	{
+		/* The uncompressed data before the offset is decompressed at the start
+		 * of the uncompressed data buffer and discarded
+		 */
+		skip_size = 0;
+
+		if( stream->uncompressed_data_offset < uncompressed_offset )
+		{
+			skip_size = uncompressed_offset - stream->uncompressed_data_offset;
+		}
+		if( skip_size > 0 )
+		{
+			buffer_offset = 0;
+			write_size    = uncompressed_data_size;
+
+			if( (uint64_t) write_size > skip_size )
+			{
+				write_size = (size_t) skip_size;
+			}
+		}
+		else
+		{
+			buffer_offset = uncompressed_data_offset;
+			write_size    = uncompressed_data_size - uncompressed_data_offset;
+		}
+		read_size = compressed_data_size - compressed_data_offset;
+
+		result = deflate_stream_decompress(
+		          stream,
+		          &( compressed_data[ compressed_data_offset ] ),
+		          &read_size,
+		          &( uncompressed_data[ buffer_offset ] ),
+		          &write_size,
+		          DEFLATE_STREAM_FLAG_END_OF_INPUT | DEFLATE_STREAM_FLAG_RAW,
+		          error );
+
+		if( result == -1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_COMPRESSION,
+			 LIBCERROR_COMPRESSION_ERROR_DECOMPRESS_FAILED,
+			 "%s: unable to decompress data.",
+			 function );
+
+			return( -1 );
+		}
+		if( ( result == 0 )
+		 && ( read_size == 0 )
+		 && ( write_size == 0 ) )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_COMPRESSION,
+			 LIBCERROR_COMPRESSION_ERROR_DECOMPRESS_FAILED,
+			 "%s: unable to decompress data - no progress.",
+			 function );
+
+			return( -1 );
+		}
+		compressed_data_offset += read_size;
+
+		if( skip_size == 0 )
+		{
+			uncompressed_data_offset += write_size;
+		}
+	}
+	/* The offset is beyond the end of the stream
+	 */
+	if( stream->uncompressed_data_offset < uncompressed_offset )
+	{
+		return( 0 );
+	}
+	return( (ssize_t) uncompressed_data_offset );
+}
+
+/* Retrieves the size of the index data
+ * Returns 1 if successful or -1 on error
+ */
+int deflate_index_get_data_size(
+     deflate_index_t *index,
+     size_t *data_size,
+     libcerror_error_t **error )
+{
+	static char *function       = "deflate_index_get_data_size";
+	size_t safe_data_size       = 0;
+	uint32_t access_point_index = 0;
+
+	if( index == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid index.",
+		 function );
+
+		return( -1 );
+	}
+	if( data_size == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid data size.",
+		 function );
+
+		return( -1 );
+	}
+	safe_data_size = DEFLATE_INDEX_HEADER_SIZE;
+
+	for( access_point_index = 0;
+	     access_point_index < index->number_of_access_points;
+	     access_point_index++ )
+	{
+		safe_data_size += DEFLATE_INDEX_ACCESS_POINT_SIZE
+		                + index->access_points[ access_point_index ].window_size;
+	}
+	*data_size = safe_data_size;
+
+	return( 1 );
+}
+
+/* Writes the index data
+ * The data size must be the size returned by deflate_index_get_data_size
+ * Returns 1 if successful or -1 on error
+ */
+int deflate_index_write_data(
+     deflate_index_t *index,
+     uint8_t *data,
+     size_t data_size,
+     libcerror_error_t **error )
+{
+	deflate_index_access_point_t *access_point = NULL;
+	static char *function                      = "deflate_index_write_data";
+	size_t data_offset                         = 0;
+	size_t required_data_size                  = 0;
+	uint32_t access_point_index                = 0;
+
+	if( deflate_index_get_data_size(
+	     index,
+	     &required_data_size,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve index data size.",
+		 function );
+
+		return( -1 );
+	}
+	if( data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid data.",
+		 function );
+
+		return( -1 );
+	}
+	if( data_size < required_data_size )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_TOO_SMALL,
+		 "%s: invalid data size value too small.",
+		 function );
+
+		return( -1 );
+	}
+	if( memory_copy(
+	     data,
+	     DEFLATE_INDEX_SIGNATURE,
+	     8 ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+		 "%s: unable to copy signature.",
+		 function );
+
+		return( -1 );
+	}
+	byte_stream_copy_from_uint32_little_endian(
+	 &( data[ 8 ] ),
+	 DEFLATE_INDEX_FORMAT_VERSION );
+
+	byte_stream_copy_from_uint32_little_endian(
+	 &( data[ 12 ] ),
+	 index->number_of_access_points );
+
+	byte_stream_copy_from_uint64_little_endian(
+	 &( data[ 16 ] ),
+	 index->interval );
+
+	byte_stream_copy_from_uint64_little_endian(
+	 &( data[ 24 ] ),
+	 index->uncompressed_data_size );
+
+	data_offset = DEFLATE_INDEX_HEADER_SIZE;
+
+	for( access_point_index = 0;
+	     access_point_index < index->number_of_access_points;
+	     access_point_index++ )
+	{
+		access_point = &( index->access_points[ access_point_index ] );
+
+		byte_stream_copy_from_uint64_little_endian(
+		 &( data[ data_offset ] ),
+		 access_point->compressed_bit_offset );
+
+		byte_stream_copy_from_uint64_little_endian(
+		 &( data[ data_offset + 8 ] ),
+		 access_point->uncompressed_offset );
+
+		byte_stream_copy_from_uint32_little_endian(
+		 &( data[ data_offset + 16 ] ),
+		 access_point->window_size );
+
+		data_offset += DEFLATE_INDEX_ACCESS_POINT_SIZE;
+
+		if( access_point->window_size > 0 )
+		{
+			if( memory_copy(
+			     &( data[ data_offset ] ),
+			     access_point->window,
+			     (size_t) access_point->window_size ) == NULL )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_MEMORY,
+				 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+				 "%s: unable to copy window of access point: %" PRIu32 ".",
+				 function,
+				 access_point_index );
+
+				return( -1 );
+			}
+			data_offset += access_point->window_size;
+		}
+	}
+	return( 1 );
+}
+
+/* Reads the index data
+ * The access points of the index are replaced by those of the data
+ * Returns 1 if successful or -1 on error
+ */
+int deflate_index_read_data(
+     deflate_index_t *index,
+     const uint8_t *data,
+     size_t data_size,
+     libcerror_error_t **error )
+{
+	deflate_index_access_point_t *access_point = NULL;
+	static char *function                      = "deflate_index_read_data";
+	size_t data_offset                         = 0;
+	uint64_t interval                          = 0;
+	uint64_t previous_uncompressed_offset      = 0;
+	uint64_t uncompressed_data_size            = 0;
+	uint32_t access_point_index                = 0;
+	uint32_t format_version                    = 0;
+	uint32_t number_of_access_points           = 0;
+
+	if( index == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid index.",
+		 function );
+
+		return( -1 );
+	}
+	if( data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid data.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( data_size < DEFLATE_INDEX_HEADER_SIZE )
+	 || ( data_size > (size_t) SSIZE_MAX ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid data size value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( memory_compare(
+	     data,
+	     DEFLATE_INDEX_SIGNATURE,
+	     8 ) != 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_UNSUPPORTED_VALUE,
+		 "%s: unsupported signature.",
+		 function );
+
+		return( -1 );
+	}
+	byte_stream_copy_to_uint32_little_endian(
+	 &( data[ 8 ] ),
+	 format_version );
+
+	byte_stream_copy_to_uint32_little_endian(
+	 &( data[ 12 ] ),
+	 number_of_access_points );
+
+	byte_stream_copy_to_uint64_little_endian(
+	 &( data[ 16 ] ),
+	 interval );
+
+	byte_stream_copy_to_uint64_little_endian(
+	 &( data[ 24 ] ),
+	 uncompressed_data_size );
+
+	if( format_version != DEFLATE_INDEX_FORMAT_VERSION )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_UNSUPPORTED_VALUE,
+		 "%s: unsupported format version: %" PRIu32 ".",
+		 function,
+		 format_version );
+
+		return( -1 );
+	}
+	if( interval == 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid interval value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	/* Every access point requires at least its fixed size part of the data
+	 */
+	if( number_of_access_points > ( ( data_size - DEFLATE_INDEX_HEADER_SIZE ) / DEFLATE_INDEX_ACCESS_POINT_SIZE ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid number of access points value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( deflate_index_resize_access_points(
+	     index,
+	     number_of_access_points,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_RESIZE_FAILED,
+		 "%s: unable to resize access points.",
+		 function );
+
+		return( -1 );
+	}
+	index->number_of_access_points = 0;
+
+	data_offset = DEFLATE_INDEX_HEADER_SIZE;
+
+	for( access_point_index = 0;
+	     access_point_index < number_of_access_points;
+	     access_point_index++ )
+	{
+		access_point = &( index->access_points[ access_point_index ] );
+
+		if( DEFLATE_INDEX_ACCESS_POINT_SIZE > ( data_size - data_offset ) )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+			 LIBCERROR_ARGUMENT_ERROR_VALUE_TOO_SMALL,
+			 "%s: invalid data size value too small.",
+			 function );
+
+			return( -1 );
+		}
+		byte_stream_copy_to_uint64_little_endian(
+		 &( data[ data_offset ] ),
+		 access_point->compressed_bit_offset );
+
+		byte_stream_copy_to_uint64_little_endian(
+		 &( data[ data_offset + 8 ] ),
+		 access_point->uncompressed_offset );
+
+		byte_stream_copy_to_uint32_little_endian(
+		 &( data[ data_offset + 16 ] ),
+		 access_point->window_size );
+
+		data_offset += DEFLATE_INDEX_ACCESS_POINT_SIZE;
+
+		if( ( access_point->window_size > DEFLATE_STREAM_WINDOW_SIZE )
+		 || ( (size_t) access_point->window_size > ( data_size - data_offset ) ) )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+			 "%s: invalid window size of access point: %" PRIu32 " value out of bounds.",
+			 function,
+			 access_point_index );
+
+			return( -1 );
+		}
+		if( ( access_point_index > 0 )
+		 && ( access_point->uncompressed_offset < previous_uncompressed_offset ) )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+			 "%s: invalid uncompressed offset of access point: %" PRIu32 " value out of bounds.",
+			 function,
+			 access_point_index );
+
+			return( -1 );
+		}
+		if( access_point->window_size > 0 )
+		{
+			if( memory_copy(
+			     access_point->window,
+			     &( data[ data_offset ] ),
+			     (size_t) access_point->window_size ) == NULL )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_MEMORY,
+				 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+				 "%s: unable to copy window of access point: %" PRIu32 ".",
+				 function,
+				 access_point_index );
+
+				return( -1 );
+			}
+			data_offset += access_point->window_size;
+		}
+		previous_uncompressed_offset = access_point->uncompressed_offset;
+	}
+	index->interval                = interval;
+	index->uncompressed_data_size  = uncompressed_data_size;
+	index->number_of_access_points = number_of_access_points;
+
+	return( 1 );
+}
+
@@ -0,0 +1,151 @@
+/*
+ * Deflate (zlib) random-access index functions
+ *
+ * Copyright (C) 2008-2019, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This software is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This software is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this software.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#if !defined( _DEFLATE_INDEX_H )
+#define _DEFLATE_INDEX_H
+
+#include <common.h>
+#include <types.h>
+
+#include "assorted_libcerror.h"
+#include "deflate_stream.h"
+
+#if defined( __cplusplus )
+extern "C" {
+#endif
+
+/* The signature of the index data
+ */
+#define DEFLATE_INDEX_SIGNATURE			"DFLTIDX\0"
+
+/* The format version of the index data
+ */
+#define DEFLATE_INDEX_FORMAT_VERSION		1
+
+/* The size of the index data header
+ * which consists of the signature, format version, number of access points,
+ * interval and uncompressed data size
+ */
+#define DEFLATE_INDEX_HEADER_SIZE		32
+
+/* The size of an access point in the index data without the window
+ * which consists of the compressed bit offset, uncompressed offset and window size
+ */
+#define DEFLATE_INDEX_ACCESS_POINT_SIZE		20
+
+typedef struct deflate_index_access_point deflate_index_access_point_t;
+
+struct deflate_index_access_point
+{
+	/* The offset of the start of the block in the compressed data in bits
+	 */
+	uint64_t compressed_bit_offset;
+
+	/* The offset of the start of the block in the uncompressed data
+	 */
+	uint64_t uncompressed_offset;
+
+	/* The size of the window
+	 */
+	uint32_t window_size;
+
+	/* The window, which contains the uncompressed data preceding the block
+	 */
+	uint8_t window[ DEFLATE_STREAM_WINDOW_SIZE ];
+};
+
+typedef struct deflate_index deflate_index_t;
+
+struct deflate_index
+{
+	/* The minimum distance between access points in the uncompressed data
+	 */
+	uint64_t interval;
+
+	/* The uncompressed data size, which is 0 until the end of the stream has been reached
+	 */
+	uint64_t uncompressed_data_size;
+
+	/* The access points, ordered by offset
+	 */
+	deflate_index_access_point_t *access_points;
+
+	/* The number of access points
+	 */
+	uint32_t number_of_access_points;
+
+	/* The number of access points that fit in the access points array
+	 */
+	uint32_t maximum_number_of_access_points;
+};
+
+int deflate_index_initialize(
+     deflate_index_t **index,
+     uint64_t interval,
+     libcerror_error_t **error );
+
+int deflate_index_free(
+     deflate_index_t **index,
+     libcerror_error_t **error );
+
+int deflate_index_decompress(
+     deflate_index_t *index,
+     deflate_stream_t *stream,
+     const uint8_t *compressed_data,
+     size_t *compressed_data_size,
+     uint8_t *uncompressed_data,
+     size_t *uncompressed_data_size,
+     uint8_t flags,
+     libcerror_error_t **error );
+
+ssize_t deflate_index_decompress_at_offset(
+         deflate_index_t *index,
+         deflate_stream_t *stream,
+         const uint8_t *compressed_data,
+         size_t compressed_data_size,
+         uint64_t uncompressed_offset,
+         uint8_t *uncompressed_data,
+         size_t uncompressed_data_size,
+         libcerror_error_t **error );
+
+int deflate_index_get_data_size(
+     deflate_index_t *index,
+     size_t *data_size,
+     libcerror_error_t **error );
+
+int deflate_index_write_data(
+     deflate_index_t *index,
+     uint8_t *data,
+     size_t data_size,
+     libcerror_error_t **error );
+
+int deflate_index_read_data(
+     deflate_index_t *index,
+     const uint8_t *data,
+     size_t data_size,
+     libcerror_error_t **error );
+
+#if defined( __cplusplus )
+}
+#endif
+
+#endif /* !defined( _DEFLATE_INDEX_H ) */
+
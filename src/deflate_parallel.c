@@ -0,0 +1,1243 @@
+/*
+ * Deflate (zlib) speculative parallel decompression functions
+ *
+ * Copyright (C) 2008-2019, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This software is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This software is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this software.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <byte_stream.h>
+#include <memory.h>
+#include <types.h>
+
+#include "assorted_libcerror.h"
+#include "deflate.h"
+#include "deflate_parallel.h"
+#include "deflate_tables.h"
+
+/* Retrieves up to 56 bits at a bit offset in the compressed data
+ * Returns 1 if successful or 0 if the compressed data is too small
+ */
+static int deflate_parallel_get_bits(
+            const uint8_t *compressed_data,
+            size_t compressed_data_size,
+            uint64_t bit_offset,
+            uint8_t number_of_bits,
+            uint64_t *value_64bit )
+{
+	uint64_t safe_value_64bit = 0;
+	size_t byte_offset        = 0;
+	size_t last_byte_offset   = 0;
+	uint8_t byte_shift        = 0;
+
+	if( ( bit_offset + number_of_bits ) > ( (uint64_t) compressed_data_size * 8 ) )
+	{
+		return( 0 );
+	}
+	byte_offset      = (size_t) ( bit_offset >> 3 );
+	last_byte_offset = (size_t) ( ( bit_offset + number_of_bits + 7 ) >> 3 );
+
+	while( byte_offset < last_byte_offset )
+	{
+		safe_value_64bit |= (uint64_t) compressed_data[ byte_offset++ ] << byte_shift;
+
+		byte_shift += 8;
+	}
+	safe_value_64bit >>= bit_offset & 0x07;
+
+	*value_64bit = safe_value_64bit & ~( (uint64_t) 0xffffffffffffffffULL << number_of_bits );
+
+	return( 1 );
+}
+
+/* Initializes a bit stream at a bit offset in the compressed data
+ * Returns 1 if successful or -1 on error
+ */
+static int deflate_parallel_bit_stream_set_offset(
+            deflate_bit_stream_t *bit_stream,
+            const uint8_t *compressed_data,
+            size_t compressed_data_size,
+            uint64_t bit_offset,
+            libcerror_error_t **error )
+{
+	static char *function = "deflate_parallel_bit_stream_set_offset";
+	uint32_t value_32bit  = 0;
+
+	if( bit_offset >= ( (uint64_t) compressed_data_size * 8 ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid bit offset value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	bit_stream->byte_stream        = compressed_data;
+	bit_stream->byte_stream_size   = compressed_data_size;
+	bit_stream->byte_stream_offset = (size_t) ( bit_offset >> 3 );
+	bit_stream->bit_buffer         = 0;
+	bit_stream->bit_buffer_size    = 0;
+
+	if( deflate_bit_stream_get_value(
+	     bit_stream,
+	     (uint8_t) ( bit_offset & 0x07 ),
+	     &value_32bit,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve value from bit stream.",
+		 function );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Retrieves the current offset of a bit stream in bits
+ */
+static uint64_t deflate_parallel_bit_stream_get_offset(
+                 deflate_bit_stream_t *bit_stream )
+{
+	return( ( (uint64_t) bit_stream->byte_stream_offset * 8 ) - bit_stream->bit_buffer_size );
+}
+
+/* Resizes the symbols of a chunk to hold at least the required number of symbols
+ * Returns 1 if successful or -1 on error
+ */
+static int deflate_parallel_chunk_resize(
+            deflate_parallel_chunk_t *chunk,
+            size_t required_number_of_symbols,
+            size_t maximum_number_of_symbols,
+            libcerror_error_t **error )
+{
+	uint16_t *symbols             = NULL;
+	static char *function         = "deflate_parallel_chunk_resize";
+	size_t safe_number_of_symbols = 0;
+
+	if( required_number_of_symbols > maximum_number_of_symbols )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid required number of symbols value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	safe_number_of_symbols = chunk->maximum_number_of_symbols;
+
+	while( safe_number_of_symbols < required_number_of_symbols )
+	{
+		if( safe_number_of_symbols > ( maximum_number_of_symbols / 2 ) )
+		{
+			safe_number_of_symbols = maximum_number_of_symbols;
+		}
+		else
+		{
+			safe_number_of_symbols *= 2;
+		}
+	}
+	symbols = (uint16_t *) memory_reallocate(
+	                        chunk->symbols,
+	                        sizeof( uint16_t ) * safe_number_of_symbols );
+
+	if( symbols == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to resize symbols.",
+		 function );
+
+		return( -1 );
+	}
+	chunk->symbols                   = symbols;
+	chunk->maximum_number_of_symbols = safe_number_of_symbols;
+
+	return( 1 );
+}
+
+/* Decodes a Huffman compressed block into symbols
+ * A back-reference that refers to data before the start of the chunk is stored
+ * as a reference to the window that precedes the chunk
+ * If chunk is NULL the block is only decoded to validate it, in which case
+ * number_of_symbols is used to track the number of decoded symbols
+ * Returns 1 on success or -1 on error
+ */
+static int deflate_parallel_decode_huffman(
+            deflate_bit_stream_t *bit_stream,
+            const deflate_huffman_table_t *literals_table,
+            const deflate_huffman_table_t *distances_table,
+            deflate_parallel_chunk_t *chunk,
+            size_t *number_of_symbols,
+            size_t maximum_number_of_symbols,
+            libcerror_error_t **error )
+{
+	static char *function         = "deflate_parallel_decode_huffman";
+	size_t symbol_index           = 0;
+	size_t safe_number_of_symbols = 0;
+	uint32_t code_value           = 0;
+	uint32_t extra_bits           = 0;
+	uint16_t compression_offset   = 0;
+	uint16_t compression_size     = 0;
+	uint16_t symbol               = 0;
+
+	safe_number_of_symbols = *number_of_symbols;
+
+	do
+	{
+		if( deflate_bit_stream_get_huffman_encoded_value(
+		     bit_stream,
+		     literals_table,
+		     &code_value,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve literal value from bit stream.",
+			 function );
+
+			goto on_error;
+		}
+		if( code_value < 256 )
+		{
+			if( chunk != NULL )
+			{
+				if( safe_number_of_symbols >= chunk->maximum_number_of_symbols )
+				{
+					if( deflate_parallel_chunk_resize(
+					     chunk,
+					     safe_number_of_symbols + 1,
+					     maximum_number_of_symbols,
+					     error ) != 1 )
+					{
+						libcerror_error_set(
+						 error,
+						 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+						 LIBCERROR_RUNTIME_ERROR_RESIZE_FAILED,
+						 "%s: unable to resize chunk.",
+						 function );
+
+						goto on_error;
+					}
+				}
+				chunk->symbols[ safe_number_of_symbols ] = (uint16_t) code_value;
+			}
+			safe_number_of_symbols++;
+		}
+		else if( ( code_value > 256 )
+		      && ( code_value < 286 ) )
+		{
+			code_value -= 257;
+
+			if( deflate_bit_stream_get_value(
+			     bit_stream,
+			     (uint8_t) deflate_literal_codes_number_of_extra_bits[ code_value ],
+			     &extra_bits,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+				 "%s: unable to retrieve literal extra value from bit stream.",
+				 function );
+
+				goto on_error;
+			}
+			compression_size = deflate_literal_codes_base[ code_value ] + (uint16_t) extra_bits;
+
+			if( deflate_bit_stream_get_huffman_encoded_value(
+			     bit_stream,
+			     distances_table,
+			     &code_value,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+				 "%s: unable to retrieve distance value from bit stream.",
+				 function );
+
+				goto on_error;
+			}
+			if( code_value >= 30 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+				 "%s: invalid distance code value out of bounds.",
+				 function );
+
+				goto on_error;
+			}
+			if( deflate_bit_stream_get_value(
+			     bit_stream,
+			     (uint8_t) deflate_distance_codes_number_of_extra_bits[ code_value ],
+			     &extra_bits,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+				 "%s: unable to retrieve distance extra value from bit stream.",
+				 function );
+
+				goto on_error;
+			}
+			compression_offset = deflate_distance_codes_base[ code_value ] + (uint16_t) extra_bits;
+
+			/* The back-reference can refer to at most the window that precedes the chunk
+			 */
+			if( compression_offset > ( safe_number_of_symbols + DEFLATE_PARALLEL_WINDOW_SIZE ) )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+				 "%s: invalid compression offset value out of bounds.",
+				 function );
+
+				goto on_error;
+			}
+			if( chunk != NULL )
+			{
+				if( ( safe_number_of_symbols + compression_size ) > chunk->maximum_number_of_symbols )
+				{
+					if( deflate_parallel_chunk_resize(
+					     chunk,
+					     safe_number_of_symbols + compression_size,
+					     maximum_number_of_symbols,
+					     error ) != 1 )
+					{
+						libcerror_error_set(
+						 error,
+						 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+						 LIBCERROR_RUNTIME_ERROR_RESIZE_FAILED,
+						 "%s: unable to resize chunk.",
+						 function );
+
+						goto on_error;
+					}
+				}
+				/* Copying the symbols also copies unresolved window references
+				 */
+				for( symbol_index = safe_number_of_symbols;
+				     symbol_index < ( safe_number_of_symbols + compression_size );
+				     symbol_index++ )
+				{
+					if( compression_offset <= symbol_index )
+					{
+						symbol = chunk->symbols[ symbol_index - compression_offset ];
+					}
+					else
+					{
+						symbol = (uint16_t) ( 256 + DEFLATE_PARALLEL_WINDOW_SIZE - ( compression_offset - symbol_index ) );
+					}
+					if( symbol >= 256 )
+					{
+						chunk->number_of_window_references += 1;
+					}
+					chunk->symbols[ symbol_index ] = symbol;
+				}
+			}
+			else if( ( safe_number_of_symbols + compression_size ) > maximum_number_of_symbols )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_VALUE_EXCEEDS_MAXIMUM,
+				 "%s: invalid number of symbols value exceeds maximum.",
+				 function );
+
+				goto on_error;
+			}
+			safe_number_of_symbols += compression_size;
+		}
+		else if( code_value != 256 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+			 "%s: invalid code value: %" PRIu32 ".",
+			 function,
+			 code_value );
+
+			goto on_error;
+		}
+	}
+	while( code_value != 256 );
+
+	*number_of_symbols = safe_number_of_symbols;
+
+	return( 1 );
+
+on_error:
+	*number_of_symbols = safe_number_of_symbols;
+
+	return( -1 );
+}
+
+/* Checks if there is a plausible deflate block header at a bit offset
+ * An uncompressed block must have a block size that matches its copy and
+ * a dynamic Huffman block must have a valid number of codes and a complete
+ * set of code sizes for the code sizes table
+ * Returns 1 if the block header is plausible or 0 if not
+ */
+int deflate_parallel_check_block_header(
+     const uint8_t *compressed_data,
+     size_t compressed_data_size,
+     uint64_t bit_offset )
+{
+	size_t byte_offset           = 0;
+	uint64_t value_64bit         = 0;
+	uint32_t code_space          = 0;
+	uint16_t block_size          = 0;
+	uint16_t block_size_copy     = 0;
+	uint8_t block_type           = 0;
+	uint8_t code_size            = 0;
+	uint8_t code_size_index      = 0;
+	uint8_t number_of_code_sizes = 0;
+
+	if( compressed_data == NULL )
+	{
+		return( 0 );
+	}
+	if( deflate_parallel_get_bits(
+	     compressed_data,
+	     compressed_data_size,
+	     bit_offset,
+	     3,
+	     &value_64bit ) != 1 )
+	{
+		return( 0 );
+	}
+	block_type = (uint8_t) ( value_64bit >> 1 );
+
+	switch( block_type )
+	{
+		case DEFLATE_BLOCK_TYPE_UNCOMPRESSED:
+			byte_offset = (size_t) ( ( bit_offset + 3 + 7 ) >> 3 );
+
+			if( ( compressed_data_size < 4 )
+			 || ( byte_offset > ( compressed_data_size - 4 ) ) )
+			{
+				return( 0 );
+			}
+			byte_stream_copy_to_uint16_little_endian(
+			 &( compressed_data[ byte_offset ] ),
+			 block_size );
+
+			byte_stream_copy_to_uint16_little_endian(
+			 &( compressed_data[ byte_offset + 2 ] ),
+			 block_size_copy );
+
+			if( block_size != (uint16_t) ( ~block_size_copy ) )
+			{
+				return( 0 );
+			}
+			break;
+
+		case DEFLATE_BLOCK_TYPE_HUFFMAN_FIXED:
+			break;
+
+		case DEFLATE_BLOCK_TYPE_HUFFMAN_DYNAMIC:
+			if( deflate_parallel_get_bits(
+			     compressed_data,
+			     compressed_data_size,
+			     bit_offset + 3,
+			     14,
+			     &value_64bit ) != 1 )
+			{
+				return( 0 );
+			}
+			if( ( ( value_64bit & 0x1f ) > 29 )
+			 || ( ( ( value_64bit >> 5 ) & 0x1f ) > 29 ) )
+			{
+				return( 0 );
+			}
+			number_of_code_sizes = (uint8_t) ( value_64bit >> 10 ) + 4;
+
+			/* The code sizes of the code sizes table are stored as 3-bit values
+			 * from bit 17, a complete set of code sizes fills the code space of 2^7
+			 */
+			for( code_size_index = 0;
+			     code_size_index < number_of_code_sizes;
+			     code_size_index++ )
+			{
+				if( deflate_parallel_get_bits(
+				     compressed_data,
+				     compressed_data_size,
+				     bit_offset + 17 + ( code_size_index * 3 ),
+				     3,
+				     &value_64bit ) != 1 )
+				{
+					return( 0 );
+				}
+				code_size = (uint8_t) value_64bit;
+
+				if( code_size > 0 )
+				{
+					code_space += 128 >> code_size;
+				}
+			}
+			if( code_space != 128 )
+			{
+				return( 0 );
+			}
+			break;
+
+		case DEFLATE_BLOCK_TYPE_RESERVED:
+		default:
+			return( 0 );
+	}
+	return( 1 );
+}
+
+/* Determines if a candidate dynamic Huffman block at a bit offset is valid
+ * A candidate is valid if its Huffman tables can be constructed, the block
+ * decodes without error and it is followed by a plausible block header
+ * Returns 1 if valid, 0 if not or -1 on error
+ */
+static int deflate_parallel_validate_block(
+            const uint8_t *compressed_data,
+            size_t compressed_data_size,
+            uint64_t bit_offset,
+            deflate_huffman_table_t *literals_table,
+            deflate_huffman_table_t *distances_table,
+            libcerror_error_t **error )
+{
+	deflate_bit_stream_t bit_stream;
+
+	libcerror_error_t *validate_error = NULL;
+	static char *function             = "deflate_parallel_validate_block";
+	size_t number_of_symbols          = 0;
+	int result                        = 0;
+
+	if( deflate_parallel_bit_stream_set_offset(
+	     &bit_stream,
+	     compressed_data,
+	     compressed_data_size,
+	     bit_offset + 3,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to set bit stream offset.",
+		 function );
+
+		return( -1 );
+	}
+	/* Errors are expected for invalid candidates and are discarded
+	 */
+	result = deflate_initialize_dynamic_huffman_tables(
+	          &bit_stream,
+	          literals_table,
+	          distances_table,
+	          &validate_error );
+
+	if( result == 1 )
+	{
+		result = deflate_parallel_decode_huffman(
+		          &bit_stream,
+		          literals_table,
+		          distances_table,
+		          NULL,
+		          &number_of_symbols,
+		          (size_t) SSIZE_MAX,
+		          &validate_error );
+	}
+	if( validate_error != NULL )
+	{
+		libcerror_error_free(
+		 &validate_error );
+	}
+	if( result != 1 )
+	{
+		return( 0 );
+	}
+	return( deflate_parallel_check_block_header(
+	         compressed_data,
+	         compressed_data_size,
+	         deflate_parallel_bit_stream_get_offset(
+	          &bit_stream ) ) );
+}
+
+/* Finds the first block boundary at or after a bit offset
+ * Only non-last dynamic Huffman blocks are considered, since these
+ * contain enough redundancy to reject almost all false candidates
+ * On return block_bit_offset contains the offset of the block in bits
+ * Returns 1 if a block was found, 0 if not or -1 on error
+ */
+int deflate_parallel_find_block(
+     const uint8_t *compressed_data,
+     size_t compressed_data_size,
+     uint64_t bit_offset,
+     uint64_t maximum_bit_offset,
+     uint64_t *block_bit_offset,
+     libcerror_error_t **error )
+{
+	deflate_huffman_table_t distances_table;
+	deflate_huffman_table_t literals_table;
+
+	static char *function  = "deflate_parallel_find_block";
+	uint64_t search_offset = 0;
+	uint64_t value_64bit   = 0;
+	int result             = 0;
+
+	if( compressed_data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid compressed data.",
+		 function );
+
+		return( -1 );
+	}
+	if( compressed_data_size > (size_t) SSIZE_MAX )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid compressed data size value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	if( block_bit_offset == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid block bit offset.",
+		 function );
+
+		return( -1 );
+	}
+	if( maximum_bit_offset > ( (uint64_t) compressed_data_size * 8 ) )
+	{
+		maximum_bit_offset = (uint64_t) compressed_data_size * 8;
+	}
+	for( search_offset = bit_offset;
+	     search_offset < maximum_bit_offset;
+	     search_offset++ )
+	{
+		/* A non-last dynamic Huffman block header starts with the bits 0, 0, 1
+		 */
+		if( ( deflate_parallel_get_bits(
+		       compressed_data,
+		       compressed_data_size,
+		       search_offset,
+		       3,
+		       &value_64bit ) != 1 )
+		 || ( value_64bit != 0x04 ) )
+		{
+			continue;
+		}
+		if( deflate_parallel_check_block_header(
+		     compressed_data,
+		     compressed_data_size,
+		     search_offset ) != 1 )
+		{
+			continue;
+		}
+		result = deflate_parallel_validate_block(
+		          compressed_data,
+		          compressed_data_size,
+		          search_offset,
+		          &literals_table,
+		          &distances_table,
+		          error );
+
+		if( result == -1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GENERIC,
+			 "%s: unable to validate block at bit offset: %" PRIu64 ".",
+			 function,
+			 search_offset );
+
+			return( -1 );
+		}
+		else if( result != 0 )
+		{
+			*block_bit_offset = search_offset;
+
+			return( 1 );
+		}
+	}
+	return( 0 );
+}
+
+/* Creates a chunk
+ * Make sure the value chunk is referencing, is set to NULL
+ * Returns 1 if successful or -1 on error
+ */
+int deflate_parallel_chunk_initialize(
+     deflate_parallel_chunk_t **chunk,
+     uint64_t start_bit_offset,
+     uint64_t stop_bit_offset,
+     libcerror_error_t **error )
+{
+	static char *function = "deflate_parallel_chunk_initialize";
+
+	if( chunk == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid chunk.",
+		 function );
+
+		return( -1 );
+	}
+	if( *chunk != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid chunk value already set.",
+		 function );
+
+		return( -1 );
+	}
+	if( stop_bit_offset <= start_bit_offset )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid stop bit offset value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	*chunk = memory_allocate_structure(
+	          deflate_parallel_chunk_t );
+
+	if( *chunk == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create chunk.",
+		 function );
+
+		return( -1 );
+	}
+	( *chunk )->start_bit_offset            = start_bit_offset;
+	( *chunk )->stop_bit_offset             = stop_bit_offset;
+	( *chunk )->end_bit_offset              = 0;
+	( *chunk )->symbols                     = NULL;
+	( *chunk )->number_of_symbols           = 0;
+	( *chunk )->maximum_number_of_symbols   = 0;
+	( *chunk )->number_of_window_references = 0;
+	( *chunk )->last_block_flag             = 0;
+
+	return( 1 );
+}
+
+/* Frees a chunk
+ * Returns 1 if successful or -1 on error
+ */
+int deflate_parallel_chunk_free(
+     deflate_parallel_chunk_t **chunk,
+     libcerror_error_t **error )
+{
+	static char *function = "deflate_parallel_chunk_free";
+
+	if( chunk == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid chunk.",
+		 function );
+
+		return( -1 );
+	}
+	if( *chunk != NULL )
+	{
+		if( ( *chunk )->symbols != NULL )
+		{
+			memory_free(
+			 ( *chunk )->symbols );
+		}
+		memory_free(
+		 *chunk );
+
+		*chunk = NULL;
+	}
+	return( 1 );
+}
+
+/* Decodes the blocks of a chunk into symbols
+ * Decoding starts at the start bit offset and stops at the first block boundary
+ * at or after the stop bit offset or after the last block of the stream
+ * The maximum number of symbols limits the memory used by a chunk that was
+ * started at a false block boundary
+ * Returns 1 if successful or -1 on error
+ */
+int deflate_parallel_chunk_decode(
+     deflate_parallel_chunk_t *chunk,
+     const uint8_t *compressed_data,
+     size_t compressed_data_size,
+     size_t maximum_number_of_symbols,
+     libcerror_error_t **error )
+{
+	deflate_huffman_table_t dynamic_distances_table;
+	deflate_huffman_table_t dynamic_literals_table;
+	deflate_bit_stream_t bit_stream;
+
+	const deflate_huffman_table_t *distances_table = NULL;
+	const deflate_huffman_table_t *literals_table  = NULL;
+	static char *function                          = "deflate_parallel_chunk_decode";
+	uint64_t bit_offset                            = 0;
+	uint64_t initial_number_of_symbols             = 0;
+	size_t symbol_index                            = 0;
+	uint32_t block_size                            = 0;
+	uint32_t block_size_copy                       = 0;
+	uint32_t value_32bit                           = 0;
+	uint8_t block_type                             = 0;
+	uint8_t last_block_flag                        = 0;
+
+	if( chunk == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid chunk.",
+		 function );
+
+		return( -1 );
+	}
+	if( chunk->symbols != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid chunk - symbols value already set.",
+		 function );
+
+		return( -1 );
+	}
+	if( compressed_data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid compressed data.",
+		 function );
+
+		return( -1 );
+	}
+	if( compressed_data_size > (size_t) SSIZE_MAX )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid compressed data size value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( maximum_number_of_symbols == 0 )
+	 || ( maximum_number_of_symbols > ( (size_t) SSIZE_MAX / sizeof( uint16_t ) ) ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid maximum number of symbols value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( deflate_parallel_bit_stream_set_offset(
+	     &bit_stream,
+	     compressed_data,
+	     compressed_data_size,
+	     chunk->start_bit_offset,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to set bit stream offset.",
+		 function );
+
+		goto on_error;
+	}
+	/* Estimate the number of symbols from the size of the compressed data of the chunk
+	 */
+	initial_number_of_symbols = ( ( chunk->stop_bit_offset - chunk->start_bit_offset ) / 8 ) + 1;
+
+	if( initial_number_of_symbols > ( maximum_number_of_symbols / DEFLATE_PARALLEL_INITIAL_SYMBOLS_PER_BYTE ) )
+	{
+		initial_number_of_symbols = maximum_number_of_symbols;
+	}
+	else
+	{
+		initial_number_of_symbols *= DEFLATE_PARALLEL_INITIAL_SYMBOLS_PER_BYTE;
+	}
+	chunk->symbols = (uint16_t *) memory_allocate(
+	                               sizeof( uint16_t ) * (size_t) initial_number_of_symbols );
+
+	if( chunk->symbols == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create symbols.",
+		 function );
+
+		goto on_error;
+	}
+	chunk->maximum_number_of_symbols   = (size_t) initial_number_of_symbols;
+	chunk->number_of_symbols           = 0;
+	chunk->number_of_window_references = 0;
+	chunk->last_block_flag             = 0;
+
+	while( last_block_flag == 0 )
+	{
+		bit_offset = deflate_parallel_bit_stream_get_offset(
+		              &bit_stream );
+
+		if( bit_offset >= chunk->stop_bit_offset )
+		{
+			break;
+		}
+		if( deflate_bit_stream_get_value(
+		     &bit_stream,
+		     3,
+		     &value_32bit,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve value from bit stream.",
+			 function );
+
+			goto on_error;
+		}
+		last_block_flag = (uint8_t) ( value_32bit & 0x00000001UL );
+		block_type      = (uint8_t) ( value_32bit >> 1 );
+
+		switch( block_type )
+		{
+			case DEFLATE_BLOCK_TYPE_UNCOMPRESSED:
+				/* Ignore the bits in the buffer upto the next byte
+				 */
+				if( deflate_bit_stream_get_value(
+				     &bit_stream,
+				     bit_stream.bit_buffer_size & 0x07,
+				     &value_32bit,
+				     error ) != 1 )
+				{
+					libcerror_error_set(
+					 error,
+					 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+					 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+					 "%s: unable to retrieve value from bit stream.",
+					 function );
+
+					goto on_error;
+				}
+				/* Return the bytes remaining in the bit buffer to the byte stream
+				 */
+				bit_stream.byte_stream_offset -= bit_stream.bit_buffer_size >> 3;
+				bit_stream.bit_buffer          = 0;
+				bit_stream.bit_buffer_size     = 0;
+
+				if( ( bit_stream.byte_stream_size - bit_stream.byte_stream_offset ) < 4 )
+				{
+					libcerror_error_set(
+					 error,
+					 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+					 LIBCERROR_ARGUMENT_ERROR_VALUE_TOO_SMALL,
+					 "%s: invalid compressed data value too small.",
+					 function );
+
+					goto on_error;
+				}
+				byte_stream_copy_to_uint16_little_endian(
+				 &( compressed_data[ bit_stream.byte_stream_offset ] ),
+				 block_size );
+
+				byte_stream_copy_to_uint16_little_endian(
+				 &( compressed_data[ bit_stream.byte_stream_offset + 2 ] ),
+				 block_size_copy );
+
+				bit_stream.byte_stream_offset += 4;
+
+				if( block_size != ( block_size_copy ^ 0x0000ffffUL ) )
+				{
+					libcerror_error_set(
+					 error,
+					 LIBCERROR_ERROR_DOMAIN_INPUT,
+					 LIBCERROR_INPUT_ERROR_VALUE_MISMATCH,
+					 "%s: mismatch in block size ( %" PRIu32 " != %" PRIu32 " ).",
+					 function,
+					 block_size,
+					 (uint32_t) ( block_size_copy ^ 0x0000ffffUL ) );
+
+					goto on_error;
+				}
+				if( (size_t) block_size > ( bit_stream.byte_stream_size - bit_stream.byte_stream_offset ) )
+				{
+					libcerror_error_set(
+					 error,
+					 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+					 LIBCERROR_ARGUMENT_ERROR_VALUE_TOO_SMALL,
+					 "%s: invalid compressed data value too small.",
+					 function );
+
+					goto on_error;
+				}
+				if( ( chunk->number_of_symbols + block_size ) > chunk->maximum_number_of_symbols )
+				{
+					if( deflate_parallel_chunk_resize(
+					     chunk,
+					     chunk->number_of_symbols + block_size,
+					     maximum_number_of_symbols,
+					     error ) != 1 )
+					{
+						libcerror_error_set(
+						 error,
+						 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+						 LIBCERROR_RUNTIME_ERROR_RESIZE_FAILED,
+						 "%s: unable to resize chunk.",
+						 function );
+
+						goto on_error;
+					}
+				}
+				for( symbol_index = 0;
+				     symbol_index < (size_t) block_size;
+				     symbol_index++ )
+				{
+					chunk->symbols[ chunk->number_of_symbols++ ] = compressed_data[ bit_stream.byte_stream_offset++ ];
+				}
+				break;
+
+			case DEFLATE_BLOCK_TYPE_HUFFMAN_FIXED:
+				literals_table  = &deflate_fixed_huffman_literals_table;
+				distances_table = &deflate_fixed_huffman_distances_table;
+
+				break;
+
+			case DEFLATE_BLOCK_TYPE_HUFFMAN_DYNAMIC:
+				if( deflate_initialize_dynamic_huffman_tables(
+				     &bit_stream,
+				     &dynamic_literals_table,
+				     &dynamic_distances_table,
+				     error ) != 1 )
+				{
+					libcerror_error_set(
+					 error,
+					 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+					 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+					 "%s: unable to construct dynamic Huffman tables.",
+					 function );
+
+					goto on_error;
+				}
+				literals_table  = &dynamic_literals_table;
+				distances_table = &dynamic_distances_table;
+
+				break;
+
+			case DEFLATE_BLOCK_TYPE_RESERVED:
+			default:
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_UNSUPPORTED_VALUE,
+				 "%s: unsupported block type.",
+				 function );
+
+				goto on_error;
+		}
+		if( block_type != DEFLATE_BLOCK_TYPE_UNCOMPRESSED )
+		{
+			if( deflate_parallel_decode_huffman(
+			     &bit_stream,
+			     literals_table,
+			     distances_table,
+			     chunk,
+			     &( chunk->number_of_symbols ),
+			     maximum_number_of_symbols,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+				 "%s: unable to decode Huffman encoded bit stream.",
+				 function );
+
+				goto on_error;
+			}
+		}
+	}
+	chunk->end_bit_offset  = deflate_parallel_bit_stream_get_offset(
+	                          &bit_stream );
+	chunk->last_block_flag = last_block_flag;
+
+	return( 1 );
+
+on_error:
+	if( chunk->symbols != NULL )
+	{
+		memory_free(
+		 chunk->symbols );
+
+		chunk->symbols = NULL;
+	}
+	chunk->number_of_symbols         = 0;
+	chunk->maximum_number_of_symbols = 0;
+
+	return( -1 );
+}
+
+/* Resolves symbols of a chunk into uncompressed data
+ * The uncompressed offset is the offset of the start of the chunk in the uncompressed data
+ * The window references are resolved using the uncompressed data that precedes the chunk,
+ * hence the 32 KiB that precede the chunk must have been resolved before
+ * Returns 1 if successful or -1 on error
+ */
+int deflate_parallel_chunk_resolve(
+     deflate_parallel_chunk_t *chunk,
+     size_t first_symbol_index,
+     size_t number_of_symbols,
+     uint8_t *uncompressed_data,
+     size_t uncompressed_data_size,
+     size_t uncompressed_offset,
+     libcerror_error_t **error )
+{
+	static char *function = "deflate_parallel_chunk_resolve";
+	size_t symbol_index   = 0;
+	size_t window_offset  = 0;
+	uint16_t symbol       = 0;
+
+	if( chunk == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid chunk.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( first_symbol_index > chunk->number_of_symbols )
+	 || ( number_of_symbols > ( chunk->number_of_symbols - first_symbol_index ) ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid number of symbols value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( uncompressed_data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid uncompressed data.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( uncompressed_offset > uncompressed_data_size )
+	 || ( chunk->number_of_symbols > ( uncompressed_data_size - uncompressed_offset ) ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_TOO_SMALL,
+		 "%s: invalid uncompressed data value too small.",
+		 function );
+
+		return( -1 );
+	}
+	for( symbol_index = first_symbol_index;
+	     symbol_index < ( first_symbol_index + number_of_symbols );
+	     symbol_index++ )
+	{
+		symbol = chunk->symbols[ symbol_index ];
+
+		if( symbol >= 256 )
+		{
+			window_offset = uncompressed_offset + (size_t) ( symbol - 256 );
+
+			if( window_offset < DEFLATE_PARALLEL_WINDOW_SIZE )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+				 "%s: invalid window reference value out of bounds.",
+				 function );
+
+				return( -1 );
+			}
+			symbol = uncompressed_data[ window_offset - DEFLATE_PARALLEL_WINDOW_SIZE ];
+		}
+		uncompressed_data[ uncompressed_offset + symbol_index ] = (uint8_t) symbol;
+	}
+	return( 1 );
+}
+
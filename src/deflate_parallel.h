@@ -0,0 +1,128 @@
+/*
+ * Deflate (zlib) speculative parallel decompression functions
+ *
+ * Copyright (C) 2008-2019, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This software is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This software is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this software.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#if !defined( _DEFLATE_PARALLEL_H )
+#define _DEFLATE_PARALLEL_H
+
+#include <common.h>
+#include <types.h>
+
+#include "assorted_libcerror.h"
+
+#if defined( __cplusplus )
+extern "C" {
+#endif
+
+/* The size of the window that back-references can refer to
+ */
+#define DEFLATE_PARALLEL_WINDOW_SIZE			32768
+
+/* The initial number of symbols of a chunk per byte of compressed data
+ */
+#define DEFLATE_PARALLEL_INITIAL_SYMBOLS_PER_BYTE	4
+
+typedef struct deflate_parallel_chunk deflate_parallel_chunk_t;
+
+/* A chunk contains the symbolically decoded data of consecutive blocks
+ * A symbol of 0 - 255 is a literal byte and a symbol of 256 + index refers
+ * to the byte at index of the 32 KiB window that precedes the chunk, which
+ * is unknown while decoding the chunk and resolved afterwards
+ */
+struct deflate_parallel_chunk
+{
+	/* The offset of the first block of the chunk in the compressed data in bits
+	 */
+	uint64_t start_bit_offset;
+
+	/* The offset in bits from which the chunk stops at the first block boundary
+	 */
+	uint64_t stop_bit_offset;
+
+	/* The offset in bits of the block boundary where the chunk stopped
+	 */
+	uint64_t end_bit_offset;
+
+	/* The symbols
+	 */
+	uint16_t *symbols;
+
+	/* The number of symbols
+	 */
+	size_t number_of_symbols;
+
+	/* The maximum number of symbols the symbols array can hold
+	 */
+	size_t maximum_number_of_symbols;
+
+	/* The number of symbols that refer to the window
+	 */
+	size_t number_of_window_references;
+
+	/* Value to indicate the chunk ends with the last block of the stream
+	 */
+	uint8_t last_block_flag;
+};
+
+int deflate_parallel_check_block_header(
+     const uint8_t *compressed_data,
+     size_t compressed_data_size,
+     uint64_t bit_offset );
+
+int deflate_parallel_find_block(
+     const uint8_t *compressed_data,
+     size_t compressed_data_size,
+     uint64_t bit_offset,
+     uint64_t maximum_bit_offset,
+     uint64_t *block_bit_offset,
+     libcerror_error_t **error );
+
+int deflate_parallel_chunk_initialize(
+     deflate_parallel_chunk_t **chunk,
+     uint64_t start_bit_offset,
+     uint64_t stop_bit_offset,
+     libcerror_error_t **error );
+
+int deflate_parallel_chunk_free(
+     deflate_parallel_chunk_t **chunk,
+     libcerror_error_t **error );
+
+int deflate_parallel_chunk_decode(
+     deflate_parallel_chunk_t *chunk,
+     const uint8_t *compressed_data,
+     size_t compressed_data_size,
+     size_t maximum_number_of_symbols,
+     libcerror_error_t **error );
+
+int deflate_parallel_chunk_resolve(
+     deflate_parallel_chunk_t *chunk,
+     size_t first_symbol_index,
+     size_t number_of_symbols,
+     uint8_t *uncompressed_data,
+     size_t uncompressed_data_size,
+     size_t uncompressed_offset,
+     libcerror_error_t **error );
+
+#if defined( __cplusplus )
+}
+#endif
+
+#endif /* !defined( _DEFLATE_PARALLEL_H ) */
+
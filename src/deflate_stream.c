@@ -0,0 +1,1272 @@
+/*
+ * Deflate (zlib) streaming decompression functions
+ *
+ * Copyright (C) 2008-2019, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This software is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This software is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this software.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <byte_stream.h>
+#include <lz_match.h>
+#include <memory.h>
+#include <types.h>
+
+#include "assorted_libcerror.h"
+#include "assorted_libcnotify.h"
+#include "deflate.h"
+#include "deflate_stream.h"
+#include "deflate_tables.h"
+
+/* Creates a stream
+ * Make sure the value stream is referencing, is set to NULL
+ * Returns 1 if successful or -1 on error
+ */
+int deflate_stream_initialize(
+     deflate_stream_t **stream,
+     libcerror_error_t **error )
+{
+	static char *function = "deflate_stream_initialize";
+
+	if( stream == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid stream.",
+		 function );
+
+		return( -1 );
+	}
+	if( *stream != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid stream value already set.",
+		 function );
+
+		return( -1 );
+	}
+	*stream = memory_allocate_structure(
+	           deflate_stream_t );
+
+	if( *stream == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create stream.",
+		 function );
+
+		goto on_error;
+	}
+	if( memory_set(
+	     *stream,
+	     0,
+	     sizeof( deflate_stream_t ) ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear stream.",
+		 function );
+
+		goto on_error;
+	}
+	( *stream )->state                  = DEFLATE_STREAM_STATE_HEADER;
+	( *stream )->bit_stream.byte_stream = ( *stream )->input_buffer;
+	( *stream )->calculated_checksum    = 1;
+
+	return( 1 );
+
+on_error:
+	if( *stream != NULL )
+	{
+		memory_free(
+		 *stream );
+
+		*stream = NULL;
+	}
+	return( -1 );
+}
+
+/* Frees a stream
+ * Returns 1 if successful or -1 on error
+ */
+int deflate_stream_free(
+     deflate_stream_t **stream,
+     libcerror_error_t **error )
+{
+	static char *function = "deflate_stream_free";
+
+	if( stream == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid stream.",
+		 function );
+
+		return( -1 );
+	}
+	if( *stream != NULL )
+	{
+		memory_free(
+		 *stream );
+
+		*stream = NULL;
+	}
+	return( 1 );
+}
+
+/* Resets a stream so it can be used to decompress another stream
+ * The buffers and Huffman tables of the stream are reused and are not cleared
+ * Returns 1 if successful or -1 on error
+ */
+int deflate_stream_reset(
+     deflate_stream_t *stream,
+     libcerror_error_t **error )
+{
+	static char *function = "deflate_stream_reset";
+
+	if( stream == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid stream.",
+		 function );
+
+		return( -1 );
+	}
+	stream->state                         = DEFLATE_STREAM_STATE_HEADER;
+	stream->bit_stream.byte_stream        = stream->input_buffer;
+	stream->bit_stream.byte_stream_size   = 0;
+	stream->bit_stream.byte_stream_offset = 0;
+	stream->bit_stream.bit_buffer         = 0;
+	stream->bit_stream.bit_buffer_size    = 0;
+	stream->window_offset                 = 0;
+	stream->output_offset                 = 0;
+	stream->literals_table                = NULL;
+	stream->distances_table               = NULL;
+	stream->block_size                    = 0;
+	stream->last_block_flag               = 0;
+	stream->stop_pending                  = 0;
+	stream->stopped_at_block              = 0;
+	stream->compressed_data_offset        = 0;
+	stream->uncompressed_data_offset      = 0;
+	stream->calculated_checksum           = 1;
+
+	return( 1 );
+}
+
+/* Restarts a stream so it can be used to decompress a subsequent raw deflate stream
+ * that uses the decompressed data of the previous stream as its sliding window,
+ * such as the blocks of a MSZIP compressed folder
+ * The remaining compressed data of the previous stream is discarded
+ * The compressed data must be decompressed with DEFLATE_STREAM_FLAG_RAW
+ * Returns 1 if successful or -1 on error
+ */
+int deflate_stream_restart(
+     deflate_stream_t *stream,
+     libcerror_error_t **error )
+{
+	static char *function = "deflate_stream_restart";
+
+	if( stream == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid stream.",
+		 function );
+
+		return( -1 );
+	}
+	if( stream->output_offset != stream->window_offset )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid stream - decompressed data has not been returned.",
+		 function );
+
+		return( -1 );
+	}
+	stream->state                         = DEFLATE_STREAM_STATE_BLOCK_HEADER;
+	stream->bit_stream.byte_stream        = stream->input_buffer;
+	stream->bit_stream.byte_stream_size   = 0;
+	stream->bit_stream.byte_stream_offset = 0;
+	stream->bit_stream.bit_buffer         = 0;
+	stream->bit_stream.bit_buffer_size    = 0;
+	stream->literals_table                = NULL;
+	stream->distances_table               = NULL;
+	stream->block_size                    = 0;
+	stream->last_block_flag               = 0;
+	stream->stop_pending                  = 0;
+	stream->stopped_at_block              = 0;
+
+	return( 1 );
+}
+
+/* Decodes Huffman encoded data into the window buffer
+ * Decoding stops at the end of the block, when the window buffer has no space
+ * for another match or when the input could end within the next symbol
+ * Returns 1 at the end of the block, 0 if more input or window space is required or -1 on error
+ */
+static int deflate_stream_decode_huffman(
+            deflate_stream_t *stream,
+            uint8_t end_of_input,
+            libcerror_error_t **error )
+{
+	deflate_bit_stream_t *bit_stream = NULL;
+	uint8_t *window_buffer           = NULL;
+	static char *function            = "deflate_stream_decode_huffman";
+	size_t available_bits            = 0;
+	size_t window_offset             = 0;
+	uint32_t code_value              = 0;
+	uint32_t extra_bits              = 0;
+	uint16_t compression_offset      = 0;
+	uint16_t compression_size        = 0;
+	int result                       = 0;
+
+	bit_stream    = &( stream->bit_stream );
+	window_buffer = stream->window_buffer;
+	window_offset = stream->window_offset;
+
+	while( window_offset <= ( DEFLATE_STREAM_WINDOW_BUFFER_SIZE - DEFLATE_STREAM_MAXIMUM_MATCH_SIZE ) )
+	{
+		/* Only decode the next symbol if it cannot be cut off by the end of the input buffer,
+		 * unless there is no more input
+		 */
+		if( end_of_input == 0 )
+		{
+			available_bits = (size_t) bit_stream->bit_buffer_size
+			               + ( ( bit_stream->byte_stream_size - bit_stream->byte_stream_offset ) * 8 );
+
+			if( available_bits < DEFLATE_STREAM_MAXIMUM_SYMBOL_BITS )
+			{
+				break;
+			}
+		}
+		if( deflate_bit_stream_get_huffman_encoded_value(
+		     bit_stream,
+		     stream->literals_table,
+		     &code_value,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve literal value from bit stream.",
+			 function );
+
+			result = -1;
+
+			break;
+		}
+		if( code_value < 256 )
+		{
+			window_buffer[ window_offset++ ] = (uint8_t) code_value;
+
+			continue;
+		}
+		if( code_value == 256 )
+		{
+			result = 1;
+
+			break;
+		}
+		if( code_value >= 286 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+			 "%s: invalid code value: %" PRIu32 ".",
+			 function,
+			 code_value );
+
+			result = -1;
+
+			break;
+		}
+		code_value -= 257;
+
+		if( deflate_bit_stream_get_value(
+		     bit_stream,
+		     (uint8_t) deflate_literal_codes_number_of_extra_bits[ code_value ],
+		     &extra_bits,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve literal extra value from bit stream.",
+			 function );
+
+			result = -1;
+
+			break;
+		}
+		compression_size = deflate_literal_codes_base[ code_value ] + (uint16_t) extra_bits;
+
+		if( deflate_bit_stream_get_huffman_encoded_value(
+		     bit_stream,
+		     stream->distances_table,
+		     &code_value,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve distance value from bit stream.",
+			 function );
+
+			result = -1;
+
+			break;
+		}
+		if( code_value >= 30 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+			 "%s: invalid distance code value out of bounds.",
+			 function );
+
+			result = -1;
+
+			break;
+		}
+		if( deflate_bit_stream_get_value(
+		     bit_stream,
+		     (uint8_t) deflate_distance_codes_number_of_extra_bits[ code_value ],
+		     &extra_bits,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve distance extra value from bit stream.",
+			 function );
+
+			result = -1;
+
+			break;
+		}
+		compression_offset = deflate_distance_codes_base[ code_value ] + (uint16_t) extra_bits;
+
+		if( (size_t) compression_offset > window_offset )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+			 "%s: invalid compression offset value out of bounds.",
+			 function );
+
+			result = -1;
+
+			break;
+		}
+		lz_match_copy(
+		 window_buffer,
+		 DEFLATE_STREAM_WINDOW_BUFFER_SIZE + LZ_MATCH_COPY_SLACK_SIZE,
+		 window_offset,
+		 (size_t) compression_offset,
+		 (size_t) compression_size );
+
+		window_offset += compression_size;
+	}
+	stream->window_offset = window_offset;
+
+	return( result );
+}
+
+/* Decompresses zlib compressed data in chunks
+ * The compressed data is added to the input buffer of the stream, on return
+ * compressed_data_size contains the number of bytes that were added and
+ * uncompressed_data_size the number of bytes of uncompressed data that were returned
+ * Set DEFLATE_STREAM_FLAG_END_OF_INPUT in flags if the compressed data contains
+ * the remainder of the input and DEFLATE_STREAM_FLAG_IGNORE_CHECKSUM to not calculate
+ * and verify the Adler-32, the latter must be set on every call
+ * Set DEFLATE_STREAM_FLAG_RAW on every call if the compressed data has no zlib header
+ * and Adler-32, at the end of the stream the input buffer then contains the bytes
+ * after the byte that contains the end of the last block
+ * Set DEFLATE_STREAM_FLAG_STOP_AT_BLOCK to return at the start of every block, which
+ * is indicated by stopped_at_block, the stream then is at an access point
+ * Returns 1 if the end of the stream was reached, 0 if more input data or uncompressed data space is required or -1 on error
+ */
+int deflate_stream_decompress(
+     deflate_stream_t *stream,
+     const uint8_t *compressed_data,
+     size_t *compressed_data_size,
+     uint8_t *uncompressed_data,
+     size_t *uncompressed_data_size,
+     uint8_t flags,
+     libcerror_error_t **error )
+{
+	deflate_bit_stream_t *bit_stream = NULL;
+	const uint8_t *header_data       = NULL;
+	static char *function            = "deflate_stream_decompress";
+	size_t available_size            = 0;
+	size_t copy_size                 = 0;
+	size_t move_offset               = 0;
+	size_t uncompressed_data_offset  = 0;
+	uint32_t block_size_copy         = 0;
+	uint32_t stored_checksum         = 0;
+	uint32_t value_32bit             = 0;
+	uint8_t block_type               = 0;
+	uint8_t end_of_input             = 0;
+	uint8_t need_input               = 0;
+	int result                       = 0;
+
+	if( stream == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid stream.",
+		 function );
+
+		return( -1 );
+	}
+	if( compressed_data_size == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid compressed data size.",
+		 function );
+
+		return( -1 );
+	}
+	if( *compressed_data_size > (size_t) SSIZE_MAX )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid compressed data size value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( compressed_data == NULL )
+	 && ( *compressed_data_size > 0 ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid compressed data.",
+		 function );
+
+		return( -1 );
+	}
+	if( uncompressed_data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid uncompressed data.",
+		 function );
+
+		return( -1 );
+	}
+	if( uncompressed_data_size == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid uncompressed data size.",
+		 function );
+
+		return( -1 );
+	}
+	if( *uncompressed_data_size > (size_t) SSIZE_MAX )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid uncompressed data size value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	bit_stream = &( stream->bit_stream );
+
+	stream->stopped_at_block = 0;
+
+	/* Move the remaining input to the start of the input buffer
+	 * if it does not overlap with the start of the input buffer
+	 * The whole bytes in the bit buffer are kept so that they can be
+	 * returned to the byte stream at the start of an uncompressed block
+	 */
+	move_offset    = bit_stream->byte_stream_offset - ( bit_stream->bit_buffer_size >> 3 );
+	available_size = bit_stream->byte_stream_size - move_offset;
+
+	if( ( move_offset > 0 )
+	 && ( available_size <= move_offset ) )
+	{
+		if( available_size > 0 )
+		{
+			if( memory_copy(
+			     stream->input_buffer,
+			     &( stream->input_buffer[ move_offset ] ),
+			     available_size ) == NULL )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_MEMORY,
+				 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+				 "%s: unable to move input data.",
+				 function );
+
+				return( -1 );
+			}
+		}
+		bit_stream->byte_stream_offset -= move_offset;
+		bit_stream->byte_stream_size    = available_size;
+	}
+	copy_size = DEFLATE_STREAM_INPUT_BUFFER_SIZE - bit_stream->byte_stream_size;
+
+	if( copy_size > *compressed_data_size )
+	{
+		copy_size = *compressed_data_size;
+	}
+	if( copy_size > 0 )
+	{
+		if( memory_copy(
+		     &( stream->input_buffer[ bit_stream->byte_stream_size ] ),
+		     compressed_data,
+		     copy_size ) == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+			 "%s: unable to copy compressed data to input buffer.",
+			 function );
+
+			return( -1 );
+		}
+		bit_stream->byte_stream_size   += copy_size;
+		stream->compressed_data_offset += copy_size;
+	}
+	/* The input only ends if all compressed data fitted in the input buffer
+	 */
+	if( ( ( flags & DEFLATE_STREAM_FLAG_END_OF_INPUT ) != 0 )
+	 && ( copy_size == *compressed_data_size ) )
+	{
+		end_of_input = 1;
+	}
+	*compressed_data_size = copy_size;
+
+	while( need_input == 0 )
+	{
+		/* Return the decompressed data that is in the window buffer
+		 */
+		copy_size = stream->window_offset - stream->output_offset;
+
+		if( copy_size > ( *uncompressed_data_size - uncompressed_data_offset ) )
+		{
+			copy_size = *uncompressed_data_size - uncompressed_data_offset;
+		}
+		if( copy_size > 0 )
+		{
+			if( memory_copy(
+			     &( uncompressed_data[ uncompressed_data_offset ] ),
+			     &( stream->window_buffer[ stream->output_offset ] ),
+			     copy_size ) == NULL )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_MEMORY,
+				 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+				 "%s: unable to copy uncompressed data.",
+				 function );
+
+				return( -1 );
+			}
+			if( ( flags & ( DEFLATE_STREAM_FLAG_IGNORE_CHECKSUM | DEFLATE_STREAM_FLAG_RAW ) ) == 0 )
+			{
+				if( deflate_calculate_adler32(
+				     &( stream->calculated_checksum ),
+				     &( uncompressed_data[ uncompressed_data_offset ] ),
+				     copy_size,
+				     stream->calculated_checksum,
+				     error ) != 1 )
+				{
+					libcerror_error_set(
+					 error,
+					 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+					 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+					 "%s: unable to calculate checksum.",
+					 function );
+
+					return( -1 );
+				}
+			}
+			stream->output_offset            += copy_size;
+			stream->uncompressed_data_offset += copy_size;
+			uncompressed_data_offset         += copy_size;
+		}
+		if( stream->output_offset < stream->window_offset )
+		{
+			break;
+		}
+		if( stream->state == DEFLATE_STREAM_STATE_END_OF_STREAM )
+		{
+			result = 1;
+
+			break;
+		}
+		/* Keep the last part of the decompressed data as the sliding window
+		 * once the window buffer cannot contain another match
+		 */
+		if( stream->window_offset > ( DEFLATE_STREAM_WINDOW_BUFFER_SIZE - DEFLATE_STREAM_MAXIMUM_MATCH_SIZE ) )
+		{
+			if( memory_copy(
+			     stream->window_buffer,
+			     &( stream->window_buffer[ stream->window_offset - DEFLATE_STREAM_WINDOW_SIZE ] ),
+			     DEFLATE_STREAM_WINDOW_SIZE ) == NULL )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_MEMORY,
+				 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+				 "%s: unable to move sliding window.",
+				 function );
+
+				return( -1 );
+			}
+			stream->window_offset = DEFLATE_STREAM_WINDOW_SIZE;
+			stream->output_offset = DEFLATE_STREAM_WINDOW_SIZE;
+		}
+		if( ( ( flags & DEFLATE_STREAM_FLAG_STOP_AT_BLOCK ) != 0 )
+		 && ( stream->stop_pending != 0 ) )
+		{
+			stream->stop_pending     = 0;
+			stream->stopped_at_block = 1;
+
+			break;
+		}
+		available_size = bit_stream->byte_stream_size - bit_stream->byte_stream_offset;
+
+		switch( stream->state )
+		{
+			case DEFLATE_STREAM_STATE_HEADER:
+				if( ( flags & DEFLATE_STREAM_FLAG_RAW ) != 0 )
+				{
+					stream->state        = DEFLATE_STREAM_STATE_BLOCK_HEADER;
+					stream->stop_pending = 1;
+
+					break;
+				}
+				if( available_size < 2 )
+				{
+					need_input = 1;
+
+					break;
+				}
+				header_data = &( stream->input_buffer[ bit_stream->byte_stream_offset ] );
+
+				if( ( header_data[ 0 ] & 0x0f ) != 8 )
+				{
+					libcerror_error_set(
+					 error,
+					 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+					 LIBCERROR_RUNTIME_ERROR_UNSUPPORTED_VALUE,
+					 "%s: unsupported compression method: %" PRIu8 ".",
+					 function,
+					 header_data[ 0 ] & 0x0f );
+
+					return( -1 );
+				}
+				if( ( header_data[ 0 ] >> 4 ) > 7 )
+				{
+					libcerror_error_set(
+					 error,
+					 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+					 LIBCERROR_RUNTIME_ERROR_UNSUPPORTED_VALUE,
+					 "%s: unsupported compression window size: %" PRIu32 ".",
+					 function,
+					 (uint32_t) 1 << ( ( header_data[ 0 ] >> 4 ) + 8 ) );
+
+					return( -1 );
+				}
+				if( ( ( ( (uint16_t) header_data[ 0 ] << 8 ) | header_data[ 1 ] ) % 31 ) != 0 )
+				{
+					libcerror_error_set(
+					 error,
+					 LIBCERROR_ERROR_DOMAIN_INPUT,
+					 LIBCERROR_INPUT_ERROR_VALUE_MISMATCH,
+					 "%s: invalid header check bits.",
+					 function );
+
+					return( -1 );
+				}
+				/* The preset dictionary identifier is ignored
+				 */
+				if( ( header_data[ 1 ] & 0x20 ) != 0 )
+				{
+					if( available_size < 6 )
+					{
+						need_input = 1;
+
+						break;
+					}
+					bit_stream->byte_stream_offset += 4;
+				}
+				bit_stream->byte_stream_offset += 2;
+
+				stream->state        = DEFLATE_STREAM_STATE_BLOCK_HEADER;
+				stream->stop_pending = 1;
+
+				break;
+
+			case DEFLATE_STREAM_STATE_BLOCK_HEADER:
+				if( ( bit_stream->bit_buffer_size < 3 )
+				 && ( available_size == 0 ) )
+				{
+					need_input = 1;
+
+					break;
+				}
+				if( deflate_bit_stream_get_value(
+				     bit_stream,
+				     3,
+				     &value_32bit,
+				     error ) != 1 )
+				{
+					libcerror_error_set(
+					 error,
+					 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+					 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+					 "%s: unable to retrieve block header from bit stream.",
+					 function );
+
+					return( -1 );
+				}
+				stream->last_block_flag = (uint8_t) ( value_32bit & 0x00000001UL );
+				stream->stop_pending    = 0;
+				block_type              = (uint8_t) ( value_32bit >> 1 );
+
+				switch( block_type )
+				{
+					case DEFLATE_BLOCK_TYPE_UNCOMPRESSED:
+						stream->state = DEFLATE_STREAM_STATE_UNCOMPRESSED_BLOCK_HEADER;
+						break;
+
+					case DEFLATE_BLOCK_TYPE_HUFFMAN_FIXED:
+						stream->literals_table  = &deflate_fixed_huffman_literals_table;
+						stream->distances_table = &deflate_fixed_huffman_distances_table;
+						stream->state           = DEFLATE_STREAM_STATE_HUFFMAN_DATA;
+						break;
+
+					case DEFLATE_BLOCK_TYPE_HUFFMAN_DYNAMIC:
+						stream->state = DEFLATE_STREAM_STATE_DYNAMIC_HUFFMAN_TABLES;
+						break;
+
+					case DEFLATE_BLOCK_TYPE_RESERVED:
+					default:
+						libcerror_error_set(
+						 error,
+						 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+						 LIBCERROR_RUNTIME_ERROR_UNSUPPORTED_VALUE,
+						 "%s: unsupported block type.",
+						 function );
+
+						return( -1 );
+				}
+				break;
+
+			case DEFLATE_STREAM_STATE_UNCOMPRESSED_BLOCK_HEADER:
+			case DEFLATE_STREAM_STATE_CHECKSUM:
+				/* Ignore the bits in the buffer upto the next byte and return
+				 * the bytes remaining in the bit buffer to the byte stream
+				 */
+				bit_stream->byte_stream_offset -= bit_stream->bit_buffer_size >> 3;
+				bit_stream->bit_buffer          = 0;
+				bit_stream->bit_buffer_size     = 0;
+
+				available_size = bit_stream->byte_stream_size - bit_stream->byte_stream_offset;
+
+				if( available_size < 4 )
+				{
+					need_input = 1;
+
+					break;
+				}
+				if( stream->state == DEFLATE_STREAM_STATE_CHECKSUM )
+				{
+					byte_stream_copy_to_uint32_big_endian(
+					 &( stream->input_buffer[ bit_stream->byte_stream_offset ] ),
+					 stored_checksum );
+
+					bit_stream->byte_stream_offset += 4;
+
+					if( ( ( flags & DEFLATE_STREAM_FLAG_IGNORE_CHECKSUM ) == 0 )
+					 && ( stored_checksum != stream->calculated_checksum ) )
+					{
+						libcerror_error_set(
+						 error,
+						 LIBCERROR_ERROR_DOMAIN_INPUT,
+						 LIBCERROR_INPUT_ERROR_CHECKSUM_MISMATCH,
+						 "%s: checksum does not match (stored: 0x%08" PRIx32 ", calculated: 0x%08" PRIx32 ").",
+						 function,
+						 stored_checksum,
+						 stream->calculated_checksum );
+
+						return( -1 );
+					}
+					stream->state = DEFLATE_STREAM_STATE_END_OF_STREAM;
+
+					break;
+				}
+				byte_stream_copy_to_uint16_little_endian(
+				 &( stream->input_buffer[ bit_stream->byte_stream_offset ] ),
+				 stream->block_size );
+
+				byte_stream_copy_to_uint16_little_endian(
+				 &( stream->input_buffer[ bit_stream->byte_stream_offset + 2 ] ),
+				 block_size_copy );
+
+				bit_stream->byte_stream_offset += 4;
+
+				block_size_copy ^= 0x0000ffffUL;
+
+				if( stream->block_size != block_size_copy )
+				{
+					libcerror_error_set(
+					 error,
+					 LIBCERROR_ERROR_DOMAIN_INPUT,
+					 LIBCERROR_INPUT_ERROR_VALUE_MISMATCH,
+					 "%s: mismatch in block size ( %" PRIu32 " != %" PRIu32 " ).",
+					 function,
+					 stream->block_size,
+					 block_size_copy );
+
+					return( -1 );
+				}
+				stream->state = DEFLATE_STREAM_STATE_UNCOMPRESSED_BLOCK_DATA;
+
+				break;
+
+			case DEFLATE_STREAM_STATE_UNCOMPRESSED_BLOCK_DATA:
+				if( stream->block_size == 0 )
+				{
+					stream->state = DEFLATE_STREAM_STATE_END_OF_BLOCK;
+
+					break;
+				}
+				copy_size = DEFLATE_STREAM_WINDOW_BUFFER_SIZE - stream->window_offset;
+
+				if( copy_size > available_size )
+				{
+					copy_size = available_size;
+				}
+				if( copy_size > (size_t) stream->block_size )
+				{
+					copy_size = (size_t) stream->block_size;
+				}
+				if( copy_size == 0 )
+				{
+					need_input = 1;
+
+					break;
+				}
+				if( memory_copy(
+				     &( stream->window_buffer[ stream->window_offset ] ),
+				     &( stream->input_buffer[ bit_stream->byte_stream_offset ] ),
+				     copy_size ) == NULL )
+				{
+					libcerror_error_set(
+					 error,
+					 LIBCERROR_ERROR_DOMAIN_MEMORY,
+					 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+					 "%s: unable to copy uncompressed block data.",
+					 function );
+
+					return( -1 );
+				}
+				bit_stream->byte_stream_offset += copy_size;
+				stream->window_offset          += copy_size;
+				stream->block_size             -= (uint32_t) copy_size;
+
+				break;
+
+			case DEFLATE_STREAM_STATE_DYNAMIC_HUFFMAN_TABLES:
+				if( ( end_of_input == 0 )
+				 && ( available_size < DEFLATE_STREAM_MAXIMUM_DYNAMIC_HEADER_SIZE ) )
+				{
+					need_input = 1;
+
+					break;
+				}
+				if( deflate_initialize_dynamic_huffman_tables(
+				     bit_stream,
+				     &( stream->dynamic_huffman_literals_table ),
+				     &( stream->dynamic_huffman_distances_table ),
+				     error ) != 1 )
+				{
+					libcerror_error_set(
+					 error,
+					 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+					 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+					 "%s: unable to initialize dynamic Huffman tables.",
+					 function );
+
+					return( -1 );
+				}
+				stream->literals_table  = &( stream->dynamic_huffman_literals_table );
+				stream->distances_table = &( stream->dynamic_huffman_distances_table );
+				stream->state           = DEFLATE_STREAM_STATE_HUFFMAN_DATA;
+
+				break;
+
+			case DEFLATE_STREAM_STATE_HUFFMAN_DATA:
+				result = deflate_stream_decode_huffman(
+				          stream,
+				          end_of_input,
+				          error );
+
+				if( result == -1 )
+				{
+					libcerror_error_set(
+					 error,
+					 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+					 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+					 "%s: unable to decode Huffman encoded data.",
+					 function );
+
+					return( -1 );
+				}
+				else if( result == 1 )
+				{
+					stream->state = DEFLATE_STREAM_STATE_END_OF_BLOCK;
+				}
+				else if( stream->window_offset <= ( DEFLATE_STREAM_WINDOW_BUFFER_SIZE - DEFLATE_STREAM_MAXIMUM_MATCH_SIZE ) )
+				{
+					need_input = 1;
+				}
+				result = 0;
+
+				break;
+
+			case DEFLATE_STREAM_STATE_END_OF_BLOCK:
+				if( ( stream->last_block_flag != 0 )
+				 && ( ( flags & DEFLATE_STREAM_FLAG_RAW ) != 0 ) )
+				{
+					/* Return the bytes remaining in the bit buffer to the byte stream
+					 */
+					bit_stream->byte_stream_offset -= bit_stream->bit_buffer_size >> 3;
+					bit_stream->bit_buffer          = 0;
+					bit_stream->bit_buffer_size     = 0;
+
+					stream->state = DEFLATE_STREAM_STATE_END_OF_STREAM;
+				}
+				else if( stream->last_block_flag != 0 )
+				{
+					stream->state = DEFLATE_STREAM_STATE_CHECKSUM;
+				}
+				else
+				{
+					stream->state        = DEFLATE_STREAM_STATE_BLOCK_HEADER;
+					stream->stop_pending = 1;
+				}
+				break;
+
+			default:
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_UNSUPPORTED_VALUE,
+				 "%s: unsupported state: %d.",
+				 function,
+				 stream->state );
+
+				return( -1 );
+		}
+	}
+	if( ( need_input != 0 )
+	 && ( end_of_input != 0 ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_TOO_SMALL,
+		 "%s: invalid compressed data value too small.",
+		 function );
+
+		return( -1 );
+	}
+	*uncompressed_data_size = uncompressed_data_offset;
+
+	return( result );
+}
+
+
+/* Retrieves the access point at the start of the current block
+ * The access point consists of the offset of the block in the compressed data in bits,
+ * the offset of the block in the uncompressed data and the sliding window
+ * Returns 1 if successful, 0 if the stream is not at the start of a block or -1 on error
+ */
+int deflate_stream_get_access_point(
+     deflate_stream_t *stream,
+     uint64_t *compressed_bit_offset,
+     uint64_t *uncompressed_offset,
+     uint8_t *window_data,
+     size_t window_data_size,
+     size_t *window_size,
+     libcerror_error_t **error )
+{
+	deflate_bit_stream_t *bit_stream = NULL;
+	static char *function            = "deflate_stream_get_access_point";
+	size_t safe_window_size          = 0;
+
+	if( stream == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid stream.",
+		 function );
+
+		return( -1 );
+	}
+	if( compressed_bit_offset == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid compressed bit offset.",
+		 function );
+
+		return( -1 );
+	}
+	if( uncompressed_offset == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid uncompressed offset.",
+		 function );
+
+		return( -1 );
+	}
+	if( window_data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid window data.",
+		 function );
+
+		return( -1 );
+	}
+	if( window_data_size < DEFLATE_STREAM_WINDOW_SIZE )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_TOO_SMALL,
+		 "%s: invalid window data size value too small.",
+		 function );
+
+		return( -1 );
+	}
+	if( window_size == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid window size.",
+		 function );
+
+		return( -1 );
+	}
+	/* All the uncompressed data of the previous blocks must have been returned
+	 */
+	if( ( stream->state != DEFLATE_STREAM_STATE_BLOCK_HEADER )
+	 || ( stream->output_offset != stream->window_offset ) )
+	{
+		return( 0 );
+	}
+	bit_stream = &( stream->bit_stream );
+
+	/* The bits in the bit buffer and the bytes remaining in the input buffer
+	 * have been added but not consumed
+	 */
+	*compressed_bit_offset = ( stream->compressed_data_offset * 8 )
+	                       - ( ( bit_stream->byte_stream_size - bit_stream->byte_stream_offset ) * 8 )
+	                       - bit_stream->bit_buffer_size;
+	*uncompressed_offset   = stream->uncompressed_data_offset;
+
+	safe_window_size = stream->window_offset;
+
+	if( safe_window_size > DEFLATE_STREAM_WINDOW_SIZE )
+	{
+		safe_window_size = DEFLATE_STREAM_WINDOW_SIZE;
+	}
+	if( safe_window_size > 0 )
+	{
+		if( memory_copy(
+		     window_data,
+		     &( stream->window_buffer[ stream->window_offset - safe_window_size ] ),
+		     safe_window_size ) == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+			 "%s: unable to copy window data.",
+			 function );
+
+			return( -1 );
+		}
+	}
+	*window_size = safe_window_size;
+
+	return( 1 );
+}
+
+/* Primes a stream to continue decompression at an access point
+ * If the compressed bit offset is not a multiple of 8, first_byte must contain
+ * the byte at compressed_bit_offset / 8 and the compressed data must be added from
+ * the next byte, otherwise first_byte is ignored and the compressed data must be added
+ * from the byte at compressed_bit_offset / 8
+ * The compressed data must be decompressed with DEFLATE_STREAM_FLAG_RAW
+ * Returns 1 if successful or -1 on error
+ */
+int deflate_stream_set_access_point(
+     deflate_stream_t *stream,
+     uint64_t compressed_bit_offset,
+     uint64_t uncompressed_offset,
+     uint8_t first_byte,
+     const uint8_t *window_data,
+     size_t window_size,
+     libcerror_error_t **error )
+{
+	static char *function = "deflate_stream_set_access_point";
+	uint8_t bit_index     = 0;
+
+	if( stream == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid stream.",
+		 function );
+
+		return( -1 );
+	}
+	if( window_size > DEFLATE_STREAM_WINDOW_SIZE )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid window size value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( window_data == NULL )
+	 && ( window_size > 0 ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid window data.",
+		 function );
+
+		return( -1 );
+	}
+	if( deflate_stream_reset(
+	     stream,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to reset stream.",
+		 function );
+
+		return( -1 );
+	}
+	if( window_size > 0 )
+	{
+		if( memory_copy(
+		     stream->window_buffer,
+		     window_data,
+		     window_size ) == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+			 "%s: unable to copy window data.",
+			 function );
+
+			return( -1 );
+		}
+	}
+	bit_index = (uint8_t) ( compressed_bit_offset & 0x07 );
+
+	if( bit_index > 0 )
+	{
+		stream->bit_stream.bit_buffer      = (uint64_t) ( first_byte >> bit_index );
+		stream->bit_stream.bit_buffer_size = 8 - bit_index;
+	}
+	stream->state                    = DEFLATE_STREAM_STATE_BLOCK_HEADER;
+	stream->stop_pending             = 1;
+	stream->window_offset            = window_size;
+	stream->output_offset            = window_size;
+	stream->compressed_data_offset   = ( compressed_bit_offset + 7 ) >> 3;
+	stream->uncompressed_data_offset = uncompressed_offset;
+
+	return( 1 );
+}
@@ -0,0 +1,218 @@
+/*
+ * Deflate (zlib) streaming decompression functions
+ *
+ * Copyright (C) 2008-2019, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This software is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This software is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this software.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#if !defined( _DEFLATE_STREAM_H )
+#define _DEFLATE_STREAM_H
+
+#include <common.h>
+#include <lz_match.h>
+#include <types.h>
+
+#include "assorted_libcerror.h"
+#include "deflate.h"
+
+#if defined( __cplusplus )
+extern "C" {
+#endif
+
+/* The size of the input buffer
+ */
+#define DEFLATE_STREAM_INPUT_BUFFER_SIZE	( 64 * 1024 )
+
+/* The maximum size of the sliding window
+ */
+#define DEFLATE_STREAM_WINDOW_SIZE		32768
+
+/* The size of the window buffer, the decompressed data is
+ * moved to the start of the buffer once the buffer is full
+ * and only the last DEFLATE_STREAM_WINDOW_SIZE bytes are kept
+ */
+#define DEFLATE_STREAM_WINDOW_BUFFER_SIZE	( 4 * DEFLATE_STREAM_WINDOW_SIZE )
+
+/* The maximum size of a match
+ */
+#define DEFLATE_STREAM_MAXIMUM_MATCH_SIZE	258
+
+/* The maximum number of bits of a literal and length code, a distance code and their extra bits
+ */
+#define DEFLATE_STREAM_MAXIMUM_SYMBOL_BITS	48
+
+/* The maximum size of the dynamic Huffman table definitions in a block header
+ * 14 bits for the header, 19 x 3 bits for the codes table and up to 318 codes
+ * of at most 7 bits with 7 extra bits
+ */
+#define DEFLATE_STREAM_MAXIMUM_DYNAMIC_HEADER_SIZE	576
+
+/* The flags
+ */
+enum DEFLATE_STREAM_FLAGS
+{
+	DEFLATE_STREAM_FLAG_END_OF_INPUT	= 0x01,
+	DEFLATE_STREAM_FLAG_IGNORE_CHECKSUM	= 0x02,
+
+	/* The compressed data is raw deflate data, without zlib header and Adler-32
+	 */
+	DEFLATE_STREAM_FLAG_RAW			= 0x04,
+
+	/* Stop at the start of every block, once the uncompressed data
+	 * of the previous blocks has been returned
+	 */
+	DEFLATE_STREAM_FLAG_STOP_AT_BLOCK	= 0x08
+};
+
+/* The states
+ */
+enum DEFLATE_STREAM_STATES
+{
+	DEFLATE_STREAM_STATE_HEADER,
+	DEFLATE_STREAM_STATE_BLOCK_HEADER,
+	DEFLATE_STREAM_STATE_UNCOMPRESSED_BLOCK_HEADER,
+	DEFLATE_STREAM_STATE_UNCOMPRESSED_BLOCK_DATA,
+	DEFLATE_STREAM_STATE_DYNAMIC_HUFFMAN_TABLES,
+	DEFLATE_STREAM_STATE_HUFFMAN_DATA,
+	DEFLATE_STREAM_STATE_END_OF_BLOCK,
+	DEFLATE_STREAM_STATE_CHECKSUM,
+	DEFLATE_STREAM_STATE_END_OF_STREAM
+};
+
+typedef struct deflate_stream deflate_stream_t;
+
+struct deflate_stream
+{
+	/* The state
+	 */
+	int state;
+
+	/* The input buffer
+	 */
+	uint8_t input_buffer[ DEFLATE_STREAM_INPUT_BUFFER_SIZE ];
+
+	/* The bit stream of the input buffer
+	 */
+	deflate_bit_stream_t bit_stream;
+
+	/* The window buffer, the remainder is used as slack by lz_match_copy
+	 */
+	uint8_t window_buffer[ DEFLATE_STREAM_WINDOW_BUFFER_SIZE + LZ_MATCH_COPY_SLACK_SIZE ];
+
+	/* The window offset, which is the end of the decompressed data in the window buffer
+	 */
+	size_t window_offset;
+
+	/* The output offset, which is the start of the decompressed data in the window buffer
+	 * that has not been returned yet
+	 */
+	size_t output_offset;
+
+	/* The dynamic Huffman literals table
+	 */
+	deflate_huffman_table_t dynamic_huffman_literals_table;
+
+	/* The dynamic Huffman distances table
+	 */
+	deflate_huffman_table_t dynamic_huffman_distances_table;
+
+	/* The Huffman literals table of the current block
+	 */
+	const deflate_huffman_table_t *literals_table;
+
+	/* The Huffman distances table of the current block
+	 */
+	const deflate_huffman_table_t *distances_table;
+
+	/* The number of bytes remaining in the current uncompressed block
+	 */
+	uint32_t block_size;
+
+	/* Value to indicate the current block is the last block
+	 */
+	uint8_t last_block_flag;
+
+	/* Value to indicate the start of the current block has not been stopped at
+	 */
+	uint8_t stop_pending;
+
+	/* Value to indicate the last call stopped at the start of a block
+	 */
+	uint8_t stopped_at_block;
+
+	/* The offset of the end of the compressed data that was added to the input buffer
+	 */
+	uint64_t compressed_data_offset;
+
+	/* The offset of the end of the uncompressed data that was returned
+	 */
+	uint64_t uncompressed_data_offset;
+
+	/* The calculated Adler-32 of the decompressed data that has been returned
+	 */
+	uint32_t calculated_checksum;
+};
+
+int deflate_stream_initialize(
+     deflate_stream_t **stream,
+     libcerror_error_t **error );
+
+int deflate_stream_free(
+     deflate_stream_t **stream,
+     libcerror_error_t **error );
+
+int deflate_stream_reset(
+     deflate_stream_t *stream,
+     libcerror_error_t **error );
+
+int deflate_stream_restart(
+     deflate_stream_t *stream,
+     libcerror_error_t **error );
+
+int deflate_stream_decompress(
+     deflate_stream_t *stream,
+     const uint8_t *compressed_data,
+     size_t *compressed_data_size,
+     uint8_t *uncompressed_data,
+     size_t *uncompressed_data_size,
+     uint8_t flags,
+     libcerror_error_t **error );
+
+int deflate_stream_get_access_point(
+     deflate_stream_t *stream,
+     uint64_t *compressed_bit_offset,
+     uint64_t *uncompressed_offset,
+     uint8_t *window_data,
+     size_t window_data_size,
+     size_t *window_size,
+     libcerror_error_t **error );
+
+int deflate_stream_set_access_point(
+     deflate_stream_t *stream,
+     uint64_t compressed_bit_offset,
+     uint64_t uncompressed_offset,
+     uint8_t first_byte,
+     const uint8_t *window_data,
+     size_t window_size,
+     libcerror_error_t **error );
+
+#if defined( __cplusplus )
+}
+#endif
+
+#endif /* !defined( _DEFLATE_STREAM_H ) */
+
@@ -0,0 +1,223 @@
+/*
+ * Deflate fixed Huffman tables
+ *
+ * This file was generated by scripts/deflate_tables.py, do not edit.
+ *
+ * Copyright (C) 2008-2019, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This software is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This software is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this software.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <types.h>
+
+#include "deflate.h"
+#include "deflate_tables.h"
+
+/* The fixed Huffman literals and lengths table
+ * The secondary lookup tables are not used since the codes are at most 9 bits
+ */
+const deflate_huffman_table_t deflate_fixed_huffman_literals_table = {
+	15,
+	{
+		256, 257, 258, 259, 260, 261, 262, 263, 264, 265, 266, 267, 268, 269, 270, 271,
+		272, 273, 274, 275, 276, 277, 278, 279, 0, 1, 2, 3, 4, 5, 6, 7,
+		8, 9, 10, 11, 12, 13, 14, 15, 16, 17, 18, 19, 20, 21, 22, 23,
+		24, 25, 26, 27, 28, 29, 30, 31, 32, 33, 34, 35, 36, 37, 38, 39,
+		40, 41, 42, 43, 44, 45, 46, 47, 48, 49, 50, 51, 52, 53, 54, 55,
+		56, 57, 58, 59, 60, 61, 62, 63, 64, 65, 66, 67, 68, 69, 70, 71,
+		72, 73, 74, 75, 76, 77, 78, 79, 80, 81, 82, 83, 84, 85, 86, 87,
+		88, 89, 90, 91, 92, 93, 94, 95, 96, 97, 98, 99, 100, 101, 102, 103,
+		104, 105, 106, 107, 108, 109, 110, 111, 112, 113, 114, 115, 116, 117, 118, 119,
+		120, 121, 122, 123, 124, 125, 126, 127, 128, 129, 130, 131, 132, 133, 134, 135,
+		136, 137, 138, 139, 140, 141, 142, 143, 280, 281, 282, 283, 284, 285, 286, 287,
+		144, 145, 146, 147, 148, 149, 150, 151, 152, 153, 154, 155, 156, 157, 158, 159,
+		160, 161, 162, 163, 164, 165, 166, 167, 168, 169, 170, 171, 172, 173, 174, 175,
+		176, 177, 178, 179, 180, 181, 182, 183, 184, 185, 186, 187, 188, 189, 190, 191,
+		192, 193, 194, 195, 196, 197, 198, 199, 200, 201, 202, 203, 204, 205, 206, 207,
+		208, 209, 210, 211, 212, 213, 214, 215, 216, 217, 218, 219, 220, 221, 222, 223,
+		224, 225, 226, 227, 228, 229, 230, 231, 232, 233, 234, 235, 236, 237, 238, 239,
+		240, 241, 242, 243, 244, 245, 246, 247, 248, 249, 250, 251, 252, 253, 254, 255
+	},
+	{
+		0, 0, 0, 0, 0, 0, 0, 24, 152, 112, 0, 0, 0, 0, 0, 0
+	},
+	16,
+	{
+		0x0f00, 0x1050, 0x1010, 0x1118, 0x0f10, 0x1070, 0x1030, 0x12c0,
+		0x0f08, 0x1060, 0x1020, 0x12a0, 0x1000, 0x1080, 0x1040, 0x12e0,
+		0x0f04, 0x1058, 0x1018, 0x1290, 0x0f14, 0x1078, 0x1038, 0x12d0,
+		0x0f0c, 0x1068, 0x1028, 0x12b0, 0x1008, 0x1088, 0x1048, 0x12f0,
+		0x0f02, 0x1054, 0x1014, 0x111c, 0x0f12, 0x1074, 0x1034, 0x12c8,
+		0x0f0a, 0x1064, 0x1024, 0x12a8, 0x1004, 0x1084, 0x1044, 0x12e8,
+		0x0f06, 0x105c, 0x101c, 0x1298, 0x0f16, 0x107c, 0x103c, 0x12d8,
+		0x0f0e, 0x106c, 0x102c, 0x12b8, 0x100c, 0x108c, 0x104c, 0x12f8,
+		0x0f01, 0x1052, 0x1012, 0x111a, 0x0f11, 0x1072, 0x1032, 0x12c4,
+		0x0f09, 0x1062, 0x1022, 0x12a4, 0x1002, 0x1082, 0x1042, 0x12e4,
+		0x0f05, 0x105a, 0x101a, 0x1294, 0x0f15, 0x107a, 0x103a, 0x12d4,
+		0x0f0d, 0x106a, 0x102a, 0x12b4, 0x100a, 0x108a, 0x104a, 0x12f4,
+		0x0f03, 0x1056, 0x1016, 0x111e, 0x0f13, 0x1076, 0x1036, 0x12cc,
+		0x0f0b, 0x1066, 0x1026, 0x12ac, 0x1006, 0x1086, 0x1046, 0x12ec,
+		0x0f07, 0x105e, 0x101e, 0x129c, 0x0f17, 0x107e, 0x103e, 0x12dc,
+		0x0f0f, 0x106e, 0x102e, 0x12bc, 0x100e, 0x108e, 0x104e, 0x12fc,
+		0x0f00, 0x1051, 0x1011, 0x1119, 0x0f10, 0x1071, 0x1031, 0x12c2,
+		0x0f08, 0x1061, 0x1021, 0x12a2, 0x1001, 0x1081, 0x1041, 0x12e2,
+		0x0f04, 0x1059, 0x1019, 0x1292, 0x0f14, 0x1079, 0x1039, 0x12d2,
+		0x0f0c, 0x1069, 0x1029, 0x12b2, 0x1009, 0x1089, 0x1049, 0x12f2,
+		0x0f02, 0x1055, 0x1015, 0x111d, 0x0f12, 0x1075, 0x1035, 0x12ca,
+		0x0f0a, 0x1065, 0x1025, 0x12aa, 0x1005, 0x1085, 0x1045, 0x12ea,
+		0x0f06, 0x105d, 0x101d, 0x129a, 0x0f16, 0x107d, 0x103d, 0x12da,
+		0x0f0e, 0x106d, 0x102d, 0x12ba, 0x100d, 0x108d, 0x104d, 0x12fa,
+		0x0f01, 0x1053, 0x1013, 0x111b, 0x0f11, 0x1073, 0x1033, 0x12c6,
+		0x0f09, 0x1063, 0x1023, 0x12a6, 0x1003, 0x1083, 0x1043, 0x12e6,
+		0x0f05, 0x105b, 0x101b, 0x1296, 0x0f15, 0x107b, 0x103b, 0x12d6,
+		0x0f0d, 0x106b, 0x102b, 0x12b6, 0x100b, 0x108b, 0x104b, 0x12f6,
+		0x0f03, 0x1057, 0x1017, 0x111f, 0x0f13, 0x1077, 0x1037, 0x12ce,
+		0x0f0b, 0x1067, 0x1027, 0x12ae, 0x1007, 0x1087, 0x1047, 0x12ee,
+		0x0f07, 0x105f, 0x101f, 0x129e, 0x0f17, 0x107f, 0x103f, 0x12de,
+		0x0f0f, 0x106f, 0x102f, 0x12be, 0x100f, 0x108f, 0x104f, 0x12fe,
+		0x0f00, 0x1050, 0x1010, 0x1118, 0x0f10, 0x1070, 0x1030, 0x12c1,
+		0x0f08, 0x1060, 0x1020, 0x12a1, 0x1000, 0x1080, 0x1040, 0x12e1,
+		0x0f04, 0x1058, 0x1018, 0x1291, 0x0f14, 0x1078, 0x1038, 0x12d1,
+		0x0f0c, 0x1068, 0x1028, 0x12b1, 0x1008, 0x1088, 0x1048, 0x12f1,
+		0x0f02, 0x1054, 0x1014, 0x111c, 0x0f12, 0x1074, 0x1034, 0x12c9,
+		0x0f0a, 0x1064, 0x1024, 0x12a9, 0x1004, 0x1084, 0x1044, 0x12e9,
+		0x0f06, 0x105c, 0x101c, 0x1299, 0x0f16, 0x107c, 0x103c, 0x12d9,
+		0x0f0e, 0x106c, 0x102c, 0x12b9, 0x100c, 0x108c, 0x104c, 0x12f9,
+		0x0f01, 0x1052, 0x1012, 0x111a, 0x0f11, 0x1072, 0x1032, 0x12c5,
+		0x0f09, 0x1062, 0x1022, 0x12a5, 0x1002, 0x1082, 0x1042, 0x12e5,
+		0x0f05, 0x105a, 0x101a, 0x1295, 0x0f15, 0x107a, 0x103a, 0x12d5,
+		0x0f0d, 0x106a, 0x102a, 0x12b5, 0x100a, 0x108a, 0x104a, 0x12f5,
+		0x0f03, 0x1056, 0x1016, 0x111e, 0x0f13, 0x1076, 0x1036, 0x12cd,
+		0x0f0b, 0x1066, 0x1026, 0x12ad, 0x1006, 0x1086, 0x1046, 0x12ed,
+		0x0f07, 0x105e, 0x101e, 0x129d, 0x0f17, 0x107e, 0x103e, 0x12dd,
+		0x0f0f, 0x106e, 0x102e, 0x12bd, 0x100e, 0x108e, 0x104e, 0x12fd,
+		0x0f00, 0x1051, 0x1011, 0x1119, 0x0f10, 0x1071, 0x1031, 0x12c3,
+		0x0f08, 0x1061, 0x1021, 0x12a3, 0x1001, 0x1081, 0x1041, 0x12e3,
+		0x0f04, 0x1059, 0x1019, 0x1293, 0x0f14, 0x1079, 0x1039, 0x12d3,
+		0x0f0c, 0x1069, 0x1029, 0x12b3, 0x1009, 0x1089, 0x1049, 0x12f3,
+		0x0f02, 0x1055, 0x1015, 0x111d, 0x0f12, 0x1075, 0x1035, 0x12cb,
+		0x0f0a, 0x1065, 0x1025, 0x12ab, 0x1005, 0x1085, 0x1045, 0x12eb,
+		0x0f06, 0x105d, 0x101d, 0x129b, 0x0f16, 0x107d, 0x103d, 0x12db,
+		0x0f0e, 0x106d, 0x102d, 0x12bb, 0x100d, 0x108d, 0x104d, 0x12fb,
+		0x0f01, 0x1053, 0x1013, 0x111b, 0x0f11, 0x1073, 0x1033, 0x12c7,
+		0x0f09, 0x1063, 0x1023, 0x12a7, 0x1003, 0x1083, 0x1043, 0x12e7,
+		0x0f05, 0x105b, 0x101b, 0x1297, 0x0f15, 0x107b, 0x103b, 0x12d7,
+		0x0f0d, 0x106b, 0x102b, 0x12b7, 0x100b, 0x108b, 0x104b, 0x12f7,
+		0x0f03, 0x1057, 0x1017, 0x111f, 0x0f13, 0x1077, 0x1037, 0x12cf,
+		0x0f0b, 0x1067, 0x1027, 0x12af, 0x1007, 0x1087, 0x1047, 0x12ef,
+		0x0f07, 0x105f, 0x101f, 0x129f, 0x0f17, 0x107f, 0x103f, 0x12df,
+		0x0f0f, 0x106f, 0x102f, 0x12bf, 0x100f, 0x108f, 0x104f, 0x12ff
+	}
+};
+
+/* The fixed Huffman distances table
+ * The secondary lookup tables are not used since the codes are at most 9 bits
+ */
+const deflate_huffman_table_t deflate_fixed_huffman_distances_table = {
+	15,
+	{
+		0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15,
+		16, 17, 18, 19, 20, 21, 22, 23, 24, 25, 26, 27, 28, 29, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0
+	},
+	{
+		0, 0, 0, 0, 0, 30, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0
+	},
+	16,
+	{
+		0x0a00, 0x0a10, 0x0a08, 0x0a18, 0x0a04, 0x0a14, 0x0a0c, 0x0a1c,
+		0x0a02, 0x0a12, 0x0a0a, 0x0a1a, 0x0a06, 0x0a16, 0x0a0e, 0x0000,
+		0x0a01, 0x0a11, 0x0a09, 0x0a19, 0x0a05, 0x0a15, 0x0a0d, 0x0a1d,
+		0x0a03, 0x0a13, 0x0a0b, 0x0a1b, 0x0a07, 0x0a17, 0x0a0f, 0x0000,
+		0x0a00, 0x0a10, 0x0a08, 0x0a18, 0x0a04, 0x0a14, 0x0a0c, 0x0a1c,
+		0x0a02, 0x0a12, 0x0a0a, 0x0a1a, 0x0a06, 0x0a16, 0x0a0e, 0x0000,
+		0x0a01, 0x0a11, 0x0a09, 0x0a19, 0x0a05, 0x0a15, 0x0a0d, 0x0a1d,
+		0x0a03, 0x0a13, 0x0a0b, 0x0a1b, 0x0a07, 0x0a17, 0x0a0f, 0x0000,
+		0x0a00, 0x0a10, 0x0a08, 0x0a18, 0x0a04, 0x0a14, 0x0a0c, 0x0a1c,
+		0x0a02, 0x0a12, 0x0a0a, 0x0a1a, 0x0a06, 0x0a16, 0x0a0e, 0x0000,
+		0x0a01, 0x0a11, 0x0a09, 0x0a19, 0x0a05, 0x0a15, 0x0a0d, 0x0a1d,
+		0x0a03, 0x0a13, 0x0a0b, 0x0a1b, 0x0a07, 0x0a17, 0x0a0f, 0x0000,
+		0x0a00, 0x0a10, 0x0a08, 0x0a18, 0x0a04, 0x0a14, 0x0a0c, 0x0a1c,
+		0x0a02, 0x0a12, 0x0a0a, 0x0a1a, 0x0a06, 0x0a16, 0x0a0e, 0x0000,
+		0x0a01, 0x0a11, 0x0a09, 0x0a19, 0x0a05, 0x0a15, 0x0a0d, 0x0a1d,
+		0x0a03, 0x0a13, 0x0a0b, 0x0a1b, 0x0a07, 0x0a17, 0x0a0f, 0x0000,
+		0x0a00, 0x0a10, 0x0a08, 0x0a18, 0x0a04, 0x0a14, 0x0a0c, 0x0a1c,
+		0x0a02, 0x0a12, 0x0a0a, 0x0a1a, 0x0a06, 0x0a16, 0x0a0e, 0x0000,
+		0x0a01, 0x0a11, 0x0a09, 0x0a19, 0x0a05, 0x0a15, 0x0a0d, 0x0a1d,
+		0x0a03, 0x0a13, 0x0a0b, 0x0a1b, 0x0a07, 0x0a17, 0x0a0f, 0x0000,
+		0x0a00, 0x0a10, 0x0a08, 0x0a18, 0x0a04, 0x0a14, 0x0a0c, 0x0a1c,
+		0x0a02, 0x0a12, 0x0a0a, 0x0a1a, 0x0a06, 0x0a16, 0x0a0e, 0x0000,
+		0x0a01, 0x0a11, 0x0a09, 0x0a19, 0x0a05, 0x0a15, 0x0a0d, 0x0a1d,
+		0x0a03, 0x0a13, 0x0a0b, 0x0a1b, 0x0a07, 0x0a17, 0x0a0f, 0x0000,
+		0x0a00, 0x0a10, 0x0a08, 0x0a18, 0x0a04, 0x0a14, 0x0a0c, 0x0a1c,
+		0x0a02, 0x0a12, 0x0a0a, 0x0a1a, 0x0a06, 0x0a16, 0x0a0e, 0x0000,
+		0x0a01, 0x0a11, 0x0a09, 0x0a19, 0x0a05, 0x0a15, 0x0a0d, 0x0a1d,
+		0x0a03, 0x0a13, 0x0a0b, 0x0a1b, 0x0a07, 0x0a17, 0x0a0f, 0x0000,
+		0x0a00, 0x0a10, 0x0a08, 0x0a18, 0x0a04, 0x0a14, 0x0a0c, 0x0a1c,
+		0x0a02, 0x0a12, 0x0a0a, 0x0a1a, 0x0a06, 0x0a16, 0x0a0e, 0x0000,
+		0x0a01, 0x0a11, 0x0a09, 0x0a19, 0x0a05, 0x0a15, 0x0a0d, 0x0a1d,
+		0x0a03, 0x0a13, 0x0a0b, 0x0a1b, 0x0a07, 0x0a17, 0x0a0f, 0x0000,
+		0x0a00, 0x0a10, 0x0a08, 0x0a18, 0x0a04, 0x0a14, 0x0a0c, 0x0a1c,
+		0x0a02, 0x0a12, 0x0a0a, 0x0a1a, 0x0a06, 0x0a16, 0x0a0e, 0x0000,
+		0x0a01, 0x0a11, 0x0a09, 0x0a19, 0x0a05, 0x0a15, 0x0a0d, 0x0a1d,
+		0x0a03, 0x0a13, 0x0a0b, 0x0a1b, 0x0a07, 0x0a17, 0x0a0f, 0x0000,
+		0x0a00, 0x0a10, 0x0a08, 0x0a18, 0x0a04, 0x0a14, 0x0a0c, 0x0a1c,
+		0x0a02, 0x0a12, 0x0a0a, 0x0a1a, 0x0a06, 0x0a16, 0x0a0e, 0x0000,
+		0x0a01, 0x0a11, 0x0a09, 0x0a19, 0x0a05, 0x0a15, 0x0a0d, 0x0a1d,
+		0x0a03, 0x0a13, 0x0a0b, 0x0a1b, 0x0a07, 0x0a17, 0x0a0f, 0x0000,
+		0x0a00, 0x0a10, 0x0a08, 0x0a18, 0x0a04, 0x0a14, 0x0a0c, 0x0a1c,
+		0x0a02, 0x0a12, 0x0a0a, 0x0a1a, 0x0a06, 0x0a16, 0x0a0e, 0x0000,
+		0x0a01, 0x0a11, 0x0a09, 0x0a19, 0x0a05, 0x0a15, 0x0a0d, 0x0a1d,
+		0x0a03, 0x0a13, 0x0a0b, 0x0a1b, 0x0a07, 0x0a17, 0x0a0f, 0x0000,
+		0x0a00, 0x0a10, 0x0a08, 0x0a18, 0x0a04, 0x0a14, 0x0a0c, 0x0a1c,
+		0x0a02, 0x0a12, 0x0a0a, 0x0a1a, 0x0a06, 0x0a16, 0x0a0e, 0x0000,
+		0x0a01, 0x0a11, 0x0a09, 0x0a19, 0x0a05, 0x0a15, 0x0a0d, 0x0a1d,
+		0x0a03, 0x0a13, 0x0a0b, 0x0a1b, 0x0a07, 0x0a17, 0x0a0f, 0x0000,
+		0x0a00, 0x0a10, 0x0a08, 0x0a18, 0x0a04, 0x0a14, 0x0a0c, 0x0a1c,
+		0x0a02, 0x0a12, 0x0a0a, 0x0a1a, 0x0a06, 0x0a16, 0x0a0e, 0x0000,
+		0x0a01, 0x0a11, 0x0a09, 0x0a19, 0x0a05, 0x0a15, 0x0a0d, 0x0a1d,
+		0x0a03, 0x0a13, 0x0a0b, 0x0a1b, 0x0a07, 0x0a17, 0x0a0f, 0x0000,
+		0x0a00, 0x0a10, 0x0a08, 0x0a18, 0x0a04, 0x0a14, 0x0a0c, 0x0a1c,
+		0x0a02, 0x0a12, 0x0a0a, 0x0a1a, 0x0a06, 0x0a16, 0x0a0e, 0x0000,
+		0x0a01, 0x0a11, 0x0a09, 0x0a19, 0x0a05, 0x0a15, 0x0a0d, 0x0a1d,
+		0x0a03, 0x0a13, 0x0a0b, 0x0a1b, 0x0a07, 0x0a17, 0x0a0f, 0x0000,
+		0x0a00, 0x0a10, 0x0a08, 0x0a18, 0x0a04, 0x0a14, 0x0a0c, 0x0a1c,
+		0x0a02, 0x0a12, 0x0a0a, 0x0a1a, 0x0a06, 0x0a16, 0x0a0e, 0x0000,
+		0x0a01, 0x0a11, 0x0a09, 0x0a19, 0x0a05, 0x0a15, 0x0a0d, 0x0a1d,
+		0x0a03, 0x0a13, 0x0a0b, 0x0a1b, 0x0a07, 0x0a17, 0x0a0f, 0x0000,
+		0x0a00, 0x0a10, 0x0a08, 0x0a18, 0x0a04, 0x0a14, 0x0a0c, 0x0a1c,
+		0x0a02, 0x0a12, 0x0a0a, 0x0a1a, 0x0a06, 0x0a16, 0x0a0e, 0x0000,
+		0x0a01, 0x0a11, 0x0a09, 0x0a19, 0x0a05, 0x0a15, 0x0a0d, 0x0a1d,
+		0x0a03, 0x0a13, 0x0a0b, 0x0a1b, 0x0a07, 0x0a17, 0x0a0f, 0x0000
+	}
+};
+
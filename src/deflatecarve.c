@@ -0,0 +1,543 @@
+/*
+ * deflatecarve finds zlib and raw deflate compressed streams in data
+ *
+ * Copyright (C) 2008-2019, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This software is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This software is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this software.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <file_stream.h>
+#include <system_string.h>
+#include <types.h>
+
+#if defined( HAVE_STDLIB_H )
+#include <stdlib.h>
+#endif
+
+#include "assorted_getopt.h"
+#include "assorted_input_file.h"
+#include "assorted_libcerror.h"
+#include "assorted_libcfile.h"
+#include "assorted_libcnotify.h"
+#include "assorted_output.h"
+#include "deflate_carve.h"
+
+/* The size of the data that is scanned at once if the source file is not mapped
+ */
+#define DEFLATECARVE_VIEW_SIZE		( 64 * 1024 * 1024 )
+
+/* The number of bytes at the end of a view that are scanned as part of the next view
+ * so that the block header of a candidate is not cut off
+ */
+#define DEFLATECARVE_VIEW_OVERLAP	64
+
+/* Prints the executable usage information
+ */
+void usage_fprint(
+      FILE *stream )
+{
+	if( stream == NULL )
+	{
+		return;
+	}
+	fprintf( stream, "Use deflatecarve to find zlib or raw deflate compressed streams in data,\n"
+	                 "such as unallocated space of a storage media image.\n\n" );
+
+	fprintf( stream, "Usage: deflatecarve [ -m size ] [ -o offset ] [ -s size ] [ -S format ]\n"
+	                 "                    [ -hrvV ] source\n\n" );
+
+	fprintf( stream, "\tsource: the source file\n\n" );
+
+	fprintf( stream, "\t-h:     shows this help\n" );
+	fprintf( stream, "\t-m:     minimum size of the uncompressed data of a stream (default is 1)\n" );
+	fprintf( stream, "\t-o:     data offset (default is 0)\n" );
+	fprintf( stream, "\t-r:     find raw deflate streams instead of zlib streams, these are not\n"
+	                 "\t        verified by a checksum and raw deflate streams that start with\n"
+	                 "\t        a fixed Huffman block are not found\n" );
+	fprintf( stream, "\t-s:     size of data (default is the file size)\n" );
+	fprintf( stream, "\t-S:     print timing and throughput statistics of the open,\n"
+	                 "\t        read, compute and write phases and the peak memory\n"
+	                 "\t        size to stderr in the format: text or json\n" );
+	fprintf( stream, "\t-v:     verbose output to stderr\n" );
+	fprintf( stream, "\t-V:     print version\n" );
+	fprintf( stream, "\n" );
+	fprintf( stream, "A line is printed per stream with the offset and size of the compressed\n"
+	                 "data and the size of the uncompressed data, separated by tabs. The offset\n"
+	                 "and size can be passed to zdecompress to decompress a zlib stream.\n" );
+	fprintf( stream, "\n" );
+}
+
+/* The main program
+ */
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+int wmain( int argc, wchar_t * const argv[] )
+#else
+int main( int argc, char * const argv[] )
+#endif
+{
+	libcerror_error_t *error                     = NULL;
+	assorted_input_file_t *source_file           = NULL;
+	deflate_carve_scanner_t *scanner             = NULL;
+	system_character_t *option_statistics_format = NULL;
+	system_character_t *source                   = NULL;
+	uint8_t *view_data                           = NULL;
+	char *program                                = "deflatecarve";
+	system_integer_t option                      = 0;
+	size64_t minimum_uncompressed_size           = 1;
+	size64_t scan_offset                         = 0;
+	size64_t source_size                         = 0;
+	size64_t uncompressed_data_size              = 0;
+	size_t compressed_data_size                  = 0;
+	size_t data_offset                           = 0;
+	size_t maximum_view_size                     = 0;
+	size_t scan_size                             = 0;
+	size_t view_size                             = 0;
+	ssize_t read_count                           = 0;
+	off_t source_offset                          = 0;
+	uint64_t number_of_streams                   = 0;
+	uint8_t block_type                           = 0;
+	uint8_t flags                                = 0;
+	int is_mapped                                = 0;
+	int result                                   = 0;
+	int stream_type                              = DEFLATE_CARVE_STREAM_TYPE_ZLIB;
+	int verbose                                  = 0;
+
+	assorted_output_version_fprint(
+	 stdout,
+	 program );
+
+	while( ( option = assorted_getopt(
+	                   argc,
+	                   argv,
+	                   _SYSTEM_STRING( "hm:o:rs:S:vV" ) ) ) != (system_integer_t) -1 )
+	{
+		switch( option )
+		{
+			case '?':
+			default:
+				fprintf(
+				 stderr,
+				 "Invalid argument: %" PRIs_SYSTEM "\n",
+				 argv[ optind ] );
+
+				usage_fprint(
+				 stdout );
+
+				return( EXIT_FAILURE );
+
+			case 'h':
+				usage_fprint(
+				 stdout );
+
+				return( EXIT_SUCCESS );
+
+			case 'm':
+				minimum_uncompressed_size = atol( optarg );
+
+				break;
+
+			case 'o':
+				source_offset = atol( optarg );
+
+				break;
+
+			case 'r':
+				stream_type = DEFLATE_CARVE_STREAM_TYPE_RAW;
+
+				break;
+
+			case 's':
+				source_size = atol( optarg );
+
+				break;
+
+			case 'S':
+				option_statistics_format = optarg;
+
+				break;
+
+			case 'v':
+				verbose = 1;
+
+				break;
+
+			case 'V':
+				assorted_output_copyright_fprint(
+				 stdout );
+
+				return( EXIT_SUCCESS );
+		}
+	}
+	if( optind == argc )
+	{
+		fprintf(
+		 stderr,
+		 "Missing source file.\n" );
+
+		usage_fprint(
+		 stdout );
+
+		return( EXIT_FAILURE );
+	}
+	source = argv[ optind ];
+
+	libcnotify_stream_set(
+	 stderr,
+	 NULL );
+	libcnotify_verbose_set(
+	 verbose );
+
+	if( assorted_output_statistics_initialize(
+	     option_statistics_format,
+	     &error ) != 1 )
+	{
+		fprintf(
+		 stderr,
+		 "Unable to initialize statistics.\n" );
+
+		goto on_error;
+	}
+
+	/* Open the source file
+	 */
+	if( assorted_input_file_initialize(
+	     &source_file,
+	     &error ) != 1 )
+	{
+		fprintf(
+		 stderr,
+		 "Unable to create source file.\n" );
+
+		goto on_error;
+	}
+	if( assorted_input_file_open(
+	     source_file,
+	     source,
+	     &error ) != 1 )
+	{
+		fprintf(
+		 stderr,
+		 "Unable to open source file.\n" );
+
+		goto on_error;
+	}
+	if( source_size == 0 )
+	{
+		if( assorted_input_file_get_size(
+		     source_file,
+		     &source_size,
+		     &error ) == -1 )
+		{
+			fprintf(
+			 stderr,
+			 "Unable to determine size of source file.\n" );
+
+			goto on_error;
+		}
+		if( source_size <= (size64_t) source_offset )
+		{
+			fprintf(
+			 stderr,
+			 "Invalid source offset value out of bounds.\n" );
+
+			goto on_error;
+		}
+		source_size -= source_offset;
+	}
+	if( source_size == 0 )
+	{
+		fprintf(
+		 stderr,
+		 "Invalid source size value is zero.\n" );
+
+		goto on_error;
+	}
+	is_mapped = assorted_input_file_is_mapped(
+	             source_file,
+	             &error );
+
+	if( is_mapped == -1 )
+	{
+		fprintf(
+		 stderr,
+		 "Unable to determine if source file is mapped.\n" );
+
+		goto on_error;
+	}
+	/* If the source file is mapped all data is scanned as a single view,
+	 * otherwise the data is read in views and a stream that continues beyond
+	 * the end of a view is validated using a view that starts at the stream
+	 */
+	if( is_mapped != 0 )
+	{
+		maximum_view_size = (size_t) SSIZE_MAX;
+	}
+	else
+	{
+		maximum_view_size = DEFLATECARVE_VIEW_SIZE;
+	}
+	view_size = maximum_view_size;
+
+	if( deflate_carve_scanner_initialize(
+	     &scanner,
+	     &error ) != 1 )
+	{
+		fprintf(
+		 stderr,
+		 "Unable to create scanner.\n" );
+
+		goto on_error;
+	}
+	while( scan_offset < source_size )
+	{
+		flags = 0;
+
+		if( (size64_t) view_size >= ( source_size - scan_offset ) )
+		{
+			view_size = (size_t) ( source_size - scan_offset );
+			flags     = DEFLATE_CARVE_FLAG_END_OF_INPUT;
+		}
+		if( assorted_input_file_seek_offset(
+		     source_file,
+		     (off64_t) ( source_offset + scan_offset ),
+		     SEEK_SET,
+		     &error ) == -1 )
+		{
+			fprintf(
+			 stderr,
+			 "Unable to seek offset in source file.\n" );
+
+			goto on_error;
+		}
+		read_count = assorted_input_file_read_data(
+		              source_file,
+		              &view_data,
+		              view_size,
+		              &error );
+
+		if( read_count != (ssize_t) view_size )
+		{
+			fprintf(
+			 stderr,
+			 "Unable to read from source file.\n" );
+
+			goto on_error;
+		}
+		scan_size = view_size;
+
+		if( ( flags & DEFLATE_CARVE_FLAG_END_OF_INPUT ) == 0 )
+		{
+			scan_size -= DEFLATECARVE_VIEW_OVERLAP;
+		}
+		data_offset = 0;
+
+		while( data_offset < scan_size )
+		{
+			if( stream_type == DEFLATE_CARVE_STREAM_TYPE_ZLIB )
+			{
+				result = deflate_carve_find_zlib_header(
+				          view_data,
+				          view_size,
+				          &data_offset,
+				          &error );
+			}
+			else
+			{
+				result = deflate_carve_find_raw_block_header(
+				          view_data,
+				          view_size,
+				          &data_offset,
+				          &error );
+			}
+			if( result == -1 )
+			{
+				fprintf(
+				 stderr,
+				 "Unable to find candidate.\n" );
+
+				goto on_error;
+			}
+			else if( ( result == 0 )
+			      || ( data_offset >= scan_size ) )
+			{
+				data_offset = scan_size;
+
+				break;
+			}
+			/* Only candidates of which the first block header is plausible are decoded,
+			 * the block header of a raw deflate candidate was already checked
+			 */
+			if( stream_type == DEFLATE_CARVE_STREAM_TYPE_ZLIB )
+			{
+				result = deflate_carve_check_block_header(
+				          &( view_data[ data_offset + 2 ] ),
+				          view_size - ( data_offset + 2 ),
+				          &block_type,
+				          &error );
+
+				if( result == -1 )
+				{
+					fprintf(
+					 stderr,
+					 "Unable to check block header.\n" );
+
+					goto on_error;
+				}
+			}
+			if( result != 0 )
+			{
+				/* The reason a candidate is not a valid stream is not relevant
+				 * hence no error is passed
+				 */
+				result = deflate_carve_scanner_validate_stream(
+				          scanner,
+				          &( view_data[ data_offset ] ),
+				          view_size - data_offset,
+				          stream_type,
+				          flags,
+				          &compressed_data_size,
+				          &uncompressed_data_size,
+				          NULL );
+
+				if( result == 0 )
+				{
+					break;
+				}
+				else if( ( result == 1 )
+				      && ( uncompressed_data_size >= minimum_uncompressed_size ) )
+				{
+					fprintf(
+					 stdout,
+					 "%" PRIu64 "\t%" PRIzd "\t%" PRIu64 "\n",
+					 (uint64_t) source_offset + scan_offset + data_offset,
+					 compressed_data_size,
+					 uncompressed_data_size );
+
+					number_of_streams++;
+
+					data_offset += compressed_data_size;
+
+					continue;
+				}
+			}
+			data_offset++;
+		}
+		if( ( result == 0 )
+		 && ( data_offset < scan_size ) )
+		{
+			/* The stream continues beyond the end of the view, if the view
+			 * already starts at the stream the size of the view is doubled
+			 */
+			if( data_offset == 0 )
+			{
+				if( view_size > ( (size_t) SSIZE_MAX / 2 ) )
+				{
+					fprintf(
+					 stderr,
+					 "Invalid view size value exceeds maximum.\n" );
+
+					goto on_error;
+				}
+				view_size *= 2;
+
+				continue;
+			}
+		}
+		scan_offset += data_offset;
+		view_size    = maximum_view_size;
+	}
+	/* Clean up
+	 */
+	if( deflate_carve_scanner_free(
+	     &scanner,
+	     &error ) != 1 )
+	{
+		fprintf(
+		 stderr,
+		 "Unable to free scanner.\n" );
+
+		goto on_error;
+	}
+	if( assorted_input_file_close(
+	     source_file,
+	     &error ) != 0 )
+	{
+		fprintf(
+		 stderr,
+		 "Unable to close source file.\n" );
+
+		goto on_error;
+	}
+	if( assorted_input_file_free(
+	     &source_file,
+	     &error ) != 1 )
+	{
+		fprintf(
+		 stderr,
+		 "Unable to free source file.\n" );
+
+		goto on_error;
+	}
+	fprintf(
+	 stdout,
+	 "Number of streams found:\t%" PRIu64 "\n",
+	 number_of_streams );
+
+	fprintf(
+	 stdout,
+	 "Deflate carve:\t\tSUCCESS\n" );
+
+	assorted_output_statistics_fprint(
+	 stderr,
+	 program,
+	 1,
+	 NULL );
+	assorted_output_statistics_free(
+	 NULL );
+
+	return( EXIT_SUCCESS );
+
+on_error:
+	if( error != NULL )
+	{
+		libcnotify_print_error_backtrace(
+		 error );
+		libcerror_error_free(
+		 &error );
+	}
+	assorted_output_statistics_fprint(
+	 stderr,
+	 program,
+	 -1,
+	 NULL );
+	assorted_output_statistics_free(
+	 NULL );
+	if( scanner != NULL )
+	{
+		deflate_carve_scanner_free(
+		 &scanner,
+		 NULL );
+	}
+	if( source_file != NULL )
+	{
+		assorted_input_file_free(
+		 &source_file,
+		 NULL );
+	}
+	return( EXIT_FAILURE );
+}
+
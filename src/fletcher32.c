@@ -23,8 +23,19 @@
 #include <types.h>
 
 #include "assorted_libcerror.h"
+#include "cpu_features.h"
 #include "fletcher32.h"
 
+#if defined( HAVE_CPU_FEATURES_X86 )
+#include <immintrin.h>
+
+#endif
+
+/* The maximum number of bytes that can be added before the sums need to be reduced
+ * 255 * n * ( n + 1 ) / 2 + ( n + 1 ) * 0xffff <= 0xffffffff
+ */
+#define FLETCHER32_MAXIMUM_NUMBER_OF_BYTES	5552
+
 /* Calculates the Fletcher-32 of a buffer
  * Use a previous key of 0 to calculate a new Fletcher-32
  * Returns 1 if successful or -1 on error
@@ -74,13 +85,19 @@ int fletcher32_calculate(
 
 		return( -1 );
 	}
-/*
-	lower_word = previous_key & 0xffff;
-	upper_word = ( previous_key >> 16 ) & 0xffff;
-*/
-
-	lower_word = 0xffff;
-	upper_word = 0xffff;
+	/* The reduced sums are never 0, hence a previous key of 0 indicates
+	 * a new Fletcher-32 that starts with sums of 0xffff
+	 */
+	if( previous_key == 0 )
+	{
+		lower_word = 0xffff;
+		upper_word = 0xffff;
+	}
+	else
+	{
+		lower_word = previous_key & 0xffff;
+		upper_word = ( previous_key >> 16 ) & 0xffff;
+	}
 
         while( size )
 	{
@@ -116,3 +133,550 @@ int fletcher32_calculate(
 	return( 1 );
 }
 
+/* Reduces a sum modulo 65535 (0xffff)
+ * A sum that is not 0 is reduced to a value in the range 1 to 65535, which is
+ * the same value as repeatedly folding the upper 16-bit into the lower 16-bit
+ * Returns the reduced sum
+ */
+static uint32_t fletcher32_reduce(
+                 uint32_t sum )
+{
+	if( sum == 0 )
+	{
+		return( 0 );
+	}
+	return( ( ( sum - 1 ) % 0xffff ) + 1 );
+}
+
+/* Calculates the Fletcher-32 of a buffer
+ * The sums are only reduced every 5552 bytes, where overflow becomes possible,
+ * and 8 bytes are added at a time
+ * Use a previous key of 0 to calculate a new Fletcher-32
+ * Returns 1 if successful or -1 on error
+ */
+int fletcher32_calculate_deferred(
+     uint32_t previous_key,
+     uint8_t *buffer,
+     size_t size,
+     uint32_t *fletcher32,
+     libcerror_error_t **error )
+{
+	static char *function = "fletcher32_calculate_deferred";
+	size_t block_size     = 0;
+	uint32_t lower_word   = 0;
+	uint32_t upper_word   = 0;
+
+	if( buffer == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid buffer.",
+		 function );
+
+		return( -1 );
+	}
+	if( size > (size_t) SSIZE_MAX )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid size value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	if( fletcher32 == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid Fletcher-32.",
+		 function );
+
+		return( -1 );
+	}
+	if( previous_key == 0 )
+	{
+		lower_word = 0xffff;
+		upper_word = 0xffff;
+	}
+	else
+	{
+		lower_word = previous_key & 0xffff;
+		upper_word = ( previous_key >> 16 ) & 0xffff;
+	}
+	while( size > 0 )
+	{
+		block_size = size;
+
+		if( block_size > FLETCHER32_MAXIMUM_NUMBER_OF_BYTES )
+		{
+			block_size = FLETCHER32_MAXIMUM_NUMBER_OF_BYTES;
+		}
+		size -= block_size;
+
+		/* The lower word is added to the upper word for every byte, hence
+		 * for 8 bytes the upper word is increased with 8 times the lower word
+		 * and the bytes weighted by their distance to the end of the 8 bytes
+		 */
+		while( block_size >= 8 )
+		{
+			upper_word += ( lower_word << 3 )
+			            + ( 8 * (uint32_t) buffer[ 0 ] )
+			            + ( 7 * (uint32_t) buffer[ 1 ] )
+			            + ( 6 * (uint32_t) buffer[ 2 ] )
+			            + ( 5 * (uint32_t) buffer[ 3 ] )
+			            + ( 4 * (uint32_t) buffer[ 4 ] )
+			            + ( 3 * (uint32_t) buffer[ 5 ] )
+			            + ( 2 * (uint32_t) buffer[ 6 ] )
+			            + buffer[ 7 ];
+
+			lower_word += (uint32_t) buffer[ 0 ] + buffer[ 1 ] + buffer[ 2 ] + buffer[ 3 ]
+			            + buffer[ 4 ] + buffer[ 5 ] + buffer[ 6 ] + buffer[ 7 ];
+
+			buffer     += 8;
+			block_size -= 8;
+		}
+		while( block_size > 0 )
+		{
+			lower_word += *buffer;
+			upper_word += lower_word;
+
+			buffer     += 1;
+			block_size -= 1;
+		}
+		lower_word = fletcher32_reduce(
+		              lower_word );
+		upper_word = fletcher32_reduce(
+		              upper_word );
+	}
+	*fletcher32 = ( upper_word << 16 ) | lower_word;
+
+	return( 1 );
+}
+
+#if defined( HAVE_CPU_FEATURES_X86 )
+
+/* The multipliers of the upper word of the bytes in a 32 byte block
+ */
+static const uint8_t fletcher32_simd_multipliers[ 64 ] = {
+	64, 63, 62, 61, 60, 59, 58, 57, 56, 55, 54, 53, 52, 51, 50, 49,
+	48, 47, 46, 45, 44, 43, 42, 41, 40, 39, 38, 37, 36, 35, 34, 33,
+	32, 31, 30, 29, 28, 27, 26, 25, 24, 23, 22, 21, 20, 19, 18, 17,
+	16, 15, 14, 13, 12, 11, 10,  9,  8,  7,  6,  5,  4,  3,  2,  1 };
+
+/* Calculates the Fletcher-32 of a buffer using SSSE3
+ * The size must be a multiple of 32
+ * Returns the Fletcher-32
+ */
+CPU_FEATURES_TARGET( "ssse3" )
+static uint32_t fletcher32_calculate_ssse3(
+                 uint32_t checksum_value,
+                 const uint8_t *buffer,
+                 size_t size )
+{
+	__m128i lower_word_sums;
+	__m128i multipliers1;
+	__m128i multipliers2;
+	__m128i ones;
+	__m128i previous_lower_word_sums;
+	__m128i upper_word_sums;
+	__m128i value1;
+	__m128i value2;
+	__m128i zero;
+
+	size_t number_of_blocks = 0;
+	uint32_t lower_word     = 0;
+	uint32_t upper_word     = 0;
+
+	lower_word = checksum_value & 0xffff;
+	upper_word = ( checksum_value >> 16 ) & 0xffff;
+
+	multipliers1 = _mm_loadu_si128(
+	                (const __m128i *) &( fletcher32_simd_multipliers[ 32 ] ) );
+	multipliers2 = _mm_loadu_si128(
+	                (const __m128i *) &( fletcher32_simd_multipliers[ 48 ] ) );
+
+	ones = _mm_set1_epi16( 1 );
+	zero = _mm_setzero_si128();
+
+	while( size > 0 )
+	{
+		/* The sums need to be reduced per 5552 (0x15b0) bytes
+		 * 5552 / 32 = 173
+		 */
+		number_of_blocks = size / 32;
+
+		if( number_of_blocks > 173 )
+		{
+			number_of_blocks = 173;
+		}
+		size -= number_of_blocks * 32;
+
+		/* The lower word is added to the upper word for every byte
+		 */
+		previous_lower_word_sums = _mm_set_epi32(
+		                            0,
+		                            0,
+		                            0,
+		                            (int) ( lower_word * number_of_blocks ) );
+
+		upper_word_sums = _mm_set_epi32(
+		                   0,
+		                   0,
+		                   0,
+		                   (int) upper_word );
+
+		lower_word_sums = _mm_setzero_si128();
+
+		while( number_of_blocks > 0 )
+		{
+			value1 = _mm_loadu_si128(
+			          (const __m128i *) buffer );
+			value2 = _mm_loadu_si128(
+			          (const __m128i *) &( buffer[ 16 ] ) );
+
+			previous_lower_word_sums = _mm_add_epi32(
+			                            previous_lower_word_sums,
+			                            lower_word_sums );
+
+			lower_word_sums = _mm_add_epi32(
+			                   lower_word_sums,
+			                   _mm_sad_epu8(
+			                    value1,
+			                    zero ) );
+
+			upper_word_sums = _mm_add_epi32(
+			                   upper_word_sums,
+			                   _mm_madd_epi16(
+			                    _mm_maddubs_epi16(
+			                     value1,
+			                     multipliers1 ),
+			                    ones ) );
+
+			lower_word_sums = _mm_add_epi32(
+			                   lower_word_sums,
+			                   _mm_sad_epu8(
+			                    value2,
+			                    zero ) );
+
+			upper_word_sums = _mm_add_epi32(
+			                   upper_word_sums,
+			                   _mm_madd_epi16(
+			                    _mm_maddubs_epi16(
+			                     value2,
+			                     multipliers2 ),
+			                    ones ) );
+
+			buffer           += 32;
+			number_of_blocks -= 1;
+		}
+		upper_word_sums = _mm_add_epi32(
+		                   upper_word_sums,
+		                   _mm_slli_epi32(
+		                    previous_lower_word_sums,
+		                    5 ) );
+
+		/* Add the 32-bit integers of the sums
+		 */
+		lower_word_sums = _mm_add_epi32(
+		                   lower_word_sums,
+		                   _mm_shuffle_epi32(
+		                    lower_word_sums,
+		                    _MM_SHUFFLE( 1, 0, 3, 2 ) ) );
+
+		lower_word += (uint32_t) _mm_cvtsi128_si32(
+		                          lower_word_sums );
+
+		upper_word_sums = _mm_add_epi32(
+		                   upper_word_sums,
+		                   _mm_shuffle_epi32(
+		                    upper_word_sums,
+		                    _MM_SHUFFLE( 2, 3, 0, 1 ) ) );
+
+		upper_word_sums = _mm_add_epi32(
+		                   upper_word_sums,
+		                   _mm_shuffle_epi32(
+		                    upper_word_sums,
+		                    _MM_SHUFFLE( 1, 0, 3, 2 ) ) );
+
+		upper_word = (uint32_t) _mm_cvtsi128_si32(
+		                         upper_word_sums );
+
+		lower_word = fletcher32_reduce(
+		              lower_word );
+		upper_word = fletcher32_reduce(
+		              upper_word );
+	}
+	return( ( upper_word << 16 ) | lower_word );
+}
+
+/* Calculates the Fletcher-32 of a buffer using AVX2
+ * The size must be a multiple of 32
+ * Returns the Fletcher-32
+ */
+CPU_FEATURES_TARGET( "avx2" )
+static uint32_t fletcher32_calculate_avx2(
+                 uint32_t checksum_value,
+                 const uint8_t *buffer,
+                 size_t size )
+{
+	__m256i lower_word_sums;
+	__m256i multipliers;
+	__m256i ones;
+	__m256i previous_lower_word_sums;
+	__m256i upper_word_sums;
+	__m256i value;
+	__m256i zero;
+	__m128i sums;
+
+	size_t number_of_blocks = 0;
+	uint32_t lower_word     = 0;
+	uint32_t upper_word     = 0;
+
+	lower_word = checksum_value & 0xffff;
+	upper_word = ( checksum_value >> 16 ) & 0xffff;
+
+	multipliers = _mm256_loadu_si256(
+	               (const __m256i *) &( fletcher32_simd_multipliers[ 32 ] ) );
+
+	ones = _mm256_set1_epi16( 1 );
+	zero = _mm256_setzero_si256();
+
+	while( size > 0 )
+	{
+		/* The sums need to be reduced per 5552 (0x15b0) bytes
+		 * 5552 / 32 = 173
+		 */
+		number_of_blocks = size / 32;
+
+		if( number_of_blocks > 173 )
+		{
+			number_of_blocks = 173;
+		}
+		size -= number_of_blocks * 32;
+
+		/* The lower word is added to the upper word for every byte
+		 */
+		previous_lower_word_sums = _mm256_set_epi32(
+		                            0,
+		                            0,
+		                            0,
+		                            0,
+		                            0,
+		                            0,
+		                            0,
+		                            (int) ( lower_word * number_of_blocks ) );
+
+		upper_word_sums = _mm256_set_epi32(
+		                   0,
+		                   0,
+		                   0,
+		                   0,
+		                   0,
+		                   0,
+		                   0,
+		                   (int) upper_word );
+
+		lower_word_sums = _mm256_setzero_si256();
+
+		while( number_of_blocks > 0 )
+		{
+			value = _mm256_loadu_si256(
+			         (const __m256i *) buffer );
+
+			previous_lower_word_sums = _mm256_add_epi32(
+			                            previous_lower_word_sums,
+			                            lower_word_sums );
+
+			lower_word_sums = _mm256_add_epi32(
+			                   lower_word_sums,
+			                   _mm256_sad_epu8(
+			                    value,
+			                    zero ) );
+
+			upper_word_sums = _mm256_add_epi32(
+			                   upper_word_sums,
+			                   _mm256_madd_epi16(
+			                    _mm256_maddubs_epi16(
+			                     value,
+			                     multipliers ),
+			                    ones ) );
+
+			buffer           += 32;
+			number_of_blocks -= 1;
+		}
+		upper_word_sums = _mm256_add_epi32(
+		                   upper_word_sums,
+		                   _mm256_slli_epi32(
+		                    previous_lower_word_sums,
+		                    5 ) );
+
+		/* Add the 32-bit integers of the sums
+		 */
+		sums = _mm_add_epi32(
+		        _mm256_castsi256_si128(
+		         lower_word_sums ),
+		        _mm256_extracti128_si256(
+		         lower_word_sums,
+		         1 ) );
+
+		sums = _mm_add_epi32(
+		        sums,
+		        _mm_shuffle_epi32(
+		         sums,
+		         _MM_SHUFFLE( 1, 0, 3, 2 ) ) );
+
+		lower_word += (uint32_t) _mm_cvtsi128_si32(
+		                          sums );
+
+		sums = _mm_add_epi32(
+		        _mm256_castsi256_si128(
+		         upper_word_sums ),
+		        _mm256_extracti128_si256(
+		         upper_word_sums,
+		         1 ) );
+
+		sums = _mm_add_epi32(
+		        sums,
+		        _mm_shuffle_epi32(
+		         sums,
+		         _MM_SHUFFLE( 2, 3, 0, 1 ) ) );
+
+		sums = _mm_add_epi32(
+		        sums,
+		        _mm_shuffle_epi32(
+		         sums,
+		         _MM_SHUFFLE( 1, 0, 3, 2 ) ) );
+
+		upper_word = (uint32_t) _mm_cvtsi128_si32(
+		                         sums );
+
+		lower_word = fletcher32_reduce(
+		              lower_word );
+		upper_word = fletcher32_reduce(
+		              upper_word );
+	}
+	return( ( upper_word << 16 ) | lower_word );
+}
+
+#endif /* defined( HAVE_CPU_FEATURES_X86 ) */
+
+/* Calculates the Fletcher-32 of a buffer
+ * Uses the SIMD instructions of the CPU if available, otherwise falls back to the deferred variant
+ *
+ * On x86 AVX2 or SSSE3 is used, using the same weighted sums as the Adler-32 SIMD variant.
+ * The data that remains after the last SIMD block is calculated with the deferred variant.
+ *
+ * Use a previous key of 0 to calculate a new Fletcher-32
+ * Returns 1 if successful or -1 on error
+ */
+int fletcher32_calculate_simd(
+     uint32_t previous_key,
+     uint8_t *buffer,
+     size_t size,
+     uint32_t *fletcher32,
+     libcerror_error_t **error )
+{
+	static char *function = "fletcher32_calculate_simd";
+	size_t buffer_offset  = 0;
+	size_t block_size     = 0;
+	uint32_t value_32bit  = 0;
+
+	if( buffer == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid buffer.",
+		 function );
+
+		return( -1 );
+	}
+	if( size > (size_t) SSIZE_MAX )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid size value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	if( fletcher32 == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid Fletcher-32.",
+		 function );
+
+		return( -1 );
+	}
+	/* A previous key of 0 indicates a new Fletcher-32 that starts with sums of 0xffff
+	 */
+	if( previous_key == 0 )
+	{
+		value_32bit = 0xffffffffUL;
+	}
+	else
+	{
+		value_32bit = previous_key;
+	}
+#if defined( HAVE_CPU_FEATURES_X86 )
+	if( size >= 32 )
+	{
+		block_size = size & ~( (size_t) 31 );
+
+		if( cpu_features_has(
+		     CPU_FEATURE_FLAG_AVX2 ) != 0 )
+		{
+			value_32bit = fletcher32_calculate_avx2(
+			               value_32bit,
+			               buffer,
+			               block_size );
+
+			buffer_offset = block_size;
+		}
+		else if( cpu_features_has(
+		          CPU_FEATURE_FLAG_SSSE3 ) != 0 )
+		{
+			value_32bit = fletcher32_calculate_ssse3(
+			               value_32bit,
+			               buffer,
+			               block_size );
+
+			buffer_offset = block_size;
+		}
+	}
+#endif
+	/* Calculate the remaining data using the deferred variant
+	 */
+	if( fletcher32_calculate_deferred(
+	     value_32bit,
+	     &( buffer[ buffer_offset ] ),
+	     size - buffer_offset,
+	     &value_32bit,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GENERIC,
+		 "%s: unable to calculate Fletcher-32 of remaining data.",
+		 function );
+
+		return( -1 );
+	}
+	*fletcher32 = value_32bit;
+
+	return( 1 );
+}
+
@@ -38,6 +38,20 @@ int fletcher32_calculate(
      uint32_t *fletcher32,
      libcerror_error_t **error );
 
+int fletcher32_calculate_deferred(
+     uint32_t previous_key,
+     uint8_t *buffer,
+     size_t size,
+     uint32_t *fletcher32,
+     libcerror_error_t **error );
+
+int fletcher32_calculate_simd(
+     uint32_t previous_key,
+     uint8_t *buffer,
+     size_t size,
+     uint32_t *fletcher32,
+     libcerror_error_t **error );
+
 #if defined( __cplusplus )
 }
 #endif
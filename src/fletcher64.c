@@ -24,8 +24,19 @@
 #include <types.h>
 
 #include "assorted_libcerror.h"
+#include "cpu_features.h"
 #include "fletcher64.h"
 
+#if defined( HAVE_CPU_FEATURES_X86 )
+#include <immintrin.h>
+
+#endif
+
+/* The maximum number of 32-bit values that can be added before the sums need to be reduced
+ * ( n * ( n + 1 ) / 2 + n + 1 ) * 0xffffffff <= 0xffffffffffffffff
+ */
+#define FLETCHER64_MAXIMUM_NUMBER_OF_VALUES	65536
+
 /* Calculates the Fletcher-64 of a buffer of data
  * Use a previous key of 0 to calculate a new Fletcher-64
  * Returns 1 if successful or -1 on error
@@ -37,11 +48,12 @@ int fletcher64_calculate(
      uint64_t *fletcher64,
      libcerror_error_t **error )
 {
-	static char *function = "fletcher64_calculate";
-	size_t data_offset    = 0;
-	uint64_t lower_32bit  = 0;
-	uint64_t upper_32bit  = 0;
-	uint32_t value_32bit  = 0;
+	static char *function      = "fletcher64_calculate";
+	size_t data_offset         = 0;
+	size_t maximum_data_offset = 0;
+	uint64_t lower_32bit       = 0;
+	uint64_t upper_32bit       = 0;
+	uint32_t value_32bit       = 0;
 
 	if( data == NULL )
 	{
@@ -90,10 +102,21 @@ int fletcher64_calculate(
 	lower_32bit = previous_key & 0xffffffffUL;
 	upper_32bit = ( previous_key >> 32 ) & 0xffffffffUL;
 
+	/* The sums are reduced before they can overflow
+	 */
+	maximum_data_offset = 4 * FLETCHER64_MAXIMUM_NUMBER_OF_VALUES;
+
         for( data_offset = 0;
 	     data_offset < data_size;
 	     data_offset += 4 )
 	{
+		if( data_offset == maximum_data_offset )
+		{
+			lower_32bit %= 0xffffffffUL;
+			upper_32bit %= 0xffffffffUL;
+
+			maximum_data_offset += 4 * FLETCHER64_MAXIMUM_NUMBER_OF_VALUES;
+		}
 		byte_stream_copy_to_uint32_little_endian(
 		 &( data[ data_offset ] ),
 		 value_32bit );
@@ -109,3 +132,371 @@ int fletcher64_calculate(
 	return( 1 );
 }
 
+#if defined( HAVE_CPU_FEATURES_X86 )
+
+/* Adds the lane sums of a SIMD block to the Fletcher-64 sums
+ * The lower sums contain the sum of the 32-bit values per lane and the upper sums
+ * the sum of the values per lane weighted by the number of vectors that remain
+ * Returns the Fletcher-64
+ */
+static uint64_t fletcher64_add_lane_sums(
+                 uint64_t checksum_value,
+                 const uint64_t *lower_sums,
+                 const uint64_t *upper_sums,
+                 const uint8_t *lane_indexes,
+                 uint8_t number_of_lanes,
+                 size_t number_of_values )
+{
+	uint64_t lower_32bit  = 0;
+	uint64_t upper_32bit  = 0;
+	uint64_t weighted_sum = 0;
+	uint8_t lane_index    = 0;
+
+	lower_32bit = checksum_value & 0xffffffffUL;
+	upper_32bit = ( checksum_value >> 32 ) & 0xffffffffUL;
+
+	/* The lower sum is added to the upper sum for every value
+	 */
+	upper_32bit += (uint64_t) number_of_values * lower_32bit;
+
+	/* The value at index i of a block of n values is added n - i times
+	 * to the upper sum, which is the number of remaining vectors times
+	 * the number of lanes minus the index of the lane
+	 */
+	for( lane_index = 0;
+	     lane_index < number_of_lanes;
+	     lane_index++ )
+	{
+		lower_32bit  += lower_sums[ lane_index ] % 0xffffffffUL;
+		upper_32bit  += ( upper_sums[ lane_index ] % 0xffffffffUL ) * number_of_lanes;
+		weighted_sum += ( lower_sums[ lane_index ] % 0xffffffffUL ) * lane_indexes[ lane_index ];
+	}
+	lower_32bit %= 0xffffffffUL;
+	upper_32bit  = ( upper_32bit + ( 0xffffffffUL - ( weighted_sum % 0xffffffffUL ) ) ) % 0xffffffffUL;
+
+	return( ( upper_32bit << 32 ) | lower_32bit );
+}
+
+/* Calculates the Fletcher-64 of a buffer using SSE2
+ * The size must be a multiple of 16
+ * Returns the Fletcher-64
+ */
+CPU_FEATURES_TARGET( "sse2" )
+static uint64_t fletcher64_calculate_sse2(
+                 uint64_t checksum_value,
+                 const uint8_t *buffer,
+                 size_t size )
+{
+	static const uint8_t lane_indexes[ 4 ] = { 0, 1, 2, 3 };
+
+	uint64_t lower_sums[ 4 ];
+	uint64_t upper_sums[ 4 ];
+
+	__m128i lower_sums1;
+	__m128i lower_sums2;
+	__m128i upper_sums1;
+	__m128i upper_sums2;
+	__m128i value;
+	__m128i zero;
+
+	size_t number_of_blocks = 0;
+	size_t block_index      = 0;
+
+	zero = _mm_setzero_si128();
+
+	while( size > 0 )
+	{
+		/* The sums need to be reduced per 65536 vectors
+		 */
+		number_of_blocks = size / 16;
+
+		if( number_of_blocks > FLETCHER64_MAXIMUM_NUMBER_OF_VALUES )
+		{
+			number_of_blocks = FLETCHER64_MAXIMUM_NUMBER_OF_VALUES;
+		}
+		size -= number_of_blocks * 16;
+
+		lower_sums1 = _mm_setzero_si128();
+		lower_sums2 = _mm_setzero_si128();
+		upper_sums1 = _mm_setzero_si128();
+		upper_sums2 = _mm_setzero_si128();
+
+		for( block_index = 0;
+		     block_index < number_of_blocks;
+		     block_index++ )
+		{
+			value = _mm_loadu_si128(
+			         (const __m128i *) buffer );
+
+			/* Zero extend the 32-bit values 0 and 1 and 2 and 3 into 64-bit lanes
+			 */
+			lower_sums1 = _mm_add_epi64(
+			               lower_sums1,
+			               _mm_unpacklo_epi32(
+			                value,
+			                zero ) );
+
+			lower_sums2 = _mm_add_epi64(
+			               lower_sums2,
+			               _mm_unpackhi_epi32(
+			                value,
+			                zero ) );
+
+			upper_sums1 = _mm_add_epi64(
+			               upper_sums1,
+			               lower_sums1 );
+
+			upper_sums2 = _mm_add_epi64(
+			               upper_sums2,
+			               lower_sums2 );
+
+			buffer += 16;
+		}
+		_mm_storeu_si128(
+		 (__m128i *) &( lower_sums[ 0 ] ),
+		 lower_sums1 );
+		_mm_storeu_si128(
+		 (__m128i *) &( lower_sums[ 2 ] ),
+		 lower_sums2 );
+		_mm_storeu_si128(
+		 (__m128i *) &( upper_sums[ 0 ] ),
+		 upper_sums1 );
+		_mm_storeu_si128(
+		 (__m128i *) &( upper_sums[ 2 ] ),
+		 upper_sums2 );
+
+		checksum_value = fletcher64_add_lane_sums(
+		                  checksum_value,
+		                  lower_sums,
+		                  upper_sums,
+		                  lane_indexes,
+		                  4,
+		                  number_of_blocks * 4 );
+	}
+	return( checksum_value );
+}
+
+/* Calculates the Fletcher-64 of a buffer using AVX2
+ * The size must be a multiple of 32
+ * Returns the Fletcher-64
+ */
+CPU_FEATURES_TARGET( "avx2" )
+static uint64_t fletcher64_calculate_avx2(
+                 uint64_t checksum_value,
+                 const uint8_t *buffer,
+                 size_t size )
+{
+	/* The unpack instructions operate on the 128-bit halves, hence the first
+	 * sums contain the values 0, 1, 4 and 5 and the second sums 2, 3, 6 and 7
+	 */
+	static const uint8_t lane_indexes[ 8 ] = { 0, 1, 4, 5, 2, 3, 6, 7 };
+
+	uint64_t lower_sums[ 8 ];
+	uint64_t upper_sums[ 8 ];
+
+	__m256i lower_sums1;
+	__m256i lower_sums2;
+	__m256i upper_sums1;
+	__m256i upper_sums2;
+	__m256i value;
+	__m256i zero;
+
+	size_t number_of_blocks = 0;
+	size_t block_index      = 0;
+
+	zero = _mm256_setzero_si256();
+
+	while( size > 0 )
+	{
+		/* The sums need to be reduced per 65536 vectors
+		 */
+		number_of_blocks = size / 32;
+
+		if( number_of_blocks > FLETCHER64_MAXIMUM_NUMBER_OF_VALUES )
+		{
+			number_of_blocks = FLETCHER64_MAXIMUM_NUMBER_OF_VALUES;
+		}
+		size -= number_of_blocks * 32;
+
+		lower_sums1 = _mm256_setzero_si256();
+		lower_sums2 = _mm256_setzero_si256();
+		upper_sums1 = _mm256_setzero_si256();
+		upper_sums2 = _mm256_setzero_si256();
+
+		for( block_index = 0;
+		     block_index < number_of_blocks;
+		     block_index++ )
+		{
+			value = _mm256_loadu_si256(
+			         (const __m256i *) buffer );
+
+			lower_sums1 = _mm256_add_epi64(
+			               lower_sums1,
+			               _mm256_unpacklo_epi32(
+			                value,
+			                zero ) );
+
+			lower_sums2 = _mm256_add_epi64(
+			               lower_sums2,
+			               _mm256_unpackhi_epi32(
+			                value,
+			                zero ) );
+
+			upper_sums1 = _mm256_add_epi64(
+			               upper_sums1,
+			               lower_sums1 );
+
+			upper_sums2 = _mm256_add_epi64(
+			               upper_sums2,
+			               lower_sums2 );
+
+			buffer += 32;
+		}
+		_mm256_storeu_si256(
+		 (__m256i *) &( lower_sums[ 0 ] ),
+		 lower_sums1 );
+		_mm256_storeu_si256(
+		 (__m256i *) &( lower_sums[ 4 ] ),
+		 lower_sums2 );
+		_mm256_storeu_si256(
+		 (__m256i *) &( upper_sums[ 0 ] ),
+		 upper_sums1 );
+		_mm256_storeu_si256(
+		 (__m256i *) &( upper_sums[ 4 ] ),
+		 upper_sums2 );
+
+		checksum_value = fletcher64_add_lane_sums(
+		                  checksum_value,
+		                  lower_sums,
+		                  upper_sums,
+		                  lane_indexes,
+		                  8,
+		                  number_of_blocks * 8 );
+	}
+	return( checksum_value );
+}
+
+#endif /* defined( HAVE_CPU_FEATURES_X86 ) */
+
+/* Calculates the Fletcher-64 of a buffer of data
+ * Uses the SIMD instructions of the CPU if available, otherwise falls back to the basic variant
+ *
+ * On x86 AVX2 or SSE2 is used, where the 32-bit values are added in 64-bit lanes
+ * and the sums are only reduced every 65536 vectors.
+ * The data that remains after the last SIMD block is calculated with the basic variant.
+ *
+ * Use a previous key of 0 to calculate a new Fletcher-64
+ * Returns 1 if successful or -1 on error
+ */
+int fletcher64_calculate_simd(
+     uint64_t previous_key,
+     uint8_t *data,
+     size_t data_size,
+     uint64_t *fletcher64,
+     libcerror_error_t **error )
+{
+	static char *function = "fletcher64_calculate_simd";
+	size_t data_offset    = 0;
+	size_t block_size     = 0;
+	uint64_t value_64bit  = 0;
+
+	if( data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid data.",
+		 function );
+
+		return( -1 );
+	}
+	if( data_size > (size_t) SSIZE_MAX )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid data size value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( data_size % 4 ) != 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid data size value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( fletcher64 == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid Fletcher-64.",
+		 function );
+
+		return( -1 );
+	}
+	/* The SIMD functions expect reduced sums
+	 */
+	value_64bit = ( ( ( previous_key >> 32 ) % 0xffffffffUL ) << 32 )
+	            | ( ( previous_key & 0xffffffffUL ) % 0xffffffffUL );
+
+#if defined( HAVE_CPU_FEATURES_X86 )
+	if( ( data_size >= 32 )
+	 && ( cpu_features_has(
+	       CPU_FEATURE_FLAG_AVX2 ) != 0 ) )
+	{
+		block_size = data_size & ~( (size_t) 31 );
+
+		value_64bit = fletcher64_calculate_avx2(
+		               value_64bit,
+		               data,
+		               block_size );
+
+		data_offset = block_size;
+	}
+	if( ( ( data_size - data_offset ) >= 16 )
+	 && ( cpu_features_has(
+	       CPU_FEATURE_FLAG_SSE2 ) != 0 ) )
+	{
+		block_size = ( data_size - data_offset ) & ~( (size_t) 15 );
+
+		value_64bit = fletcher64_calculate_sse2(
+		               value_64bit,
+		               &( data[ data_offset ] ),
+		               block_size );
+
+		data_offset += block_size;
+	}
+#endif
+	/* Calculate the remaining data using the basic variant
+	 */
+	if( fletcher64_calculate(
+	     value_64bit,
+	     &( data[ data_offset ] ),
+	     data_size - data_offset,
+	     &value_64bit,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GENERIC,
+		 "%s: unable to calculate Fletcher-64 of remaining data.",
+		 function );
+
+		return( -1 );
+	}
+	*fletcher64 = value_64bit;
+
+	return( 1 );
+}
+
@@ -38,6 +38,13 @@ int fletcher64_calculate(
      uint64_t *fletcher64,
      libcerror_error_t **error );
 
+int fletcher64_calculate_simd(
+     uint64_t previous_key,
+     uint8_t *buffer,
+     size_t size,
+     uint64_t *fletcher64,
+     libcerror_error_t **error );
+
 #if defined( __cplusplus )
 }
 #endif
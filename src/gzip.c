@@ -0,0 +1,833 @@
+/*
+ * GZIP decompression functions
+ *
+ * Copyright (C) 2008-2019, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This software is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This software is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this software.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <byte_stream.h>
+#include <memory.h>
+#include <types.h>
+
+#include "assorted_libcerror.h"
+#include "assorted_libcnotify.h"
+#include "crc32.h"
+#include "deflate_stream.h"
+#include "gzip.h"
+
+/* Determines if the data starts with the signature of a member header
+ * Returns 1 if the data starts with the signature or 0 if not
+ */
+int gzip_check_signature(
+     const uint8_t *data,
+     size_t data_size )
+{
+	if( ( data == NULL )
+	 || ( data_size < 2 ) )
+	{
+		return( 0 );
+	}
+	if( ( data[ 0 ] != 0x1f )
+	 || ( data[ 1 ] != 0x8b ) )
+	{
+		return( 0 );
+	}
+	return( 1 );
+}
+
+/* Reads a member header
+ * The BGZF member size is read from the "BC" extra subfield, which BGZF
+ * stores in every member so that the members can be located without decompressing them
+ * Returns 1 if successful, 0 if the data does not start with a member header or -1 on error
+ */
+int gzip_member_header_read_data(
+     gzip_member_header_t *member_header,
+     const uint8_t *data,
+     size_t data_size,
+     libcerror_error_t **error )
+{
+	static char *function       = "gzip_member_header_read_data";
+	size_t data_offset          = 0;
+	size_t extra_field_end      = 0;
+	uint32_t calculated_crc32   = 0;
+	uint16_t extra_field_size   = 0;
+	uint16_t stored_header_crc  = 0;
+	uint16_t subfield_data_size = 0;
+	uint16_t value_16bit        = 0;
+
+	if( member_header == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid member header.",
+		 function );
+
+		return( -1 );
+	}
+	if( data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid data.",
+		 function );
+
+		return( -1 );
+	}
+	if( data_size > (size_t) SSIZE_MAX )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid data size value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	if( gzip_check_signature(
+	     data,
+	     data_size ) == 0 )
+	{
+		return( 0 );
+	}
+	if( data_size < GZIP_MEMBER_HEADER_SIZE )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_TOO_SMALL,
+		 "%s: invalid data value too small.",
+		 function );
+
+		return( -1 );
+	}
+	if( data[ 2 ] != GZIP_COMPRESSION_METHOD_DEFLATE )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_UNSUPPORTED_VALUE,
+		 "%s: unsupported compression method: %" PRIu8 ".",
+		 function,
+		 data[ 2 ] );
+
+		return( -1 );
+	}
+	if( ( data[ 3 ] & 0xe0 ) != 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_UNSUPPORTED_VALUE,
+		 "%s: unsupported flags: 0x%02" PRIx8 ".",
+		 function,
+		 data[ 3 ] );
+
+		return( -1 );
+	}
+	member_header->flags = data[ 3 ];
+
+	byte_stream_copy_to_uint32_little_endian(
+	 &( data[ 4 ] ),
+	 member_header->modification_time );
+
+	member_header->extra_flags      = data[ 8 ];
+	member_header->operating_system = data[ 9 ];
+	member_header->bgzf_member_size = 0;
+
+	data_offset = GZIP_MEMBER_HEADER_SIZE;
+
+	if( ( member_header->flags & GZIP_MEMBER_FLAG_EXTRA_FIELD ) != 0 )
+	{
+		if( ( data_size - data_offset ) < 2 )
+		{
+			goto on_truncated;
+		}
+		byte_stream_copy_to_uint16_little_endian(
+		 &( data[ data_offset ] ),
+		 extra_field_size );
+
+		data_offset += 2;
+
+		if( (size_t) extra_field_size > ( data_size - data_offset ) )
+		{
+			goto on_truncated;
+		}
+		extra_field_end = data_offset + extra_field_size;
+
+		/* Every subfield consists of a 2 byte identifier, a 2 byte size and the subfield data
+		 */
+		while( ( data_offset + 4 ) <= extra_field_end )
+		{
+			byte_stream_copy_to_uint16_little_endian(
+			 &( data[ data_offset + 2 ] ),
+			 subfield_data_size );
+
+			if( (size_t) subfield_data_size > ( extra_field_end - ( data_offset + 4 ) ) )
+			{
+				break;
+			}
+			if( ( data[ data_offset ] == 'B' )
+			 && ( data[ data_offset + 1 ] == 'C' )
+			 && ( subfield_data_size == 2 ) )
+			{
+				/* The BGZF block size is the size of the member minus 1
+				 */
+				byte_stream_copy_to_uint16_little_endian(
+				 &( data[ data_offset + 4 ] ),
+				 value_16bit );
+
+				member_header->bgzf_member_size = (size_t) value_16bit + 1;
+			}
+			data_offset += 4 + (size_t) subfield_data_size;
+		}
+		data_offset = extra_field_end;
+	}
+	if( ( member_header->flags & GZIP_MEMBER_FLAG_NAME ) != 0 )
+	{
+		while( ( data_offset < data_size )
+		    && ( data[ data_offset ] != 0 ) )
+		{
+			data_offset++;
+		}
+		if( data_offset >= data_size )
+		{
+			goto on_truncated;
+		}
+		data_offset++;
+	}
+	if( ( member_header->flags & GZIP_MEMBER_FLAG_COMMENT ) != 0 )
+	{
+		while( ( data_offset < data_size )
+		    && ( data[ data_offset ] != 0 ) )
+		{
+			data_offset++;
+		}
+		if( data_offset >= data_size )
+		{
+			goto on_truncated;
+		}
+		data_offset++;
+	}
+	if( ( member_header->flags & GZIP_MEMBER_FLAG_HEADER_CRC ) != 0 )
+	{
+		if( ( data_size - data_offset ) < 2 )
+		{
+			goto on_truncated;
+		}
+		byte_stream_copy_to_uint16_little_endian(
+		 &( data[ data_offset ] ),
+		 stored_header_crc );
+
+		/* The header CRC consists of the least significant 16 bits
+		 * of the CRC-32 of the header up to the header CRC
+		 */
+		if( crc32_calculate_hardware(
+		     &calculated_crc32,
+		     (uint8_t *) data,
+		     data_offset,
+		     0,
+		     0,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GENERIC,
+			 "%s: unable to calculate CRC-32.",
+			 function );
+
+			return( -1 );
+		}
+		if( stored_header_crc != (uint16_t) ( calculated_crc32 & 0xffff ) )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_INPUT,
+			 LIBCERROR_INPUT_ERROR_CHECKSUM_MISMATCH,
+			 "%s: header checksum does not match (stored: 0x%04" PRIx16 ", calculated: 0x%04" PRIx32 ").",
+			 function,
+			 stored_header_crc,
+			 calculated_crc32 & 0xffff );
+
+			return( -1 );
+		}
+		data_offset += 2;
+	}
+	member_header->header_size = data_offset;
+
+	if( libcnotify_verbose != 0 )
+	{
+		libcnotify_printf(
+		 "%s: flags\t\t\t\t: 0x%02" PRIx8 "\n",
+		 function,
+		 member_header->flags );
+
+		libcnotify_printf(
+		 "%s: modification time\t\t: %" PRIu32 "\n",
+		 function,
+		 member_header->modification_time );
+
+		libcnotify_printf(
+		 "%s: operating system\t\t: %" PRIu8 "\n",
+		 function,
+		 member_header->operating_system );
+
+		libcnotify_printf(
+		 "%s: header size\t\t\t: %" PRIzd "\n",
+		 function,
+		 member_header->header_size );
+
+		libcnotify_printf(
+		 "%s: BGZF member size\t\t: %" PRIzd "\n",
+		 function,
+		 member_header->bgzf_member_size );
+
+		libcnotify_printf(
+		 "\n" );
+	}
+	return( 1 );
+
+on_truncated:
+	libcerror_error_set(
+	 error,
+	 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+	 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+	 "%s: truncated member header.",
+	 function );
+
+	return( -1 );
+}
+
+/* Reads a member footer
+ * The uncompressed size is stored modulo 2^32
+ * Returns 1 if successful or -1 on error
+ */
+int gzip_member_footer_read_data(
+     const uint8_t *data,
+     size_t data_size,
+     uint32_t *crc32,
+     uint32_t *uncompressed_size,
+     libcerror_error_t **error )
+{
+	static char *function = "gzip_member_footer_read_data";
+
+	if( data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid data.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( data_size < GZIP_MEMBER_FOOTER_SIZE )
+	 || ( data_size > (size_t) SSIZE_MAX ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid data size value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( crc32 == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid CRC-32.",
+		 function );
+
+		return( -1 );
+	}
+	if( uncompressed_size == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid uncompressed size.",
+		 function );
+
+		return( -1 );
+	}
+	byte_stream_copy_to_uint32_little_endian(
+	 &( data[ 0 ] ),
+	 *crc32 );
+
+	byte_stream_copy_to_uint32_little_endian(
+	 &( data[ 4 ] ),
+	 *uncompressed_size );
+
+	return( 1 );
+}
+
+/* Creates a decoder
+ * Make sure the value decoder is referencing, is set to NULL
+ * Returns 1 if successful or -1 on error
+ */
+int gzip_decoder_initialize(
+     gzip_decoder_t **decoder,
+     libcerror_error_t **error )
+{
+	static char *function = "gzip_decoder_initialize";
+
+	if( decoder == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid decoder.",
+		 function );
+
+		return( -1 );
+	}
+	if( *decoder != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid decoder value already set.",
+		 function );
+
+		return( -1 );
+	}
+	*decoder = memory_allocate_structure(
+	            gzip_decoder_t );
+
+	if( *decoder == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create decoder.",
+		 function );
+
+		goto on_error;
+	}
+	( *decoder )->stream = NULL;
+
+	if( deflate_stream_initialize(
+	     &( ( *decoder )->stream ),
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create stream.",
+		 function );
+
+		goto on_error;
+	}
+	return( 1 );
+
+on_error:
+	if( *decoder != NULL )
+	{
+		memory_free(
+		 *decoder );
+
+		*decoder = NULL;
+	}
+	return( -1 );
+}
+
+/* Frees a decoder
+ * Returns 1 if successful or -1 on error
+ */
+int gzip_decoder_free(
+     gzip_decoder_t **decoder,
+     libcerror_error_t **error )
+{
+	static char *function = "gzip_decoder_free";
+	int result            = 1;
+
+	if( decoder == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid decoder.",
+		 function );
+
+		return( -1 );
+	}
+	if( *decoder != NULL )
+	{
+		if( deflate_stream_free(
+		     &( ( *decoder )->stream ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free stream.",
+			 function );
+
+			result = -1;
+		}
+		memory_free(
+		 *decoder );
+
+		*decoder = NULL;
+	}
+	return( result );
+}
+
+/* Decompresses a GZIP member
+ * The compressed data must start with the member header and can contain subsequent
+ * members, of which the data is ignored, on return member_size contains the size of
+ * the member and uncompressed_data_size the size of its uncompressed data
+ * The CRC-32 is calculated over every part of the uncompressed data directly after it
+ * was decompressed, unless GZIP_DECOMPRESS_FLAG_IGNORE_CHECKSUM is set
+ * Returns 1 on success or -1 on error
+ */
+int gzip_decoder_decompress_member(
+     gzip_decoder_t *decoder,
+     const uint8_t *compressed_data,
+     size_t compressed_data_size,
+     uint8_t *uncompressed_data,
+     size_t *uncompressed_data_size,
+     size_t *member_size,
+     uint8_t flags,
+     libcerror_error_t **error )
+{
+	gzip_member_header_t member_header;
+
+	static char *function           = "gzip_decoder_decompress_member";
+	size_t compressed_data_offset   = 0;
+	size_t stream_compressed_size   = 0;
+	size_t stream_uncompressed_size = 0;
+	size_t uncompressed_data_offset = 0;
+	uint32_t calculated_crc32       = 0;
+	uint32_t stored_crc32           = 0;
+	uint32_t stored_size            = 0;
+	int result                      = 0;
+
+	if( decoder == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid decoder.",
+		 function );
+
+		return( -1 );
+	}
+	if( compressed_data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid compressed data.",
+		 function );
+
+		return( -1 );
+	}
+	if( compressed_data_size > (size_t) SSIZE_MAX )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid compressed data size value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	if( uncompressed_data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid uncompressed data.",
+		 function );
+
+		return( -1 );
+	}
+	if( uncompressed_data_size == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid uncompressed data size.",
+		 function );
+
+		return( -1 );
+	}
+	if( *uncompressed_data_size > (size_t) SSIZE_MAX )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid uncompressed data size value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	if( member_size == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid member size.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( flags & ~( GZIP_DECOMPRESS_FLAG_IGNORE_CHECKSUM ) ) != 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_UNSUPPORTED_VALUE,
+		 "%s: unsupported flags: 0x%02" PRIx8 ".",
+		 function,
+		 flags );
+
+		return( -1 );
+	}
+	result = gzip_member_header_read_data(
+	          &member_header,
+	          compressed_data,
+	          compressed_data_size,
+	          error );
+
+	if( result == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_READ_FAILED,
+		 "%s: unable to read member header.",
+		 function );
+
+		return( -1 );
+	}
+	else if( result == 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_UNSUPPORTED_VALUE,
+		 "%s: unsupported member signature.",
+		 function );
+
+		return( -1 );
+	}
+	/* The deflate data of a BGZF member cannot extend beyond the member
+	 */
+	if( member_header.bgzf_member_size != 0 )
+	{
+		if( ( member_header.bgzf_member_size < ( member_header.header_size + GZIP_MEMBER_FOOTER_SIZE ) )
+		 || ( member_header.bgzf_member_size > compressed_data_size ) )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+			 "%s: invalid BGZF member size value out of bounds.",
+			 function );
+
+			return( -1 );
+		}
+		compressed_data_size = member_header.bgzf_member_size;
+	}
+	if( deflate_stream_reset(
+	     decoder->stream,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to reset stream.",
+		 function );
+
+		return( -1 );
+	}
+	compressed_data_offset = member_header.header_size;
+
+	do
+	{
+		stream_compressed_size   = compressed_data_size - compressed_data_offset;
+		stream_uncompressed_size = *uncompressed_data_size - uncompressed_data_offset;
+
+		result = deflate_stream_decompress(
+		          decoder->stream,
+		          &( compressed_data[ compressed_data_offset ] ),
+		          &stream_compressed_size,
+		          &( uncompressed_data[ uncompressed_data_offset ] ),
+		          &stream_uncompressed_size,
+		          DEFLATE_STREAM_FLAG_END_OF_INPUT | DEFLATE_STREAM_FLAG_RAW,
+		          error );
+
+		if( result == -1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_COMPRESSION,
+			 LIBCERROR_COMPRESSION_ERROR_DECOMPRESS_FAILED,
+			 "%s: unable to decompress data.",
+			 function );
+
+			return( -1 );
+		}
+		if( ( stream_uncompressed_size > 0 )
+		 && ( ( flags & GZIP_DECOMPRESS_FLAG_IGNORE_CHECKSUM ) == 0 ) )
+		{
+			if( crc32_calculate_hardware(
+			     &calculated_crc32,
+			     &( uncompressed_data[ uncompressed_data_offset ] ),
+			     stream_uncompressed_size,
+			     calculated_crc32,
+			     0,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_GENERIC,
+				 "%s: unable to calculate CRC-32.",
+				 function );
+
+				return( -1 );
+			}
+		}
+		compressed_data_offset   += stream_compressed_size;
+		uncompressed_data_offset += stream_uncompressed_size;
+
+		if( ( result == 0 )
+		 && ( stream_compressed_size == 0 )
+		 && ( stream_uncompressed_size == 0 ) )
+		{
+			if( uncompressed_data_offset == *uncompressed_data_size )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+				 LIBCERROR_ARGUMENT_ERROR_VALUE_TOO_SMALL,
+				 "%s: invalid uncompressed data size value too small.",
+				 function );
+			}
+			else
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_COMPRESSION,
+				 LIBCERROR_COMPRESSION_ERROR_DECOMPRESS_FAILED,
+				 "%s: truncated compressed data.",
+				 function );
+			}
+			return( -1 );
+		}
+	}
+	while( result != 1 );
+
+	/* The input buffer of the stream contains the data after the end of the deflate data
+	 */
+	compressed_data_offset -= decoder->stream->bit_stream.byte_stream_size
+	                        - decoder->stream->bit_stream.byte_stream_offset;
+
+	if( gzip_member_footer_read_data(
+	     &( compressed_data[ compressed_data_offset ] ),
+	     compressed_data_size - compressed_data_offset,
+	     &stored_crc32,
+	     &stored_size,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_READ_FAILED,
+		 "%s: unable to read member footer.",
+		 function );
+
+		return( -1 );
+	}
+	compressed_data_offset += GZIP_MEMBER_FOOTER_SIZE;
+
+	if( ( member_header.bgzf_member_size != 0 )
+	 && ( compressed_data_offset != member_header.bgzf_member_size ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_INPUT,
+		 LIBCERROR_INPUT_ERROR_VALUE_MISMATCH,
+		 "%s: mismatch in BGZF member size ( %" PRIzd " != %" PRIzd " ).",
+		 function,
+		 compressed_data_offset,
+		 member_header.bgzf_member_size );
+
+		return( -1 );
+	}
+	if( stored_size != (uint32_t) uncompressed_data_offset )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_INPUT,
+		 LIBCERROR_INPUT_ERROR_VALUE_MISMATCH,
+		 "%s: mismatch in uncompressed size ( %" PRIu32 " != %" PRIu32 " ).",
+		 function,
+		 stored_size,
+		 (uint32_t) uncompressed_data_offset );
+
+		return( -1 );
+	}
+	if( ( ( flags & GZIP_DECOMPRESS_FLAG_IGNORE_CHECKSUM ) == 0 )
+	 && ( stored_crc32 != calculated_crc32 ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_INPUT,
+		 LIBCERROR_INPUT_ERROR_CHECKSUM_MISMATCH,
+		 "%s: checksum does not match (stored: 0x%08" PRIx32 ", calculated: 0x%08" PRIx32 ").",
+		 function,
+		 stored_crc32,
+		 calculated_crc32 );
+
+		return( -1 );
+	}
+	*uncompressed_data_size = uncompressed_data_offset;
+	*member_size            = compressed_data_offset;
+
+	return( 1 );
+}
+
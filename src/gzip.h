@@ -0,0 +1,153 @@
+/*
+ * GZIP decompression functions
+ *
+ * Copyright (C) 2008-2019, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This software is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This software is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this software.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#if !defined( _GZIP_H )
+#define _GZIP_H
+
+#include <common.h>
+#include <types.h>
+
+#include "assorted_libcerror.h"
+#include "deflate_stream.h"
+
+#if defined( __cplusplus )
+extern "C" {
+#endif
+
+/* The size of a member header without the optional fields
+ */
+#define GZIP_MEMBER_HEADER_SIZE		10
+
+/* The size of a member footer, which contains the CRC-32 and the uncompressed size
+ */
+#define GZIP_MEMBER_FOOTER_SIZE		8
+
+/* The maximum size of a BGZF member, including its header and footer
+ */
+#define GZIP_BGZF_MAXIMUM_MEMBER_SIZE	65536
+
+/* The compression methods
+ */
+enum GZIP_COMPRESSION_METHODS
+{
+	GZIP_COMPRESSION_METHOD_DEFLATE		= 8
+};
+
+/* The member header flags
+ */
+enum GZIP_MEMBER_FLAGS
+{
+	GZIP_MEMBER_FLAG_TEXT			= 0x01,
+	GZIP_MEMBER_FLAG_HEADER_CRC		= 0x02,
+	GZIP_MEMBER_FLAG_EXTRA_FIELD		= 0x04,
+	GZIP_MEMBER_FLAG_NAME			= 0x08,
+	GZIP_MEMBER_FLAG_COMMENT		= 0x10
+};
+
+/* The decompression flags
+ */
+enum GZIP_DECOMPRESS_FLAGS
+{
+	/* Do not calculate and verify the CRC-32 of the uncompressed data
+	 */
+	GZIP_DECOMPRESS_FLAG_IGNORE_CHECKSUM	= 0x01
+};
+
+typedef struct gzip_member_header gzip_member_header_t;
+
+struct gzip_member_header
+{
+	/* The flags
+	 */
+	uint8_t flags;
+
+	/* The modification time, which contains a POSIX timestamp or 0 if not set
+	 */
+	uint32_t modification_time;
+
+	/* The extra flags
+	 */
+	uint8_t extra_flags;
+
+	/* The operating system
+	 */
+	uint8_t operating_system;
+
+	/* The size of the header, including the optional fields
+	 */
+	size_t header_size;
+
+	/* The size of the member, including the header and footer, as stored in
+	 * the BGZF extra subfield or 0 if the member has no BGZF extra subfield
+	 */
+	size_t bgzf_member_size;
+};
+
+typedef struct gzip_decoder gzip_decoder_t;
+
+struct gzip_decoder
+{
+	/* The stream used to decompress the raw deflate data of a member
+	 */
+	deflate_stream_t *stream;
+};
+
+int gzip_check_signature(
+     const uint8_t *data,
+     size_t data_size );
+
+int gzip_member_header_read_data(
+     gzip_member_header_t *member_header,
+     const uint8_t *data,
+     size_t data_size,
+     libcerror_error_t **error );
+
+int gzip_member_footer_read_data(
+     const uint8_t *data,
+     size_t data_size,
+     uint32_t *crc32,
+     uint32_t *uncompressed_size,
+     libcerror_error_t **error );
+
+int gzip_decoder_initialize(
+     gzip_decoder_t **decoder,
+     libcerror_error_t **error );
+
+int gzip_decoder_free(
+     gzip_decoder_t **decoder,
+     libcerror_error_t **error );
+
+int gzip_decoder_decompress_member(
+     gzip_decoder_t *decoder,
+     const uint8_t *compressed_data,
+     size_t compressed_data_size,
+     uint8_t *uncompressed_data,
+     size_t *uncompressed_data_size,
+     size_t *member_size,
+     uint8_t flags,
+     libcerror_error_t **error );
+
+#if defined( __cplusplus )
+}
+#endif
+
+#endif /* !defined( _GZIP_H ) */
+
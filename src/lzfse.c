@@ -0,0 +1,1597 @@
+/*
+ * LZFSE decompression functions
+ *
+ * Copyright (C) 2008-2019, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This software is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This software is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this software.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <byte_stream.h>
+#include <lz_match.h>
+#include <memory.h>
+#include <types.h>
+
+#include "assorted_libcerror.h"
+#include "lzfse.h"
+#include "lzvn.h"
+
+/* The number of value bits and the value bases of the literal size (L) symbols
+ */
+const uint8_t lzfse_l_value_bits[ LZFSE_NUMBER_OF_L_SYMBOLS ] = {
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	2, 3, 5, 8 };
+
+const int32_t lzfse_l_value_bases[ LZFSE_NUMBER_OF_L_SYMBOLS ] = {
+	0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15,
+	16, 20, 28, 60 };
+
+/* The number of value bits and the value bases of the match size (M) symbols
+ */
+const uint8_t lzfse_m_value_bits[ LZFSE_NUMBER_OF_M_SYMBOLS ] = {
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	3, 5, 8, 11 };
+
+const int32_t lzfse_m_value_bases[ LZFSE_NUMBER_OF_M_SYMBOLS ] = {
+	0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15,
+	16, 24, 56, 312 };
+
+/* The number of value bits and the value bases of the match distance (D) symbols
+ * a distance of 0 indicates that the distance of the previous match is used
+ */
+const uint8_t lzfse_d_value_bits[ LZFSE_NUMBER_OF_D_SYMBOLS ] = {
+	0, 0, 0, 0, 1, 1, 1, 1, 2, 2, 2, 2, 3, 3, 3, 3,
+	4, 4, 4, 4, 5, 5, 5, 5, 6, 6, 6, 6, 7, 7, 7, 7,
+	8, 8, 8, 8, 9, 9, 9, 9, 10, 10, 10, 10, 11, 11, 11, 11,
+	12, 12, 12, 12, 13, 13, 13, 13, 14, 14, 14, 14, 15, 15, 15, 15 };
+
+const int32_t lzfse_d_value_bases[ LZFSE_NUMBER_OF_D_SYMBOLS ] = {
+	0, 1, 2, 3, 4, 6, 8, 10,
+	12, 16, 20, 24, 28, 36, 44, 52,
+	60, 76, 92, 108, 124, 156, 188, 220,
+	252, 316, 380, 444, 508, 636, 764, 892,
+	1020, 1276, 1532, 1788, 2044, 2556, 3068, 3580,
+	4092, 5116, 6140, 7164, 8188, 10236, 12284, 14332,
+	16380, 20476, 24572, 28668, 32764, 40956, 49148, 57340,
+	65532, 81916, 98300, 114684, 131068, 163836, 196604, 229372 };
+
+/* The number of bits and the values of the variable-length encoded frequencies
+ * indexed by the 5 least significant bits, where 8 and 14 bit values store
+ * the frequency minus 8 or 24 in the bits above the 4 least significant bits
+ */
+const uint8_t lzfse_frequency_number_of_bits[ 32 ] = {
+	2, 3, 2, 5, 2, 3, 2, 8, 2, 3, 2, 5, 2, 3, 2, 14,
+	2, 3, 2, 5, 2, 3, 2, 8, 2, 3, 2, 5, 2, 3, 2, 14 };
+
+const uint8_t lzfse_frequency_values[ 32 ] = {
+	0, 2, 1, 4, 0, 3, 1, 0, 0, 2, 1, 5, 0, 3, 1, 0,
+	0, 2, 1, 6, 0, 3, 1, 0, 0, 2, 1, 7, 0, 3, 1, 0 };
+
+/* Initializes the bit stream to read backwards from the end of the byte stream
+ * The number of bits is 0 if all the bits of the last byte are used or -7 to -1
+ * for the number of unused most significant bits of the last byte
+ * Returns 1 on success or -1 on error
+ */
+static int lzfse_bit_stream_initialize(
+            lzfse_bit_stream_t *bit_stream,
+            const uint8_t *byte_stream,
+            size_t byte_stream_size,
+            int8_t number_of_bits,
+            libcerror_error_t **error )
+{
+	static char *function = "lzfse_bit_stream_initialize";
+	size_t byte_index     = 0;
+
+	if( ( number_of_bits < -7 )
+	 || ( number_of_bits > 0 ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid number of bits value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( byte_stream_size < 8 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_TOO_SMALL,
+		 "%s: invalid byte stream size value too small.",
+		 function );
+
+		return( -1 );
+	}
+	bit_stream->byte_stream = byte_stream;
+
+	if( number_of_bits != 0 )
+	{
+		bit_stream->byte_stream_offset = byte_stream_size - 8;
+
+		byte_stream_copy_to_uint64_little_endian(
+		 &( byte_stream[ bit_stream->byte_stream_offset ] ),
+		 bit_stream->bit_buffer );
+
+		bit_stream->bit_buffer_size = (uint8_t) ( 64 + number_of_bits );
+	}
+	else
+	{
+		/* The last byte is entirely used, hence only 7 bytes are read
+		 * so that the bit buffer has room for the next byte
+		 */
+		bit_stream->byte_stream_offset = byte_stream_size - 7;
+		bit_stream->bit_buffer         = 0;
+
+		for( byte_index = 7;
+		     byte_index > 0;
+		     byte_index-- )
+		{
+			bit_stream->bit_buffer <<= 8;
+			bit_stream->bit_buffer  |= byte_stream[ bit_stream->byte_stream_offset + byte_index - 1 ];
+		}
+		bit_stream->bit_buffer_size = 56;
+	}
+	if( ( bit_stream->bit_buffer >> bit_stream->bit_buffer_size ) != 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_UNSUPPORTED_VALUE,
+		 "%s: invalid unused bits of last byte value not zero.",
+		 function );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Adds the preceding bytes of the byte stream to the bit buffer
+ * so that the bit buffer contains at least 56 bits
+ * Returns 1 on success or -1 if the start of the byte stream was reached
+ */
+static int lzfse_bit_stream_refill(
+            lzfse_bit_stream_t *bit_stream )
+{
+	uint64_t value_64bit   = 0;
+	size_t number_of_bytes = 0;
+	uint8_t number_of_bits = 0;
+
+	number_of_bytes = (size_t) ( 63 - bit_stream->bit_buffer_size ) / 8;
+
+	if( number_of_bytes == 0 )
+	{
+		return( 1 );
+	}
+	if( number_of_bytes > bit_stream->byte_stream_offset )
+	{
+		return( -1 );
+	}
+	bit_stream->byte_stream_offset -= number_of_bytes;
+
+	/* The bytes after the bytes that are added have been read before
+	 * hence 8 bytes can be read without checking the end of the byte stream
+	 */
+	byte_stream_copy_to_uint64_little_endian(
+	 &( bit_stream->byte_stream[ bit_stream->byte_stream_offset ] ),
+	 value_64bit );
+
+	number_of_bits = (uint8_t) ( number_of_bytes * 8 );
+
+	bit_stream->bit_buffer     <<= number_of_bits;
+	bit_stream->bit_buffer      |= value_64bit & ( ( (uint64_t) 1 << number_of_bits ) - 1 );
+	bit_stream->bit_buffer_size += number_of_bits;
+
+	return( 1 );
+}
+
+/* Retrieves a value from the most significant bits of the bit buffer
+ * The caller must ensure that the bit buffer contains at least number of bits bits
+ * Returns the value
+ */
+static uint32_t lzfse_bit_stream_get_value(
+                 lzfse_bit_stream_t *bit_stream,
+                 uint8_t number_of_bits )
+{
+	uint32_t value = 0;
+
+	bit_stream->bit_buffer_size -= number_of_bits;
+
+	value = (uint32_t) ( bit_stream->bit_buffer >> bit_stream->bit_buffer_size );
+
+	bit_stream->bit_buffer &= ( (uint64_t) 1 << bit_stream->bit_buffer_size ) - 1;
+
+	return( value );
+}
+
+/* Reads a compressed block (version 2) header including the frequency tables
+ * Returns 1 if successful or -1 on error
+ */
+int lzfse_read_compressed_block_header(
+     lzfse_compressed_block_header_t *header,
+     const uint8_t *data,
+     size_t data_size,
+     libcerror_error_t **error )
+{
+	static char *function    = "lzfse_read_compressed_block_header";
+	size_t data_offset       = 0;
+	uint64_t packed_fields1  = 0;
+	uint64_t packed_fields2  = 0;
+	uint64_t packed_fields3  = 0;
+	uint32_t bit_buffer      = 0;
+	uint32_t signature       = 0;
+	uint16_t frequency_index = 0;
+	uint8_t bit_buffer_size  = 0;
+	uint8_t literal_index    = 0;
+	uint8_t lookup_value     = 0;
+	uint8_t number_of_bits   = 0;
+
+	if( header == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid header.",
+		 function );
+
+		return( -1 );
+	}
+	if( data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid data.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( data_size < LZFSE_COMPRESSED_BLOCK_HEADER_SIZE )
+	 || ( data_size > (size_t) SSIZE_MAX ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid data size value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	byte_stream_copy_to_uint32_little_endian(
+	 &( data[ 0 ] ),
+	 signature );
+
+	if( signature != LZFSE_BLOCK_SIGNATURE_COMPRESSED_V2 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_UNSUPPORTED_VALUE,
+		 "%s: unsupported signature.",
+		 function );
+
+		return( -1 );
+	}
+	byte_stream_copy_to_uint32_little_endian(
+	 &( data[ 4 ] ),
+	 header->uncompressed_size );
+
+	byte_stream_copy_to_uint64_little_endian(
+	 &( data[ 8 ] ),
+	 packed_fields1 );
+
+	byte_stream_copy_to_uint64_little_endian(
+	 &( data[ 16 ] ),
+	 packed_fields2 );
+
+	byte_stream_copy_to_uint64_little_endian(
+	 &( data[ 24 ] ),
+	 packed_fields3 );
+
+	header->number_of_literals = (uint32_t) ( packed_fields1 & 0x000fffffUL );
+	header->literals_size      = (uint32_t) ( ( packed_fields1 >> 20 ) & 0x000fffffUL );
+	header->number_of_matches  = (uint32_t) ( ( packed_fields1 >> 40 ) & 0x000fffffUL );
+	header->literal_bits       = (int8_t) ( ( packed_fields1 >> 60 ) & 0x07 ) - 7;
+
+	for( literal_index = 0;
+	     literal_index < 4;
+	     literal_index++ )
+	{
+		header->literal_states[ literal_index ] = (uint16_t) ( ( packed_fields2 >> ( 10 * literal_index ) ) & 0x03ff );
+	}
+	header->lmd_size = (uint32_t) ( ( packed_fields2 >> 40 ) & 0x000fffffUL );
+	header->lmd_bits = (int8_t) ( ( packed_fields2 >> 60 ) & 0x07 ) - 7;
+
+	header->header_size = (uint32_t) ( packed_fields3 & 0xffffffffUL );
+	header->l_state     = (uint16_t) ( ( packed_fields3 >> 32 ) & 0x03ff );
+	header->m_state     = (uint16_t) ( ( packed_fields3 >> 42 ) & 0x03ff );
+	header->d_state     = (uint16_t) ( ( packed_fields3 >> 52 ) & 0x03ff );
+
+	if( ( header->header_size < LZFSE_COMPRESSED_BLOCK_HEADER_SIZE )
+	 || ( (size_t) header->header_size > data_size ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid header size value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( header->number_of_literals > LZFSE_MAXIMUM_NUMBER_OF_LITERALS )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid number of literals value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( header->number_of_matches > LZFSE_MAXIMUM_NUMBER_OF_MATCHES )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid number of matches value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	for( literal_index = 0;
+	     literal_index < 4;
+	     literal_index++ )
+	{
+		if( header->literal_states[ literal_index ] >= LZFSE_NUMBER_OF_LITERAL_STATES )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+			 "%s: invalid literal state value out of bounds.",
+			 function );
+
+			return( -1 );
+		}
+	}
+	if( ( header->l_state >= LZFSE_NUMBER_OF_L_STATES )
+	 || ( header->m_state >= LZFSE_NUMBER_OF_M_STATES )
+	 || ( header->d_state >= LZFSE_NUMBER_OF_D_STATES ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid L, M or D state value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	/* The frequency tables are stored as variable-length values of 2 to 14 bits
+	 * that are read from the least significant bit, if the header contains
+	 * no frequency tables all the frequencies are 0
+	 */
+	data_offset = LZFSE_COMPRESSED_BLOCK_HEADER_SIZE;
+
+	if( data_offset == (size_t) header->header_size )
+	{
+		if( memory_set(
+		     header->frequencies,
+		     0,
+		     sizeof( uint16_t ) * LZFSE_NUMBER_OF_FREQUENCIES ) == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+			 "%s: unable to clear frequencies.",
+			 function );
+
+			return( -1 );
+		}
+		return( 1 );
+	}
+	for( frequency_index = 0;
+	     frequency_index < LZFSE_NUMBER_OF_FREQUENCIES;
+	     frequency_index++ )
+	{
+		while( ( data_offset < (size_t) header->header_size )
+		    && ( bit_buffer_size <= 24 ) )
+		{
+			bit_buffer      |= (uint32_t) data[ data_offset++ ] << bit_buffer_size;
+			bit_buffer_size += 8;
+		}
+		lookup_value   = (uint8_t) ( bit_buffer & 0x1f );
+		number_of_bits = lzfse_frequency_number_of_bits[ lookup_value ];
+
+		if( number_of_bits > bit_buffer_size )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+			 "%s: invalid frequency tables size value too small.",
+			 function );
+
+			return( -1 );
+		}
+		if( number_of_bits == 8 )
+		{
+			header->frequencies[ frequency_index ] = (uint16_t) ( 8 + ( ( bit_buffer >> 4 ) & 0x000f ) );
+		}
+		else if( number_of_bits == 14 )
+		{
+			header->frequencies[ frequency_index ] = (uint16_t) ( 24 + ( ( bit_buffer >> 4 ) & 0x03ff ) );
+		}
+		else
+		{
+			header->frequencies[ frequency_index ] = lzfse_frequency_values[ lookup_value ];
+		}
+		bit_buffer     >>= number_of_bits;
+		bit_buffer_size -= number_of_bits;
+	}
+	if( ( bit_buffer_size >= 8 )
+	 || ( data_offset != (size_t) header->header_size ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid frequency tables size value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Determines the number of bits needed to scale a frequency to the number of states
+ * so that number of states <= frequency << number of bits < 2 * number of states
+ * Returns the number of bits
+ */
+static uint8_t lzfse_get_frequency_number_of_bits(
+                uint16_t frequency,
+                uint16_t number_of_states )
+{
+	uint8_t number_of_bits = 0;
+
+	while( ( (uint32_t) frequency << number_of_bits ) < (uint32_t) number_of_states )
+	{
+		number_of_bits++;
+	}
+	return( number_of_bits );
+}
+
+/* Constructs a FSE decoder table from the symbol frequencies
+ * The states of a symbol are consecutive, the first states read the
+ * number of bits needed to scale the frequency to the number of states
+ * and the remaining states 1 bit less
+ * Returns 1 on success or -1 on error
+ */
+int lzfse_decoder_table_construct(
+     lzfse_decoder_entry_t *table,
+     uint16_t number_of_states,
+     const uint16_t *frequencies,
+     uint16_t number_of_symbols,
+     libcerror_error_t **error )
+{
+	static char *function          = "lzfse_decoder_table_construct";
+	uint32_t sum_of_frequencies    = 0;
+	uint16_t frequency             = 0;
+	uint16_t frequency_index       = 0;
+	uint16_t number_of_wide_states = 0;
+	uint16_t symbol                = 0;
+	uint16_t table_index           = 0;
+	uint8_t number_of_bits         = 0;
+
+	if( table == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid table.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( number_of_states == 0 )
+	 || ( ( number_of_states & ( number_of_states - 1 ) ) != 0 ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_UNSUPPORTED_VALUE,
+		 "%s: unsupported number of states value not a power of 2.",
+		 function );
+
+		return( -1 );
+	}
+	if( frequencies == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid frequencies.",
+		 function );
+
+		return( -1 );
+	}
+	if( number_of_symbols > 256 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid number of symbols value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	for( symbol = 0;
+	     symbol < number_of_symbols;
+	     symbol++ )
+	{
+		sum_of_frequencies += frequencies[ symbol ];
+	}
+	if( sum_of_frequencies > (uint32_t) number_of_states )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid sum of frequencies value exceeds number of states.",
+		 function );
+
+		return( -1 );
+	}
+	for( symbol = 0;
+	     symbol < number_of_symbols;
+	     symbol++ )
+	{
+		frequency = frequencies[ symbol ];
+
+		if( frequency == 0 )
+		{
+			continue;
+		}
+		number_of_bits        = lzfse_get_frequency_number_of_bits(
+		                         frequency,
+		                         number_of_states );
+		number_of_wide_states = (uint16_t) ( ( 2 * (uint32_t) number_of_states ) >> number_of_bits ) - frequency;
+
+		for( frequency_index = 0;
+		     frequency_index < frequency;
+		     frequency_index++ )
+		{
+			table[ table_index ].symbol = (uint8_t) symbol;
+
+			if( frequency_index < number_of_wide_states )
+			{
+				table[ table_index ].number_of_bits = number_of_bits;
+				table[ table_index ].delta          = (int16_t) ( ( (int32_t) ( frequency + frequency_index ) << number_of_bits ) - number_of_states );
+			}
+			else
+			{
+				table[ table_index ].number_of_bits = number_of_bits - 1;
+				table[ table_index ].delta          = (int16_t) ( ( frequency_index - number_of_wide_states ) << ( number_of_bits - 1 ) );
+			}
+			table_index++;
+		}
+	}
+	/* The states that are not used by a symbol are set so that they decode as state 0
+	 */
+	while( table_index < number_of_states )
+	{
+		table[ table_index ].number_of_bits = 0;
+		table[ table_index ].symbol         = 0;
+		table[ table_index ].delta          = 0;
+
+		table_index++;
+	}
+	return( 1 );
+}
+
+/* Constructs a FSE value decoder table from the symbol frequencies
+ * A value decoder entry combines the state bits and the value bits of the symbol
+ * so that they are read with a single read of the bit stream
+ * Returns 1 on success or -1 on error
+ */
+int lzfse_value_decoder_table_construct(
+     lzfse_value_decoder_entry_t *table,
+     uint16_t number_of_states,
+     const uint16_t *frequencies,
+     const uint8_t *value_bits,
+     const int32_t *value_bases,
+     uint16_t number_of_symbols,
+     libcerror_error_t **error )
+{
+	lzfse_decoder_entry_t decoder_table[ LZFSE_NUMBER_OF_D_STATES ];
+
+	static char *function = "lzfse_value_decoder_table_construct";
+	uint16_t table_index  = 0;
+	uint8_t symbol        = 0;
+
+	if( table == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid table.",
+		 function );
+
+		return( -1 );
+	}
+	if( number_of_states > LZFSE_NUMBER_OF_D_STATES )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid number of states value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	if( value_bits == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid value bits.",
+		 function );
+
+		return( -1 );
+	}
+	if( value_bases == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid value bases.",
+		 function );
+
+		return( -1 );
+	}
+	if( lzfse_decoder_table_construct(
+	     decoder_table,
+	     number_of_states,
+	     frequencies,
+	     number_of_symbols,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to construct decoder table.",
+		 function );
+
+		return( -1 );
+	}
+	for( table_index = 0;
+	     table_index < number_of_states;
+	     table_index++ )
+	{
+		symbol = decoder_table[ table_index ].symbol;
+
+		table[ table_index ].number_of_bits       = decoder_table[ table_index ].number_of_bits + value_bits[ symbol ];
+		table[ table_index ].number_of_value_bits = value_bits[ symbol ];
+		table[ table_index ].delta                = decoder_table[ table_index ].delta;
+		table[ table_index ].value_base           = value_bases[ symbol ];
+	}
+	return( 1 );
+}
+
+/* Decompresses the literals and L, M and D values of a compressed block
+ * The matches can refer to the uncompressed data of the preceding blocks
+ * Returns 1 on success or -1 on error
+ */
+static int lzfse_decompress_compressed_block(
+            lzfse_decoder_t *decoder,
+            const lzfse_compressed_block_header_t *header,
+            const uint8_t *compressed_data,
+            size_t compressed_data_offset,
+            uint8_t *uncompressed_data,
+            size_t uncompressed_data_size,
+            size_t *uncompressed_data_offset,
+            libcerror_error_t **error )
+{
+	lzfse_bit_stream_t bit_stream;
+
+	uint16_t literal_states[ 4 ];
+
+	const lzfse_value_decoder_entry_t *value_entry = NULL;
+	const lzfse_decoder_entry_t *literal_entry     = NULL;
+	static char *function                          = "lzfse_decompress_compressed_block";
+	size_t block_end_offset                        = 0;
+	size_t literal_offset                          = 0;
+	size_t literals_end_offset                     = 0;
+	size_t lmd_end_offset                          = 0;
+	size_t safe_uncompressed_data_offset           = 0;
+	uint32_t literal_index                         = 0;
+	uint32_t match_index                           = 0;
+	uint32_t value_32bit                           = 0;
+	int32_t distance                               = 0;
+	int32_t literal_size                           = 0;
+	int32_t match_size                             = 0;
+	int32_t value_32bit_signed                     = 0;
+	uint16_t d_state                               = 0;
+	uint16_t l_state                               = 0;
+	uint16_t m_state                               = 0;
+	uint8_t state_index                            = 0;
+
+	safe_uncompressed_data_offset = *uncompressed_data_offset;
+
+	if( (size_t) header->uncompressed_size > ( uncompressed_data_size - safe_uncompressed_data_offset ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_TOO_SMALL,
+		 "%s: uncompressed data size value too small.",
+		 function );
+
+		return( -1 );
+	}
+	block_end_offset = safe_uncompressed_data_offset + header->uncompressed_size;
+
+	if( lzfse_decoder_table_construct(
+	     decoder->literal_table,
+	     LZFSE_NUMBER_OF_LITERAL_STATES,
+	     &( header->frequencies[ LZFSE_NUMBER_OF_L_SYMBOLS + LZFSE_NUMBER_OF_M_SYMBOLS + LZFSE_NUMBER_OF_D_SYMBOLS ] ),
+	     LZFSE_NUMBER_OF_LITERAL_SYMBOLS,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to construct literal decoder table.",
+		 function );
+
+		return( -1 );
+	}
+	if( lzfse_value_decoder_table_construct(
+	     decoder->l_table,
+	     LZFSE_NUMBER_OF_L_STATES,
+	     header->frequencies,
+	     lzfse_l_value_bits,
+	     lzfse_l_value_bases,
+	     LZFSE_NUMBER_OF_L_SYMBOLS,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to construct L value decoder table.",
+		 function );
+
+		return( -1 );
+	}
+	if( lzfse_value_decoder_table_construct(
+	     decoder->m_table,
+	     LZFSE_NUMBER_OF_M_STATES,
+	     &( header->frequencies[ LZFSE_NUMBER_OF_L_SYMBOLS ] ),
+	     lzfse_m_value_bits,
+	     lzfse_m_value_bases,
+	     LZFSE_NUMBER_OF_M_SYMBOLS,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to construct M value decoder table.",
+		 function );
+
+		return( -1 );
+	}
+	if( lzfse_value_decoder_table_construct(
+	     decoder->d_table,
+	     LZFSE_NUMBER_OF_D_STATES,
+	     &( header->frequencies[ LZFSE_NUMBER_OF_L_SYMBOLS + LZFSE_NUMBER_OF_M_SYMBOLS ] ),
+	     lzfse_d_value_bits,
+	     lzfse_d_value_bases,
+	     LZFSE_NUMBER_OF_D_SYMBOLS,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to construct D value decoder table.",
+		 function );
+
+		return( -1 );
+	}
+	literals_end_offset = compressed_data_offset + header->literals_size;
+	lmd_end_offset      = literals_end_offset + header->lmd_size;
+
+	/* The literals are stored backwards at the end of the literals data
+	 * as 4 interleaved FSE streams, the bit stream can read before the start
+	 * of the literals data, as long as it stays within the compressed data
+	 */
+	if( lzfse_bit_stream_initialize(
+	     &bit_stream,
+	     compressed_data,
+	     literals_end_offset,
+	     header->literal_bits,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to initialize literals bit stream.",
+		 function );
+
+		return( -1 );
+	}
+	for( state_index = 0;
+	     state_index < 4;
+	     state_index++ )
+	{
+		literal_states[ state_index ] = header->literal_states[ state_index ];
+	}
+	for( literal_index = 0;
+	     literal_index < header->number_of_literals;
+	     literal_index += 4 )
+	{
+		/* 4 literals require at most 40 bits
+		 */
+		if( lzfse_bit_stream_refill(
+		     &bit_stream ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+			 "%s: invalid literals bit stream value out of bounds.",
+			 function );
+
+			return( -1 );
+		}
+		for( state_index = 0;
+		     state_index < 4;
+		     state_index++ )
+		{
+			literal_entry = &( decoder->literal_table[ literal_states[ state_index ] ] );
+
+			decoder->literals[ literal_index + state_index ] = literal_entry->symbol;
+
+			literal_states[ state_index ] = (uint16_t) ( literal_entry->delta + (int32_t) lzfse_bit_stream_get_value(
+			                                                                               &bit_stream,
+			                                                                               literal_entry->number_of_bits ) );
+		}
+	}
+	/* The L, M and D values are stored backwards at the end of the L, M and D data
+	 */
+	if( lzfse_bit_stream_initialize(
+	     &bit_stream,
+	     compressed_data,
+	     lmd_end_offset,
+	     header->lmd_bits,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to initialize L, M and D bit stream.",
+		 function );
+
+		return( -1 );
+	}
+	l_state = header->l_state;
+	m_state = header->m_state;
+	d_state = header->d_state;
+
+	for( match_index = 0;
+	     match_index < header->number_of_matches;
+	     match_index++ )
+	{
+		/* The L, M and D values require at most 14 + 17 + 23 = 54 bits
+		 */
+		if( lzfse_bit_stream_refill(
+		     &bit_stream ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+			 "%s: invalid L, M and D bit stream value out of bounds.",
+			 function );
+
+			return( -1 );
+		}
+		value_entry  = &( decoder->l_table[ l_state ] );
+		value_32bit  = lzfse_bit_stream_get_value(
+		                &bit_stream,
+		                value_entry->number_of_bits );
+		l_state      = (uint16_t) ( value_entry->delta + (int32_t) ( value_32bit >> value_entry->number_of_value_bits ) );
+		literal_size = value_entry->value_base + (int32_t) ( value_32bit & ( ( (uint32_t) 1 << value_entry->number_of_value_bits ) - 1 ) );
+
+		value_entry = &( decoder->m_table[ m_state ] );
+		value_32bit = lzfse_bit_stream_get_value(
+		               &bit_stream,
+		               value_entry->number_of_bits );
+		m_state     = (uint16_t) ( value_entry->delta + (int32_t) ( value_32bit >> value_entry->number_of_value_bits ) );
+		match_size  = value_entry->value_base + (int32_t) ( value_32bit & ( ( (uint32_t) 1 << value_entry->number_of_value_bits ) - 1 ) );
+
+		value_entry        = &( decoder->d_table[ d_state ] );
+		value_32bit        = lzfse_bit_stream_get_value(
+		                      &bit_stream,
+		                      value_entry->number_of_bits );
+		d_state            = (uint16_t) ( value_entry->delta + (int32_t) ( value_32bit >> value_entry->number_of_value_bits ) );
+		value_32bit_signed = value_entry->value_base + (int32_t) ( value_32bit & ( ( (uint32_t) 1 << value_entry->number_of_value_bits ) - 1 ) );
+
+		if( value_32bit_signed != 0 )
+		{
+			distance = value_32bit_signed;
+		}
+		if( (size_t) literal_size > ( (size_t) header->number_of_literals - literal_offset ) )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+			 "%s: invalid literal size value out of bounds.",
+			 function );
+
+			return( -1 );
+		}
+		if( (size_t) ( literal_size + match_size ) > ( block_end_offset - safe_uncompressed_data_offset ) )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+			 "%s: literal and match size value exceeds block size.",
+			 function );
+
+			return( -1 );
+		}
+		if( literal_size > 0 )
+		{
+			/* The literals are copied in blocks of 16 bytes if there is room
+			 * after the literal in the uncompressed data, the literals buffer
+			 * has room for the additional bytes
+			 */
+			if( ( uncompressed_data_size - safe_uncompressed_data_offset ) >= (size_t) ( literal_size + 16 ) )
+			{
+				for( value_32bit = 0;
+				     value_32bit < (uint32_t) literal_size;
+				     value_32bit += 16 )
+				{
+					memory_copy(
+					 &( uncompressed_data[ safe_uncompressed_data_offset + value_32bit ] ),
+					 &( decoder->literals[ literal_offset + value_32bit ] ),
+					 16 );
+				}
+			}
+			else
+			{
+				memory_copy(
+				 &( uncompressed_data[ safe_uncompressed_data_offset ] ),
+				 &( decoder->literals[ literal_offset ] ),
+				 (size_t) literal_size );
+			}
+			literal_offset                += (size_t) literal_size;
+			safe_uncompressed_data_offset += (size_t) literal_size;
+		}
+		if( match_size > 0 )
+		{
+			if( ( distance <= 0 )
+			 || ( (size_t) distance > safe_uncompressed_data_offset ) )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+				 "%s: invalid distance value out of bounds.",
+				 function );
+
+				return( -1 );
+			}
+			lz_match_copy(
+			 uncompressed_data,
+			 uncompressed_data_size,
+			 safe_uncompressed_data_offset,
+			 (size_t) distance,
+			 (size_t) match_size );
+
+			safe_uncompressed_data_offset += (size_t) match_size;
+		}
+	}
+	if( safe_uncompressed_data_offset != block_end_offset )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid uncompressed size value does not match size of decompressed data.",
+		 function );
+
+		return( -1 );
+	}
+	*uncompressed_data_offset = safe_uncompressed_data_offset;
+
+	return( 1 );
+}
+
+/* Reads the header of the block at the start of the data
+ * The block size is the size of the block header and its compressed data
+ * Returns 1 on success or -1 on error
+ */
+static int lzfse_read_block_header(
+            const uint8_t *data,
+            size_t data_size,
+            uint32_t *signature,
+            size_t *block_size,
+            uint32_t *uncompressed_size,
+            lzfse_compressed_block_header_t *header,
+            libcerror_error_t **error )
+{
+	static char *function   = "lzfse_read_block_header";
+	uint32_t payload_size   = 0;
+	uint32_t safe_signature = 0;
+
+	if( data_size < 4 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: missing end of stream block.",
+		 function );
+
+		return( -1 );
+	}
+	byte_stream_copy_to_uint32_little_endian(
+	 data,
+	 safe_signature );
+
+	*block_size        = 0;
+	*uncompressed_size = 0;
+
+	switch( safe_signature )
+	{
+		case LZFSE_BLOCK_SIGNATURE_END_OF_STREAM:
+			*block_size = LZFSE_END_OF_STREAM_BLOCK_HEADER_SIZE;
+			break;
+
+		case LZFSE_BLOCK_SIGNATURE_UNCOMPRESSED:
+			if( data_size < LZFSE_UNCOMPRESSED_BLOCK_HEADER_SIZE )
+			{
+				break;
+			}
+			byte_stream_copy_to_uint32_little_endian(
+			 &( data[ 4 ] ),
+			 *uncompressed_size );
+
+			*block_size = LZFSE_UNCOMPRESSED_BLOCK_HEADER_SIZE + (size_t) *uncompressed_size;
+			break;
+
+		case LZFSE_BLOCK_SIGNATURE_LZVN:
+			if( data_size < LZFSE_LZVN_BLOCK_HEADER_SIZE )
+			{
+				break;
+			}
+			byte_stream_copy_to_uint32_little_endian(
+			 &( data[ 4 ] ),
+			 *uncompressed_size );
+
+			byte_stream_copy_to_uint32_little_endian(
+			 &( data[ 8 ] ),
+			 payload_size );
+
+			*block_size = LZFSE_LZVN_BLOCK_HEADER_SIZE + (size_t) payload_size;
+			break;
+
+		case LZFSE_BLOCK_SIGNATURE_COMPRESSED_V2:
+			if( lzfse_read_compressed_block_header(
+			     header,
+			     data,
+			     data_size,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_IO,
+				 LIBCERROR_IO_ERROR_READ_FAILED,
+				 "%s: unable to read compressed block header.",
+				 function );
+
+				return( -1 );
+			}
+			*uncompressed_size = header->uncompressed_size;
+			*block_size        = (size_t) header->header_size + header->literals_size + header->lmd_size;
+			break;
+
+		/* The compressed block (version 1) header is not written by
+		 * the LZFSE encoder, which converts it to the version 2 header
+		 */
+		default:
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_UNSUPPORTED_VALUE,
+			 "%s: unsupported block signature: 0x%08" PRIx32 ".",
+			 function,
+			 safe_signature );
+
+			return( -1 );
+	}
+	if( ( *block_size == 0 )
+	 || ( *block_size > data_size ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_TOO_SMALL,
+		 "%s: data size value too small.",
+		 function );
+
+		return( -1 );
+	}
+	*signature = safe_signature;
+
+	return( 1 );
+}
+
+/* Determines the uncompressed data size from the block headers
+ * Returns 1 on success or -1 on error
+ */
+int lzfse_get_uncompressed_size(
+     const uint8_t *compressed_data,
+     size_t compressed_data_size,
+     size_t *uncompressed_data_size,
+     libcerror_error_t **error )
+{
+	lzfse_compressed_block_header_t header;
+
+	static char *function            = "lzfse_get_uncompressed_size";
+	size_t block_size                = 0;
+	size_t compressed_data_offset    = 0;
+	size_t safe_uncompressed_size    = 0;
+	uint32_t block_uncompressed_size = 0;
+	uint32_t signature               = 0;
+
+	if( compressed_data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid compressed data.",
+		 function );
+
+		return( -1 );
+	}
+	if( compressed_data_size > (size_t) SSIZE_MAX )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid compressed data size value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	if( uncompressed_data_size == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid uncompressed data size.",
+		 function );
+
+		return( -1 );
+	}
+	do
+	{
+		if( lzfse_read_block_header(
+		     &( compressed_data[ compressed_data_offset ] ),
+		     compressed_data_size - compressed_data_offset,
+		     &signature,
+		     &block_size,
+		     &block_uncompressed_size,
+		     &header,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_READ_FAILED,
+			 "%s: unable to read block header at offset: %" PRIzd ".",
+			 function,
+			 compressed_data_offset );
+
+			return( -1 );
+		}
+		if( (size_t) block_uncompressed_size > ( (size_t) SSIZE_MAX - safe_uncompressed_size ) )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_VALUE_EXCEEDS_MAXIMUM,
+			 "%s: invalid uncompressed data size value exceeds maximum.",
+			 function );
+
+			return( -1 );
+		}
+		compressed_data_offset += block_size;
+		safe_uncompressed_size += block_uncompressed_size;
+	}
+	while( signature != LZFSE_BLOCK_SIGNATURE_END_OF_STREAM );
+
+	*uncompressed_data_size = safe_uncompressed_size;
+
+	return( 1 );
+}
+
+/* Decompresses LZFSE compressed data
+ * The compressed data consists of LZFSE compressed, LZVN compressed and
+ * uncompressed blocks and is terminated by an end of stream block
+ * Returns 1 on success or -1 on error
+ */
+int lzfse_decompress(
+     const uint8_t *compressed_data,
+     size_t compressed_data_size,
+     uint8_t *uncompressed_data,
+     size_t *uncompressed_data_size,
+     libcerror_error_t **error )
+{
+	lzfse_compressed_block_header_t header;
+
+	lzfse_decoder_t *decoder         = NULL;
+	static char *function            = "lzfse_decompress";
+	size_t block_size                = 0;
+	size_t compressed_data_offset    = 0;
+	size_t lzvn_uncompressed_size    = 0;
+	size_t uncompressed_data_offset  = 0;
+	uint32_t block_uncompressed_size = 0;
+	uint32_t signature               = 0;
+
+	if( compressed_data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid compressed data.",
+		 function );
+
+		return( -1 );
+	}
+	if( compressed_data_size > (size_t) SSIZE_MAX )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid compressed data size value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	if( uncompressed_data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid uncompressed data.",
+		 function );
+
+		return( -1 );
+	}
+	if( uncompressed_data_size == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid uncompressed data size.",
+		 function );
+
+		return( -1 );
+	}
+	if( *uncompressed_data_size > (size_t) SSIZE_MAX )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid uncompressed data size value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	do
+	{
+		if( lzfse_read_block_header(
+		     &( compressed_data[ compressed_data_offset ] ),
+		     compressed_data_size - compressed_data_offset,
+		     &signature,
+		     &block_size,
+		     &block_uncompressed_size,
+		     &header,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_READ_FAILED,
+			 "%s: unable to read block header at offset: %" PRIzd ".",
+			 function,
+			 compressed_data_offset );
+
+			goto on_error;
+		}
+		if( (size_t) block_uncompressed_size > ( *uncompressed_data_size - uncompressed_data_offset ) )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+			 LIBCERROR_ARGUMENT_ERROR_VALUE_TOO_SMALL,
+			 "%s: uncompressed data size value too small.",
+			 function );
+
+			goto on_error;
+		}
+		if( signature == LZFSE_BLOCK_SIGNATURE_UNCOMPRESSED )
+		{
+			if( memory_copy(
+			     &( uncompressed_data[ uncompressed_data_offset ] ),
+			     &( compressed_data[ compressed_data_offset + LZFSE_UNCOMPRESSED_BLOCK_HEADER_SIZE ] ),
+			     (size_t) block_uncompressed_size ) == NULL )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_MEMORY,
+				 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+				 "%s: unable to copy uncompressed block.",
+				 function );
+
+				goto on_error;
+			}
+			uncompressed_data_offset += block_uncompressed_size;
+		}
+		else if( signature == LZFSE_BLOCK_SIGNATURE_LZVN )
+		{
+			lzvn_uncompressed_size = (size_t) block_uncompressed_size;
+
+			if( lzvn_decompress(
+			     &( compressed_data[ compressed_data_offset + LZFSE_LZVN_BLOCK_HEADER_SIZE ] ),
+			     block_size - LZFSE_LZVN_BLOCK_HEADER_SIZE,
+			     &( uncompressed_data[ uncompressed_data_offset ] ),
+			     &lzvn_uncompressed_size,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_COMPRESSION,
+				 LIBCERROR_COMPRESSION_ERROR_DECOMPRESS_FAILED,
+				 "%s: unable to decompress LZVN block at offset: %" PRIzd ".",
+				 function,
+				 compressed_data_offset );
+
+				goto on_error;
+			}
+			if( lzvn_uncompressed_size != (size_t) block_uncompressed_size )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+				 "%s: invalid LZVN block uncompressed size value does not match size of decompressed data.",
+				 function );
+
+				goto on_error;
+			}
+			uncompressed_data_offset += block_uncompressed_size;
+		}
+		else if( signature == LZFSE_BLOCK_SIGNATURE_COMPRESSED_V2 )
+		{
+			/* The decoder is only allocated when the data contains LZFSE compressed blocks
+			 */
+			if( decoder == NULL )
+			{
+				decoder = memory_allocate_structure(
+				           lzfse_decoder_t );
+
+				if( decoder == NULL )
+				{
+					libcerror_error_set(
+					 error,
+					 LIBCERROR_ERROR_DOMAIN_MEMORY,
+					 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+					 "%s: unable to create decoder.",
+					 function );
+
+					goto on_error;
+				}
+			}
+			if( lzfse_decompress_compressed_block(
+			     decoder,
+			     &header,
+			     compressed_data,
+			     compressed_data_offset + header.header_size,
+			     uncompressed_data,
+			     *uncompressed_data_size,
+			     &uncompressed_data_offset,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_COMPRESSION,
+				 LIBCERROR_COMPRESSION_ERROR_DECOMPRESS_FAILED,
+				 "%s: unable to decompress compressed block at offset: %" PRIzd ".",
+				 function,
+				 compressed_data_offset );
+
+				goto on_error;
+			}
+		}
+		compressed_data_offset += block_size;
+	}
+	while( signature != LZFSE_BLOCK_SIGNATURE_END_OF_STREAM );
+
+	if( decoder != NULL )
+	{
+		memory_free(
+		 decoder );
+	}
+	*uncompressed_data_size = uncompressed_data_offset;
+
+	return( 1 );
+
+on_error:
+	if( decoder != NULL )
+	{
+		memory_free(
+		 decoder );
+	}
+	return( -1 );
+}
+
+/* Decompresses LZFSE compressed data into a newly allocated buffer
+ * The buffer is sized using the uncompressed sizes of the block headers
+ * The uncompressed data must be freed with memory_free
+ * Returns 1 on success or -1 on error
+ */
+int lzfse_decompress_allocate(
+     const uint8_t *compressed_data,
+     size_t compressed_data_size,
+     uint8_t **uncompressed_data,
+     size_t *uncompressed_data_size,
+     libcerror_error_t **error )
+{
+	static char *function              = "lzfse_decompress_allocate";
+	size_t safe_uncompressed_data_size = 0;
+
+	if( uncompressed_data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid uncompressed data.",
+		 function );
+
+		return( -1 );
+	}
+	if( *uncompressed_data != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid uncompressed data value already set.",
+		 function );
+
+		return( -1 );
+	}
+	if( uncompressed_data_size == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid uncompressed data size.",
+		 function );
+
+		return( -1 );
+	}
+	if( lzfse_get_uncompressed_size(
+	     compressed_data,
+	     compressed_data_size,
+	     &safe_uncompressed_data_size,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to determine uncompressed data size.",
+		 function );
+
+		return( -1 );
+	}
+	/* Allocate at least 1 byte for an empty stream
+	 */
+	*uncompressed_data = (uint8_t *) memory_allocate(
+	                                  sizeof( uint8_t ) * ( safe_uncompressed_data_size + 1 ) );
+
+	if( *uncompressed_data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create uncompressed data.",
+		 function );
+
+		goto on_error;
+	}
+	if( lzfse_decompress(
+	     compressed_data,
+	     compressed_data_size,
+	     *uncompressed_data,
+	     &safe_uncompressed_data_size,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_COMPRESSION,
+		 LIBCERROR_COMPRESSION_ERROR_DECOMPRESS_FAILED,
+		 "%s: unable to decompress data.",
+		 function );
+
+		goto on_error;
+	}
+	*uncompressed_data_size = safe_uncompressed_data_size;
+
+	return( 1 );
+
+on_error:
+	if( *uncompressed_data != NULL )
+	{
+		memory_free(
+		 *uncompressed_data );
+
+		*uncompressed_data = NULL;
+	}
+	return( -1 );
+}
+
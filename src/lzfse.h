@@ -0,0 +1,266 @@
+/*
+ * LZFSE decompression functions
+ *
+ * Copyright (C) 2008-2019, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This software is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This software is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this software.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#if !defined( _LZFSE_H )
+#define _LZFSE_H
+
+#include <common.h>
+#include <types.h>
+
+#include "assorted_libcerror.h"
+
+#if defined( __cplusplus )
+extern "C" {
+#endif
+
+/* The number of symbols of the FSE encoded literal size (L), match size (M),
+ * match distance (D) and literal values
+ */
+#define LZFSE_NUMBER_OF_L_SYMBOLS			20
+#define LZFSE_NUMBER_OF_M_SYMBOLS			20
+#define LZFSE_NUMBER_OF_D_SYMBOLS			64
+#define LZFSE_NUMBER_OF_LITERAL_SYMBOLS			256
+
+/* The total number of symbols of the frequency tables
+ */
+#define LZFSE_NUMBER_OF_FREQUENCIES \
+	( LZFSE_NUMBER_OF_L_SYMBOLS + LZFSE_NUMBER_OF_M_SYMBOLS + LZFSE_NUMBER_OF_D_SYMBOLS + LZFSE_NUMBER_OF_LITERAL_SYMBOLS )
+
+/* The number of states of the FSE encoded literal size (L), match size (M),
+ * match distance (D) and literal values
+ */
+#define LZFSE_NUMBER_OF_L_STATES			64
+#define LZFSE_NUMBER_OF_M_STATES			64
+#define LZFSE_NUMBER_OF_D_STATES			256
+#define LZFSE_NUMBER_OF_LITERAL_STATES			1024
+
+/* The maximum number of literals and matches of a compressed block
+ */
+#define LZFSE_MAXIMUM_NUMBER_OF_LITERALS		40000
+#define LZFSE_MAXIMUM_NUMBER_OF_MATCHES			10000
+
+/* The size of the block headers
+ */
+#define LZFSE_END_OF_STREAM_BLOCK_HEADER_SIZE		4
+#define LZFSE_UNCOMPRESSED_BLOCK_HEADER_SIZE		8
+#define LZFSE_LZVN_BLOCK_HEADER_SIZE			12
+
+/* The size of the compressed block (version 2) header without the frequency tables
+ */
+#define LZFSE_COMPRESSED_BLOCK_HEADER_SIZE		32
+
+/* The block signatures
+ */
+enum LZFSE_BLOCK_SIGNATURES
+{
+	LZFSE_BLOCK_SIGNATURE_END_OF_STREAM		= 0x24787662UL,
+	LZFSE_BLOCK_SIGNATURE_UNCOMPRESSED		= 0x2d787662UL,
+	LZFSE_BLOCK_SIGNATURE_COMPRESSED_V1		= 0x31787662UL,
+	LZFSE_BLOCK_SIGNATURE_COMPRESSED_V2		= 0x32787662UL,
+	LZFSE_BLOCK_SIGNATURE_LZVN			= 0x6e787662UL
+};
+
+typedef struct lzfse_bit_stream lzfse_bit_stream_t;
+
+struct lzfse_bit_stream
+{
+	/* The byte stream, which is read backwards from the end
+	 */
+	const uint8_t *byte_stream;
+
+	/* The byte stream offset, the bytes before the offset have not been added to the bit buffer
+	 */
+	size_t byte_stream_offset;
+
+	/* The bit buffer
+	 * the bits are consumed from the most significant bit of the bit buffer size bits
+	 */
+	uint64_t bit_buffer;
+
+	/* The number of bits remaining in the bit buffer
+	 */
+	uint8_t bit_buffer_size;
+};
+
+typedef struct lzfse_decoder_entry lzfse_decoder_entry_t;
+
+struct lzfse_decoder_entry
+{
+	/* The number of bits to read for the next state
+	 */
+	uint8_t number_of_bits;
+
+	/* The symbol
+	 */
+	uint8_t symbol;
+
+	/* The base of the next state
+	 */
+	int16_t delta;
+};
+
+typedef struct lzfse_value_decoder_entry lzfse_value_decoder_entry_t;
+
+struct lzfse_value_decoder_entry
+{
+	/* The number of bits to read for the next state and the value
+	 */
+	uint8_t number_of_bits;
+
+	/* The number of bits of the value
+	 */
+	uint8_t number_of_value_bits;
+
+	/* The base of the next state
+	 */
+	int16_t delta;
+
+	/* The base of the value
+	 */
+	int32_t value_base;
+};
+
+typedef struct lzfse_compressed_block_header lzfse_compressed_block_header_t;
+
+struct lzfse_compressed_block_header
+{
+	/* The size of the header including the frequency tables
+	 */
+	uint32_t header_size;
+
+	/* The number of uncompressed bytes
+	 */
+	uint32_t uncompressed_size;
+
+	/* The number of literals
+	 */
+	uint32_t number_of_literals;
+
+	/* The size of the FSE encoded literals
+	 */
+	uint32_t literals_size;
+
+	/* The number of bits of the last byte of the FSE encoded literals
+	 * 0 if all bits are used or -7 to -1 for the number of unused bits
+	 */
+	int8_t literal_bits;
+
+	/* The initial states of the 4 interleaved literal decoders
+	 */
+	uint16_t literal_states[ 4 ];
+
+	/* The number of L, M and D values
+	 */
+	uint32_t number_of_matches;
+
+	/* The size of the FSE encoded L, M and D values
+	 */
+	uint32_t lmd_size;
+
+	/* The number of bits of the last byte of the FSE encoded L, M and D values
+	 */
+	int8_t lmd_bits;
+
+	/* The initial states of the L, M and D decoders
+	 */
+	uint16_t l_state;
+	uint16_t m_state;
+	uint16_t d_state;
+
+	/* The frequency tables of the L, M, D and literal symbols, in that order
+	 */
+	uint16_t frequencies[ LZFSE_NUMBER_OF_FREQUENCIES ];
+};
+
+typedef struct lzfse_decoder lzfse_decoder_t;
+
+struct lzfse_decoder
+{
+	/* The literal decoder table
+	 */
+	lzfse_decoder_entry_t literal_table[ LZFSE_NUMBER_OF_LITERAL_STATES ];
+
+	/* The L value decoder table
+	 */
+	lzfse_value_decoder_entry_t l_table[ LZFSE_NUMBER_OF_L_STATES ];
+
+	/* The M value decoder table
+	 */
+	lzfse_value_decoder_entry_t m_table[ LZFSE_NUMBER_OF_M_STATES ];
+
+	/* The D value decoder table
+	 */
+	lzfse_value_decoder_entry_t d_table[ LZFSE_NUMBER_OF_D_STATES ];
+
+	/* The decoded literals of the current block, the literals are decoded
+	 * 4 at a time and copied in blocks of 16 bytes, hence the additional bytes
+	 */
+	uint8_t literals[ LZFSE_MAXIMUM_NUMBER_OF_LITERALS + 64 ];
+};
+
+int lzfse_read_compressed_block_header(
+     lzfse_compressed_block_header_t *header,
+     const uint8_t *data,
+     size_t data_size,
+     libcerror_error_t **error );
+
+int lzfse_decoder_table_construct(
+     lzfse_decoder_entry_t *table,
+     uint16_t number_of_states,
+     const uint16_t *frequencies,
+     uint16_t number_of_symbols,
+     libcerror_error_t **error );
+
+int lzfse_value_decoder_table_construct(
+     lzfse_value_decoder_entry_t *table,
+     uint16_t number_of_states,
+     const uint16_t *frequencies,
+     const uint8_t *value_bits,
+     const int32_t *value_bases,
+     uint16_t number_of_symbols,
+     libcerror_error_t **error );
+
+int lzfse_get_uncompressed_size(
+     const uint8_t *compressed_data,
+     size_t compressed_data_size,
+     size_t *uncompressed_data_size,
+     libcerror_error_t **error );
+
+int lzfse_decompress(
+     const uint8_t *compressed_data,
+     size_t compressed_data_size,
+     uint8_t *uncompressed_data,
+     size_t *uncompressed_data_size,
+     libcerror_error_t **error );
+
+int lzfse_decompress_allocate(
+     const uint8_t *compressed_data,
+     size_t compressed_data_size,
+     uint8_t **uncompressed_data,
+     size_t *uncompressed_data_size,
+     libcerror_error_t **error );
+
+#if defined( __cplusplus )
+}
+#endif
+
+#endif /* !defined( _LZFSE_H ) */
+
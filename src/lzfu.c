@@ -38,7 +38,103 @@ const char *lzfu_rtf_dictionary = \
 	"{\\f0\\fnil \\froman \\fswiss \\fmodern \\fscript \\fdecor MS Sans SerifSymbolArialTimes New RomanCourier"
 	"{\\colortbl\\red0\\green0\\blue0\r\n\\par \\pard\\plain\\f0\\fs20\\b\\i\\u\\tab\\tx";
 
+/* Reads the LZFu header from the compressed data
+ * The compressed data size in the header is validated against the size of the compressed data
+ * and is returned without the 12 bytes of the header it includes
+ * Return 1 on success or -1 on error
+ */
+static int lzfu_read_header(
+            lzfu_header_t *lzfu_header,
+            const uint8_t *compressed_data,
+            size_t compressed_data_size,
+            libcerror_error_t **error )
+{
+	static char *function = "lzfu_read_header";
+
+	if( compressed_data_size < sizeof( lzfu_header_t ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_TOO_SMALL,
+		 "%s: invalid compressed data value too small.",
+		 function );
+
+		return( -1 );
+	}
+	byte_stream_copy_to_uint32_little_endian(
+	 &( compressed_data[ 0 ] ),
+	 lzfu_header->compressed_data_size );
+
+	byte_stream_copy_to_uint32_little_endian(
+	 &( compressed_data[ 4 ] ),
+	 lzfu_header->uncompressed_data_size );
+
+	byte_stream_copy_to_uint32_little_endian(
+	 &( compressed_data[ 8 ] ),
+	 lzfu_header->signature );
+
+	byte_stream_copy_to_uint32_little_endian(
+	 &( compressed_data[ 12 ] ),
+	 lzfu_header->crc );
+
+	if( libcnotify_verbose != 0 )
+	{
+		libcnotify_printf(
+		 "%s: lzfu header compressed data size\t: %" PRIu32 "\n",
+		 function,
+		 lzfu_header->compressed_data_size );
+
+		libcnotify_printf(
+		 "%s: lzfu header uncompressed data size\t: %" PRIu32 "\n",
+		 function,
+		 lzfu_header->uncompressed_data_size );
+
+		libcnotify_printf(
+		 "%s: lzfu header signature\t\t\t: 0x08%" PRIx32 "\n",
+		 function,
+		 lzfu_header->signature );
+
+		libcnotify_printf(
+		 "%s: lzfu header crc\t\t\t: %" PRIu32 "\n",
+		 function,
+		 lzfu_header->crc );
+	}
+	if( ( lzfu_header->signature != LZFU_SIGNATURE_COMPRESSED )
+	 && ( lzfu_header->signature != LZFU_SIGNATURE_UNCOMPRESSED ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_UNSUPPORTED_VALUE,
+		 "%s: unsupported compression signature: 0x%08" PRIx32 ".",
+		 function,
+		 lzfu_header->signature );
+
+		return( -1 );
+	}
+	/* The compressed data size includes 12 bytes of the header
+	 */
+	if( ( lzfu_header->compressed_data_size < 12 )
+	 || ( (size_t) ( lzfu_header->compressed_data_size - 12 ) > ( compressed_data_size - sizeof( lzfu_header_t ) ) ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid compressed data size value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	lzfu_header->compressed_data_size -= 12;
+
+	return( 1 );
+}
+
 /* Determines the uncompressed data size from the LZFu header in the compressed data
+ * The size is taken from the header, which makes this a constant time function,
+ * use lzfu_decompress_allocate to decompress data of which the header could be damaged
  * Return 1 on success or -1 on error
  */
 int lzfu_get_uncompressed_data_size(
@@ -49,20 +145,7 @@ int lzfu_get_uncompressed_data_size(
 {
 	lzfu_header_t lzfu_header;
 
-	uint8_t *lzfu_data                = 0;
-	static char *function             = "lzfu_get_uncompressed_data_size";
-
-	uint8_t lz_buffer[ 4096 ];
-
-	uint8_t *lzfu_reference_data      = 0;
-	size_t compressed_data_iterator   = 0;
-	size_t uncompressed_data_iterator = 0;
-	uint16_t lz_buffer_iterator       = 0;
-	uint16_t reference_offset         = 0;
-	uint16_t reference_size           = 0;
-	uint16_t reference_iterator       = 0;
-	uint8_t flag_byte_bit_mask        = 0;
-	uint8_t flag_byte                 = 0;
+	static char *function = "lzfu_get_uncompressed_data_size";
 
 	if( compressed_data == NULL )
 	{
@@ -97,250 +180,684 @@ int lzfu_get_uncompressed_data_size(
 
 		return( -1 );
 	}
-	lzfu_data = compressed_data;
+	if( lzfu_read_header(
+	     &lzfu_header,
+	     compressed_data,
+	     compressed_data_size,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to read header.",
+		 function );
 
-	byte_stream_copy_to_uint32_little_endian(
-	 lzfu_data,
-	 lzfu_header.compressed_data_size );
+		return( -1 );
+	}
+	/* Compensate for the 2 trailing zero bytes
+	 */
+	*uncompressed_data_size = (size_t) lzfu_header.uncompressed_data_size + 2;
 
-	lzfu_data += 4;
+	return( 1 );
+}
 
-	byte_stream_copy_to_uint32_little_endian(
-	 lzfu_data,
-	 lzfu_header.uncompressed_data_size );
+/* Retrieves a byte of the RTF dictionary followed by the uncompressed data
+ * Returns the byte value
+ */
+static uint8_t lzfu_compressor_get_byte(
+                const uint8_t *uncompressed_data,
+                size_t position )
+{
+	if( position < LZFU_RTF_DICTIONARY_SIZE )
+	{
+		return( (uint8_t) lzfu_rtf_dictionary[ position ] );
+	}
+	return( uncompressed_data[ position - LZFU_RTF_DICTIONARY_SIZE ] );
+}
 
-	lzfu_data += 4;
+/* Inserts the string at the position into the hash chains
+ * The position is relative to the start of the RTF dictionary
+ * and data size is the size of the RTF dictionary and the uncompressed data
+ */
+static void lzfu_compressor_insert_string(
+             lzfu_compressor_t *compressor,
+             const uint8_t *uncompressed_data,
+             size_t data_size,
+             size_t position )
+{
+	uint32_t hash_value = 0;
 
-	byte_stream_copy_to_uint32_little_endian(
-	 lzfu_data,
-	 lzfu_header.signature );
+	if( ( position + 3 ) > data_size )
+	{
+		return;
+	}
+	hash_value = ( (uint32_t) lzfu_compressor_get_byte( uncompressed_data, position ) << 16 )
+	           | ( (uint32_t) lzfu_compressor_get_byte( uncompressed_data, position + 1 ) << 8 )
+	           | lzfu_compressor_get_byte( uncompressed_data, position + 2 );
+
+	hash_value  *= (uint32_t) 0x9e3779b1UL;
+	hash_value >>= 32 - LZFU_COMPRESSOR_HASH_NUMBER_OF_BITS;
+
+	compressor->hash_chains[ position % LZFU_LZ_BUFFER_SIZE ] = compressor->hash_heads[ hash_value ];
+	compressor->hash_heads[ hash_value ]                      = (uint32_t) ( position + 1 );
+}
+
+/* Finds the longest match of the string at the position in the LZ buffer
+ * Returns the size of the match or 0 if no match was found
+ */
+static size_t lzfu_compressor_find_match(
+               lzfu_compressor_t *compressor,
+               const uint8_t *uncompressed_data,
+               size_t data_size,
+               size_t position,
+               size_t *match_position )
+{
+	const uint8_t *string = NULL;
+	size_t candidate      = 0;
+	size_t match_size     = 0;
+	size_t maximum_size   = 0;
+	size_t size           = 0;
+	uint32_t hash_value   = 0;
+	int chain_length      = 0;
+
+	if( ( position + 3 ) > data_size )
+	{
+		return( 0 );
+	}
+	string = &( uncompressed_data[ position - LZFU_RTF_DICTIONARY_SIZE ] );
+
+	hash_value = ( (uint32_t) string[ 0 ] << 16 )
+	           | ( (uint32_t) string[ 1 ] << 8 )
+	           | string[ 2 ];
+
+	hash_value  *= (uint32_t) 0x9e3779b1UL;
+	hash_value >>= 32 - LZFU_COMPRESSOR_HASH_NUMBER_OF_BITS;
+
+	maximum_size = data_size - position;
+
+	if( maximum_size > 17 )
+	{
+		maximum_size = 17;
+	}
+	candidate = compressor->hash_heads[ hash_value ];
+
+	while( ( candidate != 0 )
+	    && ( chain_length < LZFU_COMPRESSOR_MAXIMUM_CHAIN_LENGTH ) )
+	{
+		candidate -= 1;
+
+		/* The offset of the current position in the LZ buffer cannot be referenced
+		 * since it is used to mark the end of the compressed data
+		 */
+		if( ( position - candidate ) >= LZFU_LZ_BUFFER_SIZE )
+		{
+			break;
+		}
+		/* The match can overlap the current position, since the decompressor
+		 * copies the match a byte at a time
+		 */
+		for( size = 0;
+		     size < maximum_size;
+		     size++ )
+		{
+			if( lzfu_compressor_get_byte( uncompressed_data, candidate + size ) != string[ size ] )
+			{
+				break;
+			}
+		}
+		if( size > match_size )
+		{
+			match_size      = size;
+			*match_position = candidate;
+
+			if( size == maximum_size )
+			{
+				break;
+			}
+		}
+		candidate = compressor->hash_chains[ candidate % LZFU_LZ_BUFFER_SIZE ];
 
-	lzfu_data += 8;
+		chain_length++;
+	}
+	return( match_size );
+}
 
-	if( ( lzfu_header.signature != LZFU_SIGNATURE_COMPRESSED )
-	 && ( lzfu_header.signature != LZFU_SIGNATURE_UNCOMPRESSED ) )
+/* Compresses data using LZFu compression
+ * Returns 1 on success or -1 on error
+ */
+int lzfu_compress(
+     uint8_t *uncompressed_data,
+     size_t uncompressed_data_size,
+     uint8_t *compressed_data,
+     size_t *compressed_data_size,
+     libcerror_error_t **error )
+{
+	lzfu_compressor_t *compressor = NULL;
+	static char *function         = "lzfu_compress";
+	size_t compressed_data_offset = 0;
+	size_t data_size              = 0;
+	size_t flag_byte_offset       = 0;
+	size_t match_position         = 0;
+	size_t match_size             = 0;
+	size_t position               = 0;
+	size_t required_size          = 0;
+	uint32_t calculated_crc       = 0;
+	uint16_t reference            = 0;
+	uint8_t flag_byte             = 0;
+	uint8_t flag_byte_bit_index   = 0;
+
+	if( compressed_data == NULL )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_UNSUPPORTED_VALUE,
-		 "%s: unsupported compression signature: 0x%08" PRIx32 ".",
-		 function,
-		 lzfu_header.signature );
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid compressed data.",
+		 function );
 
 		return( -1 );
 	}
-	compressed_data_size -= sizeof( lzfu_header_t );
+	if( compressed_data_size == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid compressed data size.",
+		 function );
 
-	/* The compressed data size includes 12 bytes of the header
+		return( -1 );
+	}
+	if( uncompressed_data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid uncompressed data.",
+		 function );
+
+		return( -1 );
+	}
+	if( uncompressed_data_size > (size_t) SSIZE_MAX )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid uncompressed data size value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	/* In the worst case every byte is stored as a literal and the data is terminated
+	 * by an end of data reference of 2 bytes, with a flag byte for every 8 values
 	 */
-	lzfu_header.compressed_data_size -= 12;
+	required_size = sizeof( lzfu_header_t ) + uncompressed_data_size + 2 + ( ( uncompressed_data_size + 8 ) / 8 );
 
-#ifdef X
-	if( (size_t) lzfu_header.compressed_data_size != compressed_data_size )
+	if( required_size > (size_t) 0xffffffffUL )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_RANGE,
-		 "%s: mismatch in compressed data size (%" PRIu32 " != %" PRIzd ").",
-		 function,
-		 lzfu_header.compressed_data_size,
-		 compressed_data_size );
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid uncompressed data size value exceeds maximum.",
+		 function );
 
 		return( -1 );
 	}
-#endif
-	if( memory_copy(
-	     lz_buffer,
-	     lzfu_rtf_dictionary,
-	     207 ) == NULL )
+	if( *compressed_data_size < required_size )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_MEMORY,
-		 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
-		 "%s: unable to initialize lz buffer.",
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_TOO_SMALL,
+		 "%s: compressed data too small.",
 		 function );
 
+		*compressed_data_size = required_size;
+
 		return( -1 );
 	}
-	lz_buffer_iterator = 207;
+	compressor = memory_allocate_structure(
+	              lzfu_compressor_t );
+
+	if( compressor == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create compressor.",
+		 function );
 
+		goto on_error;
+	}
 	if( memory_set(
-	     &( lz_buffer[ lz_buffer_iterator ] ),
+	     compressor->hash_heads,
 	     0,
-	     ( 4096 - lz_buffer_iterator ) ) == NULL )
+	     sizeof( uint32_t ) * ( 1 << LZFU_COMPRESSOR_HASH_NUMBER_OF_BITS ) ) == NULL )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_MEMORY,
 		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
-		 "%s: unable to clear lz buffer.",
+		 "%s: unable to clear compressor hash heads.",
 		 function );
 
-		return( -1 );
+		goto on_error;
 	}
-	while( compressed_data_iterator < (size_t) lzfu_header.compressed_data_size )
+	/* The positions are relative to the start of the RTF dictionary,
+	 * which precedes the uncompressed data in the LZ buffer
+	 */
+	data_size = LZFU_RTF_DICTIONARY_SIZE + uncompressed_data_size;
+
+	for( position = 0;
+	     position < LZFU_RTF_DICTIONARY_SIZE;
+	     position++ )
 	{
-		flag_byte = lzfu_data[ compressed_data_iterator++ ];
+		lzfu_compressor_insert_string(
+		 compressor,
+		 uncompressed_data,
+		 data_size,
+		 position );
+	}
+	compressed_data_offset = sizeof( lzfu_header_t );
+	flag_byte_offset       = compressed_data_offset++;
 
-		/* Check every bit in the chunk flag byte from LSB to MSB
-		 */
-		for( flag_byte_bit_mask = 0x01;
-		     flag_byte_bit_mask != 0x00;
-		     flag_byte_bit_mask <<= 1 )
+	while( position <= data_size )
+	{
+		if( flag_byte_bit_index == 8 )
 		{
-			if( compressed_data_iterator == (size_t) lzfu_header.compressed_data_size )
-			{
-				break;
-			}
-			/* Check if the byte value is a literal or a reference
+			compressed_data[ flag_byte_offset ] = flag_byte;
+
+			flag_byte_offset    = compressed_data_offset++;
+			flag_byte           = 0;
+			flag_byte_bit_index = 0;
+		}
+		if( position == data_size )
+		{
+			/* The end of the compressed data is marked by a reference
+			 * to the offset of the current position in the LZ buffer
 			 */
-			if( ( flag_byte & flag_byte_bit_mask ) == 0 )
-			{
-				lz_buffer[ lz_buffer_iterator++ ] = lzfu_data[ compressed_data_iterator ];
+			reference = (uint16_t) ( ( position % LZFU_LZ_BUFFER_SIZE ) << 4 );
 
-				uncompressed_data_iterator++;
-				compressed_data_iterator++;
+			byte_stream_copy_from_uint16_big_endian(
+			 &( compressed_data[ compressed_data_offset ] ),
+			 reference );
 
-				/* Make sure the lz buffer iterator wraps around
-				 */
-				lz_buffer_iterator %= 4096;
+			compressed_data_offset += 2;
+			flag_byte              |= (uint8_t) ( 1 << flag_byte_bit_index );
 
-				lz_buffer[ lz_buffer_iterator ] = 0;
-			}
-			else
-			{
-				lzfu_reference_data = &( lzfu_data[ compressed_data_iterator ] );
+			break;
+		}
+		match_size = lzfu_compressor_find_match(
+		              compressor,
+		              uncompressed_data,
+		              data_size,
+		              position,
+		              &match_position );
+
+		if( match_size >= 3 )
+		{
+			reference = (uint16_t) ( ( ( match_position % LZFU_LZ_BUFFER_SIZE ) << 4 ) | ( match_size - 2 ) );
 
-				compressed_data_iterator += 2;
+			byte_stream_copy_from_uint16_big_endian(
+			 &( compressed_data[ compressed_data_offset ] ),
+			 reference );
 
-				byte_stream_copy_to_uint16_big_endian(
-				 lzfu_reference_data,
-				 reference_offset );
+			compressed_data_offset += 2;
+			flag_byte              |= (uint8_t) ( 1 << flag_byte_bit_index );
+		}
+		else
+		{
+			compressed_data[ compressed_data_offset++ ] = uncompressed_data[ position - LZFU_RTF_DICTIONARY_SIZE ];
 
-				reference_size     = ( reference_offset & 0x000f ) + 2;
-				reference_offset >>= 4;
+			match_size = 1;
+		}
+		while( match_size > 0 )
+		{
+			lzfu_compressor_insert_string(
+			 compressor,
+			 uncompressed_data,
+			 data_size,
+			 position );
+
+			position++;
+			match_size--;
+		}
+		flag_byte_bit_index++;
+	}
+	compressed_data[ flag_byte_offset ] = flag_byte;
 
-				for( reference_iterator = 0; reference_iterator < reference_size; reference_iterator++ )
-				{
-					lz_buffer[ lz_buffer_iterator++ ] = lz_buffer[ reference_offset ];
+	memory_free(
+	 compressor );
 
-					uncompressed_data_iterator++;
-					reference_offset++;
+	compressor = NULL;
 
-					/* Make sure the lz buffer iterator and reference offset wrap around
-					 */
-					lz_buffer_iterator %= 4096;
-					reference_offset   %= 4096;
+	if( crc32_calculate_hardware(
+	     &calculated_crc,
+	     &( compressed_data[ sizeof( lzfu_header_t ) ] ),
+	     compressed_data_offset - sizeof( lzfu_header_t ),
+	     0,
+	     1,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to calculate weak CRC.",
+		 function );
 
-					lz_buffer[ lz_buffer_iterator ] = 0;
-				}
-			}
-		}
+		goto on_error;
 	}
-	if( (size_t) ( lzfu_header.uncompressed_data_size + 2 ) != uncompressed_data_iterator )
+	/* The compressed data size includes 12 bytes of the header
+	 */
+	byte_stream_copy_from_uint32_little_endian(
+	 &( compressed_data[ 0 ] ),
+	 (uint32_t) ( compressed_data_offset - 4 ) );
+
+	byte_stream_copy_from_uint32_little_endian(
+	 &( compressed_data[ 4 ] ),
+	 (uint32_t) uncompressed_data_size );
+
+	byte_stream_copy_from_uint32_little_endian(
+	 &( compressed_data[ 8 ] ),
+	 LZFU_SIGNATURE_COMPRESSED );
+
+	byte_stream_copy_from_uint32_little_endian(
+	 &( compressed_data[ 12 ] ),
+	 calculated_crc );
+
+	*compressed_data_size = compressed_data_offset;
+
+	return( 1 );
+
+on_error:
+	if( compressor != NULL )
 	{
-		if( libcnotify_verbose != 0 )
-		{
-			libcnotify_printf(
-			 "%s: mismatch in uncompressed data size (in header: %" PRIu32 " != required: %" PRIzd ").\n",
-			 function,
-			 lzfu_header.uncompressed_data_size + 2,
-			 uncompressed_data_iterator );
-		}
+		memory_free(
+		 compressor );
 	}
-	/* Compensate for the 2 trailing zero bytes
-	 */
-	*uncompressed_data_size = lzfu_header.uncompressed_data_size + 2;
+	return( -1 );
+}
+
+/* Decompresses data using LZFu compression
+ * Returns 1 on success or -1 on error
+ */
+int lzfu_decompress(
+     uint8_t *compressed_data,
+     size_t compressed_data_size,
+     uint8_t *uncompressed_data,
+     size_t *uncompressed_data_size,
+     libcerror_error_t **error )
+{
+	lzfu_decoder_t decoder;
+
+	decoder.lz_buffer_changed_size = LZFU_LZ_BUFFER_SIZE;
+
+	return( lzfu_decoder_decompress(
+	         &decoder,
+	         compressed_data,
+	         compressed_data_size,
+	         uncompressed_data,
+	         uncompressed_data_size,
+	         error ) );
+}
+
+/* Creates a decoder
+ * Make sure the value decoder is referencing, is set to NULL
+ * Returns 1 if successful or -1 on error
+ */
+int lzfu_decoder_initialize(
+     lzfu_decoder_t **decoder,
+     libcerror_error_t **error )
+{
+	static char *function = "lzfu_decoder_initialize";
+
+	if( decoder == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid decoder.",
+		 function );
+
+		return( -1 );
+	}
+	if( *decoder != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid decoder value already set.",
+		 function );
+
+		return( -1 );
+	}
+	*decoder = memory_allocate_structure(
+	            lzfu_decoder_t );
+
+	if( *decoder == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create decoder.",
+		 function );
+
+		goto on_error;
+	}
+	( *decoder )->lz_buffer_changed_size = LZFU_LZ_BUFFER_SIZE;
+
+	if( lzfu_decoder_reset(
+	     *decoder,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to reset decoder.",
+		 function );
+
+		goto on_error;
+	}
+	return( 1 );
+
+on_error:
+	if( *decoder != NULL )
+	{
+		memory_free(
+		 *decoder );
 
-	return( 1 );
+		*decoder = NULL;
+	}
+	return( -1 );
 }
 
-/* Compresses data using LZFu compression
- * Returns 1 on success or -1 on error
+/* Frees a decoder
+ * Returns 1 if successful or -1 on error
  */
-int lzfu_compress(
-     uint8_t *uncompressed_data,
-     size_t uncompressed_data_size,
-     uint8_t *compressed_data,
-     size_t *compressed_data_size,
+int lzfu_decoder_free(
+     lzfu_decoder_t **decoder,
      libcerror_error_t **error )
 {
-	static char *function = "lzfu_compress";
+	static char *function = "lzfu_decoder_free";
 
-	if( compressed_data == NULL )
+	if( decoder == NULL )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
 		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
-		 "%s: invalid compressed data.",
+		 "%s: invalid decoder.",
 		 function );
 
 		return( -1 );
 	}
-	if( compressed_data_size == NULL )
+	if( *decoder != NULL )
+	{
+		memory_free(
+		 *decoder );
+
+		*decoder = NULL;
+	}
+	return( 1 );
+}
+
+/* Resets the LZ buffer of a decoder to the RTF dictionary followed by 0-byte values
+ * Only the part of the LZ buffer that was changed by the previous stream is cleared
+ * which for small streams is considerably less than the size of the LZ buffer
+ * Returns 1 if successful or -1 on error
+ */
+int lzfu_decoder_reset(
+     lzfu_decoder_t *decoder,
+     libcerror_error_t **error )
+{
+	static char *function = "lzfu_decoder_reset";
+
+	if( decoder == NULL )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
 		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
-		 "%s: invalid compressed data size.",
+		 "%s: invalid decoder.",
 		 function );
 
 		return( -1 );
 	}
-	if( uncompressed_data == NULL )
+	if( decoder->lz_buffer_changed_size > ( LZFU_LZ_BUFFER_SIZE - LZFU_RTF_DICTIONARY_SIZE ) )
+	{
+		/* The LZ buffer wrapped around and the RTF dictionary could have been overwritten
+		 */
+		if( memory_copy(
+		     decoder->lz_buffer,
+		     lzfu_rtf_dictionary,
+		     LZFU_RTF_DICTIONARY_SIZE ) == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+			 "%s: unable to initialize lz buffer.",
+			 function );
+
+			return( -1 );
+		}
+		decoder->lz_buffer_changed_size = LZFU_LZ_BUFFER_SIZE - LZFU_RTF_DICTIONARY_SIZE;
+	}
+	if( decoder->lz_buffer_changed_size > 0 )
+	{
+		if( memory_set(
+		     &( decoder->lz_buffer[ LZFU_RTF_DICTIONARY_SIZE ] ),
+		     0,
+		     decoder->lz_buffer_changed_size ) == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+			 "%s: unable to clear lz buffer.",
+			 function );
+
+			return( -1 );
+		}
+		decoder->lz_buffer_changed_size = 0;
+	}
+	return( 1 );
+}
+
+/* Resizes the uncompressed data to contain at least required size bytes
+ * The size of the uncompressed data is doubled, to prevent resizing it for
+ * every byte, but limited to maximum size
+ * Returns 1 on success or -1 on error
+ */
+static int lzfu_resize_uncompressed_data(
+            uint8_t **uncompressed_data,
+            size_t *uncompressed_data_size,
+            size_t required_size,
+            size_t maximum_size,
+            libcerror_error_t **error )
+{
+	uint8_t *reallocation = NULL;
+	static char *function = "lzfu_resize_uncompressed_data";
+	size_t new_size       = 0;
+
+	if( required_size > maximum_size )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
-		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
-		 "%s: invalid uncompressed data.",
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid required size value exceeds maximum.",
 		 function );
 
 		return( -1 );
 	}
-	if( uncompressed_data_size > (size_t) SSIZE_MAX )
+	new_size = *uncompressed_data_size;
+
+	if( new_size <= ( maximum_size / 2 ) )
+	{
+		new_size *= 2;
+	}
+	else
+	{
+		new_size = maximum_size;
+	}
+	if( new_size < required_size )
+	{
+		new_size = required_size;
+	}
+	reallocation = (uint8_t *) memory_reallocate(
+	                            *uncompressed_data,
+	                            sizeof( uint8_t ) * new_size );
+
+	if( reallocation == NULL )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
-		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
-		 "%s: invalid uncompressed data size value exceeds maximum.",
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to resize uncompressed data.",
 		 function );
 
 		return( -1 );
 	}
-/* TODO implement */
-	libcerror_error_set(
-	 error,
-	 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-	 LIBCERROR_RUNTIME_ERROR_GENERIC,
-	 "%s: NOT IMPLEMENTED YET",
-	 function );
+	*uncompressed_data      = reallocation;
+	*uncompressed_data_size = new_size;
 
-	return( -1 );
+	return( 1 );
 }
 
-/* Decompresses data using LZFu compression
+/* Decompresses data using LZFu compression and the LZ buffer of the decoder
+ * If maximum uncompressed data size is not 0 the uncompressed data is resized
+ * when needed up to that size, which requires the uncompressed data to be
+ * allocated by memory_allocate
  * Returns 1 on success or -1 on error
  */
-int lzfu_decompress(
-     uint8_t *compressed_data,
-     size_t compressed_data_size,
-     uint8_t *uncompressed_data,
-     size_t *uncompressed_data_size,
-     libcerror_error_t **error )
+static int lzfu_decoder_decompress_data(
+            lzfu_decoder_t *decoder,
+            uint8_t *compressed_data,
+            size_t compressed_data_size,
+            uint8_t **uncompressed_data,
+            size_t *uncompressed_data_size,
+            size_t maximum_uncompressed_data_size,
+            libcerror_error_t **error )
 {
 	lzfu_header_t lzfu_header;
-	uint8_t lz_buffer[ 4096 ];
 
+	uint8_t *lz_buffer                = NULL;
+	uint8_t *output_data              = NULL;
 	uint8_t *lzfu_data                = 0;
 	uint8_t *lzfu_reference_data      = 0;
-	static char *function             = "lzfu_decompress";
+	static char *function             = "lzfu_decoder_decompress_data";
 	size_t compressed_data_iterator   = 0;
 	size_t uncompressed_data_iterator = 0;
 	uint32_t calculated_crc           = 0;
@@ -351,165 +868,114 @@ int lzfu_decompress(
 	uint8_t flag_byte_bit_mask        = 0;
 	uint8_t flag_byte                 = 0;
 
-	if( uncompressed_data == NULL )
+	if( decoder == NULL )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
 		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
-		 "%s: invalid uncompressed data.",
+		 "%s: invalid decoder.",
 		 function );
 
 		return( -1 );
 	}
-	if( uncompressed_data_size == NULL )
+	if( uncompressed_data == NULL )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
 		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
-		 "%s: invalid uncompressed data size.",
+		 "%s: invalid uncompressed data.",
 		 function );
 
 		return( -1 );
 	}
-	if( compressed_data == NULL )
+	if( *uncompressed_data == NULL )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
 		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
-		 "%s: invalid compressed data.",
+		 "%s: invalid uncompressed data.",
 		 function );
 
 		return( -1 );
 	}
-	if( compressed_data_size > (size_t) SSIZE_MAX )
+	if( uncompressed_data_size == NULL )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
-		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
-		 "%s: invalid compressed data size value exceeds maximum.",
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid uncompressed data size.",
 		 function );
 
 		return( -1 );
 	}
-	if( memory_copy(
-	     lz_buffer,
-	     lzfu_rtf_dictionary,
-	     207 ) == NULL )
+	if( compressed_data == NULL )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_MEMORY,
-		 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
-		 "%s: unable to initialize lz buffer.",
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid compressed data.",
 		 function );
 
 		return( -1 );
 	}
-	lz_buffer_iterator = 207;
-
-	if( memory_set(
-	     &( lz_buffer[ lz_buffer_iterator ] ),
-	     0,
-	     ( 4096 - lz_buffer_iterator ) ) == NULL )
+	if( compressed_data_size > (size_t) SSIZE_MAX )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_MEMORY,
-		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
-		 "%s: unable to clear lz buffer.",
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid compressed data size value exceeds maximum.",
 		 function );
 
 		return( -1 );
 	}
-	lzfu_data = compressed_data;
-
-	byte_stream_copy_to_uint32_little_endian(
-	 lzfu_data,
-	 lzfu_header.compressed_data_size );
-
-	lzfu_data += 4;
-
-	byte_stream_copy_to_uint32_little_endian(
-	 lzfu_data,
-	 lzfu_header.uncompressed_data_size );
-
-	lzfu_data += 4;
-
-	byte_stream_copy_to_uint32_little_endian(
-	 lzfu_data,
-	 lzfu_header.signature );
-
-	lzfu_data += 4;
-
-	byte_stream_copy_to_uint32_little_endian(
-	 lzfu_data,
-	 lzfu_header.crc );
-
-	lzfu_data += 4;
-
-	if( libcnotify_verbose != 0 )
-	{
-		libcnotify_printf(
-		 "%s: lzfu header compressed data size\t: %" PRIu32 "\n",
-		 function,
-		 lzfu_header.compressed_data_size );
-
-		libcnotify_printf(
-		 "%s: lzfu header uncompressed data size\t: %" PRIu32 "\n",
-		 function,
-		 lzfu_header.uncompressed_data_size );
-
-		libcnotify_printf(
-		 "%s: lzfu header signature\t\t\t: 0x08%" PRIx32 "\n",
-		 function,
-		 lzfu_header.signature );
-
-		libcnotify_printf(
-		 "%s: lzfu header crc\t\t\t: %" PRIu32 "\n",
-		 function,
-		 lzfu_header.crc );
-	}
-	if( ( lzfu_header.signature != LZFU_SIGNATURE_COMPRESSED )
-	 && ( lzfu_header.signature != LZFU_SIGNATURE_UNCOMPRESSED ) )
+	if( lzfu_decoder_reset(
+	     decoder,
+	     error ) != 1 )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
-		 LIBCERROR_ARGUMENT_ERROR_UNSUPPORTED_VALUE,
-		 "%s: unsupported compression signature: 0x%08" PRIx32 ".",
-		 function,
-		 lzfu_header.signature );
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to reset decoder.",
+		 function );
 
 		return( -1 );
 	}
-	compressed_data_size -= sizeof( lzfu_header_t );
+	lz_buffer          = decoder->lz_buffer;
+	lz_buffer_iterator = LZFU_RTF_DICTIONARY_SIZE;
 
-	/* The compressed data size includes 12 bytes of the header
+	/* Until the stream was successfully decompressed assume the whole LZ buffer was changed
 	 */
-	lzfu_header.compressed_data_size -= 12;
+	decoder->lz_buffer_changed_size = LZFU_LZ_BUFFER_SIZE;
 
-#ifdef X
-	if( lzfu_header.compressed_data_size != compressed_data_size )
+	if( lzfu_read_header(
+	     &lzfu_header,
+	     compressed_data,
+	     compressed_data_size,
+	     error ) != 1 )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_RANGE,
-		 "%s: mismatch in compressed data size (%" PRIu32 " != %" PRIzd ").",
-		 function,
-		 lzfu_header.compressed_data_size,
-		 compressed_data_size );
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to read header.",
+		 function );
 
 		return( -1 );
 	}
-#endif
+	lzfu_data   = &( compressed_data[ sizeof( lzfu_header_t ) ] );
+	output_data = *uncompressed_data;
+
 	/* Make sure the uncompressed buffer is large enough
 	 */
-	if( *uncompressed_data_size < lzfu_header.uncompressed_data_size )
+	if( ( *uncompressed_data_size < lzfu_header.uncompressed_data_size )
+	 && ( maximum_uncompressed_data_size == 0 ) )
 	{
 		libcerror_error_set(
 		 error,
@@ -522,7 +988,7 @@ int lzfu_decompress(
 
 		return( -1 );
 	}
-	if( crc32_calculate(
+	if( crc32_calculate_hardware(
 	     &calculated_crc,
 	     lzfu_data,
 	     (size_t) lzfu_header.compressed_data_size,
@@ -583,19 +1049,39 @@ int lzfu_decompress(
 				}
 				if( uncompressed_data_iterator >= *uncompressed_data_size )
 				{
-					libcerror_error_set(
-					 error,
-					 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
-					 LIBCERROR_ARGUMENT_ERROR_VALUE_TOO_SMALL,
-					 "%s: uncompressed data too small.",
-					 function );
-
-					*uncompressed_data_size = uncompressed_data_iterator;
-
-					return( -1 );
+					if( maximum_uncompressed_data_size <= *uncompressed_data_size )
+					{
+						libcerror_error_set(
+						 error,
+						 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+						 LIBCERROR_ARGUMENT_ERROR_VALUE_TOO_SMALL,
+						 "%s: uncompressed data too small.",
+						 function );
+
+						*uncompressed_data_size = uncompressed_data_iterator;
+
+						return( -1 );
+					}
+					if( lzfu_resize_uncompressed_data(
+					     uncompressed_data,
+					     uncompressed_data_size,
+					     uncompressed_data_iterator + 1,
+					     maximum_uncompressed_data_size,
+					     error ) != 1 )
+					{
+						libcerror_error_set(
+						 error,
+						 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+						 LIBCERROR_RUNTIME_ERROR_RESIZE_FAILED,
+						 "%s: unable to resize uncompressed data.",
+						 function );
+
+						return( -1 );
+					}
+					output_data = *uncompressed_data;
 				}
 				lz_buffer[ lz_buffer_iterator++ ]                 = lzfu_data[ compressed_data_iterator ];
-				uncompressed_data[ uncompressed_data_iterator++ ] = lzfu_data[ compressed_data_iterator ];
+				output_data[ uncompressed_data_iterator++ ]       = lzfu_data[ compressed_data_iterator ];
 
 				compressed_data_iterator++;
 
@@ -633,21 +1119,41 @@ int lzfu_decompress(
 
 				if( ( uncompressed_data_iterator + reference_size - 1 ) >= *uncompressed_data_size )
 				{
-					libcerror_error_set(
-					 error,
-					 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
-					 LIBCERROR_ARGUMENT_ERROR_VALUE_TOO_SMALL,
-					 "%s: uncompressed data too small.",
-					 function );
-
-					*uncompressed_data_size = uncompressed_data_iterator + reference_size;
-
-					return( -1 );
+					if( maximum_uncompressed_data_size <= *uncompressed_data_size )
+					{
+						libcerror_error_set(
+						 error,
+						 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+						 LIBCERROR_ARGUMENT_ERROR_VALUE_TOO_SMALL,
+						 "%s: uncompressed data too small.",
+						 function );
+
+						*uncompressed_data_size = uncompressed_data_iterator + reference_size;
+
+						return( -1 );
+					}
+					if( lzfu_resize_uncompressed_data(
+					     uncompressed_data,
+					     uncompressed_data_size,
+					     uncompressed_data_iterator + reference_size,
+					     maximum_uncompressed_data_size,
+					     error ) != 1 )
+					{
+						libcerror_error_set(
+						 error,
+						 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+						 LIBCERROR_RUNTIME_ERROR_RESIZE_FAILED,
+						 "%s: unable to resize uncompressed data.",
+						 function );
+
+						return( -1 );
+					}
+					output_data = *uncompressed_data;
 				}
 				for( reference_iterator = 0; reference_iterator < reference_size; reference_iterator++ )
 				{
 					lz_buffer[ lz_buffer_iterator++ ]                 = lz_buffer[ reference_offset ];
-					uncompressed_data[ uncompressed_data_iterator++ ] = lz_buffer[ reference_offset ];
+					output_data[ uncompressed_data_iterator++ ]       = lz_buffer[ reference_offset ];
 
 					reference_offset++;
 
@@ -663,6 +1169,176 @@ int lzfu_decompress(
 	}
 	*uncompressed_data_size = uncompressed_data_iterator;
 
+	/* The byte after the last byte stored in the LZ buffer is set to 0 as well
+	 */
+	if( uncompressed_data_iterator < ( LZFU_LZ_BUFFER_SIZE - LZFU_RTF_DICTIONARY_SIZE ) )
+	{
+		decoder->lz_buffer_changed_size = uncompressed_data_iterator + 1;
+	}
+	return( 1 );
+}
+
+/* Decompresses data using LZFu compression and the LZ buffer of the decoder
+ * Returns 1 on success or -1 on error
+ */
+int lzfu_decoder_decompress(
+     lzfu_decoder_t *decoder,
+     uint8_t *compressed_data,
+     size_t compressed_data_size,
+     uint8_t *uncompressed_data,
+     size_t *uncompressed_data_size,
+     libcerror_error_t **error )
+{
+	return( lzfu_decoder_decompress_data(
+	         decoder,
+	         compressed_data,
+	         compressed_data_size,
+	         &uncompressed_data,
+	         uncompressed_data_size,
+	         0,
+	         error ) );
+}
+
+/* Decompresses data using LZFu compression into a newly allocated buffer
+ * The buffer is sized using the uncompressed data size in the header so that
+ * the data is decompressed in a single pass, if the header is damaged and
+ * the uncompressed data is larger the buffer is resized while decompressing
+ * The uncompressed data must be freed with memory_free
+ * Returns 1 on success or -1 on error
+ */
+int lzfu_decompress_allocate(
+     uint8_t *compressed_data,
+     size_t compressed_data_size,
+     uint8_t **uncompressed_data,
+     size_t *uncompressed_data_size,
+     libcerror_error_t **error )
+{
+	lzfu_decoder_t decoder;
+
+	static char *function                 = "lzfu_decompress_allocate";
+	size_t maximum_uncompressed_data_size = 0;
+	size_t safe_uncompressed_data_size    = 0;
+
+	if( compressed_data_size > (size_t) ( SSIZE_MAX / 8 ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid compressed data size value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	if( uncompressed_data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid uncompressed data.",
+		 function );
+
+		return( -1 );
+	}
+	if( *uncompressed_data != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid uncompressed data value already set.",
+		 function );
+
+		return( -1 );
+	}
+	if( uncompressed_data_size == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid uncompressed data size.",
+		 function );
+
+		return( -1 );
+	}
+	if( lzfu_get_uncompressed_data_size(
+	     compressed_data,
+	     compressed_data_size,
+	     &safe_uncompressed_data_size,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to determine uncompressed data size.",
+		 function );
+
+		goto on_error;
+	}
+	/* A flag byte followed by 8 references of 2 bytes, which is 17 bytes of compressed data,
+	 * can represent at most 8 x 17 bytes of uncompressed data
+	 */
+	maximum_uncompressed_data_size = compressed_data_size * 8;
+
+	/* Do not trust a damaged header to allocate more than the compressed data can represent
+	 */
+	if( safe_uncompressed_data_size > maximum_uncompressed_data_size )
+	{
+		safe_uncompressed_data_size = maximum_uncompressed_data_size;
+	}
+	if( safe_uncompressed_data_size == 0 )
+	{
+		safe_uncompressed_data_size = 1;
+	}
+	*uncompressed_data = (uint8_t *) memory_allocate(
+	                                  sizeof( uint8_t ) * safe_uncompressed_data_size );
+
+	if( *uncompressed_data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create uncompressed data.",
+		 function );
+
+		goto on_error;
+	}
+	decoder.lz_buffer_changed_size = LZFU_LZ_BUFFER_SIZE;
+
+	if( lzfu_decoder_decompress_data(
+	     &decoder,
+	     compressed_data,
+	     compressed_data_size,
+	     uncompressed_data,
+	     &safe_uncompressed_data_size,
+	     maximum_uncompressed_data_size,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_COMPRESSION,
+		 LIBCERROR_COMPRESSION_ERROR_DECOMPRESS_FAILED,
+		 "%s: unable to decompress data.",
+		 function );
+
+		goto on_error;
+	}
+	*uncompressed_data_size = safe_uncompressed_data_size;
+
 	return( 1 );
+
+on_error:
+	if( *uncompressed_data != NULL )
+	{
+		memory_free(
+		 *uncompressed_data );
+
+		*uncompressed_data = NULL;
+	}
+	return( -1 );
 }
 
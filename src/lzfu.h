@@ -54,6 +54,55 @@ struct lzfu_header
 	uint32_t crc;
 };
 
+/* The size of the LZ buffer (sliding window)
+ */
+#define LZFU_LZ_BUFFER_SIZE		4096
+
+/* The size of the RTF dictionary used to prime the LZ buffer
+ */
+#define LZFU_RTF_DICTIONARY_SIZE	207
+
+/* The number of bits of the string hash used by the compressor
+ */
+#define LZFU_COMPRESSOR_HASH_NUMBER_OF_BITS	12
+
+/* The maximum number of strings in a hash chain the compressor compares
+ */
+#define LZFU_COMPRESSOR_MAXIMUM_CHAIN_LENGTH	32
+
+typedef struct lzfu_compressor lzfu_compressor_t;
+
+struct lzfu_compressor
+{
+	/* The hash heads
+	 * an entry contains the position + 1 of the last string with the hash or 0 if not set
+	 */
+	uint32_t hash_heads[ 1 << LZFU_COMPRESSOR_HASH_NUMBER_OF_BITS ];
+
+	/* The hash chains
+	 * an entry contains the position + 1 of the previous string with the same hash
+	 * and is indexed by the offset of the string within the LZ buffer
+	 */
+	uint32_t hash_chains[ LZFU_LZ_BUFFER_SIZE ];
+};
+
+typedef struct lzfu_decoder lzfu_decoder_t;
+
+/* The decoder contains the LZ buffer of lzfu_decoder_decompress
+ * so that it can be reused when decompressing many small streams
+ */
+struct lzfu_decoder
+{
+	/* The LZ buffer
+	 */
+	uint8_t lz_buffer[ LZFU_LZ_BUFFER_SIZE ];
+
+	/* The number of bytes after the RTF dictionary that have been
+	 * changed since the LZ buffer was last reset
+	 */
+	size_t lz_buffer_changed_size;
+};
+
 int lzfu_get_uncompressed_data_size(
      uint8_t *compressed_data,
      size_t compressed_data_size,
@@ -74,6 +123,33 @@ int lzfu_decompress(
      size_t *uncompressed_data_size,
      libcerror_error_t **error );
 
+int lzfu_decompress_allocate(
+     uint8_t *compressed_data,
+     size_t compressed_data_size,
+     uint8_t **uncompressed_data,
+     size_t *uncompressed_data_size,
+     libcerror_error_t **error );
+
+int lzfu_decoder_initialize(
+     lzfu_decoder_t **decoder,
+     libcerror_error_t **error );
+
+int lzfu_decoder_free(
+     lzfu_decoder_t **decoder,
+     libcerror_error_t **error );
+
+int lzfu_decoder_reset(
+     lzfu_decoder_t *decoder,
+     libcerror_error_t **error );
+
+int lzfu_decoder_decompress(
+     lzfu_decoder_t *decoder,
+     uint8_t *compressed_data,
+     size_t compressed_data_size,
+     uint8_t *uncompressed_data,
+     size_t *uncompressed_data_size,
+     libcerror_error_t **error );
+
 #if defined( __cplusplus )
 }
 #endif
@@ -31,10 +31,12 @@
 #endif
 
 #include "assorted_getopt.h"
+#include "assorted_input_file.h"
 #include "assorted_libcerror.h"
 #include "assorted_libcfile.h"
 #include "assorted_libcnotify.h"
 #include "assorted_output.h"
+#include "assorted_output_file.h"
 #include "lzfu.h"
 
 /* Prints the executable usage information
@@ -48,13 +50,17 @@ void usage_fprint(
 	}
 	fprintf( stream, "Use lzfudecompress to decompress data as LZFu compressed data.\n\n" );
 
-	fprintf( stream, "Usage: lzfudecompress [ -o offset ] [ -s size ] [ -hvV ] source\n\n" );
+	fprintf( stream, "Usage: lzfudecompress [ -o offset ] [ -s size ] [ -S format ]\n"
+	                 "                      [ -hvV ] source\n\n" );
 
 	fprintf( stream, "\tsource: the source file\n\n" );
 
 	fprintf( stream, "\t-h:     shows this help\n" );
 	fprintf( stream, "\t-o:     data offset (default is 0)\n" );
 	fprintf( stream, "\t-s:     size of data (default is the file size)\n" );
+	fprintf( stream, "\t-S:     print timing and throughput statistics of the open,\n"
+	                 "\t        read, compute and write phases and the peak memory\n"
+	                 "\t        size to stderr in the format: text or json\n" );
 	fprintf( stream, "\t-v:     verbose output to stderr\n" );
 	fprintf( stream, "\t-V:     print version\n" );
 	fprintf( stream, "\n" );
@@ -68,24 +74,26 @@ int wmain( int argc, wchar_t * const argv[] )
 int main( int argc, char * const argv[] )
 #endif
 {
-	char destination[ 128 ];
-
-	libcerror_error_t *error          = NULL;
-	libcfile_file_t *destination_file = NULL;
-	libcfile_file_t *source_file      = NULL;
-	system_character_t *source        = NULL;
-	uint8_t *buffer                   = NULL;
-	uint8_t *uncompressed_data        = NULL;
-	char *program                     = "lzfudecompress";
-	system_integer_t option           = 0;
-	size64_t source_size              = 0;
-	size_t uncompressed_data_size     = 0;
-	ssize_t read_count                = 0;
-	ssize_t write_count               = 0;
-	off_t source_offset               = 0;
-	int print_count                   = 0;
-	int result                        = 0;
-	int verbose                       = 0;
+	system_character_t destination[ 128 ];
+
+	libcerror_error_t *error                     = NULL;
+	assorted_input_file_t *source_file           = NULL;
+	assorted_output_file_t *destination_file     = NULL;
+	system_character_t *option_statistics_format = NULL;
+	system_character_t *source                   = NULL;
+	uint8_t *buffer                              = NULL;
+	uint8_t *uncompressed_data                   = NULL;
+	char *program                                = "lzfudecompress";
+	system_integer_t option                      = 0;
+	size64_t source_size                         = 0;
+	size_t uncompressed_data_size                = 0;
+	ssize_t read_count                           = 0;
+	ssize_t write_count                          = 0;
+	off_t source_offset                          = 0;
+	int is_mapped                                = 0;
+	int print_count                              = 0;
+	int result                                   = 0;
+	int verbose                                  = 0;
 
 	assorted_output_version_fprint(
 	 stdout,
@@ -94,7 +102,7 @@ int main( int argc, char * const argv[] )
 	while( ( option = assorted_getopt(
 	                   argc,
 	                   argv,
-	                   _SYSTEM_STRING( "ho:s:vV" ) ) ) != (system_integer_t) -1 )
+	                   _SYSTEM_STRING( "ho:s:S:vV" ) ) ) != (system_integer_t) -1 )
 	{
 		switch( option )
 		{
@@ -126,6 +134,11 @@ int main( int argc, char * const argv[] )
 
 				break;
 
+			case 'S':
+				option_statistics_format = optarg;
+
+				break;
+
 			case 'v':
 				verbose = 1;
 
@@ -157,9 +170,20 @@ int main( int argc, char * const argv[] )
 	libcnotify_verbose_set(
 	 verbose );
 
+	if( assorted_output_statistics_initialize(
+	     option_statistics_format,
+	     &error ) != 1 )
+	{
+		fprintf(
+		 stderr,
+		 "Unable to initialize statistics.\n" );
+
+		goto on_error;
+	}
+
 	/* Open the source file
 	 */
-	if( libcfile_file_initialize(
+	if( assorted_input_file_initialize(
 	     &source_file,
 	     &error ) != 1 )
 	{
@@ -169,10 +193,9 @@ int main( int argc, char * const argv[] )
 
 		goto on_error;
 	}
-	if( libcfile_file_open(
+	if( assorted_input_file_open(
 	     source_file,
 	     source,
-	     LIBCFILE_OPEN_READ,
 	     &error ) != 1 )
 	{
 		fprintf(
@@ -183,7 +206,7 @@ int main( int argc, char * const argv[] )
 	}
 	if( source_size == 0 )
 	{
-		if( libcfile_file_get_size(
+		if( assorted_input_file_get_size(
 		     source_file,
 		     &source_size,
 		     &error ) == -1 )
@@ -203,7 +226,7 @@ int main( int argc, char * const argv[] )
 
 		goto on_error;
 	}
-	if( source_size > (size64_t) ( SSIZE_MAX / 16 ) )
+	if( source_size > (size64_t) ( SSIZE_MAX / 8 ) )
 	{
 		fprintf(
 		 stderr,
@@ -211,33 +234,9 @@ int main( int argc, char * const argv[] )
 
 		goto on_error;
 	}
-	buffer = (uint8_t *) memory_allocate(
-	                      sizeof( uint8_t ) * source_size );
-
-	if( buffer == NULL )
-	{
-		fprintf(
-		 stderr,
-		 "Unable to create buffer.\n" );
-
-		goto on_error;
-	}
-	uncompressed_data_size = source_size * 16;
-
-	uncompressed_data = (uint8_t *) memory_allocate(
-	                                 sizeof( uint8_t ) * uncompressed_data_size );
-
-	if( uncompressed_data == NULL )
-	{
-		fprintf(
-		 stderr,
-		 "Unable to create uncompressed data buffer.\n" );
-
-		goto on_error;
-	}
 	/* Position the source file at the right offset
 	 */
-	if( libcfile_file_seek_offset(
+	if( assorted_input_file_seek_offset(
 	     source_file,
 	     source_offset,
 	     SEEK_SET,
@@ -249,10 +248,10 @@ int main( int argc, char * const argv[] )
 
 		goto on_error;
 	}
-	print_count = narrow_string_snprintf(
+	print_count = system_string_sprintf(
 	               destination,
 	               128,
-	               "%s.lzfudecompressed",
+	               _SYSTEM_STRING( "%" PRIs_SYSTEM ".lzfudecompressed" ),
 	               source );
 
 	if( ( print_count < 0 )
@@ -266,10 +265,10 @@ int main( int argc, char * const argv[] )
 	}
 	/* Read and decompress the data
 	 */
-	read_count = libcfile_file_read_buffer(
-		      source_file,
-		      buffer,
-		      source_size,
+	read_count = assorted_input_file_read_data(
+	              source_file,
+	              &buffer,
+	              (size_t) source_size,
 	              &error );
 
 	if( read_count != (ssize_t) source_size )
@@ -280,22 +279,11 @@ int main( int argc, char * const argv[] )
 
 		goto on_error;
 	}
-	if( lzfu_decompress(
-	     buffer,
-	     source_size,
-	     uncompressed_data,
-	     &uncompressed_data_size,
-	     &error ) != 1 )
-	{
-		fprintf(
-		 stderr,
-		 "Unable to decompress data.\n" );
-
-		goto on_error;
-	}
-	/* Open the destination file
+	/* Open the destination file, if it can be mapped the data is decompressed
+	 * directly into the destination file instead of an uncompressed data buffer
+	 * LZFu compressed data represents at most 8 times its size of uncompressed data
 	 */
-	if( libcfile_file_initialize(
+	if( assorted_output_file_initialize(
 	     &destination_file,
 	     &error ) != 1 )
 	{
@@ -305,10 +293,10 @@ int main( int argc, char * const argv[] )
 
 		goto on_error;
 	}
-	if( libcfile_file_open(
+	if( assorted_output_file_open(
 	     destination_file,
 	     destination,
-	     LIBCFILE_OPEN_WRITE,
+	     (size_t) source_size * 8,
 	     &error ) != 1 )
 	{
 		fprintf(
@@ -317,7 +305,47 @@ int main( int argc, char * const argv[] )
 
 		goto on_error;
 	}
-	write_count = libcfile_file_write_buffer(
+	is_mapped = assorted_output_file_get_mapped_data(
+	             destination_file,
+	             &uncompressed_data,
+	             &uncompressed_data_size,
+	             &error );
+
+	if( is_mapped == -1 )
+	{
+		fprintf(
+		 stderr,
+		 "Unable to retrieve mapped destination data.\n" );
+
+		goto on_error;
+	}
+	else if( is_mapped != 0 )
+	{
+		result = lzfu_decompress(
+		          buffer,
+		          (size_t) source_size,
+		          uncompressed_data,
+		          &uncompressed_data_size,
+		          &error );
+	}
+	else
+	{
+		result = lzfu_decompress_allocate(
+		          buffer,
+		          (size_t) source_size,
+		          &uncompressed_data,
+		          &uncompressed_data_size,
+		          &error );
+	}
+	if( result != 1 )
+	{
+		fprintf(
+		 stderr,
+		 "Unable to decompress data.\n" );
+
+		goto on_error;
+	}
+	write_count = assorted_output_file_write_data(
 		       destination_file,
 		       uncompressed_data,
 		       uncompressed_data_size,
@@ -333,7 +361,7 @@ int main( int argc, char * const argv[] )
 	}
 	/* Clean up
 	 */
-	if( libcfile_file_close(
+	if( assorted_output_file_close(
 	     destination_file,
 	     &error ) != 0 )
 	{
@@ -343,7 +371,7 @@ int main( int argc, char * const argv[] )
 
 		goto on_error;
 	}
-	if( libcfile_file_free(
+	if( assorted_output_file_free(
 	     &destination_file,
 	     &error ) != 1 )
 	{
@@ -353,7 +381,7 @@ int main( int argc, char * const argv[] )
 
 		goto on_error;
 	}
-	if( libcfile_file_close(
+	if( assorted_input_file_close(
 	     source_file,
 	     &error ) != 0 )
 	{
@@ -363,7 +391,7 @@ int main( int argc, char * const argv[] )
 
 		goto on_error;
 	}
-	if( libcfile_file_free(
+	if( assorted_input_file_free(
 	     &source_file,
 	     &error ) != 1 )
 	{
@@ -373,12 +401,11 @@ int main( int argc, char * const argv[] )
 
 		goto on_error;
 	}
-	memory_free(
-	 uncompressed_data );
-
-	memory_free(
-	 buffer );
-
+	if( is_mapped == 0 )
+	{
+		memory_free(
+		 uncompressed_data );
+	}
 	if( result == -1 )
 	{
 		fprintf(
@@ -391,6 +418,14 @@ int main( int argc, char * const argv[] )
 	 stdout,
 	 "LZFu decompression:\tSUCCESS\n" );
 
+	assorted_output_statistics_fprint(
+	 stderr,
+	 program,
+	 1,
+	 NULL );
+	assorted_output_statistics_free(
+	 NULL );
+
 	return( EXIT_SUCCESS );
 
 on_error:
@@ -401,25 +436,28 @@ on_error:
 		libcerror_error_free(
 		 &error );
 	}
+	assorted_output_statistics_fprint(
+	 stderr,
+	 program,
+	 -1,
+	 NULL );
+	assorted_output_statistics_free(
+	 NULL );
 	if( destination_file != NULL )
 	{
-		libcfile_file_free(
+		assorted_output_file_free(
 		 &destination_file,
 		 NULL );
 	}
-	if( uncompressed_data != NULL )
+	if( ( uncompressed_data != NULL )
+	 && ( is_mapped == 0 ) )
 	{
 		memory_free(
 		 uncompressed_data );
 	}
-	if( buffer != NULL )
-	{
-		memory_free(
-		 buffer );
-	}
 	if( source_file != NULL )
 	{
-		libcfile_file_free(
+		assorted_input_file_free(
 		 &source_file,
 		 NULL );
 	}
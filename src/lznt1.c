@@ -0,0 +1,656 @@
+/*
+ * LZNT1 compression functions
+ *
+ * Copyright (C) 2008-2019, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This software is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This software is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this software.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <byte_stream.h>
+#include <memory.h>
+#include <types.h>
+
+#include "assorted_libcerror.h"
+#include "lznt1.h"
+
+/* The chunk header flags and signature
+ */
+#define LZNT1_CHUNK_HEADER_FLAG_IS_COMPRESSED	0x8000
+#define LZNT1_CHUNK_HEADER_SIGNATURE		0x3000
+
+/* The minimum size of a match
+ */
+#define LZNT1_MINIMUM_MATCH_SIZE		3
+
+/* The maximum size of a token, which is a flag byte followed by a 16-bit tuple
+ */
+#define LZNT1_MAXIMUM_TOKEN_SIZE		3
+
+/* Creates a compressor
+ * Make sure the value compressor is referencing, is set to NULL
+ * Returns 1 if successful or -1 on error
+ */
+int lznt1_compressor_initialize(
+     lznt1_compressor_t **compressor,
+     libcerror_error_t **error )
+{
+	static char *function = "lznt1_compressor_initialize";
+
+	if( compressor == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid compressor.",
+		 function );
+
+		return( -1 );
+	}
+	if( *compressor != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid compressor value already set.",
+		 function );
+
+		return( -1 );
+	}
+	*compressor = memory_allocate_structure(
+	               lznt1_compressor_t );
+
+	if( *compressor == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create compressor.",
+		 function );
+
+		goto on_error;
+	}
+	if( memory_set(
+	     *compressor,
+	     0,
+	     sizeof( lznt1_compressor_t ) ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear compressor.",
+		 function );
+
+		goto on_error;
+	}
+	return( 1 );
+
+on_error:
+	if( *compressor != NULL )
+	{
+		memory_free(
+		 *compressor );
+
+		*compressor = NULL;
+	}
+	return( -1 );
+}
+
+/* Frees a compressor
+ * Returns 1 if successful or -1 on error
+ */
+int lznt1_compressor_free(
+     lznt1_compressor_t **compressor,
+     libcerror_error_t **error )
+{
+	static char *function = "lznt1_compressor_free";
+
+	if( compressor == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid compressor.",
+		 function );
+
+		return( -1 );
+	}
+	if( *compressor != NULL )
+	{
+		memory_free(
+		 *compressor );
+
+		*compressor = NULL;
+	}
+	return( 1 );
+}
+
+/* Inserts the 3-byte string at the offset into the hash table and hash chain
+ * Returns the hash chain entry of the previous string with the same hash
+ */
+static uint16_t lznt1_compressor_insert_string(
+                 lznt1_compressor_t *compressor,
+                 const uint8_t *data,
+                 size_t data_offset )
+{
+	uint32_t hash_value  = 0;
+	uint16_t chain_entry = 0;
+
+	hash_value = ( (uint32_t) data[ data_offset ] )
+	           | ( (uint32_t) data[ data_offset + 1 ] << 8 )
+	           | ( (uint32_t) data[ data_offset + 2 ] << 16 );
+
+	hash_value  *= (uint32_t) 0x9e3779b1UL;
+	hash_value >>= 32 - LZNT1_COMPRESSOR_HASH_NUMBER_OF_BITS;
+
+	chain_entry = compressor->hash_table[ hash_value ];
+
+	compressor->hash_chain[ data_offset ] = chain_entry;
+	compressor->hash_table[ hash_value ]  = (uint16_t) ( data_offset + 1 );
+
+	return( chain_entry );
+}
+
+/* Determines the size of the match between the data at the offset and the data at the match offset
+ * Returns the match size
+ */
+static size_t lznt1_compressor_get_match_size(
+               const uint8_t *data,
+               size_t data_offset,
+               size_t match_offset,
+               size_t maximum_match_size )
+{
+	size_t match_size = 0;
+
+	while( match_size < maximum_match_size )
+	{
+		if( data[ match_offset + match_size ] != data[ data_offset + match_size ] )
+		{
+			break;
+		}
+		match_size++;
+	}
+	return( match_size );
+}
+
+/* Compresses a chunk of at most 4096 bytes using LZNT1 compression
+ * Uses hash chains of the 3-byte strings in the chunk to find the longest match,
+ * where a match can refer to any preceding offset in the chunk
+ * The chunk is stored uncompressed as soon as the compressed data can no longer
+ * be smaller than the uncompressed data, hence the compressed data must be
+ * able to contain the uncompressed data and the chunk header
+ * Returns 1 on success or -1 on error
+ */
+int lznt1_compressor_compress_chunk(
+     lznt1_compressor_t *compressor,
+     const uint8_t *uncompressed_data,
+     size_t uncompressed_data_size,
+     uint8_t *compressed_data,
+     size_t *compressed_data_size,
+     libcerror_error_t **error )
+{
+	static char *function           = "lznt1_compressor_compress_chunk";
+	size_t candidate_match_size     = 0;
+	size_t candidate_offset         = 0;
+	size_t compressed_data_offset   = 0;
+	size_t flag_byte_offset         = 0;
+	size_t match_offset             = 0;
+	size_t match_size               = 0;
+	size_t maximum_match_size       = 0;
+	size_t string_offset            = 0;
+	size_t uncompressed_data_offset = 0;
+	uint16_t chain_entry            = 0;
+	uint16_t chunk_header           = 0;
+	uint16_t tuple                  = 0;
+	uint8_t flag_bit_index          = 0;
+	uint8_t number_of_offset_bits   = 4;
+	int chain_length                = 0;
+
+	if( compressor == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid compressor.",
+		 function );
+
+		return( -1 );
+	}
+	if( uncompressed_data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid uncompressed data.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( uncompressed_data_size == 0 )
+	 || ( uncompressed_data_size > (size_t) LZNT1_CHUNK_SIZE ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid uncompressed data size value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( compressed_data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid compressed data.",
+		 function );
+
+		return( -1 );
+	}
+	if( compressed_data_size == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid compressed data size.",
+		 function );
+
+		return( -1 );
+	}
+	if( *compressed_data_size < ( LZNT1_CHUNK_HEADER_SIZE + uncompressed_data_size ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_TOO_SMALL,
+		 "%s: invalid compressed data size value too small.",
+		 function );
+
+		return( -1 );
+	}
+	/* Only the hash table needs to be cleared, a hash chain entry is set
+	 * when its string is inserted and before it is referenced
+	 */
+	if( memory_set(
+	     compressor->hash_table,
+	     0,
+	     sizeof( uint16_t ) * ( 1 << LZNT1_COMPRESSOR_HASH_NUMBER_OF_BITS ) ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear hash table.",
+		 function );
+
+		return( -1 );
+	}
+	compressed_data_offset = LZNT1_CHUNK_HEADER_SIZE;
+
+	while( uncompressed_data_offset < uncompressed_data_size )
+	{
+		/* Stop when the next token could make the compressed data larger
+		 * than the uncompressed data
+		 */
+		if( ( compressed_data_offset + LZNT1_MAXIMUM_TOKEN_SIZE ) > ( LZNT1_CHUNK_HEADER_SIZE + uncompressed_data_size ) )
+		{
+			break;
+		}
+		if( flag_bit_index == 0 )
+		{
+			flag_byte_offset = compressed_data_offset++;
+
+			compressed_data[ flag_byte_offset ] = 0;
+		}
+		match_size = 0;
+
+		if( ( uncompressed_data_offset + LZNT1_MINIMUM_MATCH_SIZE ) <= uncompressed_data_size )
+		{
+			chain_entry = lznt1_compressor_insert_string(
+			               compressor,
+			               uncompressed_data,
+			               uncompressed_data_offset );
+
+			if( chain_entry != 0 )
+			{
+				/* The number of bits of the tuple used to store the match offset
+				 * grows with the offset in the chunk from 4 up to 12 bits,
+				 * the remaining bits are used to store the match size
+				 */
+				while( ( uncompressed_data_offset - 1 ) >= ( (size_t) 1 << number_of_offset_bits ) )
+				{
+					number_of_offset_bits++;
+				}
+				maximum_match_size = ( (size_t) 1 << ( 16 - number_of_offset_bits ) ) + LZNT1_MINIMUM_MATCH_SIZE - 1;
+
+				if( maximum_match_size > ( uncompressed_data_size - uncompressed_data_offset ) )
+				{
+					maximum_match_size = uncompressed_data_size - uncompressed_data_offset;
+				}
+				chain_length = LZNT1_COMPRESSOR_MAXIMUM_CHAIN_LENGTH;
+
+				while( ( chain_entry != 0 )
+				    && ( chain_length > 0 ) )
+				{
+					candidate_offset = (size_t) chain_entry - 1;
+
+					/* A candidate can only be longer if it matches at the current match size
+					 */
+					if( uncompressed_data[ candidate_offset + match_size ] == uncompressed_data[ uncompressed_data_offset + match_size ] )
+					{
+						candidate_match_size = lznt1_compressor_get_match_size(
+						                        uncompressed_data,
+						                        uncompressed_data_offset,
+						                        candidate_offset,
+						                        maximum_match_size );
+
+						if( candidate_match_size > match_size )
+						{
+							match_size   = candidate_match_size;
+							match_offset = candidate_offset;
+
+							if( match_size == maximum_match_size )
+							{
+								break;
+							}
+						}
+					}
+					chain_entry = compressor->hash_chain[ candidate_offset ];
+
+					chain_length--;
+				}
+			}
+		}
+		if( match_size >= LZNT1_MINIMUM_MATCH_SIZE )
+		{
+			tuple = (uint16_t) ( ( ( uncompressed_data_offset - match_offset - 1 ) << ( 16 - number_of_offset_bits ) )
+			                   | ( match_size - LZNT1_MINIMUM_MATCH_SIZE ) );
+
+			byte_stream_copy_from_uint16_little_endian(
+			 &( compressed_data[ compressed_data_offset ] ),
+			 tuple );
+
+			compressed_data_offset += 2;
+
+			compressed_data[ flag_byte_offset ] |= (uint8_t) ( 1 << flag_bit_index );
+
+			for( string_offset = uncompressed_data_offset + 1;
+			     string_offset < ( uncompressed_data_offset + match_size );
+			     string_offset++ )
+			{
+				if( ( string_offset + LZNT1_MINIMUM_MATCH_SIZE ) > uncompressed_data_size )
+				{
+					break;
+				}
+				lznt1_compressor_insert_string(
+				 compressor,
+				 uncompressed_data,
+				 string_offset );
+			}
+			uncompressed_data_offset += match_size;
+		}
+		else
+		{
+			compressed_data[ compressed_data_offset++ ] = uncompressed_data[ uncompressed_data_offset++ ];
+		}
+		flag_bit_index = ( flag_bit_index + 1 ) & 0x07;
+	}
+	if( ( uncompressed_data_offset < uncompressed_data_size )
+	 || ( compressed_data_offset >= ( LZNT1_CHUNK_HEADER_SIZE + uncompressed_data_size ) ) )
+	{
+		/* The chunk is uncompressible and is stored uncompressed
+		 */
+		chunk_header = (uint16_t) ( LZNT1_CHUNK_HEADER_SIGNATURE | ( uncompressed_data_size - 1 ) );
+
+		if( memory_copy(
+		     &( compressed_data[ LZNT1_CHUNK_HEADER_SIZE ] ),
+		     uncompressed_data,
+		     uncompressed_data_size ) == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+			 "%s: unable to copy uncompressed data.",
+			 function );
+
+			return( -1 );
+		}
+		compressed_data_offset = LZNT1_CHUNK_HEADER_SIZE + uncompressed_data_size;
+	}
+	else
+	{
+		chunk_header = (uint16_t) ( LZNT1_CHUNK_HEADER_FLAG_IS_COMPRESSED | LZNT1_CHUNK_HEADER_SIGNATURE | ( compressed_data_offset - 3 ) );
+	}
+	byte_stream_copy_from_uint16_little_endian(
+	 compressed_data,
+	 chunk_header );
+
+	*compressed_data_size = compressed_data_offset;
+
+	return( 1 );
+}
+
+/* Determines the maximum size of LZNT1 compressed data, which is the size
+ * of the data with every chunk stored uncompressed
+ * Returns 1 on success or -1 on error
+ */
+int lznt1_get_maximum_compressed_data_size(
+     size_t uncompressed_data_size,
+     size_t *compressed_data_size,
+     libcerror_error_t **error )
+{
+	static char *function   = "lznt1_get_maximum_compressed_data_size";
+	size_t number_of_chunks = 0;
+
+	if( uncompressed_data_size > (size_t) SSIZE_MAX )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid uncompressed data size value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	if( compressed_data_size == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid compressed data size.",
+		 function );
+
+		return( -1 );
+	}
+	number_of_chunks = uncompressed_data_size / LZNT1_CHUNK_SIZE;
+
+	if( ( uncompressed_data_size % LZNT1_CHUNK_SIZE ) != 0 )
+	{
+		number_of_chunks++;
+	}
+	if( ( number_of_chunks * LZNT1_CHUNK_HEADER_SIZE ) > ( (size_t) SSIZE_MAX - uncompressed_data_size ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid compressed data size value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	*compressed_data_size = uncompressed_data_size + ( number_of_chunks * LZNT1_CHUNK_HEADER_SIZE );
+
+	return( 1 );
+}
+
+/* Compresses data using LZNT1 compression
+ * The data is compressed in independent chunks of 4096 bytes that are stored consecutively
+ * Returns 1 on success or -1 on error
+ */
+int lznt1_compress(
+     const uint8_t *uncompressed_data,
+     size_t uncompressed_data_size,
+     uint8_t *compressed_data,
+     size_t *compressed_data_size,
+     libcerror_error_t **error )
+{
+	lznt1_compressor_t *compressor  = NULL;
+	static char *function           = "lznt1_compress";
+	size_t chunk_compressed_size    = 0;
+	size_t chunk_uncompressed_size  = 0;
+	size_t compressed_data_offset   = 0;
+	size_t uncompressed_data_offset = 0;
+
+	if( uncompressed_data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid uncompressed data.",
+		 function );
+
+		return( -1 );
+	}
+	if( uncompressed_data_size > (size_t) SSIZE_MAX )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid uncompressed data size value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	if( compressed_data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid compressed data.",
+		 function );
+
+		return( -1 );
+	}
+	if( compressed_data_size == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid compressed data size.",
+		 function );
+
+		return( -1 );
+	}
+	if( *compressed_data_size > (size_t) SSIZE_MAX )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid compressed data size value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	if( lznt1_compressor_initialize(
+	     &compressor,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create compressor.",
+		 function );
+
+		goto on_error;
+	}
+	while( uncompressed_data_offset < uncompressed_data_size )
+	{
+		chunk_uncompressed_size = uncompressed_data_size - uncompressed_data_offset;
+
+		if( chunk_uncompressed_size > LZNT1_CHUNK_SIZE )
+		{
+			chunk_uncompressed_size = LZNT1_CHUNK_SIZE;
+		}
+		chunk_compressed_size = *compressed_data_size - compressed_data_offset;
+
+		if( lznt1_compressor_compress_chunk(
+		     compressor,
+		     &( uncompressed_data[ uncompressed_data_offset ] ),
+		     chunk_uncompressed_size,
+		     &( compressed_data[ compressed_data_offset ] ),
+		     &chunk_compressed_size,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_COMPRESSION,
+			 LIBCERROR_COMPRESSION_ERROR_COMPRESS_FAILED,
+			 "%s: unable to compress chunk at offset: %" PRIzd ".",
+			 function,
+			 uncompressed_data_offset );
+
+			goto on_error;
+		}
+		compressed_data_offset   += chunk_compressed_size;
+		uncompressed_data_offset += chunk_uncompressed_size;
+	}
+	if( lznt1_compressor_free(
+	     &compressor,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+		 "%s: unable to free compressor.",
+		 function );
+
+		goto on_error;
+	}
+	*compressed_data_size = compressed_data_offset;
+
+	return( 1 );
+
+on_error:
+	if( compressor != NULL )
+	{
+		lznt1_compressor_free(
+		 &compressor,
+		 NULL );
+	}
+	return( -1 );
+}
+
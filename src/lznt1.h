@@ -0,0 +1,104 @@
+/*
+ * LZNT1 compression functions
+ *
+ * Copyright (C) 2008-2019, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This software is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This software is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this software.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#if !defined( _LZNT1_H )
+#define _LZNT1_H
+
+#include <common.h>
+#include <types.h>
+
+#include "assorted_libcerror.h"
+
+#if defined( __cplusplus )
+extern "C" {
+#endif
+
+/* The size of the uncompressed data of a chunk
+ */
+#define LZNT1_CHUNK_SIZE				4096
+
+/* The size of the chunk header
+ */
+#define LZNT1_CHUNK_HEADER_SIZE				2
+
+/* The maximum size of a compressed chunk, which is the size of a chunk
+ * stored uncompressed, including the chunk header
+ */
+#define LZNT1_MAXIMUM_COMPRESSED_CHUNK_SIZE		( LZNT1_CHUNK_HEADER_SIZE + LZNT1_CHUNK_SIZE )
+
+/* The number of bits of the string hash used by the compressor
+ */
+#define LZNT1_COMPRESSOR_HASH_NUMBER_OF_BITS		12
+
+/* The maximum number of hash chain entries the compressor compares per position
+ */
+#define LZNT1_COMPRESSOR_MAXIMUM_CHAIN_LENGTH		32
+
+typedef struct lznt1_compressor lznt1_compressor_t;
+
+struct lznt1_compressor
+{
+	/* The hash table
+	 * an entry contains the offset + 1 of the last string in the chunk with the hash or 0 if not set
+	 */
+	uint16_t hash_table[ 1 << LZNT1_COMPRESSOR_HASH_NUMBER_OF_BITS ];
+
+	/* The hash chain
+	 * an entry contains the offset + 1 of the previous string in the chunk with the same hash
+	 * as the string at the offset or 0 if not set
+	 */
+	uint16_t hash_chain[ LZNT1_CHUNK_SIZE ];
+};
+
+int lznt1_compressor_initialize(
+     lznt1_compressor_t **compressor,
+     libcerror_error_t **error );
+
+int lznt1_compressor_free(
+     lznt1_compressor_t **compressor,
+     libcerror_error_t **error );
+
+int lznt1_compressor_compress_chunk(
+     lznt1_compressor_t *compressor,
+     const uint8_t *uncompressed_data,
+     size_t uncompressed_data_size,
+     uint8_t *compressed_data,
+     size_t *compressed_data_size,
+     libcerror_error_t **error );
+
+int lznt1_get_maximum_compressed_data_size(
+     size_t uncompressed_data_size,
+     size_t *compressed_data_size,
+     libcerror_error_t **error );
+
+int lznt1_compress(
+     const uint8_t *uncompressed_data,
+     size_t uncompressed_data_size,
+     uint8_t *compressed_data,
+     size_t *compressed_data_size,
+     libcerror_error_t **error );
+
+#if defined( __cplusplus )
+}
+#endif
+
+#endif /* !defined( _LZNT1_H ) */
+
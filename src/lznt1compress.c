@@ -0,0 +1,1052 @@
+/*
+ * Compresses data using LZNT1 compression
+ *
+ * Copyright (C) 2008-2019, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This software is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This software is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this software.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <file_stream.h>
+#include <memory.h>
+#include <system_string.h>
+#include <types.h>
+
+#if defined( HAVE_STDLIB_H )
+#include <stdlib.h>
+#endif
+
+#include "assorted_getopt.h"
+#include "assorted_input_file.h"
+#include "assorted_libcerror.h"
+#include "assorted_libcfile.h"
+#include "assorted_libcnotify.h"
+#include "assorted_libcthreads.h"
+#include "assorted_output.h"
+#include "assorted_output_file.h"
+#include "assorted_worker_pool.h"
+#include "lznt1.h"
+
+/* The maximum number of threads
+ */
+#define LZNT1COMPRESS_MAXIMUM_NUMBER_OF_THREADS	64
+
+/* The number of ranges of chunks per thread
+ */
+#define LZNT1COMPRESS_RANGES_PER_THREAD		4
+
+/* Prints the executable usage information
+ */
+void usage_fprint(
+      FILE *stream )
+{
+	if( stream == NULL )
+	{
+		return;
+	}
+	fprintf( stream, "Use lznt1compress to compress data using LZNT1 compression.\n\n" );
+
+	fprintf( stream, "Usage: lznt1compress [ -D window ] [ -j threads ] [ -o offset ]\n"
+	                 "                     [ -s size ] [ -S format ] [ -t target ]\n"
+	                 "                     [ -hvV ] source\n\n" );
+
+	fprintf( stream, "\tsource: the source file\n\n" );
+
+	fprintf( stream, "\t-D:     limit the hexadecimal representation of the data to\n"
+	                 "\t        a window formatted as offset:size or offset relative\n"
+	                 "\t        to the start of the data (default is all data)\n" );
+	fprintf( stream, "\t-h:     shows this help\n" );
+	fprintf( stream, "\t-j:     number of threads (default is 1), the chunks of\n"
+	                 "\t        4096 bytes are compressed in parallel\n" );
+	fprintf( stream, "\t-o:     data offset (default is 0)\n" );
+	fprintf( stream, "\t-s:     size of data (default is the file size)\n" );
+	fprintf( stream, "\t-S:     print timing and throughput statistics of the open,\n"
+	                 "\t        read, compute and write phases and the peak memory\n"
+	                 "\t        size to stderr in the format: text or json\n" );
+	fprintf( stream, "\t-t:     specify the target file to write the output data,\n"
+	                 "\t        by default the data will be written to stdout in\n"
+	                 "\t        hexadecimal representation\n" );
+	fprintf( stream, "\t-v:     verbose output to stderr\n" );
+	fprintf( stream, "\t-V:     print version\n" );
+	fprintf( stream, "\n" );
+}
+
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+
+typedef struct lznt1compress_thread_range lznt1compress_thread_range_t;
+
+struct lznt1compress_thread_range
+{
+	/* The uncompressed data
+	 */
+	const uint8_t *uncompressed_data;
+
+	/* The uncompressed data size
+	 */
+	size_t uncompressed_data_size;
+
+	/* The chunk slots, which contain the maximum compressed chunk size for every chunk
+	 */
+	uint8_t *chunk_slots;
+
+	/* The compressed data sizes of the chunks, which include the chunk header
+	 */
+	size_t *compressed_chunk_sizes;
+
+	/* The index of the first chunk of the range
+	 */
+	int first_chunk_index;
+
+	/* The number of chunks of the range
+	 */
+	int number_of_chunks;
+
+	/* The result of the compression
+	 */
+	int result;
+};
+
+/* Compresses the chunks of a range, used as the task function of the worker pool
+ * Every chunk is compressed into its slot using a compressor of the range
+ * Returns 1 if successful or -1 on error
+ */
+int lznt1compress_thread_range_compress(
+     void *arguments,
+     uint8_t *worker_buffer,
+     size_t worker_buffer_size )
+{
+	lznt1_compressor_t *compressor             = NULL;
+	lznt1compress_thread_range_t *thread_range = NULL;
+	size_t uncompressed_data_offset            = 0;
+	size_t uncompressed_data_size              = 0;
+	int chunk_index                            = 0;
+	int last_chunk_index                       = 0;
+
+	( void ) worker_buffer;
+	( void ) worker_buffer_size;
+
+	if( arguments == NULL )
+	{
+		return( -1 );
+	}
+	thread_range = (lznt1compress_thread_range_t *) arguments;
+
+	thread_range->result = -1;
+
+	if( lznt1_compressor_initialize(
+	     &compressor,
+	     NULL ) != 1 )
+	{
+		return( -1 );
+	}
+	last_chunk_index = thread_range->first_chunk_index + thread_range->number_of_chunks;
+
+	for( chunk_index = thread_range->first_chunk_index;
+	     chunk_index < last_chunk_index;
+	     chunk_index++ )
+	{
+		uncompressed_data_offset = (size_t) chunk_index * LZNT1_CHUNK_SIZE;
+		uncompressed_data_size   = thread_range->uncompressed_data_size - uncompressed_data_offset;
+
+		if( uncompressed_data_size > LZNT1_CHUNK_SIZE )
+		{
+			uncompressed_data_size = LZNT1_CHUNK_SIZE;
+		}
+		thread_range->compressed_chunk_sizes[ chunk_index ] = LZNT1_MAXIMUM_COMPRESSED_CHUNK_SIZE;
+
+		if( lznt1_compressor_compress_chunk(
+		     compressor,
+		     &( thread_range->uncompressed_data[ uncompressed_data_offset ] ),
+		     uncompressed_data_size,
+		     &( thread_range->chunk_slots[ (size_t) chunk_index * LZNT1_MAXIMUM_COMPRESSED_CHUNK_SIZE ] ),
+		     &( thread_range->compressed_chunk_sizes[ chunk_index ] ),
+		     NULL ) != 1 )
+		{
+			break;
+		}
+	}
+	if( chunk_index == last_chunk_index )
+	{
+		thread_range->result = 1;
+	}
+	lznt1_compressor_free(
+	 &compressor,
+	 NULL );
+
+	return( thread_range->result );
+}
+
+/* Compresses data using LZNT1 compression using the worker pool
+ * The chunks are independent and are split into ranges of consecutive chunks,
+ * which are compressed in parallel into slots of the maximum compressed chunk size
+ * and concatenated afterwards
+ * Returns 1 if successful or -1 on error
+ */
+int lznt1compress_compress_parallel(
+     const uint8_t *uncompressed_data,
+     size_t uncompressed_data_size,
+     uint8_t *compressed_data,
+     size_t *compressed_data_size,
+     assorted_worker_pool_t *worker_pool,
+     libcerror_error_t **error )
+{
+	lznt1compress_thread_range_t *thread_ranges = NULL;
+	uint8_t *chunk_slots                        = NULL;
+	size_t *compressed_chunk_sizes              = NULL;
+	static char *function                       = "lznt1compress_compress_parallel";
+	size_t compressed_data_offset               = 0;
+	size_t number_of_chunks                     = 0;
+	int chunk_index                             = 0;
+	int first_chunk_index                       = 0;
+	int number_of_ranges                        = 0;
+	int range_index                             = 0;
+	int result                                  = 1;
+
+	if( uncompressed_data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid uncompressed data.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( uncompressed_data_size == 0 )
+	 || ( uncompressed_data_size > (size_t) SSIZE_MAX ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid uncompressed data size value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( compressed_data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid compressed data.",
+		 function );
+
+		return( -1 );
+	}
+	if( compressed_data_size == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid compressed data size.",
+		 function );
+
+		return( -1 );
+	}
+	if( worker_pool == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid worker pool.",
+		 function );
+
+		return( -1 );
+	}
+	number_of_chunks = uncompressed_data_size / LZNT1_CHUNK_SIZE;
+
+	if( ( uncompressed_data_size % LZNT1_CHUNK_SIZE ) != 0 )
+	{
+		number_of_chunks++;
+	}
+	if( ( number_of_chunks > (size_t) INT_MAX )
+	 || ( number_of_chunks > ( (size_t) SSIZE_MAX / LZNT1_MAXIMUM_COMPRESSED_CHUNK_SIZE ) ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid number of chunks value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	/* Do not use more ranges than chunks
+	 */
+	number_of_ranges = worker_pool->number_of_workers * LZNT1COMPRESS_RANGES_PER_THREAD;
+
+	if( (int) number_of_chunks < number_of_ranges )
+	{
+		number_of_ranges = (int) number_of_chunks;
+	}
+	if( number_of_ranges <= 1 )
+	{
+		return( lznt1_compress(
+		         uncompressed_data,
+		         uncompressed_data_size,
+		         compressed_data,
+		         compressed_data_size,
+		         error ) );
+	}
+	compressed_chunk_sizes = (size_t *) memory_allocate(
+	                                     sizeof( size_t ) * number_of_chunks );
+
+	if( compressed_chunk_sizes == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create compressed chunk sizes.",
+		 function );
+
+		goto on_error;
+	}
+	chunk_slots = (uint8_t *) memory_allocate(
+	                           sizeof( uint8_t ) * number_of_chunks * LZNT1_MAXIMUM_COMPRESSED_CHUNK_SIZE );
+
+	if( chunk_slots == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create chunk slots.",
+		 function );
+
+		goto on_error;
+	}
+	thread_ranges = (lznt1compress_thread_range_t *) memory_allocate(
+	                                                  sizeof( lznt1compress_thread_range_t ) * number_of_ranges );
+
+	if( thread_ranges == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create thread ranges.",
+		 function );
+
+		goto on_error;
+	}
+	/* There are multiple ranges per worker so that the work is evenly
+	 * distributed even if some parts of the data compress slower than others
+	 */
+	for( range_index = 0;
+	     range_index < number_of_ranges;
+	     range_index++ )
+	{
+		thread_ranges[ range_index ].uncompressed_data      = uncompressed_data;
+		thread_ranges[ range_index ].uncompressed_data_size = uncompressed_data_size;
+		thread_ranges[ range_index ].chunk_slots            = chunk_slots;
+		thread_ranges[ range_index ].compressed_chunk_sizes = compressed_chunk_sizes;
+		thread_ranges[ range_index ].first_chunk_index      = first_chunk_index;
+		thread_ranges[ range_index ].number_of_chunks       = ( (int) number_of_chunks / number_of_ranges )
+		                                                    + (int) ( range_index < ( (int) number_of_chunks % number_of_ranges ) );
+		thread_ranges[ range_index ].result                 = 0;
+
+		first_chunk_index += thread_ranges[ range_index ].number_of_chunks;
+	}
+	for( range_index = 0;
+	     range_index < number_of_ranges;
+	     range_index++ )
+	{
+		if( assorted_worker_pool_push(
+		     worker_pool,
+		     lznt1compress_thread_range_compress,
+		     (void *) &( thread_ranges[ range_index ] ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+			 "%s: unable to push range: %d onto worker pool.",
+			 function,
+			 range_index );
+
+			result = -1;
+
+			break;
+		}
+	}
+	/* Wait for the ranges that were pushed, also on error, since they
+	 * reference the thread ranges
+	 */
+	if( assorted_worker_pool_wait(
+	     worker_pool,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to wait for worker pool.",
+		 function );
+
+		result = -1;
+	}
+	if( result != 1 )
+	{
+		goto on_error;
+	}
+	for( range_index = 0;
+	     range_index < number_of_ranges;
+	     range_index++ )
+	{
+		if( thread_ranges[ range_index ].result != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_COMPRESSION,
+			 LIBCERROR_COMPRESSION_ERROR_COMPRESS_FAILED,
+			 "%s: unable to compress range: %d.",
+			 function,
+			 range_index );
+
+			goto on_error;
+		}
+	}
+	/* Concatenate the compressed chunks
+	 */
+	for( chunk_index = 0;
+	     chunk_index < (int) number_of_chunks;
+	     chunk_index++ )
+	{
+		if( compressed_chunk_sizes[ chunk_index ] > ( *compressed_data_size - compressed_data_offset ) )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+			 LIBCERROR_ARGUMENT_ERROR_VALUE_TOO_SMALL,
+			 "%s: invalid compressed data size value too small.",
+			 function );
+
+			goto on_error;
+		}
+		if( memory_copy(
+		     &( compressed_data[ compressed_data_offset ] ),
+		     &( chunk_slots[ (size_t) chunk_index * LZNT1_MAXIMUM_COMPRESSED_CHUNK_SIZE ] ),
+		     compressed_chunk_sizes[ chunk_index ] ) == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+			 "%s: unable to copy chunk: %d.",
+			 function,
+			 chunk_index );
+
+			goto on_error;
+		}
+		compressed_data_offset += compressed_chunk_sizes[ chunk_index ];
+	}
+	*compressed_data_size = compressed_data_offset;
+
+	memory_free(
+	 thread_ranges );
+	memory_free(
+	 chunk_slots );
+	memory_free(
+	 compressed_chunk_sizes );
+
+	return( 1 );
+
+on_error:
+	if( thread_ranges != NULL )
+	{
+		memory_free(
+		 thread_ranges );
+	}
+	if( chunk_slots != NULL )
+	{
+		memory_free(
+		 chunk_slots );
+	}
+	if( compressed_chunk_sizes != NULL )
+	{
+		memory_free(
+		 compressed_chunk_sizes );
+	}
+	return( -1 );
+}
+
+#endif /* defined( HAVE_MULTI_THREAD_SUPPORT ) */
+
+/* The main program
+ */
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+int wmain( int argc, wchar_t * const argv[] )
+#else
+int main( int argc, char * const argv[] )
+#endif
+{
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+	assorted_worker_pool_t *worker_pool          = NULL;
+#endif
+	libcerror_error_t *error                     = NULL;
+	assorted_input_file_t *source_file           = NULL;
+	assorted_output_file_t *destination_file     = NULL;
+	system_character_t *option_hexdump_window    = NULL;
+	system_character_t *option_statistics_format = NULL;
+	system_character_t *option_target_path       = NULL;
+	system_character_t *source                   = NULL;
+	uint8_t *buffer                              = NULL;
+	uint8_t *compressed_data                     = NULL;
+	char *program                                = "lznt1compress";
+	system_integer_t option                      = 0;
+	size64_t source_size                         = 0;
+	size_t compressed_data_size                  = 0;
+	ssize_t read_count                           = 0;
+	ssize_t write_count                          = 0;
+	off_t source_offset                          = 0;
+	int is_mapped                                = 0;
+	int number_of_threads                        = 1;
+	int result                                   = 0;
+	int verbose                                  = 0;
+
+	assorted_output_version_fprint(
+	 stdout,
+	 program );
+
+	while( ( option = assorted_getopt(
+	                   argc,
+	                   argv,
+	                   _SYSTEM_STRING( "D:hj:o:s:S:t:vV" ) ) ) != (system_integer_t) -1 )
+	{
+		switch( option )
+		{
+			case (system_integer_t) '?':
+			default:
+				fprintf(
+				 stderr,
+				 "Invalid argument: %" PRIs_SYSTEM "\n",
+				 argv[ optind ] );
+
+				usage_fprint(
+				 stdout );
+
+				return( EXIT_FAILURE );
+
+			case (system_integer_t) 'D':
+				option_hexdump_window = optarg;
+
+				break;
+
+			case (system_integer_t) 'h':
+				usage_fprint(
+				 stdout );
+
+				return( EXIT_SUCCESS );
+
+			case (system_integer_t) 'j':
+				number_of_threads = (int) atol( optarg );
+
+				break;
+
+			case (system_integer_t) 'o':
+				source_offset = atol( optarg );
+
+				break;
+
+			case (system_integer_t) 's':
+				source_size = atol( optarg );
+
+				break;
+
+			case (system_integer_t) 'S':
+				option_statistics_format = optarg;
+
+				break;
+
+			case (system_integer_t) 't':
+				option_target_path = optarg;
+
+				break;
+
+			case (system_integer_t) 'v':
+				verbose = 1;
+
+				break;
+
+			case (system_integer_t) 'V':
+				assorted_output_copyright_fprint(
+				 stdout );
+
+				return( EXIT_SUCCESS );
+		}
+	}
+	if( optind == argc )
+	{
+		fprintf(
+		 stderr,
+		 "Missing source file.\n" );
+
+		usage_fprint(
+		 stdout );
+
+		return( EXIT_FAILURE );
+	}
+	source = argv[ optind ];
+
+	if( ( number_of_threads <= 0 )
+	 || ( number_of_threads > LZNT1COMPRESS_MAXIMUM_NUMBER_OF_THREADS ) )
+	{
+		fprintf(
+		 stderr,
+		 "Unsupported number of threads, value must be between 1 and %d.\n",
+		 LZNT1COMPRESS_MAXIMUM_NUMBER_OF_THREADS );
+
+		return( EXIT_FAILURE );
+	}
+#if !defined( HAVE_MULTI_THREAD_SUPPORT )
+	if( number_of_threads > 1 )
+	{
+		fprintf(
+		 stderr,
+		 "Multi-threading not supported, using a single thread.\n" );
+
+		number_of_threads = 1;
+	}
+#endif
+	libcnotify_stream_set(
+	 stderr,
+	 NULL );
+	libcnotify_verbose_set(
+	 verbose );
+
+	if( assorted_output_statistics_initialize(
+	     option_statistics_format,
+	     &error ) != 1 )
+	{
+		fprintf(
+		 stderr,
+		 "Unable to initialize statistics.\n" );
+
+		goto on_error;
+	}
+	if( option_hexdump_window != NULL )
+	{
+		if( assorted_output_hexdump_window_set(
+		     option_hexdump_window,
+		     &error ) != 1 )
+		{
+			fprintf(
+			 stderr,
+			 "Unsupported hexdump window.\n" );
+
+			goto on_error;
+		}
+	}
+	/* Open the source file
+	 */
+	if( assorted_input_file_initialize(
+	     &source_file,
+	     &error ) != 1 )
+	{
+		fprintf(
+		 stderr,
+		 "Unable to create source file.\n" );
+
+		goto on_error;
+	}
+	if( assorted_input_file_open(
+	     source_file,
+	     source,
+	     &error ) != 1 )
+	{
+		fprintf(
+		 stderr,
+		 "Unable to open source file.\n" );
+
+		goto on_error;
+	}
+	if( source_size == 0 )
+	{
+		if( assorted_input_file_get_size(
+		     source_file,
+		     &source_size,
+		     &error ) == -1 )
+		{
+			fprintf(
+			 stderr,
+			 "Unable to determine size of source file.\n" );
+
+			goto on_error;
+		}
+		if( source_size <= (size64_t) source_offset )
+		{
+			fprintf(
+			 stderr,
+			 "Invalid source size value is less equal than source offset.\n" );
+
+			goto on_error;
+		}
+		source_size -= source_offset;
+	}
+	if( source_size == 0 )
+	{
+		fprintf(
+		 stderr,
+		 "Invalid source size value is zero.\n" );
+
+		goto on_error;
+	}
+	if( source_size > (size_t) SSIZE_MAX )
+	{
+		fprintf(
+		 stderr,
+		 "Invalid source size value exceeds maximum.\n" );
+
+		goto on_error;
+	}
+	/* Position the source file at the right offset
+	 */
+	if( assorted_input_file_seek_offset(
+	     source_file,
+	     source_offset,
+	     SEEK_SET,
+	     &error ) == -1 )
+	{
+		fprintf(
+		 stderr,
+		 "Unable to seek offset in source file.\n" );
+
+		goto on_error;
+	}
+	fprintf(
+	 stdout,
+	 "Starting LZNT1 compression of: %" PRIs_SYSTEM " at offset: %" PRIjd " (0x%08" PRIjx ").\n",
+	 source,
+	 source_offset,
+	 source_offset );
+
+	read_count = assorted_input_file_read_data(
+	              source_file,
+	              &buffer,
+	              (size_t) source_size,
+	              &error );
+
+	if( read_count != (ssize_t) source_size )
+	{
+		fprintf(
+		 stderr,
+		 "Unable to read from source file.\n" );
+
+		goto on_error;
+	}
+	if( lznt1_get_maximum_compressed_data_size(
+	     (size_t) source_size,
+	     &compressed_data_size,
+	     &error ) != 1 )
+	{
+		fprintf(
+		 stderr,
+		 "Unable to determine maximum compressed data size.\n" );
+
+		goto on_error;
+	}
+	/* Open the destination file, if it can be mapped the data is compressed
+	 * directly into the destination file instead of a compressed data buffer
+	 * The mapped destination file is truncated to the compressed data size when closed
+	 */
+	if( option_target_path != NULL )
+	{
+		if( assorted_output_file_initialize(
+		     &destination_file,
+		     &error ) != 1 )
+		{
+			fprintf(
+			 stderr,
+			 "Unable to create destination file.\n" );
+
+			goto on_error;
+		}
+		if( assorted_output_file_open(
+		     destination_file,
+		     option_target_path,
+		     compressed_data_size,
+		     &error ) != 1 )
+		{
+			fprintf(
+			 stderr,
+			 "Unable to open destination file.\n" );
+
+			goto on_error;
+		}
+		is_mapped = assorted_output_file_get_mapped_data(
+		             destination_file,
+		             &compressed_data,
+		             &compressed_data_size,
+		             &error );
+
+		if( is_mapped == -1 )
+		{
+			fprintf(
+			 stderr,
+			 "Unable to retrieve mapped destination data.\n" );
+
+			goto on_error;
+		}
+	}
+	if( is_mapped == 0 )
+	{
+		compressed_data = (uint8_t *) memory_allocate(
+		                               sizeof( uint8_t ) * compressed_data_size );
+
+		if( compressed_data == NULL )
+		{
+			fprintf(
+			 stderr,
+			 "Unable to create compressed data buffer.\n" );
+
+			goto on_error;
+		}
+	}
+	/* Compress the data
+	 */
+	if( option_target_path == NULL )
+	{
+		fprintf(
+		 stderr,
+		 "Uncompressed data:\n" );
+
+		if( assorted_output_data_fprint(
+		     stderr,
+		     buffer,
+		     source_size,
+		     0,
+		     &error ) != 1 )
+		{
+			fprintf(
+			 stderr,
+			 "Unable to print uncompressed data.\n" );
+
+			goto on_error;
+		}
+	}
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+	if( number_of_threads > 1 )
+	{
+		if( assorted_worker_pool_initialize(
+		     &worker_pool,
+		     number_of_threads,
+		     0,
+		     ASSORTED_WORKER_POOL_FLAG_CPU_AFFINITY,
+		     &error ) != 1 )
+		{
+			fprintf(
+			 stderr,
+			 "Unable to create worker pool.\n" );
+
+			goto on_error;
+		}
+		result = lznt1compress_compress_parallel(
+		          buffer,
+		          (size_t) source_size,
+		          compressed_data,
+		          &compressed_data_size,
+		          worker_pool,
+		          &error );
+	}
+	else
+#endif
+	{
+		result = lznt1_compress(
+		          buffer,
+		          (size_t) source_size,
+		          compressed_data,
+		          &compressed_data_size,
+		          &error );
+	}
+	if( result != 1 )
+	{
+		fprintf(
+		 stderr,
+		 "Unable to compress data.\n" );
+
+		goto on_error;
+	}
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+	if( worker_pool != NULL )
+	{
+		if( assorted_worker_pool_free(
+		     &worker_pool,
+		     &error ) != 1 )
+		{
+			fprintf(
+			 stderr,
+			 "Unable to free worker pool.\n" );
+
+			goto on_error;
+		}
+	}
+#endif
+	if( option_target_path == NULL )
+	{
+		fprintf(
+		 stderr,
+		 "Compressed data:\n" );
+
+		if( assorted_output_data_fprint(
+		     stderr,
+		     compressed_data,
+		     compressed_data_size,
+		     0,
+		     &error ) != 1 )
+		{
+			fprintf(
+			 stderr,
+			 "Unable to print compressed data.\n" );
+
+			goto on_error;
+		}
+	}
+	else
+	{
+		write_count = assorted_output_file_write_data(
+			       destination_file,
+			       compressed_data,
+			       compressed_data_size,
+			       &error );
+
+		if( write_count != (ssize_t) compressed_data_size )
+		{
+			fprintf(
+			 stderr,
+			 "Unable to write to destination file.\n" );
+
+			goto on_error;
+		}
+		if( assorted_output_file_close(
+		     destination_file,
+		     &error ) != 0 )
+		{
+			fprintf(
+			 stderr,
+			 "Unable to close destination file.\n" );
+
+			goto on_error;
+		}
+		if( assorted_output_file_free(
+		     &destination_file,
+		     &error ) != 1 )
+		{
+			fprintf(
+			 stderr,
+			 "Unable to free destination file.\n" );
+
+			goto on_error;
+		}
+	}
+	/* Clean up
+	 */
+	if( assorted_input_file_close(
+	     source_file,
+	     &error ) != 0 )
+	{
+		fprintf(
+		 stderr,
+		 "Unable to close source file.\n" );
+
+		goto on_error;
+	}
+	if( assorted_input_file_free(
+	     &source_file,
+	     &error ) != 1 )
+	{
+		fprintf(
+		 stderr,
+		 "Unable to free source file.\n" );
+
+		goto on_error;
+	}
+	if( is_mapped == 0 )
+	{
+		memory_free(
+		 compressed_data );
+	}
+	compressed_data = NULL;
+
+	fprintf(
+	 stdout,
+	 "LZNT1 compression:\tSUCCESS\n" );
+
+	assorted_output_statistics_fprint(
+	 stderr,
+	 program,
+	 1,
+	 NULL );
+	assorted_output_statistics_free(
+	 NULL );
+
+	return( EXIT_SUCCESS );
+
+on_error:
+	if( error != NULL )
+	{
+		libcnotify_print_error_backtrace(
+		 error );
+		libcerror_error_free(
+		 &error );
+	}
+	assorted_output_statistics_fprint(
+	 stderr,
+	 program,
+	 -1,
+	 NULL );
+	assorted_output_statistics_free(
+	 NULL );
+
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+	if( worker_pool != NULL )
+	{
+		assorted_worker_pool_free(
+		 &worker_pool,
+		 NULL );
+	}
+#endif
+	if( destination_file != NULL )
+	{
+		assorted_output_file_free(
+		 &destination_file,
+		 NULL );
+	}
+	if( ( compressed_data != NULL )
+	 && ( is_mapped == 0 ) )
+	{
+		memory_free(
+		 compressed_data );
+	}
+	if( source_file != NULL )
+	{
+		assorted_input_file_free(
+		 &source_file,
+		 NULL );
+	}
+	fprintf(
+	 stdout,
+	 "LZNT1 compression:\tFAILURE\n" );
+
+	return( EXIT_FAILURE );
+}
+
@@ -20,6 +20,7 @@
  */
 
 #include <common.h>
+#include <byte_stream.h>
 #include <file_stream.h>
 #include <memory.h>
 #include <system_string.h>
@@ -30,11 +31,22 @@
 #endif
 
 #include "assorted_getopt.h"
+#include "assorted_input_file.h"
 #include "assorted_libcerror.h"
 #include "assorted_libcfile.h"
 #include "assorted_libcnotify.h"
+#include "assorted_libcthreads.h"
 #include "assorted_libfwnt.h"
 #include "assorted_output.h"
+#include "assorted_output_file.h"
+
+/* The size of the uncompressed data of a LZNT1 chunk
+ */
+#define LZNT1DECOMPRESS_CHUNK_SIZE		4096
+
+/* The maximum number of threads
+ */
+#define LZNT1DECOMPRESS_MAXIMUM_NUMBER_OF_THREADS	64
 
 #if defined( WINAPI )
 
@@ -99,10 +111,12 @@ void usage_fprint(
 	fprintf( stream, "Use lznt1decompress to decompress LZNT1 compressed data.\n\n" );
 
 #if defined( WINAPI )
-	fprintf( stream, "Usage: lznt1decompress [ -d size ] [ -o offset ] [ -s size ]\n"
+	fprintf( stream, "Usage: lznt1decompress [ -d size ] [ -D window ] [ -j threads ]\n"
+	                 "                       [ -o offset ] [ -s size ] [ -S format ]\n"
 	                 "                       [ -t target ] [ -12hvV ] source\n\n" );
 #else
-	fprintf( stream, "Usage: lznt1decompress [ -d size ] [ -o offset ] [ -s size ]\n"
+	fprintf( stream, "Usage: lznt1decompress [ -d size ] [ -D window ] [ -j threads ]\n"
+	                 "                       [ -o offset ] [ -s size ] [ -S format ]\n"
 	                 "                       [ -t target ] [ -1hvV ] source\n\n" );
 #endif
 
@@ -112,10 +126,21 @@ void usage_fprint(
 #if defined( WINAPI )
 	fprintf( stream, "\t-2:     use the WINAPI LZNT1 decompression method\n" );
 #endif
-	fprintf( stream, "\t-d:     size of the decompressed data (default is 65536).\n" );
+	fprintf( stream, "\t-d:     size of the decompressed data (default is to resize\n"
+	                 "\t        the buffer while decompressing, 65536 for the WINAPI\n"
+	                 "\t        method or 4096 per chunk when multiple threads are used).\n" );
+	fprintf( stream, "\t-D:     limit the hexadecimal representation of the data to\n"
+	                 "\t        a window formatted as offset:size or offset relative\n"
+	                 "\t        to the start of the data (default is all data)\n" );
 	fprintf( stream, "\t-h:     shows this help\n" );
+	fprintf( stream, "\t-j:     number of threads (default is 1), the chunks are\n"
+	                 "\t        indexed and decompressed in parallel by the LZNT1\n"
+	                 "\t        decompression method\n" );
 	fprintf( stream, "\t-o:     data offset (default is 0)\n" );
 	fprintf( stream, "\t-s:     size of data (default is the file size)\n" );
+	fprintf( stream, "\t-S:     print timing and throughput statistics of the open,\n"
+	                 "\t        read, compute and write phases and the peak memory\n"
+	                 "\t        size to stderr in the format: text or json\n" );
 	fprintf( stream, "\t-t:     specify the target file to write the output data,\n"
 	                 "\t        by default the data will be written to stdout in\n"
 	                 "\t        hexadecimal representation\n" );
@@ -124,6 +149,740 @@ void usage_fprint(
 	fprintf( stream, "\n" );
 }
 
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+
+typedef struct lznt1decompress_chunk lznt1decompress_chunk_t;
+
+struct lznt1decompress_chunk
+{
+	/* The offset of the chunk in the compressed data, which includes the chunk header
+	 */
+	size_t compressed_data_offset;
+
+	/* The compressed data size of the chunk, which includes the chunk header
+	 */
+	size_t compressed_data_size;
+
+	/* The offset of the chunk in the uncompressed data
+	 */
+	size_t uncompressed_data_offset;
+
+	/* The uncompressed data size of the chunk
+	 */
+	size_t uncompressed_data_size;
+
+	/* The result of the decompression
+	 */
+	int result;
+};
+
+typedef struct lznt1decompress_thread_range lznt1decompress_thread_range_t;
+
+struct lznt1decompress_thread_range
+{
+	/* The compressed data
+	 */
+	const uint8_t *compressed_data;
+
+	/* The uncompressed data
+	 */
+	uint8_t *uncompressed_data;
+
+	/* The chunks
+	 */
+	lznt1decompress_chunk_t *chunks;
+
+	/* The number of chunks
+	 */
+	int number_of_chunks;
+
+	/* The index of the first chunk decompressed by the thread
+	 */
+	int first_chunk_index;
+
+	/* The number of chunks between the chunks decompressed by the thread
+	 */
+	int chunk_index_step;
+};
+
+/* Determines the chunks in LZNT1 compressed data
+ * Every chunk starts with a 16-bit header that contains the size of the chunk,
+ * the chunks end at the end of the data or at a chunk header of 0
+ * Returns 1 if successful or -1 on error
+ */
+int lznt1decompress_get_chunks(
+     const uint8_t *compressed_data,
+     size_t compressed_data_size,
+     lznt1decompress_chunk_t **chunks,
+     int *number_of_chunks,
+     libcerror_error_t **error )
+{
+	lznt1decompress_chunk_t *safe_chunks = NULL;
+	static char *function                = "lznt1decompress_get_chunks";
+	size_t chunk_size                    = 0;
+	size_t compressed_data_offset        = 0;
+	uint16_t chunk_header                = 0;
+	int chunk_index                      = 0;
+	int safe_number_of_chunks            = 0;
+
+	if( compressed_data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid compressed data.",
+		 function );
+
+		return( -1 );
+	}
+	if( chunks == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid chunks.",
+		 function );
+
+		return( -1 );
+	}
+	if( number_of_chunks == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid number of chunks.",
+		 function );
+
+		return( -1 );
+	}
+	/* The chunks are counted first so that the chunks array is allocated only once
+	 */
+	while( ( compressed_data_offset + 2 ) <= compressed_data_size )
+	{
+		byte_stream_copy_to_uint16_little_endian(
+		 &( compressed_data[ compressed_data_offset ] ),
+		 chunk_header );
+
+		if( chunk_header == 0 )
+		{
+			break;
+		}
+		chunk_size = (size_t) ( chunk_header & 0x0fff ) + 3;
+
+		if( chunk_size > ( compressed_data_size - compressed_data_offset ) )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+			 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+			 "%s: invalid chunk: %d size value out of bounds.",
+			 function,
+			 safe_number_of_chunks );
+
+			goto on_error;
+		}
+		if( safe_number_of_chunks == INT_MAX )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_VALUE_EXCEEDS_MAXIMUM,
+			 "%s: invalid number of chunks value exceeds maximum.",
+			 function );
+
+			goto on_error;
+		}
+		compressed_data_offset += chunk_size;
+
+		safe_number_of_chunks++;
+	}
+	if( safe_number_of_chunks > 0 )
+	{
+		safe_chunks = (lznt1decompress_chunk_t *) memory_allocate(
+		                                           sizeof( lznt1decompress_chunk_t ) * safe_number_of_chunks );
+
+		if( safe_chunks == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+			 "%s: unable to create chunks.",
+			 function );
+
+			goto on_error;
+		}
+		compressed_data_offset = 0;
+
+		for( chunk_index = 0;
+		     chunk_index < safe_number_of_chunks;
+		     chunk_index++ )
+		{
+			byte_stream_copy_to_uint16_little_endian(
+			 &( compressed_data[ compressed_data_offset ] ),
+			 chunk_header );
+
+			chunk_size = (size_t) ( chunk_header & 0x0fff ) + 3;
+
+			safe_chunks[ chunk_index ].compressed_data_offset   = compressed_data_offset;
+			safe_chunks[ chunk_index ].compressed_data_size     = chunk_size;
+			safe_chunks[ chunk_index ].uncompressed_data_offset = (size_t) chunk_index * LZNT1DECOMPRESS_CHUNK_SIZE;
+			safe_chunks[ chunk_index ].uncompressed_data_size   = 0;
+			safe_chunks[ chunk_index ].result                   = 0;
+
+			compressed_data_offset += chunk_size;
+		}
+	}
+	*chunks           = safe_chunks;
+	*number_of_chunks = safe_number_of_chunks;
+
+	return( 1 );
+
+on_error:
+	if( safe_chunks != NULL )
+	{
+		memory_free(
+		 safe_chunks );
+	}
+	return( -1 );
+}
+
+/* Decompresses the chunks of a range, used as the callback function of a thread
+ * The thread decompresses every chunk_index_step chunk starting with first_chunk_index
+ * Returns 1 if successful or -1 on error
+ */
+int lznt1decompress_thread_range_decompress(
+     void *arguments )
+{
+	lznt1decompress_chunk_t *chunk               = NULL;
+	lznt1decompress_thread_range_t *thread_range = NULL;
+	int chunk_index                              = 0;
+	int result                                   = 1;
+
+	if( arguments == NULL )
+	{
+		return( -1 );
+	}
+	thread_range = (lznt1decompress_thread_range_t *) arguments;
+
+	for( chunk_index = thread_range->first_chunk_index;
+	     chunk_index < thread_range->number_of_chunks;
+	     chunk_index += thread_range->chunk_index_step )
+	{
+		chunk = &( thread_range->chunks[ chunk_index ] );
+
+		chunk->result = libfwnt_lznt1_decompress(
+		                 &( thread_range->compressed_data[ chunk->compressed_data_offset ] ),
+		                 chunk->compressed_data_size,
+		                 &( thread_range->uncompressed_data[ chunk->uncompressed_data_offset ] ),
+		                 &( chunk->uncompressed_data_size ),
+		                 NULL );
+
+		if( chunk->result != 1 )
+		{
+			result = -1;
+		}
+	}
+	return( result );
+}
+
+/* Decompresses LZNT1 compressed data using multiple threads
+ * The chunks are decompressed in parallel directly into the uncompressed data
+ * at a multiple of 4096 bytes, which is their final offset unless a chunk other
+ * than the last one decompresses to less than 4096 bytes
+ * Returns 1 if successful or -1 on error
+ */
+int lznt1decompress_decompress_parallel(
+     const uint8_t *compressed_data,
+     lznt1decompress_chunk_t *chunks,
+     int number_of_chunks,
+     uint8_t *uncompressed_data,
+     size_t *uncompressed_data_size,
+     int number_of_threads,
+     libcerror_error_t **error )
+{
+	lznt1decompress_thread_range_t *thread_ranges = NULL;
+	libcthreads_thread_t **threads                = NULL;
+	static char *function                         = "lznt1decompress_decompress_parallel";
+	size_t remaining_uncompressed_data_size       = 0;
+	size_t safe_uncompressed_data_size            = 0;
+	size_t uncompressed_data_offset               = 0;
+	int chunk_index                               = 0;
+	int number_of_ranges                          = 0;
+	int range_index                               = 0;
+	int result                                    = 1;
+
+	if( compressed_data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid compressed data.",
+		 function );
+
+		return( -1 );
+	}
+	if( chunks == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid chunks.",
+		 function );
+
+		return( -1 );
+	}
+	if( number_of_chunks <= 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_ZERO_OR_LESS,
+		 "%s: invalid number of chunks value zero or less.",
+		 function );
+
+		return( -1 );
+	}
+	if( uncompressed_data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid uncompressed data.",
+		 function );
+
+		return( -1 );
+	}
+	if( uncompressed_data_size == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid uncompressed data size.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( number_of_threads <= 0 )
+	 || ( number_of_threads > LZNT1DECOMPRESS_MAXIMUM_NUMBER_OF_THREADS ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid number of threads value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	safe_uncompressed_data_size = *uncompressed_data_size;
+
+	/* Every chunk is given the space of 4096 bytes, except for the last chunk
+	 * which is given the remainder of the uncompressed data, if any
+	 */
+	if( chunks[ number_of_chunks - 1 ].uncompressed_data_offset >= safe_uncompressed_data_size )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_TOO_SMALL,
+		 "%s: invalid uncompressed data size value too small.",
+		 function );
+
+		return( -1 );
+	}
+	for( chunk_index = 0;
+	     chunk_index < ( number_of_chunks - 1 );
+	     chunk_index++ )
+	{
+		chunks[ chunk_index ].uncompressed_data_size = LZNT1DECOMPRESS_CHUNK_SIZE;
+		chunks[ chunk_index ].result                 = 0;
+	}
+	chunks[ number_of_chunks - 1 ].uncompressed_data_size = safe_uncompressed_data_size - chunks[ number_of_chunks - 1 ].uncompressed_data_offset;
+	chunks[ number_of_chunks - 1 ].result                 = 0;
+
+	/* Do not use more threads than chunks
+	 */
+	number_of_ranges = number_of_threads;
+
+	if( number_of_chunks < number_of_ranges )
+	{
+		number_of_ranges = number_of_chunks;
+	}
+	thread_ranges = (lznt1decompress_thread_range_t *) memory_allocate(
+	                                                    sizeof( lznt1decompress_thread_range_t ) * number_of_ranges );
+
+	if( thread_ranges == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create thread ranges.",
+		 function );
+
+		goto on_error;
+	}
+	threads = (libcthreads_thread_t **) memory_allocate(
+	                                     sizeof( libcthreads_thread_t * ) * number_of_ranges );
+
+	if( threads == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create threads.",
+		 function );
+
+		goto on_error;
+	}
+	if( memory_set(
+	     threads,
+	     0,
+	     sizeof( libcthreads_thread_t * ) * number_of_ranges ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear threads.",
+		 function );
+
+		goto on_error;
+	}
+	/* The chunks are interleaved over the threads so that the work is evenly
+	 * distributed even if some parts of the data decompress slower than others
+	 */
+	for( range_index = 0;
+	     range_index < number_of_ranges;
+	     range_index++ )
+	{
+		thread_ranges[ range_index ].compressed_data   = compressed_data;
+		thread_ranges[ range_index ].uncompressed_data = uncompressed_data;
+		thread_ranges[ range_index ].chunks            = chunks;
+		thread_ranges[ range_index ].number_of_chunks  = number_of_chunks;
+		thread_ranges[ range_index ].first_chunk_index = range_index;
+		thread_ranges[ range_index ].chunk_index_step  = number_of_ranges;
+	}
+	for( range_index = 0;
+	     range_index < ( number_of_ranges - 1 );
+	     range_index++ )
+	{
+		if( libcthreads_thread_create(
+		     &( threads[ range_index ] ),
+		     NULL,
+		     lznt1decompress_thread_range_decompress,
+		     (void *) &( thread_ranges[ range_index ] ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+			 "%s: unable to create thread: %d.",
+			 function,
+			 range_index );
+
+			result = -1;
+
+			break;
+		}
+	}
+	if( result == 1 )
+	{
+		lznt1decompress_thread_range_decompress(
+		 (void *) &( thread_ranges[ number_of_ranges - 1 ] ) );
+	}
+	/* Wait for the threads that were created, also on error
+	 */
+	for( range_index = 0;
+	     range_index < ( number_of_ranges - 1 );
+	     range_index++ )
+	{
+		if( threads[ range_index ] == NULL )
+		{
+			continue;
+		}
+		if( libcthreads_thread_join(
+		     &( threads[ range_index ] ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to join thread: %d.",
+			 function,
+			 range_index );
+
+			result = -1;
+		}
+	}
+	if( result != 1 )
+	{
+		goto on_error;
+	}
+	for( chunk_index = 0;
+	     chunk_index < number_of_chunks;
+	     chunk_index++ )
+	{
+		if( chunks[ chunk_index ].result != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_COMPRESSION,
+			 LIBCERROR_COMPRESSION_ERROR_DECOMPRESS_FAILED,
+			 "%s: unable to decompress chunk: %d.",
+			 function,
+			 chunk_index );
+
+			goto on_error;
+		}
+		uncompressed_data_offset += chunks[ chunk_index ].uncompressed_data_size;
+
+		/* If a chunk other than the last one decompressed to less than 4096 bytes
+		 * the chunks after it were not decompressed at their final offset
+		 * hence the remaining chunks are decompressed again after the chunk
+		 */
+		if( ( chunk_index < ( number_of_chunks - 1 ) )
+		 && ( chunks[ chunk_index ].uncompressed_data_size < LZNT1DECOMPRESS_CHUNK_SIZE ) )
+		{
+			remaining_uncompressed_data_size = safe_uncompressed_data_size - uncompressed_data_offset;
+
+			if( libfwnt_lznt1_decompress(
+			     &( compressed_data[ chunks[ chunk_index + 1 ].compressed_data_offset ] ),
+			     chunks[ number_of_chunks - 1 ].compressed_data_offset + chunks[ number_of_chunks - 1 ].compressed_data_size - chunks[ chunk_index + 1 ].compressed_data_offset,
+			     &( uncompressed_data[ uncompressed_data_offset ] ),
+			     &remaining_uncompressed_data_size,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_COMPRESSION,
+				 LIBCERROR_COMPRESSION_ERROR_DECOMPRESS_FAILED,
+				 "%s: unable to decompress chunks after chunk: %d.",
+				 function,
+				 chunk_index );
+
+				goto on_error;
+			}
+			uncompressed_data_offset += remaining_uncompressed_data_size;
+
+			break;
+		}
+	}
+	*uncompressed_data_size = uncompressed_data_offset;
+
+	memory_free(
+	 threads );
+	memory_free(
+	 thread_ranges );
+
+	return( 1 );
+
+on_error:
+	if( threads != NULL )
+	{
+		memory_free(
+		 threads );
+	}
+	if( thread_ranges != NULL )
+	{
+		memory_free(
+		 thread_ranges );
+	}
+	return( -1 );
+}
+
+#endif /* defined( HAVE_MULTI_THREAD_SUPPORT ) */
+
+/* Decompresses LZNT1 compressed data into a newly allocated buffer
+ * The chunks are decompressed one at a time and the buffer is doubled in size
+ * when it cannot contain another chunk, hence the chunks decompressed before
+ * a resize are not decompressed again
+ * The buffer is initially sized using the uncompressed data size
+ * The uncompressed data must be freed with memory_free
+ * Returns 1 if successful or -1 on error
+ */
+int lznt1decompress_decompress_allocate(
+     const uint8_t *compressed_data,
+     size_t compressed_data_size,
+     uint8_t **uncompressed_data,
+     size_t *uncompressed_data_size,
+     libcerror_error_t **error )
+{
+	uint8_t *reallocation               = NULL;
+	uint8_t *safe_uncompressed_data     = NULL;
+	static char *function               = "lznt1decompress_decompress_allocate";
+	size_t chunk_size                   = 0;
+	size_t chunk_uncompressed_data_size = 0;
+	size_t compressed_data_offset       = 0;
+	size_t safe_uncompressed_data_size  = 0;
+	size_t uncompressed_data_offset     = 0;
+	uint16_t chunk_header               = 0;
+
+	if( compressed_data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid compressed data.",
+		 function );
+
+		return( -1 );
+	}
+	if( uncompressed_data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid uncompressed data.",
+		 function );
+
+		return( -1 );
+	}
+	if( *uncompressed_data != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid uncompressed data value already set.",
+		 function );
+
+		return( -1 );
+	}
+	if( uncompressed_data_size == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid uncompressed data size.",
+		 function );
+
+		return( -1 );
+	}
+	safe_uncompressed_data_size = *uncompressed_data_size;
+
+	if( safe_uncompressed_data_size < LZNT1DECOMPRESS_CHUNK_SIZE )
+	{
+		safe_uncompressed_data_size = LZNT1DECOMPRESS_CHUNK_SIZE;
+	}
+	safe_uncompressed_data = (uint8_t *) memory_allocate(
+	                                      sizeof( uint8_t ) * safe_uncompressed_data_size );
+
+	if( safe_uncompressed_data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create uncompressed data.",
+		 function );
+
+		goto on_error;
+	}
+	while( ( compressed_data_offset + 2 ) <= compressed_data_size )
+	{
+		byte_stream_copy_to_uint16_little_endian(
+		 &( compressed_data[ compressed_data_offset ] ),
+		 chunk_header );
+
+		if( chunk_header == 0 )
+		{
+			break;
+		}
+		chunk_size = (size_t) ( chunk_header & 0x0fff ) + 3;
+
+		if( chunk_size > ( compressed_data_size - compressed_data_offset ) )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+			 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+			 "%s: invalid chunk size value out of bounds.",
+			 function );
+
+			goto on_error;
+		}
+		if( ( safe_uncompressed_data_size - uncompressed_data_offset ) < LZNT1DECOMPRESS_CHUNK_SIZE )
+		{
+			if( safe_uncompressed_data_size > ( (size_t) SSIZE_MAX / 2 ) )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_VALUE_EXCEEDS_MAXIMUM,
+				 "%s: invalid uncompressed data size value exceeds maximum.",
+				 function );
+
+				goto on_error;
+			}
+			reallocation = (uint8_t *) memory_reallocate(
+			                            safe_uncompressed_data,
+			                            sizeof( uint8_t ) * safe_uncompressed_data_size * 2 );
+
+			if( reallocation == NULL )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_MEMORY,
+				 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+				 "%s: unable to resize uncompressed data.",
+				 function );
+
+				goto on_error;
+			}
+			safe_uncompressed_data       = reallocation;
+			safe_uncompressed_data_size *= 2;
+		}
+		chunk_uncompressed_data_size = LZNT1DECOMPRESS_CHUNK_SIZE;
+
+		if( libfwnt_lznt1_decompress(
+		     &( compressed_data[ compressed_data_offset ] ),
+		     chunk_size,
+		     &( safe_uncompressed_data[ uncompressed_data_offset ] ),
+		     &chunk_uncompressed_data_size,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_COMPRESSION,
+			 LIBCERROR_COMPRESSION_ERROR_DECOMPRESS_FAILED,
+			 "%s: unable to decompress chunk at offset: %" PRIzd ".",
+			 function,
+			 compressed_data_offset );
+
+			goto on_error;
+		}
+		compressed_data_offset   += chunk_size;
+		uncompressed_data_offset += chunk_uncompressed_data_size;
+	}
+	*uncompressed_data      = safe_uncompressed_data;
+	*uncompressed_data_size = uncompressed_data_offset;
+
+	return( 1 );
+
+on_error:
+	if( safe_uncompressed_data != NULL )
+	{
+		memory_free(
+		 safe_uncompressed_data );
+	}
+	return( -1 );
+}
+
 /* The main program
  */
 #if defined( HAVE_WIDE_SYSTEM_CHARACTER )
@@ -132,28 +891,36 @@ int wmain( int argc, wchar_t * const argv[] )
 int main( int argc, char * const argv[] )
 #endif
 {
-	libcerror_error_t *error                 = NULL;
-	libcfile_file_t *destination_file        = NULL;
-	libcfile_file_t *source_file             = NULL;
-	system_character_t *option_target_path   = NULL;
-	system_character_t *options_string       = NULL;
-	system_character_t *source               = NULL;
-	uint8_t *buffer                          = NULL;
-	uint8_t *uncompressed_data               = NULL;
-	char *program                            = "lznt1decompress";
-	system_integer_t option                  = 0;
-	size64_t source_size                     = 0;
-	size_t buffer_size                       = 0;
-	size_t uncompressed_data_size            = 0;
-	ssize_t read_count                       = 0;
-	ssize_t write_count                      = 0;
-	off_t source_offset                      = 0;
-	int decompression_method                 = 1;
-	int result                               = 0;
-	int verbose                              = 0;
-
+	libcerror_error_t *error                     = NULL;
+	assorted_input_file_t *source_file           = NULL;
+	assorted_output_file_t *destination_file     = NULL;
+	system_character_t *option_hexdump_window    = NULL;
+	system_character_t *option_statistics_format = NULL;
+	system_character_t *option_target_path       = NULL;
+	system_character_t *options_string           = NULL;
+	system_character_t *source                   = NULL;
+	uint8_t *buffer                              = NULL;
+	uint8_t *uncompressed_data                   = NULL;
+	char *program                                = "lznt1decompress";
+	system_integer_t option                      = 0;
+	size64_t source_size                         = 0;
+	size_t uncompressed_data_size                = 0;
+	ssize_t read_count                           = 0;
+	ssize_t write_count                          = 0;
+	off_t source_offset                          = 0;
+	int decompression_method                     = 1;
+	int is_mapped                                = 0;
+	int number_of_threads                        = 1;
+	int resize_uncompressed_data                 = 0;
+	int result                                   = 0;
+	int verbose                                  = 0;
+
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+	lznt1decompress_chunk_t *chunks              = NULL;
+	int number_of_chunks                         = 0;
+#endif
 #if defined( WINAPI )
-	unsigned short winapi_compression_method = 0;
+	unsigned short winapi_compression_method     = 0;
 #endif
 
 	assorted_output_version_fprint(
@@ -161,9 +928,9 @@ int main( int argc, char * const argv[] )
 	 program );
 
 #if defined( WINAPI )
-	options_string = _SYSTEM_STRING( "d:ho:s:t:vV12" );
+	options_string = _SYSTEM_STRING( "d:D:hj:o:s:S:t:vV12" );
 #else
-	options_string = _SYSTEM_STRING( "d:ho:s:t:vV1" );
+	options_string = _SYSTEM_STRING( "d:D:hj:o:s:S:t:vV1" );
 #endif
 	while( ( option = assorted_getopt(
 	                   argc,
@@ -201,12 +968,22 @@ int main( int argc, char * const argv[] )
 
 				break;
 
+			case (system_integer_t) 'D':
+				option_hexdump_window = optarg;
+
+				break;
+
 			case (system_integer_t) 'h':
 				usage_fprint(
 				 stdout );
 
 				return( EXIT_SUCCESS );
 
+			case (system_integer_t) 'j':
+				number_of_threads = (int) atol( optarg );
+
+				break;
+
 			case (system_integer_t) 'o':
 				source_offset = atol( optarg );
 
@@ -217,6 +994,11 @@ int main( int argc, char * const argv[] )
 
 				break;
 
+			case (system_integer_t) 'S':
+				option_statistics_format = optarg;
+
+				break;
+
 			case (system_integer_t) 't':
 				option_target_path = optarg;
 
@@ -247,15 +1029,68 @@ int main( int argc, char * const argv[] )
 	}
 	source = argv[ optind ];
 
+	if( ( number_of_threads <= 0 )
+	 || ( number_of_threads > LZNT1DECOMPRESS_MAXIMUM_NUMBER_OF_THREADS ) )
+	{
+		fprintf(
+		 stderr,
+		 "Unsupported number of threads, value must be between 1 and %d.\n",
+		 LZNT1DECOMPRESS_MAXIMUM_NUMBER_OF_THREADS );
+
+		return( EXIT_FAILURE );
+	}
+#if !defined( HAVE_MULTI_THREAD_SUPPORT )
+	if( number_of_threads > 1 )
+	{
+		fprintf(
+		 stderr,
+		 "Multi-threading not supported, using a single thread.\n" );
+
+		number_of_threads = 1;
+	}
+#endif
+	if( ( number_of_threads > 1 )
+	 && ( decompression_method != 1 ) )
+	{
+		fprintf(
+		 stderr,
+		 "Multiple threads are only supported by the LZNT1 decompression method, using a single thread.\n" );
+
+		number_of_threads = 1;
+	}
 	libcnotify_stream_set(
 	 stderr,
 	 NULL );
 	libcnotify_verbose_set(
 	 verbose );
 
+	if( assorted_output_statistics_initialize(
+	     option_statistics_format,
+	     &error ) != 1 )
+	{
+		fprintf(
+		 stderr,
+		 "Unable to initialize statistics.\n" );
+
+		goto on_error;
+	}
+	if( option_hexdump_window != NULL )
+	{
+		if( assorted_output_hexdump_window_set(
+		     option_hexdump_window,
+		     &error ) != 1 )
+		{
+			fprintf(
+			 stderr,
+			 "Unsupported hexdump window.\n" );
+
+			goto on_error;
+		}
+	}
+
 	/* Open the source file
 	 */
-	if( libcfile_file_initialize(
+	if( assorted_input_file_initialize(
 	     &source_file,
 	     &error ) != 1 )
 	{
@@ -265,19 +1100,11 @@ int main( int argc, char * const argv[] )
 
 		goto on_error;
 	}
-#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
-	result = libcfile_file_open_wide(
-	          source_file,
-	          source,
-	          LIBCFILE_OPEN_READ,
-	          &error );
-#else
-	result = libcfile_file_open(
+	result = assorted_input_file_open(
 	          source_file,
 	          source,
-	          LIBCFILE_OPEN_READ,
 	          &error );
-#endif
+
  	if( result != 1 )
 	{
 		fprintf(
@@ -288,7 +1115,7 @@ int main( int argc, char * const argv[] )
 	}
 	if( source_size == 0 )
 	{
-		if( libcfile_file_get_size(
+		if( assorted_input_file_get_size(
 		     source_file,
 		     &source_size,
 		     &error ) == -1 )
@@ -325,50 +1152,9 @@ int main( int argc, char * const argv[] )
 
 		goto on_error;
 	}
-	/* Create the input buffer
-	 */
-	buffer_size = source_size;
-
-	buffer = (uint8_t *) memory_allocate(
-	                      sizeof( uint8_t ) * buffer_size );
-
-	if( buffer == NULL )
-	{
-		fprintf(
-		 stderr,
-		 "Unable to create buffer.\n" );
-
-		goto on_error;
-	}
-	if( uncompressed_data_size == 0 )
-	{
-		uncompressed_data_size = 65536;
-	}
-	uncompressed_data = (uint8_t *) memory_allocate(
-	                                 sizeof( uint8_t ) * uncompressed_data_size );
-
-	if( uncompressed_data == NULL )
-	{
-		fprintf(
-		 stderr,
-		 "Unable to create uncompressed data buffer.\n" );
-
-		goto on_error;
-	}
-	if( memory_set(
-             uncompressed_data,
-	     0,
-	     uncompressed_data_size ) == NULL )
-	{
-		fprintf(
-		 stderr,
-		 "Unable to clear uncompressed data buffer.\n" );
-
-		goto on_error;
-	}
 	/* Position the source file at the right offset
 	 */
-	if( libcfile_file_seek_offset(
+	if( assorted_input_file_seek_offset(
 	     source_file,
 	     source_offset,
 	     SEEK_SET,
@@ -387,10 +1173,10 @@ int main( int argc, char * const argv[] )
 	 source_offset,
 	 source_offset );
 
-	read_count = libcfile_file_read_buffer(
-		      source_file,
-		      buffer,
-		      source_size,
+	read_count = assorted_input_file_read_data(
+	              source_file,
+	              &buffer,
+	              (size_t) source_size,
 	              &error );
 
 	if( read_count != (ssize_t) source_size )
@@ -401,6 +1187,126 @@ int main( int argc, char * const argv[] )
 
 		goto on_error;
 	}
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+	if( number_of_threads > 1 )
+	{
+		if( lznt1decompress_get_chunks(
+		     buffer,
+		     (size_t) source_size,
+		     &chunks,
+		     &number_of_chunks,
+		     &error ) != 1 )
+		{
+			fprintf(
+			 stderr,
+			 "Unable to determine chunks.\n" );
+
+			goto on_error;
+		}
+		if( number_of_chunks == 0 )
+		{
+			fprintf(
+			 stderr,
+			 "Missing chunks.\n" );
+
+			goto on_error;
+		}
+		if( uncompressed_data_size == 0 )
+		{
+			if( (size_t) number_of_chunks > ( (size_t) SSIZE_MAX / LZNT1DECOMPRESS_CHUNK_SIZE ) )
+			{
+				fprintf(
+				 stderr,
+				 "Invalid number of chunks value exceeds maximum.\n" );
+
+				goto on_error;
+			}
+			uncompressed_data_size = (size_t) number_of_chunks * LZNT1DECOMPRESS_CHUNK_SIZE;
+		}
+	}
+#endif
+	/* Without a decompressed data size the uncompressed data buffer is resized
+	 * while decompressing, which requires the LZNT1 decompression method
+	 */
+	if( uncompressed_data_size == 0 )
+	{
+		if( decompression_method == 1 )
+		{
+			resize_uncompressed_data = 1;
+		}
+		uncompressed_data_size = 65536;
+	}
+	/* Open the destination file, if it can be mapped the data is decompressed
+	 * directly into the destination file instead of an uncompressed data buffer
+	 * An uncompressed data buffer that is resized is written buffered
+	 */
+	if( option_target_path != NULL )
+	{
+		if( assorted_output_file_initialize(
+		     &destination_file,
+		     &error ) != 1 )
+		{
+			fprintf(
+			 stderr,
+			 "Unable to create destination file.\n" );
+
+			goto on_error;
+		}
+		if( assorted_output_file_open(
+		     destination_file,
+		     option_target_path,
+		     ( resize_uncompressed_data != 0 ) ? 0 : uncompressed_data_size,
+		     &error ) != 1 )
+		{
+			fprintf(
+			 stderr,
+			 "Unable to open destination file.\n" );
+
+			goto on_error;
+		}
+		is_mapped = assorted_output_file_get_mapped_data(
+		             destination_file,
+		             &uncompressed_data,
+		             &uncompressed_data_size,
+		             &error );
+
+		if( is_mapped == -1 )
+		{
+			fprintf(
+			 stderr,
+			 "Unable to retrieve mapped destination data.\n" );
+
+			goto on_error;
+		}
+	}
+	/* The mapped destination data of a newly created file is already zero
+	 */
+	if( ( is_mapped == 0 )
+	 && ( resize_uncompressed_data == 0 ) )
+	{
+		uncompressed_data = (uint8_t *) memory_allocate(
+		                                 sizeof( uint8_t ) * uncompressed_data_size );
+
+		if( uncompressed_data == NULL )
+		{
+			fprintf(
+			 stderr,
+			 "Unable to create uncompressed data buffer.\n" );
+
+			goto on_error;
+		}
+		if( memory_set(
+		     uncompressed_data,
+		     0,
+		     uncompressed_data_size ) == NULL )
+		{
+			fprintf(
+			 stderr,
+			 "Unable to clear uncompressed data buffer.\n" );
+
+			goto on_error;
+		}
+	}
 	/* Decompress the data
 	 */
 	if( option_target_path == NULL )
@@ -409,12 +1315,44 @@ int main( int argc, char * const argv[] )
 		 stderr,
 		 "Compressed data:\n" );
 
-		libcnotify_print_data(
-		 buffer,
-		 source_size,
-		 LIBCNOTIFY_PRINT_DATA_FLAG_GROUP_DATA );
+		if( assorted_output_data_fprint(
+		     stderr,
+		     buffer,
+		     source_size,
+		     0,
+		     &error ) != 1 )
+		{
+			fprintf(
+			 stderr,
+			 "Unable to print compressed data.\n" );
+
+			goto on_error;
+		}
 	}
-	if( decompression_method == 1 )
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+	if( number_of_threads > 1 )
+	{
+		result = lznt1decompress_decompress_parallel(
+		          buffer,
+		          chunks,
+		          number_of_chunks,
+		          uncompressed_data,
+		          &uncompressed_data_size,
+		          number_of_threads,
+		          &error );
+	}
+	else
+#endif
+	if( resize_uncompressed_data != 0 )
+	{
+		result = lznt1decompress_decompress_allocate(
+		          buffer,
+		          (size_t) source_size,
+		          &uncompressed_data,
+		          &uncompressed_data_size,
+		          &error );
+	}
+	else if( decompression_method == 1 )
 	{
 		result = libfwnt_lznt1_decompress(
 		          buffer,
@@ -450,11 +1388,15 @@ int main( int argc, char * const argv[] )
 		 stderr,
 		 "Unable to decompress data.\n" );
 
-		libcnotify_print_data(
-		 uncompressed_data,
-		 uncompressed_data_size,
-		 LIBCNOTIFY_PRINT_DATA_FLAG_GROUP_DATA );
-
+		if( uncompressed_data != NULL )
+		{
+			assorted_output_data_fprint(
+			 stderr,
+			 uncompressed_data,
+			 uncompressed_data_size,
+			 0,
+			 NULL );
+		}
 		goto on_error;
 	}
 	if( option_target_path == NULL )
@@ -463,45 +1405,23 @@ int main( int argc, char * const argv[] )
 		 stderr,
 		 "Uncompressed data:\n" );
 
-		libcnotify_print_data(
-		 uncompressed_data,
-		 uncompressed_data_size,
-		 LIBCNOTIFY_PRINT_DATA_FLAG_GROUP_DATA );
-	}
-	else
-	{
-		if( libcfile_file_initialize(
-		     &destination_file,
+		if( assorted_output_data_fprint(
+		     stderr,
+		     uncompressed_data,
+		     uncompressed_data_size,
+		     0,
 		     &error ) != 1 )
 		{
 			fprintf(
 			 stderr,
-			 "Unable to create destination file.\n" );
+			 "Unable to print uncompressed data.\n" );
 
 			goto on_error;
 		}
-#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
-		result = libcfile_file_open_wide(
-		          destination_file,
-		          option_target_path,
-		          LIBCFILE_OPEN_WRITE,
-		          &error );
-#else
-		result = libcfile_file_open(
-		          destination_file,
-		          option_target_path,
-		          LIBCFILE_OPEN_WRITE,
-		          &error );
-#endif
-	 	if( result != 1 )
-		{
-			fprintf(
-			 stderr,
-			 "Unable to open destination file.\n" );
-
-			goto on_error;
-		}
-		write_count = libcfile_file_write_buffer(
+	}
+	else
+	{
+		write_count = assorted_output_file_write_data(
 			       destination_file,
 			       uncompressed_data,
 			       uncompressed_data_size,
@@ -515,7 +1435,7 @@ int main( int argc, char * const argv[] )
 
 			goto on_error;
 		}
-		if( libcfile_file_close(
+		if( assorted_output_file_close(
 		     destination_file,
 		     &error ) != 0 )
 		{
@@ -525,7 +1445,7 @@ int main( int argc, char * const argv[] )
 
 			goto on_error;
 		}
-		if( libcfile_file_free(
+		if( assorted_output_file_free(
 		     &destination_file,
 		     &error ) != 1 )
 		{
@@ -538,7 +1458,7 @@ int main( int argc, char * const argv[] )
 	}
 	/* Clean up
 	 */
-	if( libcfile_file_close(
+	if( assorted_input_file_close(
 	     source_file,
 	     &error ) != 0 )
 	{
@@ -548,7 +1468,7 @@ int main( int argc, char * const argv[] )
 
 		goto on_error;
 	}
-	if( libcfile_file_free(
+	if( assorted_input_file_free(
 	     &source_file,
 	     &error ) != 1 )
 	{
@@ -558,20 +1478,34 @@ int main( int argc, char * const argv[] )
 
 		goto on_error;
 	}
-	memory_free(
-	 uncompressed_data );
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+	if( chunks != NULL )
+	{
+		memory_free(
+		 chunks );
 
+		chunks = NULL;
+	}
+#endif
+	if( is_mapped == 0 )
+	{
+		memory_free(
+		 uncompressed_data );
+	}
 	uncompressed_data = NULL;
 
-	memory_free(
-	 buffer );
-
-	buffer = NULL;
-
 	fprintf(
 	 stdout,
 	 "LZNT1 decompression:\tSUCCESS\n" );
 
+	assorted_output_statistics_fprint(
+	 stderr,
+	 program,
+	 1,
+	 NULL );
+	assorted_output_statistics_free(
+	 NULL );
+
 	return( EXIT_SUCCESS );
 
 on_error:
@@ -582,25 +1516,35 @@ on_error:
 		libcerror_error_free(
 		 &error );
 	}
+	assorted_output_statistics_fprint(
+	 stderr,
+	 program,
+	 -1,
+	 NULL );
+	assorted_output_statistics_free(
+	 NULL );
 	if( destination_file != NULL )
 	{
-		libcfile_file_free(
+		assorted_output_file_free(
 		 &destination_file,
 		 NULL );
 	}
-	if( uncompressed_data != NULL )
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+	if( chunks != NULL )
 	{
 		memory_free(
-		 uncompressed_data );
+		 chunks );
 	}
-	if( buffer != NULL )
+#endif
+	if( ( uncompressed_data != NULL )
+	 && ( is_mapped == 0 ) )
 	{
 		memory_free(
-		 buffer );
+		 uncompressed_data );
 	}
 	if( source_file != NULL )
 	{
-		libcfile_file_free(
+		assorted_input_file_free(
 		 &source_file,
 		 NULL );
 	}
@@ -20,6 +20,7 @@
  */
 
 #include <common.h>
+#include <lz_match.h>
 #include <memory.h>
 #include <types.h>
 
@@ -42,6 +43,25 @@ enum LZVN_OPPCODE_TYPES
 	LZVN_OPPCODE_TYPE_NONE,
 };
 
+/* The maximum size of the oppcode and its values
+ */
+#define LZVN_MAXIMUM_OPPCODE_SIZE			3
+
+/* The maximum size of a literal or a match
+ */
+#define LZVN_MAXIMUM_LITERAL_SIZE			( 255 + 16 )
+#define LZVN_MAXIMUM_MATCH_SIZE				( 255 + 16 )
+
+/* The number of bytes the fast path requires after the compressed data offset
+ * to read an oppcode and copy a literal in blocks of 16 bytes
+ */
+#define LZVN_DECOMPRESS_FAST_COMPRESSED_MARGIN		( LZVN_MAXIMUM_OPPCODE_SIZE + LZVN_MAXIMUM_LITERAL_SIZE + 16 )
+
+/* The number of bytes the fast path requires after the uncompressed data offset
+ * to copy a literal in blocks of 16 bytes followed by a match using wide copies
+ */
+#define LZVN_DECOMPRESS_FAST_UNCOMPRESSED_MARGIN	( LZVN_MAXIMUM_LITERAL_SIZE + 16 + LZVN_MAXIMUM_MATCH_SIZE + LZ_MATCH_COPY_SLACK_SIZE )
+
 /* Lookup table to map an oppcode to its type
  */
 uint8_t lzvn_oppcode_types[ 256 ] = {
@@ -266,71 +286,826 @@ uint8_t lzvn_oppcode_types[ 256 ] = {
 	LZVN_OPPCODE_TYPE_DISTANCE_PREVIOUS,	/* 0xce */
 	LZVN_OPPCODE_TYPE_DISTANCE_LARGE,	/* 0xcf */
 
-	LZVN_OPPCODE_TYPE_INVALID,		/* 0xd0 */
-	LZVN_OPPCODE_TYPE_INVALID,		/* 0xd1 */
-	LZVN_OPPCODE_TYPE_INVALID,		/* 0xd2 */
-	LZVN_OPPCODE_TYPE_INVALID,		/* 0xd3 */
-	LZVN_OPPCODE_TYPE_INVALID,		/* 0xd4 */
-	LZVN_OPPCODE_TYPE_INVALID,		/* 0xd5 */
-	LZVN_OPPCODE_TYPE_INVALID,		/* 0xd6 */
-	LZVN_OPPCODE_TYPE_INVALID,		/* 0xd7 */
-	LZVN_OPPCODE_TYPE_INVALID,		/* 0xd8 */
-	LZVN_OPPCODE_TYPE_INVALID,		/* 0xd9 */
-	LZVN_OPPCODE_TYPE_INVALID,		/* 0xda */
-	LZVN_OPPCODE_TYPE_INVALID,		/* 0xdb */
-	LZVN_OPPCODE_TYPE_INVALID,		/* 0xdc */
-	LZVN_OPPCODE_TYPE_INVALID,		/* 0xdd */
-	LZVN_OPPCODE_TYPE_INVALID,		/* 0xde */
-	LZVN_OPPCODE_TYPE_INVALID,		/* 0xdf */
+	LZVN_OPPCODE_TYPE_INVALID,		/* 0xd0 */
+	LZVN_OPPCODE_TYPE_INVALID,		/* 0xd1 */
+	LZVN_OPPCODE_TYPE_INVALID,		/* 0xd2 */
+	LZVN_OPPCODE_TYPE_INVALID,		/* 0xd3 */
+	LZVN_OPPCODE_TYPE_INVALID,		/* 0xd4 */
+	LZVN_OPPCODE_TYPE_INVALID,		/* 0xd5 */
+	LZVN_OPPCODE_TYPE_INVALID,		/* 0xd6 */
+	LZVN_OPPCODE_TYPE_INVALID,		/* 0xd7 */
+	LZVN_OPPCODE_TYPE_INVALID,		/* 0xd8 */
+	LZVN_OPPCODE_TYPE_INVALID,		/* 0xd9 */
+	LZVN_OPPCODE_TYPE_INVALID,		/* 0xda */
+	LZVN_OPPCODE_TYPE_INVALID,		/* 0xdb */
+	LZVN_OPPCODE_TYPE_INVALID,		/* 0xdc */
+	LZVN_OPPCODE_TYPE_INVALID,		/* 0xdd */
+	LZVN_OPPCODE_TYPE_INVALID,		/* 0xde */
+	LZVN_OPPCODE_TYPE_INVALID,		/* 0xdf */
+
+	LZVN_OPPCODE_TYPE_LITERAL_LARGE,	/* 0xe0 */
+	LZVN_OPPCODE_TYPE_LITERAL_SMALL,	/* 0xe1 */
+	LZVN_OPPCODE_TYPE_LITERAL_SMALL,	/* 0xe2 */
+	LZVN_OPPCODE_TYPE_LITERAL_SMALL,	/* 0xe3 */
+	LZVN_OPPCODE_TYPE_LITERAL_SMALL,	/* 0xe4 */
+	LZVN_OPPCODE_TYPE_LITERAL_SMALL,	/* 0xe5 */
+	LZVN_OPPCODE_TYPE_LITERAL_SMALL,	/* 0xe6 */
+	LZVN_OPPCODE_TYPE_LITERAL_SMALL,	/* 0xe7 */
+	LZVN_OPPCODE_TYPE_LITERAL_SMALL,	/* 0xe8 */
+	LZVN_OPPCODE_TYPE_LITERAL_SMALL,	/* 0xe9 */
+	LZVN_OPPCODE_TYPE_LITERAL_SMALL,	/* 0xea */
+	LZVN_OPPCODE_TYPE_LITERAL_SMALL,	/* 0xeb */
+	LZVN_OPPCODE_TYPE_LITERAL_SMALL,	/* 0xec */
+	LZVN_OPPCODE_TYPE_LITERAL_SMALL,	/* 0xed */
+	LZVN_OPPCODE_TYPE_LITERAL_SMALL,	/* 0xee */
+	LZVN_OPPCODE_TYPE_LITERAL_SMALL,	/* 0xef */
+
+	LZVN_OPPCODE_TYPE_MATCH_LARGE,		/* 0xf0 */
+	LZVN_OPPCODE_TYPE_MATCH_SMALL,		/* 0xf1 */
+	LZVN_OPPCODE_TYPE_MATCH_SMALL,		/* 0xf2 */
+	LZVN_OPPCODE_TYPE_MATCH_SMALL,		/* 0xf3 */
+	LZVN_OPPCODE_TYPE_MATCH_SMALL,		/* 0xf4 */
+	LZVN_OPPCODE_TYPE_MATCH_SMALL,		/* 0xf5 */
+	LZVN_OPPCODE_TYPE_MATCH_SMALL,		/* 0xf6 */
+	LZVN_OPPCODE_TYPE_MATCH_SMALL,		/* 0xf7 */
+	LZVN_OPPCODE_TYPE_MATCH_SMALL,		/* 0xf8 */
+	LZVN_OPPCODE_TYPE_MATCH_SMALL,		/* 0xf9 */
+	LZVN_OPPCODE_TYPE_MATCH_SMALL,		/* 0xfa */
+	LZVN_OPPCODE_TYPE_MATCH_SMALL,		/* 0xfb */
+	LZVN_OPPCODE_TYPE_MATCH_SMALL,		/* 0xfc */
+	LZVN_OPPCODE_TYPE_MATCH_SMALL,		/* 0xfd */
+	LZVN_OPPCODE_TYPE_MATCH_SMALL,		/* 0xfe */
+	LZVN_OPPCODE_TYPE_MATCH_SMALL,		/* 0xff */
+};
+
+/* Writes literals as literal oppcodes
+ * Returns 1 on success or -1 on error
+ */
+static int lzvn_compress_write_literals(
+            const uint8_t *literal_data,
+            size_t literal_size,
+            uint8_t *compressed_data,
+            size_t compressed_data_size,
+            size_t *compressed_data_offset,
+            libcerror_error_t **error )
+{
+	static char *function = "lzvn_compress_write_literals";
+	size_t offset         = 0;
+	size_t size           = 0;
+
+	offset = *compressed_data_offset;
+
+	while( literal_size > 0 )
+	{
+		size = literal_size;
+
+		if( size > LZVN_MAXIMUM_LITERAL_SIZE )
+		{
+			size = LZVN_MAXIMUM_LITERAL_SIZE;
+		}
+		if( ( size + 2 ) > ( compressed_data_size - offset ) )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+			 LIBCERROR_ARGUMENT_ERROR_VALUE_TOO_SMALL,
+			 "%s: compressed data size value too small.",
+			 function );
+
+			return( -1 );
+		}
+		if( size >= 16 )
+		{
+			compressed_data[ offset++ ] = 0xe0;
+			compressed_data[ offset++ ] = (uint8_t) ( size - 16 );
+		}
+		else
+		{
+			compressed_data[ offset++ ] = (uint8_t) ( 0xe0 | size );
+		}
+		memory_copy(
+		 &( compressed_data[ offset ] ),
+		 literal_data,
+		 size );
+
+		offset       += size;
+		literal_data += size;
+		literal_size -= size;
+	}
+	*compressed_data_offset = offset;
+
+	return( 1 );
+}
+
+/* Determines the largest match size, of at most 10, that can be stored in an oppcode
+ * that contains the literal size, the match size and the value in the lower 3 bits
+ * Returns the match size or 0 if not available
+ */
+static uint16_t lzvn_compress_get_oppcode_match_size(
+                 size_t match_size,
+                 uint8_t literal_size,
+                 uint8_t value,
+                 uint8_t oppcode_type )
+{
+	uint8_t oppcode = 0;
+
+	if( match_size > 10 )
+	{
+		match_size = 10;
+	}
+	while( match_size >= 3 )
+	{
+		oppcode = (uint8_t) ( ( literal_size << 6 ) | ( ( match_size - 3 ) << 3 ) | value );
+
+		if( lzvn_oppcode_types[ oppcode ] == oppcode_type )
+		{
+			return( (uint16_t) match_size );
+		}
+		match_size--;
+	}
+	return( 0 );
+}
+
+/* Writes a match, preceded by up to 3 literals, as a distance oppcode followed by
+ * match oppcodes that use the previous distance for the remainder of the match
+ * Returns 1 on success or -1 on error
+ */
+static int lzvn_compress_write_match(
+            const uint8_t *literal_data,
+            uint8_t literal_size,
+            size_t match_size,
+            uint16_t distance,
+            uint16_t *previous_distance,
+            uint8_t *compressed_data,
+            size_t compressed_data_size,
+            size_t *compressed_data_offset,
+            libcerror_error_t **error )
+{
+	static char *function       = "lzvn_compress_write_match";
+	size_t offset               = 0;
+	size_t size                 = 0;
+	uint16_t oppcode_match_size = 0;
+
+	offset = *compressed_data_offset;
+
+	if( ( LZVN_MAXIMUM_OPPCODE_SIZE + literal_size ) > ( compressed_data_size - offset ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_TOO_SMALL,
+		 "%s: compressed data size value too small.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( distance != *previous_distance )
+	 || ( literal_size > 0 ) )
+	{
+		if( distance == *previous_distance )
+		{
+			oppcode_match_size = lzvn_compress_get_oppcode_match_size(
+			                      match_size,
+			                      literal_size,
+			                      6,
+			                      LZVN_OPPCODE_TYPE_DISTANCE_PREVIOUS );
+		}
+		if( oppcode_match_size != 0 )
+		{
+			compressed_data[ offset++ ] = (uint8_t) ( ( literal_size << 6 ) | ( ( oppcode_match_size - 3 ) << 3 ) | 6 );
+		}
+		else
+		{
+			if( distance < 0x0600 )
+			{
+				oppcode_match_size = lzvn_compress_get_oppcode_match_size(
+				                      match_size,
+				                      literal_size,
+				                      (uint8_t) ( distance >> 8 ),
+				                      LZVN_OPPCODE_TYPE_DISTANCE_SMALL );
+			}
+			if( oppcode_match_size != 0 )
+			{
+				compressed_data[ offset++ ] = (uint8_t) ( ( literal_size << 6 ) | ( ( oppcode_match_size - 3 ) << 3 ) | ( distance >> 8 ) );
+				compressed_data[ offset++ ] = (uint8_t) ( distance & 0xff );
+			}
+			else if( distance < 0x4000 )
+			{
+				oppcode_match_size = (uint16_t) match_size;
+
+				if( oppcode_match_size > 34 )
+				{
+					oppcode_match_size = 34;
+				}
+				compressed_data[ offset++ ] = (uint8_t) ( 0xa0 | ( literal_size << 3 ) | ( ( oppcode_match_size - 3 ) >> 2 ) );
+				compressed_data[ offset++ ] = (uint8_t) ( ( ( distance & 0x3f ) << 2 ) | ( ( oppcode_match_size - 3 ) & 0x03 ) );
+				compressed_data[ offset++ ] = (uint8_t) ( distance >> 6 );
+			}
+			else
+			{
+				/* A large distance oppcode with a match size of 3 is valid for every literal size
+				 */
+				oppcode_match_size = lzvn_compress_get_oppcode_match_size(
+				                      match_size,
+				                      literal_size,
+				                      7,
+				                      LZVN_OPPCODE_TYPE_DISTANCE_LARGE );
+
+				compressed_data[ offset++ ] = (uint8_t) ( ( literal_size << 6 ) | ( ( oppcode_match_size - 3 ) << 3 ) | 7 );
+				compressed_data[ offset++ ] = (uint8_t) ( distance & 0xff );
+				compressed_data[ offset++ ] = (uint8_t) ( distance >> 8 );
+			}
+		}
+		if( literal_size > 0 )
+		{
+			memory_copy(
+			 &( compressed_data[ offset ] ),
+			 literal_data,
+			 literal_size );
+
+			offset += literal_size;
+		}
+		match_size -= oppcode_match_size;
+	}
+	/* The remainder of the match is stored in match oppcodes that use the previous distance
+	 */
+	while( match_size > 0 )
+	{
+		size = match_size;
+
+		if( size > LZVN_MAXIMUM_MATCH_SIZE )
+		{
+			size = LZVN_MAXIMUM_MATCH_SIZE;
+		}
+		if( ( compressed_data_size - offset ) < 2 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+			 LIBCERROR_ARGUMENT_ERROR_VALUE_TOO_SMALL,
+			 "%s: compressed data size value too small.",
+			 function );
+
+			return( -1 );
+		}
+		if( size >= 16 )
+		{
+			compressed_data[ offset++ ] = 0xf0;
+			compressed_data[ offset++ ] = (uint8_t) ( size - 16 );
+		}
+		else
+		{
+			compressed_data[ offset++ ] = (uint8_t) ( 0xf0 | size );
+		}
+		match_size -= size;
+	}
+	*previous_distance      = distance;
+	*compressed_data_offset = offset;
+
+	return( 1 );
+}
+
+/* Determines the size of the match between the data at the offset and the data at the match offset
+ * Returns the match size
+ */
+static size_t lzvn_compress_get_match_size(
+               const uint8_t *data,
+               size_t data_size,
+               size_t data_offset,
+               size_t match_offset )
+{
+	size_t match_size = 0;
+
+	while( ( data_offset + match_size ) < data_size )
+	{
+		if( data[ match_offset + match_size ] != data[ data_offset + match_size ] )
+		{
+			break;
+		}
+		match_size++;
+	}
+	return( match_size );
+}
+
+/* Compresses data using LZVN compression
+ * Uses a hash table with the last offset of every 4-byte string to find matches
+ * and prefers matches with the previous distance, which are cheaper to store
+ * Returns 1 on success or -1 on error
+ */
+int lzvn_compress(
+     const uint8_t *uncompressed_data,
+     size_t uncompressed_data_size,
+     uint8_t *compressed_data,
+     size_t *compressed_data_size,
+     libcerror_error_t **error )
+{
+	lzvn_compressor_t *compressor   = NULL;
+	static char *function           = "lzvn_compress";
+	size_t compressed_data_offset   = 0;
+	size_t literal_offset           = 0;
+	size_t literal_size             = 0;
+	size_t match_offset             = 0;
+	size_t match_size               = 0;
+	size_t previous_match_size      = 0;
+	size_t uncompressed_data_offset = 0;
+	uint32_t hash_value             = 0;
+	uint16_t distance               = 0;
+	uint16_t previous_distance      = 0;
+
+	if( uncompressed_data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid uncompressed data.",
+		 function );
+
+		return( -1 );
+	}
+	if( uncompressed_data_size > (size_t) SSIZE_MAX )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid uncompressed data size value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	if( compressed_data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid compressed data.",
+		 function );
+
+		return( -1 );
+	}
+	if( compressed_data_size == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid compressed data size.",
+		 function );
+
+		return( -1 );
+	}
+	if( *compressed_data_size > (size_t) SSIZE_MAX )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid compressed data size value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	compressor = memory_allocate_structure(
+	              lzvn_compressor_t );
+
+	if( compressor == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create compressor.",
+		 function );
+
+		goto on_error;
+	}
+	if( memory_set(
+	     compressor,
+	     0,
+	     sizeof( lzvn_compressor_t ) ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear compressor.",
+		 function );
+
+		goto on_error;
+	}
+	while( ( uncompressed_data_offset + 4 ) <= uncompressed_data_size )
+	{
+		match_size = 0;
+
+		if( ( previous_distance != 0 )
+		 && ( uncompressed_data_offset >= (size_t) previous_distance ) )
+		{
+			previous_match_size = lzvn_compress_get_match_size(
+			                       uncompressed_data,
+			                       uncompressed_data_size,
+			                       uncompressed_data_offset,
+			                       uncompressed_data_offset - previous_distance );
+
+			if( previous_match_size >= 3 )
+			{
+				match_size = previous_match_size;
+				distance   = previous_distance;
+			}
+		}
+		hash_value = ( (uint32_t) uncompressed_data[ uncompressed_data_offset ] )
+		           | ( (uint32_t) uncompressed_data[ uncompressed_data_offset + 1 ] << 8 )
+		           | ( (uint32_t) uncompressed_data[ uncompressed_data_offset + 2 ] << 16 )
+		           | ( (uint32_t) uncompressed_data[ uncompressed_data_offset + 3 ] << 24 );
+
+		hash_value  *= (uint32_t) 0x9e3779b1UL;
+		hash_value >>= 32 - LZVN_COMPRESSOR_HASH_NUMBER_OF_BITS;
+
+		match_offset = (size_t) compressor->hash_table[ hash_value ];
+
+		compressor->hash_table[ hash_value ] = (uint32_t) ( uncompressed_data_offset + 1 );
+
+		/* A repeated match with the previous distance is preferred unless the other match is longer
+		 */
+		if( ( match_offset != 0 )
+		 && ( ( uncompressed_data_offset - ( match_offset - 1 ) ) <= 0xffff ) )
+		{
+			match_offset -= 1;
+
+			previous_match_size = lzvn_compress_get_match_size(
+			                       uncompressed_data,
+			                       uncompressed_data_size,
+			                       uncompressed_data_offset,
+			                       match_offset );
+
+			if( ( previous_match_size >= 4 )
+			 && ( previous_match_size > ( match_size + 1 ) ) )
+			{
+				match_size = previous_match_size;
+				distance   = (uint16_t) ( uncompressed_data_offset - match_offset );
+			}
+		}
+		if( match_size == 0 )
+		{
+			uncompressed_data_offset++;
+
+			continue;
+		}
+		/* Up to 3 literals are stored in the distance oppcode of the match
+		 */
+		literal_size = uncompressed_data_offset - literal_offset;
+
+		if( literal_size > 3 )
+		{
+			if( lzvn_compress_write_literals(
+			     &( uncompressed_data[ literal_offset ] ),
+			     literal_size - ( literal_size & 0x03 ),
+			     compressed_data,
+			     *compressed_data_size,
+			     &compressed_data_offset,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+				 "%s: unable to write literals.",
+				 function );
+
+				goto on_error;
+			}
+			literal_offset += literal_size - ( literal_size & 0x03 );
+			literal_size   &= 0x03;
+		}
+		if( lzvn_compress_write_match(
+		     &( uncompressed_data[ literal_offset ] ),
+		     (uint8_t) literal_size,
+		     match_size,
+		     distance,
+		     &previous_distance,
+		     compressed_data,
+		     *compressed_data_size,
+		     &compressed_data_offset,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to write match.",
+			 function );
+
+			goto on_error;
+		}
+		uncompressed_data_offset += match_size;
+		literal_offset            = uncompressed_data_offset;
+	}
+	if( lzvn_compress_write_literals(
+	     &( uncompressed_data[ literal_offset ] ),
+	     uncompressed_data_size - literal_offset,
+	     compressed_data,
+	     *compressed_data_size,
+	     &compressed_data_offset,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to write literals.",
+		 function );
+
+		goto on_error;
+	}
+	/* The end of stream oppcode is followed by 7 bytes of padding
+	 */
+	if( ( *compressed_data_size - compressed_data_offset ) < 8 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_TOO_SMALL,
+		 "%s: compressed data size value too small.",
+		 function );
+
+		goto on_error;
+	}
+	compressed_data[ compressed_data_offset++ ] = 0x06;
+
+	memory_set(
+	 &( compressed_data[ compressed_data_offset ] ),
+	 0,
+	 7 );
+
+	compressed_data_offset += 7;
+
+	memory_free(
+	 compressor );
+
+	*compressed_data_size = compressed_data_offset;
+
+	return( 1 );
+
+on_error:
+	if( compressor != NULL )
+	{
+		memory_free(
+		 compressor );
+	}
+	return( -1 );
+}
+
+/* Decompresses LZVN compressed data while it is far enough from the end of the compressed
+ * and uncompressed data to decode an oppcode without checking the bounds for every value
+ * The literals are copied in blocks of 16 bytes and the matches using wide copies
+ * which can overwrite uncompressed data after the end of the literal or match
+ * Returns 1 at the end of the stream, 0 when near the end the data or -1 on error
+ */
+static int lzvn_decompress_fast(
+            const uint8_t *compressed_data,
+            size_t compressed_data_size,
+            size_t *compressed_data_offset,
+            uint8_t *uncompressed_data,
+            size_t uncompressed_data_size,
+            size_t *uncompressed_data_offset,
+            uint16_t *distance,
+            libcerror_error_t **error )
+{
+	const uint8_t *compressed_data_end = NULL;
+	const uint8_t *compressed_pointer  = NULL;
+	uint8_t *uncompressed_data_end     = NULL;
+	uint8_t *uncompressed_pointer      = NULL;
+	static char *function              = "lzvn_decompress_fast";
+	size_t literal_iterator            = 0;
+	uint16_t literal_size              = 0;
+	uint16_t match_distance            = 0;
+	uint16_t match_size                = 0;
+	uint8_t oppcode                    = 0;
+	uint8_t oppcode_value              = 0;
+
+	if( ( compressed_data_size < LZVN_DECOMPRESS_FAST_COMPRESSED_MARGIN )
+	 || ( uncompressed_data_size < LZVN_DECOMPRESS_FAST_UNCOMPRESSED_MARGIN ) )
+	{
+		return( 0 );
+	}
+	compressed_pointer    = &( compressed_data[ *compressed_data_offset ] );
+	compressed_data_end   = &( compressed_data[ compressed_data_size - LZVN_DECOMPRESS_FAST_COMPRESSED_MARGIN ] );
+	uncompressed_pointer  = &( uncompressed_data[ *uncompressed_data_offset ] );
+	uncompressed_data_end = &( uncompressed_data[ uncompressed_data_size - LZVN_DECOMPRESS_FAST_UNCOMPRESSED_MARGIN ] );
+	match_distance        = *distance;
+
+	while( ( compressed_pointer < compressed_data_end )
+	    && ( uncompressed_pointer < uncompressed_data_end ) )
+	{
+		oppcode = *compressed_pointer++;
+
+		switch( lzvn_oppcode_types[ oppcode ] )
+		{
+			case LZVN_OPPCODE_TYPE_DISTANCE_LARGE:
+				literal_size   = ( oppcode & 0xc0 ) >> 6;
+				match_size     = ( ( oppcode & 0x38 ) >> 3 ) + 3;
+				match_distance = ( (uint16_t) compressed_pointer[ 1 ] << 8 ) | compressed_pointer[ 0 ];
+
+				compressed_pointer += 2;
+
+				break;
+
+			case LZVN_OPPCODE_TYPE_DISTANCE_MEDIUM:
+				oppcode_value = compressed_pointer[ 0 ];
+
+				literal_size   = ( oppcode & 0x18 ) >> 3;
+				match_size     = ( ( ( oppcode & 0x07 ) << 2 ) | ( oppcode_value & 0x03 ) ) + 3;
+				match_distance = ( (uint16_t) compressed_pointer[ 1 ] << 6 ) | ( ( oppcode_value & 0xfc ) >> 2 );
+
+				compressed_pointer += 2;
+
+				break;
+
+			case LZVN_OPPCODE_TYPE_DISTANCE_PREVIOUS:
+				literal_size = ( oppcode & 0xc0 ) >> 6;
+				match_size   = ( ( oppcode & 0x38 ) >> 3 ) + 3;
+
+				break;
+
+			case LZVN_OPPCODE_TYPE_DISTANCE_SMALL:
+				literal_size   = ( oppcode & 0xc0 ) >> 6;
+				match_size     = ( ( oppcode & 0x38 ) >> 3 ) + 3;
+				match_distance = ( (uint16_t) ( oppcode & 0x07 ) << 8 ) | *compressed_pointer++;
+
+				break;
+
+			case LZVN_OPPCODE_TYPE_LITERAL_LARGE:
+				literal_size = (uint16_t) *compressed_pointer++ + 16;
+				match_size   = 0;
+
+				break;
+
+			case LZVN_OPPCODE_TYPE_LITERAL_SMALL:
+				literal_size = oppcode & 0x0f;
+				match_size   = 0;
+
+				break;
+
+			case LZVN_OPPCODE_TYPE_MATCH_LARGE:
+				literal_size = 0;
+				match_size   = (uint16_t) *compressed_pointer++ + 16;
+
+				break;
+
+			case LZVN_OPPCODE_TYPE_MATCH_SMALL:
+				literal_size = 0;
+				match_size   = oppcode & 0x0f;
+
+				break;
+
+			case LZVN_OPPCODE_TYPE_END_OF_STREAM:
+				*compressed_data_offset   = (size_t) ( compressed_pointer - compressed_data );
+				*uncompressed_data_offset = (size_t) ( uncompressed_pointer - uncompressed_data );
+				*distance                 = match_distance;
+
+				return( 1 );
+
+			case LZVN_OPPCODE_TYPE_NONE:
+				continue;
+
+			case LZVN_OPPCODE_TYPE_INVALID:
+			default:
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_UNSUPPORTED_VALUE,
+				 "%s: invalid oppcode: 0x%02" PRIx8 ".",
+				 function,
+				 oppcode );
+
+				return( -1 );
+		}
+		if( literal_size > 0 )
+		{
+			for( literal_iterator = 0;
+			     literal_iterator < (size_t) literal_size;
+			     literal_iterator += 16 )
+			{
+				memory_copy(
+				 &( uncompressed_pointer[ literal_iterator ] ),
+				 &( compressed_pointer[ literal_iterator ] ),
+				 16 );
+			}
+			compressed_pointer   += literal_size;
+			uncompressed_pointer += literal_size;
+		}
+		if( match_size > 0 )
+		{
+			if( ( match_distance == 0 )
+			 || ( (size_t) match_distance > (size_t) ( uncompressed_pointer - uncompressed_data ) ) )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+				 "%s: invalid distance value out of bounds.",
+				 function );
+
+				return( -1 );
+			}
+			lz_match_copy(
+			 uncompressed_data,
+			 uncompressed_data_size,
+			 (size_t) ( uncompressed_pointer - uncompressed_data ),
+			 (size_t) match_distance,
+			 (size_t) match_size );
+
+			uncompressed_pointer += match_size;
+		}
+	}
+	*compressed_data_offset   = (size_t) ( compressed_pointer - compressed_data );
+	*uncompressed_data_offset = (size_t) ( uncompressed_pointer - uncompressed_data );
+	*distance                 = match_distance;
+
+	return( 0 );
+}
+
+/* Resizes the uncompressed data to contain at least required size bytes
+ * The size of the uncompressed data is doubled, to prevent resizing it for
+ * every oppcode, but limited to maximum size
+ * Returns 1 on success or -1 on error
+ */
+static int lzvn_resize_uncompressed_data(
+            uint8_t **uncompressed_data,
+            size_t *uncompressed_data_size,
+            size_t required_size,
+            size_t maximum_size,
+            libcerror_error_t **error )
+{
+	uint8_t *reallocation = NULL;
+	static char *function = "lzvn_resize_uncompressed_data";
+	size_t new_size       = 0;
+
+	if( required_size > maximum_size )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid required size value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	new_size = *uncompressed_data_size;
 
-	LZVN_OPPCODE_TYPE_LITERAL_LARGE,	/* 0xe0 */
-	LZVN_OPPCODE_TYPE_LITERAL_SMALL,	/* 0xe1 */
-	LZVN_OPPCODE_TYPE_LITERAL_SMALL,	/* 0xe2 */
-	LZVN_OPPCODE_TYPE_LITERAL_SMALL,	/* 0xe3 */
-	LZVN_OPPCODE_TYPE_LITERAL_SMALL,	/* 0xe4 */
-	LZVN_OPPCODE_TYPE_LITERAL_SMALL,	/* 0xe5 */
-	LZVN_OPPCODE_TYPE_LITERAL_SMALL,	/* 0xe6 */
-	LZVN_OPPCODE_TYPE_LITERAL_SMALL,	/* 0xe7 */
-	LZVN_OPPCODE_TYPE_LITERAL_SMALL,	/* 0xe8 */
-	LZVN_OPPCODE_TYPE_LITERAL_SMALL,	/* 0xe9 */
-	LZVN_OPPCODE_TYPE_LITERAL_SMALL,	/* 0xea */
-	LZVN_OPPCODE_TYPE_LITERAL_SMALL,	/* 0xeb */
-	LZVN_OPPCODE_TYPE_LITERAL_SMALL,	/* 0xec */
-	LZVN_OPPCODE_TYPE_LITERAL_SMALL,	/* 0xed */
-	LZVN_OPPCODE_TYPE_LITERAL_SMALL,	/* 0xee */
-	LZVN_OPPCODE_TYPE_LITERAL_SMALL,	/* 0xef */
+	if( new_size <= ( maximum_size / 2 ) )
+	{
+		new_size *= 2;
+	}
+	else
+	{
+		new_size = maximum_size;
+	}
+	if( new_size < required_size )
+	{
+		new_size = required_size;
+	}
+	reallocation = (uint8_t *) memory_reallocate(
+	                            *uncompressed_data,
+	                            sizeof( uint8_t ) * new_size );
 
-	LZVN_OPPCODE_TYPE_MATCH_LARGE,		/* 0xf0 */
-	LZVN_OPPCODE_TYPE_MATCH_SMALL,		/* 0xf1 */
-	LZVN_OPPCODE_TYPE_MATCH_SMALL,		/* 0xf2 */
-	LZVN_OPPCODE_TYPE_MATCH_SMALL,		/* 0xf3 */
-	LZVN_OPPCODE_TYPE_MATCH_SMALL,		/* 0xf4 */
-	LZVN_OPPCODE_TYPE_MATCH_SMALL,		/* 0xf5 */
-	LZVN_OPPCODE_TYPE_MATCH_SMALL,		/* 0xf6 */
-	LZVN_OPPCODE_TYPE_MATCH_SMALL,		/* 0xf7 */
-	LZVN_OPPCODE_TYPE_MATCH_SMALL,		/* 0xf8 */
-	LZVN_OPPCODE_TYPE_MATCH_SMALL,		/* 0xf9 */
-	LZVN_OPPCODE_TYPE_MATCH_SMALL,		/* 0xfa */
-	LZVN_OPPCODE_TYPE_MATCH_SMALL,		/* 0xfb */
-	LZVN_OPPCODE_TYPE_MATCH_SMALL,		/* 0xfc */
-	LZVN_OPPCODE_TYPE_MATCH_SMALL,		/* 0xfd */
-	LZVN_OPPCODE_TYPE_MATCH_SMALL,		/* 0xfe */
-	LZVN_OPPCODE_TYPE_MATCH_SMALL,		/* 0xff */
-};
+	if( reallocation == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to resize uncompressed data.",
+		 function );
+
+		return( -1 );
+	}
+	*uncompressed_data      = reallocation;
+	*uncompressed_data_size = new_size;
+
+	return( 1 );
+}
 
 /* Decompresses LZVN compressed data
+ * If maximum uncompressed data size is not 0 the uncompressed data is resized
+ * when needed up to that size, which requires the uncompressed data to be
+ * allocated by memory_allocate. Decompression continues after the resize
+ * at the oppcode that did not fit
  * Returns 1 on success or -1 on error
  */
-int lzvn_decompress(
-     const uint8_t *compressed_data,
-     size_t compressed_data_size,
-     uint8_t *uncompressed_data,
-     size_t *uncompressed_data_size,
-     libcerror_error_t **error )
+static int lzvn_decompress_data(
+            const uint8_t *compressed_data,
+            size_t compressed_data_size,
+            uint8_t **uncompressed_data,
+            size_t *uncompressed_data_size,
+            size_t maximum_uncompressed_data_size,
+            libcerror_error_t **error )
 {
-	static char *function           = "lzvn_decompress";
+	uint8_t *output_data            = NULL;
+	static char *function           = "lzvn_decompress_data";
 	size_t compressed_data_offset   = 0;
-	size_t match_offset             = 0;
 	size_t uncompressed_data_offset = 0;
 	uint16_t distance               = 0;
 	uint16_t literal_size           = 0;
@@ -338,11 +1113,12 @@ int lzvn_decompress(
 	uint8_t oppcode                 = 0;
 	uint8_t oppcode_type            = 0;
 	uint8_t oppcode_value           = 0;
+	int result                      = 0;
 
 #if defined( HAVE_DEBUG_OUTPUT )
-	size_t debug_match_offset       = 0;
-	size_t oppcode_data_offset      = 0;
-	size_t oppcode_data_size        = 0;
+	size_t debug_match_offset  = 0;
+	size_t oppcode_data_offset = 0;
+	size_t oppcode_data_size   = 0;
 #endif
 
 	if( compressed_data == NULL )
@@ -378,6 +1154,17 @@ int lzvn_decompress(
 
 		return( -1 );
 	}
+	if( *uncompressed_data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid uncompressed data.",
+		 function );
+
+		return( -1 );
+	}
 	if( uncompressed_data_size == NULL )
 	{
 		libcerror_error_set(
@@ -400,9 +1187,75 @@ int lzvn_decompress(
 
 		return( -1 );
 	}
+	output_data = *uncompressed_data;
+
+#if defined( HAVE_DEBUG_OUTPUT )
+	if( libcnotify_verbose == 0 )
+#endif
+	{
+		do
+		{
+			result = lzvn_decompress_fast(
+			          compressed_data,
+			          compressed_data_size,
+			          &compressed_data_offset,
+			          output_data,
+			          *uncompressed_data_size,
+			          &uncompressed_data_offset,
+			          &distance,
+			          error );
+
+			if( result == -1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_COMPRESSION,
+				 LIBCERROR_COMPRESSION_ERROR_DECOMPRESS_FAILED,
+				 "%s: unable to decompress data.",
+				 function );
+
+				return( -1 );
+			}
+			else if( result != 0 )
+			{
+				*uncompressed_data_size = uncompressed_data_offset;
+
+				return( 1 );
+			}
+			/* Stay on the fast path if only the uncompressed data is near its end
+			 * and it can be resized
+			 */
+			if( ( ( compressed_data_size - compressed_data_offset ) <= LZVN_DECOMPRESS_FAST_COMPRESSED_MARGIN )
+			 || ( maximum_uncompressed_data_size <= *uncompressed_data_size ) )
+			{
+				break;
+			}
+			if( lzvn_resize_uncompressed_data(
+			     uncompressed_data,
+			     uncompressed_data_size,
+			     uncompressed_data_offset + 1,
+			     maximum_uncompressed_data_size,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_RESIZE_FAILED,
+				 "%s: unable to resize uncompressed data.",
+				 function );
+
+				return( -1 );
+			}
+			output_data = *uncompressed_data;
+		}
+		while( result == 0 );
+	}
+	/* Decompress the remainder of the data checking the bounds for every value
+	 */
 	while( compressed_data_offset < compressed_data_size )
 	{
-		if( uncompressed_data_offset >= *uncompressed_data_size )
+		if( ( uncompressed_data_offset >= *uncompressed_data_size )
+		 && ( maximum_uncompressed_data_size <= *uncompressed_data_size ) )
 		{
 			break;
 		}
@@ -624,14 +1477,34 @@ int lzvn_decompress(
 			if( ( (size_t) literal_size > *uncompressed_data_size )
 			 || ( uncompressed_data_offset > ( *uncompressed_data_size - literal_size ) ) )
 			{
-				libcerror_error_set(
-				 error,
-				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-				 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
-				 "%s: literal size value exceeds uncompressed data size.",
-				 function );
+				if( maximum_uncompressed_data_size <= *uncompressed_data_size )
+				{
+					libcerror_error_set(
+					 error,
+					 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+					 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+					 "%s: literal size value exceeds uncompressed data size.",
+					 function );
 
-				return( -1 );
+					return( -1 );
+				}
+				if( lzvn_resize_uncompressed_data(
+				     uncompressed_data,
+				     uncompressed_data_size,
+				     uncompressed_data_offset + literal_size,
+				     maximum_uncompressed_data_size,
+				     error ) != 1 )
+				{
+					libcerror_error_set(
+					 error,
+					 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+					 LIBCERROR_RUNTIME_ERROR_RESIZE_FAILED,
+					 "%s: unable to resize uncompressed data.",
+					 function );
+
+					return( -1 );
+				}
+				output_data = *uncompressed_data;
 			}
 #if defined( HAVE_DEBUG_OUTPUT )
 			if( libcnotify_verbose != 0 )
@@ -646,7 +1519,7 @@ int lzvn_decompress(
 			}
 #endif
 			if( memory_copy(
-			     &( uncompressed_data[ uncompressed_data_offset ] ),
+			     &( output_data[ uncompressed_data_offset ] ),
 			     &( compressed_data[ compressed_data_offset ] ),
 			     (size_t) literal_size ) == NULL )
 			{
@@ -664,35 +1537,64 @@ int lzvn_decompress(
 		}
 		if( match_size > 0 )
 		{
-			if( (size_t) distance > uncompressed_data_offset )
+			if( distance == 0 )
 			{
 				libcerror_error_set(
 				 error,
 				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
 				 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
-				 "%s: distance value exceeds uncompressed data offset.",
+				 "%s: invalid distance value out of bounds.",
 				 function );
 
 				return( -1 );
 			}
-			match_offset = uncompressed_data_offset - distance;
-
-			if( ( (size_t) match_size > *uncompressed_data_size )
-			 || ( uncompressed_data_offset > ( *uncompressed_data_size - match_size ) ) )
+			if( (size_t) distance > uncompressed_data_offset )
 			{
 				libcerror_error_set(
 				 error,
 				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
 				 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
-				 "%s: match size value exceeds uncompressed data size.",
+				 "%s: distance value exceeds uncompressed data offset.",
 				 function );
 
 				return( -1 );
 			}
+			if( ( (size_t) match_size > *uncompressed_data_size )
+			 || ( uncompressed_data_offset > ( *uncompressed_data_size - match_size ) ) )
+			{
+				if( maximum_uncompressed_data_size <= *uncompressed_data_size )
+				{
+					libcerror_error_set(
+					 error,
+					 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+					 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+					 "%s: match size value exceeds uncompressed data size.",
+					 function );
+
+					return( -1 );
+				}
+				if( lzvn_resize_uncompressed_data(
+				     uncompressed_data,
+				     uncompressed_data_size,
+				     uncompressed_data_offset + match_size,
+				     maximum_uncompressed_data_size,
+				     error ) != 1 )
+				{
+					libcerror_error_set(
+					 error,
+					 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+					 LIBCERROR_RUNTIME_ERROR_RESIZE_FAILED,
+					 "%s: unable to resize uncompressed data.",
+					 function );
+
+					return( -1 );
+				}
+				output_data = *uncompressed_data;
+			}
 #if defined( HAVE_DEBUG_OUTPUT )
 			if( libcnotify_verbose != 0 )
 			{
-				debug_match_offset = match_offset;
+				debug_match_offset = uncompressed_data_offset - distance;
 
 				libcnotify_printf(
 				 "%s: match offset\t\t\t\t\t\t: 0x%" PRIzx "\n",
@@ -700,12 +1602,14 @@ int lzvn_decompress(
 				 debug_match_offset );
 			}
 #endif
-			while( match_size > 0 )
-			{
-				uncompressed_data[ uncompressed_data_offset++ ] = uncompressed_data[ match_offset++ ];
-
-				match_size--;
-			}
+			lz_match_copy(
+			 output_data,
+			 *uncompressed_data_size,
+			 uncompressed_data_offset,
+			 (size_t) distance,
+			 (size_t) match_size );
+
+			uncompressed_data_offset += (size_t) match_size;
 #if defined( HAVE_DEBUG_OUTPUT )
 			if( libcnotify_verbose != 0 )
 			{
@@ -713,7 +1617,7 @@ int lzvn_decompress(
 				 "%s: match:\n",
 				 function );
 				libcnotify_print_data(
-				 &( uncompressed_data[ debug_match_offset ] ),
+				 &( output_data[ debug_match_offset ] ),
 				 match_size,
 				 LIBCNOTIFY_PRINT_DATA_FLAG_GROUP_DATA );
 			}
@@ -725,3 +1629,156 @@ int lzvn_decompress(
 	return( 1 );
 }
 
+/* Decompresses LZVN compressed data
+ * Returns 1 on success or -1 on error
+ */
+int lzvn_decompress(
+     const uint8_t *compressed_data,
+     size_t compressed_data_size,
+     uint8_t *uncompressed_data,
+     size_t *uncompressed_data_size,
+     libcerror_error_t **error )
+{
+	return( lzvn_decompress_data(
+	         compressed_data,
+	         compressed_data_size,
+	         &uncompressed_data,
+	         uncompressed_data_size,
+	         0,
+	         error ) );
+}
+
+/* Decompresses LZVN compressed data into a newly allocated buffer
+ * The buffer is initially sized using the uncompressed data size, if not 0,
+ * or otherwise 4 times the compressed data size. If the uncompressed data
+ * is larger the buffer is doubled in size while decompressing, without
+ * restarting the decompression
+ * The uncompressed data must be freed with memory_free
+ * Returns 1 on success or -1 on error
+ */
+int lzvn_decompress_allocate(
+     const uint8_t *compressed_data,
+     size_t compressed_data_size,
+     uint8_t **uncompressed_data,
+     size_t *uncompressed_data_size,
+     libcerror_error_t **error )
+{
+	static char *function                 = "lzvn_decompress_allocate";
+	size_t maximum_uncompressed_data_size = 0;
+	size_t safe_uncompressed_data_size    = 0;
+
+	if( compressed_data_size > (size_t) SSIZE_MAX )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid compressed data size value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	if( uncompressed_data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid uncompressed data.",
+		 function );
+
+		return( -1 );
+	}
+	if( *uncompressed_data != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid uncompressed data value already set.",
+		 function );
+
+		return( -1 );
+	}
+	if( uncompressed_data_size == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid uncompressed data size.",
+		 function );
+
+		return( -1 );
+	}
+	/* A large match oppcode of 2 bytes represents at most 271 bytes
+	 * hence a byte of compressed data can represent at most 136 bytes
+	 */
+	if( compressed_data_size > (size_t) ( SSIZE_MAX / 136 ) )
+	{
+		maximum_uncompressed_data_size = (size_t) SSIZE_MAX;
+	}
+	else
+	{
+		maximum_uncompressed_data_size = compressed_data_size * 136;
+	}
+	safe_uncompressed_data_size = *uncompressed_data_size;
+
+	if( safe_uncompressed_data_size == 0 )
+	{
+		safe_uncompressed_data_size = compressed_data_size * 4;
+	}
+	if( safe_uncompressed_data_size > maximum_uncompressed_data_size )
+	{
+		safe_uncompressed_data_size = maximum_uncompressed_data_size;
+	}
+	if( safe_uncompressed_data_size == 0 )
+	{
+		safe_uncompressed_data_size = 1;
+	}
+	*uncompressed_data = (uint8_t *) memory_allocate(
+	                                  sizeof( uint8_t ) * safe_uncompressed_data_size );
+
+	if( *uncompressed_data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create uncompressed data.",
+		 function );
+
+		goto on_error;
+	}
+	if( lzvn_decompress_data(
+	     compressed_data,
+	     compressed_data_size,
+	     uncompressed_data,
+	     &safe_uncompressed_data_size,
+	     maximum_uncompressed_data_size,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_COMPRESSION,
+		 LIBCERROR_COMPRESSION_ERROR_DECOMPRESS_FAILED,
+		 "%s: unable to decompress data.",
+		 function );
+
+		goto on_error;
+	}
+	*uncompressed_data_size = safe_uncompressed_data_size;
+
+	return( 1 );
+
+on_error:
+	if( *uncompressed_data != NULL )
+	{
+		memory_free(
+		 *uncompressed_data );
+
+		*uncompressed_data = NULL;
+	}
+	return( -1 );
+}
+
@@ -31,6 +31,27 @@
 extern "C" {
 #endif
 
+/* The number of bits of the string hash used by the compressor
+ */
+#define LZVN_COMPRESSOR_HASH_NUMBER_OF_BITS	14
+
+typedef struct lzvn_compressor lzvn_compressor_t;
+
+struct lzvn_compressor
+{
+	/* The hash table
+	 * an entry contains the offset + 1 of the last string with the hash or 0 if not set
+	 */
+	uint32_t hash_table[ 1 << LZVN_COMPRESSOR_HASH_NUMBER_OF_BITS ];
+};
+
+int lzvn_compress(
+     const uint8_t *uncompressed_data,
+     size_t uncompressed_data_size,
+     uint8_t *compressed_data,
+     size_t *compressed_data_size,
+     libcerror_error_t **error );
+
 int lzvn_decompress(
      const uint8_t *compressed_data,
      size_t compressed_data_size,
@@ -38,6 +59,13 @@ int lzvn_decompress(
      size_t *uncompressed_data_size,
      libcerror_error_t **error );
 
+int lzvn_decompress_allocate(
+     const uint8_t *compressed_data,
+     size_t compressed_data_size,
+     uint8_t **uncompressed_data,
+     size_t *uncompressed_data_size,
+     libcerror_error_t **error );
+
 #if defined( __cplusplus )
 }
 #endif
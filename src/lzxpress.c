@@ -0,0 +1,951 @@
+/*
+ * LZXPRESS Huffman decompression functions
+ *
+ * Copyright (C) 2008-2019, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This software is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This software is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this software.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <byte_stream.h>
+#include <lz_match.h>
+#include <memory.h>
+#include <types.h>
+
+#include "assorted_libcerror.h"
+#include "assorted_libcnotify.h"
+#include "lzxpress.h"
+
+/* The maximum size of a Huffman code
+ */
+#define LZXPRESS_HUFFMAN_MAXIMUM_CODE_SIZE	15
+
+/* Adds the next 16-bit value of the byte stream to the bit buffer
+ * The values are read at the same points as defined by the format
+ * since the extended match sizes are stored in between the values
+ * Past the end of the byte stream the value is 0
+ */
+static void lzxpress_bit_stream_refill(
+             lzxpress_bit_stream_t *bit_stream )
+{
+	uint16_t value_16bit = 0;
+
+	if( ( bit_stream->byte_stream_size - bit_stream->byte_stream_offset ) >= 2 )
+	{
+		byte_stream_copy_to_uint16_little_endian(
+		 &( bit_stream->byte_stream[ bit_stream->byte_stream_offset ] ),
+		 value_16bit );
+
+		bit_stream->byte_stream_offset += 2;
+	}
+	else
+	{
+		if( bit_stream->byte_stream_offset < bit_stream->byte_stream_size )
+		{
+			value_16bit = bit_stream->byte_stream[ bit_stream->byte_stream_offset ];
+
+			bit_stream->byte_stream_offset += 1;
+		}
+		bit_stream->number_of_padding_values += 1;
+	}
+	bit_stream->bit_buffer     <<= 16;
+	bit_stream->bit_buffer      |= value_16bit;
+	bit_stream->bit_buffer_size += 16;
+}
+
+/* Constructs the Huffman table from the 4-bit code sizes of the 512 symbols
+ * The lookup table has the same layout as that of deflate, but is indexed
+ * by the most significant bits of the code, since LZXPRESS stores codes
+ * with the most significant bit first
+ * Returns 1 on success or -1 on error
+ */
+int lzxpress_huffman_table_construct(
+     lzxpress_huffman_table_t *table,
+     const uint8_t *code_sizes_table,
+     libcerror_error_t **error )
+{
+	uint16_t codes_array[ LZXPRESS_HUFFMAN_NUMBER_OF_SYMBOLS ];
+	uint8_t code_sizes_array[ LZXPRESS_HUFFMAN_NUMBER_OF_SYMBOLS ];
+
+	int code_counts_array[ 16 ];
+	int code_offsets_array[ 16 ];
+	int remaining_code_counts_array[ 16 ];
+
+	static char *function                  = "lzxpress_huffman_table_construct";
+	uint32_t huffman_code                  = 0;
+	uint16_t lookup_value                  = 0;
+	uint16_t symbol                        = 0;
+	uint8_t bit_index                      = 0;
+	uint8_t code_size                      = 0;
+	uint8_t secondary_table_number_of_bits = 0;
+	int code_index                         = 0;
+	int left_value                         = 0;
+	int lookup_table_index                 = 0;
+	int next_secondary_table_offset        = 0;
+	int primary_table_index                = 0;
+	int secondary_table_offset             = 0;
+
+	if( table == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid table.",
+		 function );
+
+		return( -1 );
+	}
+	if( code_sizes_table == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid code sizes table.",
+		 function );
+
+		return( -1 );
+	}
+	if( memory_set(
+	     code_counts_array,
+	     0,
+	     sizeof( int ) * 16 ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear code counts array.",
+		 function );
+
+		return( -1 );
+	}
+	if( memory_set(
+	     table->lookup_table,
+	     0,
+	     sizeof( uint16_t ) << LZXPRESS_HUFFMAN_LOOKUP_TABLE_NUMBER_OF_BITS ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear primary lookup table.",
+		 function );
+
+		return( -1 );
+	}
+	/* The code size of an even symbol is stored in the lower nibble
+	 * and that of an odd symbol in the upper nibble
+	 */
+	for( symbol = 0;
+	     symbol < LZXPRESS_HUFFMAN_NUMBER_OF_SYMBOLS;
+	     symbol += 2 )
+	{
+		code_sizes_array[ symbol ]     = code_sizes_table[ symbol / 2 ] & 0x0f;
+		code_sizes_array[ symbol + 1 ] = code_sizes_table[ symbol / 2 ] >> 4;
+
+		code_counts_array[ code_sizes_array[ symbol ] ]     += 1;
+		code_counts_array[ code_sizes_array[ symbol + 1 ] ] += 1;
+	}
+	if( code_counts_array[ 0 ] == LZXPRESS_HUFFMAN_NUMBER_OF_SYMBOLS )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid code sizes table - missing codes.",
+		 function );
+
+		return( -1 );
+	}
+	/* Check if the set of code sizes is over-subscribed
+	 */
+	left_value = 1;
+
+	for( bit_index = 1;
+	     bit_index <= LZXPRESS_HUFFMAN_MAXIMUM_CODE_SIZE;
+	     bit_index++ )
+	{
+		left_value <<= 1;
+		left_value  -= code_counts_array[ bit_index ];
+
+		if( left_value < 0 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+			 "%s: code sizes are over-subscribed.",
+			 function );
+
+			return( -1 );
+		}
+	}
+	/* Sort the symbols by code size and symbol value
+	 */
+	code_offsets_array[ 0 ] = 0;
+	code_offsets_array[ 1 ] = 0;
+
+	for( bit_index = 1;
+	     bit_index < LZXPRESS_HUFFMAN_MAXIMUM_CODE_SIZE;
+	     bit_index++ )
+	{
+		code_offsets_array[ bit_index + 1 ] = code_offsets_array[ bit_index ]
+		                                    + code_counts_array[ bit_index ];
+	}
+	for( symbol = 0;
+	     symbol < LZXPRESS_HUFFMAN_NUMBER_OF_SYMBOLS;
+	     symbol++ )
+	{
+		code_size = code_sizes_array[ symbol ];
+
+		if( code_size != 0 )
+		{
+			codes_array[ code_offsets_array[ code_size ]++ ] = symbol;
+		}
+	}
+	/* Construct the lookup table from the canonical Huffman codes
+	 * the primary table is indexed by the first 10 bits of the code
+	 * and codes larger than 10 bits are stored in a secondary table
+	 * that is indexed by the remaining bits
+	 */
+	for( bit_index = 0;
+	     bit_index < 16;
+	     bit_index++ )
+	{
+		remaining_code_counts_array[ bit_index ] = code_counts_array[ bit_index ];
+	}
+	primary_table_index         = -1;
+	next_secondary_table_offset = 1 << LZXPRESS_HUFFMAN_LOOKUP_TABLE_NUMBER_OF_BITS;
+
+	for( code_size = 1;
+	     code_size <= LZXPRESS_HUFFMAN_MAXIMUM_CODE_SIZE;
+	     code_size++ )
+	{
+		while( remaining_code_counts_array[ code_size ] > 0 )
+		{
+			symbol       = codes_array[ code_index++ ];
+			lookup_value = (uint16_t) ( ( (uint16_t) code_size << 9 ) | symbol );
+
+			if( code_size <= LZXPRESS_HUFFMAN_LOOKUP_TABLE_NUMBER_OF_BITS )
+			{
+				for( lookup_table_index = (int) ( huffman_code << ( LZXPRESS_HUFFMAN_LOOKUP_TABLE_NUMBER_OF_BITS - code_size ) );
+				     lookup_table_index < (int) ( ( huffman_code + 1 ) << ( LZXPRESS_HUFFMAN_LOOKUP_TABLE_NUMBER_OF_BITS - code_size ) );
+				     lookup_table_index++ )
+				{
+					table->lookup_table[ lookup_table_index ] = lookup_value;
+				}
+			}
+			else
+			{
+				if( (int) ( huffman_code >> ( code_size - LZXPRESS_HUFFMAN_LOOKUP_TABLE_NUMBER_OF_BITS ) ) != primary_table_index )
+				{
+					primary_table_index = (int) ( huffman_code >> ( code_size - LZXPRESS_HUFFMAN_LOOKUP_TABLE_NUMBER_OF_BITS ) );
+
+					/* Determine the number of bits of the secondary table from the code sizes
+					 * that remain, which are stored consecutively for the same primary index
+					 */
+					secondary_table_number_of_bits = (uint8_t) ( code_size - LZXPRESS_HUFFMAN_LOOKUP_TABLE_NUMBER_OF_BITS );
+
+					left_value = 1 << secondary_table_number_of_bits;
+
+					while( ( secondary_table_number_of_bits + LZXPRESS_HUFFMAN_LOOKUP_TABLE_NUMBER_OF_BITS ) < LZXPRESS_HUFFMAN_MAXIMUM_CODE_SIZE )
+					{
+						left_value -= remaining_code_counts_array[ secondary_table_number_of_bits + LZXPRESS_HUFFMAN_LOOKUP_TABLE_NUMBER_OF_BITS ];
+
+						if( left_value <= 0 )
+						{
+							break;
+						}
+						secondary_table_number_of_bits++;
+
+						left_value <<= 1;
+					}
+					if( ( next_secondary_table_offset + ( 1 << secondary_table_number_of_bits ) ) > LZXPRESS_HUFFMAN_LOOKUP_TABLE_SIZE )
+					{
+						libcerror_error_set(
+						 error,
+						 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+						 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+						 "%s: invalid secondary lookup table offset value out of bounds.",
+						 function );
+
+						return( -1 );
+					}
+					secondary_table_offset = next_secondary_table_offset;
+
+					if( memory_set(
+					     &( table->lookup_table[ secondary_table_offset ] ),
+					     0,
+					     sizeof( uint16_t ) << secondary_table_number_of_bits ) == NULL )
+					{
+						libcerror_error_set(
+						 error,
+						 LIBCERROR_ERROR_DOMAIN_MEMORY,
+						 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+						 "%s: unable to clear secondary lookup table.",
+						 function );
+
+						return( -1 );
+					}
+					table->lookup_table[ primary_table_index ] = (uint16_t) ( 0x8000 | ( secondary_table_number_of_bits << 12 ) | secondary_table_offset );
+
+					next_secondary_table_offset += 1 << secondary_table_number_of_bits;
+				}
+				/* The remaining bits of the code are the most significant bits of the secondary table index
+				 */
+				lookup_table_index = (int) ( huffman_code & ( ( 1UL << ( code_size - LZXPRESS_HUFFMAN_LOOKUP_TABLE_NUMBER_OF_BITS ) ) - 1 ) );
+				lookup_table_index <<= secondary_table_number_of_bits + LZXPRESS_HUFFMAN_LOOKUP_TABLE_NUMBER_OF_BITS - code_size;
+
+				for( left_value = 1 << ( secondary_table_number_of_bits + LZXPRESS_HUFFMAN_LOOKUP_TABLE_NUMBER_OF_BITS - code_size );
+				     left_value > 0;
+				     left_value-- )
+				{
+					table->lookup_table[ secondary_table_offset + lookup_table_index++ ] = lookup_value;
+				}
+			}
+			remaining_code_counts_array[ code_size ] -= 1;
+
+			huffman_code++;
+		}
+		huffman_code <<= 1;
+	}
+	return( 1 );
+}
+
+/* Resizes the uncompressed data to contain at least required size bytes
+ * The size of the uncompressed data is doubled, to prevent resizing it for
+ * every block, but limited to maximum size
+ * Returns 1 on success or -1 on error
+ */
+static int lzxpress_resize_uncompressed_data(
+            uint8_t **uncompressed_data,
+            size_t *uncompressed_data_size,
+            size_t required_size,
+            size_t maximum_size,
+            libcerror_error_t **error )
+{
+	uint8_t *reallocation = NULL;
+	static char *function = "lzxpress_resize_uncompressed_data";
+	size_t new_size       = 0;
+
+	if( required_size > maximum_size )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid required size value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	new_size = *uncompressed_data_size;
+
+	if( new_size <= ( maximum_size / 2 ) )
+	{
+		new_size *= 2;
+	}
+	else
+	{
+		new_size = maximum_size;
+	}
+	if( new_size < required_size )
+	{
+		new_size = required_size;
+	}
+	reallocation = (uint8_t *) memory_reallocate(
+	                            *uncompressed_data,
+	                            sizeof( uint8_t ) * new_size );
+
+	if( reallocation == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to resize uncompressed data.",
+		 function );
+
+		return( -1 );
+	}
+	*uncompressed_data      = reallocation;
+	*uncompressed_data_size = new_size;
+
+	return( 1 );
+}
+
+/* Decompresses LZXPRESS Huffman compressed data
+ * Every block consists of the code sizes table followed by the Huffman encoded
+ * data of 65536 bytes of uncompressed data. Decompression stops at the end of
+ * the compressed data, at the end-of-stream symbol or, if the uncompressed data
+ * is not resized, when the uncompressed data is full
+ * If maximum uncompressed data size is not 0 the uncompressed data is resized
+ * when needed up to that size, which requires the uncompressed data to be
+ * allocated by memory_allocate
+ * Returns 1 on success or -1 on error
+ */
+static int lzxpress_huffman_decompress_data(
+            const uint8_t *compressed_data,
+            size_t compressed_data_size,
+            uint8_t **uncompressed_data,
+            size_t *uncompressed_data_size,
+            size_t maximum_uncompressed_data_size,
+            libcerror_error_t **error )
+{
+	lzxpress_bit_stream_t bit_stream;
+	lzxpress_huffman_table_t table;
+
+	uint8_t *output_data            = NULL;
+	static char *function           = "lzxpress_huffman_decompress_data";
+	size_t block_end_offset         = 0;
+	size_t distance                 = 0;
+	size_t match_size               = 0;
+	size_t uncompressed_data_end    = 0;
+	size_t uncompressed_data_offset = 0;
+	uint32_t value_32bit            = 0;
+	uint16_t lookup_value           = 0;
+	uint16_t symbol                 = 0;
+	uint16_t value_16bit            = 0;
+	uint8_t number_of_bits          = 0;
+	int lookup_table_index          = 0;
+
+	if( compressed_data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid compressed data.",
+		 function );
+
+		return( -1 );
+	}
+	if( compressed_data_size > (size_t) SSIZE_MAX )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid compressed data size value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	if( uncompressed_data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid uncompressed data.",
+		 function );
+
+		return( -1 );
+	}
+	if( *uncompressed_data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid uncompressed data.",
+		 function );
+
+		return( -1 );
+	}
+	if( uncompressed_data_size == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid uncompressed data size.",
+		 function );
+
+		return( -1 );
+	}
+	if( *uncompressed_data_size > (size_t) SSIZE_MAX )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid uncompressed data size value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	output_data = *uncompressed_data;
+
+	bit_stream.byte_stream        = compressed_data;
+	bit_stream.byte_stream_size   = compressed_data_size;
+	bit_stream.byte_stream_offset = 0;
+
+	while( bit_stream.byte_stream_offset < compressed_data_size )
+	{
+		if( ( compressed_data_size - bit_stream.byte_stream_offset ) < LZXPRESS_HUFFMAN_CODE_SIZES_TABLE_SIZE )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+			 LIBCERROR_ARGUMENT_ERROR_VALUE_TOO_SMALL,
+			 "%s: compressed data size value too small.",
+			 function );
+
+			return( -1 );
+		}
+#if defined( HAVE_DEBUG_OUTPUT )
+		if( libcnotify_verbose != 0 )
+		{
+			libcnotify_printf(
+			 "%s: code sizes table:\n",
+			 function );
+			libcnotify_print_data(
+			 &( compressed_data[ bit_stream.byte_stream_offset ] ),
+			 LZXPRESS_HUFFMAN_CODE_SIZES_TABLE_SIZE,
+			 0 );
+		}
+#endif
+		if( lzxpress_huffman_table_construct(
+		     &table,
+		     &( compressed_data[ bit_stream.byte_stream_offset ] ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+			 "%s: unable to construct Huffman table.",
+			 function );
+
+			return( -1 );
+		}
+		bit_stream.byte_stream_offset      += LZXPRESS_HUFFMAN_CODE_SIZES_TABLE_SIZE;
+		bit_stream.bit_buffer               = 0;
+		bit_stream.bit_buffer_size          = 0;
+		bit_stream.number_of_padding_values = 0;
+
+		lzxpress_bit_stream_refill(
+		 &bit_stream );
+		lzxpress_bit_stream_refill(
+		 &bit_stream );
+
+		/* A match can continue past the end of the block, in which case
+		 * the next block starts at the end of the match
+		 */
+		if( uncompressed_data_offset > ( (size_t) SSIZE_MAX - LZXPRESS_HUFFMAN_BLOCK_SIZE ) )
+		{
+			block_end_offset = (size_t) SSIZE_MAX;
+		}
+		else
+		{
+			block_end_offset = uncompressed_data_offset + LZXPRESS_HUFFMAN_BLOCK_SIZE;
+		}
+		while( uncompressed_data_offset < block_end_offset )
+		{
+			/* Check the size of the uncompressed data once per block, or when it is full
+			 * instead of for every literal
+			 */
+			uncompressed_data_end = *uncompressed_data_size;
+
+			if( uncompressed_data_end > block_end_offset )
+			{
+				uncompressed_data_end = block_end_offset;
+			}
+			if( uncompressed_data_offset >= uncompressed_data_end )
+			{
+				if( maximum_uncompressed_data_size <= *uncompressed_data_size )
+				{
+					break;
+				}
+				if( lzxpress_resize_uncompressed_data(
+				     uncompressed_data,
+				     uncompressed_data_size,
+				     uncompressed_data_offset + 1,
+				     maximum_uncompressed_data_size,
+				     error ) != 1 )
+				{
+					libcerror_error_set(
+					 error,
+					 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+					 LIBCERROR_RUNTIME_ERROR_RESIZE_FAILED,
+					 "%s: unable to resize uncompressed data.",
+					 function );
+
+					return( -1 );
+				}
+				output_data = *uncompressed_data;
+
+				continue;
+			}
+			while( uncompressed_data_offset < uncompressed_data_end )
+			{
+				/* The bit buffer contains at least 16 bits
+				 */
+				value_16bit = (uint16_t) ( bit_stream.bit_buffer >> ( bit_stream.bit_buffer_size - LZXPRESS_HUFFMAN_MAXIMUM_CODE_SIZE ) ) & 0x7fff;
+
+				lookup_value = table.lookup_table[ value_16bit >> ( LZXPRESS_HUFFMAN_MAXIMUM_CODE_SIZE - LZXPRESS_HUFFMAN_LOOKUP_TABLE_NUMBER_OF_BITS ) ];
+
+				if( ( lookup_value & 0x8000 ) != 0 )
+				{
+					number_of_bits     = (uint8_t) ( ( lookup_value >> 12 ) & 0x07 );
+					lookup_table_index = (int) ( lookup_value & 0x0fff );
+
+					lookup_table_index += (int) ( ( value_16bit >> ( LZXPRESS_HUFFMAN_MAXIMUM_CODE_SIZE - LZXPRESS_HUFFMAN_LOOKUP_TABLE_NUMBER_OF_BITS - number_of_bits ) ) & ( ( 1UL << number_of_bits ) - 1 ) );
+
+					lookup_value = table.lookup_table[ lookup_table_index ];
+				}
+				number_of_bits = (uint8_t) ( ( lookup_value >> 9 ) & 0x0f );
+
+				if( ( number_of_bits == 0 )
+				 || ( bit_stream.number_of_padding_values > 2 ) )
+				{
+					libcerror_error_set(
+					 error,
+					 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+					 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+					 "%s: invalid Huffman encoded value.",
+					 function );
+
+					return( -1 );
+				}
+				bit_stream.bit_buffer_size -= number_of_bits;
+
+				if( bit_stream.bit_buffer_size < 16 )
+				{
+					lzxpress_bit_stream_refill(
+					 &bit_stream );
+				}
+				symbol = lookup_value & 0x01ff;
+
+				if( symbol < 256 )
+				{
+					output_data[ uncompressed_data_offset++ ] = (uint8_t) symbol;
+
+					continue;
+				}
+				if( ( symbol == 256 )
+				 && ( bit_stream.byte_stream_offset >= compressed_data_size ) )
+				{
+					*uncompressed_data_size = uncompressed_data_offset;
+
+					return( 1 );
+				}
+				symbol -= 256;
+
+				match_size     = symbol & 0x000f;
+				number_of_bits = (uint8_t) ( symbol >> 4 );
+
+				if( match_size == 15 )
+				{
+					if( bit_stream.byte_stream_offset >= compressed_data_size )
+					{
+						libcerror_error_set(
+						 error,
+						 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+						 LIBCERROR_ARGUMENT_ERROR_VALUE_TOO_SMALL,
+						 "%s: compressed data size value too small.",
+						 function );
+
+						return( -1 );
+					}
+					match_size = compressed_data[ bit_stream.byte_stream_offset++ ];
+
+					if( match_size == 255 )
+					{
+						if( ( compressed_data_size - bit_stream.byte_stream_offset ) < 2 )
+						{
+							libcerror_error_set(
+							 error,
+							 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+							 LIBCERROR_ARGUMENT_ERROR_VALUE_TOO_SMALL,
+							 "%s: compressed data size value too small.",
+							 function );
+
+							return( -1 );
+						}
+						byte_stream_copy_to_uint16_little_endian(
+						 &( compressed_data[ bit_stream.byte_stream_offset ] ),
+						 value_16bit );
+
+						bit_stream.byte_stream_offset += 2;
+
+						value_32bit = value_16bit;
+
+						if( value_32bit == 0 )
+						{
+							if( ( compressed_data_size - bit_stream.byte_stream_offset ) < 4 )
+							{
+								libcerror_error_set(
+								 error,
+								 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+								 LIBCERROR_ARGUMENT_ERROR_VALUE_TOO_SMALL,
+								 "%s: compressed data size value too small.",
+								 function );
+
+								return( -1 );
+							}
+							byte_stream_copy_to_uint32_little_endian(
+							 &( compressed_data[ bit_stream.byte_stream_offset ] ),
+							 value_32bit );
+
+							bit_stream.byte_stream_offset += 4;
+						}
+						if( value_32bit < 15 )
+						{
+							libcerror_error_set(
+							 error,
+							 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+							 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+							 "%s: invalid match size value out of bounds.",
+							 function );
+
+							return( -1 );
+						}
+						match_size = (size_t) value_32bit - 15;
+					}
+					match_size += 15;
+				}
+				match_size += 3;
+
+				distance = (size_t) 1 << number_of_bits;
+
+				if( number_of_bits > 0 )
+				{
+					distance += (size_t) ( ( bit_stream.bit_buffer >> ( bit_stream.bit_buffer_size - number_of_bits ) ) & ( ( 1UL << number_of_bits ) - 1 ) );
+
+					bit_stream.bit_buffer_size -= number_of_bits;
+
+					if( bit_stream.bit_buffer_size < 16 )
+					{
+						lzxpress_bit_stream_refill(
+						 &bit_stream );
+					}
+				}
+				if( distance > uncompressed_data_offset )
+				{
+					libcerror_error_set(
+					 error,
+					 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+					 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+					 "%s: invalid match distance value out of bounds.",
+					 function );
+
+					return( -1 );
+				}
+				if( match_size > ( *uncompressed_data_size - uncompressed_data_offset ) )
+				{
+					if( ( maximum_uncompressed_data_size <= *uncompressed_data_size )
+					 || ( match_size > ( maximum_uncompressed_data_size - uncompressed_data_offset ) ) )
+					{
+						libcerror_error_set(
+						 error,
+						 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+						 LIBCERROR_ARGUMENT_ERROR_VALUE_TOO_SMALL,
+						 "%s: uncompressed data size value too small.",
+						 function );
+
+						return( -1 );
+					}
+					if( lzxpress_resize_uncompressed_data(
+					     uncompressed_data,
+					     uncompressed_data_size,
+					     uncompressed_data_offset + match_size,
+					     maximum_uncompressed_data_size,
+					     error ) != 1 )
+					{
+						libcerror_error_set(
+						 error,
+						 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+						 LIBCERROR_RUNTIME_ERROR_RESIZE_FAILED,
+						 "%s: unable to resize uncompressed data.",
+						 function );
+
+						return( -1 );
+					}
+					output_data = *uncompressed_data;
+				}
+				lz_match_copy(
+				 output_data,
+				 *uncompressed_data_size,
+				 uncompressed_data_offset,
+				 distance,
+				 match_size );
+
+				uncompressed_data_offset += match_size;
+			}
+		}
+		if( ( uncompressed_data_offset < block_end_offset )
+		 && ( maximum_uncompressed_data_size <= *uncompressed_data_size ) )
+		{
+			break;
+		}
+		/* The next block starts after the last 16-bit value read into the bit buffer
+		 */
+	}
+	*uncompressed_data_size = uncompressed_data_offset;
+
+	return( 1 );
+}
+
+/* Decompresses LZXPRESS Huffman compressed data
+ * Returns 1 on success or -1 on error
+ */
+int lzxpress_huffman_decompress(
+     const uint8_t *compressed_data,
+     size_t compressed_data_size,
+     uint8_t *uncompressed_data,
+     size_t *uncompressed_data_size,
+     libcerror_error_t **error )
+{
+	return( lzxpress_huffman_decompress_data(
+	         compressed_data,
+	         compressed_data_size,
+	         &uncompressed_data,
+	         uncompressed_data_size,
+	         0,
+	         error ) );
+}
+
+/* Decompresses LZXPRESS Huffman compressed data into a newly allocated buffer
+ * The buffer is initially sized using the uncompressed data size, if not 0,
+ * or otherwise 4 times the compressed data size. If the uncompressed data
+ * is larger the buffer is doubled in size while decompressing, without
+ * restarting the decompression
+ * The uncompressed data must be freed with memory_free
+ * Returns 1 on success or -1 on error
+ */
+int lzxpress_huffman_decompress_allocate(
+     const uint8_t *compressed_data,
+     size_t compressed_data_size,
+     uint8_t **uncompressed_data,
+     size_t *uncompressed_data_size,
+     libcerror_error_t **error )
+{
+	static char *function                 = "lzxpress_huffman_decompress_allocate";
+	size_t maximum_uncompressed_data_size = 0;
+	size_t safe_uncompressed_data_size    = 0;
+
+	if( compressed_data_size > (size_t) SSIZE_MAX )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid compressed data size value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	if( uncompressed_data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid uncompressed data.",
+		 function );
+
+		return( -1 );
+	}
+	if( *uncompressed_data != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid uncompressed data value already set.",
+		 function );
+
+		return( -1 );
+	}
+	if( uncompressed_data_size == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid uncompressed data size.",
+		 function );
+
+		return( -1 );
+	}
+	/* A single match can represent up to 4 GiB of uncompressed data
+	 * hence the compressed data size does not usefully limit the buffer size
+	 */
+	maximum_uncompressed_data_size = (size_t) SSIZE_MAX;
+
+	safe_uncompressed_data_size = *uncompressed_data_size;
+
+	if( safe_uncompressed_data_size == 0 )
+	{
+		safe_uncompressed_data_size = compressed_data_size * 4;
+	}
+	if( safe_uncompressed_data_size > maximum_uncompressed_data_size )
+	{
+		safe_uncompressed_data_size = maximum_uncompressed_data_size;
+	}
+	if( safe_uncompressed_data_size == 0 )
+	{
+		safe_uncompressed_data_size = 1;
+	}
+	*uncompressed_data = (uint8_t *) memory_allocate(
+	                                  sizeof( uint8_t ) * safe_uncompressed_data_size );
+
+	if( *uncompressed_data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create uncompressed data.",
+		 function );
+
+		goto on_error;
+	}
+	if( lzxpress_huffman_decompress_data(
+	     compressed_data,
+	     compressed_data_size,
+	     uncompressed_data,
+	     &safe_uncompressed_data_size,
+	     maximum_uncompressed_data_size,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_COMPRESSION,
+		 LIBCERROR_COMPRESSION_ERROR_DECOMPRESS_FAILED,
+		 "%s: unable to decompress data.",
+		 function );
+
+		goto on_error;
+	}
+	*uncompressed_data_size = safe_uncompressed_data_size;
+
+	return( 1 );
+
+on_error:
+	if( *uncompressed_data != NULL )
+	{
+		memory_free(
+		 *uncompressed_data );
+
+		*uncompressed_data = NULL;
+	}
+	return( -1 );
+}
@@ -0,0 +1,127 @@
+/*
+ * LZXPRESS Huffman decompression functions
+ *
+ * Copyright (C) 2008-2019, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This software is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This software is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this software.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#if !defined( _LZXPRESS_H )
+#define _LZXPRESS_H
+
+#include <common.h>
+#include <types.h>
+
+#include "assorted_libcerror.h"
+
+#if defined( __cplusplus )
+extern "C" {
+#endif
+
+/* The number of symbols of the LZXPRESS Huffman code
+ * 256 literals and 256 combinations of match size and match distance bits
+ */
+#define LZXPRESS_HUFFMAN_NUMBER_OF_SYMBOLS		512
+
+/* The size of the table with the 4-bit code sizes of the symbols
+ * that precedes the Huffman encoded data of every block
+ */
+#define LZXPRESS_HUFFMAN_CODE_SIZES_TABLE_SIZE		256
+
+/* The number of bytes of uncompressed data represented by a block
+ */
+#define LZXPRESS_HUFFMAN_BLOCK_SIZE			65536
+
+/* The number of bits used to index the primary Huffman lookup table
+ */
+#define LZXPRESS_HUFFMAN_LOOKUP_TABLE_NUMBER_OF_BITS	10
+
+/* The number of entries of the Huffman lookup table
+ * this is the primary table of 1024 entries and the secondary tables
+ * for codes larger than 10 bits, where a secondary table of 2^n entries
+ * contains at least n + 1 codes, which for 512 symbols and a maximum
+ * code size of 15 bits require at most 2731 entries
+ */
+#define LZXPRESS_HUFFMAN_LOOKUP_TABLE_SIZE		4096
+
+typedef struct lzxpress_bit_stream lzxpress_bit_stream_t;
+
+struct lzxpress_bit_stream
+{
+	/* The byte stream
+	 */
+	const uint8_t *byte_stream;
+
+	/* The byte stream size
+	 */
+	size_t byte_stream_size;
+
+	/* The byte stream offset
+	 */
+	size_t byte_stream_offset;
+
+	/* The bit buffer
+	 * the bits are consumed from the most significant bit of the bit buffer size bits
+	 */
+	uint64_t bit_buffer;
+
+	/* The number of bits remaining in the bit buffer
+	 */
+	uint8_t bit_buffer_size;
+
+	/* The number of 16-bit values past the end of the byte stream
+	 * that were added to the bit buffer as 0
+	 */
+	uint8_t number_of_padding_values;
+};
+
+typedef struct lzxpress_huffman_table lzxpress_huffman_table_t;
+
+struct lzxpress_huffman_table
+{
+	/* The lookup table
+	 * an entry contains the symbol in bits 0 - 8 and the code size in bits 9 - 12
+	 * or a reference to a secondary table, indicated by bit 15, with the offset
+	 * of the secondary table in bits 0 - 11 and its number of bits in bits 12 - 14
+	 * an entry of 0 indicates an invalid Huffman code
+	 */
+	uint16_t lookup_table[ LZXPRESS_HUFFMAN_LOOKUP_TABLE_SIZE ];
+};
+
+int lzxpress_huffman_table_construct(
+     lzxpress_huffman_table_t *table,
+     const uint8_t *code_sizes_table,
+     libcerror_error_t **error );
+
+int lzxpress_huffman_decompress(
+     const uint8_t *compressed_data,
+     size_t compressed_data_size,
+     uint8_t *uncompressed_data,
+     size_t *uncompressed_data_size,
+     libcerror_error_t **error );
+
+int lzxpress_huffman_decompress_allocate(
+     const uint8_t *compressed_data,
+     size_t compressed_data_size,
+     uint8_t **uncompressed_data,
+     size_t *uncompressed_data_size,
+     libcerror_error_t **error );
+
+#if defined( __cplusplus )
+}
+#endif
+
+#endif /* !defined( _LZXPRESS_H ) */
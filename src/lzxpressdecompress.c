@@ -20,6 +20,7 @@
  */
 
 #include <common.h>
+#include <byte_stream.h>
 #include <file_stream.h>
 #include <memory.h>
 #include <system_string.h>
@@ -30,11 +31,82 @@
 #endif
 
 #include "assorted_getopt.h"
+#include "assorted_input_file.h"
 #include "assorted_libcerror.h"
 #include "assorted_libcfile.h"
 #include "assorted_libcnotify.h"
+#include "assorted_libcthreads.h"
 #include "assorted_libfwnt.h"
 #include "assorted_output.h"
+#include "assorted_output_file.h"
+#include "lzxpress.h"
+
+/* The maximum ratio of the uncompressed data size to the compressed data size
+ * up to which the uncompressed data buffer is resized
+ */
+#define LZXPRESSDECOMPRESS_MAXIMUM_COMPRESSION_RATIO	1024
+
+/* The maximum number of threads
+ */
+#define LZXPRESSDECOMPRESS_MAXIMUM_NUMBER_OF_THREADS	64
+
+typedef struct lzxpressdecompress_chunk lzxpressdecompress_chunk_t;
+
+struct lzxpressdecompress_chunk
+{
+	/* The offset of the chunk in the compressed data
+	 */
+	size_t compressed_data_offset;
+
+	/* The compressed data size of the chunk
+	 */
+	size_t compressed_data_size;
+
+	/* The offset of the chunk in the uncompressed data
+	 */
+	size_t uncompressed_data_offset;
+
+	/* The uncompressed data size of the chunk
+	 */
+	size_t uncompressed_data_size;
+
+	/* The result of the decompression
+	 */
+	int result;
+};
+
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+
+typedef struct lzxpressdecompress_thread_range lzxpressdecompress_thread_range_t;
+
+struct lzxpressdecompress_thread_range
+{
+	/* The compressed data
+	 */
+	const uint8_t *compressed_data;
+
+	/* The uncompressed data
+	 */
+	uint8_t *uncompressed_data;
+
+	/* The chunks
+	 */
+	lzxpressdecompress_chunk_t *chunks;
+
+	/* The number of chunks
+	 */
+	int number_of_chunks;
+
+	/* The index of the first chunk decompressed by the thread
+	 */
+	int first_chunk_index;
+
+	/* The number of chunks between the chunks decompressed by the thread
+	 */
+	int chunk_index_step;
+};
+
+#endif /* defined( HAVE_MULTI_THREAD_SUPPORT ) */
 
 #if defined( WINAPI )
 
@@ -101,11 +173,15 @@ void usage_fprint(
 	fprintf( stream, "Use lzxpressdecompress to decompress LZXPRESS compressed data.\n\n" );
 
 #if defined( WINAPI )
-	fprintf( stream, "Usage: lzxpressdecompress [ -d size ] [ -o offset ] [ -s size ]\n"
-	                 "                          [ -t target ] [ -1234hvV ] source\n\n" );
+	fprintf( stream, "Usage: lzxpressdecompress [ -d size ] [ -D window ] [ -j threads ]\n"
+	                 "                          [ -o offset ] [ -s size ] [ -S format ]\n"
+	                 "                          [ -t target ] [ -w chunk_size ]\n"
+	                 "                          [ -1234hvV ] source\n\n" );
 #else
-	fprintf( stream, "Usage: lzxpressdecompress [ -d size ] [ -o offset ] [ -s size ]\n"
-	                 "                          [ -t target ] [ -12hvV ] source\n\n" );
+	fprintf( stream, "Usage: lzxpressdecompress [ -d size ] [ -D window ] [ -j threads ]\n"
+	                 "                          [ -o offset ] [ -s size ] [ -S format ]\n"
+	                 "                          [ -t target ] [ -w chunk_size ]\n"
+	                 "                          [ -12hvV ] source\n\n" );
 #endif
 
 	fprintf( stream, "\tsource: the source file\n\n" );
@@ -116,18 +192,882 @@ void usage_fprint(
 	fprintf( stream, "\t-2:     use the WINAPI LZ77 + DIRECT2 decompression method\n" );
 	fprintf( stream, "\t-3:     use the WINAPI Huffman decompression method\n" );
 #endif
-	fprintf( stream, "\t-d:     size of the decompressed data (default is 65536).\n" );
+	fprintf( stream, "\t-d:     size of the decompressed data (default is to resize\n"
+	                 "\t        the buffer while decompressing, or 65536 for the\n"
+	                 "\t        WINAPI methods).\n" );
+	fprintf( stream, "\t-D:     limit the hexadecimal representation of the data to\n"
+	                 "\t        a window formatted as offset:size or offset relative\n"
+	                 "\t        to the start of the data (default is all data)\n" );
 	fprintf( stream, "\t-h:     shows this help\n" );
+	fprintf( stream, "\t-j:     number of threads (default is 1), the chunks of WOF\n"
+	                 "\t        compressed data are decompressed in parallel\n" );
 	fprintf( stream, "\t-o:     data offset (default is 0)\n" );
 	fprintf( stream, "\t-s:     size of data (default is the file size)\n" );
+	fprintf( stream, "\t-S:     print timing and throughput statistics of the open,\n"
+	                 "\t        read, compute and write phases and the peak memory\n"
+	                 "\t        size to stderr in the format: text or json\n" );
 	fprintf( stream, "\t-t:     specify the target file to write the output data,\n"
 	                 "\t        by default the data will be written to stdout in\n"
 	                 "\t        hexadecimal representation\n" );
 	fprintf( stream, "\t-v:     verbose output to stderr\n" );
 	fprintf( stream, "\t-V:     print version\n" );
+	fprintf( stream, "\t-w:     decompress Windows Overlay Filter (WOF) compressed data,\n"
+	                 "\t        such as the WofCompressedData stream, with the chunk size:\n"
+	                 "\t        4096 (XPRESS4K), 8192 (XPRESS8K) or 16384 (XPRESS16K)\n"
+	                 "\t        which requires the size of the decompressed data (-d)\n" );
 	fprintf( stream, "\n" );
 }
 
+/* Decompresses LZXPRESS compressed data into a newly allocated buffer
+ * The buffer is initially sized using the uncompressed data size and is
+ * doubled in size when the uncompressed data does not fit. libfwnt does not
+ * expose its decoder state hence the data is decompressed again after every
+ * resize, the doubling limits this to about twice the work of a single pass
+ * The uncompressed data must be freed with memory_free
+ * Returns 1 if successful or -1 on error
+ */
+int lzxpressdecompress_decompress_allocate(
+     const uint8_t *compressed_data,
+     size_t compressed_data_size,
+     int decompression_method,
+     uint8_t **uncompressed_data,
+     size_t *uncompressed_data_size,
+     libcerror_error_t **error )
+{
+	uint8_t *reallocation                 = NULL;
+	uint8_t *safe_uncompressed_data       = NULL;
+	static char *function                 = "lzxpressdecompress_decompress_allocate";
+	size_t allocated_data_size            = 0;
+	size_t maximum_uncompressed_data_size = 0;
+	size_t safe_uncompressed_data_size    = 0;
+	int result                            = 0;
+
+	if( compressed_data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid compressed data.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( decompression_method != 1 )
+	 && ( decompression_method != 2 ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_UNSUPPORTED_VALUE,
+		 "%s: unsupported decompression method.",
+		 function );
+
+		return( -1 );
+	}
+	if( uncompressed_data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid uncompressed data.",
+		 function );
+
+		return( -1 );
+	}
+	if( *uncompressed_data != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid uncompressed data value already set.",
+		 function );
+
+		return( -1 );
+	}
+	if( uncompressed_data_size == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid uncompressed data size.",
+		 function );
+
+		return( -1 );
+	}
+	/* Do not keep resizing the buffer for corrupted data
+	 */
+	if( compressed_data_size > ( (size_t) SSIZE_MAX / LZXPRESSDECOMPRESS_MAXIMUM_COMPRESSION_RATIO ) )
+	{
+		maximum_uncompressed_data_size = (size_t) SSIZE_MAX;
+	}
+	else
+	{
+		maximum_uncompressed_data_size = compressed_data_size * LZXPRESSDECOMPRESS_MAXIMUM_COMPRESSION_RATIO;
+	}
+	allocated_data_size = *uncompressed_data_size;
+
+	if( allocated_data_size == 0 )
+	{
+		allocated_data_size = 65536;
+	}
+	if( maximum_uncompressed_data_size < allocated_data_size )
+	{
+		maximum_uncompressed_data_size = allocated_data_size;
+	}
+	do
+	{
+		reallocation = (uint8_t *) memory_reallocate(
+		                            safe_uncompressed_data,
+		                            sizeof( uint8_t ) * allocated_data_size );
+
+		if( reallocation == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+			 "%s: unable to resize uncompressed data.",
+			 function );
+
+			goto on_error;
+		}
+		safe_uncompressed_data      = reallocation;
+		safe_uncompressed_data_size = allocated_data_size;
+
+		if( decompression_method == 1 )
+		{
+			result = libfwnt_lzxpress_decompress(
+			          compressed_data,
+			          compressed_data_size,
+			          safe_uncompressed_data,
+			          &safe_uncompressed_data_size,
+			          error );
+		}
+		else
+		{
+			result = libfwnt_lzxpress_huffman_decompress(
+			          compressed_data,
+			          compressed_data_size,
+			          safe_uncompressed_data,
+			          &safe_uncompressed_data_size,
+			          error );
+		}
+		if( result != 1 )
+		{
+			if( allocated_data_size >= maximum_uncompressed_data_size )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_COMPRESSION,
+				 LIBCERROR_COMPRESSION_ERROR_DECOMPRESS_FAILED,
+				 "%s: unable to decompress data.",
+				 function );
+
+				goto on_error;
+			}
+			libcerror_error_free(
+			 error );
+
+			if( allocated_data_size <= ( maximum_uncompressed_data_size / 2 ) )
+			{
+				allocated_data_size *= 2;
+			}
+			else
+			{
+				allocated_data_size = maximum_uncompressed_data_size;
+			}
+		}
+	}
+	while( result != 1 );
+
+	*uncompressed_data      = safe_uncompressed_data;
+	*uncompressed_data_size = safe_uncompressed_data_size;
+
+	return( 1 );
+
+on_error:
+	if( safe_uncompressed_data != NULL )
+	{
+		memory_free(
+		 safe_uncompressed_data );
+	}
+	return( -1 );
+}
+
+/* Determines the chunks in WOF compressed data
+ * The data starts with a table of the offsets of the chunks, relative to the end
+ * of the table, which contains an entry for every chunk except for the first one.
+ * The entries are 64-bit if the uncompressed data size exceeds 4 GiB otherwise 32-bit
+ * Returns 1 if successful or -1 on error
+ */
+int lzxpressdecompress_get_wof_chunks(
+     const uint8_t *compressed_data,
+     size_t compressed_data_size,
+     size_t uncompressed_data_size,
+     size_t chunk_size,
+     lzxpressdecompress_chunk_t **chunks,
+     int *number_of_chunks,
+     libcerror_error_t **error )
+{
+	lzxpressdecompress_chunk_t *safe_chunks = NULL;
+	static char *function                   = "lzxpressdecompress_get_wof_chunks";
+	size_t chunk_data_end_offset            = 0;
+	size_t chunk_data_offset                = 0;
+	size_t chunk_data_size                  = 0;
+	size_t chunk_table_entry_size           = 4;
+	size_t chunk_table_size                 = 0;
+	size_t safe_number_of_chunks            = 0;
+	uint64_t value_64bit                    = 0;
+	uint32_t value_32bit                    = 0;
+	int chunk_index                         = 0;
+
+	if( compressed_data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid compressed data.",
+		 function );
+
+		return( -1 );
+	}
+	if( compressed_data_size > (size_t) SSIZE_MAX )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid compressed data size value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( uncompressed_data_size == 0 )
+	 || ( uncompressed_data_size > (size_t) SSIZE_MAX ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid uncompressed data size value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( chunk_size == 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_ZERO_OR_LESS,
+		 "%s: invalid chunk size value zero or less.",
+		 function );
+
+		return( -1 );
+	}
+	if( chunks == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid chunks.",
+		 function );
+
+		return( -1 );
+	}
+	if( number_of_chunks == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid number of chunks.",
+		 function );
+
+		return( -1 );
+	}
+	safe_number_of_chunks = uncompressed_data_size / chunk_size;
+
+	if( ( uncompressed_data_size % chunk_size ) != 0 )
+	{
+		safe_number_of_chunks++;
+	}
+	if( safe_number_of_chunks > (size_t) INT_MAX )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid number of chunks value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	if( (uint64_t) uncompressed_data_size > (uint64_t) 0xffffffffUL )
+	{
+		chunk_table_entry_size = 8;
+	}
+	chunk_table_size = ( safe_number_of_chunks - 1 ) * chunk_table_entry_size;
+
+	if( chunk_table_size > compressed_data_size )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_TOO_SMALL,
+		 "%s: invalid compressed data size value too small.",
+		 function );
+
+		return( -1 );
+	}
+	safe_chunks = (lzxpressdecompress_chunk_t *) memory_allocate(
+	                                              sizeof( lzxpressdecompress_chunk_t ) * safe_number_of_chunks );
+
+	if( safe_chunks == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create chunks.",
+		 function );
+
+		goto on_error;
+	}
+	for( chunk_index = 0;
+	     chunk_index < (int) safe_number_of_chunks;
+	     chunk_index++ )
+	{
+		if( chunk_index == (int) ( safe_number_of_chunks - 1 ) )
+		{
+			chunk_data_end_offset = compressed_data_size - chunk_table_size;
+		}
+		else if( chunk_table_entry_size == 8 )
+		{
+			byte_stream_copy_to_uint64_little_endian(
+			 &( compressed_data[ (size_t) chunk_index * 8 ] ),
+			 value_64bit );
+
+			if( value_64bit > (uint64_t) ( compressed_data_size - chunk_table_size ) )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+				 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+				 "%s: invalid chunk: %d offset value out of bounds.",
+				 function,
+				 chunk_index + 1 );
+
+				goto on_error;
+			}
+			chunk_data_end_offset = (size_t) value_64bit;
+		}
+		else
+		{
+			byte_stream_copy_to_uint32_little_endian(
+			 &( compressed_data[ (size_t) chunk_index * 4 ] ),
+			 value_32bit );
+
+			if( (size_t) value_32bit > ( compressed_data_size - chunk_table_size ) )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+				 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+				 "%s: invalid chunk: %d offset value out of bounds.",
+				 function,
+				 chunk_index + 1 );
+
+				goto on_error;
+			}
+			chunk_data_end_offset = (size_t) value_32bit;
+		}
+		if( chunk_data_end_offset <= chunk_data_offset )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+			 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+			 "%s: invalid chunk: %d size value out of bounds.",
+			 function,
+			 chunk_index );
+
+			goto on_error;
+		}
+		chunk_data_size = chunk_size;
+
+		if( chunk_data_size > ( uncompressed_data_size - ( (size_t) chunk_index * chunk_size ) ) )
+		{
+			chunk_data_size = uncompressed_data_size - ( (size_t) chunk_index * chunk_size );
+		}
+		safe_chunks[ chunk_index ].compressed_data_offset   = chunk_table_size + chunk_data_offset;
+		safe_chunks[ chunk_index ].compressed_data_size     = chunk_data_end_offset - chunk_data_offset;
+		safe_chunks[ chunk_index ].uncompressed_data_offset = (size_t) chunk_index * chunk_size;
+		safe_chunks[ chunk_index ].uncompressed_data_size   = chunk_data_size;
+		safe_chunks[ chunk_index ].result                   = 0;
+
+		chunk_data_offset = chunk_data_end_offset;
+	}
+	*chunks           = safe_chunks;
+	*number_of_chunks = (int) safe_number_of_chunks;
+
+	return( 1 );
+
+on_error:
+	if( safe_chunks != NULL )
+	{
+		memory_free(
+		 safe_chunks );
+	}
+	return( -1 );
+}
+
+/* Decompresses a chunk of WOF compressed data
+ * A chunk that is not smaller than its uncompressed data is stored uncompressed
+ * Returns 1 if successful or -1 on error
+ */
+int lzxpressdecompress_decompress_wof_chunk(
+     const uint8_t *compressed_data,
+     lzxpressdecompress_chunk_t *chunk,
+     uint8_t *uncompressed_data,
+     libcerror_error_t **error )
+{
+	static char *function         = "lzxpressdecompress_decompress_wof_chunk";
+	size_t uncompressed_data_size = 0;
+
+	if( compressed_data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid compressed data.",
+		 function );
+
+		return( -1 );
+	}
+	if( chunk == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid chunk.",
+		 function );
+
+		return( -1 );
+	}
+	if( uncompressed_data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid uncompressed data.",
+		 function );
+
+		return( -1 );
+	}
+	if( chunk->compressed_data_size >= chunk->uncompressed_data_size )
+	{
+		if( chunk->compressed_data_size != chunk->uncompressed_data_size )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+			 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+			 "%s: invalid chunk compressed data size value out of bounds.",
+			 function );
+
+			return( -1 );
+		}
+		if( memory_copy(
+		     &( uncompressed_data[ chunk->uncompressed_data_offset ] ),
+		     &( compressed_data[ chunk->compressed_data_offset ] ),
+		     chunk->uncompressed_data_size ) == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+			 "%s: unable to copy uncompressed chunk.",
+			 function );
+
+			return( -1 );
+		}
+		return( 1 );
+	}
+	uncompressed_data_size = chunk->uncompressed_data_size;
+
+	if( lzxpress_huffman_decompress(
+	     &( compressed_data[ chunk->compressed_data_offset ] ),
+	     chunk->compressed_data_size,
+	     &( uncompressed_data[ chunk->uncompressed_data_offset ] ),
+	     &uncompressed_data_size,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_COMPRESSION,
+		 LIBCERROR_COMPRESSION_ERROR_DECOMPRESS_FAILED,
+		 "%s: unable to decompress chunk.",
+		 function );
+
+		return( -1 );
+	}
+	if( uncompressed_data_size != chunk->uncompressed_data_size )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_COMPRESSION,
+		 LIBCERROR_COMPRESSION_ERROR_DECOMPRESS_FAILED,
+		 "%s: mismatch in chunk uncompressed data size.",
+		 function );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+
+/* Decompresses the chunks of a range, used as the callback function of a thread
+ * The thread decompresses every chunk_index_step chunk starting with first_chunk_index
+ * Returns 1 if successful or -1 on error
+ */
+int lzxpressdecompress_thread_range_decompress(
+     void *arguments )
+{
+	lzxpressdecompress_chunk_t *chunk               = NULL;
+	lzxpressdecompress_thread_range_t *thread_range = NULL;
+	int chunk_index                                 = 0;
+	int result                                      = 1;
+
+	if( arguments == NULL )
+	{
+		return( -1 );
+	}
+	thread_range = (lzxpressdecompress_thread_range_t *) arguments;
+
+	for( chunk_index = thread_range->first_chunk_index;
+	     chunk_index < thread_range->number_of_chunks;
+	     chunk_index += thread_range->chunk_index_step )
+	{
+		chunk = &( thread_range->chunks[ chunk_index ] );
+
+		chunk->result = lzxpressdecompress_decompress_wof_chunk(
+		                 thread_range->compressed_data,
+		                 chunk,
+		                 thread_range->uncompressed_data,
+		                 NULL );
+
+		if( chunk->result != 1 )
+		{
+			result = -1;
+		}
+	}
+	return( result );
+}
+
+#endif /* defined( HAVE_MULTI_THREAD_SUPPORT ) */
+
+/* Decompresses WOF compressed data
+ * Every chunk is decompressed directly at its final offset in the uncompressed data,
+ * since the chunks are independent they are decompressed in parallel when multiple
+ * threads are used
+ * Returns 1 if successful or -1 on error
+ */
+int lzxpressdecompress_decompress_wof(
+     const uint8_t *compressed_data,
+     lzxpressdecompress_chunk_t *chunks,
+     int number_of_chunks,
+     uint8_t *uncompressed_data,
+     int number_of_threads,
+     libcerror_error_t **error )
+{
+	static char *function                            = "lzxpressdecompress_decompress_wof";
+	int chunk_index                                  = 0;
+
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+	lzxpressdecompress_thread_range_t *thread_ranges = NULL;
+	libcthreads_thread_t **threads                   = NULL;
+	int number_of_ranges                             = 0;
+	int range_index                                  = 0;
+	int result                                       = 1;
+#endif
+
+	if( compressed_data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid compressed data.",
+		 function );
+
+		return( -1 );
+	}
+	if( chunks == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid chunks.",
+		 function );
+
+		return( -1 );
+	}
+	if( number_of_chunks <= 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_ZERO_OR_LESS,
+		 "%s: invalid number of chunks value zero or less.",
+		 function );
+
+		return( -1 );
+	}
+	if( uncompressed_data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid uncompressed data.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( number_of_threads <= 0 )
+	 || ( number_of_threads > LZXPRESSDECOMPRESS_MAXIMUM_NUMBER_OF_THREADS ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid number of threads value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+	if( ( number_of_threads > 1 )
+	 && ( number_of_chunks > 1 ) )
+	{
+		/* Do not use more threads than chunks
+		 */
+		number_of_ranges = number_of_threads;
+
+		if( number_of_chunks < number_of_ranges )
+		{
+			number_of_ranges = number_of_chunks;
+		}
+		thread_ranges = (lzxpressdecompress_thread_range_t *) memory_allocate(
+		                                                       sizeof( lzxpressdecompress_thread_range_t ) * number_of_ranges );
+
+		if( thread_ranges == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+			 "%s: unable to create thread ranges.",
+			 function );
+
+			goto on_error;
+		}
+		threads = (libcthreads_thread_t **) memory_allocate(
+		                                     sizeof( libcthreads_thread_t * ) * number_of_ranges );
+
+		if( threads == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+			 "%s: unable to create threads.",
+			 function );
+
+			goto on_error;
+		}
+		if( memory_set(
+		     threads,
+		     0,
+		     sizeof( libcthreads_thread_t * ) * number_of_ranges ) == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+			 "%s: unable to clear threads.",
+			 function );
+
+			goto on_error;
+		}
+		for( chunk_index = 0;
+		     chunk_index < number_of_chunks;
+		     chunk_index++ )
+		{
+			chunks[ chunk_index ].result = 0;
+		}
+		/* The chunks are interleaved over the threads so that the work is evenly
+		 * distributed even if some parts of the data decompress slower than others
+		 */
+		for( range_index = 0;
+		     range_index < number_of_ranges;
+		     range_index++ )
+		{
+			thread_ranges[ range_index ].compressed_data   = compressed_data;
+			thread_ranges[ range_index ].uncompressed_data = uncompressed_data;
+			thread_ranges[ range_index ].chunks            = chunks;
+			thread_ranges[ range_index ].number_of_chunks  = number_of_chunks;
+			thread_ranges[ range_index ].first_chunk_index = range_index;
+			thread_ranges[ range_index ].chunk_index_step  = number_of_ranges;
+		}
+		for( range_index = 0;
+		     range_index < ( number_of_ranges - 1 );
+		     range_index++ )
+		{
+			if( libcthreads_thread_create(
+			     &( threads[ range_index ] ),
+			     NULL,
+			     lzxpressdecompress_thread_range_decompress,
+			     (void *) &( thread_ranges[ range_index ] ),
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+				 "%s: unable to create thread: %d.",
+				 function,
+				 range_index );
+
+				result = -1;
+
+				break;
+			}
+		}
+		if( result == 1 )
+		{
+			lzxpressdecompress_thread_range_decompress(
+			 (void *) &( thread_ranges[ number_of_ranges - 1 ] ) );
+		}
+		/* Wait for the threads that were created, also on error
+		 */
+		for( range_index = 0;
+		     range_index < ( number_of_ranges - 1 );
+		     range_index++ )
+		{
+			if( threads[ range_index ] == NULL )
+			{
+				continue;
+			}
+			if( libcthreads_thread_join(
+			     &( threads[ range_index ] ),
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+				 "%s: unable to join thread: %d.",
+				 function,
+				 range_index );
+
+				result = -1;
+			}
+		}
+		memory_free(
+		 threads );
+
+		threads = NULL;
+
+		memory_free(
+		 thread_ranges );
+
+		thread_ranges = NULL;
+
+		if( result != 1 )
+		{
+			goto on_error;
+		}
+		for( chunk_index = 0;
+		     chunk_index < number_of_chunks;
+		     chunk_index++ )
+		{
+			if( chunks[ chunk_index ].result != 1 )
+			{
+				/* Decompress the chunk again to determine the error
+				 */
+				lzxpressdecompress_decompress_wof_chunk(
+				 compressed_data,
+				 &( chunks[ chunk_index ] ),
+				 uncompressed_data,
+				 error );
+
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_COMPRESSION,
+				 LIBCERROR_COMPRESSION_ERROR_DECOMPRESS_FAILED,
+				 "%s: unable to decompress chunk: %d.",
+				 function,
+				 chunk_index );
+
+				goto on_error;
+			}
+		}
+		return( 1 );
+	}
+#endif /* defined( HAVE_MULTI_THREAD_SUPPORT ) */
+
+	for( chunk_index = 0;
+	     chunk_index < number_of_chunks;
+	     chunk_index++ )
+	{
+		if( lzxpressdecompress_decompress_wof_chunk(
+		     compressed_data,
+		     &( chunks[ chunk_index ] ),
+		     uncompressed_data,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_COMPRESSION,
+			 LIBCERROR_COMPRESSION_ERROR_DECOMPRESS_FAILED,
+			 "%s: unable to decompress chunk: %d.",
+			 function,
+			 chunk_index );
+
+			return( -1 );
+		}
+	}
+	return( 1 );
+
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+on_error:
+	if( threads != NULL )
+	{
+		memory_free(
+		 threads );
+	}
+	if( thread_ranges != NULL )
+	{
+		memory_free(
+		 thread_ranges );
+	}
+	return( -1 );
+#endif
+}
+
 /* The main program
  */
 #if defined( HAVE_WIDE_SYSTEM_CHARACTER )
@@ -136,29 +1076,36 @@ int wmain( int argc, wchar_t * const argv[] )
 int main( int argc, char * const argv[] )
 #endif
 {
-	libcerror_error_t *error                 = NULL;
-	libcfile_file_t *destination_file        = NULL;
-	libcfile_file_t *source_file             = NULL;
-	system_character_t *option_target_path   = NULL;
-	system_character_t *options_string       = NULL;
-	system_character_t *source               = NULL;
-	uint8_t *buffer                          = NULL;
-	uint8_t *uncompressed_data               = NULL;
-	char *program                            = "lzxpressdecompress";
-	system_integer_t option                  = 0;
-	size64_t source_size                     = 0;
-	size_t buffer_size                       = 0;
-	size_t uncompressed_data_size            = 0;
-	ssize_t read_count                       = 0;
-	ssize_t write_count                      = 0;
-	off_t source_offset                      = 0;
-	int decompression_method                 = 1;
-	int result                               = 0;
-	int verbose                              = 0;
+	libcerror_error_t *error                     = NULL;
+	assorted_input_file_t *source_file           = NULL;
+	assorted_output_file_t *destination_file     = NULL;
+	system_character_t *option_hexdump_window    = NULL;
+	system_character_t *option_statistics_format = NULL;
+	system_character_t *option_target_path       = NULL;
+	system_character_t *options_string           = NULL;
+	system_character_t *source                   = NULL;
+	uint8_t *buffer                              = NULL;
+	uint8_t *uncompressed_data                   = NULL;
+	lzxpressdecompress_chunk_t *chunks           = NULL;
+	char *program                                = "lzxpressdecompress";
+	system_integer_t option                      = 0;
+	size64_t source_size                         = 0;
+	size_t uncompressed_data_size                = 0;
+	size_t wof_chunk_size                        = 0;
+	ssize_t read_count                           = 0;
+	ssize_t write_count                          = 0;
+	off_t source_offset                          = 0;
+	int decompression_method                     = 1;
+	int is_mapped                                = 0;
+	int number_of_chunks                         = 0;
+	int number_of_threads                        = 1;
+	int resize_uncompressed_data                 = 0;
+	int result                                   = 0;
+	int verbose                                  = 0;
 
 #if defined( WINAPI )
-	void *workspace                          = NULL;
-	unsigned short winapi_compression_method = 0;
+	void *workspace                              = NULL;
+	unsigned short winapi_compression_method     = 0;
 #endif
 
 	assorted_output_version_fprint(
@@ -166,9 +1113,9 @@ int main( int argc, char * const argv[] )
 	 program );
 
 #if defined( WINAPI )
-	options_string = _SYSTEM_STRING( "d:ho:s:t:vV1234" );
+	options_string = _SYSTEM_STRING( "d:D:hj:o:s:S:t:vVw:1234" );
 #else
-	options_string = _SYSTEM_STRING( "d:ho:s:t:vV12" );
+	options_string = _SYSTEM_STRING( "d:D:hj:o:s:S:t:vVw:12" );
 #endif
 	while( ( option = assorted_getopt(
 	                   argc,
@@ -219,12 +1166,25 @@ int main( int argc, char * const argv[] )
 #endif
 				break;
 
+			case (system_integer_t) 'D':
+				option_hexdump_window = optarg;
+
+				break;
+
 			case (system_integer_t) 'h':
 				usage_fprint(
 				 stdout );
 
 				return( EXIT_SUCCESS );
 
+			case (system_integer_t) 'j':
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+				number_of_threads = (int) _wtol( optarg );
+#else
+				number_of_threads = (int) atol( optarg );
+#endif
+				break;
+
 			case (system_integer_t) 'o':
 #if defined( HAVE_WIDE_SYSTEM_CHARACTER )
 				source_offset = _wtol( optarg );
@@ -241,6 +1201,11 @@ int main( int argc, char * const argv[] )
 #endif
 				break;
 
+			case (system_integer_t) 'S':
+				option_statistics_format = optarg;
+
+				break;
+
 			case (system_integer_t) 't':
 				option_target_path = optarg;
 
@@ -256,6 +1221,14 @@ int main( int argc, char * const argv[] )
 				 stdout );
 
 				return( EXIT_SUCCESS );
+
+			case (system_integer_t) 'w':
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+				wof_chunk_size = _wtol( optarg );
+#else
+				wof_chunk_size = atol( optarg );
+#endif
+				break;
 		}
 	}
 	if( optind == argc )
@@ -271,15 +1244,104 @@ int main( int argc, char * const argv[] )
 	}
 	source = argv[ optind ];
 
+	/* WOF compressed data does not store the decompressed data size
+	 * and the LZX compressed chunks of 32768 bytes are not supported
+	 */
+	if( wof_chunk_size != 0 )
+	{
+		if( wof_chunk_size == 32768 )
+		{
+			fprintf(
+			 stderr,
+			 "Unsupported WOF chunk size, LZX compressed data is not supported.\n" );
+
+			return( EXIT_FAILURE );
+		}
+		if( ( wof_chunk_size != 4096 )
+		 && ( wof_chunk_size != 8192 )
+		 && ( wof_chunk_size != 16384 ) )
+		{
+			fprintf(
+			 stderr,
+			 "Unsupported WOF chunk size, value must be 4096, 8192 or 16384.\n" );
+
+			return( EXIT_FAILURE );
+		}
+		if( uncompressed_data_size == 0 )
+		{
+			fprintf(
+			 stderr,
+			 "Missing size of the decompressed WOF compressed data.\n" );
+
+			usage_fprint(
+			 stdout );
+
+			return( EXIT_FAILURE );
+		}
+		decompression_method = 2;
+	}
+	if( ( number_of_threads <= 0 )
+	 || ( number_of_threads > LZXPRESSDECOMPRESS_MAXIMUM_NUMBER_OF_THREADS ) )
+	{
+		fprintf(
+		 stderr,
+		 "Unsupported number of threads, value must be between 1 and %d.\n",
+		 LZXPRESSDECOMPRESS_MAXIMUM_NUMBER_OF_THREADS );
+
+		return( EXIT_FAILURE );
+	}
+#if !defined( HAVE_MULTI_THREAD_SUPPORT )
+	if( number_of_threads > 1 )
+	{
+		fprintf(
+		 stderr,
+		 "Multi-threading not supported, using a single thread.\n" );
+
+		number_of_threads = 1;
+	}
+#endif
+	if( ( number_of_threads > 1 )
+	 && ( wof_chunk_size == 0 ) )
+	{
+		fprintf(
+		 stderr,
+		 "Multiple threads are only supported for WOF compressed data, using a single thread.\n" );
+
+		number_of_threads = 1;
+	}
 	libcnotify_stream_set(
 	 stderr,
 	 NULL );
 	libcnotify_verbose_set(
 	 verbose );
 
+	if( assorted_output_statistics_initialize(
+	     option_statistics_format,
+	     &error ) != 1 )
+	{
+		fprintf(
+		 stderr,
+		 "Unable to initialize statistics.\n" );
+
+		goto on_error;
+	}
+	if( option_hexdump_window != NULL )
+	{
+		if( assorted_output_hexdump_window_set(
+		     option_hexdump_window,
+		     &error ) != 1 )
+		{
+			fprintf(
+			 stderr,
+			 "Unsupported hexdump window.\n" );
+
+			goto on_error;
+		}
+	}
+
 	/* Open the source file
 	 */
-	if( libcfile_file_initialize(
+	if( assorted_input_file_initialize(
 	     &source_file,
 	     &error ) != 1 )
 	{
@@ -289,19 +1351,11 @@ int main( int argc, char * const argv[] )
 
 		goto on_error;
 	}
-#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
-	result = libcfile_file_open_wide(
-	          source_file,
-	          source,
-	          LIBCFILE_OPEN_READ,
-	          &error );
-#else
-	result = libcfile_file_open(
+	result = assorted_input_file_open(
 	          source_file,
 	          source,
-	          LIBCFILE_OPEN_READ,
 	          &error );
-#endif
+
  	if( result != 1 )
 	{
 		fprintf(
@@ -312,7 +1366,7 @@ int main( int argc, char * const argv[] )
 	}
 	if( source_size == 0 )
 	{
-		if( libcfile_file_get_size(
+		if( assorted_input_file_get_size(
 		     source_file,
 		     &source_size,
 		     &error ) == -1 )
@@ -349,50 +1403,22 @@ int main( int argc, char * const argv[] )
 
 		goto on_error;
 	}
-	/* Create the input buffer
+	/* Without a decompressed data size the uncompressed data buffer is resized
+	 * while decompressing, which requires the libfwnt LZ77 or the Huffman
+	 * decompression method
 	 */
-	buffer_size = source_size;
-
-	buffer = (uint8_t *) memory_allocate(
-	                      sizeof( uint8_t ) * buffer_size );
-
-	if( buffer == NULL )
-	{
-		fprintf(
-		 stderr,
-		 "Unable to create buffer.\n" );
-
-		goto on_error;
-	}
 	if( uncompressed_data_size == 0 )
 	{
+		if( ( decompression_method == 1 )
+		 || ( decompression_method == 2 ) )
+		{
+			resize_uncompressed_data = 1;
+		}
 		uncompressed_data_size = 65536;
 	}
-	uncompressed_data = (uint8_t *) memory_allocate(
-	                                 sizeof( uint8_t ) * uncompressed_data_size );
-
-	if( uncompressed_data == NULL )
-	{
-		fprintf(
-		 stderr,
-		 "Unable to create uncompressed data buffer.\n" );
-
-		goto on_error;
-	}
-	if( memory_set(
-             uncompressed_data,
-	     0,
-	     uncompressed_data_size ) == NULL )
-	{
-		fprintf(
-		 stderr,
-		 "Unable to clear uncompressed data buffer.\n" );
-
-		goto on_error;
-	}
 	/* Position the source file at the right offset
 	 */
-	if( libcfile_file_seek_offset(
+	if( assorted_input_file_seek_offset(
 	     source_file,
 	     source_offset,
 	     SEEK_SET,
@@ -411,10 +1437,10 @@ int main( int argc, char * const argv[] )
 	 source_offset,
 	 source_offset );
 
-	read_count = libcfile_file_read_buffer(
-		      source_file,
-		      buffer,
-		      source_size,
+	read_count = assorted_input_file_read_data(
+	              source_file,
+	              &buffer,
+	              (size_t) source_size,
 	              &error );
 
 	if( read_count != (ssize_t) source_size )
@@ -425,6 +1451,95 @@ int main( int argc, char * const argv[] )
 
 		goto on_error;
 	}
+	if( wof_chunk_size != 0 )
+	{
+		if( lzxpressdecompress_get_wof_chunks(
+		     buffer,
+		     (size_t) source_size,
+		     uncompressed_data_size,
+		     wof_chunk_size,
+		     &chunks,
+		     &number_of_chunks,
+		     &error ) != 1 )
+		{
+			fprintf(
+			 stderr,
+			 "Unable to determine WOF chunks.\n" );
+
+			goto on_error;
+		}
+	}
+	/* Open the destination file, if it can be mapped the data is decompressed
+	 * directly into the destination file instead of an uncompressed data buffer
+	 * An uncompressed data buffer that is resized is written buffered
+	 */
+	if( option_target_path != NULL )
+	{
+		if( assorted_output_file_initialize(
+		     &destination_file,
+		     &error ) != 1 )
+		{
+			fprintf(
+			 stderr,
+			 "Unable to create destination file.\n" );
+
+			goto on_error;
+		}
+		if( assorted_output_file_open(
+		     destination_file,
+		     option_target_path,
+		     ( resize_uncompressed_data != 0 ) ? 0 : uncompressed_data_size,
+		     &error ) != 1 )
+		{
+			fprintf(
+			 stderr,
+			 "Unable to open destination file.\n" );
+
+			goto on_error;
+		}
+		is_mapped = assorted_output_file_get_mapped_data(
+		             destination_file,
+		             &uncompressed_data,
+		             &uncompressed_data_size,
+		             &error );
+
+		if( is_mapped == -1 )
+		{
+			fprintf(
+			 stderr,
+			 "Unable to retrieve mapped destination data.\n" );
+
+			goto on_error;
+		}
+	}
+	/* The mapped destination data of a newly created file is already zero
+	 */
+	if( ( is_mapped == 0 )
+	 && ( resize_uncompressed_data == 0 ) )
+	{
+		uncompressed_data = (uint8_t *) memory_allocate(
+		                                 sizeof( uint8_t ) * uncompressed_data_size );
+
+		if( uncompressed_data == NULL )
+		{
+			fprintf(
+			 stderr,
+			 "Unable to create uncompressed data buffer.\n" );
+
+			goto on_error;
+		}
+		if( memory_set(
+		     uncompressed_data,
+		     0,
+		     uncompressed_data_size ) == NULL )
+		{
+			fprintf(
+			 stderr,
+			 "Unable to clear uncompressed data buffer.\n" );
+
+			goto on_error;
+		}
+	}
 	/* Decompress the data
 	 */
 	if( option_target_path == NULL )
@@ -433,12 +1548,51 @@ int main( int argc, char * const argv[] )
 		 stderr,
 		 "Compressed data:\n" );
 
-		libcnotify_print_data(
-		 buffer,
-		 source_size,
-		 LIBCNOTIFY_PRINT_DATA_FLAG_GROUP_DATA );
+		if( assorted_output_data_fprint(
+		     stderr,
+		     buffer,
+		     source_size,
+		     0,
+		     &error ) != 1 )
+		{
+			fprintf(
+			 stderr,
+			 "Unable to print compressed data.\n" );
+
+			goto on_error;
+		}
+	}
+	if( wof_chunk_size != 0 )
+	{
+		result = lzxpressdecompress_decompress_wof(
+		          buffer,
+		          chunks,
+		          number_of_chunks,
+		          uncompressed_data,
+		          number_of_threads,
+		          &error );
 	}
-	if( decompression_method == 1 )
+	else if( ( resize_uncompressed_data != 0 )
+	      && ( decompression_method == 2 ) )
+	{
+		result = lzxpress_huffman_decompress_allocate(
+		          buffer,
+		          (size_t) source_size,
+		          &uncompressed_data,
+		          &uncompressed_data_size,
+		          &error );
+	}
+	else if( resize_uncompressed_data != 0 )
+	{
+		result = lzxpressdecompress_decompress_allocate(
+		          buffer,
+		          (size_t) source_size,
+		          decompression_method,
+		          &uncompressed_data,
+		          &uncompressed_data_size,
+		          &error );
+	}
+	else if( decompression_method == 1 )
 	{
 		result = libfwnt_lzxpress_decompress(
 		          buffer,
@@ -449,7 +1603,7 @@ int main( int argc, char * const argv[] )
 	}
 	else if( decompression_method == 2 )
 	{
-		result = libfwnt_lzxpress_huffman_decompress(
+		result = lzxpress_huffman_decompress(
 		          buffer,
 		          (size_t) source_size,
 		          uncompressed_data,
@@ -508,11 +1662,15 @@ int main( int argc, char * const argv[] )
 		 stderr,
 		 "Unable to decompress data.\n" );
 
-		libcnotify_print_data(
-		 uncompressed_data,
-		 uncompressed_data_size,
-		 LIBCNOTIFY_PRINT_DATA_FLAG_GROUP_DATA );
-
+		if( uncompressed_data != NULL )
+		{
+			assorted_output_data_fprint(
+			 stderr,
+			 uncompressed_data,
+			 uncompressed_data_size,
+			 0,
+			 NULL );
+		}
 		goto on_error;
 	}
 	if( option_target_path == NULL )
@@ -521,45 +1679,23 @@ int main( int argc, char * const argv[] )
 		 stderr,
 		 "Uncompressed data:\n" );
 
-		libcnotify_print_data(
-		 uncompressed_data,
-		 uncompressed_data_size,
-		 LIBCNOTIFY_PRINT_DATA_FLAG_GROUP_DATA );
-	}
-	else
-	{
-		if( libcfile_file_initialize(
-		     &destination_file,
+		if( assorted_output_data_fprint(
+		     stderr,
+		     uncompressed_data,
+		     uncompressed_data_size,
+		     0,
 		     &error ) != 1 )
 		{
 			fprintf(
 			 stderr,
-			 "Unable to create destination file.\n" );
-
-			goto on_error;
-		}
-#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
-		result = libcfile_file_open_wide(
-		          destination_file,
-		          option_target_path,
-		          LIBCFILE_OPEN_WRITE,
-		          &error );
-#else
-		result = libcfile_file_open(
-		          destination_file,
-		          option_target_path,
-		          LIBCFILE_OPEN_WRITE,
-		          &error );
-#endif
-	 	if( result != 1 )
-		{
-			fprintf(
-			 stderr,
-			 "Unable to open destination file.\n" );
+			 "Unable to print uncompressed data.\n" );
 
 			goto on_error;
 		}
-		write_count = libcfile_file_write_buffer(
+	}
+	else
+	{
+		write_count = assorted_output_file_write_data(
 			       destination_file,
 			       uncompressed_data,
 			       uncompressed_data_size,
@@ -573,7 +1709,7 @@ int main( int argc, char * const argv[] )
 
 			goto on_error;
 		}
-		if( libcfile_file_close(
+		if( assorted_output_file_close(
 		     destination_file,
 		     &error ) != 0 )
 		{
@@ -583,7 +1719,7 @@ int main( int argc, char * const argv[] )
 
 			goto on_error;
 		}
-		if( libcfile_file_free(
+		if( assorted_output_file_free(
 		     &destination_file,
 		     &error ) != 1 )
 		{
@@ -596,7 +1732,7 @@ int main( int argc, char * const argv[] )
 	}
 	/* Clean up
 	 */
-	if( libcfile_file_close(
+	if( assorted_input_file_close(
 	     source_file,
 	     &error ) != 0 )
 	{
@@ -606,7 +1742,7 @@ int main( int argc, char * const argv[] )
 
 		goto on_error;
 	}
-	if( libcfile_file_free(
+	if( assorted_input_file_free(
 	     &source_file,
 	     &error ) != 1 )
 	{
@@ -616,20 +1752,33 @@ int main( int argc, char * const argv[] )
 
 		goto on_error;
 	}
-	memory_free(
-	 uncompressed_data );
-
+	if( is_mapped == 0 )
+	{
+		memory_free(
+		 uncompressed_data );
+	}
 	uncompressed_data = NULL;
 
-	memory_free(
-	 buffer );
+	if( chunks != NULL )
+	{
+		memory_free(
+		 chunks );
 
-	buffer = NULL;
+		chunks = NULL;
+	}
 
 	fprintf(
 	 stdout,
 	 "LZXPRESS decompression:\tSUCCESS\n" );
 
+	assorted_output_statistics_fprint(
+	 stderr,
+	 program,
+	 1,
+	 NULL );
+	assorted_output_statistics_free(
+	 NULL );
+
 	return( EXIT_SUCCESS );
 
 on_error:
@@ -640,25 +1789,33 @@ on_error:
 		libcerror_error_free(
 		 &error );
 	}
+	assorted_output_statistics_fprint(
+	 stderr,
+	 program,
+	 -1,
+	 NULL );
+	assorted_output_statistics_free(
+	 NULL );
 	if( destination_file != NULL )
 	{
-		libcfile_file_free(
+		assorted_output_file_free(
 		 &destination_file,
 		 NULL );
 	}
-	if( uncompressed_data != NULL )
+	if( ( uncompressed_data != NULL )
+	 && ( is_mapped == 0 ) )
 	{
 		memory_free(
 		 uncompressed_data );
 	}
-	if( buffer != NULL )
+	if( chunks != NULL )
 	{
 		memory_free(
-		 buffer );
+		 chunks );
 	}
 	if( source_file != NULL )
 	{
-		libcfile_file_free(
+		assorted_input_file_free(
 		 &source_file,
 		 NULL );
 	}
@@ -21,13 +21,77 @@
 
 #include <common.h>
 #include <byte_stream.h>
+#include <lz_match.h>
 #include <memory.h>
 #include <types.h>
 
 #include "assorted_libcerror.h"
 #include "assorted_libcnotify.h"
+#include "cpu_features.h"
 #include "mssearch.h"
 
+#if defined( HAVE_CPU_FEATURES_X86 )
+#include <immintrin.h>
+#endif
+
+#if defined( HAVE_CPU_FEATURES_X86 )
+
+/* Decodes blocks of 16 bytes of Windows Search encoded data using SSE2
+ * The encoded data offset must be a multiple of 16
+ */
+CPU_FEATURES_TARGET( "sse2" )
+static void mssearch_decode_sse2(
+             uint8_t *data,
+             const uint8_t *encoded_data,
+             size_t encoded_data_offset,
+             size_t number_of_blocks,
+             uint32_t bitmask32 )
+{
+	__m128i bitmask;
+	__m128i index_increment;
+	__m128i indexes;
+	__m128i value;
+
+	bitmask         = _mm_set1_epi32(
+	                   (int) bitmask32 );
+	index_increment = _mm_set1_epi8(
+	                   16 );
+
+	/* The bitmask of a byte is XOR-ed with the lower 8 bits of its offset
+	 */
+	indexes = _mm_add_epi8(
+	           _mm_set1_epi8(
+	            (char) ( encoded_data_offset & 0xff ) ),
+	           _mm_setr_epi8(
+	            0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15 ) );
+
+	while( number_of_blocks > 0 )
+	{
+		value = _mm_loadu_si128(
+		         (const __m128i *) &( encoded_data[ encoded_data_offset ] ) );
+
+		value = _mm_xor_si128(
+		         value,
+		         _mm_xor_si128(
+		          bitmask,
+		          indexes ) );
+
+		_mm_storeu_si128(
+		 (__m128i *) &( data[ encoded_data_offset ] ),
+		 value );
+
+		indexes = _mm_add_epi8(
+		           indexes,
+		           index_increment );
+
+		encoded_data_offset += 16;
+
+		number_of_blocks--;
+	}
+}
+
+#endif /* defined( HAVE_CPU_FEATURES_X86 ) */
+
 /* Decode data using Windows Search encoding
  * Returns 1 on success or -1 on error
  */
@@ -41,9 +105,15 @@ int mssearch_decode(
 	static char *function        = "mssearch_decode";
 	size_t data_iterator         = 0;
 	size_t encoded_data_iterator = 0;
+	uint64_t bitmask64           = 0;
+	uint64_t value_64bit         = 0;
 	uint32_t bitmask32           = 0;
 	uint8_t bitmask              = 0;
 
+#if defined( HAVE_CPU_FEATURES_X86 )
+	size_t number_of_blocks      = 0;
+#endif
+
 	if( encoded_data == NULL )
 	{
 		libcerror_error_set(
@@ -79,7 +149,50 @@ int mssearch_decode(
 	}
 	bitmask32 = 0x05000113 ^ (uint32_t) encoded_data_size;
 
-	for( encoded_data_iterator = 0;
+	/* The bitmask only depends on the encoded data size and the offset
+	 * hence it can be applied to multiple bytes at a time
+	 */
+#if defined( HAVE_CPU_FEATURES_X86 )
+	if( ( encoded_data_size >= 16 )
+	 && ( cpu_features_has(
+	       CPU_FEATURE_FLAG_SSE2 ) != 0 ) )
+	{
+		number_of_blocks = encoded_data_size / 16;
+
+		mssearch_decode_sse2(
+		 data,
+		 encoded_data,
+		 0,
+		 number_of_blocks,
+		 bitmask32 );
+
+		encoded_data_iterator = number_of_blocks * 16;
+	}
+#endif
+	bitmask64 = ( (uint64_t) bitmask32 << 32 ) | bitmask32;
+
+	while( ( encoded_data_size - encoded_data_iterator ) >= 8 )
+	{
+		byte_stream_copy_to_uint64_little_endian(
+		 &( encoded_data[ encoded_data_iterator ] ),
+		 value_64bit );
+
+		/* The offset is a multiple of 8 hence adding 0 to 7 to each byte
+		 * of the lower 8 bits of the offset does not carry
+		 */
+		value_64bit ^= bitmask64
+		             ^ ( ( (uint64_t) ( encoded_data_iterator & 0xff ) * 0x0101010101010101ULL )
+		               + 0x0706050403020100ULL );
+
+		byte_stream_copy_from_uint64_little_endian(
+		 &( data[ encoded_data_iterator ] ),
+		 value_64bit );
+
+		encoded_data_iterator += 8;
+	}
+	data_iterator = encoded_data_iterator;
+
+	for( ;
 	     encoded_data_iterator < encoded_data_size;
 	     encoded_data_iterator++ )
 	{
@@ -342,6 +455,461 @@ int mssearch_decompress_run_length_compressed_utf16_string(
 	return( 1 );
 }
 
+/* Determines the UTF-8 string size of a run-length compressed UTF-16 string
+ * The size is determined from the run headers and, for runs with an upper byte of 0,
+ * the lower bytes, without decoding the string. The size includes the end-of-string character
+ * Returns 1 on success or -1 on error
+ */
+int mssearch_get_run_length_uncompressed_utf8_string_size(
+     uint8_t *compressed_data,
+     size_t compressed_data_size,
+     size_t *utf8_string_size,
+     libcerror_error_t **error )
+{
+	uint8_t *run_data               = NULL;
+	static char *function           = "mssearch_get_run_length_uncompressed_utf8_string_size";
+	size_t compressed_data_iterator = 0;
+	size_t number_of_bytes          = 0;
+	size_t safe_utf8_string_size    = 0;
+	uint64_t value_64bit            = 0;
+	uint64_t value_mask             = 0;
+	uint8_t compression_byte        = 0;
+	uint8_t compression_size        = 0;
+	uint8_t high_surrogate_pending  = 0;
+	uint8_t run_index               = 0;
+
+	if( compressed_data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid compressed data.",
+		 function );
+
+		return( -1 );
+	}
+	if( compressed_data_size > (size_t) SSIZE_MAX )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid compressed data size value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	if( utf8_string_size == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid UTF-8 string size.",
+		 function );
+
+		return( -1 );
+	}
+	while( compressed_data_iterator < compressed_data_size )
+	{
+		compression_size = compressed_data[ compressed_data_iterator++ ];
+
+		/* Check if the last byte in the compressed string was the compression size
+		 * or the run-length byte value
+		 */
+		if( ( compressed_data_iterator + 1 ) >= compressed_data_size )
+		{
+			break;
+		}
+		/* Check if the compressed string was cut-short at the end
+		 */
+		if( ( compressed_data_iterator + 1 + compression_size ) > compressed_data_size )
+		{
+			compression_size = (uint8_t) ( compressed_data_size - compressed_data_iterator - 1 );
+		}
+		compression_byte = compressed_data[ compressed_data_iterator++ ];
+
+		run_data   = &( compressed_data[ compressed_data_iterator ] );
+		run_index  = 0;
+
+		compressed_data_iterator += compression_size;
+
+		if( compression_size == 0 )
+		{
+			continue;
+		}
+		/* A high surrogate at the end of the previous run is either followed
+		 * by a low surrogate or stored as the replacement character
+		 */
+		if( high_surrogate_pending != 0 )
+		{
+			if( ( compression_byte >= 0xdc )
+			 && ( compression_byte <= 0xdf ) )
+			{
+				safe_utf8_string_size += 4;
+
+				run_index = 1;
+			}
+			else
+			{
+				safe_utf8_string_size += 3;
+			}
+			high_surrogate_pending = 0;
+		}
+		if( compression_byte == 0 )
+		{
+			/* Most runs contain ASCII characters, which are counted 8 at a time
+			 * until a byte of 0, the end-of-string character, is encountered
+			 * The last bytes of the run are counted 8 at a time as well if the
+			 * compressed data contains 8 bytes, where the bytes after the run
+			 * are replaced by 0x01
+			 */
+			while( run_index < compression_size )
+			{
+				number_of_bytes = compression_size - run_index;
+
+				if( number_of_bytes > 8 )
+				{
+					number_of_bytes = 8;
+				}
+				else if( ( number_of_bytes < 8 )
+				      && ( ( compressed_data_size - ( compressed_data_iterator - compression_size + run_index ) ) < 8 ) )
+				{
+					break;
+				}
+				byte_stream_copy_to_uint64_little_endian(
+				 &( run_data[ run_index ] ),
+				 value_64bit );
+
+				if( number_of_bytes < 8 )
+				{
+					value_mask  = ( (uint64_t) 1 << ( number_of_bytes * 8 ) ) - 1;
+					value_64bit = ( value_64bit & value_mask ) | ( 0x0101010101010101ULL & ~value_mask );
+				}
+				if( ( ( value_64bit - 0x0101010101010101ULL ) & ~value_64bit & 0x8080808080808080ULL ) != 0 )
+				{
+					break;
+				}
+				/* Every byte of 0x80 or more is stored as 2 bytes
+				 */
+				value_64bit = ( value_64bit & 0x8080808080808080ULL ) >> 7;
+
+				safe_utf8_string_size += number_of_bytes + (size_t) ( ( value_64bit * 0x0101010101010101ULL ) >> 56 );
+
+				run_index += (uint8_t) number_of_bytes;
+			}
+			while( run_index < compression_size )
+			{
+				if( run_data[ run_index ] == 0 )
+				{
+					break;
+				}
+				else if( run_data[ run_index ] < 0x80 )
+				{
+					safe_utf8_string_size += 1;
+				}
+				else
+				{
+					safe_utf8_string_size += 2;
+				}
+				run_index++;
+			}
+			if( run_index < compression_size )
+			{
+				break;
+			}
+		}
+		else if( compression_byte < 0x08 )
+		{
+			safe_utf8_string_size += (size_t) ( compression_size - run_index ) * 2;
+		}
+		else if( ( compression_byte >= 0xd8 )
+		      && ( compression_byte <= 0xdb ) )
+		{
+			/* Every high surrogate, except for the last, is followed by another
+			 * high surrogate and is stored as the replacement character
+			 */
+			safe_utf8_string_size += (size_t) ( compression_size - run_index - 1 ) * 3;
+
+			high_surrogate_pending = 1;
+		}
+		else
+		{
+			/* Every other character is stored as 3 bytes, including a low surrogate
+			 * without high surrogate, which is stored as the replacement character
+			 */
+			safe_utf8_string_size += (size_t) ( compression_size - run_index ) * 3;
+		}
+	}
+	/* A high surrogate at the end of the string is ignored since the string was cut-off
+	 */
+	*utf8_string_size = safe_utf8_string_size + 1;
+
+	return( 1 );
+}
+
+/* Decompresses a run-length compressed UTF-16 string into an UTF-8 string
+ * The string ends at the first end-of-string character or at the end of the compressed data,
+ * surrogates without a matching surrogate are stored as the replacement character U+FFFD
+ * except for a high surrogate at the end of the string, which is ignored
+ * Returns 1 on success or -1 on error
+ */
+int mssearch_decompress_run_length_compressed_utf8_string(
+     uint8_t *utf8_string,
+     size_t utf8_string_size,
+     uint8_t *compressed_data,
+     size_t compressed_data_size,
+     libcerror_error_t **error )
+{
+	uint8_t *run_data               = NULL;
+	static char *function           = "mssearch_decompress_run_length_compressed_utf8_string";
+	size_t compressed_data_iterator = 0;
+	size_t utf8_string_index        = 0;
+	uint64_t value_64bit            = 0;
+	uint32_t unicode_character      = 0;
+	uint16_t high_surrogate         = 0;
+	uint8_t byte_value              = 0;
+	uint8_t compression_byte        = 0;
+	uint8_t compression_size        = 0;
+	uint8_t run_index               = 0;
+
+	if( utf8_string == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid UTF-8 string.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( utf8_string_size == 0 )
+	 || ( utf8_string_size > (size_t) SSIZE_MAX ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid UTF-8 string size value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( compressed_data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid compressed data.",
+		 function );
+
+		return( -1 );
+	}
+	if( compressed_data_size > (size_t) SSIZE_MAX )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid compressed data size value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	while( compressed_data_iterator < compressed_data_size )
+	{
+		compression_size = compressed_data[ compressed_data_iterator++ ];
+
+		/* Check if the last byte in the compressed string was the compression size
+		 * or the run-length byte value
+		 */
+		if( ( compressed_data_iterator + 1 ) >= compressed_data_size )
+		{
+			break;
+		}
+		/* Check if the compressed string was cut-short at the end
+		 */
+		if( ( compressed_data_iterator + 1 + compression_size ) > compressed_data_size )
+		{
+			compression_size = (uint8_t) ( compressed_data_size - compressed_data_iterator - 1 );
+		}
+		compression_byte = compressed_data[ compressed_data_iterator++ ];
+
+		run_data   = &( compressed_data[ compressed_data_iterator ] );
+		run_index  = 0;
+
+		compressed_data_iterator += compression_size;
+
+		if( compression_size == 0 )
+		{
+			continue;
+		}
+		if( high_surrogate != 0 )
+		{
+			if( ( compression_byte >= 0xdc )
+			 && ( compression_byte <= 0xdf ) )
+			{
+				if( ( utf8_string_size - utf8_string_index ) < 4 )
+				{
+					goto on_string_too_small;
+				}
+				unicode_character = 0x00010000UL
+				                  + ( (uint32_t) ( high_surrogate - 0xd800 ) << 10 )
+				                  + ( (uint32_t) ( compression_byte - 0xdc ) << 8 )
+				                  + run_data[ 0 ];
+
+				utf8_string[ utf8_string_index++ ] = (uint8_t) ( 0xf0 | ( unicode_character >> 18 ) );
+				utf8_string[ utf8_string_index++ ] = (uint8_t) ( 0x80 | ( ( unicode_character >> 12 ) & 0x3f ) );
+				utf8_string[ utf8_string_index++ ] = (uint8_t) ( 0x80 | ( ( unicode_character >> 6 ) & 0x3f ) );
+				utf8_string[ utf8_string_index++ ] = (uint8_t) ( 0x80 | ( unicode_character & 0x3f ) );
+
+				run_index = 1;
+			}
+			else
+			{
+				if( ( utf8_string_size - utf8_string_index ) < 3 )
+				{
+					goto on_string_too_small;
+				}
+				utf8_string[ utf8_string_index++ ] = 0xef;
+				utf8_string[ utf8_string_index++ ] = 0xbf;
+				utf8_string[ utf8_string_index++ ] = 0xbd;
+			}
+			high_surrogate = 0;
+		}
+		if( compression_byte == 0 )
+		{
+			/* Most runs contain ASCII characters, which are copied 8 at a time
+			 * while none of them is a byte of 0 or 0x80 or more
+			 */
+			while( run_index < compression_size )
+			{
+				if( ( ( compression_size - run_index ) >= 8 )
+				 && ( ( utf8_string_size - utf8_string_index ) >= 8 ) )
+				{
+					byte_stream_copy_to_uint64_little_endian(
+					 &( run_data[ run_index ] ),
+					 value_64bit );
+
+					if( ( ( value_64bit | ( value_64bit - 0x0101010101010101ULL ) ) & 0x8080808080808080ULL ) == 0 )
+					{
+						byte_stream_copy_from_uint64_little_endian(
+						 &( utf8_string[ utf8_string_index ] ),
+						 value_64bit );
+
+						utf8_string_index += 8;
+						run_index         += 8;
+
+						continue;
+					}
+				}
+				byte_value = run_data[ run_index ];
+
+				if( byte_value == 0 )
+				{
+					break;
+				}
+				else if( byte_value < 0x80 )
+				{
+					if( utf8_string_index >= utf8_string_size )
+					{
+						goto on_string_too_small;
+					}
+					utf8_string[ utf8_string_index++ ] = byte_value;
+				}
+				else
+				{
+					if( ( utf8_string_size - utf8_string_index ) < 2 )
+					{
+						goto on_string_too_small;
+					}
+					utf8_string[ utf8_string_index++ ] = (uint8_t) ( 0xc0 | ( byte_value >> 6 ) );
+					utf8_string[ utf8_string_index++ ] = (uint8_t) ( 0x80 | ( byte_value & 0x3f ) );
+				}
+				run_index++;
+			}
+			if( run_index < compression_size )
+			{
+				break;
+			}
+		}
+		else if( compression_byte < 0x08 )
+		{
+			if( ( utf8_string_size - utf8_string_index ) < ( (size_t) ( compression_size - run_index ) * 2 ) )
+			{
+				goto on_string_too_small;
+			}
+			while( run_index < compression_size )
+			{
+				byte_value = run_data[ run_index++ ];
+
+				utf8_string[ utf8_string_index++ ] = (uint8_t) ( 0xc0 | ( compression_byte << 2 ) | ( byte_value >> 6 ) );
+				utf8_string[ utf8_string_index++ ] = (uint8_t) ( 0x80 | ( byte_value & 0x3f ) );
+			}
+		}
+		else if( ( compression_byte < 0xd8 )
+		      || ( compression_byte > 0xdf ) )
+		{
+			if( ( utf8_string_size - utf8_string_index ) < ( (size_t) ( compression_size - run_index ) * 3 ) )
+			{
+				goto on_string_too_small;
+			}
+			while( run_index < compression_size )
+			{
+				byte_value = run_data[ run_index++ ];
+
+				utf8_string[ utf8_string_index++ ] = (uint8_t) ( 0xe0 | ( compression_byte >> 4 ) );
+				utf8_string[ utf8_string_index++ ] = (uint8_t) ( 0x80 | ( ( compression_byte & 0x0f ) << 2 ) | ( byte_value >> 6 ) );
+				utf8_string[ utf8_string_index++ ] = (uint8_t) ( 0x80 | ( byte_value & 0x3f ) );
+			}
+		}
+		else
+		{
+			/* Every high surrogate, except for the last, is followed by another high
+			 * surrogate and every low surrogate of the run is without high surrogate
+			 */
+			if( compression_byte <= 0xdb )
+			{
+				high_surrogate = ( (uint16_t) compression_byte << 8 ) | run_data[ compression_size - 1 ];
+
+				compression_size--;
+			}
+			if( ( utf8_string_size - utf8_string_index ) < ( (size_t) ( compression_size - run_index ) * 3 ) )
+			{
+				goto on_string_too_small;
+			}
+			while( run_index < compression_size )
+			{
+				utf8_string[ utf8_string_index++ ] = 0xef;
+				utf8_string[ utf8_string_index++ ] = 0xbf;
+				utf8_string[ utf8_string_index++ ] = 0xbd;
+
+				run_index++;
+			}
+		}
+	}
+	if( utf8_string_index >= utf8_string_size )
+	{
+		goto on_string_too_small;
+	}
+	utf8_string[ utf8_string_index ] = 0;
+
+	return( 1 );
+
+on_string_too_small:
+	libcerror_error_set(
+	 error,
+	 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+	 LIBCERROR_ARGUMENT_ERROR_VALUE_TOO_SMALL,
+	 "%s: UTF-8 string size value too small.",
+	 function );
+
+	return( -1 );
+}
+
 /* Determines the uncompressed data size of a run-length compressed UTF-16 string
  * Returns 1 on success or -1 on error
  */
@@ -387,6 +955,17 @@ int mssearch_get_byte_index_uncompressed_data_size(
 
 		return( -1 );
 	}
+	if( compressed_data_size < 2 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_TOO_SMALL,
+		 "%s: compressed data size value too small.",
+		 function );
+
+		return( -1 );
+	}
 	/* The first 2 bytes contain the uncompressed data size
 	 */
 	byte_stream_copy_to_uint16_little_endian(
@@ -399,11 +978,15 @@ int mssearch_get_byte_index_uncompressed_data_size(
 }
 
 /* Decompresses byte-index compressed data
+ * The uncompressed data size is the size of the uncompressed data buffer,
+ * which should be at least the size stored in the compressed data or
+ * MSSEARCH_BYTE_INDEX_MAXIMUM_UNCOMPRESSED_DATA_SIZE if the stored size is not known
+ * On return uncompressed data size contains the size of the uncompressed data
  * Returns 1 on success or -1 on error
  */
 int mssearch_decompress_byte_indexed_compressed_data(
      uint8_t *uncompressed_data,
-     size_t uncompressed_data_size,
+     size_t *uncompressed_data_size,
      uint8_t *compressed_data,
      size_t compressed_data_size,
      libcerror_error_t **error )
@@ -415,9 +998,9 @@ int mssearch_decompress_byte_indexed_compressed_data(
 
 	static char *function                   = "mssearch_decompress_byte_indexed_compressed_data";
 	size_t compressed_data_iterator         = 0;
-	size_t compression_iterator             = 0;
 	size_t uncompressed_data_iterator       = 0;
 
+	uint32_t code_space                     = 0;
 	uint32_t compressed_data_bit_stream     = 0;
 	uint32_t compression_offset             = 0;
 	uint32_t nibble_count                   = 0;
@@ -445,7 +1028,18 @@ int mssearch_decompress_byte_indexed_compressed_data(
 
 		return( -1 );
 	}
-	if( uncompressed_data_size > (size_t) SSIZE_MAX )
+	if( uncompressed_data_size == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid uncompressed data size.",
+		 function );
+
+		return( -1 );
+	}
+	if( *uncompressed_data_size > (size_t) SSIZE_MAX )
 	{
 		libcerror_error_set(
 		 error,
@@ -478,7 +1072,10 @@ int mssearch_decompress_byte_indexed_compressed_data(
 
 		return( -1 );
 	}
-	if( compressed_data_size <= 1 )
+	/* The compressed data contains a 2-byte uncompressed data size,
+	 * a 256-byte compression table and at least 4 bytes of bit stream
+	 */
+	if( compressed_data_size < ( 2 + 256 + 4 ) )
 	{
 		libcerror_error_set(
 		 error,
@@ -521,7 +1118,7 @@ int mssearch_decompress_byte_indexed_compressed_data(
 	 compressed_data,
 	 stored_uncompressed_data_size );
 
-	if( uncompressed_data_size < stored_uncompressed_data_size )
+	if( *uncompressed_data_size < stored_uncompressed_data_size )
 	{
 		libcerror_error_set(
 		 error,
@@ -615,6 +1212,29 @@ int mssearch_decompress_byte_indexed_compressed_data(
 
 		return( -1 );
 	}
+	/* The nibbles contain the number of bits of the code of every value
+	 * an over-subscribed set of codes, where the codes do not fit in 15 bits,
+	 * would cause the compression value table to be filled out of bounds
+	 */
+	code_space = 0;
+
+	for( nibble_count_table_index = 1;
+	     nibble_count_table_index < 16;
+	     nibble_count_table_index++ )
+	{
+		code_space += nibble_count_table[ nibble_count_table_index ] << ( 15 - nibble_count_table_index );
+	}
+	if( code_space > 0x8000 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid compression table value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
 	/* Determine the total nible counts
 	 */
 	nibble_count = 0;
@@ -1017,7 +1637,7 @@ int mssearch_decompress_byte_indexed_compressed_data(
 
 				number_of_bits_available += 0x10;
 			}
-			if( ( uncompressed_data_iterator + compression_size ) > uncompressed_data_size )
+			if( ( uncompressed_data_iterator + compression_size ) > *uncompressed_data_size )
 			{
 				libcerror_error_set(
 				 error,
@@ -1039,18 +1659,18 @@ int mssearch_decompress_byte_indexed_compressed_data(
 
 				return( -1 );
 			}
-			compression_iterator = uncompressed_data_iterator - compression_offset;
-
-			while( compression_size > 0 )
-			{
-				uncompressed_data[ uncompressed_data_iterator++ ] = uncompressed_data[ compression_iterator++ ];
-
-				compression_size--;
-			}
+			lz_match_copy(
+			 uncompressed_data,
+			 *uncompressed_data_size,
+			 uncompressed_data_iterator,
+			 (size_t) compression_offset,
+			 (size_t) compression_size );
+
+			uncompressed_data_iterator += compression_size;
 		}
 		else
 		{
-			if( uncompressed_data_iterator >= uncompressed_data_size )
+			if( uncompressed_data_iterator >= *uncompressed_data_size )
 			{
 				libcerror_error_set(
 				 error,
@@ -1076,6 +1696,8 @@ int mssearch_decompress_byte_indexed_compressed_data(
 		 0 );
 	}
 #endif
+	*uncompressed_data_size = uncompressed_data_iterator;
+
 	return( 1 );
 }
 
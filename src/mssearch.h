@@ -31,6 +31,10 @@
 extern "C" {
 #endif
 
+/* The maximum size of byte-index uncompressed data, which is stored as a 16-bit value
+ */
+#define MSSEARCH_BYTE_INDEX_MAXIMUM_UNCOMPRESSED_DATA_SIZE	0xffff
+
 int mssearch_decode(
      uint8_t *data,
      size_t data_size,
@@ -51,6 +55,19 @@ int mssearch_decompress_run_length_compressed_utf16_string(
      size_t compressed_data_size,
      libcerror_error_t **error );
 
+int mssearch_get_run_length_uncompressed_utf8_string_size(
+     uint8_t *compressed_data,
+     size_t compressed_data_size,
+     size_t *utf8_string_size,
+     libcerror_error_t **error );
+
+int mssearch_decompress_run_length_compressed_utf8_string(
+     uint8_t *utf8_string,
+     size_t utf8_string_size,
+     uint8_t *compressed_data,
+     size_t compressed_data_size,
+     libcerror_error_t **error );
+
 int mssearch_get_byte_index_uncompressed_data_size(
      uint8_t *compressed_data,
      size_t compressed_data_size,
@@ -59,7 +76,7 @@ int mssearch_get_byte_index_uncompressed_data_size(
 
 int mssearch_decompress_byte_indexed_compressed_data(
      uint8_t *uncompressed_data,
-     size_t uncompressed_data_size,
+     size_t *uncompressed_data_size,
      uint8_t *compressed_data,
      size_t compressed_data_size,
      libcerror_error_t **error );
@@ -20,6 +20,7 @@
  */
 
 #include <common.h>
+#include <byte_stream.h>
 #include <file_stream.h>
 #include <memory.h>
 #include <narrow_string.h>
@@ -50,18 +51,693 @@ void usage_fprint(
 	}
 	fprintf( stream, "Use mssearchdecode to decode MS Search encoded data.\n\n" );
 
-	fprintf( stream, "Usage: mssearchdecode [ -o offset ] [ -s size ] [ -hvV ] source\n\n" );
+	fprintf( stream, "Usage: mssearchdecode [ -D window ] [ -o offset ] [ -s size ]\n"
+	                 "                      [ -S format ] [ -bhvV ] source\n\n" );
 
 	fprintf( stream, "\tsource: the source file\n\n" );
 
+	fprintf( stream, "\t-b:     batch mode, decodes all records in the source file, where every\n"
+	                 "\t        record consists of a 32-bit little-endian size followed by\n"
+	                 "\t        the encoded data, the values are written to the destination\n"
+	                 "\t        file as records of a 32-bit little-endian size followed by\n"
+	                 "\t        the value data, strings are written as UTF-8 and records that\n"
+	                 "\t        cannot be decoded as a size of 0xffffffff\n" );
+	fprintf( stream, "\t-D:     limit the hexadecimal representation of the data to\n"
+	                 "\t        a window formatted as offset:size or offset relative\n"
+	                 "\t        to the start of the data (default is all data)\n" );
 	fprintf( stream, "\t-h:     shows this help\n" );
 	fprintf( stream, "\t-o:     data offset (default is 0)\n" );
 	fprintf( stream, "\t-s:     size of data (default is the file size)\n" );
+	fprintf( stream, "\t-S:     print timing and throughput statistics of the open,\n"
+	                 "\t        read, compute and write phases and the peak memory\n"
+	                 "\t        size to stderr in the format: text or json\n" );
 	fprintf( stream, "\t-v:     verbose output to stderr\n" );
 	fprintf( stream, "\t-V:     print version\n" );
 	fprintf( stream, "\n" );
 }
 
+/* Buffer that is reused for multiple records
+ */
+typedef struct mssearchdecode_buffer mssearchdecode_buffer_t;
+
+struct mssearchdecode_buffer
+{
+	/* The data
+	 */
+	uint8_t *data;
+
+	/* The allocated size of the data
+	 */
+	size_t size;
+};
+
+/* Resizes a buffer if it is smaller than size
+ * Returns 1 if successful or -1 on error
+ */
+int mssearchdecode_buffer_resize(
+     mssearchdecode_buffer_t *buffer,
+     size_t size,
+     libcerror_error_t **error )
+{
+	uint8_t *reallocated_data = NULL;
+	static char *function     = "mssearchdecode_buffer_resize";
+
+	if( buffer == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid buffer.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( size == 0 )
+	 || ( size > (size_t) SSIZE_MAX ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid size value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( size > buffer->size )
+	{
+		reallocated_data = (uint8_t *) memory_reallocate(
+		                                buffer->data,
+		                                sizeof( uint8_t ) * size );
+
+		if( reallocated_data == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+			 "%s: unable to resize buffer.",
+			 function );
+
+			return( -1 );
+		}
+		buffer->data = reallocated_data;
+		buffer->size = size;
+	}
+	return( 1 );
+}
+
+/* Decodes and decompresses a value
+ * The value data is stored in one of the buffers and is valid until the next call
+ * Strings are converted to UTF-8 without end-of-string character
+ * Returns 1 if successful or -1 on error
+ */
+int mssearchdecode_decode_value(
+     mssearchdecode_buffer_t *decoded_data_buffer,
+     mssearchdecode_buffer_t *uncompressed_data_buffer,
+     mssearchdecode_buffer_t *value_buffer,
+     uint8_t *encoded_data,
+     size_t encoded_data_size,
+     int ascii_codepage,
+     uint8_t **value_data,
+     size_t *value_data_size,
+     libcerror_error_t **error )
+{
+	uint8_t *data                 = NULL;
+	static char *function         = "mssearchdecode_decode_value";
+	size_t data_size              = 0;
+	size_t uncompressed_data_size = 0;
+	size_t value_string_size      = 0;
+	uint8_t compression_type      = 0;
+
+	if( encoded_data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid encoded data.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( encoded_data_size < 1 )
+	 || ( encoded_data_size > (size_t) SSIZE_MAX ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid encoded data size value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( value_data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid value data.",
+		 function );
+
+		return( -1 );
+	}
+	if( value_data_size == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid value data size.",
+		 function );
+
+		return( -1 );
+	}
+	if( mssearchdecode_buffer_resize(
+	     decoded_data_buffer,
+	     encoded_data_size,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_RESIZE_FAILED,
+		 "%s: unable to resize decoded data buffer.",
+		 function );
+
+		return( -1 );
+	}
+	if( mssearch_decode(
+	     decoded_data_buffer->data,
+	     decoded_data_buffer->size,
+	     encoded_data,
+	     encoded_data_size,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GENERIC,
+		 "%s: unable to decode data.",
+		 function );
+
+		return( -1 );
+	}
+	compression_type = decoded_data_buffer->data[ 0 ];
+
+	data      = &( decoded_data_buffer->data[ 1 ] );
+	data_size = encoded_data_size - 1;
+
+	/* Byte-index compressed data
+	 */
+	if( ( compression_type & 0x02 ) != 0 )
+	{
+		/* The buffer is sized for the largest byte-index uncompressed data
+		 * so that it can be reused for every record without having to
+		 * determine the uncompressed data size first
+		 */
+		if( mssearchdecode_buffer_resize(
+		     uncompressed_data_buffer,
+		     MSSEARCH_BYTE_INDEX_MAXIMUM_UNCOMPRESSED_DATA_SIZE,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_RESIZE_FAILED,
+			 "%s: unable to resize uncompressed data buffer.",
+			 function );
+
+			return( -1 );
+		}
+		uncompressed_data_size = uncompressed_data_buffer->size;
+
+		if( mssearch_decompress_byte_indexed_compressed_data(
+		     uncompressed_data_buffer->data,
+		     &uncompressed_data_size,
+		     data,
+		     data_size,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_COMPRESSION,
+			 LIBCERROR_COMPRESSION_ERROR_DECOMPRESS_FAILED,
+			 "%s: unable to decompress byte-index compressed data.",
+			 function );
+
+			return( -1 );
+		}
+		data      = uncompressed_data_buffer->data;
+		data_size = uncompressed_data_size;
+
+		compression_type &= ~( 0x02 );
+	}
+	/* Run-length compressed UTF-16 little-endian string, which is decompressed
+	 * directly into an UTF-8 string
+	 */
+	if( compression_type == 0 )
+	{
+		if( mssearch_get_run_length_uncompressed_utf8_string_size(
+		     data,
+		     data_size,
+		     &value_string_size,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve run-length uncompressed UTF-8 string size.",
+			 function );
+
+			return( -1 );
+		}
+		*value_data      = value_buffer->data;
+		*value_data_size = 0;
+
+		if( value_string_size <= 1 )
+		{
+			return( 1 );
+		}
+		if( mssearchdecode_buffer_resize(
+		     value_buffer,
+		     value_string_size,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_RESIZE_FAILED,
+			 "%s: unable to resize value buffer.",
+			 function );
+
+			return( -1 );
+		}
+		if( mssearch_decompress_run_length_compressed_utf8_string(
+		     value_buffer->data,
+		     value_string_size,
+		     data,
+		     data_size,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_COMPRESSION,
+			 LIBCERROR_COMPRESSION_ERROR_DECOMPRESS_FAILED,
+			 "%s: unable to decompress run-length compressed UTF-16 string.",
+			 function );
+
+			return( -1 );
+		}
+	}
+	/* 8-bit compressed UTF-16 little-endian string
+	 */
+	else if( compression_type == 1 )
+	{
+		*value_data      = value_buffer->data;
+		*value_data_size = 0;
+
+		if( data_size == 0 )
+		{
+			return( 1 );
+		}
+		if( libuna_utf8_string_size_from_byte_stream(
+		     data,
+		     data_size,
+		     ascii_codepage,
+		     &value_string_size,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to determine size of value string.",
+			 function );
+
+			return( -1 );
+		}
+		if( mssearchdecode_buffer_resize(
+		     value_buffer,
+		     value_string_size,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_RESIZE_FAILED,
+			 "%s: unable to resize value buffer.",
+			 function );
+
+			return( -1 );
+		}
+		if( libuna_utf8_string_copy_from_byte_stream(
+		     value_buffer->data,
+		     value_string_size,
+		     data,
+		     data_size,
+		     ascii_codepage,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve value string.",
+			 function );
+
+			return( -1 );
+		}
+	}
+	/* uncompressed data
+	 */
+	else if( compression_type == 4 )
+	{
+		*value_data      = data;
+		*value_data_size = data_size;
+
+		return( 1 );
+	}
+	else
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_UNSUPPORTED_VALUE,
+		 "%s: unsupported compression type: 0x%02" PRIx8 ".",
+		 function,
+		 compression_type );
+
+		return( -1 );
+	}
+	/* Do not include the end-of-string character
+	 */
+	*value_data      = value_buffer->data;
+	*value_data_size = value_string_size - 1;
+
+	return( 1 );
+}
+
+/* Decodes a stream of records
+ * Every record consists of a 32-bit little-endian size followed by the encoded data
+ * Every decoded value is written as a 32-bit little-endian size followed by the value data,
+ * a record that cannot be decoded is written as a size of 0xffffffff without value data
+ * Returns 1 if successful or -1 on error
+ */
+int mssearchdecode_decode_records(
+     libcfile_file_t *source_file,
+     size64_t source_size,
+     libcfile_file_t *destination_file,
+     int ascii_codepage,
+     uint64_t *number_of_records,
+     uint64_t *number_of_failed_records,
+     libcerror_error_t **error )
+{
+	uint8_t record_size_data[ 4 ];
+
+	mssearchdecode_buffer_t decoded_data_buffer      = { NULL, 0 };
+	mssearchdecode_buffer_t encoded_data_buffer      = { NULL, 0 };
+	mssearchdecode_buffer_t uncompressed_data_buffer = { NULL, 0 };
+	mssearchdecode_buffer_t value_buffer             = { NULL, 0 };
+	libcerror_error_t *record_error                  = NULL;
+	uint8_t *value_data                              = NULL;
+	static char *function                            = "mssearchdecode_decode_records";
+	size_t value_data_size                           = 0;
+	ssize_t read_count                               = 0;
+	ssize_t write_count                              = 0;
+	uint64_t phase_start_time                        = 0;
+	uint32_t record_size                             = 0;
+	int result                                       = 0;
+
+	if( number_of_records == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid number of records.",
+		 function );
+
+		return( -1 );
+	}
+	if( number_of_failed_records == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid number of failed records.",
+		 function );
+
+		return( -1 );
+	}
+	*number_of_records        = 0;
+	*number_of_failed_records = 0;
+
+	while( source_size >= 4 )
+	{
+		phase_start_time = assorted_output_statistics_start_phase();
+
+		read_count = libcfile_file_read_buffer(
+		              source_file,
+		              record_size_data,
+		              4,
+		              error );
+
+		if( read_count != (ssize_t) 4 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_READ_FAILED,
+			 "%s: unable to read record: %" PRIu64 " size.",
+			 function,
+			 *number_of_records );
+
+			goto on_error;
+		}
+		assorted_output_statistics_stop_phase(
+		 ASSORTED_OUTPUT_STATISTICS_PHASE_READ,
+		 phase_start_time,
+		 (size64_t) read_count );
+
+		source_size -= 4;
+
+		byte_stream_copy_to_uint32_little_endian(
+		 record_size_data,
+		 record_size );
+
+		if( (size64_t) record_size > source_size )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+			 "%s: invalid record: %" PRIu64 " size value out of bounds.",
+			 function,
+			 *number_of_records );
+
+			goto on_error;
+		}
+		result = -1;
+
+		if( record_size > 0 )
+		{
+			if( mssearchdecode_buffer_resize(
+			     &encoded_data_buffer,
+			     (size_t) record_size,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_RESIZE_FAILED,
+				 "%s: unable to resize encoded data buffer.",
+				 function );
+
+				goto on_error;
+			}
+			phase_start_time = assorted_output_statistics_start_phase();
+
+			read_count = libcfile_file_read_buffer(
+			              source_file,
+			              encoded_data_buffer.data,
+			              (size_t) record_size,
+			              error );
+
+			if( read_count != (ssize_t) record_size )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_IO,
+				 LIBCERROR_IO_ERROR_READ_FAILED,
+				 "%s: unable to read record: %" PRIu64 " data.",
+				 function,
+				 *number_of_records );
+
+				goto on_error;
+			}
+			assorted_output_statistics_stop_phase(
+			 ASSORTED_OUTPUT_STATISTICS_PHASE_READ,
+			 phase_start_time,
+			 (size64_t) read_count );
+
+			source_size -= record_size;
+
+			result = mssearchdecode_decode_value(
+			          &decoded_data_buffer,
+			          &uncompressed_data_buffer,
+			          &value_buffer,
+			          encoded_data_buffer.data,
+			          (size_t) record_size,
+			          ascii_codepage,
+			          &value_data,
+			          &value_data_size,
+			          &record_error );
+		}
+		if( ( result == 1 )
+		 && ( value_data_size >= (size_t) 0xffffffffUL ) )
+		{
+			result = -1;
+		}
+		if( result != 1 )
+		{
+			fprintf(
+			 stderr,
+			 "Unable to decode record: %" PRIu64 ".\n",
+			 *number_of_records );
+
+			if( record_error != NULL )
+			{
+				libcnotify_print_error_backtrace(
+				 record_error );
+				libcerror_error_free(
+				 &record_error );
+			}
+			*number_of_failed_records += 1;
+
+			value_data_size = 0;
+			record_size     = 0xffffffffUL;
+		}
+		else
+		{
+			record_size = (uint32_t) value_data_size;
+		}
+		byte_stream_copy_from_uint32_little_endian(
+		 record_size_data,
+		 record_size );
+
+		phase_start_time = assorted_output_statistics_start_phase();
+
+		write_count = libcfile_file_write_buffer(
+		               destination_file,
+		               record_size_data,
+		               4,
+		               error );
+
+		if( write_count != (ssize_t) 4 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_WRITE_FAILED,
+			 "%s: unable to write record: %" PRIu64 " size.",
+			 function,
+			 *number_of_records );
+
+			goto on_error;
+		}
+		assorted_output_statistics_stop_phase(
+		 ASSORTED_OUTPUT_STATISTICS_PHASE_WRITE,
+		 phase_start_time,
+		 (size64_t) write_count );
+
+		if( value_data_size > 0 )
+		{
+			phase_start_time = assorted_output_statistics_start_phase();
+
+			write_count = libcfile_file_write_buffer(
+			               destination_file,
+			               value_data,
+			               value_data_size,
+			               error );
+
+			if( write_count != (ssize_t) value_data_size )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_IO,
+				 LIBCERROR_IO_ERROR_WRITE_FAILED,
+				 "%s: unable to write record: %" PRIu64 " data.",
+				 function,
+				 *number_of_records );
+
+				goto on_error;
+			}
+			assorted_output_statistics_stop_phase(
+			 ASSORTED_OUTPUT_STATISTICS_PHASE_WRITE,
+			 phase_start_time,
+			 (size64_t) write_count );
+		}
+		*number_of_records += 1;
+	}
+	if( source_size != 0 )
+	{
+		fprintf(
+		 stderr,
+		 "Trailing data of %" PRIu64 " bytes after last record ignored.\n",
+		 source_size );
+	}
+	if( value_buffer.data != NULL )
+	{
+		memory_free(
+		 value_buffer.data );
+	}
+	if( uncompressed_data_buffer.data != NULL )
+	{
+		memory_free(
+		 uncompressed_data_buffer.data );
+	}
+	if( encoded_data_buffer.data != NULL )
+	{
+		memory_free(
+		 encoded_data_buffer.data );
+	}
+	if( decoded_data_buffer.data != NULL )
+	{
+		memory_free(
+		 decoded_data_buffer.data );
+	}
+	return( 1 );
+
+on_error:
+	if( value_buffer.data != NULL )
+	{
+		memory_free(
+		 value_buffer.data );
+	}
+	if( uncompressed_data_buffer.data != NULL )
+	{
+		memory_free(
+		 uncompressed_data_buffer.data );
+	}
+	if( encoded_data_buffer.data != NULL )
+	{
+		memory_free(
+		 encoded_data_buffer.data );
+	}
+	if( decoded_data_buffer.data != NULL )
+	{
+		memory_free(
+		 decoded_data_buffer.data );
+	}
+	return( -1 );
+}
+
 /* The main program
  */
 #if defined( HAVE_WIDE_SYSTEM_CHARACTER )
@@ -72,32 +748,39 @@ int main( int argc, char * const argv[] )
 {
 	char destination[ 128 ];
 
-	libcerror_error_t *error         = NULL;
-	libcfile_file_t *source_file     = NULL;
-	system_character_t *source       = NULL;
-	system_character_t *value_string = NULL;
-	uint8_t *buffer                  = NULL;
-	uint8_t *decoded_data            = NULL;
-	uint8_t *narrow_value_string     = NULL;
-	uint8_t *uncompressed_data       = NULL;
-	uint8_t *value_utf16_stream      = NULL;
-	static char *function            = "main";
-	char *program                    = "mssearchdecode";
-	system_integer_t option          = 0;
-	size64_t source_size             = 0;
-	size_t buffer_size               = 0;
-	size_t decoded_data_size         = 0;
-	size_t narrow_value_string_size  = 0;
-	size_t uncompressed_data_size    = 0;
-	size_t value_string_size         = 0;
-	size_t value_utf16_stream_size   = 0;
-	ssize_t read_count               = 0;
-	off_t source_offset              = 0;
-	uint8_t compression_type         = 0;
-	int ascii_codepage               = LIBUNA_CODEPAGE_WINDOWS_1252;
-	int print_count                  = 0;
-	int result                       = 0;
-	int verbose                      = 0;
+	libcerror_error_t *error                     = NULL;
+	libcfile_file_t *destination_file            = NULL;
+	libcfile_file_t *source_file                 = NULL;
+	system_character_t *option_hexdump_window    = NULL;
+	system_character_t *option_statistics_format = NULL;
+	system_character_t *source                   = NULL;
+	system_character_t *value_string             = NULL;
+	uint8_t *buffer                              = NULL;
+	uint8_t *decoded_data                        = NULL;
+	uint8_t *narrow_value_string                 = NULL;
+	uint8_t *uncompressed_data                   = NULL;
+	uint8_t *value_utf16_stream                  = NULL;
+	static char *function                        = "main";
+	char *program                                = "mssearchdecode";
+	system_integer_t option                      = 0;
+	size64_t source_size                         = 0;
+	size_t buffer_size                           = 0;
+	size_t decoded_data_size                     = 0;
+	size_t narrow_value_string_size              = 0;
+	size_t uncompressed_data_size                = 0;
+	size_t value_string_size                     = 0;
+	size_t value_utf16_stream_size               = 0;
+	ssize_t read_count                           = 0;
+	off_t source_offset                          = 0;
+	uint64_t number_of_failed_records            = 0;
+	uint64_t number_of_records                   = 0;
+	uint64_t phase_start_time                    = 0;
+	uint8_t compression_type                     = 0;
+	int ascii_codepage                           = LIBUNA_CODEPAGE_WINDOWS_1252;
+	int batch_mode                               = 0;
+	int print_count                              = 0;
+	int result                                   = 0;
+	int verbose                                  = 0;
 
 	libcnotify_stream_set(
 	 stderr,
@@ -112,7 +795,7 @@ int main( int argc, char * const argv[] )
 	while( ( option = assorted_getopt(
 	                   argc,
 	                   argv,
-	                   _SYSTEM_STRING( "ho:s:vV" ) ) ) != (system_integer_t) -1 )
+	                   _SYSTEM_STRING( "bD:ho:s:S:vV" ) ) ) != (system_integer_t) -1 )
 	{
 		switch( option )
 		{
@@ -128,6 +811,16 @@ int main( int argc, char * const argv[] )
 
 				return( EXIT_FAILURE );
 
+			case 'b':
+				batch_mode = 1;
+
+				break;
+
+			case 'D':
+				option_hexdump_window = optarg;
+
+				break;
+
 			case 'h':
 				usage_fprint(
 				 stdout );
@@ -144,6 +837,11 @@ int main( int argc, char * const argv[] )
 
 				break;
 
+			case 'S':
+				option_statistics_format = optarg;
+
+				break;
+
 			case 'v':
 				verbose = 1;
 
@@ -175,6 +873,30 @@ int main( int argc, char * const argv[] )
 	libcnotify_verbose_set(
 	 verbose );
 
+	if( assorted_output_statistics_initialize(
+	     option_statistics_format,
+	     &error ) != 1 )
+	{
+		fprintf(
+		 stderr,
+		 "Unable to initialize statistics.\n" );
+
+		goto on_error;
+	}
+	if( option_hexdump_window != NULL )
+	{
+		if( assorted_output_hexdump_window_set(
+		     option_hexdump_window,
+		     &error ) != 1 )
+		{
+			fprintf(
+			 stderr,
+			 "Unsupported hexdump window.\n" );
+
+			goto on_error;
+		}
+	}
+
 	/* Open the source file
 	 */
 	if( libcfile_file_initialize(
@@ -187,6 +909,8 @@ int main( int argc, char * const argv[] )
 
 		goto on_error;
 	}
+	phase_start_time = assorted_output_statistics_start_phase();
+
 	if( libcfile_file_open(
 	     source_file,
 	     source,
@@ -199,6 +923,11 @@ int main( int argc, char * const argv[] )
 
 		goto on_error;
 	}
+	assorted_output_statistics_stop_phase(
+	 ASSORTED_OUTPUT_STATISTICS_PHASE_OPEN,
+	 phase_start_time,
+	 0 );
+
 	if( source_size == 0 )
 	{
 		if( libcfile_file_get_size(
@@ -212,6 +941,165 @@ int main( int argc, char * const argv[] )
 
 			goto on_error;
 		}
+		if( batch_mode != 0 )
+		{
+			if( (size64_t) source_offset > source_size )
+			{
+				fprintf(
+				 stderr,
+				 "Invalid source offset value out of bounds.\n" );
+
+				goto on_error;
+			}
+			source_size -= (size64_t) source_offset;
+		}
+	}
+	print_count = narrow_string_snprintf(
+	               destination,
+	               128,
+	               "%s.mssearch.decoded",
+	               source );
+
+	if( ( print_count < 0 )
+	 || ( print_count > 128 ) )
+	{
+		fprintf(
+		 stderr,
+		 "Unable to set destination filename.\n" );
+
+		goto on_error;
+	}
+	if( batch_mode != 0 )
+	{
+		if( libcfile_file_seek_offset(
+		     source_file,
+		     source_offset,
+		     SEEK_SET,
+		     &error ) == -1 )
+		{
+			fprintf(
+			 stderr,
+			 "Unable to seek offset in source file.\n" );
+
+			goto on_error;
+		}
+		if( libcfile_file_initialize(
+		     &destination_file,
+		     &error ) != 1 )
+		{
+			fprintf(
+			 stderr,
+			 "Unable to create destination file.\n" );
+
+			goto on_error;
+		}
+		phase_start_time = assorted_output_statistics_start_phase();
+
+		if( libcfile_file_open(
+		     destination_file,
+		     destination,
+		     LIBCFILE_OPEN_WRITE,
+		     &error ) != 1 )
+		{
+			fprintf(
+			 stderr,
+			 "Unable to open destination file.\n" );
+
+			goto on_error;
+		}
+		assorted_output_statistics_stop_phase(
+		 ASSORTED_OUTPUT_STATISTICS_PHASE_OPEN,
+		 phase_start_time,
+		 0 );
+
+		fprintf(
+		 stdout,
+		 "Starting MS Search decoding records of: %" PRIs_SYSTEM " at offset: %" PRIjd " (0x%08" PRIjx ").\n",
+		 source,
+		 source_offset,
+		 source_offset );
+
+		if( mssearchdecode_decode_records(
+		     source_file,
+		     source_size,
+		     destination_file,
+		     ascii_codepage,
+		     &number_of_records,
+		     &number_of_failed_records,
+		     &error ) != 1 )
+		{
+			fprintf(
+			 stderr,
+			 "Unable to decode records.\n" );
+
+			goto on_error;
+		}
+		phase_start_time = assorted_output_statistics_start_phase();
+
+		if( libcfile_file_close(
+		     destination_file,
+		     &error ) != 0 )
+		{
+			fprintf(
+			 stderr,
+			 "Unable to close destination file.\n" );
+
+			goto on_error;
+		}
+		assorted_output_statistics_stop_phase(
+		 ASSORTED_OUTPUT_STATISTICS_PHASE_WRITE,
+		 phase_start_time,
+		 0 );
+
+		if( libcfile_file_free(
+		     &destination_file,
+		     &error ) != 1 )
+		{
+			fprintf(
+			 stderr,
+			 "Unable to free destination file.\n" );
+
+			goto on_error;
+		}
+		if( libcfile_file_close(
+		     source_file,
+		     &error ) != 0 )
+		{
+			fprintf(
+			 stderr,
+			 "Unable to close source file.\n" );
+
+			goto on_error;
+		}
+		if( libcfile_file_free(
+		     &source_file,
+		     &error ) != 1 )
+		{
+			fprintf(
+			 stderr,
+			 "Unable to free source file.\n" );
+
+			goto on_error;
+		}
+		fprintf(
+		 stdout,
+		 "Decoded %" PRIu64 " records of which %" PRIu64 " failed.\n",
+		 number_of_records,
+		 number_of_failed_records );
+
+		if( number_of_failed_records != 0 )
+		{
+			fprintf(
+			 stdout,
+			 "MS Search decoding:\tFAILURE\n" );
+
+			return( EXIT_FAILURE );
+		}
+		fprintf(
+		 stdout,
+		 "MS Search decoding:\tSUCCESS\n" );
+
+		return( EXIT_SUCCESS );
 	}
 	if( source_size == 0 )
 	{
@@ -271,22 +1159,6 @@ int main( int argc, char * const argv[] )
 
 		goto on_error;
 	}
-	print_count = narrow_string_snprintf(
-	               destination,
-	               128,
-	               "%s.mssearch.decoded",
-	               source );
-
-	if( ( print_count < 0 )
-	 || ( print_count > 128 ) )
-	{
-		
-		fprintf(
-		 stderr,
-		 "Unable to set destination filename.\n" );
-
-		goto on_error;
-	}
 	fprintf(
 	 stdout,
 	 "Starting MS Search decoding data of: %" PRIs_SYSTEM " at offset: %" PRIjd " (0x%08" PRIjx ").\n",
@@ -294,6 +1166,8 @@ int main( int argc, char * const argv[] )
 	 source_offset,
 	 source_offset );
 
+	phase_start_time = assorted_output_statistics_start_phase();
+
 	read_count = libcfile_file_read_buffer(
 		      source_file,
 		      buffer,
@@ -308,16 +1182,30 @@ int main( int argc, char * const argv[] )
 
 		goto on_error;
 	}
+	assorted_output_statistics_stop_phase(
+	 ASSORTED_OUTPUT_STATISTICS_PHASE_READ,
+	 phase_start_time,
+	 (size64_t) read_count );
+
 	/* Decodes the data
 	 */
 	fprintf(
 	 stderr,
 	 "Encoded data:\n" );
 
-	libcnotify_print_data(
-	 buffer,
-	 source_size,
-	 0 );
+	if( assorted_output_data_fprint(
+	     stderr,
+	     buffer,
+	     source_size,
+	     0,
+	     &error ) != 1 )
+	{
+		fprintf(
+		 stderr,
+		 "Unable to print encoded data.\n" );
+
+		goto on_error;
+	}
 
 	if( mssearch_decode(
 	     decoded_data,
@@ -336,10 +1224,19 @@ int main( int argc, char * const argv[] )
 	 stderr,
 	 "Decoded data:\n" );
 
-	libcnotify_print_data(
-	 decoded_data,
-	 decoded_data_size,
-	 0 );
+	if( assorted_output_data_fprint(
+	     stderr,
+	     decoded_data,
+	     decoded_data_size,
+	     0,
+	     &error ) != 1 )
+	{
+		fprintf(
+		 stderr,
+		 "Unable to print decoded data.\n" );
+
+		goto on_error;
+	}
 
 	source_offset += source_size;
 	source_size   -= source_size;
@@ -373,10 +1270,8 @@ int main( int argc, char * const argv[] )
 
 			goto on_error;
 		}
-		uncompressed_data_size += 1;
-
 		uncompressed_data = (uint8_t *) memory_allocate(
-		                                 sizeof( uint8_t ) * uncompressed_data_size );
+		                                 sizeof( uint8_t ) * ( uncompressed_data_size + 1 ) );
 
 		if( uncompressed_data == NULL )
 		{
@@ -396,7 +1291,7 @@ int main( int argc, char * const argv[] )
 
 		result = mssearch_decompress_byte_indexed_compressed_data(
 		          &( uncompressed_data[ 1 ] ),
-		          uncompressed_data_size - 1,
+		          &uncompressed_data_size,
 		          &( decoded_data[ 1 ] ),
 		          decoded_data_size - 1,
 		          &error );
@@ -409,13 +1304,24 @@ int main( int argc, char * const argv[] )
 
 			goto on_error;
 		}
+		uncompressed_data_size += 1;
+
 		libcnotify_printf(
 		 "%s: decompressed data:\n",
 		 function );
-		libcnotify_print_data(
-		 uncompressed_data,
-		 uncompressed_data_size,
-		 0 );
+		if( assorted_output_data_fprint(
+		     stderr,
+		     uncompressed_data,
+		     uncompressed_data_size,
+		     0,
+		     &error ) != 1 )
+		{
+			fprintf(
+			 stderr,
+			 "Unable to print decompressed data.\n" );
+
+			goto on_error;
+		}
 
 		memory_free(
 		 decoded_data );
@@ -656,10 +1562,19 @@ int main( int argc, char * const argv[] )
 		libcnotify_printf(
 		 "%s: decompressed data:\n",
 		 function );
-		libcnotify_print_data(
-		 narrow_value_string,
-		 narrow_value_string_size,
-		 0 );
+		if( assorted_output_data_fprint(
+		     stderr,
+		     narrow_value_string,
+		     narrow_value_string_size,
+		     0,
+		     &error ) != 1 )
+		{
+			fprintf(
+			 stderr,
+			 "Unable to print decompressed data.\n" );
+
+			goto on_error;
+		}
 
 		memory_free(
 		 narrow_value_string );
@@ -673,10 +1588,19 @@ int main( int argc, char * const argv[] )
 		libcnotify_printf(
 		 "%s: decompressed data:\n",
 		 function );
-		libcnotify_print_data(
-		 &( decoded_data[ 1 ] ),
-		 decoded_data_size - 1,
-		 0 );
+		if( assorted_output_data_fprint(
+		     stderr,
+		     &( decoded_data[ 1 ] ),
+		     decoded_data_size - 1,
+		     0,
+		     &error ) != 1 )
+		{
+			fprintf(
+			 stderr,
+			 "Unable to print decompressed data.\n" );
+
+			goto on_error;
+		}
 	}
 	else
 	{
@@ -688,7 +1612,6 @@ int main( int argc, char * const argv[] )
 		goto on_error;
 	}
 #ifdef NOWRITE
-	libcfile_file_t *destination_file = NULL;
 	ssize_t write_count               = 0;
 
 	if( destination_file == NULL )
@@ -808,6 +1731,14 @@ int main( int argc, char * const argv[] )
 	 stdout,
 	 "MS Search decoding:\tSUCCESS\n" );
 
+	assorted_output_statistics_fprint(
+	 stderr,
+	 program,
+	 1,
+	 NULL );
+	assorted_output_statistics_free(
+	 NULL );
+
 	return( EXIT_SUCCESS );
 
 on_error:
@@ -818,14 +1749,19 @@ on_error:
 		libcerror_error_free(
 		 &error );
 	}
-#ifdef NOWRITE
+	assorted_output_statistics_fprint(
+	 stderr,
+	 program,
+	 -1,
+	 NULL );
+	assorted_output_statistics_free(
+	 NULL );
 	if( destination_file != NULL )
 	{
 		libcfile_file_free(
 		 &destination_file,
 		 NULL );
 	}
-#endif
 	if( uncompressed_data != NULL )
 	{
 		memory_free(
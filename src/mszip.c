@@ -0,0 +1,365 @@
+/*
+ * MSZIP decompression functions
+ *
+ * Copyright (C) 2008-2019, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This software is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This software is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this software.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <memory.h>
+#include <types.h>
+
+#include "assorted_libcerror.h"
+#include "deflate_stream.h"
+#include "mszip.h"
+
+/* Creates a decoder
+ * Make sure the value decoder is referencing, is set to NULL
+ * Returns 1 if successful or -1 on error
+ */
+int mszip_decoder_initialize(
+     mszip_decoder_t **decoder,
+     libcerror_error_t **error )
+{
+	static char *function = "mszip_decoder_initialize";
+
+	if( decoder == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid decoder.",
+		 function );
+
+		return( -1 );
+	}
+	if( *decoder != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid decoder value already set.",
+		 function );
+
+		return( -1 );
+	}
+	*decoder = memory_allocate_structure(
+	            mszip_decoder_t );
+
+	if( *decoder == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create decoder.",
+		 function );
+
+		goto on_error;
+	}
+	( *decoder )->stream           = NULL;
+	( *decoder )->number_of_blocks = 0;
+
+	if( deflate_stream_initialize(
+	     &( ( *decoder )->stream ),
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create stream.",
+		 function );
+
+		goto on_error;
+	}
+	return( 1 );
+
+on_error:
+	if( *decoder != NULL )
+	{
+		memory_free(
+		 *decoder );
+
+		*decoder = NULL;
+	}
+	return( -1 );
+}
+
+/* Frees a decoder
+ * Returns 1 if successful or -1 on error
+ */
+int mszip_decoder_free(
+     mszip_decoder_t **decoder,
+     libcerror_error_t **error )
+{
+	static char *function = "mszip_decoder_free";
+	int result            = 1;
+
+	if( decoder == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid decoder.",
+		 function );
+
+		return( -1 );
+	}
+	if( *decoder != NULL )
+	{
+		if( deflate_stream_free(
+		     &( ( *decoder )->stream ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free stream.",
+			 function );
+
+			result = -1;
+		}
+		memory_free(
+		 *decoder );
+
+		*decoder = NULL;
+	}
+	return( result );
+}
+
+/* Resets a decoder at the start of a folder
+ * The uncompressed data of the blocks of the previous folder is no longer used as history
+ * Returns 1 if successful or -1 on error
+ */
+int mszip_decoder_reset(
+     mszip_decoder_t *decoder,
+     libcerror_error_t **error )
+{
+	static char *function = "mszip_decoder_reset";
+
+	if( decoder == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid decoder.",
+		 function );
+
+		return( -1 );
+	}
+	decoder->number_of_blocks = 0;
+
+	return( 1 );
+}
+
+/* Decompresses a MSZIP compressed block
+ * A block consists of the "CK" signature followed by a raw deflate stream, which can
+ * refer to the uncompressed data of the previous blocks of the folder within the 32 KiB
+ * sliding window, hence the blocks of a folder must be decompressed in order
+ * The sliding window is kept in the deflate stream, so that only the uncompressed data
+ * of the block is written and the uncompressed data of the folder is not required
+ * Returns 1 on success or -1 on error
+ */
+int mszip_decoder_decompress_block(
+     mszip_decoder_t *decoder,
+     const uint8_t *compressed_data,
+     size_t compressed_data_size,
+     uint8_t *uncompressed_data,
+     size_t *uncompressed_data_size,
+     libcerror_error_t **error )
+{
+	static char *function           = "mszip_decoder_decompress_block";
+	size_t compressed_data_offset   = 0;
+	size_t stream_compressed_size   = 0;
+	size_t stream_uncompressed_size = 0;
+	size_t uncompressed_data_offset = 0;
+	int result                      = 0;
+
+	if( decoder == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid decoder.",
+		 function );
+
+		return( -1 );
+	}
+	if( compressed_data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid compressed data.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( compressed_data_size < MSZIP_SIGNATURE_SIZE )
+	 || ( compressed_data_size > (size_t) SSIZE_MAX ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid compressed data size value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( uncompressed_data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid uncompressed data.",
+		 function );
+
+		return( -1 );
+	}
+	if( uncompressed_data_size == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid uncompressed data size.",
+		 function );
+
+		return( -1 );
+	}
+	if( *uncompressed_data_size > (size_t) SSIZE_MAX )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid uncompressed data size value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( compressed_data[ 0 ] != 'C' )
+	 || ( compressed_data[ 1 ] != 'K' ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_UNSUPPORTED_VALUE,
+		 "%s: unsupported block signature.",
+		 function );
+
+		return( -1 );
+	}
+	/* The first block of a folder starts with an empty sliding window
+	 */
+	if( decoder->number_of_blocks == 0 )
+	{
+		result = deflate_stream_reset(
+		          decoder->stream,
+		          error );
+	}
+	else
+	{
+		result = deflate_stream_restart(
+		          decoder->stream,
+		          error );
+	}
+	if( result != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to start stream.",
+		 function );
+
+		return( -1 );
+	}
+	compressed_data_offset = MSZIP_SIGNATURE_SIZE;
+
+	do
+	{
+		stream_compressed_size   = compressed_data_size - compressed_data_offset;
+		stream_uncompressed_size = *uncompressed_data_size - uncompressed_data_offset;
+
+		result = deflate_stream_decompress(
+		          decoder->stream,
+		          &( compressed_data[ compressed_data_offset ] ),
+		          &stream_compressed_size,
+		          &( uncompressed_data[ uncompressed_data_offset ] ),
+		          &stream_uncompressed_size,
+		          DEFLATE_STREAM_FLAG_END_OF_INPUT | DEFLATE_STREAM_FLAG_RAW,
+		          error );
+
+		if( result == -1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_COMPRESSION,
+			 LIBCERROR_COMPRESSION_ERROR_DECOMPRESS_FAILED,
+			 "%s: unable to decompress data.",
+			 function );
+
+			return( -1 );
+		}
+		compressed_data_offset   += stream_compressed_size;
+		uncompressed_data_offset += stream_uncompressed_size;
+
+		if( ( result == 0 )
+		 && ( stream_compressed_size == 0 )
+		 && ( stream_uncompressed_size == 0 ) )
+		{
+			if( uncompressed_data_offset == *uncompressed_data_size )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+				 LIBCERROR_ARGUMENT_ERROR_VALUE_TOO_SMALL,
+				 "%s: invalid uncompressed data size value too small.",
+				 function );
+			}
+			else
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_COMPRESSION,
+				 LIBCERROR_COMPRESSION_ERROR_DECOMPRESS_FAILED,
+				 "%s: truncated compressed data.",
+				 function );
+			}
+			return( -1 );
+		}
+	}
+	while( result != 1 );
+
+	decoder->number_of_blocks += 1;
+
+	*uncompressed_data_size = uncompressed_data_offset;
+
+	return( 1 );
+}
+
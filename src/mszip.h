@@ -0,0 +1,82 @@
+/*
+ * MSZIP decompression functions
+ *
+ * Copyright (C) 2008-2019, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This software is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This software is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this software.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+
+#if !defined( _MSZIP_H )
+#define _MSZIP_H
+
+#include <common.h>
+#include <types.h>
+
+#include "assorted_libcerror.h"
+#include "deflate_stream.h"
+
+#if defined( __cplusplus )
+extern "C" {
+#endif
+
+/* The size of the signature that precedes the deflate compressed data of a block
+ */
+#define MSZIP_SIGNATURE_SIZE		2
+
+/* The maximum size of the uncompressed data of a block
+ */
+#define MSZIP_MAXIMUM_BLOCK_SIZE	32768
+
+typedef struct mszip_decoder mszip_decoder_t;
+
+struct mszip_decoder
+{
+	/* The deflate stream, its window contains the uncompressed data of the previous blocks
+	 */
+	deflate_stream_t *stream;
+
+	/* The number of blocks decompressed since the decoder was reset
+	 */
+	uint32_t number_of_blocks;
+};
+
+int mszip_decoder_initialize(
+     mszip_decoder_t **decoder,
+     libcerror_error_t **error );
+
+int mszip_decoder_free(
+     mszip_decoder_t **decoder,
+     libcerror_error_t **error );
+
+int mszip_decoder_reset(
+     mszip_decoder_t *decoder,
+     libcerror_error_t **error );
+
+int mszip_decoder_decompress_block(
+     mszip_decoder_t *decoder,
+     const uint8_t *compressed_data,
+     size_t compressed_data_size,
+     uint8_t *uncompressed_data,
+     size_t *uncompressed_data_size,
+     libcerror_error_t **error );
+
+#if defined( __cplusplus )
+}
+#endif
+
+#endif /* !defined( _MSZIP_H ) */
+
@@ -0,0 +1,861 @@
+/*
+ * Decompresses the MSZIP compressed folders of a cabinet (CAB) file
+ *
+ * Copyright (C) 2008-2019, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This software is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This software is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this software.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <file_stream.h>
+#include <memory.h>
+#include <narrow_string.h>
+#include <system_string.h>
+#include <types.h>
+
+#if defined( HAVE_STDLIB_H )
+#include <stdlib.h>
+#endif
+
+#include "assorted_getopt.h"
+#include "assorted_input_file.h"
+#include "assorted_libcerror.h"
+#include "assorted_libcfile.h"
+#include "assorted_libcnotify.h"
+#include "assorted_output.h"
+#include "assorted_output_file.h"
+#include "cab_archive.h"
+#include "mszip.h"
+
+/* Prints the executable usage information
+ */
+void usage_fprint(
+      FILE *stream )
+{
+	if( stream == NULL )
+	{
+		return;
+	}
+	fprintf( stream, "Use mszipdecompress to decompress the MSZIP compressed folders of\n"
+	                 "a cabinet (CAB) file.\n\n" );
+
+	fprintf( stream, "Usage: mszipdecompress [ -S format ] [ -hvV ] source\n\n" );
+
+	fprintf( stream, "\tsource: the source file\n\n" );
+
+	fprintf( stream, "\t-h:     shows this help\n" );
+	fprintf( stream, "\t-S:     print timing and throughput statistics of the open,\n"
+	                 "\t        read, compute and write phases and the peak memory\n"
+	                 "\t        size to stderr in the format: text or json\n" );
+	fprintf( stream, "\t-v:     verbose output to stderr\n" );
+	fprintf( stream, "\t-V:     print version\n" );
+	fprintf( stream, "\n" );
+}
+
+/* Decompresses the data blocks of a folder
+ * The uncompressed data of every data block is written to the destination file
+ * before the next data block is read, hence at most a single data block is buffered
+ * Returns 1 if successful or -1 on error
+ */
+int mszipdecompress_decompress_folder(
+     assorted_input_file_t *source_file,
+     size64_t source_size,
+     const cab_archive_header_t *header,
+     const cab_archive_folder_t *folder,
+     mszip_decoder_t *decoder,
+     uint8_t *uncompressed_data,
+     assorted_output_file_t *destination_file,
+     libcerror_error_t **error )
+{
+	cab_archive_data_block_t data_block;
+
+	uint8_t *data                 = NULL;
+	static char *function         = "mszipdecompress_decompress_folder";
+	size_t data_block_header_size = 0;
+	size_t uncompressed_data_size = 0;
+	ssize_t read_count            = 0;
+	ssize_t write_count           = 0;
+	off64_t data_block_offset     = 0;
+	uint16_t data_block_index     = 0;
+	uint16_t compression_type     = 0;
+	int result                    = 0;
+
+	if( header == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid header.",
+		 function );
+
+		return( -1 );
+	}
+	if( folder == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid folder.",
+		 function );
+
+		return( -1 );
+	}
+	if( uncompressed_data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid uncompressed data.",
+		 function );
+
+		return( -1 );
+	}
+	compression_type = folder->compression_type & 0x000f;
+
+	if( ( compression_type != CAB_ARCHIVE_COMPRESSION_TYPE_NONE )
+	 && ( compression_type != CAB_ARCHIVE_COMPRESSION_TYPE_MSZIP ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_UNSUPPORTED_VALUE,
+		 "%s: unsupported compression type: %" PRIu16 ".",
+		 function,
+		 compression_type );
+
+		return( -1 );
+	}
+	if( mszip_decoder_reset(
+	     decoder,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to reset decoder.",
+		 function );
+
+		return( -1 );
+	}
+	data_block_header_size = CAB_ARCHIVE_DATA_BLOCK_HEADER_SIZE + (size_t) header->data_block_reserved_size;
+	data_block_offset      = (off64_t) folder->data_offset;
+
+	for( data_block_index = 0;
+	     data_block_index < folder->number_of_data_blocks;
+	     data_block_index++ )
+	{
+		if( ( (size64_t) data_block_offset + data_block_header_size ) > source_size )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+			 "%s: invalid data block: %" PRIu16 " offset value out of bounds.",
+			 function,
+			 data_block_index );
+
+			return( -1 );
+		}
+		if( assorted_input_file_seek_offset(
+		     source_file,
+		     data_block_offset,
+		     SEEK_SET,
+		     error ) == -1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_SEEK_FAILED,
+			 "%s: unable to seek data block: %" PRIu16 ".",
+			 function,
+			 data_block_index );
+
+			return( -1 );
+		}
+		read_count = assorted_input_file_read_data(
+		              source_file,
+		              &data,
+		              data_block_header_size,
+		              error );
+
+		if( read_count != (ssize_t) data_block_header_size )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_READ_FAILED,
+			 "%s: unable to read data block: %" PRIu16 " header.",
+			 function,
+			 data_block_index );
+
+			return( -1 );
+		}
+		if( cab_archive_data_block_read_header(
+		     &data_block,
+		     data,
+		     (size_t) read_count,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to read data block: %" PRIu16 " header.",
+			 function,
+			 data_block_index );
+
+			return( -1 );
+		}
+		/* A data block with an uncompressed size of 0 continues in the next cabinet
+		 */
+		if( data_block.uncompressed_size == 0 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_UNSUPPORTED_VALUE,
+			 "%s: unsupported data block: %" PRIu16 " that continues in the next cabinet.",
+			 function,
+			 data_block_index );
+
+			return( -1 );
+		}
+		data_block_offset += (off64_t) data_block_header_size;
+
+		if( ( (size64_t) data_block_offset + data_block.compressed_size ) > source_size )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+			 "%s: invalid data block: %" PRIu16 " compressed size value out of bounds.",
+			 function,
+			 data_block_index );
+
+			return( -1 );
+		}
+		read_count = assorted_input_file_read_data(
+		              source_file,
+		              &data,
+		              (size_t) data_block.compressed_size,
+		              error );
+
+		if( read_count != (ssize_t) data_block.compressed_size )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_READ_FAILED,
+			 "%s: unable to read data block: %" PRIu16 " compressed data.",
+			 function,
+			 data_block_index );
+
+			return( -1 );
+		}
+		data_block_offset += (off64_t) data_block.compressed_size;
+
+		result = cab_archive_data_block_verify_checksum(
+		          &data_block,
+		          data,
+		          (size_t) read_count,
+		          error );
+
+		if( result == -1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GENERIC,
+			 "%s: unable to verify data block: %" PRIu16 " checksum.",
+			 function,
+			 data_block_index );
+
+			return( -1 );
+		}
+		else if( result == 0 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_INPUT,
+			 LIBCERROR_INPUT_ERROR_CHECKSUM_MISMATCH,
+			 "%s: mismatch in data block: %" PRIu16 " checksum.",
+			 function,
+			 data_block_index );
+
+			return( -1 );
+		}
+		if( compression_type == CAB_ARCHIVE_COMPRESSION_TYPE_NONE )
+		{
+			if( data_block.compressed_size != data_block.uncompressed_size )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+				 "%s: invalid data block: %" PRIu16 " uncompressed size value out of bounds.",
+				 function,
+				 data_block_index );
+
+				return( -1 );
+			}
+			write_count = assorted_output_file_write_data(
+			               destination_file,
+			               data,
+			               (size_t) read_count,
+			               error );
+
+			if( write_count != read_count )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_IO,
+				 LIBCERROR_IO_ERROR_WRITE_FAILED,
+				 "%s: unable to write data block: %" PRIu16 ".",
+				 function,
+				 data_block_index );
+
+				return( -1 );
+			}
+			continue;
+		}
+		uncompressed_data_size = MSZIP_MAXIMUM_BLOCK_SIZE;
+
+		if( mszip_decoder_decompress_block(
+		     decoder,
+		     data,
+		     (size_t) read_count,
+		     uncompressed_data,
+		     &uncompressed_data_size,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_COMPRESSION,
+			 LIBCERROR_COMPRESSION_ERROR_DECOMPRESS_FAILED,
+			 "%s: unable to decompress data block: %" PRIu16 ".",
+			 function,
+			 data_block_index );
+
+			return( -1 );
+		}
+		if( uncompressed_data_size != (size_t) data_block.uncompressed_size )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+			 "%s: mismatch in data block: %" PRIu16 " uncompressed size.",
+			 function,
+			 data_block_index );
+
+			return( -1 );
+		}
+		write_count = assorted_output_file_write_data(
+		               destination_file,
+		               uncompressed_data,
+		               uncompressed_data_size,
+		               error );
+
+		if( write_count != (ssize_t) uncompressed_data_size )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_WRITE_FAILED,
+			 "%s: unable to write data block: %" PRIu16 ".",
+			 function,
+			 data_block_index );
+
+			return( -1 );
+		}
+	}
+	return( 1 );
+}
+
+/* The main program
+ */
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+int wmain( int argc, wchar_t * const argv[] )
+#else
+int main( int argc, char * const argv[] )
+#endif
+{
+	system_character_t destination[ 128 ];
+
+	cab_archive_header_t header;
+
+	libcerror_error_t *error                     = NULL;
+	assorted_input_file_t *source_file           = NULL;
+	assorted_output_file_t *destination_file     = NULL;
+	cab_archive_folder_t *folders                = NULL;
+	mszip_decoder_t *decoder                     = NULL;
+	system_character_t *option_statistics_format = NULL;
+	system_character_t *source                   = NULL;
+	uint8_t *buffer                              = NULL;
+	uint8_t *uncompressed_data                   = NULL;
+	char *program                                = "mszipdecompress";
+	system_integer_t option                      = 0;
+	size64_t source_size                         = 0;
+	size_t folder_entry_size                     = 0;
+	size_t read_size                             = 0;
+	ssize_t read_count                           = 0;
+	uint16_t folder_index                        = 0;
+	int print_count                              = 0;
+	int verbose                                  = 0;
+
+	assorted_output_version_fprint(
+	 stdout,
+	 program );
+
+	while( ( option = assorted_getopt(
+	                   argc,
+	                   argv,
+	                   _SYSTEM_STRING( "hS:vV" ) ) ) != (system_integer_t) -1 )
+	{
+		switch( option )
+		{
+			case '?':
+			default:
+				fprintf(
+				 stderr,
+				 "Invalid argument: %" PRIs_SYSTEM "\n",
+				 argv[ optind ] );
+
+				usage_fprint(
+				 stdout );
+
+				return( EXIT_FAILURE );
+
+			case 'h':
+				usage_fprint(
+				 stdout );
+
+				return( EXIT_SUCCESS );
+
+			case 'S':
+				option_statistics_format = optarg;
+
+				break;
+
+			case 'v':
+				verbose = 1;
+
+				break;
+
+			case 'V':
+				assorted_output_copyright_fprint(
+				 stdout );
+
+				return( EXIT_SUCCESS );
+		}
+	}
+	if( optind == argc )
+	{
+		fprintf(
+		 stderr,
+		 "Missing source file.\n" );
+
+		usage_fprint(
+		 stdout );
+
+		return( EXIT_FAILURE );
+	}
+	source = argv[ optind ];
+
+	libcnotify_stream_set(
+	 stderr,
+	 NULL );
+	libcnotify_verbose_set(
+	 verbose );
+
+	if( assorted_output_statistics_initialize(
+	     option_statistics_format,
+	     &error ) != 1 )
+	{
+		fprintf(
+		 stderr,
+		 "Unable to initialize statistics.\n" );
+
+		goto on_error;
+	}
+
+	/* Open the source file
+	 */
+	if( assorted_input_file_initialize(
+	     &source_file,
+	     &error ) != 1 )
+	{
+		fprintf(
+		 stderr,
+		 "Unable to create source file.\n" );
+
+		goto on_error;
+	}
+	if( assorted_input_file_open(
+	     source_file,
+	     source,
+	     &error ) != 1 )
+	{
+		fprintf(
+		 stderr,
+		 "Unable to open source file.\n" );
+
+		goto on_error;
+	}
+	if( assorted_input_file_get_size(
+	     source_file,
+	     &source_size,
+	     &error ) == -1 )
+	{
+		fprintf(
+		 stderr,
+		 "Unable to determine size of source file.\n" );
+
+		goto on_error;
+	}
+	if( source_size < (size64_t) CAB_ARCHIVE_HEADER_SIZE )
+	{
+		fprintf(
+		 stderr,
+		 "Invalid source size value too small.\n" );
+
+		goto on_error;
+	}
+	/* Read the header, which is followed by the folder entries
+	 */
+	read_size = CAB_ARCHIVE_MAXIMUM_HEADER_SIZE;
+
+	if( (size64_t) read_size > source_size )
+	{
+		read_size = (size_t) source_size;
+	}
+	read_count = assorted_input_file_read_data(
+	              source_file,
+	              &buffer,
+	              read_size,
+	              &error );
+
+	if( read_count != (ssize_t) read_size )
+	{
+		fprintf(
+		 stderr,
+		 "Unable to read header from source file.\n" );
+
+		goto on_error;
+	}
+	if( cab_archive_read_header(
+	     &header,
+	     buffer,
+	     read_size,
+	     &error ) != 1 )
+	{
+		fprintf(
+		 stderr,
+		 "Unable to read header.\n" );
+
+		goto on_error;
+	}
+	if( ( header.flags & ( CAB_ARCHIVE_FLAG_PREVIOUS_CABINET | CAB_ARCHIVE_FLAG_NEXT_CABINET ) ) != 0 )
+	{
+		fprintf(
+		 stderr,
+		 "Unsupported cabinet that is part of a set.\n" );
+
+		goto on_error;
+	}
+	if( header.number_of_folders > 0 )
+	{
+		folder_entry_size = CAB_ARCHIVE_FOLDER_SIZE + (size_t) header.folder_reserved_size;
+		read_size         = folder_entry_size * header.number_of_folders;
+
+		if( ( (size64_t) header.header_size + read_size ) > source_size )
+		{
+			fprintf(
+			 stderr,
+			 "Invalid number of folders value out of bounds.\n" );
+
+			goto on_error;
+		}
+		folders = (cab_archive_folder_t *) memory_allocate(
+		                                    sizeof( cab_archive_folder_t ) * header.number_of_folders );
+
+		if( folders == NULL )
+		{
+			fprintf(
+			 stderr,
+			 "Unable to create folders.\n" );
+
+			goto on_error;
+		}
+		if( assorted_input_file_seek_offset(
+		     source_file,
+		     (off64_t) header.header_size,
+		     SEEK_SET,
+		     &error ) == -1 )
+		{
+			fprintf(
+			 stderr,
+			 "Unable to seek folders in source file.\n" );
+
+			goto on_error;
+		}
+		read_count = assorted_input_file_read_data(
+		              source_file,
+		              &buffer,
+		              read_size,
+		              &error );
+
+		if( read_count != (ssize_t) read_size )
+		{
+			fprintf(
+			 stderr,
+			 "Unable to read folders from source file.\n" );
+
+			goto on_error;
+		}
+		for( folder_index = 0;
+		     folder_index < header.number_of_folders;
+		     folder_index++ )
+		{
+			if( cab_archive_folder_read(
+			     &( folders[ folder_index ] ),
+			     &( buffer[ folder_index * folder_entry_size ] ),
+			     folder_entry_size,
+			     &error ) != 1 )
+			{
+				fprintf(
+				 stderr,
+				 "Unable to read folder: %" PRIu16 ".\n",
+				 folder_index );
+
+				goto on_error;
+			}
+		}
+	}
+	print_count = system_string_sprintf(
+	               destination,
+	               128,
+	               _SYSTEM_STRING( "%" PRIs_SYSTEM ".mszipdecompressed" ),
+	               source );
+
+	if( ( print_count < 0 )
+	 || ( print_count > 128 ) )
+	{
+		fprintf(
+		 stderr,
+		 "Unable to set destination filename.\n" );
+
+		goto on_error;
+	}
+	/* Open the destination file, the uncompressed size of the folders is not
+	 * stored in the cabinet hence the data is written buffered
+	 */
+	if( assorted_output_file_initialize(
+	     &destination_file,
+	     &error ) != 1 )
+	{
+		fprintf(
+		 stderr,
+		 "Unable to create destination file.\n" );
+
+		goto on_error;
+	}
+	if( assorted_output_file_open(
+	     destination_file,
+	     destination,
+	     0,
+	     &error ) != 1 )
+	{
+		fprintf(
+		 stderr,
+		 "Unable to open destination file.\n" );
+
+		goto on_error;
+	}
+	/* Decompress the folders, the uncompressed data of the folders is
+	 * written consecutively to the destination file
+	 */
+	if( mszip_decoder_initialize(
+	     &decoder,
+	     &error ) != 1 )
+	{
+		fprintf(
+		 stderr,
+		 "Unable to create decoder.\n" );
+
+		goto on_error;
+	}
+	uncompressed_data = (uint8_t *) memory_allocate(
+	                                 sizeof( uint8_t ) * MSZIP_MAXIMUM_BLOCK_SIZE );
+
+	if( uncompressed_data == NULL )
+	{
+		fprintf(
+		 stderr,
+		 "Unable to create uncompressed data.\n" );
+
+		goto on_error;
+	}
+	for( folder_index = 0;
+	     folder_index < header.number_of_folders;
+	     folder_index++ )
+	{
+		if( mszipdecompress_decompress_folder(
+		     source_file,
+		     source_size,
+		     &header,
+		     &( folders[ folder_index ] ),
+		     decoder,
+		     uncompressed_data,
+		     destination_file,
+		     &error ) != 1 )
+		{
+			fprintf(
+			 stderr,
+			 "Unable to decompress folder: %" PRIu16 ".\n",
+			 folder_index );
+
+			goto on_error;
+		}
+	}
+	/* Clean up
+	 */
+	memory_free(
+	 uncompressed_data );
+
+	uncompressed_data = NULL;
+
+	if( mszip_decoder_free(
+	     &decoder,
+	     &error ) != 1 )
+	{
+		fprintf(
+		 stderr,
+		 "Unable to free decoder.\n" );
+
+		goto on_error;
+	}
+	if( assorted_output_file_close(
+	     destination_file,
+	     &error ) != 0 )
+	{
+		fprintf(
+		 stderr,
+		 "Unable to close destination file.\n" );
+
+		goto on_error;
+	}
+	if( assorted_output_file_free(
+	     &destination_file,
+	     &error ) != 1 )
+	{
+		fprintf(
+		 stderr,
+		 "Unable to free destination file.\n" );
+
+		goto on_error;
+	}
+	if( folders != NULL )
+	{
+		memory_free(
+		 folders );
+
+		folders = NULL;
+	}
+	if( assorted_input_file_close(
+	     source_file,
+	     &error ) != 0 )
+	{
+		fprintf(
+		 stderr,
+		 "Unable to close source file.\n" );
+
+		goto on_error;
+	}
+	if( assorted_input_file_free(
+	     &source_file,
+	     &error ) != 1 )
+	{
+		fprintf(
+		 stderr,
+		 "Unable to free source file.\n" );
+
+		goto on_error;
+	}
+	fprintf(
+	 stdout,
+	 "MSZIP decompression:\tSUCCESS\n" );
+
+	assorted_output_statistics_fprint(
+	 stderr,
+	 program,
+	 1,
+	 NULL );
+	assorted_output_statistics_free(
+	 NULL );
+
+	return( EXIT_SUCCESS );
+
+on_error:
+	if( error != NULL )
+	{
+		libcnotify_print_error_backtrace(
+		 error );
+		libcerror_error_free(
+		 &error );
+	}
+	assorted_output_statistics_fprint(
+	 stderr,
+	 program,
+	 -1,
+	 NULL );
+	assorted_output_statistics_free(
+	 NULL );
+	if( uncompressed_data != NULL )
+	{
+		memory_free(
+		 uncompressed_data );
+	}
+	if( decoder != NULL )
+	{
+		mszip_decoder_free(
+		 &decoder,
+		 NULL );
+	}
+	if( destination_file != NULL )
+	{
+		assorted_output_file_free(
+		 &destination_file,
+		 NULL );
+	}
+	if( folders != NULL )
+	{
+		memory_free(
+		 folders );
+	}
+	if( source_file != NULL )
+	{
+		assorted_input_file_free(
+		 &source_file,
+		 NULL );
+	}
+	return( EXIT_FAILURE );
+}
+
@@ -0,0 +1,989 @@
+/*
+ * Calculates multiple checksums of file data in a single pass
+ *
+ * Copyright (C) 2008-2019, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This software is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This software is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this software.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <file_stream.h>
+#include <memory.h>
+#include <system_string.h>
+#include <types.h>
+
+#if defined( HAVE_STDLIB_H )
+#include <stdlib.h>
+#endif
+
+#include "adler32.h"
+#include "assorted_getopt.h"
+#include "assorted_input_file.h"
+#include "assorted_libcerror.h"
+#include "assorted_libcfile.h"
+#include "assorted_libcnotify.h"
+#include "assorted_libcthreads.h"
+#include "assorted_output.h"
+#include "crc32.h"
+#include "crc64.h"
+#include "fletcher32.h"
+#include "fletcher64.h"
+#include "xor32.h"
+#include "xor64.h"
+
+/* The size of the buffer used to read the source data
+ */
+#define MULTISUM_BUFFER_SIZE		( 4 * 1024 * 1024 )
+
+/* The size of the part of the buffer that is passed to every digest
+ * before the next part, so that the part remains in the CPU cache
+ * The size must be a multiple of 8 to keep the XOR and Fletcher-64
+ * values aligned with the start of the data
+ */
+#define MULTISUM_CHUNK_SIZE		( 64 * 1024 )
+
+enum MULTISUM_DIGEST_TYPES
+{
+	MULTISUM_DIGEST_TYPE_ADLER32	= 1,
+	MULTISUM_DIGEST_TYPE_CRC32,
+	MULTISUM_DIGEST_TYPE_CRC64,
+	MULTISUM_DIGEST_TYPE_FLETCHER32,
+	MULTISUM_DIGEST_TYPE_FLETCHER64,
+	MULTISUM_DIGEST_TYPE_XOR32,
+	MULTISUM_DIGEST_TYPE_XOR64
+};
+
+typedef struct multisum_digest_definition multisum_digest_definition_t;
+
+struct multisum_digest_definition
+{
+	/* The digest type
+	 */
+	int digest_type;
+
+	/* The digest name, as used on the command line
+	 */
+	const system_character_t *name;
+
+	/* The digest description, as used in the output
+	 */
+	const char *description;
+
+	/* The size of the digest value in bits
+	 */
+	uint8_t number_of_bits;
+};
+
+/* The supported digests, terminated by an empty entry
+ */
+multisum_digest_definition_t multisum_digest_definitions[] = {
+	{ MULTISUM_DIGEST_TYPE_ADLER32, _SYSTEM_STRING( "adler32" ), "Adler-32", 32 },
+	{ MULTISUM_DIGEST_TYPE_CRC32, _SYSTEM_STRING( "crc32" ), "CRC-32", 32 },
+	{ MULTISUM_DIGEST_TYPE_CRC64, _SYSTEM_STRING( "crc64" ), "CRC-64", 64 },
+	{ MULTISUM_DIGEST_TYPE_FLETCHER32, _SYSTEM_STRING( "fletcher32" ), "Fletcher-32", 32 },
+	{ MULTISUM_DIGEST_TYPE_FLETCHER64, _SYSTEM_STRING( "fletcher64" ), "Fletcher-64", 64 },
+	{ MULTISUM_DIGEST_TYPE_XOR32, _SYSTEM_STRING( "xor32" ), "XOR-32", 32 },
+	{ MULTISUM_DIGEST_TYPE_XOR64, _SYSTEM_STRING( "xor64" ), "XOR-64", 64 },
+	{ 0, NULL, NULL, 0 } };
+
+/* The number of supported digests
+ */
+#define MULTISUM_NUMBER_OF_DIGESTS	7
+
+typedef struct multisum_digest multisum_digest_t;
+
+struct multisum_digest
+{
+	/* The digest definition
+	 */
+	const multisum_digest_definition_t *definition;
+
+	/* The calculated value, which is also used as the initial value
+	 * of the calculation of the next data
+	 */
+	uint64_t value;
+
+	/* The data to calculate the digest of, used by a thread
+	 */
+	uint8_t *buffer;
+
+	/* The size of the data, used by a thread
+	 */
+	size_t size;
+
+	/* The result of the calculation, used by a thread
+	 */
+	int result;
+};
+
+/* Prints the executable usage information
+ */
+void usage_fprint(
+      FILE *stream )
+{
+	if( stream == NULL )
+	{
+		return;
+	}
+	fprintf( stream, "Use multisum to calculate multiple checksums of file data\n"
+	                 "in a single pass.\n\n" );
+
+	fprintf( stream, "Usage: multisum [ -d digest ] [ -o offset ] [ -s size ]\n"
+	                 "                [ -S format ] [ -u block_size ] [ -htvV ] source\n\n" );
+
+	fprintf( stream, "\tsource: the source file\n\n" );
+
+	fprintf( stream, "\t-d:     digest to calculate, can be specified multiple times,\n"
+	                 "\t        options: adler32, crc32, crc64, fletcher32, fletcher64,\n"
+	                 "\t        xor32, xor64 (default is all)\n" );
+	fprintf( stream, "\t-h:     shows this help\n" );
+	fprintf( stream, "\t-o:     data offset (default is 0)\n" );
+	fprintf( stream, "\t-s:     size of data (default is the file size)\n" );
+	fprintf( stream, "\t-S:     print timing and throughput statistics of the open,\n"
+	                 "\t        read, compute and write phases and the peak memory\n"
+	                 "\t        size to stderr in the format: text or json\n" );
+	fprintf( stream, "\t-t:     calculate every digest on its own thread\n" );
+	fprintf( stream, "\t-u:     read the source unbuffered using direct I/O in blocks of\n"
+	                 "\t        block_size bytes, which must be a multiple of %d, to\n"
+	                 "\t        bypass the system cache, e.g. when reading a device\n",
+	 ASSORTED_INPUT_FILE_DIRECT_IO_ALIGNMENT );
+	fprintf( stream, "\t-v:     verbose output to stderr\n" );
+	fprintf( stream, "\t-V:     print version\n" );
+	fprintf( stream, "\n" );
+	fprintf( stream, "The digests are calculated with the fastest calculation method\n"
+	                 "and the same defaults as the corresponding sum tools.\n" );
+	fprintf( stream, "\n" );
+}
+
+/* Calculates a digest of a buffer
+ * The value of the digest is used as the initial value and updated
+ * Returns 1 if successful or -1 on error
+ */
+int multisum_digest_calculate(
+     multisum_digest_t *digest,
+     uint8_t *buffer,
+     size_t size,
+     libcerror_error_t **error )
+{
+	static char *function = "multisum_digest_calculate";
+	uint32_t value_32bit  = 0;
+	int result            = -1;
+
+	if( digest == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid digest.",
+		 function );
+
+		return( -1 );
+	}
+	if( digest->definition == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid digest - missing definition.",
+		 function );
+
+		return( -1 );
+	}
+	value_32bit = (uint32_t) digest->value;
+
+	switch( digest->definition->digest_type )
+	{
+		case MULTISUM_DIGEST_TYPE_ADLER32:
+			result = checksum_calculate_adler32_simd(
+			          &value_32bit,
+			          buffer,
+			          size,
+			          value_32bit,
+			          error );
+			break;
+
+		case MULTISUM_DIGEST_TYPE_CRC32:
+			result = crc32_calculate_hardware(
+			          &value_32bit,
+			          buffer,
+			          size,
+			          value_32bit,
+			          0,
+			          error );
+			break;
+
+		case MULTISUM_DIGEST_TYPE_CRC64:
+			result = crc64_calculate_hardware(
+			          &( digest->value ),
+			          buffer,
+			          size,
+			          digest->value,
+			          error );
+			break;
+
+		case MULTISUM_DIGEST_TYPE_FLETCHER32:
+			result = fletcher32_calculate_simd(
+			          value_32bit,
+			          buffer,
+			          size,
+			          &value_32bit,
+			          error );
+			break;
+
+		case MULTISUM_DIGEST_TYPE_FLETCHER64:
+			result = fletcher64_calculate_simd(
+			          digest->value,
+			          buffer,
+			          size,
+			          &( digest->value ),
+			          error );
+			break;
+
+		case MULTISUM_DIGEST_TYPE_XOR32:
+			result = checksum_calculate_little_endian_xor32_simd(
+			          &value_32bit,
+			          buffer,
+			          size,
+			          value_32bit,
+			          error );
+			break;
+
+		case MULTISUM_DIGEST_TYPE_XOR64:
+			result = checksum_calculate_little_endian_xor64_simd(
+			          &( digest->value ),
+			          buffer,
+			          size,
+			          digest->value,
+			          error );
+			break;
+
+		default:
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+			 LIBCERROR_ARGUMENT_ERROR_UNSUPPORTED_VALUE,
+			 "%s: unsupported digest type: %d.",
+			 function,
+			 digest->definition->digest_type );
+
+			return( -1 );
+	}
+	if( digest->definition->number_of_bits == 32 )
+	{
+		digest->value = (uint64_t) value_32bit;
+	}
+	return( result );
+}
+
+/* Calculates the digests of a buffer
+ * The buffer is split into chunks and every digest is calculated
+ * of a chunk before the next chunk
+ * Returns 1 if successful or -1 on error
+ */
+int multisum_calculate(
+     multisum_digest_t *digests,
+     int number_of_digests,
+     uint8_t *buffer,
+     size_t size,
+     libcerror_error_t **error )
+{
+	static char *function = "multisum_calculate";
+	size_t buffer_offset  = 0;
+	size_t chunk_size     = 0;
+	int digest_index      = 0;
+
+	if( digests == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid digests.",
+		 function );
+
+		return( -1 );
+	}
+	while( buffer_offset < size )
+	{
+		chunk_size = size - buffer_offset;
+
+		if( chunk_size > MULTISUM_CHUNK_SIZE )
+		{
+			chunk_size = MULTISUM_CHUNK_SIZE;
+		}
+		for( digest_index = 0;
+		     digest_index < number_of_digests;
+		     digest_index++ )
+		{
+			if( multisum_digest_calculate(
+			     &( digests[ digest_index ] ),
+			     &( buffer[ buffer_offset ] ),
+			     chunk_size,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_GENERIC,
+				 "%s: unable to calculate %s.",
+				 function,
+				 digests[ digest_index ].definition->description );
+
+				return( -1 );
+			}
+		}
+		buffer_offset += chunk_size;
+	}
+	return( 1 );
+}
+
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+
+/* Calculates a digest, used as the callback function of a thread
+ * Returns 1 if successful or -1 on error
+ */
+int multisum_digest_thread_calculate(
+     void *arguments )
+{
+	multisum_digest_t *digest = NULL;
+
+	if( arguments == NULL )
+	{
+		return( -1 );
+	}
+	digest = (multisum_digest_t *) arguments;
+
+	digest->result = multisum_digest_calculate(
+	                  digest,
+	                  digest->buffer,
+	                  digest->size,
+	                  NULL );
+
+	return( digest->result );
+}
+
+/* Calculates the digests of a buffer using a thread per digest
+ * The last digest is calculated by the calling thread
+ * Returns 1 if successful or -1 on error
+ */
+int multisum_calculate_parallel(
+     multisum_digest_t *digests,
+     int number_of_digests,
+     uint8_t *buffer,
+     size_t size,
+     libcerror_error_t **error )
+{
+	libcthreads_thread_t *threads[ MULTISUM_NUMBER_OF_DIGESTS ];
+
+	static char *function = "multisum_calculate_parallel";
+	int digest_index      = 0;
+	int result            = 1;
+
+	if( digests == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid digests.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( number_of_digests <= 0 )
+	 || ( number_of_digests > MULTISUM_NUMBER_OF_DIGESTS ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid number of digests value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( memory_set(
+	     threads,
+	     0,
+	     sizeof( libcthreads_thread_t * ) * MULTISUM_NUMBER_OF_DIGESTS ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear threads.",
+		 function );
+
+		return( -1 );
+	}
+	for( digest_index = 0;
+	     digest_index < number_of_digests;
+	     digest_index++ )
+	{
+		digests[ digest_index ].buffer = buffer;
+		digests[ digest_index ].size   = size;
+		digests[ digest_index ].result = 0;
+	}
+	for( digest_index = 0;
+	     digest_index < ( number_of_digests - 1 );
+	     digest_index++ )
+	{
+		if( libcthreads_thread_create(
+		     &( threads[ digest_index ] ),
+		     NULL,
+		     multisum_digest_thread_calculate,
+		     (void *) &( digests[ digest_index ] ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+			 "%s: unable to create thread: %d.",
+			 function,
+			 digest_index );
+
+			result = -1;
+
+			break;
+		}
+	}
+	if( result == 1 )
+	{
+		multisum_digest_thread_calculate(
+		 (void *) &( digests[ number_of_digests - 1 ] ) );
+	}
+	/* Wait for the threads that were created, also on error
+	 */
+	for( digest_index = 0;
+	     digest_index < ( number_of_digests - 1 );
+	     digest_index++ )
+	{
+		if( threads[ digest_index ] == NULL )
+		{
+			continue;
+		}
+		if( libcthreads_thread_join(
+		     &( threads[ digest_index ] ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to join thread: %d.",
+			 function,
+			 digest_index );
+
+			result = -1;
+		}
+	}
+	if( result != 1 )
+	{
+		return( -1 );
+	}
+	for( digest_index = 0;
+	     digest_index < number_of_digests;
+	     digest_index++ )
+	{
+		if( digests[ digest_index ].result != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GENERIC,
+			 "%s: unable to calculate %s.",
+			 function,
+			 digests[ digest_index ].definition->description );
+
+			return( -1 );
+		}
+	}
+	return( 1 );
+}
+
+#endif /* defined( HAVE_MULTI_THREAD_SUPPORT ) */
+
+/* The main program
+ */
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+int wmain( int argc, wchar_t * const argv[] )
+#else
+int main( int argc, char * const argv[] )
+#endif
+{
+	multisum_digest_t digests[ MULTISUM_NUMBER_OF_DIGESTS ];
+	uint8_t selected_digest_types[ MULTISUM_NUMBER_OF_DIGESTS + 1 ];
+
+	const multisum_digest_definition_t *definition = NULL;
+	libcerror_error_t *error                       = NULL;
+	assorted_input_file_t *source_file             = NULL;
+	system_character_t *option_statistics_format   = NULL;
+	system_character_t *source                     = NULL;
+	uint8_t *buffer                                = NULL;
+	char *program                                  = "multisum";
+	system_integer_t option                        = 0;
+	size64_t remaining_size                        = 0;
+	size64_t source_size                           = 0;
+	size_t buffer_size                             = 0;
+	size_t direct_io_block_size                    = 0;
+	size_t name_length                             = 0;
+	size_t read_size                               = 0;
+	ssize_t read_count                             = 0;
+	off_t source_offset                            = 0;
+	uint8_t all_digests                            = 1;
+	uint8_t use_threads                            = 0;
+	int digest_index                               = 0;
+	int number_of_digests                          = 0;
+	int result                                     = 0;
+	int verbose                                    = 0;
+
+	assorted_output_version_fprint(
+	 stdout,
+	 program );
+
+	if( memory_set(
+	     selected_digest_types,
+	     0,
+	     sizeof( uint8_t ) * ( MULTISUM_NUMBER_OF_DIGESTS + 1 ) ) == NULL )
+	{
+		fprintf(
+		 stderr,
+		 "Unable to clear selected digest types.\n" );
+
+		return( EXIT_FAILURE );
+	}
+	while( ( option = assorted_getopt(
+	                   argc,
+	                   argv,
+	                   _SYSTEM_STRING( "d:ho:s:S:tu:vV" ) ) ) != (system_integer_t) -1 )
+	{
+		switch( option )
+		{
+			case '?':
+			default:
+				fprintf(
+				 stderr,
+				 "Invalid argument: %" PRIs_SYSTEM "\n",
+				 argv[ optind ] );
+
+				usage_fprint(
+				 stdout );
+
+				return( EXIT_FAILURE );
+
+			case 'd':
+				name_length = system_string_length(
+				               optarg );
+
+				for( definition = multisum_digest_definitions;
+				     definition->name != NULL;
+				     definition++ )
+				{
+					if( ( system_string_length(
+					       definition->name ) == name_length )
+					 && ( system_string_compare(
+					       definition->name,
+					       optarg,
+					       name_length ) == 0 ) )
+					{
+						break;
+					}
+				}
+				if( definition->name == NULL )
+				{
+					fprintf(
+					 stderr,
+					 "Unsupported digest: %" PRIs_SYSTEM "\n",
+					 optarg );
+
+					usage_fprint(
+					 stdout );
+
+					return( EXIT_FAILURE );
+				}
+				selected_digest_types[ definition->digest_type ] = 1;
+
+				all_digests = 0;
+
+				break;
+
+			case 'h':
+				usage_fprint(
+				 stdout );
+
+				return( EXIT_SUCCESS );
+
+			case 'o':
+				source_offset = atol( optarg );
+
+				break;
+
+			case 's':
+				source_size = atol( optarg );
+
+				break;
+
+			case 'S':
+				option_statistics_format = optarg;
+
+				break;
+
+			case 't':
+				use_threads = 1;
+
+				break;
+
+			case 'u':
+				direct_io_block_size = (size_t) atol( optarg );
+
+				break;
+
+			case 'v':
+				verbose = 1;
+
+				break;
+
+			case 'V':
+				assorted_output_copyright_fprint(
+				 stdout );
+
+				return( EXIT_SUCCESS );
+		}
+	}
+	if( optind == argc )
+	{
+		fprintf(
+		 stderr,
+		 "Missing source file.\n" );
+
+		usage_fprint(
+		 stdout );
+
+		return( EXIT_FAILURE );
+	}
+	source = argv[ optind ];
+
+#if !defined( HAVE_MULTI_THREAD_SUPPORT )
+	if( use_threads != 0 )
+	{
+		fprintf(
+		 stderr,
+		 "Multi-threading not supported, using a single thread.\n" );
+
+		use_threads = 0;
+	}
+#endif
+	libcnotify_stream_set(
+	 stderr,
+	 NULL );
+	libcnotify_verbose_set(
+	 verbose );
+
+	if( assorted_output_statistics_initialize(
+	     option_statistics_format,
+	     &error ) != 1 )
+	{
+		fprintf(
+		 stderr,
+		 "Unable to initialize statistics.\n" );
+
+		goto on_error;
+	}
+
+	/* Open the source file
+	 */
+	if( assorted_input_file_initialize(
+	     &source_file,
+	     &error ) != 1 )
+	{
+		fprintf(
+		 stderr,
+		 "Unable to create source file.\n" );
+
+		goto on_error;
+	}
+	if( assorted_input_file_set_direct_io(
+	     source_file,
+	     direct_io_block_size,
+	     &error ) != 1 )
+	{
+		fprintf(
+		 stderr,
+		 "Unable to set direct I/O block size of source file.\n" );
+
+		goto on_error;
+	}
+	if( assorted_input_file_open(
+	     source_file,
+	     source,
+	     &error ) != 1 )
+	{
+		fprintf(
+		 stderr,
+		 "Unable to open source file.\n" );
+
+		goto on_error;
+	}
+	if( source_size == 0 )
+	{
+		if( assorted_input_file_get_size(
+		     source_file,
+		     &source_size,
+		     &error ) == -1 )
+		{
+			fprintf(
+			 stderr,
+			 "Unable to determine size of source file.\n" );
+
+			goto on_error;
+		}
+	}
+	if( source_size == 0 )
+	{
+		fprintf(
+		 stderr,
+		 "Invalid source size value is zero.\n" );
+
+		goto on_error;
+	}
+	/* The Fletcher-64 is only defined for data that consists of 32-bit values
+	 */
+	if( ( source_size % 4 ) != 0 )
+	{
+		if( selected_digest_types[ MULTISUM_DIGEST_TYPE_FLETCHER64 ] != 0 )
+		{
+			fprintf(
+			 stderr,
+			 "Unable to calculate Fletcher-64 of data with a size that is not a multiple of 4.\n" );
+
+			goto on_error;
+		}
+		if( all_digests != 0 )
+		{
+			fprintf(
+			 stderr,
+			 "Fletcher-64 not calculated since the size is not a multiple of 4.\n" );
+		}
+	}
+	for( definition = multisum_digest_definitions;
+	     definition->name != NULL;
+	     definition++ )
+	{
+		if( ( all_digests == 0 )
+		 && ( selected_digest_types[ definition->digest_type ] == 0 ) )
+		{
+			continue;
+		}
+		if( ( definition->digest_type == MULTISUM_DIGEST_TYPE_FLETCHER64 )
+		 && ( ( source_size % 4 ) != 0 ) )
+		{
+			continue;
+		}
+		digests[ number_of_digests ].definition = definition;
+		digests[ number_of_digests ].value      = 0;
+		digests[ number_of_digests ].buffer     = NULL;
+		digests[ number_of_digests ].size       = 0;
+		digests[ number_of_digests ].result     = 0;
+
+		number_of_digests++;
+	}
+	buffer_size = MULTISUM_BUFFER_SIZE;
+
+	if( (size64_t) buffer_size > source_size )
+	{
+		buffer_size = (size_t) source_size;
+	}
+	/* Position the source file at the right offset
+	 */
+	if( assorted_input_file_seek_offset(
+	     source_file,
+	     source_offset,
+	     SEEK_SET,
+	     &error ) == -1 )
+	{
+		fprintf(
+		 stderr,
+		 "Unable to seek offset in source file.\n" );
+
+		goto on_error;
+	}
+	/* Read the next blocks ahead while the current block is processed
+	 */
+	if( assorted_input_file_set_read_ahead(
+	     source_file,
+	     buffer_size,
+	     ASSORTED_INPUT_FILE_DEFAULT_NUMBER_OF_READ_AHEAD_BLOCKS,
+	     &error ) != 1 )
+	{
+		fprintf(
+		 stderr,
+		 "Unable to set read-ahead of source file.\n" );
+
+		goto on_error;
+	}
+	initialize_crc32_table(
+	 0xedb88320UL );
+
+	initialize_crc64_table(
+	 0x9a6c9329ac4bc9b5ULL );
+
+	/* Read the source data in blocks and pass the blocks to every digest
+	 * so that the source data is only read once
+	 */
+	remaining_size = source_size;
+
+	while( remaining_size > 0 )
+	{
+		read_size = buffer_size;
+
+		if( (size64_t) read_size > remaining_size )
+		{
+			read_size = (size_t) remaining_size;
+		}
+		read_count = assorted_input_file_read_data(
+		              source_file,
+		              &buffer,
+		              read_size,
+		              &error );
+
+		if( read_count != (ssize_t) read_size )
+		{
+			fprintf(
+			 stderr,
+			 "Unable to read from source file.\n" );
+
+			goto on_error;
+		}
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+		if( ( use_threads != 0 )
+		 && ( number_of_digests > 1 ) )
+		{
+			result = multisum_calculate_parallel(
+			          digests,
+			          number_of_digests,
+			          buffer,
+			          read_size,
+			          &error );
+		}
+		else
+#endif
+		{
+			result = multisum_calculate(
+			          digests,
+			          number_of_digests,
+			          buffer,
+			          read_size,
+			          &error );
+		}
+		if( result != 1 )
+		{
+			fprintf(
+			 stderr,
+			 "Unable to calculate digests.\n" );
+
+			goto on_error;
+		}
+		if( libcnotify_verbose != 0 )
+		{
+			libcnotify_print_data(
+			 buffer,
+			 read_size,
+			 LIBCNOTIFY_PRINT_DATA_FLAG_GROUP_DATA );
+		}
+		remaining_size -= read_size;
+	}
+	/* Clean up
+	 */
+	if( assorted_input_file_close(
+	     source_file,
+	     &error ) != 0 )
+	{
+		fprintf(
+		 stderr,
+		 "Unable to close source file.\n" );
+
+		goto on_error;
+	}
+	if( assorted_input_file_free(
+	     &source_file,
+	     &error ) != 1 )
+	{
+		fprintf(
+		 stderr,
+		 "Unable to free source file.\n" );
+
+		goto on_error;
+	}
+	for( digest_index = 0;
+	     digest_index < number_of_digests;
+	     digest_index++ )
+	{
+		if( digests[ digest_index ].definition->number_of_bits == 32 )
+		{
+			fprintf(
+			 stdout,
+			 "Calculated %s: %" PRIu32 " (0x%08" PRIx32 ")\n",
+			 digests[ digest_index ].definition->description,
+			 (uint32_t) digests[ digest_index ].value,
+			 (uint32_t) digests[ digest_index ].value );
+		}
+		else
+		{
+			fprintf(
+			 stdout,
+			 "Calculated %s: %" PRIu64 " (0x%016" PRIx64 ")\n",
+			 digests[ digest_index ].definition->description,
+			 digests[ digest_index ].value,
+			 digests[ digest_index ].value );
+		}
+	}
+	assorted_output_statistics_fprint(
+	 stderr,
+	 program,
+	 1,
+	 NULL );
+	assorted_output_statistics_free(
+	 NULL );
+
+	return( EXIT_SUCCESS );
+
+on_error:
+	if( error != NULL )
+	{
+		libcnotify_print_error_backtrace(
+		 error );
+		libcerror_error_free(
+		 &error );
+	}
+	assorted_output_statistics_fprint(
+	 stderr,
+	 program,
+	 -1,
+	 NULL );
+	assorted_output_statistics_free(
+	 NULL );
+	if( source_file != NULL )
+	{
+		assorted_input_file_free(
+		 &source_file,
+		 NULL );
+	}
+	return( EXIT_FAILURE );
+}
+
@@ -0,0 +1,209 @@
+/*
+ * Windows Prefetch hash functions
+ *
+ * Copyright (C) 2008-2019, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This software is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This software is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this software.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <types.h>
+
+#include "assorted_libcerror.h"
+#include "prefetch_hash.h"
+
+/* The hashes are calculated over the upper case path as an UTF-16
+ * little-endian stream, without end-of-string character, a byte at a time.
+ */
+
+/* Checks the arguments of the calculate functions
+ * Returns 1 if successful or -1 on error
+ */
+static int prefetch_hash_check_arguments(
+            uint32_t *hash_value,
+            const uint8_t *utf16_stream,
+            size_t utf16_stream_size,
+            const char *function,
+            libcerror_error_t **error )
+{
+	if( hash_value == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid hash value.",
+		 function );
+
+		return( -1 );
+	}
+	if( utf16_stream == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid UTF-16 stream.",
+		 function );
+
+		return( -1 );
+	}
+	if( utf16_stream_size > (size_t) SSIZE_MAX )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid UTF-16 stream size value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Calculates the Windows XP Prefetch hash of an upper case path
+ * Returns 1 if successful or -1 on error
+ */
+int prefetch_hash_calculate_xp(
+     uint32_t *hash_value,
+     const uint8_t *utf16_stream,
+     size_t utf16_stream_size,
+     libcerror_error_t **error )
+{
+	static char *function     = "prefetch_hash_calculate_xp";
+	size_t utf16_stream_index = 0;
+	uint32_t value_32bit      = 0;
+
+	if( prefetch_hash_check_arguments(
+	     hash_value,
+	     utf16_stream,
+	     utf16_stream_size,
+	     function,
+	     error ) != 1 )
+	{
+		return( -1 );
+	}
+	for( utf16_stream_index = 0;
+	     utf16_stream_index < utf16_stream_size;
+	     utf16_stream_index++ )
+	{
+		value_32bit = ( value_32bit * 37 ) + utf16_stream[ utf16_stream_index ];
+	}
+	value_32bit *= 314159269UL;
+
+	/* The value is treated as a signed 32-bit integer of which the absolute
+	 * value is used
+	 */
+	if( value_32bit > 0x80000000UL )
+	{
+		value_32bit = (uint32_t) ( 0x100000000ULL - value_32bit );
+	}
+	*hash_value = value_32bit % 1000000007UL;
+
+	return( 1 );
+}
+
+/* Calculates the Windows Vista Prefetch hash of an upper case path
+ * Returns 1 if successful or -1 on error
+ */
+int prefetch_hash_calculate_vista(
+     uint32_t *hash_value,
+     const uint8_t *utf16_stream,
+     size_t utf16_stream_size,
+     libcerror_error_t **error )
+{
+	static char *function     = "prefetch_hash_calculate_vista";
+	size_t utf16_stream_index = 0;
+	uint32_t value_32bit      = 314159UL;
+
+	if( prefetch_hash_check_arguments(
+	     hash_value,
+	     utf16_stream,
+	     utf16_stream_size,
+	     function,
+	     error ) != 1 )
+	{
+		return( -1 );
+	}
+	for( utf16_stream_index = 0;
+	     utf16_stream_index < utf16_stream_size;
+	     utf16_stream_index++ )
+	{
+		value_32bit = ( value_32bit * 37 ) + utf16_stream[ utf16_stream_index ];
+	}
+	*hash_value = value_32bit;
+
+	return( 1 );
+}
+
+/* Calculates the Windows 2008 Prefetch hash of an upper case path
+ * This is the Windows Vista Prefetch hash calculated 8 bytes at a time,
+ * where 803794207 is -37^8 and 442596621 is 37^7 modulus 2^32, hence
+ * the hash values are the same
+ * Returns 1 if successful or -1 on error
+ */
+int prefetch_hash_calculate_2008(
+     uint32_t *hash_value,
+     const uint8_t *utf16_stream,
+     size_t utf16_stream_size,
+     libcerror_error_t **error )
+{
+	static char *function     = "prefetch_hash_calculate_2008";
+	size_t utf16_stream_index = 0;
+	uint32_t character_value  = 0;
+	uint32_t value_32bit      = 314159UL;
+
+	if( prefetch_hash_check_arguments(
+	     hash_value,
+	     utf16_stream,
+	     utf16_stream_size,
+	     function,
+	     error ) != 1 )
+	{
+		return( -1 );
+	}
+	while( ( utf16_stream_index + 8 ) < utf16_stream_size )
+	{
+		character_value  = (uint32_t) utf16_stream[ utf16_stream_index + 1 ] * 37;
+		character_value += utf16_stream[ utf16_stream_index + 2 ];
+		character_value *= 37;
+		character_value += utf16_stream[ utf16_stream_index + 3 ];
+		character_value *= 37;
+		character_value += utf16_stream[ utf16_stream_index + 4 ];
+		character_value *= 37;
+		character_value += utf16_stream[ utf16_stream_index + 5 ];
+		character_value *= 37;
+		character_value += utf16_stream[ utf16_stream_index + 6 ];
+		character_value *= 37;
+		character_value += (uint32_t) utf16_stream[ utf16_stream_index ] * 442596621UL;
+		character_value += utf16_stream[ utf16_stream_index + 7 ];
+
+		value_32bit = character_value - ( value_32bit * 803794207UL );
+
+		utf16_stream_index += 8;
+	}
+	while( utf16_stream_index < utf16_stream_size )
+	{
+		value_32bit = ( value_32bit * 37 ) + utf16_stream[ utf16_stream_index ];
+
+		utf16_stream_index++;
+	}
+	*hash_value = value_32bit;
+
+	return( 1 );
+}
+
@@ -0,0 +1,910 @@
+/*
+ * Calculates Windows Prefetch hashes of paths
+ *
+ * Copyright (C) 2008-2019, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This software is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This software is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this software.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <file_stream.h>
+#include <memory.h>
+#include <narrow_string.h>
+#include <system_string.h>
+#include <types.h>
+
+#if defined( HAVE_STDLIB_H )
+#include <stdlib.h>
+#endif
+
+#include "assorted_getopt.h"
+#include "assorted_libcerror.h"
+#include "assorted_libcnotify.h"
+#include "assorted_libuna.h"
+#include "assorted_output.h"
+#include "prefetch_hash.h"
+
+/* The size of the buffer used to read the path list
+ */
+#define PREFETCHHASH_BUFFER_SIZE		( 1024 * 1024 )
+
+/* The maximum size of an UTF-16 little-endian path stream
+ * which corresponds with the 32767 characters of an extended-length path
+ */
+#define PREFETCHHASH_MAXIMUM_PATH_SIZE		( 32767 * 2 )
+
+/* Prints the executable usage information
+ */
+void usage_fprint(
+      FILE *stream )
+{
+	if( stream == NULL )
+	{
+		return;
+	}
+	fprintf( stream, "Use prefetchhash to calculate Windows Prefetch hashes of paths.\n\n" );
+
+	fprintf( stream, "Usage: prefetchhash [ -f path_list ] [ -S format ] [ -hvV ] [ path ]\n\n" );
+
+	fprintf( stream, "\tpath:   the path to calculate the Prefetch hashes of,\n"
+	                 "\t        e.g. \\DEVICE\\HARDDISKVOLUME1\\WINDOWS\\SYSTEM32\\CMD.EXE\n\n" );
+
+	fprintf( stream, "\t-f:     calculate the Prefetch hashes of the UTF-8 encoded paths\n"
+	                 "\t        in a path list, one path per line, where - reads the list\n"
+	                 "\t        from stdin, and prints a line per path with the Windows XP,\n"
+	                 "\t        Vista and 2008 hashes followed by the path\n" );
+	fprintf( stream, "\t-h:     shows this help\n" );
+	fprintf( stream, "\t-S:     print timing and throughput statistics of the open,\n"
+	                 "\t        read, compute and write phases and the peak memory\n"
+	                 "\t        size to stderr in the format: text or json\n" );
+	fprintf( stream, "\t-v:     verbose output to stderr\n" );
+	fprintf( stream, "\t-V:     print version\n" );
+	fprintf( stream, "\n" );
+}
+
+/* Determines the upper case of an Unicode character
+ * This covers the case mappings of the Latin-1 Supplement, Latin Extended-A,
+ * Greek and Cyrillic blocks, which are the most common in Windows paths
+ * Returns the upper case Unicode character
+ */
+libuna_unicode_character_t prefetchhash_unicode_character_to_upper_case(
+                            libuna_unicode_character_t unicode_character )
+{
+	if( unicode_character < 0x0061 )
+	{
+		return( unicode_character );
+	}
+	if( unicode_character <= 0x007a )
+	{
+		return( unicode_character - 0x0020 );
+	}
+	if( unicode_character < 0x00e0 )
+	{
+		return( unicode_character );
+	}
+	if( unicode_character <= 0x00fe )
+	{
+		if( unicode_character == 0x00f7 )
+		{
+			return( unicode_character );
+		}
+		return( unicode_character - 0x0020 );
+	}
+	if( unicode_character == 0x00ff )
+	{
+		return( 0x0178 );
+	}
+	if( unicode_character <= 0x017e )
+	{
+		/* The dotless i and kra have no upper case in the same block
+		 */
+		if( ( unicode_character == 0x0131 )
+		 || ( unicode_character == 0x0138 ) )
+		{
+			return( unicode_character );
+		}
+		if( ( ( unicode_character >= 0x0139 )
+		  &&  ( unicode_character <= 0x0148 ) )
+		 || ( unicode_character >= 0x0179 ) )
+		{
+			if( ( unicode_character & 1 ) == 0 )
+			{
+				return( unicode_character - 1 );
+			}
+		}
+		else if( ( unicode_character != 0x0149 )
+		      && ( unicode_character != 0x0178 )
+		      && ( ( unicode_character & 1 ) != 0 ) )
+		{
+			return( unicode_character - 1 );
+		}
+		return( unicode_character );
+	}
+	if( ( unicode_character >= 0x03b1 )
+	 && ( unicode_character <= 0x03c9 ) )
+	{
+		if( unicode_character == 0x03c2 )
+		{
+			return( 0x03a3 );
+		}
+		return( unicode_character - 0x0020 );
+	}
+	if( ( unicode_character >= 0x0430 )
+	 && ( unicode_character <= 0x044f ) )
+	{
+		return( unicode_character - 0x0020 );
+	}
+	if( ( unicode_character >= 0x0450 )
+	 && ( unicode_character <= 0x045f ) )
+	{
+		return( unicode_character - 0x0050 );
+	}
+	return( unicode_character );
+}
+
+/* Copies an UTF-8 encoded path to an upper case UTF-16 little-endian stream
+ * Returns 1 if successful or -1 on error
+ */
+int prefetchhash_utf16_stream_copy_from_utf8_path(
+     uint8_t *utf16_stream,
+     size_t utf16_stream_size,
+     size_t *utf16_stream_index,
+     const uint8_t *utf8_path,
+     size_t utf8_path_size,
+     libcerror_error_t **error )
+{
+	static char *function                        = "prefetchhash_utf16_stream_copy_from_utf8_path";
+	libuna_unicode_character_t unicode_character = 0;
+	size_t safe_utf16_stream_index               = 0;
+	size_t utf8_path_index                       = 0;
+	uint8_t byte_value                           = 0;
+
+	if( utf16_stream == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid UTF-16 stream.",
+		 function );
+
+		return( -1 );
+	}
+	if( utf16_stream_size > (size_t) SSIZE_MAX )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid UTF-16 stream size value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	if( utf16_stream_index == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid UTF-16 stream index.",
+		 function );
+
+		return( -1 );
+	}
+	if( utf8_path == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid UTF-8 path.",
+		 function );
+
+		return( -1 );
+	}
+	if( utf8_path_size > (size_t) SSIZE_MAX )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid UTF-8 path size value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	while( utf8_path_index < utf8_path_size )
+	{
+		byte_value = utf8_path[ utf8_path_index ];
+
+		/* Most paths consist of 7-bit ASCII characters which are converted
+		 * directly, other characters are decoded and encoded by libuna
+		 */
+		if( byte_value < 0x80 )
+		{
+			if( ( safe_utf16_stream_index + 2 ) > utf16_stream_size )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_VALUE_TOO_SMALL,
+				 "%s: UTF-16 stream too small.",
+				 function );
+
+				return( -1 );
+			}
+			if( ( byte_value >= (uint8_t) 'a' )
+			 && ( byte_value <= (uint8_t) 'z' ) )
+			{
+				byte_value -= 0x20;
+			}
+			utf16_stream[ safe_utf16_stream_index++ ] = byte_value;
+			utf16_stream[ safe_utf16_stream_index++ ] = 0;
+
+			utf8_path_index++;
+
+			continue;
+		}
+		if( libuna_unicode_character_copy_from_utf8(
+		     &unicode_character,
+		     (libuna_utf8_character_t *) utf8_path,
+		     utf8_path_size,
+		     &utf8_path_index,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_CONVERSION,
+			 LIBCERROR_CONVERSION_ERROR_INPUT_FAILED,
+			 "%s: unable to copy Unicode character from UTF-8 path.",
+			 function );
+
+			return( -1 );
+		}
+		unicode_character = prefetchhash_unicode_character_to_upper_case(
+		                     unicode_character );
+
+		if( libuna_unicode_character_copy_to_utf16_stream(
+		     unicode_character,
+		     utf16_stream,
+		     utf16_stream_size,
+		     &safe_utf16_stream_index,
+		     LIBUNA_ENDIAN_LITTLE,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_CONVERSION,
+			 LIBCERROR_CONVERSION_ERROR_OUTPUT_FAILED,
+			 "%s: unable to copy Unicode character to UTF-16 stream.",
+			 function );
+
+			return( -1 );
+		}
+	}
+	*utf16_stream_index = safe_utf16_stream_index;
+
+	return( 1 );
+}
+
+/* Calculates the Windows XP, Vista and 2008 Prefetch hashes of an UTF-8 encoded path
+ * The hashes are stored in an array of 3 values
+ * Returns 1 if successful or -1 on error
+ */
+int prefetchhash_calculate_hashes(
+     uint32_t *hash_values,
+     uint8_t *utf16_stream,
+     size_t utf16_stream_size,
+     const uint8_t *utf8_path,
+     size_t utf8_path_size,
+     libcerror_error_t **error )
+{
+	static char *function     = "prefetchhash_calculate_hashes";
+	size_t utf16_stream_index = 0;
+
+	if( hash_values == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid hash values.",
+		 function );
+
+		return( -1 );
+	}
+	if( prefetchhash_utf16_stream_copy_from_utf8_path(
+	     utf16_stream,
+	     utf16_stream_size,
+	     &utf16_stream_index,
+	     utf8_path,
+	     utf8_path_size,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_CONVERSION,
+		 LIBCERROR_CONVERSION_ERROR_GENERIC,
+		 "%s: unable to convert path.",
+		 function );
+
+		return( -1 );
+	}
+	if( prefetch_hash_calculate_xp(
+	     &( hash_values[ 0 ] ),
+	     utf16_stream,
+	     utf16_stream_index,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GENERIC,
+		 "%s: unable to calculate Windows XP Prefetch hash.",
+		 function );
+
+		return( -1 );
+	}
+	if( prefetch_hash_calculate_vista(
+	     &( hash_values[ 1 ] ),
+	     utf16_stream,
+	     utf16_stream_index,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GENERIC,
+		 "%s: unable to calculate Windows Vista Prefetch hash.",
+		 function );
+
+		return( -1 );
+	}
+	if( prefetch_hash_calculate_2008(
+	     &( hash_values[ 2 ] ),
+	     utf16_stream,
+	     utf16_stream_index,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GENERIC,
+		 "%s: unable to calculate Windows 2008 Prefetch hash.",
+		 function );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Calculates the Prefetch hashes of the paths in a path list stream
+ * The list is read in bulk into a single buffer and the paths are converted
+ * into a single UTF-16 stream, hence no memory is allocated per path
+ * Returns 1 if successful or -1 on error
+ */
+int prefetchhash_hash_path_list(
+     FILE *stream,
+     uint64_t *number_of_paths,
+     libcerror_error_t **error )
+{
+	uint32_t hash_values[ 3 ];
+
+	uint8_t *buffer               = NULL;
+	uint8_t *line_end             = NULL;
+	uint8_t *utf16_stream         = NULL;
+	static char *function         = "prefetchhash_hash_path_list";
+	size_t buffer_index           = 0;
+	size_t data_size              = 0;
+	size_t line_start             = 0;
+	size_t path_size              = 0;
+	size_t read_count             = 0;
+	uint64_t safe_number_of_paths = 0;
+	int end_of_input              = 0;
+
+	if( stream == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid stream.",
+		 function );
+
+		return( -1 );
+	}
+	if( number_of_paths == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid number of paths.",
+		 function );
+
+		return( -1 );
+	}
+	buffer = (uint8_t *) memory_allocate(
+	                      sizeof( uint8_t ) * PREFETCHHASH_BUFFER_SIZE );
+
+	if( buffer == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create buffer.",
+		 function );
+
+		goto on_error;
+	}
+	utf16_stream = (uint8_t *) memory_allocate(
+	                            sizeof( uint8_t ) * PREFETCHHASH_MAXIMUM_PATH_SIZE );
+
+	if( utf16_stream == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create UTF-16 stream.",
+		 function );
+
+		goto on_error;
+	}
+	while( end_of_input == 0 )
+	{
+		read_count = file_stream_read(
+		              stream,
+		              &( buffer[ data_size ] ),
+		              PREFETCHHASH_BUFFER_SIZE - data_size );
+
+		if( read_count == 0 )
+		{
+			if( ferror( stream ) != 0 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_IO,
+				 LIBCERROR_IO_ERROR_READ_FAILED,
+				 "%s: unable to read path list.",
+				 function );
+
+				goto on_error;
+			}
+			end_of_input = 1;
+		}
+		data_size += read_count;
+
+		line_start = 0;
+
+		while( line_start < data_size )
+		{
+			line_end = (uint8_t *) narrow_string_search_character(
+			                        &( buffer[ line_start ] ),
+			                        '\n',
+			                        data_size - line_start );
+
+			if( line_end != NULL )
+			{
+				path_size = (size_t) ( line_end - &( buffer[ line_start ] ) );
+			}
+			else if( end_of_input != 0 )
+			{
+				path_size = data_size - line_start;
+			}
+			else
+			{
+				break;
+			}
+			buffer_index = line_start + path_size;
+
+			if( ( path_size > 0 )
+			 && ( buffer[ buffer_index - 1 ] == (uint8_t) '\r' ) )
+			{
+				path_size--;
+			}
+			if( path_size > 0 )
+			{
+				if( prefetchhash_calculate_hashes(
+				     hash_values,
+				     utf16_stream,
+				     PREFETCHHASH_MAXIMUM_PATH_SIZE,
+				     &( buffer[ line_start ] ),
+				     path_size,
+				     error ) != 1 )
+				{
+					libcerror_error_set(
+					 error,
+					 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+					 LIBCERROR_RUNTIME_ERROR_GENERIC,
+					 "%s: unable to calculate Prefetch hashes of path: %" PRIu64 ".",
+					 function,
+					 safe_number_of_paths );
+
+					goto on_error;
+				}
+				fprintf(
+				 stdout,
+				 "%08" PRIx32 "\t%08" PRIx32 "\t%08" PRIx32 "\t%.*s\n",
+				 hash_values[ 0 ],
+				 hash_values[ 1 ],
+				 hash_values[ 2 ],
+				 (int) path_size,
+				 (char *) &( buffer[ line_start ] ) );
+
+				safe_number_of_paths++;
+			}
+			line_start = buffer_index + 1;
+		}
+		if( line_start >= data_size )
+		{
+			data_size = 0;
+		}
+		else if( line_start > 0 )
+		{
+			/* Move the remainder of an incomplete path to the start of the buffer
+			 */
+			data_size -= line_start;
+
+			for( buffer_index = 0;
+			     buffer_index < data_size;
+			     buffer_index++ )
+			{
+				buffer[ buffer_index ] = buffer[ line_start + buffer_index ];
+			}
+		}
+		else if( data_size == PREFETCHHASH_BUFFER_SIZE )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+			 "%s: invalid path: %" PRIu64 " value exceeds maximum size.",
+			 function,
+			 safe_number_of_paths );
+
+			goto on_error;
+		}
+	}
+	memory_free(
+	 utf16_stream );
+
+	memory_free(
+	 buffer );
+
+	*number_of_paths = safe_number_of_paths;
+
+	return( 1 );
+
+on_error:
+	if( utf16_stream != NULL )
+	{
+		memory_free(
+		 utf16_stream );
+	}
+	if( buffer != NULL )
+	{
+		memory_free(
+		 buffer );
+	}
+	*number_of_paths = safe_number_of_paths;
+
+	return( -1 );
+}
+
+/* The main program
+ */
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+int wmain( int argc, wchar_t * const argv[] )
+#else
+int main( int argc, char * const argv[] )
+#endif
+{
+	uint8_t utf16_stream[ PREFETCHHASH_MAXIMUM_PATH_SIZE ];
+	uint32_t hash_values[ 3 ];
+
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+	uint8_t utf8_path[ PREFETCHHASH_MAXIMUM_PATH_SIZE ];
+#endif
+
+	FILE *stream                                 = NULL;
+	libcerror_error_t *error                     = NULL;
+	system_character_t *option_statistics_format = NULL;
+	system_character_t *path                     = NULL;
+	system_character_t *path_list                = NULL;
+	uint8_t *narrow_path                         = NULL;
+	char *program                                = "prefetchhash";
+	system_integer_t option                      = 0;
+	size_t narrow_path_size                      = 0;
+	uint64_t number_of_paths                     = 0;
+	int result                                   = 0;
+	int verbose                                  = 0;
+
+	libcnotify_stream_set(
+	 stderr,
+	 NULL );
+	libcnotify_verbose_set(
+	 1 );
+
+	while( ( option = assorted_getopt(
+	                   argc,
+	                   argv,
+	                   _SYSTEM_STRING( "f:hS:vV" ) ) ) != (system_integer_t) -1 )
+	{
+		switch( option )
+		{
+			case '?':
+			default:
+				assorted_output_version_fprint(
+				 stdout,
+				 program );
+
+				fprintf(
+				 stderr,
+				 "Invalid argument: %" PRIs_SYSTEM "\n",
+				 argv[ optind ] );
+
+				usage_fprint(
+				 stdout );
+
+				return( EXIT_FAILURE );
+
+			case 'f':
+				path_list = optarg;
+
+				break;
+
+			case 'h':
+				assorted_output_version_fprint(
+				 stdout,
+				 program );
+
+				usage_fprint(
+				 stdout );
+
+				return( EXIT_SUCCESS );
+
+			case 'S':
+				option_statistics_format = optarg;
+
+				break;
+
+			case 'v':
+				verbose = 1;
+
+				break;
+
+			case 'V':
+				assorted_output_version_fprint(
+				 stdout,
+				 program );
+
+				assorted_output_copyright_fprint(
+				 stdout );
+
+				return( EXIT_SUCCESS );
+		}
+	}
+	if( ( path_list == NULL )
+	 && ( optind == argc ) )
+	{
+		assorted_output_version_fprint(
+		 stdout,
+		 program );
+
+		fprintf(
+		 stderr,
+		 "Missing path.\n" );
+
+		usage_fprint(
+		 stdout );
+
+		return( EXIT_FAILURE );
+	}
+	libcnotify_stream_set(
+	 stderr,
+	 NULL );
+	libcnotify_verbose_set(
+	 verbose );
+
+	if( assorted_output_statistics_initialize(
+	     option_statistics_format,
+	     &error ) != 1 )
+	{
+		fprintf(
+		 stderr,
+		 "Unable to initialize statistics.\n" );
+
+		goto on_error;
+	}
+
+	if( path_list != NULL )
+	{
+		/* The path list output is intended to be processed by other tools
+		 * hence the version information is not printed
+		 */
+		if( ( path_list[ 0 ] == (system_character_t) '-' )
+		 && ( path_list[ 1 ] == 0 ) )
+		{
+			stream = stdin;
+		}
+		else
+		{
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+			stream = file_stream_open_wide(
+			          path_list,
+			          _WIDE_STRING( FILE_STREAM_BINARY_OPEN_READ ) );
+#else
+			stream = file_stream_open(
+			          path_list,
+			          FILE_STREAM_BINARY_OPEN_READ );
+#endif
+			if( stream == NULL )
+			{
+				fprintf(
+				 stderr,
+				 "Unable to open path list: %" PRIs_SYSTEM ".\n",
+				 path_list );
+
+				goto on_error;
+			}
+		}
+		result = prefetchhash_hash_path_list(
+		          stream,
+		          &number_of_paths,
+		          &error );
+
+		if( stream != stdin )
+		{
+			file_stream_close(
+			 stream );
+		}
+		stream = NULL;
+
+		if( result != 1 )
+		{
+			fprintf(
+			 stderr,
+			 "Unable to calculate Prefetch hashes of path list.\n" );
+
+			goto on_error;
+		}
+		if( verbose != 0 )
+		{
+			fprintf(
+			 stderr,
+			 "Calculated Prefetch hashes of: %" PRIu64 " paths.\n",
+			 number_of_paths );
+		}
+		return( EXIT_SUCCESS );
+	}
+	path = argv[ optind ];
+
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+	if( libuna_utf8_string_size_from_utf16(
+	     (libuna_utf16_character_t *) path,
+	     wide_string_length( path ) + 1,
+	     &narrow_path_size,
+	     &error ) != 1 )
+	{
+		fprintf(
+		 stderr,
+		 "Unable to determine path size.\n" );
+
+		goto on_error;
+	}
+	if( narrow_path_size > PREFETCHHASH_MAXIMUM_PATH_SIZE )
+	{
+		fprintf(
+		 stderr,
+		 "Invalid path size value exceeds maximum.\n" );
+
+		goto on_error;
+	}
+	if( libuna_utf8_string_copy_from_utf16(
+	     (libuna_utf8_character_t *) utf8_path,
+	     PREFETCHHASH_MAXIMUM_PATH_SIZE,
+	     (libuna_utf16_character_t *) path,
+	     wide_string_length( path ) + 1,
+	     &error ) != 1 )
+	{
+		fprintf(
+		 stderr,
+		 "Unable to convert path.\n" );
+
+		goto on_error;
+	}
+	narrow_path = utf8_path;
+
+	/* The size includes the end-of-string character
+	 */
+	narrow_path_size -= 1;
+#else
+	narrow_path      = (uint8_t *) path;
+	narrow_path_size = narrow_string_length(
+	                    path );
+#endif
+	assorted_output_version_fprint(
+	 stdout,
+	 program );
+
+	if( prefetchhash_calculate_hashes(
+	     hash_values,
+	     utf16_stream,
+	     PREFETCHHASH_MAXIMUM_PATH_SIZE,
+	     narrow_path,
+	     narrow_path_size,
+	     &error ) != 1 )
+	{
+		fprintf(
+		 stderr,
+		 "Unable to calculate Prefetch hashes.\n" );
+
+		goto on_error;
+	}
+	fprintf(
+	 stdout,
+	 "Windows Prefetch hashes:\n" );
+
+	fprintf(
+	 stdout,
+	 "\tWindows XP\t: 0x%08" PRIx32 "\n",
+	 hash_values[ 0 ] );
+
+	fprintf(
+	 stdout,
+	 "\tWindows Vista\t: 0x%08" PRIx32 "\n",
+	 hash_values[ 1 ] );
+
+	fprintf(
+	 stdout,
+	 "\tWindows 2008\t: 0x%08" PRIx32 "\n",
+	 hash_values[ 2 ] );
+
+	fprintf(
+	 stdout,
+	 "\n" );
+
+	assorted_output_statistics_fprint(
+	 stderr,
+	 program,
+	 1,
+	 NULL );
+	assorted_output_statistics_free(
+	 NULL );
+
+	return( EXIT_SUCCESS );
+
+on_error:
+	if( error != NULL )
+	{
+		libcnotify_print_error_backtrace(
+		 error );
+		libcerror_error_free(
+		 &error );
+	}
+	assorted_output_statistics_fprint(
+	 stderr,
+	 program,
+	 -1,
+	 NULL );
+	assorted_output_statistics_free(
+	 NULL );
+	return( EXIT_FAILURE );
+}
+
@@ -32,6 +32,7 @@
 #endif
 
 #include "assorted_getopt.h"
+#include "assorted_input_file.h"
 #include "assorted_libcerror.h"
 #include "assorted_libcfile.h"
 #include "assorted_libcnotify.h"
@@ -39,6 +40,10 @@
 #include "assorted_libuna.h"
 #include "assorted_output.h"
 
+/* The size of the buffer used to decrypt the data of the source file
+ */
+#define RC4CRYPT_BUFFER_SIZE	( 4 * 1024 * 1024 )
+
 /* Sets the keys
  * Returns 1 if successful or -1 on error
  */
@@ -145,15 +150,24 @@ void usage_fprint(
 	}
 	fprintf( stream, "Use rc4crypt to de- or encrypt data using RC4.\n\n" );
 
-	fprintf( stream, "Usage: rc4crypt [ -k key ] [ -o offset ] [ -s size ]\n"
+	fprintf( stream, "Usage: rc4crypt [ -d drop_size ] [ -D window ] [ -k key ]\n"
+	                 "                [ -o offset ] [ -s size ] [ -S format ]\n"
 	                 "                [ -t target ] [ -hvV ] source\n\n" );
 
 	fprintf( stream, "\tsource: the source file\n\n" );
 
+	fprintf( stream, "\t-d:     number of bytes of the keystream to skip (default is 0),\n"
+	                 "\t        such as 768 or 3072 for RC4-drop\n" );
+	fprintf( stream, "\t-D:     limit the hexadecimal representation of the data to\n"
+	                 "\t        a window formatted as offset:size or offset relative\n"
+	                 "\t        to the start of the data (default is all data)\n" );
 	fprintf( stream, "\t-h:     shows this help\n" );
 	fprintf( stream, "\t-k:     the key formatted in base16\n" );
 	fprintf( stream, "\t-o:     data offset (default is 0)\n" );
 	fprintf( stream, "\t-s:     size of data (default is the file size)\n" );
+	fprintf( stream, "\t-S:     print timing and throughput statistics of the open,\n"
+	                 "\t        read, compute and write phases and the peak memory\n"
+	                 "\t        size to stderr in the format: text or json\n" );
 	fprintf( stream, "\t-t:     specify the target file to write the output data,\n"
 	                 "\t        by default the data will be written to stdout in\n"
 	                 "\t        hexadecimal representation\n" );
@@ -162,6 +176,76 @@ void usage_fprint(
 	fprintf( stream, "\n" );
 }
 
+/* Skips the first bytes of the keystream (RC4-drop)
+ * The data buffer is used as scratch space, hence its content is overwritten
+ * Returns 1 if successful or -1 on error
+ */
+int rc4crypt_drop_keystream(
+     libfcrypto_rc4_context_t *context,
+     uint8_t *data,
+     size_t data_size,
+     size64_t drop_size,
+     libcerror_error_t **error )
+{
+	static char *function = "rc4crypt_drop_keystream";
+	size_t crypt_size     = 0;
+
+	if( data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid data.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( data_size == 0 )
+	 || ( data_size > (size_t) SSIZE_MAX ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid data size value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	/* Since RC4 keeps its state between calls the keystream is advanced
+	 * by de- or encrypting the data buffer in place
+	 */
+	while( drop_size > 0 )
+	{
+		crypt_size = data_size;
+
+		if( (size64_t) crypt_size > drop_size )
+		{
+			crypt_size = (size_t) drop_size;
+		}
+		if( libfcrypto_rc4_crypt(
+		     context,
+		     data,
+		     crypt_size,
+		     data,
+		     crypt_size,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_ENCRYPTION,
+			 LIBCERROR_ENCRYPTION_ERROR_GENERIC,
+			 "%s: unable to skip keystream.",
+			 function );
+
+			return( -1 );
+		}
+		drop_size -= crypt_size;
+	}
+	return( 1 );
+}
+
 /* The main program
  */
 #if defined( HAVE_WIDE_SYSTEM_CHARACTER )
@@ -170,26 +254,31 @@ int wmain( int argc, wchar_t * const argv[] )
 int main( int argc, char * const argv[] )
 #endif
 {
-	libcerror_error_t *error               = NULL;
-	libcfile_file_t *destination_file      = NULL;
-	libcfile_file_t *source_file           = NULL;
-	libfcrypto_rc4_context_t *context      = NULL;
-	system_character_t *option_keys        = NULL;
-	system_character_t *option_target_path = NULL;
-	system_character_t *source             = NULL;
-	uint8_t *buffer                        = NULL;
-	uint8_t *decrypted_data                = NULL;
-	uint8_t *key_data                      = NULL;
-	char *program                          = "rc4crypt";
-	system_integer_t option                = 0;
-	size64_t source_size                   = 0;
-	size_t buffer_size                     = 0;
-	size_t decrypted_data_size             = 0;
-	size_t key_data_size                   = 0;
-	ssize_t read_count                     = 0;
-	ssize_t write_count                    = 0;
-	off_t source_offset                    = 0;
-	int verbose                            = 0;
+	libcerror_error_t *error                     = NULL;
+	libcfile_file_t *destination_file            = NULL;
+	assorted_input_file_t *source_file           = NULL;
+	libfcrypto_rc4_context_t *context            = NULL;
+	system_character_t *option_keys              = NULL;
+	system_character_t *option_hexdump_window    = NULL;
+	system_character_t *option_statistics_format = NULL;
+	system_character_t *option_target_path       = NULL;
+	system_character_t *source                   = NULL;
+	uint8_t *buffer                              = NULL;
+	uint8_t *decrypted_data                      = NULL;
+	uint8_t *key_data                            = NULL;
+	char *program                                = "rc4crypt";
+	system_integer_t option                      = 0;
+	size64_t drop_size                           = 0;
+	size64_t remaining_size                      = 0;
+	size64_t source_size                         = 0;
+	uint64_t phase_start_time                    = 0;
+	size_t buffer_size                           = 0;
+	size_t key_data_size                         = 0;
+	size_t read_size                             = 0;
+	ssize_t read_count                           = 0;
+	ssize_t write_count                          = 0;
+	off_t source_offset                          = 0;
+	int verbose                                  = 0;
 
 	libcnotify_stream_set(
 	 stderr,
@@ -204,7 +293,7 @@ int main( int argc, char * const argv[] )
 	while( ( option = assorted_getopt(
 	                   argc,
 	                   argv,
-	                   _SYSTEM_STRING( "hk:o:s:t:vV" ) ) ) != (system_integer_t) -1 )
+	                   _SYSTEM_STRING( "d:D:hk:o:s:S:t:vV" ) ) ) != (system_integer_t) -1 )
 	{
 		switch( option )
 		{
@@ -220,6 +309,16 @@ int main( int argc, char * const argv[] )
 
 				return( EXIT_FAILURE );
 
+			case (system_integer_t) 'd':
+				drop_size = (size64_t) strtoull( optarg, NULL, 0 );
+
+				break;
+
+			case (system_integer_t) 'D':
+				option_hexdump_window = optarg;
+
+				break;
+
 			case (system_integer_t) 'h':
 				usage_fprint(
 				 stdout );
@@ -241,6 +340,11 @@ int main( int argc, char * const argv[] )
 
 				break;
 
+			case (system_integer_t) 'S':
+				option_statistics_format = optarg;
+
+				break;
+
 			case (system_integer_t) 't':
 				option_target_path = optarg;
 
@@ -288,9 +392,33 @@ int main( int argc, char * const argv[] )
 	libcnotify_verbose_set(
 	 verbose );
 
+	if( assorted_output_statistics_initialize(
+	     option_statistics_format,
+	     &error ) != 1 )
+	{
+		fprintf(
+		 stderr,
+		 "Unable to initialize statistics.\n" );
+
+		goto on_error;
+	}
+	if( option_hexdump_window != NULL )
+	{
+		if( assorted_output_hexdump_window_set(
+		     option_hexdump_window,
+		     &error ) != 1 )
+		{
+			fprintf(
+			 stderr,
+			 "Unsupported hexdump window.\n" );
+
+			goto on_error;
+		}
+	}
+
 	/* Open the source file
 	 */
-	if( libcfile_file_initialize(
+	if( assorted_input_file_initialize(
 	     &source_file,
 	     &error ) != 1 )
 	{
@@ -300,10 +428,9 @@ int main( int argc, char * const argv[] )
 
 		goto on_error;
 	}
-	if( libcfile_file_open(
+	if( assorted_input_file_open(
 	     source_file,
 	     source,
-	     LIBCFILE_OPEN_READ,
 	     &error ) != 1 )
 	{
 		fprintf(
@@ -314,7 +441,7 @@ int main( int argc, char * const argv[] )
 	}
 	if( source_size == 0 )
 	{
-		if( libcfile_file_get_size(
+		if( assorted_input_file_get_size(
 		     source_file,
 		     &source_size,
 		     &error ) == -1 )
@@ -325,6 +452,14 @@ int main( int argc, char * const argv[] )
 
 			goto on_error;
 		}
+		if( (size64_t) source_offset < source_size )
+		{
+			source_size -= source_offset;
+		}
+		else
+		{
+			source_size = 0;
+		}
 	}
 	if( source_size == 0 )
 	{
@@ -332,35 +467,35 @@ int main( int argc, char * const argv[] )
 		 stderr,
 		 "Invalid source size value is zero.\n" );
 
-		return( EXIT_FAILURE );
+		goto on_error;
 	}
-	if( source_size > (size_t) SSIZE_MAX )
+	/* RC4 keeps its state between calls, hence the data is decrypted in chunks
+	 * of a fixed size, without a target the data is decrypted at once so that
+	 * it can be printed
+	 */
+	if( option_target_path == NULL )
 	{
-		fprintf(
-		 stderr,
-		 "Invalid source size value exceeds maximum.\n" );
+		if( source_size > (size64_t) SSIZE_MAX )
+		{
+			fprintf(
+			 stderr,
+			 "Invalid source size value exceeds maximum.\n" );
 
-		return( EXIT_FAILURE );
+			goto on_error;
+		}
+		buffer_size = (size_t) source_size;
 	}
-	/* Create the input buffer
-	 */
-	buffer_size = source_size;
-
-	buffer = (uint8_t *) memory_allocate(
-	                      sizeof( uint8_t ) * buffer_size );
-
-	if( buffer == NULL )
+	else
 	{
-		fprintf(
-		 stderr,
-		 "Unable to create buffer.\n" );
+		buffer_size = RC4CRYPT_BUFFER_SIZE;
 
-		return( EXIT_FAILURE );
+		if( (size64_t) buffer_size > source_size )
+		{
+			buffer_size = (size_t) source_size;
+		}
 	}
-	decrypted_data_size = source_size;
-
 	decrypted_data = (uint8_t *) memory_allocate(
-	                              sizeof( uint8_t ) * decrypted_data_size );
+	                              sizeof( uint8_t ) * buffer_size );
 
 	if( decrypted_data == NULL )
 	{
@@ -372,7 +507,7 @@ int main( int argc, char * const argv[] )
 	}
 	/* Position the source file at the right offset
 	 */
-	if( libcfile_file_seek_offset(
+	if( assorted_input_file_seek_offset(
 	     source_file,
 	     source_offset,
 	     SEEK_SET,
@@ -384,39 +519,30 @@ int main( int argc, char * const argv[] )
 
 		goto on_error;
 	}
-	if( libfcrypto_rc4_context_initialize(
-	     &context,
+	/* Read the next chunks ahead while the current chunk is decrypted
+	 */
+	if( assorted_input_file_set_read_ahead(
+	     source_file,
+	     buffer_size,
+	     ASSORTED_INPUT_FILE_DEFAULT_NUMBER_OF_READ_AHEAD_BLOCKS,
 	     &error ) != 1 )
 	{
 		fprintf(
 		 stderr,
-		 "Unable to create RC4 context.\n" );
+		 "Unable to set read-ahead of source file.\n" );
 
 		goto on_error;
 	}
-	fprintf(
-	 stdout,
-	 "Starting RC4 decrypting data of: %" PRIs_SYSTEM " at offset: %" PRIjd " (0x%08" PRIjx ").\n",
-	 source,
-	 source_offset,
-	 source_offset );
-
-	read_count = libcfile_file_read_buffer(
-		      source_file,
-		      buffer,
-		      source_size,
-	              &error );
-
-	if( read_count != (ssize_t) source_size )
+	if( libfcrypto_rc4_context_initialize(
+	     &context,
+	     &error ) != 1 )
 	{
 		fprintf(
 		 stderr,
-		 "Unable to read from source file.\n" );
+		 "Unable to create RC4 context.\n" );
 
 		goto on_error;
 	}
-	/* Decrypts the data
-	 */
 	if( rc4crypt_set_keys(
 	     option_keys,
 	     &key_data,
@@ -457,43 +583,23 @@ int main( int argc, char * const argv[] )
 
 	key_data = NULL;
 
-	if( option_target_path == NULL )
+	if( drop_size > 0 )
 	{
-		fprintf(
-		 stderr,
-		 "Encrypted data:\n" );
-
-		libcnotify_print_data(
-		 buffer,
-		 source_size,
-		 0 );
-	}
-	if( libfcrypto_rc4_crypt(
-	     context,
-	     buffer,
-	     source_size,
-	     decrypted_data,
-	     decrypted_data_size,
-	     &error ) != 1 )
-	{
-		fprintf(
-		 stderr,
-		 "Unable to decode data.\n" );
-
-		goto on_error;
-	}
-	if( option_target_path == NULL )
-	{
-		fprintf(
-		 stderr,
-		 "Decrypted data:\n" );
+		if( rc4crypt_drop_keystream(
+		     context,
+		     decrypted_data,
+		     buffer_size,
+		     drop_size,
+		     &error ) != 1 )
+		{
+			fprintf(
+			 stderr,
+			 "Unable to skip keystream.\n" );
 
-		libcnotify_print_data(
-		 decrypted_data,
-		 decrypted_data_size,
-		 0 );
+			goto on_error;
+		}
 	}
-	else
+	if( option_target_path != NULL )
 	{
 		if( libcfile_file_initialize(
 		     &destination_file,
@@ -505,6 +611,8 @@ int main( int argc, char * const argv[] )
 
 			goto on_error;
 		}
+		phase_start_time = assorted_output_statistics_start_phase();
+
 		if( libcfile_file_open(
 		     destination_file,
 		     option_target_path,
@@ -517,20 +625,130 @@ int main( int argc, char * const argv[] )
 
 			goto on_error;
 		}
-		write_count = libcfile_file_write_buffer(
-			       destination_file,
-			       decrypted_data,
-			       decrypted_data_size,
-			       &error );
+		assorted_output_statistics_stop_phase(
+		 ASSORTED_OUTPUT_STATISTICS_PHASE_OPEN,
+		 phase_start_time,
+		 0 );
+	}
+	fprintf(
+	 stdout,
+	 "Starting RC4 decrypting data of: %" PRIs_SYSTEM " at offset: %" PRIjd " (0x%08" PRIjx ").\n",
+	 source,
+	 source_offset,
+	 source_offset );
+
+	/* Decrypt the source data in chunks and write the decrypted chunks
+	 * to the target
+	 */
+	remaining_size = source_size;
+
+	while( remaining_size > 0 )
+	{
+		read_size = buffer_size;
+
+		if( (size64_t) read_size > remaining_size )
+		{
+			read_size = (size_t) remaining_size;
+		}
+		read_count = assorted_input_file_read_data(
+		              source_file,
+		              &buffer,
+		              read_size,
+		              &error );
+
+		if( read_count != (ssize_t) read_size )
+		{
+			fprintf(
+			 stderr,
+			 "Unable to read from source file.\n" );
+
+			goto on_error;
+		}
+		if( option_target_path == NULL )
+		{
+			fprintf(
+			 stderr,
+			 "Encrypted data:\n" );
+
+			if( assorted_output_data_fprint(
+			     stderr,
+			     buffer,
+			     read_size,
+			     (uint64_t) ( source_size - remaining_size ),
+			     &error ) != 1 )
+			{
+				fprintf(
+				 stderr,
+				 "Unable to print encrypted data.\n" );
 
-		if( write_count != (ssize_t) decrypted_data_size )
+				goto on_error;
+			}
+		}
+		if( libfcrypto_rc4_crypt(
+		     context,
+		     buffer,
+		     read_size,
+		     decrypted_data,
+		     read_size,
+		     &error ) != 1 )
 		{
 			fprintf(
 			 stderr,
-			 "Unable to write to destination file.\n" );
+			 "Unable to decode data.\n" );
 
 			goto on_error;
 		}
+		if( option_target_path == NULL )
+		{
+			fprintf(
+			 stderr,
+			 "Decrypted data:\n" );
+
+			if( assorted_output_data_fprint(
+			     stderr,
+			     decrypted_data,
+			     read_size,
+			     (uint64_t) ( source_size - remaining_size ),
+			     &error ) != 1 )
+			{
+				fprintf(
+				 stderr,
+				 "Unable to print decrypted data.\n" );
+
+				goto on_error;
+			}
+		}
+		else
+		{
+			phase_start_time = assorted_output_statistics_start_phase();
+
+			write_count = libcfile_file_write_buffer(
+				       destination_file,
+				       decrypted_data,
+				       read_size,
+				       &error );
+
+			if( write_count != (ssize_t) read_size )
+			{
+				fprintf(
+				 stderr,
+				 "Unable to write to destination file.\n" );
+
+				goto on_error;
+			}
+			assorted_output_statistics_stop_phase(
+			 ASSORTED_OUTPUT_STATISTICS_PHASE_WRITE,
+			 phase_start_time,
+			 (size64_t) write_count );
+		}
+		remaining_size -= read_size;
+	}
+	/* Clean up
+	 */
+	if( destination_file != NULL )
+	{
+		phase_start_time = assorted_output_statistics_start_phase();
+
 		if( libcfile_file_close(
 		     destination_file,
 		     &error ) != 0 )
@@ -541,6 +759,11 @@ int main( int argc, char * const argv[] )
 
 			goto on_error;
 		}
+		assorted_output_statistics_stop_phase(
+		 ASSORTED_OUTPUT_STATISTICS_PHASE_WRITE,
+		 phase_start_time,
+		 0 );
+
 		if( libcfile_file_free(
 		     &destination_file,
 		     &error ) != 1 )
@@ -552,8 +775,6 @@ int main( int argc, char * const argv[] )
 			goto on_error;
 		}
 	}
-	/* Clean up
-	 */
 	if( libfcrypto_rc4_context_free(
 	     &context,
 	     &error ) != 1 )
@@ -564,7 +785,7 @@ int main( int argc, char * const argv[] )
 
 		goto on_error;
 	}
-	if( libcfile_file_close(
+	if( assorted_input_file_close(
 	     source_file,
 	     &error ) != 0 )
 	{
@@ -574,7 +795,7 @@ int main( int argc, char * const argv[] )
 
 		goto on_error;
 	}
-	if( libcfile_file_free(
+	if( assorted_input_file_free(
 	     &source_file,
 	     &error ) != 1 )
 	{
@@ -584,20 +805,21 @@ int main( int argc, char * const argv[] )
 
 		goto on_error;
 	}
-	if( decrypted_data != NULL )
-	{
-		memory_free(
-		 decrypted_data );
-	}
-	if( buffer != NULL )
-	{
-		memory_free(
-		 buffer );
-	}
+	memory_free(
+	 decrypted_data );
+
 	fprintf(
 	 stdout,
 	 "RC4 decryption:\tSUCCESS\n" );
 
+	assorted_output_statistics_fprint(
+	 stderr,
+	 program,
+	 1,
+	 NULL );
+	assorted_output_statistics_free(
+	 NULL );
+
 	return( EXIT_SUCCESS );
 
 on_error:
@@ -608,6 +830,13 @@ on_error:
 		libcerror_error_free(
 		 &error );
 	}
+	assorted_output_statistics_fprint(
+	 stderr,
+	 program,
+	 -1,
+	 NULL );
+	assorted_output_statistics_free(
+	 NULL );
 	if( destination_file != NULL )
 	{
 		libcfile_file_free(
@@ -635,14 +864,9 @@ on_error:
 		 &context,
 		 NULL );
 	}
-	if( buffer != NULL )
-	{
-		memory_free(
-		 buffer );
-	}
 	if( source_file != NULL )
 	{
-		libcfile_file_free(
+		assorted_input_file_free(
 		 &source_file,
 		 NULL );
 	}
@@ -0,0 +1,1291 @@
+/*
+ * Serpent functions
+ *
+ * Copyright (C) 2008-2019, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This software is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This software is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this software.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <byte_stream.h>
+#include <memory.h>
+#include <types.h>
+
+#include "assorted_libcerror.h"
+#include "cpu_features.h"
+#include "serpent.h"
+#include "serpent_sboxes.h"
+
+#if defined( HAVE_CPU_FEATURES_X86 )
+#include <immintrin.h>
+
+#elif defined( HAVE_CPU_FEATURES_ARM64 )
+#include <arm_neon.h>
+
+#endif
+
+/* The golden ratio used in the key schedule
+ */
+#define SERPENT_KEY_SCHEDULE_PHI	0x9e3779b9UL
+
+/* The reduction polynomial of GF(2^128) used to calculate the XTS tweaks
+ */
+#define SERPENT_XTS_GF_128_POLYNOMIAL	0x87ULL
+
+/* The number of XTS tweaks that are calculated at once
+ */
+#define SERPENT_XTS_NUMBER_OF_TWEAKS	64
+
+/* The round functions are defined in terms of SERPENT_WORD, SERPENT_AND,
+ * SERPENT_NOT and SERPENT_XOR, the S-box operations, and SERPENT_ROTATE_LEFT,
+ * SERPENT_SHIFT_LEFT and SERPENT_SET, that sets all 32-bit values of a word
+ * to a subkey, which are defined per implementation.
+ */
+
+/* Exclusive ORs the subkey of a round
+ */
+#define SERPENT_KEY_XOR( x0, x1, x2, x3, subkeys, round ) \
+	x0 = SERPENT_XOR( x0, SERPENT_SET( subkeys[ ( 4 * ( round ) ) ] ) ); \
+	x1 = SERPENT_XOR( x1, SERPENT_SET( subkeys[ ( 4 * ( round ) ) + 1 ] ) ); \
+	x2 = SERPENT_XOR( x2, SERPENT_SET( subkeys[ ( 4 * ( round ) ) + 2 ] ) ); \
+	x3 = SERPENT_XOR( x3, SERPENT_SET( subkeys[ ( 4 * ( round ) ) + 3 ] ) );
+
+/* Applies the linear transformation
+ */
+#define SERPENT_LINEAR_TRANSFORMATION( x0, x1, x2, x3 ) \
+	x0 = SERPENT_ROTATE_LEFT( x0, 13 ); \
+	x2 = SERPENT_ROTATE_LEFT( x2, 3 ); \
+	x1 = SERPENT_XOR( x1, SERPENT_XOR( x0, x2 ) ); \
+	x3 = SERPENT_XOR( x3, SERPENT_XOR( x2, SERPENT_SHIFT_LEFT( x0, 3 ) ) ); \
+	x1 = SERPENT_ROTATE_LEFT( x1, 1 ); \
+	x3 = SERPENT_ROTATE_LEFT( x3, 7 ); \
+	x0 = SERPENT_XOR( x0, SERPENT_XOR( x1, x3 ) ); \
+	x2 = SERPENT_XOR( x2, SERPENT_XOR( x3, SERPENT_SHIFT_LEFT( x1, 7 ) ) ); \
+	x0 = SERPENT_ROTATE_LEFT( x0, 5 ); \
+	x2 = SERPENT_ROTATE_LEFT( x2, 22 );
+
+/* Applies the inverse linear transformation
+ */
+#define SERPENT_INVERSE_LINEAR_TRANSFORMATION( x0, x1, x2, x3 ) \
+	x2 = SERPENT_ROTATE_LEFT( x2, 10 ); \
+	x0 = SERPENT_ROTATE_LEFT( x0, 27 ); \
+	x2 = SERPENT_XOR( x2, SERPENT_XOR( x3, SERPENT_SHIFT_LEFT( x1, 7 ) ) ); \
+	x0 = SERPENT_XOR( x0, SERPENT_XOR( x1, x3 ) ); \
+	x3 = SERPENT_ROTATE_LEFT( x3, 25 ); \
+	x1 = SERPENT_ROTATE_LEFT( x1, 31 ); \
+	x3 = SERPENT_XOR( x3, SERPENT_XOR( x2, SERPENT_SHIFT_LEFT( x0, 3 ) ) ); \
+	x1 = SERPENT_XOR( x1, SERPENT_XOR( x0, x2 ) ); \
+	x2 = SERPENT_ROTATE_LEFT( x2, 29 ); \
+	x0 = SERPENT_ROTATE_LEFT( x0, 19 );
+
+/* Applies an encryption round
+ */
+#define SERPENT_ENCRYPT_ROUND( x0, x1, x2, x3, subkeys, round, sbox_index ) \
+	SERPENT_KEY_XOR( x0, x1, x2, x3, subkeys, round ) \
+	SERPENT_SBOX ## sbox_index( x0, x1, x2, x3 ); \
+	SERPENT_LINEAR_TRANSFORMATION( x0, x1, x2, x3 )
+
+/* Applies a decryption round
+ */
+#define SERPENT_DECRYPT_ROUND( x0, x1, x2, x3, subkeys, round, sbox_index ) \
+	SERPENT_INVERSE_LINEAR_TRANSFORMATION( x0, x1, x2, x3 ) \
+	SERPENT_INVERSE_SBOX ## sbox_index( x0, x1, x2, x3 ); \
+	SERPENT_KEY_XOR( x0, x1, x2, x3, subkeys, round )
+
+/* Encrypts the blocks in x0 to x3
+ * The 32 rounds are applied in 4 passes of the 8 S-boxes where the linear
+ * transformation of the last round is replaced by the final subkey
+ */
+#define SERPENT_ENCRYPT( x0, x1, x2, x3, subkeys ) \
+	do \
+	{ \
+		int serpent_round = 0; \
+\
+		for( serpent_round = 0; \
+		     serpent_round < 32; \
+		     serpent_round += 8 ) \
+		{ \
+			SERPENT_ENCRYPT_ROUND( x0, x1, x2, x3, subkeys, serpent_round, 0 ) \
+			SERPENT_ENCRYPT_ROUND( x0, x1, x2, x3, subkeys, serpent_round + 1, 1 ) \
+			SERPENT_ENCRYPT_ROUND( x0, x1, x2, x3, subkeys, serpent_round + 2, 2 ) \
+			SERPENT_ENCRYPT_ROUND( x0, x1, x2, x3, subkeys, serpent_round + 3, 3 ) \
+			SERPENT_ENCRYPT_ROUND( x0, x1, x2, x3, subkeys, serpent_round + 4, 4 ) \
+			SERPENT_ENCRYPT_ROUND( x0, x1, x2, x3, subkeys, serpent_round + 5, 5 ) \
+			SERPENT_ENCRYPT_ROUND( x0, x1, x2, x3, subkeys, serpent_round + 6, 6 ) \
+			SERPENT_KEY_XOR( x0, x1, x2, x3, subkeys, serpent_round + 7 ) \
+			SERPENT_SBOX7( x0, x1, x2, x3 ); \
+\
+			if( serpent_round < 24 ) \
+			{ \
+				SERPENT_LINEAR_TRANSFORMATION( x0, x1, x2, x3 ) \
+			} \
+		} \
+		SERPENT_KEY_XOR( x0, x1, x2, x3, subkeys, 32 ) \
+	} \
+	while( 0 )
+
+/* Decrypts the blocks in x0 to x3
+ */
+#define SERPENT_DECRYPT( x0, x1, x2, x3, subkeys ) \
+	do \
+	{ \
+		int serpent_round = 0; \
+\
+		SERPENT_KEY_XOR( x0, x1, x2, x3, subkeys, 32 ) \
+\
+		for( serpent_round = 24; \
+		     serpent_round >= 0; \
+		     serpent_round -= 8 ) \
+		{ \
+			if( serpent_round < 24 ) \
+			{ \
+				SERPENT_INVERSE_LINEAR_TRANSFORMATION( x0, x1, x2, x3 ) \
+			} \
+			SERPENT_INVERSE_SBOX7( x0, x1, x2, x3 ); \
+			SERPENT_KEY_XOR( x0, x1, x2, x3, subkeys, serpent_round + 7 ) \
+			SERPENT_DECRYPT_ROUND( x0, x1, x2, x3, subkeys, serpent_round + 6, 6 ) \
+			SERPENT_DECRYPT_ROUND( x0, x1, x2, x3, subkeys, serpent_round + 5, 5 ) \
+			SERPENT_DECRYPT_ROUND( x0, x1, x2, x3, subkeys, serpent_round + 4, 4 ) \
+			SERPENT_DECRYPT_ROUND( x0, x1, x2, x3, subkeys, serpent_round + 3, 3 ) \
+			SERPENT_DECRYPT_ROUND( x0, x1, x2, x3, subkeys, serpent_round + 2, 2 ) \
+			SERPENT_DECRYPT_ROUND( x0, x1, x2, x3, subkeys, serpent_round + 1, 1 ) \
+			SERPENT_DECRYPT_ROUND( x0, x1, x2, x3, subkeys, serpent_round, 0 ) \
+		} \
+	} \
+	while( 0 )
+
+/* The 32-bit operations
+ */
+#define SERPENT_WORD			uint32_t
+#define SERPENT_AND( a, b )		( ( a ) & ( b ) )
+#define SERPENT_NOT( a )		( ~( a ) )
+#define SERPENT_XOR( a, b )		( ( a ) ^ ( b ) )
+#define SERPENT_ROTATE_LEFT( a, n )	( ( ( a ) << ( n ) ) | ( ( a ) >> ( 32 - ( n ) ) ) )
+#define SERPENT_SHIFT_LEFT( a, n )	( ( a ) << ( n ) )
+#define SERPENT_SET( a )		( a )
+
+/* Creates a context
+ * Make sure the value context is referencing, is set to NULL
+ * Returns 1 if successful or -1 on error
+ */
+int serpent_context_initialize(
+     serpent_context_t **context,
+     libcerror_error_t **error )
+{
+	static char *function = "serpent_context_initialize";
+
+	if( context == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid context.",
+		 function );
+
+		return( -1 );
+	}
+	if( *context != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid context value already set.",
+		 function );
+
+		return( -1 );
+	}
+	*context = memory_allocate_structure(
+	            serpent_context_t );
+
+	if( *context == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create context.",
+		 function );
+
+		return( -1 );
+	}
+	if( memory_set(
+	     *context,
+	     0,
+	     sizeof( serpent_context_t ) ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear context.",
+		 function );
+
+		memory_free(
+		 *context );
+
+		*context = NULL;
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Frees a context
+ * Returns 1 if successful or -1 on error
+ */
+int serpent_context_free(
+     serpent_context_t **context,
+     libcerror_error_t **error )
+{
+	static char *function = "serpent_context_free";
+	int result            = 1;
+
+	if( context == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid context.",
+		 function );
+
+		return( -1 );
+	}
+	if( *context != NULL )
+	{
+		if( memory_set(
+		     *context,
+		     0,
+		     sizeof( serpent_context_t ) ) == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+			 "%s: unable to clear context.",
+			 function );
+
+			result = -1;
+		}
+		memory_free(
+		 *context );
+
+		*context = NULL;
+	}
+	return( result );
+}
+
+/* Sets the key
+ * The key bit size must be 128, 192 or 256, a key shorter than 256 is
+ * padded with a single 1 bit followed by 0 bits
+ * Returns 1 if successful or -1 on error
+ */
+int serpent_context_set_key(
+     serpent_context_t *context,
+     const uint8_t *key,
+     size_t key_bit_size,
+     libcerror_error_t **error )
+{
+	uint8_t padded_key[ 32 ];
+	uint32_t prekeys[ 8 + SERPENT_NUMBER_OF_SUBKEYS ];
+
+	static char *function = "serpent_context_set_key";
+	size_t key_size       = 0;
+	uint32_t value_32bit  = 0;
+	uint32_t x0           = 0;
+	uint32_t x1           = 0;
+	uint32_t x2           = 0;
+	uint32_t x3           = 0;
+	int prekey_index      = 0;
+	int subkey_index      = 0;
+	int result            = 1;
+
+	if( context == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid context.",
+		 function );
+
+		return( -1 );
+	}
+	if( key == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid key.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( key_bit_size != 128 )
+	 && ( key_bit_size != 192 )
+	 && ( key_bit_size != 256 ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_UNSUPPORTED_VALUE,
+		 "%s: unsupported key bit size.",
+		 function );
+
+		return( -1 );
+	}
+	key_size = key_bit_size / 8;
+
+	if( memory_set(
+	     padded_key,
+	     0,
+	     32 ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear padded key.",
+		 function );
+
+		return( -1 );
+	}
+	if( memory_copy(
+	     padded_key,
+	     key,
+	     key_size ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+		 "%s: unable to copy key.",
+		 function );
+
+		result = -1;
+
+		goto on_error;
+	}
+	if( key_size < 32 )
+	{
+		padded_key[ key_size ] = 0x01;
+	}
+	for( prekey_index = 0;
+	     prekey_index < 8;
+	     prekey_index++ )
+	{
+		byte_stream_copy_to_uint32_little_endian(
+		 &( padded_key[ prekey_index * 4 ] ),
+		 prekeys[ prekey_index ] );
+	}
+	for( prekey_index = 8;
+	     prekey_index < ( 8 + SERPENT_NUMBER_OF_SUBKEYS );
+	     prekey_index++ )
+	{
+		value_32bit = prekeys[ prekey_index - 8 ]
+		            ^ prekeys[ prekey_index - 5 ]
+		            ^ prekeys[ prekey_index - 3 ]
+		            ^ prekeys[ prekey_index - 1 ]
+		            ^ SERPENT_KEY_SCHEDULE_PHI
+		            ^ (uint32_t) ( prekey_index - 8 );
+
+		prekeys[ prekey_index ] = SERPENT_ROTATE_LEFT( value_32bit, 11 );
+	}
+	/* The subkey of round i is calculated with S-box ( 3 - i ) modulus 8
+	 * from the prekeys
+	 */
+	for( subkey_index = 0;
+	     subkey_index < SERPENT_NUMBER_OF_SUBKEYS;
+	     subkey_index += 4 )
+	{
+		x0 = prekeys[ 8 + subkey_index ];
+		x1 = prekeys[ 8 + subkey_index + 1 ];
+		x2 = prekeys[ 8 + subkey_index + 2 ];
+		x3 = prekeys[ 8 + subkey_index + 3 ];
+
+		switch( ( 3 - ( subkey_index / 4 ) ) & 7 )
+		{
+			case 0:
+				SERPENT_SBOX0( x0, x1, x2, x3 );
+				break;
+
+			case 1:
+				SERPENT_SBOX1( x0, x1, x2, x3 );
+				break;
+
+			case 2:
+				SERPENT_SBOX2( x0, x1, x2, x3 );
+				break;
+
+			case 3:
+				SERPENT_SBOX3( x0, x1, x2, x3 );
+				break;
+
+			case 4:
+				SERPENT_SBOX4( x0, x1, x2, x3 );
+				break;
+
+			case 5:
+				SERPENT_SBOX5( x0, x1, x2, x3 );
+				break;
+
+			case 6:
+				SERPENT_SBOX6( x0, x1, x2, x3 );
+				break;
+
+			case 7:
+				SERPENT_SBOX7( x0, x1, x2, x3 );
+				break;
+		}
+		context->subkeys[ subkey_index ]     = x0;
+		context->subkeys[ subkey_index + 1 ] = x1;
+		context->subkeys[ subkey_index + 2 ] = x2;
+		context->subkeys[ subkey_index + 3 ] = x3;
+	}
+on_error:
+	memory_set(
+	 padded_key,
+	 0,
+	 32 );
+
+	memory_set(
+	 prekeys,
+	 0,
+	 sizeof( uint32_t ) * ( 8 + SERPENT_NUMBER_OF_SUBKEYS ) );
+
+	return( result );
+}
+
+/* De- or encrypts blocks of data using the 32-bit implementation
+ * The size must be a multiple of 16
+ */
+static void serpent_crypt_blocks_32bit(
+             const uint32_t *subkeys,
+             int mode,
+             const uint8_t *input_data,
+             uint8_t *output_data,
+             size_t size )
+{
+	size_t data_offset = 0;
+	uint32_t x0        = 0;
+	uint32_t x1        = 0;
+	uint32_t x2        = 0;
+	uint32_t x3        = 0;
+
+	for( data_offset = 0;
+	     data_offset < size;
+	     data_offset += SERPENT_BLOCK_SIZE )
+	{
+		byte_stream_copy_to_uint32_little_endian(
+		 &( input_data[ data_offset ] ),
+		 x0 );
+		byte_stream_copy_to_uint32_little_endian(
+		 &( input_data[ data_offset + 4 ] ),
+		 x1 );
+		byte_stream_copy_to_uint32_little_endian(
+		 &( input_data[ data_offset + 8 ] ),
+		 x2 );
+		byte_stream_copy_to_uint32_little_endian(
+		 &( input_data[ data_offset + 12 ] ),
+		 x3 );
+
+		if( mode == SERPENT_CRYPT_MODE_ENCRYPT )
+		{
+			SERPENT_ENCRYPT( x0, x1, x2, x3, subkeys );
+		}
+		else
+		{
+			SERPENT_DECRYPT( x0, x1, x2, x3, subkeys );
+		}
+		byte_stream_copy_from_uint32_little_endian(
+		 &( output_data[ data_offset ] ),
+		 x0 );
+		byte_stream_copy_from_uint32_little_endian(
+		 &( output_data[ data_offset + 4 ] ),
+		 x1 );
+		byte_stream_copy_from_uint32_little_endian(
+		 &( output_data[ data_offset + 8 ] ),
+		 x2 );
+		byte_stream_copy_from_uint32_little_endian(
+		 &( output_data[ data_offset + 12 ] ),
+		 x3 );
+	}
+}
+
+#undef SERPENT_WORD
+#undef SERPENT_AND
+#undef SERPENT_NOT
+#undef SERPENT_XOR
+#undef SERPENT_ROTATE_LEFT
+#undef SERPENT_SHIFT_LEFT
+#undef SERPENT_SET
+
+#if defined( HAVE_CPU_FEATURES_X86 )
+
+/* Transposes the 4 x 4 32-bit values in r0 to r3, per 128-bit lane,
+ * which converts 4 blocks into the 4 32-bit words of the blocks and back
+ */
+#define SERPENT_TRANSPOSE_SSE2( r0, r1, r2, r3 ) \
+	do \
+	{ \
+		__m128i t0 = _mm_unpacklo_epi32( r0, r1 ); \
+		__m128i t1 = _mm_unpacklo_epi32( r2, r3 ); \
+		__m128i t2 = _mm_unpackhi_epi32( r0, r1 ); \
+		__m128i t3 = _mm_unpackhi_epi32( r2, r3 ); \
+\
+		r0 = _mm_unpacklo_epi64( t0, t1 ); \
+		r1 = _mm_unpackhi_epi64( t0, t1 ); \
+		r2 = _mm_unpacklo_epi64( t2, t3 ); \
+		r3 = _mm_unpackhi_epi64( t2, t3 ); \
+	} \
+	while( 0 )
+
+#define SERPENT_TRANSPOSE_AVX2( r0, r1, r2, r3 ) \
+	do \
+	{ \
+		__m256i t0 = _mm256_unpacklo_epi32( r0, r1 ); \
+		__m256i t1 = _mm256_unpacklo_epi32( r2, r3 ); \
+		__m256i t2 = _mm256_unpackhi_epi32( r0, r1 ); \
+		__m256i t3 = _mm256_unpackhi_epi32( r2, r3 ); \
+\
+		r0 = _mm256_unpacklo_epi64( t0, t1 ); \
+		r1 = _mm256_unpackhi_epi64( t0, t1 ); \
+		r2 = _mm256_unpacklo_epi64( t2, t3 ); \
+		r3 = _mm256_unpackhi_epi64( t2, t3 ); \
+	} \
+	while( 0 )
+
+/* The SSE2 operations
+ */
+#define SERPENT_WORD			__m128i
+#define SERPENT_AND( a, b )		_mm_and_si128( a, b )
+#define SERPENT_NOT( a )		_mm_xor_si128( a, _mm_set1_epi32( -1 ) )
+#define SERPENT_XOR( a, b )		_mm_xor_si128( a, b )
+#define SERPENT_ROTATE_LEFT( a, n )	_mm_or_si128( _mm_slli_epi32( a, n ), _mm_srli_epi32( a, 32 - ( n ) ) )
+#define SERPENT_SHIFT_LEFT( a, n )	_mm_slli_epi32( a, n )
+#define SERPENT_SET( a )		_mm_set1_epi32( (int) ( a ) )
+
+/* De- or encrypts blocks of data using SSE2, 4 blocks at a time
+ * The size must be a multiple of 64
+ */
+CPU_FEATURES_TARGET( "sse2" )
+static void serpent_crypt_blocks_sse2(
+             const uint32_t *subkeys,
+             int mode,
+             const uint8_t *input_data,
+             uint8_t *output_data,
+             size_t size )
+{
+	__m128i x0;
+	__m128i x1;
+	__m128i x2;
+	__m128i x3;
+
+	size_t data_offset = 0;
+
+	for( data_offset = 0;
+	     data_offset < size;
+	     data_offset += 4 * SERPENT_BLOCK_SIZE )
+	{
+		x0 = _mm_loadu_si128( (const __m128i *) &( input_data[ data_offset ] ) );
+		x1 = _mm_loadu_si128( (const __m128i *) &( input_data[ data_offset + 16 ] ) );
+		x2 = _mm_loadu_si128( (const __m128i *) &( input_data[ data_offset + 32 ] ) );
+		x3 = _mm_loadu_si128( (const __m128i *) &( input_data[ data_offset + 48 ] ) );
+
+		SERPENT_TRANSPOSE_SSE2( x0, x1, x2, x3 );
+
+		if( mode == SERPENT_CRYPT_MODE_ENCRYPT )
+		{
+			SERPENT_ENCRYPT( x0, x1, x2, x3, subkeys );
+		}
+		else
+		{
+			SERPENT_DECRYPT( x0, x1, x2, x3, subkeys );
+		}
+		SERPENT_TRANSPOSE_SSE2( x0, x1, x2, x3 );
+
+		_mm_storeu_si128( (__m128i *) &( output_data[ data_offset ] ), x0 );
+		_mm_storeu_si128( (__m128i *) &( output_data[ data_offset + 16 ] ), x1 );
+		_mm_storeu_si128( (__m128i *) &( output_data[ data_offset + 32 ] ), x2 );
+		_mm_storeu_si128( (__m128i *) &( output_data[ data_offset + 48 ] ), x3 );
+	}
+}
+
+#undef SERPENT_WORD
+#undef SERPENT_AND
+#undef SERPENT_NOT
+#undef SERPENT_XOR
+#undef SERPENT_ROTATE_LEFT
+#undef SERPENT_SHIFT_LEFT
+#undef SERPENT_SET
+
+/* The AVX2 operations
+ */
+#define SERPENT_WORD			__m256i
+#define SERPENT_AND( a, b )		_mm256_and_si256( a, b )
+#define SERPENT_NOT( a )		_mm256_xor_si256( a, _mm256_set1_epi32( -1 ) )
+#define SERPENT_XOR( a, b )		_mm256_xor_si256( a, b )
+#define SERPENT_ROTATE_LEFT( a, n )	_mm256_or_si256( _mm256_slli_epi32( a, n ), _mm256_srli_epi32( a, 32 - ( n ) ) )
+#define SERPENT_SHIFT_LEFT( a, n )	_mm256_slli_epi32( a, n )
+#define SERPENT_SET( a )		_mm256_set1_epi32( (int) ( a ) )
+
+/* De- or encrypts blocks of data using AVX2, 8 blocks at a time
+ * The 128-bit lanes contain blocks 0 to 3 and 4 to 7 respectively
+ * The size must be a multiple of 128
+ */
+CPU_FEATURES_TARGET( "avx2" )
+static void serpent_crypt_blocks_avx2(
+             const uint32_t *subkeys,
+             int mode,
+             const uint8_t *input_data,
+             uint8_t *output_data,
+             size_t size )
+{
+	__m256i blocks01;
+	__m256i blocks23;
+	__m256i blocks45;
+	__m256i blocks67;
+	__m256i x0;
+	__m256i x1;
+	__m256i x2;
+	__m256i x3;
+
+	size_t data_offset = 0;
+
+	for( data_offset = 0;
+	     data_offset < size;
+	     data_offset += 8 * SERPENT_BLOCK_SIZE )
+	{
+		blocks01 = _mm256_loadu_si256( (const __m256i *) &( input_data[ data_offset ] ) );
+		blocks23 = _mm256_loadu_si256( (const __m256i *) &( input_data[ data_offset + 32 ] ) );
+		blocks45 = _mm256_loadu_si256( (const __m256i *) &( input_data[ data_offset + 64 ] ) );
+		blocks67 = _mm256_loadu_si256( (const __m256i *) &( input_data[ data_offset + 96 ] ) );
+
+		x0 = _mm256_permute2x128_si256( blocks01, blocks45, 0x20 );
+		x1 = _mm256_permute2x128_si256( blocks01, blocks45, 0x31 );
+		x2 = _mm256_permute2x128_si256( blocks23, blocks67, 0x20 );
+		x3 = _mm256_permute2x128_si256( blocks23, blocks67, 0x31 );
+
+		SERPENT_TRANSPOSE_AVX2( x0, x1, x2, x3 );
+
+		if( mode == SERPENT_CRYPT_MODE_ENCRYPT )
+		{
+			SERPENT_ENCRYPT( x0, x1, x2, x3, subkeys );
+		}
+		else
+		{
+			SERPENT_DECRYPT( x0, x1, x2, x3, subkeys );
+		}
+		SERPENT_TRANSPOSE_AVX2( x0, x1, x2, x3 );
+
+		blocks01 = _mm256_permute2x128_si256( x0, x1, 0x20 );
+		blocks45 = _mm256_permute2x128_si256( x0, x1, 0x31 );
+		blocks23 = _mm256_permute2x128_si256( x2, x3, 0x20 );
+		blocks67 = _mm256_permute2x128_si256( x2, x3, 0x31 );
+
+		_mm256_storeu_si256( (__m256i *) &( output_data[ data_offset ] ), blocks01 );
+		_mm256_storeu_si256( (__m256i *) &( output_data[ data_offset + 32 ] ), blocks23 );
+		_mm256_storeu_si256( (__m256i *) &( output_data[ data_offset + 64 ] ), blocks45 );
+		_mm256_storeu_si256( (__m256i *) &( output_data[ data_offset + 96 ] ), blocks67 );
+	}
+}
+
+#undef SERPENT_WORD
+#undef SERPENT_AND
+#undef SERPENT_NOT
+#undef SERPENT_XOR
+#undef SERPENT_ROTATE_LEFT
+#undef SERPENT_SHIFT_LEFT
+#undef SERPENT_SET
+
+#elif defined( HAVE_CPU_FEATURES_ARM64 )
+
+/* The NEON operations
+ */
+#define SERPENT_WORD			uint32x4_t
+#define SERPENT_AND( a, b )		vandq_u32( a, b )
+#define SERPENT_NOT( a )		vmvnq_u32( a )
+#define SERPENT_XOR( a, b )		veorq_u32( a, b )
+#define SERPENT_ROTATE_LEFT( a, n )	vsliq_n_u32( vshrq_n_u32( a, 32 - ( n ) ), a, n )
+#define SERPENT_SHIFT_LEFT( a, n )	vshlq_n_u32( a, n )
+#define SERPENT_SET( a )		vdupq_n_u32( a )
+
+/* De- or encrypts blocks of data using NEON, 4 blocks at a time
+ * The size must be a multiple of 64
+ */
+static void serpent_crypt_blocks_neon(
+             const uint32_t *subkeys,
+             int mode,
+             const uint8_t *input_data,
+             uint8_t *output_data,
+             size_t size )
+{
+	uint32x4x4_t blocks;
+	uint32x4_t x0;
+	uint32x4_t x1;
+	uint32x4_t x2;
+	uint32x4_t x3;
+
+	size_t data_offset = 0;
+
+	for( data_offset = 0;
+	     data_offset < size;
+	     data_offset += 4 * SERPENT_BLOCK_SIZE )
+	{
+		/* Loading interleaved 32-bit values converts 4 blocks
+		 * into the 4 32-bit words of the blocks
+		 */
+		blocks = vld4q_u32( (const uint32_t *) &( input_data[ data_offset ] ) );
+
+		x0 = blocks.val[ 0 ];
+		x1 = blocks.val[ 1 ];
+		x2 = blocks.val[ 2 ];
+		x3 = blocks.val[ 3 ];
+
+		if( mode == SERPENT_CRYPT_MODE_ENCRYPT )
+		{
+			SERPENT_ENCRYPT( x0, x1, x2, x3, subkeys );
+		}
+		else
+		{
+			SERPENT_DECRYPT( x0, x1, x2, x3, subkeys );
+		}
+		blocks.val[ 0 ] = x0;
+		blocks.val[ 1 ] = x1;
+		blocks.val[ 2 ] = x2;
+		blocks.val[ 3 ] = x3;
+
+		vst4q_u32( (uint32_t *) &( output_data[ data_offset ] ), blocks );
+	}
+}
+
+#undef SERPENT_WORD
+#undef SERPENT_AND
+#undef SERPENT_NOT
+#undef SERPENT_XOR
+#undef SERPENT_ROTATE_LEFT
+#undef SERPENT_SHIFT_LEFT
+#undef SERPENT_SET
+
+#endif /* defined( HAVE_CPU_FEATURES_X86 ) */
+
+/* De- or encrypts blocks of data, multiple blocks at a time using SIMD
+ * if supported by the CPU
+ * The size must be a multiple of 16
+ */
+static void serpent_crypt_blocks_simd(
+             const uint32_t *subkeys,
+             int mode,
+             const uint8_t *input_data,
+             uint8_t *output_data,
+             size_t size )
+{
+	size_t block_size  = 0;
+	size_t data_offset = 0;
+
+#if defined( HAVE_CPU_FEATURES_X86 )
+	if( ( size >= 128 )
+	 && ( cpu_features_has(
+	       CPU_FEATURE_FLAG_AVX2 ) != 0 ) )
+	{
+		block_size = size & ~( (size_t) 127 );
+
+		serpent_crypt_blocks_avx2(
+		 subkeys,
+		 mode,
+		 input_data,
+		 output_data,
+		 block_size );
+
+		data_offset = block_size;
+	}
+	if( ( ( size - data_offset ) >= 64 )
+	 && ( cpu_features_has(
+	       CPU_FEATURE_FLAG_SSE2 ) != 0 ) )
+	{
+		block_size = ( size - data_offset ) & ~( (size_t) 63 );
+
+		serpent_crypt_blocks_sse2(
+		 subkeys,
+		 mode,
+		 &( input_data[ data_offset ] ),
+		 &( output_data[ data_offset ] ),
+		 block_size );
+
+		data_offset += block_size;
+	}
+#elif defined( HAVE_CPU_FEATURES_ARM64 )
+	if( ( size >= 64 )
+	 && ( cpu_features_has(
+	       CPU_FEATURE_FLAG_NEON ) != 0 ) )
+	{
+		block_size = size & ~( (size_t) 63 );
+
+		serpent_crypt_blocks_neon(
+		 subkeys,
+		 mode,
+		 input_data,
+		 output_data,
+		 block_size );
+
+		data_offset = block_size;
+	}
+#endif
+	/* De- or encrypt the remaining blocks using the 32-bit implementation
+	 */
+	serpent_crypt_blocks_32bit(
+	 subkeys,
+	 mode,
+	 &( input_data[ data_offset ] ),
+	 &( output_data[ data_offset ] ),
+	 size - data_offset );
+}
+
+/* Exclusive ORs data with the tweaks
+ * The size must be a multiple of 16
+ */
+static void serpent_crypt_xor_tweaks(
+             const uint8_t *input_data,
+             const uint8_t *tweaks,
+             uint8_t *output_data,
+             size_t size )
+{
+	size_t data_offset   = 0;
+	uint64_t value_64bit = 0;
+	uint64_t tweak_64bit = 0;
+
+	for( data_offset = 0;
+	     data_offset < size;
+	     data_offset += 8 )
+	{
+		byte_stream_copy_to_uint64_little_endian(
+		 &( input_data[ data_offset ] ),
+		 value_64bit );
+		byte_stream_copy_to_uint64_little_endian(
+		 &( tweaks[ data_offset ] ),
+		 tweak_64bit );
+		byte_stream_copy_from_uint64_little_endian(
+		 &( output_data[ data_offset ] ),
+		 value_64bit ^ tweak_64bit );
+	}
+}
+
+/* Checks the arguments of the crypt functions
+ * Returns 1 if successful or -1 on error
+ */
+static int serpent_crypt_check_arguments(
+            serpent_context_t *context,
+            int mode,
+            const uint8_t *input_data,
+            size_t input_data_size,
+            uint8_t *output_data,
+            size_t output_data_size,
+            const char *function,
+            libcerror_error_t **error )
+{
+	if( context == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid context.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( mode != SERPENT_CRYPT_MODE_DECRYPT )
+	 && ( mode != SERPENT_CRYPT_MODE_ENCRYPT ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_UNSUPPORTED_VALUE,
+		 "%s: unsupported mode.",
+		 function );
+
+		return( -1 );
+	}
+	if( input_data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid input data.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( input_data_size > (size_t) SSIZE_MAX )
+	 || ( ( input_data_size % SERPENT_BLOCK_SIZE ) != 0 ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid input data size value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( output_data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid output data.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( output_data_size > (size_t) SSIZE_MAX )
+	 || ( output_data_size < input_data_size ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid output data size value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* De- or encrypts data using electronic codebook (ECB) mode, a block at a time
+ * The input data size must be a multiple of 16
+ * Returns 1 if successful or -1 on error
+ */
+int serpent_crypt_ecb_basic(
+     serpent_context_t *context,
+     int mode,
+     const uint8_t *input_data,
+     size_t input_data_size,
+     uint8_t *output_data,
+     size_t output_data_size,
+     libcerror_error_t **error )
+{
+	static char *function = "serpent_crypt_ecb_basic";
+
+	if( serpent_crypt_check_arguments(
+	     context,
+	     mode,
+	     input_data,
+	     input_data_size,
+	     output_data,
+	     output_data_size,
+	     function,
+	     error ) != 1 )
+	{
+		return( -1 );
+	}
+	serpent_crypt_blocks_32bit(
+	 context->subkeys,
+	 mode,
+	 input_data,
+	 output_data,
+	 input_data_size );
+
+	return( 1 );
+}
+
+/* De- or encrypts data using electronic codebook (ECB) mode, multiple blocks
+ * at a time using SIMD if supported by the CPU
+ * The input data size must be a multiple of 16
+ * Returns 1 if successful or -1 on error
+ */
+int serpent_crypt_ecb_simd(
+     serpent_context_t *context,
+     int mode,
+     const uint8_t *input_data,
+     size_t input_data_size,
+     uint8_t *output_data,
+     size_t output_data_size,
+     libcerror_error_t **error )
+{
+	static char *function = "serpent_crypt_ecb_simd";
+
+	if( serpent_crypt_check_arguments(
+	     context,
+	     mode,
+	     input_data,
+	     input_data_size,
+	     output_data,
+	     output_data_size,
+	     function,
+	     error ) != 1 )
+	{
+		return( -1 );
+	}
+	serpent_crypt_blocks_simd(
+	 context->subkeys,
+	 mode,
+	 input_data,
+	 output_data,
+	 input_data_size );
+
+	return( 1 );
+}
+
+/* De- or encrypts data using XEX-based tweaked-codebook mode with ciphertext
+ * stealing (XTS)
+ * The data is de- or encrypted per sector, where the tweak of a sector is its
+ * sector number, as a 128-bit little-endian value, encrypted with the tweak key.
+ * The tweak of the next block in a sector is the tweak of the previous block
+ * multiplied by x in GF(2^128). Ciphertext stealing is not supported, hence
+ * the sector size must be a multiple of 16.
+ * Returns 1 if successful or -1 on error
+ */
+static int serpent_crypt_xts(
+            serpent_context_t *context,
+            serpent_context_t *tweak_context,
+            int mode,
+            uint64_t sector_number,
+            size_t sector_size,
+            const uint8_t *input_data,
+            size_t input_data_size,
+            uint8_t *output_data,
+            size_t output_data_size,
+            uint8_t use_simd,
+            const char *function,
+            libcerror_error_t **error )
+{
+	uint8_t tweaks[ SERPENT_XTS_NUMBER_OF_TWEAKS * SERPENT_BLOCK_SIZE ];
+
+	size_t block_offset  = 0;
+	size_t data_offset   = 0;
+	size_t sector_offset = 0;
+	size_t tweak_offset  = 0;
+	size_t tweaks_size   = 0;
+	uint64_t tweak_carry = 0;
+	uint64_t tweak_high  = 0;
+	uint64_t tweak_low   = 0;
+
+	if( serpent_crypt_check_arguments(
+	     context,
+	     mode,
+	     input_data,
+	     input_data_size,
+	     output_data,
+	     output_data_size,
+	     function,
+	     error ) != 1 )
+	{
+		return( -1 );
+	}
+	if( tweak_context == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid tweak context.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( sector_size == 0 )
+	 || ( sector_size > (size_t) SSIZE_MAX )
+	 || ( ( sector_size % SERPENT_BLOCK_SIZE ) != 0 ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid sector size value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( input_data_size % sector_size ) != 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid input data size value not a multiple of the sector size.",
+		 function );
+
+		return( -1 );
+	}
+	for( sector_offset = 0;
+	     sector_offset < input_data_size;
+	     sector_offset += sector_size )
+	{
+		byte_stream_copy_from_uint64_little_endian(
+		 &( tweaks[ 0 ] ),
+		 sector_number );
+		memory_set(
+		 &( tweaks[ 8 ] ),
+		 0,
+		 8 );
+
+		serpent_crypt_blocks_32bit(
+		 tweak_context->subkeys,
+		 SERPENT_CRYPT_MODE_ENCRYPT,
+		 tweaks,
+		 tweaks,
+		 SERPENT_BLOCK_SIZE );
+
+		byte_stream_copy_to_uint64_little_endian(
+		 &( tweaks[ 0 ] ),
+		 tweak_low );
+		byte_stream_copy_to_uint64_little_endian(
+		 &( tweaks[ 8 ] ),
+		 tweak_high );
+
+		/* The blocks are exclusive ORed with their tweak, de- or encrypted
+		 * at once and exclusive ORed with their tweak again
+		 */
+		for( block_offset = 0;
+		     block_offset < sector_size;
+		     block_offset += tweaks_size )
+		{
+			tweaks_size = sector_size - block_offset;
+
+			if( tweaks_size > sizeof( tweaks ) )
+			{
+				tweaks_size = sizeof( tweaks );
+			}
+			data_offset = sector_offset + block_offset;
+
+			for( tweak_offset = 0;
+			     tweak_offset < tweaks_size;
+			     tweak_offset += SERPENT_BLOCK_SIZE )
+			{
+				byte_stream_copy_from_uint64_little_endian(
+				 &( tweaks[ tweak_offset ] ),
+				 tweak_low );
+				byte_stream_copy_from_uint64_little_endian(
+				 &( tweaks[ tweak_offset + 8 ] ),
+				 tweak_high );
+
+				tweak_carry = tweak_high >> 63;
+				tweak_high  = ( tweak_high << 1 ) | ( tweak_low >> 63 );
+				tweak_low   = ( tweak_low << 1 ) ^ ( tweak_carry * SERPENT_XTS_GF_128_POLYNOMIAL );
+			}
+			serpent_crypt_xor_tweaks(
+			 &( input_data[ data_offset ] ),
+			 tweaks,
+			 &( output_data[ data_offset ] ),
+			 tweaks_size );
+
+			if( use_simd != 0 )
+			{
+				serpent_crypt_blocks_simd(
+				 context->subkeys,
+				 mode,
+				 &( output_data[ data_offset ] ),
+				 &( output_data[ data_offset ] ),
+				 tweaks_size );
+			}
+			else
+			{
+				serpent_crypt_blocks_32bit(
+				 context->subkeys,
+				 mode,
+				 &( output_data[ data_offset ] ),
+				 &( output_data[ data_offset ] ),
+				 tweaks_size );
+			}
+			serpent_crypt_xor_tweaks(
+			 &( output_data[ data_offset ] ),
+			 tweaks,
+			 &( output_data[ data_offset ] ),
+			 tweaks_size );
+		}
+		sector_number++;
+	}
+	memory_set(
+	 tweaks,
+	 0,
+	 sizeof( tweaks ) );
+
+	return( 1 );
+}
+
+/* De- or encrypts data using XTS mode, a block at a time
+ * The input data size must be a multiple of the sector size
+ * Returns 1 if successful or -1 on error
+ */
+int serpent_crypt_xts_basic(
+     serpent_context_t *context,
+     serpent_context_t *tweak_context,
+     int mode,
+     uint64_t sector_number,
+     size_t sector_size,
+     const uint8_t *input_data,
+     size_t input_data_size,
+     uint8_t *output_data,
+     size_t output_data_size,
+     libcerror_error_t **error )
+{
+	static char *function = "serpent_crypt_xts_basic";
+
+	return( serpent_crypt_xts(
+	         context,
+	         tweak_context,
+	         mode,
+	         sector_number,
+	         sector_size,
+	         input_data,
+	         input_data_size,
+	         output_data,
+	         output_data_size,
+	         0,
+	         function,
+	         error ) );
+}
+
+/* De- or encrypts data using XTS mode, multiple blocks of a sector at a time
+ * using SIMD if supported by the CPU
+ * The input data size must be a multiple of the sector size
+ * Returns 1 if successful or -1 on error
+ */
+int serpent_crypt_xts_simd(
+     serpent_context_t *context,
+     serpent_context_t *tweak_context,
+     int mode,
+     uint64_t sector_number,
+     size_t sector_size,
+     const uint8_t *input_data,
+     size_t input_data_size,
+     uint8_t *output_data,
+     size_t output_data_size,
+     libcerror_error_t **error )
+{
+	static char *function = "serpent_crypt_xts_simd";
+
+	return( serpent_crypt_xts(
+	         context,
+	         tweak_context,
+	         mode,
+	         sector_number,
+	         sector_size,
+	         input_data,
+	         input_data_size,
+	         output_data,
+	         output_data_size,
+	         1,
+	         function,
+	         error ) );
+}
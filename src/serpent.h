@@ -0,0 +1,120 @@
+/*
+ * Serpent functions
+ *
+ * Copyright (C) 2008-2019, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This software is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This software is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this software.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#if !defined( _SERPENT_H )
+#define _SERPENT_H
+
+#include <common.h>
+#include <types.h>
+
+#include "assorted_libcerror.h"
+
+#if defined( __cplusplus )
+extern "C" {
+#endif
+
+/* The size of a Serpent block
+ */
+#define SERPENT_BLOCK_SIZE		16
+
+/* The number of 32-bit subkeys, 4 per round and 4 for the final round
+ */
+#define SERPENT_NUMBER_OF_SUBKEYS	132
+
+/* The crypt modes
+ */
+enum SERPENT_CRYPT_MODES
+{
+	SERPENT_CRYPT_MODE_DECRYPT	= 0,
+	SERPENT_CRYPT_MODE_ENCRYPT	= 1
+};
+
+typedef struct serpent_context serpent_context_t;
+
+struct serpent_context
+{
+	/* The subkeys
+	 */
+	uint32_t subkeys[ SERPENT_NUMBER_OF_SUBKEYS ];
+};
+
+int serpent_context_initialize(
+     serpent_context_t **context,
+     libcerror_error_t **error );
+
+int serpent_context_free(
+     serpent_context_t **context,
+     libcerror_error_t **error );
+
+int serpent_context_set_key(
+     serpent_context_t *context,
+     const uint8_t *key,
+     size_t key_bit_size,
+     libcerror_error_t **error );
+
+int serpent_crypt_ecb_basic(
+     serpent_context_t *context,
+     int mode,
+     const uint8_t *input_data,
+     size_t input_data_size,
+     uint8_t *output_data,
+     size_t output_data_size,
+     libcerror_error_t **error );
+
+int serpent_crypt_ecb_simd(
+     serpent_context_t *context,
+     int mode,
+     const uint8_t *input_data,
+     size_t input_data_size,
+     uint8_t *output_data,
+     size_t output_data_size,
+     libcerror_error_t **error );
+
+int serpent_crypt_xts_basic(
+     serpent_context_t *context,
+     serpent_context_t *tweak_context,
+     int mode,
+     uint64_t sector_number,
+     size_t sector_size,
+     const uint8_t *input_data,
+     size_t input_data_size,
+     uint8_t *output_data,
+     size_t output_data_size,
+     libcerror_error_t **error );
+
+int serpent_crypt_xts_simd(
+     serpent_context_t *context,
+     serpent_context_t *tweak_context,
+     int mode,
+     uint64_t sector_number,
+     size_t sector_size,
+     const uint8_t *input_data,
+     size_t input_data_size,
+     uint8_t *output_data,
+     size_t output_data_size,
+     libcerror_error_t **error );
+
+#if defined( __cplusplus )
+}
+#endif
+
+#endif /* !defined( _SERPENT_H ) */
+
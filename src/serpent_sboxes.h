@@ -0,0 +1,895 @@
+/*
+ * Serpent bitsliced S-boxes
+ *
+ * Copyright (C) 2008-2019, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This software is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This software is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this software.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#if !defined( _SERPENT_SBOXES_H )
+#define _SERPENT_SBOXES_H
+
+/* The S-boxes are applied to 32 bits in parallel, where bit n of x0, x1, x2
+ * and x3 contain the input and output bits 0, 1, 2 and 3 of the n-th S-box
+ * application, hence a block is processed per 32-bit word, or per 32-bit
+ * lane of a SIMD register. Every output bit is calculated from its algebraic
+ * normal form, in which the products shared by the output bits are calculated
+ * once.
+ *
+ * The includer defines SERPENT_WORD as the type of x0 to x3 and
+ * SERPENT_AND, SERPENT_NOT and SERPENT_XOR as the operations on that type.
+ */
+
+/* S-box 0
+ */
+#define SERPENT_SBOX0( x0, x1, x2, x3 ) \
+	do \
+	{ \
+		SERPENT_WORD t1, t2, t3, t4, t5, t6, t7, t8; \
+		SERPENT_WORD t9, t10, t11, t12, t13, t14, t15, t16; \
+		SERPENT_WORD t17, t18, t19, t20, t21, t22, t23, t24; \
+		SERPENT_WORD t25, t26, t27, t28, t29, t30, t31, t32; \
+		SERPENT_WORD t33, t34; \
+\
+		t1 = SERPENT_AND( x0, x1 ); \
+		t2 = SERPENT_AND( x0, x2 ); \
+		t3 = SERPENT_AND( x1, x2 ); \
+		t4 = SERPENT_AND( x0, x3 ); \
+		t5 = SERPENT_AND( x1, x3 ); \
+		t6 = SERPENT_AND( t1, x2 ); \
+		t7 = SERPENT_AND( t2, x3 ); \
+		t8 = SERPENT_AND( t3, x3 ); \
+		t9 = SERPENT_XOR( x0, t1 ); \
+		t10 = SERPENT_XOR( t9, x2 ); \
+		t11 = SERPENT_XOR( t10, t2 ); \
+		t12 = SERPENT_XOR( t11, t3 ); \
+		t13 = SERPENT_XOR( t12, t6 ); \
+		t14 = SERPENT_XOR( t13, x3 ); \
+		t15 = SERPENT_XOR( t14, t7 ); \
+		t16 = SERPENT_XOR( t15, t8 ); \
+		t17 = SERPENT_NOT( t16 ); \
+		t18 = SERPENT_XOR( x0, t2 ); \
+		t19 = SERPENT_XOR( t18, t3 ); \
+		t20 = SERPENT_XOR( t19, t6 ); \
+		t21 = SERPENT_XOR( t20, t5 ); \
+		t22 = SERPENT_XOR( t21, t7 ); \
+		t23 = SERPENT_XOR( t22, t8 ); \
+		t24 = SERPENT_NOT( t23 ); \
+		t25 = SERPENT_XOR( x1, t1 ); \
+		t26 = SERPENT_XOR( t25, t2 ); \
+		t27 = SERPENT_XOR( t26, t6 ); \
+		t28 = SERPENT_XOR( t27, x3 ); \
+		t29 = SERPENT_XOR( t28, t5 ); \
+		t30 = SERPENT_XOR( t29, t8 ); \
+		t31 = SERPENT_XOR( x0, x1 ); \
+		t32 = SERPENT_XOR( t31, x2 ); \
+		t33 = SERPENT_XOR( t32, x3 ); \
+		t34 = SERPENT_XOR( t33, t4 ); \
+\
+		x0 = t17; \
+		x1 = t24; \
+		x2 = t30; \
+		x3 = t34; \
+	} \
+	while( 0 )
+
+/* S-box 1
+ */
+#define SERPENT_SBOX1( x0, x1, x2, x3 ) \
+	do \
+	{ \
+		SERPENT_WORD t1, t2, t3, t4, t5, t6, t7, t8; \
+		SERPENT_WORD t9, t10, t11, t12, t13, t14, t15, t16; \
+		SERPENT_WORD t17, t18, t19, t20, t21, t22, t23, t24; \
+		SERPENT_WORD t25, t26, t27, t28, t29, t30, t31, t32; \
+		SERPENT_WORD t33, t34, t35, t36; \
+\
+		t1 = SERPENT_AND( x0, x1 ); \
+		t2 = SERPENT_AND( x0, x2 ); \
+		t3 = SERPENT_AND( x1, x2 ); \
+		t4 = SERPENT_AND( x0, x3 ); \
+		t5 = SERPENT_AND( x1, x3 ); \
+		t6 = SERPENT_AND( x2, x3 ); \
+		t7 = SERPENT_AND( t1, x3 ); \
+		t8 = SERPENT_AND( t2, x3 ); \
+		t9 = SERPENT_AND( t3, x3 ); \
+		t10 = SERPENT_XOR( x0, x1 ); \
+		t11 = SERPENT_XOR( t10, t3 ); \
+		t12 = SERPENT_XOR( t11, t4 ); \
+		t13 = SERPENT_XOR( t12, t6 ); \
+		t14 = SERPENT_XOR( t13, t8 ); \
+		t15 = SERPENT_XOR( t14, t9 ); \
+		t16 = SERPENT_NOT( t15 ); \
+		t17 = SERPENT_XOR( x0, t1 ); \
+		t18 = SERPENT_XOR( t17, x2 ); \
+		t19 = SERPENT_XOR( t18, t2 ); \
+		t20 = SERPENT_XOR( t19, x3 ); \
+		t21 = SERPENT_XOR( t20, t5 ); \
+		t22 = SERPENT_XOR( t21, t7 ); \
+		t23 = SERPENT_XOR( t22, t8 ); \
+		t24 = SERPENT_XOR( t23, t9 ); \
+		t25 = SERPENT_NOT( t24 ); \
+		t26 = SERPENT_XOR( x1, t1 ); \
+		t27 = SERPENT_XOR( t26, x2 ); \
+		t28 = SERPENT_XOR( t27, x3 ); \
+		t29 = SERPENT_NOT( t28 ); \
+		t30 = SERPENT_XOR( x1, t2 ); \
+		t31 = SERPENT_XOR( t30, x3 ); \
+		t32 = SERPENT_XOR( t31, t4 ); \
+		t33 = SERPENT_XOR( t32, t7 ); \
+		t34 = SERPENT_XOR( t33, t8 ); \
+		t35 = SERPENT_XOR( t34, t9 ); \
+		t36 = SERPENT_NOT( t35 ); \
+\
+		x0 = t16; \
+		x1 = t25; \
+		x2 = t29; \
+		x3 = t36; \
+	} \
+	while( 0 )
+
+/* S-box 2
+ */
+#define SERPENT_SBOX2( x0, x1, x2, x3 ) \
+	do \
+	{ \
+		SERPENT_WORD t1, t2, t3, t4, t5, t6, t7, t8; \
+		SERPENT_WORD t9, t10, t11, t12, t13, t14, t15, t16; \
+		SERPENT_WORD t17, t18, t19, t20, t21, t22, t23, t24; \
+		SERPENT_WORD t25, t26, t27, t28, t29, t30, t31; \
+\
+		t1 = SERPENT_AND( x0, x2 ); \
+		t2 = SERPENT_AND( x1, x2 ); \
+		t3 = SERPENT_AND( x0, x3 ); \
+		t4 = SERPENT_AND( x1, x3 ); \
+		t5 = SERPENT_AND( x2, x3 ); \
+		t6 = SERPENT_AND( t1, x1 ); \
+		t7 = SERPENT_AND( t3, x1 ); \
+		t8 = SERPENT_AND( t1, x3 ); \
+		t9 = SERPENT_XOR( x1, x2 ); \
+		t10 = SERPENT_XOR( t9, t1 ); \
+		t11 = SERPENT_XOR( t10, x3 ); \
+		t12 = SERPENT_XOR( x0, x1 ); \
+		t13 = SERPENT_XOR( t12, x2 ); \
+		t14 = SERPENT_XOR( t13, t2 ); \
+		t15 = SERPENT_XOR( t14, t6 ); \
+		t16 = SERPENT_XOR( t15, t3 ); \
+		t17 = SERPENT_XOR( t16, t7 ); \
+		t18 = SERPENT_XOR( t17, t5 ); \
+		t19 = SERPENT_XOR( t18, t8 ); \
+		t20 = SERPENT_XOR( x0, x1 ); \
+		t21 = SERPENT_XOR( t20, t2 ); \
+		t22 = SERPENT_XOR( t21, x3 ); \
+		t23 = SERPENT_XOR( t22, t4 ); \
+		t24 = SERPENT_XOR( t23, t7 ); \
+		t25 = SERPENT_XOR( t24, t5 ); \
+		t26 = SERPENT_XOR( t25, t8 ); \
+		t27 = SERPENT_XOR( x0, x1 ); \
+		t28 = SERPENT_XOR( t27, x2 ); \
+		t29 = SERPENT_XOR( t28, t6 ); \
+		t30 = SERPENT_XOR( t29, t4 ); \
+		t31 = SERPENT_NOT( t30 ); \
+\
+		x0 = t11; \
+		x1 = t19; \
+		x2 = t26; \
+		x3 = t31; \
+	} \
+	while( 0 )
+
+/* S-box 3
+ */
+#define SERPENT_SBOX3( x0, x1, x2, x3 ) \
+	do \
+	{ \
+		SERPENT_WORD t1, t2, t3, t4, t5, t6, t7, t8; \
+		SERPENT_WORD t9, t10, t11, t12, t13, t14, t15, t16; \
+		SERPENT_WORD t17, t18, t19, t20, t21, t22, t23, t24; \
+		SERPENT_WORD t25, t26, t27, t28, t29, t30, t31, t32; \
+		SERPENT_WORD t33, t34, t35, t36, t37; \
+\
+		t1 = SERPENT_AND( x0, x1 ); \
+		t2 = SERPENT_AND( x0, x2 ); \
+		t3 = SERPENT_AND( x1, x2 ); \
+		t4 = SERPENT_AND( x0, x3 ); \
+		t5 = SERPENT_AND( x1, x3 ); \
+		t6 = SERPENT_AND( x2, x3 ); \
+		t7 = SERPENT_AND( t1, x2 ); \
+		t8 = SERPENT_AND( t1, x3 ); \
+		t9 = SERPENT_AND( t2, x3 ); \
+		t10 = SERPENT_AND( t3, x3 ); \
+		t11 = SERPENT_XOR( x0, x1 ); \
+		t12 = SERPENT_XOR( t11, t3 ); \
+		t13 = SERPENT_XOR( t12, x3 ); \
+		t14 = SERPENT_XOR( t13, t4 ); \
+		t15 = SERPENT_XOR( t14, t6 ); \
+		t16 = SERPENT_XOR( t15, t9 ); \
+		t17 = SERPENT_XOR( t16, t10 ); \
+		t18 = SERPENT_XOR( x0, x1 ); \
+		t19 = SERPENT_XOR( t18, t2 ); \
+		t20 = SERPENT_XOR( t19, t4 ); \
+		t21 = SERPENT_XOR( t20, t8 ); \
+		t22 = SERPENT_XOR( t21, t6 ); \
+		t23 = SERPENT_XOR( t22, t9 ); \
+		t24 = SERPENT_XOR( x0, t1 ); \
+		t25 = SERPENT_XOR( t24, x2 ); \
+		t26 = SERPENT_XOR( t25, t7 ); \
+		t27 = SERPENT_XOR( t26, x3 ); \
+		t28 = SERPENT_XOR( t27, t5 ); \
+		t29 = SERPENT_XOR( t28, t8 ); \
+		t30 = SERPENT_XOR( x0, x1 ); \
+		t31 = SERPENT_XOR( t30, t1 ); \
+		t32 = SERPENT_XOR( t31, x2 ); \
+		t33 = SERPENT_XOR( t32, t2 ); \
+		t34 = SERPENT_XOR( t33, t7 ); \
+		t35 = SERPENT_XOR( t34, x3 ); \
+		t36 = SERPENT_XOR( t35, t6 ); \
+		t37 = SERPENT_XOR( t36, t9 ); \
+\
+		x0 = t17; \
+		x1 = t23; \
+		x2 = t29; \
+		x3 = t37; \
+	} \
+	while( 0 )
+
+/* S-box 4
+ */
+#define SERPENT_SBOX4( x0, x1, x2, x3 ) \
+	do \
+	{ \
+		SERPENT_WORD t1, t2, t3, t4, t5, t6, t7, t8; \
+		SERPENT_WORD t9, t10, t11, t12, t13, t14, t15, t16; \
+		SERPENT_WORD t17, t18, t19, t20, t21, t22, t23, t24; \
+		SERPENT_WORD t25, t26, t27, t28, t29, t30, t31, t32; \
+		SERPENT_WORD t33, t34, t35, t36, t37; \
+\
+		t1 = SERPENT_AND( x0, x1 ); \
+		t2 = SERPENT_AND( x0, x2 ); \
+		t3 = SERPENT_AND( x1, x2 ); \
+		t4 = SERPENT_AND( x0, x3 ); \
+		t5 = SERPENT_AND( x1, x3 ); \
+		t6 = SERPENT_AND( x2, x3 ); \
+		t7 = SERPENT_AND( t1, x2 ); \
+		t8 = SERPENT_AND( t1, x3 ); \
+		t9 = SERPENT_AND( t2, x3 ); \
+		t10 = SERPENT_AND( t3, x3 ); \
+		t11 = SERPENT_XOR( x1, t1 ); \
+		t12 = SERPENT_XOR( t11, x2 ); \
+		t13 = SERPENT_XOR( t12, x3 ); \
+		t14 = SERPENT_XOR( t13, t4 ); \
+		t15 = SERPENT_XOR( t14, t5 ); \
+		t16 = SERPENT_NOT( t15 ); \
+		t17 = SERPENT_XOR( x0, t2 ); \
+		t18 = SERPENT_XOR( t17, t3 ); \
+		t19 = SERPENT_XOR( t18, x3 ); \
+		t20 = SERPENT_XOR( t19, t5 ); \
+		t21 = SERPENT_XOR( t20, t6 ); \
+		t22 = SERPENT_XOR( t21, t9 ); \
+		t23 = SERPENT_XOR( t22, t10 ); \
+		t24 = SERPENT_XOR( x0, t1 ); \
+		t25 = SERPENT_XOR( t24, x2 ); \
+		t26 = SERPENT_XOR( t25, t3 ); \
+		t27 = SERPENT_XOR( t26, t7 ); \
+		t28 = SERPENT_XOR( t27, t5 ); \
+		t29 = SERPENT_XOR( t28, t8 ); \
+		t30 = SERPENT_XOR( t29, t6 ); \
+		t31 = SERPENT_XOR( t30, t10 ); \
+		t32 = SERPENT_XOR( x0, x1 ); \
+		t33 = SERPENT_XOR( t32, x2 ); \
+		t34 = SERPENT_XOR( t33, t3 ); \
+		t35 = SERPENT_XOR( t34, t4 ); \
+		t36 = SERPENT_XOR( t35, t5 ); \
+		t37 = SERPENT_XOR( t36, t8 ); \
+\
+		x0 = t16; \
+		x1 = t23; \
+		x2 = t31; \
+		x3 = t37; \
+	} \
+	while( 0 )
+
+/* S-box 5
+ */
+#define SERPENT_SBOX5( x0, x1, x2, x3 ) \
+	do \
+	{ \
+		SERPENT_WORD t1, t2, t3, t4, t5, t6, t7, t8; \
+		SERPENT_WORD t9, t10, t11, t12, t13, t14, t15, t16; \
+		SERPENT_WORD t17, t18, t19, t20, t21, t22, t23, t24; \
+		SERPENT_WORD t25, t26, t27, t28, t29, t30, t31, t32; \
+		SERPENT_WORD t33, t34, t35, t36; \
+\
+		t1 = SERPENT_AND( x0, x1 ); \
+		t2 = SERPENT_AND( x0, x2 ); \
+		t3 = SERPENT_AND( x0, x3 ); \
+		t4 = SERPENT_AND( x1, x3 ); \
+		t5 = SERPENT_AND( x2, x3 ); \
+		t6 = SERPENT_AND( t1, x2 ); \
+		t7 = SERPENT_AND( t1, x3 ); \
+		t8 = SERPENT_AND( t2, x3 ); \
+		t9 = SERPENT_AND( t4, x2 ); \
+		t10 = SERPENT_XOR( x1, t1 ); \
+		t11 = SERPENT_XOR( t10, x2 ); \
+		t12 = SERPENT_XOR( t11, x3 ); \
+		t13 = SERPENT_XOR( t12, t3 ); \
+		t14 = SERPENT_XOR( t13, t4 ); \
+		t15 = SERPENT_NOT( t14 ); \
+		t16 = SERPENT_XOR( x0, t1 ); \
+		t17 = SERPENT_XOR( t16, x2 ); \
+		t18 = SERPENT_XOR( t17, x3 ); \
+		t19 = SERPENT_XOR( t18, t4 ); \
+		t20 = SERPENT_XOR( t19, t7 ); \
+		t21 = SERPENT_XOR( t20, t5 ); \
+		t22 = SERPENT_NOT( t21 ); \
+		t23 = SERPENT_XOR( x1, t2 ); \
+		t24 = SERPENT_XOR( t23, x3 ); \
+		t25 = SERPENT_XOR( t24, t7 ); \
+		t26 = SERPENT_XOR( t25, t5 ); \
+		t27 = SERPENT_XOR( t26, t8 ); \
+		t28 = SERPENT_XOR( t27, t9 ); \
+		t29 = SERPENT_NOT( t28 ); \
+		t30 = SERPENT_XOR( x0, x1 ); \
+		t31 = SERPENT_XOR( t30, x2 ); \
+		t32 = SERPENT_XOR( t31, t6 ); \
+		t33 = SERPENT_XOR( t32, x3 ); \
+		t34 = SERPENT_XOR( t33, t3 ); \
+		t35 = SERPENT_XOR( t34, t8 ); \
+		t36 = SERPENT_NOT( t35 ); \
+\
+		x0 = t15; \
+		x1 = t22; \
+		x2 = t29; \
+		x3 = t36; \
+	} \
+	while( 0 )
+
+/* S-box 6
+ */
+#define SERPENT_SBOX6( x0, x1, x2, x3 ) \
+	do \
+	{ \
+		SERPENT_WORD t1, t2, t3, t4, t5, t6, t7, t8; \
+		SERPENT_WORD t9, t10, t11, t12, t13, t14, t15, t16; \
+		SERPENT_WORD t17, t18, t19, t20, t21, t22, t23, t24; \
+		SERPENT_WORD t25, t26, t27, t28, t29, t30, t31, t32; \
+		SERPENT_WORD t33, t34, t35, t36, t37; \
+\
+		t1 = SERPENT_AND( x0, x1 ); \
+		t2 = SERPENT_AND( x0, x2 ); \
+		t3 = SERPENT_AND( x1, x2 ); \
+		t4 = SERPENT_AND( x0, x3 ); \
+		t5 = SERPENT_AND( x1, x3 ); \
+		t6 = SERPENT_AND( x2, x3 ); \
+		t7 = SERPENT_AND( t1, x2 ); \
+		t8 = SERPENT_AND( t1, x3 ); \
+		t9 = SERPENT_AND( t3, x3 ); \
+		t10 = SERPENT_XOR( x0, x1 ); \
+		t11 = SERPENT_XOR( t10, x2 ); \
+		t12 = SERPENT_XOR( t11, t2 ); \
+		t13 = SERPENT_XOR( t12, t3 ); \
+		t14 = SERPENT_XOR( t13, t7 ); \
+		t15 = SERPENT_XOR( t14, x3 ); \
+		t16 = SERPENT_XOR( t15, t8 ); \
+		t17 = SERPENT_XOR( t16, t9 ); \
+		t18 = SERPENT_NOT( t17 ); \
+		t19 = SERPENT_XOR( x1, x2 ); \
+		t20 = SERPENT_XOR( t19, t4 ); \
+		t21 = SERPENT_NOT( t20 ); \
+		t22 = SERPENT_XOR( x0, t1 ); \
+		t23 = SERPENT_XOR( t22, x2 ); \
+		t24 = SERPENT_XOR( t23, t3 ); \
+		t25 = SERPENT_XOR( t24, t7 ); \
+		t26 = SERPENT_XOR( t25, t5 ); \
+		t27 = SERPENT_XOR( t26, t8 ); \
+		t28 = SERPENT_XOR( t27, t6 ); \
+		t29 = SERPENT_XOR( t28, t9 ); \
+		t30 = SERPENT_NOT( t29 ); \
+		t31 = SERPENT_XOR( x1, t1 ); \
+		t32 = SERPENT_XOR( t31, x2 ); \
+		t33 = SERPENT_XOR( t32, t2 ); \
+		t34 = SERPENT_XOR( t33, t7 ); \
+		t35 = SERPENT_XOR( t34, x3 ); \
+		t36 = SERPENT_XOR( t35, t6 ); \
+		t37 = SERPENT_XOR( t36, t9 ); \
+\
+		x0 = t18; \
+		x1 = t21; \
+		x2 = t30; \
+		x3 = t37; \
+	} \
+	while( 0 )
+
+/* S-box 7
+ */
+#define SERPENT_SBOX7( x0, x1, x2, x3 ) \
+	do \
+	{ \
+		SERPENT_WORD t1, t2, t3, t4, t5, t6, t7, t8; \
+		SERPENT_WORD t9, t10, t11, t12, t13, t14, t15, t16; \
+		SERPENT_WORD t17, t18, t19, t20, t21, t22, t23, t24; \
+		SERPENT_WORD t25, t26, t27, t28, t29, t30, t31, t32; \
+		SERPENT_WORD t33, t34, t35, t36, t37, t38; \
+\
+		t1 = SERPENT_AND( x0, x1 ); \
+		t2 = SERPENT_AND( x0, x2 ); \
+		t3 = SERPENT_AND( x1, x2 ); \
+		t4 = SERPENT_AND( x0, x3 ); \
+		t5 = SERPENT_AND( x1, x3 ); \
+		t6 = SERPENT_AND( x2, x3 ); \
+		t7 = SERPENT_AND( t1, x2 ); \
+		t8 = SERPENT_AND( t1, x3 ); \
+		t9 = SERPENT_AND( t2, x3 ); \
+		t10 = SERPENT_AND( t3, x3 ); \
+		t11 = SERPENT_XOR( t1, x2 ); \
+		t12 = SERPENT_XOR( t11, t4 ); \
+		t13 = SERPENT_XOR( t12, t5 ); \
+		t14 = SERPENT_XOR( t13, t6 ); \
+		t15 = SERPENT_XOR( t14, t9 ); \
+		t16 = SERPENT_XOR( t15, t10 ); \
+		t17 = SERPENT_NOT( t16 ); \
+		t18 = SERPENT_XOR( x1, t1 ); \
+		t19 = SERPENT_XOR( t18, x2 ); \
+		t20 = SERPENT_XOR( t19, t2 ); \
+		t21 = SERPENT_XOR( t20, t3 ); \
+		t22 = SERPENT_XOR( t21, x3 ); \
+		t23 = SERPENT_XOR( t22, t4 ); \
+		t24 = SERPENT_XOR( t23, t8 ); \
+		t25 = SERPENT_XOR( t24, t9 ); \
+		t26 = SERPENT_XOR( x0, x1 ); \
+		t27 = SERPENT_XOR( t26, x2 ); \
+		t28 = SERPENT_XOR( t27, t7 ); \
+		t29 = SERPENT_XOR( t28, x3 ); \
+		t30 = SERPENT_XOR( t29, t4 ); \
+		t31 = SERPENT_XOR( t30, t5 ); \
+		t32 = SERPENT_XOR( t31, t8 ); \
+		t33 = SERPENT_XOR( t32, t10 ); \
+		t34 = SERPENT_XOR( x0, x1 ); \
+		t35 = SERPENT_XOR( t34, x2 ); \
+		t36 = SERPENT_XOR( t35, t2 ); \
+		t37 = SERPENT_XOR( t36, t7 ); \
+		t38 = SERPENT_XOR( t37, t4 ); \
+\
+		x0 = t17; \
+		x1 = t25; \
+		x2 = t33; \
+		x3 = t38; \
+	} \
+	while( 0 )
+
+/* Inverse S-box 0
+ */
+#define SERPENT_INVERSE_SBOX0( x0, x1, x2, x3 ) \
+	do \
+	{ \
+		SERPENT_WORD t1, t2, t3, t4, t5, t6, t7, t8; \
+		SERPENT_WORD t9, t10, t11, t12, t13, t14, t15, t16; \
+		SERPENT_WORD t17, t18, t19, t20, t21, t22, t23, t24; \
+		SERPENT_WORD t25, t26, t27, t28, t29, t30, t31, t32; \
+		SERPENT_WORD t33, t34, t35, t36; \
+\
+		t1 = SERPENT_AND( x0, x1 ); \
+		t2 = SERPENT_AND( x0, x2 ); \
+		t3 = SERPENT_AND( x1, x2 ); \
+		t4 = SERPENT_AND( x0, x3 ); \
+		t5 = SERPENT_AND( x1, x3 ); \
+		t6 = SERPENT_AND( x2, x3 ); \
+		t7 = SERPENT_AND( t1, x3 ); \
+		t8 = SERPENT_AND( t2, x3 ); \
+		t9 = SERPENT_AND( t3, x3 ); \
+		t10 = SERPENT_XOR( t1, x2 ); \
+		t11 = SERPENT_XOR( t10, t3 ); \
+		t12 = SERPENT_XOR( t11, t4 ); \
+		t13 = SERPENT_XOR( t12, t5 ); \
+		t14 = SERPENT_XOR( t13, t7 ); \
+		t15 = SERPENT_XOR( t14, t6 ); \
+		t16 = SERPENT_XOR( t15, t8 ); \
+		t17 = SERPENT_XOR( t16, t9 ); \
+		t18 = SERPENT_NOT( t17 ); \
+		t19 = SERPENT_XOR( x0, x1 ); \
+		t20 = SERPENT_XOR( t19, x2 ); \
+		t21 = SERPENT_XOR( t20, t2 ); \
+		t22 = SERPENT_XOR( t21, t5 ); \
+		t23 = SERPENT_XOR( t22, t8 ); \
+		t24 = SERPENT_XOR( t23, t9 ); \
+		t25 = SERPENT_XOR( x0, x1 ); \
+		t26 = SERPENT_XOR( t25, t1 ); \
+		t27 = SERPENT_XOR( t26, x2 ); \
+		t28 = SERPENT_XOR( t27, x3 ); \
+		t29 = SERPENT_NOT( t28 ); \
+		t30 = SERPENT_XOR( x0, t3 ); \
+		t31 = SERPENT_XOR( t30, x3 ); \
+		t32 = SERPENT_XOR( t31, t7 ); \
+		t33 = SERPENT_XOR( t32, t6 ); \
+		t34 = SERPENT_XOR( t33, t8 ); \
+		t35 = SERPENT_XOR( t34, t9 ); \
+		t36 = SERPENT_NOT( t35 ); \
+\
+		x0 = t18; \
+		x1 = t24; \
+		x2 = t29; \
+		x3 = t36; \
+	} \
+	while( 0 )
+
+/* Inverse S-box 1
+ */
+#define SERPENT_INVERSE_SBOX1( x0, x1, x2, x3 ) \
+	do \
+	{ \
+		SERPENT_WORD t1, t2, t3, t4, t5, t6, t7, t8; \
+		SERPENT_WORD t9, t10, t11, t12, t13, t14, t15, t16; \
+		SERPENT_WORD t17, t18, t19, t20, t21, t22, t23, t24; \
+		SERPENT_WORD t25, t26, t27, t28, t29, t30, t31, t32; \
+\
+		t1 = SERPENT_AND( x0, x1 ); \
+		t2 = SERPENT_AND( x0, x2 ); \
+		t3 = SERPENT_AND( x1, x2 ); \
+		t4 = SERPENT_AND( x0, x3 ); \
+		t5 = SERPENT_AND( x1, x3 ); \
+		t6 = SERPENT_AND( t1, x2 ); \
+		t7 = SERPENT_AND( t2, x3 ); \
+		t8 = SERPENT_AND( t3, x3 ); \
+		t9 = SERPENT_XOR( x0, x1 ); \
+		t10 = SERPENT_XOR( t9, t1 ); \
+		t11 = SERPENT_XOR( t10, t6 ); \
+		t12 = SERPENT_XOR( t11, t5 ); \
+		t13 = SERPENT_XOR( t12, t7 ); \
+		t14 = SERPENT_XOR( t13, t8 ); \
+		t15 = SERPENT_NOT( t14 ); \
+		t16 = SERPENT_XOR( x1, x2 ); \
+		t17 = SERPENT_XOR( t16, t6 ); \
+		t18 = SERPENT_XOR( t17, x3 ); \
+		t19 = SERPENT_XOR( t18, t4 ); \
+		t20 = SERPENT_XOR( t19, t5 ); \
+		t21 = SERPENT_XOR( t20, t7 ); \
+		t22 = SERPENT_XOR( t21, t8 ); \
+		t23 = SERPENT_XOR( x0, x1 ); \
+		t24 = SERPENT_XOR( t23, t2 ); \
+		t25 = SERPENT_XOR( t24, t3 ); \
+		t26 = SERPENT_XOR( t25, t6 ); \
+		t27 = SERPENT_XOR( t26, x3 ); \
+		t28 = SERPENT_XOR( t27, t7 ); \
+		t29 = SERPENT_NOT( t28 ); \
+		t30 = SERPENT_XOR( x0, x2 ); \
+		t31 = SERPENT_XOR( t30, x3 ); \
+		t32 = SERPENT_XOR( t31, t5 ); \
+\
+		x0 = t15; \
+		x1 = t22; \
+		x2 = t29; \
+		x3 = t32; \
+	} \
+	while( 0 )
+
+/* Inverse S-box 2
+ */
+#define SERPENT_INVERSE_SBOX2( x0, x1, x2, x3 ) \
+	do \
+	{ \
+		SERPENT_WORD t1, t2, t3, t4, t5, t6, t7, t8; \
+		SERPENT_WORD t9, t10, t11, t12, t13, t14, t15, t16; \
+		SERPENT_WORD t17, t18, t19, t20, t21, t22, t23, t24; \
+		SERPENT_WORD t25, t26, t27, t28, t29, t30, t31; \
+\
+		t1 = SERPENT_AND( x0, x1 ); \
+		t2 = SERPENT_AND( x1, x2 ); \
+		t3 = SERPENT_AND( x0, x3 ); \
+		t4 = SERPENT_AND( x1, x3 ); \
+		t5 = SERPENT_AND( x2, x3 ); \
+		t6 = SERPENT_AND( t1, x2 ); \
+		t7 = SERPENT_AND( t1, x3 ); \
+		t8 = SERPENT_AND( t3, x2 ); \
+		t9 = SERPENT_XOR( x0, x1 ); \
+		t10 = SERPENT_XOR( t9, x2 ); \
+		t11 = SERPENT_XOR( t10, t2 ); \
+		t12 = SERPENT_XOR( t11, t4 ); \
+		t13 = SERPENT_XOR( x1, t1 ); \
+		t14 = SERPENT_XOR( t13, x2 ); \
+		t15 = SERPENT_XOR( t14, t3 ); \
+		t16 = SERPENT_XOR( t15, t7 ); \
+		t17 = SERPENT_XOR( t16, t5 ); \
+		t18 = SERPENT_XOR( t17, t8 ); \
+		t19 = SERPENT_XOR( x0, t1 ); \
+		t20 = SERPENT_XOR( t19, x2 ); \
+		t21 = SERPENT_XOR( t20, x3 ); \
+		t22 = SERPENT_XOR( t21, t3 ); \
+		t23 = SERPENT_XOR( t22, t4 ); \
+		t24 = SERPENT_XOR( t23, t7 ); \
+		t25 = SERPENT_XOR( t24, t8 ); \
+		t26 = SERPENT_NOT( t25 ); \
+		t27 = SERPENT_XOR( t1, t2 ); \
+		t28 = SERPENT_XOR( t27, t6 ); \
+		t29 = SERPENT_XOR( t28, x3 ); \
+		t30 = SERPENT_XOR( t29, t8 ); \
+		t31 = SERPENT_NOT( t30 ); \
+\
+		x0 = t12; \
+		x1 = t18; \
+		x2 = t26; \
+		x3 = t31; \
+	} \
+	while( 0 )
+
+/* Inverse S-box 3
+ */
+#define SERPENT_INVERSE_SBOX3( x0, x1, x2, x3 ) \
+	do \
+	{ \
+		SERPENT_WORD t1, t2, t3, t4, t5, t6, t7, t8; \
+		SERPENT_WORD t9, t10, t11, t12, t13, t14, t15, t16; \
+		SERPENT_WORD t17, t18, t19, t20, t21, t22, t23, t24; \
+		SERPENT_WORD t25, t26, t27, t28, t29, t30, t31, t32; \
+		SERPENT_WORD t33, t34, t35, t36, t37; \
+\
+		t1 = SERPENT_AND( x0, x1 ); \
+		t2 = SERPENT_AND( x0, x2 ); \
+		t3 = SERPENT_AND( x1, x2 ); \
+		t4 = SERPENT_AND( x0, x3 ); \
+		t5 = SERPENT_AND( x1, x3 ); \
+		t6 = SERPENT_AND( x2, x3 ); \
+		t7 = SERPENT_AND( t1, x2 ); \
+		t8 = SERPENT_AND( t1, x3 ); \
+		t9 = SERPENT_AND( t2, x3 ); \
+		t10 = SERPENT_AND( t3, x3 ); \
+		t11 = SERPENT_XOR( x0, x2 ); \
+		t12 = SERPENT_XOR( t11, t3 ); \
+		t13 = SERPENT_XOR( t12, x3 ); \
+		t14 = SERPENT_XOR( t13, t4 ); \
+		t15 = SERPENT_XOR( t14, t5 ); \
+		t16 = SERPENT_XOR( t15, t10 ); \
+		t17 = SERPENT_XOR( x1, x2 ); \
+		t18 = SERPENT_XOR( t17, t3 ); \
+		t19 = SERPENT_XOR( t18, t7 ); \
+		t20 = SERPENT_XOR( t19, x3 ); \
+		t21 = SERPENT_XOR( t20, t4 ); \
+		t22 = SERPENT_XOR( t21, t9 ); \
+		t23 = SERPENT_XOR( t22, t10 ); \
+		t24 = SERPENT_XOR( t1, t2 ); \
+		t25 = SERPENT_XOR( t24, t3 ); \
+		t26 = SERPENT_XOR( t25, t4 ); \
+		t27 = SERPENT_XOR( t26, t5 ); \
+		t28 = SERPENT_XOR( t27, t8 ); \
+		t29 = SERPENT_XOR( t28, t6 ); \
+		t30 = SERPENT_XOR( t29, t9 ); \
+		t31 = SERPENT_XOR( x0, x1 ); \
+		t32 = SERPENT_XOR( t31, x2 ); \
+		t33 = SERPENT_XOR( t32, t2 ); \
+		t34 = SERPENT_XOR( t33, t7 ); \
+		t35 = SERPENT_XOR( t34, t4 ); \
+		t36 = SERPENT_XOR( t35, t8 ); \
+		t37 = SERPENT_XOR( t36, t6 ); \
+\
+		x0 = t16; \
+		x1 = t23; \
+		x2 = t30; \
+		x3 = t37; \
+	} \
+	while( 0 )
+
+/* Inverse S-box 4
+ */
+#define SERPENT_INVERSE_SBOX4( x0, x1, x2, x3 ) \
+	do \
+	{ \
+		SERPENT_WORD t1, t2, t3, t4, t5, t6, t7, t8; \
+		SERPENT_WORD t9, t10, t11, t12, t13, t14, t15, t16; \
+		SERPENT_WORD t17, t18, t19, t20, t21, t22, t23, t24; \
+		SERPENT_WORD t25, t26, t27, t28, t29, t30, t31, t32; \
+		SERPENT_WORD t33, t34, t35; \
+\
+		t1 = SERPENT_AND( x0, x1 ); \
+		t2 = SERPENT_AND( x0, x2 ); \
+		t3 = SERPENT_AND( x0, x3 ); \
+		t4 = SERPENT_AND( x1, x3 ); \
+		t5 = SERPENT_AND( x2, x3 ); \
+		t6 = SERPENT_AND( t1, x2 ); \
+		t7 = SERPENT_AND( t1, x3 ); \
+		t8 = SERPENT_AND( t2, x3 ); \
+		t9 = SERPENT_XOR( x0, x1 ); \
+		t10 = SERPENT_XOR( t9, x2 ); \
+		t11 = SERPENT_XOR( t10, x3 ); \
+		t12 = SERPENT_XOR( t11, t3 ); \
+		t13 = SERPENT_XOR( t12, t7 ); \
+		t14 = SERPENT_XOR( t13, t5 ); \
+		t15 = SERPENT_XOR( t14, t8 ); \
+		t16 = SERPENT_NOT( t15 ); \
+		t17 = SERPENT_XOR( t1, x2 ); \
+		t18 = SERPENT_XOR( t17, t2 ); \
+		t19 = SERPENT_XOR( t18, x3 ); \
+		t20 = SERPENT_XOR( t19, t3 ); \
+		t21 = SERPENT_XOR( t20, t8 ); \
+		t22 = SERPENT_XOR( x0, x1 ); \
+		t23 = SERPENT_XOR( t22, t1 ); \
+		t24 = SERPENT_XOR( t23, x2 ); \
+		t25 = SERPENT_XOR( t24, t2 ); \
+		t26 = SERPENT_XOR( t25, t6 ); \
+		t27 = SERPENT_XOR( t26, x3 ); \
+		t28 = SERPENT_XOR( t27, t4 ); \
+		t29 = SERPENT_XOR( t28, t7 ); \
+		t30 = SERPENT_NOT( t29 ); \
+		t31 = SERPENT_XOR( x1, t1 ); \
+		t32 = SERPENT_XOR( t31, x2 ); \
+		t33 = SERPENT_XOR( t32, t3 ); \
+		t34 = SERPENT_XOR( t33, t7 ); \
+		t35 = SERPENT_XOR( t34, t5 ); \
+\
+		x0 = t16; \
+		x1 = t21; \
+		x2 = t30; \
+		x3 = t35; \
+	} \
+	while( 0 )
+
+/* Inverse S-box 5
+ */
+#define SERPENT_INVERSE_SBOX5( x0, x1, x2, x3 ) \
+	do \
+	{ \
+		SERPENT_WORD t1, t2, t3, t4, t5, t6, t7, t8; \
+		SERPENT_WORD t9, t10, t11, t12, t13, t14, t15, t16; \
+		SERPENT_WORD t17, t18, t19, t20, t21, t22, t23, t24; \
+		SERPENT_WORD t25, t26, t27, t28; \
+\
+		t1 = SERPENT_AND( x0, x1 ); \
+		t2 = SERPENT_AND( x0, x2 ); \
+		t3 = SERPENT_AND( x1, x2 ); \
+		t4 = SERPENT_AND( x0, x3 ); \
+		t5 = SERPENT_AND( x1, x3 ); \
+		t6 = SERPENT_AND( t1, x2 ); \
+		t7 = SERPENT_AND( t1, x3 ); \
+		t8 = SERPENT_AND( t2, x3 ); \
+		t9 = SERPENT_XOR( x0, t3 ); \
+		t10 = SERPENT_XOR( t9, x3 ); \
+		t11 = SERPENT_XOR( t10, t7 ); \
+		t12 = SERPENT_XOR( x0, x1 ); \
+		t13 = SERPENT_XOR( t12, t2 ); \
+		t14 = SERPENT_XOR( t13, t3 ); \
+		t15 = SERPENT_XOR( t14, t6 ); \
+		t16 = SERPENT_XOR( t15, x3 ); \
+		t17 = SERPENT_XOR( t16, t4 ); \
+		t18 = SERPENT_XOR( t17, t7 ); \
+		t19 = SERPENT_XOR( x0, t1 ); \
+		t20 = SERPENT_XOR( t19, x2 ); \
+		t21 = SERPENT_XOR( t20, t5 ); \
+		t22 = SERPENT_XOR( t21, t7 ); \
+		t23 = SERPENT_XOR( t22, t8 ); \
+		t24 = SERPENT_XOR( x1, t1 ); \
+		t25 = SERPENT_XOR( t24, x2 ); \
+		t26 = SERPENT_XOR( t25, t6 ); \
+		t27 = SERPENT_XOR( t26, t4 ); \
+		t28 = SERPENT_NOT( t27 ); \
+\
+		x0 = t11; \
+		x1 = t18; \
+		x2 = t23; \
+		x3 = t28; \
+	} \
+	while( 0 )
+
+/* Inverse S-box 6
+ */
+#define SERPENT_INVERSE_SBOX6( x0, x1, x2, x3 ) \
+	do \
+	{ \
+		SERPENT_WORD t1, t2, t3, t4, t5, t6, t7, t8; \
+		SERPENT_WORD t9, t10, t11, t12, t13, t14, t15, t16; \
+		SERPENT_WORD t17, t18, t19, t20, t21, t22, t23, t24; \
+		SERPENT_WORD t25, t26, t27, t28, t29, t30, t31, t32; \
+		SERPENT_WORD t33, t34, t35, t36, t37, t38; \
+\
+		t1 = SERPENT_AND( x0, x1 ); \
+		t2 = SERPENT_AND( x0, x2 ); \
+		t3 = SERPENT_AND( x1, x2 ); \
+		t4 = SERPENT_AND( x0, x3 ); \
+		t5 = SERPENT_AND( x1, x3 ); \
+		t6 = SERPENT_AND( x2, x3 ); \
+		t7 = SERPENT_AND( t1, x2 ); \
+		t8 = SERPENT_AND( t1, x3 ); \
+		t9 = SERPENT_AND( t3, x3 ); \
+		t10 = SERPENT_XOR( x0, t1 ); \
+		t11 = SERPENT_XOR( t10, t2 ); \
+		t12 = SERPENT_XOR( t11, t3 ); \
+		t13 = SERPENT_XOR( t12, t7 ); \
+		t14 = SERPENT_XOR( t13, x3 ); \
+		t15 = SERPENT_XOR( t14, t8 ); \
+		t16 = SERPENT_XOR( t15, t9 ); \
+		t17 = SERPENT_NOT( t16 ); \
+		t18 = SERPENT_XOR( x1, x2 ); \
+		t19 = SERPENT_XOR( t18, t2 ); \
+		t20 = SERPENT_XOR( t19, x3 ); \
+		t21 = SERPENT_NOT( t20 ); \
+		t22 = SERPENT_XOR( x0, x1 ); \
+		t23 = SERPENT_XOR( t22, t3 ); \
+		t24 = SERPENT_XOR( t23, t5 ); \
+		t25 = SERPENT_XOR( t24, t8 ); \
+		t26 = SERPENT_XOR( t25, t6 ); \
+		t27 = SERPENT_XOR( t26, t9 ); \
+		t28 = SERPENT_NOT( t27 ); \
+		t29 = SERPENT_XOR( x1, t1 ); \
+		t30 = SERPENT_XOR( t29, x2 ); \
+		t31 = SERPENT_XOR( t30, t3 ); \
+		t32 = SERPENT_XOR( t31, t7 ); \
+		t33 = SERPENT_XOR( t32, x3 ); \
+		t34 = SERPENT_XOR( t33, t4 ); \
+		t35 = SERPENT_XOR( t34, t8 ); \
+		t36 = SERPENT_XOR( t35, t6 ); \
+		t37 = SERPENT_XOR( t36, t9 ); \
+		t38 = SERPENT_NOT( t37 ); \
+\
+		x0 = t17; \
+		x1 = t21; \
+		x2 = t28; \
+		x3 = t38; \
+	} \
+	while( 0 )
+
+/* Inverse S-box 7
+ */
+#define SERPENT_INVERSE_SBOX7( x0, x1, x2, x3 ) \
+	do \
+	{ \
+		SERPENT_WORD t1, t2, t3, t4, t5, t6, t7, t8; \
+		SERPENT_WORD t9, t10, t11, t12, t13, t14, t15, t16; \
+		SERPENT_WORD t17, t18, t19, t20, t21, t22, t23, t24; \
+		SERPENT_WORD t25, t26, t27, t28, t29, t30, t31, t32; \
+		SERPENT_WORD t33, t34, t35; \
+\
+		t1 = SERPENT_AND( x0, x1 ); \
+		t2 = SERPENT_AND( x0, x2 ); \
+		t3 = SERPENT_AND( x1, x2 ); \
+		t4 = SERPENT_AND( x0, x3 ); \
+		t5 = SERPENT_AND( x1, x3 ); \
+		t6 = SERPENT_AND( x2, x3 ); \
+		t7 = SERPENT_AND( t1, x2 ); \
+		t8 = SERPENT_AND( t1, x3 ); \
+		t9 = SERPENT_AND( t2, x3 ); \
+		t10 = SERPENT_AND( t3, x3 ); \
+		t11 = SERPENT_XOR( x0, x1 ); \
+		t12 = SERPENT_XOR( t11, t3 ); \
+		t13 = SERPENT_XOR( t12, t5 ); \
+		t14 = SERPENT_XOR( t13, t8 ); \
+		t15 = SERPENT_XOR( t14, t6 ); \
+		t16 = SERPENT_XOR( t15, t10 ); \
+		t17 = SERPENT_NOT( t16 ); \
+		t18 = SERPENT_XOR( x0, x2 ); \
+		t19 = SERPENT_XOR( t18, t3 ); \
+		t20 = SERPENT_XOR( t19, x3 ); \
+		t21 = SERPENT_XOR( t20, t4 ); \
+		t22 = SERPENT_XOR( t21, t5 ); \
+		t23 = SERPENT_XOR( t22, t9 ); \
+		t24 = SERPENT_XOR( t23, t10 ); \
+		t25 = SERPENT_NOT( t24 ); \
+		t26 = SERPENT_XOR( x1, t2 ); \
+		t27 = SERPENT_XOR( t26, x3 ); \
+		t28 = SERPENT_XOR( t27, t8 ); \
+		t29 = SERPENT_XOR( t28, t6 ); \
+		t30 = SERPENT_XOR( t29, t9 ); \
+		t31 = SERPENT_XOR( t1, x2 ); \
+		t32 = SERPENT_XOR( t31, t7 ); \
+		t33 = SERPENT_XOR( t32, t4 ); \
+		t34 = SERPENT_XOR( t33, t5 ); \
+		t35 = SERPENT_XOR( t34, t8 ); \
+\
+		x0 = t17; \
+		x1 = t25; \
+		x2 = t30; \
+		x3 = t35; \
+	} \
+	while( 0 )
+
+#endif /* !defined( _SERPENT_SBOXES_H ) */
+
@@ -32,12 +32,68 @@
 #endif
 
 #include "assorted_getopt.h"
+#include "assorted_input_file.h"
 #include "assorted_libcerror.h"
 #include "assorted_libcfile.h"
 #include "assorted_libcnotify.h"
+#include "assorted_libcthreads.h"
 #include "assorted_libfcrypto.h"
 #include "assorted_libuna.h"
 #include "assorted_output.h"
+#include "serpent.h"
+
+/* The size of the buffer used to decrypt the data of the source file
+ */
+#define SERPENTCRYPT_BUFFER_SIZE			( 4 * 1024 * 1024 )
+
+/* The maximum number of threads
+ */
+#define SERPENTCRYPT_MAXIMUM_NUMBER_OF_THREADS		64
+
+/* The minimum size of the range of data decrypted by a thread
+ */
+#define SERPENTCRYPT_MINIMUM_THREAD_RANGE_SIZE		( 64 * 1024 )
+
+/* The default XTS sector size
+ */
+#define SERPENTCRYPT_DEFAULT_SECTOR_SIZE		512
+
+/* The chaining modes
+ */
+enum SERPENTCRYPT_CHAINING_MODES
+{
+	SERPENTCRYPT_CHAINING_MODE_ECB			= 0,
+	SERPENTCRYPT_CHAINING_MODE_XTS			= 1
+};
+
+typedef struct serpentcrypt_context serpentcrypt_context_t;
+
+struct serpentcrypt_context
+{
+	/* The decryption method
+	 */
+	int decryption_method;
+
+	/* The chaining mode
+	 */
+	int chaining_mode;
+
+	/* The XTS sector size
+	 */
+	size_t sector_size;
+
+	/* The libfcrypto Serpent context
+	 */
+	libfcrypto_serpent_context_t *libfcrypto_context;
+
+	/* The Serpent context
+	 */
+	serpent_context_t *serpent_context;
+
+	/* The Serpent tweak context, used in XTS mode
+	 */
+	serpent_context_t *tweak_context;
+};
 
 /* Sets the keys
  * Returns 1 if successful or -1 on error
@@ -145,23 +201,491 @@ void usage_fprint(
 	}
 	fprintf( stream, "Use serpentcrypt to de- or encrypt data using Serpent.\n\n" );
 
-	fprintf( stream, "Usage: serpentcrypt [ -k key ] [ -o offset ] [ -s size ]\n"
-	                 "                    [ -t target ] [ -hvV ] source\n\n" );
+	fprintf( stream, "Usage: serpentcrypt [ -b sector_size ] [ -D window ] [ -j threads ]\n"
+	                 "                    [ -k key ] [ -n sector_number ] [ -o offset ]\n"
+	                 "                    [ -s size ] [ -S format ] [ -t target ]\n"
+	                 "                    [ -123hvVx ] source\n\n" );
 
 	fprintf( stream, "\tsource: the source file\n\n" );
 
+	fprintf( stream, "\t-1:     use the libfcrypto decryption method\n" );
+	fprintf( stream, "\t-2:     use the basic decryption method\n" );
+	fprintf( stream, "\t-3:     use the SIMD decryption method (default), which\n"
+	                 "\t        decrypts 4 or 8 blocks at a time\n" );
+	fprintf( stream, "\t-b:     XTS sector size (default is %d), must be a multiple\n"
+	                 "\t        of 16\n", SERPENTCRYPT_DEFAULT_SECTOR_SIZE );
+	fprintf( stream, "\t-D:     limit the hexadecimal representation of the data to\n"
+	                 "\t        a window formatted as offset:size or offset relative\n"
+	                 "\t        to the start of the data (default is all data)\n" );
 	fprintf( stream, "\t-h:     shows this help\n" );
-	fprintf( stream, "\t-k:     the key formatted in base16\n" );
+	fprintf( stream, "\t-j:     number of threads (default is 1), the data is split\n"
+	                 "\t        into ranges of blocks or sectors that are decrypted\n"
+	                 "\t        in parallel\n" );
+	fprintf( stream, "\t-k:     the key formatted in base16, in XTS mode the data key\n"
+	                 "\t        followed by the tweak key\n" );
+	fprintf( stream, "\t-n:     XTS sector number of the first sector (default is\n"
+	                 "\t        the data offset divided by the sector size)\n" );
 	fprintf( stream, "\t-o:     data offset (default is 0)\n" );
 	fprintf( stream, "\t-s:     size of data (default is the file size)\n" );
+	fprintf( stream, "\t-S:     print timing and throughput statistics of the open,\n"
+	                 "\t        read, compute and write phases and the peak memory\n"
+	                 "\t        size to stderr in the format: text or json\n" );
 	fprintf( stream, "\t-t:     specify the target file to write the output data,\n"
 	                 "\t        by default the data will be written to stdout in\n"
 	                 "\t        hexadecimal representation\n" );
 	fprintf( stream, "\t-v:     verbose output to stderr\n" );
 	fprintf( stream, "\t-V:     print version\n" );
+	fprintf( stream, "\t-x:     use XTS mode instead of ECB mode, which is not\n"
+	                 "\t        supported by the libfcrypto decryption method\n" );
 	fprintf( stream, "\n" );
 }
 
+/* Decrypts data using the chaining mode and decryption method of the context
+ * The size must be a multiple of the Serpent block size, or in XTS mode
+ * of the sector size, where the sector number is that of the first sector
+ * Returns 1 if successful or -1 on error
+ */
+int serpentcrypt_decrypt(
+     serpentcrypt_context_t *context,
+     const uint8_t *encrypted_data,
+     uint8_t *decrypted_data,
+     size_t size,
+     uint64_t sector_number,
+     libcerror_error_t **error )
+{
+	static char *function = "serpentcrypt_decrypt";
+	int result            = 0;
+
+	if( context == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid context.",
+		 function );
+
+		return( -1 );
+	}
+	if( context->chaining_mode == SERPENTCRYPT_CHAINING_MODE_XTS )
+	{
+		switch( context->decryption_method )
+		{
+			case 2:
+				result = serpent_crypt_xts_basic(
+				          context->serpent_context,
+				          context->tweak_context,
+				          SERPENT_CRYPT_MODE_DECRYPT,
+				          sector_number,
+				          context->sector_size,
+				          encrypted_data,
+				          size,
+				          decrypted_data,
+				          size,
+				          error );
+				break;
+
+			case 3:
+				result = serpent_crypt_xts_simd(
+				          context->serpent_context,
+				          context->tweak_context,
+				          SERPENT_CRYPT_MODE_DECRYPT,
+				          sector_number,
+				          context->sector_size,
+				          encrypted_data,
+				          size,
+				          decrypted_data,
+				          size,
+				          error );
+				break;
+
+			default:
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+				 LIBCERROR_ARGUMENT_ERROR_UNSUPPORTED_VALUE,
+				 "%s: unsupported decryption method.",
+				 function );
+
+				return( -1 );
+		}
+	}
+	else
+	{
+		switch( context->decryption_method )
+		{
+			case 1:
+				result = libfcrypto_serpent_crypt_ecb(
+				          context->libfcrypto_context,
+				          LIBFCRYPTO_SERPENT_CRYPT_MODE_DECRYPT,
+				          encrypted_data,
+				          size,
+				          decrypted_data,
+				          size,
+				          error );
+				break;
+
+			case 2:
+				result = serpent_crypt_ecb_basic(
+				          context->serpent_context,
+				          SERPENT_CRYPT_MODE_DECRYPT,
+				          encrypted_data,
+				          size,
+				          decrypted_data,
+				          size,
+				          error );
+				break;
+
+			case 3:
+				result = serpent_crypt_ecb_simd(
+				          context->serpent_context,
+				          SERPENT_CRYPT_MODE_DECRYPT,
+				          encrypted_data,
+				          size,
+				          decrypted_data,
+				          size,
+				          error );
+				break;
+
+			default:
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+				 LIBCERROR_ARGUMENT_ERROR_UNSUPPORTED_VALUE,
+				 "%s: unsupported decryption method.",
+				 function );
+
+				return( -1 );
+		}
+	}
+	if( result != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ENCRYPTION,
+		 LIBCERROR_ENCRYPTION_ERROR_DECRYPT_FAILED,
+		 "%s: unable to decrypt data.",
+		 function );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+
+typedef struct serpentcrypt_thread_range serpentcrypt_thread_range_t;
+
+struct serpentcrypt_thread_range
+{
+	/* The context
+	 */
+	serpentcrypt_context_t *context;
+
+	/* The encrypted data of the range
+	 */
+	const uint8_t *encrypted_data;
+
+	/* The decrypted data of the range
+	 */
+	uint8_t *decrypted_data;
+
+	/* The size of the range
+	 */
+	size_t size;
+
+	/* The XTS sector number of the range
+	 */
+	uint64_t sector_number;
+
+	/* The result of the decryption
+	 */
+	int result;
+};
+
+/* Decrypts a range, used as the callback function of a thread
+ * Returns 1 if successful or -1 on error
+ */
+int serpentcrypt_thread_range_decrypt(
+     void *arguments )
+{
+	serpentcrypt_thread_range_t *thread_range = NULL;
+
+	if( arguments == NULL )
+	{
+		return( -1 );
+	}
+	thread_range = (serpentcrypt_thread_range_t *) arguments;
+
+	thread_range->result = serpentcrypt_decrypt(
+	                        thread_range->context,
+	                        thread_range->encrypted_data,
+	                        thread_range->decrypted_data,
+	                        thread_range->size,
+	                        thread_range->sector_number,
+	                        NULL );
+
+	return( thread_range->result );
+}
+
+/* Decrypts data using multiple threads
+ * Since the blocks, or in XTS mode the sectors, are decrypted independently
+ * the data is split into a range of blocks or sectors per thread, that are
+ * decrypted in parallel
+ * The last range is decrypted by the calling thread
+ * Returns 1 if successful or -1 on error
+ */
+int serpentcrypt_decrypt_parallel(
+     serpentcrypt_context_t *context,
+     const uint8_t *encrypted_data,
+     uint8_t *decrypted_data,
+     size_t size,
+     uint64_t sector_number,
+     int number_of_threads,
+     libcerror_error_t **error )
+{
+	serpentcrypt_thread_range_t *thread_ranges = NULL;
+	libcthreads_thread_t **threads             = NULL;
+	static char *function                      = "serpentcrypt_decrypt_parallel";
+	size_t range_alignment                     = 0;
+	size_t range_offset                        = 0;
+	size_t range_size                          = 0;
+	int number_of_ranges                       = 0;
+	int range_index                            = 0;
+	int result                                 = 1;
+
+	if( ( number_of_threads <= 0 )
+	 || ( number_of_threads > SERPENTCRYPT_MAXIMUM_NUMBER_OF_THREADS ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid number of threads value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( context == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid context.",
+		 function );
+
+		return( -1 );
+	}
+	/* Keep the ranges a multiple of 8 blocks so that the SIMD decryption method
+	 * only decrypts the blocks of the last range a block at a time, in XTS mode
+	 * the ranges must consist of whole sectors
+	 */
+	if( context->chaining_mode == SERPENTCRYPT_CHAINING_MODE_XTS )
+	{
+		range_alignment = context->sector_size;
+	}
+	else
+	{
+		range_alignment = 8 * SERPENT_BLOCK_SIZE;
+	}
+	if( range_alignment == 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid context - sector size value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	/* Do not use more threads than ranges of the minimum size
+	 * or than aligned ranges
+	 */
+	number_of_ranges = number_of_threads;
+
+	if( ( size / SERPENTCRYPT_MINIMUM_THREAD_RANGE_SIZE ) < (size_t) number_of_ranges )
+	{
+		number_of_ranges = (int) ( size / SERPENTCRYPT_MINIMUM_THREAD_RANGE_SIZE );
+	}
+	if( ( size / range_alignment ) < (size_t) number_of_ranges )
+	{
+		number_of_ranges = (int) ( size / range_alignment );
+	}
+	if( number_of_ranges <= 1 )
+	{
+		return( serpentcrypt_decrypt(
+		         context,
+		         encrypted_data,
+		         decrypted_data,
+		         size,
+		         sector_number,
+		         error ) );
+	}
+	thread_ranges = (serpentcrypt_thread_range_t *) memory_allocate(
+	                                                 sizeof( serpentcrypt_thread_range_t ) * number_of_ranges );
+
+	if( thread_ranges == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create thread ranges.",
+		 function );
+
+		goto on_error;
+	}
+	threads = (libcthreads_thread_t **) memory_allocate(
+	                                     sizeof( libcthreads_thread_t * ) * number_of_ranges );
+
+	if( threads == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create threads.",
+		 function );
+
+		goto on_error;
+	}
+	if( memory_set(
+	     threads,
+	     0,
+	     sizeof( libcthreads_thread_t * ) * number_of_ranges ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear threads.",
+		 function );
+
+		goto on_error;
+	}
+	range_size  = size / number_of_ranges;
+	range_size -= range_size % range_alignment;
+
+	for( range_index = 0;
+	     range_index < number_of_ranges;
+	     range_index++ )
+	{
+		thread_ranges[ range_index ].context        = context;
+		thread_ranges[ range_index ].encrypted_data = &( encrypted_data[ range_offset ] );
+		thread_ranges[ range_index ].decrypted_data = &( decrypted_data[ range_offset ] );
+		thread_ranges[ range_index ].size           = range_size;
+		thread_ranges[ range_index ].sector_number  = sector_number;
+		thread_ranges[ range_index ].result         = 0;
+
+		if( context->chaining_mode == SERPENTCRYPT_CHAINING_MODE_XTS )
+		{
+			sector_number += range_size / context->sector_size;
+		}
+
+		range_offset += range_size;
+	}
+	thread_ranges[ number_of_ranges - 1 ].size += size - range_offset;
+
+	for( range_index = 0;
+	     range_index < ( number_of_ranges - 1 );
+	     range_index++ )
+	{
+		if( libcthreads_thread_create(
+		     &( threads[ range_index ] ),
+		     NULL,
+		     serpentcrypt_thread_range_decrypt,
+		     (void *) &( thread_ranges[ range_index ] ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+			 "%s: unable to create thread: %d.",
+			 function,
+			 range_index );
+
+			result = -1;
+
+			break;
+		}
+	}
+	if( result == 1 )
+	{
+		serpentcrypt_thread_range_decrypt(
+		 (void *) &( thread_ranges[ number_of_ranges - 1 ] ) );
+	}
+	/* Wait for the threads that were created, also on error
+	 */
+	for( range_index = 0;
+	     range_index < ( number_of_ranges - 1 );
+	     range_index++ )
+	{
+		if( threads[ range_index ] == NULL )
+		{
+			continue;
+		}
+		if( libcthreads_thread_join(
+		     &( threads[ range_index ] ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to join thread: %d.",
+			 function,
+			 range_index );
+
+			result = -1;
+		}
+	}
+	if( result != 1 )
+	{
+		goto on_error;
+	}
+	for( range_index = 0;
+	     range_index < number_of_ranges;
+	     range_index++ )
+	{
+		if( thread_ranges[ range_index ].result != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_ENCRYPTION,
+			 LIBCERROR_ENCRYPTION_ERROR_DECRYPT_FAILED,
+			 "%s: unable to decrypt range: %d.",
+			 function,
+			 range_index );
+
+			goto on_error;
+		}
+	}
+	memory_free(
+	 threads );
+	memory_free(
+	 thread_ranges );
+
+	return( 1 );
+
+on_error:
+	if( threads != NULL )
+	{
+		memory_free(
+		 threads );
+	}
+	if( thread_ranges != NULL )
+	{
+		memory_free(
+		 thread_ranges );
+	}
+	return( -1 );
+}
+
+#endif /* defined( HAVE_MULTI_THREAD_SUPPORT ) */
+
 /* The main program
  */
 #if defined( HAVE_WIDE_SYSTEM_CHARACTER )
@@ -170,26 +694,43 @@ int wmain( int argc, wchar_t * const argv[] )
 int main( int argc, char * const argv[] )
 #endif
 {
-	libcerror_error_t *error               = NULL;
-	libcfile_file_t *destination_file      = NULL;
-	libcfile_file_t *source_file           = NULL;
-	libfcrypto_serpent_context_t *context  = NULL;
-	system_character_t *option_keys        = NULL;
-	system_character_t *option_target_path = NULL;
-	system_character_t *source             = NULL;
-	uint8_t *buffer                        = NULL;
-	uint8_t *decrypted_data                = NULL;
-	uint8_t *key_data                      = NULL;
-	char *program                          = "serpentcrypt";
-	system_integer_t option                = 0;
-	size64_t source_size                   = 0;
-	size_t buffer_size                     = 0;
-	size_t decrypted_data_size             = 0;
-	size_t key_data_size                   = 0;
-	ssize_t read_count                     = 0;
-	ssize_t write_count                    = 0;
-	off_t source_offset                    = 0;
-	int verbose                            = 0;
+	serpentcrypt_context_t context;
+
+	libcerror_error_t *error                     = NULL;
+	libcfile_file_t *destination_file            = NULL;
+	assorted_input_file_t *source_file           = NULL;
+	system_character_t *option_keys              = NULL;
+	system_character_t *option_sector_number     = NULL;
+	system_character_t *option_hexdump_window    = NULL;
+	system_character_t *option_statistics_format = NULL;
+	system_character_t *option_target_path       = NULL;
+	system_character_t *source                   = NULL;
+	uint8_t *buffer                              = NULL;
+	uint8_t *decrypted_data                      = NULL;
+	uint8_t *key_data                            = NULL;
+	char *program                                = "serpentcrypt";
+	system_integer_t option                      = 0;
+	size64_t remaining_size                      = 0;
+	size64_t source_size                         = 0;
+	uint64_t phase_start_time                    = 0;
+	uint64_t sector_number                       = 0;
+	size_t buffer_size                           = 0;
+	size_t key_data_size                         = 0;
+	size_t key_size                              = 0;
+	size_t read_size                             = 0;
+	ssize_t read_count                           = 0;
+	ssize_t write_count                          = 0;
+	off_t source_offset                          = 0;
+	int number_of_threads                        = 1;
+	int result                                   = 0;
+	int verbose                                  = 0;
+
+	context.decryption_method  = 3;
+	context.chaining_mode      = SERPENTCRYPT_CHAINING_MODE_ECB;
+	context.sector_size        = SERPENTCRYPT_DEFAULT_SECTOR_SIZE;
+	context.libfcrypto_context = NULL;
+	context.serpent_context    = NULL;
+	context.tweak_context      = NULL;
 
 	libcnotify_stream_set(
 	 stderr,
@@ -204,7 +745,7 @@ int main( int argc, char * const argv[] )
 	while( ( option = assorted_getopt(
 	                   argc,
 	                   argv,
-	                   _SYSTEM_STRING( "hk:o:s:t:vV" ) ) ) != (system_integer_t) -1 )
+	                   _SYSTEM_STRING( "123b:D:hj:k:n:o:s:S:t:vVx" ) ) ) != (system_integer_t) -1 )
 	{
 		switch( option )
 		{
@@ -220,17 +761,52 @@ int main( int argc, char * const argv[] )
 
 				return( EXIT_FAILURE );
 
+			case (system_integer_t) '1':
+				context.decryption_method = 1;
+
+				break;
+
+			case (system_integer_t) '2':
+				context.decryption_method = 2;
+
+				break;
+
+			case (system_integer_t) '3':
+				context.decryption_method = 3;
+
+				break;
+
+			case (system_integer_t) 'b':
+				context.sector_size = (size_t) atol( optarg );
+
+				break;
+
+			case (system_integer_t) 'D':
+				option_hexdump_window = optarg;
+
+				break;
+
 			case (system_integer_t) 'h':
 				usage_fprint(
 				 stdout );
 
 				return( EXIT_SUCCESS );
 
+			case (system_integer_t) 'j':
+				number_of_threads = (int) atol( optarg );
+
+				break;
+
 			case (system_integer_t) 'k':
 				option_keys = optarg;
 
 				break;
 
+			case (system_integer_t) 'n':
+				option_sector_number = optarg;
+
+				break;
+
 			case (system_integer_t) 'o':
 				source_offset = atol( optarg );
 
@@ -241,6 +817,11 @@ int main( int argc, char * const argv[] )
 
 				break;
 
+			case (system_integer_t) 'S':
+				option_statistics_format = optarg;
+
+				break;
+
 			case (system_integer_t) 't':
 				option_target_path = optarg;
 
@@ -256,6 +837,11 @@ int main( int argc, char * const argv[] )
 				 stdout );
 
 				return( EXIT_SUCCESS );
+
+			case (system_integer_t) 'x':
+				context.chaining_mode = SERPENTCRYPT_CHAINING_MODE_XTS;
+
+				break;
 		}
 	}
 	if( optind == argc )
@@ -282,15 +868,90 @@ int main( int argc, char * const argv[] )
 
 		return( EXIT_FAILURE );
 	}
+	if( ( number_of_threads <= 0 )
+	 || ( number_of_threads > SERPENTCRYPT_MAXIMUM_NUMBER_OF_THREADS ) )
+	{
+		fprintf(
+		 stderr,
+		 "Unsupported number of threads, value must be between 1 and %d.\n",
+		 SERPENTCRYPT_MAXIMUM_NUMBER_OF_THREADS );
+
+		return( EXIT_FAILURE );
+	}
+	if( context.chaining_mode == SERPENTCRYPT_CHAINING_MODE_XTS )
+	{
+		if( context.decryption_method == 1 )
+		{
+			fprintf(
+			 stderr,
+			 "Unsupported decryption method in XTS mode.\n" );
+
+			return( EXIT_FAILURE );
+		}
+		if( ( context.sector_size == 0 )
+		 || ( context.sector_size > SERPENTCRYPT_BUFFER_SIZE )
+		 || ( ( context.sector_size % SERPENT_BLOCK_SIZE ) != 0 ) )
+		{
+			fprintf(
+			 stderr,
+			 "Unsupported sector size, value must be a multiple of %d and not exceed %d.\n",
+			 SERPENT_BLOCK_SIZE,
+			 SERPENTCRYPT_BUFFER_SIZE );
+
+			return( EXIT_FAILURE );
+		}
+		if( option_sector_number != NULL )
+		{
+			sector_number = (uint64_t) strtoull( option_sector_number, NULL, 0 );
+		}
+		else
+		{
+			sector_number = (uint64_t) source_offset / context.sector_size;
+		}
+	}
+#if !defined( HAVE_MULTI_THREAD_SUPPORT )
+	if( number_of_threads > 1 )
+	{
+		fprintf(
+		 stderr,
+		 "Multi-threading not supported, using a single thread.\n" );
+
+		number_of_threads = 1;
+	}
+#endif
 	libcnotify_stream_set(
 	 stderr,
 	 NULL );
 	libcnotify_verbose_set(
 	 verbose );
 
+	if( assorted_output_statistics_initialize(
+	     option_statistics_format,
+	     &error ) != 1 )
+	{
+		fprintf(
+		 stderr,
+		 "Unable to initialize statistics.\n" );
+
+		goto on_error;
+	}
+	if( option_hexdump_window != NULL )
+	{
+		if( assorted_output_hexdump_window_set(
+		     option_hexdump_window,
+		     &error ) != 1 )
+		{
+			fprintf(
+			 stderr,
+			 "Unsupported hexdump window.\n" );
+
+			goto on_error;
+		}
+	}
+
 	/* Open the source file
 	 */
-	if( libcfile_file_initialize(
+	if( assorted_input_file_initialize(
 	     &source_file,
 	     &error ) != 1 )
 	{
@@ -300,10 +961,9 @@ int main( int argc, char * const argv[] )
 
 		goto on_error;
 	}
-	if( libcfile_file_open(
+	if( assorted_input_file_open(
 	     source_file,
 	     source,
-	     LIBCFILE_OPEN_READ,
 	     &error ) != 1 )
 	{
 		fprintf(
@@ -314,7 +974,7 @@ int main( int argc, char * const argv[] )
 	}
 	if( source_size == 0 )
 	{
-		if( libcfile_file_get_size(
+		if( assorted_input_file_get_size(
 		     source_file,
 		     &source_size,
 		     &error ) == -1 )
@@ -325,6 +985,14 @@ int main( int argc, char * const argv[] )
 
 			goto on_error;
 		}
+		if( (size64_t) source_offset < source_size )
+		{
+			source_size -= source_offset;
+		}
+		else
+		{
+			source_size = 0;
+		}
 	}
 	if( source_size == 0 )
 	{
@@ -332,35 +1000,59 @@ int main( int argc, char * const argv[] )
 		 stderr,
 		 "Invalid source size value is zero.\n" );
 
-		return( EXIT_FAILURE );
+		goto on_error;
 	}
-	if( source_size > (size_t) SSIZE_MAX )
+	if( ( source_size % SERPENT_BLOCK_SIZE ) != 0 )
 	{
 		fprintf(
 		 stderr,
-		 "Invalid source size value exceeds maximum.\n" );
+		 "Invalid source size value not a multiple of the block size: %d.\n",
+		 SERPENT_BLOCK_SIZE );
 
-		return( EXIT_FAILURE );
+		goto on_error;
 	}
-	/* Create the input buffer
-	 */
-	buffer_size = source_size;
-
-	buffer = (uint8_t *) memory_allocate(
-	                      sizeof( uint8_t ) * buffer_size );
-
-	if( buffer == NULL )
+	if( ( context.chaining_mode == SERPENTCRYPT_CHAINING_MODE_XTS )
+	 && ( ( source_size % context.sector_size ) != 0 ) )
 	{
 		fprintf(
 		 stderr,
-		 "Unable to create buffer.\n" );
+		 "Invalid source size value not a multiple of the sector size: %" PRIzd ".\n",
+		 context.sector_size );
 
-		return( EXIT_FAILURE );
+		goto on_error;
 	}
-	decrypted_data_size = source_size;
+	/* Decrypt a block per thread at once so that the block can be split into ranges,
+	 * without a target the data is decrypted at once so that it can be printed
+	 */
+	if( option_target_path == NULL )
+	{
+		if( source_size > (size64_t) SSIZE_MAX )
+		{
+			fprintf(
+			 stderr,
+			 "Invalid source size value exceeds maximum.\n" );
 
+			goto on_error;
+		}
+		buffer_size = (size_t) source_size;
+	}
+	else
+	{
+		buffer_size = SERPENTCRYPT_BUFFER_SIZE * (size_t) number_of_threads;
+
+		/* In XTS mode the buffer contains whole sectors
+		 */
+		if( context.chaining_mode == SERPENTCRYPT_CHAINING_MODE_XTS )
+		{
+			buffer_size -= buffer_size % context.sector_size;
+		}
+		if( (size64_t) buffer_size > source_size )
+		{
+			buffer_size = (size_t) source_size;
+		}
+	}
 	decrypted_data = (uint8_t *) memory_allocate(
-	                              sizeof( uint8_t ) * decrypted_data_size );
+	                              sizeof( uint8_t ) * buffer_size );
 
 	if( decrypted_data == NULL )
 	{
@@ -372,7 +1064,7 @@ int main( int argc, char * const argv[] )
 	}
 	/* Position the source file at the right offset
 	 */
-	if( libcfile_file_seek_offset(
+	if( assorted_input_file_seek_offset(
 	     source_file,
 	     source_offset,
 	     SEEK_SET,
@@ -384,39 +1076,20 @@ int main( int argc, char * const argv[] )
 
 		goto on_error;
 	}
-	if( libfcrypto_serpent_context_initialize(
-	     &context,
+	/* Read the next blocks ahead while the current block is decrypted
+	 */
+	if( assorted_input_file_set_read_ahead(
+	     source_file,
+	     buffer_size,
+	     ASSORTED_INPUT_FILE_DEFAULT_NUMBER_OF_READ_AHEAD_BLOCKS,
 	     &error ) != 1 )
 	{
 		fprintf(
 		 stderr,
-		 "Unable to create Serpent context.\n" );
-
-		goto on_error;
-	}
-	fprintf(
-	 stdout,
-	 "Starting Serpent decrypting data of: %" PRIs_SYSTEM " at offset: %" PRIjd " (0x%08" PRIjx ").\n",
-	 source,
-	 source_offset,
-	 source_offset );
-
-	read_count = libcfile_file_read_buffer(
-		      source_file,
-		      buffer,
-		      source_size,
-	              &error );
-
-	if( read_count != (ssize_t) source_size )
-	{
-		fprintf(
-		 stderr,
-		 "Unable to read from source file.\n" );
+		 "Unable to set read-ahead of source file.\n" );
 
 		goto on_error;
 	}
-	/* Decrypts the data
-	 */
 	if( serpentcrypt_set_keys(
 	     option_keys,
 	     &key_data,
@@ -429,11 +1102,80 @@ int main( int argc, char * const argv[] )
 
 		goto on_error;
 	}
-	if( libfcrypto_serpent_context_set_key(
-	     context,
-	     key_data,
-	     key_data_size * 8,
-	     &error ) != 1 )
+	if( context.decryption_method == 1 )
+	{
+		if( libfcrypto_serpent_context_initialize(
+		     &( context.libfcrypto_context ),
+		     &error ) != 1 )
+		{
+			fprintf(
+			 stderr,
+			 "Unable to create Serpent context.\n" );
+
+			goto on_error;
+		}
+		result = libfcrypto_serpent_context_set_key(
+		          context.libfcrypto_context,
+		          key_data,
+		          key_data_size * 8,
+		          &error );
+	}
+	else
+	{
+		/* In XTS mode the key data contains the data key followed by
+		 * the tweak key
+		 */
+		key_size = key_data_size;
+
+		if( context.chaining_mode == SERPENTCRYPT_CHAINING_MODE_XTS )
+		{
+			if( ( key_data_size % 2 ) != 0 )
+			{
+				fprintf(
+				 stderr,
+				 "Invalid key data size value not a multiple of 2.\n" );
+
+				goto on_error;
+			}
+			key_size = key_data_size / 2;
+		}
+		if( serpent_context_initialize(
+		     &( context.serpent_context ),
+		     &error ) != 1 )
+		{
+			fprintf(
+			 stderr,
+			 "Unable to create Serpent context.\n" );
+
+			goto on_error;
+		}
+		result = serpent_context_set_key(
+		          context.serpent_context,
+		          key_data,
+		          key_size * 8,
+		          &error );
+
+		if( ( result == 1 )
+		 && ( context.chaining_mode == SERPENTCRYPT_CHAINING_MODE_XTS ) )
+		{
+			if( serpent_context_initialize(
+			     &( context.tweak_context ),
+			     &error ) != 1 )
+			{
+				fprintf(
+				 stderr,
+				 "Unable to create Serpent tweak context.\n" );
+
+				goto on_error;
+			}
+			result = serpent_context_set_key(
+			          context.tweak_context,
+			          &( key_data[ key_size ] ),
+			          key_size * 8,
+			          &error );
+		}
+	}
+	if( result != 1 )
 	{
 		fprintf(
 		 stderr,
@@ -457,44 +1199,7 @@ int main( int argc, char * const argv[] )
 
 	key_data = NULL;
 
-	if( option_target_path == NULL )
-	{
-		fprintf(
-		 stderr,
-		 "Encrypted data:\n" );
-
-		libcnotify_print_data(
-		 buffer,
-		 source_size,
-		 0 );
-	}
-	if( libfcrypto_serpent_crypt_ecb(
-	     context,
-	     LIBFCRYPTO_SERPENT_CRYPT_MODE_DECRYPT,
-	     buffer,
-	     source_size,
-	     decrypted_data,
-	     decrypted_data_size,
-	     &error ) != 1 )
-	{
-		fprintf(
-		 stderr,
-		 "Unable to decode data.\n" );
-
-		goto on_error;
-	}
-	if( option_target_path == NULL )
-	{
-		fprintf(
-		 stderr,
-		 "Decrypted data:\n" );
-
-		libcnotify_print_data(
-		 decrypted_data,
-		 decrypted_data_size,
-		 0 );
-	}
-	else
+	if( option_target_path != NULL )
 	{
 		if( libcfile_file_initialize(
 		     &destination_file,
@@ -506,6 +1211,8 @@ int main( int argc, char * const argv[] )
 
 			goto on_error;
 		}
+		phase_start_time = assorted_output_statistics_start_phase();
+
 		if( libcfile_file_open(
 		     destination_file,
 		     option_target_path,
@@ -518,20 +1225,160 @@ int main( int argc, char * const argv[] )
 
 			goto on_error;
 		}
-		write_count = libcfile_file_write_buffer(
-			       destination_file,
-			       decrypted_data,
-			       decrypted_data_size,
-			       &error );
+		assorted_output_statistics_stop_phase(
+		 ASSORTED_OUTPUT_STATISTICS_PHASE_OPEN,
+		 phase_start_time,
+		 0 );
+	}
+	fprintf(
+	 stdout,
+	 "Starting Serpent decrypting data of: %" PRIs_SYSTEM " at offset: %" PRIjd " (0x%08" PRIjx ").\n",
+	 source,
+	 source_offset,
+	 source_offset );
+
+	if( context.chaining_mode == SERPENTCRYPT_CHAINING_MODE_XTS )
+	{
+		fprintf(
+		 stdout,
+		 "Using XTS mode with sector size: %" PRIzd " starting at sector: %" PRIu64 ".\n",
+		 context.sector_size,
+		 sector_number );
+	}
+
+	/* Decrypt the source data in blocks and write the decrypted blocks
+	 * to the target
+	 */
+	remaining_size = source_size;
+
+	while( remaining_size > 0 )
+	{
+		read_size = buffer_size;
+
+		if( (size64_t) read_size > remaining_size )
+		{
+			read_size = (size_t) remaining_size;
+		}
+		read_count = assorted_input_file_read_data(
+		              source_file,
+		              &buffer,
+		              read_size,
+		              &error );
+
+		if( read_count != (ssize_t) read_size )
+		{
+			fprintf(
+			 stderr,
+			 "Unable to read from source file.\n" );
+
+			goto on_error;
+		}
+		if( option_target_path == NULL )
+		{
+			fprintf(
+			 stderr,
+			 "Encrypted data:\n" );
+
+			if( assorted_output_data_fprint(
+			     stderr,
+			     buffer,
+			     read_size,
+			     (uint64_t) ( source_size - remaining_size ),
+			     &error ) != 1 )
+			{
+				fprintf(
+				 stderr,
+				 "Unable to print encrypted data.\n" );
 
-		if( write_count != (ssize_t) decrypted_data_size )
+				goto on_error;
+			}
+		}
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+		if( number_of_threads > 1 )
+		{
+			result = serpentcrypt_decrypt_parallel(
+			          &context,
+			          buffer,
+			          decrypted_data,
+			          read_size,
+			          sector_number,
+			          number_of_threads,
+			          &error );
+		}
+		else
+#endif
+		{
+			result = serpentcrypt_decrypt(
+			          &context,
+			          buffer,
+			          decrypted_data,
+			          read_size,
+			          sector_number,
+			          &error );
+		}
+		if( result != 1 )
 		{
 			fprintf(
 			 stderr,
-			 "Unable to write to destination file.\n" );
+			 "Unable to decode data.\n" );
 
 			goto on_error;
 		}
+		if( option_target_path == NULL )
+		{
+			fprintf(
+			 stderr,
+			 "Decrypted data:\n" );
+
+			if( assorted_output_data_fprint(
+			     stderr,
+			     decrypted_data,
+			     read_size,
+			     (uint64_t) ( source_size - remaining_size ),
+			     &error ) != 1 )
+			{
+				fprintf(
+				 stderr,
+				 "Unable to print decrypted data.\n" );
+
+				goto on_error;
+			}
+		}
+		else
+		{
+			phase_start_time = assorted_output_statistics_start_phase();
+
+			write_count = libcfile_file_write_buffer(
+				       destination_file,
+				       decrypted_data,
+				       read_size,
+				       &error );
+
+			if( write_count != (ssize_t) read_size )
+			{
+				fprintf(
+				 stderr,
+				 "Unable to write to destination file.\n" );
+
+				goto on_error;
+			}
+			assorted_output_statistics_stop_phase(
+			 ASSORTED_OUTPUT_STATISTICS_PHASE_WRITE,
+			 phase_start_time,
+			 (size64_t) write_count );
+		}
+		if( context.chaining_mode == SERPENTCRYPT_CHAINING_MODE_XTS )
+		{
+			sector_number += read_size / context.sector_size;
+		}
+		remaining_size -= read_size;
+	}
+	/* Clean up
+	 */
+	if( destination_file != NULL )
+	{
+		phase_start_time = assorted_output_statistics_start_phase();
+
 		if( libcfile_file_close(
 		     destination_file,
 		     &error ) != 0 )
@@ -542,6 +1389,11 @@ int main( int argc, char * const argv[] )
 
 			goto on_error;
 		}
+		assorted_output_statistics_stop_phase(
+		 ASSORTED_OUTPUT_STATISTICS_PHASE_WRITE,
+		 phase_start_time,
+		 0 );
+
 		if( libcfile_file_free(
 		     &destination_file,
 		     &error ) != 1 )
@@ -553,19 +1405,46 @@ int main( int argc, char * const argv[] )
 			goto on_error;
 		}
 	}
-	/* Clean up
-	 */
-	if( libfcrypto_serpent_context_free(
-	     &context,
-	     &error ) != 1 )
+	if( context.libfcrypto_context != NULL )
 	{
-		fprintf(
-		 stderr,
-		 "Unable to free Serpent context.\n" );
+		if( libfcrypto_serpent_context_free(
+		     &( context.libfcrypto_context ),
+		     &error ) != 1 )
+		{
+			fprintf(
+			 stderr,
+			 "Unable to free Serpent context.\n" );
 
-		goto on_error;
+			goto on_error;
+		}
 	}
-	if( libcfile_file_close(
+	if( context.serpent_context != NULL )
+	{
+		if( serpent_context_free(
+		     &( context.serpent_context ),
+		     &error ) != 1 )
+		{
+			fprintf(
+			 stderr,
+			 "Unable to free Serpent context.\n" );
+
+			goto on_error;
+		}
+	}
+	if( context.tweak_context != NULL )
+	{
+		if( serpent_context_free(
+		     &( context.tweak_context ),
+		     &error ) != 1 )
+		{
+			fprintf(
+			 stderr,
+			 "Unable to free Serpent tweak context.\n" );
+
+			goto on_error;
+		}
+	}
+	if( assorted_input_file_close(
 	     source_file,
 	     &error ) != 0 )
 	{
@@ -575,7 +1454,7 @@ int main( int argc, char * const argv[] )
 
 		goto on_error;
 	}
-	if( libcfile_file_free(
+	if( assorted_input_file_free(
 	     &source_file,
 	     &error ) != 1 )
 	{
@@ -585,20 +1464,21 @@ int main( int argc, char * const argv[] )
 
 		goto on_error;
 	}
-	if( decrypted_data != NULL )
-	{
-		memory_free(
-		 decrypted_data );
-	}
-	if( buffer != NULL )
-	{
-		memory_free(
-		 buffer );
-	}
+	memory_free(
+	 decrypted_data );
+
 	fprintf(
 	 stdout,
 	 "Serpent decryption:\tSUCCESS\n" );
 
+	assorted_output_statistics_fprint(
+	 stderr,
+	 program,
+	 1,
+	 NULL );
+	assorted_output_statistics_free(
+	 NULL );
+
 	return( EXIT_SUCCESS );
 
 on_error:
@@ -609,6 +1489,13 @@ on_error:
 		libcerror_error_free(
 		 &error );
 	}
+	assorted_output_statistics_fprint(
+	 stderr,
+	 program,
+	 -1,
+	 NULL );
+	assorted_output_statistics_free(
+	 NULL );
 	if( destination_file != NULL )
 	{
 		libcfile_file_free(
@@ -630,20 +1517,27 @@ on_error:
 		memory_free(
 		 key_data );
 	}
-	if( context != NULL )
+	if( context.libfcrypto_context != NULL )
 	{
 		libfcrypto_serpent_context_free(
-		 &context,
+		 &( context.libfcrypto_context ),
 		 NULL );
 	}
-	if( buffer != NULL )
+	if( context.serpent_context != NULL )
 	{
-		memory_free(
-		 buffer );
+		serpent_context_free(
+		 &( context.serpent_context ),
+		 NULL );
+	}
+	if( context.tweak_context != NULL )
+	{
+		serpent_context_free(
+		 &( context.tweak_context ),
+		 NULL );
 	}
 	if( source_file != NULL )
 	{
-		libcfile_file_free(
+		assorted_input_file_free(
 		 &source_file,
 		 NULL );
 	}
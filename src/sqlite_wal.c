@@ -0,0 +1,782 @@
+/*
+ * SQLite write-ahead log (WAL) functions
+ *
+ * Copyright (C) 2008-2019, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This software is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This software is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this software.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <byte_stream.h>
+#include <memory.h>
+#include <types.h>
+
+#include "assorted_libcerror.h"
+#include "cpu_features.h"
+#include "sqlite_wal.h"
+
+#if defined( HAVE_CPU_FEATURES_X86 )
+#include <immintrin.h>
+
+#endif
+
+/* Calculates the WAL checksum of a buffer
+ * The checksum consists of 2 sums, where for every pair of 32-bit values:
+ *   checksum1 += value1 + checksum2
+ *   checksum2 += value2 + checksum1
+ * The size must be a multiple of 8
+ * The checksum values contain the checksum of the preceding data and are updated
+ * Returns 1 if successful or -1 on error
+ */
+int sqlite_wal_checksum_calculate(
+     uint32_t *checksum1,
+     uint32_t *checksum2,
+     const uint8_t *buffer,
+     size_t size,
+     uint8_t byte_order,
+     libcerror_error_t **error )
+{
+	static char *function = "sqlite_wal_checksum_calculate";
+	size_t buffer_offset  = 0;
+	uint32_t sum1         = 0;
+	uint32_t sum2         = 0;
+	uint32_t value1       = 0;
+	uint32_t value2       = 0;
+
+	if( checksum1 == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid checksum1.",
+		 function );
+
+		return( -1 );
+	}
+	if( checksum2 == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid checksum2.",
+		 function );
+
+		return( -1 );
+	}
+	if( buffer == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid buffer.",
+		 function );
+
+		return( -1 );
+	}
+	if( size > (size_t) SSIZE_MAX )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid size value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( size % 8 ) != 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_UNSUPPORTED_VALUE,
+		 "%s: invalid size value not a multiple of 8.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( byte_order != SQLITE_WAL_BYTE_ORDER_BIG_ENDIAN )
+	 && ( byte_order != SQLITE_WAL_BYTE_ORDER_LITTLE_ENDIAN ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_UNSUPPORTED_VALUE,
+		 "%s: unsupported byte order.",
+		 function );
+
+		return( -1 );
+	}
+	sum1 = *checksum1;
+	sum2 = *checksum2;
+
+	if( byte_order == SQLITE_WAL_BYTE_ORDER_BIG_ENDIAN )
+	{
+		for( buffer_offset = 0;
+		     buffer_offset < size;
+		     buffer_offset += 8 )
+		{
+			byte_stream_copy_to_uint32_big_endian(
+			 &( buffer[ buffer_offset ] ),
+			 value1 );
+
+			byte_stream_copy_to_uint32_big_endian(
+			 &( buffer[ buffer_offset + 4 ] ),
+			 value2 );
+
+			sum1 += value1 + sum2;
+			sum2 += value2 + sum1;
+		}
+	}
+	else
+	{
+		for( buffer_offset = 0;
+		     buffer_offset < size;
+		     buffer_offset += 8 )
+		{
+			byte_stream_copy_to_uint32_little_endian(
+			 &( buffer[ buffer_offset ] ),
+			 value1 );
+
+			byte_stream_copy_to_uint32_little_endian(
+			 &( buffer[ buffer_offset + 4 ] ),
+			 value2 );
+
+			sum1 += value1 + sum2;
+			sum2 += value2 + sum1;
+		}
+	}
+	*checksum1 = sum1;
+	*checksum2 = sum2;
+
+	return( 1 );
+}
+
+/* Combines the sums of the pairs of a SIMD block into the checksum
+ * For every pair the sums are (checksum1, checksum2) = M * (checksum1, checksum2) + (value1, value1 + value2)
+ * with M = [ 1 1 ; 1 2 ], hence the sums of the pair at index i of a block of N pairs contribute
+ * M^(N - 1 - i) times to the checksum at the end of the block, which is applied using Horner's method
+ */
+static void sqlite_wal_checksum_combine_sums(
+             uint32_t *checksum1,
+             uint32_t *checksum2,
+             const uint32_t *sums,
+             size_t number_of_pairs )
+{
+	size_t pair_index = 0;
+	uint32_t sum1     = 0;
+	uint32_t sum2     = 0;
+
+	sum1 = sums[ 0 ];
+	sum2 = sums[ 1 ];
+
+	for( pair_index = 1;
+	     pair_index < number_of_pairs;
+	     pair_index++ )
+	{
+		sum1 += sum2;
+		sum2 += sum1;
+
+		sum1 += sums[ 2 * pair_index ];
+		sum2 += sums[ ( 2 * pair_index ) + 1 ];
+	}
+	*checksum1 = sum1;
+	*checksum2 = sum2;
+}
+
+#if defined( HAVE_CPU_FEATURES_X86 )
+
+/* Calculates the WAL checksum of a buffer using SSE4.1
+ * Every 32-bit lane pair keeps the sums of the pair at the same index of every
+ * 128 byte block of 16 pairs, which are multiplied by M^16 for every block,
+ * so that the sums of the lanes do not depend on each other
+ * The size must be a multiple of 128
+ */
+CPU_FEATURES_TARGET( "sse4.1" )
+static void sqlite_wal_checksum_calculate_sse41(
+             uint32_t *checksum1,
+             uint32_t *checksum2,
+             const uint8_t *buffer,
+             size_t size,
+             uint8_t byte_order )
+{
+	uint32_t sums[ 32 ];
+
+	__m128i byte_swap_mask;
+	__m128i lane_sums[ 8 ];
+	__m128i multipliers1;
+	__m128i multipliers2;
+	__m128i value;
+
+	size_t buffer_offset = 0;
+	int lane_index       = 0;
+
+	/* M^16 = [ 0x148add 0x213d05 ; 0x213d05 0x35c7e2 ]
+	 */
+	multipliers1 = _mm_set_epi32(
+	                0x35c7e2,
+	                0x148add,
+	                0x35c7e2,
+	                0x148add );
+
+	multipliers2 = _mm_set1_epi32(
+	                0x213d05 );
+
+	byte_swap_mask = _mm_set_epi8(
+	                  12, 13, 14, 15, 8, 9, 10, 11, 4, 5, 6, 7, 0, 1, 2, 3 );
+
+	for( lane_index = 0;
+	     lane_index < 8;
+	     lane_index++ )
+	{
+		lane_sums[ lane_index ] = _mm_setzero_si128();
+	}
+	/* The checksum of the preceding data is multiplied by M^16 for every block
+	 * by the lanes of the last pair, which are not multiplied when combined
+	 */
+	lane_sums[ 7 ] = _mm_set_epi32(
+	                  (int) *checksum2,
+	                  (int) *checksum1,
+	                  0,
+	                  0 );
+
+	for( buffer_offset = 0;
+	     buffer_offset < size;
+	     buffer_offset += 128 )
+	{
+		for( lane_index = 0;
+		     lane_index < 8;
+		     lane_index++ )
+		{
+			value = _mm_loadu_si128(
+			         (__m128i *) &( buffer[ buffer_offset + ( lane_index * 16 ) ] ) );
+
+			if( byte_order == SQLITE_WAL_BYTE_ORDER_BIG_ENDIAN )
+			{
+				value = _mm_shuffle_epi8(
+				         value,
+				         byte_swap_mask );
+			}
+			/* ( value1, value2 ) => ( value1, value1 + value2 )
+			 */
+			value = _mm_add_epi32(
+			         value,
+			         _mm_slli_epi64(
+			          value,
+			          32 ) );
+
+			lane_sums[ lane_index ] = _mm_add_epi32(
+			                           _mm_add_epi32(
+			                            _mm_mullo_epi32(
+			                             lane_sums[ lane_index ],
+			                             multipliers1 ),
+			                            _mm_mullo_epi32(
+			                             _mm_shuffle_epi32(
+			                              lane_sums[ lane_index ],
+			                              _MM_SHUFFLE( 2, 3, 0, 1 ) ),
+			                             multipliers2 ) ),
+			                           value );
+		}
+	}
+	for( lane_index = 0;
+	     lane_index < 8;
+	     lane_index++ )
+	{
+		_mm_storeu_si128(
+		 (__m128i *) &( sums[ lane_index * 4 ] ),
+		 lane_sums[ lane_index ] );
+	}
+	sqlite_wal_checksum_combine_sums(
+	 checksum1,
+	 checksum2,
+	 sums,
+	 16 );
+}
+
+/* Calculates the WAL checksum of a buffer using AVX2
+ * Every 32-bit lane pair keeps the sums of the pair at the same index of every
+ * 256 byte block of 32 pairs, which are multiplied by M^32 for every block,
+ * so that the sums of the lanes do not depend on each other
+ * The size must be a multiple of 256
+ */
+CPU_FEATURES_TARGET( "avx2" )
+static void sqlite_wal_checksum_calculate_avx2(
+             uint32_t *checksum1,
+             uint32_t *checksum2,
+             const uint8_t *buffer,
+             size_t size,
+             uint8_t byte_order )
+{
+	uint32_t sums[ 64 ];
+
+	__m256i byte_swap_mask;
+	__m256i lane_sums[ 8 ];
+	__m256i multipliers1;
+	__m256i multipliers2;
+	__m256i value;
+
+	size_t buffer_offset = 0;
+	int lane_index       = 0;
+
+	/* M^32 = [ 0xc7b064e2 0x61ca20bb ; 0x61ca20bb 0x297a859d ] modulo 2^32
+	 */
+	multipliers1 = _mm256_set_epi32(
+	                0x297a859d,
+	                (int) 0xc7b064e2UL,
+	                0x297a859d,
+	                (int) 0xc7b064e2UL,
+	                0x297a859d,
+	                (int) 0xc7b064e2UL,
+	                0x297a859d,
+	                (int) 0xc7b064e2UL );
+
+	multipliers2 = _mm256_set1_epi32(
+	                0x61ca20bb );
+
+	byte_swap_mask = _mm256_set_epi8(
+	                  12, 13, 14, 15, 8, 9, 10, 11, 4, 5, 6, 7, 0, 1, 2, 3,
+	                  12, 13, 14, 15, 8, 9, 10, 11, 4, 5, 6, 7, 0, 1, 2, 3 );
+
+	for( lane_index = 0;
+	     lane_index < 8;
+	     lane_index++ )
+	{
+		lane_sums[ lane_index ] = _mm256_setzero_si256();
+	}
+	/* The checksum of the preceding data is multiplied by M^32 for every block
+	 * by the lanes of the last pair, which are not multiplied when combined
+	 */
+	lane_sums[ 7 ] = _mm256_set_epi32(
+	                  (int) *checksum2,
+	                  (int) *checksum1,
+	                  0,
+	                  0,
+	                  0,
+	                  0,
+	                  0,
+	                  0 );
+
+	for( buffer_offset = 0;
+	     buffer_offset < size;
+	     buffer_offset += 256 )
+	{
+		for( lane_index = 0;
+		     lane_index < 8;
+		     lane_index++ )
+		{
+			value = _mm256_loadu_si256(
+			         (__m256i *) &( buffer[ buffer_offset + ( lane_index * 32 ) ] ) );
+
+			if( byte_order == SQLITE_WAL_BYTE_ORDER_BIG_ENDIAN )
+			{
+				value = _mm256_shuffle_epi8(
+				         value,
+				         byte_swap_mask );
+			}
+			/* ( value1, value2 ) => ( value1, value1 + value2 )
+			 */
+			value = _mm256_add_epi32(
+			         value,
+			         _mm256_slli_epi64(
+			          value,
+			          32 ) );
+
+			lane_sums[ lane_index ] = _mm256_add_epi32(
+			                           _mm256_add_epi32(
+			                            _mm256_mullo_epi32(
+			                             lane_sums[ lane_index ],
+			                             multipliers1 ),
+			                            _mm256_mullo_epi32(
+			                             _mm256_shuffle_epi32(
+			                              lane_sums[ lane_index ],
+			                              _MM_SHUFFLE( 2, 3, 0, 1 ) ),
+			                             multipliers2 ) ),
+			                           value );
+		}
+	}
+	for( lane_index = 0;
+	     lane_index < 8;
+	     lane_index++ )
+	{
+		_mm256_storeu_si256(
+		 (__m256i *) &( sums[ lane_index * 8 ] ),
+		 lane_sums[ lane_index ] );
+	}
+	sqlite_wal_checksum_combine_sums(
+	 checksum1,
+	 checksum2,
+	 sums,
+	 32 );
+}
+
+#endif /* defined( HAVE_CPU_FEATURES_X86 ) */
+
+/* Calculates the WAL checksum of a buffer
+ * Uses the SIMD instructions of the CPU if available, otherwise falls back to the basic variant
+ *
+ * On x86 AVX2 or SSE4.1 is used. The recurrence of the sums is linear, hence the sums of the pairs
+ * at the same index of consecutive SIMD blocks are calculated independently in separate lanes and
+ * combined at the end. The data that remains after the last SIMD block is calculated with the basic
+ * variant.
+ *
+ * The size must be a multiple of 8
+ * The checksum values contain the checksum of the preceding data and are updated
+ * Returns 1 if successful or -1 on error
+ */
+int sqlite_wal_checksum_calculate_simd(
+     uint32_t *checksum1,
+     uint32_t *checksum2,
+     const uint8_t *buffer,
+     size_t size,
+     uint8_t byte_order,
+     libcerror_error_t **error )
+{
+	static char *function = "sqlite_wal_checksum_calculate_simd";
+	size_t buffer_offset  = 0;
+	size_t block_size     = 0;
+
+	if( checksum1 == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid checksum1.",
+		 function );
+
+		return( -1 );
+	}
+	if( checksum2 == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid checksum2.",
+		 function );
+
+		return( -1 );
+	}
+	if( buffer == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid buffer.",
+		 function );
+
+		return( -1 );
+	}
+	if( size > (size_t) SSIZE_MAX )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid size value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( size % 8 ) != 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_UNSUPPORTED_VALUE,
+		 "%s: invalid size value not a multiple of 8.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( byte_order != SQLITE_WAL_BYTE_ORDER_BIG_ENDIAN )
+	 && ( byte_order != SQLITE_WAL_BYTE_ORDER_LITTLE_ENDIAN ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_UNSUPPORTED_VALUE,
+		 "%s: unsupported byte order.",
+		 function );
+
+		return( -1 );
+	}
+#if defined( HAVE_CPU_FEATURES_X86 )
+	if( ( size >= 256 )
+	 && ( cpu_features_has(
+	       CPU_FEATURE_FLAG_AVX2 ) != 0 ) )
+	{
+		block_size = size & ~( (size_t) 255 );
+
+		sqlite_wal_checksum_calculate_avx2(
+		 checksum1,
+		 checksum2,
+		 buffer,
+		 block_size,
+		 byte_order );
+
+		buffer_offset = block_size;
+	}
+	else if( ( size >= 128 )
+	      && ( cpu_features_has(
+	            CPU_FEATURE_FLAG_SSE4_1 ) != 0 ) )
+	{
+		block_size = size & ~( (size_t) 127 );
+
+		sqlite_wal_checksum_calculate_sse41(
+		 checksum1,
+		 checksum2,
+		 buffer,
+		 block_size,
+		 byte_order );
+
+		buffer_offset = block_size;
+	}
+#endif
+	/* Calculate the remaining data using the basic variant
+	 */
+	if( sqlite_wal_checksum_calculate(
+	     checksum1,
+	     checksum2,
+	     &( buffer[ buffer_offset ] ),
+	     size - buffer_offset,
+	     byte_order,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GENERIC,
+		 "%s: unable to calculate checksum of remaining data.",
+		 function );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Reads the WAL file header
+ * Returns 1 if successful, 0 if the checksum of the file header does not match or -1 on error
+ */
+int sqlite_wal_read_file_header(
+     sqlite_wal_file_header_t *file_header,
+     const uint8_t *data,
+     size_t data_size,
+     libcerror_error_t **error )
+{
+	static char *function = "sqlite_wal_read_file_header";
+	uint32_t checksum1    = 0;
+	uint32_t checksum2    = 0;
+	uint32_t signature    = 0;
+
+	if( file_header == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file header.",
+		 function );
+
+		return( -1 );
+	}
+	if( data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid data.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( data_size < SQLITE_WAL_FILE_HEADER_SIZE )
+	 || ( data_size > (size_t) SSIZE_MAX ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid data size value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	byte_stream_copy_to_uint32_big_endian(
+	 &( data[ 0 ] ),
+	 signature );
+
+	if( ( signature & ~( (uint32_t) 1 ) ) != SQLITE_WAL_SIGNATURE )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_UNSUPPORTED_VALUE,
+		 "%s: unsupported signature.",
+		 function );
+
+		return( -1 );
+	}
+	file_header->byte_order = (uint8_t) ( signature & 1 );
+
+	byte_stream_copy_to_uint32_big_endian(
+	 &( data[ 4 ] ),
+	 file_header->format_version );
+
+	byte_stream_copy_to_uint32_big_endian(
+	 &( data[ 8 ] ),
+	 file_header->page_size );
+
+	byte_stream_copy_to_uint32_big_endian(
+	 &( data[ 12 ] ),
+	 file_header->checkpoint_sequence_number );
+
+	byte_stream_copy_to_uint32_big_endian(
+	 &( data[ 16 ] ),
+	 file_header->salt1 );
+
+	byte_stream_copy_to_uint32_big_endian(
+	 &( data[ 20 ] ),
+	 file_header->salt2 );
+
+	byte_stream_copy_to_uint32_big_endian(
+	 &( data[ 24 ] ),
+	 file_header->checksum1 );
+
+	byte_stream_copy_to_uint32_big_endian(
+	 &( data[ 28 ] ),
+	 file_header->checksum2 );
+
+	/* The page size is a power of 2 between 512 and 65536
+	 */
+	if( ( file_header->page_size < 512 )
+	 || ( file_header->page_size > 65536 )
+	 || ( ( file_header->page_size & ( file_header->page_size - 1 ) ) != 0 ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_UNSUPPORTED_VALUE,
+		 "%s: unsupported page size: %" PRIu32 ".",
+		 function,
+		 file_header->page_size );
+
+		return( -1 );
+	}
+	/* The checksum is calculated over the first 24 bytes of the file header
+	 */
+	if( sqlite_wal_checksum_calculate(
+	     &checksum1,
+	     &checksum2,
+	     data,
+	     24,
+	     file_header->byte_order,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GENERIC,
+		 "%s: unable to calculate checksum.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( checksum1 != file_header->checksum1 )
+	 || ( checksum2 != file_header->checksum2 ) )
+	{
+		return( 0 );
+	}
+	return( 1 );
+}
+
+/* Reads a WAL frame header
+ * Returns 1 if successful or -1 on error
+ */
+int sqlite_wal_frame_read_header(
+     sqlite_wal_frame_header_t *frame_header,
+     const uint8_t *data,
+     size_t data_size,
+     libcerror_error_t **error )
+{
+	static char *function = "sqlite_wal_frame_read_header";
+
+	if( frame_header == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid frame header.",
+		 function );
+
+		return( -1 );
+	}
+	if( data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid data.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( data_size < SQLITE_WAL_FRAME_HEADER_SIZE )
+	 || ( data_size > (size_t) SSIZE_MAX ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid data size value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	byte_stream_copy_to_uint32_big_endian(
+	 &( data[ 0 ] ),
+	 frame_header->page_number );
+
+	byte_stream_copy_to_uint32_big_endian(
+	 &( data[ 4 ] ),
+	 frame_header->database_size );
+
+	byte_stream_copy_to_uint32_big_endian(
+	 &( data[ 8 ] ),
+	 frame_header->salt1 );
+
+	byte_stream_copy_to_uint32_big_endian(
+	 &( data[ 12 ] ),
+	 frame_header->salt2 );
+
+	byte_stream_copy_to_uint32_big_endian(
+	 &( data[ 16 ] ),
+	 frame_header->checksum1 );
+
+	byte_stream_copy_to_uint32_big_endian(
+	 &( data[ 20 ] ),
+	 frame_header->checksum2 );
+
+	return( 1 );
+}
+
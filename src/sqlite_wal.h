@@ -0,0 +1,147 @@
+/*
+ * SQLite write-ahead log (WAL) functions
+ *
+ * Copyright (C) 2008-2019, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This software is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This software is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this software.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#if !defined( _SQLITE_WAL_H )
+#define _SQLITE_WAL_H
+
+#include <common.h>
+#include <types.h>
+
+#include "assorted_libcerror.h"
+
+#if defined( __cplusplus )
+extern "C" {
+#endif
+
+/* The size of the WAL file header
+ */
+#define SQLITE_WAL_FILE_HEADER_SIZE		32
+
+/* The size of the WAL frame header
+ */
+#define SQLITE_WAL_FRAME_HEADER_SIZE		24
+
+/* The size of the data at the start of the frame header that is included in the checksum
+ */
+#define SQLITE_WAL_FRAME_HEADER_CHECKSUM_SIZE	8
+
+/* The signature, where the least significant bit indicates the byte order
+ * of the 32-bit values of which the checksum is calculated
+ */
+#define SQLITE_WAL_SIGNATURE			0x377f0682UL
+
+/* The byte orders of the 32-bit values of which the checksum is calculated
+ */
+enum SQLITE_WAL_BYTE_ORDERS
+{
+	SQLITE_WAL_BYTE_ORDER_LITTLE_ENDIAN	= 0,
+	SQLITE_WAL_BYTE_ORDER_BIG_ENDIAN	= 1
+};
+
+typedef struct sqlite_wal_file_header sqlite_wal_file_header_t;
+
+struct sqlite_wal_file_header
+{
+	/* The byte order of the 32-bit values of which the checksum is calculated
+	 */
+	uint8_t byte_order;
+
+	/* The format version
+	 */
+	uint32_t format_version;
+
+	/* The page size
+	 */
+	uint32_t page_size;
+
+	/* The checkpoint sequence number
+	 */
+	uint32_t checkpoint_sequence_number;
+
+	/* The salt values, which are copied into every frame header
+	 */
+	uint32_t salt1;
+	uint32_t salt2;
+
+	/* The checksum values, which are the initial checksum values of the first frame
+	 */
+	uint32_t checksum1;
+	uint32_t checksum2;
+};
+
+typedef struct sqlite_wal_frame_header sqlite_wal_frame_header_t;
+
+struct sqlite_wal_frame_header
+{
+	/* The page number
+	 */
+	uint32_t page_number;
+
+	/* The database size in pages, which is non-zero for the last frame of a commit
+	 */
+	uint32_t database_size;
+
+	/* The salt values
+	 */
+	uint32_t salt1;
+	uint32_t salt2;
+
+	/* The cumulative checksum values of the WAL file header and the frames
+	 * up to and including this frame
+	 */
+	uint32_t checksum1;
+	uint32_t checksum2;
+};
+
+int sqlite_wal_checksum_calculate(
+     uint32_t *checksum1,
+     uint32_t *checksum2,
+     const uint8_t *buffer,
+     size_t size,
+     uint8_t byte_order,
+     libcerror_error_t **error );
+
+int sqlite_wal_checksum_calculate_simd(
+     uint32_t *checksum1,
+     uint32_t *checksum2,
+     const uint8_t *buffer,
+     size_t size,
+     uint8_t byte_order,
+     libcerror_error_t **error );
+
+int sqlite_wal_read_file_header(
+     sqlite_wal_file_header_t *file_header,
+     const uint8_t *data,
+     size_t data_size,
+     libcerror_error_t **error );
+
+int sqlite_wal_frame_read_header(
+     sqlite_wal_frame_header_t *frame_header,
+     const uint8_t *data,
+     size_t data_size,
+     libcerror_error_t **error );
+
+#if defined( __cplusplus )
+}
+#endif
+
+#endif /* !defined( _SQLITE_WAL_H ) */
+
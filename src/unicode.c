@@ -0,0 +1,185 @@
+/*
+ * Unicode case folding and normalization functions
+ *
+ * Copyright (C) 2008-2019, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This software is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This software is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this software.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <types.h>
+
+#include "assorted_libcerror.h"
+#include "unicode.h"
+#include "unicode_tables.h"
+
+/* The Hangul syllables are decomposed algorithmically
+ */
+#define UNICODE_HANGUL_SYLLABLE_BASE		0x0000ac00UL
+#define UNICODE_HANGUL_LEADING_JAMO_BASE	0x00001100UL
+#define UNICODE_HANGUL_VOWEL_JAMO_BASE		0x00001161UL
+#define UNICODE_HANGUL_TRAILING_JAMO_BASE	0x000011a7UL
+#define UNICODE_HANGUL_NUMBER_OF_VOWEL_JAMOS	21
+#define UNICODE_HANGUL_NUMBER_OF_TRAILING_JAMOS	28
+#define UNICODE_HANGUL_NUMBER_OF_SYLLABLES	11172
+
+/* Determines the simple case folding of an Unicode character
+ * The case folding is looked up in the two-stage tables generated by scripts/unicode_tables.py
+ * Returns the case folded Unicode character
+ */
+uint32_t unicode_get_case_folded_character(
+          uint32_t unicode_character )
+{
+	uint32_t page_index = 0;
+	uint8_t delta_index = 0;
+
+	page_index = unicode_character / UNICODE_TABLES_BLOCK_SIZE;
+
+	if( page_index >= unicode_tables_case_folding_number_of_pages )
+	{
+		return( unicode_character );
+	}
+	delta_index = unicode_tables_case_folding_blocks[ ( (uint32_t) unicode_tables_case_folding_pages[ page_index ] * UNICODE_TABLES_BLOCK_SIZE ) + ( unicode_character % UNICODE_TABLES_BLOCK_SIZE ) ];
+
+	return( (uint32_t) ( (int32_t) unicode_character + unicode_tables_case_folding_deltas[ delta_index ] ) );
+}
+
+/* Retrieves the NFD (canonical) decomposition of an Unicode character
+ * The decomposition is looked up in the two-stage tables generated by scripts/unicode_tables.py
+ * except for the Hangul syllables that are decomposed algorithmically
+ * Returns 1 if successful, 0 if the character has no decomposition or -1 on error
+ */
+int unicode_get_nfd_decomposition(
+     uint32_t unicode_character,
+     uint32_t *decomposition,
+     size_t decomposition_size,
+     size_t *decomposition_length,
+     libcerror_error_t **error )
+{
+	static char *function   = "unicode_get_nfd_decomposition";
+	size_t sequence_length  = 0;
+	size_t sequence_offset  = 0;
+	uint32_t page_index     = 0;
+	uint32_t syllable_index = 0;
+	uint16_t sequence_index = 0;
+
+	if( decomposition == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid decomposition.",
+		 function );
+
+		return( -1 );
+	}
+	if( decomposition_size > (size_t) SSIZE_MAX )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid decomposition size value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	if( decomposition_length == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid decomposition length.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( unicode_character >= UNICODE_HANGUL_SYLLABLE_BASE )
+	 && ( unicode_character < ( UNICODE_HANGUL_SYLLABLE_BASE + UNICODE_HANGUL_NUMBER_OF_SYLLABLES ) ) )
+	{
+		syllable_index = unicode_character - UNICODE_HANGUL_SYLLABLE_BASE;
+
+		if( ( syllable_index % UNICODE_HANGUL_NUMBER_OF_TRAILING_JAMOS ) == 0 )
+		{
+			sequence_length = 2;
+		}
+		else
+		{
+			sequence_length = 3;
+		}
+		if( sequence_length > decomposition_size )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+			 LIBCERROR_ARGUMENT_ERROR_VALUE_TOO_SMALL,
+			 "%s: invalid decomposition size value too small.",
+			 function );
+
+			return( -1 );
+		}
+		decomposition[ 0 ] = UNICODE_HANGUL_LEADING_JAMO_BASE
+		                   + ( syllable_index / ( UNICODE_HANGUL_NUMBER_OF_VOWEL_JAMOS * UNICODE_HANGUL_NUMBER_OF_TRAILING_JAMOS ) );
+		decomposition[ 1 ] = UNICODE_HANGUL_VOWEL_JAMO_BASE
+		                   + ( ( syllable_index % ( UNICODE_HANGUL_NUMBER_OF_VOWEL_JAMOS * UNICODE_HANGUL_NUMBER_OF_TRAILING_JAMOS ) ) / UNICODE_HANGUL_NUMBER_OF_TRAILING_JAMOS );
+
+		if( sequence_length == 3 )
+		{
+			decomposition[ 2 ] = UNICODE_HANGUL_TRAILING_JAMO_BASE
+			                   + ( syllable_index % UNICODE_HANGUL_NUMBER_OF_TRAILING_JAMOS );
+		}
+		*decomposition_length = sequence_length;
+
+		return( 1 );
+	}
+	page_index = unicode_character / UNICODE_TABLES_BLOCK_SIZE;
+
+	if( page_index >= unicode_tables_nfd_number_of_pages )
+	{
+		return( 0 );
+	}
+	sequence_index = unicode_tables_nfd_blocks[ ( (uint32_t) unicode_tables_nfd_pages[ page_index ] * UNICODE_TABLES_BLOCK_SIZE ) + ( unicode_character % UNICODE_TABLES_BLOCK_SIZE ) ];
+
+	if( sequence_index == 0 )
+	{
+		return( 0 );
+	}
+	sequence_length = (size_t) unicode_tables_nfd_sequences[ sequence_index++ ];
+
+	if( sequence_length > decomposition_size )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_TOO_SMALL,
+		 "%s: invalid decomposition size value too small.",
+		 function );
+
+		return( -1 );
+	}
+	for( sequence_offset = 0;
+	     sequence_offset < sequence_length;
+	     sequence_offset++ )
+	{
+		decomposition[ sequence_offset ] = unicode_tables_nfd_sequences[ sequence_index++ ];
+	}
+	*decomposition_length = sequence_length;
+
+	return( 1 );
+}
+
@@ -0,0 +1,53 @@
+/*
+ * Unicode case folding and normalization functions
+ *
+ * Copyright (C) 2008-2019, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This software is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This software is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this software.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#if !defined( _UNICODE_H )
+#define _UNICODE_H
+
+#include <common.h>
+#include <types.h>
+
+#include "assorted_libcerror.h"
+
+#if defined( __cplusplus )
+extern "C" {
+#endif
+
+/* The maximum number of characters of a NFD decomposition of a single Unicode character
+ */
+#define UNICODE_NFD_MAXIMUM_DECOMPOSITION_LENGTH	4
+
+uint32_t unicode_get_case_folded_character(
+          uint32_t unicode_character );
+
+int unicode_get_nfd_decomposition(
+     uint32_t unicode_character,
+     uint32_t *decomposition,
+     size_t decomposition_size,
+     size_t *decomposition_length,
+     libcerror_error_t **error );
+
+#if defined( __cplusplus )
+}
+#endif
+
+#endif /* !defined( _UNICODE_H ) */
+
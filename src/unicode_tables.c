@@ -0,0 +1,1812 @@
+/*
+ * Unicode case folding and NFD tables
+ *
+ * This file was generated by scripts/unicode_tables.py, do not edit.
+ * Unicode version: 14.0.0 (Python unicodedata)
+ *
+ * Copyright (C) 2008-2019, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This software is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This software is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this software.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <types.h>
+
+#include "unicode_tables.h"
+
+/* The case folding tables
+ * The 490 pages map a block of 256 Unicode characters onto one of the 25 distinct blocks
+ * and the blocks contain the index of the difference between the case folded and the Unicode character
+ */
+const uint32_t unicode_tables_case_folding_number_of_pages = 490;
+
+const uint8_t unicode_tables_case_folding_pages[ 490 ] = {
+	0, 1, 2, 3, 4, 5, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6,
+	7, 6, 6, 8, 6, 6, 6, 6, 6, 6, 6, 6, 9, 6, 10, 11,
+	6, 12, 6, 6, 13, 6, 6, 6, 6, 6, 6, 6, 14, 6, 6, 6,
+	6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6,
+	6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6,
+	6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6,
+	6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6,
+	6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6,
+	6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6,
+	6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6,
+	6, 6, 6, 6, 6, 6, 15, 16, 6, 6, 6, 17, 6, 6, 6, 6,
+	6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6,
+	6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6,
+	6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6,
+	6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6,
+	6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 18,
+	6, 6, 6, 6, 19, 20, 6, 6, 6, 6, 6, 6, 21, 6, 6, 6,
+	6, 6, 6, 6, 6, 6, 6, 6, 22, 6, 6, 6, 6, 6, 6, 6,
+	6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6,
+	6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6,
+	6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6,
+	6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6,
+	6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 23, 6,
+	6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6,
+	6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6,
+	6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6,
+	6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6,
+	6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6,
+	6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6,
+	6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6,
+	6, 6, 6, 6, 6, 6, 6, 6, 6, 24
+};
+
+const uint8_t unicode_tables_case_folding_blocks[ 6400 ] = {
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+	1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+	1, 1, 1, 1, 1, 1, 1, 0, 1, 1, 1, 1, 1, 1, 1, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	3, 0, 3, 0, 3, 0, 3, 0, 3, 0, 3, 0, 3, 0, 3, 0,
+	3, 0, 3, 0, 3, 0, 3, 0, 3, 0, 3, 0, 3, 0, 3, 0,
+	3, 0, 3, 0, 3, 0, 3, 0, 3, 0, 3, 0, 3, 0, 3, 0,
+	0, 0, 3, 0, 3, 0, 3, 0, 0, 3, 0, 3, 0, 3, 0, 3,
+	0, 3, 0, 3, 0, 3, 0, 3, 0, 0, 3, 0, 3, 0, 3, 0,
+	3, 0, 3, 0, 3, 0, 3, 0, 3, 0, 3, 0, 3, 0, 3, 0,
+	3, 0, 3, 0, 3, 0, 3, 0, 3, 0, 3, 0, 3, 0, 3, 0,
+	3, 0, 3, 0, 3, 0, 3, 0, 4, 3, 0, 3, 0, 3, 0, 5,
+	0, 6, 3, 0, 3, 0, 7, 3, 0, 8, 8, 3, 0, 0, 9, 10,
+	11, 3, 0, 8, 12, 0, 13, 14, 3, 0, 0, 0, 13, 15, 0, 16,
+	3, 0, 3, 0, 3, 0, 17, 3, 0, 17, 0, 0, 3, 0, 17, 3,
+	0, 18, 18, 3, 0, 3, 0, 19, 3, 0, 0, 0, 3, 0, 0, 0,
+	0, 0, 0, 0, 20, 3, 0, 20, 3, 0, 20, 3, 0, 3, 0, 3,
+	0, 3, 0, 3, 0, 3, 0, 3, 0, 3, 0, 3, 0, 0, 3, 0,
+	3, 0, 3, 0, 3, 0, 3, 0, 3, 0, 3, 0, 3, 0, 3, 0,
+	0, 20, 3, 0, 3, 0, 21, 22, 3, 0, 3, 0, 3, 0, 3, 0,
+	3, 0, 3, 0, 3, 0, 3, 0, 3, 0, 3, 0, 3, 0, 3, 0,
+	3, 0, 3, 0, 3, 0, 3, 0, 3, 0, 3, 0, 3, 0, 3, 0,
+	23, 0, 3, 0, 3, 0, 3, 0, 3, 0, 3, 0, 3, 0, 3, 0,
+	3, 0, 3, 0, 0, 0, 0, 0, 0, 0, 24, 3, 0, 25, 26, 0,
+	0, 3, 0, 27, 28, 29, 3, 0, 3, 0, 3, 0, 3, 0, 3, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 30, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	3, 0, 3, 0, 0, 0, 3, 0, 0, 0, 0, 0, 0, 0, 0, 30,
+	0, 0, 0, 0, 0, 0, 31, 0, 32, 32, 32, 0, 33, 0, 34, 34,
+	0, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+	1, 1, 0, 1, 1, 1, 1, 1, 1, 1, 1, 1, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 3, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 35,
+	36, 37, 0, 0, 0, 38, 39, 0, 3, 0, 3, 0, 3, 0, 3, 0,
+	3, 0, 3, 0, 3, 0, 3, 0, 3, 0, 3, 0, 3, 0, 3, 0,
+	40, 41, 0, 0, 42, 43, 0, 3, 0, 44, 3, 0, 0, 23, 23, 23,
+	45, 45, 45, 45, 45, 45, 45, 45, 45, 45, 45, 45, 45, 45, 45, 45,
+	1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+	1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	3, 0, 3, 0, 3, 0, 3, 0, 3, 0, 3, 0, 3, 0, 3, 0,
+	3, 0, 3, 0, 3, 0, 3, 0, 3, 0, 3, 0, 3, 0, 3, 0,
+	3, 0, 0, 0, 0, 0, 0, 0, 0, 0, 3, 0, 3, 0, 3, 0,
+	3, 0, 3, 0, 3, 0, 3, 0, 3, 0, 3, 0, 3, 0, 3, 0,
+	3, 0, 3, 0, 3, 0, 3, 0, 3, 0, 3, 0, 3, 0, 3, 0,
+	3, 0, 3, 0, 3, 0, 3, 0, 3, 0, 3, 0, 3, 0, 3, 0,
+	46, 3, 0, 3, 0, 3, 0, 3, 0, 3, 0, 3, 0, 3, 0, 0,
+	3, 0, 3, 0, 3, 0, 3, 0, 3, 0, 3, 0, 3, 0, 3, 0,
+	3, 0, 3, 0, 3, 0, 3, 0, 3, 0, 3, 0, 3, 0, 3, 0,
+	3, 0, 3, 0, 3, 0, 3, 0, 3, 0, 3, 0, 3, 0, 3, 0,
+	3, 0, 3, 0, 3, 0, 3, 0, 3, 0, 3, 0, 3, 0, 3, 0,
+	3, 0, 3, 0, 3, 0, 3, 0, 3, 0, 3, 0, 3, 0, 3, 0,
+	3, 0, 3, 0, 3, 0, 3, 0, 3, 0, 3, 0, 3, 0, 3, 0,
+	0, 47, 47, 47, 47, 47, 47, 47, 47, 47, 47, 47, 47, 47, 47, 47,
+	47, 47, 47, 47, 47, 47, 47, 47, 47, 47, 47, 47, 47, 47, 47, 47,
+	47, 47, 47, 47, 47, 47, 47, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48,
+	48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48,
+	48, 48, 48, 48, 48, 48, 0, 48, 0, 0, 0, 0, 0, 48, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 49, 49, 49, 49, 49, 49, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	50, 51, 52, 53, 53, 54, 55, 56, 57, 0, 0, 0, 0, 0, 0, 0,
+	58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58,
+	58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58,
+	58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 0, 0, 58, 58, 58,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	3, 0, 3, 0, 3, 0, 3, 0, 3, 0, 3, 0, 3, 0, 3, 0,
+	3, 0, 3, 0, 3, 0, 3, 0, 3, 0, 3, 0, 3, 0, 3, 0,
+	3, 0, 3, 0, 3, 0, 3, 0, 3, 0, 3, 0, 3, 0, 3, 0,
+	3, 0, 3, 0, 3, 0, 3, 0, 3, 0, 3, 0, 3, 0, 3, 0,
+	3, 0, 3, 0, 3, 0, 3, 0, 3, 0, 3, 0, 3, 0, 3, 0,
+	3, 0, 3, 0, 3, 0, 3, 0, 3, 0, 3, 0, 3, 0, 3, 0,
+	3, 0, 3, 0, 3, 0, 3, 0, 3, 0, 3, 0, 3, 0, 3, 0,
+	3, 0, 3, 0, 3, 0, 3, 0, 3, 0, 3, 0, 3, 0, 3, 0,
+	3, 0, 3, 0, 3, 0, 3, 0, 3, 0, 3, 0, 3, 0, 3, 0,
+	3, 0, 3, 0, 3, 0, 0, 0, 0, 0, 0, 59, 0, 0, 60, 0,
+	3, 0, 3, 0, 3, 0, 3, 0, 3, 0, 3, 0, 3, 0, 3, 0,
+	3, 0, 3, 0, 3, 0, 3, 0, 3, 0, 3, 0, 3, 0, 3, 0,
+	3, 0, 3, 0, 3, 0, 3, 0, 3, 0, 3, 0, 3, 0, 3, 0,
+	3, 0, 3, 0, 3, 0, 3, 0, 3, 0, 3, 0, 3, 0, 3, 0,
+	3, 0, 3, 0, 3, 0, 3, 0, 3, 0, 3, 0, 3, 0, 3, 0,
+	3, 0, 3, 0, 3, 0, 3, 0, 3, 0, 3, 0, 3, 0, 3, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 49, 49, 49, 49, 49, 49, 49, 49,
+	0, 0, 0, 0, 0, 0, 0, 0, 49, 49, 49, 49, 49, 49, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 49, 49, 49, 49, 49, 49, 49, 49,
+	0, 0, 0, 0, 0, 0, 0, 0, 49, 49, 49, 49, 49, 49, 49, 49,
+	0, 0, 0, 0, 0, 0, 0, 0, 49, 49, 49, 49, 49, 49, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 49, 0, 49, 0, 49, 0, 49,
+	0, 0, 0, 0, 0, 0, 0, 0, 49, 49, 49, 49, 49, 49, 49, 49,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 49, 49, 49, 49, 49, 49, 49, 49,
+	0, 0, 0, 0, 0, 0, 0, 0, 49, 49, 49, 49, 49, 49, 49, 49,
+	0, 0, 0, 0, 0, 0, 0, 0, 49, 49, 49, 49, 49, 49, 49, 49,
+	0, 0, 0, 0, 0, 0, 0, 0, 49, 49, 61, 61, 62, 0, 63, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 64, 64, 64, 64, 62, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 49, 49, 65, 65, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 49, 49, 66, 66, 44, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 67, 67, 68, 68, 62, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 69, 0, 0, 0, 70, 71, 0, 0, 0, 0,
+	0, 0, 72, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	73, 73, 73, 73, 73, 73, 73, 73, 73, 73, 73, 73, 73, 73, 73, 73,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 3, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74,
+	74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	47, 47, 47, 47, 47, 47, 47, 47, 47, 47, 47, 47, 47, 47, 47, 47,
+	47, 47, 47, 47, 47, 47, 47, 47, 47, 47, 47, 47, 47, 47, 47, 47,
+	47, 47, 47, 47, 47, 47, 47, 47, 47, 47, 47, 47, 47, 47, 47, 47,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	3, 0, 75, 76, 77, 0, 0, 3, 0, 3, 0, 3, 0, 78, 79, 80,
+	81, 0, 3, 0, 0, 3, 0, 0, 0, 0, 0, 0, 0, 0, 82, 82,
+	3, 0, 3, 0, 3, 0, 3, 0, 3, 0, 3, 0, 3, 0, 3, 0,
+	3, 0, 3, 0, 3, 0, 3, 0, 3, 0, 3, 0, 3, 0, 3, 0,
+	3, 0, 3, 0, 3, 0, 3, 0, 3, 0, 3, 0, 3, 0, 3, 0,
+	3, 0, 3, 0, 3, 0, 3, 0, 3, 0, 3, 0, 3, 0, 3, 0,
+	3, 0, 3, 0, 3, 0, 3, 0, 3, 0, 3, 0, 3, 0, 3, 0,
+	3, 0, 3, 0, 3, 0, 3, 0, 3, 0, 3, 0, 3, 0, 3, 0,
+	3, 0, 3, 0, 0, 0, 0, 0, 0, 0, 0, 3, 0, 3, 0, 0,
+	0, 0, 3, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	3, 0, 3, 0, 3, 0, 3, 0, 3, 0, 3, 0, 3, 0, 3, 0,
+	3, 0, 3, 0, 3, 0, 3, 0, 3, 0, 3, 0, 3, 0, 3, 0,
+	3, 0, 3, 0, 3, 0, 3, 0, 3, 0, 3, 0, 3, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	3, 0, 3, 0, 3, 0, 3, 0, 3, 0, 3, 0, 3, 0, 3, 0,
+	3, 0, 3, 0, 3, 0, 3, 0, 3, 0, 3, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 3, 0, 3, 0, 3, 0, 3, 0, 3, 0, 3, 0, 3, 0,
+	0, 0, 3, 0, 3, 0, 3, 0, 3, 0, 3, 0, 3, 0, 3, 0,
+	3, 0, 3, 0, 3, 0, 3, 0, 3, 0, 3, 0, 3, 0, 3, 0,
+	3, 0, 3, 0, 3, 0, 3, 0, 3, 0, 3, 0, 3, 0, 3, 0,
+	3, 0, 3, 0, 3, 0, 3, 0, 3, 0, 3, 0, 3, 0, 3, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 3, 0, 3, 0, 83, 3, 0,
+	3, 0, 3, 0, 3, 0, 3, 0, 0, 0, 0, 3, 0, 84, 0, 0,
+	3, 0, 3, 0, 0, 0, 3, 0, 3, 0, 3, 0, 3, 0, 3, 0,
+	3, 0, 3, 0, 3, 0, 3, 0, 3, 0, 85, 86, 87, 88, 85, 0,
+	89, 90, 91, 92, 3, 0, 3, 0, 3, 0, 3, 0, 3, 0, 3, 0,
+	3, 0, 3, 0, 41, 93, 94, 3, 0, 3, 0, 0, 0, 0, 0, 0,
+	3, 0, 0, 0, 0, 0, 3, 0, 3, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 3, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	95, 95, 95, 95, 95, 95, 95, 95, 95, 95, 95, 95, 95, 95, 95, 95,
+	95, 95, 95, 95, 95, 95, 95, 95, 95, 95, 95, 95, 95, 95, 95, 95,
+	95, 95, 95, 95, 95, 95, 95, 95, 95, 95, 95, 95, 95, 95, 95, 95,
+	95, 95, 95, 95, 95, 95, 95, 95, 95, 95, 95, 95, 95, 95, 95, 95,
+	95, 95, 95, 95, 95, 95, 95, 95, 95, 95, 95, 95, 95, 95, 95, 95,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+	1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96,
+	96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96,
+	96, 96, 96, 96, 96, 96, 96, 96, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96,
+	96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96,
+	96, 96, 96, 96, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	97, 97, 97, 97, 97, 97, 97, 97, 97, 97, 97, 0, 97, 97, 97, 97,
+	97, 97, 97, 97, 97, 97, 97, 97, 97, 97, 97, 0, 97, 97, 97, 97,
+	97, 97, 97, 0, 97, 97, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33,
+	33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33,
+	33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33,
+	33, 33, 33, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+	1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+	1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	98, 98, 98, 98, 98, 98, 98, 98, 98, 98, 98, 98, 98, 98, 98, 98,
+	98, 98, 98, 98, 98, 98, 98, 98, 98, 98, 98, 98, 98, 98, 98, 98,
+	98, 98, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0
+};
+
+const int32_t unicode_tables_case_folding_deltas[ 99 ] = {
+	0, 32, 775, 1, -121, -268, 210, 206,
+	205, 79, 202, 203, 207, 211, 209, 213,
+	214, 218, 217, 219, 2, -97, -56, -130,
+	10795, -163, 10792, -195, 69, 71, 116, 38,
+	37, 64, 63, 8, -30, -25, -15, -22,
+	-54, -48, -60, -64, -7, 80, 15, 48,
+	7264, -8, -6222, -6221, -6212, -6210, -6211, -6204,
+	-6180, 35267, -3008, -58, -7615, -74, -9, -7173,
+	-86, -100, -112, -128, -126, -7517, -8383, -8262,
+	28, 16, 26, -10743, -3814, -10727, -10780, -10749,
+	-10783, -10782, -10815, -35332, -42280, -42308, -42319, -42315,
+	-42305, -42258, -42282, -42261, 928, -42307, -35384, -38864,
+	40, 39, 34
+};
+
+/* The NFD tables
+ * The 763 pages map a block of 256 Unicode characters onto one of the 36 distinct blocks
+ * and the blocks contain the index of the decomposition in the sequences
+ * The longest decomposition consists of 4 characters
+ */
+const uint32_t unicode_tables_nfd_number_of_pages = 763;
+
+const uint8_t unicode_tables_nfd_pages[ 763 ] = {
+	0, 1, 2, 3, 4, 5, 6, 5, 5, 7, 8, 9, 10, 11, 5, 12,
+	13, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 14, 5, 5, 15, 16,
+	17, 18, 19, 20, 5, 5, 5, 5, 5, 5, 21, 5, 5, 5, 5, 5,
+	22, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+	5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+	5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+	5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+	5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+	5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+	5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+	5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+	5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+	5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+	5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+	5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+	5, 5, 5, 5, 5, 5, 5, 5, 5, 23, 24, 25, 5, 5, 5, 5,
+	5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+	26, 27, 5, 28, 29, 30, 5, 5, 5, 31, 5, 5, 5, 5, 5, 5,
+	5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+	5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+	5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+	5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+	5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+	5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+	5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+	5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+	5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+	5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+	5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+	5, 32, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+	5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+	5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+	5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+	5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+	5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+	5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+	5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+	5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+	5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+	5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+	5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+	5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+	5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+	5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+	5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+	5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+	5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+	5, 5, 5, 5, 5, 5, 5, 5, 33, 34, 35
+};
+
+const uint16_t unicode_tables_nfd_blocks[ 9216 ] = {
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	1, 4, 7, 10, 13, 16, 0, 19, 22, 25, 28, 31, 34, 37, 40, 43,
+	0, 46, 49, 52, 55, 58, 61, 0, 0, 64, 67, 70, 73, 76, 0, 0,
+	79, 82, 85, 88, 91, 94, 0, 97, 100, 103, 106, 109, 112, 115, 118, 121,
+	0, 124, 127, 130, 133, 136, 139, 0, 0, 142, 145, 148, 151, 154, 0, 157,
+	160, 163, 166, 169, 172, 175, 178, 181, 184, 187, 190, 193, 196, 199, 202, 205,
+	0, 0, 208, 211, 214, 217, 220, 223, 226, 229, 232, 235, 238, 241, 244, 247,
+	250, 253, 256, 259, 262, 265, 0, 0, 268, 271, 274, 277, 280, 283, 286, 289,
+	292, 0, 0, 0, 295, 298, 301, 304, 0, 307, 310, 313, 316, 319, 322, 0,
+	0, 0, 0, 325, 328, 331, 334, 337, 340, 0, 0, 0, 343, 346, 349, 352,
+	355, 358, 0, 0, 361, 364, 367, 370, 373, 376, 379, 382, 385, 388, 391, 394,
+	397, 400, 403, 406, 409, 412, 0, 0, 415, 418, 421, 424, 427, 430, 433, 436,
+	439, 442, 445, 448, 451, 454, 457, 460, 463, 466, 469, 472, 475, 478, 481, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	484, 487, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 490,
+	493, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 496, 499, 502,
+	505, 508, 511, 514, 517, 520, 524, 528, 532, 536, 540, 544, 548, 0, 552, 556,
+	560, 564, 568, 571, 0, 0, 574, 577, 580, 583, 586, 589, 592, 596, 600, 603,
+	606, 0, 0, 0, 609, 612, 0, 0, 615, 618, 621, 625, 629, 632, 635, 638,
+	641, 644, 647, 650, 653, 656, 659, 662, 665, 668, 671, 674, 677, 680, 683, 686,
+	689, 692, 695, 698, 701, 704, 707, 710, 713, 716, 719, 722, 0, 0, 725, 728,
+	0, 0, 0, 0, 0, 0, 731, 734, 737, 740, 743, 747, 751, 755, 759, 762,
+	765, 769, 773, 776, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	779, 781, 0, 783, 785, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 788, 0, 0, 0, 0, 0, 0, 0, 0, 0, 790, 0,
+	0, 0, 0, 0, 0, 792, 795, 798, 800, 803, 806, 0, 809, 0, 812, 815,
+	818, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 822, 825, 828, 831, 834, 837,
+	840, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 844, 847, 850, 853, 856, 0,
+	0, 0, 0, 859, 862, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	865, 868, 0, 871, 0, 0, 0, 874, 0, 0, 0, 0, 877, 880, 883, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 886, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 889, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	892, 895, 0, 898, 0, 0, 0, 901, 0, 0, 0, 0, 904, 907, 910, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 913, 916, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 919, 922, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	925, 928, 931, 934, 0, 0, 937, 940, 0, 0, 943, 946, 949, 952, 955, 958,
+	0, 0, 961, 964, 967, 970, 973, 976, 0, 0, 979, 982, 985, 988, 991, 994,
+	997, 1000, 1003, 1006, 1009, 1012, 0, 0, 1015, 1018, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 1021, 1024, 1027, 1030, 1033, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	1036, 0, 1039, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 1042, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 1045, 0, 0, 0, 0, 0, 0,
+	0, 1048, 0, 0, 1051, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 1054, 1057, 1060, 1063, 1066, 1069, 1072, 1075,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1078, 1081, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1084, 1087, 0, 1090,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 1093, 0, 0, 1096, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 1099, 1102, 1105, 0, 0, 1108, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 1111, 0, 0, 1114, 1117, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1120, 1123, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 1126, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1129, 1132, 1135, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 1138, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	1141, 0, 0, 0, 0, 0, 0, 1144, 1147, 0, 1150, 1153, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1157, 1160, 1163, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1166, 0, 1169, 1172, 1176, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 1179, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1182, 0, 0,
+	0, 0, 1185, 0, 0, 0, 0, 1188, 0, 0, 0, 0, 1191, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 1194, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 1197, 0, 1200, 1203, 0, 1206, 0, 0, 0, 0, 0, 0, 0,
+	0, 1209, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 1212, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1215, 0, 0,
+	0, 0, 1218, 0, 0, 0, 0, 1221, 0, 0, 0, 0, 1224, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 1227, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 1230, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 1233, 0, 1236, 0, 1239, 0, 1242, 0, 1245, 0,
+	0, 0, 1248, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1251, 0, 1254, 0, 0,
+	1257, 1260, 0, 1263, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	1266, 1269, 1272, 1275, 1278, 1281, 1284, 1287, 1290, 1294, 1298, 1301, 1304, 1307, 1310, 1313,
+	1316, 1319, 1322, 1325, 1328, 1332, 1336, 1340, 1344, 1347, 1350, 1353, 1356, 1360, 1364, 1367,
+	1370, 1373, 1376, 1379, 1382, 1385, 1388, 1391, 1394, 1397, 1400, 1403, 1406, 1409, 1412, 1416,
+	1420, 1423, 1426, 1429, 1432, 1435, 1438, 1441, 1444, 1448, 1452, 1455, 1458, 1461, 1464, 1467,
+	1470, 1473, 1476, 1479, 1482, 1485, 1488, 1491, 1494, 1497, 1500, 1503, 1506, 1510, 1514, 1518,
+	1522, 1526, 1530, 1534, 1538, 1541, 1544, 1547, 1550, 1553, 1556, 1559, 1562, 1566, 1570, 1573,
+	1576, 1579, 1582, 1585, 1588, 1592, 1596, 1600, 1604, 1608, 1612, 1615, 1618, 1621, 1624, 1627,
+	1630, 1633, 1636, 1639, 1642, 1645, 1648, 1651, 1654, 1658, 1662, 1666, 1670, 1673, 1676, 1679,
+	1682, 1685, 1688, 1691, 1694, 1697, 1700, 1703, 1706, 1709, 1712, 1715, 1718, 1721, 1724, 1727,
+	1730, 1733, 1736, 1739, 1742, 1745, 1748, 1751, 1754, 1757, 0, 1760, 0, 0, 0, 0,
+	1763, 1766, 1769, 1772, 1775, 1779, 1783, 1787, 1791, 1795, 1799, 1803, 1807, 1811, 1815, 1819,
+	1823, 1827, 1831, 1835, 1839, 1843, 1847, 1851, 1855, 1858, 1861, 1864, 1867, 1870, 1873, 1877,
+	1881, 1885, 1889, 1893, 1897, 1901, 1905, 1909, 1913, 1916, 1919, 1922, 1925, 1928, 1931, 1934,
+	1937, 1941, 1945, 1949, 1953, 1957, 1961, 1965, 1969, 1973, 1977, 1981, 1985, 1989, 1993, 1997,
+	2001, 2005, 2009, 2013, 2017, 2020, 2023, 2026, 2029, 2033, 2037, 2041, 2045, 2049, 2053, 2057,
+	2061, 2065, 2069, 2072, 2075, 2078, 2081, 2084, 2087, 2090, 0, 0, 0, 0, 0, 0,
+	2093, 2096, 2099, 2103, 2107, 2111, 2115, 2119, 2123, 2126, 2129, 2133, 2137, 2141, 2145, 2149,
+	2153, 2156, 2159, 2163, 2167, 2171, 0, 0, 2175, 2178, 2181, 2185, 2189, 2193, 0, 0,
+	2197, 2200, 2203, 2207, 2211, 2215, 2219, 2223, 2227, 2230, 2233, 2237, 2241, 2245, 2249, 2253,
+	2257, 2260, 2263, 2267, 2271, 2275, 2279, 2283, 2287, 2290, 2293, 2297, 2301, 2305, 2309, 2313,
+	2317, 2320, 2323, 2327, 2331, 2335, 0, 0, 2339, 2342, 2345, 2349, 2353, 2357, 0, 0,
+	2361, 2364, 2367, 2371, 2375, 2379, 2383, 2387, 0, 2391, 0, 2394, 0, 2398, 0, 2402,
+	2406, 2409, 2412, 2416, 2420, 2424, 2428, 2432, 2436, 2439, 2442, 2446, 2450, 2454, 2458, 2462,
+	2466, 2469, 2472, 2475, 2478, 2481, 2484, 2487, 2490, 2493, 2496, 2499, 2502, 2505, 0, 0,
+	2508, 2512, 2516, 2521, 2526, 2531, 2536, 2541, 2546, 2550, 2554, 2559, 2564, 2569, 2574, 2579,
+	2584, 2588, 2592, 2597, 2602, 2607, 2612, 2617, 2622, 2626, 2630, 2635, 2640, 2645, 2650, 2655,
+	2660, 2664, 2668, 2673, 2678, 2683, 2688, 2693, 2698, 2702, 2706, 2711, 2716, 2721, 2726, 2731,
+	2736, 2739, 2742, 2746, 2749, 0, 2753, 2756, 2760, 2763, 2766, 2769, 2772, 0, 2775, 0,
+	0, 2777, 2780, 2784, 2787, 0, 2791, 2794, 2798, 2801, 2804, 2807, 2810, 2813, 2816, 2819,
+	2822, 2825, 2828, 2832, 0, 0, 2836, 2839, 2843, 2846, 2849, 2852, 0, 2855, 2858, 2861,
+	2864, 2867, 2870, 2874, 2878, 2881, 2884, 2887, 2891, 2894, 2897, 2900, 2903, 2906, 2909, 2912,
+	0, 0, 2914, 2918, 2921, 0, 2925, 2928, 2932, 2935, 2938, 2941, 2944, 2947, 0, 0,
+	2949, 2951, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 2953, 0, 0, 0, 2955, 2957, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2960, 2963, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2966, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2969, 2972, 2975,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 2978, 0, 0, 0, 0, 2981, 0, 0, 2984, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 2987, 0, 2990, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 2993, 0, 0, 2996, 0, 0, 2999, 0, 3002, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	3005, 0, 3008, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 3011, 3014, 3017,
+	3020, 3023, 0, 0, 3026, 3029, 0, 0, 3032, 3035, 0, 0, 0, 0, 0, 0,
+	3038, 3041, 0, 0, 3044, 3047, 0, 0, 3050, 3053, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 3056, 3059, 3062, 3065,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	3068, 3071, 3074, 3077, 0, 0, 0, 0, 0, 0, 3080, 3083, 3086, 3089, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 3092, 3094, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 3096, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 3099, 0, 3102, 0,
+	3105, 0, 3108, 0, 3111, 0, 3114, 0, 3117, 0, 3120, 0, 3123, 0, 3126, 0,
+	3129, 0, 3132, 0, 0, 3135, 0, 3138, 0, 3141, 0, 0, 0, 0, 0, 0,
+	3144, 3147, 0, 3150, 3153, 0, 3156, 3159, 0, 3162, 3165, 0, 3168, 3171, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 3174, 0, 0, 0, 0, 0, 0, 0, 0, 0, 3177, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 3180, 0, 3183, 0,
+	3186, 0, 3189, 0, 3192, 0, 3195, 0, 3198, 0, 3201, 0, 3204, 0, 3207, 0,
+	3210, 0, 3213, 0, 0, 3216, 0, 3219, 0, 3222, 0, 0, 0, 0, 0, 0,
+	3225, 3228, 0, 3231, 3234, 0, 3237, 3240, 0, 3243, 3246, 0, 3249, 3252, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 3255, 0, 0, 3258, 3261, 3264, 3267, 0, 0, 0, 3270, 0,
+	3273, 3275, 3277, 3279, 3281, 3283, 3285, 3287, 3289, 3291, 3293, 3295, 3297, 3299, 3301, 3303,
+	3305, 3307, 3309, 3311, 3313, 3315, 3317, 3319, 3321, 3323, 3325, 3327, 3329, 3331, 3333, 3335,
+	3337, 3339, 3341, 3343, 3345, 3347, 3349, 3351, 3353, 3355, 3357, 3359, 3361, 3363, 3365, 3367,
+	3369, 3371, 3373, 3375, 3377, 3379, 3381, 3383, 3385, 3387, 3389, 3391, 3393, 3395, 3397, 3399,
+	3401, 3403, 3405, 3407, 3409, 3411, 3413, 3415, 3417, 3419, 3421, 3423, 3425, 3427, 3429, 3431,
+	3433, 3435, 3437, 3439, 3441, 3443, 3445, 3447, 3449, 3451, 3453, 3455, 3457, 3459, 3461, 3463,
+	3465, 3467, 3469, 3471, 3473, 3475, 3477, 3479, 3481, 3483, 3485, 3487, 3489, 3491, 3493, 3495,
+	3497, 3499, 3501, 3503, 3505, 3507, 3509, 3511, 3513, 3515, 3517, 3519, 3521, 3523, 3525, 3527,
+	3529, 3531, 3533, 3535, 3537, 3539, 3541, 3543, 3545, 3547, 3549, 3551, 3553, 3555, 3557, 3559,
+	3561, 3563, 3565, 3567, 3569, 3571, 3573, 3575, 3577, 3579, 3581, 3583, 3585, 3587, 3589, 3591,
+	3593, 3595, 3597, 3599, 3601, 3603, 3605, 3607, 3609, 3611, 3613, 3615, 3617, 3619, 3621, 3623,
+	3625, 3627, 3629, 3631, 3633, 3635, 3637, 3639, 3641, 3643, 3645, 3647, 3649, 3651, 3653, 3655,
+	3657, 3659, 3661, 3663, 3665, 3667, 3669, 3671, 3673, 3675, 3677, 3679, 3681, 3683, 3685, 3687,
+	3689, 3691, 3693, 3695, 3697, 3699, 3701, 3703, 3705, 3707, 3709, 3711, 3713, 3715, 3717, 3719,
+	3721, 3723, 3725, 3727, 3729, 3731, 3733, 3735, 3737, 3739, 3741, 3743, 3745, 3747, 3749, 3751,
+	3753, 3755, 3757, 3759, 3761, 3763, 3765, 3767, 3769, 3771, 3773, 3775, 3777, 3779, 3781, 3783,
+	3785, 3787, 3789, 3791, 3793, 3795, 3797, 3799, 3801, 3803, 3805, 3807, 3809, 3811, 0, 0,
+	3813, 0, 3815, 0, 0, 3817, 3819, 3821, 3823, 3825, 3827, 3829, 3831, 3833, 3835, 0,
+	3837, 0, 3839, 0, 0, 3841, 3843, 0, 0, 0, 3845, 3847, 3849, 3851, 3853, 3855,
+	3857, 3859, 3861, 3863, 3865, 3867, 3869, 3871, 3873, 3875, 3877, 3879, 3881, 3883, 3885, 3887,
+	3889, 3891, 3893, 3895, 3897, 3899, 3901, 3903, 3905, 3907, 3909, 3911, 3913, 3915, 3917, 3919,
+	3921, 3923, 3925, 3927, 3929, 3931, 3933, 3935, 3937, 3939, 3941, 3943, 3945, 3947, 3949, 3951,
+	3953, 3955, 3957, 3959, 3961, 3963, 3965, 3967, 3969, 3971, 3973, 3975, 3977, 3979, 0, 0,
+	3981, 3983, 3985, 3987, 3989, 3991, 3993, 3995, 3997, 3999, 4001, 4003, 4005, 4007, 4009, 4011,
+	4013, 4015, 4017, 4019, 4021, 4023, 4025, 4027, 4029, 4031, 4033, 4035, 4037, 4039, 4041, 4043,
+	4045, 4047, 4049, 4051, 4053, 4055, 4057, 4059, 4061, 4063, 4065, 4067, 4069, 4071, 4073, 4075,
+	4077, 4079, 4081, 4083, 4085, 4087, 4089, 4091, 4093, 4095, 4097, 4099, 4101, 4103, 4105, 4107,
+	4109, 4111, 4113, 4115, 4117, 4119, 4121, 4123, 4125, 4127, 4129, 4131, 4133, 4135, 4137, 4139,
+	4141, 4143, 4145, 4147, 4149, 4151, 4153, 4155, 4157, 4159, 4161, 4163, 4165, 4167, 4169, 4171,
+	4173, 4175, 4177, 4179, 4181, 4183, 4185, 4187, 4189, 4191, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4193, 0, 4196,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4199, 4202, 4205, 4209, 4213, 4216,
+	4219, 4222, 4225, 4228, 4231, 4234, 4237, 0, 4240, 4243, 4246, 4249, 4252, 0, 4255, 0,
+	4258, 4261, 0, 4264, 4267, 0, 4270, 4273, 4276, 4279, 4282, 4285, 4288, 4291, 4294, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4297, 0, 4300, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4303, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4306, 4309,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4312, 4315, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4318, 4321, 0, 4324, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4327, 4330, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 4333, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4336, 4339,
+	4342, 4346, 4350, 4354, 4358, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4362, 4365, 4368, 4372, 4376,
+	4380, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	4384, 4386, 4388, 4390, 4392, 4394, 4396, 4398, 4400, 4402, 4404, 4406, 4408, 4410, 4412, 4414,
+	4416, 4418, 4420, 4422, 4424, 4426, 4428, 4430, 4432, 4434, 4436, 4438, 4440, 4442, 4444, 4446,
+	4448, 4450, 4452, 4454, 4456, 4458, 4460, 4462, 4464, 4466, 4468, 4470, 4472, 4474, 4476, 4478,
+	4480, 4482, 4484, 4486, 4488, 4490, 4492, 4494, 4496, 4498, 4500, 4502, 4504, 4506, 4508, 4510,
+	4512, 4514, 4516, 4518, 4520, 4522, 4524, 4526, 4528, 4530, 4532, 4534, 4536, 4538, 4540, 4542,
+	4544, 4546, 4548, 4550, 4552, 4554, 4556, 4558, 4560, 4562, 4564, 4566, 4568, 4570, 4572, 4574,
+	4576, 4578, 4580, 4582, 4584, 4586, 4588, 4590, 4592, 4594, 4596, 4598, 4600, 4602, 4604, 4606,
+	4608, 4610, 4612, 4614, 4616, 4618, 4620, 4622, 4624, 4626, 4628, 4630, 4632, 4634, 4636, 4638,
+	4640, 4642, 4644, 4646, 4648, 4650, 4652, 4654, 4656, 4658, 4660, 4662, 4664, 4666, 4668, 4670,
+	4672, 4674, 4676, 4678, 4680, 4682, 4684, 4686, 4688, 4690, 4692, 4694, 4696, 4698, 4700, 4702,
+	4704, 4706, 4708, 4710, 4712, 4714, 4716, 4718, 4720, 4722, 4724, 4726, 4728, 4730, 4732, 4734,
+	4736, 4738, 4740, 4742, 4744, 4746, 4748, 4750, 4752, 4754, 4756, 4758, 4760, 4762, 4764, 4766,
+	4768, 4770, 4772, 4774, 4776, 4778, 4780, 4782, 4784, 4786, 4788, 4790, 4792, 4794, 4796, 4798,
+	4800, 4802, 4804, 4806, 4808, 4810, 4812, 4814, 4816, 4818, 4820, 4822, 4824, 4826, 4828, 4830,
+	4832, 4834, 4836, 4838, 4840, 4842, 4844, 4846, 4848, 4850, 4852, 4854, 4856, 4858, 4860, 4862,
+	4864, 4866, 4868, 4870, 4872, 4874, 4876, 4878, 4880, 4882, 4884, 4886, 4888, 4890, 4892, 4894,
+	4896, 4898, 4900, 4902, 4904, 4906, 4908, 4910, 4912, 4914, 4916, 4918, 4920, 4922, 4924, 4926,
+	4928, 4930, 4932, 4934, 4936, 4938, 4940, 4942, 4944, 4946, 4948, 4950, 4952, 4954, 4956, 4958,
+	4960, 4962, 4964, 4966, 4968, 4970, 4972, 4974, 4976, 4978, 4980, 4982, 4984, 4986, 4988, 4990,
+	4992, 4994, 4996, 4998, 5000, 5002, 5004, 5006, 5008, 5010, 5012, 5014, 5016, 5018, 5020, 5022,
+	5024, 5026, 5028, 5030, 5032, 5034, 5036, 5038, 5040, 5042, 5044, 5046, 5048, 5050, 5052, 5054,
+	5056, 5058, 5060, 5062, 5064, 5066, 5068, 5070, 5072, 5074, 5076, 5078, 5080, 5082, 5084, 5086,
+	5088, 5090, 5092, 5094, 5096, 5098, 5100, 5102, 5104, 5106, 5108, 5110, 5112, 5114, 5116, 5118,
+	5120, 5122, 5124, 5126, 5128, 5130, 5132, 5134, 5136, 5138, 5140, 5142, 5144, 5146, 5148, 5150,
+	5152, 5154, 5156, 5158, 5160, 5162, 5164, 5166, 5168, 5170, 5172, 5174, 5176, 5178, 5180, 5182,
+	5184, 5186, 5188, 5190, 5192, 5194, 5196, 5198, 5200, 5202, 5204, 5206, 5208, 5210, 5212, 5214,
+	5216, 5218, 5220, 5222, 5224, 5226, 5228, 5230, 5232, 5234, 5236, 5238, 5240, 5242, 5244, 5246,
+	5248, 5250, 5252, 5254, 5256, 5258, 5260, 5262, 5264, 5266, 5268, 5270, 5272, 5274, 5276, 5278,
+	5280, 5282, 5284, 5286, 5288, 5290, 5292, 5294, 5296, 5298, 5300, 5302, 5304, 5306, 5308, 5310,
+	5312, 5314, 5316, 5318, 5320, 5322, 5324, 5326, 5328, 5330, 5332, 5334, 5336, 5338, 5340, 5342,
+	5344, 5346, 5348, 5350, 5352, 5354, 5356, 5358, 5360, 5362, 5364, 5366, 5368, 5370, 5372, 5374,
+	5376, 5378, 5380, 5382, 5384, 5386, 5388, 5390, 5392, 5394, 5396, 5398, 5400, 5402, 5404, 5406,
+	5408, 5410, 5412, 5414, 5416, 5418, 5420, 5422, 5424, 5426, 5428, 5430, 5432, 5434, 5436, 5438,
+	5440, 5442, 5444, 5446, 5448, 5450, 5452, 5454, 5456, 5458, 5460, 5462, 5464, 5466, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0
+};
+
+const uint32_t unicode_tables_nfd_sequences[ 5468 ] = {
+	0x0000, 0x0002, 0x0041, 0x0300, 0x0002, 0x0041, 0x0301, 0x0002,
+	0x0041, 0x0302, 0x0002, 0x0041, 0x0303, 0x0002, 0x0041, 0x0308,
+	0x0002, 0x0041, 0x030a, 0x0002, 0x0043, 0x0327, 0x0002, 0x0045,
+	0x0300, 0x0002, 0x0045, 0x0301, 0x0002, 0x0045, 0x0302, 0x0002,
+	0x0045, 0x0308, 0x0002, 0x0049, 0x0300, 0x0002, 0x0049, 0x0301,
+	0x0002, 0x0049, 0x0302, 0x0002, 0x0049, 0x0308, 0x0002, 0x004e,
+	0x0303, 0x0002, 0x004f, 0x0300, 0x0002, 0x004f, 0x0301, 0x0002,
+	0x004f, 0x0302, 0x0002, 0x004f, 0x0303, 0x0002, 0x004f, 0x0308,
+	0x0002, 0x0055, 0x0300, 0x0002, 0x0055, 0x0301, 0x0002, 0x0055,
+	0x0302, 0x0002, 0x0055, 0x0308, 0x0002, 0x0059, 0x0301, 0x0002,
+	0x0061, 0x0300, 0x0002, 0x0061, 0x0301, 0x0002, 0x0061, 0x0302,
+	0x0002, 0x0061, 0x0303, 0x0002, 0x0061, 0x0308, 0x0002, 0x0061,
+	0x030a, 0x0002, 0x0063, 0x0327, 0x0002, 0x0065, 0x0300, 0x0002,
+	0x0065, 0x0301, 0x0002, 0x0065, 0x0302, 0x0002, 0x0065, 0x0308,
+	0x0002, 0x0069, 0x0300, 0x0002, 0x0069, 0x0301, 0x0002, 0x0069,
+	0x0302, 0x0002, 0x0069, 0x0308, 0x0002, 0x006e, 0x0303, 0x0002,
+	0x006f, 0x0300, 0x0002, 0x006f, 0x0301, 0x0002, 0x006f, 0x0302,
+	0x0002, 0x006f, 0x0303, 0x0002, 0x006f, 0x0308, 0x0002, 0x0075,
+	0x0300, 0x0002, 0x0075, 0x0301, 0x0002, 0x0075, 0x0302, 0x0002,
+	0x0075, 0x0308, 0x0002, 0x0079, 0x0301, 0x0002, 0x0079, 0x0308,
+	0x0002, 0x0041, 0x0304, 0x0002, 0x0061, 0x0304, 0x0002, 0x0041,
+	0x0306, 0x0002, 0x0061, 0x0306, 0x0002, 0x0041, 0x0328, 0x0002,
+	0x0061, 0x0328, 0x0002, 0x0043, 0x0301, 0x0002, 0x0063, 0x0301,
+	0x0002, 0x0043, 0x0302, 0x0002, 0x0063, 0x0302, 0x0002, 0x0043,
+	0x0307, 0x0002, 0x0063, 0x0307, 0x0002, 0x0043, 0x030c, 0x0002,
+	0x0063, 0x030c, 0x0002, 0x0044, 0x030c, 0x0002, 0x0064, 0x030c,
+	0x0002, 0x0045, 0x0304, 0x0002, 0x0065, 0x0304, 0x0002, 0x0045,
+	0x0306, 0x0002, 0x0065, 0x0306, 0x0002, 0x0045, 0x0307, 0x0002,
+	0x0065, 0x0307, 0x0002, 0x0045, 0x0328, 0x0002, 0x0065, 0x0328,
+	0x0002, 0x0045, 0x030c, 0x0002, 0x0065, 0x030c, 0x0002, 0x0047,
+	0x0302, 0x0002, 0x0067, 0x0302, 0x0002, 0x0047, 0x0306, 0x0002,
+	0x0067, 0x0306, 0x0002, 0x0047, 0x0307, 0x0002, 0x0067, 0x0307,
+	0x0002, 0x0047, 0x0327, 0x0002, 0x0067, 0x0327, 0x0002, 0x0048,
+	0x0302, 0x0002, 0x0068, 0x0302, 0x0002, 0x0049, 0x0303, 0x0002,
+	0x0069, 0x0303, 0x0002, 0x0049, 0x0304, 0x0002, 0x0069, 0x0304,
+	0x0002, 0x0049, 0x0306, 0x0002, 0x0069, 0x0306, 0x0002, 0x0049,
+	0x0328, 0x0002, 0x0069, 0x0328, 0x0002, 0x0049, 0x0307, 0x0002,
+	0x004a, 0x0302, 0x0002, 0x006a, 0x0302, 0x0002, 0x004b, 0x0327,
+	0x0002, 0x006b, 0x0327, 0x0002, 0x004c, 0x0301, 0x0002, 0x006c,
+	0x0301, 0x0002, 0x004c, 0x0327, 0x0002, 0x006c, 0x0327, 0x0002,
+	0x004c, 0x030c, 0x0002, 0x006c, 0x030c, 0x0002, 0x004e, 0x0301,
+	0x0002, 0x006e, 0x0301, 0x0002, 0x004e, 0x0327, 0x0002, 0x006e,
+	0x0327, 0x0002, 0x004e, 0x030c, 0x0002, 0x006e, 0x030c, 0x0002,
+	0x004f, 0x0304, 0x0002, 0x006f, 0x0304, 0x0002, 0x004f, 0x0306,
+	0x0002, 0x006f, 0x0306, 0x0002, 0x004f, 0x030b, 0x0002, 0x006f,
+	0x030b, 0x0002, 0x0052, 0x0301, 0x0002, 0x0072, 0x0301, 0x0002,
+	0x0052, 0x0327, 0x0002, 0x0072, 0x0327, 0x0002, 0x0052, 0x030c,
+	0x0002, 0x0072, 0x030c, 0x0002, 0x0053, 0x0301, 0x0002, 0x0073,
+	0x0301, 0x0002, 0x0053, 0x0302, 0x0002, 0x0073, 0x0302, 0x0002,
+	0x0053, 0x0327, 0x0002, 0x0073, 0x0327, 0x0002, 0x0053, 0x030c,
+	0x0002, 0x0073, 0x030c, 0x0002, 0x0054, 0x0327, 0x0002, 0x0074,
+	0x0327, 0x0002, 0x0054, 0x030c, 0x0002, 0x0074, 0x030c, 0x0002,
+	0x0055, 0x0303, 0x0002, 0x0075, 0x0303, 0x0002, 0x0055, 0x0304,
+	0x0002, 0x0075, 0x0304, 0x0002, 0x0055, 0x0306, 0x0002, 0x0075,
+	0x0306, 0x0002, 0x0055, 0x030a, 0x0002, 0x0075, 0x030a, 0x0002,
+	0x0055, 0x030b, 0x0002, 0x0075, 0x030b, 0x0002, 0x0055, 0x0328,
+	0x0002, 0x0075, 0x0328, 0x0002, 0x0057, 0x0302, 0x0002, 0x0077,
+	0x0302, 0x0002, 0x0059, 0x0302, 0x0002, 0x0079, 0x0302, 0x0002,
+	0x0059, 0x0308, 0x0002, 0x005a, 0x0301, 0x0002, 0x007a, 0x0301,
+	0x0002, 0x005a, 0x0307, 0x0002, 0x007a, 0x0307, 0x0002, 0x005a,
+	0x030c, 0x0002, 0x007a, 0x030c, 0x0002, 0x004f, 0x031b, 0x0002,
+	0x006f, 0x031b, 0x0002, 0x0055, 0x031b, 0x0002, 0x0075, 0x031b,
+	0x0002, 0x0041, 0x030c, 0x0002, 0x0061, 0x030c, 0x0002, 0x0049,
+	0x030c, 0x0002, 0x0069, 0x030c, 0x0002, 0x004f, 0x030c, 0x0002,
+	0x006f, 0x030c, 0x0002, 0x0055, 0x030c, 0x0002, 0x0075, 0x030c,
+	0x0003, 0x0055, 0x0308, 0x0304, 0x0003, 0x0075, 0x0308, 0x0304,
+	0x0003, 0x0055, 0x0308, 0x0301, 0x0003, 0x0075, 0x0308, 0x0301,
+	0x0003, 0x0055, 0x0308, 0x030c, 0x0003, 0x0075, 0x0308, 0x030c,
+	0x0003, 0x0055, 0x0308, 0x0300, 0x0003, 0x0075, 0x0308, 0x0300,
+	0x0003, 0x0041, 0x0308, 0x0304, 0x0003, 0x0061, 0x0308, 0x0304,
+	0x0003, 0x0041, 0x0307, 0x0304, 0x0003, 0x0061, 0x0307, 0x0304,
+	0x0002, 0x00c6, 0x0304, 0x0002, 0x00e6, 0x0304, 0x0002, 0x0047,
+	0x030c, 0x0002, 0x0067, 0x030c, 0x0002, 0x004b, 0x030c, 0x0002,
+	0x006b, 0x030c, 0x0002, 0x004f, 0x0328, 0x0002, 0x006f, 0x0328,
+	0x0003, 0x004f, 0x0328, 0x0304, 0x0003, 0x006f, 0x0328, 0x0304,
+	0x0002, 0x01b7, 0x030c, 0x0002, 0x0292, 0x030c, 0x0002, 0x006a,
+	0x030c, 0x0002, 0x0047, 0x0301, 0x0002, 0x0067, 0x0301, 0x0002,
+	0x004e, 0x0300, 0x0002, 0x006e, 0x0300, 0x0003, 0x0041, 0x030a,
+	0x0301, 0x0003, 0x0061, 0x030a, 0x0301, 0x0002, 0x00c6, 0x0301,
+	0x0002, 0x00e6, 0x0301, 0x0002, 0x00d8, 0x0301, 0x0002, 0x00f8,
+	0x0301, 0x0002, 0x0041, 0x030f, 0x0002, 0x0061, 0x030f, 0x0002,
+	0x0041, 0x0311, 0x0002, 0x0061, 0x0311, 0x0002, 0x0045, 0x030f,
+	0x0002, 0x0065, 0x030f, 0x0002, 0x0045, 0x0311, 0x0002, 0x0065,
+	0x0311, 0x0002, 0x0049, 0x030f, 0x0002, 0x0069, 0x030f, 0x0002,
+	0x0049, 0x0311, 0x0002, 0x0069, 0x0311, 0x0002, 0x004f, 0x030f,
+	0x0002, 0x006f, 0x030f, 0x0002, 0x004f, 0x0311, 0x0002, 0x006f,
+	0x0311, 0x0002, 0x0052, 0x030f, 0x0002, 0x0072, 0x030f, 0x0002,
+	0x0052, 0x0311, 0x0002, 0x0072, 0x0311, 0x0002, 0x0055, 0x030f,
+	0x0002, 0x0075, 0x030f, 0x0002, 0x0055, 0x0311, 0x0002, 0x0075,
+	0x0311, 0x0002, 0x0053, 0x0326, 0x0002, 0x0073, 0x0326, 0x0002,
+	0x0054, 0x0326, 0x0002, 0x0074, 0x0326, 0x0002, 0x0048, 0x030c,
+	0x0002, 0x0068, 0x030c, 0x0002, 0x0041, 0x0307, 0x0002, 0x0061,
+	0x0307, 0x0002, 0x0045, 0x0327, 0x0002, 0x0065, 0x0327, 0x0003,
+	0x004f, 0x0308, 0x0304, 0x0003, 0x006f, 0x0308, 0x0304, 0x0003,
+	0x004f, 0x0303, 0x0304, 0x0003, 0x006f, 0x0303, 0x0304, 0x0002,
+	0x004f, 0x0307, 0x0002, 0x006f, 0x0307, 0x0003, 0x004f, 0x0307,
+	0x0304, 0x0003, 0x006f, 0x0307, 0x0304, 0x0002, 0x0059, 0x0304,
+	0x0002, 0x0079, 0x0304, 0x0001, 0x0300, 0x0001, 0x0301, 0x0001,
+	0x0313, 0x0002, 0x0308, 0x0301, 0x0001, 0x02b9, 0x0001, 0x003b,
+	0x0002, 0x00a8, 0x0301, 0x0002, 0x0391, 0x0301, 0x0001, 0x00b7,
+	0x0002, 0x0395, 0x0301, 0x0002, 0x0397, 0x0301, 0x0002, 0x0399,
+	0x0301, 0x0002, 0x039f, 0x0301, 0x0002, 0x03a5, 0x0301, 0x0002,
+	0x03a9, 0x0301, 0x0003, 0x03b9, 0x0308, 0x0301, 0x0002, 0x0399,
+	0x0308, 0x0002, 0x03a5, 0x0308, 0x0002, 0x03b1, 0x0301, 0x0002,
+	0x03b5, 0x0301, 0x0002, 0x03b7, 0x0301, 0x0002, 0x03b9, 0x0301,
+	0x0003, 0x03c5, 0x0308, 0x0301, 0x0002, 0x03b9, 0x0308, 0x0002,
+	0x03c5, 0x0308, 0x0002, 0x03bf, 0x0301, 0x0002, 0x03c5, 0x0301,
+	0x0002, 0x03c9, 0x0301, 0x0002, 0x03d2, 0x0301, 0x0002, 0x03d2,
+	0x0308, 0x0002, 0x0415, 0x0300, 0x0002, 0x0415, 0x0308, 0x0002,
+	0x0413, 0x0301, 0x0002, 0x0406, 0x0308, 0x0002, 0x041a, 0x0301,
+	0x0002, 0x0418, 0x0300, 0x0002, 0x0423, 0x0306, 0x0002, 0x0418,
+	0x0306, 0x0002, 0x0438, 0x0306, 0x0002, 0x0435, 0x0300, 0x0002,
+	0x0435, 0x0308, 0x0002, 0x0433, 0x0301, 0x0002, 0x0456, 0x0308,
+	0x0002, 0x043a, 0x0301, 0x0002, 0x0438, 0x0300, 0x0002, 0x0443,
+	0x0306, 0x0002, 0x0474, 0x030f, 0x0002, 0x0475, 0x030f, 0x0002,
+	0x0416, 0x0306, 0x0002, 0x0436, 0x0306, 0x0002, 0x0410, 0x0306,
+	0x0002, 0x0430, 0x0306, 0x0002, 0x0410, 0x0308, 0x0002, 0x0430,
+	0x0308, 0x0002, 0x0415, 0x0306, 0x0002, 0x0435, 0x0306, 0x0002,
+	0x04d8, 0x0308, 0x0002, 0x04d9, 0x0308, 0x0002, 0x0416, 0x0308,
+	0x0002, 0x0436, 0x0308, 0x0002, 0x0417, 0x0308, 0x0002, 0x0437,
+	0x0308, 0x0002, 0x0418, 0x0304, 0x0002, 0x0438, 0x0304, 0x0002,
+	0x0418, 0x0308, 0x0002, 0x0438, 0x0308, 0x0002, 0x041e, 0x0308,
+	0x0002, 0x043e, 0x0308, 0x0002, 0x04e8, 0x0308, 0x0002, 0x04e9,
+	0x0308, 0x0002, 0x042d, 0x0308, 0x0002, 0x044d, 0x0308, 0x0002,
+	0x0423, 0x0304, 0x0002, 0x0443, 0x0304, 0x0002, 0x0423, 0x0308,
+	0x0002, 0x0443, 0x0308, 0x0002, 0x0423, 0x030b, 0x0002, 0x0443,
+	0x030b, 0x0002, 0x0427, 0x0308, 0x0002, 0x0447, 0x0308, 0x0002,
+	0x042b, 0x0308, 0x0002, 0x044b, 0x0308, 0x0002, 0x0627, 0x0653,
+	0x0002, 0x0627, 0x0654, 0x0002, 0x0648, 0x0654, 0x0002, 0x0627,
+	0x0655, 0x0002, 0x064a, 0x0654, 0x0002, 0x06d5, 0x0654, 0x0002,
+	0x06c1, 0x0654, 0x0002, 0x06d2, 0x0654, 0x0002, 0x0928, 0x093c,
+	0x0002, 0x0930, 0x093c, 0x0002, 0x0933, 0x093c, 0x0002, 0x0915,
+	0x093c, 0x0002, 0x0916, 0x093c, 0x0002, 0x0917, 0x093c, 0x0002,
+	0x091c, 0x093c, 0x0002, 0x0921, 0x093c, 0x0002, 0x0922, 0x093c,
+	0x0002, 0x092b, 0x093c, 0x0002, 0x092f, 0x093c, 0x0002, 0x09c7,
+	0x09be, 0x0002, 0x09c7, 0x09d7, 0x0002, 0x09a1, 0x09bc, 0x0002,
+	0x09a2, 0x09bc, 0x0002, 0x09af, 0x09bc, 0x0002, 0x0a32, 0x0a3c,
+	0x0002, 0x0a38, 0x0a3c, 0x0002, 0x0a16, 0x0a3c, 0x0002, 0x0a17,
+	0x0a3c, 0x0002, 0x0a1c, 0x0a3c, 0x0002, 0x0a2b, 0x0a3c, 0x0002,
+	0x0b47, 0x0b56, 0x0002, 0x0b47, 0x0b3e, 0x0002, 0x0b47, 0x0b57,
+	0x0002, 0x0b21, 0x0b3c, 0x0002, 0x0b22, 0x0b3c, 0x0002, 0x0b92,
+	0x0bd7, 0x0002, 0x0bc6, 0x0bbe, 0x0002, 0x0bc7, 0x0bbe, 0x0002,
+	0x0bc6, 0x0bd7, 0x0002, 0x0c46, 0x0c56, 0x0002, 0x0cbf, 0x0cd5,
+	0x0002, 0x0cc6, 0x0cd5, 0x0002, 0x0cc6, 0x0cd6, 0x0002, 0x0cc6,
+	0x0cc2, 0x0003, 0x0cc6, 0x0cc2, 0x0cd5, 0x0002, 0x0d46, 0x0d3e,
+	0x0002, 0x0d47, 0x0d3e, 0x0002, 0x0d46, 0x0d57, 0x0002, 0x0dd9,
+	0x0dca, 0x0002, 0x0dd9, 0x0dcf, 0x0003, 0x0dd9, 0x0dcf, 0x0dca,
+	0x0002, 0x0dd9, 0x0ddf, 0x0002, 0x0f42, 0x0fb7, 0x0002, 0x0f4c,
+	0x0fb7, 0x0002, 0x0f51, 0x0fb7, 0x0002, 0x0f56, 0x0fb7, 0x0002,
+	0x0f5b, 0x0fb7, 0x0002, 0x0f40, 0x0fb5, 0x0002, 0x0f71, 0x0f72,
+	0x0002, 0x0f71, 0x0f74, 0x0002, 0x0fb2, 0x0f80, 0x0002, 0x0fb3,
+	0x0f80, 0x0002, 0x0f71, 0x0f80, 0x0002, 0x0f92, 0x0fb7, 0x0002,
+	0x0f9c, 0x0fb7, 0x0002, 0x0fa1, 0x0fb7, 0x0002, 0x0fa6, 0x0fb7,
+	0x0002, 0x0fab, 0x0fb7, 0x0002, 0x0f90, 0x0fb5, 0x0002, 0x1025,
+	0x102e, 0x0002, 0x1b05, 0x1b35, 0x0002, 0x1b07, 0x1b35, 0x0002,
+	0x1b09, 0x1b35, 0x0002, 0x1b0b, 0x1b35, 0x0002, 0x1b0d, 0x1b35,
+	0x0002, 0x1b11, 0x1b35, 0x0002, 0x1b3a, 0x1b35, 0x0002, 0x1b3c,
+	0x1b35, 0x0002, 0x1b3e, 0x1b35, 0x0002, 0x1b3f, 0x1b35, 0x0002,
+	0x1b42, 0x1b35, 0x0002, 0x0041, 0x0325, 0x0002, 0x0061, 0x0325,
+	0x0002, 0x0042, 0x0307, 0x0002, 0x0062, 0x0307, 0x0002, 0x0042,
+	0x0323, 0x0002, 0x0062, 0x0323, 0x0002, 0x0042, 0x0331, 0x0002,
+	0x0062, 0x0331, 0x0003, 0x0043, 0x0327, 0x0301, 0x0003, 0x0063,
+	0x0327, 0x0301, 0x0002, 0x0044, 0x0307, 0x0002, 0x0064, 0x0307,
+	0x0002, 0x0044, 0x0323, 0x0002, 0x0064, 0x0323, 0x0002, 0x0044,
+	0x0331, 0x0002, 0x0064, 0x0331, 0x0002, 0x0044, 0x0327, 0x0002,
+	0x0064, 0x0327, 0x0002, 0x0044, 0x032d, 0x0002, 0x0064, 0x032d,
+	0x0003, 0x0045, 0x0304, 0x0300, 0x0003, 0x0065, 0x0304, 0x0300,
+	0x0003, 0x0045, 0x0304, 0x0301, 0x0003, 0x0065, 0x0304, 0x0301,
+	0x0002, 0x0045, 0x032d, 0x0002, 0x0065, 0x032d, 0x0002, 0x0045,
+	0x0330, 0x0002, 0x0065, 0x0330, 0x0003, 0x0045, 0x0327, 0x0306,
+	0x0003, 0x0065, 0x0327, 0x0306, 0x0002, 0x0046, 0x0307, 0x0002,
+	0x0066, 0x0307, 0x0002, 0x0047, 0x0304, 0x0002, 0x0067, 0x0304,
+	0x0002, 0x0048, 0x0307, 0x0002, 0x0068, 0x0307, 0x0002, 0x0048,
+	0x0323, 0x0002, 0x0068, 0x0323, 0x0002, 0x0048, 0x0308, 0x0002,
+	0x0068, 0x0308, 0x0002, 0x0048, 0x0327, 0x0002, 0x0068, 0x0327,
+	0x0002, 0x0048, 0x032e, 0x0002, 0x0068, 0x032e, 0x0002, 0x0049,
+	0x0330, 0x0002, 0x0069, 0x0330, 0x0003, 0x0049, 0x0308, 0x0301,
+	0x0003, 0x0069, 0x0308, 0x0301, 0x0002, 0x004b, 0x0301, 0x0002,
+	0x006b, 0x0301, 0x0002, 0x004b, 0x0323, 0x0002, 0x006b, 0x0323,
+	0x0002, 0x004b, 0x0331, 0x0002, 0x006b, 0x0331, 0x0002, 0x004c,
+	0x0323, 0x0002, 0x006c, 0x0323, 0x0003, 0x004c, 0x0323, 0x0304,
+	0x0003, 0x006c, 0x0323, 0x0304, 0x0002, 0x004c, 0x0331, 0x0002,
+	0x006c, 0x0331, 0x0002, 0x004c, 0x032d, 0x0002, 0x006c, 0x032d,
+	0x0002, 0x004d, 0x0301, 0x0002, 0x006d, 0x0301, 0x0002, 0x004d,
+	0x0307, 0x0002, 0x006d, 0x0307, 0x0002, 0x004d, 0x0323, 0x0002,
+	0x006d, 0x0323, 0x0002, 0x004e, 0x0307, 0x0002, 0x006e, 0x0307,
+	0x0002, 0x004e, 0x0323, 0x0002, 0x006e, 0x0323, 0x0002, 0x004e,
+	0x0331, 0x0002, 0x006e, 0x0331, 0x0002, 0x004e, 0x032d, 0x0002,
+	0x006e, 0x032d, 0x0003, 0x004f, 0x0303, 0x0301, 0x0003, 0x006f,
+	0x0303, 0x0301, 0x0003, 0x004f, 0x0303, 0x0308, 0x0003, 0x006f,
+	0x0303, 0x0308, 0x0003, 0x004f, 0x0304, 0x0300, 0x0003, 0x006f,
+	0x0304, 0x0300, 0x0003, 0x004f, 0x0304, 0x0301, 0x0003, 0x006f,
+	0x0304, 0x0301, 0x0002, 0x0050, 0x0301, 0x0002, 0x0070, 0x0301,
+	0x0002, 0x0050, 0x0307, 0x0002, 0x0070, 0x0307, 0x0002, 0x0052,
+	0x0307, 0x0002, 0x0072, 0x0307, 0x0002, 0x0052, 0x0323, 0x0002,
+	0x0072, 0x0323, 0x0003, 0x0052, 0x0323, 0x0304, 0x0003, 0x0072,
+	0x0323, 0x0304, 0x0002, 0x0052, 0x0331, 0x0002, 0x0072, 0x0331,
+	0x0002, 0x0053, 0x0307, 0x0002, 0x0073, 0x0307, 0x0002, 0x0053,
+	0x0323, 0x0002, 0x0073, 0x0323, 0x0003, 0x0053, 0x0301, 0x0307,
+	0x0003, 0x0073, 0x0301, 0x0307, 0x0003, 0x0053, 0x030c, 0x0307,
+	0x0003, 0x0073, 0x030c, 0x0307, 0x0003, 0x0053, 0x0323, 0x0307,
+	0x0003, 0x0073, 0x0323, 0x0307, 0x0002, 0x0054, 0x0307, 0x0002,
+	0x0074, 0x0307, 0x0002, 0x0054, 0x0323, 0x0002, 0x0074, 0x0323,
+	0x0002, 0x0054, 0x0331, 0x0002, 0x0074, 0x0331, 0x0002, 0x0054,
+	0x032d, 0x0002, 0x0074, 0x032d, 0x0002, 0x0055, 0x0324, 0x0002,
+	0x0075, 0x0324, 0x0002, 0x0055, 0x0330, 0x0002, 0x0075, 0x0330,
+	0x0002, 0x0055, 0x032d, 0x0002, 0x0075, 0x032d, 0x0003, 0x0055,
+	0x0303, 0x0301, 0x0003, 0x0075, 0x0303, 0x0301, 0x0003, 0x0055,
+	0x0304, 0x0308, 0x0003, 0x0075, 0x0304, 0x0308, 0x0002, 0x0056,
+	0x0303, 0x0002, 0x0076, 0x0303, 0x0002, 0x0056, 0x0323, 0x0002,
+	0x0076, 0x0323, 0x0002, 0x0057, 0x0300, 0x0002, 0x0077, 0x0300,
+	0x0002, 0x0057, 0x0301, 0x0002, 0x0077, 0x0301, 0x0002, 0x0057,
+	0x0308, 0x0002, 0x0077, 0x0308, 0x0002, 0x0057, 0x0307, 0x0002,
+	0x0077, 0x0307, 0x0002, 0x0057, 0x0323, 0x0002, 0x0077, 0x0323,
+	0x0002, 0x0058, 0x0307, 0x0002, 0x0078, 0x0307, 0x0002, 0x0058,
+	0x0308, 0x0002, 0x0078, 0x0308, 0x0002, 0x0059, 0x0307, 0x0002,
+	0x0079, 0x0307, 0x0002, 0x005a, 0x0302, 0x0002, 0x007a, 0x0302,
+	0x0002, 0x005a, 0x0323, 0x0002, 0x007a, 0x0323, 0x0002, 0x005a,
+	0x0331, 0x0002, 0x007a, 0x0331, 0x0002, 0x0068, 0x0331, 0x0002,
+	0x0074, 0x0308, 0x0002, 0x0077, 0x030a, 0x0002, 0x0079, 0x030a,
+	0x0002, 0x017f, 0x0307, 0x0002, 0x0041, 0x0323, 0x0002, 0x0061,
+	0x0323, 0x0002, 0x0041, 0x0309, 0x0002, 0x0061, 0x0309, 0x0003,
+	0x0041, 0x0302, 0x0301, 0x0003, 0x0061, 0x0302, 0x0301, 0x0003,
+	0x0041, 0x0302, 0x0300, 0x0003, 0x0061, 0x0302, 0x0300, 0x0003,
+	0x0041, 0x0302, 0x0309, 0x0003, 0x0061, 0x0302, 0x0309, 0x0003,
+	0x0041, 0x0302, 0x0303, 0x0003, 0x0061, 0x0302, 0x0303, 0x0003,
+	0x0041, 0x0323, 0x0302, 0x0003, 0x0061, 0x0323, 0x0302, 0x0003,
+	0x0041, 0x0306, 0x0301, 0x0003, 0x0061, 0x0306, 0x0301, 0x0003,
+	0x0041, 0x0306, 0x0300, 0x0003, 0x0061, 0x0306, 0x0300, 0x0003,
+	0x0041, 0x0306, 0x0309, 0x0003, 0x0061, 0x0306, 0x0309, 0x0003,
+	0x0041, 0x0306, 0x0303, 0x0003, 0x0061, 0x0306, 0x0303, 0x0003,
+	0x0041, 0x0323, 0x0306, 0x0003, 0x0061, 0x0323, 0x0306, 0x0002,
+	0x0045, 0x0323, 0x0002, 0x0065, 0x0323, 0x0002, 0x0045, 0x0309,
+	0x0002, 0x0065, 0x0309, 0x0002, 0x0045, 0x0303, 0x0002, 0x0065,
+	0x0303, 0x0003, 0x0045, 0x0302, 0x0301, 0x0003, 0x0065, 0x0302,
+	0x0301, 0x0003, 0x0045, 0x0302, 0x0300, 0x0003, 0x0065, 0x0302,
+	0x0300, 0x0003, 0x0045, 0x0302, 0x0309, 0x0003, 0x0065, 0x0302,
+	0x0309, 0x0003, 0x0045, 0x0302, 0x0303, 0x0003, 0x0065, 0x0302,
+	0x0303, 0x0003, 0x0045, 0x0323, 0x0302, 0x0003, 0x0065, 0x0323,
+	0x0302, 0x0002, 0x0049, 0x0309, 0x0002, 0x0069, 0x0309, 0x0002,
+	0x0049, 0x0323, 0x0002, 0x0069, 0x0323, 0x0002, 0x004f, 0x0323,
+	0x0002, 0x006f, 0x0323, 0x0002, 0x004f, 0x0309, 0x0002, 0x006f,
+	0x0309, 0x0003, 0x004f, 0x0302, 0x0301, 0x0003, 0x006f, 0x0302,
+	0x0301, 0x0003, 0x004f, 0x0302, 0x0300, 0x0003, 0x006f, 0x0302,
+	0x0300, 0x0003, 0x004f, 0x0302, 0x0309, 0x0003, 0x006f, 0x0302,
+	0x0309, 0x0003, 0x004f, 0x0302, 0x0303, 0x0003, 0x006f, 0x0302,
+	0x0303, 0x0003, 0x004f, 0x0323, 0x0302, 0x0003, 0x006f, 0x0323,
+	0x0302, 0x0003, 0x004f, 0x031b, 0x0301, 0x0003, 0x006f, 0x031b,
+	0x0301, 0x0003, 0x004f, 0x031b, 0x0300, 0x0003, 0x006f, 0x031b,
+	0x0300, 0x0003, 0x004f, 0x031b, 0x0309, 0x0003, 0x006f, 0x031b,
+	0x0309, 0x0003, 0x004f, 0x031b, 0x0303, 0x0003, 0x006f, 0x031b,
+	0x0303, 0x0003, 0x004f, 0x031b, 0x0323, 0x0003, 0x006f, 0x031b,
+	0x0323, 0x0002, 0x0055, 0x0323, 0x0002, 0x0075, 0x0323, 0x0002,
+	0x0055, 0x0309, 0x0002, 0x0075, 0x0309, 0x0003, 0x0055, 0x031b,
+	0x0301, 0x0003, 0x0075, 0x031b, 0x0301, 0x0003, 0x0055, 0x031b,
+	0x0300, 0x0003, 0x0075, 0x031b, 0x0300, 0x0003, 0x0055, 0x031b,
+	0x0309, 0x0003, 0x0075, 0x031b, 0x0309, 0x0003, 0x0055, 0x031b,
+	0x0303, 0x0003, 0x0075, 0x031b, 0x0303, 0x0003, 0x0055, 0x031b,
+	0x0323, 0x0003, 0x0075, 0x031b, 0x0323, 0x0002, 0x0059, 0x0300,
+	0x0002, 0x0079, 0x0300, 0x0002, 0x0059, 0x0323, 0x0002, 0x0079,
+	0x0323, 0x0002, 0x0059, 0x0309, 0x0002, 0x0079, 0x0309, 0x0002,
+	0x0059, 0x0303, 0x0002, 0x0079, 0x0303, 0x0002, 0x03b1, 0x0313,
+	0x0002, 0x03b1, 0x0314, 0x0003, 0x03b1, 0x0313, 0x0300, 0x0003,
+	0x03b1, 0x0314, 0x0300, 0x0003, 0x03b1, 0x0313, 0x0301, 0x0003,
+	0x03b1, 0x0314, 0x0301, 0x0003, 0x03b1, 0x0313, 0x0342, 0x0003,
+	0x03b1, 0x0314, 0x0342, 0x0002, 0x0391, 0x0313, 0x0002, 0x0391,
+	0x0314, 0x0003, 0x0391, 0x0313, 0x0300, 0x0003, 0x0391, 0x0314,
+	0x0300, 0x0003, 0x0391, 0x0313, 0x0301, 0x0003, 0x0391, 0x0314,
+	0x0301, 0x0003, 0x0391, 0x0313, 0x0342, 0x0003, 0x0391, 0x0314,
+	0x0342, 0x0002, 0x03b5, 0x0313, 0x0002, 0x03b5, 0x0314, 0x0003,
+	0x03b5, 0x0313, 0x0300, 0x0003, 0x03b5, 0x0314, 0x0300, 0x0003,
+	0x03b5, 0x0313, 0x0301, 0x0003, 0x03b5, 0x0314, 0x0301, 0x0002,
+	0x0395, 0x0313, 0x0002, 0x0395, 0x0314, 0x0003, 0x0395, 0x0313,
+	0x0300, 0x0003, 0x0395, 0x0314, 0x0300, 0x0003, 0x0395, 0x0313,
+	0x0301, 0x0003, 0x0395, 0x0314, 0x0301, 0x0002, 0x03b7, 0x0313,
+	0x0002, 0x03b7, 0x0314, 0x0003, 0x03b7, 0x0313, 0x0300, 0x0003,
+	0x03b7, 0x0314, 0x0300, 0x0003, 0x03b7, 0x0313, 0x0301, 0x0003,
+	0x03b7, 0x0314, 0x0301, 0x0003, 0x03b7, 0x0313, 0x0342, 0x0003,
+	0x03b7, 0x0314, 0x0342, 0x0002, 0x0397, 0x0313, 0x0002, 0x0397,
+	0x0314, 0x0003, 0x0397, 0x0313, 0x0300, 0x0003, 0x0397, 0x0314,
+	0x0300, 0x0003, 0x0397, 0x0313, 0x0301, 0x0003, 0x0397, 0x0314,
+	0x0301, 0x0003, 0x0397, 0x0313, 0x0342, 0x0003, 0x0397, 0x0314,
+	0x0342, 0x0002, 0x03b9, 0x0313, 0x0002, 0x03b9, 0x0314, 0x0003,
+	0x03b9, 0x0313, 0x0300, 0x0003, 0x03b9, 0x0314, 0x0300, 0x0003,
+	0x03b9, 0x0313, 0x0301, 0x0003, 0x03b9, 0x0314, 0x0301, 0x0003,
+	0x03b9, 0x0313, 0x0342, 0x0003, 0x03b9, 0x0314, 0x0342, 0x0002,
+	0x0399, 0x0313, 0x0002, 0x0399, 0x0314, 0x0003, 0x0399, 0x0313,
+	0x0300, 0x0003, 0x0399, 0x0314, 0x0300, 0x0003, 0x0399, 0x0313,
+	0x0301, 0x0003, 0x0399, 0x0314, 0x0301, 0x0003, 0x0399, 0x0313,
+	0x0342, 0x0003, 0x0399, 0x0314, 0x0342, 0x0002, 0x03bf, 0x0313,
+	0x0002, 0x03bf, 0x0314, 0x0003, 0x03bf, 0x0313, 0x0300, 0x0003,
+	0x03bf, 0x0314, 0x0300, 0x0003, 0x03bf, 0x0313, 0x0301, 0x0003,
+	0x03bf, 0x0314, 0x0301, 0x0002, 0x039f, 0x0313, 0x0002, 0x039f,
+	0x0314, 0x0003, 0x039f, 0x0313, 0x0300, 0x0003, 0x039f, 0x0314,
+	0x0300, 0x0003, 0x039f, 0x0313, 0x0301, 0x0003, 0x039f, 0x0314,
+	0x0301, 0x0002, 0x03c5, 0x0313, 0x0002, 0x03c5, 0x0314, 0x0003,
+	0x03c5, 0x0313, 0x0300, 0x0003, 0x03c5, 0x0314, 0x0300, 0x0003,
+	0x03c5, 0x0313, 0x0301, 0x0003, 0x03c5, 0x0314, 0x0301, 0x0003,
+	0x03c5, 0x0313, 0x0342, 0x0003, 0x03c5, 0x0314, 0x0342, 0x0002,
+	0x03a5, 0x0314, 0x0003, 0x03a5, 0x0314, 0x0300, 0x0003, 0x03a5,
+	0x0314, 0x0301, 0x0003, 0x03a5, 0x0314, 0x0342, 0x0002, 0x03c9,
+	0x0313, 0x0002, 0x03c9, 0x0314, 0x0003, 0x03c9, 0x0313, 0x0300,
+	0x0003, 0x03c9, 0x0314, 0x0300, 0x0003, 0x03c9, 0x0313, 0x0301,
+	0x0003, 0x03c9, 0x0314, 0x0301, 0x0003, 0x03c9, 0x0313, 0x0342,
+	0x0003, 0x03c9, 0x0314, 0x0342, 0x0002, 0x03a9, 0x0313, 0x0002,
+	0x03a9, 0x0314, 0x0003, 0x03a9, 0x0313, 0x0300, 0x0003, 0x03a9,
+	0x0314, 0x0300, 0x0003, 0x03a9, 0x0313, 0x0301, 0x0003, 0x03a9,
+	0x0314, 0x0301, 0x0003, 0x03a9, 0x0313, 0x0342, 0x0003, 0x03a9,
+	0x0314, 0x0342, 0x0002, 0x03b1, 0x0300, 0x0002, 0x03b1, 0x0301,
+	0x0002, 0x03b5, 0x0300, 0x0002, 0x03b5, 0x0301, 0x0002, 0x03b7,
+	0x0300, 0x0002, 0x03b7, 0x0301, 0x0002, 0x03b9, 0x0300, 0x0002,
+	0x03b9, 0x0301, 0x0002, 0x03bf, 0x0300, 0x0002, 0x03bf, 0x0301,
+	0x0002, 0x03c5, 0x0300, 0x0002, 0x03c5, 0x0301, 0x0002, 0x03c9,
+	0x0300, 0x0002, 0x03c9, 0x0301, 0x0003, 0x03b1, 0x0313, 0x0345,
+	0x0003, 0x03b1, 0x0314, 0x0345, 0x0004, 0x03b1, 0x0313, 0x0300,
+	0x0345, 0x0004, 0x03b1, 0x0314, 0x0300, 0x0345, 0x0004, 0x03b1,
+	0x0313, 0x0301, 0x0345, 0x0004, 0x03b1, 0x0314, 0x0301, 0x0345,
+	0x0004, 0x03b1, 0x0313, 0x0342, 0x0345, 0x0004, 0x03b1, 0x0314,
+	0x0342, 0x0345, 0x0003, 0x0391, 0x0313, 0x0345, 0x0003, 0x0391,
+	0x0314, 0x0345, 0x0004, 0x0391, 0x0313, 0x0300, 0x0345, 0x0004,
+	0x0391, 0x0314, 0x0300, 0x0345, 0x0004, 0x0391, 0x0313, 0x0301,
+	0x0345, 0x0004, 0x0391, 0x0314, 0x0301, 0x0345, 0x0004, 0x0391,
+	0x0313, 0x0342, 0x0345, 0x0004, 0x0391, 0x0314, 0x0342, 0x0345,
+	0x0003, 0x03b7, 0x0313, 0x0345, 0x0003, 0x03b7, 0x0314, 0x0345,
+	0x0004, 0x03b7, 0x0313, 0x0300, 0x0345, 0x0004, 0x03b7, 0x0314,
+	0x0300, 0x0345, 0x0004, 0x03b7, 0x0313, 0x0301, 0x0345, 0x0004,
+	0x03b7, 0x0314, 0x0301, 0x0345, 0x0004, 0x03b7, 0x0313, 0x0342,
+	0x0345, 0x0004, 0x03b7, 0x0314, 0x0342, 0x0345, 0x0003, 0x0397,
+	0x0313, 0x0345, 0x0003, 0x0397, 0x0314, 0x0345, 0x0004, 0x0397,
+	0x0313, 0x0300, 0x0345, 0x0004, 0x0397, 0x0314, 0x0300, 0x0345,
+	0x0004, 0x0397, 0x0313, 0x0301, 0x0345, 0x0004, 0x0397, 0x0314,
+	0x0301, 0x0345, 0x0004, 0x0397, 0x0313, 0x0342, 0x0345, 0x0004,
+	0x0397, 0x0314, 0x0342, 0x0345, 0x0003, 0x03c9, 0x0313, 0x0345,
+	0x0003, 0x03c9, 0x0314, 0x0345, 0x0004, 0x03c9, 0x0313, 0x0300,
+	0x0345, 0x0004, 0x03c9, 0x0314, 0x0300, 0x0345, 0x0004, 0x03c9,
+	0x0313, 0x0301, 0x0345, 0x0004, 0x03c9, 0x0314, 0x0301, 0x0345,
+	0x0004, 0x03c9, 0x0313, 0x0342, 0x0345, 0x0004, 0x03c9, 0x0314,
+	0x0342, 0x0345, 0x0003, 0x03a9, 0x0313, 0x0345, 0x0003, 0x03a9,
+	0x0314, 0x0345, 0x0004, 0x03a9, 0x0313, 0x0300, 0x0345, 0x0004,
+	0x03a9, 0x0314, 0x0300, 0x0345, 0x0004, 0x03a9, 0x0313, 0x0301,
+	0x0345, 0x0004, 0x03a9, 0x0314, 0x0301, 0x0345, 0x0004, 0x03a9,
+	0x0313, 0x0342, 0x0345, 0x0004, 0x03a9, 0x0314, 0x0342, 0x0345,
+	0x0002, 0x03b1, 0x0306, 0x0002, 0x03b1, 0x0304, 0x0003, 0x03b1,
+	0x0300, 0x0345, 0x0002, 0x03b1, 0x0345, 0x0003, 0x03b1, 0x0301,
+	0x0345, 0x0002, 0x03b1, 0x0342, 0x0003, 0x03b1, 0x0342, 0x0345,
+	0x0002, 0x0391, 0x0306, 0x0002, 0x0391, 0x0304, 0x0002, 0x0391,
+	0x0300, 0x0002, 0x0391, 0x0301, 0x0002, 0x0391, 0x0345, 0x0001,
+	0x03b9, 0x0002, 0x00a8, 0x0342, 0x0003, 0x03b7, 0x0300, 0x0345,
+	0x0002, 0x03b7, 0x0345, 0x0003, 0x03b7, 0x0301, 0x0345, 0x0002,
+	0x03b7, 0x0342, 0x0003, 0x03b7, 0x0342, 0x0345, 0x0002, 0x0395,
+	0x0300, 0x0002, 0x0395, 0x0301, 0x0002, 0x0397, 0x0300, 0x0002,
+	0x0397, 0x0301, 0x0002, 0x0397, 0x0345, 0x0002, 0x1fbf, 0x0300,
+	0x0002, 0x1fbf, 0x0301, 0x0002, 0x1fbf, 0x0342, 0x0002, 0x03b9,
+	0x0306, 0x0002, 0x03b9, 0x0304, 0x0003, 0x03b9, 0x0308, 0x0300,
+	0x0003, 0x03b9, 0x0308, 0x0301, 0x0002, 0x03b9, 0x0342, 0x0003,
+	0x03b9, 0x0308, 0x0342, 0x0002, 0x0399, 0x0306, 0x0002, 0x0399,
+	0x0304, 0x0002, 0x0399, 0x0300, 0x0002, 0x0399, 0x0301, 0x0002,
+	0x1ffe, 0x0300, 0x0002, 0x1ffe, 0x0301, 0x0002, 0x1ffe, 0x0342,
+	0x0002, 0x03c5, 0x0306, 0x0002, 0x03c5, 0x0304, 0x0003, 0x03c5,
+	0x0308, 0x0300, 0x0003, 0x03c5, 0x0308, 0x0301, 0x0002, 0x03c1,
+	0x0313, 0x0002, 0x03c1, 0x0314, 0x0002, 0x03c5, 0x0342, 0x0003,
+	0x03c5, 0x0308, 0x0342, 0x0002, 0x03a5, 0x0306, 0x0002, 0x03a5,
+	0x0304, 0x0002, 0x03a5, 0x0300, 0x0002, 0x03a5, 0x0301, 0x0002,
+	0x03a1, 0x0314, 0x0002, 0x00a8, 0x0300, 0x0002, 0x00a8, 0x0301,
+	0x0001, 0x0060, 0x0003, 0x03c9, 0x0300, 0x0345, 0x0002, 0x03c9,
+	0x0345, 0x0003, 0x03c9, 0x0301, 0x0345, 0x0002, 0x03c9, 0x0342,
+	0x0003, 0x03c9, 0x0342, 0x0345, 0x0002, 0x039f, 0x0300, 0x0002,
+	0x039f, 0x0301, 0x0002, 0x03a9, 0x0300, 0x0002, 0x03a9, 0x0301,
+	0x0002, 0x03a9, 0x0345, 0x0001, 0x00b4, 0x0001, 0x2002, 0x0001,
+	0x2003, 0x0001, 0x03a9, 0x0001, 0x004b, 0x0002, 0x0041, 0x030a,
+	0x0002, 0x2190, 0x0338, 0x0002, 0x2192, 0x0338, 0x0002, 0x2194,
+	0x0338, 0x0002, 0x21d0, 0x0338, 0x0002, 0x21d4, 0x0338, 0x0002,
+	0x21d2, 0x0338, 0x0002, 0x2203, 0x0338, 0x0002, 0x2208, 0x0338,
+	0x0002, 0x220b, 0x0338, 0x0002, 0x2223, 0x0338, 0x0002, 0x2225,
+	0x0338, 0x0002, 0x223c, 0x0338, 0x0002, 0x2243, 0x0338, 0x0002,
+	0x2245, 0x0338, 0x0002, 0x2248, 0x0338, 0x0002, 0x003d, 0x0338,
+	0x0002, 0x2261, 0x0338, 0x0002, 0x224d, 0x0338, 0x0002, 0x003c,
+	0x0338, 0x0002, 0x003e, 0x0338, 0x0002, 0x2264, 0x0338, 0x0002,
+	0x2265, 0x0338, 0x0002, 0x2272, 0x0338, 0x0002, 0x2273, 0x0338,
+	0x0002, 0x2276, 0x0338, 0x0002, 0x2277, 0x0338, 0x0002, 0x227a,
+	0x0338, 0x0002, 0x227b, 0x0338, 0x0002, 0x2282, 0x0338, 0x0002,
+	0x2283, 0x0338, 0x0002, 0x2286, 0x0338, 0x0002, 0x2287, 0x0338,
+	0x0002, 0x22a2, 0x0338, 0x0002, 0x22a8, 0x0338, 0x0002, 0x22a9,
+	0x0338, 0x0002, 0x22ab, 0x0338, 0x0002, 0x227c, 0x0338, 0x0002,
+	0x227d, 0x0338, 0x0002, 0x2291, 0x0338, 0x0002, 0x2292, 0x0338,
+	0x0002, 0x22b2, 0x0338, 0x0002, 0x22b3, 0x0338, 0x0002, 0x22b4,
+	0x0338, 0x0002, 0x22b5, 0x0338, 0x0001, 0x3008, 0x0001, 0x3009,
+	0x0002, 0x2add, 0x0338, 0x0002, 0x304b, 0x3099, 0x0002, 0x304d,
+	0x3099, 0x0002, 0x304f, 0x3099, 0x0002, 0x3051, 0x3099, 0x0002,
+	0x3053, 0x3099, 0x0002, 0x3055, 0x3099, 0x0002, 0x3057, 0x3099,
+	0x0002, 0x3059, 0x3099, 0x0002, 0x305b, 0x3099, 0x0002, 0x305d,
+	0x3099, 0x0002, 0x305f, 0x3099, 0x0002, 0x3061, 0x3099, 0x0002,
+	0x3064, 0x3099, 0x0002, 0x3066, 0x3099, 0x0002, 0x3068, 0x3099,
+	0x0002, 0x306f, 0x3099, 0x0002, 0x306f, 0x309a, 0x0002, 0x3072,
+	0x3099, 0x0002, 0x3072, 0x309a, 0x0002, 0x3075, 0x3099, 0x0002,
+	0x3075, 0x309a, 0x0002, 0x3078, 0x3099, 0x0002, 0x3078, 0x309a,
+	0x0002, 0x307b, 0x3099, 0x0002, 0x307b, 0x309a, 0x0002, 0x3046,
+	0x3099, 0x0002, 0x309d, 0x3099, 0x0002, 0x30ab, 0x3099, 0x0002,
+	0x30ad, 0x3099, 0x0002, 0x30af, 0x3099, 0x0002, 0x30b1, 0x3099,
+	0x0002, 0x30b3, 0x3099, 0x0002, 0x30b5, 0x3099, 0x0002, 0x30b7,
+	0x3099, 0x0002, 0x30b9, 0x3099, 0x0002, 0x30bb, 0x3099, 0x0002,
+	0x30bd, 0x3099, 0x0002, 0x30bf, 0x3099, 0x0002, 0x30c1, 0x3099,
+	0x0002, 0x30c4, 0x3099, 0x0002, 0x30c6, 0x3099, 0x0002, 0x30c8,
+	0x3099, 0x0002, 0x30cf, 0x3099, 0x0002, 0x30cf, 0x309a, 0x0002,
+	0x30d2, 0x3099, 0x0002, 0x30d2, 0x309a, 0x0002, 0x30d5, 0x3099,
+	0x0002, 0x30d5, 0x309a, 0x0002, 0x30d8, 0x3099, 0x0002, 0x30d8,
+	0x309a, 0x0002, 0x30db, 0x3099, 0x0002, 0x30db, 0x309a, 0x0002,
+	0x30a6, 0x3099, 0x0002, 0x30ef, 0x3099, 0x0002, 0x30f0, 0x3099,
+	0x0002, 0x30f1, 0x3099, 0x0002, 0x30f2, 0x3099, 0x0002, 0x30fd,
+	0x3099, 0x0001, 0x8c48, 0x0001, 0x66f4, 0x0001, 0x8eca, 0x0001,
+	0x8cc8, 0x0001, 0x6ed1, 0x0001, 0x4e32, 0x0001, 0x53e5, 0x0001,
+	0x9f9c, 0x0001, 0x9f9c, 0x0001, 0x5951, 0x0001, 0x91d1, 0x0001,
+	0x5587, 0x0001, 0x5948, 0x0001, 0x61f6, 0x0001, 0x7669, 0x0001,
+	0x7f85, 0x0001, 0x863f, 0x0001, 0x87ba, 0x0001, 0x88f8, 0x0001,
+	0x908f, 0x0001, 0x6a02, 0x0001, 0x6d1b, 0x0001, 0x70d9, 0x0001,
+	0x73de, 0x0001, 0x843d, 0x0001, 0x916a, 0x0001, 0x99f1, 0x0001,
+	0x4e82, 0x0001, 0x5375, 0x0001, 0x6b04, 0x0001, 0x721b, 0x0001,
+	0x862d, 0x0001, 0x9e1e, 0x0001, 0x5d50, 0x0001, 0x6feb, 0x0001,
+	0x85cd, 0x0001, 0x8964, 0x0001, 0x62c9, 0x0001, 0x81d8, 0x0001,
+	0x881f, 0x0001, 0x5eca, 0x0001, 0x6717, 0x0001, 0x6d6a, 0x0001,
+	0x72fc, 0x0001, 0x90ce, 0x0001, 0x4f86, 0x0001, 0x51b7, 0x0001,
+	0x52de, 0x0001, 0x64c4, 0x0001, 0x6ad3, 0x0001, 0x7210, 0x0001,
+	0x76e7, 0x0001, 0x8001, 0x0001, 0x8606, 0x0001, 0x865c, 0x0001,
+	0x8def, 0x0001, 0x9732, 0x0001, 0x9b6f, 0x0001, 0x9dfa, 0x0001,
+	0x788c, 0x0001, 0x797f, 0x0001, 0x7da0, 0x0001, 0x83c9, 0x0001,
+	0x9304, 0x0001, 0x9e7f, 0x0001, 0x8ad6, 0x0001, 0x58df, 0x0001,
+	0x5f04, 0x0001, 0x7c60, 0x0001, 0x807e, 0x0001, 0x7262, 0x0001,
+	0x78ca, 0x0001, 0x8cc2, 0x0001, 0x96f7, 0x0001, 0x58d8, 0x0001,
+	0x5c62, 0x0001, 0x6a13, 0x0001, 0x6dda, 0x0001, 0x6f0f, 0x0001,
+	0x7d2f, 0x0001, 0x7e37, 0x0001, 0x964b, 0x0001, 0x52d2, 0x0001,
+	0x808b, 0x0001, 0x51dc, 0x0001, 0x51cc, 0x0001, 0x7a1c, 0x0001,
+	0x7dbe, 0x0001, 0x83f1, 0x0001, 0x9675, 0x0001, 0x8b80, 0x0001,
+	0x62cf, 0x0001, 0x6a02, 0x0001, 0x8afe, 0x0001, 0x4e39, 0x0001,
+	0x5be7, 0x0001, 0x6012, 0x0001, 0x7387, 0x0001, 0x7570, 0x0001,
+	0x5317, 0x0001, 0x78fb, 0x0001, 0x4fbf, 0x0001, 0x5fa9, 0x0001,
+	0x4e0d, 0x0001, 0x6ccc, 0x0001, 0x6578, 0x0001, 0x7d22, 0x0001,
+	0x53c3, 0x0001, 0x585e, 0x0001, 0x7701, 0x0001, 0x8449, 0x0001,
+	0x8aaa, 0x0001, 0x6bba, 0x0001, 0x8fb0, 0x0001, 0x6c88, 0x0001,
+	0x62fe, 0x0001, 0x82e5, 0x0001, 0x63a0, 0x0001, 0x7565, 0x0001,
+	0x4eae, 0x0001, 0x5169, 0x0001, 0x51c9, 0x0001, 0x6881, 0x0001,
+	0x7ce7, 0x0001, 0x826f, 0x0001, 0x8ad2, 0x0001, 0x91cf, 0x0001,
+	0x52f5, 0x0001, 0x5442, 0x0001, 0x5973, 0x0001, 0x5eec, 0x0001,
+	0x65c5, 0x0001, 0x6ffe, 0x0001, 0x792a, 0x0001, 0x95ad, 0x0001,
+	0x9a6a, 0x0001, 0x9e97, 0x0001, 0x9ece, 0x0001, 0x529b, 0x0001,
+	0x66c6, 0x0001, 0x6b77, 0x0001, 0x8f62, 0x0001, 0x5e74, 0x0001,
+	0x6190, 0x0001, 0x6200, 0x0001, 0x649a, 0x0001, 0x6f23, 0x0001,
+	0x7149, 0x0001, 0x7489, 0x0001, 0x79ca, 0x0001, 0x7df4, 0x0001,
+	0x806f, 0x0001, 0x8f26, 0x0001, 0x84ee, 0x0001, 0x9023, 0x0001,
+	0x934a, 0x0001, 0x5217, 0x0001, 0x52a3, 0x0001, 0x54bd, 0x0001,
+	0x70c8, 0x0001, 0x88c2, 0x0001, 0x8aaa, 0x0001, 0x5ec9, 0x0001,
+	0x5ff5, 0x0001, 0x637b, 0x0001, 0x6bae, 0x0001, 0x7c3e, 0x0001,
+	0x7375, 0x0001, 0x4ee4, 0x0001, 0x56f9, 0x0001, 0x5be7, 0x0001,
+	0x5dba, 0x0001, 0x601c, 0x0001, 0x73b2, 0x0001, 0x7469, 0x0001,
+	0x7f9a, 0x0001, 0x8046, 0x0001, 0x9234, 0x0001, 0x96f6, 0x0001,
+	0x9748, 0x0001, 0x9818, 0x0001, 0x4f8b, 0x0001, 0x79ae, 0x0001,
+	0x91b4, 0x0001, 0x96b8, 0x0001, 0x60e1, 0x0001, 0x4e86, 0x0001,
+	0x50da, 0x0001, 0x5bee, 0x0001, 0x5c3f, 0x0001, 0x6599, 0x0001,
+	0x6a02, 0x0001, 0x71ce, 0x0001, 0x7642, 0x0001, 0x84fc, 0x0001,
+	0x907c, 0x0001, 0x9f8d, 0x0001, 0x6688, 0x0001, 0x962e, 0x0001,
+	0x5289, 0x0001, 0x677b, 0x0001, 0x67f3, 0x0001, 0x6d41, 0x0001,
+	0x6e9c, 0x0001, 0x7409, 0x0001, 0x7559, 0x0001, 0x786b, 0x0001,
+	0x7d10, 0x0001, 0x985e, 0x0001, 0x516d, 0x0001, 0x622e, 0x0001,
+	0x9678, 0x0001, 0x502b, 0x0001, 0x5d19, 0x0001, 0x6dea, 0x0001,
+	0x8f2a, 0x0001, 0x5f8b, 0x0001, 0x6144, 0x0001, 0x6817, 0x0001,
+	0x7387, 0x0001, 0x9686, 0x0001, 0x5229, 0x0001, 0x540f, 0x0001,
+	0x5c65, 0x0001, 0x6613, 0x0001, 0x674e, 0x0001, 0x68a8, 0x0001,
+	0x6ce5, 0x0001, 0x7406, 0x0001, 0x75e2, 0x0001, 0x7f79, 0x0001,
+	0x88cf, 0x0001, 0x88e1, 0x0001, 0x91cc, 0x0001, 0x96e2, 0x0001,
+	0x533f, 0x0001, 0x6eba, 0x0001, 0x541d, 0x0001, 0x71d0, 0x0001,
+	0x7498, 0x0001, 0x85fa, 0x0001, 0x96a3, 0x0001, 0x9c57, 0x0001,
+	0x9e9f, 0x0001, 0x6797, 0x0001, 0x6dcb, 0x0001, 0x81e8, 0x0001,
+	0x7acb, 0x0001, 0x7b20, 0x0001, 0x7c92, 0x0001, 0x72c0, 0x0001,
+	0x7099, 0x0001, 0x8b58, 0x0001, 0x4ec0, 0x0001, 0x8336, 0x0001,
+	0x523a, 0x0001, 0x5207, 0x0001, 0x5ea6, 0x0001, 0x62d3, 0x0001,
+	0x7cd6, 0x0001, 0x5b85, 0x0001, 0x6d1e, 0x0001, 0x66b4, 0x0001,
+	0x8f3b, 0x0001, 0x884c, 0x0001, 0x964d, 0x0001, 0x898b, 0x0001,
+	0x5ed3, 0x0001, 0x5140, 0x0001, 0x55c0, 0x0001, 0x585a, 0x0001,
+	0x6674, 0x0001, 0x51de, 0x0001, 0x732a, 0x0001, 0x76ca, 0x0001,
+	0x793c, 0x0001, 0x795e, 0x0001, 0x7965, 0x0001, 0x798f, 0x0001,
+	0x9756, 0x0001, 0x7cbe, 0x0001, 0x7fbd, 0x0001, 0x8612, 0x0001,
+	0x8af8, 0x0001, 0x9038, 0x0001, 0x90fd, 0x0001, 0x98ef, 0x0001,
+	0x98fc, 0x0001, 0x9928, 0x0001, 0x9db4, 0x0001, 0x90de, 0x0001,
+	0x96b7, 0x0001, 0x4fae, 0x0001, 0x50e7, 0x0001, 0x514d, 0x0001,
+	0x52c9, 0x0001, 0x52e4, 0x0001, 0x5351, 0x0001, 0x559d, 0x0001,
+	0x5606, 0x0001, 0x5668, 0x0001, 0x5840, 0x0001, 0x58a8, 0x0001,
+	0x5c64, 0x0001, 0x5c6e, 0x0001, 0x6094, 0x0001, 0x6168, 0x0001,
+	0x618e, 0x0001, 0x61f2, 0x0001, 0x654f, 0x0001, 0x65e2, 0x0001,
+	0x6691, 0x0001, 0x6885, 0x0001, 0x6d77, 0x0001, 0x6e1a, 0x0001,
+	0x6f22, 0x0001, 0x716e, 0x0001, 0x722b, 0x0001, 0x7422, 0x0001,
+	0x7891, 0x0001, 0x793e, 0x0001, 0x7949, 0x0001, 0x7948, 0x0001,
+	0x7950, 0x0001, 0x7956, 0x0001, 0x795d, 0x0001, 0x798d, 0x0001,
+	0x798e, 0x0001, 0x7a40, 0x0001, 0x7a81, 0x0001, 0x7bc0, 0x0001,
+	0x7df4, 0x0001, 0x7e09, 0x0001, 0x7e41, 0x0001, 0x7f72, 0x0001,
+	0x8005, 0x0001, 0x81ed, 0x0001, 0x8279, 0x0001, 0x8279, 0x0001,
+	0x8457, 0x0001, 0x8910, 0x0001, 0x8996, 0x0001, 0x8b01, 0x0001,
+	0x8b39, 0x0001, 0x8cd3, 0x0001, 0x8d08, 0x0001, 0x8fb6, 0x0001,
+	0x9038, 0x0001, 0x96e3, 0x0001, 0x97ff, 0x0001, 0x983b, 0x0001,
+	0x6075, 0x0001, 0x242ee, 0x0001, 0x8218, 0x0001, 0x4e26, 0x0001,
+	0x51b5, 0x0001, 0x5168, 0x0001, 0x4f80, 0x0001, 0x5145, 0x0001,
+	0x5180, 0x0001, 0x52c7, 0x0001, 0x52fa, 0x0001, 0x559d, 0x0001,
+	0x5555, 0x0001, 0x5599, 0x0001, 0x55e2, 0x0001, 0x585a, 0x0001,
+	0x58b3, 0x0001, 0x5944, 0x0001, 0x5954, 0x0001, 0x5a62, 0x0001,
+	0x5b28, 0x0001, 0x5ed2, 0x0001, 0x5ed9, 0x0001, 0x5f69, 0x0001,
+	0x5fad, 0x0001, 0x60d8, 0x0001, 0x614e, 0x0001, 0x6108, 0x0001,
+	0x618e, 0x0001, 0x6160, 0x0001, 0x61f2, 0x0001, 0x6234, 0x0001,
+	0x63c4, 0x0001, 0x641c, 0x0001, 0x6452, 0x0001, 0x6556, 0x0001,
+	0x6674, 0x0001, 0x6717, 0x0001, 0x671b, 0x0001, 0x6756, 0x0001,
+	0x6b79, 0x0001, 0x6bba, 0x0001, 0x6d41, 0x0001, 0x6edb, 0x0001,
+	0x6ecb, 0x0001, 0x6f22, 0x0001, 0x701e, 0x0001, 0x716e, 0x0001,
+	0x77a7, 0x0001, 0x7235, 0x0001, 0x72af, 0x0001, 0x732a, 0x0001,
+	0x7471, 0x0001, 0x7506, 0x0001, 0x753b, 0x0001, 0x761d, 0x0001,
+	0x761f, 0x0001, 0x76ca, 0x0001, 0x76db, 0x0001, 0x76f4, 0x0001,
+	0x774a, 0x0001, 0x7740, 0x0001, 0x78cc, 0x0001, 0x7ab1, 0x0001,
+	0x7bc0, 0x0001, 0x7c7b, 0x0001, 0x7d5b, 0x0001, 0x7df4, 0x0001,
+	0x7f3e, 0x0001, 0x8005, 0x0001, 0x8352, 0x0001, 0x83ef, 0x0001,
+	0x8779, 0x0001, 0x8941, 0x0001, 0x8986, 0x0001, 0x8996, 0x0001,
+	0x8abf, 0x0001, 0x8af8, 0x0001, 0x8acb, 0x0001, 0x8b01, 0x0001,
+	0x8afe, 0x0001, 0x8aed, 0x0001, 0x8b39, 0x0001, 0x8b8a, 0x0001,
+	0x8d08, 0x0001, 0x8f38, 0x0001, 0x9072, 0x0001, 0x9199, 0x0001,
+	0x9276, 0x0001, 0x967c, 0x0001, 0x96e3, 0x0001, 0x9756, 0x0001,
+	0x97db, 0x0001, 0x97ff, 0x0001, 0x980b, 0x0001, 0x983b, 0x0001,
+	0x9b12, 0x0001, 0x9f9c, 0x0001, 0x2284a, 0x0001, 0x22844, 0x0001,
+	0x233d5, 0x0001, 0x3b9d, 0x0001, 0x4018, 0x0001, 0x4039, 0x0001,
+	0x25249, 0x0001, 0x25cd0, 0x0001, 0x27ed3, 0x0001, 0x9f43, 0x0001,
+	0x9f8e, 0x0002, 0x05d9, 0x05b4, 0x0002, 0x05f2, 0x05b7, 0x0002,
+	0x05e9, 0x05c1, 0x0002, 0x05e9, 0x05c2, 0x0003, 0x05e9, 0x05bc,
+	0x05c1, 0x0003, 0x05e9, 0x05bc, 0x05c2, 0x0002, 0x05d0, 0x05b7,
+	0x0002, 0x05d0, 0x05b8, 0x0002, 0x05d0, 0x05bc, 0x0002, 0x05d1,
+	0x05bc, 0x0002, 0x05d2, 0x05bc, 0x0002, 0x05d3, 0x05bc, 0x0002,
+	0x05d4, 0x05bc, 0x0002, 0x05d5, 0x05bc, 0x0002, 0x05d6, 0x05bc,
+	0x0002, 0x05d8, 0x05bc, 0x0002, 0x05d9, 0x05bc, 0x0002, 0x05da,
+	0x05bc, 0x0002, 0x05db, 0x05bc, 0x0002, 0x05dc, 0x05bc, 0x0002,
+	0x05de, 0x05bc, 0x0002, 0x05e0, 0x05bc, 0x0002, 0x05e1, 0x05bc,
+	0x0002, 0x05e3, 0x05bc, 0x0002, 0x05e4, 0x05bc, 0x0002, 0x05e6,
+	0x05bc, 0x0002, 0x05e7, 0x05bc, 0x0002, 0x05e8, 0x05bc, 0x0002,
+	0x05e9, 0x05bc, 0x0002, 0x05ea, 0x05bc, 0x0002, 0x05d5, 0x05b9,
+	0x0002, 0x05d1, 0x05bf, 0x0002, 0x05db, 0x05bf, 0x0002, 0x05e4,
+	0x05bf, 0x0002, 0x11099, 0x110ba, 0x0002, 0x1109b, 0x110ba, 0x0002,
+	0x110a5, 0x110ba, 0x0002, 0x11131, 0x11127, 0x0002, 0x11132, 0x11127,
+	0x0002, 0x11347, 0x1133e, 0x0002, 0x11347, 0x11357, 0x0002, 0x114b9,
+	0x114ba, 0x0002, 0x114b9, 0x114b0, 0x0002, 0x114b9, 0x114bd, 0x0002,
+	0x115b8, 0x115af, 0x0002, 0x115b9, 0x115af, 0x0002, 0x11935, 0x11930,
+	0x0002, 0x1d157, 0x1d165, 0x0002, 0x1d158, 0x1d165, 0x0003, 0x1d158,
+	0x1d165, 0x1d16e, 0x0003, 0x1d158, 0x1d165, 0x1d16f, 0x0003, 0x1d158,
+	0x1d165, 0x1d170, 0x0003, 0x1d158, 0x1d165, 0x1d171, 0x0003, 0x1d158,
+	0x1d165, 0x1d172, 0x0002, 0x1d1b9, 0x1d165, 0x0002, 0x1d1ba, 0x1d165,
+	0x0003, 0x1d1b9, 0x1d165, 0x1d16e, 0x0003, 0x1d1ba, 0x1d165, 0x1d16e,
+	0x0003, 0x1d1b9, 0x1d165, 0x1d16f, 0x0003, 0x1d1ba, 0x1d165, 0x1d16f,
+	0x0001, 0x4e3d, 0x0001, 0x4e38, 0x0001, 0x4e41, 0x0001, 0x20122,
+	0x0001, 0x4f60, 0x0001, 0x4fae, 0x0001, 0x4fbb, 0x0001, 0x5002,
+	0x0001, 0x507a, 0x0001, 0x5099, 0x0001, 0x50e7, 0x0001, 0x50cf,
+	0x0001, 0x349e, 0x0001, 0x2063a, 0x0001, 0x514d, 0x0001, 0x5154,
+	0x0001, 0x5164, 0x0001, 0x5177, 0x0001, 0x2051c, 0x0001, 0x34b9,
+	0x0001, 0x5167, 0x0001, 0x518d, 0x0001, 0x2054b, 0x0001, 0x5197,
+	0x0001, 0x51a4, 0x0001, 0x4ecc, 0x0001, 0x51ac, 0x0001, 0x51b5,
+	0x0001, 0x291df, 0x0001, 0x51f5, 0x0001, 0x5203, 0x0001, 0x34df,
+	0x0001, 0x523b, 0x0001, 0x5246, 0x0001, 0x5272, 0x0001, 0x5277,
+	0x0001, 0x3515, 0x0001, 0x52c7, 0x0001, 0x52c9, 0x0001, 0x52e4,
+	0x0001, 0x52fa, 0x0001, 0x5305, 0x0001, 0x5306, 0x0001, 0x5317,
+	0x0001, 0x5349, 0x0001, 0x5351, 0x0001, 0x535a, 0x0001, 0x5373,
+	0x0001, 0x537d, 0x0001, 0x537f, 0x0001, 0x537f, 0x0001, 0x537f,
+	0x0001, 0x20a2c, 0x0001, 0x7070, 0x0001, 0x53ca, 0x0001, 0x53df,
+	0x0001, 0x20b63, 0x0001, 0x53eb, 0x0001, 0x53f1, 0x0001, 0x5406,
+	0x0001, 0x549e, 0x0001, 0x5438, 0x0001, 0x5448, 0x0001, 0x5468,
+	0x0001, 0x54a2, 0x0001, 0x54f6, 0x0001, 0x5510, 0x0001, 0x5553,
+	0x0001, 0x5563, 0x0001, 0x5584, 0x0001, 0x5584, 0x0001, 0x5599,
+	0x0001, 0x55ab, 0x0001, 0x55b3, 0x0001, 0x55c2, 0x0001, 0x5716,
+	0x0001, 0x5606, 0x0001, 0x5717, 0x0001, 0x5651, 0x0001, 0x5674,
+	0x0001, 0x5207, 0x0001, 0x58ee, 0x0001, 0x57ce, 0x0001, 0x57f4,
+	0x0001, 0x580d, 0x0001, 0x578b, 0x0001, 0x5832, 0x0001, 0x5831,
+	0x0001, 0x58ac, 0x0001, 0x214e4, 0x0001, 0x58f2, 0x0001, 0x58f7,
+	0x0001, 0x5906, 0x0001, 0x591a, 0x0001, 0x5922, 0x0001, 0x5962,
+	0x0001, 0x216a8, 0x0001, 0x216ea, 0x0001, 0x59ec, 0x0001, 0x5a1b,
+	0x0001, 0x5a27, 0x0001, 0x59d8, 0x0001, 0x5a66, 0x0001, 0x36ee,
+	0x0001, 0x36fc, 0x0001, 0x5b08, 0x0001, 0x5b3e, 0x0001, 0x5b3e,
+	0x0001, 0x219c8, 0x0001, 0x5bc3, 0x0001, 0x5bd8, 0x0001, 0x5be7,
+	0x0001, 0x5bf3, 0x0001, 0x21b18, 0x0001, 0x5bff, 0x0001, 0x5c06,
+	0x0001, 0x5f53, 0x0001, 0x5c22, 0x0001, 0x3781, 0x0001, 0x5c60,
+	0x0001, 0x5c6e, 0x0001, 0x5cc0, 0x0001, 0x5c8d, 0x0001, 0x21de4,
+	0x0001, 0x5d43, 0x0001, 0x21de6, 0x0001, 0x5d6e, 0x0001, 0x5d6b,
+	0x0001, 0x5d7c, 0x0001, 0x5de1, 0x0001, 0x5de2, 0x0001, 0x382f,
+	0x0001, 0x5dfd, 0x0001, 0x5e28, 0x0001, 0x5e3d, 0x0001, 0x5e69,
+	0x0001, 0x3862, 0x0001, 0x22183, 0x0001, 0x387c, 0x0001, 0x5eb0,
+	0x0001, 0x5eb3, 0x0001, 0x5eb6, 0x0001, 0x5eca, 0x0001, 0x2a392,
+	0x0001, 0x5efe, 0x0001, 0x22331, 0x0001, 0x22331, 0x0001, 0x8201,
+	0x0001, 0x5f22, 0x0001, 0x5f22, 0x0001, 0x38c7, 0x0001, 0x232b8,
+	0x0001, 0x261da, 0x0001, 0x5f62, 0x0001, 0x5f6b, 0x0001, 0x38e3,
+	0x0001, 0x5f9a, 0x0001, 0x5fcd, 0x0001, 0x5fd7, 0x0001, 0x5ff9,
+	0x0001, 0x6081, 0x0001, 0x393a, 0x0001, 0x391c, 0x0001, 0x6094,
+	0x0001, 0x226d4, 0x0001, 0x60c7, 0x0001, 0x6148, 0x0001, 0x614c,
+	0x0001, 0x614e, 0x0001, 0x614c, 0x0001, 0x617a, 0x0001, 0x618e,
+	0x0001, 0x61b2, 0x0001, 0x61a4, 0x0001, 0x61af, 0x0001, 0x61de,
+	0x0001, 0x61f2, 0x0001, 0x61f6, 0x0001, 0x6210, 0x0001, 0x621b,
+	0x0001, 0x625d, 0x0001, 0x62b1, 0x0001, 0x62d4, 0x0001, 0x6350,
+	0x0001, 0x22b0c, 0x0001, 0x633d, 0x0001, 0x62fc, 0x0001, 0x6368,
+	0x0001, 0x6383, 0x0001, 0x63e4, 0x0001, 0x22bf1, 0x0001, 0x6422,
+	0x0001, 0x63c5, 0x0001, 0x63a9, 0x0001, 0x3a2e, 0x0001, 0x6469,
+	0x0001, 0x647e, 0x0001, 0x649d, 0x0001, 0x6477, 0x0001, 0x3a6c,
+	0x0001, 0x654f, 0x0001, 0x656c, 0x0001, 0x2300a, 0x0001, 0x65e3,
+	0x0001, 0x66f8, 0x0001, 0x6649, 0x0001, 0x3b19, 0x0001, 0x6691,
+	0x0001, 0x3b08, 0x0001, 0x3ae4, 0x0001, 0x5192, 0x0001, 0x5195,
+	0x0001, 0x6700, 0x0001, 0x669c, 0x0001, 0x80ad, 0x0001, 0x43d9,
+	0x0001, 0x6717, 0x0001, 0x671b, 0x0001, 0x6721, 0x0001, 0x675e,
+	0x0001, 0x6753, 0x0001, 0x233c3, 0x0001, 0x3b49, 0x0001, 0x67fa,
+	0x0001, 0x6785, 0x0001, 0x6852, 0x0001, 0x6885, 0x0001, 0x2346d,
+	0x0001, 0x688e, 0x0001, 0x681f, 0x0001, 0x6914, 0x0001, 0x3b9d,
+	0x0001, 0x6942, 0x0001, 0x69a3, 0x0001, 0x69ea, 0x0001, 0x6aa8,
+	0x0001, 0x236a3, 0x0001, 0x6adb, 0x0001, 0x3c18, 0x0001, 0x6b21,
+	0x0001, 0x238a7, 0x0001, 0x6b54, 0x0001, 0x3c4e, 0x0001, 0x6b72,
+	0x0001, 0x6b9f, 0x0001, 0x6bba, 0x0001, 0x6bbb, 0x0001, 0x23a8d,
+	0x0001, 0x21d0b, 0x0001, 0x23afa, 0x0001, 0x6c4e, 0x0001, 0x23cbc,
+	0x0001, 0x6cbf, 0x0001, 0x6ccd, 0x0001, 0x6c67, 0x0001, 0x6d16,
+	0x0001, 0x6d3e, 0x0001, 0x6d77, 0x0001, 0x6d41, 0x0001, 0x6d69,
+	0x0001, 0x6d78, 0x0001, 0x6d85, 0x0001, 0x23d1e, 0x0001, 0x6d34,
+	0x0001, 0x6e2f, 0x0001, 0x6e6e, 0x0001, 0x3d33, 0x0001, 0x6ecb,
+	0x0001, 0x6ec7, 0x0001, 0x23ed1, 0x0001, 0x6df9, 0x0001, 0x6f6e,
+	0x0001, 0x23f5e, 0x0001, 0x23f8e, 0x0001, 0x6fc6, 0x0001, 0x7039,
+	0x0001, 0x701e, 0x0001, 0x701b, 0x0001, 0x3d96, 0x0001, 0x704a,
+	0x0001, 0x707d, 0x0001, 0x7077, 0x0001, 0x70ad, 0x0001, 0x20525,
+	0x0001, 0x7145, 0x0001, 0x24263, 0x0001, 0x719c, 0x0001, 0x243ab,
+	0x0001, 0x7228, 0x0001, 0x7235, 0x0001, 0x7250, 0x0001, 0x24608,
+	0x0001, 0x7280, 0x0001, 0x7295, 0x0001, 0x24735, 0x0001, 0x24814,
+	0x0001, 0x737a, 0x0001, 0x738b, 0x0001, 0x3eac, 0x0001, 0x73a5,
+	0x0001, 0x3eb8, 0x0001, 0x3eb8, 0x0001, 0x7447, 0x0001, 0x745c,
+	0x0001, 0x7471, 0x0001, 0x7485, 0x0001, 0x74ca, 0x0001, 0x3f1b,
+	0x0001, 0x7524, 0x0001, 0x24c36, 0x0001, 0x753e, 0x0001, 0x24c92,
+	0x0001, 0x7570, 0x0001, 0x2219f, 0x0001, 0x7610, 0x0001, 0x24fa1,
+	0x0001, 0x24fb8, 0x0001, 0x25044, 0x0001, 0x3ffc, 0x0001, 0x4008,
+	0x0001, 0x76f4, 0x0001, 0x250f3, 0x0001, 0x250f2, 0x0001, 0x25119,
+	0x0001, 0x25133, 0x0001, 0x771e, 0x0001, 0x771f, 0x0001, 0x771f,
+	0x0001, 0x774a, 0x0001, 0x4039, 0x0001, 0x778b, 0x0001, 0x4046,
+	0x0001, 0x4096, 0x0001, 0x2541d, 0x0001, 0x784e, 0x0001, 0x788c,
+	0x0001, 0x78cc, 0x0001, 0x40e3, 0x0001, 0x25626, 0x0001, 0x7956,
+	0x0001, 0x2569a, 0x0001, 0x256c5, 0x0001, 0x798f, 0x0001, 0x79eb,
+	0x0001, 0x412f, 0x0001, 0x7a40, 0x0001, 0x7a4a, 0x0001, 0x7a4f,
+	0x0001, 0x2597c, 0x0001, 0x25aa7, 0x0001, 0x25aa7, 0x0001, 0x7aee,
+	0x0001, 0x4202, 0x0001, 0x25bab, 0x0001, 0x7bc6, 0x0001, 0x7bc9,
+	0x0001, 0x4227, 0x0001, 0x25c80, 0x0001, 0x7cd2, 0x0001, 0x42a0,
+	0x0001, 0x7ce8, 0x0001, 0x7ce3, 0x0001, 0x7d00, 0x0001, 0x25f86,
+	0x0001, 0x7d63, 0x0001, 0x4301, 0x0001, 0x7dc7, 0x0001, 0x7e02,
+	0x0001, 0x7e45, 0x0001, 0x4334, 0x0001, 0x26228, 0x0001, 0x26247,
+	0x0001, 0x4359, 0x0001, 0x262d9, 0x0001, 0x7f7a, 0x0001, 0x2633e,
+	0x0001, 0x7f95, 0x0001, 0x7ffa, 0x0001, 0x8005, 0x0001, 0x264da,
+	0x0001, 0x26523, 0x0001, 0x8060, 0x0001, 0x265a8, 0x0001, 0x8070,
+	0x0001, 0x2335f, 0x0001, 0x43d5, 0x0001, 0x80b2, 0x0001, 0x8103,
+	0x0001, 0x440b, 0x0001, 0x813e, 0x0001, 0x5ab5, 0x0001, 0x267a7,
+	0x0001, 0x267b5, 0x0001, 0x23393, 0x0001, 0x2339c, 0x0001, 0x8201,
+	0x0001, 0x8204, 0x0001, 0x8f9e, 0x0001, 0x446b, 0x0001, 0x8291,
+	0x0001, 0x828b, 0x0001, 0x829d, 0x0001, 0x52b3, 0x0001, 0x82b1,
+	0x0001, 0x82b3, 0x0001, 0x82bd, 0x0001, 0x82e6, 0x0001, 0x26b3c,
+	0x0001, 0x82e5, 0x0001, 0x831d, 0x0001, 0x8363, 0x0001, 0x83ad,
+	0x0001, 0x8323, 0x0001, 0x83bd, 0x0001, 0x83e7, 0x0001, 0x8457,
+	0x0001, 0x8353, 0x0001, 0x83ca, 0x0001, 0x83cc, 0x0001, 0x83dc,
+	0x0001, 0x26c36, 0x0001, 0x26d6b, 0x0001, 0x26cd5, 0x0001, 0x452b,
+	0x0001, 0x84f1, 0x0001, 0x84f3, 0x0001, 0x8516, 0x0001, 0x273ca,
+	0x0001, 0x8564, 0x0001, 0x26f2c, 0x0001, 0x455d, 0x0001, 0x4561,
+	0x0001, 0x26fb1, 0x0001, 0x270d2, 0x0001, 0x456b, 0x0001, 0x8650,
+	0x0001, 0x865c, 0x0001, 0x8667, 0x0001, 0x8669, 0x0001, 0x86a9,
+	0x0001, 0x8688, 0x0001, 0x870e, 0x0001, 0x86e2, 0x0001, 0x8779,
+	0x0001, 0x8728, 0x0001, 0x876b, 0x0001, 0x8786, 0x0001, 0x45d7,
+	0x0001, 0x87e1, 0x0001, 0x8801, 0x0001, 0x45f9, 0x0001, 0x8860,
+	0x0001, 0x8863, 0x0001, 0x27667, 0x0001, 0x88d7, 0x0001, 0x88de,
+	0x0001, 0x4635, 0x0001, 0x88fa, 0x0001, 0x34bb, 0x0001, 0x278ae,
+	0x0001, 0x27966, 0x0001, 0x46be, 0x0001, 0x46c7, 0x0001, 0x8aa0,
+	0x0001, 0x8aed, 0x0001, 0x8b8a, 0x0001, 0x8c55, 0x0001, 0x27ca8,
+	0x0001, 0x8cab, 0x0001, 0x8cc1, 0x0001, 0x8d1b, 0x0001, 0x8d77,
+	0x0001, 0x27f2f, 0x0001, 0x20804, 0x0001, 0x8dcb, 0x0001, 0x8dbc,
+	0x0001, 0x8df0, 0x0001, 0x208de, 0x0001, 0x8ed4, 0x0001, 0x8f38,
+	0x0001, 0x285d2, 0x0001, 0x285ed, 0x0001, 0x9094, 0x0001, 0x90f1,
+	0x0001, 0x9111, 0x0001, 0x2872e, 0x0001, 0x911b, 0x0001, 0x9238,
+	0x0001, 0x92d7, 0x0001, 0x92d8, 0x0001, 0x927c, 0x0001, 0x93f9,
+	0x0001, 0x9415, 0x0001, 0x28bfa, 0x0001, 0x958b, 0x0001, 0x4995,
+	0x0001, 0x95b7, 0x0001, 0x28d77, 0x0001, 0x49e6, 0x0001, 0x96c3,
+	0x0001, 0x5db2, 0x0001, 0x9723, 0x0001, 0x29145, 0x0001, 0x2921a,
+	0x0001, 0x4a6e, 0x0001, 0x4a76, 0x0001, 0x97e0, 0x0001, 0x2940a,
+	0x0001, 0x4ab2, 0x0001, 0x29496, 0x0001, 0x980b, 0x0001, 0x980b,
+	0x0001, 0x9829, 0x0001, 0x295b6, 0x0001, 0x98e2, 0x0001, 0x4b33,
+	0x0001, 0x9929, 0x0001, 0x99a7, 0x0001, 0x99c2, 0x0001, 0x99fe,
+	0x0001, 0x4bce, 0x0001, 0x29b30, 0x0001, 0x9b12, 0x0001, 0x9c40,
+	0x0001, 0x9cfd, 0x0001, 0x4cce, 0x0001, 0x4ced, 0x0001, 0x9d67,
+	0x0001, 0x2a0ce, 0x0001, 0x4cf8, 0x0001, 0x2a105, 0x0001, 0x2a20e,
+	0x0001, 0x2a291, 0x0001, 0x9ebb, 0x0001, 0x4d56, 0x0001, 0x9ef9,
+	0x0001, 0x9efe, 0x0001, 0x9f05, 0x0001, 0x9f0f, 0x0001, 0x9f16,
+	0x0001, 0x9f3b, 0x0001, 0x2a600
+};
+
@@ -0,0 +1,57 @@
+/*
+ * Unicode case folding and NFD tables
+ *
+ * Copyright (C) 2008-2019, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This software is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This software is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this software.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#if !defined( _UNICODE_TABLES_H )
+#define _UNICODE_TABLES_H
+
+#include <common.h>
+#include <types.h>
+
+#if defined( __cplusplus )
+extern "C" {
+#endif
+
+/* The number of Unicode characters per block of the tables
+ */
+#define UNICODE_TABLES_BLOCK_SIZE	256
+
+extern const uint32_t unicode_tables_case_folding_number_of_pages;
+
+extern const uint8_t unicode_tables_case_folding_pages[];
+
+extern const uint8_t unicode_tables_case_folding_blocks[];
+
+extern const int32_t unicode_tables_case_folding_deltas[];
+
+extern const uint32_t unicode_tables_nfd_number_of_pages;
+
+extern const uint8_t unicode_tables_nfd_pages[];
+
+extern const uint16_t unicode_tables_nfd_blocks[];
+
+extern const uint32_t unicode_tables_nfd_sequences[];
+
+#if defined( __cplusplus )
+}
+#endif
+
+#endif /* !defined( _UNICODE_TABLES_H ) */
+
@@ -0,0 +1,659 @@
+/*
+ * Verifies the checksums of SQLite write-ahead log (WAL) files
+ *
+ * Copyright (C) 2008-2019, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This software is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This software is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this software.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <file_stream.h>
+#include <memory.h>
+#include <system_string.h>
+#include <types.h>
+
+#if defined( HAVE_STDLIB_H )
+#include <stdlib.h>
+#endif
+
+#include "assorted_getopt.h"
+#include "assorted_input_file.h"
+#include "assorted_libcerror.h"
+#include "assorted_libcfile.h"
+#include "assorted_libcnotify.h"
+#include "assorted_output.h"
+#include "sqlite_wal.h"
+
+/* The maximum size of the frames that are read at once
+ */
+#define WALSUM_MAXIMUM_READ_SIZE	( 4 * 1024 * 1024 )
+
+typedef struct walsum_file walsum_file_t;
+
+struct walsum_file
+{
+	/* The number of frames
+	 */
+	uint64_t number_of_frames;
+
+	/* The number of valid frames, which are the frames from the start of the
+	 * WAL file of which the salt values and cumulative checksum match
+	 */
+	uint64_t number_of_valid_frames;
+
+	/* The number of committed frames, which are the valid frames up to and
+	 * including the last valid commit frame
+	 */
+	uint64_t number_of_committed_frames;
+};
+
+/* Prints the executable usage information
+ */
+void usage_fprint(
+      FILE *stream )
+{
+	if( stream == NULL )
+	{
+		return;
+	}
+	fprintf( stream, "Use walsum to verify the checksums of the frames of SQLite\n"
+	                 "write-ahead log (WAL) files.\n\n" );
+
+	fprintf( stream, "Usage: walsum [ -S format ] [ -12hvV ] source ...\n\n" );
+
+	fprintf( stream, "\tsource: the source files\n\n" );
+
+	fprintf( stream, "\t-1:     use the basic calculation method\n" );
+	fprintf( stream, "\t-2:     use the SIMD calculation method (default)\n" );
+	fprintf( stream, "\t-h:     shows this help\n" );
+	fprintf( stream, "\t-S:     print timing and throughput statistics of the open,\n"
+	                 "\t        read, compute and write phases and the peak memory\n"
+	                 "\t        size to stderr in the format: text or json\n" );
+	fprintf( stream, "\t-v:     verbose output to stderr\n" );
+	fprintf( stream, "\t-V:     print version\n" );
+	fprintf( stream, "\n" );
+}
+
+/* Calculates the WAL checksum of a buffer using a specific calculation method
+ * Returns 1 if successful or -1 on error
+ */
+int walsum_calculate(
+     int calculation_method,
+     uint32_t *checksum1,
+     uint32_t *checksum2,
+     const uint8_t *buffer,
+     size_t size,
+     uint8_t byte_order,
+     libcerror_error_t **error )
+{
+	static char *function = "walsum_calculate";
+	int result            = -1;
+
+	if( calculation_method == 1 )
+	{
+		result = sqlite_wal_checksum_calculate(
+		          checksum1,
+		          checksum2,
+		          buffer,
+		          size,
+		          byte_order,
+		          error );
+	}
+	else if( calculation_method == 2 )
+	{
+		result = sqlite_wal_checksum_calculate_simd(
+		          checksum1,
+		          checksum2,
+		          buffer,
+		          size,
+		          byte_order,
+		          error );
+	}
+	else
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_UNSUPPORTED_VALUE,
+		 "%s: unsupported calculation method: %d.",
+		 function,
+		 calculation_method );
+
+		return( -1 );
+	}
+	return( result );
+}
+
+/* Verifies the frames of a WAL file
+ * The frames are read and verified in a single pass, the cumulative checksum of a frame
+ * depends on all preceding frames, hence the frames that follow the first frame that
+ * does not match are not verified
+ * Returns 1 if successful, 0 if the checksum of the file header does not match or -1 on error
+ */
+int walsum_verify_file(
+     const system_character_t *filename,
+     int calculation_method,
+     walsum_file_t *wal_file,
+     libcerror_error_t **error )
+{
+	sqlite_wal_file_header_t file_header;
+	sqlite_wal_frame_header_t frame_header;
+
+	assorted_input_file_t *input_file = NULL;
+	uint8_t *data                     = NULL;
+	static char *function             = "walsum_verify_file";
+	size64_t file_size                = 0;
+	size_t data_offset                = 0;
+	size_t frame_size                 = 0;
+	size_t read_size                  = 0;
+	ssize_t read_count                = 0;
+	uint64_t frames_per_read          = 0;
+	uint64_t frame_index              = 0;
+	uint64_t number_of_frames         = 0;
+	uint32_t checksum1                = 0;
+	uint32_t checksum2                = 0;
+	int result                        = 0;
+	int valid_frame                   = 1;
+
+	if( wal_file == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid WAL file.",
+		 function );
+
+		return( -1 );
+	}
+	wal_file->number_of_frames           = 0;
+	wal_file->number_of_valid_frames     = 0;
+	wal_file->number_of_committed_frames = 0;
+
+	if( assorted_input_file_initialize(
+	     &input_file,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create input file.",
+		 function );
+
+		goto on_error;
+	}
+	if( assorted_input_file_open(
+	     input_file,
+	     filename,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_OPEN_FAILED,
+		 "%s: unable to open input file.",
+		 function );
+
+		goto on_error;
+	}
+	if( assorted_input_file_get_size(
+	     input_file,
+	     &file_size,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve input file size.",
+		 function );
+
+		goto on_error;
+	}
+	if( file_size < (size64_t) SQLITE_WAL_FILE_HEADER_SIZE )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid input file size value too small.",
+		 function );
+
+		goto on_error;
+	}
+	read_count = assorted_input_file_read_data(
+	              input_file,
+	              &data,
+	              SQLITE_WAL_FILE_HEADER_SIZE,
+	              error );
+
+	if( read_count != (ssize_t) SQLITE_WAL_FILE_HEADER_SIZE )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_READ_FAILED,
+		 "%s: unable to read file header.",
+		 function );
+
+		goto on_error;
+	}
+	result = sqlite_wal_read_file_header(
+	          &file_header,
+	          data,
+	          (size_t) read_count,
+	          error );
+
+	if( result == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to read file header.",
+		 function );
+
+		goto on_error;
+	}
+	frame_size       = SQLITE_WAL_FRAME_HEADER_SIZE + (size_t) file_header.page_size;
+	number_of_frames = ( file_size - SQLITE_WAL_FILE_HEADER_SIZE ) / frame_size;
+
+	wal_file->number_of_frames = number_of_frames;
+
+	/* The frames are only valid if the checksum of the file header matches
+	 */
+	if( result == 0 )
+	{
+		valid_frame = 0;
+	}
+	frames_per_read = WALSUM_MAXIMUM_READ_SIZE / frame_size;
+	checksum1       = file_header.checksum1;
+	checksum2       = file_header.checksum2;
+	while( ( valid_frame != 0 )
+	    && ( frame_index < number_of_frames ) )
+	{
+		if( frames_per_read > ( number_of_frames - frame_index ) )
+		{
+			frames_per_read = number_of_frames - frame_index;
+		}
+		read_size = (size_t) frames_per_read * frame_size;
+
+		read_count = assorted_input_file_read_data(
+		              input_file,
+		              &data,
+		              read_size,
+		              error );
+
+		if( read_count != (ssize_t) read_size )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_READ_FAILED,
+			 "%s: unable to read frame: %" PRIu64 ".",
+			 function,
+			 frame_index );
+
+			goto on_error;
+		}
+		for( data_offset = 0;
+		     data_offset < read_size;
+		     data_offset += frame_size )
+		{
+			if( sqlite_wal_frame_read_header(
+			     &frame_header,
+			     &( data[ data_offset ] ),
+			     frame_size,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+				 "%s: unable to read frame: %" PRIu64 " header.",
+				 function,
+				 frame_index );
+
+				goto on_error;
+			}
+			/* A frame with other salt values remains from before the WAL was restarted
+			 */
+			if( ( frame_header.salt1 != file_header.salt1 )
+			 || ( frame_header.salt2 != file_header.salt2 ) )
+			{
+				valid_frame = 0;
+
+				break;
+			}
+			/* The checksum of a frame is calculated over the page number and
+			 * database size of the frame header and the page data
+			 */
+			if( walsum_calculate(
+			     calculation_method,
+			     &checksum1,
+			     &checksum2,
+			     &( data[ data_offset ] ),
+			     SQLITE_WAL_FRAME_HEADER_CHECKSUM_SIZE,
+			     file_header.byte_order,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_GENERIC,
+				 "%s: unable to calculate frame: %" PRIu64 " checksum.",
+				 function,
+				 frame_index );
+
+				goto on_error;
+			}
+			if( walsum_calculate(
+			     calculation_method,
+			     &checksum1,
+			     &checksum2,
+			     &( data[ data_offset + SQLITE_WAL_FRAME_HEADER_SIZE ] ),
+			     (size_t) file_header.page_size,
+			     file_header.byte_order,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_GENERIC,
+				 "%s: unable to calculate frame: %" PRIu64 " checksum.",
+				 function,
+				 frame_index );
+
+				goto on_error;
+			}
+			if( ( frame_header.checksum1 != checksum1 )
+			 || ( frame_header.checksum2 != checksum2 ) )
+			{
+				valid_frame = 0;
+
+				break;
+			}
+			frame_index += 1;
+
+			wal_file->number_of_valid_frames = frame_index;
+
+			if( frame_header.database_size != 0 )
+			{
+				wal_file->number_of_committed_frames = frame_index;
+			}
+		}
+	}
+	if( assorted_input_file_close(
+	     input_file,
+	     error ) != 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_CLOSE_FAILED,
+		 "%s: unable to close input file.",
+		 function );
+
+		goto on_error;
+	}
+	if( assorted_input_file_free(
+	     &input_file,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+		 "%s: unable to free input file.",
+		 function );
+
+		goto on_error;
+	}
+	return( result );
+
+on_error:
+	if( input_file != NULL )
+	{
+		assorted_input_file_free(
+		 &input_file,
+		 NULL );
+	}
+	return( -1 );
+}
+
+/* The main program
+ */
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+int wmain( int argc, wchar_t * const argv[] )
+#else
+int main( int argc, char * const argv[] )
+#endif
+{
+	walsum_file_t wal_file;
+
+	libcerror_error_t *error                     = NULL;
+	system_character_t *option_statistics_format = NULL;
+	char *program                                = "walsum";
+	system_integer_t option                      = 0;
+	int calculation_method                       = 2;
+	int number_of_failed_files                   = 0;
+	int number_of_files                          = 0;
+	int result                                   = 0;
+	int verbose                                  = 0;
+
+	assorted_output_version_fprint(
+	 stdout,
+	 program );
+
+	while( ( option = assorted_getopt(
+	                   argc,
+	                   argv,
+	                   _SYSTEM_STRING( "12hS:vV" ) ) ) != (system_integer_t) -1 )
+	{
+		switch( option )
+		{
+			case '?':
+			default:
+				fprintf(
+				 stderr,
+				 "Invalid argument: %" PRIs_SYSTEM "\n",
+				 argv[ optind ] );
+
+				usage_fprint(
+				 stdout );
+
+				return( EXIT_FAILURE );
+
+			case '1':
+				calculation_method = 1;
+
+				break;
+
+			case '2':
+				calculation_method = 2;
+
+				break;
+
+			case 'h':
+				usage_fprint(
+				 stdout );
+
+				return( EXIT_SUCCESS );
+
+			case 'S':
+				option_statistics_format = optarg;
+
+				break;
+
+			case 'v':
+				verbose = 1;
+
+				break;
+
+			case 'V':
+				assorted_output_copyright_fprint(
+				 stdout );
+
+				return( EXIT_SUCCESS );
+		}
+	}
+	if( optind == argc )
+	{
+		fprintf(
+		 stderr,
+		 "Missing source file.\n" );
+
+		usage_fprint(
+		 stdout );
+
+		return( EXIT_FAILURE );
+	}
+	libcnotify_stream_set(
+	 stderr,
+	 NULL );
+	libcnotify_verbose_set(
+	 verbose );
+
+	if( assorted_output_statistics_initialize(
+	     option_statistics_format,
+	     &error ) != 1 )
+	{
+		fprintf(
+		 stderr,
+		 "Unable to initialize statistics.\n" );
+
+		goto on_error;
+	}
+	/* A file that cannot be verified is reported and the remaining files are verified
+	 */
+	while( optind < argc )
+	{
+		result = walsum_verify_file(
+		          argv[ optind ],
+		          calculation_method,
+		          &wal_file,
+		          &error );
+
+		if( result == -1 )
+		{
+			fprintf(
+			 stderr,
+			 "Unable to verify file: %" PRIs_SYSTEM ".\n",
+			 argv[ optind ] );
+
+			libcnotify_print_error_backtrace(
+			 error );
+			libcerror_error_free(
+			 &error );
+
+			fprintf(
+			 stdout,
+			 "%" PRIs_SYSTEM ": FAILED\n",
+			 argv[ optind ] );
+
+			number_of_failed_files++;
+		}
+		else if( result == 0 )
+		{
+			fprintf(
+			 stdout,
+			 "%" PRIs_SYSTEM ": FAILED file header checksum mismatch\n",
+			 argv[ optind ] );
+
+			number_of_failed_files++;
+		}
+		else
+		{
+			fprintf(
+			 stdout,
+			 "%" PRIs_SYSTEM ": OK frames: %" PRIu64 ", valid: %" PRIu64 ", committed: %" PRIu64 "\n",
+			 argv[ optind ],
+			 wal_file.number_of_frames,
+			 wal_file.number_of_valid_frames,
+			 wal_file.number_of_committed_frames );
+		}
+		number_of_files++;
+
+		optind++;
+	}
+	fprintf(
+	 stdout,
+	 "\n" );
+
+	fprintf(
+	 stdout,
+	 "Number of files:\t\t%d\n",
+	 number_of_files );
+
+	fprintf(
+	 stdout,
+	 "Number of failed files:\t\t%d\n",
+	 number_of_failed_files );
+
+	fprintf(
+	 stdout,
+	 "\n" );
+
+	if( number_of_failed_files != 0 )
+	{
+		fprintf(
+		 stdout,
+		 "WAL verify:\t\t\tFAILURE\n" );
+
+		result = -1;
+	}
+	else
+	{
+		fprintf(
+		 stdout,
+		 "WAL verify:\t\t\tSUCCESS\n" );
+
+		result = 1;
+	}
+	assorted_output_statistics_fprint(
+	 stderr,
+	 program,
+	 result,
+	 NULL );
+	assorted_output_statistics_free(
+	 NULL );
+
+	if( result != 1 )
+	{
+		return( EXIT_FAILURE );
+	}
+	return( EXIT_SUCCESS );
+
+on_error:
+	if( error != NULL )
+	{
+		libcnotify_print_error_backtrace(
+		 error );
+		libcerror_error_free(
+		 &error );
+	}
+	assorted_output_statistics_fprint(
+	 stderr,
+	 program,
+	 -1,
+	 NULL );
+	assorted_output_statistics_free(
+	 NULL );
+
+	return( EXIT_FAILURE );
+}
+
@@ -45,6 +45,13 @@ int checksum_calculate_little_endian_xor32_cpu_aligned(
      uint32_t initial_value,
      libcerror_error_t **error );
 
+int checksum_calculate_little_endian_xor32_simd(
+     uint32_t *checksum_value,
+     const uint8_t *buffer,
+     size_t size,
+     uint32_t initial_value,
+     libcerror_error_t **error );
+
 #if defined( __cplusplus )
 }
 #endif
@@ -30,13 +30,25 @@
 #include <stdlib.h>
 #endif
 
+#include "assorted_batch.h"
+#include "assorted_calibrate.h"
 #include "assorted_getopt.h"
+#include "assorted_input_file.h"
 #include "assorted_libcerror.h"
 #include "assorted_libcfile.h"
 #include "assorted_libcnotify.h"
 #include "assorted_output.h"
 #include "xor32.h"
 
+/* The size of the buffer used to read the source data
+ */
+#define XOR32SUM_BUFFER_SIZE		( 4 * 1024 * 1024 )
+
+/* The calculation methods considered when calibrating
+ */
+static const int xor32sum_calculation_methods[] = {
+	1, 2, 3 };
+
 /* Prints the executable usage information
  */
 void usage_fprint(
@@ -48,22 +60,184 @@ void usage_fprint(
 	}
 	fprintf( stream, "Use xor32sum to calculate a 32-bit XOR-32 of file data.\n\n" );
 
-	fprintf( stream, "Usage: xor32sum [ -i initial_value ] [ -o offset ] [ -s size ]\n"
-	                 "                [ -12hvV ] source\n\n" );
+	fprintf( stream, "Usage: xor32sum [ -C checksum_list ] [ -i initial_value ] [ -j threads ]\n"
+	                 "                [ -o offset ] [ -s size ] [ -S format ] [ -u block_size ]\n"
+	                 "                [ -123bhvV ] source ...\n\n" );
 
-	fprintf( stream, "\tsource: the source file\n\n" );
+	fprintf( stream, "\tsource: the source file, in batch mode the source files and\n"
+	                 "\t        directories, where - reads the paths from stdin\n\n" );
 
 	fprintf( stream, "\t-1:     use the basic calculation method\n" );
-	fprintf( stream, "\t-2:     use the cpu-aligned calculation method (default)\n" );
+	fprintf( stream, "\t-2:     use the cpu-aligned calculation method\n" );
+	fprintf( stream, "\t-3:     use the SIMD calculation method\n" );
+	fprintf( stream, "\t        by default the fastest calculation method is selected\n"
+	                 "\t        by calibrating all methods before a large source is read,\n"
+	                 "\t        otherwise the SIMD calculation method is used\n" );
+	fprintf( stream, "\t-b:     batch mode, calculates the XOR-32 of every source file and\n"
+	                 "\t        of every file in the source directories, or of the files\n"
+	                 "\t        of which the paths are read from stdin if no source is\n"
+	                 "\t        provided, and prints a line per file in the format of\n"
+	                 "\t        sha256sum, implied when multiple sources are provided\n" );
+	fprintf( stream, "\t-C:     verify the XOR-32 of the files in a checksum list in\n"
+	                 "\t        the format of sha256sum, where - reads the list from stdin,\n"
+	                 "\t        implies -b\n" );
 	fprintf( stream, "\t-h:     shows this help\n" );
 	fprintf( stream, "\t-i:     initial XOR-32 (default is 0)\n" );
+	fprintf( stream, "\t-j:     number of threads used in batch mode (default is %d)\n",
+	 ASSORTED_BATCH_DEFAULT_NUMBER_OF_THREADS );
 	fprintf( stream, "\t-o:     data offset (default is 0)\n" );
 	fprintf( stream, "\t-s:     size of data (default is the file size)\n" );
+	fprintf( stream, "\t-S:     print timing and throughput statistics of the open,\n"
+	                 "\t        read, compute and write phases and the peak memory\n"
+	                 "\t        size to stderr in the format: text or json\n" );
+	fprintf( stream, "\t-u:     read the source unbuffered using direct I/O in blocks of\n"
+	                 "\t        block_size bytes, which must be a multiple of %d, to\n"
+	                 "\t        bypass the system cache, e.g. when reading a device\n",
+	 ASSORTED_INPUT_FILE_DIRECT_IO_ALIGNMENT );
 	fprintf( stream, "\t-v:     verbose output to stderr\n" );
 	fprintf( stream, "\t-V:     print version\n" );
 	fprintf( stream, "\n" );
 }
 
+/* Calculates the XOR-32 of a buffer using a specific calculation method
+ * Returns 1 if successful or -1 on error
+ */
+int xor32sum_calculate(
+     int calculation_method,
+     uint32_t *checksum_value,
+     uint8_t *buffer,
+     size_t size,
+     uint32_t initial_value,
+     libcerror_error_t **error )
+{
+	static char *function = "xor32sum_calculate";
+	int result            = -1;
+
+	if( checksum_value == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid checksum value.",
+		 function );
+
+		return( -1 );
+	}
+	if( calculation_method == 1 )
+	{
+		result = checksum_calculate_little_endian_xor32_basic(
+		          checksum_value,
+		          buffer,
+		          size,
+		          initial_value,
+		          error );
+	}
+	else if( calculation_method == 2 )
+	{
+		result = checksum_calculate_little_endian_xor32_cpu_aligned(
+		          checksum_value,
+		          buffer,
+		          size,
+		          initial_value,
+		          error );
+	}
+	else if( calculation_method == 3 )
+	{
+		result = checksum_calculate_little_endian_xor32_simd(
+		          checksum_value,
+		          buffer,
+		          size,
+		          initial_value,
+		          error );
+	}
+	else
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_UNSUPPORTED_VALUE,
+		 "%s: unsupported calculation method: %d.",
+		 function,
+		 calculation_method );
+
+		return( -1 );
+	}
+	return( result );
+}
+
+/* Calculates the XOR-32 of a buffer to calibrate a calculation method
+ * Returns 1 if successful or -1 on error
+ */
+int xor32sum_calibrate_calculate(
+     int calculation_method,
+     uint8_t *buffer,
+     size_t size,
+     libcerror_error_t **error )
+{
+	uint32_t checksum_value = 0;
+
+	return( xor32sum_calculate(
+	         calculation_method,
+	         &checksum_value,
+	         buffer,
+	         size,
+	         0,
+	         error ) );
+}
+
+/* Calculates the XOR-32 of a buffer in batch mode
+ * The arguments contain the calculation method
+ * Returns 1 if successful or -1 on error
+ */
+int xor32sum_batch_calculate(
+     void *arguments,
+     uint64_t *checksum_value,
+     uint8_t *buffer,
+     size_t size,
+     libcerror_error_t **error )
+{
+	static char *function         = "xor32sum_batch_calculate";
+	uint32_t checksum_value_32bit = 0;
+	int result                    = 0;
+
+	if( arguments == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid arguments.",
+		 function );
+
+		return( -1 );
+	}
+	if( checksum_value == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid checksum value.",
+		 function );
+
+		return( -1 );
+	}
+	checksum_value_32bit = (uint32_t) *checksum_value;
+
+	result = xor32sum_calculate(
+	          *( (int *) arguments ),
+	          &checksum_value_32bit,
+	          buffer,
+	          size,
+	          checksum_value_32bit,
+	          error );
+
+	*checksum_value = (uint64_t) checksum_value_32bit;
+
+	return( result );
+}
+
 /* The main program
  */
 #if defined( HAVE_WIDE_SYSTEM_CHARACTER )
@@ -72,34 +246,43 @@ int wmain( int argc, wchar_t * const argv[] )
 int main( int argc, char * const argv[] )
 #endif
 {
-	libcerror_error_t *error     = NULL;
-	libcfile_file_t *source_file = NULL;
-	system_character_t *source   = NULL;
-	uint8_t *buffer              = NULL;
-	char *program                = "xor32sum";
-	system_integer_t option      = 0;
-	size64_t source_size         = 0;
-	ssize_t read_count           = 0;
-	off_t source_offset          = 0;
-	uint32_t checksum_value      = 0;
-	uint32_t initial_value       = 0;
-	int calculation_method       = 2;
-	int result                   = 0;
-	int verbose                  = 0;
-
-	assorted_output_version_fprint(
-	 stdout,
-	 program );
+	assorted_batch_t *batch                      = NULL;
+	libcerror_error_t *error                     = NULL;
+	assorted_input_file_t *source_file           = NULL;
+	system_character_t *option_statistics_format = NULL;
+	system_character_t *source                   = NULL;
+	system_character_t *checksum_list            = NULL;
+	uint8_t *buffer                              = NULL;
+	char *program                                = "xor32sum";
+	system_integer_t option                      = 0;
+	size64_t remaining_size                      = 0;
+	size64_t source_size                         = 0;
+	size_t buffer_size                           = 0;
+	size_t direct_io_block_size                  = 0;
+	size_t read_size                             = 0;
+	ssize_t read_count                           = 0;
+	off_t source_offset                          = 0;
+	uint32_t checksum_value                      = 0;
+	uint32_t initial_value                       = 0;
+	uint8_t batch_mode                           = 0;
+	int calculation_method                       = 0;
+	int number_of_batch_threads                  = ASSORTED_BATCH_DEFAULT_NUMBER_OF_THREADS;
+	int result                                   = 0;
+	int verbose                                  = 0;
 
 	while( ( option = assorted_getopt(
 	                   argc,
 	                   argv,
-	                   _SYSTEM_STRING( "12hi:o:s:vV" ) ) ) != (system_integer_t) -1 )
+	                   _SYSTEM_STRING( "123bC:hi:j:o:s:S:u:vV" ) ) ) != (system_integer_t) -1 )
 	{
 		switch( option )
 		{
 			case '?':
 			default:
+				assorted_output_version_fprint(
+				 stdout,
+				 program );
+
 				fprintf(
 				 stderr,
 				 "Invalid argument: %" PRIs_SYSTEM "\n",
@@ -120,7 +303,27 @@ int main( int argc, char * const argv[] )
 
 				break;
 
+			case '3':
+				calculation_method = 3;
+
+				break;
+
+			case 'b':
+				batch_mode = 1;
+
+				break;
+
+			case 'C':
+				checksum_list = optarg;
+				batch_mode    = 1;
+
+				break;
+
 			case 'h':
+				assorted_output_version_fprint(
+				 stdout,
+				 program );
+
 				usage_fprint(
 				 stdout );
 
@@ -131,6 +334,11 @@ int main( int argc, char * const argv[] )
 
 				break;
 
+			case 'j':
+				number_of_batch_threads = (int) atol( optarg );
+
+				break;
+
 			case 'o':
 				source_offset = atol( optarg );
 
@@ -141,19 +349,44 @@ int main( int argc, char * const argv[] )
 
 				break;
 
+			case 'S':
+				option_statistics_format = optarg;
+
+				break;
+
+			case 'u':
+				direct_io_block_size = (size_t) atol( optarg );
+
+				break;
+
 			case 'v':
 				verbose = 1;
 
 				break;
 
 			case 'V':
+				assorted_output_version_fprint(
+				 stdout,
+				 program );
+
 				assorted_output_copyright_fprint(
 				 stdout );
 
 				return( EXIT_SUCCESS );
 		}
 	}
-	if( optind == argc )
+	if( ( argc - optind ) > 1 )
+	{
+		batch_mode = 1;
+	}
+	if( batch_mode == 0 )
+	{
+		assorted_output_version_fprint(
+		 stdout,
+		 program );
+	}
+	if( ( batch_mode == 0 )
+	 && ( optind == argc ) )
 	{
 		fprintf(
 		 stderr,
@@ -172,9 +405,102 @@ int main( int argc, char * const argv[] )
 	libcnotify_verbose_set(
 	 verbose );
 
+	if( assorted_output_statistics_initialize(
+	     option_statistics_format,
+	     &error ) != 1 )
+	{
+		fprintf(
+		 stderr,
+		 "Unable to initialize statistics.\n" );
+
+		goto on_error;
+	}
+
+	if( batch_mode != 0 )
+	{
+		if( ( source_offset != 0 )
+		 || ( source_size != 0 ) )
+		{
+			fprintf(
+			 stderr,
+			 "Offset and size are not supported in batch mode.\n" );
+
+			return( EXIT_FAILURE );
+		}
+		if( direct_io_block_size != 0 )
+		{
+			fprintf(
+			 stderr,
+			 "Direct I/O is not supported in batch mode.\n" );
+
+			return( EXIT_FAILURE );
+		}
+		if( ( number_of_batch_threads <= 0 )
+		 || ( number_of_batch_threads > ASSORTED_BATCH_MAXIMUM_NUMBER_OF_THREADS ) )
+		{
+			fprintf(
+			 stderr,
+			 "Unsupported number of threads, value must be between 1 and %d.\n",
+			 ASSORTED_BATCH_MAXIMUM_NUMBER_OF_THREADS );
+
+			return( EXIT_FAILURE );
+		}
+		/* The methods are not calibrated since the size of the files is not known in advance
+		 */
+		if( calculation_method == 0 )
+		{
+			calculation_method = 3;
+		}
+		if( assorted_batch_initialize(
+		     &batch,
+		     xor32sum_batch_calculate,
+		     (void *) &calculation_method,
+		     (uint64_t) initial_value,
+		     4,
+		     number_of_batch_threads,
+		     &error ) != 1 )
+		{
+			fprintf(
+			 stderr,
+			 "Unable to create batch.\n" );
+
+			goto on_error;
+		}
+		result = assorted_batch_process(
+		          batch,
+		          argc - optind,
+		          &( argv[ optind ] ),
+		          checksum_list,
+		          &error );
+
+		if( result == -1 )
+		{
+			fprintf(
+			 stderr,
+			 "Unable to process batch.\n" );
+
+			goto on_error;
+		}
+		if( assorted_batch_free(
+		     &batch,
+		     &error ) != 1 )
+		{
+			fprintf(
+			 stderr,
+			 "Unable to free batch.\n" );
+
+			goto on_error;
+		}
+		if( result != 1 )
+		{
+			return( EXIT_FAILURE );
+		}
+		return( EXIT_SUCCESS );
+	}
+
 	/* Open the source file
 	 */
-	if( libcfile_file_initialize(
+	if( assorted_input_file_initialize(
 	     &source_file,
 	     &error ) != 1 )
 	{
@@ -184,10 +510,20 @@ int main( int argc, char * const argv[] )
 
 		goto on_error;
 	}
-	if( libcfile_file_open(
+	if( assorted_input_file_set_direct_io(
+	     source_file,
+	     direct_io_block_size,
+	     &error ) != 1 )
+	{
+		fprintf(
+		 stderr,
+		 "Unable to set direct I/O block size of source file.\n" );
+
+		goto on_error;
+	}
+	if( assorted_input_file_open(
 	     source_file,
 	     source,
-	     LIBCFILE_OPEN_READ,
 	     &error ) != 1 )
 	{
 		fprintf(
@@ -198,7 +534,7 @@ int main( int argc, char * const argv[] )
 	}
 	if( source_size == 0 )
 	{
-		if( libcfile_file_get_size(
+		if( assorted_input_file_get_size(
 		     source_file,
 		     &source_size,
 		     &error ) == -1 )
@@ -218,28 +554,15 @@ int main( int argc, char * const argv[] )
 
 		goto on_error;
 	}
-	if( source_size > (size64_t) SSIZE_MAX )
-	{
-		fprintf(
-		 stderr,
-		 "Invalid source size value exceeds maximum.\n" );
-
-		goto on_error;
-	}
-	buffer = (uint8_t *) memory_allocate(
-	                      sizeof( uint8_t ) * (size_t) source_size );
+	buffer_size = XOR32SUM_BUFFER_SIZE;
 
-	if( buffer == NULL )
+	if( (size64_t) buffer_size > source_size )
 	{
-		fprintf(
-		 stderr,
-		 "Unable to create buffer.\n" );
-
-		goto on_error;
+		buffer_size = (size_t) source_size;
 	}
 	/* Position the source file at the right offset
 	 */
-	if( libcfile_file_seek_offset(
+	if( assorted_input_file_seek_offset(
 	     source_file,
 	     source_offset,
 	     SEEK_SET,
@@ -251,23 +574,104 @@ int main( int argc, char * const argv[] )
 
 		goto on_error;
 	}
-	read_count = libcfile_file_read_buffer(
-		      source_file,
-		      buffer,
-		      source_size,
-	              &error );
-
-	if( read_count != (ssize_t) source_size )
+	/* Read the next blocks ahead while the current block is processed
+	 */
+	if( assorted_input_file_set_read_ahead(
+	     source_file,
+	     buffer_size,
+	     ASSORTED_INPUT_FILE_DEFAULT_NUMBER_OF_READ_AHEAD_BLOCKS,
+	     &error ) != 1 )
 	{
 		fprintf(
 		 stderr,
-		 "Unable to read from source file.\n" );
+		 "Unable to set read-ahead of source file.\n" );
 
 		goto on_error;
 	}
+	if( calculation_method == 0 )
+	{
+		calculation_method = 3;
+
+		if( source_size >= ASSORTED_CALIBRATE_MINIMUM_DATA_SIZE )
+		{
+			if( assorted_calibrate_select_calculation_method(
+			     xor32sum_calibrate_calculate,
+			     xor32sum_calculation_methods,
+			     (int) ( sizeof( xor32sum_calculation_methods ) / sizeof( int ) ),
+			     &calculation_method,
+			     &error ) != 1 )
+			{
+				fprintf(
+				 stderr,
+				 "Unable to calibrate calculation methods.\n" );
+
+				goto on_error;
+			}
+		}
+		if( verbose != 0 )
+		{
+			fprintf(
+			 stderr,
+			 "Selected calculation method: %d\n",
+			 calculation_method );
+		}
+	}
+	/* Read the source data in blocks and pass the XOR-32 of the previous
+	 * blocks as the initial value of the next block
+	 */
+	checksum_value = initial_value;
+	remaining_size = source_size;
+
+	while( remaining_size > 0 )
+	{
+		read_size = buffer_size;
+
+		if( (size64_t) read_size > remaining_size )
+		{
+			read_size = (size_t) remaining_size;
+		}
+		read_count = assorted_input_file_read_data(
+		              source_file,
+		              &buffer,
+		              read_size,
+		              &error );
+
+		if( read_count != (ssize_t) read_size )
+		{
+			fprintf(
+			 stderr,
+			 "Unable to read from source file.\n" );
+
+			goto on_error;
+		}
+		result = xor32sum_calculate(
+		          calculation_method,
+		          &checksum_value,
+		          buffer,
+		          read_size,
+		          checksum_value,
+		          &error );
+
+		if( result != 1 )
+		{
+			fprintf(
+			 stderr,
+			 "Unable to calculate XOR-32.\n" );
+
+			goto on_error;
+		}
+		if( libcnotify_verbose != 0 )
+		{
+			libcnotify_print_data(
+			 buffer,
+			 read_size,
+			 0 );
+		}
+		remaining_size -= read_size;
+	}
 	/* Clean up
 	 */
-	if( libcfile_file_close(
+	if( assorted_input_file_close(
 	     source_file,
 	     &error ) != 0 )
 	{
@@ -277,7 +681,7 @@ int main( int argc, char * const argv[] )
 
 		goto on_error;
 	}
-	if( libcfile_file_free(
+	if( assorted_input_file_free(
 	     &source_file,
 	     &error ) != 1 )
 	{
@@ -287,48 +691,20 @@ int main( int argc, char * const argv[] )
 
 		goto on_error;
 	}
-	if( calculation_method == 1 )
-	{
-		result = checksum_calculate_little_endian_xor32_basic(
-		          &checksum_value,
-		          buffer,
-		          source_size,
-		          initial_value,
-		          NULL );
-	}
-	else if( calculation_method == 2 )
-	{
-		result = checksum_calculate_little_endian_xor32_cpu_aligned(
-		          &checksum_value,
-		          buffer,
-		          source_size,
-		          initial_value,
-		          NULL );
-	}
-	if( result != 1 )
-	{
-		fprintf(
-		 stderr,
-		 "Unable to calculate XOR-32.\n" );
-
-		goto on_error;
-	}
-	if( libcnotify_verbose != 0 )
-	{
-		libcnotify_print_data(
-		 buffer,
-		 source_size,
-		 0 );
-	}
-	memory_free(
-	 buffer );
-
 	fprintf(
 	 stdout,
 	 "Calculated XOR-32: %" PRIu32 " (0x%08" PRIx32 ")\n",
 	 checksum_value,
 	 checksum_value );
 
+	assorted_output_statistics_fprint(
+	 stderr,
+	 program,
+	 1,
+	 NULL );
+	assorted_output_statistics_free(
+	 NULL );
+
 	return( EXIT_SUCCESS );
 
 on_error:
@@ -339,14 +715,22 @@ on_error:
 		libcerror_error_free(
 		 &error );
 	}
-	if( buffer != NULL )
+	assorted_output_statistics_fprint(
+	 stderr,
+	 program,
+	 -1,
+	 NULL );
+	assorted_output_statistics_free(
+	 NULL );
+	if( batch != NULL )
 	{
-		memory_free(
-		 buffer );
+		assorted_batch_free(
+		 &batch,
+		 NULL );
 	}
 	if( source_file != NULL )
 	{
-		libcfile_file_free(
+		assorted_input_file_free(
 		 &source_file,
 		 NULL );
 	}
@@ -21,11 +21,21 @@
 
 #include <common.h>
 #include <byte_stream.h>
+#include <memory.h>
 #include <types.h>
 
 #include "assorted_libcerror.h"
+#include "cpu_features.h"
 #include "xor64.h"
 
+#if defined( HAVE_CPU_FEATURES_X86 )
+#include <immintrin.h>
+
+#elif defined( HAVE_CPU_FEATURES_ARM64 )
+#include <arm_neon.h>
+
+#endif
+
 /* The largest primary (or scalar) available
  * supported by a single load and store instruction
  */
@@ -131,7 +141,7 @@ int checksum_calculate_little_endian_xor64_basic(
 
 		*checksum_value ^= value_64bit;
 
-		buffer += 4;
+		buffer += 8;
 	}
 	return( 1 );
 }
@@ -147,16 +157,15 @@ int checksum_calculate_little_endian_xor64_cpu_aligned(
      uint64_t initial_value,
      libcerror_error_t **error )
 {
+	uint8_t value_aligned_data[ 8 ];
+
 	xor64_aligned_t *aligned_buffer_iterator = NULL;
-	uint8_t *buffer_iterator                 = NULL;
 	static char *function                    = "checksum_calculate_little_endian_xor64_cpu_aligned";
 	xor64_aligned_t value_aligned            = 0;
+	size_t buffer_offset                     = 0;
+	uint64_t aligned_value_64bit             = 0;
 	uint64_t value_64bit                     = 0;
-	uint8_t alignment_count                  = 0;
 	uint8_t alignment_size                   = 0;
-	uint8_t byte_count                       = 0;
-	uint8_t byte_order                       = 0;
-	uint8_t byte_size                        = 0;
 
 	if( checksum_value == NULL )
 	{
@@ -191,197 +200,488 @@ int checksum_calculate_little_endian_xor64_cpu_aligned(
 
 		return( -1 );
 	}
-	*checksum_value = initial_value;
-
-	buffer_iterator = (uint8_t *) buffer;
-
-	/* Only optimize when there is the alignment is a multitude of 64-bit
+	/* Only optimize when the aligned value is 64-bit
 	 * and for buffers larger than the alignment
 	 */
-	if( ( ( sizeof( xor64_aligned_t ) % 4 ) == 0 )
+	if( ( sizeof( xor64_aligned_t ) == 8 )
 	 && ( size > ( 2 * sizeof( xor64_aligned_t ) ) ) )
 	{
-		/* Align the buffer iterator
+		/* Determine the number of bytes before the first aligned value
 		 */
-		alignment_size = (uint8_t) ( (intptr_t) buffer_iterator % sizeof( xor64_aligned_t ) );
-
-		byte_size = alignment_size;
+		alignment_size = (uint8_t) ( (intptr_t) buffer % sizeof( xor64_aligned_t ) );
 
-		while( byte_size != 0 )
+		if( alignment_size != 0 )
 		{
-			value_64bit = 0;
-			byte_count  = 1;
-
-			if( byte_size >= 4 )
-			{
-				value_64bit |= buffer_iterator[ 3 ];
-				value_64bit <<= 8;
-
-				byte_count++;
-			}
-			if( byte_size >= 3 )
-			{
-				value_64bit |= buffer_iterator[ 2 ];
-				value_64bit <<= 8;
-
-				byte_count++;
-			}
-			if( byte_size >= 2 )
-			{
-				value_64bit |= buffer_iterator[ 1 ];
-				value_64bit <<= 8;
-
-				byte_count++;
-			}
-			value_64bit |= buffer_iterator[ 0 ];
-
-			buffer_iterator += byte_count;
-			byte_size       -= byte_count;
-
-			*checksum_value ^= value_64bit;
+			alignment_size = (uint8_t) sizeof( xor64_aligned_t ) - alignment_size;
 		}
-		aligned_buffer_iterator = (xor64_aligned_t *) buffer_iterator;
-
-		size -= alignment_size;
-
-		if( *buffer_iterator != (uint8_t) ( *aligned_buffer_iterator & 0xff ) )
+		while( buffer_offset < (size_t) alignment_size )
 		{
-			byte_order = _BYTE_STREAM_ENDIAN_BIG;
-		}
-		else
-		{
-			byte_order = _BYTE_STREAM_ENDIAN_LITTLE;
+			value_64bit ^= (uint64_t) buffer[ buffer_offset ] << ( ( buffer_offset % 8 ) * 8 );
+
+			buffer_offset++;
 		}
-		/* Determine the aligned XOR value
+		/* Determine the aligned XOR value, where every byte of the aligned value
+		 * contains the XOR of the bytes with the same offset modulus 8 relative to
+		 * the first aligned value
 		 */
-		while( size > sizeof( xor64_aligned_t ) )
+		aligned_buffer_iterator = (xor64_aligned_t *) &( buffer[ buffer_offset ] );
+
+		while( ( size - buffer_offset ) >= sizeof( xor64_aligned_t ) )
 		{
 			value_aligned ^= *aligned_buffer_iterator;
 
 			aligned_buffer_iterator++;
 
-			size -= sizeof( xor64_aligned_t );
+			buffer_offset += sizeof( xor64_aligned_t );
 		}
-		/* Align the aligned XOR value with the 64-bit XOR value
+		/* Convert the aligned XOR value from host byte order to a little-endian
+		 * value and shift its bytes into their offset relative to the buffer
 		 */
-		if( alignment_size > 0 )
-		{
-			byte_count      = ( alignment_size % 4 ) * 8;
-			alignment_count = ( sizeof( xor64_aligned_t ) - alignment_size ) * 8;
-
-			if( byte_order == _BYTE_STREAM_ENDIAN_BIG )
-			{
-				/* Shift twice to set unused bytes to 0
-				 */
-				value_64bit = (uint64_t) ( ( value_aligned >> alignment_count ) << byte_count );
-
-				/* Strip-off the used part of the aligned value
-				 */
-				value_aligned <<= byte_count;
-			}
-			else if( byte_order == _BYTE_STREAM_ENDIAN_LITTLE )
-			{
-				value_64bit = (uint64_t) ( value_aligned << byte_count );
-
-				/* Strip-off the used part of the aligned value
-				 */
-				value_aligned >>= alignment_count;
-			}
-			*checksum_value ^= value_64bit;
-		}
-		/* Update the 64-bit XOR value with the aligned XOR value
-		 */
-		byte_size = (uint8_t) sizeof( xor64_aligned_t );
+		memory_copy(
+		 value_aligned_data,
+		 &value_aligned,
+		 8 );
 
-		while( byte_size != 0 )
+		byte_stream_copy_to_uint64_little_endian(
+		 value_aligned_data,
+		 aligned_value_64bit );
+
+		if( alignment_size != 0 )
 		{
-			byte_count = ( ( byte_size / 4 ) - 1 ) * 64;
-
-			if( byte_order == _BYTE_STREAM_ENDIAN_BIG )
-			{
-				value_64bit = (uint64_t) ( value_aligned >> byte_count );
-
-				/* Change big-endian into little-endian
-				 */
-				value_64bit = ( ( value_64bit & 0x00ff ) << 24 )
-				            | ( ( value_64bit & 0xff00 ) << 8 )
-				            | ( ( value_64bit >> 8 ) & 0xff00 )
-				            | ( ( value_64bit >> 24 ) & 0x00ff );
-
-				value_aligned <<= byte_count;
-			}
-			else if( byte_order == _BYTE_STREAM_ENDIAN_LITTLE )
-			{
-				value_64bit = (uint64_t) value_aligned;
-
-				value_aligned >>= byte_count;
-			}
-			byte_size -= 4;
-
-			*checksum_value ^= value_64bit;
+			aligned_value_64bit = byte_stream_bit_rotate_left_64bit(
+			                       aligned_value_64bit,
+			                       alignment_size * 8 );
 		}
-		/* Re-align the buffer iterator
-		 */
-		buffer_iterator = (uint8_t *) aligned_buffer_iterator;
+		value_64bit ^= aligned_value_64bit;
+	}
+	/* Process the remaining bytes
+	 */
+	while( buffer_offset < size )
+	{
+		value_64bit ^= (uint64_t) buffer[ buffer_offset ] << ( ( buffer_offset % 8 ) * 8 );
 
-		byte_size = 4 - ( alignment_size % 4 );
+		buffer_offset++;
+	}
+	*checksum_value = initial_value ^ value_64bit;
 
-		if( byte_size != 4 )
-		{
-			value_64bit   = buffer_iterator[ 0 ];
-			value_64bit <<= 8;
+	return( 1 );
+}
 
-			if( byte_size >= 2 )
-			{
-				value_64bit |= buffer_iterator[ 1 ];
-			}
-			value_64bit <<= 8;
+#if defined( HAVE_CPU_FEATURES_X86 )
 
-			if( byte_size >= 3 )
-			{
-				value_64bit |= buffer_iterator[ 2 ];
-			}
-			value_64bit <<= 8;
+/* Calculates the little-endian XOR-64 of a buffer using SSE2
+ * The size must be a multiple of 64
+ * Returns the XOR-64
+ */
+CPU_FEATURES_TARGET( "sse2" )
+static uint64_t xor64_calculate_sse2(
+                 uint64_t checksum_value,
+                 const uint8_t *buffer,
+                 size_t size )
+{
+	uint64_t lanes[ 2 ];
 
-			buffer_iterator += byte_size;
-			size            -= byte_size;
+	__m128i value1;
+	__m128i value2;
+	__m128i value3;
+	__m128i value4;
 
-			*checksum_value ^= value_64bit;
-		}
+	size_t buffer_offset = 0;
+
+	/* Use 4 independent accumulators so that the XOR operations
+	 * of consecutive loads do not depend on each other
+	 */
+	value1 = _mm_setzero_si128();
+	value2 = _mm_setzero_si128();
+	value3 = _mm_setzero_si128();
+	value4 = _mm_setzero_si128();
+
+	for( buffer_offset = 0;
+	     buffer_offset < size;
+	     buffer_offset += 64 )
+	{
+		value1 = _mm_xor_si128(
+		          value1,
+		          _mm_loadu_si128(
+		           (__m128i *) &( buffer[ buffer_offset ] ) ) );
+		value2 = _mm_xor_si128(
+		          value2,
+		          _mm_loadu_si128(
+		           (__m128i *) &( buffer[ buffer_offset + 16 ] ) ) );
+		value3 = _mm_xor_si128(
+		          value3,
+		          _mm_loadu_si128(
+		           (__m128i *) &( buffer[ buffer_offset + 32 ] ) ) );
+		value4 = _mm_xor_si128(
+		          value4,
+		          _mm_loadu_si128(
+		           (__m128i *) &( buffer[ buffer_offset + 48 ] ) ) );
 	}
-	while( size > 0 )
+	value1 = _mm_xor_si128(
+	          _mm_xor_si128(
+	           value1,
+	           value2 ),
+	          _mm_xor_si128(
+	           value3,
+	           value4 ) );
+
+	_mm_storeu_si128(
+	 (__m128i *) lanes,
+	 value1 );
+
+	return( checksum_value ^ lanes[ 0 ] ^ lanes[ 1 ] );
+}
+
+/* Calculates the little-endian XOR-64 of a buffer using AVX2
+ * The size must be a multiple of 128
+ * Returns the XOR-64
+ */
+CPU_FEATURES_TARGET( "avx2" )
+static uint64_t xor64_calculate_avx2(
+                 uint64_t checksum_value,
+                 const uint8_t *buffer,
+                 size_t size )
+{
+	uint64_t lanes[ 2 ];
+
+	__m256i value1;
+	__m256i value2;
+	__m256i value3;
+	__m256i value4;
+	__m128i result;
+
+	size_t buffer_offset = 0;
+
+	/* Use 4 independent accumulators so that the XOR operations
+	 * of consecutive loads do not depend on each other
+	 */
+	value1 = _mm256_setzero_si256();
+	value2 = _mm256_setzero_si256();
+	value3 = _mm256_setzero_si256();
+	value4 = _mm256_setzero_si256();
+
+	for( buffer_offset = 0;
+	     buffer_offset < size;
+	     buffer_offset += 128 )
 	{
-		value_64bit = 0;
-		byte_count  = 1;
+		value1 = _mm256_xor_si256(
+		          value1,
+		          _mm256_loadu_si256(
+		           (__m256i *) &( buffer[ buffer_offset ] ) ) );
+		value2 = _mm256_xor_si256(
+		          value2,
+		          _mm256_loadu_si256(
+		           (__m256i *) &( buffer[ buffer_offset + 32 ] ) ) );
+		value3 = _mm256_xor_si256(
+		          value3,
+		          _mm256_loadu_si256(
+		           (__m256i *) &( buffer[ buffer_offset + 64 ] ) ) );
+		value4 = _mm256_xor_si256(
+		          value4,
+		          _mm256_loadu_si256(
+		           (__m256i *) &( buffer[ buffer_offset + 96 ] ) ) );
+	}
+	value1 = _mm256_xor_si256(
+	          _mm256_xor_si256(
+	           value1,
+	           value2 ),
+	          _mm256_xor_si256(
+	           value3,
+	           value4 ) );
+
+	result = _mm_xor_si128(
+	          _mm256_castsi256_si128(
+	           value1 ),
+	          _mm256_extracti128_si256(
+	           value1,
+	           1 ) );
+
+	_mm_storeu_si128(
+	 (__m128i *) lanes,
+	 result );
+
+	return( checksum_value ^ lanes[ 0 ] ^ lanes[ 1 ] );
+}
 
-		if( size >= 4 )
-		{
-			value_64bit |= buffer_iterator[ 3 ];
-			value_64bit <<= 8;
+/* Calculates the little-endian XOR-64 of a buffer using AVX-512F
+ * The size must be a multiple of 256
+ * Returns the XOR-64
+ */
+CPU_FEATURES_TARGET( "avx512f" )
+static uint64_t xor64_calculate_avx512f(
+                 uint64_t checksum_value,
+                 const uint8_t *buffer,
+                 size_t size )
+{
+	uint64_t lanes[ 2 ];
 
-			byte_count++;
-		}
-		if( size >= 3 )
-		{
-			value_64bit |= buffer_iterator[ 2 ];
-			value_64bit <<= 8;
+	__m512i value1;
+	__m512i value2;
+	__m512i value3;
+	__m512i value4;
+	__m256i result;
+	__m128i value;
 
-			byte_count++;
-		}
-		if( size >= 2 )
-		{
-			value_64bit |= buffer_iterator[ 1 ];
-			value_64bit <<= 8;
+	size_t buffer_offset = 0;
 
-			byte_count++;
-		}
-		value_64bit |= buffer_iterator[ 0 ];
+	/* Use 4 independent accumulators so that the XOR operations
+	 * of consecutive loads do not depend on each other
+	 */
+	value1 = _mm512_setzero_si512();
+	value2 = _mm512_setzero_si512();
+	value3 = _mm512_setzero_si512();
+	value4 = _mm512_setzero_si512();
+
+	for( buffer_offset = 0;
+	     buffer_offset < size;
+	     buffer_offset += 256 )
+	{
+		value1 = _mm512_xor_si512(
+		          value1,
+		          _mm512_loadu_si512(
+		           (const void *) &( buffer[ buffer_offset ] ) ) );
+		value2 = _mm512_xor_si512(
+		          value2,
+		          _mm512_loadu_si512(
+		           (const void *) &( buffer[ buffer_offset + 64 ] ) ) );
+		value3 = _mm512_xor_si512(
+		          value3,
+		          _mm512_loadu_si512(
+		           (const void *) &( buffer[ buffer_offset + 128 ] ) ) );
+		value4 = _mm512_xor_si512(
+		          value4,
+		          _mm512_loadu_si512(
+		           (const void *) &( buffer[ buffer_offset + 192 ] ) ) );
+	}
+	value1 = _mm512_xor_si512(
+	          _mm512_xor_si512(
+	           value1,
+	           value2 ),
+	          _mm512_xor_si512(
+	           value3,
+	           value4 ) );
+
+	result = _mm256_xor_si256(
+	          _mm512_castsi512_si256(
+	           value1 ),
+	          _mm512_extracti64x4_epi64(
+	           value1,
+	           1 ) );
+
+	value = _mm_xor_si128(
+	         _mm256_castsi256_si128(
+	          result ),
+	         _mm256_extracti128_si256(
+	          result,
+	          1 ) );
+
+	_mm_storeu_si128(
+	 (__m128i *) lanes,
+	 value );
+
+	return( checksum_value ^ lanes[ 0 ] ^ lanes[ 1 ] );
+}
 
-		buffer_iterator += byte_count;
-		size            -= byte_count;
+#elif defined( HAVE_CPU_FEATURES_ARM64 )
 
-		*checksum_value ^= value_64bit;
+/* Calculates the little-endian XOR-64 of a buffer using NEON (Advanced SIMD)
+ * The size must be a multiple of 64
+ * Returns the XOR-64
+ */
+static uint64_t xor64_calculate_neon(
+                 uint64_t checksum_value,
+                 const uint8_t *buffer,
+                 size_t size )
+{
+	uint8x16_t value1;
+	uint8x16_t value2;
+	uint8x16_t value3;
+	uint8x16_t value4;
+	uint64x2_t lanes;
+
+	size_t buffer_offset = 0;
+
+	/* Use 4 independent accumulators so that the XOR operations
+	 * of consecutive loads do not depend on each other
+	 */
+	value1 = vdupq_n_u8( 0 );
+	value2 = vdupq_n_u8( 0 );
+	value3 = vdupq_n_u8( 0 );
+	value4 = vdupq_n_u8( 0 );
+
+	for( buffer_offset = 0;
+	     buffer_offset < size;
+	     buffer_offset += 64 )
+	{
+		value1 = veorq_u8(
+		          value1,
+		          vld1q_u8(
+		           &( buffer[ buffer_offset ] ) ) );
+		value2 = veorq_u8(
+		          value2,
+		          vld1q_u8(
+		           &( buffer[ buffer_offset + 16 ] ) ) );
+		value3 = veorq_u8(
+		          value3,
+		          vld1q_u8(
+		           &( buffer[ buffer_offset + 32 ] ) ) );
+		value4 = veorq_u8(
+		          value4,
+		          vld1q_u8(
+		           &( buffer[ buffer_offset + 48 ] ) ) );
+	}
+	value1 = veorq_u8(
+	          veorq_u8(
+	           value1,
+	           value2 ),
+	          veorq_u8(
+	           value3,
+	           value4 ) );
+
+	lanes = vreinterpretq_u64_u8(
+	         value1 );
+
+	return( checksum_value ^ vgetq_lane_u64( lanes, 0 ) ^ vgetq_lane_u64( lanes, 1 ) );
+}
+
+#endif /* defined( HAVE_CPU_FEATURES_X86 ) */
+
+/* Calculates the little-endian XOR-64 of a buffer
+ * Uses the SIMD instructions of the CPU if available, otherwise falls back to the CPU aligned variant
+ *
+ * On x86 AVX-512F, AVX2 or SSE2 is used and on ARMv8 NEON (Advanced SIMD).
+ * The data that remains after the last SIMD block is calculated with the CPU aligned variant.
+ *
+ * It uses the initial value to calculate a new XOR-64
+ * Returns 1 if successful or -1 on error
+ */
+int checksum_calculate_little_endian_xor64_simd(
+     uint64_t *checksum_value,
+     const uint8_t *buffer,
+     size_t size,
+     uint64_t initial_value,
+     libcerror_error_t **error )
+{
+	static char *function = "checksum_calculate_little_endian_xor64_simd";
+	size_t buffer_offset  = 0;
+	size_t block_size     = 0;
+	uint64_t value_64bit  = 0;
+
+	if( checksum_value == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid checksum value.",
+		 function );
+
+		return( -1 );
 	}
+	if( buffer == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid buffer.",
+		 function );
+
+		return( -1 );
+	}
+	if( size > (size_t) SSIZE_MAX )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid size value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	value_64bit = initial_value;
+
+	/* The SIMD blocks are a multiple of 8 bytes hence the XOR-64 of the
+	 * remaining data stays aligned with the start of the buffer
+	 */
+#if defined( HAVE_CPU_FEATURES_X86 )
+	/* Note that AVX-512BW implies AVX-512F
+	 */
+	if( ( size >= 256 )
+	 && ( cpu_features_has(
+	       CPU_FEATURE_FLAG_AVX512BW ) != 0 ) )
+	{
+		block_size = size & ~( (size_t) 255 );
+
+		value_64bit = xor64_calculate_avx512f(
+		               value_64bit,
+		               buffer,
+		               block_size );
+
+		buffer_offset = block_size;
+	}
+	else if( ( size >= 128 )
+	      && ( cpu_features_has(
+	            CPU_FEATURE_FLAG_AVX2 ) != 0 ) )
+	{
+		block_size = size & ~( (size_t) 127 );
+
+		value_64bit = xor64_calculate_avx2(
+		               value_64bit,
+		               buffer,
+		               block_size );
+
+		buffer_offset = block_size;
+	}
+	if( ( ( size - buffer_offset ) >= 64 )
+	 && ( cpu_features_has(
+	       CPU_FEATURE_FLAG_SSE2 ) != 0 ) )
+	{
+		block_size = ( size - buffer_offset ) & ~( (size_t) 63 );
+
+		value_64bit = xor64_calculate_sse2(
+		               value_64bit,
+		               &( buffer[ buffer_offset ] ),
+		               block_size );
+
+		buffer_offset += block_size;
+	}
+#elif defined( HAVE_CPU_FEATURES_ARM64 )
+	if( ( size >= 64 )
+	 && ( cpu_features_has(
+	       CPU_FEATURE_FLAG_NEON ) != 0 ) )
+	{
+		block_size = size & ~( (size_t) 63 );
+
+		value_64bit = xor64_calculate_neon(
+		               value_64bit,
+		               buffer,
+		               block_size );
+
+		buffer_offset = block_size;
+	}
+#endif
+	/* Calculate the remaining data using the CPU aligned variant
+	 */
+	if( checksum_calculate_little_endian_xor64_cpu_aligned(
+	     &value_64bit,
+	     &( buffer[ buffer_offset ] ),
+	     size - buffer_offset,
+	     value_64bit,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GENERIC,
+		 "%s: unable to calculate XOR-64 of remaining data.",
+		 function );
+
+		return( -1 );
+	}
+	*checksum_value = value_64bit;
+
 	return( 1 );
 }
 
@@ -45,6 +45,13 @@ int checksum_calculate_little_endian_xor64_cpu_aligned(
      uint64_t initial_value,
      libcerror_error_t **error );
 
+int checksum_calculate_little_endian_xor64_simd(
+     uint64_t *checksum_value,
+     const uint8_t *buffer,
+     size_t size,
+     uint64_t initial_value,
+     libcerror_error_t **error );
+
 #if defined( __cplusplus )
 }
 #endif
@@ -20,6 +20,7 @@
  */
 
 #include <common.h>
+#include <byte_stream.h>
 #include <file_stream.h>
 #include <memory.h>
 #include <narrow_string.h>
@@ -34,13 +35,23 @@
 #include <zlib.h>
 #endif
 
+#include "adler32.h"
 #include "assorted_getopt.h"
 #include "assorted_libcerror.h"
 #include "assorted_libcfile.h"
 #include "assorted_libcnotify.h"
+#include "assorted_libcthreads.h"
 #include "assorted_output.h"
 #include "deflate.h"
 
+/* The maximum number of threads
+ */
+#define ZCOMPRESS_MAXIMUM_NUMBER_OF_THREADS	64
+
+/* The size of the chunks of data compressed by a thread
+ */
+#define ZCOMPRESS_CHUNK_SIZE			( 128 * 1024 )
+
 /* Prints the executable usage information
  */
 void usage_fprint(
@@ -53,7 +64,8 @@ void usage_fprint(
 	fprintf( stream, "Use zcompress to compress data as zlib compressed data.\n\n" );
 
 	fprintf( stream, "Usage: zcompress [ -l compression_level ] [ -o offset ]\n"
-	                 "                 [ -s size ] [ -12hvV ] source\n\n" );
+	                 "                 [ -s size ] [ -S format ] [ -t threads ] [ -12hvV ]\n"
+	                 "                 source\n\n" );
 
 	fprintf( stream, "\tsource: the source file\n\n" );
 
@@ -63,11 +75,543 @@ void usage_fprint(
 	fprintf( stream, "\t-l:     compression level (default is -1)\n" );
 	fprintf( stream, "\t-o:     data offset (default is 0)\n" );
 	fprintf( stream, "\t-s:     size of data (default is the file size)\n" );
+	fprintf( stream, "\t-S:     print timing and throughput statistics of the open,\n"
+	                 "\t        read, compute and write phases and the peak memory\n"
+	                 "\t        size to stderr in the format: text or json\n" );
+	fprintf( stream, "\t-t:     number of threads (default is 1), the data is split\n"
+	                 "\t        into chunks that are compressed in parallel by the\n"
+	                 "\t        internal compression method\n" );
 	fprintf( stream, "\t-v:     verbose output to stderr\n" );
 	fprintf( stream, "\t-V:     print version\n" );
 	fprintf( stream, "\n" );
 }
 
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+
+typedef struct zcompress_chunk zcompress_chunk_t;
+
+struct zcompress_chunk
+{
+	/* The offset of the chunk in the uncompressed data
+	 */
+	size_t offset;
+
+	/* The size of the chunk
+	 */
+	size_t size;
+
+	/* The compressed data of the chunk
+	 */
+	uint8_t *compressed_data;
+
+	/* The compressed data size of the chunk
+	 */
+	size_t compressed_data_size;
+
+	/* The calculated Adler-32 of the chunk
+	 */
+	uint32_t adler32;
+
+	/* The result of the compression
+	 */
+	int result;
+};
+
+typedef struct zcompress_thread_range zcompress_thread_range_t;
+
+struct zcompress_thread_range
+{
+	/* The uncompressed data
+	 */
+	const uint8_t *uncompressed_data;
+
+	/* The compression level
+	 */
+	int compression_level;
+
+	/* The chunks
+	 */
+	zcompress_chunk_t *chunks;
+
+	/* The number of chunks
+	 */
+	int number_of_chunks;
+
+	/* The index of the first chunk compressed by the thread
+	 */
+	int first_chunk_index;
+
+	/* The number of chunks between the chunks compressed by the thread
+	 */
+	int chunk_index_step;
+};
+
+/* Compresses the chunks of a range, used as the callback function of a thread
+ * The thread compresses every chunk_index_step chunk starting with first_chunk_index
+ * Every chunk is primed with the uncompressed data before it as preset dictionary
+ * Returns 1 if successful or -1 on error
+ */
+int zcompress_thread_range_compress(
+     void *arguments )
+{
+	zcompress_chunk_t *chunk               = NULL;
+	zcompress_thread_range_t *thread_range = NULL;
+	int chunk_index                        = 0;
+	int result                             = 1;
+
+	if( arguments == NULL )
+	{
+		return( -1 );
+	}
+	thread_range = (zcompress_thread_range_t *) arguments;
+
+	for( chunk_index = thread_range->first_chunk_index;
+	     chunk_index < thread_range->number_of_chunks;
+	     chunk_index += thread_range->chunk_index_step )
+	{
+		chunk = &( thread_range->chunks[ chunk_index ] );
+
+		chunk->result = deflate_compress_chunk(
+		                 thread_range->uncompressed_data,
+		                 chunk->offset + chunk->size,
+		                 chunk->offset,
+		                 thread_range->compression_level,
+		                 (uint8_t) ( chunk_index == ( thread_range->number_of_chunks - 1 ) ),
+		                 chunk->compressed_data,
+		                 &( chunk->compressed_data_size ),
+		                 NULL );
+
+		if( chunk->result == 1 )
+		{
+			chunk->result = deflate_calculate_adler32(
+			                 &( chunk->adler32 ),
+			                 &( thread_range->uncompressed_data[ chunk->offset ] ),
+			                 chunk->size,
+			                 1,
+			                 NULL );
+		}
+		if( chunk->result != 1 )
+		{
+			result = -1;
+		}
+	}
+	return( result );
+}
+
+/* Compresses data as zlib compressed data using multiple threads
+ * The data is split into chunks that are compressed in parallel, every chunk
+ * uses the 32 KiB before it as preset dictionary and all but the last chunk
+ * end with a sync flush, so that the compressed chunks can be concatenated
+ * into a single zlib stream. The Adler-32 of the chunks are combined into
+ * the Adler-32 of the data. The last range is compressed by the calling thread
+ * Returns 1 if successful or -1 on error
+ */
+int zcompress_compress_parallel(
+     const uint8_t *uncompressed_data,
+     size_t uncompressed_data_size,
+     int compression_level,
+     uint8_t *compressed_data,
+     size_t *compressed_data_size,
+     int number_of_threads,
+     libcerror_error_t **error )
+{
+	libcthreads_thread_t **threads          = NULL;
+	uint8_t *chunks_data                    = NULL;
+	zcompress_chunk_t *chunks               = NULL;
+	zcompress_thread_range_t *thread_ranges = NULL;
+	static char *function                   = "zcompress_compress_parallel";
+	size_t chunk_data_size                  = 0;
+	size_t compressed_data_offset           = 0;
+	size_t safe_compressed_data_size        = 0;
+	uint32_t adler32                        = 1;
+	int chunk_index                         = 0;
+	int number_of_chunks                    = 0;
+	int number_of_ranges                    = 0;
+	int range_index                         = 0;
+	int result                              = 1;
+
+	if( uncompressed_data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid uncompressed data.",
+		 function );
+
+		return( -1 );
+	}
+	if( uncompressed_data_size > (size_t) SSIZE_MAX )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid uncompressed data size value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	if( compressed_data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid compressed data.",
+		 function );
+
+		return( -1 );
+	}
+	if( compressed_data_size == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid compressed data size.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( number_of_threads <= 0 )
+	 || ( number_of_threads > ZCOMPRESS_MAXIMUM_NUMBER_OF_THREADS ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid number of threads value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	number_of_chunks = (int) ( uncompressed_data_size / ZCOMPRESS_CHUNK_SIZE );
+
+	if( ( uncompressed_data_size % ZCOMPRESS_CHUNK_SIZE ) != 0 )
+	{
+		number_of_chunks++;
+	}
+	/* Do not use more threads than chunks
+	 */
+	number_of_ranges = number_of_threads;
+
+	if( number_of_chunks < number_of_ranges )
+	{
+		number_of_ranges = number_of_chunks;
+	}
+	if( number_of_ranges <= 1 )
+	{
+		return( deflate_compress(
+		         uncompressed_data,
+		         uncompressed_data_size,
+		         compression_level,
+		         compressed_data,
+		         compressed_data_size,
+		         error ) );
+	}
+	safe_compressed_data_size = *compressed_data_size;
+
+	if( deflate_write_zlib_header(
+	     compressed_data,
+	     safe_compressed_data_size,
+	     compression_level,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_COMPRESSION,
+		 LIBCERROR_COMPRESSION_ERROR_COMPRESS_FAILED,
+		 "%s: unable to write zlib header.",
+		 function );
+
+		goto on_error;
+	}
+	compressed_data_offset = 2;
+
+	/* Reserve space for the stored block headers in case a chunk cannot be compressed
+	 * and for the empty stored block of the sync flush
+	 */
+	chunk_data_size = ZCOMPRESS_CHUNK_SIZE + ( ZCOMPRESS_CHUNK_SIZE / 256 ) + 64;
+
+	chunks = (zcompress_chunk_t *) memory_allocate(
+	                                sizeof( zcompress_chunk_t ) * number_of_chunks );
+
+	if( chunks == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create chunks.",
+		 function );
+
+		goto on_error;
+	}
+	chunks_data = (uint8_t *) memory_allocate(
+	                           sizeof( uint8_t ) * chunk_data_size * number_of_chunks );
+
+	if( chunks_data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create chunks data.",
+		 function );
+
+		goto on_error;
+	}
+	thread_ranges = (zcompress_thread_range_t *) memory_allocate(
+	                                              sizeof( zcompress_thread_range_t ) * number_of_ranges );
+
+	if( thread_ranges == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create thread ranges.",
+		 function );
+
+		goto on_error;
+	}
+	threads = (libcthreads_thread_t **) memory_allocate(
+	                                     sizeof( libcthreads_thread_t * ) * number_of_ranges );
+
+	if( threads == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create threads.",
+		 function );
+
+		goto on_error;
+	}
+	if( memory_set(
+	     threads,
+	     0,
+	     sizeof( libcthreads_thread_t * ) * number_of_ranges ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear threads.",
+		 function );
+
+		goto on_error;
+	}
+	for( chunk_index = 0;
+	     chunk_index < number_of_chunks;
+	     chunk_index++ )
+	{
+		chunks[ chunk_index ].offset               = (size_t) chunk_index * ZCOMPRESS_CHUNK_SIZE;
+		chunks[ chunk_index ].size                 = ZCOMPRESS_CHUNK_SIZE;
+		chunks[ chunk_index ].compressed_data      = &( chunks_data[ (size_t) chunk_index * chunk_data_size ] );
+		chunks[ chunk_index ].compressed_data_size = chunk_data_size;
+		chunks[ chunk_index ].adler32              = 1;
+		chunks[ chunk_index ].result               = 0;
+	}
+	chunks[ number_of_chunks - 1 ].size = uncompressed_data_size - chunks[ number_of_chunks - 1 ].offset;
+
+	/* The chunks are interleaved over the threads so that the work is evenly
+	 * distributed even if some parts of the data compress slower than others
+	 */
+	for( range_index = 0;
+	     range_index < number_of_ranges;
+	     range_index++ )
+	{
+		thread_ranges[ range_index ].uncompressed_data      = uncompressed_data;
+		thread_ranges[ range_index ].compression_level      = compression_level;
+		thread_ranges[ range_index ].chunks                 = chunks;
+		thread_ranges[ range_index ].number_of_chunks       = number_of_chunks;
+		thread_ranges[ range_index ].first_chunk_index      = range_index;
+		thread_ranges[ range_index ].chunk_index_step       = number_of_ranges;
+	}
+	for( range_index = 0;
+	     range_index < ( number_of_ranges - 1 );
+	     range_index++ )
+	{
+		if( libcthreads_thread_create(
+		     &( threads[ range_index ] ),
+		     NULL,
+		     zcompress_thread_range_compress,
+		     (void *) &( thread_ranges[ range_index ] ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+			 "%s: unable to create thread: %d.",
+			 function,
+			 range_index );
+
+			result = -1;
+
+			break;
+		}
+	}
+	if( result == 1 )
+	{
+		zcompress_thread_range_compress(
+		 (void *) &( thread_ranges[ number_of_ranges - 1 ] ) );
+	}
+	/* Wait for the threads that were created, also on error
+	 */
+	for( range_index = 0;
+	     range_index < ( number_of_ranges - 1 );
+	     range_index++ )
+	{
+		if( threads[ range_index ] == NULL )
+		{
+			continue;
+		}
+		if( libcthreads_thread_join(
+		     &( threads[ range_index ] ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to join thread: %d.",
+			 function,
+			 range_index );
+
+			result = -1;
+		}
+	}
+	if( result != 1 )
+	{
+		goto on_error;
+	}
+	for( chunk_index = 0;
+	     chunk_index < number_of_chunks;
+	     chunk_index++ )
+	{
+		if( chunks[ chunk_index ].result != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_COMPRESSION,
+			 LIBCERROR_COMPRESSION_ERROR_COMPRESS_FAILED,
+			 "%s: unable to compress chunk: %d.",
+			 function,
+			 chunk_index );
+
+			goto on_error;
+		}
+		if( ( chunks[ chunk_index ].compressed_data_size > safe_compressed_data_size )
+		 || ( compressed_data_offset > ( safe_compressed_data_size - chunks[ chunk_index ].compressed_data_size ) ) )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+			 LIBCERROR_ARGUMENT_ERROR_VALUE_TOO_SMALL,
+			 "%s: invalid compressed data size value too small.",
+			 function );
+
+			goto on_error;
+		}
+		if( memory_copy(
+		     &( compressed_data[ compressed_data_offset ] ),
+		     chunks[ chunk_index ].compressed_data,
+		     chunks[ chunk_index ].compressed_data_size ) == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+			 "%s: unable to copy compressed data of chunk: %d.",
+			 function,
+			 chunk_index );
+
+			goto on_error;
+		}
+		compressed_data_offset += chunks[ chunk_index ].compressed_data_size;
+
+		if( chunk_index == 0 )
+		{
+			adler32 = chunks[ chunk_index ].adler32;
+		}
+		else if( checksum_combine_adler32(
+		          &adler32,
+		          adler32,
+		          chunks[ chunk_index ].adler32,
+		          (size64_t) chunks[ chunk_index ].size,
+		          error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GENERIC,
+			 "%s: unable to combine Adler-32 of chunk: %d.",
+			 function,
+			 chunk_index );
+
+			goto on_error;
+		}
+	}
+	if( ( compressed_data_offset + 4 ) > safe_compressed_data_size )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_TOO_SMALL,
+		 "%s: invalid compressed data size value too small.",
+		 function );
+
+		goto on_error;
+	}
+	byte_stream_copy_from_uint32_big_endian(
+	 &( compressed_data[ compressed_data_offset ] ),
+	 adler32 );
+
+	compressed_data_offset += 4;
+
+	*compressed_data_size = compressed_data_offset;
+
+	memory_free(
+	 threads );
+	memory_free(
+	 thread_ranges );
+	memory_free(
+	 chunks_data );
+	memory_free(
+	 chunks );
+
+	return( 1 );
+
+on_error:
+	if( threads != NULL )
+	{
+		memory_free(
+		 threads );
+	}
+	if( thread_ranges != NULL )
+	{
+		memory_free(
+		 thread_ranges );
+	}
+	if( chunks_data != NULL )
+	{
+		memory_free(
+		 chunks_data );
+	}
+	if( chunks != NULL )
+	{
+		memory_free(
+		 chunks );
+	}
+	return( -1 );
+}
+
+#endif /* defined( HAVE_MULTI_THREAD_SUPPORT ) */
+
 /* The main program
  */
 #if defined( HAVE_WIDE_SYSTEM_CHARACTER )
@@ -78,43 +622,50 @@ int main( int argc, char * const argv[] )
 {
 	char destination[ 128 ];
 
-	libcerror_error_t *error          = NULL;
-	libcfile_file_t *destination_file = NULL;
-	libcfile_file_t *source_file      = NULL;
-	system_character_t *source        = NULL;
-	uint8_t *buffer                   = NULL;
-	uint8_t *compressed_data          = NULL;
-	char *program                     = "zcompress";
-	system_integer_t option           = 0;
-	size64_t source_size              = 0;
-	size_t compressed_data_size       = 0;
-	ssize_t read_count                = 0;
-	ssize_t write_count               = 0;
-	off_t source_offset               = 0;
-	int compression_method            = 2;
-	int print_count                   = 0;
-	int result                        = 0;
-	int verbose                       = 0;
+	libcerror_error_t *error                     = NULL;
+	libcfile_file_t *destination_file            = NULL;
+	libcfile_file_t *source_file                 = NULL;
+	system_character_t *option_statistics_format = NULL;
+	system_character_t *source                   = NULL;
+	uint8_t *buffer                              = NULL;
+	uint8_t *compressed_data                     = NULL;
+	char *program                                = "zcompress";
+	system_integer_t option                      = 0;
+	size64_t source_size                         = 0;
+	uint64_t phase_start_time                    = 0;
+	size_t compressed_data_size                  = 0;
+	ssize_t read_count                           = 0;
+	ssize_t write_count                          = 0;
+	off_t source_offset                          = 0;
+	int compression_method                       = 2;
+	int number_of_threads                        = 1;
+	int print_count                              = 0;
+	int result                                   = 0;
+	int verbose                                  = 0;
 
 #if !defined( HAVE_ZLIB ) && !defined( ZLIB_DLL )
-	int compression_level             = -1;
+	int compression_level                        = -1;
 
 #else
-	int compression_level             = Z_DEFAULT_COMPRESSION;
+	int compression_level                        = Z_DEFAULT_COMPRESSION;
 
 #if defined( USE_COMPRESS2 )
-	uLongf zlib_compressed_data_size  = 0;
+	uLongf zlib_compressed_data_size             = 0;
 
 #else
 	z_stream zlib_stream;
 
-	int zlib_flush                    = Z_FINISH;
+	size_t region_offset                         = 0;
+	size_t region_size                           = 0;
+	int region_compression_level                 = 0;
+	int zlib_compression_level                   = 0;
+	int zlib_flush                               = Z_FINISH;
+	int zlib_strategy                            = Z_DEFAULT_STRATEGY;
 
 #if !defined( USE_DEFLATE_INIT )
-	int zlib_memLevel                 = 8;
-	int zlib_method                   = Z_DEFLATED;
-	int zlib_strategy                 = Z_DEFAULT_STRATEGY;
-	int zlib_windowBits               = 15;
+	int zlib_memLevel   = 8;
+	int zlib_method     = Z_DEFLATED;
+	int zlib_windowBits = 15;
 
 #endif /* !defined( USE_DEFLATE_INIT ) */
 #endif /* defined( USE_COMPRESS2 ) */
@@ -127,7 +678,7 @@ int main( int argc, char * const argv[] )
 	while( ( option = assorted_getopt(
 	                   argc,
 	                   argv,
-	                   _SYSTEM_STRING( "12hl:o:s:vV" ) ) ) != (system_integer_t) -1 )
+	                   _SYSTEM_STRING( "12hl:o:s:S:t:vV" ) ) ) != (system_integer_t) -1 )
 	{
 		switch( option )
 		{
@@ -174,6 +725,16 @@ int main( int argc, char * const argv[] )
 
 				break;
 
+			case 'S':
+				option_statistics_format = optarg;
+
+				break;
+
+			case 't':
+				number_of_threads = (int) atol( optarg );
+
+				break;
+
 			case 'v':
 				verbose = 1;
 
@@ -199,12 +760,43 @@ int main( int argc, char * const argv[] )
 	}
 	source = argv[ optind ];
 
+	if( ( number_of_threads <= 0 )
+	 || ( number_of_threads > ZCOMPRESS_MAXIMUM_NUMBER_OF_THREADS ) )
+	{
+		fprintf(
+		 stderr,
+		 "Unsupported number of threads, value must be between 1 and %d.\n",
+		 ZCOMPRESS_MAXIMUM_NUMBER_OF_THREADS );
+
+		return( EXIT_FAILURE );
+	}
+#if !defined( HAVE_MULTI_THREAD_SUPPORT )
+	if( number_of_threads > 1 )
+	{
+		fprintf(
+		 stderr,
+		 "Multi-threading not supported, using a single thread.\n" );
+
+		number_of_threads = 1;
+	}
+#endif
 	libcnotify_stream_set(
 	 stderr,
 	 NULL );
 	libcnotify_verbose_set(
 	 verbose );
 
+	if( assorted_output_statistics_initialize(
+	     option_statistics_format,
+	     &error ) != 1 )
+	{
+		fprintf(
+		 stderr,
+		 "Unable to initialize statistics.\n" );
+
+		goto on_error;
+	}
+
 	/* Open the source file
 	 */
 	if( libcfile_file_initialize(
@@ -217,6 +809,8 @@ int main( int argc, char * const argv[] )
 
 		goto on_error;
 	}
+	phase_start_time = assorted_output_statistics_start_phase();
+
 	if( libcfile_file_open(
 	     source_file,
 	     source,
@@ -229,6 +823,11 @@ int main( int argc, char * const argv[] )
 
 		goto on_error;
 	}
+	assorted_output_statistics_stop_phase(
+	 ASSORTED_OUTPUT_STATISTICS_PHASE_OPEN,
+	 phase_start_time,
+	 0 );
+
 	if( source_size == 0 )
 	{
 		if( libcfile_file_get_size(
@@ -270,7 +869,10 @@ int main( int argc, char * const argv[] )
 
 		goto on_error;
 	}
-	compressed_data_size = source_size * 2;
+	/* Reserve space for the zlib header and checksum and the stored block headers
+	 * in case the data cannot be compressed
+	 */
+	compressed_data_size = ( source_size * 2 ) + 16;
 
 	compressed_data = (uint8_t *) memory_allocate(
 	                               sizeof( uint8_t ) * compressed_data_size );
@@ -314,6 +916,8 @@ int main( int argc, char * const argv[] )
 	}
 	/* Read and compress the data
 	 */
+	phase_start_time = assorted_output_statistics_start_phase();
+
 	read_count = libcfile_file_read_buffer(
 		      source_file,
 		      buffer,
@@ -328,6 +932,11 @@ int main( int argc, char * const argv[] )
 
 		goto on_error;
 	}
+	assorted_output_statistics_stop_phase(
+	 ASSORTED_OUTPUT_STATISTICS_PHASE_READ,
+	 phase_start_time,
+	 (size64_t) read_count );
+
 	if( compression_method == 1 )
 	{
 #if !defined( HAVE_ZLIB ) && !defined( ZLIB_DLL )
@@ -382,24 +991,84 @@ int main( int argc, char * const argv[] )
 
 			goto on_error;
 		}
-		zlib_stream.avail_in  = (uInt) source_size;
-		zlib_stream.next_in   = (Bytef *) buffer;
 		zlib_stream.avail_out = (uInt) compressed_data_size;
 		zlib_stream.next_out  = (Bytef *) compressed_data;
 
-		result = deflate(
-			  &zlib_stream,
-			  zlib_flush );
+		zlib_compression_level = compression_level;
 
-		if( result < 0 )
+		/* Regions that are estimated to be incompressible, such as encrypted
+		 * or already compressed data, are stored by switching to compression level 0
+		 */
+		while( region_offset < (size_t) source_size )
 		{
-			fprintf(
-			 stderr,
-			 "Unable to compress data - deflate (%d, %s).\n",
-			 result,
-			 zlib_stream.msg );
+			region_size = (size_t) source_size - region_offset;
+
+			if( region_size > DEFLATE_COMPRESSOR_SCAN_SIZE )
+			{
+				region_size = DEFLATE_COMPRESSOR_SCAN_SIZE;
+			}
+			result = deflate_data_is_compressible(
+			          &( buffer[ region_offset ] ),
+			          region_size,
+			          &error );
+
+			if( result == -1 )
+			{
+				fprintf(
+				 stderr,
+				 "Unable to determine if region is compressible.\n" );
+
+				goto on_error;
+			}
+			region_compression_level = 0;
+
+			if( result != 0 )
+			{
+				region_compression_level = compression_level;
+			}
+			if( region_compression_level != zlib_compression_level )
+			{
+				result = deflateParams(
+				          &zlib_stream,
+				          region_compression_level,
+				          zlib_strategy );
+
+				if( result != Z_OK )
+				{
+					fprintf(
+					 stderr,
+					 "Unable to compress data - deflateParams (%d, %s).\n",
+					 result,
+					 zlib_stream.msg );
+
+					goto on_error;
+				}
+				zlib_compression_level = region_compression_level;
+			}
+			zlib_flush = Z_NO_FLUSH;
+
+			if( ( region_offset + region_size ) == (size_t) source_size )
+			{
+				zlib_flush = Z_FINISH;
+			}
+			zlib_stream.avail_in = (uInt) region_size;
+			zlib_stream.next_in  = (Bytef *) &( buffer[ region_offset ] );
+
+			result = deflate(
+				  &zlib_stream,
+				  zlib_flush );
+
+			if( result < 0 )
+			{
+				fprintf(
+				 stderr,
+				 "Unable to compress data - deflate (%d, %s).\n",
+				 result,
+				 zlib_stream.msg );
 
-			goto on_error;
+				goto on_error;
+			}
+			region_offset += region_size;
 		}
 		result = deflateEnd(
 		          &zlib_stream );
@@ -420,13 +1089,30 @@ int main( int argc, char * const argv[] )
 	}
 	else if( compression_method == 2 )
 	{
-		if( deflate_compress(
-		     buffer,
-		     source_size,
-		     compression_level,
-		     compressed_data,
-		     &compressed_data_size,
-		     &error ) != 1 )
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+		if( number_of_threads > 1 )
+		{
+			result = zcompress_compress_parallel(
+			          buffer,
+			          source_size,
+			          compression_level,
+			          compressed_data,
+			          &compressed_data_size,
+			          number_of_threads,
+			          &error );
+		}
+		else
+#endif
+		{
+			result = deflate_compress(
+			          buffer,
+			          source_size,
+			          compression_level,
+			          compressed_data,
+			          &compressed_data_size,
+			          &error );
+		}
+		if( result != 1 )
 		{
 			fprintf(
 			 stderr,
@@ -447,6 +1133,8 @@ int main( int argc, char * const argv[] )
 
 		goto on_error;
 	}
+	phase_start_time = assorted_output_statistics_start_phase();
+
 	if( libcfile_file_open(
 	     destination_file,
 	     destination,
@@ -459,6 +1147,13 @@ int main( int argc, char * const argv[] )
 
 		goto on_error;
 	}
+	assorted_output_statistics_stop_phase(
+	 ASSORTED_OUTPUT_STATISTICS_PHASE_OPEN,
+	 phase_start_time,
+	 0 );
+
+	phase_start_time = assorted_output_statistics_start_phase();
+
 	write_count = libcfile_file_write_buffer(
 		       destination_file,
 		       compressed_data,
@@ -473,8 +1168,15 @@ int main( int argc, char * const argv[] )
 
 		goto on_error;
 	}
+	assorted_output_statistics_stop_phase(
+	 ASSORTED_OUTPUT_STATISTICS_PHASE_WRITE,
+	 phase_start_time,
+	 (size64_t) write_count );
+
 	/* Clean up
 	 */
+	phase_start_time = assorted_output_statistics_start_phase();
+
 	if( libcfile_file_close(
 	     destination_file,
 	     &error ) != 0 )
@@ -485,6 +1187,11 @@ int main( int argc, char * const argv[] )
 
 		goto on_error;
 	}
+	assorted_output_statistics_stop_phase(
+	 ASSORTED_OUTPUT_STATISTICS_PHASE_WRITE,
+	 phase_start_time,
+	 0 );
+
 	if( libcfile_file_free(
 	     &destination_file,
 	     &error ) != 1 )
@@ -533,6 +1240,14 @@ int main( int argc, char * const argv[] )
 	 stdout,
 	 "Z compression:\tSUCCESS\n" );
 
+	assorted_output_statistics_fprint(
+	 stderr,
+	 program,
+	 1,
+	 NULL );
+	assorted_output_statistics_free(
+	 NULL );
+
 	return( EXIT_SUCCESS );
 
 on_error:
@@ -543,6 +1258,13 @@ on_error:
 		libcerror_error_free(
 		 &error );
 	}
+	assorted_output_statistics_fprint(
+	 stderr,
+	 program,
+	 -1,
+	 NULL );
+	assorted_output_statistics_free(
+	 NULL );
 	if( destination_file != NULL )
 	{
 		libcfile_file_free(
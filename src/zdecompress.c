@@ -1,5 +1,5 @@
 /*
- * zdecompress decompresses zlib compressed data
+ * zdecompress decompresses zlib or GZIP compressed data
  *
  * Copyright (C) 2008-2019, Joachim Metz <joachim.metz@gmail.com>
  *
@@ -20,6 +20,7 @@
  */
 
 #include <common.h>
+#include <byte_stream.h>
 #include <file_stream.h>
 #include <memory.h>
 #include <narrow_string.h>
@@ -35,35 +36,2025 @@
 #endif
 
 #include "assorted_getopt.h"
+#include "assorted_input_file.h"
 #include "assorted_libcerror.h"
 #include "assorted_libcfile.h"
 #include "assorted_libcnotify.h"
 #include "assorted_output.h"
+#include "assorted_output_file.h"
+#include "assorted_worker_pool.h"
 #include "deflate.h"
+#include "deflate_index.h"
+#include "deflate_parallel.h"
+#include "deflate_stream.h"
+#include "gzip.h"
+
+/* The size of the chunks used by the streaming decompression method
+ */
+#define ZDECOMPRESS_STREAM_CHUNK_SIZE		( 64 * 1024 )
+
+/* The maximum number of threads
+ */
+#define ZDECOMPRESS_MAXIMUM_NUMBER_OF_THREADS	64
+
+/* The number of ranges of BGZF members per thread, more ranges than threads
+ * let idle workers steal the ranges of workers that are still busy
+ */
+#define ZDECOMPRESS_BGZF_RANGES_PER_THREAD	4
+
+/* The number of chunks of a speculatively decompressed stream per thread
+ */
+#define ZDECOMPRESS_PARALLEL_CHUNKS_PER_THREAD	2
+
+/* The minimum size of the compressed data of a chunk of a speculatively decompressed stream
+ * smaller chunks spend relatively more time on finding their first block
+ */
+#define ZDECOMPRESS_PARALLEL_MINIMUM_CHUNK_SIZE	( 1024 * 1024 )
+
+typedef struct zdecompress_bgzf_member zdecompress_bgzf_member_t;
+
+struct zdecompress_bgzf_member
+{
+	/* The offset of the member in the compressed data
+	 */
+	size_t compressed_offset;
+
+	/* The size of the member
+	 */
+	size_t compressed_size;
+
+	/* The offset of the uncompressed data of the member
+	 */
+	size_t uncompressed_offset;
+
+	/* The size of the uncompressed data of the member
+	 */
+	size_t uncompressed_size;
+};
 
 /* Prints the executable usage information
  */
-void usage_fprint(
-      FILE *stream )
+void usage_fprint(
+      FILE *stream )
+{
+	if( stream == NULL )
+	{
+		return;
+	}
+	fprintf( stream, "Use zdecompress to decompress data as zlib or GZIP compressed data.\n\n" );
+
+	fprintf( stream, "Usage: zdecompress [ -i interval ] [ -l size ] [ -o offset ] [ -s size ]\n"
+	                 "                   [ -S format ] [ -t threads ] [ -u offset ] [ -123hnpvV ]\n"
+	                 "                   source\n\n" );
+
+	fprintf( stream, "\tsource: the source file\n\n" );
+
+	fprintf( stream, "\t-1:     use the zlib decompression method\n" );
+	fprintf( stream, "\t-2:     use the internal decompression method (default), which also\n"
+	                 "\t        decompresses GZIP compressed data, including multi-member\n"
+	                 "\t        and BGZF compressed data\n" );
+	fprintf( stream, "\t-3:     use the internal streaming decompression method\n" );
+	fprintf( stream, "\t-h:     shows this help\n" );
+	fprintf( stream, "\t-i:     build a random-access index with an access point every interval\n"
+	                 "\t        bytes of uncompressed data and write it to source.zindex,\n"
+	                 "\t        uses the internal streaming decompression method\n" );
+	fprintf( stream, "\t-l:     size of the uncompressed data to decompress at the uncompressed\n"
+	                 "\t        offset using the random-access index in source.zindex\n" );
+	fprintf( stream, "\t-n:     do not verify the Adler-32 or CRC-32 of the uncompressed data,\n"
+	                 "\t        only used by the internal decompression methods\n" );
+	fprintf( stream, "\t-o:     data offset (default is 0)\n" );
+	fprintf( stream, "\t-p:     speculatively decompress a single zlib stream in parallel using\n"
+	                 "\t        the number of threads (experimental), falls back to the internal\n"
+	                 "\t        decompression method if the block boundaries cannot be determined\n" );
+	fprintf( stream, "\t-s:     size of data (default is the file size)\n" );
+	fprintf( stream, "\t-S:     print timing and throughput statistics of the open,\n"
+	                 "\t        read, compute and write phases and the peak memory\n"
+	                 "\t        size to stderr in the format: text or json\n" );
+	fprintf( stream, "\t-t:     number of threads (default is 1), used to decompress\n"
+	                 "\t        the members of BGZF compressed data in parallel and by -p\n" );
+	fprintf( stream, "\t-u:     uncompressed offset (default is 0), used with -l\n" );
+	fprintf( stream, "\t-v:     verbose output to stderr\n" );
+	fprintf( stream, "\t-V:     print version\n" );
+	fprintf( stream, "\n" );
+}
+
+/* Decompresses the source data in chunks and writes the uncompressed data to the destination file
+ * If index is not NULL access points are added to the index while decompressing
+ * Returns 1 if successful or -1 on error
+ */
+int zdecompress_stream(
+     assorted_input_file_t *source_file,
+     size64_t source_size,
+     assorted_output_file_t *destination_file,
+     deflate_index_t *index,
+     uint8_t ignore_checksum,
+     libcerror_error_t **error )
+{
+	deflate_stream_t *stream      = NULL;
+	uint8_t *buffer               = NULL;
+	uint8_t *uncompressed_data    = NULL;
+	static char *function         = "zdecompress_stream";
+	size_t buffer_offset          = 0;
+	size_t buffer_size            = 0;
+	size_t compressed_data_size   = 0;
+	size_t read_size              = 0;
+	size_t uncompressed_data_size = 0;
+	ssize_t read_count            = 0;
+	ssize_t write_count           = 0;
+	uint8_t flags                 = 0;
+	int result                    = 0;
+
+	if( ignore_checksum != 0 )
+	{
+		flags = DEFLATE_STREAM_FLAG_IGNORE_CHECKSUM;
+	}
+	if( deflate_stream_initialize(
+	     &stream,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create stream.",
+		 function );
+
+		goto on_error;
+	}
+	uncompressed_data = (uint8_t *) memory_allocate(
+	                                 sizeof( uint8_t ) * ZDECOMPRESS_STREAM_CHUNK_SIZE );
+
+	if( uncompressed_data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create uncompressed data buffer.",
+		 function );
+
+		goto on_error;
+	}
+	/* Read the next chunks ahead while the current chunk is decompressed
+	 */
+	if( assorted_input_file_set_read_ahead(
+	     source_file,
+	     ZDECOMPRESS_STREAM_CHUNK_SIZE,
+	     ASSORTED_INPUT_FILE_MAXIMUM_NUMBER_OF_READ_AHEAD_BLOCKS,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to set read-ahead of source file.",
+		 function );
+
+		goto on_error;
+	}
+	while( result == 0 )
+	{
+		if( ( buffer_offset >= buffer_size )
+		 && ( source_size > 0 ) )
+		{
+			read_size = ZDECOMPRESS_STREAM_CHUNK_SIZE;
+
+			if( (size64_t) read_size > source_size )
+			{
+				read_size = (size_t) source_size;
+			}
+			read_count = assorted_input_file_read_data(
+			              source_file,
+			              &buffer,
+			              read_size,
+			              error );
+
+			if( read_count != (ssize_t) read_size )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_IO,
+				 LIBCERROR_IO_ERROR_READ_FAILED,
+				 "%s: unable to read from source file.",
+				 function );
+
+				goto on_error;
+			}
+			source_size  -= read_size;
+			buffer_offset = 0;
+			buffer_size   = read_size;
+		}
+		if( source_size == 0 )
+		{
+			flags |= DEFLATE_STREAM_FLAG_END_OF_INPUT;
+		}
+		compressed_data_size   = buffer_size - buffer_offset;
+		uncompressed_data_size = ZDECOMPRESS_STREAM_CHUNK_SIZE;
+
+		if( index != NULL )
+		{
+			result = deflate_index_decompress(
+			          index,
+			          stream,
+			          &( buffer[ buffer_offset ] ),
+			          &compressed_data_size,
+			          uncompressed_data,
+			          &uncompressed_data_size,
+			          flags,
+			          error );
+		}
+		else
+		{
+			result = deflate_stream_decompress(
+			          stream,
+			          &( buffer[ buffer_offset ] ),
+			          &compressed_data_size,
+			          uncompressed_data,
+			          &uncompressed_data_size,
+			          flags,
+			          error );
+		}
+
+		if( result == -1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_COMPRESSION,
+			 LIBCERROR_COMPRESSION_ERROR_DECOMPRESS_FAILED,
+			 "%s: unable to decompress data.",
+			 function );
+
+			goto on_error;
+		}
+		buffer_offset += compressed_data_size;
+
+		if( uncompressed_data_size > 0 )
+		{
+			write_count = assorted_output_file_write_data(
+				       destination_file,
+				       uncompressed_data,
+				       uncompressed_data_size,
+				       error );
+
+			if( write_count != (ssize_t) uncompressed_data_size )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_IO,
+				 LIBCERROR_IO_ERROR_WRITE_FAILED,
+				 "%s: unable to write to destination file.",
+				 function );
+
+				goto on_error;
+			}
+		}
+	}
+	memory_free(
+	 uncompressed_data );
+
+	if( deflate_stream_free(
+	     &stream,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+		 "%s: unable to free stream.",
+		 function );
+
+		return( -1 );
+	}
+	return( 1 );
+
+on_error:
+	if( uncompressed_data != NULL )
+	{
+		memory_free(
+		 uncompressed_data );
+	}
+	if( stream != NULL )
+	{
+		deflate_stream_free(
+		 &stream,
+		 NULL );
+	}
+	return( -1 );
+}
+
+/* Decompresses GZIP compressed data that consists of one or more members
+ * The uncompressed data of the members is concatenated, data after the last
+ * member that does not start with a member header, such as padding, is ignored
+ * Returns 1 if successful or -1 on error
+ */
+int zdecompress_gzip(
+     const uint8_t *compressed_data,
+     size_t compressed_data_size,
+     uint8_t *uncompressed_data,
+     size_t *uncompressed_data_size,
+     uint8_t ignore_checksum,
+     libcerror_error_t **error )
+{
+	gzip_decoder_t *decoder         = NULL;
+	static char *function           = "zdecompress_gzip";
+	size_t compressed_data_offset   = 0;
+	size_t member_size              = 0;
+	size_t member_uncompressed_size = 0;
+	size_t uncompressed_data_offset = 0;
+	uint8_t flags                   = 0;
+
+	if( compressed_data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid compressed data.",
+		 function );
+
+		return( -1 );
+	}
+	if( uncompressed_data_size == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid uncompressed data size.",
+		 function );
+
+		return( -1 );
+	}
+	if( ignore_checksum != 0 )
+	{
+		flags = GZIP_DECOMPRESS_FLAG_IGNORE_CHECKSUM;
+	}
+	if( gzip_decoder_initialize(
+	     &decoder,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create decoder.",
+		 function );
+
+		goto on_error;
+	}
+	while( compressed_data_offset < compressed_data_size )
+	{
+		if( ( compressed_data_offset > 0 )
+		 && ( gzip_check_signature(
+		       &( compressed_data[ compressed_data_offset ] ),
+		       compressed_data_size - compressed_data_offset ) == 0 ) )
+		{
+			if( libcnotify_verbose != 0 )
+			{
+				libcnotify_printf(
+				 "%s: ignoring %" PRIzd " bytes of trailing data.\n",
+				 function,
+				 compressed_data_size - compressed_data_offset );
+			}
+			break;
+		}
+		member_uncompressed_size = *uncompressed_data_size - uncompressed_data_offset;
+
+		if( gzip_decoder_decompress_member(
+		     decoder,
+		     &( compressed_data[ compressed_data_offset ] ),
+		     compressed_data_size - compressed_data_offset,
+		     &( uncompressed_data[ uncompressed_data_offset ] ),
+		     &member_uncompressed_size,
+		     &member_size,
+		     flags,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_COMPRESSION,
+			 LIBCERROR_COMPRESSION_ERROR_DECOMPRESS_FAILED,
+			 "%s: unable to decompress member at offset: %" PRIzd ".",
+			 function,
+			 compressed_data_offset );
+
+			goto on_error;
+		}
+		compressed_data_offset   += member_size;
+		uncompressed_data_offset += member_uncompressed_size;
+	}
+	if( gzip_decoder_free(
+	     &decoder,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+		 "%s: unable to free decoder.",
+		 function );
+
+		goto on_error;
+	}
+	*uncompressed_data_size = uncompressed_data_offset;
+
+	return( 1 );
+
+on_error:
+	if( decoder != NULL )
+	{
+		gzip_decoder_free(
+		 &decoder,
+		 NULL );
+	}
+	return( -1 );
+}
+
+/* Retrieves the members of BGZF compressed data
+ * Every BGZF member stores its size in the header and the size of its uncompressed
+ * data in the footer, hence the members and the offsets of their uncompressed data
+ * can be determined up front without decompressing them
+ * Returns 1 if successful, 0 if the data does not consist of BGZF members or -1 on error
+ */
+int zdecompress_get_bgzf_members(
+     const uint8_t *compressed_data,
+     size_t compressed_data_size,
+     zdecompress_bgzf_member_t **members,
+     int *number_of_members,
+     size_t *uncompressed_data_size,
+     libcerror_error_t **error )
+{
+	gzip_member_header_t member_header;
+
+	zdecompress_bgzf_member_t *reallocation = NULL;
+	static char *function                   = "zdecompress_get_bgzf_members";
+	size_t compressed_data_offset           = 0;
+	size_t uncompressed_data_offset         = 0;
+	uint32_t member_uncompressed_size       = 0;
+	uint32_t stored_crc32                   = 0;
+	int maximum_number_of_members           = 0;
+	int member_index                        = 0;
+	int result                              = 1;
+
+	if( compressed_data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid compressed data.",
+		 function );
+
+		return( -1 );
+	}
+	if( members == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid members.",
+		 function );
+
+		return( -1 );
+	}
+	if( *members != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid members value already set.",
+		 function );
+
+		return( -1 );
+	}
+	if( number_of_members == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid number of members.",
+		 function );
+
+		return( -1 );
+	}
+	if( uncompressed_data_size == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid uncompressed data size.",
+		 function );
+
+		return( -1 );
+	}
+	while( compressed_data_offset < compressed_data_size )
+	{
+		result = gzip_member_header_read_data(
+		          &member_header,
+		          &( compressed_data[ compressed_data_offset ] ),
+		          compressed_data_size - compressed_data_offset,
+		          error );
+
+		if( result == -1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_READ_FAILED,
+			 "%s: unable to read member header at offset: %" PRIzd ".",
+			 function,
+			 compressed_data_offset );
+
+			goto on_error;
+		}
+		/* Members without BGZF block size and trailing data are left to
+		 * the sequential decompression, which can locate them
+		 */
+		if( ( result == 0 )
+		 || ( member_header.bgzf_member_size < ( member_header.header_size + GZIP_MEMBER_FOOTER_SIZE ) )
+		 || ( member_header.bgzf_member_size > ( compressed_data_size - compressed_data_offset ) ) )
+		{
+			result = 0;
+
+			break;
+		}
+		if( member_index >= maximum_number_of_members )
+		{
+			if( maximum_number_of_members == 0 )
+			{
+				maximum_number_of_members = 1024;
+			}
+			else if( maximum_number_of_members < ( INT_MAX / 2 ) )
+			{
+				maximum_number_of_members *= 2;
+			}
+			else
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_VALUE_EXCEEDS_MAXIMUM,
+				 "%s: invalid number of members value exceeds maximum.",
+				 function );
+
+				goto on_error;
+			}
+			reallocation = (zdecompress_bgzf_member_t *) memory_reallocate(
+			                                              *members,
+			                                              sizeof( zdecompress_bgzf_member_t ) * maximum_number_of_members );
+
+			if( reallocation == NULL )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_MEMORY,
+				 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+				 "%s: unable to resize members.",
+				 function );
+
+				goto on_error;
+			}
+			*members = reallocation;
+		}
+		if( gzip_member_footer_read_data(
+		     &( compressed_data[ compressed_data_offset + member_header.bgzf_member_size - GZIP_MEMBER_FOOTER_SIZE ] ),
+		     GZIP_MEMBER_FOOTER_SIZE,
+		     &stored_crc32,
+		     &member_uncompressed_size,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_READ_FAILED,
+			 "%s: unable to read member footer at offset: %" PRIzd ".",
+			 function,
+			 compressed_data_offset );
+
+			goto on_error;
+		}
+		if( (size_t) member_uncompressed_size > ( (size_t) SSIZE_MAX - uncompressed_data_offset ) )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_VALUE_EXCEEDS_MAXIMUM,
+			 "%s: invalid uncompressed data size value exceeds maximum.",
+			 function );
+
+			goto on_error;
+		}
+		( *members )[ member_index ].compressed_offset   = compressed_data_offset;
+		( *members )[ member_index ].compressed_size     = member_header.bgzf_member_size;
+		( *members )[ member_index ].uncompressed_offset = uncompressed_data_offset;
+		( *members )[ member_index ].uncompressed_size   = (size_t) member_uncompressed_size;
+
+		compressed_data_offset   += member_header.bgzf_member_size;
+		uncompressed_data_offset += (size_t) member_uncompressed_size;
+
+		member_index++;
+	}
+	if( result == 0 )
+	{
+		if( *members != NULL )
+		{
+			memory_free(
+			 *members );
+
+			*members = NULL;
+		}
+		*number_of_members = 0;
+
+		return( 0 );
+	}
+	*number_of_members      = member_index;
+	*uncompressed_data_size = uncompressed_data_offset;
+
+	return( 1 );
+
+on_error:
+	if( *members != NULL )
+	{
+		memory_free(
+		 *members );
+
+		*members = NULL;
+	}
+	return( -1 );
+}
+
+/* Decompresses a range of BGZF members
+ * The uncompressed data of every member is written at the offset that was determined
+ * up front, hence ranges can be decompressed in any order
+ * Returns 1 if successful or -1 on error
+ */
+int zdecompress_bgzf_decompress_range(
+     const uint8_t *compressed_data,
+     zdecompress_bgzf_member_t *members,
+     int first_member_index,
+     int number_of_members,
+     uint8_t *uncompressed_data,
+     uint8_t ignore_checksum,
+     libcerror_error_t **error )
+{
+	gzip_decoder_t *decoder           = NULL;
+	zdecompress_bgzf_member_t *member = NULL;
+	static char *function             = "zdecompress_bgzf_decompress_range";
+	size_t member_size                = 0;
+	size_t member_uncompressed_size   = 0;
+	uint8_t flags                     = 0;
+	int member_index                  = 0;
+
+	if( compressed_data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid compressed data.",
+		 function );
+
+		return( -1 );
+	}
+	if( members == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid members.",
+		 function );
+
+		return( -1 );
+	}
+	if( ignore_checksum != 0 )
+	{
+		flags = GZIP_DECOMPRESS_FLAG_IGNORE_CHECKSUM;
+	}
+	if( gzip_decoder_initialize(
+	     &decoder,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create decoder.",
+		 function );
+
+		goto on_error;
+	}
+	for( member_index = first_member_index;
+	     member_index < ( first_member_index + number_of_members );
+	     member_index++ )
+	{
+		member = &( members[ member_index ] );
+
+		member_uncompressed_size = member->uncompressed_size;
+
+		if( gzip_decoder_decompress_member(
+		     decoder,
+		     &( compressed_data[ member->compressed_offset ] ),
+		     member->compressed_size,
+		     &( uncompressed_data[ member->uncompressed_offset ] ),
+		     &member_uncompressed_size,
+		     &member_size,
+		     flags,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_COMPRESSION,
+			 LIBCERROR_COMPRESSION_ERROR_DECOMPRESS_FAILED,
+			 "%s: unable to decompress member at offset: %" PRIzd ".",
+			 function,
+			 member->compressed_offset );
+
+			goto on_error;
+		}
+	}
+	if( gzip_decoder_free(
+	     &decoder,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+		 "%s: unable to free decoder.",
+		 function );
+
+		goto on_error;
+	}
+	return( 1 );
+
+on_error:
+	if( decoder != NULL )
+	{
+		gzip_decoder_free(
+		 &decoder,
+		 NULL );
+	}
+	return( -1 );
+}
+
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+
+typedef struct zdecompress_thread_range zdecompress_thread_range_t;
+
+struct zdecompress_thread_range
+{
+	/* The compressed data
+	 */
+	const uint8_t *compressed_data;
+
+	/* The BGZF members
+	 */
+	zdecompress_bgzf_member_t *members;
+
+	/* The index of the first member of the range
+	 */
+	int first_member_index;
+
+	/* The number of members of the range
+	 */
+	int number_of_members;
+
+	/* The uncompressed data
+	 */
+	uint8_t *uncompressed_data;
+
+	/* Value to indicate the CRC-32 should not be verified
+	 */
+	uint8_t ignore_checksum;
+
+	/* The result of the decompression
+	 */
+	int result;
+};
+
+/* Decompresses the BGZF members of a range, used as the task function of the worker pool
+ * Returns 1 if successful or -1 on error
+ */
+int zdecompress_thread_range_decompress(
+     void *arguments,
+     uint8_t *worker_buffer,
+     size_t worker_buffer_size )
+{
+	zdecompress_thread_range_t *thread_range = NULL;
+
+	( void ) worker_buffer;
+	( void ) worker_buffer_size;
+
+	if( arguments == NULL )
+	{
+		return( -1 );
+	}
+	thread_range = (zdecompress_thread_range_t *) arguments;
+
+	thread_range->result = zdecompress_bgzf_decompress_range(
+	                        thread_range->compressed_data,
+	                        thread_range->members,
+	                        thread_range->first_member_index,
+	                        thread_range->number_of_members,
+	                        thread_range->uncompressed_data,
+	                        thread_range->ignore_checksum,
+	                        NULL );
+
+	return( thread_range->result );
+}
+
+/* Decompresses BGZF members using the worker pool
+ * The members are split into consecutive ranges, which are decompressed in parallel
+ * directly into the uncompressed data at the offsets of their members
+ * Returns 1 if successful or -1 on error
+ */
+int zdecompress_bgzf_decompress_parallel(
+     const uint8_t *compressed_data,
+     zdecompress_bgzf_member_t *members,
+     int number_of_members,
+     uint8_t *uncompressed_data,
+     uint8_t ignore_checksum,
+     assorted_worker_pool_t *worker_pool,
+     libcerror_error_t **error )
+{
+	zdecompress_thread_range_t *thread_ranges = NULL;
+	static char *function                     = "zdecompress_bgzf_decompress_parallel";
+	int first_member_index                    = 0;
+	int number_of_ranges                      = 0;
+	int range_index                           = 0;
+	int result                                = 1;
+
+	if( worker_pool == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid worker pool.",
+		 function );
+
+		return( -1 );
+	}
+	/* Do not use more ranges than members
+	 */
+	number_of_ranges = worker_pool->number_of_workers * ZDECOMPRESS_BGZF_RANGES_PER_THREAD;
+
+	if( number_of_members < number_of_ranges )
+	{
+		number_of_ranges = number_of_members;
+	}
+	if( number_of_ranges <= 1 )
+	{
+		return( zdecompress_bgzf_decompress_range(
+		         compressed_data,
+		         members,
+		         0,
+		         number_of_members,
+		         uncompressed_data,
+		         ignore_checksum,
+		         error ) );
+	}
+	thread_ranges = (zdecompress_thread_range_t *) memory_allocate(
+	                                                sizeof( zdecompress_thread_range_t ) * number_of_ranges );
+
+	if( thread_ranges == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create thread ranges.",
+		 function );
+
+		return( -1 );
+	}
+	/* The ranges consist of consecutive members so that every worker
+	 * writes a contiguous part of the uncompressed data
+	 */
+	for( range_index = 0;
+	     range_index < number_of_ranges;
+	     range_index++ )
+	{
+		thread_ranges[ range_index ].compressed_data    = compressed_data;
+		thread_ranges[ range_index ].members            = members;
+		thread_ranges[ range_index ].first_member_index = first_member_index;
+		thread_ranges[ range_index ].number_of_members  = ( number_of_members / number_of_ranges )
+		                                                + (int) ( range_index < ( number_of_members % number_of_ranges ) );
+		thread_ranges[ range_index ].uncompressed_data  = uncompressed_data;
+		thread_ranges[ range_index ].ignore_checksum    = ignore_checksum;
+		thread_ranges[ range_index ].result             = 0;
+
+		first_member_index += thread_ranges[ range_index ].number_of_members;
+	}
+	for( range_index = 0;
+	     range_index < number_of_ranges;
+	     range_index++ )
+	{
+		if( assorted_worker_pool_push(
+		     worker_pool,
+		     zdecompress_thread_range_decompress,
+		     (void *) &( thread_ranges[ range_index ] ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+			 "%s: unable to push range: %d onto worker pool.",
+			 function,
+			 range_index );
+
+			result = -1;
+
+			break;
+		}
+	}
+	/* Wait for the ranges that were pushed, also on error, since they
+	 * reference the thread ranges
+	 */
+	if( assorted_worker_pool_wait(
+	     worker_pool,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to wait for worker pool.",
+		 function );
+
+		result = -1;
+	}
+	if( result == 1 )
+	{
+		for( range_index = 0;
+		     range_index < number_of_ranges;
+		     range_index++ )
+		{
+			if( thread_ranges[ range_index ].result != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_COMPRESSION,
+				 LIBCERROR_COMPRESSION_ERROR_DECOMPRESS_FAILED,
+				 "%s: unable to decompress members of range: %d.",
+				 function,
+				 range_index );
+
+				result = -1;
+
+				break;
+			}
+		}
+	}
+	memory_free(
+	 thread_ranges );
+
+	return( result );
+}
+
+typedef struct zdecompress_parallel_chunk zdecompress_parallel_chunk_t;
+
+struct zdecompress_parallel_chunk
+{
+	/* The compressed data
+	 */
+	const uint8_t *compressed_data;
+
+	/* The compressed data size
+	 */
+	size_t compressed_data_size;
+
+	/* The bit offset from which to search for the first block of the chunk
+	 */
+	uint64_t search_bit_offset;
+
+	/* The bit offset up to which to search for the first block of the chunk
+	 */
+	uint64_t maximum_search_bit_offset;
+
+	/* The bit offset of the first block of the chunk
+	 */
+	uint64_t block_bit_offset;
+
+	/* The symbolically decoded chunk
+	 */
+	deflate_parallel_chunk_t *chunk;
+
+	/* The maximum number of symbols of the chunk
+	 */
+	size_t maximum_number_of_symbols;
+
+	/* The uncompressed data
+	 */
+	uint8_t *uncompressed_data;
+
+	/* The uncompressed data size
+	 */
+	size_t uncompressed_data_size;
+
+	/* The offset of the chunk in the uncompressed data
+	 */
+	size_t uncompressed_offset;
+
+	/* The number of symbols at the start of the chunk that are resolved in parallel
+	 */
+	size_t number_of_head_symbols;
+
+	/* The result of the task
+	 */
+	int result;
+};
+
+/* Finds the first block of a chunk, used as the task function of the worker pool
+ * Returns 1 if successful or -1 on error
+ */
+int zdecompress_parallel_chunk_find_block(
+     void *arguments,
+     uint8_t *worker_buffer,
+     size_t worker_buffer_size )
+{
+	zdecompress_parallel_chunk_t *parallel_chunk = NULL;
+
+	( void ) worker_buffer;
+	( void ) worker_buffer_size;
+
+	if( arguments == NULL )
+	{
+		return( -1 );
+	}
+	parallel_chunk = (zdecompress_parallel_chunk_t *) arguments;
+
+	/* Not finding a block is not an error, the chunk is merged with the preceding chunk
+	 */
+	parallel_chunk->result = deflate_parallel_find_block(
+	                          parallel_chunk->compressed_data,
+	                          parallel_chunk->compressed_data_size,
+	                          parallel_chunk->search_bit_offset,
+	                          parallel_chunk->maximum_search_bit_offset,
+	                          &( parallel_chunk->block_bit_offset ),
+	                          NULL );
+
+	return( parallel_chunk->result == -1 ? -1 : 1 );
+}
+
+/* Decodes a chunk into symbols, used as the task function of the worker pool
+ * Returns 1 if successful or -1 on error
+ */
+int zdecompress_parallel_chunk_decode(
+     void *arguments,
+     uint8_t *worker_buffer,
+     size_t worker_buffer_size )
+{
+	zdecompress_parallel_chunk_t *parallel_chunk = NULL;
+
+	( void ) worker_buffer;
+	( void ) worker_buffer_size;
+
+	if( arguments == NULL )
+	{
+		return( -1 );
+	}
+	parallel_chunk = (zdecompress_parallel_chunk_t *) arguments;
+
+	/* A chunk that was started at a false block boundary fails to decode,
+	 * which is not an error of the worker pool
+	 */
+	parallel_chunk->result = deflate_parallel_chunk_decode(
+	                          parallel_chunk->chunk,
+	                          parallel_chunk->compressed_data,
+	                          parallel_chunk->compressed_data_size,
+	                          parallel_chunk->maximum_number_of_symbols,
+	                          NULL );
+
+	return( 1 );
+}
+
+/* Resolves the symbols at the start of a chunk, used as the task function of the worker pool
+ * Returns 1 if successful or -1 on error
+ */
+int zdecompress_parallel_chunk_resolve(
+     void *arguments,
+     uint8_t *worker_buffer,
+     size_t worker_buffer_size )
+{
+	zdecompress_parallel_chunk_t *parallel_chunk = NULL;
+
+	( void ) worker_buffer;
+	( void ) worker_buffer_size;
+
+	if( arguments == NULL )
+	{
+		return( -1 );
+	}
+	parallel_chunk = (zdecompress_parallel_chunk_t *) arguments;
+
+	parallel_chunk->result = deflate_parallel_chunk_resolve(
+	                          parallel_chunk->chunk,
+	                          0,
+	                          parallel_chunk->number_of_head_symbols,
+	                          parallel_chunk->uncompressed_data,
+	                          parallel_chunk->uncompressed_data_size,
+	                          parallel_chunk->uncompressed_offset,
+	                          NULL );
+
+	return( parallel_chunk->result );
+}
+
+/* Runs a task for every chunk using the worker pool
+ * Returns 1 if successful or -1 on error
+ */
+int zdecompress_parallel_chunks_run(
+     zdecompress_parallel_chunk_t *parallel_chunks,
+     int first_chunk_index,
+     int number_of_chunks,
+     assorted_worker_pool_task_function_t task_function,
+     assorted_worker_pool_t *worker_pool,
+     libcerror_error_t **error )
+{
+	static char *function = "zdecompress_parallel_chunks_run";
+	int chunk_index       = 0;
+	int result            = 1;
+
+	for( chunk_index = first_chunk_index;
+	     chunk_index < number_of_chunks;
+	     chunk_index++ )
+	{
+		if( assorted_worker_pool_push(
+		     worker_pool,
+		     task_function,
+		     (void *) &( parallel_chunks[ chunk_index ] ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+			 "%s: unable to push chunk: %d onto worker pool.",
+			 function,
+			 chunk_index );
+
+			result = -1;
+
+			break;
+		}
+	}
+	/* Wait for the chunks that were pushed, also on error, since they
+	 * reference the parallel chunks
+	 */
+	if( assorted_worker_pool_wait(
+	     worker_pool,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to wait for worker pool.",
+		 function );
+
+		result = -1;
+	}
+	return( result );
+}
+
+/* Speculatively decompresses a single zlib stream using the worker pool
+ * The compressed data is split into chunks, the first block of every chunk
+ * except the first is guessed by searching for a valid dynamic Huffman block
+ * Every chunk is decoded in parallel into symbols in which the back-references
+ * to the data of the preceding chunks are unresolved, these are resolved after
+ * the last 32 KiB of every chunk has been resolved in order
+ * A chunk of which the first block was guessed wrong is decoded again sequentially
+ * If uncompressed_data points to NULL the uncompressed data is allocated
+ * otherwise uncompressed_data_size contains the size of the uncompressed data,
+ * which limits the size of the decompressed data in both cases
+ * Returns 1 if successful, 0 if the stream could not be decompressed in parallel
+ * in which case it should be decompressed sequentially or -1 on error
+ */
+int zdecompress_deflate_parallel(
+     const uint8_t *compressed_data,
+     size_t compressed_data_size,
+     uint8_t **uncompressed_data,
+     size_t *uncompressed_data_size,
+     uint8_t flags,
+     assorted_worker_pool_t *worker_pool,
+     libcerror_error_t **error )
+{
+	zdecompress_parallel_chunk_t *parallel_chunks = NULL;
+	uint8_t *safe_uncompressed_data               = NULL;
+	static char *function                         = "zdecompress_deflate_parallel";
+	size_t chunk_size                             = 0;
+	size_t compressed_data_offset                 = 0;
+	size_t uncompressed_offset                    = 0;
+	uint64_t end_bit_offset                       = 0;
+	uint64_t stop_bit_offset                      = 0;
+	uint32_t calculated_checksum                  = 1;
+	uint32_t stored_checksum                      = 0;
+	int chunk_index                               = 0;
+	int next_chunk_index                          = 0;
+	int number_of_chunks                          = 0;
+	int number_of_found_chunks                    = 0;
+	int result                                    = 0;
+
+	if( compressed_data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid compressed data.",
+		 function );
+
+		return( -1 );
+	}
+	if( uncompressed_data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid uncompressed data.",
+		 function );
+
+		return( -1 );
+	}
+	if( uncompressed_data_size == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid uncompressed data size.",
+		 function );
+
+		return( -1 );
+	}
+	if( worker_pool == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid worker pool.",
+		 function );
+
+		return( -1 );
+	}
+	/* Streams with a preset dictionary are decompressed sequentially
+	 */
+	if( ( compressed_data_size < 6 )
+	 || ( ( compressed_data[ 0 ] & 0x0f ) != 8 )
+	 || ( ( compressed_data[ 1 ] & 0x20 ) != 0 ) )
+	{
+		return( 0 );
+	}
+	number_of_chunks = worker_pool->number_of_workers * ZDECOMPRESS_PARALLEL_CHUNKS_PER_THREAD;
+
+	if( (size_t) number_of_chunks > ( compressed_data_size / ZDECOMPRESS_PARALLEL_MINIMUM_CHUNK_SIZE ) )
+	{
+		number_of_chunks = (int) ( compressed_data_size / ZDECOMPRESS_PARALLEL_MINIMUM_CHUNK_SIZE );
+	}
+	if( number_of_chunks <= 1 )
+	{
+		return( 0 );
+	}
+	chunk_size = compressed_data_size / number_of_chunks;
+
+	parallel_chunks = (zdecompress_parallel_chunk_t *) memory_allocate(
+	                                                    sizeof( zdecompress_parallel_chunk_t ) * number_of_chunks );
+
+	if( parallel_chunks == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create parallel chunks.",
+		 function );
+
+		goto on_error;
+	}
+	if( memory_set(
+	     parallel_chunks,
+	     0,
+	     sizeof( zdecompress_parallel_chunk_t ) * number_of_chunks ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear parallel chunks.",
+		 function );
+
+		memory_free(
+		 parallel_chunks );
+
+		return( -1 );
+	}
+	for( chunk_index = 0;
+	     chunk_index < number_of_chunks;
+	     chunk_index++ )
+	{
+		parallel_chunks[ chunk_index ].compressed_data           = compressed_data;
+		parallel_chunks[ chunk_index ].compressed_data_size      = compressed_data_size;
+		parallel_chunks[ chunk_index ].search_bit_offset         = (uint64_t) chunk_size * chunk_index * 8;
+		parallel_chunks[ chunk_index ].maximum_search_bit_offset = (uint64_t) chunk_size * ( chunk_index + 1 ) * 8;
+		parallel_chunks[ chunk_index ].maximum_number_of_symbols = *uncompressed_data_size;
+	}
+	/* The first chunk starts directly after the zlib header
+	 */
+	parallel_chunks[ 0 ].block_bit_offset = 16;
+	parallel_chunks[ 0 ].result           = 1;
+
+	if( zdecompress_parallel_chunks_run(
+	     parallel_chunks,
+	     1,
+	     number_of_chunks,
+	     zdecompress_parallel_chunk_find_block,
+	     worker_pool,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GENERIC,
+		 "%s: unable to find blocks.",
+		 function );
+
+		goto on_error;
+	}
+	/* A chunk in which no block was found is merged with the preceding chunk
+	 */
+	for( chunk_index = 0;
+	     chunk_index < number_of_chunks;
+	     chunk_index++ )
+	{
+		if( parallel_chunks[ chunk_index ].result == 1 )
+		{
+			parallel_chunks[ number_of_found_chunks++ ] = parallel_chunks[ chunk_index ];
+		}
+	}
+	number_of_chunks = number_of_found_chunks;
+
+	if( number_of_chunks <= 1 )
+	{
+		memory_free(
+		 parallel_chunks );
+
+		return( 0 );
+	}
+	for( chunk_index = 0;
+	     chunk_index < number_of_chunks;
+	     chunk_index++ )
+	{
+		/* The last chunk is decoded up to the last block of the stream
+		 */
+		if( chunk_index < ( number_of_chunks - 1 ) )
+		{
+			stop_bit_offset = parallel_chunks[ chunk_index + 1 ].block_bit_offset;
+		}
+		else
+		{
+			stop_bit_offset = ( (uint64_t) compressed_data_size * 8 ) + 1;
+		}
+		if( deflate_parallel_chunk_initialize(
+		     &( parallel_chunks[ chunk_index ].chunk ),
+		     parallel_chunks[ chunk_index ].block_bit_offset,
+		     stop_bit_offset,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+			 "%s: unable to create chunk: %d.",
+			 function,
+			 chunk_index );
+
+			goto on_error;
+		}
+		parallel_chunks[ chunk_index ].result = 0;
+	}
+	if( zdecompress_parallel_chunks_run(
+	     parallel_chunks,
+	     0,
+	     number_of_chunks,
+	     zdecompress_parallel_chunk_decode,
+	     worker_pool,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GENERIC,
+		 "%s: unable to decode chunks.",
+		 function );
+
+		goto on_error;
+	}
+	/* A guessed block boundary is only correct if the preceding chunk ends
+	 * exactly where the chunk starts, since the first chunk starts at a true
+	 * block boundary, so does every chunk that passes this check
+	 * A chunk that was started at a false block boundary is decoded again from
+	 * where the preceding chunk ended and a chunk that is entirely covered by
+	 * the preceding chunk is removed
+	 */
+	result      = 1;
+	chunk_index = 0;
+
+	while( chunk_index < number_of_chunks )
+	{
+		if( ( parallel_chunks[ chunk_index ].result != 1 )
+		 || ( ( chunk_index == ( number_of_chunks - 1 ) )
+		  &&  ( parallel_chunks[ chunk_index ].chunk->last_block_flag == 0 ) ) )
+		{
+			result = 0;
+
+			break;
+		}
+		if( chunk_index == ( number_of_chunks - 1 ) )
+		{
+			break;
+		}
+		end_bit_offset = parallel_chunks[ chunk_index ].chunk->end_bit_offset;
+
+		if( parallel_chunks[ chunk_index ].chunk->last_block_flag != 0 )
+		{
+			for( next_chunk_index = chunk_index + 1;
+			     next_chunk_index < number_of_chunks;
+			     next_chunk_index++ )
+			{
+				deflate_parallel_chunk_free(
+				 &( parallel_chunks[ next_chunk_index ].chunk ),
+				 NULL );
+			}
+			number_of_chunks = chunk_index + 1;
+
+			break;
+		}
+		next_chunk_index = chunk_index + 1;
+
+		if( ( parallel_chunks[ next_chunk_index ].result == 1 )
+		 && ( parallel_chunks[ next_chunk_index ].block_bit_offset == end_bit_offset ) )
+		{
+			chunk_index++;
+
+			continue;
+		}
+		stop_bit_offset = parallel_chunks[ next_chunk_index ].chunk->stop_bit_offset;
+
+		if( deflate_parallel_chunk_free(
+		     &( parallel_chunks[ next_chunk_index ].chunk ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free chunk: %d.",
+			 function,
+			 next_chunk_index );
+
+			goto on_error;
+		}
+		if( end_bit_offset >= stop_bit_offset )
+		{
+			number_of_chunks--;
+
+			while( next_chunk_index < number_of_chunks )
+			{
+				parallel_chunks[ next_chunk_index ] = parallel_chunks[ next_chunk_index + 1 ];
+
+				next_chunk_index++;
+			}
+			/* The chunk is checked against its new next chunk
+			 */
+			continue;
+		}
+		if( deflate_parallel_chunk_initialize(
+		     &( parallel_chunks[ next_chunk_index ].chunk ),
+		     end_bit_offset,
+		     stop_bit_offset,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+			 "%s: unable to create chunk: %d.",
+			 function,
+			 next_chunk_index );
+
+			goto on_error;
+		}
+		parallel_chunks[ next_chunk_index ].block_bit_offset = end_bit_offset;
+
+		parallel_chunks[ next_chunk_index ].result = deflate_parallel_chunk_decode(
+		                                              parallel_chunks[ next_chunk_index ].chunk,
+		                                              compressed_data,
+		                                              compressed_data_size,
+		                                              parallel_chunks[ next_chunk_index ].maximum_number_of_symbols,
+		                                              NULL );
+
+		chunk_index++;
+	}
+	if( result != 0 )
+	{
+		for( chunk_index = 0;
+		     chunk_index < number_of_chunks;
+		     chunk_index++ )
+		{
+			parallel_chunks[ chunk_index ].uncompressed_offset = uncompressed_offset;
+
+			if( parallel_chunks[ chunk_index ].chunk->number_of_symbols > ( *uncompressed_data_size - uncompressed_offset ) )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+				 LIBCERROR_ARGUMENT_ERROR_VALUE_TOO_SMALL,
+				 "%s: invalid uncompressed data value too small.",
+				 function );
+
+				goto on_error;
+			}
+			uncompressed_offset += parallel_chunks[ chunk_index ].chunk->number_of_symbols;
+		}
+	}
+	if( result == 0 )
+	{
+		for( chunk_index = 0;
+		     chunk_index < number_of_chunks;
+		     chunk_index++ )
+		{
+			deflate_parallel_chunk_free(
+			 &( parallel_chunks[ chunk_index ].chunk ),
+			 NULL );
+		}
+		memory_free(
+		 parallel_chunks );
+
+		return( 0 );
+	}
+	safe_uncompressed_data = *uncompressed_data;
+
+	if( safe_uncompressed_data == NULL )
+	{
+		/* Allocate at least 1 byte for an empty stream
+		 */
+		safe_uncompressed_data = (uint8_t *) memory_allocate(
+		                                      sizeof( uint8_t ) * ( uncompressed_offset + 1 ) );
+
+		if( safe_uncompressed_data == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+			 "%s: unable to create uncompressed data.",
+			 function );
+
+			goto on_error;
+		}
+	}
+	/* The last 32 KiB of every chunk is resolved in order, after which
+	 * the window of every chunk is known and the remaining symbols of
+	 * the chunks are resolved in parallel
+	 */
+	for( chunk_index = 0;
+	     chunk_index < number_of_chunks;
+	     chunk_index++ )
+	{
+		parallel_chunks[ chunk_index ].uncompressed_data      = safe_uncompressed_data;
+		parallel_chunks[ chunk_index ].uncompressed_data_size = uncompressed_offset;
+		parallel_chunks[ chunk_index ].number_of_head_symbols = 0;
+
+		if( parallel_chunks[ chunk_index ].chunk->number_of_symbols > DEFLATE_PARALLEL_WINDOW_SIZE )
+		{
+			parallel_chunks[ chunk_index ].number_of_head_symbols = parallel_chunks[ chunk_index ].chunk->number_of_symbols
+			                                                      - DEFLATE_PARALLEL_WINDOW_SIZE;
+		}
+		if( deflate_parallel_chunk_resolve(
+		     parallel_chunks[ chunk_index ].chunk,
+		     parallel_chunks[ chunk_index ].number_of_head_symbols,
+		     parallel_chunks[ chunk_index ].chunk->number_of_symbols - parallel_chunks[ chunk_index ].number_of_head_symbols,
+		     safe_uncompressed_data,
+		     uncompressed_offset,
+		     parallel_chunks[ chunk_index ].uncompressed_offset,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GENERIC,
+			 "%s: unable to resolve end of chunk: %d.",
+			 function,
+			 chunk_index );
+
+			goto on_error;
+		}
+		parallel_chunks[ chunk_index ].result = 0;
+	}
+	if( zdecompress_parallel_chunks_run(
+	     parallel_chunks,
+	     0,
+	     number_of_chunks,
+	     zdecompress_parallel_chunk_resolve,
+	     worker_pool,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GENERIC,
+		 "%s: unable to resolve chunks.",
+		 function );
+
+		goto on_error;
+	}
+	for( chunk_index = 0;
+	     chunk_index < number_of_chunks;
+	     chunk_index++ )
+	{
+		if( parallel_chunks[ chunk_index ].result != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GENERIC,
+			 "%s: unable to resolve chunk: %d.",
+			 function,
+			 chunk_index );
+
+			goto on_error;
+		}
+	}
+	compressed_data_offset = (size_t) ( ( parallel_chunks[ number_of_chunks - 1 ].chunk->end_bit_offset + 7 ) / 8 );
+
+	if( ( ( flags & DEFLATE_DECOMPRESS_FLAG_IGNORE_CHECKSUM ) == 0 )
+	 && ( ( compressed_data_size - compressed_data_offset ) >= 4 ) )
+	{
+		if( deflate_calculate_adler32(
+		     &calculated_checksum,
+		     safe_uncompressed_data,
+		     uncompressed_offset,
+		     1,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to calculate checksum.",
+			 function );
+
+			goto on_error;
+		}
+		byte_stream_copy_to_uint32_big_endian(
+		 &( compressed_data[ compressed_data_offset ] ),
+		 stored_checksum );
+
+		if( stored_checksum != calculated_checksum )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_INPUT,
+			 LIBCERROR_INPUT_ERROR_CHECKSUM_MISMATCH,
+			 "%s: checksum does not match (stored: 0x%08" PRIx32 ", calculated: 0x%08" PRIx32 ").",
+			 function,
+			 stored_checksum,
+			 calculated_checksum );
+
+			goto on_error;
+		}
+	}
+	for( chunk_index = 0;
+	     chunk_index < number_of_chunks;
+	     chunk_index++ )
+	{
+		deflate_parallel_chunk_free(
+		 &( parallel_chunks[ chunk_index ].chunk ),
+		 NULL );
+	}
+	memory_free(
+	 parallel_chunks );
+
+	*uncompressed_data      = safe_uncompressed_data;
+	*uncompressed_data_size = uncompressed_offset;
+
+	return( 1 );
+
+on_error:
+	if( ( safe_uncompressed_data != NULL )
+	 && ( *uncompressed_data == NULL ) )
+	{
+		memory_free(
+		 safe_uncompressed_data );
+	}
+	if( parallel_chunks != NULL )
+	{
+		for( chunk_index = 0;
+		     chunk_index < number_of_chunks;
+		     chunk_index++ )
+		{
+			deflate_parallel_chunk_free(
+			 &( parallel_chunks[ chunk_index ].chunk ),
+			 NULL );
+		}
+		memory_free(
+		 parallel_chunks );
+	}
+	return( -1 );
+}
+
+#endif /* defined( HAVE_MULTI_THREAD_SUPPORT ) */
+
+/* Writes an index to a file
+ * Returns 1 if successful or -1 on error
+ */
+int zdecompress_write_index(
+     deflate_index_t *index,
+     const system_character_t *filename,
+     libcerror_error_t **error )
 {
-	if( stream == NULL )
+	assorted_output_file_t *index_file = NULL;
+	uint8_t *data                      = NULL;
+	static char *function              = "zdecompress_write_index";
+	size_t data_size                   = 0;
+	ssize_t write_count                = 0;
+
+	if( deflate_index_get_data_size(
+	     index,
+	     &data_size,
+	     error ) != 1 )
 	{
-		return;
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve index data size.",
+		 function );
+
+		goto on_error;
 	}
-	fprintf( stream, "Use zdecompress to decompress data as zlib compressed data.\n\n" );
+	data = (uint8_t *) memory_allocate(
+	                    sizeof( uint8_t ) * data_size );
 
-	fprintf( stream, "Usage: zdecompress [ -o offset ] [ -s size ] [ -12hvV ] source\n\n" );
+	if( data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create index data.",
+		 function );
 
-	fprintf( stream, "\tsource: the source file\n\n" );
+		goto on_error;
+	}
+	if( deflate_index_write_data(
+	     index,
+	     data,
+	     data_size,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to write index data.",
+		 function );
 
-	fprintf( stream, "\t-1:     use the zlib decompression method\n" );
-	fprintf( stream, "\t-2:     use the internal decompression method (default)\n" );
-	fprintf( stream, "\t-h:     shows this help\n" );
-	fprintf( stream, "\t-o:     data offset (default is 0)\n" );
-	fprintf( stream, "\t-s:     size of data (default is the file size)\n" );
-	fprintf( stream, "\t-v:     verbose output to stderr\n" );
-	fprintf( stream, "\t-V:     print version\n" );
-	fprintf( stream, "\n" );
+		goto on_error;
+	}
+	if( assorted_output_file_initialize(
+	     &index_file,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create index file.",
+		 function );
+
+		goto on_error;
+	}
+	if( assorted_output_file_open(
+	     index_file,
+	     filename,
+	     data_size,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_OPEN_FAILED,
+		 "%s: unable to open index file.",
+		 function );
+
+		goto on_error;
+	}
+	write_count = assorted_output_file_write_data(
+	               index_file,
+	               data,
+	               data_size,
+	               error );
+
+	if( write_count != (ssize_t) data_size )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_WRITE_FAILED,
+		 "%s: unable to write to index file.",
+		 function );
+
+		goto on_error;
+	}
+	if( assorted_output_file_close(
+	     index_file,
+	     error ) != 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_CLOSE_FAILED,
+		 "%s: unable to close index file.",
+		 function );
+
+		goto on_error;
+	}
+	if( assorted_output_file_free(
+	     &index_file,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+		 "%s: unable to free index file.",
+		 function );
+
+		goto on_error;
+	}
+	memory_free(
+	 data );
+
+	return( 1 );
+
+on_error:
+	if( index_file != NULL )
+	{
+		assorted_output_file_free(
+		 &index_file,
+		 NULL );
+	}
+	if( data != NULL )
+	{
+		memory_free(
+		 data );
+	}
+	return( -1 );
+}
+
+/* Reads an index from a file
+ * Returns 1 if successful or -1 on error
+ */
+int zdecompress_read_index(
+     deflate_index_t *index,
+     const system_character_t *filename,
+     libcerror_error_t **error )
+{
+	assorted_input_file_t *index_file = NULL;
+	uint8_t *data                     = NULL;
+	static char *function             = "zdecompress_read_index";
+	size64_t data_size                = 0;
+	ssize_t read_count                = 0;
+
+	if( assorted_input_file_initialize(
+	     &index_file,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create index file.",
+		 function );
+
+		goto on_error;
+	}
+	if( assorted_input_file_open(
+	     index_file,
+	     filename,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_OPEN_FAILED,
+		 "%s: unable to open index file.",
+		 function );
+
+		goto on_error;
+	}
+	if( assorted_input_file_get_size(
+	     index_file,
+	     &data_size,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve index file size.",
+		 function );
+
+		goto on_error;
+	}
+	if( data_size > (size64_t) SSIZE_MAX )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid index file size value exceeds maximum.",
+		 function );
+
+		goto on_error;
+	}
+	read_count = assorted_input_file_read_data(
+	              index_file,
+	              &data,
+	              (size_t) data_size,
+	              error );
+
+	if( read_count != (ssize_t) data_size )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_READ_FAILED,
+		 "%s: unable to read from index file.",
+		 function );
+
+		goto on_error;
+	}
+	if( deflate_index_read_data(
+	     index,
+	     data,
+	     (size_t) data_size,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to read index data.",
+		 function );
+
+		goto on_error;
+	}
+	if( assorted_input_file_close(
+	     index_file,
+	     error ) != 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_CLOSE_FAILED,
+		 "%s: unable to close index file.",
+		 function );
+
+		goto on_error;
+	}
+	if( assorted_input_file_free(
+	     &index_file,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+		 "%s: unable to free index file.",
+		 function );
+
+		goto on_error;
+	}
+	return( 1 );
+
+on_error:
+	if( index_file != NULL )
+	{
+		assorted_input_file_free(
+		 &index_file,
+		 NULL );
+	}
+	return( -1 );
 }
 
 /* The main program
@@ -74,25 +2065,43 @@ int wmain( int argc, wchar_t * const argv[] )
 int main( int argc, char * const argv[] )
 #endif
 {
-	char destination[ 128 ];
-
-	libcerror_error_t *error           = NULL;
-	libcfile_file_t *destination_file  = NULL;
-	libcfile_file_t *source_file       = NULL;
-	system_character_t *source         = NULL;
-	uint8_t *buffer                    = NULL;
-	uint8_t *uncompressed_data         = NULL;
-	char *program                      = "zdecompress";
-	system_integer_t option            = 0;
-	size64_t source_size               = 0;
-	size_t uncompressed_data_size      = 0;
-	ssize_t read_count                 = 0;
-	ssize_t write_count                = 0;
-	off_t source_offset                = 0;
-	int decompression_method           = 2;
-	int print_count                    = 0;
-	int result                         = 0;
-	int verbose                        = 0;
+	system_character_t destination[ 128 ];
+	system_character_t index_filename[ 128 ];
+
+	libcerror_error_t *error                     = NULL;
+	assorted_input_file_t *source_file           = NULL;
+	assorted_output_file_t *destination_file     = NULL;
+	deflate_index_t *index                       = NULL;
+	deflate_stream_t *stream                     = NULL;
+	zdecompress_bgzf_member_t *bgzf_members      = NULL;
+	system_character_t *option_statistics_format = NULL;
+	system_character_t *source                   = NULL;
+	uint8_t *buffer                              = NULL;
+	uint8_t *uncompressed_data                   = NULL;
+	char *program                                = "zdecompress";
+	system_integer_t option                      = 0;
+	size64_t index_interval                      = 0;
+	size64_t source_size                         = 0;
+	size64_t uncompressed_offset                 = 0;
+	size_t uncompressed_data_size                = 0;
+	size_t uncompressed_size                     = 0;
+	ssize_t read_count                           = 0;
+	ssize_t write_count                          = 0;
+	off_t source_offset                          = 0;
+	int decompression_method                     = 2;
+	uint8_t flags                                = 0;
+	int is_gzip                                  = 0;
+	int is_mapped                                = 0;
+	int number_of_bgzf_members                   = 0;
+	int number_of_threads                        = 1;
+	int parallel                                 = 0;
+	int print_count                              = 0;
+	int result                                   = 0;
+	int verbose                                  = 0;
+
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+	assorted_worker_pool_t *worker_pool          = NULL;
+#endif
 
 #if defined( HAVE_ZLIB ) || defined( ZLIB_DLL )
 	uLongf zlib_uncompressed_data_size = 0;
@@ -105,7 +2114,7 @@ int main( int argc, char * const argv[] )
 	while( ( option = assorted_getopt(
 	                   argc,
 	                   argv,
-	                   _SYSTEM_STRING( "12ho:s:vV" ) ) ) != (system_integer_t) -1 )
+	                   _SYSTEM_STRING( "123hi:l:no:ps:S:t:u:vV" ) ) ) != (system_integer_t) -1 )
 	{
 		switch( option )
 		{
@@ -131,19 +2140,59 @@ int main( int argc, char * const argv[] )
 
 				break;
 
+			case '3':
+				decompression_method = 3;
+
+				break;
+
 			case 'h':
 				usage_fprint(
 				 stdout );
 
 				return( EXIT_SUCCESS );
 
-			case 'o':
-				source_offset = atol( optarg );
+			case 'i':
+				index_interval = atol( optarg );
+
+				break;
+
+			case 'l':
+				uncompressed_size = atol( optarg );
+
+				break;
+
+			case 'n':
+				flags = DEFLATE_DECOMPRESS_FLAG_IGNORE_CHECKSUM;
+
+				break;
+
+			case 'o':
+				source_offset = atol( optarg );
+
+				break;
+
+			case 'p':
+				parallel = 1;
+
+				break;
+
+			case 's':
+				source_size = atol( optarg );
+
+				break;
+
+			case 'S':
+				option_statistics_format = optarg;
+
+				break;
+
+			case 't':
+				number_of_threads = (int) atol( optarg );
 
 				break;
 
-			case 's':
-				source_size = atol( optarg );
+			case 'u':
+				uncompressed_offset = atol( optarg );
 
 				break;
 
@@ -172,15 +2221,64 @@ int main( int argc, char * const argv[] )
 	}
 	source = argv[ optind ];
 
+	if( ( number_of_threads <= 0 )
+	 || ( number_of_threads > ZDECOMPRESS_MAXIMUM_NUMBER_OF_THREADS ) )
+	{
+		fprintf(
+		 stderr,
+		 "Unsupported number of threads, value must be between 1 and %d.\n",
+		 ZDECOMPRESS_MAXIMUM_NUMBER_OF_THREADS );
+
+		return( EXIT_FAILURE );
+	}
+#if !defined( HAVE_MULTI_THREAD_SUPPORT )
+	if( number_of_threads > 1 )
+	{
+		fprintf(
+		 stderr,
+		 "Multi-threading not supported, using a single thread.\n" );
+
+		number_of_threads = 1;
+	}
+	if( parallel != 0 )
+	{
+		fprintf(
+		 stderr,
+		 "Multi-threading not supported, decompressing sequentially.\n" );
+	}
+#endif
+	/* Building an index requires the streaming decompression method
+	 * and decompressing at an uncompressed offset the random-access method
+	 */
+	if( index_interval > 0 )
+	{
+		decompression_method = 3;
+	}
+	else if( uncompressed_size > 0 )
+	{
+		decompression_method = 4;
+	}
+
 	libcnotify_stream_set(
 	 stderr,
 	 NULL );
 	libcnotify_verbose_set(
 	 verbose );
 
+	if( assorted_output_statistics_initialize(
+	     option_statistics_format,
+	     &error ) != 1 )
+	{
+		fprintf(
+		 stderr,
+		 "Unable to initialize statistics.\n" );
+
+		goto on_error;
+	}
+
 	/* Open the source file
 	 */
-	if( libcfile_file_initialize(
+	if( assorted_input_file_initialize(
 	     &source_file,
 	     &error ) != 1 )
 	{
@@ -190,10 +2288,9 @@ int main( int argc, char * const argv[] )
 
 		goto on_error;
 	}
-	if( libcfile_file_open(
+	if( assorted_input_file_open(
 	     source_file,
 	     source,
-	     LIBCFILE_OPEN_READ,
 	     &error ) != 1 )
 	{
 		fprintf(
@@ -204,7 +2301,7 @@ int main( int argc, char * const argv[] )
 	}
 	if( source_size == 0 )
 	{
-		if( libcfile_file_get_size(
+		if( assorted_input_file_get_size(
 		     source_file,
 		     &source_size,
 		     &error ) == -1 )
@@ -224,7 +2321,8 @@ int main( int argc, char * const argv[] )
 
 		goto on_error;
 	}
-	if( source_size > (size64_t) SSIZE_MAX / 16 )
+	if( ( decompression_method != 3 )
+	 && ( source_size > (size64_t) SSIZE_MAX / 16 ) )
 	{
 		fprintf(
 		 stderr,
@@ -232,33 +2330,17 @@ int main( int argc, char * const argv[] )
 
 		goto on_error;
 	}
-	buffer = (uint8_t *) memory_allocate(
-	                      sizeof( uint8_t ) * source_size );
-
-	if( buffer == NULL )
+	if( decompression_method == 4 )
 	{
-		fprintf(
-		 stderr,
-		 "Unable to create buffer.\n" );
-
-		goto on_error;
+		uncompressed_data_size = uncompressed_size;
 	}
-	uncompressed_data_size = source_size * 16;
-
-	uncompressed_data = (uint8_t *) memory_allocate(
-	                                 sizeof( uint8_t ) * uncompressed_data_size );
-
-	if( uncompressed_data == NULL )
+	else if( decompression_method != 3 )
 	{
-		fprintf(
-		 stderr,
-		 "Unable to create uncompressed data buffer.\n" );
-
-		goto on_error;
+		uncompressed_data_size = source_size * 16;
 	}
 	/* Position the source file at the right offset
 	 */
-	if( libcfile_file_seek_offset(
+	if( assorted_input_file_seek_offset(
 	     source_file,
 	     source_offset,
 	     SEEK_SET,
@@ -270,10 +2352,10 @@ int main( int argc, char * const argv[] )
 
 		goto on_error;
 	}
-	print_count = narrow_string_snprintf(
+	print_count = system_string_sprintf(
 	               destination,
 	               128,
-	               "%s.zdecompressed",
+	               _SYSTEM_STRING( "%" PRIs_SYSTEM ".zdecompressed" ),
 	               source );
 
 	if( ( print_count < 0 )
@@ -285,22 +2367,132 @@ int main( int argc, char * const argv[] )
 
 		goto on_error;
 	}
+	print_count = system_string_sprintf(
+	               index_filename,
+	               128,
+	               _SYSTEM_STRING( "%" PRIs_SYSTEM ".zindex" ),
+	               source );
+
+	if( ( print_count < 0 )
+	 || ( print_count > 128 ) )
+	{
+		fprintf(
+		 stderr,
+		 "Unable to set index filename.\n" );
+
+		goto on_error;
+	}
 	/* Read and decompress the data
 	 */
-	read_count = libcfile_file_read_buffer(
-		      source_file,
-		      buffer,
-		      source_size,
-	              &error );
+	if( decompression_method != 3 )
+	{
+		read_count = assorted_input_file_read_data(
+		              source_file,
+		              &buffer,
+		              (size_t) source_size,
+		              &error );
+
+		if( read_count != (ssize_t) source_size )
+		{
+			fprintf(
+			 stderr,
+			 "Unable to read from source file.\n" );
+
+			goto on_error;
+		}
+	}
+	/* The internal decompression method also decompresses GZIP compressed data,
+	 * if it consists of BGZF members the size of the uncompressed data is known up front
+	 */
+	if( ( decompression_method == 2 )
+	 && ( gzip_check_signature(
+	       buffer,
+	       (size_t) source_size ) != 0 ) )
+	{
+		is_gzip = 1;
+
+		if( zdecompress_get_bgzf_members(
+		     buffer,
+		     (size_t) source_size,
+		     &bgzf_members,
+		     &number_of_bgzf_members,
+		     &uncompressed_data_size,
+		     &error ) == -1 )
+		{
+			fprintf(
+			 stderr,
+			 "Unable to determine BGZF members.\n" );
+
+			goto on_error;
+		}
+		/* The destination file cannot be opened with a maximum size of 0
+		 */
+		if( uncompressed_data_size == 0 )
+		{
+			uncompressed_data_size = 1;
+		}
+	}
+	/* Open the destination file, if it can be mapped the data is decompressed
+	 * directly into the destination file instead of an uncompressed data buffer
+	 * The internal decompression method resizes the uncompressed data buffer
+	 * while decompressing and the streaming decompression method writes the data buffered
+	 */
+	if( assorted_output_file_initialize(
+	     &destination_file,
+	     &error ) != 1 )
+	{
+		fprintf(
+		 stderr,
+		 "Unable to create destination file.\n" );
 
-	if( read_count != (ssize_t) source_size )
+		goto on_error;
+	}
+	if( assorted_output_file_open(
+	     destination_file,
+	     destination,
+	     uncompressed_data_size,
+	     &error ) != 1 )
 	{
 		fprintf(
 		 stderr,
-		 "Unable to read from source file.\n" );
+		 "Unable to open destination file.\n" );
 
 		goto on_error;
 	}
+	if( decompression_method != 3 )
+	{
+		is_mapped = assorted_output_file_get_mapped_data(
+		             destination_file,
+		             &uncompressed_data,
+		             &uncompressed_data_size,
+		             &error );
+
+		if( is_mapped == -1 )
+		{
+			fprintf(
+			 stderr,
+			 "Unable to retrieve mapped destination data.\n" );
+
+			goto on_error;
+		}
+		else if( ( is_mapped == 0 )
+		      && ( ( decompression_method == 1 )
+		       ||  ( decompression_method == 4 )
+		       ||  ( is_gzip != 0 ) ) )
+		{
+			uncompressed_data = (uint8_t *) memory_allocate(
+			                                 sizeof( uint8_t ) * uncompressed_data_size );
+
+			if( uncompressed_data == NULL )
+			{
+				fprintf(
+				 stderr,
+				 "Unable to create uncompressed data buffer.\n" );
+
+				goto on_error;
+			}
+		}
+	}
 	if( decompression_method == 1 )
 	{
 #if !defined( HAVE_ZLIB ) && !defined( ZLIB_DLL )
@@ -331,12 +2523,122 @@ int main( int argc, char * const argv[] )
 	}
 	else if( decompression_method == 2 )
 	{
-		if( deflate_decompress(
-		     buffer,
-		     source_size,
-		     uncompressed_data,
-		     &uncompressed_data_size,
-		     &error ) != 1 )
+		if( bgzf_members != NULL )
+		{
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+			if( number_of_threads > 1 )
+			{
+				if( assorted_worker_pool_initialize(
+				     &worker_pool,
+				     number_of_threads,
+				     0,
+				     ASSORTED_WORKER_POOL_FLAG_CPU_AFFINITY,
+				     &error ) != 1 )
+				{
+					fprintf(
+					 stderr,
+					 "Unable to create worker pool.\n" );
+
+					goto on_error;
+				}
+				result = zdecompress_bgzf_decompress_parallel(
+				          buffer,
+				          bgzf_members,
+				          number_of_bgzf_members,
+				          uncompressed_data,
+				          (uint8_t) ( flags != 0 ),
+				          worker_pool,
+				          &error );
+			}
+			else
+#endif
+			{
+				result = zdecompress_bgzf_decompress_range(
+				          buffer,
+				          bgzf_members,
+				          0,
+				          number_of_bgzf_members,
+				          uncompressed_data,
+				          (uint8_t) ( flags != 0 ),
+				          &error );
+			}
+			uncompressed_data_size = bgzf_members[ number_of_bgzf_members - 1 ].uncompressed_offset
+			                       + bgzf_members[ number_of_bgzf_members - 1 ].uncompressed_size;
+		}
+		else if( is_gzip != 0 )
+		{
+			result = zdecompress_gzip(
+			          buffer,
+			          (size_t) source_size,
+			          uncompressed_data,
+			          &uncompressed_data_size,
+			          (uint8_t) ( flags != 0 ),
+			          &error );
+		}
+		else
+		{
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+			if( ( parallel != 0 )
+			 && ( number_of_threads > 1 ) )
+			{
+				if( assorted_worker_pool_initialize(
+				     &worker_pool,
+				     number_of_threads,
+				     0,
+				     ASSORTED_WORKER_POOL_FLAG_CPU_AFFINITY,
+				     &error ) != 1 )
+				{
+					fprintf(
+					 stderr,
+					 "Unable to create worker pool.\n" );
+
+					goto on_error;
+				}
+				result = zdecompress_deflate_parallel(
+				          buffer,
+				          (size_t) source_size,
+				          &uncompressed_data,
+				          &uncompressed_data_size,
+				          flags,
+				          worker_pool,
+				          &error );
+
+				if( ( result == 0 )
+				 && ( verbose != 0 ) )
+				{
+					fprintf(
+					 stderr,
+					 "Unable to decompress data in parallel, decompressing sequentially.\n" );
+				}
+			}
+#endif
+			if( result == 0 )
+			{
+				if( is_mapped != 0 )
+				{
+					result = deflate_decompress_with_flags(
+					          buffer,
+					          source_size,
+					          uncompressed_data,
+					          &uncompressed_data_size,
+					          flags,
+					          &error );
+				}
+				else
+				{
+					uncompressed_data_size = 0;
+
+					result = deflate_decompress_allocate(
+					          buffer,
+					          source_size,
+					          &uncompressed_data,
+					          &uncompressed_data_size,
+					          flags,
+					          &error );
+				}
+			}
+		}
+		if( result != 1 )
 		{
 			fprintf(
 			 stderr,
@@ -344,48 +2646,138 @@ int main( int argc, char * const argv[] )
 
 			goto on_error;
 		}
+#if defined( HAVE_DEFLATE_STATISTICS )
+		if( deflate_statistics_fprint(
+		     stderr,
+		     &error ) != 1 )
+		{
+			fprintf(
+			 stderr,
+			 "Unable to print deflate statistics.\n" );
+
+			goto on_error;
+		}
+#endif
 	}
-	/* Open the destination file
-	 */
-	if( libcfile_file_initialize(
-	     &destination_file,
-	     &error ) != 1 )
+	else if( decompression_method == 4 )
 	{
-		fprintf(
-		 stderr,
-		 "Unable to create destination file.\n" );
+		if( deflate_index_initialize(
+		     &index,
+		     1,
+		     &error ) != 1 )
+		{
+			fprintf(
+			 stderr,
+			 "Unable to create index.\n" );
 
-		goto on_error;
+			goto on_error;
+		}
+		if( zdecompress_read_index(
+		     index,
+		     index_filename,
+		     &error ) != 1 )
+		{
+			fprintf(
+			 stderr,
+			 "Unable to read index.\n" );
+
+			goto on_error;
+		}
+		if( deflate_stream_initialize(
+		     &stream,
+		     &error ) != 1 )
+		{
+			fprintf(
+			 stderr,
+			 "Unable to create stream.\n" );
+
+			goto on_error;
+		}
+		read_count = deflate_index_decompress_at_offset(
+		              index,
+		              stream,
+		              buffer,
+		              (size_t) source_size,
+		              (uint64_t) uncompressed_offset,
+		              uncompressed_data,
+		              uncompressed_data_size,
+		              &error );
+
+		if( read_count == -1 )
+		{
+			fprintf(
+			 stderr,
+			 "Unable to decompress data.\n" );
+
+			goto on_error;
+		}
+		uncompressed_data_size = (size_t) read_count;
 	}
-	if( libcfile_file_open(
-	     destination_file,
-	     destination,
-	     LIBCFILE_OPEN_WRITE,
-	     &error ) != 1 )
+	if( decompression_method == 3 )
 	{
-		fprintf(
-		 stderr,
-		 "Unable to open destination file.\n" );
+		if( index_interval > 0 )
+		{
+			if( deflate_index_initialize(
+			     &index,
+			     (uint64_t) index_interval,
+			     &error ) != 1 )
+			{
+				fprintf(
+				 stderr,
+				 "Unable to create index.\n" );
 
-		goto on_error;
-	}
-	write_count = libcfile_file_write_buffer(
-		       destination_file,
-		       uncompressed_data,
-		       uncompressed_data_size,
-		       &error );
+				goto on_error;
+			}
+		}
+		if( zdecompress_stream(
+		     source_file,
+		     source_size,
+		     destination_file,
+		     index,
+		     (uint8_t) ( flags != 0 ),
+		     &error ) != 1 )
+		{
+			fprintf(
+			 stderr,
+			 "Unable to decompress data.\n" );
 
-	if( write_count != (ssize_t) uncompressed_data_size )
+			goto on_error;
+		}
+		if( index != NULL )
+		{
+			if( zdecompress_write_index(
+			     index,
+			     index_filename,
+			     &error ) != 1 )
+			{
+				fprintf(
+				 stderr,
+				 "Unable to write index.\n" );
+
+				goto on_error;
+			}
+		}
+	}
+	else
 	{
-		fprintf(
-		 stderr,
-		 "Unable to write to destination file.\n" );
+		write_count = assorted_output_file_write_data(
+			       destination_file,
+			       uncompressed_data,
+			       uncompressed_data_size,
+			       &error );
 
-		goto on_error;
+		if( write_count != (ssize_t) uncompressed_data_size )
+		{
+			fprintf(
+			 stderr,
+			 "Unable to write to destination file.\n" );
+
+			goto on_error;
+		}
 	}
 	/* Clean up
 	 */
-	if( libcfile_file_close(
+	if( assorted_output_file_close(
 	     destination_file,
 	     &error ) != 0 )
 	{
@@ -395,7 +2787,7 @@ int main( int argc, char * const argv[] )
 
 		goto on_error;
 	}
-	if( libcfile_file_free(
+	if( assorted_output_file_free(
 	     &destination_file,
 	     &error ) != 1 )
 	{
@@ -405,7 +2797,7 @@ int main( int argc, char * const argv[] )
 
 		goto on_error;
 	}
-	if( libcfile_file_close(
+	if( assorted_input_file_close(
 	     source_file,
 	     &error ) != 0 )
 	{
@@ -415,7 +2807,7 @@ int main( int argc, char * const argv[] )
 
 		goto on_error;
 	}
-	if( libcfile_file_free(
+	if( assorted_input_file_free(
 	     &source_file,
 	     &error ) != 1 )
 	{
@@ -425,12 +2817,60 @@ int main( int argc, char * const argv[] )
 
 		goto on_error;
 	}
-	memory_free(
-	 uncompressed_data );
+	if( ( uncompressed_data != NULL )
+	 && ( is_mapped == 0 ) )
+	{
+		memory_free(
+		 uncompressed_data );
+	}
+	if( stream != NULL )
+	{
+		if( deflate_stream_free(
+		     &stream,
+		     &error ) != 1 )
+		{
+			fprintf(
+			 stderr,
+			 "Unable to free stream.\n" );
 
-	memory_free(
-	 buffer );
+			goto on_error;
+		}
+	}
+	if( index != NULL )
+	{
+		if( deflate_index_free(
+		     &index,
+		     &error ) != 1 )
+		{
+			fprintf(
+			 stderr,
+			 "Unable to free index.\n" );
+
+			goto on_error;
+		}
+	}
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+	if( worker_pool != NULL )
+	{
+		if( assorted_worker_pool_free(
+		     &worker_pool,
+		     &error ) != 1 )
+		{
+			fprintf(
+			 stderr,
+			 "Unable to free worker pool.\n" );
+
+			goto on_error;
+		}
+	}
+#endif
+	if( bgzf_members != NULL )
+	{
+		memory_free(
+		 bgzf_members );
 
+		bgzf_members = NULL;
+	}
 	if( result == -1 )
 	{
 		fprintf(
@@ -443,6 +2883,14 @@ int main( int argc, char * const argv[] )
 	 stdout,
 	 "Z decompression:\tSUCCESS\n" );
 
+	assorted_output_statistics_fprint(
+	 stderr,
+	 program,
+	 1,
+	 NULL );
+	assorted_output_statistics_free(
+	 NULL );
+
 	return( EXIT_SUCCESS );
 
 on_error:
@@ -453,25 +2901,53 @@ on_error:
 		libcerror_error_free(
 		 &error );
 	}
+	assorted_output_statistics_fprint(
+	 stderr,
+	 program,
+	 -1,
+	 NULL );
+	assorted_output_statistics_free(
+	 NULL );
 	if( destination_file != NULL )
 	{
-		libcfile_file_free(
+		assorted_output_file_free(
 		 &destination_file,
 		 NULL );
 	}
-	if( uncompressed_data != NULL )
+	if( ( uncompressed_data != NULL )
+	 && ( is_mapped == 0 ) )
 	{
 		memory_free(
 		 uncompressed_data );
 	}
-	if( buffer != NULL )
+	if( stream != NULL )
+	{
+		deflate_stream_free(
+		 &stream,
+		 NULL );
+	}
+	if( index != NULL )
+	{
+		deflate_index_free(
+		 &index,
+		 NULL );
+	}
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+	if( worker_pool != NULL )
+	{
+		assorted_worker_pool_free(
+		 &worker_pool,
+		 NULL );
+	}
+#endif
+	if( bgzf_members != NULL )
 	{
 		memory_free(
-		 buffer );
+		 bgzf_members );
 	}
 	if( source_file != NULL )
 	{
-		libcfile_file_free(
+		assorted_input_file_free(
 		 &source_file,
 		 NULL );
 	}
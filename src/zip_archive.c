@@ -0,0 +1,903 @@
+/*
+ * ZIP archive functions
+ *
+ * Copyright (C) 2008-2019, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This software is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This software is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this software.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <byte_stream.h>
+#include <memory.h>
+#include <types.h>
+
+#include "assorted_libcerror.h"
+#include "crc32.h"
+#include "deflate_stream.h"
+#include "zip_archive.h"
+
+/* The identifier of the ZIP64 extended information extra field
+ */
+#define ZIP_ARCHIVE_ZIP64_EXTRA_FIELD_IDENTIFIER	0x0001
+
+/* Reads the end of central directory record
+ * The data contains the end of the archive, where data offset is the offset of the data in the archive
+ * If the archive contains a ZIP64 end of central directory record it must be contained in the data
+ * Returns 1 if successful, 0 if no end of central directory record was found or -1 on error
+ */
+int zip_archive_read_end_of_central_directory(
+     zip_archive_directory_t *directory,
+     const uint8_t *data,
+     size_t data_size,
+     uint64_t data_offset,
+     libcerror_error_t **error )
+{
+	static char *function                  = "zip_archive_read_end_of_central_directory";
+	size_t record_offset                   = 0;
+	uint64_t zip64_record_offset           = 0;
+	uint32_t central_directory_offset      = 0;
+	uint32_t central_directory_size        = 0;
+	uint32_t disk_number                   = 0;
+	uint32_t central_directory_disk_number = 0;
+	uint16_t comment_size                  = 0;
+	uint16_t number_of_members             = 0;
+	int has_record                         = 0;
+
+	if( directory == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid directory.",
+		 function );
+
+		return( -1 );
+	}
+	if( data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid data.",
+		 function );
+
+		return( -1 );
+	}
+	if( data_size > (size_t) SSIZE_MAX )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid data size value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	if( data_size < ZIP_ARCHIVE_END_OF_CENTRAL_DIRECTORY_SIZE )
+	{
+		return( 0 );
+	}
+	/* The record is searched for backwards since the comment can contain the signature
+	 */
+	record_offset = data_size - ZIP_ARCHIVE_END_OF_CENTRAL_DIRECTORY_SIZE + 1;
+
+	while( record_offset > 0 )
+	{
+		record_offset--;
+
+		if( ( data[ record_offset ] == 'P' )
+		 && ( data[ record_offset + 1 ] == 'K' )
+		 && ( data[ record_offset + 2 ] == 0x05 )
+		 && ( data[ record_offset + 3 ] == 0x06 ) )
+		{
+			byte_stream_copy_to_uint16_little_endian(
+			 &( data[ record_offset + 20 ] ),
+			 comment_size );
+
+			if( (size_t) comment_size <= ( data_size - record_offset - ZIP_ARCHIVE_END_OF_CENTRAL_DIRECTORY_SIZE ) )
+			{
+				has_record = 1;
+
+				break;
+			}
+		}
+	}
+	if( has_record == 0 )
+	{
+		return( 0 );
+	}
+	byte_stream_copy_to_uint16_little_endian(
+	 &( data[ record_offset + 4 ] ),
+	 disk_number );
+
+	byte_stream_copy_to_uint16_little_endian(
+	 &( data[ record_offset + 6 ] ),
+	 central_directory_disk_number );
+
+	byte_stream_copy_to_uint16_little_endian(
+	 &( data[ record_offset + 10 ] ),
+	 number_of_members );
+
+	byte_stream_copy_to_uint32_little_endian(
+	 &( data[ record_offset + 12 ] ),
+	 central_directory_size );
+
+	byte_stream_copy_to_uint32_little_endian(
+	 &( data[ record_offset + 16 ] ),
+	 central_directory_offset );
+
+	directory->offset            = central_directory_offset;
+	directory->size              = central_directory_size;
+	directory->number_of_members = number_of_members;
+
+	/* The ZIP64 end of central directory locator precedes the end of central directory record
+	 */
+	if( ( record_offset >= ZIP_ARCHIVE_ZIP64_END_OF_CENTRAL_DIRECTORY_LOCATOR_SIZE )
+	 && ( data[ record_offset - 20 ] == 'P' )
+	 && ( data[ record_offset - 19 ] == 'K' )
+	 && ( data[ record_offset - 18 ] == 0x06 )
+	 && ( data[ record_offset - 17 ] == 0x07 ) )
+	{
+		record_offset -= ZIP_ARCHIVE_ZIP64_END_OF_CENTRAL_DIRECTORY_LOCATOR_SIZE;
+
+		byte_stream_copy_to_uint64_little_endian(
+		 &( data[ record_offset + 8 ] ),
+		 zip64_record_offset );
+
+		if( ( record_offset < ZIP_ARCHIVE_ZIP64_END_OF_CENTRAL_DIRECTORY_SIZE )
+		 || ( zip64_record_offset < data_offset )
+		 || ( ( zip64_record_offset - data_offset ) > ( record_offset - ZIP_ARCHIVE_ZIP64_END_OF_CENTRAL_DIRECTORY_SIZE ) ) )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_UNSUPPORTED_VALUE,
+			 "%s: unsupported ZIP64 end of central directory record offset: %" PRIu64 ".",
+			 function,
+			 zip64_record_offset );
+
+			return( -1 );
+		}
+		record_offset = (size_t) ( zip64_record_offset - data_offset );
+
+		if( ( data[ record_offset ] != 'P' )
+		 || ( data[ record_offset + 1 ] != 'K' )
+		 || ( data[ record_offset + 2 ] != 0x06 )
+		 || ( data[ record_offset + 3 ] != 0x06 ) )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_UNSUPPORTED_VALUE,
+			 "%s: unsupported ZIP64 end of central directory record signature.",
+			 function );
+
+			return( -1 );
+		}
+		byte_stream_copy_to_uint32_little_endian(
+		 &( data[ record_offset + 16 ] ),
+		 disk_number );
+
+		byte_stream_copy_to_uint32_little_endian(
+		 &( data[ record_offset + 20 ] ),
+		 central_directory_disk_number );
+
+		byte_stream_copy_to_uint64_little_endian(
+		 &( data[ record_offset + 32 ] ),
+		 directory->number_of_members );
+
+		byte_stream_copy_to_uint64_little_endian(
+		 &( data[ record_offset + 40 ] ),
+		 directory->size );
+
+		byte_stream_copy_to_uint64_little_endian(
+		 &( data[ record_offset + 48 ] ),
+		 directory->offset );
+	}
+	if( ( disk_number != 0 )
+	 || ( central_directory_disk_number != 0 ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_UNSUPPORTED_VALUE,
+		 "%s: unsupported multi-disk archive.",
+		 function );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Reads a central directory entry
+ * The sizes and offset of the ZIP64 extended information extra field replace those of the entry
+ * The name of the member references the data
+ * Returns 1 if successful or -1 on error
+ */
+int zip_archive_member_read_central_directory_entry(
+     zip_archive_member_t *member,
+     const uint8_t *data,
+     size_t data_size,
+     size_t *entry_size,
+     libcerror_error_t **error )
+{
+	const uint8_t *extra_field        = NULL;
+	static char *function             = "zip_archive_member_read_central_directory_entry";
+	size_t extra_field_offset         = 0;
+	size_t zip64_field_offset         = 0;
+	uint32_t compressed_size          = 0;
+	uint32_t local_file_header_offset = 0;
+	uint32_t uncompressed_size        = 0;
+	uint16_t comment_size             = 0;
+	uint16_t extra_field_data_size    = 0;
+	uint16_t extra_field_identifier   = 0;
+	uint16_t extra_field_size         = 0;
+
+	if( member == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid member.",
+		 function );
+
+		return( -1 );
+	}
+	if( data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid data.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( data_size < ZIP_ARCHIVE_CENTRAL_DIRECTORY_ENTRY_SIZE )
+	 || ( data_size > (size_t) SSIZE_MAX ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid data size value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( entry_size == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid entry size.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( data[ 0 ] != 'P' )
+	 || ( data[ 1 ] != 'K' )
+	 || ( data[ 2 ] != 0x01 )
+	 || ( data[ 3 ] != 0x02 ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_UNSUPPORTED_VALUE,
+		 "%s: unsupported central directory entry signature.",
+		 function );
+
+		return( -1 );
+	}
+	byte_stream_copy_to_uint16_little_endian(
+	 &( data[ 8 ] ),
+	 member->flags );
+
+	byte_stream_copy_to_uint16_little_endian(
+	 &( data[ 10 ] ),
+	 member->compression_method );
+
+	byte_stream_copy_to_uint32_little_endian(
+	 &( data[ 16 ] ),
+	 member->crc32 );
+
+	byte_stream_copy_to_uint32_little_endian(
+	 &( data[ 20 ] ),
+	 compressed_size );
+
+	byte_stream_copy_to_uint32_little_endian(
+	 &( data[ 24 ] ),
+	 uncompressed_size );
+
+	byte_stream_copy_to_uint16_little_endian(
+	 &( data[ 28 ] ),
+	 member->name_size );
+
+	byte_stream_copy_to_uint16_little_endian(
+	 &( data[ 30 ] ),
+	 extra_field_size );
+
+	byte_stream_copy_to_uint16_little_endian(
+	 &( data[ 32 ] ),
+	 comment_size );
+
+	byte_stream_copy_to_uint32_little_endian(
+	 &( data[ 42 ] ),
+	 local_file_header_offset );
+
+	*entry_size = ZIP_ARCHIVE_CENTRAL_DIRECTORY_ENTRY_SIZE
+	            + (size_t) member->name_size
+	            + (size_t) extra_field_size
+	            + (size_t) comment_size;
+
+	if( *entry_size > data_size )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid entry size value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	member->name                     = &( data[ ZIP_ARCHIVE_CENTRAL_DIRECTORY_ENTRY_SIZE ] );
+	member->compressed_size          = compressed_size;
+	member->uncompressed_size        = uncompressed_size;
+	member->local_file_header_offset = local_file_header_offset;
+
+	extra_field = &( data[ ZIP_ARCHIVE_CENTRAL_DIRECTORY_ENTRY_SIZE + member->name_size ] );
+
+	while( ( extra_field_offset + 4 ) <= (size_t) extra_field_size )
+	{
+		byte_stream_copy_to_uint16_little_endian(
+		 &( extra_field[ extra_field_offset ] ),
+		 extra_field_identifier );
+
+		byte_stream_copy_to_uint16_little_endian(
+		 &( extra_field[ extra_field_offset + 2 ] ),
+		 extra_field_data_size );
+
+		extra_field_offset += 4;
+
+		if( (size_t) extra_field_data_size > ( (size_t) extra_field_size - extra_field_offset ) )
+		{
+			break;
+		}
+		if( extra_field_identifier == ZIP_ARCHIVE_ZIP64_EXTRA_FIELD_IDENTIFIER )
+		{
+			/* The ZIP64 extended information only contains the values
+			 * that do not fit in the entry, in the order of the entry
+			 */
+			zip64_field_offset = extra_field_offset;
+
+			if( ( uncompressed_size == 0xffffffffUL )
+			 && ( ( zip64_field_offset + 8 ) <= ( extra_field_offset + extra_field_data_size ) ) )
+			{
+				byte_stream_copy_to_uint64_little_endian(
+				 &( extra_field[ zip64_field_offset ] ),
+				 member->uncompressed_size );
+
+				zip64_field_offset += 8;
+			}
+			if( ( compressed_size == 0xffffffffUL )
+			 && ( ( zip64_field_offset + 8 ) <= ( extra_field_offset + extra_field_data_size ) ) )
+			{
+				byte_stream_copy_to_uint64_little_endian(
+				 &( extra_field[ zip64_field_offset ] ),
+				 member->compressed_size );
+
+				zip64_field_offset += 8;
+			}
+			if( ( local_file_header_offset == 0xffffffffUL )
+			 && ( ( zip64_field_offset + 8 ) <= ( extra_field_offset + extra_field_data_size ) ) )
+			{
+				byte_stream_copy_to_uint64_little_endian(
+				 &( extra_field[ zip64_field_offset ] ),
+				 member->local_file_header_offset );
+			}
+			break;
+		}
+		extra_field_offset += extra_field_data_size;
+	}
+	return( 1 );
+}
+
+/* Determines the size of a local file header including the filename and extra field
+ * The data of the member follows the local file header
+ * Returns 1 if successful or -1 on error
+ */
+int zip_archive_get_local_file_header_size(
+     const uint8_t *data,
+     size_t data_size,
+     size_t *header_size,
+     libcerror_error_t **error )
+{
+	static char *function     = "zip_archive_get_local_file_header_size";
+	uint16_t extra_field_size = 0;
+	uint16_t name_size        = 0;
+
+	if( data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid data.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( data_size < ZIP_ARCHIVE_LOCAL_FILE_HEADER_SIZE )
+	 || ( data_size > (size_t) SSIZE_MAX ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid data size value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( header_size == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid header size.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( data[ 0 ] != 'P' )
+	 || ( data[ 1 ] != 'K' )
+	 || ( data[ 2 ] != 0x03 )
+	 || ( data[ 3 ] != 0x04 ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_UNSUPPORTED_VALUE,
+		 "%s: unsupported local file header signature.",
+		 function );
+
+		return( -1 );
+	}
+	byte_stream_copy_to_uint16_little_endian(
+	 &( data[ 26 ] ),
+	 name_size );
+
+	byte_stream_copy_to_uint16_little_endian(
+	 &( data[ 28 ] ),
+	 extra_field_size );
+
+	*header_size = ZIP_ARCHIVE_LOCAL_FILE_HEADER_SIZE
+	             + (size_t) name_size
+	             + (size_t) extra_field_size;
+
+	return( 1 );
+}
+
+/* Creates a verifier
+ * Make sure the value verifier is referencing, is set to NULL
+ * Returns 1 if successful or -1 on error
+ */
+int zip_archive_verifier_initialize(
+     zip_archive_verifier_t **verifier,
+     libcerror_error_t **error )
+{
+	static char *function = "zip_archive_verifier_initialize";
+
+	if( verifier == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid verifier.",
+		 function );
+
+		return( -1 );
+	}
+	if( *verifier != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid verifier value already set.",
+		 function );
+
+		return( -1 );
+	}
+	*verifier = memory_allocate_structure(
+	             zip_archive_verifier_t );
+
+	if( *verifier == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create verifier.",
+		 function );
+
+		goto on_error;
+	}
+	( *verifier )->stream = NULL;
+	( *verifier )->member = NULL;
+
+	if( deflate_stream_initialize(
+	     &( ( *verifier )->stream ),
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create stream.",
+		 function );
+
+		goto on_error;
+	}
+	return( 1 );
+
+on_error:
+	if( *verifier != NULL )
+	{
+		memory_free(
+		 *verifier );
+
+		*verifier = NULL;
+	}
+	return( -1 );
+}
+
+/* Frees a verifier
+ * Returns 1 if successful or -1 on error
+ */
+int zip_archive_verifier_free(
+     zip_archive_verifier_t **verifier,
+     libcerror_error_t **error )
+{
+	static char *function = "zip_archive_verifier_free";
+	int result            = 1;
+
+	if( verifier == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid verifier.",
+		 function );
+
+		return( -1 );
+	}
+	if( *verifier != NULL )
+	{
+		if( deflate_stream_free(
+		     &( ( *verifier )->stream ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free stream.",
+			 function );
+
+			result = -1;
+		}
+		memory_free(
+		 *verifier );
+
+		*verifier = NULL;
+	}
+	return( result );
+}
+
+/* Starts the verification of a member
+ * The member must remain available until the verification is finished
+ * Returns 1 if successful, 0 if the member is encrypted or its compression method is not supported or -1 on error
+ */
+int zip_archive_verifier_start(
+     zip_archive_verifier_t *verifier,
+     const zip_archive_member_t *member,
+     libcerror_error_t **error )
+{
+	static char *function = "zip_archive_verifier_start";
+
+	if( verifier == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid verifier.",
+		 function );
+
+		return( -1 );
+	}
+	if( member == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid member.",
+		 function );
+
+		return( -1 );
+	}
+	verifier->member = NULL;
+
+	if( ( member->flags & ZIP_ARCHIVE_FLAG_ENCRYPTED ) != 0 )
+	{
+		return( 0 );
+	}
+	if( ( member->compression_method != ZIP_ARCHIVE_COMPRESSION_METHOD_STORED )
+	 && ( member->compression_method != ZIP_ARCHIVE_COMPRESSION_METHOD_DEFLATE ) )
+	{
+		return( 0 );
+	}
+	if( member->compression_method == ZIP_ARCHIVE_COMPRESSION_METHOD_DEFLATE )
+	{
+		if( deflate_stream_reset(
+		     verifier->stream,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to reset stream.",
+			 function );
+
+			return( -1 );
+		}
+	}
+	verifier->member                    = member;
+	verifier->remaining_compressed_size = member->compressed_size;
+	verifier->uncompressed_size         = 0;
+	verifier->calculated_crc32          = 0;
+	verifier->end_of_stream             = 0;
+
+	return( 1 );
+}
+
+/* Adds compressed data of the member to the verification
+ * Deflate compressed data is decompressed in parts of the size of the uncompressed data buffer
+ * and the CRC-32 of every part is calculated directly after it was decompressed
+ * Returns 1 if successful or -1 on error
+ */
+int zip_archive_verifier_update(
+     zip_archive_verifier_t *verifier,
+     const uint8_t *compressed_data,
+     size_t compressed_data_size,
+     libcerror_error_t **error )
+{
+	static char *function         = "zip_archive_verifier_update";
+	size_t compressed_data_offset = 0;
+	size_t stream_compressed_size = 0;
+	size_t uncompressed_data_size = 0;
+	uint8_t stream_flags          = DEFLATE_STREAM_FLAG_RAW;
+	int result                    = 0;
+
+	if( verifier == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid verifier.",
+		 function );
+
+		return( -1 );
+	}
+	if( verifier->member == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid verifier - missing member.",
+		 function );
+
+		return( -1 );
+	}
+	if( compressed_data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid compressed data.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( compressed_data_size > (size_t) SSIZE_MAX )
+	 || ( (uint64_t) compressed_data_size > verifier->remaining_compressed_size ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid compressed data size value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	verifier->remaining_compressed_size -= compressed_data_size;
+
+	if( verifier->member->compression_method == ZIP_ARCHIVE_COMPRESSION_METHOD_STORED )
+	{
+		if( crc32_calculate_hardware(
+		     &( verifier->calculated_crc32 ),
+		     (uint8_t *) compressed_data,
+		     compressed_data_size,
+		     verifier->calculated_crc32,
+		     0,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GENERIC,
+			 "%s: unable to calculate CRC-32.",
+			 function );
+
+			return( -1 );
+		}
+		verifier->uncompressed_size += compressed_data_size;
+
+		return( 1 );
+	}
+	if( verifier->remaining_compressed_size == 0 )
+	{
+		stream_flags |= DEFLATE_STREAM_FLAG_END_OF_INPUT;
+	}
+	/* Data after the end of the deflate stream is ignored
+	 */
+	while( verifier->end_of_stream == 0 )
+	{
+		/* Decompression stops once the uncompressed data exceeds the size of the member
+		 */
+		if( verifier->uncompressed_size > verifier->member->uncompressed_size )
+		{
+			break;
+		}
+		stream_compressed_size = compressed_data_size - compressed_data_offset;
+		uncompressed_data_size = ZIP_ARCHIVE_UNCOMPRESSED_DATA_SIZE;
+
+		result = deflate_stream_decompress(
+		          verifier->stream,
+		          &( compressed_data[ compressed_data_offset ] ),
+		          &stream_compressed_size,
+		          verifier->uncompressed_data,
+		          &uncompressed_data_size,
+		          stream_flags,
+		          error );
+
+		if( result == -1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_COMPRESSION,
+			 LIBCERROR_COMPRESSION_ERROR_DECOMPRESS_FAILED,
+			 "%s: unable to decompress data.",
+			 function );
+
+			return( -1 );
+		}
+		compressed_data_offset += stream_compressed_size;
+
+		if( uncompressed_data_size > 0 )
+		{
+			if( crc32_calculate_hardware(
+			     &( verifier->calculated_crc32 ),
+			     verifier->uncompressed_data,
+			     uncompressed_data_size,
+			     verifier->calculated_crc32,
+			     0,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_GENERIC,
+				 "%s: unable to calculate CRC-32.",
+				 function );
+
+				return( -1 );
+			}
+			verifier->uncompressed_size += uncompressed_data_size;
+		}
+		if( result == 1 )
+		{
+			verifier->end_of_stream = 1;
+		}
+		/* The stream cannot continue without more compressed data
+		 */
+		else if( ( stream_compressed_size == 0 )
+		      && ( uncompressed_data_size == 0 ) )
+		{
+			break;
+		}
+	}
+	return( 1 );
+}
+
+/* Finishes the verification of a member
+ * Returns 1 if the uncompressed data matches the size and CRC-32 of the member, 0 if not or -1 on error
+ */
+int zip_archive_verifier_finish(
+     zip_archive_verifier_t *verifier,
+     libcerror_error_t **error )
+{
+	static char *function = "zip_archive_verifier_finish";
+	int result            = 1;
+
+	if( verifier == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid verifier.",
+		 function );
+
+		return( -1 );
+	}
+	if( verifier->member == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid verifier - missing member.",
+		 function );
+
+		return( -1 );
+	}
+	if( verifier->remaining_compressed_size != 0 )
+	{
+		result = 0;
+	}
+	else if( ( verifier->member->compression_method == ZIP_ARCHIVE_COMPRESSION_METHOD_DEFLATE )
+	      && ( verifier->end_of_stream == 0 ) )
+	{
+		result = 0;
+	}
+	else if( ( verifier->uncompressed_size != verifier->member->uncompressed_size )
+	      || ( verifier->calculated_crc32 != verifier->member->crc32 ) )
+	{
+		result = 0;
+	}
+	verifier->member = NULL;
+
+	return( result );
+}
+
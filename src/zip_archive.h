@@ -0,0 +1,219 @@
+/*
+ * ZIP archive functions
+ *
+ * Copyright (C) 2008-2019, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This software is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This software is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this software.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#if !defined( _ZIP_ARCHIVE_H )
+#define _ZIP_ARCHIVE_H
+
+#include <common.h>
+#include <types.h>
+
+#include "assorted_libcerror.h"
+#include "deflate_stream.h"
+
+#if defined( __cplusplus )
+extern "C" {
+#endif
+
+/* The size of the end of central directory record without the comment
+ */
+#define ZIP_ARCHIVE_END_OF_CENTRAL_DIRECTORY_SIZE		22
+
+/* The size of the ZIP64 end of central directory locator
+ */
+#define ZIP_ARCHIVE_ZIP64_END_OF_CENTRAL_DIRECTORY_LOCATOR_SIZE	20
+
+/* The size of the ZIP64 end of central directory record without the extensible data
+ */
+#define ZIP_ARCHIVE_ZIP64_END_OF_CENTRAL_DIRECTORY_SIZE		56
+
+/* The maximum size of the data at the end of an archive that contains the end of
+ * central directory record, which is followed by a comment of at most 65535 bytes,
+ * and the preceding ZIP64 end of central directory locator and record
+ */
+#define ZIP_ARCHIVE_MAXIMUM_TRAILER_SIZE \
+	( ZIP_ARCHIVE_ZIP64_END_OF_CENTRAL_DIRECTORY_SIZE + ZIP_ARCHIVE_ZIP64_END_OF_CENTRAL_DIRECTORY_LOCATOR_SIZE \
+	+ ZIP_ARCHIVE_END_OF_CENTRAL_DIRECTORY_SIZE + 65535 )
+
+/* The size of a central directory entry without the filename, extra field and comment
+ */
+#define ZIP_ARCHIVE_CENTRAL_DIRECTORY_ENTRY_SIZE		46
+
+/* The size of a local file header without the filename and extra field
+ */
+#define ZIP_ARCHIVE_LOCAL_FILE_HEADER_SIZE			30
+
+/* The size of the uncompressed data buffer of the verifier, the CRC-32 is calculated
+ * over every part of the uncompressed data while it is still in the cache
+ */
+#define ZIP_ARCHIVE_UNCOMPRESSED_DATA_SIZE			( 64 * 1024 )
+
+/* The compression methods
+ */
+enum ZIP_ARCHIVE_COMPRESSION_METHODS
+{
+	ZIP_ARCHIVE_COMPRESSION_METHOD_STORED		= 0,
+	ZIP_ARCHIVE_COMPRESSION_METHOD_DEFLATE		= 8
+};
+
+/* The general purpose flags
+ */
+enum ZIP_ARCHIVE_FLAGS
+{
+	ZIP_ARCHIVE_FLAG_ENCRYPTED			= 0x0001
+};
+
+typedef struct zip_archive_directory zip_archive_directory_t;
+
+struct zip_archive_directory
+{
+	/* The offset of the central directory
+	 */
+	uint64_t offset;
+
+	/* The size of the central directory
+	 */
+	uint64_t size;
+
+	/* The number of members
+	 */
+	uint64_t number_of_members;
+};
+
+typedef struct zip_archive_member zip_archive_member_t;
+
+struct zip_archive_member
+{
+	/* The filename, which references the central directory data and is not terminated
+	 */
+	const uint8_t *name;
+
+	/* The filename size
+	 */
+	uint16_t name_size;
+
+	/* The general purpose flags
+	 */
+	uint16_t flags;
+
+	/* The compression method
+	 */
+	uint16_t compression_method;
+
+	/* The CRC-32 of the uncompressed data
+	 */
+	uint32_t crc32;
+
+	/* The compressed size
+	 */
+	uint64_t compressed_size;
+
+	/* The uncompressed size
+	 */
+	uint64_t uncompressed_size;
+
+	/* The offset of the local file header
+	 */
+	uint64_t local_file_header_offset;
+};
+
+typedef struct zip_archive_verifier zip_archive_verifier_t;
+
+struct zip_archive_verifier
+{
+	/* The stream used to decompress deflate compressed members
+	 */
+	deflate_stream_t *stream;
+
+	/* The uncompressed data buffer, the uncompressed data of a member is discarded
+	 * once its CRC-32 has been calculated
+	 */
+	uint8_t uncompressed_data[ ZIP_ARCHIVE_UNCOMPRESSED_DATA_SIZE ];
+
+	/* The member that is verified
+	 */
+	const zip_archive_member_t *member;
+
+	/* The number of bytes of compressed data that have not been added yet
+	 */
+	uint64_t remaining_compressed_size;
+
+	/* The number of bytes of uncompressed data
+	 */
+	uint64_t uncompressed_size;
+
+	/* The calculated CRC-32 of the uncompressed data
+	 */
+	uint32_t calculated_crc32;
+
+	/* Value to indicate the end of the deflate stream was reached
+	 */
+	uint8_t end_of_stream;
+};
+
+int zip_archive_read_end_of_central_directory(
+     zip_archive_directory_t *directory,
+     const uint8_t *data,
+     size_t data_size,
+     uint64_t data_offset,
+     libcerror_error_t **error );
+
+int zip_archive_member_read_central_directory_entry(
+     zip_archive_member_t *member,
+     const uint8_t *data,
+     size_t data_size,
+     size_t *entry_size,
+     libcerror_error_t **error );
+
+int zip_archive_get_local_file_header_size(
+     const uint8_t *data,
+     size_t data_size,
+     size_t *header_size,
+     libcerror_error_t **error );
+
+int zip_archive_verifier_initialize(
+     zip_archive_verifier_t **verifier,
+     libcerror_error_t **error );
+
+int zip_archive_verifier_free(
+     zip_archive_verifier_t **verifier,
+     libcerror_error_t **error );
+
+int zip_archive_verifier_start(
+     zip_archive_verifier_t *verifier,
+     const zip_archive_member_t *member,
+     libcerror_error_t **error );
+
+int zip_archive_verifier_update(
+     zip_archive_verifier_t *verifier,
+     const uint8_t *compressed_data,
+     size_t compressed_data_size,
+     libcerror_error_t **error );
+
+int zip_archive_verifier_finish(
+     zip_archive_verifier_t *verifier,
+     libcerror_error_t **error );
+
+#if defined( __cplusplus )
+}
+#endif
+
+#endif /* !defined( _ZIP_ARCHIVE_H ) */
+
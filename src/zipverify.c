@@ -0,0 +1,1503 @@
+/*
+ * zipverify verifies the members of ZIP archives
+ *
+ * Copyright (C) 2008-2019, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This software is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This software is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this software.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <file_stream.h>
+#include <memory.h>
+#include <system_string.h>
+#include <types.h>
+
+#if defined( HAVE_STDLIB_H )
+#include <stdlib.h>
+#endif
+
+#include "assorted_getopt.h"
+#include "assorted_input_file.h"
+#include "assorted_libcerror.h"
+#include "assorted_libcfile.h"
+#include "assorted_libcnotify.h"
+#include "assorted_libcthreads.h"
+#include "assorted_output.h"
+#include "zip_archive.h"
+
+/* The size of the compressed data that is read at once
+ */
+#define ZIPVERIFY_READ_SIZE			( 1024 * 1024 )
+
+/* The default number of threads
+ */
+#define ZIPVERIFY_DEFAULT_NUMBER_OF_THREADS	4
+
+/* The maximum number of threads
+ */
+#define ZIPVERIFY_MAXIMUM_NUMBER_OF_THREADS	64
+
+/* The members are verified in tasks of consecutive members, a task is
+ * complete once it contains this number of members or compressed data
+ */
+#define ZIPVERIFY_MAXIMUM_TASK_NUMBER_OF_MEMBERS	256
+#define ZIPVERIFY_MAXIMUM_TASK_COMPRESSED_SIZE		( 16 * 1024 * 1024 )
+
+/* The maximum number of tasks queued per thread
+ */
+#define ZIPVERIFY_MAXIMUM_NUMBER_OF_QUEUED_TASKS	2
+
+/* The member results
+ */
+enum ZIPVERIFY_MEMBER_RESULTS
+{
+	ZIPVERIFY_MEMBER_RESULT_OK,
+	ZIPVERIFY_MEMBER_RESULT_FAILED,
+	ZIPVERIFY_MEMBER_RESULT_UNSUPPORTED
+};
+
+typedef struct zipverify_archive zipverify_archive_t;
+
+struct zipverify_archive
+{
+	/* The path
+	 */
+	const system_character_t *path;
+
+	/* The size
+	 */
+	size64_t size;
+
+	/* The central directory data, which contains the names of the members
+	 */
+	uint8_t *central_directory_data;
+
+	/* The members
+	 */
+	zip_archive_member_t *members;
+
+	/* The number of members
+	 */
+	uint64_t number_of_members;
+
+	/* The number of members that were verified successfully
+	 */
+	uint64_t number_of_verified_members;
+
+	/* The number of members that failed verification
+	 */
+	uint64_t number_of_failed_members;
+
+	/* The number of members that are encrypted or use an unsupported compression method
+	 */
+	uint64_t number_of_unsupported_members;
+
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+	/* The mutex that serializes the output and the counters
+	 */
+	libcthreads_mutex_t *mutex;
+#endif
+};
+
+typedef struct zipverify_task zipverify_task_t;
+
+struct zipverify_task
+{
+	/* The index of the first member
+	 */
+	uint64_t first_member_index;
+
+	/* The number of members
+	 */
+	uint64_t number_of_members;
+};
+
+/* Prints the executable usage information
+ */
+void usage_fprint(
+      FILE *stream )
+{
+	if( stream == NULL )
+	{
+		return;
+	}
+	fprintf( stream, "Use zipverify to verify the CRC-32 and size of the members of a ZIP archive,\n"
+	                 "such as a JAR, DOCX or XLSX file.\n\n" );
+
+	fprintf( stream, "Usage: zipverify [ -j threads ] [ -S format ] [ -hvV ] source\n\n" );
+
+	fprintf( stream, "\tsource: the source file\n\n" );
+
+	fprintf( stream, "\t-h:     shows this help\n" );
+	fprintf( stream, "\t-j:     number of threads (default is %d), the members are\n"
+	                 "\t        verified in parallel in tasks of consecutive members\n",
+	                 ZIPVERIFY_DEFAULT_NUMBER_OF_THREADS );
+	fprintf( stream, "\t-S:     print timing and throughput statistics of the open,\n"
+	                 "\t        read, compute and write phases and the peak memory\n"
+	                 "\t        size to stderr in the format: text or json\n" );
+	fprintf( stream, "\t-v:     verbose output to stderr\n" );
+	fprintf( stream, "\t-V:     print version\n" );
+	fprintf( stream, "\n" );
+	fprintf( stream, "A line is printed per member with the result of the verification, stored\n"
+	                 "and deflate compressed members are supported, encrypted members are not.\n" );
+	fprintf( stream, "\n" );
+}
+
+/* Reads the central directory of an archive
+ * Returns 1 if successful or -1 on error
+ */
+int zipverify_read_central_directory(
+     zipverify_archive_t *archive,
+     assorted_input_file_t *input_file,
+     libcerror_error_t **error )
+{
+	zip_archive_directory_t directory;
+
+	uint8_t *data                   = NULL;
+	static char *function           = "zipverify_read_central_directory";
+	size_t data_offset              = 0;
+	size_t entry_size               = 0;
+	size_t trailer_size             = 0;
+	ssize_t read_count              = 0;
+	uint64_t member_index           = 0;
+	uint64_t phase_start_time       = 0;
+	int result                      = 0;
+
+	if( archive == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid archive.",
+		 function );
+
+		return( -1 );
+	}
+	trailer_size = ZIP_ARCHIVE_MAXIMUM_TRAILER_SIZE;
+
+	if( (size64_t) trailer_size > archive->size )
+	{
+		trailer_size = (size_t) archive->size;
+	}
+	phase_start_time = assorted_output_statistics_start_phase();
+
+	if( assorted_input_file_seek_offset(
+	     input_file,
+	     (off64_t) ( archive->size - trailer_size ),
+	     SEEK_SET,
+	     error ) == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_SEEK_FAILED,
+		 "%s: unable to seek end of central directory record.",
+		 function );
+
+		goto on_error;
+	}
+	read_count = assorted_input_file_read_data(
+	              input_file,
+	              &data,
+	              trailer_size,
+	              error );
+
+	if( read_count != (ssize_t) trailer_size )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_READ_FAILED,
+		 "%s: unable to read end of central directory record.",
+		 function );
+
+		goto on_error;
+	}
+	assorted_output_statistics_stop_phase(
+	 ASSORTED_OUTPUT_STATISTICS_PHASE_READ,
+	 phase_start_time,
+	 (size64_t) trailer_size );
+
+	result = zip_archive_read_end_of_central_directory(
+	          &directory,
+	          data,
+	          trailer_size,
+	          (uint64_t) ( archive->size - trailer_size ),
+	          error );
+
+	if( result == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to read end of central directory record.",
+		 function );
+
+		goto on_error;
+	}
+	else if( result == 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: missing end of central directory record.",
+		 function );
+
+		goto on_error;
+	}
+	if( ( directory.offset > archive->size )
+	 || ( directory.size > ( archive->size - directory.offset ) )
+	 || ( directory.size > (uint64_t) SSIZE_MAX ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid central directory offset or size value out of bounds.",
+		 function );
+
+		goto on_error;
+	}
+	/* Every member requires at least a central directory entry
+	 */
+	if( directory.number_of_members > ( directory.size / ZIP_ARCHIVE_CENTRAL_DIRECTORY_ENTRY_SIZE ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid number of members value out of bounds.",
+		 function );
+
+		goto on_error;
+	}
+	if( directory.number_of_members == 0 )
+	{
+		return( 1 );
+	}
+	archive->central_directory_data = (uint8_t *) memory_allocate(
+	                                               sizeof( uint8_t ) * (size_t) directory.size );
+
+	if( archive->central_directory_data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create central directory data.",
+		 function );
+
+		goto on_error;
+	}
+	archive->members = (zip_archive_member_t *) memory_allocate(
+	                                             sizeof( zip_archive_member_t ) * (size_t) directory.number_of_members );
+
+	if( archive->members == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create members.",
+		 function );
+
+		goto on_error;
+	}
+	phase_start_time = assorted_output_statistics_start_phase();
+
+	if( assorted_input_file_seek_offset(
+	     input_file,
+	     (off64_t) directory.offset,
+	     SEEK_SET,
+	     error ) == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_SEEK_FAILED,
+		 "%s: unable to seek central directory.",
+		 function );
+
+		goto on_error;
+	}
+	read_count = assorted_input_file_read_data(
+	              input_file,
+	              &data,
+	              (size_t) directory.size,
+	              error );
+
+	if( read_count != (ssize_t) directory.size )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_READ_FAILED,
+		 "%s: unable to read central directory.",
+		 function );
+
+		goto on_error;
+	}
+	assorted_output_statistics_stop_phase(
+	 ASSORTED_OUTPUT_STATISTICS_PHASE_READ,
+	 phase_start_time,
+	 (size64_t) directory.size );
+
+	/* The data returned by the input file is only valid until the next read
+	 * and the names of the members reference the central directory data
+	 */
+	if( memory_copy(
+	     archive->central_directory_data,
+	     data,
+	     (size_t) directory.size ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+		 "%s: unable to copy central directory data.",
+		 function );
+
+		goto on_error;
+	}
+	for( member_index = 0;
+	     member_index < directory.number_of_members;
+	     member_index++ )
+	{
+		if( zip_archive_member_read_central_directory_entry(
+		     &( archive->members[ member_index ] ),
+		     &( archive->central_directory_data[ data_offset ] ),
+		     (size_t) directory.size - data_offset,
+		     &entry_size,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to read central directory entry: %" PRIu64 ".",
+			 function,
+			 member_index );
+
+			goto on_error;
+		}
+		data_offset += entry_size;
+	}
+	archive->number_of_members = directory.number_of_members;
+
+	return( 1 );
+
+on_error:
+	if( archive->members != NULL )
+	{
+		memory_free(
+		 archive->members );
+
+		archive->members = NULL;
+	}
+	if( archive->central_directory_data != NULL )
+	{
+		memory_free(
+		 archive->central_directory_data );
+
+		archive->central_directory_data = NULL;
+	}
+	return( -1 );
+}
+
+/* Verifies a member
+ * The compressed data is read in parts and every part is decompressed and
+ * its CRC-32 calculated before the next part is read
+ * Returns 1 if successful or -1 on error
+ */
+int zipverify_verify_member(
+     zipverify_archive_t *archive,
+     assorted_input_file_t *input_file,
+     zip_archive_verifier_t *verifier,
+     const zip_archive_member_t *member,
+     int *member_result,
+     libcerror_error_t **error )
+{
+	uint8_t *data             = NULL;
+	static char *function     = "zipverify_verify_member";
+	size_t header_size        = 0;
+	size_t read_size          = 0;
+	ssize_t read_count        = 0;
+	uint64_t data_offset      = 0;
+	uint64_t phase_start_time = 0;
+	uint64_t remaining_size   = 0;
+	int result                = 0;
+
+	if( archive == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid archive.",
+		 function );
+
+		return( -1 );
+	}
+	if( member == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid member.",
+		 function );
+
+		return( -1 );
+	}
+	if( member_result == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid member result.",
+		 function );
+
+		return( -1 );
+	}
+	result = zip_archive_verifier_start(
+	          verifier,
+	          member,
+	          error );
+
+	if( result == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to start verification.",
+		 function );
+
+		return( -1 );
+	}
+	else if( result == 0 )
+	{
+		*member_result = ZIPVERIFY_MEMBER_RESULT_UNSUPPORTED;
+
+		return( 1 );
+	}
+	if( ( member->local_file_header_offset > archive->size )
+	 || ( ( archive->size - member->local_file_header_offset ) < ZIP_ARCHIVE_LOCAL_FILE_HEADER_SIZE ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid local file header offset value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	phase_start_time = assorted_output_statistics_start_phase();
+
+	if( assorted_input_file_seek_offset(
+	     input_file,
+	     (off64_t) member->local_file_header_offset,
+	     SEEK_SET,
+	     error ) == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_SEEK_FAILED,
+		 "%s: unable to seek local file header.",
+		 function );
+
+		return( -1 );
+	}
+	read_count = assorted_input_file_read_data(
+	              input_file,
+	              &data,
+	              ZIP_ARCHIVE_LOCAL_FILE_HEADER_SIZE,
+	              error );
+
+	if( read_count != (ssize_t) ZIP_ARCHIVE_LOCAL_FILE_HEADER_SIZE )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_READ_FAILED,
+		 "%s: unable to read local file header.",
+		 function );
+
+		return( -1 );
+	}
+	assorted_output_statistics_stop_phase(
+	 ASSORTED_OUTPUT_STATISTICS_PHASE_READ,
+	 phase_start_time,
+	 (size64_t) ZIP_ARCHIVE_LOCAL_FILE_HEADER_SIZE );
+
+	if( zip_archive_get_local_file_header_size(
+	     data,
+	     ZIP_ARCHIVE_LOCAL_FILE_HEADER_SIZE,
+	     &header_size,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve local file header size.",
+		 function );
+
+		return( -1 );
+	}
+	data_offset = member->local_file_header_offset + header_size;
+
+	if( ( data_offset > archive->size )
+	 || ( member->compressed_size > ( archive->size - data_offset ) ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid compressed size value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( assorted_input_file_seek_offset(
+	     input_file,
+	     (off64_t) data_offset,
+	     SEEK_SET,
+	     error ) == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_SEEK_FAILED,
+		 "%s: unable to seek compressed data.",
+		 function );
+
+		return( -1 );
+	}
+	remaining_size = member->compressed_size;
+
+	while( remaining_size > 0 )
+	{
+		read_size = ZIPVERIFY_READ_SIZE;
+
+		if( (uint64_t) read_size > remaining_size )
+		{
+			read_size = (size_t) remaining_size;
+		}
+		phase_start_time = assorted_output_statistics_start_phase();
+
+		read_count = assorted_input_file_read_data(
+		              input_file,
+		              &data,
+		              read_size,
+		              error );
+
+		if( read_count != (ssize_t) read_size )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_READ_FAILED,
+			 "%s: unable to read compressed data.",
+			 function );
+
+			return( -1 );
+		}
+		assorted_output_statistics_stop_phase(
+		 ASSORTED_OUTPUT_STATISTICS_PHASE_READ,
+		 phase_start_time,
+		 (size64_t) read_size );
+
+		if( zip_archive_verifier_update(
+		     verifier,
+		     data,
+		     read_size,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GENERIC,
+			 "%s: unable to verify compressed data.",
+			 function );
+
+			return( -1 );
+		}
+		remaining_size -= read_size;
+	}
+	result = zip_archive_verifier_finish(
+	          verifier,
+	          error );
+
+	if( result == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GENERIC,
+		 "%s: unable to finish verification.",
+		 function );
+
+		return( -1 );
+	}
+	else if( result == 0 )
+	{
+		*member_result = ZIPVERIFY_MEMBER_RESULT_FAILED;
+	}
+	else
+	{
+		*member_result = ZIPVERIFY_MEMBER_RESULT_OK;
+	}
+	return( 1 );
+}
+
+/* Prints the result of a member and counts it
+ * A member that could not be verified is reported and counted as failed
+ * Returns 1 if successful or -1 on error
+ */
+int zipverify_report_member(
+     zipverify_archive_t *archive,
+     const zip_archive_member_t *member,
+     int member_result,
+     libcerror_error_t *member_error,
+     libcerror_error_t **error )
+{
+	static char *function = "zipverify_report_member";
+
+	if( archive == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid archive.",
+		 function );
+
+		return( -1 );
+	}
+	if( member == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid member.",
+		 function );
+
+		return( -1 );
+	}
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+	if( archive->mutex != NULL )
+	{
+		if( libcthreads_mutex_grab(
+		     archive->mutex,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to grab mutex.",
+			 function );
+
+			return( -1 );
+		}
+	}
+#endif
+	switch( member_result )
+	{
+		case ZIPVERIFY_MEMBER_RESULT_OK:
+			archive->number_of_verified_members += 1;
+
+			fprintf(
+			 stdout,
+			 "%.*s: OK\n",
+			 (int) member->name_size,
+			 (char *) member->name );
+
+			break;
+
+		case ZIPVERIFY_MEMBER_RESULT_UNSUPPORTED:
+			archive->number_of_unsupported_members += 1;
+
+			if( ( member->flags & ZIP_ARCHIVE_FLAG_ENCRYPTED ) != 0 )
+			{
+				fprintf(
+				 stdout,
+				 "%.*s: SKIPPED encrypted\n",
+				 (int) member->name_size,
+				 (char *) member->name );
+			}
+			else
+			{
+				fprintf(
+				 stdout,
+				 "%.*s: SKIPPED unsupported compression method: %" PRIu16 "\n",
+				 (int) member->name_size,
+				 (char *) member->name,
+				 member->compression_method );
+			}
+			break;
+
+		default:
+			archive->number_of_failed_members += 1;
+
+			fprintf(
+			 stdout,
+			 "%.*s: FAILED\n",
+			 (int) member->name_size,
+			 (char *) member->name );
+
+			if( ( member_error != NULL )
+			 && ( libcnotify_verbose != 0 ) )
+			{
+				libcnotify_print_error_backtrace(
+				 member_error );
+			}
+			break;
+	}
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+	if( archive->mutex != NULL )
+	{
+		if( libcthreads_mutex_release(
+		     archive->mutex,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to release mutex.",
+			 function );
+
+			return( -1 );
+		}
+	}
+#endif
+	return( 1 );
+}
+
+/* Verifies the members of a task
+ * Every task opens the archive so that tasks can be verified in parallel
+ * Returns 1 if successful or -1 on error
+ */
+int zipverify_verify_task(
+     zipverify_archive_t *archive,
+     zipverify_task_t *task,
+     libcerror_error_t **error )
+{
+	assorted_input_file_t *input_file = NULL;
+	libcerror_error_t *member_error   = NULL;
+	zip_archive_verifier_t *verifier  = NULL;
+	static char *function             = "zipverify_verify_task";
+	uint64_t member_index             = 0;
+	uint64_t phase_start_time         = 0;
+	int member_result                 = 0;
+
+	if( archive == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid archive.",
+		 function );
+
+		return( -1 );
+	}
+	if( task == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid task.",
+		 function );
+
+		return( -1 );
+	}
+	phase_start_time = assorted_output_statistics_start_phase();
+
+	if( assorted_input_file_initialize(
+	     &input_file,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create input file.",
+		 function );
+
+		goto on_error;
+	}
+	if( assorted_input_file_open(
+	     input_file,
+	     archive->path,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_OPEN_FAILED,
+		 "%s: unable to open input file.",
+		 function );
+
+		goto on_error;
+	}
+	assorted_output_statistics_stop_phase(
+	 ASSORTED_OUTPUT_STATISTICS_PHASE_OPEN,
+	 phase_start_time,
+	 0 );
+
+	if( zip_archive_verifier_initialize(
+	     &verifier,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create verifier.",
+		 function );
+
+		goto on_error;
+	}
+	for( member_index = task->first_member_index;
+	     member_index < ( task->first_member_index + task->number_of_members );
+	     member_index++ )
+	{
+		member_result = ZIPVERIFY_MEMBER_RESULT_FAILED;
+
+		zipverify_verify_member(
+		 archive,
+		 input_file,
+		 verifier,
+		 &( archive->members[ member_index ] ),
+		 &member_result,
+		 &member_error );
+
+		if( zipverify_report_member(
+		     archive,
+		     &( archive->members[ member_index ] ),
+		     member_result,
+		     member_error,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GENERIC,
+			 "%s: unable to report member: %" PRIu64 ".",
+			 function,
+			 member_index );
+
+			goto on_error;
+		}
+		if( member_error != NULL )
+		{
+			libcerror_error_free(
+			 &member_error );
+		}
+	}
+	if( zip_archive_verifier_free(
+	     &verifier,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+		 "%s: unable to free verifier.",
+		 function );
+
+		goto on_error;
+	}
+	if( assorted_input_file_close(
+	     input_file,
+	     error ) != 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_CLOSE_FAILED,
+		 "%s: unable to close input file.",
+		 function );
+
+		goto on_error;
+	}
+	if( assorted_input_file_free(
+	     &input_file,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+		 "%s: unable to free input file.",
+		 function );
+
+		goto on_error;
+	}
+	return( 1 );
+
+on_error:
+	if( member_error != NULL )
+	{
+		libcerror_error_free(
+		 &member_error );
+	}
+	if( verifier != NULL )
+	{
+		zip_archive_verifier_free(
+		 &verifier,
+		 NULL );
+	}
+	if( input_file != NULL )
+	{
+		assorted_input_file_free(
+		 &input_file,
+		 NULL );
+	}
+	return( -1 );
+}
+
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+
+/* Verifies the members of a task, used as the callback function of the thread pool
+ * The task is freed afterwards
+ * Returns 1 if successful or -1 on error
+ */
+int zipverify_thread_pool_verify(
+     intptr_t *value,
+     void *arguments )
+{
+	libcerror_error_t *error = NULL;
+	zipverify_task_t *task   = NULL;
+	int result               = 0;
+
+	if( ( value == NULL )
+	 || ( arguments == NULL ) )
+	{
+		return( -1 );
+	}
+	task = (zipverify_task_t *) value;
+
+	result = zipverify_verify_task(
+	          (zipverify_archive_t *) arguments,
+	          task,
+	          &error );
+
+	if( result != 1 )
+	{
+		libcnotify_print_error_backtrace(
+		 error );
+		libcerror_error_free(
+		 &error );
+	}
+	memory_free(
+	 task );
+
+	return( result );
+}
+
+#endif /* defined( HAVE_MULTI_THREAD_SUPPORT ) */
+
+/* The main program
+ */
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+int wmain( int argc, wchar_t * const argv[] )
+#else
+int main( int argc, char * const argv[] )
+#endif
+{
+	zipverify_archive_t archive;
+
+	libcerror_error_t *error                     = NULL;
+	assorted_input_file_t *source_file           = NULL;
+	system_character_t *option_statistics_format = NULL;
+	system_character_t *source                   = NULL;
+	zipverify_task_t *task                       = NULL;
+	char *program                                = "zipverify";
+	system_integer_t option                      = 0;
+	uint64_t member_index                        = 0;
+	uint64_t phase_start_time                    = 0;
+	uint64_t task_compressed_size                = 0;
+	int number_of_threads                        = ZIPVERIFY_DEFAULT_NUMBER_OF_THREADS;
+	int result                                   = 0;
+	int verbose                                  = 0;
+
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+	libcthreads_thread_pool_t *thread_pool       = NULL;
+#endif
+
+	assorted_output_version_fprint(
+	 stdout,
+	 program );
+
+	while( ( option = assorted_getopt(
+	                   argc,
+	                   argv,
+	                   _SYSTEM_STRING( "hj:S:vV" ) ) ) != (system_integer_t) -1 )
+	{
+		switch( option )
+		{
+			case '?':
+			default:
+				fprintf(
+				 stderr,
+				 "Invalid argument: %" PRIs_SYSTEM "\n",
+				 argv[ optind ] );
+
+				usage_fprint(
+				 stdout );
+
+				return( EXIT_FAILURE );
+
+			case 'h':
+				usage_fprint(
+				 stdout );
+
+				return( EXIT_SUCCESS );
+
+			case 'j':
+				number_of_threads = (int) atol( optarg );
+
+				break;
+
+			case 'S':
+				option_statistics_format = optarg;
+
+				break;
+
+			case 'v':
+				verbose = 1;
+
+				break;
+
+			case 'V':
+				assorted_output_copyright_fprint(
+				 stdout );
+
+				return( EXIT_SUCCESS );
+		}
+	}
+	if( optind == argc )
+	{
+		fprintf(
+		 stderr,
+		 "Missing source file.\n" );
+
+		usage_fprint(
+		 stdout );
+
+		return( EXIT_FAILURE );
+	}
+	source = argv[ optind ];
+
+	if( ( number_of_threads <= 0 )
+	 || ( number_of_threads > ZIPVERIFY_MAXIMUM_NUMBER_OF_THREADS ) )
+	{
+		fprintf(
+		 stderr,
+		 "Unsupported number of threads, value must be between 1 and %d.\n",
+		 ZIPVERIFY_MAXIMUM_NUMBER_OF_THREADS );
+
+		return( EXIT_FAILURE );
+	}
+#if !defined( HAVE_MULTI_THREAD_SUPPORT )
+	number_of_threads = 1;
+#endif
+	if( memory_set(
+	     &archive,
+	     0,
+	     sizeof( zipverify_archive_t ) ) == NULL )
+	{
+		fprintf(
+		 stderr,
+		 "Unable to clear archive.\n" );
+
+		return( EXIT_FAILURE );
+	}
+	archive.path = source;
+
+	libcnotify_stream_set(
+	 stderr,
+	 NULL );
+	libcnotify_verbose_set(
+	 verbose );
+
+	if( assorted_output_statistics_initialize(
+	     option_statistics_format,
+	     &error ) != 1 )
+	{
+		fprintf(
+		 stderr,
+		 "Unable to initialize statistics.\n" );
+
+		goto on_error;
+	}
+
+	/* Open the source file
+	 */
+	phase_start_time = assorted_output_statistics_start_phase();
+
+	if( assorted_input_file_initialize(
+	     &source_file,
+	     &error ) != 1 )
+	{
+		fprintf(
+		 stderr,
+		 "Unable to create source file.\n" );
+
+		goto on_error;
+	}
+	if( assorted_input_file_open(
+	     source_file,
+	     source,
+	     &error ) != 1 )
+	{
+		fprintf(
+		 stderr,
+		 "Unable to open source file.\n" );
+
+		goto on_error;
+	}
+	assorted_output_statistics_stop_phase(
+	 ASSORTED_OUTPUT_STATISTICS_PHASE_OPEN,
+	 phase_start_time,
+	 0 );
+
+	if( assorted_input_file_get_size(
+	     source_file,
+	     &( archive.size ),
+	     &error ) == -1 )
+	{
+		fprintf(
+		 stderr,
+		 "Unable to determine size of source file.\n" );
+
+		goto on_error;
+	}
+	if( zipverify_read_central_directory(
+	     &archive,
+	     source_file,
+	     &error ) != 1 )
+	{
+		fprintf(
+		 stderr,
+		 "Unable to read central directory.\n" );
+
+		goto on_error;
+	}
+	if( assorted_input_file_close(
+	     source_file,
+	     &error ) != 0 )
+	{
+		fprintf(
+		 stderr,
+		 "Unable to close source file.\n" );
+
+		goto on_error;
+	}
+	if( assorted_input_file_free(
+	     &source_file,
+	     &error ) != 1 )
+	{
+		fprintf(
+		 stderr,
+		 "Unable to free source file.\n" );
+
+		goto on_error;
+	}
+	fprintf(
+	 stdout,
+	 "Starting verification of: %" PRIs_SYSTEM " with %" PRIu64 " members.\n",
+	 source,
+	 archive.number_of_members );
+
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+	if( number_of_threads > 1 )
+	{
+		if( libcthreads_mutex_initialize(
+		     &( archive.mutex ),
+		     &error ) != 1 )
+		{
+			fprintf(
+			 stderr,
+			 "Unable to create mutex.\n" );
+
+			goto on_error;
+		}
+		/* The size of the queue bounds the number of tasks that are pending
+		 */
+		if( libcthreads_thread_pool_create(
+		     &thread_pool,
+		     NULL,
+		     number_of_threads,
+		     number_of_threads * ZIPVERIFY_MAXIMUM_NUMBER_OF_QUEUED_TASKS,
+		     zipverify_thread_pool_verify,
+		     &archive,
+		     &error ) != 1 )
+		{
+			fprintf(
+			 stderr,
+			 "Unable to create thread pool.\n" );
+
+			goto on_error;
+		}
+	}
+#endif
+	/* The members are divided into tasks of consecutive members, so that every
+	 * task reads its part of the archive sequentially
+	 */
+	for( member_index = 0;
+	     member_index < archive.number_of_members;
+	     member_index++ )
+	{
+		if( task == NULL )
+		{
+			task = memory_allocate_structure(
+			        zipverify_task_t );
+
+			if( task == NULL )
+			{
+				fprintf(
+				 stderr,
+				 "Unable to create task.\n" );
+
+				goto on_error;
+			}
+			task->first_member_index = member_index;
+			task->number_of_members  = 0;
+
+			task_compressed_size = 0;
+		}
+		task->number_of_members += 1;
+		task_compressed_size    += archive.members[ member_index ].compressed_size;
+
+		if( ( task->number_of_members < ZIPVERIFY_MAXIMUM_TASK_NUMBER_OF_MEMBERS )
+		 && ( task_compressed_size < ZIPVERIFY_MAXIMUM_TASK_COMPRESSED_SIZE )
+		 && ( ( member_index + 1 ) < archive.number_of_members ) )
+		{
+			continue;
+		}
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+		if( thread_pool != NULL )
+		{
+			/* Blocks while the queue of the thread pool is full
+			 */
+			if( libcthreads_thread_pool_push(
+			     thread_pool,
+			     (intptr_t *) task,
+			     &error ) != 1 )
+			{
+				fprintf(
+				 stderr,
+				 "Unable to push task onto thread pool.\n" );
+
+				goto on_error;
+			}
+			task = NULL;
+
+			continue;
+		}
+#endif
+		result = zipverify_verify_task(
+		          &archive,
+		          task,
+		          &error );
+
+		memory_free(
+		 task );
+
+		task = NULL;
+
+		if( result != 1 )
+		{
+			fprintf(
+			 stderr,
+			 "Unable to verify members.\n" );
+
+			goto on_error;
+		}
+	}
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+	if( thread_pool != NULL )
+	{
+		if( libcthreads_thread_pool_join(
+		     &thread_pool,
+		     &error ) != 1 )
+		{
+			fprintf(
+			 stderr,
+			 "Unable to join thread pool.\n" );
+
+			goto on_error;
+		}
+	}
+	if( archive.mutex != NULL )
+	{
+		if( libcthreads_mutex_free(
+		     &( archive.mutex ),
+		     &error ) != 1 )
+		{
+			fprintf(
+			 stderr,
+			 "Unable to free mutex.\n" );
+
+			goto on_error;
+		}
+	}
+#endif
+	/* Members of tasks that could not be verified, such as due to an archive
+	 * that could not be opened by a thread, are counted as failed
+	 */
+	archive.number_of_failed_members = archive.number_of_members
+	                                 - archive.number_of_verified_members
+	                                 - archive.number_of_unsupported_members;
+
+	if( archive.members != NULL )
+	{
+		memory_free(
+		 archive.members );
+
+		archive.members = NULL;
+	}
+	if( archive.central_directory_data != NULL )
+	{
+		memory_free(
+		 archive.central_directory_data );
+
+		archive.central_directory_data = NULL;
+	}
+	fprintf(
+	 stdout,
+	 "\n" );
+
+	fprintf(
+	 stdout,
+	 "Number of members:\t\t%" PRIu64 "\n",
+	 archive.number_of_members );
+
+	fprintf(
+	 stdout,
+	 "Number of verified members:\t%" PRIu64 "\n",
+	 archive.number_of_verified_members );
+
+	fprintf(
+	 stdout,
+	 "Number of failed members:\t%" PRIu64 "\n",
+	 archive.number_of_failed_members );
+
+	fprintf(
+	 stdout,
+	 "Number of skipped members:\t%" PRIu64 "\n",
+	 archive.number_of_unsupported_members );
+
+	fprintf(
+	 stdout,
+	 "\n" );
+
+	if( archive.number_of_failed_members != 0 )
+	{
+		fprintf(
+		 stdout,
+		 "ZIP verify:\t\t\tFAILURE\n" );
+
+		result = -1;
+	}
+	else
+	{
+		fprintf(
+		 stdout,
+		 "ZIP verify:\t\t\tSUCCESS\n" );
+
+		result = 1;
+	}
+	assorted_output_statistics_fprint(
+	 stderr,
+	 program,
+	 result,
+	 NULL );
+	assorted_output_statistics_free(
+	 NULL );
+
+	if( result != 1 )
+	{
+		return( EXIT_FAILURE );
+	}
+	return( EXIT_SUCCESS );
+
+on_error:
+	if( error != NULL )
+	{
+		libcnotify_print_error_backtrace(
+		 error );
+		libcerror_error_free(
+		 &error );
+	}
+	assorted_output_statistics_fprint(
+	 stderr,
+	 program,
+	 -1,
+	 NULL );
+	assorted_output_statistics_free(
+	 NULL );
+	if( task != NULL )
+	{
+		memory_free(
+		 task );
+	}
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+	if( thread_pool != NULL )
+	{
+		libcthreads_thread_pool_join(
+		 &thread_pool,
+		 NULL );
+	}
+	if( archive.mutex != NULL )
+	{
+		libcthreads_mutex_free(
+		 &( archive.mutex ),
+		 NULL );
+	}
+#endif
+	if( archive.members != NULL )
+	{
+		memory_free(
+		 archive.members );
+	}
+	if( archive.central_directory_data != NULL )
+	{
+		memory_free(
+		 archive.central_directory_data );
+	}
+	if( source_file != NULL )
+	{
+		assorted_input_file_free(
+		 &source_file,
+		 NULL );
+	}
+	return( EXIT_FAILURE );
+}
+
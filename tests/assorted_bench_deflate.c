@@ -0,0 +1,678 @@
+/*
+ * Deflate (zlib) bit-stream and Huffman primitives benchmarking program
+ *
+ * Copyright (C) 2008-2019, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This software is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This software is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this software.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <byte_stream.h>
+#include <file_stream.h>
+#include <memory.h>
+#include <narrow_string.h>
+#include <types.h>
+
+#if defined( HAVE_STDLIB_H ) || defined( WINAPI )
+#include <stdlib.h>
+#endif
+
+#include "assorted_test_libcerror.h"
+#include "assorted_test_unused.h"
+
+#include "../src/assorted_timer.h"
+#include "../src/deflate.h"
+#include "../src/deflate_tables.h"
+
+/* The size of the synthetic input data
+ */
+#define ASSORTED_BENCH_DEFLATE_DATA_SIZE			( 4 * 1024 * 1024 )
+
+/* The number of times the Huffman table is constructed
+ */
+#define ASSORTED_BENCH_DEFLATE_NUMBER_OF_TABLE_CONSTRUCTIONS	65536
+
+/* Retrieves the number of bits consumed from a bit stream
+ */
+#define assorted_bench_deflate_bit_stream_get_offset( bit_stream ) \
+	( ( (uint64_t) ( bit_stream )->byte_stream_offset * 8 ) - ( bit_stream )->bit_buffer_size )
+
+uint8_t assorted_bench_deflate_random_data[ ASSORTED_BENCH_DEFLATE_DATA_SIZE ];
+
+uint8_t assorted_bench_deflate_text_data[ ASSORTED_BENCH_DEFLATE_DATA_SIZE ];
+
+uint8_t assorted_bench_deflate_compressed_data[ ASSORTED_BENCH_DEFLATE_DATA_SIZE + 1024 ];
+
+uint8_t assorted_bench_deflate_uncompressed_data[ ASSORTED_BENCH_DEFLATE_DATA_SIZE ];
+
+size_t assorted_bench_deflate_compressed_data_size = 0;
+
+/* Fills the synthetic input data
+ * The random data contains pseudo random bytes and the text data pseudo random words
+ * Returns 1 if successful or 0 if not
+ */
+int assorted_bench_deflate_fill_data(
+     void )
+{
+	const char *words[ 8 ] = {
+		"access ", "point ", "window ", "block ", "offset ", "stream ", "index\n", "deflate " };
+
+	libcerror_error_t *error = NULL;
+	size_t data_offset       = 0;
+	size_t word_size         = 0;
+	uint32_t random_value    = 1;
+	int letter_index         = 0;
+
+	for( data_offset = 0;
+	     data_offset < ASSORTED_BENCH_DEFLATE_DATA_SIZE;
+	     data_offset++ )
+	{
+		random_value = ( random_value * 1103515245UL ) + 12345;
+
+		assorted_bench_deflate_random_data[ data_offset ] = (uint8_t) ( random_value >> 16 );
+	}
+	/* Every word is followed by 4 pseudo random letters so that the compressed data
+	 * contains a mix of literals and matches
+	 */
+	data_offset = 0;
+
+	while( data_offset < ASSORTED_BENCH_DEFLATE_DATA_SIZE )
+	{
+		random_value = ( random_value * 1103515245UL ) + 12345;
+
+		word_size = narrow_string_length(
+		             words[ ( random_value >> 16 ) & 0x07 ] );
+
+		if( word_size > ( ASSORTED_BENCH_DEFLATE_DATA_SIZE - data_offset ) )
+		{
+			word_size = ASSORTED_BENCH_DEFLATE_DATA_SIZE - data_offset;
+		}
+		memory_copy(
+		 &( assorted_bench_deflate_text_data[ data_offset ] ),
+		 words[ ( random_value >> 16 ) & 0x07 ],
+		 word_size );
+
+		data_offset += word_size;
+
+		for( letter_index = 0;
+		     ( letter_index < 4 ) && ( data_offset < ASSORTED_BENCH_DEFLATE_DATA_SIZE );
+		     letter_index++ )
+		{
+			random_value = ( random_value * 1103515245UL ) + 12345;
+
+			assorted_bench_deflate_text_data[ data_offset++ ] = (uint8_t) ( 'a' + ( ( random_value >> 16 ) % 26 ) );
+		}
+	}
+	assorted_bench_deflate_compressed_data_size = ASSORTED_BENCH_DEFLATE_DATA_SIZE + 1024;
+
+	if( deflate_compress(
+	     assorted_bench_deflate_text_data,
+	     ASSORTED_BENCH_DEFLATE_DATA_SIZE,
+	     6,
+	     assorted_bench_deflate_compressed_data,
+	     &assorted_bench_deflate_compressed_data_size,
+	     &error ) != 1 )
+	{
+		fprintf(
+		 stderr,
+		 "Unable to compress text data.\n" );
+
+		goto on_error;
+	}
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_backtrace_fprint(
+		 error,
+		 stderr );
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Prints the result of a benchmark
+ * A number of bits of 0 represents that bits per cycle does not apply
+ */
+void assorted_bench_deflate_print_result(
+      const char *name,
+      uint64_t number_of_operations,
+      uint64_t number_of_bits,
+      uint64_t elapsed_time,
+      uint64_t number_of_cycles )
+{
+	double nanoseconds_per_operation = 0.0;
+
+	if( number_of_operations > 0 )
+	{
+		nanoseconds_per_operation = (double) elapsed_time / (double) number_of_operations;
+	}
+	fprintf(
+	 stdout,
+	 "%-45s %12" PRIu64 " %10.2f ",
+	 name,
+	 number_of_operations,
+	 nanoseconds_per_operation );
+
+	if( ( number_of_bits > 0 )
+	 && ( number_of_cycles > 0 ) )
+	{
+		fprintf(
+		 stdout,
+		 "%10.3f\n",
+		 (double) number_of_bits / (double) number_of_cycles );
+	}
+	else
+	{
+		fprintf(
+		 stdout,
+		 "%10s\n",
+		 "n/a" );
+	}
+}
+
+/* Benchmarks the deflate_bit_stream_get_value function
+ * The number of bits read cycles from 1 to 16 bits
+ * Returns 1 if successful or 0 if not
+ */
+int assorted_bench_deflate_bit_stream_get_value(
+     void )
+{
+	deflate_bit_stream_t bit_stream;
+
+	libcerror_error_t *error      = NULL;
+	uint64_t end_cycles           = 0;
+	uint64_t end_time             = 0;
+	uint64_t number_of_operations = 0;
+	uint64_t operation            = 0;
+	uint64_t start_cycles         = 0;
+	uint64_t start_time           = 0;
+	uint32_t value_32bit          = 0;
+
+	bit_stream.byte_stream        = assorted_bench_deflate_random_data;
+	bit_stream.byte_stream_size   = ASSORTED_BENCH_DEFLATE_DATA_SIZE;
+	bit_stream.byte_stream_offset = 0;
+	bit_stream.bit_buffer         = 0;
+	bit_stream.bit_buffer_size    = 0;
+
+	/* On average 8.5 bits are read per operation
+	 */
+	number_of_operations = ( (uint64_t) ASSORTED_BENCH_DEFLATE_DATA_SIZE * 8 ) / 9;
+
+	start_time   = assorted_timer_get_nanoseconds();
+	start_cycles = assorted_timer_get_cycles();
+
+	for( operation = 0;
+	     operation < number_of_operations;
+	     operation++ )
+	{
+		if( deflate_bit_stream_get_value(
+		     &bit_stream,
+		     (uint8_t) ( ( operation & 0x0f ) + 1 ),
+		     &value_32bit,
+		     &error ) != 1 )
+		{
+			fprintf(
+			 stderr,
+			 "Unable to retrieve value from bit stream.\n" );
+
+			goto on_error;
+		}
+	}
+	end_cycles = assorted_timer_get_cycles();
+	end_time   = assorted_timer_get_nanoseconds();
+
+	assorted_bench_deflate_print_result(
+	 "deflate_bit_stream_get_value",
+	 number_of_operations,
+	 assorted_bench_deflate_bit_stream_get_offset( &bit_stream ),
+	 end_time - start_time,
+	 end_cycles - start_cycles );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_backtrace_fprint(
+		 error,
+		 stderr );
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Benchmarks the deflate_huffman_table_construct function
+ * The table is constructed from the fixed Huffman literals and lengths code sizes
+ * Returns 1 if successful or 0 if not
+ */
+int assorted_bench_deflate_huffman_table_construct(
+     void )
+{
+	uint16_t code_size_array[ 288 ];
+
+	deflate_huffman_table_t table;
+
+	libcerror_error_t *error = NULL;
+	uint64_t end_cycles      = 0;
+	uint64_t end_time        = 0;
+	uint64_t operation       = 0;
+	uint64_t start_cycles    = 0;
+	uint64_t start_time      = 0;
+	uint16_t symbol          = 0;
+
+	for( symbol = 0;
+	     symbol < 288;
+	     symbol++ )
+	{
+		if( symbol < 144 )
+		{
+			code_size_array[ symbol ] = 8;
+		}
+		else if( symbol < 256 )
+		{
+			code_size_array[ symbol ] = 9;
+		}
+		else if( symbol < 280 )
+		{
+			code_size_array[ symbol ] = 7;
+		}
+		else
+		{
+			code_size_array[ symbol ] = 8;
+		}
+	}
+	start_time   = assorted_timer_get_nanoseconds();
+	start_cycles = assorted_timer_get_cycles();
+
+	for( operation = 0;
+	     operation < ASSORTED_BENCH_DEFLATE_NUMBER_OF_TABLE_CONSTRUCTIONS;
+	     operation++ )
+	{
+		if( deflate_huffman_table_construct(
+		     &table,
+		     code_size_array,
+		     288,
+		     &error ) != 1 )
+		{
+			fprintf(
+			 stderr,
+			 "Unable to construct Huffman table.\n" );
+
+			goto on_error;
+		}
+	}
+	end_cycles = assorted_timer_get_cycles();
+	end_time   = assorted_timer_get_nanoseconds();
+
+	assorted_bench_deflate_print_result(
+	 "deflate_huffman_table_construct",
+	 ASSORTED_BENCH_DEFLATE_NUMBER_OF_TABLE_CONSTRUCTIONS,
+	 0,
+	 end_time - start_time,
+	 end_cycles - start_cycles );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_backtrace_fprint(
+		 error,
+		 stderr );
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Benchmarks the deflate_bit_stream_get_huffman_encoded_value function
+ * Random data is decoded with the fixed Huffman literals and lengths table,
+ * which is a complete code, so that every bit sequence is a valid code
+ * Returns 1 if successful or 0 if not
+ */
+int assorted_bench_deflate_bit_stream_get_huffman_encoded_value(
+     void )
+{
+	deflate_bit_stream_t bit_stream;
+
+	libcerror_error_t *error      = NULL;
+	uint64_t end_cycles           = 0;
+	uint64_t end_time             = 0;
+	uint64_t number_of_operations = 0;
+	uint64_t operation            = 0;
+	uint64_t start_cycles         = 0;
+	uint64_t start_time           = 0;
+	uint32_t value_32bit          = 0;
+
+	bit_stream.byte_stream        = assorted_bench_deflate_random_data;
+	bit_stream.byte_stream_size   = ASSORTED_BENCH_DEFLATE_DATA_SIZE;
+	bit_stream.byte_stream_offset = 0;
+	bit_stream.bit_buffer         = 0;
+	bit_stream.bit_buffer_size    = 0;
+
+	/* A fixed Huffman literals and lengths code is at most 9 bits
+	 */
+	number_of_operations = ( (uint64_t) ASSORTED_BENCH_DEFLATE_DATA_SIZE * 8 ) / 9;
+
+	start_time   = assorted_timer_get_nanoseconds();
+	start_cycles = assorted_timer_get_cycles();
+
+	for( operation = 0;
+	     operation < number_of_operations;
+	     operation++ )
+	{
+		if( deflate_bit_stream_get_huffman_encoded_value(
+		     &bit_stream,
+		     &deflate_fixed_huffman_literals_table,
+		     &value_32bit,
+		     &error ) != 1 )
+		{
+			fprintf(
+			 stderr,
+			 "Unable to retrieve Huffman encoded value from bit stream.\n" );
+
+			goto on_error;
+		}
+	}
+	end_cycles = assorted_timer_get_cycles();
+	end_time   = assorted_timer_get_nanoseconds();
+
+	assorted_bench_deflate_print_result(
+	 "deflate_bit_stream_get_huffman_encoded_value",
+	 number_of_operations,
+	 assorted_bench_deflate_bit_stream_get_offset( &bit_stream ),
+	 end_time - start_time,
+	 end_cycles - start_cycles );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_backtrace_fprint(
+		 error,
+		 stderr );
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Benchmarks the deflate_decode_huffman function
+ * The blocks of the compressed text data are decoded one by one where only
+ * the time spent in deflate_decode_huffman is measured and an operation
+ * corresponds to an uncompressed byte
+ * Returns 1 if successful or 0 if not
+ */
+int assorted_bench_deflate_decode_huffman(
+     void )
+{
+	deflate_bit_stream_t bit_stream;
+	deflate_huffman_table_t dynamic_distances_table;
+	deflate_huffman_table_t dynamic_literals_table;
+
+	const deflate_huffman_table_t *distances_table = NULL;
+	const deflate_huffman_table_t *literals_table  = NULL;
+	libcerror_error_t *error                       = NULL;
+	size_t uncompressed_data_offset                = 0;
+	uint64_t elapsed_time                          = 0;
+	uint64_t end_cycles                            = 0;
+	uint64_t end_offset                            = 0;
+	uint64_t end_time                              = 0;
+	uint64_t number_of_bits                        = 0;
+	uint64_t number_of_cycles                      = 0;
+	uint64_t start_cycles                          = 0;
+	uint64_t start_offset                          = 0;
+	uint64_t start_time                            = 0;
+	uint32_t block_size                            = 0;
+	uint32_t block_type                            = 0;
+	uint32_t last_block_flag                       = 0;
+	uint32_t value_32bit                           = 0;
+	int result                                     = 0;
+
+	/* Skip the zlib header and exclude the Adler-32 checksum
+	 */
+	bit_stream.byte_stream        = &( assorted_bench_deflate_compressed_data[ 2 ] );
+	bit_stream.byte_stream_size   = assorted_bench_deflate_compressed_data_size - 6;
+	bit_stream.byte_stream_offset = 0;
+	bit_stream.bit_buffer         = 0;
+	bit_stream.bit_buffer_size    = 0;
+
+	while( last_block_flag == 0 )
+	{
+		if( deflate_bit_stream_get_value(
+		     &bit_stream,
+		     1,
+		     &last_block_flag,
+		     &error ) != 1 )
+		{
+			fprintf(
+			 stderr,
+			 "Unable to retrieve last block flag from bit stream.\n" );
+
+			goto on_error;
+		}
+		if( deflate_bit_stream_get_value(
+		     &bit_stream,
+		     2,
+		     &block_type,
+		     &error ) != 1 )
+		{
+			fprintf(
+			 stderr,
+			 "Unable to retrieve block type from bit stream.\n" );
+
+			goto on_error;
+		}
+		if( block_type == DEFLATE_BLOCK_TYPE_UNCOMPRESSED )
+		{
+			/* Ignore the bits in the buffer upto the next byte and
+			 * return the bytes remaining in the bit buffer to the byte stream
+			 */
+			if( deflate_bit_stream_get_value(
+			     &bit_stream,
+			     bit_stream.bit_buffer_size & 0x07,
+			     &value_32bit,
+			     &error ) != 1 )
+			{
+				fprintf(
+				 stderr,
+				 "Unable to retrieve value from bit stream.\n" );
+
+				goto on_error;
+			}
+			bit_stream.byte_stream_offset -= bit_stream.bit_buffer_size >> 3;
+			bit_stream.bit_buffer          = 0;
+			bit_stream.bit_buffer_size     = 0;
+
+			if( ( bit_stream.byte_stream_size - bit_stream.byte_stream_offset ) < 4 )
+			{
+				fprintf(
+				 stderr,
+				 "Invalid uncompressed block size.\n" );
+
+				goto on_error;
+			}
+			byte_stream_copy_to_uint16_little_endian(
+			 &( bit_stream.byte_stream[ bit_stream.byte_stream_offset ] ),
+			 block_size );
+
+			bit_stream.byte_stream_offset += 4;
+
+			if( ( (size_t) block_size > ( bit_stream.byte_stream_size - bit_stream.byte_stream_offset ) )
+			 || ( (size_t) block_size > ( ASSORTED_BENCH_DEFLATE_DATA_SIZE - uncompressed_data_offset ) ) )
+			{
+				fprintf(
+				 stderr,
+				 "Invalid uncompressed block size.\n" );
+
+				goto on_error;
+			}
+			memory_copy(
+			 &( assorted_bench_deflate_uncompressed_data[ uncompressed_data_offset ] ),
+			 &( bit_stream.byte_stream[ bit_stream.byte_stream_offset ] ),
+			 (size_t) block_size );
+
+			bit_stream.byte_stream_offset += block_size;
+			uncompressed_data_offset      += block_size;
+
+			continue;
+		}
+		else if( block_type == DEFLATE_BLOCK_TYPE_HUFFMAN_FIXED )
+		{
+			literals_table  = &deflate_fixed_huffman_literals_table;
+			distances_table = &deflate_fixed_huffman_distances_table;
+		}
+		else if( block_type == DEFLATE_BLOCK_TYPE_HUFFMAN_DYNAMIC )
+		{
+			if( deflate_initialize_dynamic_huffman_tables(
+			     &bit_stream,
+			     &dynamic_literals_table,
+			     &dynamic_distances_table,
+			     &error ) != 1 )
+			{
+				fprintf(
+				 stderr,
+				 "Unable to construct dynamic Huffman tables.\n" );
+
+				goto on_error;
+			}
+			literals_table  = &dynamic_literals_table;
+			distances_table = &dynamic_distances_table;
+		}
+		else
+		{
+			fprintf(
+			 stderr,
+			 "Unsupported block type.\n" );
+
+			goto on_error;
+		}
+		start_offset = assorted_bench_deflate_bit_stream_get_offset( &bit_stream );
+		start_time   = assorted_timer_get_nanoseconds();
+		start_cycles = assorted_timer_get_cycles();
+
+		result = deflate_decode_huffman(
+		          &bit_stream,
+		          literals_table,
+		          distances_table,
+		          assorted_bench_deflate_uncompressed_data,
+		          ASSORTED_BENCH_DEFLATE_DATA_SIZE,
+		          &uncompressed_data_offset,
+		          &error );
+
+		end_cycles = assorted_timer_get_cycles();
+		end_time   = assorted_timer_get_nanoseconds();
+
+		if( result != 1 )
+		{
+			fprintf(
+			 stderr,
+			 "Unable to decode Huffman encoded block.\n" );
+
+			goto on_error;
+		}
+		end_offset = assorted_bench_deflate_bit_stream_get_offset( &bit_stream );
+
+		elapsed_time     += end_time - start_time;
+		number_of_cycles += end_cycles - start_cycles;
+		number_of_bits   += end_offset - start_offset;
+	}
+	if( ( uncompressed_data_offset != ASSORTED_BENCH_DEFLATE_DATA_SIZE )
+	 || ( memory_compare(
+	       assorted_bench_deflate_uncompressed_data,
+	       assorted_bench_deflate_text_data,
+	       ASSORTED_BENCH_DEFLATE_DATA_SIZE ) != 0 ) )
+	{
+		fprintf(
+		 stderr,
+		 "Mismatch in uncompressed data.\n" );
+
+		goto on_error;
+	}
+	assorted_bench_deflate_print_result(
+	 "deflate_decode_huffman (per byte)",
+	 (uint64_t) uncompressed_data_offset,
+	 number_of_bits,
+	 elapsed_time,
+	 number_of_cycles );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_backtrace_fprint(
+		 error,
+		 stderr );
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* The main program
+ */
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+int wmain(
+     int argc ASSORTED_TEST_ATTRIBUTE_UNUSED,
+     wchar_t * const argv[] ASSORTED_TEST_ATTRIBUTE_UNUSED )
+#else
+int main(
+     int argc ASSORTED_TEST_ATTRIBUTE_UNUSED,
+     char * const argv[] ASSORTED_TEST_ATTRIBUTE_UNUSED )
+#endif
+{
+	ASSORTED_TEST_UNREFERENCED_PARAMETER( argc )
+	ASSORTED_TEST_UNREFERENCED_PARAMETER( argv )
+
+	if( assorted_bench_deflate_fill_data() != 1 )
+	{
+		goto on_error;
+	}
+	fprintf(
+	 stdout,
+	 "%-45s %12s %10s %10s\n",
+	 "primitive",
+	 "operations",
+	 "ns/op",
+	 "bits/cycle" );
+
+	if( assorted_bench_deflate_bit_stream_get_value() != 1 )
+	{
+		goto on_error;
+	}
+	if( assorted_bench_deflate_huffman_table_construct() != 1 )
+	{
+		goto on_error;
+	}
+	if( assorted_bench_deflate_bit_stream_get_huffman_encoded_value() != 1 )
+	{
+		goto on_error;
+	}
+	if( assorted_bench_deflate_decode_huffman() != 1 )
+	{
+		goto on_error;
+	}
+	return( EXIT_SUCCESS );
+
+on_error:
+	return( EXIT_FAILURE );
+}
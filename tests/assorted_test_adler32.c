@@ -0,0 +1,468 @@
+/*
+ * Adler-32 functions testing program
+ *
+ * Copyright (C) 2008-2019, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This software is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This software is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this software.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <file_stream.h>
+#include <types.h>
+
+#if defined( HAVE_STDLIB_H ) || defined( WINAPI )
+#include <stdlib.h>
+#endif
+
+#include "assorted_test_libcerror.h"
+#include "assorted_test_macros.h"
+#include "assorted_test_unused.h"
+
+#include "../src/adler32.h"
+
+typedef int (*assorted_test_adler32_calculate_function_t)(
+               uint32_t *checksum_value,
+               const uint8_t *buffer,
+               size_t size,
+               uint32_t initial_value,
+               libcerror_error_t **error );
+
+/* The check string used by the checksum catalogues
+ */
+uint8_t assorted_test_adler32_check_data[ 9 ] = {
+	'1', '2', '3', '4', '5', '6', '7', '8', '9' };
+
+/* Buffer larger than multiple modulo blocks of 5552 bytes
+ */
+uint8_t assorted_test_adler32_data[ 20011 ];
+
+/* Tests an Adler-32 calculate function
+ * Returns 1 if successful or 0 if not
+ */
+int assorted_test_adler32_calculate_function(
+     assorted_test_adler32_calculate_function_t calculate_function )
+{
+	libcerror_error_t *error     = NULL;
+	size_t buffer_offset         = 0;
+	size_t buffer_size           = 0;
+	uint32_t calculated_checksum = 0;
+	uint32_t expected_checksum   = 0;
+	int result                   = 0;
+
+	/* Initialize test
+	 */
+	for( buffer_offset = 0;
+	     buffer_offset < 20011;
+	     buffer_offset++ )
+	{
+		assorted_test_adler32_data[ buffer_offset ] = (uint8_t) ( ( buffer_offset * 7 ) + ( buffer_offset >> 3 ) );
+	}
+	/* Test regular cases
+	 */
+	result = calculate_function(
+	          &calculated_checksum,
+	          assorted_test_adler32_check_data,
+	          9,
+	          1,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ASSORTED_TEST_ASSERT_EQUAL_UINT32(
+	 "calculated_checksum",
+	 calculated_checksum,
+	 (uint32_t) 0x091e01deUL );
+
+	ASSORTED_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test with all buffer sizes up to 160 bytes from unaligned offsets
+	 * to cover the SIMD blocks and trailing bytes
+	 */
+	for( buffer_size = 0;
+	     buffer_size <= 160;
+	     buffer_size++ )
+	{
+		for( buffer_offset = 0;
+		     buffer_offset < 8;
+		     buffer_offset++ )
+		{
+			result = checksum_calculate_adler32_basic2(
+			          &expected_checksum,
+			          &( assorted_test_adler32_data[ buffer_offset ] ),
+			          buffer_size,
+			          0x12345678UL,
+			          &error );
+
+			ASSORTED_TEST_ASSERT_EQUAL_INT(
+			 "result",
+			 result,
+			 1 );
+
+			result = calculate_function(
+			          &calculated_checksum,
+			          &( assorted_test_adler32_data[ buffer_offset ] ),
+			          buffer_size,
+			          0x12345678UL,
+			          &error );
+
+			ASSORTED_TEST_ASSERT_EQUAL_INT(
+			 "result",
+			 result,
+			 1 );
+
+			ASSORTED_TEST_ASSERT_EQUAL_UINT32(
+			 "calculated_checksum",
+			 calculated_checksum,
+			 expected_checksum );
+		}
+	}
+	/* Test with the maximum byte values to cover the modulo calculation
+	 */
+	for( buffer_offset = 0;
+	     buffer_offset < 20011;
+	     buffer_offset++ )
+	{
+		assorted_test_adler32_data[ buffer_offset ] = 0xff;
+	}
+	for( buffer_size = 5500;
+	     buffer_size <= 20000;
+	     buffer_size += 1811 )
+	{
+		result = checksum_calculate_adler32_basic2(
+		          &expected_checksum,
+		          &( assorted_test_adler32_data[ 3 ] ),
+		          buffer_size,
+		          0xfff0fff0UL,
+		          &error );
+
+		ASSORTED_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		result = calculate_function(
+		          &calculated_checksum,
+		          &( assorted_test_adler32_data[ 3 ] ),
+		          buffer_size,
+		          0xfff0fff0UL,
+		          &error );
+
+		ASSORTED_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		ASSORTED_TEST_ASSERT_EQUAL_UINT32(
+		 "calculated_checksum",
+		 calculated_checksum,
+		 expected_checksum );
+	}
+	/* Test error cases
+	 */
+	result = calculate_function(
+	          NULL,
+	          assorted_test_adler32_data,
+	          20011,
+	          1,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ASSORTED_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = calculate_function(
+	          &calculated_checksum,
+	          NULL,
+	          20011,
+	          1,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ASSORTED_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = calculate_function(
+	          &calculated_checksum,
+	          assorted_test_adler32_data,
+	          (size_t) SSIZE_MAX + 1,
+	          1,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ASSORTED_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the checksum_calculate_adler32_cpu_aligned function
+ * Returns 1 if successful or 0 if not
+ */
+int assorted_test_adler32_calculate_cpu_aligned(
+     void )
+{
+	return( assorted_test_adler32_calculate_function(
+	         checksum_calculate_adler32_cpu_aligned ) );
+}
+
+/* Tests the checksum_calculate_adler32_simd function
+ * Returns 1 if successful or 0 if not
+ */
+int assorted_test_adler32_calculate_simd(
+     void )
+{
+	return( assorted_test_adler32_calculate_function(
+	         checksum_calculate_adler32_simd ) );
+}
+
+/* Tests the checksum_combine_adler32 function
+ * Returns 1 if successful or 0 if not
+ */
+int assorted_test_adler32_combine(
+     void )
+{
+	static uint8_t buffer[ 70001 ];
+
+	libcerror_error_t *error   = NULL;
+	size_t buffer_offset       = 0;
+	size_t split_offset        = 0;
+	uint32_t combined_checksum = 0;
+	uint32_t expected_checksum = 0;
+	uint32_t first_checksum    = 0;
+	uint32_t second_checksum   = 0;
+	int result                 = 0;
+
+	/* Initialize test
+	 */
+	for( buffer_offset = 0;
+	     buffer_offset < 70001;
+	     buffer_offset++ )
+	{
+		buffer[ buffer_offset ] = (uint8_t) ( ( buffer_offset * 11 ) + ( buffer_offset >> 4 ) );
+	}
+	/* Test regular cases
+	 */
+	result = checksum_calculate_adler32_basic2(
+	          &first_checksum,
+	          assorted_test_adler32_check_data,
+	          4,
+	          1,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	result = checksum_calculate_adler32_basic2(
+	          &second_checksum,
+	          &( assorted_test_adler32_check_data[ 4 ] ),
+	          5,
+	          1,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	result = checksum_combine_adler32(
+	          &combined_checksum,
+	          first_checksum,
+	          second_checksum,
+	          5,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ASSORTED_TEST_ASSERT_EQUAL_UINT32(
+	 "combined_checksum",
+	 combined_checksum,
+	 (uint32_t) 0x091e01deUL );
+
+	ASSORTED_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test with a first part that uses an arbitrary initial value and
+	 * with second parts that are larger than the modulus of 65521
+	 */
+	result = checksum_calculate_adler32_basic2(
+	          &expected_checksum,
+	          buffer,
+	          70001,
+	          0x12345678UL,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	for( split_offset = 0;
+	     split_offset <= 70001;
+	     split_offset += 4999 )
+	{
+		result = checksum_calculate_adler32_basic2(
+		          &first_checksum,
+		          buffer,
+		          split_offset,
+		          0x12345678UL,
+		          &error );
+
+		ASSORTED_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		result = checksum_calculate_adler32_basic2(
+		          &second_checksum,
+		          &( buffer[ split_offset ] ),
+		          70001 - split_offset,
+		          1,
+		          &error );
+
+		ASSORTED_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		result = checksum_combine_adler32(
+		          &combined_checksum,
+		          first_checksum,
+		          second_checksum,
+		          (size64_t) ( 70001 - split_offset ),
+		          &error );
+
+		ASSORTED_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		ASSORTED_TEST_ASSERT_EQUAL_UINT32(
+		 "combined_checksum",
+		 combined_checksum,
+		 expected_checksum );
+
+		ASSORTED_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+	}
+	/* Test error cases
+	 */
+	result = checksum_combine_adler32(
+	          NULL,
+	          first_checksum,
+	          second_checksum,
+	          5,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ASSORTED_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* The main program
+ */
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+int wmain(
+     int argc ASSORTED_TEST_ATTRIBUTE_UNUSED,
+     wchar_t * const argv[] ASSORTED_TEST_ATTRIBUTE_UNUSED )
+#else
+int main(
+     int argc ASSORTED_TEST_ATTRIBUTE_UNUSED,
+     char * const argv[] ASSORTED_TEST_ATTRIBUTE_UNUSED )
+#endif
+{
+	ASSORTED_TEST_UNREFERENCED_PARAMETER( argc )
+	ASSORTED_TEST_UNREFERENCED_PARAMETER( argv )
+
+	ASSORTED_TEST_RUN(
+	 "checksum_calculate_adler32_cpu_aligned",
+	 assorted_test_adler32_calculate_cpu_aligned );
+
+	ASSORTED_TEST_RUN(
+	 "checksum_calculate_adler32_simd",
+	 assorted_test_adler32_calculate_simd );
+
+	ASSORTED_TEST_RUN(
+	 "checksum_combine_adler32",
+	 assorted_test_adler32_combine );
+
+	return( EXIT_SUCCESS );
+
+on_error:
+	return( EXIT_FAILURE );
+}
+
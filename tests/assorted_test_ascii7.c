@@ -0,0 +1,903 @@
+/*
+ * ASCII 7-bit (un)compression functions testing program
+ *
+ * Copyright (C) 2008-2019, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This software is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This software is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this software.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <file_stream.h>
+#include <memory.h>
+#include <types.h>
+
+#if defined( HAVE_STDLIB_H ) || defined( WINAPI )
+#include <stdlib.h>
+#endif
+
+#include "assorted_test_libcerror.h"
+#include "assorted_test_macros.h"
+#include "assorted_test_unused.h"
+
+#include "../src/ascii7.h"
+
+/* The first byte followed by "hellohello", which packs into the septets of the GSM 03.38 example
+ */
+uint8_t assorted_test_ascii7_uncompressed_data1[ 11 ] = {
+	'X', 'h', 'e', 'l', 'l', 'o', 'h', 'e', 'l', 'l', 'o' };
+
+uint8_t assorted_test_ascii7_compressed_data1[ 10 ] = {
+	'X', 0xe8, 0x32, 0x9b, 0xfd, 0x46, 0x97, 0xd9, 0xec, 0x37 };
+
+/* A text of 43 characters, which packs into 5 groups of 7 bytes followed by a tail of 2 bytes
+ */
+uint8_t assorted_test_ascii7_uncompressed_data2[ 43 ] = {
+	'T', 'h', 'e', ' ', 'q', 'u', 'i', 'c', 'k', ' ', 'b', 'r', 'o', 'w', 'n', ' ',
+	'f', 'o', 'x', ' ', 'j', 'u', 'm', 'p', 's', ' ', 'o', 'v', 'e', 'r', ' ', 't',
+	'h', 'e', ' ', 'l', 'a', 'z', 'y', ' ', 'd', 'o', 'g' };
+
+uint8_t assorted_test_ascii7_compressed_data2[ 38 ] = {
+	0x54, 0xe8, 0x32, 0x28, 0x5e, 0x4f, 0x8f, 0xd7, 0x20, 0xb1, 0xfc, 0x7d, 0x77, 0x83, 0xcc, 0x6f,
+	0x3c, 0x48, 0x5d, 0x6f, 0xc3, 0xe7, 0xa0, 0xb7, 0xbd, 0x2c, 0x07, 0xd1, 0xd1, 0x65, 0x10, 0x3b,
+	0xac, 0xcf, 0x83, 0xc8, 0xef, 0x33 };
+
+/* Buffers larger than multiple SIMD blocks
+ */
+uint8_t assorted_test_ascii7_uncompressed_data[ 520 ];
+
+uint8_t assorted_test_ascii7_compressed_data[ 520 ];
+
+uint8_t assorted_test_ascii7_decompressed_data[ 600 ];
+
+/* Tests the ascii7_get_uncompressed_data_size function
+ * Returns 1 if successful or 0 if not
+ */
+int assorted_test_ascii7_get_uncompressed_data_size(
+     void )
+{
+	libcerror_error_t *error      = NULL;
+	size_t uncompressed_data_size = 0;
+	int result                    = 0;
+
+	/* Test regular cases
+	 */
+	result = ascii7_get_uncompressed_data_size(
+	          assorted_test_ascii7_compressed_data1,
+	          10,
+	          &uncompressed_data_size,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ASSORTED_TEST_ASSERT_EQUAL_SIZE(
+	 "uncompressed_data_size",
+	 uncompressed_data_size,
+	 (size_t) 11 );
+
+	ASSORTED_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = ascii7_get_uncompressed_data_size(
+	          assorted_test_ascii7_compressed_data2,
+	          38,
+	          &uncompressed_data_size,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ASSORTED_TEST_ASSERT_EQUAL_SIZE(
+	 "uncompressed_data_size",
+	 uncompressed_data_size,
+	 (size_t) 43 );
+
+	ASSORTED_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = ascii7_get_uncompressed_data_size(
+	          assorted_test_ascii7_compressed_data1,
+	          1,
+	          &uncompressed_data_size,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ASSORTED_TEST_ASSERT_EQUAL_SIZE(
+	 "uncompressed_data_size",
+	 uncompressed_data_size,
+	 (size_t) 1 );
+
+	ASSORTED_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = ascii7_get_uncompressed_data_size(
+	          assorted_test_ascii7_compressed_data1,
+	          8,
+	          &uncompressed_data_size,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ASSORTED_TEST_ASSERT_EQUAL_SIZE(
+	 "uncompressed_data_size",
+	 uncompressed_data_size,
+	 (size_t) 9 );
+
+	ASSORTED_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = ascii7_get_uncompressed_data_size(
+	          NULL,
+	          10,
+	          &uncompressed_data_size,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ASSORTED_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = ascii7_get_uncompressed_data_size(
+	          assorted_test_ascii7_compressed_data1,
+	          (size_t) SSIZE_MAX + 1,
+	          &uncompressed_data_size,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ASSORTED_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = ascii7_get_uncompressed_data_size(
+	          assorted_test_ascii7_compressed_data1,
+	          0,
+	          &uncompressed_data_size,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ASSORTED_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = ascii7_get_uncompressed_data_size(
+	          assorted_test_ascii7_compressed_data1,
+	          10,
+	          NULL,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ASSORTED_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the ascii7_decompress function
+ * Returns 1 if successful or 0 if not
+ */
+int assorted_test_ascii7_decompress(
+     void )
+{
+	uint8_t uncompressed_data[ 64 ];
+
+	libcerror_error_t *error      = NULL;
+	size_t compressed_data_size   = 0;
+	size_t uncompressed_data_size = 0;
+	int result                    = 0;
+
+	/* Test regular cases
+	 */
+	result = ascii7_decompress(
+	          uncompressed_data,
+	          11,
+	          assorted_test_ascii7_compressed_data1,
+	          10,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ASSORTED_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = memory_compare(
+	          uncompressed_data,
+	          assorted_test_ascii7_uncompressed_data1,
+	          11 );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	result = ascii7_decompress(
+	          uncompressed_data,
+	          43,
+	          assorted_test_ascii7_compressed_data2,
+	          38,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ASSORTED_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = memory_compare(
+	          uncompressed_data,
+	          assorted_test_ascii7_uncompressed_data2,
+	          43 );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	/* Every prefix of the compressed data decodes to a prefix of the text
+	 * covering the tail lengths 1 to 7 with and without preceding 8-byte groups
+	 */
+	for( compressed_data_size = 1;
+	     compressed_data_size <= 38;
+	     compressed_data_size++ )
+	{
+		result = ascii7_get_uncompressed_data_size(
+		          assorted_test_ascii7_compressed_data2,
+		          compressed_data_size,
+		          &uncompressed_data_size,
+		          &error );
+
+		ASSORTED_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		ASSORTED_TEST_ASSERT_EQUAL_SIZE(
+		 "uncompressed_data_size",
+		 uncompressed_data_size,
+		 (size_t) 1 + ( ( compressed_data_size - 1 ) * 8 ) / 7 );
+
+		ASSORTED_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		result = ascii7_decompress(
+		          uncompressed_data,
+		          uncompressed_data_size,
+		          assorted_test_ascii7_compressed_data2,
+		          compressed_data_size,
+		          &error );
+
+		ASSORTED_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		ASSORTED_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		result = memory_compare(
+		          uncompressed_data,
+		          assorted_test_ascii7_uncompressed_data2,
+		          uncompressed_data_size );
+
+		ASSORTED_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 0 );
+	}
+	/* Test error cases
+	 */
+	result = ascii7_decompress(
+	          NULL,
+	          11,
+	          assorted_test_ascii7_compressed_data1,
+	          10,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ASSORTED_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = ascii7_decompress(
+	          uncompressed_data,
+	          (size_t) SSIZE_MAX + 1,
+	          assorted_test_ascii7_compressed_data1,
+	          10,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ASSORTED_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = ascii7_decompress(
+	          uncompressed_data,
+	          11,
+	          NULL,
+	          10,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ASSORTED_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = ascii7_decompress(
+	          uncompressed_data,
+	          11,
+	          assorted_test_ascii7_compressed_data1,
+	          (size_t) SSIZE_MAX + 1,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ASSORTED_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = ascii7_decompress(
+	          uncompressed_data,
+	          11,
+	          assorted_test_ascii7_compressed_data1,
+	          0,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ASSORTED_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = ascii7_decompress(
+	          uncompressed_data,
+	          10,
+	          assorted_test_ascii7_compressed_data1,
+	          10,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ASSORTED_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the ascii7_get_compressed_data_size function
+ * Returns 1 if successful or 0 if not
+ */
+int assorted_test_ascii7_get_compressed_data_size(
+     void )
+{
+	libcerror_error_t *error    = NULL;
+	size_t compressed_data_size = 0;
+	int result                  = 0;
+
+	/* Test regular cases
+	 */
+	result = ascii7_get_compressed_data_size(
+	          assorted_test_ascii7_uncompressed_data1,
+	          11,
+	          &compressed_data_size,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ASSORTED_TEST_ASSERT_EQUAL_SIZE(
+	 "compressed_data_size",
+	 compressed_data_size,
+	 (size_t) 10 );
+
+	ASSORTED_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = ascii7_get_compressed_data_size(
+	          assorted_test_ascii7_uncompressed_data1,
+	          1,
+	          &compressed_data_size,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ASSORTED_TEST_ASSERT_EQUAL_SIZE(
+	 "compressed_data_size",
+	 compressed_data_size,
+	 (size_t) 1 );
+
+	ASSORTED_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = ascii7_get_compressed_data_size(
+	          assorted_test_ascii7_uncompressed_data1,
+	          9,
+	          &compressed_data_size,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ASSORTED_TEST_ASSERT_EQUAL_SIZE(
+	 "compressed_data_size",
+	 compressed_data_size,
+	 (size_t) 8 );
+
+	ASSORTED_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = ascii7_get_compressed_data_size(
+	          NULL,
+	          11,
+	          &compressed_data_size,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ASSORTED_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = ascii7_get_compressed_data_size(
+	          assorted_test_ascii7_uncompressed_data1,
+	          0,
+	          &compressed_data_size,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ASSORTED_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = ascii7_get_compressed_data_size(
+	          assorted_test_ascii7_uncompressed_data1,
+	          11,
+	          NULL,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ASSORTED_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the ascii7_compress function
+ * Returns 1 if successful or 0 if not
+ */
+int assorted_test_ascii7_compress(
+     void )
+{
+	uint8_t compressed_data[ 16 ];
+
+	libcerror_error_t *error      = NULL;
+	size_t compressed_data_size   = 0;
+	size_t data_offset            = 0;
+	size_t decompressed_data_size = 0;
+	size_t uncompressed_data_size = 0;
+	int result                    = 0;
+
+	/* Test regular cases
+	 */
+	result = ascii7_compress(
+	          compressed_data,
+	          10,
+	          assorted_test_ascii7_uncompressed_data1,
+	          11,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ASSORTED_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = memory_compare(
+	          compressed_data,
+	          assorted_test_ascii7_compressed_data1,
+	          10 );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	/* Test with all data sizes up to 512 bytes to cover the SIMD blocks,
+	 * the 8-byte groups and trailing bytes, which should not write beyond
+	 * the end of the compressed data and should decompress to the same data
+	 */
+	for( data_offset = 0;
+	     data_offset < 520;
+	     data_offset++ )
+	{
+		assorted_test_ascii7_uncompressed_data[ data_offset ] = (uint8_t) ( ( data_offset * 37 ) + ( data_offset >> 4 ) );
+	}
+	for( uncompressed_data_size = 1;
+	     uncompressed_data_size <= 512;
+	     uncompressed_data_size++ )
+	{
+		result = ascii7_get_compressed_data_size(
+		          assorted_test_ascii7_uncompressed_data,
+		          uncompressed_data_size,
+		          &compressed_data_size,
+		          &error );
+
+		ASSORTED_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		assorted_test_ascii7_compressed_data[ compressed_data_size ] = 0xa5;
+
+		result = ascii7_compress(
+		          assorted_test_ascii7_compressed_data,
+		          compressed_data_size,
+		          assorted_test_ascii7_uncompressed_data,
+		          uncompressed_data_size,
+		          &error );
+
+		ASSORTED_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		ASSORTED_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		ASSORTED_TEST_ASSERT_EQUAL_UINT8(
+		 "assorted_test_ascii7_compressed_data[ compressed_data_size ]",
+		 assorted_test_ascii7_compressed_data[ compressed_data_size ],
+		 (uint8_t) 0xa5 );
+
+		/* The uncompressed data size of the compressed data is at most 1 byte
+		 * larger than the size of the data that was compressed
+		 */
+		result = ascii7_get_uncompressed_data_size(
+		          assorted_test_ascii7_compressed_data,
+		          compressed_data_size,
+		          &decompressed_data_size,
+		          &error );
+
+		ASSORTED_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		ASSORTED_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		ASSORTED_TEST_ASSERT_LESS_THAN_UINT64(
+		 "uncompressed_data_size",
+		 (uint64_t) uncompressed_data_size,
+		 (uint64_t) decompressed_data_size + 1 );
+
+		ASSORTED_TEST_ASSERT_LESS_THAN_UINT64(
+		 "decompressed_data_size",
+		 (uint64_t) decompressed_data_size,
+		 (uint64_t) uncompressed_data_size + 2 );
+
+		result = ascii7_decompress(
+		          assorted_test_ascii7_decompressed_data,
+		          decompressed_data_size,
+		          assorted_test_ascii7_compressed_data,
+		          compressed_data_size,
+		          &error );
+
+		ASSORTED_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		ASSORTED_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		ASSORTED_TEST_ASSERT_EQUAL_UINT8(
+		 "assorted_test_ascii7_decompressed_data[ 0 ]",
+		 assorted_test_ascii7_decompressed_data[ 0 ],
+		 assorted_test_ascii7_uncompressed_data[ 0 ] );
+
+		for( data_offset = 1;
+		     data_offset < uncompressed_data_size;
+		     data_offset++ )
+		{
+			ASSORTED_TEST_ASSERT_EQUAL_UINT8(
+			 "assorted_test_ascii7_decompressed_data[ data_offset ]",
+			 assorted_test_ascii7_decompressed_data[ data_offset ],
+			 (uint8_t) ( assorted_test_ascii7_uncompressed_data[ data_offset ] & 0x7f ) );
+		}
+	}
+	/* Test error cases
+	 */
+	result = ascii7_compress(
+	          NULL,
+	          10,
+	          assorted_test_ascii7_uncompressed_data1,
+	          11,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ASSORTED_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = ascii7_compress(
+	          compressed_data,
+	          (size_t) SSIZE_MAX + 1,
+	          assorted_test_ascii7_uncompressed_data1,
+	          11,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ASSORTED_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = ascii7_compress(
+	          compressed_data,
+	          10,
+	          NULL,
+	          11,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ASSORTED_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = ascii7_compress(
+	          compressed_data,
+	          9,
+	          assorted_test_ascii7_uncompressed_data1,
+	          11,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ASSORTED_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* The main program
+ */
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+int wmain(
+     int argc ASSORTED_TEST_ATTRIBUTE_UNUSED,
+     wchar_t * const argv[] ASSORTED_TEST_ATTRIBUTE_UNUSED )
+#else
+int main(
+     int argc ASSORTED_TEST_ATTRIBUTE_UNUSED,
+     char * const argv[] ASSORTED_TEST_ATTRIBUTE_UNUSED )
+#endif
+{
+	ASSORTED_TEST_UNREFERENCED_PARAMETER( argc )
+	ASSORTED_TEST_UNREFERENCED_PARAMETER( argv )
+
+	ASSORTED_TEST_RUN(
+	 "ascii7_get_uncompressed_data_size",
+	 assorted_test_ascii7_get_uncompressed_data_size );
+
+	ASSORTED_TEST_RUN(
+	 "ascii7_decompress",
+	 assorted_test_ascii7_decompress );
+
+	ASSORTED_TEST_RUN(
+	 "ascii7_get_compressed_data_size",
+	 assorted_test_ascii7_get_compressed_data_size );
+
+	ASSORTED_TEST_RUN(
+	 "ascii7_compress",
+	 assorted_test_ascii7_compress );
+
+	return( EXIT_SUCCESS );
+
+on_error:
+	return( EXIT_FAILURE );
+}
+
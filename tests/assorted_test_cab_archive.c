@@ -0,0 +1,658 @@
+/*
+ * Cabinet (CAB) archive functions testing program
+ *
+ * Copyright (C) 2008-2019, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This software is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This software is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this software.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <file_stream.h>
+#include <memory.h>
+#include <types.h>
+
+#if defined( HAVE_STDLIB_H ) || defined( WINAPI )
+#include <stdlib.h>
+#endif
+
+#include "assorted_test_libcerror.h"
+#include "assorted_test_macros.h"
+#include "assorted_test_unused.h"
+#include "../src/cab_archive.h"
+
+/* A cabinet with a single MSZIP compressed folder of 2 data blocks at offset 69,
+ * that contains a single file of 131 bytes
+ */
+uint8_t assorted_test_cab_archive_data[ 172 ] = {
+	0x4d, 0x53, 0x43, 0x46, 0x00, 0x00, 0x00, 0x00, 0xac, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x2c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x01, 0x01, 0x00, 0x01, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x45, 0x00, 0x00, 0x00, 0x02, 0x00, 0x01, 0x00, 0x83, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x20, 0x00, 0x74, 0x65, 0x73, 0x74,
+	0x2e, 0x74, 0x78, 0x74, 0x00, 0xd0, 0x0a, 0x9c, 0xa0, 0x36, 0x00, 0x32, 0x00, 0x43, 0x4b, 0xf3,
+	0x0d, 0x8e, 0xf2, 0x0c, 0x50, 0x48, 0xce, 0xcf, 0x2d, 0x28, 0x4a, 0x2d, 0x2e, 0x4e, 0x4d, 0x51,
+	0x48, 0x49, 0x2c, 0x49, 0x54, 0x48, 0xca, 0xc9, 0x4f, 0xce, 0x2e, 0x56, 0xc8, 0x4f, 0x53, 0x48,
+	0x54, 0x48, 0x4e, 0x4c, 0xca, 0xcc, 0x4b, 0x2d, 0x51, 0x48, 0xcb, 0xcf, 0x49, 0x49, 0x2d, 0xd2,
+	0xe3, 0x02, 0x00, 0x28, 0x59, 0xe0, 0x6a, 0x21, 0x00, 0x51, 0x00, 0x43, 0x4b, 0x0b, 0xc9, 0x48,
+	0x55, 0x28, 0x4e, 0x4d, 0xce, 0xcf, 0x4b, 0x81, 0x28, 0x53, 0x28, 0x4a, 0x4d, 0x4b, 0x2d, 0x2a,
+	0x56, 0x28, 0xc9, 0x57, 0x28, 0x01, 0x4a, 0xf9, 0x92, 0x6c, 0x20, 0x00 };
+
+/* Tests the cab_archive_read_header function
+ * Returns 1 if successful or 0 if not
+ */
+int assorted_test_cab_archive_read_header(
+     void )
+{
+	uint8_t header_data[ 36 ];
+
+	cab_archive_header_t header;
+
+	libcerror_error_t *error = NULL;
+	int result               = 0;
+
+	/* Test regular cases
+	 */
+	result = cab_archive_read_header(
+	          &header,
+	          assorted_test_cab_archive_data,
+	          172,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ASSORTED_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_UINT32(
+	 "header.cabinet_size",
+	 header.cabinet_size,
+	 (uint32_t) 172 );
+
+	ASSORTED_TEST_ASSERT_EQUAL_UINT16(
+	 "header.number_of_folders",
+	 header.number_of_folders,
+	 (uint16_t) 1 );
+
+	ASSORTED_TEST_ASSERT_EQUAL_UINT16(
+	 "header.number_of_files",
+	 header.number_of_files,
+	 (uint16_t) 1 );
+
+	ASSORTED_TEST_ASSERT_EQUAL_UINT16(
+	 "header.flags",
+	 header.flags,
+	 (uint16_t) 0 );
+
+	ASSORTED_TEST_ASSERT_EQUAL_SIZE(
+	 "header.header_size",
+	 header.header_size,
+	 (size_t) CAB_ARCHIVE_HEADER_SIZE );
+
+	/* Test error cases
+	 */
+	result = cab_archive_read_header(
+	          NULL,
+	          assorted_test_cab_archive_data,
+	          172,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ASSORTED_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = cab_archive_read_header(
+	          &header,
+	          assorted_test_cab_archive_data,
+	          CAB_ARCHIVE_HEADER_SIZE - 1,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ASSORTED_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Test data with an invalid signature
+	 */
+	if( memory_copy(
+	     header_data,
+	     assorted_test_cab_archive_data,
+	     36 ) == NULL )
+	{
+		goto on_error;
+	}
+	header_data[ 0 ] = 'X';
+
+	result = cab_archive_read_header(
+	          &header,
+	          header_data,
+	          36,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ASSORTED_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the cab_archive_folder_read function
+ * Returns 1 if successful or 0 if not
+ */
+int assorted_test_cab_archive_folder_read(
+     void )
+{
+	cab_archive_folder_t folder;
+
+	libcerror_error_t *error = NULL;
+	int result               = 0;
+
+	/* Test regular cases
+	 */
+	result = cab_archive_folder_read(
+	          &folder,
+	          &( assorted_test_cab_archive_data[ 36 ] ),
+	          CAB_ARCHIVE_FOLDER_SIZE,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ASSORTED_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_UINT32(
+	 "folder.data_offset",
+	 folder.data_offset,
+	 (uint32_t) 69 );
+
+	ASSORTED_TEST_ASSERT_EQUAL_UINT16(
+	 "folder.number_of_data_blocks",
+	 folder.number_of_data_blocks,
+	 (uint16_t) 2 );
+
+	ASSORTED_TEST_ASSERT_EQUAL_UINT16(
+	 "folder.compression_type",
+	 folder.compression_type,
+	 (uint16_t) CAB_ARCHIVE_COMPRESSION_TYPE_MSZIP );
+
+	/* Test error cases
+	 */
+	result = cab_archive_folder_read(
+	          NULL,
+	          &( assorted_test_cab_archive_data[ 36 ] ),
+	          CAB_ARCHIVE_FOLDER_SIZE,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ASSORTED_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = cab_archive_folder_read(
+	          &folder,
+	          &( assorted_test_cab_archive_data[ 36 ] ),
+	          CAB_ARCHIVE_FOLDER_SIZE - 1,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ASSORTED_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the cab_archive_data_block_read_header function
+ * Returns 1 if successful or 0 if not
+ */
+int assorted_test_cab_archive_data_block_read_header(
+     void )
+{
+	cab_archive_data_block_t data_block;
+
+	libcerror_error_t *error = NULL;
+	int result               = 0;
+
+	/* Test regular cases
+	 */
+	result = cab_archive_data_block_read_header(
+	          &data_block,
+	          &( assorted_test_cab_archive_data[ 69 ] ),
+	          CAB_ARCHIVE_DATA_BLOCK_HEADER_SIZE,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ASSORTED_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_UINT32(
+	 "data_block.checksum",
+	 data_block.checksum,
+	 (uint32_t) 0xa09c0ad0UL );
+
+	ASSORTED_TEST_ASSERT_EQUAL_UINT16(
+	 "data_block.compressed_size",
+	 data_block.compressed_size,
+	 (uint16_t) 54 );
+
+	ASSORTED_TEST_ASSERT_EQUAL_UINT16(
+	 "data_block.uncompressed_size",
+	 data_block.uncompressed_size,
+	 (uint16_t) 50 );
+
+	/* Test error cases
+	 */
+	result = cab_archive_data_block_read_header(
+	          NULL,
+	          &( assorted_test_cab_archive_data[ 69 ] ),
+	          CAB_ARCHIVE_DATA_BLOCK_HEADER_SIZE,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ASSORTED_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = cab_archive_data_block_read_header(
+	          &data_block,
+	          &( assorted_test_cab_archive_data[ 69 ] ),
+	          CAB_ARCHIVE_DATA_BLOCK_HEADER_SIZE - 1,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ASSORTED_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the cab_archive_calculate_checksum function
+ * Returns 1 if successful or 0 if not
+ */
+int assorted_test_cab_archive_calculate_checksum(
+     void )
+{
+	uint8_t data[ 7 ] = {
+		0x01, 0x02, 0x03, 0x04, 0x05, 0x06, 0x07 };
+
+	libcerror_error_t *error = NULL;
+	uint32_t checksum_value  = 0;
+	int result               = 0;
+
+	/* Test regular cases
+	 */
+	result = cab_archive_calculate_checksum(
+	          &checksum_value,
+	          data,
+	          7,
+	          0,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ASSORTED_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* 0x04030201 ^ 0x00050607
+	 */
+	ASSORTED_TEST_ASSERT_EQUAL_UINT32(
+	 "checksum_value",
+	 checksum_value,
+	 (uint32_t) 0x04060406UL );
+
+	result = cab_archive_calculate_checksum(
+	          &checksum_value,
+	          data,
+	          4,
+	          0x04030201UL,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ASSORTED_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_UINT32(
+	 "checksum_value",
+	 checksum_value,
+	 (uint32_t) 0 );
+
+	/* Test error cases
+	 */
+	result = cab_archive_calculate_checksum(
+	          NULL,
+	          data,
+	          7,
+	          0,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ASSORTED_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = cab_archive_calculate_checksum(
+	          &checksum_value,
+	          NULL,
+	          7,
+	          0,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ASSORTED_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the cab_archive_data_block_verify_checksum function
+ * Returns 1 if successful or 0 if not
+ */
+int assorted_test_cab_archive_data_block_verify_checksum(
+     void )
+{
+	uint8_t compressed_data[ 33 ];
+
+	cab_archive_data_block_t data_block;
+
+	libcerror_error_t *error = NULL;
+	int result               = 0;
+
+	/* Test regular cases
+	 */
+	result = cab_archive_data_block_read_header(
+	          &data_block,
+	          &( assorted_test_cab_archive_data[ 131 ] ),
+	          CAB_ARCHIVE_DATA_BLOCK_HEADER_SIZE,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ASSORTED_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = cab_archive_data_block_verify_checksum(
+	          &data_block,
+	          &( assorted_test_cab_archive_data[ 139 ] ),
+	          33,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ASSORTED_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test compressed data that does not match the checksum
+	 */
+	if( memory_copy(
+	     compressed_data,
+	     &( assorted_test_cab_archive_data[ 139 ] ),
+	     33 ) == NULL )
+	{
+		goto on_error;
+	}
+	compressed_data[ 32 ] ^= 0x01;
+
+	result = cab_archive_data_block_verify_checksum(
+	          &data_block,
+	          compressed_data,
+	          33,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	ASSORTED_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test a data block without a checksum
+	 */
+	data_block.checksum = 0;
+
+	result = cab_archive_data_block_verify_checksum(
+	          &data_block,
+	          compressed_data,
+	          33,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ASSORTED_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = cab_archive_data_block_verify_checksum(
+	          NULL,
+	          compressed_data,
+	          33,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ASSORTED_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = cab_archive_data_block_verify_checksum(
+	          &data_block,
+	          compressed_data,
+	          32,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ASSORTED_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* The main program
+ */
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+int wmain(
+     int argc ASSORTED_TEST_ATTRIBUTE_UNUSED,
+     wchar_t * const argv[] ASSORTED_TEST_ATTRIBUTE_UNUSED )
+#else
+int main(
+     int argc ASSORTED_TEST_ATTRIBUTE_UNUSED,
+     char * const argv[] ASSORTED_TEST_ATTRIBUTE_UNUSED )
+#endif
+{
+	ASSORTED_TEST_UNREFERENCED_PARAMETER( argc )
+	ASSORTED_TEST_UNREFERENCED_PARAMETER( argv )
+
+	ASSORTED_TEST_RUN(
+	 "cab_archive_read_header",
+	 assorted_test_cab_archive_read_header );
+
+	ASSORTED_TEST_RUN(
+	 "cab_archive_folder_read",
+	 assorted_test_cab_archive_folder_read );
+
+	ASSORTED_TEST_RUN(
+	 "cab_archive_data_block_read_header",
+	 assorted_test_cab_archive_data_block_read_header );
+
+	ASSORTED_TEST_RUN(
+	 "cab_archive_calculate_checksum",
+	 assorted_test_cab_archive_calculate_checksum );
+
+	ASSORTED_TEST_RUN(
+	 "cab_archive_data_block_verify_checksum",
+	 assorted_test_cab_archive_data_block_verify_checksum );
+
+	return( EXIT_SUCCESS );
+
+on_error:
+	return( EXIT_FAILURE );
+}
+
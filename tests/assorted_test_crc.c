@@ -0,0 +1,760 @@
+/*
+ * Generic CRC functions testing program
+ *
+ * Copyright (C) 2009-2019, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This software is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This software is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this software.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <file_stream.h>
+#include <types.h>
+
+#if defined( HAVE_STDLIB_H ) || defined( WINAPI )
+#include <stdlib.h>
+#endif
+
+#include "assorted_test_libcerror.h"
+#include "assorted_test_macros.h"
+#include "assorted_test_unused.h"
+
+#include "../src/crc.h"
+
+/* The check string used by the CRC catalogues
+ */
+uint8_t assorted_test_crc_check_data[ 9 ] = {
+	'1', '2', '3', '4', '5', '6', '7', '8', '9' };
+
+/* Calculates a CRC bit by bit, as reference for the engine
+ * Returns the CRC
+ */
+uint64_t assorted_test_crc_calculate_bitwise(
+          const crc_parameters_t *parameters,
+          const uint8_t *buffer,
+          size_t size,
+          uint64_t initial_value )
+{
+	size_t buffer_offset = 0;
+	uint64_t crc         = 0;
+	uint64_t mask        = 0;
+	uint64_t top_bit     = 0;
+	uint64_t value       = 0;
+	uint8_t bit_index    = 0;
+	uint8_t byte_value   = 0;
+
+	mask    = ( (uint64_t) 0xffffffffffffffffULL ) >> ( 64 - parameters->width );
+	top_bit = (uint64_t) 1 << ( parameters->width - 1 );
+	crc     = initial_value ^ parameters->xor_value;
+
+	if( parameters->reflected != 0 )
+	{
+		/* Bring the register into normal bit order
+		 */
+		value = crc;
+		crc   = 0;
+
+		for( bit_index = 0;
+		     bit_index < parameters->width;
+		     bit_index++ )
+		{
+			crc <<= 1;
+			crc  |= ( value >> bit_index ) & 1;
+		}
+	}
+	for( buffer_offset = 0;
+	     buffer_offset < size;
+	     buffer_offset++ )
+	{
+		byte_value = buffer[ buffer_offset ];
+
+		for( bit_index = 0;
+		     bit_index < 8;
+		     bit_index++ )
+		{
+			if( parameters->reflected != 0 )
+			{
+				if( ( byte_value >> bit_index ) & 1 )
+				{
+					crc ^= top_bit;
+				}
+			}
+			else if( ( byte_value >> ( 7 - bit_index ) ) & 1 )
+			{
+				crc ^= top_bit;
+			}
+			if( ( crc & top_bit ) != 0 )
+			{
+				crc = ( ( crc << 1 ) ^ parameters->polynomial ) & mask;
+			}
+			else
+			{
+				crc = ( crc << 1 ) & mask;
+			}
+		}
+	}
+	if( parameters->reflected != 0 )
+	{
+		value = crc;
+		crc   = 0;
+
+		for( bit_index = 0;
+		     bit_index < parameters->width;
+		     bit_index++ )
+		{
+			crc <<= 1;
+			crc  |= ( value >> bit_index ) & 1;
+		}
+	}
+	return( crc ^ parameters->xor_value );
+}
+
+/* Tests the crc_engine_initialize function
+ * Returns 1 if successful or 0 if not
+ */
+int assorted_test_crc_engine_initialize(
+     void )
+{
+	crc_parameters_t parameters;
+
+	crc_engine_t *engine     = NULL;
+	libcerror_error_t *error = NULL;
+	int result               = 0;
+
+	/* Test regular cases
+	 */
+	result = crc_engine_initialize(
+	          &engine,
+	          &( crc_presets[ 0 ] ),
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ASSORTED_TEST_ASSERT_IS_NOT_NULL(
+	 "engine",
+	 engine );
+
+	ASSORTED_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = crc_engine_free(
+	          &engine,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ASSORTED_TEST_ASSERT_IS_NULL(
+	 "engine",
+	 engine );
+
+	ASSORTED_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = crc_engine_initialize(
+	          NULL,
+	          &( crc_presets[ 0 ] ),
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ASSORTED_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	engine = (crc_engine_t *) 0x12345678UL;
+
+	result = crc_engine_initialize(
+	          &engine,
+	          &( crc_presets[ 0 ] ),
+	          &error );
+
+	engine = NULL;
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ASSORTED_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = crc_engine_initialize(
+	          &engine,
+	          NULL,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ASSORTED_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	parameters.name          = "invalid";
+	parameters.width         = CRC_MINIMUM_WIDTH - 1;
+	parameters.polynomial    = 0x07;
+	parameters.reflected     = 0;
+	parameters.initial_value = 0;
+	parameters.xor_value     = 0;
+	parameters.check_value   = 0;
+
+	result = crc_engine_initialize(
+	          &engine,
+	          &parameters,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ASSORTED_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	parameters.width = CRC_MAXIMUM_WIDTH + 1;
+
+	result = crc_engine_initialize(
+	          &engine,
+	          &parameters,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ASSORTED_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	parameters.width      = 16;
+	parameters.polynomial = 0x11021;
+
+	result = crc_engine_initialize(
+	          &engine,
+	          &parameters,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ASSORTED_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	parameters.polynomial    = 0x1021;
+	parameters.initial_value = 0x10000;
+
+	result = crc_engine_initialize(
+	          &engine,
+	          &parameters,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ASSORTED_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	parameters.initial_value = 0;
+	parameters.xor_value     = 0x10000;
+
+	result = crc_engine_initialize(
+	          &engine,
+	          &parameters,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ASSORTED_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( engine != NULL )
+	{
+		crc_engine_free(
+		 &engine,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the crc_engine_calculate function with the check values of the presets
+ * Returns 1 if successful or 0 if not
+ */
+int assorted_test_crc_engine_calculate_presets(
+     void )
+{
+	crc_engine_t *engine     = NULL;
+	libcerror_error_t *error = NULL;
+	uint64_t calculated_crc  = 0;
+	int preset_index         = 0;
+	int result               = 0;
+
+	for( preset_index = 0;
+	     crc_presets[ preset_index ].name != NULL;
+	     preset_index++ )
+	{
+		result = crc_engine_initialize(
+		          &engine,
+		          &( crc_presets[ preset_index ] ),
+		          &error );
+
+		ASSORTED_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		result = crc_engine_calculate(
+		          engine,
+		          &calculated_crc,
+		          assorted_test_crc_check_data,
+		          9,
+		          engine->empty_data_crc,
+		          &error );
+
+		ASSORTED_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		ASSORTED_TEST_ASSERT_EQUAL_UINT64(
+		 "calculated_crc",
+		 calculated_crc,
+		 crc_presets[ preset_index ].check_value );
+
+		/* The CRC of empty data is the initial value of a new CRC
+		 */
+		result = crc_engine_calculate(
+		          engine,
+		          &calculated_crc,
+		          assorted_test_crc_check_data,
+		          0,
+		          engine->empty_data_crc,
+		          &error );
+
+		ASSORTED_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		ASSORTED_TEST_ASSERT_EQUAL_UINT64(
+		 "calculated_crc",
+		 calculated_crc,
+		 engine->empty_data_crc );
+
+		result = crc_engine_free(
+		          &engine,
+		          &error );
+
+		ASSORTED_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		ASSORTED_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+	}
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( engine != NULL )
+	{
+		crc_engine_free(
+		 &engine,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the crc_engine_calculate function against a bit by bit calculation
+ * Returns 1 if successful or 0 if not
+ */
+int assorted_test_crc_engine_calculate(
+     void )
+{
+	crc_parameters_t parameters;
+	uint8_t buffer[ 1031 ];
+
+	crc_engine_t *engine     = NULL;
+	libcerror_error_t *error = NULL;
+	size_t buffer_offset     = 0;
+	size_t buffer_size       = 0;
+	uint64_t calculated_crc  = 0;
+	uint64_t expected_crc    = 0;
+	int preset_index         = 0;
+	int result               = 0;
+
+	/* Initialize test
+	 */
+	for( buffer_offset = 0;
+	     buffer_offset < 1031;
+	     buffer_offset++ )
+	{
+		buffer[ buffer_offset ] = (uint8_t) ( ( buffer_offset * 7 ) + ( buffer_offset >> 3 ) );
+	}
+	/* The CRC-24/BLE model is not a preset and has an odd width
+	 */
+	parameters.name          = "crc-24/ble";
+	parameters.width         = 24;
+	parameters.polynomial    = 0x00065b;
+	parameters.reflected     = 1;
+	parameters.initial_value = 0x555555;
+	parameters.xor_value     = 0;
+	parameters.check_value   = 0xc25a56;
+
+	for( preset_index = -1;
+	     ( preset_index < 0 ) || ( crc_presets[ preset_index ].name != NULL );
+	     preset_index++ )
+	{
+		if( preset_index >= 0 )
+		{
+			parameters = crc_presets[ preset_index ];
+		}
+		result = crc_engine_initialize(
+		          &engine,
+		          &parameters,
+		          &error );
+
+		ASSORTED_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		/* Test regular cases
+		 */
+		for( buffer_size = 0;
+		     buffer_size <= 1024;
+		     buffer_size += 31 )
+		{
+			for( buffer_offset = 0;
+			     buffer_offset < 4;
+			     buffer_offset++ )
+			{
+				expected_crc = assorted_test_crc_calculate_bitwise(
+				                &parameters,
+				                &( buffer[ buffer_offset ] ),
+				                buffer_size,
+				                engine->empty_data_crc );
+
+				result = crc_engine_calculate(
+				          engine,
+				          &calculated_crc,
+				          &( buffer[ buffer_offset ] ),
+				          buffer_size,
+				          engine->empty_data_crc,
+				          &error );
+
+				ASSORTED_TEST_ASSERT_EQUAL_INT(
+				 "result",
+				 result,
+				 1 );
+
+				ASSORTED_TEST_ASSERT_EQUAL_UINT64(
+				 "calculated_crc",
+				 calculated_crc,
+				 expected_crc );
+			}
+		}
+		/* Test chaining with a previous value
+		 */
+		result = crc_engine_calculate(
+		          engine,
+		          &calculated_crc,
+		          buffer,
+		          517,
+		          engine->empty_data_crc,
+		          &error );
+
+		ASSORTED_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		result = crc_engine_calculate(
+		          engine,
+		          &calculated_crc,
+		          &( buffer[ 517 ] ),
+		          1031 - 517,
+		          calculated_crc,
+		          &error );
+
+		ASSORTED_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		expected_crc = assorted_test_crc_calculate_bitwise(
+		                &parameters,
+		                buffer,
+		                1031,
+		                engine->empty_data_crc );
+
+		ASSORTED_TEST_ASSERT_EQUAL_UINT64(
+		 "calculated_crc",
+		 calculated_crc,
+		 expected_crc );
+
+		result = crc_engine_free(
+		          &engine,
+		          &error );
+
+		ASSORTED_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		ASSORTED_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+	}
+	/* Test error cases
+	 */
+	result = crc_engine_initialize(
+	          &engine,
+	          &( crc_presets[ 0 ] ),
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	result = crc_engine_calculate(
+	          NULL,
+	          &calculated_crc,
+	          buffer,
+	          1031,
+	          0,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ASSORTED_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = crc_engine_calculate(
+	          engine,
+	          NULL,
+	          buffer,
+	          1031,
+	          0,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ASSORTED_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = crc_engine_calculate(
+	          engine,
+	          &calculated_crc,
+	          NULL,
+	          1031,
+	          0,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ASSORTED_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = crc_engine_calculate(
+	          engine,
+	          &calculated_crc,
+	          buffer,
+	          (size_t) SSIZE_MAX + 1,
+	          0,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ASSORTED_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = crc_engine_calculate(
+	          engine,
+	          &calculated_crc,
+	          buffer,
+	          1031,
+	          (uint64_t) 1 << crc_presets[ 0 ].width,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ASSORTED_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = crc_engine_free(
+	          &engine,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ASSORTED_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( engine != NULL )
+	{
+		crc_engine_free(
+		 &engine,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* The main program
+ */
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+int wmain(
+     int argc ASSORTED_TEST_ATTRIBUTE_UNUSED,
+     wchar_t * const argv[] ASSORTED_TEST_ATTRIBUTE_UNUSED )
+#else
+int main(
+     int argc ASSORTED_TEST_ATTRIBUTE_UNUSED,
+     char * const argv[] ASSORTED_TEST_ATTRIBUTE_UNUSED )
+#endif
+{
+	ASSORTED_TEST_UNREFERENCED_PARAMETER( argc )
+	ASSORTED_TEST_UNREFERENCED_PARAMETER( argv )
+
+	ASSORTED_TEST_RUN(
+	 "crc_engine_initialize",
+	 assorted_test_crc_engine_initialize );
+
+	ASSORTED_TEST_RUN(
+	 "crc_engine_calculate (presets)",
+	 assorted_test_crc_engine_calculate_presets );
+
+	ASSORTED_TEST_RUN(
+	 "crc_engine_calculate",
+	 assorted_test_crc_engine_calculate );
+
+	return( EXIT_SUCCESS );
+
+on_error:
+	return( EXIT_FAILURE );
+}
+
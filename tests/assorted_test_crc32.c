@@ -0,0 +1,1143 @@
+/*
+ * CRC-32 functions testing program
+ *
+ * Copyright (C) 2009-2019, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This software is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This software is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this software.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <file_stream.h>
+#include <types.h>
+
+#if defined( HAVE_STDLIB_H ) || defined( WINAPI )
+#include <stdlib.h>
+#endif
+
+#include "assorted_test_libcerror.h"
+#include "assorted_test_macros.h"
+#include "assorted_test_unused.h"
+
+#include "../src/crc32.h"
+
+typedef int (*assorted_test_crc32_calculate_function_t)(
+               uint32_t *crc32,
+               uint8_t *buffer,
+               size_t size,
+               uint32_t initial_value,
+               uint8_t weak_crc,
+               libcerror_error_t **error );
+
+/* The check string used by the CRC catalogues
+ */
+uint8_t assorted_test_crc32_check_data[ 9 ] = {
+	'1', '2', '3', '4', '5', '6', '7', '8', '9' };
+
+/* Tests a CRC-32 calculate function
+ * Returns 1 if successful or 0 if not
+ */
+int assorted_test_crc32_calculate_function(
+     assorted_test_crc32_calculate_function_t calculate_function )
+{
+	uint8_t buffer[ 1031 ];
+
+	libcerror_error_t *error  = NULL;
+	size_t buffer_offset      = 0;
+	size_t buffer_size        = 0;
+	uint32_t calculated_crc32 = 0;
+	uint32_t expected_crc32   = 0;
+	int result                = 0;
+
+	/* Initialize test
+	 */
+	for( buffer_offset = 0;
+	     buffer_offset < 1031;
+	     buffer_offset++ )
+	{
+		buffer[ buffer_offset ] = (uint8_t) ( ( buffer_offset * 7 ) + ( buffer_offset >> 3 ) );
+	}
+	/* Test regular cases
+	 */
+	result = calculate_function(
+	          &calculated_crc32,
+	          assorted_test_crc32_check_data,
+	          9,
+	          0,
+	          0,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ASSORTED_TEST_ASSERT_EQUAL_UINT32(
+	 "calculated_crc32",
+	 calculated_crc32,
+	 (uint32_t) 0xcbf43926UL );
+
+	ASSORTED_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test with all buffer sizes up to 64 bytes from unaligned offsets
+	 * to cover the head and trailing bytes
+	 */
+	for( buffer_size = 0;
+	     buffer_size <= 64;
+	     buffer_size++ )
+	{
+		for( buffer_offset = 0;
+		     buffer_offset < 8;
+		     buffer_offset++ )
+		{
+			result = crc32_calculate(
+			          &expected_crc32,
+			          &( buffer[ buffer_offset ] ),
+			          buffer_size,
+			          0x12345678UL,
+			          0,
+			          &error );
+
+			ASSORTED_TEST_ASSERT_EQUAL_INT(
+			 "result",
+			 result,
+			 1 );
+
+			result = calculate_function(
+			          &calculated_crc32,
+			          &( buffer[ buffer_offset ] ),
+			          buffer_size,
+			          0x12345678UL,
+			          0,
+			          &error );
+
+			ASSORTED_TEST_ASSERT_EQUAL_INT(
+			 "result",
+			 result,
+			 1 );
+
+			ASSORTED_TEST_ASSERT_EQUAL_UINT32(
+			 "calculated_crc32",
+			 calculated_crc32,
+			 expected_crc32 );
+		}
+	}
+	/* Test chaining with a previous value
+	 */
+	result = crc32_calculate(
+	          &expected_crc32,
+	          buffer,
+	          1031,
+	          0,
+	          1,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	result = calculate_function(
+	          &calculated_crc32,
+	          buffer,
+	          517,
+	          0,
+	          1,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	result = calculate_function(
+	          &calculated_crc32,
+	          &( buffer[ 517 ] ),
+	          1031 - 517,
+	          calculated_crc32,
+	          1,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ASSORTED_TEST_ASSERT_EQUAL_UINT32(
+	 "calculated_crc32",
+	 calculated_crc32,
+	 expected_crc32 );
+
+	ASSORTED_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = calculate_function(
+	          NULL,
+	          buffer,
+	          1031,
+	          0,
+	          0,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ASSORTED_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = calculate_function(
+	          &calculated_crc32,
+	          NULL,
+	          1031,
+	          0,
+	          0,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ASSORTED_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = calculate_function(
+	          &calculated_crc32,
+	          buffer,
+	          (size_t) SSIZE_MAX + 1,
+	          0,
+	          0,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ASSORTED_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the crc32_calculate function
+ * Returns 1 if successful or 0 if not
+ */
+int assorted_test_crc32_calculate(
+     void )
+{
+	return( assorted_test_crc32_calculate_function(
+	         crc32_calculate ) );
+}
+
+/* Tests the crc32_calculate_modulo2 function
+ * Returns 1 if successful or 0 if not
+ */
+int assorted_test_crc32_calculate_modulo2(
+     void )
+{
+	return( assorted_test_crc32_calculate_function(
+	         crc32_calculate_modulo2 ) );
+}
+
+/* Tests the crc32_calculate_slicing_by_8 function
+ * Returns 1 if successful or 0 if not
+ */
+int assorted_test_crc32_calculate_slicing_by_8(
+     void )
+{
+	return( assorted_test_crc32_calculate_function(
+	         crc32_calculate_slicing_by_8 ) );
+}
+
+/* Tests the crc32_calculate_slicing_by_16 function
+ * Returns 1 if successful or 0 if not
+ */
+int assorted_test_crc32_calculate_slicing_by_16(
+     void )
+{
+	return( assorted_test_crc32_calculate_function(
+	         crc32_calculate_slicing_by_16 ) );
+}
+
+/* Tests the crc32_calculate_hardware function
+ * Returns 1 if successful or 0 if not
+ */
+int assorted_test_crc32_calculate_hardware(
+     void )
+{
+	return( assorted_test_crc32_calculate_function(
+	         crc32_calculate_hardware ) );
+}
+
+/* Tests the crc32_calculate_hardware function with the CRC-32C (Castagnoli) polynomial
+ * Returns 1 if successful or 0 if not
+ */
+int assorted_test_crc32_calculate_hardware_castagnoli(
+     void )
+{
+	uint8_t buffer[ 1031 ];
+
+	libcerror_error_t *error  = NULL;
+	size_t buffer_offset      = 0;
+	size_t buffer_size        = 0;
+	uint32_t calculated_crc32 = 0;
+	uint32_t expected_crc32   = 0;
+	int result                = 0;
+
+	/* Initialize test
+	 */
+	for( buffer_offset = 0;
+	     buffer_offset < 1031;
+	     buffer_offset++ )
+	{
+		buffer[ buffer_offset ] = (uint8_t) ( ( buffer_offset * 13 ) + ( buffer_offset >> 5 ) );
+	}
+	initialize_crc32_table(
+	 0x82f63b78UL );
+
+	/* Test regular cases
+	 */
+	result = crc32_calculate_hardware(
+	          &calculated_crc32,
+	          assorted_test_crc32_check_data,
+	          9,
+	          0,
+	          0,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ASSORTED_TEST_ASSERT_EQUAL_UINT32(
+	 "calculated_crc32",
+	 calculated_crc32,
+	 (uint32_t) 0xe3069283UL );
+
+	ASSORTED_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	for( buffer_size = 0;
+	     buffer_size <= 1024;
+	     buffer_size += 7 )
+	{
+		result = crc32_calculate(
+		          &expected_crc32,
+		          &( buffer[ 3 ] ),
+		          buffer_size,
+		          0x87654321UL,
+		          0,
+		          &error );
+
+		ASSORTED_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		result = crc32_calculate_hardware(
+		          &calculated_crc32,
+		          &( buffer[ 3 ] ),
+		          buffer_size,
+		          0x87654321UL,
+		          0,
+		          &error );
+
+		ASSORTED_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		ASSORTED_TEST_ASSERT_EQUAL_UINT32(
+		 "calculated_crc32",
+		 calculated_crc32,
+		 expected_crc32 );
+	}
+	initialize_crc32_table(
+	 0xedb88320UL );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	initialize_crc32_table(
+	 0xedb88320UL );
+
+	return( 0 );
+}
+
+/* Tests the crc32_combine_values function
+ * Returns 1 if successful or 0 if not
+ */
+int assorted_test_crc32_combine(
+     void )
+{
+	uint8_t buffer[ 1031 ];
+
+	libcerror_error_t *error = NULL;
+	size_t buffer_offset     = 0;
+	size_t split_offset      = 0;
+	uint32_t combined_crc32  = 0;
+	uint32_t expected_crc32  = 0;
+	uint32_t first_crc32     = 0;
+	uint32_t second_crc32    = 0;
+	uint8_t weak_crc         = 0;
+	int result               = 0;
+
+	/* Initialize test
+	 */
+	for( buffer_offset = 0;
+	     buffer_offset < 1031;
+	     buffer_offset++ )
+	{
+		buffer[ buffer_offset ] = (uint8_t) ( ( buffer_offset * 11 ) + ( buffer_offset >> 4 ) );
+	}
+	/* Test regular cases
+	 */
+	for( weak_crc = 0;
+	     weak_crc <= 1;
+	     weak_crc++ )
+	{
+		result = crc32_calculate(
+		          &expected_crc32,
+		          buffer,
+		          1031,
+		          0x12345678UL,
+		          weak_crc,
+		          &error );
+
+		ASSORTED_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		for( split_offset = 0;
+		     split_offset <= 1031;
+		     split_offset += 103 )
+		{
+			result = crc32_calculate(
+			          &first_crc32,
+			          buffer,
+			          split_offset,
+			          0x12345678UL,
+			          weak_crc,
+			          &error );
+
+			ASSORTED_TEST_ASSERT_EQUAL_INT(
+			 "result",
+			 result,
+			 1 );
+
+			result = crc32_calculate(
+			          &second_crc32,
+			          &( buffer[ split_offset ] ),
+			          1031 - split_offset,
+			          0,
+			          weak_crc,
+			          &error );
+
+			ASSORTED_TEST_ASSERT_EQUAL_INT(
+			 "result",
+			 result,
+			 1 );
+
+			result = crc32_combine_values(
+			          &combined_crc32,
+			          first_crc32,
+			          second_crc32,
+			          (size64_t) ( 1031 - split_offset ),
+			          &error );
+
+			ASSORTED_TEST_ASSERT_EQUAL_INT(
+			 "result",
+			 result,
+			 1 );
+
+			ASSORTED_TEST_ASSERT_EQUAL_UINT32(
+			 "combined_crc32",
+			 combined_crc32,
+			 expected_crc32 );
+
+			ASSORTED_TEST_ASSERT_IS_NULL(
+			 "error",
+			 error );
+		}
+	}
+	/* Test with the CRC-32C (Castagnoli) polynomial
+	 */
+	initialize_crc32_table(
+	 0x82f63b78UL );
+
+	result = crc32_calculate(
+	          &first_crc32,
+	          assorted_test_crc32_check_data,
+	          4,
+	          0,
+	          0,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	result = crc32_calculate(
+	          &second_crc32,
+	          &( assorted_test_crc32_check_data[ 4 ] ),
+	          5,
+	          0,
+	          0,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	result = crc32_combine_values(
+	          &combined_crc32,
+	          first_crc32,
+	          second_crc32,
+	          5,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ASSORTED_TEST_ASSERT_EQUAL_UINT32(
+	 "combined_crc32",
+	 combined_crc32,
+	 (uint32_t) 0xe3069283UL );
+
+	initialize_crc32_table(
+	 0xedb88320UL );
+
+	/* Test error cases
+	 */
+	result = crc32_combine_values(
+	          NULL,
+	          first_crc32,
+	          second_crc32,
+	          5,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ASSORTED_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	initialize_crc32_table(
+	 0xedb88320UL );
+
+	return( 0 );
+}
+
+/* Tests the crc32_validate function
+ * Returns 1 if successful or 0 if not
+ */
+int assorted_test_crc32_validate(
+     void )
+{
+	libcerror_error_t *error = NULL;
+	uint8_t bit_index        = 0;
+	uint8_t expected_index   = 0;
+	int result               = 0;
+
+	/* Test regular cases
+	 */
+	result = crc32_validate(
+	          0x12345678UL,
+	          0x12345678UL,
+	          &bit_index,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	ASSORTED_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	for( expected_index = 0;
+	     expected_index < 32;
+	     expected_index++ )
+	{
+		result = crc32_validate(
+		          0x12345678UL ^ ( (uint32_t) 1 << expected_index ),
+		          0x12345678UL,
+		          &bit_index,
+		          &error );
+
+		ASSORTED_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		ASSORTED_TEST_ASSERT_EQUAL_UINT8(
+		 "bit_index",
+		 bit_index,
+		 expected_index );
+
+		ASSORTED_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+	}
+	result = crc32_validate(
+	          0x12345678UL ^ 0x00000101UL,
+	          0x12345678UL,
+	          &bit_index,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	ASSORTED_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = crc32_validate(
+	          0x12345678UL,
+	          0x12345678UL,
+	          NULL,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ASSORTED_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the crc32_locate_error_offset function
+ * Returns 1 if successful or 0 if not
+ */
+int assorted_test_crc32_locate_error_offset(
+     void )
+{
+	uint8_t buffer[ 1031 ];
+
+	libcerror_error_t *error     = NULL;
+	uint64_t bit_offset          = 0;
+	uint64_t expected_bit_offset = 0;
+	size_t buffer_offset         = 0;
+	uint32_t calculated_crc32    = 0;
+	uint32_t expected_crc32      = 0;
+	int result                   = 0;
+
+	/* Initialize test
+	 */
+	for( buffer_offset = 0;
+	     buffer_offset < 1031;
+	     buffer_offset++ )
+	{
+		buffer[ buffer_offset ] = (uint8_t) ( ( buffer_offset * 11 ) + ( buffer_offset >> 4 ) );
+	}
+	result = crc32_calculate(
+	          &expected_crc32,
+	          buffer,
+	          1031,
+	          0,
+	          1,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	/* Test regular cases
+	 */
+	for( expected_bit_offset = 0;
+	     expected_bit_offset < ( 1031 * 8 );
+	     expected_bit_offset += 97 )
+	{
+		buffer[ expected_bit_offset / 8 ] ^= (uint8_t) ( 1 << ( expected_bit_offset % 8 ) );
+
+		result = crc32_calculate(
+		          &calculated_crc32,
+		          buffer,
+		          1031,
+		          0,
+		          1,
+		          &error );
+
+		buffer[ expected_bit_offset / 8 ] ^= (uint8_t) ( 1 << ( expected_bit_offset % 8 ) );
+
+		ASSORTED_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		result = crc32_locate_error_offset(
+		          expected_crc32,
+		          calculated_crc32,
+		          1031,
+		          &bit_offset,
+		          &error );
+
+		ASSORTED_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		ASSORTED_TEST_ASSERT_EQUAL_UINT64(
+		 "bit_offset",
+		 bit_offset,
+		 expected_bit_offset );
+
+		ASSORTED_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+	}
+	result = crc32_locate_error_offset(
+	          expected_crc32,
+	          expected_crc32 ^ 0x00000101UL,
+	          1031,
+	          &bit_offset,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	ASSORTED_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = crc32_locate_error_offset(
+	          expected_crc32,
+	          calculated_crc32,
+	          1031,
+	          NULL,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ASSORTED_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the crc32_syndrome_table functions
+ * Returns 1 if successful or 0 if not
+ */
+int assorted_test_crc32_syndrome_table(
+     void )
+{
+	uint8_t buffer[ 1031 ];
+
+	libcerror_error_t *error               = NULL;
+	crc32_syndrome_table_t *syndrome_table = NULL;
+	uint64_t expected_first_bit_offset     = 0;
+	uint64_t expected_second_bit_offset    = 0;
+	uint64_t first_bit_offset              = 0;
+	uint64_t second_bit_offset             = 0;
+	size_t buffer_offset                   = 0;
+	uint32_t calculated_crc32              = 0;
+	uint32_t expected_crc32                = 0;
+	int result                             = 0;
+
+	/* Initialize test
+	 */
+	for( buffer_offset = 0;
+	     buffer_offset < 1031;
+	     buffer_offset++ )
+	{
+		buffer[ buffer_offset ] = (uint8_t) ( ( buffer_offset * 11 ) + ( buffer_offset >> 4 ) );
+	}
+	result = crc32_calculate(
+	          &expected_crc32,
+	          buffer,
+	          1031,
+	          0,
+	          0,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	result = crc32_syndrome_table_initialize(
+	          &syndrome_table,
+	          2048,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ASSORTED_TEST_ASSERT_IS_NOT_NULL(
+	 "syndrome_table",
+	 syndrome_table );
+
+	ASSORTED_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases of single-bit errors
+	 */
+	for( expected_first_bit_offset = 0;
+	     expected_first_bit_offset < ( 1031 * 8 );
+	     expected_first_bit_offset += 89 )
+	{
+		buffer[ expected_first_bit_offset / 8 ] ^= (uint8_t) ( 1 << ( expected_first_bit_offset % 8 ) );
+
+		result = crc32_calculate(
+		          &calculated_crc32,
+		          buffer,
+		          1031,
+		          0,
+		          0,
+		          &error );
+
+		buffer[ expected_first_bit_offset / 8 ] ^= (uint8_t) ( 1 << ( expected_first_bit_offset % 8 ) );
+
+		ASSORTED_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		result = crc32_syndrome_table_locate_error_offset(
+		          syndrome_table,
+		          expected_crc32,
+		          calculated_crc32,
+		          1031,
+		          &first_bit_offset,
+		          &error );
+
+		ASSORTED_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		ASSORTED_TEST_ASSERT_EQUAL_UINT64(
+		 "first_bit_offset",
+		 first_bit_offset,
+		 expected_first_bit_offset );
+
+		ASSORTED_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+	}
+	/* Test regular cases of double-bit errors
+	 */
+	for( expected_first_bit_offset = 3;
+	     expected_first_bit_offset < ( 1031 * 8 );
+	     expected_first_bit_offset += 1021 )
+	{
+		for( expected_second_bit_offset = expected_first_bit_offset + 1;
+		     expected_second_bit_offset < ( 1031 * 8 );
+		     expected_second_bit_offset += 797 )
+		{
+			buffer[ expected_first_bit_offset / 8 ] ^= (uint8_t) ( 1 << ( expected_first_bit_offset % 8 ) );
+			buffer[ expected_second_bit_offset / 8 ] ^= (uint8_t) ( 1 << ( expected_second_bit_offset % 8 ) );
+
+			result = crc32_calculate(
+			          &calculated_crc32,
+			          buffer,
+			          1031,
+			          0,
+			          0,
+			          &error );
+
+			buffer[ expected_first_bit_offset / 8 ] ^= (uint8_t) ( 1 << ( expected_first_bit_offset % 8 ) );
+			buffer[ expected_second_bit_offset / 8 ] ^= (uint8_t) ( 1 << ( expected_second_bit_offset % 8 ) );
+
+			ASSORTED_TEST_ASSERT_EQUAL_INT(
+			 "result",
+			 result,
+			 1 );
+
+			result = crc32_syndrome_table_locate_double_error_offsets(
+			          syndrome_table,
+			          expected_crc32,
+			          calculated_crc32,
+			          1031,
+			          &first_bit_offset,
+			          &second_bit_offset,
+			          &error );
+
+			ASSORTED_TEST_ASSERT_EQUAL_INT(
+			 "result",
+			 result,
+			 1 );
+
+			ASSORTED_TEST_ASSERT_EQUAL_UINT64(
+			 "first_bit_offset",
+			 first_bit_offset,
+			 expected_first_bit_offset );
+
+			ASSORTED_TEST_ASSERT_EQUAL_UINT64(
+			 "second_bit_offset",
+			 second_bit_offset,
+			 expected_second_bit_offset );
+
+			ASSORTED_TEST_ASSERT_IS_NULL(
+			 "error",
+			 error );
+		}
+	}
+	/* Test error cases
+	 */
+	result = crc32_syndrome_table_locate_error_offset(
+	          syndrome_table,
+	          expected_crc32,
+	          calculated_crc32,
+	          4096,
+	          &first_bit_offset,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ASSORTED_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = crc32_syndrome_table_locate_error_offset(
+	          NULL,
+	          expected_crc32,
+	          calculated_crc32,
+	          1031,
+	          &first_bit_offset,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ASSORTED_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = crc32_syndrome_table_initialize(
+	          &syndrome_table,
+	          2048,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ASSORTED_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = crc32_syndrome_table_free(
+	          &syndrome_table,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ASSORTED_TEST_ASSERT_IS_NULL(
+	 "syndrome_table",
+	 syndrome_table );
+
+	ASSORTED_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( syndrome_table != NULL )
+	{
+		crc32_syndrome_table_free(
+		 &syndrome_table,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* The main program
+ */
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+int wmain(
+     int argc ASSORTED_TEST_ATTRIBUTE_UNUSED,
+     wchar_t * const argv[] ASSORTED_TEST_ATTRIBUTE_UNUSED )
+#else
+int main(
+     int argc ASSORTED_TEST_ATTRIBUTE_UNUSED,
+     char * const argv[] ASSORTED_TEST_ATTRIBUTE_UNUSED )
+#endif
+{
+	ASSORTED_TEST_UNREFERENCED_PARAMETER( argc )
+	ASSORTED_TEST_UNREFERENCED_PARAMETER( argv )
+
+	initialize_crc32_table(
+	 0xedb88320UL );
+
+	ASSORTED_TEST_RUN(
+	 "crc32_calculate",
+	 assorted_test_crc32_calculate );
+
+	ASSORTED_TEST_RUN(
+	 "crc32_calculate_modulo2",
+	 assorted_test_crc32_calculate_modulo2 );
+
+	ASSORTED_TEST_RUN(
+	 "crc32_calculate_slicing_by_8",
+	 assorted_test_crc32_calculate_slicing_by_8 );
+
+	ASSORTED_TEST_RUN(
+	 "crc32_calculate_slicing_by_16",
+	 assorted_test_crc32_calculate_slicing_by_16 );
+
+	ASSORTED_TEST_RUN(
+	 "crc32_calculate_hardware",
+	 assorted_test_crc32_calculate_hardware );
+
+	ASSORTED_TEST_RUN(
+	 "crc32_calculate_hardware (Castagnoli)",
+	 assorted_test_crc32_calculate_hardware_castagnoli );
+
+	ASSORTED_TEST_RUN(
+	 "crc32_combine_values",
+	 assorted_test_crc32_combine );
+
+	ASSORTED_TEST_RUN(
+	 "crc32_validate",
+	 assorted_test_crc32_validate );
+
+	ASSORTED_TEST_RUN(
+	 "crc32_locate_error_offset",
+	 assorted_test_crc32_locate_error_offset );
+
+	ASSORTED_TEST_RUN(
+	 "crc32_syndrome_table",
+	 assorted_test_crc32_syndrome_table );
+
+	return( EXIT_SUCCESS );
+
+on_error:
+	return( EXIT_FAILURE );
+}
+
@@ -0,0 +1,525 @@
+/*
+ * CRC-64 functions testing program
+ *
+ * Copyright (C) 2009-2019, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This software is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This software is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this software.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <file_stream.h>
+#include <types.h>
+
+#if defined( HAVE_STDLIB_H ) || defined( WINAPI )
+#include <stdlib.h>
+#endif
+
+#include "assorted_test_libcerror.h"
+#include "assorted_test_macros.h"
+#include "assorted_test_unused.h"
+
+#include "../src/crc64.h"
+
+typedef int (*assorted_test_crc64_calculate_function_t)(
+               uint64_t *crc64,
+               uint8_t *buffer,
+               size_t size,
+               uint64_t initial_value,
+               libcerror_error_t **error );
+
+/* The check string used by the CRC catalogues
+ */
+uint8_t assorted_test_crc64_check_data[ 9 ] = {
+	'1', '2', '3', '4', '5', '6', '7', '8', '9' };
+
+/* Tests a CRC-64 calculate function against crc64_calculate_2
+ * Returns 1 if successful or 0 if not
+ */
+int assorted_test_crc64_calculate_function(
+     assorted_test_crc64_calculate_function_t calculate_function )
+{
+	uint8_t buffer[ 1031 ];
+
+	libcerror_error_t *error  = NULL;
+	size_t buffer_offset      = 0;
+	size_t buffer_size        = 0;
+	uint64_t calculated_crc64 = 0;
+	uint64_t expected_crc64   = 0;
+	int result                = 0;
+
+	/* Initialize test
+	 */
+	for( buffer_offset = 0;
+	     buffer_offset < 1031;
+	     buffer_offset++ )
+	{
+		buffer[ buffer_offset ] = (uint8_t) ( ( buffer_offset * 7 ) + ( buffer_offset >> 3 ) );
+	}
+	/* Test regular cases
+	 */
+	for( buffer_size = 0;
+	     buffer_size <= 1024;
+	     buffer_size += 5 )
+	{
+		for( buffer_offset = 0;
+		     buffer_offset < 4;
+		     buffer_offset++ )
+		{
+			result = crc64_calculate_2(
+			          &expected_crc64,
+			          &( buffer[ buffer_offset ] ),
+			          buffer_size,
+			          0x123456789abcdef0ULL,
+			          &error );
+
+			ASSORTED_TEST_ASSERT_EQUAL_INT(
+			 "result",
+			 result,
+			 1 );
+
+			result = calculate_function(
+			          &calculated_crc64,
+			          &( buffer[ buffer_offset ] ),
+			          buffer_size,
+			          0x123456789abcdef0ULL,
+			          &error );
+
+			ASSORTED_TEST_ASSERT_EQUAL_INT(
+			 "result",
+			 result,
+			 1 );
+
+			ASSORTED_TEST_ASSERT_EQUAL_UINT64(
+			 "calculated_crc64",
+			 calculated_crc64,
+			 expected_crc64 );
+		}
+	}
+	/* Test chaining with a previous value
+	 */
+	result = calculate_function(
+	          &calculated_crc64,
+	          buffer,
+	          517,
+	          0,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	result = calculate_function(
+	          &calculated_crc64,
+	          &( buffer[ 517 ] ),
+	          1031 - 517,
+	          calculated_crc64,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	result = crc64_calculate_2(
+	          &expected_crc64,
+	          buffer,
+	          1031,
+	          0,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ASSORTED_TEST_ASSERT_EQUAL_UINT64(
+	 "calculated_crc64",
+	 calculated_crc64,
+	 expected_crc64 );
+
+	ASSORTED_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = calculate_function(
+	          NULL,
+	          buffer,
+	          1031,
+	          0,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ASSORTED_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = calculate_function(
+	          &calculated_crc64,
+	          NULL,
+	          1031,
+	          0,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ASSORTED_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = calculate_function(
+	          &calculated_crc64,
+	          buffer,
+	          (size_t) SSIZE_MAX + 1,
+	          0,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ASSORTED_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests a CRC-64 calculate function with the CRC-64/XZ (ECMA-182) polynomial
+ * Returns 1 if successful or 0 if not
+ */
+int assorted_test_crc64_calculate_function_xz(
+     assorted_test_crc64_calculate_function_t calculate_function )
+{
+	libcerror_error_t *error  = NULL;
+	uint64_t calculated_crc64 = 0;
+	int result                = 0;
+
+	result = calculate_function(
+	          &calculated_crc64,
+	          assorted_test_crc64_check_data,
+	          9,
+	          0xffffffffffffffffULL,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	calculated_crc64 ^= (uint64_t) 0xffffffffffffffffULL;
+
+	ASSORTED_TEST_ASSERT_EQUAL_UINT64(
+	 "calculated_crc64",
+	 calculated_crc64,
+	 (uint64_t) 0x995dc9bbdf1939faULL );
+
+	ASSORTED_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the crc64_calculate_1 function
+ * Returns 1 if successful or 0 if not
+ */
+int assorted_test_crc64_calculate_1(
+     void )
+{
+	libcerror_error_t *error  = NULL;
+	uint64_t calculated_crc64 = 0;
+	uint64_t expected_crc64   = 0;
+	int result                = 0;
+
+	/* Test regular cases
+	 */
+	result = crc64_calculate_1(
+	          &calculated_crc64,
+	          assorted_test_crc64_check_data,
+	          9,
+	          0,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ASSORTED_TEST_ASSERT_EQUAL_UINT64(
+	 "calculated_crc64",
+	 calculated_crc64,
+	 (uint64_t) 0x6f3b579a0d209385ULL );
+
+	ASSORTED_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Method 1 is not a reflected CRC-64 and its result differs from
+	 * crc64_calculate_2 and the methods that are equivalent to it
+	 */
+	result = crc64_calculate_2(
+	          &expected_crc64,
+	          assorted_test_crc64_check_data,
+	          9,
+	          0,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ASSORTED_TEST_ASSERT_EQUAL_UINT64(
+	 "expected_crc64",
+	 expected_crc64,
+	 (uint64_t) 0x7800c064d4a83784ULL );
+
+	ASSORTED_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = crc64_calculate_hardware(
+	          &calculated_crc64,
+	          assorted_test_crc64_check_data,
+	          9,
+	          0,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ASSORTED_TEST_ASSERT_EQUAL_UINT64(
+	 "calculated_crc64",
+	 calculated_crc64,
+	 expected_crc64 );
+
+	ASSORTED_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test chaining with a previous value
+	 */
+	result = crc64_calculate_1(
+	          &calculated_crc64,
+	          assorted_test_crc64_check_data,
+	          4,
+	          0,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	result = crc64_calculate_1(
+	          &calculated_crc64,
+	          &( assorted_test_crc64_check_data[ 4 ] ),
+	          5,
+	          calculated_crc64,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ASSORTED_TEST_ASSERT_EQUAL_UINT64(
+	 "calculated_crc64",
+	 calculated_crc64,
+	 (uint64_t) 0x6f3b579a0d209385ULL );
+
+	ASSORTED_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = crc64_calculate_1(
+	          NULL,
+	          assorted_test_crc64_check_data,
+	          9,
+	          0,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ASSORTED_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = crc64_calculate_1(
+	          &calculated_crc64,
+	          NULL,
+	          9,
+	          0,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ASSORTED_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the crc64_calculate_slicing_by_8 function
+ * Returns 1 if successful or 0 if not
+ */
+int assorted_test_crc64_calculate_slicing_by_8(
+     void )
+{
+	return( assorted_test_crc64_calculate_function(
+	         crc64_calculate_slicing_by_8 ) );
+}
+
+/* Tests the crc64_calculate_hardware function
+ * Returns 1 if successful or 0 if not
+ */
+int assorted_test_crc64_calculate_hardware(
+     void )
+{
+	return( assorted_test_crc64_calculate_function(
+	         crc64_calculate_hardware ) );
+}
+
+/* Tests the CRC-64 calculate functions with the CRC-64/XZ polynomial
+ * Returns 1 if successful or 0 if not
+ */
+int assorted_test_crc64_calculate_xz(
+     void )
+{
+	int result = 0;
+
+	initialize_crc64_table(
+	 0xc96c5795d7870f42ULL );
+
+	result = assorted_test_crc64_calculate_function_xz(
+	          crc64_calculate_2 );
+
+	if( result == 1 )
+	{
+		result = assorted_test_crc64_calculate_function_xz(
+		          crc64_calculate_slicing_by_8 );
+	}
+	if( result == 1 )
+	{
+		result = assorted_test_crc64_calculate_function_xz(
+		          crc64_calculate_hardware );
+	}
+	if( result == 1 )
+	{
+		result = assorted_test_crc64_calculate_function(
+		          crc64_calculate_hardware );
+	}
+	return( result );
+}
+
+/* The main program
+ */
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+int wmain(
+     int argc ASSORTED_TEST_ATTRIBUTE_UNUSED,
+     wchar_t * const argv[] ASSORTED_TEST_ATTRIBUTE_UNUSED )
+#else
+int main(
+     int argc ASSORTED_TEST_ATTRIBUTE_UNUSED,
+     char * const argv[] ASSORTED_TEST_ATTRIBUTE_UNUSED )
+#endif
+{
+	ASSORTED_TEST_UNREFERENCED_PARAMETER( argc )
+	ASSORTED_TEST_UNREFERENCED_PARAMETER( argv )
+
+	ASSORTED_TEST_RUN(
+	 "crc64_calculate_1",
+	 assorted_test_crc64_calculate_1 );
+
+	ASSORTED_TEST_RUN(
+	 "crc64_calculate_slicing_by_8",
+	 assorted_test_crc64_calculate_slicing_by_8 );
+
+	ASSORTED_TEST_RUN(
+	 "crc64_calculate_hardware",
+	 assorted_test_crc64_calculate_hardware );
+
+	ASSORTED_TEST_RUN(
+	 "crc64_calculate (CRC-64/XZ)",
+	 assorted_test_crc64_calculate_xz );
+
+	return( EXIT_SUCCESS );
+
+on_error:
+	return( EXIT_FAILURE );
+}
+
@@ -34,6 +34,8 @@
 #include "assorted_test_unused.h"
 
 #include "../src/deflate.h"
+#include "../src/deflate_stream.h"
+#include "../src/deflate_tables.h"
 
 /* Define to make assorted_test_deflate generate verbose output
 #define ASSORTED_TEST_DEFLATE
@@ -735,10 +737,10 @@ int assorted_test_deflate_bit_stream_get_value(
 	 bit_stream.byte_stream_offset,
 	 (size_t) 0 );
 
-	ASSORTED_TEST_ASSERT_EQUAL_UINT32(
+	ASSORTED_TEST_ASSERT_EQUAL_UINT64(
 	 "bit_stream.bit_buffer",
 	 bit_stream.bit_buffer,
-	 (uint32_t) 0x00000000UL );
+	 (uint64_t) 0x0000000000000000ULL );
 
 	ASSORTED_TEST_ASSERT_EQUAL_UINT8(
 	 "bit_stream.bit_buffer_size",
@@ -768,17 +770,17 @@ int assorted_test_deflate_bit_stream_get_value(
 	ASSORTED_TEST_ASSERT_EQUAL_SIZE(
 	 "bit_stream.byte_stream_offset",
 	 bit_stream.byte_stream_offset,
-	 (size_t) 1 );
+	 (size_t) 7 );
 
-	ASSORTED_TEST_ASSERT_EQUAL_UINT32(
+	ASSORTED_TEST_ASSERT_EQUAL_UINT64(
 	 "bit_stream.bit_buffer",
 	 bit_stream.bit_buffer,
-	 (uint32_t) 0x00000007UL );
+	 (uint64_t) 0x000db8f6d59bdda7ULL );
 
 	ASSORTED_TEST_ASSERT_EQUAL_UINT8(
 	 "bit_stream.bit_buffer_size",
 	 bit_stream.bit_buffer_size,
-	 (uint8_t) 4 );
+	 (uint8_t) 52 );
 
 	result = deflate_bit_stream_get_value(
 	          &bit_stream,
@@ -803,17 +805,17 @@ int assorted_test_deflate_bit_stream_get_value(
 	ASSORTED_TEST_ASSERT_EQUAL_SIZE(
 	 "bit_stream.byte_stream_offset",
 	 bit_stream.byte_stream_offset,
-	 (size_t) 2 );
+	 (size_t) 7 );
 
-	ASSORTED_TEST_ASSERT_EQUAL_UINT32(
+	ASSORTED_TEST_ASSERT_EQUAL_UINT64(
 	 "bit_stream.bit_buffer",
 	 bit_stream.bit_buffer,
-	 (uint32_t) 0x00000000UL );
+	 (uint64_t) 0x000000db8f6d59bdULL );
 
 	ASSORTED_TEST_ASSERT_EQUAL_UINT8(
 	 "bit_stream.bit_buffer_size",
 	 bit_stream.bit_buffer_size,
-	 (uint8_t) 0 );
+	 (uint8_t) 40 );
 
 	result = deflate_bit_stream_get_value(
 	          &bit_stream,
@@ -838,17 +840,17 @@ int assorted_test_deflate_bit_stream_get_value(
 	ASSORTED_TEST_ASSERT_EQUAL_SIZE(
 	 "bit_stream.byte_stream_offset",
 	 bit_stream.byte_stream_offset,
-	 (size_t) 6 );
+	 (size_t) 7 );
 
-	ASSORTED_TEST_ASSERT_EQUAL_UINT32(
+	ASSORTED_TEST_ASSERT_EQUAL_UINT64(
 	 "bit_stream.bit_buffer",
 	 bit_stream.bit_buffer,
-	 (uint32_t) 0x00000000UL );
+	 (uint64_t) 0x00000000000000dbULL );
 
 	ASSORTED_TEST_ASSERT_EQUAL_UINT8(
 	 "bit_stream.bit_buffer_size",
 	 bit_stream.bit_buffer_size,
-	 (uint8_t) 0 );
+	 (uint8_t) 8 );
 
 	/* Test error cases
 	 */
@@ -945,12 +947,12 @@ int assorted_test_deflate_huffman_table_construct(
 
 	deflate_huffman_table_t table;
 
-	libcerror_error_t *error        = NULL;
-	uint16_t symbol                 = 0;
-	int result                      = 0;
+	libcerror_error_t *error = NULL;
+	uint16_t symbol          = 0;
+	int result               = 0;
 
 #if defined( HAVE_ASSORTED_TEST_MEMORY )
-	int number_of_memset_fail_tests = 2;
+	int number_of_memset_fail_tests = 3;
 	int test_number                 = 0;
 #endif
 
@@ -1105,12 +1107,20 @@ on_error:
 int assorted_test_deflate_bit_stream_get_huffman_encoded_value(
      void )
 {
+	uint8_t long_codes_byte_stream[ 6 ] = {
+		0xff, 0xff, 0xff, 0xdf, 0x7f, 0x00 };
+
+	uint32_t expected_symbols[ 4 ]      = { 15, 14, 9, 0 };
+	uint16_t code_size_array[ 16 ];
+
 	deflate_bit_stream_t bit_stream;
 	deflate_huffman_table_t distances_table;
 	deflate_huffman_table_t literals_table;
+	deflate_huffman_table_t long_codes_table;
 
 	libcerror_error_t *error = NULL;
 	uint32_t value_32bit     = 0;
+	uint16_t symbol          = 0;
 	int result               = 0;
 
 	/* Initialize test
@@ -1159,6 +1169,74 @@ int assorted_test_deflate_bit_stream_get_huffman_encoded_value(
 	 "error",
 	 error );
 
+	/* Test Huffman codes that are larger than the primary lookup table
+	 */
+	for( symbol = 0;
+	     symbol < 16;
+	     symbol++ )
+	{
+		if( symbol < 15 )
+		{
+			code_size_array[ symbol ] = symbol + 1;
+		}
+		else
+		{
+			code_size_array[ symbol ] = 15;
+		}
+	}
+	result = deflate_huffman_table_construct(
+	          &long_codes_table,
+	          code_size_array,
+	          16,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ASSORTED_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	bit_stream.byte_stream        = long_codes_byte_stream;
+	bit_stream.byte_stream_size   = 6;
+	bit_stream.byte_stream_offset = 0;
+	bit_stream.bit_buffer         = 0;
+	bit_stream.bit_buffer_size    = 0;
+
+	for( symbol = 0;
+	     symbol < 4;
+	     symbol++ )
+	{
+		value_32bit = 0;
+
+		result = deflate_bit_stream_get_huffman_encoded_value(
+		          &bit_stream,
+		          &long_codes_table,
+		          &value_32bit,
+		          &error );
+
+		ASSORTED_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		ASSORTED_TEST_ASSERT_EQUAL_UINT32(
+		 "value_32bit",
+		 value_32bit,
+		 expected_symbols[ symbol ] );
+
+		ASSORTED_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+	}
+	bit_stream.byte_stream        = assorted_test_deflate_compressed_byte_stream;
+	bit_stream.byte_stream_size   = 2627;
+	bit_stream.byte_stream_offset = 2;
+	bit_stream.bit_buffer         = 0;
+	bit_stream.bit_buffer_size    = 0;
+
 	/* Test error cases
 	 */
 	value_32bit = 0;
@@ -1256,8 +1334,8 @@ int assorted_test_deflate_initialize_dynamic_huffman_tables(
 	deflate_huffman_table_t distances_table;
 	deflate_huffman_table_t literals_table;
 
-	libcerror_error_t *error        = NULL;
-	int result                      = 0;
+	libcerror_error_t *error = NULL;
+	int result               = 0;
 
 #if defined( HAVE_ASSORTED_TEST_MEMORY )
 	int number_of_memset_fail_tests = 6;
@@ -1375,8 +1453,8 @@ int assorted_test_deflate_initialize_fixed_huffman_tables(
 	deflate_huffman_table_t distances_table;
 	deflate_huffman_table_t literals_table;
 
-	libcerror_error_t *error        = NULL;
-	int result                      = 0;
+	libcerror_error_t *error = NULL;
+	int result               = 0;
 
 #if defined( HAVE_ASSORTED_TEST_MEMORY )
 	int number_of_memset_fail_tests = 4;
@@ -1477,6 +1555,117 @@ on_error:
 	return( 0 );
 }
 
+/* Tests the deflate_fixed_huffman_literals_table and deflate_fixed_huffman_distances_table
+ * Returns 1 if successful or 0 if not
+ */
+int assorted_test_deflate_fixed_huffman_tables(
+     void )
+{
+	deflate_huffman_table_t distances_table;
+	deflate_huffman_table_t literals_table;
+
+	libcerror_error_t *error = NULL;
+	int result               = 0;
+
+	/* Test that the static tables match the constructed tables
+	 */
+	result = deflate_initialize_fixed_huffman_tables(
+	          &literals_table,
+	          &distances_table,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ASSORTED_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "deflate_fixed_huffman_literals_table.number_of_codes",
+	 deflate_fixed_huffman_literals_table.number_of_codes,
+	 literals_table.number_of_codes );
+
+	/* Only the primary lookup table is set since the fixed Huffman codes are at most 9 bits
+	 */
+	result = memory_compare(
+	          deflate_fixed_huffman_literals_table.codes_array,
+	          literals_table.codes_array,
+	          sizeof( int ) * 288 );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	result = memory_compare(
+	          deflate_fixed_huffman_literals_table.code_counts_array,
+	          literals_table.code_counts_array,
+	          sizeof( int ) * 16 );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	result = memory_compare(
+	          deflate_fixed_huffman_literals_table.lookup_table,
+	          literals_table.lookup_table,
+	          sizeof( uint16_t ) << DEFLATE_HUFFMAN_LOOKUP_TABLE_NUMBER_OF_BITS );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "deflate_fixed_huffman_distances_table.number_of_codes",
+	 deflate_fixed_huffman_distances_table.number_of_codes,
+	 distances_table.number_of_codes );
+
+	result = memory_compare(
+	          deflate_fixed_huffman_distances_table.codes_array,
+	          distances_table.codes_array,
+	          sizeof( int ) * 288 );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	result = memory_compare(
+	          deflate_fixed_huffman_distances_table.code_counts_array,
+	          distances_table.code_counts_array,
+	          sizeof( int ) * 16 );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	result = memory_compare(
+	          deflate_fixed_huffman_distances_table.lookup_table,
+	          distances_table.lookup_table,
+	          sizeof( uint16_t ) << DEFLATE_HUFFMAN_LOOKUP_TABLE_NUMBER_OF_BITS );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
 /* Tests the deflate_decode_huffman function
  * Returns 1 if successful or 0 if not
  */
@@ -1728,25 +1917,40 @@ on_error:
 	return( 0 );
 }
 
-/* Tests the deflate_decompress function
+/* Tests the deflate_data_is_compressible function
  * Returns 1 if successful or 0 if not
  */
-int assorted_test_deflate_decompress(
+int assorted_test_deflate_data_is_compressible(
      void )
 {
-	uint8_t uncompressed_data[ 8192 ];
+	uint8_t *random_data     = NULL;
+	libcerror_error_t *error = NULL;
+	uint32_t random_value    = 1;
+	size_t data_offset       = 0;
+	int result               = 0;
 
-	libcerror_error_t *error      = NULL;
-	size_t uncompressed_data_size = 7640;
-	int result                    = 0;
+	/* Initialize test
+	 */
+	random_data = (uint8_t *) memory_allocate(
+	                           sizeof( uint8_t ) * DEFLATE_COMPRESSOR_SCAN_SIZE );
+
+	ASSORTED_TEST_ASSERT_IS_NOT_NULL(
+	 "random_data",
+	 random_data );
+
+	for( data_offset = 0;
+	     data_offset < DEFLATE_COMPRESSOR_SCAN_SIZE;
+	     data_offset++ )
+	{
+		random_value = ( random_value * 1103515245UL ) + 12345;
 
+		random_data[ data_offset ] = (uint8_t) ( random_value >> 16 );
+	}
 	/* Test regular cases
 	 */
-	result = deflate_decompress(
-	          assorted_test_deflate_compressed_byte_stream,
-	          2627,
-	          uncompressed_data,
-	          &uncompressed_data_size,
+	result = deflate_data_is_compressible(
+	          assorted_test_deflate_uncompressed_byte_stream,
+	          7640,
 	          &error );
 
 	ASSORTED_TEST_ASSERT_EQUAL_INT(
@@ -1754,24 +1958,45 @@ int assorted_test_deflate_decompress(
 	 result,
 	 1 );
 
-	ASSORTED_TEST_ASSERT_EQUAL_SIZE(
-	 "uncompressed_data_size",
-	 uncompressed_data_size,
-	 (size_t) 7640 );
+	ASSORTED_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = deflate_data_is_compressible(
+	          random_data,
+	          DEFLATE_COMPRESSOR_SCAN_SIZE,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
 
 	ASSORTED_TEST_ASSERT_IS_NULL(
 	 "error",
 	 error );
 
-/* TODO: test uncompressed data too small */
+	/* Test data smaller than the minimum scan size
+	 */
+	result = deflate_data_is_compressible(
+	          random_data,
+	          DEFLATE_COMPRESSOR_MINIMUM_SCAN_SIZE - 1,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ASSORTED_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
 
 	/* Test error cases
 	 */
-	result = deflate_decompress(
+	result = deflate_data_is_compressible(
 	          NULL,
-	          2627,
-	          uncompressed_data,
-	          &uncompressed_data_size,
+	          DEFLATE_COMPRESSOR_SCAN_SIZE,
 	          &error );
 
 	ASSORTED_TEST_ASSERT_EQUAL_INT(
@@ -1786,11 +2011,9 @@ int assorted_test_deflate_decompress(
 	libcerror_error_free(
 	 &error );
 
-	result = deflate_decompress(
-	          assorted_test_deflate_compressed_byte_stream,
-	          (size_t) SSIZE_MAX + 1,
-	          uncompressed_data,
-	          &uncompressed_data_size,
+	result = deflate_data_is_compressible(
+	          random_data,
+	          DEFLATE_COMPRESSOR_SCAN_SIZE + 1,
 	          &error );
 
 	ASSORTED_TEST_ASSERT_EQUAL_INT(
@@ -1805,11 +2028,113 @@ int assorted_test_deflate_decompress(
 	libcerror_error_free(
 	 &error );
 
-	result = deflate_decompress(
-	          assorted_test_deflate_compressed_byte_stream,
-	          2627,
+	/* Clean up
+	 */
+	memory_free(
+	 random_data );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( random_data != NULL )
+	{
+		memory_free(
+		 random_data );
+	}
+	return( 0 );
+}
+
+/* Tests the deflate_compress function
+ * Returns 1 if successful or 0 if not
+ */
+int assorted_test_deflate_compress(
+     void )
+{
+	uint8_t compressed_data[ 8192 ];
+	uint8_t uncompressed_data[ 8192 ];
+
+	int compression_levels[ 5 ] = {
+		-1, 0, 1, 4, 9 };
+
+	libcerror_error_t *error      = NULL;
+	size_t compressed_data_size   = 0;
+	size_t uncompressed_data_size = 0;
+	int level_index               = 0;
+	int result                    = 0;
+
+	/* Test regular cases
+	 */
+	for( level_index = 0;
+	     level_index < 5;
+	     level_index++ )
+	{
+		compressed_data_size = 8192;
+
+		result = deflate_compress(
+		          assorted_test_deflate_uncompressed_byte_stream,
+		          7640,
+		          compression_levels[ level_index ],
+		          compressed_data,
+		          &compressed_data_size,
+		          &error );
+
+		ASSORTED_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		ASSORTED_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		uncompressed_data_size = 8192;
+
+		result = deflate_decompress(
+		          compressed_data,
+		          compressed_data_size,
+		          uncompressed_data,
+		          &uncompressed_data_size,
+		          &error );
+
+		ASSORTED_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		ASSORTED_TEST_ASSERT_EQUAL_SIZE(
+		 "uncompressed_data_size",
+		 uncompressed_data_size,
+		 (size_t) 7640 );
+
+		ASSORTED_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		result = memory_compare(
+		          uncompressed_data,
+		          assorted_test_deflate_uncompressed_byte_stream,
+		          7640 );
+
+		ASSORTED_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 0 );
+	}
+	/* Test error cases
+	 */
+	compressed_data_size = 8192;
+
+	result = deflate_compress(
 	          NULL,
-	          &uncompressed_data_size,
+	          7640,
+	          6,
+	          compressed_data,
+	          &compressed_data_size,
 	          &error );
 
 	ASSORTED_TEST_ASSERT_EQUAL_INT(
@@ -1824,11 +2149,12 @@ int assorted_test_deflate_decompress(
 	libcerror_error_free(
 	 &error );
 
-	result = deflate_decompress(
-	          assorted_test_deflate_compressed_byte_stream,
-	          2627,
-	          uncompressed_data,
-	          NULL,
+	result = deflate_compress(
+	          assorted_test_deflate_uncompressed_byte_stream,
+	          7640,
+	          10,
+	          compressed_data,
+	          &compressed_data_size,
 	          &error );
 
 	ASSORTED_TEST_ASSERT_EQUAL_INT(
@@ -1843,24 +2169,1184 @@ int assorted_test_deflate_decompress(
 	libcerror_error_free(
 	 &error );
 
-	return( 1 );
+	result = deflate_compress(
+	          assorted_test_deflate_uncompressed_byte_stream,
+	          7640,
+	          6,
+	          NULL,
+	          &compressed_data_size,
+	          &error );
 
-on_error:
-	return( 0 );
-}
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
 
-#endif /* defined( __GNUC__ ) && !defined( LIBASSORTED_DLL_IMPORT ) */
+	ASSORTED_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
 
-/* The main program
- */
-#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
-int wmain(
-     int argc ASSORTED_TEST_ATTRIBUTE_UNUSED,
-     wchar_t * const argv[] ASSORTED_TEST_ATTRIBUTE_UNUSED )
-#else
-int main(
-     int argc ASSORTED_TEST_ATTRIBUTE_UNUSED,
-     char * const argv[] ASSORTED_TEST_ATTRIBUTE_UNUSED )
+	libcerror_error_free(
+	 &error );
+
+	result = deflate_compress(
+	          assorted_test_deflate_uncompressed_byte_stream,
+	          7640,
+	          6,
+	          compressed_data,
+	          NULL,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ASSORTED_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Test compressed data too small
+	 */
+	compressed_data_size = 1024;
+
+	result = deflate_compress(
+	          assorted_test_deflate_uncompressed_byte_stream,
+	          7640,
+	          6,
+	          compressed_data,
+	          &compressed_data_size,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ASSORTED_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the deflate_decompress function
+ * Returns 1 if successful or 0 if not
+ */
+int assorted_test_deflate_decompress(
+     void )
+{
+	uint8_t uncompressed_data[ 8192 ];
+
+	libcerror_error_t *error      = NULL;
+	size_t uncompressed_data_size = 7640;
+	int result                    = 0;
+
+	/* Test regular cases
+	 */
+	result = deflate_decompress(
+	          assorted_test_deflate_compressed_byte_stream,
+	          2627,
+	          uncompressed_data,
+	          &uncompressed_data_size,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ASSORTED_TEST_ASSERT_EQUAL_SIZE(
+	 "uncompressed_data_size",
+	 uncompressed_data_size,
+	 (size_t) 7640 );
+
+	ASSORTED_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test uncompressed data too small
+	 */
+	uncompressed_data_size = 7639;
+
+	result = deflate_decompress(
+	          assorted_test_deflate_compressed_byte_stream,
+	          2627,
+	          uncompressed_data,
+	          &uncompressed_data_size,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ASSORTED_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	uncompressed_data_size = 7640;
+
+	/* Test error cases
+	 */
+	result = deflate_decompress(
+	          NULL,
+	          2627,
+	          uncompressed_data,
+	          &uncompressed_data_size,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ASSORTED_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = deflate_decompress(
+	          assorted_test_deflate_compressed_byte_stream,
+	          (size_t) SSIZE_MAX + 1,
+	          uncompressed_data,
+	          &uncompressed_data_size,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ASSORTED_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = deflate_decompress(
+	          assorted_test_deflate_compressed_byte_stream,
+	          2627,
+	          NULL,
+	          &uncompressed_data_size,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ASSORTED_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = deflate_decompress(
+	          assorted_test_deflate_compressed_byte_stream,
+	          2627,
+	          uncompressed_data,
+	          NULL,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ASSORTED_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	return( 0 );
+}
+
+/* Tests the deflate_decompress_with_flags function
+ * Returns 1 if successful or 0 if not
+ */
+int assorted_test_deflate_decompress_with_flags(
+     void )
+{
+	uint8_t compressed_data[ 2627 ];
+	uint8_t uncompressed_data[ 8192 ];
+
+	libcerror_error_t *error      = NULL;
+	size_t uncompressed_data_size = 8192;
+	int result                    = 0;
+
+	/* Initialize test
+	 */
+	if( memory_copy(
+	     compressed_data,
+	     assorted_test_deflate_compressed_byte_stream,
+	     2627 ) == NULL )
+	{
+		goto on_error;
+	}
+	/* Corrupt the stored Adler-32
+	 */
+	compressed_data[ 2626 ] ^= 0x01;
+
+	/* Test regular cases
+	 */
+	result = deflate_decompress_with_flags(
+	          compressed_data,
+	          2627,
+	          uncompressed_data,
+	          &uncompressed_data_size,
+	          DEFLATE_DECOMPRESS_FLAG_IGNORE_CHECKSUM,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ASSORTED_TEST_ASSERT_EQUAL_SIZE(
+	 "uncompressed_data_size",
+	 uncompressed_data_size,
+	 (size_t) 7640 );
+
+	ASSORTED_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = memory_compare(
+	          uncompressed_data,
+	          assorted_test_deflate_uncompressed_byte_stream,
+	          7640 );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	/* Test error cases
+	 */
+	uncompressed_data_size = 8192;
+
+	result = deflate_decompress_with_flags(
+	          compressed_data,
+	          2627,
+	          uncompressed_data,
+	          &uncompressed_data_size,
+	          0,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ASSORTED_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	uncompressed_data_size = 8192;
+
+	result = deflate_decompress_with_flags(
+	          assorted_test_deflate_compressed_byte_stream,
+	          2627,
+	          uncompressed_data,
+	          &uncompressed_data_size,
+	          0x80,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ASSORTED_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the deflate_decompress_allocate function
+ * Returns 1 if successful or 0 if not
+ */
+int assorted_test_deflate_decompress_allocate(
+     void )
+{
+	libcerror_error_t *error      = NULL;
+	uint8_t *uncompressed_data    = NULL;
+	size_t uncompressed_data_size = 0;
+	int result                    = 0;
+
+	/* Test regular cases
+	 */
+	result = deflate_decompress_allocate(
+	          assorted_test_deflate_compressed_byte_stream,
+	          2627,
+	          &uncompressed_data,
+	          &uncompressed_data_size,
+	          0,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ASSORTED_TEST_ASSERT_IS_NOT_NULL(
+	 "uncompressed_data",
+	 uncompressed_data );
+
+	ASSORTED_TEST_ASSERT_EQUAL_SIZE(
+	 "uncompressed_data_size",
+	 uncompressed_data_size,
+	 (size_t) 7640 );
+
+	ASSORTED_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = memory_compare(
+	          uncompressed_data,
+	          assorted_test_deflate_uncompressed_byte_stream,
+	          7640 );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	memory_free(
+	 uncompressed_data );
+
+	uncompressed_data = NULL;
+
+	/* Test an initial size that requires the uncompressed data to be resized
+	 * several times while decompressing
+	 */
+	uncompressed_data_size = 1;
+
+	result = deflate_decompress_allocate(
+	          assorted_test_deflate_compressed_byte_stream,
+	          2627,
+	          &uncompressed_data,
+	          &uncompressed_data_size,
+	          0,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ASSORTED_TEST_ASSERT_IS_NOT_NULL(
+	 "uncompressed_data",
+	 uncompressed_data );
+
+	ASSORTED_TEST_ASSERT_EQUAL_SIZE(
+	 "uncompressed_data_size",
+	 uncompressed_data_size,
+	 (size_t) 7640 );
+
+	ASSORTED_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = memory_compare(
+	          uncompressed_data,
+	          assorted_test_deflate_uncompressed_byte_stream,
+	          7640 );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	memory_free(
+	 uncompressed_data );
+
+	uncompressed_data = NULL;
+
+	/* Test error cases
+	 */
+	uncompressed_data_size = 0;
+
+	result = deflate_decompress_allocate(
+	          NULL,
+	          2627,
+	          &uncompressed_data,
+	          &uncompressed_data_size,
+	          0,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ASSORTED_TEST_ASSERT_IS_NULL(
+	 "uncompressed_data",
+	 uncompressed_data );
+
+	ASSORTED_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = deflate_decompress_allocate(
+	          assorted_test_deflate_compressed_byte_stream,
+	          (size_t) SSIZE_MAX + 1,
+	          &uncompressed_data,
+	          &uncompressed_data_size,
+	          0,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ASSORTED_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = deflate_decompress_allocate(
+	          assorted_test_deflate_compressed_byte_stream,
+	          2627,
+	          NULL,
+	          &uncompressed_data_size,
+	          0,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ASSORTED_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = deflate_decompress_allocate(
+	          assorted_test_deflate_compressed_byte_stream,
+	          2627,
+	          &uncompressed_data,
+	          NULL,
+	          0,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ASSORTED_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( uncompressed_data != NULL )
+	{
+		memory_free(
+		 uncompressed_data );
+	}
+	return( 0 );
+}
+
+/* Tests the deflate_decoder_decompress function
+ * Returns 1 if successful or 0 if not
+ */
+int assorted_test_deflate_decoder_decompress(
+     void )
+{
+	uint8_t uncompressed_data[ 8192 ];
+
+	deflate_decoder_t *decoder    = NULL;
+	libcerror_error_t *error      = NULL;
+	size_t uncompressed_data_size = 0;
+	int iterator                  = 0;
+	int result                    = 0;
+
+	result = deflate_decoder_initialize(
+	          &decoder,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ASSORTED_TEST_ASSERT_IS_NOT_NULL(
+	 "decoder",
+	 decoder );
+
+	ASSORTED_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 * with the decoder reused for multiple streams
+	 */
+	for( iterator = 0;
+	     iterator < 3;
+	     iterator++ )
+	{
+		uncompressed_data_size = 8192;
+
+		result = deflate_decoder_decompress(
+		          decoder,
+		          assorted_test_deflate_compressed_byte_stream,
+		          2627,
+		          uncompressed_data,
+		          &uncompressed_data_size,
+		          0,
+		          &error );
+
+		ASSORTED_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		ASSORTED_TEST_ASSERT_EQUAL_SIZE(
+		 "uncompressed_data_size",
+		 uncompressed_data_size,
+		 (size_t) 7640 );
+
+		ASSORTED_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		result = memory_compare(
+		          uncompressed_data,
+		          assorted_test_deflate_uncompressed_byte_stream,
+		          7640 );
+
+		ASSORTED_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 0 );
+	}
+	/* Test error cases
+	 */
+	uncompressed_data_size = 8192;
+
+	result = deflate_decoder_decompress(
+	          NULL,
+	          assorted_test_deflate_compressed_byte_stream,
+	          2627,
+	          uncompressed_data,
+	          &uncompressed_data_size,
+	          0,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ASSORTED_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = deflate_decoder_decompress(
+	          decoder,
+	          NULL,
+	          2627,
+	          uncompressed_data,
+	          &uncompressed_data_size,
+	          0,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ASSORTED_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = deflate_decoder_free(
+	          &decoder,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ASSORTED_TEST_ASSERT_IS_NULL(
+	 "decoder",
+	 decoder );
+
+	ASSORTED_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( decoder != NULL )
+	{
+		deflate_decoder_free(
+		 &decoder,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the deflate_stream_decompress function
+ * Returns 1 if successful or 0 if not
+ */
+int assorted_test_deflate_stream_decompress(
+     void )
+{
+	uint8_t uncompressed_data[ 8192 ];
+
+	deflate_stream_t *stream        = NULL;
+	libcerror_error_t *error        = NULL;
+	size_t chunk_size               = 0;
+	size_t compressed_data_offset   = 0;
+	size_t compressed_data_size     = 0;
+	size_t uncompressed_data_offset = 0;
+	size_t uncompressed_data_size   = 0;
+	uint8_t flags                   = 0;
+	int result                      = 0;
+
+	/* Test regular cases
+	 * with the input and output provided in chunks of various sizes
+	 */
+	for( chunk_size = 1;
+	     chunk_size <= 8192;
+	     chunk_size *= 3 )
+	{
+		result = deflate_stream_initialize(
+		          &stream,
+		          &error );
+
+		ASSORTED_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		ASSORTED_TEST_ASSERT_IS_NOT_NULL(
+		 "stream",
+		 stream );
+
+		ASSORTED_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		compressed_data_offset   = 0;
+		uncompressed_data_offset = 0;
+		result                   = 0;
+
+		while( result == 0 )
+		{
+			compressed_data_size = 2627 - compressed_data_offset;
+			flags                = DEFLATE_STREAM_FLAG_END_OF_INPUT;
+
+			if( compressed_data_size > chunk_size )
+			{
+				compressed_data_size = chunk_size;
+				flags                = 0;
+			}
+			uncompressed_data_size = 8192 - uncompressed_data_offset;
+
+			if( uncompressed_data_size > chunk_size )
+			{
+				uncompressed_data_size = chunk_size;
+			}
+			result = deflate_stream_decompress(
+			          stream,
+			          &( assorted_test_deflate_compressed_byte_stream[ compressed_data_offset ] ),
+			          &compressed_data_size,
+			          &( uncompressed_data[ uncompressed_data_offset ] ),
+			          &uncompressed_data_size,
+			          flags,
+			          &error );
+
+			ASSORTED_TEST_ASSERT_NOT_EQUAL_INT(
+			 "result",
+			 result,
+			 -1 );
+
+			ASSORTED_TEST_ASSERT_IS_NULL(
+			 "error",
+			 error );
+
+			compressed_data_offset   += compressed_data_size;
+			uncompressed_data_offset += uncompressed_data_size;
+		}
+		ASSORTED_TEST_ASSERT_EQUAL_SIZE(
+		 "uncompressed_data_offset",
+		 uncompressed_data_offset,
+		 (size_t) 7640 );
+
+		result = memory_compare(
+		          uncompressed_data,
+		          assorted_test_deflate_uncompressed_byte_stream,
+		          7640 );
+
+		ASSORTED_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 0 );
+
+		result = deflate_stream_free(
+		          &stream,
+		          &error );
+
+		ASSORTED_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		ASSORTED_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+	}
+	/* Test error cases
+	 */
+	result = deflate_stream_initialize(
+	          &stream,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	compressed_data_size   = 2000;
+	uncompressed_data_size = 8192;
+
+	result = deflate_stream_decompress(
+	          stream,
+	          assorted_test_deflate_compressed_byte_stream,
+	          &compressed_data_size,
+	          uncompressed_data,
+	          &uncompressed_data_size,
+	          DEFLATE_STREAM_FLAG_END_OF_INPUT,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ASSORTED_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = deflate_stream_decompress(
+	          NULL,
+	          assorted_test_deflate_compressed_byte_stream,
+	          &compressed_data_size,
+	          uncompressed_data,
+	          &uncompressed_data_size,
+	          0,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ASSORTED_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = deflate_stream_decompress(
+	          stream,
+	          assorted_test_deflate_compressed_byte_stream,
+	          NULL,
+	          uncompressed_data,
+	          &uncompressed_data_size,
+	          0,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ASSORTED_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = deflate_stream_decompress(
+	          stream,
+	          assorted_test_deflate_compressed_byte_stream,
+	          &compressed_data_size,
+	          NULL,
+	          &uncompressed_data_size,
+	          0,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ASSORTED_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = deflate_stream_free(
+	          &stream,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( stream != NULL )
+	{
+		deflate_stream_free(
+		 &stream,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the deflate_stream_reset function
+ * Returns 1 if successful or 0 if not
+ */
+int assorted_test_deflate_stream_reset(
+     void )
+{
+	uint8_t uncompressed_data[ 8192 ];
+
+	deflate_stream_t *stream      = NULL;
+	libcerror_error_t *error      = NULL;
+	size_t compressed_data_size   = 0;
+	size_t uncompressed_data_size = 0;
+	int iterator                  = 0;
+	int result                    = 0;
+
+	result = deflate_stream_initialize(
+	          &stream,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	/* Test regular cases
+	 * with the stream reset after an incomplete and after a complete stream
+	 */
+	compressed_data_size   = 1000;
+	uncompressed_data_size = 8192;
+
+	result = deflate_stream_decompress(
+	          stream,
+	          assorted_test_deflate_compressed_byte_stream,
+	          &compressed_data_size,
+	          uncompressed_data,
+	          &uncompressed_data_size,
+	          0,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	for( iterator = 0;
+	     iterator < 2;
+	     iterator++ )
+	{
+		result = deflate_stream_reset(
+		          stream,
+		          &error );
+
+		ASSORTED_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		ASSORTED_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		compressed_data_size   = 2627;
+		uncompressed_data_size = 8192;
+
+		result = deflate_stream_decompress(
+		          stream,
+		          assorted_test_deflate_compressed_byte_stream,
+		          &compressed_data_size,
+		          uncompressed_data,
+		          &uncompressed_data_size,
+		          DEFLATE_STREAM_FLAG_END_OF_INPUT,
+		          &error );
+
+		ASSORTED_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		ASSORTED_TEST_ASSERT_EQUAL_SIZE(
+		 "uncompressed_data_size",
+		 uncompressed_data_size,
+		 (size_t) 7640 );
+
+		ASSORTED_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		result = memory_compare(
+		          uncompressed_data,
+		          assorted_test_deflate_uncompressed_byte_stream,
+		          7640 );
+
+		ASSORTED_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 0 );
+	}
+	/* Test error cases
+	 */
+	result = deflate_stream_reset(
+	          NULL,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ASSORTED_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = deflate_stream_free(
+	          &stream,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( stream != NULL )
+	{
+		deflate_stream_free(
+		 &stream,
+		 NULL );
+	}
+	return( 0 );
+}
+
+#if defined( HAVE_DEFLATE_STATISTICS )
+
+/* Tests the deflate_statistics_get function
+ * Returns 1 if successful or 0 if not
+ */
+int assorted_test_deflate_statistics_get(
+     void )
+{
+	uint8_t uncompressed_data[ 8192 ];
+
+	deflate_statistics_t statistics;
+
+	libcerror_error_t *error      = NULL;
+	size_t uncompressed_data_size = 7640;
+	uint64_t number_of_blocks     = 0;
+	int result                    = 0;
+
+	/* Test regular cases
+	 */
+	deflate_statistics_reset();
+
+	result = deflate_decompress(
+	          assorted_test_deflate_compressed_byte_stream,
+	          2627,
+	          uncompressed_data,
+	          &uncompressed_data_size,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ASSORTED_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = deflate_statistics_get(
+	          &statistics,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ASSORTED_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	number_of_blocks = statistics.number_of_stored_blocks
+	                 + statistics.number_of_fixed_huffman_blocks
+	                 + statistics.number_of_dynamic_huffman_blocks;
+
+	ASSORTED_TEST_ASSERT_NOT_EQUAL_INT64(
+	 "number_of_blocks",
+	 (int64_t) number_of_blocks,
+	 (int64_t) 0 );
+
+	/* Every byte of the uncompressed data is produced by a stored block, a literal or a match
+	 */
+	ASSORTED_TEST_ASSERT_EQUAL_UINT64(
+	 "number_of_bytes",
+	 statistics.number_of_stored_bytes + statistics.number_of_literals + statistics.number_of_match_bytes,
+	 (uint64_t) 7640 );
+
+	/* Test error cases
+	 */
+	result = deflate_statistics_get(
+	          NULL,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ASSORTED_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+#endif /* defined( HAVE_DEFLATE_STATISTICS ) */
+
+#endif /* defined( __GNUC__ ) && !defined( LIBASSORTED_DLL_IMPORT ) */
+
+/* The main program
+ */
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+int wmain(
+     int argc ASSORTED_TEST_ATTRIBUTE_UNUSED,
+     wchar_t * const argv[] ASSORTED_TEST_ATTRIBUTE_UNUSED )
+#else
+int main(
+     int argc ASSORTED_TEST_ATTRIBUTE_UNUSED,
+     char * const argv[] ASSORTED_TEST_ATTRIBUTE_UNUSED )
 #endif
 {
 	ASSORTED_TEST_UNREFERENCED_PARAMETER( argc )
@@ -1897,6 +3383,10 @@ int main(
 	 "deflate_initialize_fixed_huffman_tables",
 	 assorted_test_deflate_initialize_fixed_huffman_tables );
 
+	ASSORTED_TEST_RUN(
+	 "deflate_fixed_huffman_tables",
+	 assorted_test_deflate_fixed_huffman_tables );
+
 	ASSORTED_TEST_RUN(
 	 "deflate_decode_huffman",
 	 assorted_test_deflate_decode_huffman );
@@ -1905,10 +3395,45 @@ int main(
 	 "deflate_calculate_adler32",
 	 assorted_test_deflate_calculate_adler32 );
 
+	ASSORTED_TEST_RUN(
+	 "deflate_data_is_compressible",
+	 assorted_test_deflate_data_is_compressible );
+
+	ASSORTED_TEST_RUN(
+	 "deflate_compress",
+	 assorted_test_deflate_compress );
+
 	ASSORTED_TEST_RUN(
 	 "deflate_decompress",
 	 assorted_test_deflate_decompress );
 
+	ASSORTED_TEST_RUN(
+	 "deflate_decompress_with_flags",
+	 assorted_test_deflate_decompress_with_flags );
+
+	ASSORTED_TEST_RUN(
+	 "deflate_decompress_allocate",
+	 assorted_test_deflate_decompress_allocate );
+
+	ASSORTED_TEST_RUN(
+	 "deflate_decoder_decompress",
+	 assorted_test_deflate_decoder_decompress );
+
+	ASSORTED_TEST_RUN(
+	 "deflate_stream_decompress",
+	 assorted_test_deflate_stream_decompress );
+
+	ASSORTED_TEST_RUN(
+	 "deflate_stream_reset",
+	 assorted_test_deflate_stream_reset );
+
+#if defined( HAVE_DEFLATE_STATISTICS )
+
+	ASSORTED_TEST_RUN(
+	 "deflate_statistics_get",
+	 assorted_test_deflate_statistics_get );
+
+#endif
 #endif /* defined( __GNUC__ ) && !defined( LIBASSORTED_DLL_IMPORT ) */
 
 	return( EXIT_SUCCESS );
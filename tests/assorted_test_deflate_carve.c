@@ -0,0 +1,1034 @@
+/*
+ * Deflate (zlib) stream carving functions testing program
+ *
+ * Copyright (C) 2008-2019, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This software is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This software is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this software.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <file_stream.h>
+#include <memory.h>
+#include <types.h>
+
+#if defined( HAVE_STDLIB_H ) || defined( WINAPI )
+#include <stdlib.h>
+#endif
+
+#include "assorted_test_libcerror.h"
+#include "assorted_test_macros.h"
+#include "assorted_test_unused.h"
+
+#include "../src/deflate.h"
+#include "../src/deflate_carve.h"
+
+/* A zlib stream with a single dynamic Huffman block of 358 bytes of text
+ */
+uint8_t assorted_test_deflate_carve_zlib_stream[ 133 ] = {
+	0x78, 0xda, 0xd5, 0x8e, 0xd1, 0x0d, 0xc2, 0x30, 0x0c, 0x44, 0x57, 0xb9, 0x09, 0xba, 0x05, 0x1b,
+	0x74, 0x01, 0x13, 0x5f, 0x89, 0x45, 0xd2, 0x20, 0xdb, 0x2a, 0x82, 0xe9, 0x49, 0x25, 0x18, 0x82,
+	0xbf, 0x27, 0x9d, 0xef, 0x9d, 0xd7, 0x4a, 0x28, 0xb7, 0x26, 0xc9, 0x22, 0x7e, 0x10, 0x39, 0x46,
+	0x43, 0x14, 0xd9, 0x03, 0x82, 0xc8, 0xe1, 0x72, 0x23, 0x3a, 0xd5, 0x04, 0xd6, 0x4f, 0xde, 0x86,
+	0xe3, 0xdd, 0xec, 0x0a, 0xd9, 0x15, 0x2e, 0xcf, 0x5f, 0x7d, 0x1e, 0x3b, 0xa5, 0xc7, 0x82, 0xcb,
+	0x41, 0x7f, 0x61, 0x2a, 0xd4, 0xf4, 0x0c, 0xb2, 0x4a, 0xe2, 0x21, 0x11, 0x8c, 0xc9, 0x44, 0xa5,
+	0x28, 0x1d, 0xa5, 0xb2, 0xdc, 0x03, 0x16, 0xd3, 0x50, 0x86, 0x52, 0xe7, 0xf6, 0xc4, 0xa4, 0x77,
+	0xdb, 0x09, 0xdb, 0x60, 0x79, 0xa6, 0x82, 0x43, 0x9a, 0xe9, 0xd7, 0xbf, 0x60, 0xfd, 0xbf, 0x97,
+	0x3f, 0xfa, 0xdd, 0x81, 0x0f };
+
+/* An uncompressed block of 5 bytes
+ */
+uint8_t assorted_test_deflate_carve_stored_block[ 10 ] = {
+	0x01, 0x05, 0x00, 0xfa, 0xff, 0x41, 0x42, 0x43, 0x44, 0x45 };
+
+/* The test data contains the zlib stream at offset 40, the bytes before and
+ * after the stream are 0xff and are neither a zlib header nor a block header
+ */
+uint8_t assorted_test_deflate_carve_data[ 256 ];
+
+/* Fills the test data
+ */
+void assorted_test_deflate_carve_fill_data(
+      void )
+{
+	memory_set(
+	 assorted_test_deflate_carve_data,
+	 0xff,
+	 256 );
+
+	memory_copy(
+	 &( assorted_test_deflate_carve_data[ 40 ] ),
+	 assorted_test_deflate_carve_zlib_stream,
+	 133 );
+}
+
+/* Tests the deflate_carve_scanner_initialize function
+ * Returns 1 if successful or 0 if not
+ */
+int assorted_test_deflate_carve_scanner_initialize(
+     void )
+{
+	deflate_carve_scanner_t *scanner = NULL;
+	libcerror_error_t *error         = NULL;
+	int result                       = 0;
+
+	/* Test regular cases
+	 */
+	result = deflate_carve_scanner_initialize(
+	          &scanner,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ASSORTED_TEST_ASSERT_IS_NOT_NULL(
+	 "scanner",
+	 scanner );
+
+	ASSORTED_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = deflate_carve_scanner_free(
+	          &scanner,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ASSORTED_TEST_ASSERT_IS_NULL(
+	 "scanner",
+	 scanner );
+
+	ASSORTED_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = deflate_carve_scanner_initialize(
+	          NULL,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ASSORTED_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	scanner = (deflate_carve_scanner_t *) 0x12345678UL;
+
+	result = deflate_carve_scanner_initialize(
+	          &scanner,
+	          &error );
+
+	scanner = NULL;
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ASSORTED_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( scanner != NULL )
+	{
+		deflate_carve_scanner_free(
+		 &scanner,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the deflate_carve_find_zlib_header function
+ * Returns 1 if successful or 0 if not
+ */
+int assorted_test_deflate_carve_find_zlib_header(
+     void )
+{
+	libcerror_error_t *error = NULL;
+	size_t data_offset       = 0;
+	size_t header_offset     = 0;
+	int result               = 0;
+
+	assorted_test_deflate_carve_fill_data();
+
+	/* Test regular cases
+	 */
+	data_offset = 0;
+
+	result = deflate_carve_find_zlib_header(
+	          assorted_test_deflate_carve_data,
+	          256,
+	          &data_offset,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ASSORTED_TEST_ASSERT_EQUAL_SIZE(
+	 "data_offset",
+	 data_offset,
+	 (size_t) 40 );
+
+	ASSORTED_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test the search from every offset to cover the blocks
+	 * of 16 offsets and the trailing offsets
+	 */
+	for( header_offset = 0;
+	     header_offset <= 40;
+	     header_offset++ )
+	{
+		data_offset = 0;
+
+		result = deflate_carve_find_zlib_header(
+		          &( assorted_test_deflate_carve_data[ 40 - header_offset ] ),
+		          header_offset + 2,
+		          &data_offset,
+		          &error );
+
+		ASSORTED_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		ASSORTED_TEST_ASSERT_EQUAL_SIZE(
+		 "data_offset",
+		 data_offset,
+		 header_offset );
+
+		ASSORTED_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+	}
+	data_offset = 41;
+
+	result = deflate_carve_find_zlib_header(
+	          assorted_test_deflate_carve_data,
+	          256,
+	          &data_offset,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	ASSORTED_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = deflate_carve_find_zlib_header(
+	          NULL,
+	          256,
+	          &data_offset,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ASSORTED_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = deflate_carve_find_zlib_header(
+	          assorted_test_deflate_carve_data,
+	          (size_t) SSIZE_MAX + 1,
+	          &data_offset,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ASSORTED_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = deflate_carve_find_zlib_header(
+	          assorted_test_deflate_carve_data,
+	          256,
+	          NULL,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ASSORTED_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the deflate_carve_find_raw_block_header function
+ * Returns 1 if successful or 0 if not
+ */
+int assorted_test_deflate_carve_find_raw_block_header(
+     void )
+{
+	libcerror_error_t *error = NULL;
+	size_t data_offset       = 0;
+	int result               = 0;
+
+	assorted_test_deflate_carve_fill_data();
+
+	/* Test regular cases
+	 */
+	data_offset = 0;
+
+	result = deflate_carve_find_raw_block_header(
+	          assorted_test_deflate_carve_data,
+	          256,
+	          &data_offset,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ASSORTED_TEST_ASSERT_EQUAL_SIZE(
+	 "data_offset",
+	 data_offset,
+	 (size_t) 42 );
+
+	ASSORTED_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test an uncompressed block after the zlib stream
+	 */
+	memory_copy(
+	 &( assorted_test_deflate_carve_data[ 200 ] ),
+	 assorted_test_deflate_carve_stored_block,
+	 10 );
+
+	data_offset = 40 + 133;
+
+	result = deflate_carve_find_raw_block_header(
+	          assorted_test_deflate_carve_data,
+	          256,
+	          &data_offset,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ASSORTED_TEST_ASSERT_EQUAL_SIZE(
+	 "data_offset",
+	 data_offset,
+	 (size_t) 200 );
+
+	ASSORTED_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	data_offset = 201;
+
+	result = deflate_carve_find_raw_block_header(
+	          assorted_test_deflate_carve_data,
+	          256,
+	          &data_offset,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	ASSORTED_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = deflate_carve_find_raw_block_header(
+	          NULL,
+	          256,
+	          &data_offset,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ASSORTED_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = deflate_carve_find_raw_block_header(
+	          assorted_test_deflate_carve_data,
+	          (size_t) SSIZE_MAX + 1,
+	          &data_offset,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ASSORTED_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = deflate_carve_find_raw_block_header(
+	          assorted_test_deflate_carve_data,
+	          256,
+	          NULL,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ASSORTED_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the deflate_carve_check_block_header function
+ * Returns 1 if successful or 0 if not
+ */
+int assorted_test_deflate_carve_check_block_header(
+     void )
+{
+	uint8_t block_header_data[ 10 ];
+
+	libcerror_error_t *error = NULL;
+	uint8_t block_type       = 0;
+	int result               = 0;
+
+	/* Test regular cases
+	 */
+	result = deflate_carve_check_block_header(
+	          &( assorted_test_deflate_carve_zlib_stream[ 2 ] ),
+	          131,
+	          &block_type,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ASSORTED_TEST_ASSERT_EQUAL_UINT8(
+	 "block_type",
+	 block_type,
+	 (uint8_t) DEFLATE_BLOCK_TYPE_HUFFMAN_DYNAMIC );
+
+	ASSORTED_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = deflate_carve_check_block_header(
+	          assorted_test_deflate_carve_stored_block,
+	          10,
+	          &block_type,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ASSORTED_TEST_ASSERT_EQUAL_UINT8(
+	 "block_type",
+	 block_type,
+	 (uint8_t) DEFLATE_BLOCK_TYPE_UNCOMPRESSED );
+
+	ASSORTED_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test an uncompressed block with a block size that does not match its copy
+	 */
+	memory_copy(
+	 block_header_data,
+	 assorted_test_deflate_carve_stored_block,
+	 10 );
+
+	block_header_data[ 3 ] = 0xfb;
+
+	result = deflate_carve_check_block_header(
+	          block_header_data,
+	          10,
+	          &block_type,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	ASSORTED_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test a dynamic Huffman block with an incomplete set of code sizes
+	 */
+	memory_copy(
+	 block_header_data,
+	 &( assorted_test_deflate_carve_zlib_stream[ 2 ] ),
+	 10 );
+
+	block_header_data[ 3 ] ^= 0x0e;
+
+	result = deflate_carve_check_block_header(
+	          block_header_data,
+	          10,
+	          &block_type,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	ASSORTED_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test a block with the reserved block type
+	 */
+	block_header_data[ 0 ] = 0x07;
+
+	result = deflate_carve_check_block_header(
+	          block_header_data,
+	          10,
+	          &block_type,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	ASSORTED_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = deflate_carve_check_block_header(
+	          NULL,
+	          10,
+	          &block_type,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ASSORTED_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = deflate_carve_check_block_header(
+	          assorted_test_deflate_carve_stored_block,
+	          (size_t) SSIZE_MAX + 1,
+	          &block_type,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ASSORTED_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = deflate_carve_check_block_header(
+	          assorted_test_deflate_carve_stored_block,
+	          10,
+	          NULL,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ASSORTED_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the deflate_carve_scanner_validate_stream function
+ * Returns 1 if successful or 0 if not
+ */
+int assorted_test_deflate_carve_scanner_validate_stream(
+     void )
+{
+	deflate_carve_scanner_t *scanner = NULL;
+	libcerror_error_t *error         = NULL;
+	size64_t uncompressed_data_size  = 0;
+	size_t compressed_data_size      = 0;
+	int result                       = 0;
+
+	/* Initialize test
+	 */
+	assorted_test_deflate_carve_fill_data();
+
+	result = deflate_carve_scanner_initialize(
+	          &scanner,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ASSORTED_TEST_ASSERT_IS_NOT_NULL(
+	 "scanner",
+	 scanner );
+
+	ASSORTED_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	result = deflate_carve_scanner_validate_stream(
+	          scanner,
+	          &( assorted_test_deflate_carve_data[ 40 ] ),
+	          256 - 40,
+	          DEFLATE_CARVE_STREAM_TYPE_ZLIB,
+	          DEFLATE_CARVE_FLAG_END_OF_INPUT,
+	          &compressed_data_size,
+	          &uncompressed_data_size,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ASSORTED_TEST_ASSERT_EQUAL_SIZE(
+	 "compressed_data_size",
+	 compressed_data_size,
+	 (size_t) 133 );
+
+	ASSORTED_TEST_ASSERT_EQUAL_UINT64(
+	 "uncompressed_data_size",
+	 (uint64_t) uncompressed_data_size,
+	 (uint64_t) 358 );
+
+	ASSORTED_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* The raw deflate data of the zlib stream is without the zlib header and Adler-32
+	 */
+	result = deflate_carve_scanner_validate_stream(
+	          scanner,
+	          &( assorted_test_deflate_carve_data[ 42 ] ),
+	          256 - 42,
+	          DEFLATE_CARVE_STREAM_TYPE_RAW,
+	          DEFLATE_CARVE_FLAG_END_OF_INPUT,
+	          &compressed_data_size,
+	          &uncompressed_data_size,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ASSORTED_TEST_ASSERT_EQUAL_SIZE(
+	 "compressed_data_size",
+	 compressed_data_size,
+	 (size_t) 133 - 6 );
+
+	ASSORTED_TEST_ASSERT_EQUAL_UINT64(
+	 "uncompressed_data_size",
+	 (uint64_t) uncompressed_data_size,
+	 (uint64_t) 358 );
+
+	ASSORTED_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test a stream that continues beyond the end of the data
+	 */
+	result = deflate_carve_scanner_validate_stream(
+	          scanner,
+	          &( assorted_test_deflate_carve_data[ 40 ] ),
+	          100,
+	          DEFLATE_CARVE_STREAM_TYPE_ZLIB,
+	          0,
+	          &compressed_data_size,
+	          &uncompressed_data_size,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	ASSORTED_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test data that does not contain a valid stream
+	 */
+	result = deflate_carve_scanner_validate_stream(
+	          scanner,
+	          &( assorted_test_deflate_carve_data[ 40 ] ),
+	          100,
+	          DEFLATE_CARVE_STREAM_TYPE_ZLIB,
+	          DEFLATE_CARVE_FLAG_END_OF_INPUT,
+	          &compressed_data_size,
+	          &uncompressed_data_size,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ASSORTED_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Test error cases
+	 */
+	result = deflate_carve_scanner_validate_stream(
+	          NULL,
+	          &( assorted_test_deflate_carve_data[ 40 ] ),
+	          256 - 40,
+	          DEFLATE_CARVE_STREAM_TYPE_ZLIB,
+	          DEFLATE_CARVE_FLAG_END_OF_INPUT,
+	          &compressed_data_size,
+	          &uncompressed_data_size,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ASSORTED_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = deflate_carve_scanner_validate_stream(
+	          scanner,
+	          NULL,
+	          256 - 40,
+	          DEFLATE_CARVE_STREAM_TYPE_ZLIB,
+	          DEFLATE_CARVE_FLAG_END_OF_INPUT,
+	          &compressed_data_size,
+	          &uncompressed_data_size,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ASSORTED_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = deflate_carve_scanner_validate_stream(
+	          scanner,
+	          &( assorted_test_deflate_carve_data[ 40 ] ),
+	          (size_t) SSIZE_MAX + 1,
+	          DEFLATE_CARVE_STREAM_TYPE_ZLIB,
+	          DEFLATE_CARVE_FLAG_END_OF_INPUT,
+	          &compressed_data_size,
+	          &uncompressed_data_size,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ASSORTED_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = deflate_carve_scanner_validate_stream(
+	          scanner,
+	          &( assorted_test_deflate_carve_data[ 40 ] ),
+	          256 - 40,
+	          -1,
+	          DEFLATE_CARVE_FLAG_END_OF_INPUT,
+	          &compressed_data_size,
+	          &uncompressed_data_size,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ASSORTED_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = deflate_carve_scanner_validate_stream(
+	          scanner,
+	          &( assorted_test_deflate_carve_data[ 40 ] ),
+	          256 - 40,
+	          DEFLATE_CARVE_STREAM_TYPE_ZLIB,
+	          0xff,
+	          &compressed_data_size,
+	          &uncompressed_data_size,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ASSORTED_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = deflate_carve_scanner_validate_stream(
+	          scanner,
+	          &( assorted_test_deflate_carve_data[ 40 ] ),
+	          256 - 40,
+	          DEFLATE_CARVE_STREAM_TYPE_ZLIB,
+	          DEFLATE_CARVE_FLAG_END_OF_INPUT,
+	          NULL,
+	          &uncompressed_data_size,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ASSORTED_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = deflate_carve_scanner_validate_stream(
+	          scanner,
+	          &( assorted_test_deflate_carve_data[ 40 ] ),
+	          256 - 40,
+	          DEFLATE_CARVE_STREAM_TYPE_ZLIB,
+	          DEFLATE_CARVE_FLAG_END_OF_INPUT,
+	          &compressed_data_size,
+	          NULL,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ASSORTED_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = deflate_carve_scanner_free(
+	          &scanner,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ASSORTED_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( scanner != NULL )
+	{
+		deflate_carve_scanner_free(
+		 &scanner,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* The main program
+ */
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+int wmain(
+     int argc ASSORTED_TEST_ATTRIBUTE_UNUSED,
+     wchar_t * const argv[] ASSORTED_TEST_ATTRIBUTE_UNUSED )
+#else
+int main(
+     int argc ASSORTED_TEST_ATTRIBUTE_UNUSED,
+     char * const argv[] ASSORTED_TEST_ATTRIBUTE_UNUSED )
+#endif
+{
+	ASSORTED_TEST_UNREFERENCED_PARAMETER( argc )
+	ASSORTED_TEST_UNREFERENCED_PARAMETER( argv )
+
+	ASSORTED_TEST_RUN(
+	 "deflate_carve_scanner_initialize",
+	 assorted_test_deflate_carve_scanner_initialize );
+
+	/* TODO: add tests for deflate_carve_scanner_free */
+
+	ASSORTED_TEST_RUN(
+	 "deflate_carve_find_zlib_header",
+	 assorted_test_deflate_carve_find_zlib_header );
+
+	ASSORTED_TEST_RUN(
+	 "deflate_carve_find_raw_block_header",
+	 assorted_test_deflate_carve_find_raw_block_header );
+
+	ASSORTED_TEST_RUN(
+	 "deflate_carve_check_block_header",
+	 assorted_test_deflate_carve_check_block_header );
+
+	ASSORTED_TEST_RUN(
+	 "deflate_carve_scanner_validate_stream",
+	 assorted_test_deflate_carve_scanner_validate_stream );
+
+	return( EXIT_SUCCESS );
+
+on_error:
+	return( EXIT_FAILURE );
+}
@@ -0,0 +1,985 @@
+/*
+ * Deflate (zlib) random-access index functions testing program
+ *
+ * Copyright (C) 2008-2019, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This software is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This software is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this software.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <file_stream.h>
+#include <memory.h>
+#include <narrow_string.h>
+#include <types.h>
+
+#if defined( HAVE_STDLIB_H ) || defined( WINAPI )
+#include <stdlib.h>
+#endif
+
+#include "assorted_test_libcerror.h"
+#include "assorted_test_macros.h"
+#include "assorted_test_unused.h"
+
+#include "../src/deflate.h"
+#include "../src/deflate_index.h"
+#include "../src/deflate_stream.h"
+
+/* The size of the uncompressed test data, which is large enough
+ * for the compressed data to consist of multiple blocks
+ */
+#define ASSORTED_TEST_DEFLATE_INDEX_DATA_SIZE	( 1280 * 1024 )
+
+/* The size of the test range, which is large enough for decompressing
+ * the range to require multiple calls of deflate_stream_decompress
+ */
+#define ASSORTED_TEST_DEFLATE_INDEX_RANGE_SIZE	( ( 1024 * 1024 ) + 1 )
+
+/* The interval of the test index
+ */
+#define ASSORTED_TEST_DEFLATE_INDEX_INTERVAL	( 16 * 1024 )
+
+uint8_t assorted_test_deflate_index_uncompressed_data[ ASSORTED_TEST_DEFLATE_INDEX_DATA_SIZE ];
+
+uint8_t assorted_test_deflate_index_compressed_data[ ASSORTED_TEST_DEFLATE_INDEX_DATA_SIZE + 1024 ];
+
+size_t assorted_test_deflate_index_compressed_data_size = 0;
+
+uint8_t assorted_test_deflate_index_range_data[ ASSORTED_TEST_DEFLATE_INDEX_RANGE_SIZE ];
+
+/* Fills the uncompressed test data with pseudo random words and compresses it
+ * Returns 1 if successful or 0 if not
+ */
+int assorted_test_deflate_index_fill_data(
+     void )
+{
+	const char *words[ 8 ] = {
+		"access ", "point ", "window ", "block ", "offset ", "stream ", "index\n", "deflate " };
+
+	libcerror_error_t *error = NULL;
+	size_t data_offset       = 0;
+	size_t word_size         = 0;
+	uint32_t random_value    = 1;
+	int letter_index         = 0;
+	int result               = 0;
+
+	/* Every word is followed by 4 pseudo random letters so that the compressed data
+	 * contains enough literals to consist of multiple blocks
+	 */
+	while( data_offset < ASSORTED_TEST_DEFLATE_INDEX_DATA_SIZE )
+	{
+		random_value = ( random_value * 1103515245UL ) + 12345;
+
+		word_size = narrow_string_length(
+		             words[ ( random_value >> 16 ) & 0x07 ] );
+
+		if( word_size > ( ASSORTED_TEST_DEFLATE_INDEX_DATA_SIZE - data_offset ) )
+		{
+			word_size = ASSORTED_TEST_DEFLATE_INDEX_DATA_SIZE - data_offset;
+		}
+		memory_copy(
+		 &( assorted_test_deflate_index_uncompressed_data[ data_offset ] ),
+		 words[ ( random_value >> 16 ) & 0x07 ],
+		 word_size );
+
+		data_offset += word_size;
+
+		for( letter_index = 0;
+		     ( letter_index < 4 ) && ( data_offset < ASSORTED_TEST_DEFLATE_INDEX_DATA_SIZE );
+		     letter_index++ )
+		{
+			random_value = ( random_value * 1103515245UL ) + 12345;
+
+			assorted_test_deflate_index_uncompressed_data[ data_offset++ ] = (uint8_t) ( 'a' + ( ( random_value >> 16 ) % 26 ) );
+		}
+	}
+	assorted_test_deflate_index_compressed_data_size = ASSORTED_TEST_DEFLATE_INDEX_DATA_SIZE + 1024;
+
+	result = deflate_compress(
+	          assorted_test_deflate_index_uncompressed_data,
+	          ASSORTED_TEST_DEFLATE_INDEX_DATA_SIZE,
+	          6,
+	          assorted_test_deflate_index_compressed_data,
+	          &assorted_test_deflate_index_compressed_data_size,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ASSORTED_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Builds an index of the compressed test data
+ * Returns 1 if successful or 0 if not
+ */
+int assorted_test_deflate_index_build(
+     deflate_index_t *index,
+     deflate_stream_t *stream )
+{
+	uint8_t uncompressed_data[ 8192 ];
+
+	libcerror_error_t *error        = NULL;
+	size_t compressed_data_offset   = 0;
+	size_t compressed_data_size     = 0;
+	size_t uncompressed_data_offset = 0;
+	size_t uncompressed_data_size   = 0;
+	uint8_t flags                   = 0;
+	int result                      = 0;
+
+	/* Decompress the data in small chunks so that access points are
+	 * added at different positions in the input buffer of the stream
+	 */
+	while( result == 0 )
+	{
+		compressed_data_size = assorted_test_deflate_index_compressed_data_size - compressed_data_offset;
+
+		if( compressed_data_size > 3000 )
+		{
+			compressed_data_size = 3000;
+		}
+		else
+		{
+			flags = DEFLATE_STREAM_FLAG_END_OF_INPUT;
+		}
+		uncompressed_data_size = 8192;
+
+		result = deflate_index_decompress(
+		          index,
+		          stream,
+		          &( assorted_test_deflate_index_compressed_data[ compressed_data_offset ] ),
+		          &compressed_data_size,
+		          uncompressed_data,
+		          &uncompressed_data_size,
+		          flags,
+		          &error );
+
+		ASSORTED_TEST_ASSERT_NOT_EQUAL_INT(
+		 "result",
+		 result,
+		 -1 );
+
+		ASSORTED_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		ASSORTED_TEST_ASSERT_LESS_THAN_UINT64(
+		 "uncompressed_data_offset",
+		 (uint64_t) ( uncompressed_data_offset + uncompressed_data_size ),
+		 (uint64_t) ( ASSORTED_TEST_DEFLATE_INDEX_DATA_SIZE + 1 ) );
+
+		result = memory_compare(
+		          uncompressed_data,
+		          &( assorted_test_deflate_index_uncompressed_data[ uncompressed_data_offset ] ),
+		          uncompressed_data_size );
+
+		ASSORTED_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 0 );
+
+		compressed_data_offset   += compressed_data_size;
+		uncompressed_data_offset += uncompressed_data_size;
+
+		result = ( index->uncompressed_data_size != 0 ) ? 1 : 0;
+	}
+	ASSORTED_TEST_ASSERT_EQUAL_SIZE(
+	 "uncompressed_data_offset",
+	 uncompressed_data_offset,
+	 (size_t) ASSORTED_TEST_DEFLATE_INDEX_DATA_SIZE );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Reads data at offsets using an index and compares it with the uncompressed test data
+ * Returns 1 if successful or 0 if not
+ */
+int assorted_test_deflate_index_read_at_offsets(
+     deflate_index_t *index,
+     deflate_stream_t *stream )
+{
+	uint8_t uncompressed_data[ 4096 ];
+
+	uint64_t uncompressed_offsets[ 7 ] = {
+		0, 1, 16383, 16384, 100000, 200003, ASSORTED_TEST_DEFLATE_INDEX_DATA_SIZE - 4096 };
+
+	libcerror_error_t *error = NULL;
+	ssize_t read_count       = 0;
+	int offset_index         = 0;
+	int result               = 0;
+
+	for( offset_index = 0;
+	     offset_index < 7;
+	     offset_index++ )
+	{
+		read_count = deflate_index_decompress_at_offset(
+		              index,
+		              stream,
+		              assorted_test_deflate_index_compressed_data,
+		              assorted_test_deflate_index_compressed_data_size,
+		              uncompressed_offsets[ offset_index ],
+		              uncompressed_data,
+		              4096,
+		              &error );
+
+		ASSORTED_TEST_ASSERT_EQUAL_SSIZE(
+		 "read_count",
+		 read_count,
+		 (ssize_t) 4096 );
+
+		ASSORTED_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		result = memory_compare(
+		          uncompressed_data,
+		          &( assorted_test_deflate_index_uncompressed_data[ uncompressed_offsets[ offset_index ] ] ),
+		          4096 );
+
+		ASSORTED_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 0 );
+	}
+	/* Test reading the end of the data
+	 */
+	read_count = deflate_index_decompress_at_offset(
+	              index,
+	              stream,
+	              assorted_test_deflate_index_compressed_data,
+	              assorted_test_deflate_index_compressed_data_size,
+	              ASSORTED_TEST_DEFLATE_INDEX_DATA_SIZE - 100,
+	              uncompressed_data,
+	              4096,
+	              &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_SSIZE(
+	 "read_count",
+	 read_count,
+	 (ssize_t) 100 );
+
+	ASSORTED_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = memory_compare(
+	          uncompressed_data,
+	          &( assorted_test_deflate_index_uncompressed_data[ ASSORTED_TEST_DEFLATE_INDEX_DATA_SIZE - 100 ] ),
+	          100 );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	read_count = deflate_index_decompress_at_offset(
+	              index,
+	              stream,
+	              assorted_test_deflate_index_compressed_data,
+	              assorted_test_deflate_index_compressed_data_size,
+	              ASSORTED_TEST_DEFLATE_INDEX_DATA_SIZE,
+	              uncompressed_data,
+	              4096,
+	              &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_SSIZE(
+	 "read_count",
+	 read_count,
+	 (ssize_t) 0 );
+
+	ASSORTED_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Reads ranges that span multiple blocks using an index and compares them with the uncompressed test data
+ * Returns 1 if successful or 0 if not
+ */
+int assorted_test_deflate_index_read_ranges(
+     deflate_index_t *index,
+     deflate_stream_t *stream )
+{
+	uint64_t uncompressed_offsets[ 3 ];
+
+	libcerror_error_t *error = NULL;
+	ssize_t read_count       = 0;
+	int offset_index         = 0;
+	int result               = 0;
+
+	/* Test a range at the first access point, a range at another access point
+	 * and a range between access points
+	 */
+	uncompressed_offsets[ 0 ] = index->access_points[ 0 ].uncompressed_offset;
+	uncompressed_offsets[ 1 ] = index->access_points[ 2 ].uncompressed_offset;
+	uncompressed_offsets[ 2 ] = index->access_points[ 1 ].uncompressed_offset + 1000;
+
+	ASSORTED_TEST_ASSERT_LESS_THAN_UINT64(
+	 "uncompressed_offsets[ 2 ]",
+	 uncompressed_offsets[ 2 ],
+	 index->access_points[ 2 ].uncompressed_offset );
+
+	for( offset_index = 0;
+	     offset_index < 3;
+	     offset_index++ )
+	{
+		read_count = deflate_index_decompress_at_offset(
+		              index,
+		              stream,
+		              assorted_test_deflate_index_compressed_data,
+		              assorted_test_deflate_index_compressed_data_size,
+		              uncompressed_offsets[ offset_index ],
+		              assorted_test_deflate_index_range_data,
+		              ASSORTED_TEST_DEFLATE_INDEX_RANGE_SIZE,
+		              &error );
+
+		ASSORTED_TEST_ASSERT_EQUAL_SSIZE(
+		 "read_count",
+		 read_count,
+		 (ssize_t) ASSORTED_TEST_DEFLATE_INDEX_RANGE_SIZE );
+
+		ASSORTED_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		result = memory_compare(
+		          assorted_test_deflate_index_range_data,
+		          &( assorted_test_deflate_index_uncompressed_data[ uncompressed_offsets[ offset_index ] ] ),
+		          ASSORTED_TEST_DEFLATE_INDEX_RANGE_SIZE );
+
+		ASSORTED_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 0 );
+	}
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the deflate_index_initialize function
+ * Returns 1 if successful or 0 if not
+ */
+int assorted_test_deflate_index_initialize(
+     void )
+{
+	libcerror_error_t *error = NULL;
+	deflate_index_t *index   = NULL;
+	int result               = 0;
+
+	/* Test regular cases
+	 */
+	result = deflate_index_initialize(
+	          &index,
+	          ASSORTED_TEST_DEFLATE_INDEX_INTERVAL,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ASSORTED_TEST_ASSERT_IS_NOT_NULL(
+	 "index",
+	 index );
+
+	ASSORTED_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = deflate_index_free(
+	          &index,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ASSORTED_TEST_ASSERT_IS_NULL(
+	 "index",
+	 index );
+
+	ASSORTED_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = deflate_index_initialize(
+	          NULL,
+	          ASSORTED_TEST_DEFLATE_INDEX_INTERVAL,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ASSORTED_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = deflate_index_initialize(
+	          &index,
+	          0,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ASSORTED_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( index != NULL )
+	{
+		deflate_index_free(
+		 &index,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the deflate_index_decompress and deflate_index_decompress_at_offset functions
+ * Returns 1 if successful or 0 if not
+ */
+int assorted_test_deflate_index_decompress_at_offset(
+     void )
+{
+	uint8_t uncompressed_data[ 4096 ];
+
+	libcerror_error_t *error    = NULL;
+	deflate_index_t *index      = NULL;
+	deflate_stream_t *stream    = NULL;
+	ssize_t read_count          = 0;
+	uint64_t distance           = 0;
+	uint32_t access_point_index = 0;
+	int result                  = 0;
+
+	result = deflate_stream_initialize(
+	          &stream,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	result = deflate_index_initialize(
+	          &index,
+	          ASSORTED_TEST_DEFLATE_INDEX_INTERVAL,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	/* Test regular cases
+	 */
+	result = assorted_test_deflate_index_build(
+	          index,
+	          stream );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ASSORTED_TEST_ASSERT_EQUAL_UINT64(
+	 "index->uncompressed_data_size",
+	 index->uncompressed_data_size,
+	 (uint64_t) ASSORTED_TEST_DEFLATE_INDEX_DATA_SIZE );
+
+	ASSORTED_TEST_ASSERT_GREATER_THAN_INT(
+	 "index->number_of_access_points",
+	 (int) index->number_of_access_points,
+	 2 );
+
+	/* The first access point is the start of the first block after the zlib header
+	 */
+	ASSORTED_TEST_ASSERT_EQUAL_UINT64(
+	 "index->access_points[ 0 ].compressed_bit_offset",
+	 index->access_points[ 0 ].compressed_bit_offset,
+	 (uint64_t) 16 );
+
+	for( access_point_index = 1;
+	     access_point_index < index->number_of_access_points;
+	     access_point_index++ )
+	{
+		distance = index->access_points[ access_point_index ].uncompressed_offset
+		         - index->access_points[ access_point_index - 1 ].uncompressed_offset;
+
+		ASSORTED_TEST_ASSERT_LESS_THAN_UINT64(
+		 "interval",
+		 (uint64_t) ( ASSORTED_TEST_DEFLATE_INDEX_INTERVAL - 1 ),
+		 distance );
+
+		ASSORTED_TEST_ASSERT_EQUAL_UINT32(
+		 "window_size",
+		 index->access_points[ access_point_index ].window_size,
+		 (uint32_t) DEFLATE_STREAM_WINDOW_SIZE );
+	}
+	result = assorted_test_deflate_index_read_at_offsets(
+	          index,
+	          stream );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	result = assorted_test_deflate_index_read_ranges(
+	          index,
+	          stream );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	/* Test error cases
+	 */
+	read_count = deflate_index_decompress_at_offset(
+	              NULL,
+	              stream,
+	              assorted_test_deflate_index_compressed_data,
+	              assorted_test_deflate_index_compressed_data_size,
+	              0,
+	              uncompressed_data,
+	              4096,
+	              &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_SSIZE(
+	 "read_count",
+	 read_count,
+	 (ssize_t) -1 );
+
+	ASSORTED_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	read_count = deflate_index_decompress_at_offset(
+	              index,
+	              stream,
+	              assorted_test_deflate_index_compressed_data,
+	              assorted_test_deflate_index_compressed_data_size / 2,
+	              ASSORTED_TEST_DEFLATE_INDEX_DATA_SIZE - 100,
+	              uncompressed_data,
+	              4096,
+	              &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_SSIZE(
+	 "read_count",
+	 read_count,
+	 (ssize_t) -1 );
+
+	ASSORTED_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = deflate_index_free(
+	          &index,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	result = deflate_stream_free(
+	          &stream,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( index != NULL )
+	{
+		deflate_index_free(
+		 &index,
+		 NULL );
+	}
+	if( stream != NULL )
+	{
+		deflate_stream_free(
+		 &stream,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the deflate_index_write_data and deflate_index_read_data functions
+ * Returns 1 if successful or 0 if not
+ */
+int assorted_test_deflate_index_read_data(
+     void )
+{
+	libcerror_error_t *error = NULL;
+	deflate_index_t *index   = NULL;
+	deflate_index_t *index2  = NULL;
+	deflate_stream_t *stream = NULL;
+	uint8_t *data            = NULL;
+	size_t data_size         = 0;
+	int result               = 0;
+
+	result = deflate_stream_initialize(
+	          &stream,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	result = deflate_index_initialize(
+	          &index,
+	          ASSORTED_TEST_DEFLATE_INDEX_INTERVAL,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	result = assorted_test_deflate_index_build(
+	          index,
+	          stream );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	/* Test regular cases
+	 */
+	result = deflate_index_get_data_size(
+	          index,
+	          &data_size,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ASSORTED_TEST_ASSERT_GREATER_THAN_INT(
+	 "data_size",
+	 (int) data_size,
+	 DEFLATE_INDEX_HEADER_SIZE );
+
+	data = (uint8_t *) memory_allocate(
+	                    sizeof( uint8_t ) * data_size );
+
+	ASSORTED_TEST_ASSERT_IS_NOT_NULL(
+	 "data",
+	 data );
+
+	result = deflate_index_write_data(
+	          index,
+	          data,
+	          data_size,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	result = deflate_index_initialize(
+	          &index2,
+	          1,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	result = deflate_index_read_data(
+	          index2,
+	          data,
+	          data_size,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ASSORTED_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_UINT64(
+	 "index2->interval",
+	 index2->interval,
+	 (uint64_t) ASSORTED_TEST_DEFLATE_INDEX_INTERVAL );
+
+	ASSORTED_TEST_ASSERT_EQUAL_UINT64(
+	 "index2->uncompressed_data_size",
+	 index2->uncompressed_data_size,
+	 index->uncompressed_data_size );
+
+	ASSORTED_TEST_ASSERT_EQUAL_UINT32(
+	 "index2->number_of_access_points",
+	 index2->number_of_access_points,
+	 index->number_of_access_points );
+
+	result = assorted_test_deflate_index_read_at_offsets(
+	          index2,
+	          stream );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	/* Test error cases
+	 */
+	result = deflate_index_read_data(
+	          index2,
+	          data,
+	          data_size - 1,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ASSORTED_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	data[ 0 ] = 0xff;
+
+	result = deflate_index_read_data(
+	          index2,
+	          data,
+	          data_size,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ASSORTED_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = deflate_index_write_data(
+	          index,
+	          data,
+	          DEFLATE_INDEX_HEADER_SIZE,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ASSORTED_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	memory_free(
+	 data );
+
+	data = NULL;
+
+	result = deflate_index_free(
+	          &index2,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	result = deflate_index_free(
+	          &index,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	result = deflate_stream_free(
+	          &stream,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( data != NULL )
+	{
+		memory_free(
+		 data );
+	}
+	if( index2 != NULL )
+	{
+		deflate_index_free(
+		 &index2,
+		 NULL );
+	}
+	if( index != NULL )
+	{
+		deflate_index_free(
+		 &index,
+		 NULL );
+	}
+	if( stream != NULL )
+	{
+		deflate_stream_free(
+		 &stream,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* The main program
+ */
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+int wmain(
+     int argc ASSORTED_TEST_ATTRIBUTE_UNUSED,
+     wchar_t * const argv[] ASSORTED_TEST_ATTRIBUTE_UNUSED )
+#else
+int main(
+     int argc ASSORTED_TEST_ATTRIBUTE_UNUSED,
+     char * const argv[] ASSORTED_TEST_ATTRIBUTE_UNUSED )
+#endif
+{
+	ASSORTED_TEST_UNREFERENCED_PARAMETER( argc )
+	ASSORTED_TEST_UNREFERENCED_PARAMETER( argv )
+
+	if( assorted_test_deflate_index_fill_data() != 1 )
+	{
+		goto on_error;
+	}
+	ASSORTED_TEST_RUN(
+	 "deflate_index_initialize",
+	 assorted_test_deflate_index_initialize );
+
+	/* TODO: add tests for deflate_index_free */
+
+	ASSORTED_TEST_RUN(
+	 "deflate_index_decompress_at_offset",
+	 assorted_test_deflate_index_decompress_at_offset );
+
+	ASSORTED_TEST_RUN(
+	 "deflate_index_read_data",
+	 assorted_test_deflate_index_read_data );
+
+	return( EXIT_SUCCESS );
+
+on_error:
+	return( EXIT_FAILURE );
+}
+
@@ -0,0 +1,838 @@
+/*
+ * Deflate (zlib) speculative parallel decompression functions testing program
+ *
+ * Copyright (C) 2008-2019, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This software is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This software is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this software.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <file_stream.h>
+#include <memory.h>
+#include <types.h>
+
+#if defined( HAVE_STDLIB_H ) || defined( WINAPI )
+#include <stdlib.h>
+#endif
+
+#include "assorted_test_libcerror.h"
+#include "assorted_test_macros.h"
+#include "assorted_test_unused.h"
+#include "../src/deflate.h"
+#include "../src/deflate_parallel.h"
+
+/* A zlib stream of 2320 bytes of text that consists of two dynamic Huffman blocks
+ * of which the second block starts at bit offset 1120
+ */
+uint8_t assorted_test_deflate_parallel_compressed_data[ 494 ] = {
+	0x78, 0xda, 0x6c, 0x50, 0x5b, 0x0e, 0x03, 0x21, 0x08, 0xbc, 0x0a, 0x57, 0x43, 0x25, 0xd5, 0x2c,
+	0xea, 0x46, 0xb1, 0x9b, 0xbd, 0xfd, 0x36, 0x01, 0xdb, 0x68, 0xfa, 0x43, 0x08, 0x33, 0x99, 0x07,
+	0x5d, 0x1a, 0x61, 0x06, 0x4e, 0x42, 0x0d, 0x19, 0x4e, 0xfc, 0x4c, 0x26, 0x06, 0x1f, 0x47, 0x39,
+	0xe0, 0x4a, 0x25, 0xd4, 0x0b, 0xfa, 0x9d, 0x5d, 0x65, 0x08, 0xe4, 0x6b, 0xa0, 0x66, 0x58, 0x48,
+	0x5d, 0xb0, 0x78, 0xda, 0xa8, 0x27, 0xf9, 0xc1, 0x28, 0xe9, 0x4d, 0xcb, 0x6e, 0x30, 0x53, 0x79,
+	0x49, 0xfc, 0x47, 0x56, 0x15, 0x73, 0x32, 0x9a, 0xde, 0xb6, 0x4c, 0x0b, 0x36, 0x73, 0x0b, 0x3a,
+	0x5e, 0x0d, 0x27, 0x62, 0x8a, 0x4a, 0xc8, 0x28, 0x3e, 0x7e, 0xeb, 0xcc, 0x02, 0xb3, 0x97, 0xdd,
+	0x2d, 0xdc, 0xd6, 0xb2, 0x51, 0xaf, 0xbc, 0x95, 0xea, 0xfa, 0x3c, 0x57, 0x47, 0x09, 0xd8, 0xee,
+	0xdf, 0x32, 0x15, 0xd5, 0xd5, 0x12, 0xab, 0xf9, 0xfa, 0x01, 0x25, 0x3c, 0x7c, 0x54, 0xcb, 0x0e,
+	0xc2, 0x30, 0x0c, 0xfb, 0x56, 0x40, 0x9a, 0x90, 0x60, 0xec, 0xb4, 0xff, 0x47, 0xaa, 0x1f, 0xd4,
+	0xee, 0xc4, 0x65, 0xdd, 0x96, 0xc4, 0x71, 0x9c, 0x34, 0xc6, 0x2e, 0x3c, 0x58, 0xb3, 0x09, 0x73,
+	0x7e, 0x96, 0x93, 0x2d, 0xbc, 0x22, 0x9a, 0x2d, 0x82, 0x3f, 0x0f, 0x51, 0x55, 0x98, 0x93, 0xd3,
+	0x9b, 0xc7, 0xf3, 0xdc, 0xb6, 0xfd, 0xf6, 0xb1, 0x5b, 0x88, 0x04, 0x9e, 0x45, 0xdb, 0x6d, 0x53,
+	0x86, 0xfb, 0xfb, 0x78, 0xbc, 0x56, 0x8d, 0xa2, 0x27, 0x82, 0x2f, 0xf1, 0xa9, 0x23, 0x2b, 0xa4,
+	0x84, 0x4e, 0xe0, 0x97, 0x22, 0x07, 0x64, 0x27, 0xb4, 0x9b, 0x6a, 0xf1, 0x88, 0x4c, 0x4a, 0xc9,
+	0x36, 0xff, 0x13, 0x53, 0x03, 0x90, 0x80, 0xe2, 0x23, 0x5d, 0x91, 0xe4, 0x81, 0xda, 0xc5, 0x0f,
+	0x9e, 0x4a, 0x45, 0xf5, 0x86, 0xc7, 0x15, 0x25, 0x8f, 0x67, 0xf6, 0x19, 0x12, 0xad, 0xd5, 0xfd,
+	0x79, 0x29, 0x91, 0xeb, 0x62, 0x59, 0x6d, 0xd6, 0xe3, 0x6f, 0xe7, 0x88, 0x56, 0x91, 0x4e, 0xdc,
+	0xdb, 0x2a, 0x22, 0xd7, 0x06, 0x8c, 0x0d, 0xfe, 0x13, 0x95, 0x51, 0x92, 0x45, 0x61, 0x3d, 0xa0,
+	0x4a, 0x9f, 0xb5, 0x98, 0xa3, 0x7e, 0xe8, 0x8c, 0x3b, 0x54, 0xcc, 0x58, 0x42, 0xcf, 0x36, 0xe7,
+	0x66, 0xd0, 0x5d, 0x96, 0x84, 0x20, 0x60, 0x0e, 0xf4, 0x66, 0x0e, 0x1c, 0x07, 0x62, 0x12, 0xd4,
+	0x45, 0x7c, 0x19, 0xbe, 0x67, 0xba, 0xed, 0xe2, 0x56, 0x97, 0x69, 0x3c, 0x9b, 0xbf, 0x79, 0x34,
+	0xf7, 0xe5, 0xee, 0xe9, 0xcc, 0xed, 0x9c, 0x4b, 0xd8, 0x99, 0x85, 0xa6, 0xc5, 0xd1, 0xd4, 0xbe,
+	0x6d, 0x95, 0x31, 0x02, 0xc0, 0x20, 0x08, 0x03, 0xf7, 0x3e, 0xa6, 0xff, 0x7f, 0x5e, 0x07, 0x11,
+	0x7a, 0x17, 0x96, 0x2e, 0x36, 0xa8, 0x90, 0x8b, 0xf4, 0xb8, 0x4a, 0x57, 0xcd, 0x09, 0x05, 0xab,
+	0xcb, 0x5b, 0x99, 0xae, 0x55, 0xa0, 0x95, 0xe9, 0x78, 0xf0, 0x47, 0x0a, 0x69, 0xc8, 0x96, 0x3a,
+	0x2b, 0x3d, 0x5c, 0xca, 0xcf, 0xf7, 0x76, 0x65, 0x23, 0xb4, 0x1b, 0xdd, 0xc8, 0x60, 0x30, 0xce,
+	0x31, 0x38, 0x61, 0x4b, 0x1c, 0x32, 0x1e, 0xe3, 0xdb, 0x7e, 0xd5, 0x91, 0x89, 0x2c, 0xdb, 0xc0,
+	0x16, 0x89, 0xab, 0xe2, 0xf9, 0x9c, 0x6d, 0x5d, 0xb3, 0x35, 0xef, 0x05, 0x98, 0x04, 0xfd, 0x26,
+	0xfe, 0xa9, 0x9f, 0x1b, 0xc8, 0x43, 0xb7, 0x46, 0x60, 0x5c, 0x9b, 0x45, 0x27, 0x63, 0x94, 0x70,
+	0x8e, 0xcc, 0xe6, 0x6d, 0x65, 0xf7, 0x51, 0xbe, 0xcf, 0x07, 0x86, 0x51, 0x73, 0x4e };
+
+/* Tests the deflate_parallel_check_block_header function
+ * Returns 1 if successful or 0 if not
+ */
+int assorted_test_deflate_parallel_check_block_header(
+     void )
+{
+	int result = 0;
+
+	/* Test regular cases
+	 */
+	result = deflate_parallel_check_block_header(
+	          assorted_test_deflate_parallel_compressed_data,
+	          494,
+	          16 );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	result = deflate_parallel_check_block_header(
+	          assorted_test_deflate_parallel_compressed_data,
+	          494,
+	          1120 );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	/* The zlib header is not a plausible block header
+	 */
+	result = deflate_parallel_check_block_header(
+	          assorted_test_deflate_parallel_compressed_data,
+	          494,
+	          0 );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	/* Test error cases
+	 */
+	result = deflate_parallel_check_block_header(
+	          NULL,
+	          494,
+	          16 );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	result = deflate_parallel_check_block_header(
+	          assorted_test_deflate_parallel_compressed_data,
+	          3,
+	          16 );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	return( 1 );
+
+on_error:
+	return( 0 );
+}
+
+/* Tests the deflate_parallel_find_block function
+ * Returns 1 if successful or 0 if not
+ */
+int assorted_test_deflate_parallel_find_block(
+     void )
+{
+	libcerror_error_t *error  = NULL;
+	uint64_t block_bit_offset = 0;
+	int result                = 0;
+
+	/* Test regular cases
+	 */
+	result = deflate_parallel_find_block(
+	          assorted_test_deflate_parallel_compressed_data,
+	          494,
+	          17,
+	          494 * 8,
+	          &block_bit_offset,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ASSORTED_TEST_ASSERT_EQUAL_UINT64(
+	 "block_bit_offset",
+	 block_bit_offset,
+	 (uint64_t) 1120 );
+
+	ASSORTED_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* The second block is the last block hence there are no more candidates
+	 */
+	result = deflate_parallel_find_block(
+	          assorted_test_deflate_parallel_compressed_data,
+	          494,
+	          1121,
+	          494 * 8,
+	          &block_bit_offset,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	ASSORTED_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* The maximum bit offset limits the search
+	 */
+	result = deflate_parallel_find_block(
+	          assorted_test_deflate_parallel_compressed_data,
+	          494,
+	          17,
+	          1120,
+	          &block_bit_offset,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	ASSORTED_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = deflate_parallel_find_block(
+	          NULL,
+	          494,
+	          17,
+	          494 * 8,
+	          &block_bit_offset,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ASSORTED_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = deflate_parallel_find_block(
+	          assorted_test_deflate_parallel_compressed_data,
+	          494,
+	          17,
+	          494 * 8,
+	          NULL,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ASSORTED_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the deflate_parallel_chunk_initialize function
+ * Returns 1 if successful or 0 if not
+ */
+int assorted_test_deflate_parallel_chunk_initialize(
+     void )
+{
+	deflate_parallel_chunk_t *chunk = NULL;
+	libcerror_error_t *error        = NULL;
+	int result                      = 0;
+
+	/* Test regular cases
+	 */
+	result = deflate_parallel_chunk_initialize(
+	          &chunk,
+	          16,
+	          1120,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ASSORTED_TEST_ASSERT_IS_NOT_NULL(
+	 "chunk",
+	 chunk );
+
+	ASSORTED_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = deflate_parallel_chunk_free(
+	          &chunk,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ASSORTED_TEST_ASSERT_IS_NULL(
+	 "chunk",
+	 chunk );
+
+	ASSORTED_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = deflate_parallel_chunk_initialize(
+	          NULL,
+	          16,
+	          1120,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ASSORTED_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	chunk = (deflate_parallel_chunk_t *) 0x12345678UL;
+
+	result = deflate_parallel_chunk_initialize(
+	          &chunk,
+	          16,
+	          1120,
+	          &error );
+
+	chunk = NULL;
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ASSORTED_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = deflate_parallel_chunk_initialize(
+	          &chunk,
+	          1120,
+	          1120,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ASSORTED_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( chunk != NULL )
+	{
+		deflate_parallel_chunk_free(
+		 &chunk,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the deflate_parallel_chunk_decode and deflate_parallel_chunk_resolve functions
+ * Returns 1 if successful or 0 if not
+ */
+int assorted_test_deflate_parallel_chunk_decode(
+     void )
+{
+	uint8_t expected_data[ 4096 ];
+	uint8_t uncompressed_data[ 4096 ];
+
+	deflate_parallel_chunk_t *first_chunk  = NULL;
+	deflate_parallel_chunk_t *second_chunk = NULL;
+	libcerror_error_t *error               = NULL;
+	size_t expected_data_size              = 4096;
+	int result                             = 0;
+
+	/* Initialize test
+	 */
+	result = deflate_decompress(
+	          assorted_test_deflate_parallel_compressed_data,
+	          494,
+	          expected_data,
+	          &expected_data_size,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ASSORTED_TEST_ASSERT_EQUAL_SIZE(
+	 "expected_data_size",
+	 expected_data_size,
+	 (size_t) 2320 );
+
+	ASSORTED_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = deflate_parallel_chunk_initialize(
+	          &first_chunk,
+	          16,
+	          1120,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ASSORTED_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = deflate_parallel_chunk_initialize(
+	          &second_chunk,
+	          1120,
+	          ( 494 * 8 ) + 1,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ASSORTED_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	result = deflate_parallel_chunk_decode(
+	          first_chunk,
+	          assorted_test_deflate_parallel_compressed_data,
+	          494,
+	          4096,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ASSORTED_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_UINT64(
+	 "first_chunk->end_bit_offset",
+	 first_chunk->end_bit_offset,
+	 (uint64_t) 1120 );
+
+	ASSORTED_TEST_ASSERT_EQUAL_UINT8(
+	 "first_chunk->last_block_flag",
+	 first_chunk->last_block_flag,
+	 (uint8_t) 0 );
+
+	ASSORTED_TEST_ASSERT_EQUAL_SIZE(
+	 "first_chunk->number_of_window_references",
+	 first_chunk->number_of_window_references,
+	 (size_t) 0 );
+
+	/* The second chunk is decoded without the data of the first chunk
+	 */
+	result = deflate_parallel_chunk_decode(
+	          second_chunk,
+	          assorted_test_deflate_parallel_compressed_data,
+	          494,
+	          4096,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ASSORTED_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_UINT8(
+	 "second_chunk->last_block_flag",
+	 second_chunk->last_block_flag,
+	 (uint8_t) 1 );
+
+	ASSORTED_TEST_ASSERT_NOT_EQUAL_SSIZE(
+	 "second_chunk->number_of_window_references",
+	 (ssize_t) second_chunk->number_of_window_references,
+	 (ssize_t) 0 );
+
+	ASSORTED_TEST_ASSERT_EQUAL_SIZE(
+	 "number_of_symbols",
+	 first_chunk->number_of_symbols + second_chunk->number_of_symbols,
+	 (size_t) 2320 );
+
+	/* The window references of the second chunk cannot be resolved
+	 * before the data of the first chunk
+	 */
+	result = deflate_parallel_chunk_resolve(
+	          second_chunk,
+	          0,
+	          second_chunk->number_of_symbols,
+	          uncompressed_data,
+	          4096,
+	          0,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ASSORTED_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = deflate_parallel_chunk_resolve(
+	          first_chunk,
+	          0,
+	          first_chunk->number_of_symbols,
+	          uncompressed_data,
+	          4096,
+	          0,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ASSORTED_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = deflate_parallel_chunk_resolve(
+	          second_chunk,
+	          0,
+	          second_chunk->number_of_symbols,
+	          uncompressed_data,
+	          4096,
+	          first_chunk->number_of_symbols,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ASSORTED_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = memory_compare(
+	          uncompressed_data,
+	          expected_data,
+	          2320 );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	/* Test error cases
+	 */
+	result = deflate_parallel_chunk_resolve(
+	          first_chunk,
+	          0,
+	          first_chunk->number_of_symbols + 1,
+	          uncompressed_data,
+	          4096,
+	          0,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ASSORTED_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = deflate_parallel_chunk_resolve(
+	          first_chunk,
+	          0,
+	          first_chunk->number_of_symbols,
+	          uncompressed_data,
+	          16,
+	          0,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ASSORTED_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* A chunk that has already been decoded cannot be decoded again
+	 */
+	result = deflate_parallel_chunk_decode(
+	          first_chunk,
+	          assorted_test_deflate_parallel_compressed_data,
+	          494,
+	          4096,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ASSORTED_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = deflate_parallel_chunk_free(
+	          &second_chunk,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ASSORTED_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* The maximum number of symbols limits the size of the chunk
+	 */
+	result = deflate_parallel_chunk_initialize(
+	          &second_chunk,
+	          1120,
+	          ( 494 * 8 ) + 1,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ASSORTED_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = deflate_parallel_chunk_decode(
+	          second_chunk,
+	          assorted_test_deflate_parallel_compressed_data,
+	          494,
+	          16,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ASSORTED_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = deflate_parallel_chunk_decode(
+	          NULL,
+	          assorted_test_deflate_parallel_compressed_data,
+	          494,
+	          4096,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ASSORTED_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = deflate_parallel_chunk_decode(
+	          second_chunk,
+	          NULL,
+	          494,
+	          4096,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ASSORTED_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = deflate_parallel_chunk_free(
+	          &second_chunk,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ASSORTED_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = deflate_parallel_chunk_free(
+	          &first_chunk,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ASSORTED_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( second_chunk != NULL )
+	{
+		deflate_parallel_chunk_free(
+		 &second_chunk,
+		 NULL );
+	}
+	if( first_chunk != NULL )
+	{
+		deflate_parallel_chunk_free(
+		 &first_chunk,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* The main program
+ */
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+int wmain(
+     int argc ASSORTED_TEST_ATTRIBUTE_UNUSED,
+     wchar_t * const argv[] ASSORTED_TEST_ATTRIBUTE_UNUSED )
+#else
+int main(
+     int argc ASSORTED_TEST_ATTRIBUTE_UNUSED,
+     char * const argv[] ASSORTED_TEST_ATTRIBUTE_UNUSED )
+#endif
+{
+	ASSORTED_TEST_UNREFERENCED_PARAMETER( argc )
+	ASSORTED_TEST_UNREFERENCED_PARAMETER( argv )
+
+	ASSORTED_TEST_RUN(
+	 "deflate_parallel_check_block_header",
+	 assorted_test_deflate_parallel_check_block_header );
+
+	ASSORTED_TEST_RUN(
+	 "deflate_parallel_find_block",
+	 assorted_test_deflate_parallel_find_block );
+
+	ASSORTED_TEST_RUN(
+	 "deflate_parallel_chunk_initialize",
+	 assorted_test_deflate_parallel_chunk_initialize );
+
+	/* TODO: add tests for deflate_parallel_chunk_free */
+
+	ASSORTED_TEST_RUN(
+	 "deflate_parallel_chunk_decode",
+	 assorted_test_deflate_parallel_chunk_decode );
+
+	return( EXIT_SUCCESS );
+
+on_error:
+	return( EXIT_FAILURE );
+}
+
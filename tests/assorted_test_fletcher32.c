@@ -0,0 +1,431 @@
+/*
+ * Fletcher-32 functions testing program
+ *
+ * Copyright (C) 2008-2019, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This software is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This software is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this software.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <file_stream.h>
+#include <memory.h>
+#include <types.h>
+
+#if defined( HAVE_STDLIB_H ) || defined( WINAPI )
+#include <stdlib.h>
+#endif
+
+#include "assorted_test_libcerror.h"
+#include "assorted_test_macros.h"
+#include "assorted_test_unused.h"
+
+#include "../src/fletcher32.h"
+
+typedef int (*assorted_test_fletcher32_calculate_function_t)(
+               uint32_t previous_key,
+               uint8_t *buffer,
+               size_t size,
+               uint32_t *fletcher32,
+               libcerror_error_t **error );
+
+/* The check string used by the checksum catalogues
+ */
+uint8_t assorted_test_fletcher32_check_data[ 9 ] = {
+	'1', '2', '3', '4', '5', '6', '7', '8', '9' };
+
+/* The sizes around the points where the sums are reduced, which is
+ * every 5552 bytes for the deferred and every 5536 bytes for the SIMD variants
+ */
+size_t assorted_test_fletcher32_reduce_sizes[ 13 ] = {
+	5535, 5536, 5537, 5551, 5552, 5553, 11072, 11073,
+	11103, 11104, 11105, 16657, 20011 };
+
+/* Buffer large enough for 3 reduction blocks and a tail from every offset
+ * relative to a 64-byte boundary
+ */
+uint8_t assorted_test_fletcher32_data[ 64 + 63 + 20011 ];
+
+/* Tests a Fletcher-32 calculate function
+ * Returns 1 if successful or 0 if not
+ */
+int assorted_test_fletcher32_calculate_function(
+     assorted_test_fletcher32_calculate_function_t calculate_function )
+{
+	libcerror_error_t *error       = NULL;
+	uint8_t *aligned_data          = NULL;
+	size_t buffer_offset           = 0;
+	size_t buffer_size             = 0;
+	uint32_t calculated_fletcher32 = 0;
+	uint32_t expected_fletcher32   = 0;
+	int result                     = 0;
+	int size_index                 = 0;
+
+	/* Initialize test
+	 */
+	aligned_data = &( assorted_test_fletcher32_data[ ( 64 - ( (intptr_t) assorted_test_fletcher32_data % 64 ) ) % 64 ] );
+
+	for( buffer_offset = 0;
+	     buffer_offset < ( 63 + 20011 );
+	     buffer_offset++ )
+	{
+		aligned_data[ buffer_offset ] = (uint8_t) ( ( buffer_offset * 7 ) + ( buffer_offset >> 3 ) );
+	}
+
+	/* Test regular cases
+	 */
+	result = calculate_function(
+	          0,
+	          assorted_test_fletcher32_check_data,
+	          9,
+	          &calculated_fletcher32,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ASSORTED_TEST_ASSERT_EQUAL_UINT32(
+	 "calculated_fletcher32",
+	 calculated_fletcher32,
+	 (uint32_t) 0x091501ddUL );
+
+	ASSORTED_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = calculate_function(
+	          0x12345678UL,
+	          assorted_test_fletcher32_check_data,
+	          9,
+	          &calculated_fletcher32,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ASSORTED_TEST_ASSERT_EQUAL_UINT32(
+	 "calculated_fletcher32",
+	 calculated_fletcher32,
+	 (uint32_t) 0x25845855UL );
+
+	ASSORTED_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test with multiple reduction blocks and a tail from a misaligned buffer
+	 */
+	result = calculate_function(
+	          0,
+	          &( aligned_data[ 1 ] ),
+	          20011,
+	          &calculated_fletcher32,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ASSORTED_TEST_ASSERT_EQUAL_UINT32(
+	 "calculated_fletcher32",
+	 calculated_fletcher32,
+	 (uint32_t) 0x9609ee68UL );
+
+	ASSORTED_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = calculate_function(
+	          0x89abcdefUL,
+	          &( aligned_data[ 1 ] ),
+	          20011,
+	          &calculated_fletcher32,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ASSORTED_TEST_ASSERT_EQUAL_UINT32(
+	 "calculated_fletcher32",
+	 calculated_fletcher32,
+	 (uint32_t) 0xc7bbbc58UL );
+
+	ASSORTED_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test with all buffer sizes up to 5 blocks of 32 bytes and a tail from every
+	 * offset relative to a 64-byte boundary to cover the SIMD blocks and
+	 * the trailing bytes
+	 */
+	for( buffer_size = 0;
+	     buffer_size <= 191;
+	     buffer_size++ )
+	{
+		for( buffer_offset = 0;
+		     buffer_offset < 64;
+		     buffer_offset++ )
+		{
+			result = fletcher32_calculate(
+			          0x12345678UL,
+			          &( aligned_data[ buffer_offset ] ),
+			          buffer_size,
+			          &expected_fletcher32,
+			          &error );
+
+			ASSORTED_TEST_ASSERT_EQUAL_INT(
+			 "result",
+			 result,
+			 1 );
+
+			result = calculate_function(
+			          0x12345678UL,
+			          &( aligned_data[ buffer_offset ] ),
+			          buffer_size,
+			          &calculated_fletcher32,
+			          &error );
+
+			ASSORTED_TEST_ASSERT_EQUAL_INT(
+			 "result",
+			 result,
+			 1 );
+
+			ASSORTED_TEST_ASSERT_EQUAL_UINT32(
+			 "calculated_fletcher32",
+			 calculated_fletcher32,
+			 expected_fletcher32 );
+		}
+	}
+	ASSORTED_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test with the sizes around the reduction points, once with the pattern
+	 * and once with all bits set so the sums are at their largest
+	 */
+	for( size_index = 0;
+	     size_index < 26;
+	     size_index++ )
+	{
+		if( size_index == 13 )
+		{
+			if( memory_set(
+			     assorted_test_fletcher32_data,
+			     0xff,
+			     64 + 63 + 20011 ) == NULL )
+			{
+				goto on_error;
+			}
+		}
+		buffer_size = assorted_test_fletcher32_reduce_sizes[ size_index % 13 ];
+
+		for( buffer_offset = 0;
+		     buffer_offset < 64;
+		     buffer_offset += 7 )
+		{
+			result = fletcher32_calculate(
+			          0x89abcdefUL,
+			          &( aligned_data[ buffer_offset ] ),
+			          buffer_size,
+			          &expected_fletcher32,
+			          &error );
+
+			ASSORTED_TEST_ASSERT_EQUAL_INT(
+			 "result",
+			 result,
+			 1 );
+
+			result = calculate_function(
+			          0x89abcdefUL,
+			          &( aligned_data[ buffer_offset ] ),
+			          buffer_size,
+			          &calculated_fletcher32,
+			          &error );
+
+			ASSORTED_TEST_ASSERT_EQUAL_INT(
+			 "result",
+			 result,
+			 1 );
+
+			ASSORTED_TEST_ASSERT_EQUAL_UINT32(
+			 "calculated_fletcher32",
+			 calculated_fletcher32,
+			 expected_fletcher32 );
+		}
+	}
+	ASSORTED_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = calculate_function(
+	          0x89abcdefUL,
+	          aligned_data,
+	          20000,
+	          &calculated_fletcher32,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ASSORTED_TEST_ASSERT_EQUAL_UINT32(
+	 "calculated_fletcher32",
+	 calculated_fletcher32,
+	 (uint32_t) 0x5f5da01dUL );
+
+	ASSORTED_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = calculate_function(
+	          0,
+	          NULL,
+	          9,
+	          &calculated_fletcher32,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ASSORTED_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = calculate_function(
+	          0,
+	          assorted_test_fletcher32_check_data,
+	          (size_t) SSIZE_MAX + 1,
+	          &calculated_fletcher32,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ASSORTED_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = calculate_function(
+	          0,
+	          assorted_test_fletcher32_check_data,
+	          9,
+	          NULL,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ASSORTED_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the fletcher32_calculate function
+ * Returns 1 if successful or 0 if not
+ */
+int assorted_test_fletcher32_calculate(
+     void )
+{
+	return( assorted_test_fletcher32_calculate_function(
+	         fletcher32_calculate ) );
+}
+
+/* Tests the fletcher32_calculate_deferred function
+ * Returns 1 if successful or 0 if not
+ */
+int assorted_test_fletcher32_calculate_deferred(
+     void )
+{
+	return( assorted_test_fletcher32_calculate_function(
+	         fletcher32_calculate_deferred ) );
+}
+
+/* Tests the fletcher32_calculate_simd function
+ * Returns 1 if successful or 0 if not
+ */
+int assorted_test_fletcher32_calculate_simd(
+     void )
+{
+	return( assorted_test_fletcher32_calculate_function(
+	         fletcher32_calculate_simd ) );
+}
+
+/* The main program
+ */
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+int wmain(
+     int argc ASSORTED_TEST_ATTRIBUTE_UNUSED,
+     wchar_t * const argv[] ASSORTED_TEST_ATTRIBUTE_UNUSED )
+#else
+int main(
+     int argc ASSORTED_TEST_ATTRIBUTE_UNUSED,
+     char * const argv[] ASSORTED_TEST_ATTRIBUTE_UNUSED )
+#endif
+{
+	ASSORTED_TEST_UNREFERENCED_PARAMETER( argc )
+	ASSORTED_TEST_UNREFERENCED_PARAMETER( argv )
+
+	ASSORTED_TEST_RUN(
+	 "fletcher32_calculate",
+	 assorted_test_fletcher32_calculate );
+
+	ASSORTED_TEST_RUN(
+	 "fletcher32_calculate_deferred",
+	 assorted_test_fletcher32_calculate_deferred );
+
+	ASSORTED_TEST_RUN(
+	 "fletcher32_calculate_simd",
+	 assorted_test_fletcher32_calculate_simd );
+
+	return( EXIT_SUCCESS );
+
+on_error:
+	return( EXIT_FAILURE );
+}
+
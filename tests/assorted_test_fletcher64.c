@@ -0,0 +1,406 @@
+/*
+ * Fletcher-64 functions testing program
+ *
+ * Copyright (C) 2008-2019, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This software is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This software is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this software.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <file_stream.h>
+#include <types.h>
+
+#if defined( HAVE_STDLIB_H ) || defined( WINAPI )
+#include <stdlib.h>
+#endif
+
+#include "assorted_test_libcerror.h"
+#include "assorted_test_macros.h"
+#include "assorted_test_unused.h"
+
+#include "../src/fletcher64.h"
+
+typedef int (*assorted_test_fletcher64_calculate_function_t)(
+               uint64_t previous_key,
+               uint8_t *buffer,
+               size_t size,
+               uint64_t *fletcher64,
+               libcerror_error_t **error );
+
+/* The check string used by the checksum catalogues, truncated to a multiple of 4
+ */
+uint8_t assorted_test_fletcher64_check_data[ 8 ] = {
+	'1', '2', '3', '4', '5', '6', '7', '8' };
+
+/* The sizes around the points where the sums are reduced, which is every
+ * 65536 values for the basic variant and every 65536 vectors for the SIMD variants
+ */
+size_t assorted_test_fletcher64_reduce_sizes[ 10 ] = {
+	262140, 262144, 262148, 1048572, 1048576, 1048580,
+	2097148, 2097152, 2097156, 2097188 };
+
+/* Buffer large enough for 65536 vectors of 32 bytes and a tail from every offset
+ * relative to a 64-byte boundary
+ */
+uint8_t assorted_test_fletcher64_data[ 64 + 63 + 2097188 ];
+
+/* Tests a Fletcher-64 calculate function
+ * Returns 1 if successful or 0 if not
+ */
+int assorted_test_fletcher64_calculate_function(
+     assorted_test_fletcher64_calculate_function_t calculate_function )
+{
+	libcerror_error_t *error       = NULL;
+	uint8_t *aligned_data          = NULL;
+	size_t buffer_offset           = 0;
+	size_t buffer_size             = 0;
+	uint64_t calculated_fletcher64 = 0;
+	uint64_t expected_fletcher64   = 0;
+	uint32_t seed                  = 0x12345678UL;
+	int result                     = 0;
+	int size_index                 = 0;
+
+	/* Initialize test
+	 */
+	aligned_data = &( assorted_test_fletcher64_data[ ( 64 - ( (intptr_t) assorted_test_fletcher64_data % 64 ) ) % 64 ] );
+
+	for( buffer_offset = 0;
+	     buffer_offset < ( 63 + 2097188 );
+	     buffer_offset++ )
+	{
+		seed = ( seed * 1103515245UL ) + 12345UL;
+
+		aligned_data[ buffer_offset ] = (uint8_t) ( seed >> 24 );
+	}
+	/* Test regular cases
+	 */
+	result = calculate_function(
+	          0,
+	          assorted_test_fletcher64_check_data,
+	          8,
+	          &calculated_fletcher64,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ASSORTED_TEST_ASSERT_EQUAL_UINT64(
+	 "calculated_fletcher64",
+	 calculated_fletcher64,
+	 (uint64_t) 0xa09d9a976c6a6866ULL );
+
+	ASSORTED_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = calculate_function(
+	          0x123456789abcdef0ULL,
+	          assorted_test_fletcher64_check_data,
+	          8,
+	          &calculated_fletcher64,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ASSORTED_TEST_ASSERT_EQUAL_UINT64(
+	 "calculated_fletcher64",
+	 calculated_fletcher64,
+	 (uint64_t) 0xe84baef007274757ULL );
+
+	ASSORTED_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test with 1 MiB of data where the upper sum exceeds 64-bit
+	 * when it is not reduced
+	 */
+	result = calculate_function(
+	          0,
+	          aligned_data,
+	          1048576,
+	          &calculated_fletcher64,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ASSORTED_TEST_ASSERT_EQUAL_UINT64(
+	 "calculated_fletcher64",
+	 calculated_fletcher64,
+	 (uint64_t) 0xf7d2a301af4a3c98ULL );
+
+	ASSORTED_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = calculate_function(
+	          0x123456789abcdef0ULL,
+	          aligned_data,
+	          1048576,
+	          &calculated_fletcher64,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ASSORTED_TEST_ASSERT_EQUAL_UINT64(
+	 "calculated_fletcher64",
+	 calculated_fletcher64,
+	 (uint64_t) 0x85c9646d4a071b89ULL );
+
+	ASSORTED_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test with all buffer sizes up to 4 vectors of 128 bytes from every
+	 * offset relative to a 64-byte boundary to cover the SIMD vectors and
+	 * the trailing values
+	 */
+	for( buffer_size = 0;
+	     buffer_size <= 512;
+	     buffer_size += 4 )
+	{
+		for( buffer_offset = 0;
+		     buffer_offset < 64;
+		     buffer_offset++ )
+		{
+			result = fletcher64_calculate(
+			          0x123456789abcdef0ULL,
+			          &( aligned_data[ buffer_offset ] ),
+			          buffer_size,
+			          &expected_fletcher64,
+			          &error );
+
+			ASSORTED_TEST_ASSERT_EQUAL_INT(
+			 "result",
+			 result,
+			 1 );
+
+			result = calculate_function(
+			          0x123456789abcdef0ULL,
+			          &( aligned_data[ buffer_offset ] ),
+			          buffer_size,
+			          &calculated_fletcher64,
+			          &error );
+
+			ASSORTED_TEST_ASSERT_EQUAL_INT(
+			 "result",
+			 result,
+			 1 );
+
+			ASSORTED_TEST_ASSERT_EQUAL_UINT64(
+			 "calculated_fletcher64",
+			 calculated_fletcher64,
+			 expected_fletcher64 );
+		}
+	}
+	ASSORTED_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test with the sizes around the reduction points
+	 */
+	for( size_index = 0;
+	     size_index < 10;
+	     size_index++ )
+	{
+		buffer_size = assorted_test_fletcher64_reduce_sizes[ size_index ];
+
+		for( buffer_offset = 0;
+		     buffer_offset < 64;
+		     buffer_offset += 21 )
+		{
+			result = fletcher64_calculate(
+			          0x123456789abcdef0ULL,
+			          &( aligned_data[ buffer_offset ] ),
+			          buffer_size,
+			          &expected_fletcher64,
+			          &error );
+
+			ASSORTED_TEST_ASSERT_EQUAL_INT(
+			 "result",
+			 result,
+			 1 );
+
+			result = calculate_function(
+			          0x123456789abcdef0ULL,
+			          &( aligned_data[ buffer_offset ] ),
+			          buffer_size,
+			          &calculated_fletcher64,
+			          &error );
+
+			ASSORTED_TEST_ASSERT_EQUAL_INT(
+			 "result",
+			 result,
+			 1 );
+
+			ASSORTED_TEST_ASSERT_EQUAL_UINT64(
+			 "calculated_fletcher64",
+			 calculated_fletcher64,
+			 expected_fletcher64 );
+		}
+	}
+	ASSORTED_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = calculate_function(
+	          0,
+	          NULL,
+	          8,
+	          &calculated_fletcher64,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ASSORTED_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = calculate_function(
+	          0,
+	          assorted_test_fletcher64_check_data,
+	          (size_t) SSIZE_MAX + 1,
+	          &calculated_fletcher64,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ASSORTED_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = calculate_function(
+	          0,
+	          assorted_test_fletcher64_check_data,
+	          7,
+	          &calculated_fletcher64,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ASSORTED_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = calculate_function(
+	          0,
+	          assorted_test_fletcher64_check_data,
+	          8,
+	          NULL,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ASSORTED_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the fletcher64_calculate function
+ * Returns 1 if successful or 0 if not
+ */
+int assorted_test_fletcher64_calculate(
+     void )
+{
+	return( assorted_test_fletcher64_calculate_function(
+	         fletcher64_calculate ) );
+}
+
+/* Tests the fletcher64_calculate_simd function
+ * Returns 1 if successful or 0 if not
+ */
+int assorted_test_fletcher64_calculate_simd(
+     void )
+{
+	return( assorted_test_fletcher64_calculate_function(
+	         fletcher64_calculate_simd ) );
+}
+
+/* The main program
+ */
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+int wmain(
+     int argc ASSORTED_TEST_ATTRIBUTE_UNUSED,
+     wchar_t * const argv[] ASSORTED_TEST_ATTRIBUTE_UNUSED )
+#else
+int main(
+     int argc ASSORTED_TEST_ATTRIBUTE_UNUSED,
+     char * const argv[] ASSORTED_TEST_ATTRIBUTE_UNUSED )
+#endif
+{
+	ASSORTED_TEST_UNREFERENCED_PARAMETER( argc )
+	ASSORTED_TEST_UNREFERENCED_PARAMETER( argv )
+
+	ASSORTED_TEST_RUN(
+	 "fletcher64_calculate",
+	 assorted_test_fletcher64_calculate );
+
+	ASSORTED_TEST_RUN(
+	 "fletcher64_calculate_simd",
+	 assorted_test_fletcher64_calculate_simd );
+
+	return( EXIT_SUCCESS );
+
+on_error:
+	return( EXIT_FAILURE );
+}
+
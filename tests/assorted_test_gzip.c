@@ -0,0 +1,929 @@
+/*
+ * GZIP decompression functions testing program
+ *
+ * Copyright (C) 2008-2019, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This software is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This software is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this software.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <file_stream.h>
+#include <memory.h>
+#include <types.h>
+
+#if defined( HAVE_STDLIB_H ) || defined( WINAPI )
+#include <stdlib.h>
+#endif
+
+#include "assorted_test_libcerror.h"
+#include "assorted_test_macros.h"
+#include "assorted_test_unused.h"
+#include "../src/gzip.h"
+
+/* A member with a name and header CRC
+ */
+uint8_t assorted_test_gzip_member1[ 65 ] = {
+	0x1f, 0x8b, 0x08, 0x0a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x67, 0x7a, 0x69, 0x70, 0x2e, 0x74,
+	0x78, 0x74, 0x00, 0x83, 0xf9, 0x73, 0x8f, 0xf2, 0x0c, 0x50, 0x48, 0xce, 0xcf, 0x2d, 0x28, 0x4a,
+	0x2d, 0x2e, 0x4e, 0x4d, 0x51, 0x48, 0x49, 0x2c, 0x49, 0x54, 0xc8, 0x4f, 0x53, 0x48, 0x54, 0xc8,
+	0x4d, 0xcd, 0x4d, 0x4a, 0x2d, 0xd2, 0xe3, 0x02, 0x00, 0x6d, 0xe4, 0x5e, 0x5f, 0x22, 0x00, 0x00,
+	0x00 };
+
+/* A BGZF member
+ */
+uint8_t assorted_test_gzip_member2[ 78 ] = {
+	0x1f, 0x8b, 0x08, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x06, 0x00, 0x42, 0x43, 0x02, 0x00,
+	0x4d, 0x00, 0x73, 0x54, 0x70, 0x72, 0x8f, 0x72, 0x53, 0xc8, 0x4d, 0xcd, 0x4d, 0x4a, 0x2d, 0x52,
+	0x28, 0x2e, 0xc9, 0x2f, 0x4a, 0x2d, 0x56, 0x28, 0xc9, 0x48, 0x55, 0x28, 0xce, 0xac, 0x4a, 0x55,
+	0xc8, 0x4f, 0x03, 0xb3, 0xa1, 0xb2, 0x99, 0x79, 0x0a, 0x99, 0x25, 0xc5, 0x0a, 0x19, 0xa9, 0x89,
+	0x29, 0xa9, 0x45, 0x7a, 0x5c, 0x00, 0xbc, 0xc3, 0xa0, 0x7c, 0x3b, 0x00, 0x00, 0x00 };
+
+uint8_t *assorted_test_gzip_uncompressed_data1 = (uint8_t *) \
+	"GZIP compressed data of a member.\n";
+
+uint8_t *assorted_test_gzip_uncompressed_data2 = (uint8_t *) \
+	"A BGZF member stores the size of the member in its header.\n";
+
+/* Tests the gzip_check_signature function
+ * Returns 1 if successful or 0 if not
+ */
+int assorted_test_gzip_check_signature(
+     void )
+{
+	int result = 0;
+
+	/* Test regular cases
+	 */
+	result = gzip_check_signature(
+	          assorted_test_gzip_member1,
+	          65 );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	result = gzip_check_signature(
+	          &( assorted_test_gzip_member1[ 1 ] ),
+	          64 );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	/* Test error cases
+	 */
+	result = gzip_check_signature(
+	          NULL,
+	          65 );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	result = gzip_check_signature(
+	          assorted_test_gzip_member1,
+	          1 );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	return( 1 );
+
+on_error:
+	return( 0 );
+}
+
+/* Tests the gzip_member_header_read_data function
+ * Returns 1 if successful or 0 if not
+ */
+int assorted_test_gzip_member_header_read_data(
+     void )
+{
+	uint8_t member_data[ 65 ];
+
+	gzip_member_header_t member_header;
+
+	libcerror_error_t *error = NULL;
+	int result               = 0;
+
+	/* Test regular cases
+	 */
+	result = gzip_member_header_read_data(
+	          &member_header,
+	          assorted_test_gzip_member1,
+	          65,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ASSORTED_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_UINT8(
+	 "member_header.flags",
+	 member_header.flags,
+	 (uint8_t) ( GZIP_MEMBER_FLAG_HEADER_CRC | GZIP_MEMBER_FLAG_NAME ) );
+
+	ASSORTED_TEST_ASSERT_EQUAL_UINT8(
+	 "member_header.operating_system",
+	 member_header.operating_system,
+	 (uint8_t) 3 );
+
+	ASSORTED_TEST_ASSERT_EQUAL_SIZE(
+	 "member_header.header_size",
+	 member_header.header_size,
+	 (size_t) 21 );
+
+	ASSORTED_TEST_ASSERT_EQUAL_SIZE(
+	 "member_header.bgzf_member_size",
+	 member_header.bgzf_member_size,
+	 (size_t) 0 );
+
+	result = gzip_member_header_read_data(
+	          &member_header,
+	          assorted_test_gzip_member2,
+	          78,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ASSORTED_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_SIZE(
+	 "member_header.header_size",
+	 member_header.header_size,
+	 (size_t) 18 );
+
+	ASSORTED_TEST_ASSERT_EQUAL_SIZE(
+	 "member_header.bgzf_member_size",
+	 member_header.bgzf_member_size,
+	 (size_t) 78 );
+
+	/* Data that does not start with a member header
+	 */
+	result = gzip_member_header_read_data(
+	          &member_header,
+	          &( assorted_test_gzip_member1[ 1 ] ),
+	          64,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	ASSORTED_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = gzip_member_header_read_data(
+	          NULL,
+	          assorted_test_gzip_member1,
+	          65,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ASSORTED_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = gzip_member_header_read_data(
+	          &member_header,
+	          NULL,
+	          65,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ASSORTED_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* A name that is not terminated
+	 */
+	result = gzip_member_header_read_data(
+	          &member_header,
+	          assorted_test_gzip_member1,
+	          15,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ASSORTED_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* A header CRC that does not match
+	 */
+	result = memory_copy(
+	          member_data,
+	          assorted_test_gzip_member1,
+	          65 ) == NULL;
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	member_data[ 10 ] = 'G';
+
+	result = gzip_member_header_read_data(
+	          &member_header,
+	          member_data,
+	          65,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ASSORTED_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the gzip_member_footer_read_data function
+ * Returns 1 if successful or 0 if not
+ */
+int assorted_test_gzip_member_footer_read_data(
+     void )
+{
+	libcerror_error_t *error   = NULL;
+	uint32_t crc32             = 0;
+	uint32_t uncompressed_size = 0;
+	int result                 = 0;
+
+	/* Test regular cases
+	 */
+	result = gzip_member_footer_read_data(
+	          &( assorted_test_gzip_member1[ 57 ] ),
+	          8,
+	          &crc32,
+	          &uncompressed_size,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ASSORTED_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_UINT32(
+	 "crc32",
+	 crc32,
+	 (uint32_t) 0x5f5ee46dUL );
+
+	ASSORTED_TEST_ASSERT_EQUAL_UINT32(
+	 "uncompressed_size",
+	 uncompressed_size,
+	 (uint32_t) 34 );
+
+	/* Test error cases
+	 */
+	result = gzip_member_footer_read_data(
+	          NULL,
+	          8,
+	          &crc32,
+	          &uncompressed_size,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ASSORTED_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = gzip_member_footer_read_data(
+	          &( assorted_test_gzip_member1[ 57 ] ),
+	          7,
+	          &crc32,
+	          &uncompressed_size,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ASSORTED_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the gzip_decoder_initialize function
+ * Returns 1 if successful or 0 if not
+ */
+int assorted_test_gzip_decoder_initialize(
+     void )
+{
+	libcerror_error_t *error = NULL;
+	gzip_decoder_t *decoder  = NULL;
+	int result               = 0;
+
+	/* Test regular cases
+	 */
+	result = gzip_decoder_initialize(
+	          &decoder,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ASSORTED_TEST_ASSERT_IS_NOT_NULL(
+	 "decoder",
+	 decoder );
+
+	ASSORTED_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = gzip_decoder_free(
+	          &decoder,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ASSORTED_TEST_ASSERT_IS_NULL(
+	 "decoder",
+	 decoder );
+
+	ASSORTED_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = gzip_decoder_initialize(
+	          NULL,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ASSORTED_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	decoder = (gzip_decoder_t *) 0x12345678UL;
+
+	result = gzip_decoder_initialize(
+	          &decoder,
+	          &error );
+
+	decoder = NULL;
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ASSORTED_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( decoder != NULL )
+	{
+		gzip_decoder_free(
+		 &decoder,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the gzip_decoder_decompress_member function
+ * Returns 1 if successful or 0 if not
+ */
+int assorted_test_gzip_decoder_decompress_member(
+     void )
+{
+	uint8_t compressed_data[ 143 ];
+	uint8_t uncompressed_data[ 128 ];
+
+	libcerror_error_t *error      = NULL;
+	gzip_decoder_t *decoder       = NULL;
+	size_t member_size            = 0;
+	size_t uncompressed_data_size = 0;
+	int result                    = 0;
+
+	/* Initialize test
+	 */
+	result = memory_copy(
+	          compressed_data,
+	          assorted_test_gzip_member1,
+	          65 ) == NULL;
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	result = memory_copy(
+	          &( compressed_data[ 65 ] ),
+	          assorted_test_gzip_member2,
+	          78 ) == NULL;
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	result = gzip_decoder_initialize(
+	          &decoder,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ASSORTED_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	ASSORTED_TEST_ASSERT_IS_NOT_NULL(
+	 "decoder",
+	 decoder );
+
+	/* Test regular cases
+	 */
+	/* The first member is followed by the second member, which is ignored
+	 */
+	uncompressed_data_size = 128;
+
+	result = gzip_decoder_decompress_member(
+	          decoder,
+	          compressed_data,
+	          143,
+	          uncompressed_data,
+	          &uncompressed_data_size,
+	          &member_size,
+	          0,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ASSORTED_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_SIZE(
+	 "member_size",
+	 member_size,
+	 (size_t) 65 );
+
+	ASSORTED_TEST_ASSERT_EQUAL_SIZE(
+	 "uncompressed_data_size",
+	 uncompressed_data_size,
+	 (size_t) 34 );
+
+	result = memory_compare(
+	          uncompressed_data,
+	          assorted_test_gzip_uncompressed_data1,
+	          34 );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	uncompressed_data_size = 128;
+
+	result = gzip_decoder_decompress_member(
+	          decoder,
+	          &( compressed_data[ 65 ] ),
+	          78,
+	          uncompressed_data,
+	          &uncompressed_data_size,
+	          &member_size,
+	          0,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ASSORTED_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_SIZE(
+	 "member_size",
+	 member_size,
+	 (size_t) 78 );
+
+	ASSORTED_TEST_ASSERT_EQUAL_SIZE(
+	 "uncompressed_data_size",
+	 uncompressed_data_size,
+	 (size_t) 59 );
+
+	result = memory_compare(
+	          uncompressed_data,
+	          assorted_test_gzip_uncompressed_data2,
+	          59 );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	/* A CRC-32 that does not match is ignored if requested
+	 */
+	compressed_data[ 57 ] ^= 0x01;
+
+	uncompressed_data_size = 128;
+
+	result = gzip_decoder_decompress_member(
+	          decoder,
+	          compressed_data,
+	          65,
+	          uncompressed_data,
+	          &uncompressed_data_size,
+	          &member_size,
+	          GZIP_DECOMPRESS_FLAG_IGNORE_CHECKSUM,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ASSORTED_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	/* A CRC-32 that does not match
+	 */
+	uncompressed_data_size = 128;
+
+	result = gzip_decoder_decompress_member(
+	          decoder,
+	          compressed_data,
+	          65,
+	          uncompressed_data,
+	          &uncompressed_data_size,
+	          &member_size,
+	          0,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ASSORTED_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	compressed_data[ 57 ] ^= 0x01;
+
+	/* An uncompressed size that does not match
+	 */
+	compressed_data[ 61 ] ^= 0x01;
+
+	uncompressed_data_size = 128;
+
+	result = gzip_decoder_decompress_member(
+	          decoder,
+	          compressed_data,
+	          65,
+	          uncompressed_data,
+	          &uncompressed_data_size,
+	          &member_size,
+	          0,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ASSORTED_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	compressed_data[ 61 ] ^= 0x01;
+
+	/* An uncompressed data buffer that is too small
+	 */
+	uncompressed_data_size = 16;
+
+	result = gzip_decoder_decompress_member(
+	          decoder,
+	          compressed_data,
+	          65,
+	          uncompressed_data,
+	          &uncompressed_data_size,
+	          &member_size,
+	          0,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ASSORTED_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* A truncated member
+	 */
+	uncompressed_data_size = 128;
+
+	result = gzip_decoder_decompress_member(
+	          decoder,
+	          compressed_data,
+	          60,
+	          uncompressed_data,
+	          &uncompressed_data_size,
+	          &member_size,
+	          0,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ASSORTED_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* A BGZF member size that exceeds the data
+	 */
+	uncompressed_data_size = 128;
+
+	result = gzip_decoder_decompress_member(
+	          decoder,
+	          &( compressed_data[ 65 ] ),
+	          77,
+	          uncompressed_data,
+	          &uncompressed_data_size,
+	          &member_size,
+	          0,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ASSORTED_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Data that does not start with a member header
+	 */
+	uncompressed_data_size = 128;
+
+	result = gzip_decoder_decompress_member(
+	          decoder,
+	          &( compressed_data[ 1 ] ),
+	          64,
+	          uncompressed_data,
+	          &uncompressed_data_size,
+	          &member_size,
+	          0,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ASSORTED_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	uncompressed_data_size = 128;
+
+	result = gzip_decoder_decompress_member(
+	          decoder,
+	          compressed_data,
+	          65,
+	          uncompressed_data,
+	          &uncompressed_data_size,
+	          &member_size,
+	          0xff,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ASSORTED_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = gzip_decoder_free(
+	          &decoder,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ASSORTED_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	ASSORTED_TEST_ASSERT_IS_NULL(
+	 "decoder",
+	 decoder );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( decoder != NULL )
+	{
+		gzip_decoder_free(
+		 &decoder,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* The main program
+ */
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+int wmain(
+     int argc ASSORTED_TEST_ATTRIBUTE_UNUSED,
+     wchar_t * const argv[] ASSORTED_TEST_ATTRIBUTE_UNUSED )
+#else
+int main(
+     int argc ASSORTED_TEST_ATTRIBUTE_UNUSED,
+     char * const argv[] ASSORTED_TEST_ATTRIBUTE_UNUSED )
+#endif
+{
+	ASSORTED_TEST_UNREFERENCED_PARAMETER( argc )
+	ASSORTED_TEST_UNREFERENCED_PARAMETER( argv )
+
+	ASSORTED_TEST_RUN(
+	 "gzip_check_signature",
+	 assorted_test_gzip_check_signature );
+
+	ASSORTED_TEST_RUN(
+	 "gzip_member_header_read_data",
+	 assorted_test_gzip_member_header_read_data );
+
+	ASSORTED_TEST_RUN(
+	 "gzip_member_footer_read_data",
+	 assorted_test_gzip_member_footer_read_data );
+
+	ASSORTED_TEST_RUN(
+	 "gzip_decoder_initialize",
+	 assorted_test_gzip_decoder_initialize );
+
+	/* TODO: add tests for gzip_decoder_free */
+
+	ASSORTED_TEST_RUN(
+	 "gzip_decoder_decompress_member",
+	 assorted_test_gzip_decoder_decompress_member );
+
+	return( EXIT_SUCCESS );
+
+on_error:
+	return( EXIT_FAILURE );
+}
+
@@ -0,0 +1,800 @@
+/*
+ * LZFSE decompression functions testing program
+ *
+ * Copyright (C) 2008-2019, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This software is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This software is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this software.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <file_stream.h>
+#include <memory.h>
+#include <types.h>
+
+#if defined( HAVE_STDLIB_H ) || defined( WINAPI )
+#include <stdlib.h>
+#endif
+
+#include "assorted_test_libcerror.h"
+#include "assorted_test_macros.h"
+#include "assorted_test_unused.h"
+#include "../src/lzfse.h"
+
+/* A LZFSE compressed stream that consists of 2 compressed (version 2) blocks, where the second
+ * block refers to the uncompressed data of the first block, an uncompressed block, a LZVN
+ * compressed block and the end of stream block
+ */
+uint8_t assorted_test_lzfse_compressed_data[ 426 ] = {
+	0x62, 0x76, 0x78, 0x32, 0x6b, 0x00, 0x00, 0x00, 0x44, 0x00, 0x50, 0x02, 0x00, 0x03, 0x00, 0x10,
+	0xf5, 0x80, 0x94, 0x0e, 0x43, 0x05, 0x00, 0x00, 0xa1, 0x00, 0x00, 0x00, 0x2f, 0xbc, 0x70, 0x00,
+	0x00, 0x00, 0x00, 0x70, 0xce, 0x35, 0xd7, 0x00, 0xc0, 0x35, 0x00, 0x00, 0x3f, 0x01, 0x00, 0x00,
+	0x00, 0xf0, 0x3e, 0xf0, 0x3d, 0x7c, 0x0f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x6f, 0x00, 0x00, 0x00, 0x77, 0x00, 0x00, 0x00, 0x00, 0x00, 0xfc, 0x1f, 0x00,
+	0x00, 0x00, 0xdc, 0x01, 0x00, 0x00, 0x00, 0x00, 0xc0, 0xdd, 0x1d, 0x00, 0x77, 0x00, 0x70, 0x77,
+	0x07, 0xc0, 0x1d, 0x00, 0x3c, 0x09, 0x77, 0x5f, 0xc1, 0x57, 0xf0, 0x61, 0xbc, 0x01, 0xbc, 0x01,
+	0x70, 0x77, 0xf7, 0x06, 0xdc, 0x3d, 0x0d, 0x77, 0x3c, 0x09, 0x3f, 0xc4, 0x93, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x88, 0xb9, 0xf0, 0xf8, 0x83, 0x7f, 0x9c, 0x0c, 0xb4, 0x84, 0xd3, 0xeb, 0x65,
+	0x37, 0x5a, 0xd5, 0x9e, 0x1d, 0x72, 0x81, 0x02, 0x45, 0x73, 0x23, 0x4b, 0x04, 0xeb, 0x92, 0x5a,
+	0x1f, 0x59, 0x9a, 0xc5, 0xee, 0x01, 0x24, 0x54, 0xd9, 0x18, 0x01, 0x62, 0x76, 0x78, 0x32, 0x0d,
+	0x00, 0x00, 0x00, 0x04, 0x00, 0x10, 0x00, 0x00, 0x02, 0x00, 0x50, 0x00, 0x03, 0x08, 0x00, 0x00,
+	0x02, 0x00, 0x10, 0x88, 0x00, 0x00, 0x00, 0x10, 0x80, 0x00, 0x08, 0x8f, 0x00, 0x8f, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x8f, 0x00, 0x00, 0x00, 0x3c, 0x02, 0x00, 0x00, 0x8f, 0x06, 0x00, 0x00, 0x00,
+	0xc0, 0xa3, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x8f, 0x1e,
+	0x00, 0x00, 0x8f, 0x0e, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf0, 0xe8, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x70, 0x00, 0x62, 0x76, 0x78, 0x2d, 0x14, 0x00, 0x00, 0x00, 0x55, 0x6e,
+	0x63, 0x6f, 0x6d, 0x70, 0x72, 0x65, 0x73, 0x73, 0x65, 0x64, 0x20, 0x62, 0x6c, 0x6f, 0x63, 0x6b,
+	0x2e, 0x0a, 0x62, 0x76, 0x78, 0x6e, 0x2e, 0x00, 0x00, 0x00, 0x28, 0x00, 0x00, 0x00, 0xe0, 0x04,
+	0x4c, 0x5a, 0x56, 0x4e, 0x20, 0x63, 0x6f, 0x6d, 0x70, 0x72, 0x65, 0x73, 0x73, 0x65, 0x64, 0x20,
+	0x62, 0x6c, 0x6f, 0x63, 0xc8, 0x17, 0x6b, 0x2c, 0x20, 0xf0, 0x01, 0xe2, 0x2e, 0x0a, 0x06, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x62, 0x76, 0x78, 0x24 };
+
+uint8_t *assorted_test_lzfse_uncompressed_data = (uint8_t *) \
+	"LZFSE compressed data blocks of a LZFSE compressed stream.\n"
+	"The second block refers to the LZFSE compressed data blocks.\n"
+	"Uncompressed block.\n"
+	"LZVN compressed block, LZVN compressed block.\n";
+
+/* Tests the lzfse_read_compressed_block_header function
+ * Returns 1 if successful or 0 if not
+ */
+int assorted_test_lzfse_read_compressed_block_header(
+     void )
+{
+	lzfse_compressed_block_header_t header;
+
+	libcerror_error_t *error = NULL;
+	int result               = 0;
+
+	/* Test regular cases
+	 */
+	result = lzfse_read_compressed_block_header(
+	          &header,
+	          assorted_test_lzfse_compressed_data,
+	          426,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ASSORTED_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_UINT32(
+	 "header.header_size",
+	 header.header_size,
+	 (uint32_t) 161 );
+
+	ASSORTED_TEST_ASSERT_EQUAL_UINT32(
+	 "header.uncompressed_size",
+	 header.uncompressed_size,
+	 (uint32_t) 107 );
+
+	ASSORTED_TEST_ASSERT_EQUAL_UINT32(
+	 "header.number_of_literals",
+	 header.number_of_literals,
+	 (uint32_t) 68 );
+
+	ASSORTED_TEST_ASSERT_EQUAL_UINT32(
+	 "header.literals_size",
+	 header.literals_size,
+	 (uint32_t) 37 );
+
+	ASSORTED_TEST_ASSERT_EQUAL_UINT32(
+	 "header.number_of_matches",
+	 header.number_of_matches,
+	 (uint32_t) 3 );
+
+	ASSORTED_TEST_ASSERT_EQUAL_UINT32(
+	 "header.lmd_size",
+	 header.lmd_size,
+	 (uint32_t) 5 );
+
+	/* Test error cases
+	 */
+	result = lzfse_read_compressed_block_header(
+	          NULL,
+	          assorted_test_lzfse_compressed_data,
+	          426,
+	          &error );
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ASSORTED_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = lzfse_read_compressed_block_header(
+	          &header,
+	          NULL,
+	          426,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ASSORTED_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = lzfse_read_compressed_block_header(
+	          &header,
+	          assorted_test_lzfse_compressed_data,
+	          16,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ASSORTED_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Test data too small to contain the frequency tables
+	 */
+	result = lzfse_read_compressed_block_header(
+	          &header,
+	          assorted_test_lzfse_compressed_data,
+	          64,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ASSORTED_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Test unsupported signature
+	 */
+	result = lzfse_read_compressed_block_header(
+	          &header,
+	          &( assorted_test_lzfse_compressed_data[ 342 ] ),
+	          84,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ASSORTED_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the lzfse_decoder_table_construct function
+ * Returns 1 if successful or 0 if not
+ */
+int assorted_test_lzfse_decoder_table_construct(
+     void )
+{
+	lzfse_decoder_entry_t table[ 4 ];
+
+	uint16_t frequencies[ 3 ]         = { 2, 1, 1 };
+	uint16_t invalid_frequencies[ 3 ] = { 3, 1, 1 };
+
+	libcerror_error_t *error = NULL;
+	int result               = 0;
+
+	/* Test regular cases
+	 */
+	result = lzfse_decoder_table_construct(
+	          table,
+	          4,
+	          frequencies,
+	          3,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ASSORTED_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Symbol 0 occupies 2 states that read 1 bit and symbols 1 and 2
+	 * occupy 1 state each that reads 2 bits
+	 */
+	ASSORTED_TEST_ASSERT_EQUAL_UINT8(
+	 "table[ 0 ].number_of_bits",
+	 table[ 0 ].number_of_bits,
+	 (uint8_t) 1 );
+
+	ASSORTED_TEST_ASSERT_EQUAL_UINT8(
+	 "table[ 0 ].symbol",
+	 table[ 0 ].symbol,
+	 (uint8_t) 0 );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT16(
+	 "table[ 0 ].delta",
+	 table[ 0 ].delta,
+	 (int16_t) 0 );
+
+	ASSORTED_TEST_ASSERT_EQUAL_UINT8(
+	 "table[ 1 ].number_of_bits",
+	 table[ 1 ].number_of_bits,
+	 (uint8_t) 1 );
+
+	ASSORTED_TEST_ASSERT_EQUAL_UINT8(
+	 "table[ 1 ].symbol",
+	 table[ 1 ].symbol,
+	 (uint8_t) 0 );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT16(
+	 "table[ 1 ].delta",
+	 table[ 1 ].delta,
+	 (int16_t) 2 );
+
+	ASSORTED_TEST_ASSERT_EQUAL_UINT8(
+	 "table[ 2 ].number_of_bits",
+	 table[ 2 ].number_of_bits,
+	 (uint8_t) 2 );
+
+	ASSORTED_TEST_ASSERT_EQUAL_UINT8(
+	 "table[ 2 ].symbol",
+	 table[ 2 ].symbol,
+	 (uint8_t) 1 );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT16(
+	 "table[ 2 ].delta",
+	 table[ 2 ].delta,
+	 (int16_t) 0 );
+
+	ASSORTED_TEST_ASSERT_EQUAL_UINT8(
+	 "table[ 3 ].number_of_bits",
+	 table[ 3 ].number_of_bits,
+	 (uint8_t) 2 );
+
+	ASSORTED_TEST_ASSERT_EQUAL_UINT8(
+	 "table[ 3 ].symbol",
+	 table[ 3 ].symbol,
+	 (uint8_t) 2 );
+
+	/* Test error cases
+	 */
+	result = lzfse_decoder_table_construct(
+	          NULL,
+	          4,
+	          frequencies,
+	          3,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ASSORTED_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = lzfse_decoder_table_construct(
+	          table,
+	          4,
+	          NULL,
+	          3,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ASSORTED_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Test frequencies that exceed the number of states
+	 */
+	result = lzfse_decoder_table_construct(
+	          table,
+	          4,
+	          invalid_frequencies,
+	          3,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ASSORTED_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the lzfse_get_uncompressed_size function
+ * Returns 1 if successful or 0 if not
+ */
+int assorted_test_lzfse_get_uncompressed_size(
+     void )
+{
+	libcerror_error_t *error      = NULL;
+	size_t uncompressed_data_size = 0;
+	int result                    = 0;
+
+	/* Test regular cases
+	 */
+	result = lzfse_get_uncompressed_size(
+	          assorted_test_lzfse_compressed_data,
+	          426,
+	          &uncompressed_data_size,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ASSORTED_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_SIZE(
+	 "uncompressed_data_size",
+	 uncompressed_data_size,
+	 (size_t) 186 );
+
+	/* Test error cases
+	 */
+	result = lzfse_get_uncompressed_size(
+	          NULL,
+	          426,
+	          &uncompressed_data_size,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ASSORTED_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = lzfse_get_uncompressed_size(
+	          assorted_test_lzfse_compressed_data,
+	          426,
+	          NULL,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ASSORTED_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Test data without the end of stream block
+	 */
+	result = lzfse_get_uncompressed_size(
+	          assorted_test_lzfse_compressed_data,
+	          422,
+	          &uncompressed_data_size,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ASSORTED_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the lzfse_decompress function
+ * Returns 1 if successful or 0 if not
+ */
+int assorted_test_lzfse_decompress(
+     void )
+{
+	uint8_t uncompressed_data[ 256 ];
+
+	libcerror_error_t *error      = NULL;
+	size_t uncompressed_data_size = 0;
+	int result                    = 0;
+
+	/* Test regular cases
+	 */
+	uncompressed_data_size = 256;
+
+	result = lzfse_decompress(
+	          assorted_test_lzfse_compressed_data,
+	          426,
+	          uncompressed_data,
+	          &uncompressed_data_size,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ASSORTED_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_SIZE(
+	 "uncompressed_data_size",
+	 uncompressed_data_size,
+	 (size_t) 186 );
+
+	result = memory_compare(
+	          uncompressed_data,
+	          assorted_test_lzfse_uncompressed_data,
+	          186 );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	/* Test error cases
+	 */
+	uncompressed_data_size = 256;
+
+	result = lzfse_decompress(
+	          NULL,
+	          426,
+	          uncompressed_data,
+	          &uncompressed_data_size,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ASSORTED_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = lzfse_decompress(
+	          assorted_test_lzfse_compressed_data,
+	          426,
+	          NULL,
+	          &uncompressed_data_size,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ASSORTED_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = lzfse_decompress(
+	          assorted_test_lzfse_compressed_data,
+	          426,
+	          uncompressed_data,
+	          NULL,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ASSORTED_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Test uncompressed data too small
+	 */
+	uncompressed_data_size = 128;
+
+	result = lzfse_decompress(
+	          assorted_test_lzfse_compressed_data,
+	          426,
+	          uncompressed_data,
+	          &uncompressed_data_size,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ASSORTED_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Test compressed data that is truncated within the literals
+	 * of the first block
+	 */
+	uncompressed_data_size = 256;
+
+	result = lzfse_decompress(
+	          assorted_test_lzfse_compressed_data,
+	          180,
+	          uncompressed_data,
+	          &uncompressed_data_size,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ASSORTED_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the lzfse_decompress_allocate function
+ * Returns 1 if successful or 0 if not
+ */
+int assorted_test_lzfse_decompress_allocate(
+     void )
+{
+	libcerror_error_t *error      = NULL;
+	uint8_t *uncompressed_data    = NULL;
+	size_t uncompressed_data_size = 0;
+	int result                    = 0;
+
+	/* Test regular cases
+	 */
+	result = lzfse_decompress_allocate(
+	          assorted_test_lzfse_compressed_data,
+	          426,
+	          &uncompressed_data,
+	          &uncompressed_data_size,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ASSORTED_TEST_ASSERT_IS_NOT_NULL(
+	 "uncompressed_data",
+	 uncompressed_data );
+
+	ASSORTED_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_SIZE(
+	 "uncompressed_data_size",
+	 uncompressed_data_size,
+	 (size_t) 186 );
+
+	result = memory_compare(
+	          uncompressed_data,
+	          assorted_test_lzfse_uncompressed_data,
+	          186 );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	memory_free(
+	 uncompressed_data );
+
+	uncompressed_data = NULL;
+
+	/* Test error cases
+	 */
+	result = lzfse_decompress_allocate(
+	          assorted_test_lzfse_compressed_data,
+	          426,
+	          NULL,
+	          &uncompressed_data_size,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ASSORTED_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( uncompressed_data != NULL )
+	{
+		memory_free(
+		 uncompressed_data );
+	}
+	return( 0 );
+}
+
+/* The main program
+ */
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+int wmain(
+     int argc ASSORTED_TEST_ATTRIBUTE_UNUSED,
+     wchar_t * const argv[] ASSORTED_TEST_ATTRIBUTE_UNUSED )
+#else
+int main(
+     int argc ASSORTED_TEST_ATTRIBUTE_UNUSED,
+     char * const argv[] ASSORTED_TEST_ATTRIBUTE_UNUSED )
+#endif
+{
+	ASSORTED_TEST_UNREFERENCED_PARAMETER( argc )
+	ASSORTED_TEST_UNREFERENCED_PARAMETER( argv )
+
+	ASSORTED_TEST_RUN(
+	 "lzfse_read_compressed_block_header",
+	 assorted_test_lzfse_read_compressed_block_header );
+
+	ASSORTED_TEST_RUN(
+	 "lzfse_decoder_table_construct",
+	 assorted_test_lzfse_decoder_table_construct );
+
+	/* TODO: add tests for lzfse_value_decoder_table_construct */
+
+	ASSORTED_TEST_RUN(
+	 "lzfse_get_uncompressed_size",
+	 assorted_test_lzfse_get_uncompressed_size );
+
+	ASSORTED_TEST_RUN(
+	 "lzfse_decompress",
+	 assorted_test_lzfse_decompress );
+
+	ASSORTED_TEST_RUN(
+	 "lzfse_decompress_allocate",
+	 assorted_test_lzfse_decompress_allocate );
+
+	return( EXIT_SUCCESS );
+
+on_error:
+	return( EXIT_FAILURE );
+}
+
@@ -0,0 +1,836 @@
+/*
+ * LZFu (compressed RTF) compression functions testing program
+ *
+ * Copyright (C) 2008-2019, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This software is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This software is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this software.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <byte_stream.h>
+#include <file_stream.h>
+#include <memory.h>
+#include <types.h>
+
+#if defined( HAVE_STDLIB_H ) || defined( WINAPI )
+#include <stdlib.h>
+#endif
+
+#include "assorted_test_libcerror.h"
+#include "assorted_test_macros.h"
+#include "assorted_test_unused.h"
+
+#include "../src/crc32.h"
+#include "../src/lzfu.h"
+
+/* The compressed RTF example of [MS-OXRTFCP] section 3.1.1, which contains references
+ * into the RTF dictionary
+ */
+uint8_t assorted_test_lzfu_uncompressed_data1[ 43 ] = {
+	'{', '\\', 'r', 't', 'f', '1', '\\', 'a', 'n', 's', 'i', '\\', 'a', 'n', 's', 'i',
+	'c', 'p', 'g', '1', '2', '5', '2', '\\', 'p', 'a', 'r', 'd', ' ', 'h', 'e', 'l',
+	'l', 'o', ' ', 'w', 'o', 'r', 'l', 'd', '}', '\r', '\n' };
+
+uint8_t assorted_test_lzfu_compressed_data1[ 49 ] = {
+	0x2d, 0x00, 0x00, 0x00, 0x2b, 0x00, 0x00, 0x00, 0x4c, 0x5a, 0x46, 0x75, 0xf1, 0xc5, 0xc7, 0xa7,
+	0x03, 0x00, 0x0a, 0x00, 0x72, 0x63, 0x70, 0x67, 0x31, 0x32, 0x35, 0x42, 0x32, 0x0a, 0xf3, 0x20,
+	0x68, 0x65, 0x6c, 0x09, 0x00, 0x20, 0x62, 0x77, 0x05, 0xb0, 0x6c, 0x64, 0x7d, 0x0a, 0x80, 0x0f,
+	0xa0 };
+
+/* The compressed RTF example of [MS-OXRTFCP] section 3.1.2, which contains a reference
+ * that overlaps with the data it produces
+ */
+uint8_t assorted_test_lzfu_uncompressed_data2[ 28 ] = {
+	'{', '\\', 'r', 't', 'f', '1', ' ', 'W', 'X', 'Y', 'Z', 'W', 'X', 'Y', 'Z', 'W',
+	'X', 'Y', 'Z', 'W', 'X', 'Y', 'Z', 'W', 'X', 'Y', 'Z', '}' };
+
+uint8_t assorted_test_lzfu_compressed_data2[ 30 ] = {
+	0x1a, 0x00, 0x00, 0x00, 0x1c, 0x00, 0x00, 0x00, 0x4c, 0x5a, 0x46, 0x75, 0xe2, 0xd4, 0x4b, 0x51,
+	0x41, 0x00, 0x04, 0x20, 0x57, 0x58, 0x59, 0x5a, 0x0d, 0x6e, 0x7d, 0x01, 0x0e, 0xb0 };
+
+/* Buffers larger than the LZ buffer
+ */
+uint8_t assorted_test_lzfu_uncompressed_data[ 10000 ];
+
+uint8_t assorted_test_lzfu_compressed_data[ 11500 ];
+
+uint8_t assorted_test_lzfu_decompressed_data[ 10002 ];
+
+/* Compresses data and tests if the result can be decompressed into the original data
+ * Returns 1 if successful or 0 if not
+ */
+int assorted_test_lzfu_compress_round_trip(
+     uint8_t *uncompressed_data,
+     size_t uncompressed_data_size,
+     size_t *compressed_data_size )
+{
+	libcerror_error_t *error      = NULL;
+	size_t decompressed_data_size = 0;
+	uint32_t calculated_crc       = 0;
+	uint32_t value_32bit          = 0;
+	int result                    = 0;
+
+	*compressed_data_size = 11500;
+
+	result = lzfu_compress(
+	          uncompressed_data,
+	          uncompressed_data_size,
+	          assorted_test_lzfu_compressed_data,
+	          compressed_data_size,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ASSORTED_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* The compressed data size in the header includes 12 bytes of the header
+	 */
+	byte_stream_copy_to_uint32_little_endian(
+	 &( assorted_test_lzfu_compressed_data[ 0 ] ),
+	 value_32bit );
+
+	ASSORTED_TEST_ASSERT_EQUAL_SIZE(
+	 "compressed data size",
+	 (size_t) value_32bit,
+	 *compressed_data_size - 4 );
+
+	byte_stream_copy_to_uint32_little_endian(
+	 &( assorted_test_lzfu_compressed_data[ 4 ] ),
+	 value_32bit );
+
+	ASSORTED_TEST_ASSERT_EQUAL_SIZE(
+	 "uncompressed data size",
+	 (size_t) value_32bit,
+	 uncompressed_data_size );
+
+	byte_stream_copy_to_uint32_little_endian(
+	 &( assorted_test_lzfu_compressed_data[ 8 ] ),
+	 value_32bit );
+
+	ASSORTED_TEST_ASSERT_EQUAL_UINT32(
+	 "signature",
+	 value_32bit,
+	 (uint32_t) 0x75465a4cUL );
+
+	result = crc32_calculate(
+	          &calculated_crc,
+	          &( assorted_test_lzfu_compressed_data[ 16 ] ),
+	          *compressed_data_size - 16,
+	          0,
+	          1,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	byte_stream_copy_to_uint32_little_endian(
+	 &( assorted_test_lzfu_compressed_data[ 12 ] ),
+	 value_32bit );
+
+	ASSORTED_TEST_ASSERT_EQUAL_UINT32(
+	 "crc",
+	 value_32bit,
+	 calculated_crc );
+
+	/* The uncompressed data is followed by the 2 bytes of the end of data reference
+	 */
+	decompressed_data_size = 10002;
+
+	result = lzfu_decompress(
+	          assorted_test_lzfu_compressed_data,
+	          *compressed_data_size,
+	          assorted_test_lzfu_decompressed_data,
+	          &decompressed_data_size,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ASSORTED_TEST_ASSERT_EQUAL_SIZE(
+	 "decompressed_data_size",
+	 decompressed_data_size,
+	 uncompressed_data_size + 2 );
+
+	ASSORTED_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	if( uncompressed_data_size > 0 )
+	{
+		result = memory_compare(
+		          assorted_test_lzfu_decompressed_data,
+		          uncompressed_data,
+		          uncompressed_data_size );
+
+		ASSORTED_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 0 );
+	}
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the lzfu_get_uncompressed_data_size function
+ * Returns 1 if successful or 0 if not
+ */
+int assorted_test_lzfu_get_uncompressed_data_size(
+     void )
+{
+	libcerror_error_t *error      = NULL;
+	size_t uncompressed_data_size = 0;
+	int result                    = 0;
+
+	/* Test regular cases
+	 */
+	result = lzfu_get_uncompressed_data_size(
+	          assorted_test_lzfu_compressed_data1,
+	          49,
+	          &uncompressed_data_size,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ASSORTED_TEST_ASSERT_EQUAL_SIZE(
+	 "uncompressed_data_size",
+	 uncompressed_data_size,
+	 (size_t) 43 + 2 );
+
+	ASSORTED_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = lzfu_get_uncompressed_data_size(
+	          NULL,
+	          49,
+	          &uncompressed_data_size,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ASSORTED_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = lzfu_get_uncompressed_data_size(
+	          assorted_test_lzfu_compressed_data1,
+	          (size_t) SSIZE_MAX + 1,
+	          &uncompressed_data_size,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ASSORTED_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = lzfu_get_uncompressed_data_size(
+	          assorted_test_lzfu_compressed_data1,
+	          49,
+	          NULL,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ASSORTED_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* The compressed data must contain the header
+	 */
+	result = lzfu_get_uncompressed_data_size(
+	          assorted_test_lzfu_compressed_data1,
+	          15,
+	          &uncompressed_data_size,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ASSORTED_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* The compressed data size in the header must fit in the compressed data
+	 */
+	result = lzfu_get_uncompressed_data_size(
+	          assorted_test_lzfu_compressed_data1,
+	          48,
+	          &uncompressed_data_size,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ASSORTED_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the lzfu_compress function
+ * Returns 1 if successful or 0 if not
+ */
+int assorted_test_lzfu_compress(
+     void )
+{
+	libcerror_error_t *error    = NULL;
+	size_t compressed_data_size = 0;
+	size_t data_offset          = 0;
+	uint32_t random_value       = 0;
+	int result                  = 0;
+
+	/* Test regular cases
+	 */
+	result = assorted_test_lzfu_compress_round_trip(
+	          assorted_test_lzfu_uncompressed_data,
+	          0,
+	          &compressed_data_size );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	/* The empty data consists of the header, a flag byte and the end of data reference
+	 */
+	ASSORTED_TEST_ASSERT_EQUAL_SIZE(
+	 "compressed_data_size",
+	 compressed_data_size,
+	 (size_t) 16 + 3 );
+
+	result = assorted_test_lzfu_compress_round_trip(
+	          assorted_test_lzfu_uncompressed_data2,
+	          1,
+	          &compressed_data_size );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ASSORTED_TEST_ASSERT_EQUAL_SIZE(
+	 "compressed_data_size",
+	 compressed_data_size,
+	 (size_t) 16 + 4 );
+
+	/* The data that matches the start of the RTF dictionary is stored as references
+	 */
+	result = assorted_test_lzfu_compress_round_trip(
+	          assorted_test_lzfu_uncompressed_data1,
+	          43,
+	          &compressed_data_size );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ASSORTED_TEST_ASSERT_LESS_THAN_UINT64(
+	 "compressed_data_size",
+	 (uint64_t) compressed_data_size,
+	 (uint64_t) 16 + 43 );
+
+	result = assorted_test_lzfu_compress_round_trip(
+	          assorted_test_lzfu_uncompressed_data2,
+	          28,
+	          &compressed_data_size );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ASSORTED_TEST_ASSERT_EQUAL_SIZE(
+	 "compressed_data_size",
+	 compressed_data_size,
+	 (size_t) 30 );
+
+	result = memory_compare(
+	          assorted_test_lzfu_compressed_data,
+	          assorted_test_lzfu_compressed_data2,
+	          30 );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	/* Repetitive data that wraps around the LZ buffer
+	 */
+	for( data_offset = 0;
+	     data_offset < 10000;
+	     data_offset++ )
+	{
+		assorted_test_lzfu_uncompressed_data[ data_offset ] = (uint8_t) ( 'a' + ( data_offset % 23 ) );
+	}
+	result = assorted_test_lzfu_compress_round_trip(
+	          assorted_test_lzfu_uncompressed_data,
+	          10000,
+	          &compressed_data_size );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ASSORTED_TEST_ASSERT_LESS_THAN_UINT64(
+	 "compressed_data_size",
+	 (uint64_t) compressed_data_size,
+	 (uint64_t) 10000 / 4 );
+
+	/* Random data that is mostly stored as literals
+	 */
+	random_value = 0x12345678UL;
+
+	for( data_offset = 0;
+	     data_offset < 10000;
+	     data_offset++ )
+	{
+		random_value = ( random_value * 1103515245UL ) + 12345UL;
+
+		assorted_test_lzfu_uncompressed_data[ data_offset ] = (uint8_t) ( random_value >> 24 );
+	}
+	result = assorted_test_lzfu_compress_round_trip(
+	          assorted_test_lzfu_uncompressed_data,
+	          10000,
+	          &compressed_data_size );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	/* Test error cases
+	 */
+	compressed_data_size = 11500;
+
+	result = lzfu_compress(
+	          NULL,
+	          10000,
+	          assorted_test_lzfu_compressed_data,
+	          &compressed_data_size,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ASSORTED_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = lzfu_compress(
+	          assorted_test_lzfu_uncompressed_data,
+	          (size_t) SSIZE_MAX + 1,
+	          assorted_test_lzfu_compressed_data,
+	          &compressed_data_size,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ASSORTED_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = lzfu_compress(
+	          assorted_test_lzfu_uncompressed_data,
+	          10000,
+	          NULL,
+	          &compressed_data_size,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ASSORTED_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = lzfu_compress(
+	          assorted_test_lzfu_uncompressed_data,
+	          10000,
+	          assorted_test_lzfu_compressed_data,
+	          NULL,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ASSORTED_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* The compressed data must be able to contain every byte stored as a literal,
+	 * the required size is returned
+	 */
+	compressed_data_size = 11000;
+
+	result = lzfu_compress(
+	          assorted_test_lzfu_uncompressed_data,
+	          10000,
+	          assorted_test_lzfu_compressed_data,
+	          &compressed_data_size,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ASSORTED_TEST_ASSERT_EQUAL_SIZE(
+	 "compressed_data_size",
+	 compressed_data_size,
+	 (size_t) 16 + 10000 + 2 + 1251 );
+
+	ASSORTED_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the lzfu_decompress function
+ * Returns 1 if successful or 0 if not
+ */
+int assorted_test_lzfu_decompress(
+     void )
+{
+	uint8_t compressed_data[ 49 ];
+	uint8_t uncompressed_data[ 64 ];
+
+	libcerror_error_t *error      = NULL;
+	size_t uncompressed_data_size = 0;
+	int result                    = 0;
+
+	/* Test regular cases
+	 */
+	uncompressed_data_size = 64;
+
+	result = lzfu_decompress(
+	          assorted_test_lzfu_compressed_data1,
+	          49,
+	          uncompressed_data,
+	          &uncompressed_data_size,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ASSORTED_TEST_ASSERT_EQUAL_SIZE(
+	 "uncompressed_data_size",
+	 uncompressed_data_size,
+	 (size_t) 43 + 2 );
+
+	ASSORTED_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = memory_compare(
+	          uncompressed_data,
+	          assorted_test_lzfu_uncompressed_data1,
+	          43 );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	uncompressed_data_size = 64;
+
+	result = lzfu_decompress(
+	          assorted_test_lzfu_compressed_data2,
+	          30,
+	          uncompressed_data,
+	          &uncompressed_data_size,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ASSORTED_TEST_ASSERT_EQUAL_SIZE(
+	 "uncompressed_data_size",
+	 uncompressed_data_size,
+	 (size_t) 28 + 2 );
+
+	ASSORTED_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = memory_compare(
+	          uncompressed_data,
+	          assorted_test_lzfu_uncompressed_data2,
+	          28 );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	/* Test error cases
+	 */
+	uncompressed_data_size = 64;
+
+	result = lzfu_decompress(
+	          NULL,
+	          49,
+	          uncompressed_data,
+	          &uncompressed_data_size,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ASSORTED_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = lzfu_decompress(
+	          assorted_test_lzfu_compressed_data1,
+	          49,
+	          NULL,
+	          &uncompressed_data_size,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ASSORTED_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = lzfu_decompress(
+	          assorted_test_lzfu_compressed_data1,
+	          49,
+	          uncompressed_data,
+	          NULL,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ASSORTED_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	uncompressed_data_size = 42;
+
+	result = lzfu_decompress(
+	          assorted_test_lzfu_compressed_data1,
+	          49,
+	          uncompressed_data,
+	          &uncompressed_data_size,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ASSORTED_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* A modified byte of the compressed data does not match the CRC in the header
+	 */
+	if( memory_copy(
+	     compressed_data,
+	     assorted_test_lzfu_compressed_data1,
+	     49 ) == NULL )
+	{
+		goto on_error;
+	}
+	compressed_data[ 32 ] ^= 0x01;
+
+	uncompressed_data_size = 64;
+
+	result = lzfu_decompress(
+	          compressed_data,
+	          49,
+	          uncompressed_data,
+	          &uncompressed_data_size,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ASSORTED_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* The main program
+ */
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+int wmain(
+     int argc ASSORTED_TEST_ATTRIBUTE_UNUSED,
+     wchar_t * const argv[] ASSORTED_TEST_ATTRIBUTE_UNUSED )
+#else
+int main(
+     int argc ASSORTED_TEST_ATTRIBUTE_UNUSED,
+     char * const argv[] ASSORTED_TEST_ATTRIBUTE_UNUSED )
+#endif
+{
+	ASSORTED_TEST_UNREFERENCED_PARAMETER( argc )
+	ASSORTED_TEST_UNREFERENCED_PARAMETER( argv )
+
+	ASSORTED_TEST_RUN(
+	 "lzfu_get_uncompressed_data_size",
+	 assorted_test_lzfu_get_uncompressed_data_size );
+
+	ASSORTED_TEST_RUN(
+	 "lzfu_compress",
+	 assorted_test_lzfu_compress );
+
+	ASSORTED_TEST_RUN(
+	 "lzfu_decompress",
+	 assorted_test_lzfu_decompress );
+
+	/* TODO: add tests for lzfu_decoder_decompress */
+
+	/* TODO: add tests for lzfu_decompress_allocate */
+
+	return( EXIT_SUCCESS );
+
+on_error:
+	return( EXIT_FAILURE );
+}
@@ -0,0 +1,807 @@
+/*
+ * LZNT1 compression functions testing program
+ *
+ * Copyright (C) 2008-2019, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This software is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This software is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this software.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <file_stream.h>
+#include <memory.h>
+#include <types.h>
+
+#if defined( HAVE_STDLIB_H ) || defined( WINAPI )
+#include <stdlib.h>
+#endif
+
+#include "assorted_test_libcerror.h"
+#include "assorted_test_macros.h"
+#include "assorted_test_unused.h"
+
+#include "../src/lznt1.h"
+
+/* "abcabcabcabc", which compresses into 3 literals followed by a match of 9 bytes at distance 3
+ */
+uint8_t assorted_test_lznt1_uncompressed_data1[ 12 ] = {
+	'a', 'b', 'c', 'a', 'b', 'c', 'a', 'b', 'c', 'a', 'b', 'c' };
+
+uint8_t assorted_test_lznt1_compressed_data1[ 8 ] = {
+	0x05, 0xb0, 0x08, 'a', 'b', 'c', 0x06, 0x20 };
+
+/* 2 chunks of zero bytes followed by a chunk of 100 zero bytes, every chunk compresses
+ * into a literal followed by a match of the remainder of the chunk at distance 1
+ */
+uint8_t assorted_test_lznt1_compressed_data2[ 18 ] = {
+	0x03, 0xb0, 0x02, 0x00, 0xfc, 0x0f,
+	0x03, 0xb0, 0x02, 0x00, 0xfc, 0x0f,
+	0x03, 0xb0, 0x02, 0x00, 0x60, 0x00 };
+
+/* Buffers of multiple chunks
+ */
+uint8_t assorted_test_lznt1_uncompressed_data[ 8292 ];
+
+uint8_t assorted_test_lznt1_compressed_data[ 8300 ];
+
+/* Tests the lznt1_compressor_initialize function
+ * Returns 1 if successful or 0 if not
+ */
+int assorted_test_lznt1_compressor_initialize(
+     void )
+{
+	libcerror_error_t *error       = NULL;
+	lznt1_compressor_t *compressor = NULL;
+	int result                     = 0;
+
+	/* Test regular cases
+	 */
+	result = lznt1_compressor_initialize(
+	          &compressor,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ASSORTED_TEST_ASSERT_IS_NOT_NULL(
+	 "compressor",
+	 compressor );
+
+	ASSORTED_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = lznt1_compressor_free(
+	          &compressor,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ASSORTED_TEST_ASSERT_IS_NULL(
+	 "compressor",
+	 compressor );
+
+	ASSORTED_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = lznt1_compressor_initialize(
+	          NULL,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ASSORTED_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	compressor = (lznt1_compressor_t *) 0x12345678UL;
+
+	result = lznt1_compressor_initialize(
+	          &compressor,
+	          &error );
+
+	compressor = NULL;
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ASSORTED_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( compressor != NULL )
+	{
+		lznt1_compressor_free(
+		 &compressor,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the lznt1_compressor_compress_chunk function
+ * Returns 1 if successful or 0 if not
+ */
+int assorted_test_lznt1_compressor_compress_chunk(
+     void )
+{
+	libcerror_error_t *error       = NULL;
+	lznt1_compressor_t *compressor = NULL;
+	size_t compressed_data_size    = 0;
+	size_t data_offset             = 0;
+	uint32_t value_32bit           = 1;
+	int result                     = 0;
+
+	/* Initialize test
+	 */
+	result = lznt1_compressor_initialize(
+	          &compressor,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ASSORTED_TEST_ASSERT_IS_NOT_NULL(
+	 "compressor",
+	 compressor );
+
+	ASSORTED_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	compressed_data_size = 14;
+
+	result = lznt1_compressor_compress_chunk(
+	          compressor,
+	          assorted_test_lznt1_uncompressed_data1,
+	          12,
+	          assorted_test_lznt1_compressed_data,
+	          &compressed_data_size,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ASSORTED_TEST_ASSERT_EQUAL_SIZE(
+	 "compressed_data_size",
+	 compressed_data_size,
+	 (size_t) 8 );
+
+	ASSORTED_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = memory_compare(
+	          assorted_test_lznt1_compressed_data,
+	          assorted_test_lznt1_compressed_data1,
+	          8 );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	/* Test that data without matches is stored as an uncompressed chunk
+	 */
+	for( data_offset = 0;
+	     data_offset < LZNT1_CHUNK_SIZE;
+	     data_offset++ )
+	{
+		value_32bit = ( value_32bit * 1103515245UL ) + 12345UL;
+
+		assorted_test_lznt1_uncompressed_data[ data_offset ] = (uint8_t) ( value_32bit >> 16 );
+	}
+	compressed_data_size = LZNT1_MAXIMUM_COMPRESSED_CHUNK_SIZE;
+
+	result = lznt1_compressor_compress_chunk(
+	          compressor,
+	          assorted_test_lznt1_uncompressed_data,
+	          LZNT1_CHUNK_SIZE,
+	          assorted_test_lznt1_compressed_data,
+	          &compressed_data_size,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ASSORTED_TEST_ASSERT_EQUAL_SIZE(
+	 "compressed_data_size",
+	 compressed_data_size,
+	 (size_t) LZNT1_MAXIMUM_COMPRESSED_CHUNK_SIZE );
+
+	ASSORTED_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_UINT8(
+	 "assorted_test_lznt1_compressed_data[ 0 ]",
+	 assorted_test_lznt1_compressed_data[ 0 ],
+	 (uint8_t) 0xff );
+
+	ASSORTED_TEST_ASSERT_EQUAL_UINT8(
+	 "assorted_test_lznt1_compressed_data[ 1 ]",
+	 assorted_test_lznt1_compressed_data[ 1 ],
+	 (uint8_t) 0x3f );
+
+	result = memory_compare(
+	          &( assorted_test_lznt1_compressed_data[ LZNT1_CHUNK_HEADER_SIZE ] ),
+	          assorted_test_lznt1_uncompressed_data,
+	          LZNT1_CHUNK_SIZE );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	/* Test that data too small to contain a match is stored as an uncompressed chunk
+	 */
+	compressed_data_size = 4;
+
+	result = lznt1_compressor_compress_chunk(
+	          compressor,
+	          assorted_test_lznt1_uncompressed_data1,
+	          2,
+	          assorted_test_lznt1_compressed_data,
+	          &compressed_data_size,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ASSORTED_TEST_ASSERT_EQUAL_SIZE(
+	 "compressed_data_size",
+	 compressed_data_size,
+	 (size_t) 4 );
+
+	ASSORTED_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_UINT8(
+	 "assorted_test_lznt1_compressed_data[ 0 ]",
+	 assorted_test_lznt1_compressed_data[ 0 ],
+	 (uint8_t) 0x01 );
+
+	ASSORTED_TEST_ASSERT_EQUAL_UINT8(
+	 "assorted_test_lznt1_compressed_data[ 1 ]",
+	 assorted_test_lznt1_compressed_data[ 1 ],
+	 (uint8_t) 0x30 );
+
+	/* Test error cases
+	 */
+	compressed_data_size = 14;
+
+	result = lznt1_compressor_compress_chunk(
+	          NULL,
+	          assorted_test_lznt1_uncompressed_data1,
+	          12,
+	          assorted_test_lznt1_compressed_data,
+	          &compressed_data_size,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ASSORTED_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = lznt1_compressor_compress_chunk(
+	          compressor,
+	          NULL,
+	          12,
+	          assorted_test_lznt1_compressed_data,
+	          &compressed_data_size,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ASSORTED_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = lznt1_compressor_compress_chunk(
+	          compressor,
+	          assorted_test_lznt1_uncompressed_data1,
+	          0,
+	          assorted_test_lznt1_compressed_data,
+	          &compressed_data_size,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ASSORTED_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	compressed_data_size = 8300;
+
+	result = lznt1_compressor_compress_chunk(
+	          compressor,
+	          assorted_test_lznt1_uncompressed_data,
+	          LZNT1_CHUNK_SIZE + 1,
+	          assorted_test_lznt1_compressed_data,
+	          &compressed_data_size,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ASSORTED_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	compressed_data_size = 14;
+
+	result = lznt1_compressor_compress_chunk(
+	          compressor,
+	          assorted_test_lznt1_uncompressed_data1,
+	          12,
+	          NULL,
+	          &compressed_data_size,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ASSORTED_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = lznt1_compressor_compress_chunk(
+	          compressor,
+	          assorted_test_lznt1_uncompressed_data1,
+	          12,
+	          assorted_test_lznt1_compressed_data,
+	          NULL,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ASSORTED_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* The compressed data must be able to contain the chunk stored uncompressed
+	 */
+	compressed_data_size = 13;
+
+	result = lznt1_compressor_compress_chunk(
+	          compressor,
+	          assorted_test_lznt1_uncompressed_data1,
+	          12,
+	          assorted_test_lznt1_compressed_data,
+	          &compressed_data_size,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ASSORTED_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = lznt1_compressor_free(
+	          &compressor,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ASSORTED_TEST_ASSERT_IS_NULL(
+	 "compressor",
+	 compressor );
+
+	ASSORTED_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( compressor != NULL )
+	{
+		lznt1_compressor_free(
+		 &compressor,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the lznt1_get_maximum_compressed_data_size function
+ * Returns 1 if successful or 0 if not
+ */
+int assorted_test_lznt1_get_maximum_compressed_data_size(
+     void )
+{
+	libcerror_error_t *error    = NULL;
+	size_t compressed_data_size = 0;
+	int result                  = 0;
+
+	/* Test regular cases
+	 */
+	result = lznt1_get_maximum_compressed_data_size(
+	          1,
+	          &compressed_data_size,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ASSORTED_TEST_ASSERT_EQUAL_SIZE(
+	 "compressed_data_size",
+	 compressed_data_size,
+	 (size_t) 3 );
+
+	ASSORTED_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = lznt1_get_maximum_compressed_data_size(
+	          LZNT1_CHUNK_SIZE,
+	          &compressed_data_size,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ASSORTED_TEST_ASSERT_EQUAL_SIZE(
+	 "compressed_data_size",
+	 compressed_data_size,
+	 (size_t) 4098 );
+
+	ASSORTED_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = lznt1_get_maximum_compressed_data_size(
+	          LZNT1_CHUNK_SIZE + 1,
+	          &compressed_data_size,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ASSORTED_TEST_ASSERT_EQUAL_SIZE(
+	 "compressed_data_size",
+	 compressed_data_size,
+	 (size_t) 4101 );
+
+	ASSORTED_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = lznt1_get_maximum_compressed_data_size(
+	          (size_t) SSIZE_MAX + 1,
+	          &compressed_data_size,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ASSORTED_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = lznt1_get_maximum_compressed_data_size(
+	          LZNT1_CHUNK_SIZE,
+	          NULL,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ASSORTED_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the lznt1_compress function
+ * Returns 1 if successful or 0 if not
+ */
+int assorted_test_lznt1_compress(
+     void )
+{
+	libcerror_error_t *error    = NULL;
+	size_t compressed_data_size = 0;
+	int result                  = 0;
+
+	/* Test regular cases
+	 */
+	if( memory_set(
+	     assorted_test_lznt1_uncompressed_data,
+	     0,
+	     8292 ) == NULL )
+	{
+		goto on_error;
+	}
+	compressed_data_size = 8300;
+
+	result = lznt1_compress(
+	          assorted_test_lznt1_uncompressed_data,
+	          8292,
+	          assorted_test_lznt1_compressed_data,
+	          &compressed_data_size,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ASSORTED_TEST_ASSERT_EQUAL_SIZE(
+	 "compressed_data_size",
+	 compressed_data_size,
+	 (size_t) 18 );
+
+	ASSORTED_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = memory_compare(
+	          assorted_test_lznt1_compressed_data,
+	          assorted_test_lznt1_compressed_data2,
+	          18 );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	/* Test error cases
+	 */
+	compressed_data_size = 8300;
+
+	result = lznt1_compress(
+	          NULL,
+	          8292,
+	          assorted_test_lznt1_compressed_data,
+	          &compressed_data_size,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ASSORTED_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = lznt1_compress(
+	          assorted_test_lznt1_uncompressed_data,
+	          8292,
+	          NULL,
+	          &compressed_data_size,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ASSORTED_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = lznt1_compress(
+	          assorted_test_lznt1_uncompressed_data,
+	          8292,
+	          assorted_test_lznt1_compressed_data,
+	          NULL,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ASSORTED_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* The compressed data must be able to contain every chunk stored uncompressed
+	 */
+	compressed_data_size = 113;
+
+	result = lznt1_compress(
+	          assorted_test_lznt1_uncompressed_data,
+	          8292,
+	          assorted_test_lznt1_compressed_data,
+	          &compressed_data_size,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ASSORTED_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* The main program
+ */
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+int wmain(
+     int argc ASSORTED_TEST_ATTRIBUTE_UNUSED,
+     wchar_t * const argv[] ASSORTED_TEST_ATTRIBUTE_UNUSED )
+#else
+int main(
+     int argc ASSORTED_TEST_ATTRIBUTE_UNUSED,
+     char * const argv[] ASSORTED_TEST_ATTRIBUTE_UNUSED )
+#endif
+{
+	ASSORTED_TEST_UNREFERENCED_PARAMETER( argc )
+	ASSORTED_TEST_UNREFERENCED_PARAMETER( argv )
+
+	ASSORTED_TEST_RUN(
+	 "lznt1_compressor_initialize",
+	 assorted_test_lznt1_compressor_initialize );
+
+	/* TODO: add tests for lznt1_compressor_free */
+
+	ASSORTED_TEST_RUN(
+	 "lznt1_compressor_compress_chunk",
+	 assorted_test_lznt1_compressor_compress_chunk );
+
+	ASSORTED_TEST_RUN(
+	 "lznt1_get_maximum_compressed_data_size",
+	 assorted_test_lznt1_get_maximum_compressed_data_size );
+
+	ASSORTED_TEST_RUN(
+	 "lznt1_compress",
+	 assorted_test_lznt1_compress );
+
+	return( EXIT_SUCCESS );
+
+on_error:
+	return( EXIT_FAILURE );
+}
+
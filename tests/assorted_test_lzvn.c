@@ -0,0 +1,614 @@
+/*
+ * LZVN compression functions testing program
+ *
+ * Copyright (C) 2008-2019, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This software is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This software is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this software.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <file_stream.h>
+#include <memory.h>
+#include <types.h>
+
+#if defined( HAVE_STDLIB_H ) || defined( WINAPI )
+#include <stdlib.h>
+#endif
+
+#include "assorted_test_libcerror.h"
+#include "assorted_test_macros.h"
+#include "assorted_test_unused.h"
+
+#include "../src/lzvn.h"
+
+/* The end of stream oppcode followed by 7 bytes of padding
+ */
+uint8_t assorted_test_lzvn_end_of_stream[ 8 ] = {
+	0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 };
+
+/* The oppcodes of a match of 16 bytes at the largest small distance, which is stored
+ * as a small distance match of 10 bytes followed by a match of 6 bytes
+ */
+uint8_t assorted_test_lzvn_oppcodes_distance_0x05ff[ 3 ] = {
+	0x3d, 0xff, 0xf6 };
+
+/* The oppcodes of a match of 16 bytes at the smallest medium distance
+ */
+uint8_t assorted_test_lzvn_oppcodes_distance_0x0600[ 3 ] = {
+	0xa3, 0x01, 0x18 };
+
+/* The oppcodes of a match of 16 bytes at the largest medium distance
+ */
+uint8_t assorted_test_lzvn_oppcodes_distance_0x3fff[ 3 ] = {
+	0xa3, 0xfd, 0xff };
+
+/* The oppcodes of a match of 16 bytes at the smallest large distance, which is stored
+ * as a large distance match of 10 bytes followed by a match of 6 bytes
+ */
+uint8_t assorted_test_lzvn_oppcodes_distance_0x4000[ 4 ] = {
+	0x3f, 0x00, 0x40, 0xf6 };
+
+/* The oppcodes of a match of 16 bytes at the largest distance
+ */
+uint8_t assorted_test_lzvn_oppcodes_distance_0xffff[ 4 ] = {
+	0x3f, 0xff, 0xff, 0xf6 };
+
+/* Buffers larger than the largest distance
+ */
+uint8_t assorted_test_lzvn_uncompressed_data[ 65552 ];
+
+uint8_t assorted_test_lzvn_compressed_data[ 1024 ];
+
+uint8_t assorted_test_lzvn_decompressed_data[ 65552 ];
+
+/* Fills data with pseudo random bytes
+ */
+void assorted_test_lzvn_set_random_data(
+      uint8_t *data,
+      size_t data_size,
+      uint32_t seed )
+{
+	size_t data_offset = 0;
+
+	for( data_offset = 0;
+	     data_offset < data_size;
+	     data_offset++ )
+	{
+		seed = ( seed * 1103515245UL ) + 12345UL;
+
+		data[ data_offset ] = (uint8_t) ( seed >> 24 );
+	}
+}
+
+/* Compresses data and tests if the result can be decompressed into the original data
+ * Returns 1 if successful or 0 if not
+ */
+int assorted_test_lzvn_compress_round_trip(
+     size_t uncompressed_data_size,
+     size_t *compressed_data_size )
+{
+	libcerror_error_t *error      = NULL;
+	size_t decompressed_data_size = 0;
+	int result                    = 0;
+
+	*compressed_data_size = 1024;
+
+	result = lzvn_compress(
+	          assorted_test_lzvn_uncompressed_data,
+	          uncompressed_data_size,
+	          assorted_test_lzvn_compressed_data,
+	          compressed_data_size,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ASSORTED_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	ASSORTED_TEST_ASSERT_LESS_THAN_UINT64(
+	 "compressed_data_size",
+	 (uint64_t) 7,
+	 (uint64_t) *compressed_data_size );
+
+	result = memory_compare(
+	          &( assorted_test_lzvn_compressed_data[ *compressed_data_size - 8 ] ),
+	          assorted_test_lzvn_end_of_stream,
+	          8 );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	decompressed_data_size = 65552;
+
+	result = lzvn_decompress(
+	          assorted_test_lzvn_compressed_data,
+	          *compressed_data_size,
+	          assorted_test_lzvn_decompressed_data,
+	          &decompressed_data_size,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ASSORTED_TEST_ASSERT_EQUAL_SIZE(
+	 "decompressed_data_size",
+	 decompressed_data_size,
+	 uncompressed_data_size );
+
+	ASSORTED_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	if( uncompressed_data_size > 0 )
+	{
+		result = memory_compare(
+		          assorted_test_lzvn_decompressed_data,
+		          assorted_test_lzvn_uncompressed_data,
+		          uncompressed_data_size );
+
+		ASSORTED_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 0 );
+	}
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Compresses 16 random bytes that are repeated at a specific distance, with zero bytes in between,
+ * and tests if the repetition is stored using the expected oppcodes before the end of stream oppcode
+ * Returns 1 if successful or 0 if not
+ */
+int assorted_test_lzvn_compress_distance(
+     size_t distance,
+     uint8_t *expected_oppcodes,
+     size_t expected_oppcodes_size )
+{
+	size_t compressed_data_size = 0;
+	int result                  = 0;
+
+	if( memory_set(
+	     assorted_test_lzvn_uncompressed_data,
+	     0,
+	     distance ) == NULL )
+	{
+		return( 0 );
+	}
+	assorted_test_lzvn_set_random_data(
+	 assorted_test_lzvn_uncompressed_data,
+	 16,
+	 7 );
+
+	if( memory_copy(
+	     &( assorted_test_lzvn_uncompressed_data[ distance ] ),
+	     assorted_test_lzvn_uncompressed_data,
+	     16 ) == NULL )
+	{
+		return( 0 );
+	}
+	result = assorted_test_lzvn_compress_round_trip(
+	          distance + 16,
+	          &compressed_data_size );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	result = memory_compare(
+	          &( assorted_test_lzvn_compressed_data[ compressed_data_size - 8 - expected_oppcodes_size ] ),
+	          expected_oppcodes,
+	          expected_oppcodes_size );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	return( 1 );
+
+on_error:
+	return( 0 );
+}
+
+/* Tests the lzvn_compress function
+ * Returns 1 if successful or 0 if not
+ */
+int assorted_test_lzvn_compress(
+     void )
+{
+	libcerror_error_t *error    = NULL;
+	size_t compressed_data_size = 0;
+	int result                  = 0;
+
+	/* Test regular cases
+	 */
+	result = assorted_test_lzvn_compress_round_trip(
+	          0,
+	          &compressed_data_size );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ASSORTED_TEST_ASSERT_EQUAL_SIZE(
+	 "compressed_data_size",
+	 compressed_data_size,
+	 (size_t) 8 );
+
+	/* Matches at the distances around the boundaries of the small, medium and large distance oppcodes
+	 */
+	result = assorted_test_lzvn_compress_distance(
+	          0x05ff,
+	          assorted_test_lzvn_oppcodes_distance_0x05ff,
+	          3 );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	result = assorted_test_lzvn_compress_distance(
+	          0x0600,
+	          assorted_test_lzvn_oppcodes_distance_0x0600,
+	          3 );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	result = assorted_test_lzvn_compress_distance(
+	          0x3fff,
+	          assorted_test_lzvn_oppcodes_distance_0x3fff,
+	          3 );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	result = assorted_test_lzvn_compress_distance(
+	          0x4000,
+	          assorted_test_lzvn_oppcodes_distance_0x4000,
+	          4 );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	result = assorted_test_lzvn_compress_distance(
+	          0xffff,
+	          assorted_test_lzvn_oppcodes_distance_0xffff,
+	          4 );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	/* 64 random bytes that are repeated with 1 byte changed, the repetition is stored as
+	 * a small distance match of 20 bytes followed by a literal and a match that reuses
+	 * the previous distance
+	 */
+	assorted_test_lzvn_set_random_data(
+	 assorted_test_lzvn_uncompressed_data,
+	 64,
+	 9 );
+
+	if( memory_copy(
+	     &( assorted_test_lzvn_uncompressed_data[ 64 ] ),
+	     assorted_test_lzvn_uncompressed_data,
+	     64 ) == NULL )
+	{
+		goto on_error;
+	}
+	assorted_test_lzvn_uncompressed_data[ 84 ] ^= 0x55;
+
+	result = assorted_test_lzvn_compress_round_trip(
+	          128,
+	          &compressed_data_size );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ASSORTED_TEST_ASSERT_EQUAL_SIZE(
+	 "compressed_data_size",
+	 compressed_data_size,
+	 (size_t) 2 + 64 + 7 + 8 );
+
+	ASSORTED_TEST_ASSERT_EQUAL_UINT8(
+	 "compressed_data[ 66 ]",
+	 assorted_test_lzvn_compressed_data[ 66 ],
+	 (uint8_t) 0x38 );
+
+	ASSORTED_TEST_ASSERT_EQUAL_UINT8(
+	 "compressed_data[ 67 ]",
+	 assorted_test_lzvn_compressed_data[ 67 ],
+	 (uint8_t) 0x40 );
+
+	ASSORTED_TEST_ASSERT_EQUAL_UINT8(
+	 "compressed_data[ 68 ]",
+	 assorted_test_lzvn_compressed_data[ 68 ],
+	 (uint8_t) 0xfa );
+
+	ASSORTED_TEST_ASSERT_EQUAL_UINT8(
+	 "compressed_data[ 69 ]",
+	 assorted_test_lzvn_compressed_data[ 69 ],
+	 (uint8_t) 0x6e );
+
+	ASSORTED_TEST_ASSERT_EQUAL_UINT8(
+	 "compressed_data[ 70 ]",
+	 assorted_test_lzvn_compressed_data[ 70 ],
+	 assorted_test_lzvn_uncompressed_data[ 84 ] );
+
+	ASSORTED_TEST_ASSERT_EQUAL_UINT8(
+	 "compressed_data[ 71 ]",
+	 assorted_test_lzvn_compressed_data[ 71 ],
+	 (uint8_t) 0xf0 );
+
+	ASSORTED_TEST_ASSERT_EQUAL_UINT8(
+	 "compressed_data[ 72 ]",
+	 assorted_test_lzvn_compressed_data[ 72 ],
+	 (uint8_t) 0x13 );
+
+	/* 300 random bytes that are stored as a large literal of 271 bytes followed by
+	 * a large literal of 29 bytes
+	 */
+	assorted_test_lzvn_set_random_data(
+	 assorted_test_lzvn_uncompressed_data,
+	 300,
+	 11 );
+
+	result = assorted_test_lzvn_compress_round_trip(
+	          300,
+	          &compressed_data_size );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ASSORTED_TEST_ASSERT_EQUAL_SIZE(
+	 "compressed_data_size",
+	 compressed_data_size,
+	 (size_t) 2 + 271 + 2 + 29 + 8 );
+
+	ASSORTED_TEST_ASSERT_EQUAL_UINT8(
+	 "compressed_data[ 0 ]",
+	 assorted_test_lzvn_compressed_data[ 0 ],
+	 (uint8_t) 0xe0 );
+
+	ASSORTED_TEST_ASSERT_EQUAL_UINT8(
+	 "compressed_data[ 1 ]",
+	 assorted_test_lzvn_compressed_data[ 1 ],
+	 (uint8_t) 0xff );
+
+	ASSORTED_TEST_ASSERT_EQUAL_UINT8(
+	 "compressed_data[ 273 ]",
+	 assorted_test_lzvn_compressed_data[ 273 ],
+	 (uint8_t) 0xe0 );
+
+	ASSORTED_TEST_ASSERT_EQUAL_UINT8(
+	 "compressed_data[ 274 ]",
+	 assorted_test_lzvn_compressed_data[ 274 ],
+	 (uint8_t) 0x0d );
+
+	/* Test error cases
+	 */
+	compressed_data_size = 1024;
+
+	result = lzvn_compress(
+	          NULL,
+	          300,
+	          assorted_test_lzvn_compressed_data,
+	          &compressed_data_size,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ASSORTED_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = lzvn_compress(
+	          assorted_test_lzvn_uncompressed_data,
+	          (size_t) SSIZE_MAX + 1,
+	          assorted_test_lzvn_compressed_data,
+	          &compressed_data_size,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ASSORTED_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = lzvn_compress(
+	          assorted_test_lzvn_uncompressed_data,
+	          300,
+	          NULL,
+	          &compressed_data_size,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ASSORTED_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = lzvn_compress(
+	          assorted_test_lzvn_uncompressed_data,
+	          300,
+	          assorted_test_lzvn_compressed_data,
+	          NULL,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ASSORTED_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	compressed_data_size = (size_t) SSIZE_MAX + 1;
+
+	result = lzvn_compress(
+	          assorted_test_lzvn_uncompressed_data,
+	          300,
+	          assorted_test_lzvn_compressed_data,
+	          &compressed_data_size,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ASSORTED_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* The compressed data must be able to contain the literals
+	 */
+	compressed_data_size = 100;
+
+	result = lzvn_compress(
+	          assorted_test_lzvn_uncompressed_data,
+	          300,
+	          assorted_test_lzvn_compressed_data,
+	          &compressed_data_size,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ASSORTED_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* The compressed data must be able to contain the end of stream oppcode
+	 */
+	compressed_data_size = 7;
+
+	result = lzvn_compress(
+	          assorted_test_lzvn_uncompressed_data,
+	          0,
+	          assorted_test_lzvn_compressed_data,
+	          &compressed_data_size,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ASSORTED_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* The main program
+ */
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+int wmain(
+     int argc ASSORTED_TEST_ATTRIBUTE_UNUSED,
+     wchar_t * const argv[] ASSORTED_TEST_ATTRIBUTE_UNUSED )
+#else
+int main(
+     int argc ASSORTED_TEST_ATTRIBUTE_UNUSED,
+     char * const argv[] ASSORTED_TEST_ATTRIBUTE_UNUSED )
+#endif
+{
+	ASSORTED_TEST_UNREFERENCED_PARAMETER( argc )
+	ASSORTED_TEST_UNREFERENCED_PARAMETER( argv )
+
+	ASSORTED_TEST_RUN(
+	 "lzvn_compress",
+	 assorted_test_lzvn_compress );
+
+	/* TODO: add tests for lzvn_decompress */
+
+	/* TODO: add tests for lzvn_decompress_allocate */
+
+	return( EXIT_SUCCESS );
+
+on_error:
+	return( EXIT_FAILURE );
+}
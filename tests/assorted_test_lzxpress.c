@@ -0,0 +1,788 @@
+/*
+ * LZXPRESS Huffman decompression functions testing program
+ *
+ * Copyright (C) 2008-2019, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This software is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This software is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this software.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <file_stream.h>
+#include <memory.h>
+#include <types.h>
+
+#if defined( HAVE_STDLIB_H ) || defined( WINAPI )
+#include <stdlib.h>
+#endif
+
+#include "assorted_test_libcerror.h"
+#include "assorted_test_macros.h"
+#include "assorted_test_unused.h"
+
+#include "../src/lzxpress.h"
+
+/* The size of the uncompressed data of the literals test data
+ */
+#define ASSORTED_TEST_LZXPRESS_LITERALS_DATA_SIZE	2582
+
+/* The size of the uncompressed data of the matches test data
+ */
+#define ASSORTED_TEST_LZXPRESS_MATCHES_DATA_SIZE	100600
+
+/* A single block of literals only, where the letters 'A' to 'O' occur
+ * a Fibonacci number of times, which results in code sizes of 1 to 15 bits
+ */
+uint8_t assorted_test_lzxpress_huffman_literals_compressed_data[ 1102 ] = {
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0xf0, 0xde, 0xbc, 0x9a, 0x78, 0x56, 0x34, 0x12, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x0f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0xfd, 0xff, 0xf7, 0xff, 0xdf, 0xff, 0xff, 0xfe, 0xff, 0xf7, 0xfb, 0xbf, 0xbf, 0xff, 0xff, 0xfb,
+	0xfb, 0xbf, 0x7f, 0xff, 0xfd, 0xef, 0xbf, 0xff, 0xfe, 0xf7, 0xdf, 0xff, 0xfe, 0xfb, 0xbf, 0xff,
+	0xfb, 0xef, 0xff, 0xfe, 0xef, 0xbf, 0xfe, 0xfb, 0xbf, 0xff, 0xfb, 0xef, 0xff, 0xfe, 0xbf, 0x7f,
+	0xef, 0xdf, 0xfb, 0xf7, 0xfe, 0xfd, 0x7f, 0xff, 0xdf, 0xbf, 0xf7, 0xef, 0xfd, 0xfb, 0xff, 0xfe,
+	0xbf, 0x7f, 0xef, 0xdf, 0xf7, 0xf7, 0xf7, 0xf7, 0xf7, 0xf7, 0xf7, 0xf7, 0xf7, 0xf7, 0xf7, 0xf7,
+	0xf7, 0xf7, 0xf7, 0xf7, 0xf7, 0xf7, 0xf7, 0xf7, 0xf7, 0xf7, 0xf7, 0xf7, 0xf7, 0xf7, 0xf7, 0xf7,
+	0xf7, 0xf7, 0xf7, 0xf7, 0xf7, 0xf7, 0xef, 0xf7, 0xbf, 0xdf, 0xfd, 0x7e, 0xf7, 0xfb, 0xdf, 0xef,
+	0x7e, 0xbf, 0xfb, 0xfd, 0xef, 0xf7, 0xbf, 0xdf, 0xfd, 0x7e, 0xf7, 0xfb, 0xdf, 0xef, 0x7e, 0xbf,
+	0xfb, 0xfd, 0xef, 0xf7, 0xbf, 0xdf, 0xfd, 0x7e, 0xf7, 0xfb, 0xdf, 0xef, 0x7e, 0xbf, 0xfb, 0xfd,
+	0xef, 0xf7, 0xbf, 0xdf, 0xfd, 0x7e, 0xef, 0xfb, 0xfb, 0xbe, 0xbe, 0xef, 0xef, 0xfb, 0xfb, 0xbe,
+	0xbe, 0xef, 0xef, 0xfb, 0xfb, 0xbe, 0xbe, 0xef, 0xef, 0xfb, 0xfb, 0xbe, 0xbe, 0xef, 0xef, 0xfb,
+	0xfb, 0xbe, 0xbe, 0xef, 0xef, 0xfb, 0xfb, 0xbe, 0xbe, 0xef, 0xef, 0xfb, 0xfb, 0xbe, 0xbe, 0xef,
+	0xef, 0xfb, 0xfb, 0xbe, 0xbe, 0xef, 0xef, 0xfb, 0xfb, 0xbe, 0xbe, 0xef, 0xef, 0xfb, 0xfb, 0xbe,
+	0xbe, 0xef, 0xef, 0xfb, 0xfb, 0xbe, 0xbe, 0xef, 0xef, 0xfb, 0xde, 0x7b, 0xbd, 0xf7, 0x7b, 0xef,
+	0xf7, 0xde, 0xef, 0xbd, 0xde, 0x7b, 0xbd, 0xf7, 0x7b, 0xef, 0xf7, 0xde, 0xef, 0xbd, 0xde, 0x7b,
+	0xbd, 0xf7, 0x7b, 0xef, 0xf7, 0xde, 0xef, 0xbd, 0xde, 0x7b, 0xbd, 0xf7, 0x7b, 0xef, 0xf7, 0xde,
+	0xef, 0xbd, 0xde, 0x7b, 0xbd, 0xf7, 0x7b, 0xef, 0xf7, 0xde, 0xef, 0xbd, 0xde, 0x7b, 0xbd, 0xf7,
+	0x7b, 0xef, 0xf7, 0xde, 0xef, 0xbd, 0xde, 0x7b, 0xbd, 0xf7, 0x7b, 0xef, 0xf7, 0xde, 0xef, 0xbd,
+	0xde, 0x7b, 0xbd, 0xf7, 0x7b, 0xef, 0xf7, 0xde, 0xef, 0xbd, 0xde, 0x7b, 0xbd, 0xf7, 0x7b, 0xef,
+	0xf7, 0xde, 0xee, 0xbd, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee,
+	0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee,
+	0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee,
+	0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee,
+	0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee,
+	0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee,
+	0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee,
+	0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0x6d, 0xdb, 0xdb, 0xb6, 0xb6, 0x6d, 0x6d, 0xdb,
+	0xdb, 0xb6, 0xb6, 0x6d, 0x6d, 0xdb, 0xdb, 0xb6, 0xb6, 0x6d, 0x6d, 0xdb, 0xdb, 0xb6, 0xb6, 0x6d,
+	0x6d, 0xdb, 0xdb, 0xb6, 0xb6, 0x6d, 0x6d, 0xdb, 0xdb, 0xb6, 0xb6, 0x6d, 0x6d, 0xdb, 0xdb, 0xb6,
+	0xb6, 0x6d, 0x6d, 0xdb, 0xdb, 0xb6, 0xb6, 0x6d, 0x6d, 0xdb, 0xdb, 0xb6, 0xb6, 0x6d, 0x6d, 0xdb,
+	0xdb, 0xb6, 0xb6, 0x6d, 0x6d, 0xdb, 0xdb, 0xb6, 0xb6, 0x6d, 0x6d, 0xdb, 0xdb, 0xb6, 0xb6, 0x6d,
+	0x6d, 0xdb, 0xdb, 0xb6, 0xb6, 0x6d, 0x6d, 0xdb, 0xdb, 0xb6, 0xb6, 0x6d, 0x6d, 0xdb, 0xdb, 0xb6,
+	0xb6, 0x6d, 0x6d, 0xdb, 0xdb, 0xb6, 0xb6, 0x6d, 0x6d, 0xdb, 0xdb, 0xb6, 0xb6, 0x6d, 0x6d, 0xdb,
+	0xdb, 0xb6, 0xb6, 0x6d, 0x6d, 0xdb, 0xdb, 0xb6, 0xb6, 0x6d, 0x6d, 0xdb, 0xdb, 0xb6, 0xb6, 0x6d,
+	0x6d, 0xdb, 0xdb, 0xb6, 0xb6, 0x6d, 0x6d, 0xdb, 0xdb, 0xb6, 0xb6, 0x6d, 0x6d, 0xdb, 0xdb, 0xb6,
+	0xb6, 0x6d, 0x6d, 0xdb, 0xd5, 0xb6, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+	0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+	0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+	0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+	0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+	0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+	0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+	0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+	0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+	0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x54, 0x55, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3f, 0x00, 0x80, 0xff, 0x00, 0x00 };
+/* Two blocks where the first block contains a match of 99749 bytes, which
+ * continues past the end of the block and has its size stored in 32 bits,
+ * and the second block a match of 587 bytes, which has its size stored in 16 bits
+ */
+uint8_t assorted_test_lzxpress_huffman_matches_compressed_data[ 788 ] = {
+	0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88,
+	0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88,
+	0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88,
+	0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88,
+	0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88,
+	0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88,
+	0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88,
+	0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x77, 0x07, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x70,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x09, 0x08, 0x0b, 0x0a, 0x0d, 0x0c, 0x0f, 0x0e, 0x11, 0x10, 0x13, 0x12, 0x15, 0x14, 0x17, 0x16,
+	0x19, 0x18, 0x1b, 0x1a, 0x1d, 0x1c, 0x1f, 0x1e, 0x21, 0x20, 0x23, 0x22, 0x25, 0x24, 0x27, 0x26,
+	0x29, 0x28, 0x2b, 0x2a, 0x2d, 0x2c, 0x2f, 0x2e, 0x31, 0x30, 0x33, 0x32, 0x35, 0x34, 0x37, 0x36,
+	0x39, 0x38, 0x3b, 0x3a, 0x3d, 0x3c, 0x3f, 0x3e, 0x41, 0x40, 0x43, 0x42, 0x45, 0x44, 0x47, 0x46,
+	0x49, 0x48, 0x4b, 0x4a, 0x4d, 0x4c, 0x4f, 0x4e, 0x51, 0x50, 0x53, 0x52, 0x55, 0x54, 0x57, 0x56,
+	0x59, 0x58, 0x5b, 0x5a, 0x5d, 0x5c, 0x5f, 0x5e, 0x61, 0x60, 0x63, 0x62, 0x65, 0x64, 0x67, 0x66,
+	0x69, 0x68, 0x6b, 0x6a, 0x6d, 0x6c, 0x6f, 0x6e, 0x71, 0x70, 0x73, 0x72, 0x75, 0x74, 0x77, 0x76,
+	0x79, 0x78, 0x7b, 0x7a, 0x7d, 0x7c, 0x7f, 0x7e, 0x81, 0x80, 0x83, 0x82, 0x85, 0x84, 0x87, 0x86,
+	0x89, 0x88, 0x8b, 0x8a, 0x8d, 0x8c, 0x8f, 0x8e, 0x91, 0x90, 0x93, 0x92, 0x95, 0x94, 0x97, 0x96,
+	0x99, 0x98, 0x9b, 0x9a, 0x9d, 0x9c, 0x9f, 0x9e, 0xa1, 0xa0, 0xa3, 0xa2, 0xa5, 0xa4, 0xa7, 0xa6,
+	0xa9, 0xa8, 0xab, 0xaa, 0xad, 0xac, 0xaf, 0xae, 0xb1, 0xb0, 0xb3, 0xb2, 0xb5, 0xb4, 0xb7, 0xb6,
+	0xb9, 0xb8, 0xbb, 0xba, 0xbd, 0xbc, 0xbf, 0xbe, 0xc1, 0xc0, 0xc3, 0xc2, 0xc5, 0xc4, 0xc7, 0xc6,
+	0xc9, 0xc8, 0xcb, 0xca, 0xcd, 0xcc, 0xcf, 0xce, 0xd1, 0xd0, 0xd3, 0xd2, 0xd5, 0xd4, 0xd7, 0xd6,
+	0xd9, 0xd8, 0xdb, 0xda, 0xdd, 0xdc, 0xdf, 0xde, 0xe1, 0xe0, 0xe3, 0xe2, 0xe5, 0xe4, 0xe7, 0xe6,
+	0xe9, 0xe8, 0xeb, 0xea, 0xed, 0xec, 0xef, 0xee, 0xf1, 0xf0, 0xf3, 0xf2, 0xf5, 0xf4, 0xf7, 0xf6,
+	0xf9, 0xf8, 0xfb, 0xfa, 0xfd, 0xfc, 0xff, 0xfe, 0x04, 0x00, 0x3f, 0x10, 0x00, 0x60, 0xff, 0x00,
+	0x00, 0xa2, 0x85, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x30, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x6b, 0x9e, 0xd5, 0x38, 0x7c, 0xa2, 0x7c, 0x41, 0x00,
+	0x00, 0xff, 0x48, 0x02 };
+
+uint8_t assorted_test_lzxpress_literals_uncompressed_data[ ASSORTED_TEST_LZXPRESS_LITERALS_DATA_SIZE ];
+
+uint8_t assorted_test_lzxpress_matches_uncompressed_data[ ASSORTED_TEST_LZXPRESS_MATCHES_DATA_SIZE ];
+
+/* Fills the uncompressed test data
+ */
+void assorted_test_lzxpress_fill_data(
+      void )
+{
+	size_t data_offset   = 0;
+	size_t next_run_size = 2;
+	size_t run_index     = 0;
+	size_t run_size      = 1;
+	uint8_t byte_value   = (uint8_t) 'A';
+
+	while( data_offset < ASSORTED_TEST_LZXPRESS_LITERALS_DATA_SIZE )
+	{
+		for( run_index = 0;
+		     ( run_index < run_size ) && ( data_offset < ASSORTED_TEST_LZXPRESS_LITERALS_DATA_SIZE );
+		     run_index++ )
+		{
+			assorted_test_lzxpress_literals_uncompressed_data[ data_offset++ ] = byte_value;
+		}
+		next_run_size += run_size;
+		run_size       = next_run_size - run_size;
+
+		byte_value++;
+	}
+	for( data_offset = 0;
+	     data_offset < ASSORTED_TEST_LZXPRESS_MATCHES_DATA_SIZE;
+	     data_offset++ )
+	{
+		if( data_offset < 100000 )
+		{
+			assorted_test_lzxpress_matches_uncompressed_data[ data_offset ] = (uint8_t) ( data_offset % 251 );
+		}
+		else
+		{
+			assorted_test_lzxpress_matches_uncompressed_data[ data_offset ] = (uint8_t) ( 'a' + ( ( data_offset * 31 ) % 13 ) );
+		}
+	}
+}
+
+/* Tests the lzxpress_huffman_table_construct function
+ * Returns 1 if successful or 0 if not
+ */
+int assorted_test_lzxpress_huffman_table_construct(
+     void )
+{
+	uint8_t code_sizes_table[ LZXPRESS_HUFFMAN_CODE_SIZES_TABLE_SIZE ];
+
+	lzxpress_huffman_table_t table;
+
+	libcerror_error_t *error = NULL;
+	int result               = 0;
+
+	/* Test regular cases
+	 */
+	result = lzxpress_huffman_table_construct(
+	          &table,
+	          assorted_test_lzxpress_huffman_literals_compressed_data,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ASSORTED_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* The 1-bit code of 'O' fills the first half of the primary table
+	 */
+	ASSORTED_TEST_ASSERT_EQUAL_UINT16(
+	 "table.lookup_table[ 0 ]",
+	 table.lookup_table[ 0 ],
+	 (uint16_t) ( ( 1 << 9 ) | 'O' ) );
+
+	ASSORTED_TEST_ASSERT_EQUAL_UINT16(
+	 "table.lookup_table[ 511 ]",
+	 table.lookup_table[ 511 ],
+	 (uint16_t) ( ( 1 << 9 ) | 'O' ) );
+
+	/* The 11-bit to 15-bit codes are stored in a secondary table
+	 */
+	ASSORTED_TEST_ASSERT_NOT_EQUAL_INT(
+	 "table.lookup_table[ 1023 ] & 0x8000",
+	 (int) ( table.lookup_table[ 1023 ] & 0x8000 ),
+	 0 );
+
+	/* Test error cases
+	 */
+	result = lzxpress_huffman_table_construct(
+	          NULL,
+	          assorted_test_lzxpress_huffman_literals_compressed_data,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ASSORTED_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = lzxpress_huffman_table_construct(
+	          &table,
+	          NULL,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ASSORTED_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Test table without codes
+	 */
+	memory_set(
+	 code_sizes_table,
+	 0,
+	 LZXPRESS_HUFFMAN_CODE_SIZES_TABLE_SIZE );
+
+	result = lzxpress_huffman_table_construct(
+	          &table,
+	          code_sizes_table,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ASSORTED_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Test over-subscribed code sizes
+	 */
+	memory_set(
+	 code_sizes_table,
+	 0x11,
+	 LZXPRESS_HUFFMAN_CODE_SIZES_TABLE_SIZE );
+
+	result = lzxpress_huffman_table_construct(
+	          &table,
+	          code_sizes_table,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ASSORTED_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the lzxpress_huffman_decompress function
+ * Returns 1 if successful or 0 if not
+ */
+int assorted_test_lzxpress_huffman_decompress(
+     void )
+{
+	libcerror_error_t *error      = NULL;
+	uint8_t *uncompressed_data    = NULL;
+	size_t uncompressed_data_size = 0;
+	int result                    = 0;
+
+	uncompressed_data = (uint8_t *) memory_allocate(
+	                                 sizeof( uint8_t ) * ASSORTED_TEST_LZXPRESS_MATCHES_DATA_SIZE );
+
+	ASSORTED_TEST_ASSERT_IS_NOT_NULL(
+	 "uncompressed_data",
+	 uncompressed_data );
+
+	/* Test regular cases
+	 */
+	uncompressed_data_size = ASSORTED_TEST_LZXPRESS_MATCHES_DATA_SIZE;
+
+	result = lzxpress_huffman_decompress(
+	          assorted_test_lzxpress_huffman_literals_compressed_data,
+	          1102,
+	          uncompressed_data,
+	          &uncompressed_data_size,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ASSORTED_TEST_ASSERT_EQUAL_SIZE(
+	 "uncompressed_data_size",
+	 uncompressed_data_size,
+	 (size_t) ASSORTED_TEST_LZXPRESS_LITERALS_DATA_SIZE );
+
+	ASSORTED_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = memory_compare(
+	          uncompressed_data,
+	          assorted_test_lzxpress_literals_uncompressed_data,
+	          ASSORTED_TEST_LZXPRESS_LITERALS_DATA_SIZE );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	uncompressed_data_size = ASSORTED_TEST_LZXPRESS_MATCHES_DATA_SIZE;
+
+	result = lzxpress_huffman_decompress(
+	          assorted_test_lzxpress_huffman_matches_compressed_data,
+	          788,
+	          uncompressed_data,
+	          &uncompressed_data_size,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ASSORTED_TEST_ASSERT_EQUAL_SIZE(
+	 "uncompressed_data_size",
+	 uncompressed_data_size,
+	 (size_t) ASSORTED_TEST_LZXPRESS_MATCHES_DATA_SIZE );
+
+	ASSORTED_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = memory_compare(
+	          uncompressed_data,
+	          assorted_test_lzxpress_matches_uncompressed_data,
+	          ASSORTED_TEST_LZXPRESS_MATCHES_DATA_SIZE );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	/* Test uncompressed data that ends before the end-of-stream symbol
+	 */
+	uncompressed_data_size = 1000;
+
+	result = lzxpress_huffman_decompress(
+	          assorted_test_lzxpress_huffman_literals_compressed_data,
+	          1102,
+	          uncompressed_data,
+	          &uncompressed_data_size,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ASSORTED_TEST_ASSERT_EQUAL_SIZE(
+	 "uncompressed_data_size",
+	 uncompressed_data_size,
+	 (size_t) 1000 );
+
+	ASSORTED_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test uncompressed data too small for a match
+	 */
+	uncompressed_data_size = 1000;
+
+	result = lzxpress_huffman_decompress(
+	          assorted_test_lzxpress_huffman_matches_compressed_data,
+	          788,
+	          uncompressed_data,
+	          &uncompressed_data_size,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ASSORTED_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Test compressed data too small
+	 */
+	uncompressed_data_size = ASSORTED_TEST_LZXPRESS_MATCHES_DATA_SIZE;
+
+	result = lzxpress_huffman_decompress(
+	          assorted_test_lzxpress_huffman_matches_compressed_data,
+	          100,
+	          uncompressed_data,
+	          &uncompressed_data_size,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ASSORTED_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Test error cases
+	 */
+	uncompressed_data_size = ASSORTED_TEST_LZXPRESS_MATCHES_DATA_SIZE;
+
+	result = lzxpress_huffman_decompress(
+	          NULL,
+	          788,
+	          uncompressed_data,
+	          &uncompressed_data_size,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ASSORTED_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = lzxpress_huffman_decompress(
+	          assorted_test_lzxpress_huffman_matches_compressed_data,
+	          (size_t) SSIZE_MAX + 1,
+	          uncompressed_data,
+	          &uncompressed_data_size,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ASSORTED_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = lzxpress_huffman_decompress(
+	          assorted_test_lzxpress_huffman_matches_compressed_data,
+	          788,
+	          NULL,
+	          &uncompressed_data_size,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ASSORTED_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = lzxpress_huffman_decompress(
+	          assorted_test_lzxpress_huffman_matches_compressed_data,
+	          788,
+	          uncompressed_data,
+	          NULL,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ASSORTED_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	memory_free(
+	 uncompressed_data );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( uncompressed_data != NULL )
+	{
+		memory_free(
+		 uncompressed_data );
+	}
+	return( 0 );
+}
+
+/* Tests the lzxpress_huffman_decompress_allocate function
+ * Returns 1 if successful or 0 if not
+ */
+int assorted_test_lzxpress_huffman_decompress_allocate(
+     void )
+{
+	libcerror_error_t *error      = NULL;
+	uint8_t *uncompressed_data    = NULL;
+	size_t uncompressed_data_size = 0;
+	int result                    = 0;
+
+	/* Test regular cases
+	 * the initial buffer of 4 times the compressed data size is resized
+	 * while decompressing the match that continues past the first block
+	 */
+	result = lzxpress_huffman_decompress_allocate(
+	          assorted_test_lzxpress_huffman_matches_compressed_data,
+	          788,
+	          &uncompressed_data,
+	          &uncompressed_data_size,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ASSORTED_TEST_ASSERT_IS_NOT_NULL(
+	 "uncompressed_data",
+	 uncompressed_data );
+
+	ASSORTED_TEST_ASSERT_EQUAL_SIZE(
+	 "uncompressed_data_size",
+	 uncompressed_data_size,
+	 (size_t) ASSORTED_TEST_LZXPRESS_MATCHES_DATA_SIZE );
+
+	ASSORTED_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = memory_compare(
+	          uncompressed_data,
+	          assorted_test_lzxpress_matches_uncompressed_data,
+	          ASSORTED_TEST_LZXPRESS_MATCHES_DATA_SIZE );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	/* Test error cases
+	 */
+	result = lzxpress_huffman_decompress_allocate(
+	          assorted_test_lzxpress_huffman_matches_compressed_data,
+	          788,
+	          &uncompressed_data,
+	          &uncompressed_data_size,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ASSORTED_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	memory_free(
+	 uncompressed_data );
+
+	uncompressed_data = NULL;
+
+	result = lzxpress_huffman_decompress_allocate(
+	          assorted_test_lzxpress_huffman_matches_compressed_data,
+	          788,
+	          NULL,
+	          &uncompressed_data_size,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ASSORTED_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	uncompressed_data_size = 0;
+
+	result = lzxpress_huffman_decompress_allocate(
+	          assorted_test_lzxpress_huffman_matches_compressed_data,
+	          100,
+	          &uncompressed_data,
+	          &uncompressed_data_size,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ASSORTED_TEST_ASSERT_IS_NULL(
+	 "uncompressed_data",
+	 uncompressed_data );
+
+	ASSORTED_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( uncompressed_data != NULL )
+	{
+		memory_free(
+		 uncompressed_data );
+	}
+	return( 0 );
+}
+
+/* The main program
+ */
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+int wmain(
+     int argc ASSORTED_TEST_ATTRIBUTE_UNUSED,
+     wchar_t * const argv[] ASSORTED_TEST_ATTRIBUTE_UNUSED )
+#else
+int main(
+     int argc ASSORTED_TEST_ATTRIBUTE_UNUSED,
+     char * const argv[] ASSORTED_TEST_ATTRIBUTE_UNUSED )
+#endif
+{
+	ASSORTED_TEST_UNREFERENCED_PARAMETER( argc )
+	ASSORTED_TEST_UNREFERENCED_PARAMETER( argv )
+
+	assorted_test_lzxpress_fill_data();
+
+	ASSORTED_TEST_RUN(
+	 "lzxpress_huffman_table_construct",
+	 assorted_test_lzxpress_huffman_table_construct );
+
+	ASSORTED_TEST_RUN(
+	 "lzxpress_huffman_decompress",
+	 assorted_test_lzxpress_huffman_decompress );
+
+	ASSORTED_TEST_RUN(
+	 "lzxpress_huffman_decompress_allocate",
+	 assorted_test_lzxpress_huffman_decompress_allocate );
+
+	return( EXIT_SUCCESS );
+
+on_error:
+	return( EXIT_FAILURE );
+}
+
@@ -0,0 +1,376 @@
+/*
+ * Memory arena functions testing program
+ *
+ * Copyright (C) 2008-2019, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This software is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This software is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this software.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <memory.h>
+#include <memory_arena.h>
+#include <types.h>
+
+#if defined( HAVE_STDLIB_H ) || defined( WINAPI )
+#include <stdlib.h>
+#endif
+
+#include "assorted_test_macros.h"
+#include "assorted_test_unused.h"
+
+/* Tests the memory_arena_allocate function
+ * Returns 1 if successful or 0 if not
+ */
+int assorted_test_memory_arena_allocate(
+     uint8_t flags )
+{
+	memory_arena_t arena;
+
+	uint8_t *data[ 8 ];
+
+	uint8_t *previous_data = NULL;
+	int data_index         = 0;
+	int result             = 0;
+
+	/* Initialize test
+	 */
+	result = memory_arena_initialize(
+	          &arena,
+	          4096,
+	          flags );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	/* Test regular cases
+	 */
+	for( data_index = 0;
+	     data_index < 8;
+	     data_index++ )
+	{
+		data[ data_index ] = (uint8_t *) memory_arena_allocate(
+		                                  &arena,
+		                                  (size_t) ( data_index * 100 ) + 1 );
+
+		ASSORTED_TEST_ASSERT_IS_NOT_NULL(
+		 "data",
+		 data[ data_index ] );
+
+		ASSORTED_TEST_ASSERT_EQUAL_INT(
+		 "alignment",
+		 (int) ( (intptr_t) data[ data_index ] % MEMORY_ARENA_ALIGNMENT ),
+		 0 );
+
+		memory_set(
+		 data[ data_index ],
+		 data_index,
+		 ( data_index * 100 ) + 1 );
+	}
+	/* Test an allocation larger than the block size
+	 */
+	previous_data = (uint8_t *) memory_arena_allocate(
+	                             &arena,
+	                             65536 );
+
+	ASSORTED_TEST_ASSERT_IS_NOT_NULL(
+	 "previous_data",
+	 previous_data );
+
+	memory_set(
+	 previous_data,
+	 0xff,
+	 65536 );
+
+	for( data_index = 0;
+	     data_index < 8;
+	     data_index++ )
+	{
+		ASSORTED_TEST_ASSERT_EQUAL_INT(
+		 "data[ data_index ][ data_index * 100 ]",
+		 (int) data[ data_index ][ data_index * 100 ],
+		 data_index );
+	}
+	/* Test that a reset replaces the blocks by a single block that fits all the allocations
+	 */
+	result = memory_arena_reset(
+	          &arena );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ASSORTED_TEST_ASSERT_IS_NULL(
+	 "arena.current_block->previous_block",
+	 arena.current_block->previous_block );
+
+	for( data_index = 0;
+	     data_index < 8;
+	     data_index++ )
+	{
+		data[ data_index ] = (uint8_t *) memory_arena_allocate(
+		                                  &arena,
+		                                  (size_t) ( data_index * 100 ) + 1 );
+
+		ASSORTED_TEST_ASSERT_IS_NOT_NULL(
+		 "data",
+		 data[ data_index ] );
+	}
+	previous_data = (uint8_t *) memory_arena_allocate(
+	                             &arena,
+	                             65536 );
+
+	ASSORTED_TEST_ASSERT_IS_NOT_NULL(
+	 "previous_data",
+	 previous_data );
+
+	ASSORTED_TEST_ASSERT_IS_NULL(
+	 "arena.current_block->previous_block",
+	 arena.current_block->previous_block );
+
+	/* Test that a reset of a single block reuses the memory
+	 */
+	result = memory_arena_reset(
+	          &arena );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	previous_data = (uint8_t *) memory_arena_allocate(
+	                             &arena,
+	                             1 );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "previous_data",
+	 (int) ( previous_data == data[ 0 ] ),
+	 1 );
+
+	/* Test error cases
+	 */
+	previous_data = (uint8_t *) memory_arena_allocate(
+	                             &arena,
+	                             (size_t) SSIZE_MAX );
+
+	ASSORTED_TEST_ASSERT_IS_NULL(
+	 "previous_data",
+	 previous_data );
+
+	previous_data = (uint8_t *) memory_arena_allocate(
+	                             NULL,
+	                             1 );
+
+	ASSORTED_TEST_ASSERT_IS_NULL(
+	 "previous_data",
+	 previous_data );
+
+	result = memory_arena_reset(
+	          NULL );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	/* Clean up
+	 */
+	memory_arena_free(
+	 &arena );
+
+	ASSORTED_TEST_ASSERT_IS_NULL(
+	 "arena.current_block",
+	 arena.current_block );
+
+	return( 1 );
+
+on_error:
+	memory_arena_free(
+	 &arena );
+
+	return( 0 );
+}
+
+/* Tests the memory_arena_allocate function with heap backed blocks
+ * Returns 1 if successful or 0 if not
+ */
+int assorted_test_memory_arena_allocate_heap(
+     void )
+{
+	return( assorted_test_memory_arena_allocate(
+	         0 ) );
+}
+
+/* Tests the memory_arena_allocate function with huge page backed blocks
+ * Returns 1 if successful or 0 if not
+ */
+int assorted_test_memory_arena_allocate_huge_pages(
+     void )
+{
+	return( assorted_test_memory_arena_allocate(
+	         MEMORY_ARENA_FLAG_HUGE_PAGES ) );
+}
+
+/* Tests the memory_arena_get_mark and memory_arena_rewind functions
+ * Returns 1 if successful or 0 if not
+ */
+int assorted_test_memory_arena_rewind(
+     void )
+{
+	memory_arena_mark_t mark;
+	memory_arena_t arena;
+
+	memory_arena_block_t *block = NULL;
+	uint8_t *data               = NULL;
+	uint8_t *first_data         = NULL;
+	uint8_t *marked_data        = NULL;
+	int iteration               = 0;
+	int result                  = 0;
+
+	/* Initialize test
+	 */
+	result = memory_arena_initialize(
+	          &arena,
+	          1024,
+	          0 );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	first_data = (uint8_t *) memory_arena_allocate(
+	                          &arena,
+	                          100 );
+
+	ASSORTED_TEST_ASSERT_IS_NOT_NULL(
+	 "first_data",
+	 first_data );
+
+	memory_set(
+	 first_data,
+	 0x5a,
+	 100 );
+
+	memory_arena_get_mark(
+	 &arena,
+	 &mark );
+
+	block = arena.current_block;
+
+	/* Test regular cases
+	 */
+	for( iteration = 0;
+	     iteration < 4;
+	     iteration++ )
+	{
+		data = (uint8_t *) memory_arena_allocate(
+		                    &arena,
+		                    200 );
+
+		ASSORTED_TEST_ASSERT_IS_NOT_NULL(
+		 "data",
+		 data );
+
+		if( iteration == 0 )
+		{
+			marked_data = data;
+		}
+		else
+		{
+			ASSORTED_TEST_ASSERT_EQUAL_INT(
+			 "data",
+			 (int) ( data == marked_data ),
+			 1 );
+		}
+		/* Force an additional block
+		 */
+		data = (uint8_t *) memory_arena_allocate(
+		                    &arena,
+		                    8192 );
+
+		ASSORTED_TEST_ASSERT_IS_NOT_NULL(
+		 "data",
+		 data );
+
+		memory_set(
+		 data,
+		 0xa5,
+		 8192 );
+
+		memory_arena_rewind(
+		 &arena,
+		 &mark );
+
+		ASSORTED_TEST_ASSERT_EQUAL_INT(
+		 "arena.current_block",
+		 (int) ( arena.current_block == block ),
+		 1 );
+
+		ASSORTED_TEST_ASSERT_EQUAL_INT(
+		 "first_data[ 99 ]",
+		 (int) first_data[ 99 ],
+		 0x5a );
+	}
+	/* Clean up
+	 */
+	memory_arena_free(
+	 &arena );
+
+	return( 1 );
+
+on_error:
+	memory_arena_free(
+	 &arena );
+
+	return( 0 );
+}
+
+/* The main program
+ */
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+int wmain(
+     int argc ASSORTED_TEST_ATTRIBUTE_UNUSED,
+     wchar_t * const argv[] ASSORTED_TEST_ATTRIBUTE_UNUSED )
+#else
+int main(
+     int argc ASSORTED_TEST_ATTRIBUTE_UNUSED,
+     char * const argv[] ASSORTED_TEST_ATTRIBUTE_UNUSED )
+#endif
+{
+	ASSORTED_TEST_UNREFERENCED_PARAMETER( argc )
+	ASSORTED_TEST_UNREFERENCED_PARAMETER( argv )
+
+	ASSORTED_TEST_RUN(
+	 "memory_arena_allocate",
+	 assorted_test_memory_arena_allocate_heap );
+
+	ASSORTED_TEST_RUN(
+	 "memory_arena_allocate (huge pages)",
+	 assorted_test_memory_arena_allocate_huge_pages );
+
+	ASSORTED_TEST_RUN(
+	 "memory_arena_rewind",
+	 assorted_test_memory_arena_rewind );
+
+	return( EXIT_SUCCESS );
+
+on_error:
+	return( EXIT_FAILURE );
+}
+
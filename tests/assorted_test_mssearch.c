@@ -0,0 +1,1372 @@
+/*
+ * Windows Search (MSSearch) decoding and decompression functions testing program
+ *
+ * Copyright (C) 2008-2019, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This software is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This software is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this software.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <file_stream.h>
+#include <memory.h>
+#include <types.h>
+
+#if defined( HAVE_STDLIB_H ) || defined( WINAPI )
+#include <stdlib.h>
+#endif
+
+#include "assorted_test_libcerror.h"
+#include "assorted_test_macros.h"
+#include "assorted_test_unused.h"
+
+#include "../src/mssearch.h"
+
+/* A run-length compressed UTF-16 string of "Hello", U+00E9, " ", U+0416, U+1F600
+ * and 2 times U+20AC, of which the surrogate pair of U+1F600 is stored in 2 runs
+ */
+uint8_t assorted_test_mssearch_run_length_compressed_data1[ 24 ] = {
+	0x05, 0x00, 'H', 'e', 'l', 'l', 'o',
+	0x02, 0x00, 0xe9, ' ',
+	0x01, 0x04, 0x16,
+	0x01, 0xd8, 0x3d,
+	0x01, 0xde, 0x00,
+	0x02, 0x20, 0xac, 0xac };
+
+uint8_t assorted_test_mssearch_utf8_string1[ 21 ] = {
+	'H', 'e', 'l', 'l', 'o', 0xc3, 0xa9, ' ', 0xd0, 0x96, 0xf0, 0x9f, 0x98, 0x80,
+	0xe2, 0x82, 0xac, 0xe2, 0x82, 0xac, 0x00 };
+
+/* The uncompressed data of assorted_test_mssearch_run_length_compressed_data1
+ * as an UTF-16 little-endian string
+ */
+uint8_t assorted_test_mssearch_utf16_string1[ 24 ] = {
+	'H', 0x00, 'e', 0x00, 'l', 0x00, 'l', 0x00, 'o', 0x00, 0xe9, 0x00, ' ', 0x00, 0x16, 0x04,
+	0x3d, 0xd8, 0x00, 0xde, 0xac, 0x20, 0xac, 0x20 };
+
+/* A run-length compressed UTF-16 string of 12 ASCII characters followed by an end-of-string
+ * character, a low surrogate without high surrogate and a high surrogate at the end
+ */
+uint8_t assorted_test_mssearch_run_length_compressed_data2[ 25 ] = {
+	0x0e, 0x00, 'a', 'b', 'c', 'd', 'e', 'f', 'g', 'h', 'i', 'j', 'k', 'l', 0x00, 'm',
+	0x01, 0xdc, 0x00,
+	0x02, 0xd8, 0x00, 0x01,
+	0x00, 0x00 };
+
+uint8_t assorted_test_mssearch_run_length_compressed_data3[ 14 ] = {
+	0x02, 0x00, 'a', 'b',
+	0x01, 0xdc, 0x00,
+	0x03, 0xd8, 0x00, 0x01, 0x02,
+	0x00, 0x00 };
+
+uint8_t assorted_test_mssearch_utf8_string3[ 12 ] = {
+	'a', 'b', 0xef, 0xbf, 0xbd, 0xef, 0xbf, 0xbd, 0xef, 0xbf, 0xbd, 0x00 };
+
+/* The bit stream of byte-index compressed data of "Windows Search!!" that consists of
+ * 16 literals and an end-of-stream tuple, where every value is stored with a 9-bit code
+ */
+uint8_t assorted_test_mssearch_byte_index_bit_stream1[ 22 ] = {
+	0x9a, 0x2b, 0xc6, 0x4d, 0x79, 0x43, 0xe6, 0xdc, 0x29, 0x20, 0x4c, 0x99, 0x23, 0x27, 0xa0, 0x19,
+	0x21, 0x42, 0x00, 0x80, 0x00, 0x00 };
+
+/* The bit stream of byte-index compressed data of "abcdabcdabcdabcd" that consists of
+ * 4 literals, a tuple of offset 4 and size 12 and an end-of-stream tuple,
+ * where every value is stored with a 9-bit code
+ */
+uint8_t assorted_test_mssearch_byte_index_bit_stream2[ 10 ] = {
+	0x98, 0x30, 0x66, 0x8c, 0x49, 0x49, 0x00, 0x00, 0x00, 0x00 };
+
+/* Sets byte-index compressed data with an uncompressed data size of 16,
+ * a compression table where every value has a 9-bit code and a bit stream
+ */
+void assorted_test_mssearch_set_byte_index_compressed_data(
+      uint8_t *compressed_data,
+      const uint8_t *bit_stream,
+      size_t bit_stream_size )
+{
+	compressed_data[ 0 ] = 16;
+	compressed_data[ 1 ] = 0;
+
+	memory_set(
+	 &( compressed_data[ 2 ] ),
+	 0x99,
+	 256 );
+
+	memory_copy(
+	 &( compressed_data[ 2 + 256 ] ),
+	 bit_stream,
+	 bit_stream_size );
+}
+
+/* Decodes Windows Search encoded data a byte at a time
+ * This is used as the reference to test the optimized decoding against
+ */
+void assorted_test_mssearch_decode_bytes(
+      uint8_t *data,
+      const uint8_t *encoded_data,
+      size_t encoded_data_size )
+{
+	size_t data_offset = 0;
+	uint32_t bitmask32 = 0;
+
+	bitmask32 = 0x05000113 ^ (uint32_t) encoded_data_size;
+
+	for( data_offset = 0;
+	     data_offset < encoded_data_size;
+	     data_offset++ )
+	{
+		data[ data_offset ] = encoded_data[ data_offset ]
+		                    ^ (uint8_t) ( bitmask32 >> ( ( data_offset & 0x03 ) * 8 ) )
+		                    ^ (uint8_t) data_offset;
+	}
+}
+
+/* Tests the mssearch_decode function
+ * Returns 1 if successful or 0 if not
+ */
+int assorted_test_mssearch_decode(
+     void )
+{
+	uint8_t data[ 64 ];
+	uint8_t encoded_data[ 64 ];
+	uint8_t expected_data[ 64 ];
+
+	size_t encoded_data_sizes[ 10 ] = {
+		0, 1, 7, 8, 15, 16, 17, 31, 32, 33 };
+
+	uint8_t expected_data1[ 4 ] = {
+		0x17, 0x00, 0x02, 0x06 };
+
+	libcerror_error_t *error      = NULL;
+	size_t data_offset            = 0;
+	size_t encoded_data_size      = 0;
+	size_t encoded_data_offset    = 0;
+	int encoded_data_size_index   = 0;
+	int result                    = 0;
+
+	for( data_offset = 0;
+	     data_offset < 64;
+	     data_offset++ )
+	{
+		encoded_data[ data_offset ] = (uint8_t) ( ( data_offset * 37 ) + 11 );
+	}
+	/* Test regular cases
+	 */
+	memory_set(
+	 data,
+	 0,
+	 4 );
+
+	result = mssearch_decode(
+	          data,
+	          4,
+	          data,
+	          4,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ASSORTED_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = memory_compare(
+	          data,
+	          expected_data1,
+	          4 );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	/* Test the sizes of the SSE2, 64-bit and single byte decoding and their combinations
+	 * where the data starts at an aligned and an unaligned offset
+	 */
+	for( encoded_data_offset = 0;
+	     encoded_data_offset < 2;
+	     encoded_data_offset++ )
+	{
+		for( encoded_data_size_index = 0;
+		     encoded_data_size_index < 10;
+		     encoded_data_size_index++ )
+		{
+			encoded_data_size = encoded_data_sizes[ encoded_data_size_index ];
+
+			assorted_test_mssearch_decode_bytes(
+			 expected_data,
+			 &( encoded_data[ encoded_data_offset ] ),
+			 encoded_data_size );
+
+			memory_set(
+			 data,
+			 0xff,
+			 64 );
+
+			result = mssearch_decode(
+			          &( data[ encoded_data_offset ] ),
+			          encoded_data_size,
+			          &( encoded_data[ encoded_data_offset ] ),
+			          encoded_data_size,
+			          &error );
+
+			ASSORTED_TEST_ASSERT_EQUAL_INT(
+			 "result",
+			 result,
+			 1 );
+
+			ASSORTED_TEST_ASSERT_IS_NULL(
+			 "error",
+			 error );
+
+			result = memory_compare(
+			          &( data[ encoded_data_offset ] ),
+			          expected_data,
+			          encoded_data_size );
+
+			ASSORTED_TEST_ASSERT_EQUAL_INT(
+			 "result",
+			 result,
+			 0 );
+
+			/* The bytes after the data should not be changed
+			 */
+			ASSORTED_TEST_ASSERT_EQUAL_UINT8(
+			 "data[ encoded_data_offset + encoded_data_size ]",
+			 data[ encoded_data_offset + encoded_data_size ],
+			 (uint8_t) 0xff );
+		}
+	}
+	/* Test error cases
+	 */
+	result = mssearch_decode(
+	          data,
+	          64,
+	          NULL,
+	          64,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ASSORTED_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = mssearch_decode(
+	          data,
+	          64,
+	          encoded_data,
+	          (size_t) SSIZE_MAX + 1,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ASSORTED_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Test with data that is too small
+	 */
+	result = mssearch_decode(
+	          data,
+	          16,
+	          encoded_data,
+	          17,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ASSORTED_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the mssearch_get_run_length_uncompressed_utf16_string_size function
+ * Returns 1 if successful or 0 if not
+ */
+int assorted_test_mssearch_get_run_length_uncompressed_utf16_string_size(
+     void )
+{
+	libcerror_error_t *error      = NULL;
+	size_t uncompressed_data_size = 0;
+	int result                    = 0;
+
+	/* Test regular cases
+	 */
+	result = mssearch_get_run_length_uncompressed_utf16_string_size(
+	          assorted_test_mssearch_run_length_compressed_data1,
+	          24,
+	          &uncompressed_data_size,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ASSORTED_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_SIZE(
+	 "uncompressed_data_size",
+	 uncompressed_data_size,
+	 (size_t) 24 );
+
+	/* Test error cases
+	 */
+	result = mssearch_get_run_length_uncompressed_utf16_string_size(
+	          NULL,
+	          24,
+	          &uncompressed_data_size,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ASSORTED_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = mssearch_get_run_length_uncompressed_utf16_string_size(
+	          assorted_test_mssearch_run_length_compressed_data1,
+	          (size_t) SSIZE_MAX + 1,
+	          &uncompressed_data_size,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ASSORTED_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = mssearch_get_run_length_uncompressed_utf16_string_size(
+	          assorted_test_mssearch_run_length_compressed_data1,
+	          24,
+	          NULL,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ASSORTED_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the mssearch_decompress_run_length_compressed_utf16_string function
+ * Returns 1 if successful or 0 if not
+ */
+int assorted_test_mssearch_decompress_run_length_compressed_utf16_string(
+     void )
+{
+	uint8_t uncompressed_data[ 32 ];
+
+	libcerror_error_t *error = NULL;
+	int result               = 0;
+
+	/* Test regular cases
+	 */
+	result = mssearch_decompress_run_length_compressed_utf16_string(
+	          uncompressed_data,
+	          24,
+	          assorted_test_mssearch_run_length_compressed_data1,
+	          24,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ASSORTED_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = memory_compare(
+	          uncompressed_data,
+	          assorted_test_mssearch_utf16_string1,
+	          24 );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	/* Test error cases
+	 */
+	result = mssearch_decompress_run_length_compressed_utf16_string(
+	          NULL,
+	          24,
+	          assorted_test_mssearch_run_length_compressed_data1,
+	          24,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ASSORTED_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = mssearch_decompress_run_length_compressed_utf16_string(
+	          uncompressed_data,
+	          (size_t) SSIZE_MAX + 1,
+	          assorted_test_mssearch_run_length_compressed_data1,
+	          24,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ASSORTED_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = mssearch_decompress_run_length_compressed_utf16_string(
+	          uncompressed_data,
+	          24,
+	          NULL,
+	          24,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ASSORTED_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = mssearch_decompress_run_length_compressed_utf16_string(
+	          uncompressed_data,
+	          24,
+	          assorted_test_mssearch_run_length_compressed_data1,
+	          (size_t) SSIZE_MAX + 1,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ASSORTED_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Test with uncompressed data that is too small
+	 */
+	result = mssearch_decompress_run_length_compressed_utf16_string(
+	          uncompressed_data,
+	          23,
+	          assorted_test_mssearch_run_length_compressed_data1,
+	          24,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ASSORTED_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the mssearch_get_run_length_uncompressed_utf8_string_size function
+ * Returns 1 if successful or 0 if not
+ */
+int assorted_test_mssearch_get_run_length_uncompressed_utf8_string_size(
+     void )
+{
+	libcerror_error_t *error = NULL;
+	size_t utf8_string_size  = 0;
+	int result               = 0;
+
+	/* Test regular cases
+	 */
+	result = mssearch_get_run_length_uncompressed_utf8_string_size(
+	          assorted_test_mssearch_run_length_compressed_data1,
+	          24,
+	          &utf8_string_size,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ASSORTED_TEST_ASSERT_EQUAL_SIZE(
+	 "utf8_string_size",
+	 utf8_string_size,
+	 (size_t) 21 );
+
+	ASSORTED_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = mssearch_get_run_length_uncompressed_utf8_string_size(
+	          assorted_test_mssearch_run_length_compressed_data2,
+	          25,
+	          &utf8_string_size,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ASSORTED_TEST_ASSERT_EQUAL_SIZE(
+	 "utf8_string_size",
+	 utf8_string_size,
+	 (size_t) 13 );
+
+	ASSORTED_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = mssearch_get_run_length_uncompressed_utf8_string_size(
+	          assorted_test_mssearch_run_length_compressed_data3,
+	          14,
+	          &utf8_string_size,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ASSORTED_TEST_ASSERT_EQUAL_SIZE(
+	 "utf8_string_size",
+	 utf8_string_size,
+	 (size_t) 12 );
+
+	ASSORTED_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = mssearch_get_run_length_uncompressed_utf8_string_size(
+	          NULL,
+	          24,
+	          &utf8_string_size,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ASSORTED_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = mssearch_get_run_length_uncompressed_utf8_string_size(
+	          assorted_test_mssearch_run_length_compressed_data1,
+	          (size_t) SSIZE_MAX + 1,
+	          &utf8_string_size,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ASSORTED_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = mssearch_get_run_length_uncompressed_utf8_string_size(
+	          assorted_test_mssearch_run_length_compressed_data1,
+	          24,
+	          NULL,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ASSORTED_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the mssearch_decompress_run_length_compressed_utf8_string function
+ * Returns 1 if successful or 0 if not
+ */
+int assorted_test_mssearch_decompress_run_length_compressed_utf8_string(
+     void )
+{
+	uint8_t utf8_string[ 32 ];
+
+	libcerror_error_t *error = NULL;
+	int result               = 0;
+
+	/* Test regular cases
+	 */
+	result = mssearch_decompress_run_length_compressed_utf8_string(
+	          utf8_string,
+	          21,
+	          assorted_test_mssearch_run_length_compressed_data1,
+	          24,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ASSORTED_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = memory_compare(
+	          utf8_string,
+	          assorted_test_mssearch_utf8_string1,
+	          21 );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	result = mssearch_decompress_run_length_compressed_utf8_string(
+	          utf8_string,
+	          13,
+	          assorted_test_mssearch_run_length_compressed_data2,
+	          25,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ASSORTED_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = memory_compare(
+	          utf8_string,
+	          "abcdefghijkl",
+	          13 );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	result = mssearch_decompress_run_length_compressed_utf8_string(
+	          utf8_string,
+	          12,
+	          assorted_test_mssearch_run_length_compressed_data3,
+	          14,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ASSORTED_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = memory_compare(
+	          utf8_string,
+	          assorted_test_mssearch_utf8_string3,
+	          12 );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	/* Test error cases
+	 */
+	result = mssearch_decompress_run_length_compressed_utf8_string(
+	          NULL,
+	          21,
+	          assorted_test_mssearch_run_length_compressed_data1,
+	          24,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ASSORTED_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = mssearch_decompress_run_length_compressed_utf8_string(
+	          utf8_string,
+	          0,
+	          assorted_test_mssearch_run_length_compressed_data1,
+	          24,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ASSORTED_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = mssearch_decompress_run_length_compressed_utf8_string(
+	          utf8_string,
+	          21,
+	          NULL,
+	          24,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ASSORTED_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Test with an UTF-8 string that is too small
+	 */
+	result = mssearch_decompress_run_length_compressed_utf8_string(
+	          utf8_string,
+	          20,
+	          assorted_test_mssearch_run_length_compressed_data1,
+	          24,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ASSORTED_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the mssearch_get_byte_index_uncompressed_data_size function
+ * Returns 1 if successful or 0 if not
+ */
+int assorted_test_mssearch_get_byte_index_uncompressed_data_size(
+     void )
+{
+	uint8_t compressed_data[ 2 + 256 + 22 ];
+
+	libcerror_error_t *error      = NULL;
+	size_t uncompressed_data_size = 0;
+	int result                    = 0;
+
+	assorted_test_mssearch_set_byte_index_compressed_data(
+	 compressed_data,
+	 assorted_test_mssearch_byte_index_bit_stream1,
+	 22 );
+
+	/* Test regular cases
+	 */
+	result = mssearch_get_byte_index_uncompressed_data_size(
+	          compressed_data,
+	          2 + 256 + 22,
+	          &uncompressed_data_size,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ASSORTED_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_SIZE(
+	 "uncompressed_data_size",
+	 uncompressed_data_size,
+	 (size_t) 16 );
+
+	/* Test error cases
+	 */
+	result = mssearch_get_byte_index_uncompressed_data_size(
+	          NULL,
+	          2 + 256 + 22,
+	          &uncompressed_data_size,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ASSORTED_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = mssearch_get_byte_index_uncompressed_data_size(
+	          compressed_data,
+	          (size_t) SSIZE_MAX + 1,
+	          &uncompressed_data_size,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ASSORTED_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = mssearch_get_byte_index_uncompressed_data_size(
+	          compressed_data,
+	          2 + 256 + 22,
+	          NULL,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ASSORTED_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Test with compressed data that is too small
+	 */
+	result = mssearch_get_byte_index_uncompressed_data_size(
+	          compressed_data,
+	          1,
+	          &uncompressed_data_size,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ASSORTED_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the mssearch_decompress_byte_indexed_compressed_data function
+ * Returns 1 if successful or 0 if not
+ */
+int assorted_test_mssearch_decompress_byte_indexed_compressed_data(
+     void )
+{
+	uint8_t compressed_data[ 2 + 256 + 22 ];
+	uint8_t uncompressed_data[ 64 ];
+
+	libcerror_error_t *error      = NULL;
+	size_t uncompressed_data_size = 0;
+	int result                    = 0;
+
+	/* Test regular cases
+	 */
+	assorted_test_mssearch_set_byte_index_compressed_data(
+	 compressed_data,
+	 assorted_test_mssearch_byte_index_bit_stream1,
+	 22 );
+
+	uncompressed_data_size = 16;
+
+	result = mssearch_decompress_byte_indexed_compressed_data(
+	          uncompressed_data,
+	          &uncompressed_data_size,
+	          compressed_data,
+	          2 + 256 + 22,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ASSORTED_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_SIZE(
+	 "uncompressed_data_size",
+	 uncompressed_data_size,
+	 (size_t) 16 );
+
+	result = memory_compare(
+	          uncompressed_data,
+	          "Windows Search!!",
+	          16 );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	/* Test with an uncompressed data buffer that is larger than the stored size
+	 */
+	assorted_test_mssearch_set_byte_index_compressed_data(
+	 compressed_data,
+	 assorted_test_mssearch_byte_index_bit_stream2,
+	 10 );
+
+	uncompressed_data_size = 64;
+
+	result = mssearch_decompress_byte_indexed_compressed_data(
+	          uncompressed_data,
+	          &uncompressed_data_size,
+	          compressed_data,
+	          2 + 256 + 10,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ASSORTED_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_SIZE(
+	 "uncompressed_data_size",
+	 uncompressed_data_size,
+	 (size_t) 16 );
+
+	result = memory_compare(
+	          uncompressed_data,
+	          "abcdabcdabcdabcd",
+	          16 );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	/* Test error cases
+	 */
+	uncompressed_data_size = 64;
+
+	result = mssearch_decompress_byte_indexed_compressed_data(
+	          NULL,
+	          &uncompressed_data_size,
+	          compressed_data,
+	          2 + 256 + 10,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ASSORTED_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = mssearch_decompress_byte_indexed_compressed_data(
+	          uncompressed_data,
+	          NULL,
+	          compressed_data,
+	          2 + 256 + 10,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ASSORTED_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = mssearch_decompress_byte_indexed_compressed_data(
+	          uncompressed_data,
+	          &uncompressed_data_size,
+	          NULL,
+	          2 + 256 + 10,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ASSORTED_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = mssearch_decompress_byte_indexed_compressed_data(
+	          uncompressed_data,
+	          &uncompressed_data_size,
+	          compressed_data,
+	          (size_t) SSIZE_MAX + 1,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ASSORTED_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Test with compressed data that is truncated in the compression table
+	 */
+	result = mssearch_decompress_byte_indexed_compressed_data(
+	          uncompressed_data,
+	          &uncompressed_data_size,
+	          compressed_data,
+	          2 + 255,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ASSORTED_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Test with compressed data that is truncated in a 16-bit value of the bit stream
+	 */
+	result = mssearch_decompress_byte_indexed_compressed_data(
+	          uncompressed_data,
+	          &uncompressed_data_size,
+	          compressed_data,
+	          2 + 256 + 9,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ASSORTED_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Test with an uncompressed data buffer that is smaller than the stored size
+	 */
+	uncompressed_data_size = 15;
+
+	result = mssearch_decompress_byte_indexed_compressed_data(
+	          uncompressed_data,
+	          &uncompressed_data_size,
+	          compressed_data,
+	          2 + 256 + 10,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ASSORTED_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Test with a stored size that is smaller than the size of the uncompressed data
+	 */
+	compressed_data[ 0 ] = 8;
+
+	uncompressed_data_size = 8;
+
+	result = mssearch_decompress_byte_indexed_compressed_data(
+	          uncompressed_data,
+	          &uncompressed_data_size,
+	          compressed_data,
+	          2 + 256 + 10,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ASSORTED_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	compressed_data[ 0 ] = 16;
+
+	/* Test with an over-subscribed compression table, where 2 values have an 8-bit code
+	 * and the other values a 9-bit code
+	 */
+	compressed_data[ 2 ] = 0x88;
+
+	uncompressed_data_size = 64;
+
+	result = mssearch_decompress_byte_indexed_compressed_data(
+	          uncompressed_data,
+	          &uncompressed_data_size,
+	          compressed_data,
+	          2 + 256 + 10,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ASSORTED_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* The main program
+ */
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+int wmain(
+     int argc ASSORTED_TEST_ATTRIBUTE_UNUSED,
+     wchar_t * const argv[] ASSORTED_TEST_ATTRIBUTE_UNUSED )
+#else
+int main(
+     int argc ASSORTED_TEST_ATTRIBUTE_UNUSED,
+     char * const argv[] ASSORTED_TEST_ATTRIBUTE_UNUSED )
+#endif
+{
+	ASSORTED_TEST_UNREFERENCED_PARAMETER( argc )
+	ASSORTED_TEST_UNREFERENCED_PARAMETER( argv )
+
+	ASSORTED_TEST_RUN(
+	 "mssearch_decode",
+	 assorted_test_mssearch_decode );
+
+	ASSORTED_TEST_RUN(
+	 "mssearch_get_run_length_uncompressed_utf16_string_size",
+	 assorted_test_mssearch_get_run_length_uncompressed_utf16_string_size );
+
+	ASSORTED_TEST_RUN(
+	 "mssearch_decompress_run_length_compressed_utf16_string",
+	 assorted_test_mssearch_decompress_run_length_compressed_utf16_string );
+
+	ASSORTED_TEST_RUN(
+	 "mssearch_get_run_length_uncompressed_utf8_string_size",
+	 assorted_test_mssearch_get_run_length_uncompressed_utf8_string_size );
+
+	ASSORTED_TEST_RUN(
+	 "mssearch_decompress_run_length_compressed_utf8_string",
+	 assorted_test_mssearch_decompress_run_length_compressed_utf8_string );
+
+	ASSORTED_TEST_RUN(
+	 "mssearch_get_byte_index_uncompressed_data_size",
+	 assorted_test_mssearch_get_byte_index_uncompressed_data_size );
+
+	ASSORTED_TEST_RUN(
+	 "mssearch_decompress_byte_indexed_compressed_data",
+	 assorted_test_mssearch_decompress_byte_indexed_compressed_data );
+
+	return( EXIT_SUCCESS );
+
+on_error:
+	return( EXIT_FAILURE );
+}
+
@@ -0,0 +1,527 @@
+/*
+ * MSZIP decompression functions testing program
+ *
+ * Copyright (C) 2008-2019, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This software is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This software is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this software.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <file_stream.h>
+#include <memory.h>
+#include <types.h>
+
+#if defined( HAVE_STDLIB_H ) || defined( WINAPI )
+#include <stdlib.h>
+#endif
+
+#include "assorted_test_libcerror.h"
+#include "assorted_test_macros.h"
+#include "assorted_test_unused.h"
+#include "../src/mszip.h"
+
+/* The first MSZIP compressed block of a folder
+ */
+uint8_t assorted_test_mszip_compressed_block1[ 54 ] = {
+	0x43, 0x4b, 0xf3, 0x0d, 0x8e, 0xf2, 0x0c, 0x50, 0x48, 0xce, 0xcf, 0x2d, 0x28, 0x4a, 0x2d, 0x2e,
+	0x4e, 0x4d, 0x51, 0x48, 0x49, 0x2c, 0x49, 0x54, 0x48, 0xca, 0xc9, 0x4f, 0xce, 0x2e, 0x56, 0xc8,
+	0x4f, 0x53, 0x48, 0x54, 0x48, 0x4e, 0x4c, 0xca, 0xcc, 0x4b, 0x2d, 0x51, 0x48, 0xcb, 0xcf, 0x49,
+	0x49, 0x2d, 0xd2, 0xe3, 0x02, 0x00 };
+
+/* The second MSZIP compressed block of a folder, which refers to the uncompressed data
+ * of the first block
+ */
+uint8_t assorted_test_mszip_compressed_block2[ 33 ] = {
+	0x43, 0x4b, 0x0b, 0xc9, 0x48, 0x55, 0x28, 0x4e, 0x4d, 0xce, 0xcf, 0x4b, 0x81, 0x28, 0x53, 0x28,
+	0x4a, 0x4d, 0x4b, 0x2d, 0x2a, 0x56, 0x28, 0xc9, 0x57, 0x28, 0x01, 0x4a, 0xf9, 0x92, 0x6c, 0x20,
+	0x00 };
+
+uint8_t *assorted_test_mszip_uncompressed_block1 = (uint8_t *) \
+	"MSZIP compressed data blocks of a cabinet folder.\n";
+
+uint8_t *assorted_test_mszip_uncompressed_block2 = (uint8_t *) \
+	"The second block refers to the MSZIP compressed data blocks of a cabinet folder.\n";
+
+/* Tests the mszip_decoder_initialize function
+ * Returns 1 if successful or 0 if not
+ */
+int assorted_test_mszip_decoder_initialize(
+     void )
+{
+	libcerror_error_t *error = NULL;
+	mszip_decoder_t *decoder = NULL;
+	int result               = 0;
+
+	/* Test regular cases
+	 */
+	result = mszip_decoder_initialize(
+	          &decoder,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ASSORTED_TEST_ASSERT_IS_NOT_NULL(
+	 "decoder",
+	 decoder );
+
+	ASSORTED_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = mszip_decoder_free(
+	          &decoder,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ASSORTED_TEST_ASSERT_IS_NULL(
+	 "decoder",
+	 decoder );
+
+	ASSORTED_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = mszip_decoder_initialize(
+	          NULL,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ASSORTED_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	decoder = (mszip_decoder_t *) 0x12345678UL;
+
+	result = mszip_decoder_initialize(
+	          &decoder,
+	          &error );
+
+	decoder = NULL;
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ASSORTED_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( decoder != NULL )
+	{
+		mszip_decoder_free(
+		 &decoder,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the mszip_decoder_decompress_block function
+ * Returns 1 if successful or 0 if not
+ */
+int assorted_test_mszip_decoder_decompress_block(
+     void )
+{
+	uint8_t uncompressed_data[ 128 ];
+
+	libcerror_error_t *error      = NULL;
+	mszip_decoder_t *decoder      = NULL;
+	size_t uncompressed_data_size = 0;
+	int result                    = 0;
+
+	/* Initialize test
+	 */
+	result = mszip_decoder_initialize(
+	          &decoder,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ASSORTED_TEST_ASSERT_IS_NOT_NULL(
+	 "decoder",
+	 decoder );
+
+	ASSORTED_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	uncompressed_data_size = 128;
+
+	result = mszip_decoder_decompress_block(
+	          decoder,
+	          assorted_test_mszip_compressed_block1,
+	          54,
+	          uncompressed_data,
+	          &uncompressed_data_size,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ASSORTED_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_SIZE(
+	 "uncompressed_data_size",
+	 uncompressed_data_size,
+	 (size_t) 50 );
+
+	result = memory_compare(
+	          uncompressed_data,
+	          assorted_test_mszip_uncompressed_block1,
+	          50 );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	/* The second block can only be decompressed with the sliding window
+	 * of the first block
+	 */
+	uncompressed_data_size = 128;
+
+	result = mszip_decoder_decompress_block(
+	          decoder,
+	          assorted_test_mszip_compressed_block2,
+	          33,
+	          uncompressed_data,
+	          &uncompressed_data_size,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ASSORTED_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_SIZE(
+	 "uncompressed_data_size",
+	 uncompressed_data_size,
+	 (size_t) 81 );
+
+	result = memory_compare(
+	          uncompressed_data,
+	          assorted_test_mszip_uncompressed_block2,
+	          81 );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	/* Test error cases
+	 */
+	result = mszip_decoder_reset(
+	          decoder,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ASSORTED_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* The second block without the sliding window of the first block
+	 */
+	uncompressed_data_size = 128;
+
+	result = mszip_decoder_decompress_block(
+	          decoder,
+	          assorted_test_mszip_compressed_block2,
+	          33,
+	          uncompressed_data,
+	          &uncompressed_data_size,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ASSORTED_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = mszip_decoder_reset(
+	          decoder,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ASSORTED_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* An uncompressed data buffer that is too small
+	 */
+	uncompressed_data_size = 32;
+
+	result = mszip_decoder_decompress_block(
+	          decoder,
+	          assorted_test_mszip_compressed_block1,
+	          54,
+	          uncompressed_data,
+	          &uncompressed_data_size,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ASSORTED_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = mszip_decoder_reset(
+	          decoder,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ASSORTED_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* A block without the signature
+	 */
+	uncompressed_data_size = 128;
+
+	result = mszip_decoder_decompress_block(
+	          decoder,
+	          &( assorted_test_mszip_compressed_block1[ 1 ] ),
+	          53,
+	          uncompressed_data,
+	          &uncompressed_data_size,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ASSORTED_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* A truncated block
+	 */
+	uncompressed_data_size = 128;
+
+	result = mszip_decoder_decompress_block(
+	          decoder,
+	          assorted_test_mszip_compressed_block1,
+	          20,
+	          uncompressed_data,
+	          &uncompressed_data_size,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ASSORTED_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = mszip_decoder_decompress_block(
+	          NULL,
+	          assorted_test_mszip_compressed_block1,
+	          54,
+	          uncompressed_data,
+	          &uncompressed_data_size,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ASSORTED_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = mszip_decoder_decompress_block(
+	          decoder,
+	          NULL,
+	          54,
+	          uncompressed_data,
+	          &uncompressed_data_size,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ASSORTED_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = mszip_decoder_decompress_block(
+	          decoder,
+	          assorted_test_mszip_compressed_block1,
+	          1,
+	          uncompressed_data,
+	          &uncompressed_data_size,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ASSORTED_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = mszip_decoder_free(
+	          &decoder,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ASSORTED_TEST_ASSERT_IS_NULL(
+	 "decoder",
+	 decoder );
+
+	ASSORTED_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( decoder != NULL )
+	{
+		mszip_decoder_free(
+		 &decoder,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* The main program
+ */
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+int wmain(
+     int argc ASSORTED_TEST_ATTRIBUTE_UNUSED,
+     wchar_t * const argv[] ASSORTED_TEST_ATTRIBUTE_UNUSED )
+#else
+int main(
+     int argc ASSORTED_TEST_ATTRIBUTE_UNUSED,
+     char * const argv[] ASSORTED_TEST_ATTRIBUTE_UNUSED )
+#endif
+{
+	ASSORTED_TEST_UNREFERENCED_PARAMETER( argc )
+	ASSORTED_TEST_UNREFERENCED_PARAMETER( argv )
+
+	ASSORTED_TEST_RUN(
+	 "mszip_decoder_initialize",
+	 assorted_test_mszip_decoder_initialize );
+
+	/* TODO: add tests for mszip_decoder_free */
+
+	ASSORTED_TEST_RUN(
+	 "mszip_decoder_decompress_block",
+	 assorted_test_mszip_decoder_decompress_block );
+
+	return( EXIT_SUCCESS );
+
+on_error:
+	return( EXIT_FAILURE );
+}
+
@@ -0,0 +1,338 @@
+/*
+ * Windows Prefetch hash functions testing program
+ *
+ * Copyright (C) 2008-2019, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This software is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This software is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this software.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <file_stream.h>
+#include <types.h>
+
+#if defined( HAVE_STDLIB_H ) || defined( WINAPI )
+#include <stdlib.h>
+#endif
+
+#include "assorted_test_libcerror.h"
+#include "assorted_test_macros.h"
+#include "assorted_test_unused.h"
+
+#include "../src/prefetch_hash.h"
+
+typedef int (*assorted_test_prefetch_hash_calculate_function_t)(
+               uint32_t *hash_value,
+               const uint8_t *utf16_stream,
+               size_t utf16_stream_size,
+               libcerror_error_t **error );
+
+/* The upper case paths of the test vectors
+ */
+const char *assorted_test_prefetch_hash_paths[ 3 ] = {
+	"\\DEVICE\\HARDDISKVOLUME1\\WINDOWS\\SYSTEM32\\CMD.EXE",
+	"\\DEVICE\\HARDDISKVOLUME1\\WINDOWS\\SYSTEM32\\NOTEPAD.EXE",
+	"A" };
+
+/* The expected Windows XP hash values of the test vectors
+ */
+uint32_t assorted_test_prefetch_hash_xp_values[ 3 ] = {
+	0x087b4001UL, 0x336351a9UL, 0x158781e7UL };
+
+/* The expected Windows Vista and 2008 hash values of the test vectors
+ */
+uint32_t assorted_test_prefetch_hash_vista_values[ 3 ] = {
+	0x89305d47UL, 0xeb1b961aUL, 0x19a297bcUL };
+
+uint8_t assorted_test_prefetch_hash_utf16_stream[ 256 ];
+
+/* Copies an ASCII path into the UTF-16 little-endian test stream
+ * Returns the size of the UTF-16 stream
+ */
+size_t assorted_test_prefetch_hash_copy_path(
+        const char *path )
+{
+	size_t utf16_stream_index = 0;
+
+	while( *path != 0 )
+	{
+		assorted_test_prefetch_hash_utf16_stream[ utf16_stream_index++ ] = (uint8_t) *path;
+		assorted_test_prefetch_hash_utf16_stream[ utf16_stream_index++ ] = 0;
+
+		path++;
+	}
+	return( utf16_stream_index );
+}
+
+/* Tests a Prefetch hash calculate function
+ * Returns 1 if successful or 0 if not
+ */
+int assorted_test_prefetch_hash_calculate_function(
+     assorted_test_prefetch_hash_calculate_function_t calculate_function,
+     uint32_t *expected_hash_values,
+     uint32_t expected_empty_hash_value )
+{
+	libcerror_error_t *error       = NULL;
+	size_t utf16_stream_size       = 0;
+	uint32_t calculated_hash_value = 0;
+	int path_index                 = 0;
+	int result                     = 0;
+
+	/* Test regular cases
+	 */
+	for( path_index = 0;
+	     path_index < 3;
+	     path_index++ )
+	{
+		utf16_stream_size = assorted_test_prefetch_hash_copy_path(
+		                     assorted_test_prefetch_hash_paths[ path_index ] );
+
+		result = calculate_function(
+		          &calculated_hash_value,
+		          assorted_test_prefetch_hash_utf16_stream,
+		          utf16_stream_size,
+		          &error );
+
+		ASSORTED_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		ASSORTED_TEST_ASSERT_EQUAL_UINT32(
+		 "calculated_hash_value",
+		 calculated_hash_value,
+		 expected_hash_values[ path_index ] );
+
+		ASSORTED_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+	}
+	result = calculate_function(
+	          &calculated_hash_value,
+	          assorted_test_prefetch_hash_utf16_stream,
+	          0,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ASSORTED_TEST_ASSERT_EQUAL_UINT32(
+	 "calculated_hash_value",
+	 calculated_hash_value,
+	 expected_empty_hash_value );
+
+	ASSORTED_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = calculate_function(
+	          NULL,
+	          assorted_test_prefetch_hash_utf16_stream,
+	          utf16_stream_size,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ASSORTED_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = calculate_function(
+	          &calculated_hash_value,
+	          NULL,
+	          utf16_stream_size,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ASSORTED_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = calculate_function(
+	          &calculated_hash_value,
+	          assorted_test_prefetch_hash_utf16_stream,
+	          (size_t) SSIZE_MAX + 1,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ASSORTED_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the prefetch_hash_calculate_xp function
+ * Returns 1 if successful or 0 if not
+ */
+int assorted_test_prefetch_hash_calculate_xp(
+     void )
+{
+	return( assorted_test_prefetch_hash_calculate_function(
+	         prefetch_hash_calculate_xp,
+	         assorted_test_prefetch_hash_xp_values,
+	         0 ) );
+}
+
+/* Tests the prefetch_hash_calculate_vista function
+ * Returns 1 if successful or 0 if not
+ */
+int assorted_test_prefetch_hash_calculate_vista(
+     void )
+{
+	return( assorted_test_prefetch_hash_calculate_function(
+	         prefetch_hash_calculate_vista,
+	         assorted_test_prefetch_hash_vista_values,
+	         0x0004cb2fUL ) );
+}
+
+/* Tests the prefetch_hash_calculate_2008 function
+ * Returns 1 if successful or 0 if not
+ */
+int assorted_test_prefetch_hash_calculate_2008(
+     void )
+{
+	libcerror_error_t *error       = NULL;
+	size_t utf16_stream_index      = 0;
+	size_t utf16_stream_size       = 0;
+	uint32_t calculated_hash_value = 0;
+	uint32_t expected_hash_value   = 0;
+	int result                     = 0;
+
+	result = assorted_test_prefetch_hash_calculate_function(
+	          prefetch_hash_calculate_2008,
+	          assorted_test_prefetch_hash_vista_values,
+	          0x0004cb2fUL );
+
+	if( result != 1 )
+	{
+		goto on_error;
+	}
+	/* Test with all stream sizes up to 64 bytes to cover the blocks
+	 * of 8 bytes and the trailing bytes
+	 */
+	for( utf16_stream_index = 0;
+	     utf16_stream_index < 256;
+	     utf16_stream_index++ )
+	{
+		assorted_test_prefetch_hash_utf16_stream[ utf16_stream_index ] = (uint8_t) ( ( utf16_stream_index * 13 ) + 0x41 );
+	}
+	for( utf16_stream_size = 0;
+	     utf16_stream_size <= 64;
+	     utf16_stream_size++ )
+	{
+		result = prefetch_hash_calculate_vista(
+		          &expected_hash_value,
+		          assorted_test_prefetch_hash_utf16_stream,
+		          utf16_stream_size,
+		          &error );
+
+		ASSORTED_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		result = prefetch_hash_calculate_2008(
+		          &calculated_hash_value,
+		          assorted_test_prefetch_hash_utf16_stream,
+		          utf16_stream_size,
+		          &error );
+
+		ASSORTED_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		ASSORTED_TEST_ASSERT_EQUAL_UINT32(
+		 "calculated_hash_value",
+		 calculated_hash_value,
+		 expected_hash_value );
+	}
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* The main program
+ */
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+int wmain(
+     int argc ASSORTED_TEST_ATTRIBUTE_UNUSED,
+     wchar_t * const argv[] ASSORTED_TEST_ATTRIBUTE_UNUSED )
+#else
+int main(
+     int argc ASSORTED_TEST_ATTRIBUTE_UNUSED,
+     char * const argv[] ASSORTED_TEST_ATTRIBUTE_UNUSED )
+#endif
+{
+	ASSORTED_TEST_UNREFERENCED_PARAMETER( argc )
+	ASSORTED_TEST_UNREFERENCED_PARAMETER( argv )
+
+	ASSORTED_TEST_RUN(
+	 "prefetch_hash_calculate_xp",
+	 assorted_test_prefetch_hash_calculate_xp );
+
+	ASSORTED_TEST_RUN(
+	 "prefetch_hash_calculate_vista",
+	 assorted_test_prefetch_hash_calculate_vista );
+
+	ASSORTED_TEST_RUN(
+	 "prefetch_hash_calculate_2008",
+	 assorted_test_prefetch_hash_calculate_2008 );
+
+	return( EXIT_SUCCESS );
+
+on_error:
+	return( EXIT_FAILURE );
+}
+
@@ -0,0 +1,905 @@
+/*
+ * Serpent functions testing program
+ *
+ * Copyright (C) 2008-2019, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This software is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This software is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this software.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <memory.h>
+#include <file_stream.h>
+#include <types.h>
+
+#if defined( HAVE_STDLIB_H ) || defined( WINAPI )
+#include <stdlib.h>
+#endif
+
+#include "assorted_test_libcerror.h"
+#include "assorted_test_macros.h"
+#include "assorted_test_unused.h"
+
+#include "../src/serpent.h"
+
+typedef int (*assorted_test_serpent_crypt_xts_function_t)(
+               serpent_context_t *context,
+               serpent_context_t *tweak_context,
+               int mode,
+               uint64_t sector_number,
+               size_t sector_size,
+               const uint8_t *input_data,
+               size_t input_data_size,
+               uint8_t *output_data,
+               size_t output_data_size,
+               libcerror_error_t **error );
+
+typedef int (*assorted_test_serpent_crypt_function_t)(
+               serpent_context_t *context,
+               int mode,
+               const uint8_t *input_data,
+               size_t input_data_size,
+               uint8_t *output_data,
+               size_t output_data_size,
+               libcerror_error_t **error );
+
+/* The key of the test vectors: 00 01 02 ... 1f, of which the first 16 or 24 bytes
+ * are used for the 128-bit and 192-bit keys
+ */
+uint8_t assorted_test_serpent_key[ 32 ] = {
+	0x00, 0x01, 0x02, 0x03, 0x04, 0x05, 0x06, 0x07, 0x08, 0x09, 0x0a, 0x0b, 0x0c, 0x0d, 0x0e, 0x0f,
+	0x10, 0x11, 0x12, 0x13, 0x14, 0x15, 0x16, 0x17, 0x18, 0x19, 0x1a, 0x1b, 0x1c, 0x1d, 0x1e, 0x1f };
+
+uint8_t assorted_test_serpent_plaintext[ 16 ] = {
+	0x00, 0x11, 0x22, 0x33, 0x44, 0x55, 0x66, 0x77, 0x88, 0x99, 0xaa, 0xbb, 0xcc, 0xdd, 0xee, 0xff };
+
+/* The ciphertext of the 128-bit, 192-bit and 256-bit keys
+ */
+uint8_t assorted_test_serpent_ciphertext[ 3 ][ 16 ] = {
+	{ 0x56, 0x3e, 0x2c, 0xf8, 0x74, 0x0a, 0x27, 0xc1, 0x64, 0x80, 0x45, 0x60, 0x39, 0x1e, 0x9b, 0x27 },
+	{ 0x6a, 0xb8, 0x16, 0xc8, 0x2d, 0xe5, 0x3b, 0x93, 0x00, 0x50, 0x08, 0xaf, 0xa2, 0x24, 0x6a, 0x02 },
+	{ 0x28, 0x68, 0xb7, 0xa2, 0xd2, 0x8e, 0xcd, 0x5e, 0x4f, 0xde, 0xfa, 0xc3, 0xc4, 0x33, 0x00, 0x74 } };
+
+/* The XTS tweak key: 20 21 22 ... 3f
+ */
+uint8_t assorted_test_serpent_xts_tweak_key[ 32 ] = {
+	0x20, 0x21, 0x22, 0x23, 0x24, 0x25, 0x26, 0x27, 0x28, 0x29, 0x2a, 0x2b, 0x2c, 0x2d, 0x2e, 0x2f,
+	0x30, 0x31, 0x32, 0x33, 0x34, 0x35, 0x36, 0x37, 0x38, 0x39, 0x3a, 0x3b, 0x3c, 0x3d, 0x3e, 0x3f };
+
+/* The XTS ciphertext of 2 sectors of 32 bytes, starting at sector 0x123456789,
+ * with the 256-bit key and tweak key
+ */
+uint8_t assorted_test_serpent_xts_ciphertext[ 64 ] = {
+	0x5b, 0x26, 0x01, 0x07, 0x90, 0x53, 0x7d, 0x50, 0x28, 0x28, 0x7b, 0x66, 0x95, 0xdd, 0xb1, 0x53,
+	0x50, 0x60, 0x7d, 0xc7, 0xa8, 0x30, 0xe9, 0xba, 0x35, 0x74, 0x5e, 0x95, 0x35, 0x44, 0x13, 0x42,
+	0xc2, 0x89, 0x8b, 0x04, 0xd8, 0x83, 0xbf, 0x8b, 0x2a, 0xd0, 0x84, 0xae, 0xcc, 0xcf, 0xd7, 0x6e,
+	0x10, 0x58, 0xf0, 0xc1, 0xd3, 0xb8, 0xf6, 0x5b, 0x44, 0xd8, 0x68, 0x2d, 0x2f, 0x45, 0x31, 0xb0 };
+
+/* Tests a Serpent crypt function against the test vectors and serpent_crypt_ecb_basic
+ * Returns 1 if successful or 0 if not
+ */
+int assorted_test_serpent_crypt_function(
+     assorted_test_serpent_crypt_function_t crypt_function )
+{
+	uint8_t buffer[ 1040 ];
+	uint8_t decrypted_data[ 1040 ];
+	uint8_t encrypted_data[ 1040 ];
+	uint8_t expected_data[ 1040 ];
+
+	libcerror_error_t *error           = NULL;
+	serpent_context_t *serpent_context = NULL;
+	size_t buffer_offset               = 0;
+	size_t buffer_size                 = 0;
+	int key_index                      = 0;
+	int result                         = 0;
+
+	/* Initialize test
+	 */
+	for( buffer_offset = 0;
+	     buffer_offset < 1040;
+	     buffer_offset++ )
+	{
+		buffer[ buffer_offset ] = (uint8_t) ( ( buffer_offset * 7 ) + ( buffer_offset >> 3 ) );
+	}
+	result = serpent_context_initialize(
+	          &serpent_context,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	/* Test the test vectors
+	 */
+	for( key_index = 0;
+	     key_index < 3;
+	     key_index++ )
+	{
+		result = serpent_context_set_key(
+		          serpent_context,
+		          assorted_test_serpent_key,
+		          128 + ( key_index * 64 ),
+		          &error );
+
+		ASSORTED_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		result = crypt_function(
+		          serpent_context,
+		          SERPENT_CRYPT_MODE_ENCRYPT,
+		          assorted_test_serpent_plaintext,
+		          16,
+		          encrypted_data,
+		          16,
+		          &error );
+
+		ASSORTED_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		result = memory_compare(
+		          encrypted_data,
+		          assorted_test_serpent_ciphertext[ key_index ],
+		          16 );
+
+		ASSORTED_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 0 );
+
+		result = crypt_function(
+		          serpent_context,
+		          SERPENT_CRYPT_MODE_DECRYPT,
+		          assorted_test_serpent_ciphertext[ key_index ],
+		          16,
+		          decrypted_data,
+		          16,
+		          &error );
+
+		ASSORTED_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		result = memory_compare(
+		          decrypted_data,
+		          assorted_test_serpent_plaintext,
+		          16 );
+
+		ASSORTED_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 0 );
+	}
+	/* Test regular cases, the sizes cover the multi-block and remaining blocks
+	 */
+	for( buffer_size = 16;
+	     buffer_size <= 1040;
+	     buffer_size += 48 )
+	{
+		result = serpent_crypt_ecb_basic(
+		          serpent_context,
+		          SERPENT_CRYPT_MODE_ENCRYPT,
+		          buffer,
+		          buffer_size,
+		          expected_data,
+		          buffer_size,
+		          &error );
+
+		ASSORTED_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		result = crypt_function(
+		          serpent_context,
+		          SERPENT_CRYPT_MODE_ENCRYPT,
+		          buffer,
+		          buffer_size,
+		          encrypted_data,
+		          buffer_size,
+		          &error );
+
+		ASSORTED_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		result = memory_compare(
+		          encrypted_data,
+		          expected_data,
+		          buffer_size );
+
+		ASSORTED_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 0 );
+
+		result = crypt_function(
+		          serpent_context,
+		          SERPENT_CRYPT_MODE_DECRYPT,
+		          encrypted_data,
+		          buffer_size,
+		          decrypted_data,
+		          buffer_size,
+		          &error );
+
+		ASSORTED_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		result = memory_compare(
+		          decrypted_data,
+		          buffer,
+		          buffer_size );
+
+		ASSORTED_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 0 );
+	}
+	ASSORTED_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = crypt_function(
+	          NULL,
+	          SERPENT_CRYPT_MODE_DECRYPT,
+	          buffer,
+	          1040,
+	          decrypted_data,
+	          1040,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ASSORTED_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = crypt_function(
+	          serpent_context,
+	          -1,
+	          buffer,
+	          1040,
+	          decrypted_data,
+	          1040,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ASSORTED_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = crypt_function(
+	          serpent_context,
+	          SERPENT_CRYPT_MODE_DECRYPT,
+	          buffer,
+	          1039,
+	          decrypted_data,
+	          1040,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ASSORTED_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = crypt_function(
+	          serpent_context,
+	          SERPENT_CRYPT_MODE_DECRYPT,
+	          buffer,
+	          1040,
+	          decrypted_data,
+	          1024,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ASSORTED_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = serpent_context_free(
+	          &serpent_context,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( serpent_context != NULL )
+	{
+		serpent_context_free(
+		 &serpent_context,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests a Serpent XTS crypt function against the test vector and serpent_crypt_xts_basic
+ * Returns 1 if successful or 0 if not
+ */
+int assorted_test_serpent_crypt_xts_function(
+     assorted_test_serpent_crypt_xts_function_t crypt_function )
+{
+	uint8_t buffer[ 4096 ];
+	uint8_t decrypted_data[ 4096 ];
+	uint8_t encrypted_data[ 4096 ];
+	uint8_t expected_data[ 4096 ];
+
+	libcerror_error_t *error           = NULL;
+	serpent_context_t *serpent_context = NULL;
+	serpent_context_t *tweak_context   = NULL;
+	size_t buffer_offset               = 0;
+	size_t sector_size                 = 0;
+	int result                         = 0;
+
+	/* Initialize test
+	 */
+	for( buffer_offset = 0;
+	     buffer_offset < 4096;
+	     buffer_offset++ )
+	{
+		buffer[ buffer_offset ] = (uint8_t) ( ( buffer_offset * 0x11 ) + ( buffer_offset >> 4 ) );
+	}
+	result = serpent_context_initialize(
+	          &serpent_context,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	result = serpent_context_initialize(
+	          &tweak_context,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	result = serpent_context_set_key(
+	          serpent_context,
+	          assorted_test_serpent_key,
+	          256,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	result = serpent_context_set_key(
+	          tweak_context,
+	          assorted_test_serpent_xts_tweak_key,
+	          256,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	/* Test the test vector
+	 */
+	result = crypt_function(
+	          serpent_context,
+	          tweak_context,
+	          SERPENT_CRYPT_MODE_ENCRYPT,
+	          0x123456789ULL,
+	          32,
+	          buffer,
+	          64,
+	          encrypted_data,
+	          64,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	result = memory_compare(
+	          encrypted_data,
+	          assorted_test_serpent_xts_ciphertext,
+	          64 );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	/* Test that a sector can be decrypted on its own
+	 */
+	result = crypt_function(
+	          serpent_context,
+	          tweak_context,
+	          SERPENT_CRYPT_MODE_DECRYPT,
+	          0x12345678aULL,
+	          32,
+	          &( assorted_test_serpent_xts_ciphertext[ 32 ] ),
+	          32,
+	          decrypted_data,
+	          32,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	result = memory_compare(
+	          decrypted_data,
+	          &( buffer[ 32 ] ),
+	          32 );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	/* Test regular cases, the sector sizes cover the multi-block and remaining blocks
+	 */
+	for( sector_size = 16;
+	     sector_size <= 4096;
+	     sector_size *= 2 )
+	{
+		result = serpent_crypt_xts_basic(
+		          serpent_context,
+		          tweak_context,
+		          SERPENT_CRYPT_MODE_ENCRYPT,
+		          7,
+		          sector_size,
+		          buffer,
+		          4096,
+		          expected_data,
+		          4096,
+		          &error );
+
+		ASSORTED_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		result = crypt_function(
+		          serpent_context,
+		          tweak_context,
+		          SERPENT_CRYPT_MODE_ENCRYPT,
+		          7,
+		          sector_size,
+		          buffer,
+		          4096,
+		          encrypted_data,
+		          4096,
+		          &error );
+
+		ASSORTED_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		result = memory_compare(
+		          encrypted_data,
+		          expected_data,
+		          4096 );
+
+		ASSORTED_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 0 );
+
+		result = crypt_function(
+		          serpent_context,
+		          tweak_context,
+		          SERPENT_CRYPT_MODE_DECRYPT,
+		          7,
+		          sector_size,
+		          encrypted_data,
+		          4096,
+		          decrypted_data,
+		          4096,
+		          &error );
+
+		ASSORTED_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		result = memory_compare(
+		          decrypted_data,
+		          buffer,
+		          4096 );
+
+		ASSORTED_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 0 );
+	}
+	ASSORTED_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = crypt_function(
+	          serpent_context,
+	          NULL,
+	          SERPENT_CRYPT_MODE_DECRYPT,
+	          0,
+	          512,
+	          buffer,
+	          4096,
+	          decrypted_data,
+	          4096,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ASSORTED_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = crypt_function(
+	          serpent_context,
+	          tweak_context,
+	          SERPENT_CRYPT_MODE_DECRYPT,
+	          0,
+	          0,
+	          buffer,
+	          4096,
+	          decrypted_data,
+	          4096,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ASSORTED_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = crypt_function(
+	          serpent_context,
+	          tweak_context,
+	          SERPENT_CRYPT_MODE_DECRYPT,
+	          0,
+	          24,
+	          buffer,
+	          4096,
+	          decrypted_data,
+	          4096,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ASSORTED_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = crypt_function(
+	          serpent_context,
+	          tweak_context,
+	          SERPENT_CRYPT_MODE_DECRYPT,
+	          0,
+	          512,
+	          buffer,
+	          4080,
+	          decrypted_data,
+	          4096,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ASSORTED_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = serpent_context_free(
+	          &tweak_context,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	result = serpent_context_free(
+	          &serpent_context,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( tweak_context != NULL )
+	{
+		serpent_context_free(
+		 &tweak_context,
+		 NULL );
+	}
+	if( serpent_context != NULL )
+	{
+		serpent_context_free(
+		 &serpent_context,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the serpent_context_set_key function
+ * Returns 1 if successful or 0 if not
+ */
+int assorted_test_serpent_context_set_key(
+     void )
+{
+	libcerror_error_t *error           = NULL;
+	serpent_context_t *serpent_context = NULL;
+	int result                         = 0;
+
+	result = serpent_context_initialize(
+	          &serpent_context,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	/* Test error cases
+	 */
+	result = serpent_context_set_key(
+	          NULL,
+	          assorted_test_serpent_key,
+	          256,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ASSORTED_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = serpent_context_set_key(
+	          serpent_context,
+	          NULL,
+	          256,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ASSORTED_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = serpent_context_set_key(
+	          serpent_context,
+	          assorted_test_serpent_key,
+	          64,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ASSORTED_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = serpent_context_free(
+	          &serpent_context,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( serpent_context != NULL )
+	{
+		serpent_context_free(
+		 &serpent_context,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the serpent_crypt_ecb_basic function
+ * Returns 1 if successful or 0 if not
+ */
+int assorted_test_serpent_crypt_ecb_basic(
+     void )
+{
+	return( assorted_test_serpent_crypt_function(
+	         serpent_crypt_ecb_basic ) );
+}
+
+/* Tests the serpent_crypt_ecb_simd function
+ * Returns 1 if successful or 0 if not
+ */
+int assorted_test_serpent_crypt_ecb_simd(
+     void )
+{
+	return( assorted_test_serpent_crypt_function(
+	         serpent_crypt_ecb_simd ) );
+}
+
+/* Tests the serpent_crypt_xts_basic function
+ * Returns 1 if successful or 0 if not
+ */
+int assorted_test_serpent_crypt_xts_basic(
+     void )
+{
+	return( assorted_test_serpent_crypt_xts_function(
+	         serpent_crypt_xts_basic ) );
+}
+
+/* Tests the serpent_crypt_xts_simd function
+ * Returns 1 if successful or 0 if not
+ */
+int assorted_test_serpent_crypt_xts_simd(
+     void )
+{
+	return( assorted_test_serpent_crypt_xts_function(
+	         serpent_crypt_xts_simd ) );
+}
+
+/* The main program
+ */
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+int wmain(
+     int argc ASSORTED_TEST_ATTRIBUTE_UNUSED,
+     wchar_t * const argv[] ASSORTED_TEST_ATTRIBUTE_UNUSED )
+#else
+int main(
+     int argc ASSORTED_TEST_ATTRIBUTE_UNUSED,
+     char * const argv[] ASSORTED_TEST_ATTRIBUTE_UNUSED )
+#endif
+{
+	ASSORTED_TEST_UNREFERENCED_PARAMETER( argc )
+	ASSORTED_TEST_UNREFERENCED_PARAMETER( argv )
+
+	ASSORTED_TEST_RUN(
+	 "serpent_context_set_key",
+	 assorted_test_serpent_context_set_key );
+
+	ASSORTED_TEST_RUN(
+	 "serpent_crypt_ecb_basic",
+	 assorted_test_serpent_crypt_ecb_basic );
+
+	ASSORTED_TEST_RUN(
+	 "serpent_crypt_ecb_simd",
+	 assorted_test_serpent_crypt_ecb_simd );
+
+	ASSORTED_TEST_RUN(
+	 "serpent_crypt_xts_basic",
+	 assorted_test_serpent_crypt_xts_basic );
+
+	ASSORTED_TEST_RUN(
+	 "serpent_crypt_xts_simd",
+	 assorted_test_serpent_crypt_xts_simd );
+
+	return( EXIT_SUCCESS );
+
+on_error:
+	return( EXIT_FAILURE );
+}
+
@@ -0,0 +1,683 @@
+/*
+ * SQLite write-ahead log (WAL) functions testing program
+ *
+ * Copyright (C) 2008-2019, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This software is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This software is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this software.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <file_stream.h>
+#include <memory.h>
+#include <types.h>
+
+#if defined( HAVE_STDLIB_H ) || defined( WINAPI )
+#include <stdlib.h>
+#endif
+
+#include "assorted_test_libcerror.h"
+#include "assorted_test_macros.h"
+#include "assorted_test_unused.h"
+#include "../src/sqlite_wal.h"
+
+/* The file header and first frame header of a WAL file with a page size of 4096
+ */
+uint8_t assorted_test_sqlite_wal_data[ 56 ] = {
+	0x37, 0x7f, 0x06, 0x82, 0x00, 0x2d, 0xe2, 0x18, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0xe9, 0xa9, 0x60, 0xa1, 0xbf, 0x50, 0x92, 0xa2, 0x76, 0x47, 0xac, 0xfc, 0xd0, 0xc1, 0xd5, 0x60,
+	0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0xe9, 0xa9, 0x60, 0xa1, 0xbf, 0x50, 0x92, 0xa2,
+	0xda, 0xfd, 0x81, 0x3b, 0x5d, 0x8b, 0x19, 0x23 };
+
+/* Tests the sqlite_wal_checksum_calculate function
+ * Returns 1 if successful or 0 if not
+ */
+int assorted_test_sqlite_wal_checksum_calculate(
+     void )
+{
+	uint8_t data[ 16 ] = {
+		0x01, 0x02, 0x03, 0x04, 0x05, 0x06, 0x07, 0x08, 0x09, 0x0a, 0x0b, 0x0c, 0x0d, 0x0e, 0x0f, 0x10 };
+
+	libcerror_error_t *error = NULL;
+	uint32_t checksum1       = 0;
+	uint32_t checksum2       = 0;
+	int result               = 0;
+
+	/* Test regular cases
+	 */
+	result = sqlite_wal_checksum_calculate(
+	          &checksum1,
+	          &checksum2,
+	          data,
+	          16,
+	          SQLITE_WAL_BYTE_ORDER_LITTLE_ENDIAN,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ASSORTED_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_UINT32(
+	 "checksum1",
+	 checksum1,
+	 (uint32_t) 0x1c181410UL );
+
+	ASSORTED_TEST_ASSERT_EQUAL_UINT32(
+	 "checksum2",
+	 checksum2,
+	 (uint32_t) 0x38312a23UL );
+
+	checksum1 = 0;
+	checksum2 = 0;
+
+	result = sqlite_wal_checksum_calculate(
+	          &checksum1,
+	          &checksum2,
+	          data,
+	          16,
+	          SQLITE_WAL_BYTE_ORDER_BIG_ENDIAN,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ASSORTED_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_UINT32(
+	 "checksum1",
+	 checksum1,
+	 (uint32_t) 0x1014181cUL );
+
+	ASSORTED_TEST_ASSERT_EQUAL_UINT32(
+	 "checksum2",
+	 checksum2,
+	 (uint32_t) 0x232a3138UL );
+
+	/* The checksum is cumulative
+	 */
+	checksum1 = 0;
+	checksum2 = 0;
+
+	result = sqlite_wal_checksum_calculate(
+	          &checksum1,
+	          &checksum2,
+	          data,
+	          8,
+	          SQLITE_WAL_BYTE_ORDER_BIG_ENDIAN,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	result = sqlite_wal_checksum_calculate(
+	          &checksum1,
+	          &checksum2,
+	          &( data[ 8 ] ),
+	          8,
+	          SQLITE_WAL_BYTE_ORDER_BIG_ENDIAN,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ASSORTED_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_UINT32(
+	 "checksum1",
+	 checksum1,
+	 (uint32_t) 0x1014181cUL );
+
+	ASSORTED_TEST_ASSERT_EQUAL_UINT32(
+	 "checksum2",
+	 checksum2,
+	 (uint32_t) 0x232a3138UL );
+
+	/* Test error cases
+	 */
+	result = sqlite_wal_checksum_calculate(
+	          NULL,
+	          &checksum2,
+	          data,
+	          16,
+	          SQLITE_WAL_BYTE_ORDER_BIG_ENDIAN,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ASSORTED_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = sqlite_wal_checksum_calculate(
+	          &checksum1,
+	          &checksum2,
+	          NULL,
+	          16,
+	          SQLITE_WAL_BYTE_ORDER_BIG_ENDIAN,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ASSORTED_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = sqlite_wal_checksum_calculate(
+	          &checksum1,
+	          &checksum2,
+	          data,
+	          12,
+	          SQLITE_WAL_BYTE_ORDER_BIG_ENDIAN,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ASSORTED_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the sqlite_wal_checksum_calculate_simd function
+ * Returns 1 if successful or 0 if not
+ */
+int assorted_test_sqlite_wal_checksum_calculate_simd(
+     void )
+{
+	uint8_t data[ 1032 ];
+
+	libcerror_error_t *error = NULL;
+	size_t data_offset       = 0;
+	size_t data_size         = 0;
+	uint32_t checksum1       = 0;
+	uint32_t checksum2       = 0;
+	uint32_t simd_checksum1  = 0;
+	uint32_t simd_checksum2  = 0;
+	uint8_t byte_order       = 0;
+	int result               = 0;
+
+	for( data_offset = 0;
+	     data_offset < 1032;
+	     data_offset++ )
+	{
+		data[ data_offset ] = (uint8_t) ( ( data_offset * 37 ) + ( data_offset >> 5 ) );
+	}
+	/* Test regular cases, the SIMD variant must match the basic variant
+	 * for sizes that are handled partially and entirely by the vectorized code
+	 */
+	for( byte_order = SQLITE_WAL_BYTE_ORDER_LITTLE_ENDIAN;
+	     byte_order <= SQLITE_WAL_BYTE_ORDER_BIG_ENDIAN;
+	     byte_order++ )
+	{
+		for( data_size = 0;
+		     data_size <= 1032;
+		     data_size += 8 )
+		{
+			checksum1      = 0x12345678UL;
+			checksum2      = 0x9abcdef0UL;
+			simd_checksum1 = 0x12345678UL;
+			simd_checksum2 = 0x9abcdef0UL;
+
+			result = sqlite_wal_checksum_calculate(
+			          &checksum1,
+			          &checksum2,
+			          data,
+			          data_size,
+			          byte_order,
+			          &error );
+
+			ASSORTED_TEST_ASSERT_EQUAL_INT(
+			 "result",
+			 result,
+			 1 );
+
+			result = sqlite_wal_checksum_calculate_simd(
+			          &simd_checksum1,
+			          &simd_checksum2,
+			          data,
+			          data_size,
+			          byte_order,
+			          &error );
+
+			ASSORTED_TEST_ASSERT_EQUAL_INT(
+			 "result",
+			 result,
+			 1 );
+
+			ASSORTED_TEST_ASSERT_IS_NULL(
+			 "error",
+			 error );
+
+			ASSORTED_TEST_ASSERT_EQUAL_UINT32(
+			 "simd_checksum1",
+			 simd_checksum1,
+			 checksum1 );
+
+			ASSORTED_TEST_ASSERT_EQUAL_UINT32(
+			 "simd_checksum2",
+			 simd_checksum2,
+			 checksum2 );
+		}
+	}
+	/* Test error cases
+	 */
+	result = sqlite_wal_checksum_calculate_simd(
+	          &simd_checksum1,
+	          &simd_checksum2,
+	          NULL,
+	          1032,
+	          SQLITE_WAL_BYTE_ORDER_BIG_ENDIAN,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ASSORTED_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = sqlite_wal_checksum_calculate_simd(
+	          &simd_checksum1,
+	          &simd_checksum2,
+	          data,
+	          1028,
+	          SQLITE_WAL_BYTE_ORDER_BIG_ENDIAN,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ASSORTED_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the sqlite_wal_read_file_header function
+ * Returns 1 if successful or 0 if not
+ */
+int assorted_test_sqlite_wal_read_file_header(
+     void )
+{
+	uint8_t header_data[ 32 ];
+
+	sqlite_wal_file_header_t file_header;
+
+	libcerror_error_t *error = NULL;
+	int result               = 0;
+
+	/* Test regular cases
+	 */
+	result = sqlite_wal_read_file_header(
+	          &file_header,
+	          assorted_test_sqlite_wal_data,
+	          56,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ASSORTED_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_UINT8(
+	 "file_header.byte_order",
+	 file_header.byte_order,
+	 (uint8_t) SQLITE_WAL_BYTE_ORDER_LITTLE_ENDIAN );
+
+	ASSORTED_TEST_ASSERT_EQUAL_UINT32(
+	 "file_header.format_version",
+	 file_header.format_version,
+	 (uint32_t) 3007000UL );
+
+	ASSORTED_TEST_ASSERT_EQUAL_UINT32(
+	 "file_header.page_size",
+	 file_header.page_size,
+	 (uint32_t) 4096 );
+
+	ASSORTED_TEST_ASSERT_EQUAL_UINT32(
+	 "file_header.salt1",
+	 file_header.salt1,
+	 (uint32_t) 0xe9a960a1UL );
+
+	ASSORTED_TEST_ASSERT_EQUAL_UINT32(
+	 "file_header.salt2",
+	 file_header.salt2,
+	 (uint32_t) 0xbf5092a2UL );
+
+	/* Test data with a checksum mismatch
+	 */
+	if( memory_copy(
+	     header_data,
+	     assorted_test_sqlite_wal_data,
+	     32 ) == NULL )
+	{
+		goto on_error;
+	}
+	header_data[ 31 ] ^= 0x01;
+
+	result = sqlite_wal_read_file_header(
+	          &file_header,
+	          header_data,
+	          32,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	ASSORTED_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = sqlite_wal_read_file_header(
+	          NULL,
+	          assorted_test_sqlite_wal_data,
+	          56,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ASSORTED_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = sqlite_wal_read_file_header(
+	          &file_header,
+	          assorted_test_sqlite_wal_data,
+	          SQLITE_WAL_FILE_HEADER_SIZE - 1,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ASSORTED_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Test data with an invalid signature
+	 */
+	header_data[ 31 ] ^= 0x01;
+	header_data[ 0 ]   = 'X';
+
+	result = sqlite_wal_read_file_header(
+	          &file_header,
+	          header_data,
+	          32,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ASSORTED_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Test data with an unsupported page size
+	 */
+	header_data[ 0 ]  = 0x37;
+	header_data[ 10 ] = 0x30;
+
+	result = sqlite_wal_read_file_header(
+	          &file_header,
+	          header_data,
+	          32,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ASSORTED_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the sqlite_wal_frame_read_header function
+ * Returns 1 if successful or 0 if not
+ */
+int assorted_test_sqlite_wal_frame_read_header(
+     void )
+{
+	sqlite_wal_frame_header_t frame_header;
+
+	libcerror_error_t *error = NULL;
+	int result               = 0;
+
+	/* Test regular cases
+	 */
+	result = sqlite_wal_frame_read_header(
+	          &frame_header,
+	          &( assorted_test_sqlite_wal_data[ 32 ] ),
+	          24,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ASSORTED_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_UINT32(
+	 "frame_header.page_number",
+	 frame_header.page_number,
+	 (uint32_t) 1 );
+
+	ASSORTED_TEST_ASSERT_EQUAL_UINT32(
+	 "frame_header.database_size",
+	 frame_header.database_size,
+	 (uint32_t) 0 );
+
+	ASSORTED_TEST_ASSERT_EQUAL_UINT32(
+	 "frame_header.salt1",
+	 frame_header.salt1,
+	 (uint32_t) 0xe9a960a1UL );
+
+	ASSORTED_TEST_ASSERT_EQUAL_UINT32(
+	 "frame_header.checksum1",
+	 frame_header.checksum1,
+	 (uint32_t) 0xdafd813bUL );
+
+	ASSORTED_TEST_ASSERT_EQUAL_UINT32(
+	 "frame_header.checksum2",
+	 frame_header.checksum2,
+	 (uint32_t) 0x5d8b1923UL );
+
+	/* Test error cases
+	 */
+	result = sqlite_wal_frame_read_header(
+	          NULL,
+	          &( assorted_test_sqlite_wal_data[ 32 ] ),
+	          24,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ASSORTED_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = sqlite_wal_frame_read_header(
+	          &frame_header,
+	          &( assorted_test_sqlite_wal_data[ 32 ] ),
+	          SQLITE_WAL_FRAME_HEADER_SIZE - 1,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ASSORTED_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* The main program
+ */
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+int wmain(
+     int argc ASSORTED_TEST_ATTRIBUTE_UNUSED,
+     wchar_t * const argv[] ASSORTED_TEST_ATTRIBUTE_UNUSED )
+#else
+int main(
+     int argc ASSORTED_TEST_ATTRIBUTE_UNUSED,
+     char * const argv[] ASSORTED_TEST_ATTRIBUTE_UNUSED )
+#endif
+{
+	ASSORTED_TEST_UNREFERENCED_PARAMETER( argc )
+	ASSORTED_TEST_UNREFERENCED_PARAMETER( argv )
+
+	ASSORTED_TEST_RUN(
+	 "sqlite_wal_checksum_calculate",
+	 assorted_test_sqlite_wal_checksum_calculate );
+
+	ASSORTED_TEST_RUN(
+	 "sqlite_wal_checksum_calculate_simd",
+	 assorted_test_sqlite_wal_checksum_calculate_simd );
+
+	ASSORTED_TEST_RUN(
+	 "sqlite_wal_read_file_header",
+	 assorted_test_sqlite_wal_read_file_header );
+
+	ASSORTED_TEST_RUN(
+	 "sqlite_wal_frame_read_header",
+	 assorted_test_sqlite_wal_frame_read_header );
+
+	return( EXIT_SUCCESS );
+
+on_error:
+	return( EXIT_FAILURE );
+}
+
@@ -0,0 +1,469 @@
+/*
+ * Unicode case folding and normalization functions testing program
+ *
+ * Copyright (C) 2008-2019, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This software is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This software is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this software.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <file_stream.h>
+#include <types.h>
+
+#if defined( HAVE_STDLIB_H ) || defined( WINAPI )
+#include <stdlib.h>
+#endif
+
+#include "assorted_test_libcerror.h"
+#include "assorted_test_macros.h"
+#include "assorted_test_unused.h"
+
+#include "../src/unicode.h"
+
+/* Tests the unicode_get_case_folded_character function
+ * Returns 1 if successful or 0 if not
+ */
+int assorted_test_unicode_get_case_folded_character(
+     void )
+{
+	uint32_t case_folded_character = 0;
+
+	/* Test regular cases
+	 */
+	case_folded_character = unicode_get_case_folded_character(
+	                         0x00000041UL );
+
+	ASSORTED_TEST_ASSERT_EQUAL_UINT32(
+	 "case_folded_character",
+	 case_folded_character,
+	 (uint32_t) 0x00000061UL );
+
+	case_folded_character = unicode_get_case_folded_character(
+	                         0x00000061UL );
+
+	ASSORTED_TEST_ASSERT_EQUAL_UINT32(
+	 "case_folded_character",
+	 case_folded_character,
+	 (uint32_t) 0x00000061UL );
+
+	case_folded_character = unicode_get_case_folded_character(
+	                         0x000000c0UL );
+
+	ASSORTED_TEST_ASSERT_EQUAL_UINT32(
+	 "case_folded_character",
+	 case_folded_character,
+	 (uint32_t) 0x000000e0UL );
+
+	/* LATIN CAPITAL LETTER SHARP S has a simple case folding
+	 */
+	case_folded_character = unicode_get_case_folded_character(
+	                         0x00001e9eUL );
+
+	ASSORTED_TEST_ASSERT_EQUAL_UINT32(
+	 "case_folded_character",
+	 case_folded_character,
+	 (uint32_t) 0x000000dfUL );
+
+	/* LATIN SMALL LETTER SHARP S only has a full case folding
+	 */
+	case_folded_character = unicode_get_case_folded_character(
+	                         0x000000dfUL );
+
+	ASSORTED_TEST_ASSERT_EQUAL_UINT32(
+	 "case_folded_character",
+	 case_folded_character,
+	 (uint32_t) 0x000000dfUL );
+
+	case_folded_character = unicode_get_case_folded_character(
+	                         0x0000a7aeUL );
+
+	ASSORTED_TEST_ASSERT_EQUAL_UINT32(
+	 "case_folded_character",
+	 case_folded_character,
+	 (uint32_t) 0x0000026aUL );
+
+	case_folded_character = unicode_get_case_folded_character(
+	                         0x00010400UL );
+
+	ASSORTED_TEST_ASSERT_EQUAL_UINT32(
+	 "case_folded_character",
+	 case_folded_character,
+	 (uint32_t) 0x00010428UL );
+
+	/* Test characters beyond the last page of the tables
+	 */
+	case_folded_character = unicode_get_case_folded_character(
+	                         0x0010ffffUL );
+
+	ASSORTED_TEST_ASSERT_EQUAL_UINT32(
+	 "case_folded_character",
+	 case_folded_character,
+	 (uint32_t) 0x0010ffffUL );
+
+	case_folded_character = unicode_get_case_folded_character(
+	                         0xffffffffUL );
+
+	ASSORTED_TEST_ASSERT_EQUAL_UINT32(
+	 "case_folded_character",
+	 case_folded_character,
+	 (uint32_t) 0xffffffffUL );
+
+	return( 1 );
+
+on_error:
+	return( 0 );
+}
+
+/* Tests the unicode_get_nfd_decomposition function
+ * Returns 1 if successful or 0 if not
+ */
+int assorted_test_unicode_get_nfd_decomposition(
+     void )
+{
+	uint32_t decomposition[ UNICODE_NFD_MAXIMUM_DECOMPOSITION_LENGTH ];
+
+	libcerror_error_t *error    = NULL;
+	size_t decomposition_length = 0;
+	int result                  = 0;
+
+	/* Test regular cases
+	 */
+	result = unicode_get_nfd_decomposition(
+	          0x00000041UL,
+	          decomposition,
+	          UNICODE_NFD_MAXIMUM_DECOMPOSITION_LENGTH,
+	          &decomposition_length,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	ASSORTED_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = unicode_get_nfd_decomposition(
+	          0x000000c5UL,
+	          decomposition,
+	          UNICODE_NFD_MAXIMUM_DECOMPOSITION_LENGTH,
+	          &decomposition_length,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ASSORTED_TEST_ASSERT_EQUAL_SIZE(
+	 "decomposition_length",
+	 decomposition_length,
+	 (size_t) 2 );
+
+	ASSORTED_TEST_ASSERT_EQUAL_UINT32(
+	 "decomposition[ 0 ]",
+	 decomposition[ 0 ],
+	 (uint32_t) 0x00000041UL );
+
+	ASSORTED_TEST_ASSERT_EQUAL_UINT32(
+	 "decomposition[ 1 ]",
+	 decomposition[ 1 ],
+	 (uint32_t) 0x0000030aUL );
+
+	ASSORTED_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* ANGSTROM SIGN decomposes recursively
+	 */
+	result = unicode_get_nfd_decomposition(
+	          0x0000212bUL,
+	          decomposition,
+	          UNICODE_NFD_MAXIMUM_DECOMPOSITION_LENGTH,
+	          &decomposition_length,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ASSORTED_TEST_ASSERT_EQUAL_SIZE(
+	 "decomposition_length",
+	 decomposition_length,
+	 (size_t) 2 );
+
+	ASSORTED_TEST_ASSERT_EQUAL_UINT32(
+	 "decomposition[ 0 ]",
+	 decomposition[ 0 ],
+	 (uint32_t) 0x00000041UL );
+
+	ASSORTED_TEST_ASSERT_EQUAL_UINT32(
+	 "decomposition[ 1 ]",
+	 decomposition[ 1 ],
+	 (uint32_t) 0x0000030aUL );
+
+	ASSORTED_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = unicode_get_nfd_decomposition(
+	          0x00001f82UL,
+	          decomposition,
+	          UNICODE_NFD_MAXIMUM_DECOMPOSITION_LENGTH,
+	          &decomposition_length,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ASSORTED_TEST_ASSERT_EQUAL_SIZE(
+	 "decomposition_length",
+	 decomposition_length,
+	 (size_t) 4 );
+
+	ASSORTED_TEST_ASSERT_EQUAL_UINT32(
+	 "decomposition[ 0 ]",
+	 decomposition[ 0 ],
+	 (uint32_t) 0x000003b1UL );
+
+	ASSORTED_TEST_ASSERT_EQUAL_UINT32(
+	 "decomposition[ 1 ]",
+	 decomposition[ 1 ],
+	 (uint32_t) 0x00000313UL );
+
+	ASSORTED_TEST_ASSERT_EQUAL_UINT32(
+	 "decomposition[ 2 ]",
+	 decomposition[ 2 ],
+	 (uint32_t) 0x00000300UL );
+
+	ASSORTED_TEST_ASSERT_EQUAL_UINT32(
+	 "decomposition[ 3 ]",
+	 decomposition[ 3 ],
+	 (uint32_t) 0x00000345UL );
+
+	ASSORTED_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test the algorithmic decomposition of Hangul syllables
+	 */
+	result = unicode_get_nfd_decomposition(
+	          0x0000ac00UL,
+	          decomposition,
+	          UNICODE_NFD_MAXIMUM_DECOMPOSITION_LENGTH,
+	          &decomposition_length,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ASSORTED_TEST_ASSERT_EQUAL_SIZE(
+	 "decomposition_length",
+	 decomposition_length,
+	 (size_t) 2 );
+
+	ASSORTED_TEST_ASSERT_EQUAL_UINT32(
+	 "decomposition[ 0 ]",
+	 decomposition[ 0 ],
+	 (uint32_t) 0x00001100UL );
+
+	ASSORTED_TEST_ASSERT_EQUAL_UINT32(
+	 "decomposition[ 1 ]",
+	 decomposition[ 1 ],
+	 (uint32_t) 0x00001161UL );
+
+	ASSORTED_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = unicode_get_nfd_decomposition(
+	          0x0000d7a3UL,
+	          decomposition,
+	          UNICODE_NFD_MAXIMUM_DECOMPOSITION_LENGTH,
+	          &decomposition_length,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ASSORTED_TEST_ASSERT_EQUAL_SIZE(
+	 "decomposition_length",
+	 decomposition_length,
+	 (size_t) 3 );
+
+	ASSORTED_TEST_ASSERT_EQUAL_UINT32(
+	 "decomposition[ 0 ]",
+	 decomposition[ 0 ],
+	 (uint32_t) 0x00001112UL );
+
+	ASSORTED_TEST_ASSERT_EQUAL_UINT32(
+	 "decomposition[ 1 ]",
+	 decomposition[ 1 ],
+	 (uint32_t) 0x00001175UL );
+
+	ASSORTED_TEST_ASSERT_EQUAL_UINT32(
+	 "decomposition[ 2 ]",
+	 decomposition[ 2 ],
+	 (uint32_t) 0x000011c2UL );
+
+	ASSORTED_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test characters beyond the last page of the tables
+	 */
+	result = unicode_get_nfd_decomposition(
+	          0x0010ffffUL,
+	          decomposition,
+	          UNICODE_NFD_MAXIMUM_DECOMPOSITION_LENGTH,
+	          &decomposition_length,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	ASSORTED_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = unicode_get_nfd_decomposition(
+	          0x000000c5UL,
+	          NULL,
+	          UNICODE_NFD_MAXIMUM_DECOMPOSITION_LENGTH,
+	          &decomposition_length,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ASSORTED_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = unicode_get_nfd_decomposition(
+	          0x000000c5UL,
+	          decomposition,
+	          1,
+	          &decomposition_length,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ASSORTED_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = unicode_get_nfd_decomposition(
+	          0x0000ac00UL,
+	          decomposition,
+	          1,
+	          &decomposition_length,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ASSORTED_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = unicode_get_nfd_decomposition(
+	          0x000000c5UL,
+	          decomposition,
+	          UNICODE_NFD_MAXIMUM_DECOMPOSITION_LENGTH,
+	          NULL,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ASSORTED_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* The main program
+ */
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+int wmain(
+     int argc ASSORTED_TEST_ATTRIBUTE_UNUSED,
+     wchar_t * const argv[] ASSORTED_TEST_ATTRIBUTE_UNUSED )
+#else
+int main(
+     int argc ASSORTED_TEST_ATTRIBUTE_UNUSED,
+     char * const argv[] ASSORTED_TEST_ATTRIBUTE_UNUSED )
+#endif
+{
+	ASSORTED_TEST_UNREFERENCED_PARAMETER( argc )
+	ASSORTED_TEST_UNREFERENCED_PARAMETER( argv )
+
+	ASSORTED_TEST_RUN(
+	 "unicode_get_case_folded_character",
+	 assorted_test_unicode_get_case_folded_character );
+
+	ASSORTED_TEST_RUN(
+	 "unicode_get_nfd_decomposition",
+	 assorted_test_unicode_get_nfd_decomposition );
+
+	return( EXIT_SUCCESS );
+
+on_error:
+	return( EXIT_FAILURE );
+}
+
@@ -0,0 +1,332 @@
+/*
+ * XOR-64 functions testing program
+ *
+ * Copyright (C) 2008-2019, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This software is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This software is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this software.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <file_stream.h>
+#include <types.h>
+
+#if defined( HAVE_STDLIB_H ) || defined( WINAPI )
+#include <stdlib.h>
+#endif
+
+#include "assorted_test_libcerror.h"
+#include "assorted_test_macros.h"
+#include "assorted_test_unused.h"
+
+#include "../src/xor64.h"
+
+typedef int (*assorted_test_xor64_calculate_function_t)(
+               uint64_t *checksum_value,
+               const uint8_t *buffer,
+               size_t size,
+               uint64_t initial_value,
+               libcerror_error_t **error );
+
+/* The check string used by the checksum catalogues
+ */
+uint8_t assorted_test_xor64_check_data[ 9 ] = {
+	'1', '2', '3', '4', '5', '6', '7', '8', '9' };
+
+/* Buffer larger than 3 blocks of the widest SIMD variant of 256 bytes
+ * with a tail, from every offset relative to a 64-byte boundary
+ */
+uint8_t assorted_test_xor64_data[ 64 + 63 + 831 ];
+
+/* Tests a XOR-64 calculate function
+ * Returns 1 if successful or 0 if not
+ */
+int assorted_test_xor64_calculate_function(
+     assorted_test_xor64_calculate_function_t calculate_function )
+{
+	libcerror_error_t *error     = NULL;
+	uint8_t *aligned_data        = NULL;
+	size_t buffer_offset         = 0;
+	size_t buffer_size           = 0;
+	uint64_t calculated_checksum = 0;
+	uint64_t expected_checksum   = 0;
+	int result                   = 0;
+
+	/* Initialize test
+	 */
+	for( buffer_offset = 0;
+	     buffer_offset < ( 64 + 63 + 831 );
+	     buffer_offset++ )
+	{
+		assorted_test_xor64_data[ buffer_offset ] = (uint8_t) ( ( buffer_offset * 7 ) + ( buffer_offset >> 3 ) );
+	}
+	aligned_data = &( assorted_test_xor64_data[ ( 64 - ( (intptr_t) assorted_test_xor64_data % 64 ) ) % 64 ] );
+
+	/* Test regular cases
+	 */
+	result = calculate_function(
+	          &calculated_checksum,
+	          assorted_test_xor64_check_data,
+	          9,
+	          0,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ASSORTED_TEST_ASSERT_EQUAL_UINT64(
+	 "calculated_checksum",
+	 calculated_checksum,
+	 (uint64_t) 0x3837363534333208ULL );
+
+	ASSORTED_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test with all buffer sizes up to 3 blocks of 256 bytes and a tail from every
+	 * offset relative to a 64-byte boundary to cover the SIMD blocks, the aligned
+	 * values and the trailing bytes
+	 */
+	for( buffer_size = 0;
+	     buffer_size <= 831;
+	     buffer_size++ )
+	{
+		for( buffer_offset = 0;
+		     buffer_offset < 64;
+		     buffer_offset++ )
+		{
+			result = checksum_calculate_little_endian_xor64_basic(
+			          &expected_checksum,
+			          &( aligned_data[ buffer_offset ] ),
+			          buffer_size,
+			          0x123456789abcdef0ULL,
+			          &error );
+
+			ASSORTED_TEST_ASSERT_EQUAL_INT(
+			 "result",
+			 result,
+			 1 );
+
+			result = calculate_function(
+			          &calculated_checksum,
+			          &( aligned_data[ buffer_offset ] ),
+			          buffer_size,
+			          0x123456789abcdef0ULL,
+			          &error );
+
+			ASSORTED_TEST_ASSERT_EQUAL_INT(
+			 "result",
+			 result,
+			 1 );
+
+			ASSORTED_TEST_ASSERT_EQUAL_UINT64(
+			 "calculated_checksum",
+			 calculated_checksum,
+			 expected_checksum );
+		}
+	}
+	ASSORTED_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = calculate_function(
+	          NULL,
+	          assorted_test_xor64_data,
+	          831,
+	          0,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ASSORTED_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = calculate_function(
+	          &calculated_checksum,
+	          NULL,
+	          831,
+	          0,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ASSORTED_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = calculate_function(
+	          &calculated_checksum,
+	          assorted_test_xor64_data,
+	          (size_t) SSIZE_MAX + 1,
+	          0,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ASSORTED_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the checksum_calculate_little_endian_xor64_basic function
+ * Returns 1 if successful or 0 if not
+ */
+int assorted_test_xor64_calculate_basic(
+     void )
+{
+	libcerror_error_t *error     = NULL;
+	uint64_t calculated_checksum = 0;
+	int result                   = 0;
+
+	/* Test regular cases
+	 */
+	result = checksum_calculate_little_endian_xor64_basic(
+	          &calculated_checksum,
+	          assorted_test_xor64_check_data,
+	          9,
+	          0,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ASSORTED_TEST_ASSERT_EQUAL_UINT64(
+	 "calculated_checksum",
+	 calculated_checksum,
+	 (uint64_t) 0x3837363534333208ULL );
+
+	ASSORTED_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = checksum_calculate_little_endian_xor64_basic(
+	          &calculated_checksum,
+	          assorted_test_xor64_check_data,
+	          9,
+	          0x3837363534333208ULL,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ASSORTED_TEST_ASSERT_EQUAL_UINT64(
+	 "calculated_checksum",
+	 calculated_checksum,
+	 (uint64_t) 0 );
+
+	ASSORTED_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the checksum_calculate_little_endian_xor64_cpu_aligned function
+ * Returns 1 if successful or 0 if not
+ */
+int assorted_test_xor64_calculate_cpu_aligned(
+     void )
+{
+	return( assorted_test_xor64_calculate_function(
+	         checksum_calculate_little_endian_xor64_cpu_aligned ) );
+}
+
+/* Tests the checksum_calculate_little_endian_xor64_simd function
+ * Returns 1 if successful or 0 if not
+ */
+int assorted_test_xor64_calculate_simd(
+     void )
+{
+	return( assorted_test_xor64_calculate_function(
+	         checksum_calculate_little_endian_xor64_simd ) );
+}
+
+/* The main program
+ */
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+int wmain(
+     int argc ASSORTED_TEST_ATTRIBUTE_UNUSED,
+     wchar_t * const argv[] ASSORTED_TEST_ATTRIBUTE_UNUSED )
+#else
+int main(
+     int argc ASSORTED_TEST_ATTRIBUTE_UNUSED,
+     char * const argv[] ASSORTED_TEST_ATTRIBUTE_UNUSED )
+#endif
+{
+	ASSORTED_TEST_UNREFERENCED_PARAMETER( argc )
+	ASSORTED_TEST_UNREFERENCED_PARAMETER( argv )
+
+	ASSORTED_TEST_RUN(
+	 "checksum_calculate_little_endian_xor64_basic",
+	 assorted_test_xor64_calculate_basic );
+
+	ASSORTED_TEST_RUN(
+	 "checksum_calculate_little_endian_xor64_cpu_aligned",
+	 assorted_test_xor64_calculate_cpu_aligned );
+
+	ASSORTED_TEST_RUN(
+	 "checksum_calculate_little_endian_xor64_simd",
+	 assorted_test_xor64_calculate_simd );
+
+	return( EXIT_SUCCESS );
+
+on_error:
+	return( EXIT_FAILURE );
+}
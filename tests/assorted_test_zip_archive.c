@@ -0,0 +1,1081 @@
+/*
+ * ZIP archive functions testing program
+ *
+ * Copyright (C) 2008-2019, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This software is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This software is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this software.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <file_stream.h>
+#include <memory.h>
+#include <types.h>
+
+#if defined( HAVE_STDLIB_H ) || defined( WINAPI )
+#include <stdlib.h>
+#endif
+
+#include "assorted_test_libcerror.h"
+#include "assorted_test_macros.h"
+#include "assorted_test_unused.h"
+
+#include "../src/zip_archive.h"
+
+/* A ZIP archive with a stored member of 17 bytes at offset 0, a deflate compressed
+ * member of 232 bytes at offset 57 and the central directory at offset 132
+ */
+uint8_t assorted_test_zip_archive_data[ 267 ] = {
+	0x50, 0x4b, 0x03, 0x04, 0x14, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x21, 0x4e, 0xe9, 0x15,
+	0x78, 0xa8, 0x11, 0x00, 0x00, 0x00, 0x11, 0x00, 0x00, 0x00, 0x0a, 0x00, 0x00, 0x00, 0x73, 0x74,
+	0x6f, 0x72, 0x65, 0x64, 0x2e, 0x74, 0x78, 0x74, 0x5a, 0x49, 0x50, 0x20, 0x61, 0x72, 0x63, 0x68,
+	0x69, 0x76, 0x65, 0x20, 0x74, 0x65, 0x73, 0x74, 0x0a, 0x50, 0x4b, 0x03, 0x04, 0x14, 0x00, 0x00,
+	0x00, 0x08, 0x00, 0x00, 0x00, 0x21, 0x4e, 0x6f, 0xc8, 0x55, 0xa1, 0x22, 0x00, 0x00, 0x00, 0xe8,
+	0x00, 0x00, 0x00, 0x0b, 0x00, 0x00, 0x00, 0x64, 0x65, 0x66, 0x6c, 0x61, 0x74, 0x65, 0x2e, 0x74,
+	0x78, 0x74, 0x4b, 0x49, 0x4d, 0xcb, 0x49, 0x2c, 0x49, 0x55, 0x48, 0xce, 0xcf, 0x2d, 0x28, 0x4a,
+	0x2d, 0x2e, 0x4e, 0x4d, 0x51, 0x28, 0x49, 0x2d, 0x2e, 0x51, 0x48, 0x49, 0x2c, 0x49, 0x54, 0x48,
+	0x19, 0x3e, 0x92, 0x00, 0x50, 0x4b, 0x01, 0x02, 0x14, 0x03, 0x14, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x21, 0x4e, 0xe9, 0x15, 0x78, 0xa8, 0x11, 0x00, 0x00, 0x00, 0x11, 0x00, 0x00, 0x00,
+	0x0a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x01, 0x00, 0x00,
+	0x00, 0x00, 0x73, 0x74, 0x6f, 0x72, 0x65, 0x64, 0x2e, 0x74, 0x78, 0x74, 0x50, 0x4b, 0x01, 0x02,
+	0x14, 0x03, 0x14, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x21, 0x4e, 0x6f, 0xc8, 0x55, 0xa1,
+	0x22, 0x00, 0x00, 0x00, 0xe8, 0x00, 0x00, 0x00, 0x0b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x80, 0x01, 0x39, 0x00, 0x00, 0x00, 0x64, 0x65, 0x66, 0x6c, 0x61, 0x74,
+	0x65, 0x2e, 0x74, 0x78, 0x74, 0x50, 0x4b, 0x05, 0x06, 0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0x02,
+	0x00, 0x71, 0x00, 0x00, 0x00, 0x84, 0x00, 0x00, 0x00, 0x00, 0x00 };
+
+/* Tests the zip_archive_read_end_of_central_directory function
+ * Returns 1 if successful or 0 if not
+ */
+int assorted_test_zip_archive_read_end_of_central_directory(
+     void )
+{
+	zip_archive_directory_t directory;
+
+	libcerror_error_t *error = NULL;
+	int result               = 0;
+
+	/* Test regular cases
+	 */
+	result = zip_archive_read_end_of_central_directory(
+	          &directory,
+	          assorted_test_zip_archive_data,
+	          267,
+	          0,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ASSORTED_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_UINT64(
+	 "directory.offset",
+	 directory.offset,
+	 (uint64_t) 132 );
+
+	ASSORTED_TEST_ASSERT_EQUAL_UINT64(
+	 "directory.size",
+	 directory.size,
+	 (uint64_t) 113 );
+
+	ASSORTED_TEST_ASSERT_EQUAL_UINT64(
+	 "directory.number_of_members",
+	 directory.number_of_members,
+	 (uint64_t) 2 );
+
+	/* Test data that does not contain the end of central directory record
+	 */
+	result = zip_archive_read_end_of_central_directory(
+	          &directory,
+	          assorted_test_zip_archive_data,
+	          200,
+	          0,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	ASSORTED_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = zip_archive_read_end_of_central_directory(
+	          NULL,
+	          assorted_test_zip_archive_data,
+	          267,
+	          0,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ASSORTED_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = zip_archive_read_end_of_central_directory(
+	          &directory,
+	          NULL,
+	          267,
+	          0,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ASSORTED_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the zip_archive_member_read_central_directory_entry function
+ * Returns 1 if successful or 0 if not
+ */
+int assorted_test_zip_archive_member_read_central_directory_entry(
+     void )
+{
+	uint8_t entry_data[ 56 ];
+
+	zip_archive_member_t member;
+
+	libcerror_error_t *error = NULL;
+	size_t entry_size        = 0;
+	int result               = 0;
+
+	/* Test regular cases
+	 */
+	result = zip_archive_member_read_central_directory_entry(
+	          &member,
+	          &( assorted_test_zip_archive_data[ 132 ] ),
+	          113,
+	          &entry_size,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ASSORTED_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_SIZE(
+	 "entry_size",
+	 entry_size,
+	 (size_t) 56 );
+
+	ASSORTED_TEST_ASSERT_EQUAL_UINT16(
+	 "member.name_size",
+	 member.name_size,
+	 (uint16_t) 10 );
+
+	ASSORTED_TEST_ASSERT_EQUAL_UINT16(
+	 "member.compression_method",
+	 member.compression_method,
+	 (uint16_t) ZIP_ARCHIVE_COMPRESSION_METHOD_STORED );
+
+	ASSORTED_TEST_ASSERT_EQUAL_UINT32(
+	 "member.crc32",
+	 member.crc32,
+	 (uint32_t) 0xa87815e9UL );
+
+	ASSORTED_TEST_ASSERT_EQUAL_UINT64(
+	 "member.compressed_size",
+	 member.compressed_size,
+	 (uint64_t) 17 );
+
+	ASSORTED_TEST_ASSERT_EQUAL_UINT64(
+	 "member.uncompressed_size",
+	 member.uncompressed_size,
+	 (uint64_t) 17 );
+
+	ASSORTED_TEST_ASSERT_EQUAL_UINT64(
+	 "member.local_file_header_offset",
+	 member.local_file_header_offset,
+	 (uint64_t) 0 );
+
+	result = zip_archive_member_read_central_directory_entry(
+	          &member,
+	          &( assorted_test_zip_archive_data[ 188 ] ),
+	          113 - 56,
+	          &entry_size,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ASSORTED_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_SIZE(
+	 "entry_size",
+	 entry_size,
+	 (size_t) 57 );
+
+	ASSORTED_TEST_ASSERT_EQUAL_UINT16(
+	 "member.compression_method",
+	 member.compression_method,
+	 (uint16_t) ZIP_ARCHIVE_COMPRESSION_METHOD_DEFLATE );
+
+	ASSORTED_TEST_ASSERT_EQUAL_UINT64(
+	 "member.compressed_size",
+	 member.compressed_size,
+	 (uint64_t) 34 );
+
+	ASSORTED_TEST_ASSERT_EQUAL_UINT64(
+	 "member.uncompressed_size",
+	 member.uncompressed_size,
+	 (uint64_t) 232 );
+
+	ASSORTED_TEST_ASSERT_EQUAL_UINT64(
+	 "member.local_file_header_offset",
+	 member.local_file_header_offset,
+	 (uint64_t) 57 );
+
+	/* Test error cases
+	 */
+	result = zip_archive_member_read_central_directory_entry(
+	          NULL,
+	          &( assorted_test_zip_archive_data[ 132 ] ),
+	          113,
+	          &entry_size,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ASSORTED_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = zip_archive_member_read_central_directory_entry(
+	          &member,
+	          NULL,
+	          113,
+	          &entry_size,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ASSORTED_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Test an entry with a filename that exceeds the data
+	 */
+	result = zip_archive_member_read_central_directory_entry(
+	          &member,
+	          &( assorted_test_zip_archive_data[ 132 ] ),
+	          50,
+	          &entry_size,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ASSORTED_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Test an entry with an invalid signature
+	 */
+	memory_copy(
+	 entry_data,
+	 &( assorted_test_zip_archive_data[ 132 ] ),
+	 56 );
+
+	entry_data[ 2 ] = 0xff;
+
+	result = zip_archive_member_read_central_directory_entry(
+	          &member,
+	          entry_data,
+	          56,
+	          &entry_size,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ASSORTED_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the zip_archive_get_local_file_header_size function
+ * Returns 1 if successful or 0 if not
+ */
+int assorted_test_zip_archive_get_local_file_header_size(
+     void )
+{
+	libcerror_error_t *error = NULL;
+	size_t header_size       = 0;
+	int result               = 0;
+
+	/* Test regular cases
+	 */
+	result = zip_archive_get_local_file_header_size(
+	          &( assorted_test_zip_archive_data[ 57 ] ),
+	          ZIP_ARCHIVE_LOCAL_FILE_HEADER_SIZE,
+	          &header_size,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ASSORTED_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_SIZE(
+	 "header_size",
+	 header_size,
+	 (size_t) 41 );
+
+	/* Test error cases
+	 */
+	result = zip_archive_get_local_file_header_size(
+	          NULL,
+	          ZIP_ARCHIVE_LOCAL_FILE_HEADER_SIZE,
+	          &header_size,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ASSORTED_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = zip_archive_get_local_file_header_size(
+	          &( assorted_test_zip_archive_data[ 57 ] ),
+	          10,
+	          &header_size,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ASSORTED_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = zip_archive_get_local_file_header_size(
+	          &( assorted_test_zip_archive_data[ 57 ] ),
+	          ZIP_ARCHIVE_LOCAL_FILE_HEADER_SIZE,
+	          NULL,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ASSORTED_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Test a central directory entry instead of a local file header
+	 */
+	result = zip_archive_get_local_file_header_size(
+	          &( assorted_test_zip_archive_data[ 132 ] ),
+	          ZIP_ARCHIVE_LOCAL_FILE_HEADER_SIZE,
+	          &header_size,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ASSORTED_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the zip_archive_verifier_initialize function
+ * Returns 1 if successful or 0 if not
+ */
+int assorted_test_zip_archive_verifier_initialize(
+     void )
+{
+	libcerror_error_t *error         = NULL;
+	zip_archive_verifier_t *verifier = NULL;
+	int result                       = 0;
+
+	/* Test regular cases
+	 */
+	result = zip_archive_verifier_initialize(
+	          &verifier,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ASSORTED_TEST_ASSERT_IS_NOT_NULL(
+	 "verifier",
+	 verifier );
+
+	ASSORTED_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = zip_archive_verifier_free(
+	          &verifier,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ASSORTED_TEST_ASSERT_IS_NULL(
+	 "verifier",
+	 verifier );
+
+	ASSORTED_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = zip_archive_verifier_initialize(
+	          NULL,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ASSORTED_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	verifier = (zip_archive_verifier_t *) 0x12345678UL;
+
+	result = zip_archive_verifier_initialize(
+	          &verifier,
+	          &error );
+
+	verifier = NULL;
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ASSORTED_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( verifier != NULL )
+	{
+		zip_archive_verifier_free(
+		 &verifier,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Verifies a member of the test data, the compressed data is added in parts of part size
+ * Returns the result of zip_archive_verifier_finish or -1 on error
+ */
+int assorted_test_zip_archive_verify_member(
+     zip_archive_verifier_t *verifier,
+     const zip_archive_member_t *member,
+     const uint8_t *compressed_data,
+     size_t part_size,
+     libcerror_error_t **error )
+{
+	size_t data_offset = 0;
+	size_t read_size   = 0;
+	int result         = 0;
+
+	result = zip_archive_verifier_start(
+	          verifier,
+	          member,
+	          error );
+
+	if( result != 1 )
+	{
+		return( -1 );
+	}
+	while( data_offset < (size_t) member->compressed_size )
+	{
+		read_size = (size_t) member->compressed_size - data_offset;
+
+		if( read_size > part_size )
+		{
+			read_size = part_size;
+		}
+		if( zip_archive_verifier_update(
+		     verifier,
+		     &( compressed_data[ data_offset ] ),
+		     read_size,
+		     error ) != 1 )
+		{
+			return( -1 );
+		}
+		data_offset += read_size;
+	}
+	return( zip_archive_verifier_finish(
+	         verifier,
+	         error ) );
+}
+
+/* Tests the zip_archive_verifier_start, zip_archive_verifier_update and zip_archive_verifier_finish functions
+ * Returns 1 if successful or 0 if not
+ */
+int assorted_test_zip_archive_verifier_verify(
+     void )
+{
+	uint8_t compressed_data[ 34 ];
+
+	zip_archive_member_t deflate_member;
+	zip_archive_member_t stored_member;
+	zip_archive_member_t unsupported_member;
+
+	libcerror_error_t *error         = NULL;
+	zip_archive_verifier_t *verifier = NULL;
+	size_t entry_size                = 0;
+	int result                       = 0;
+
+	/* Initialize test
+	 */
+	result = zip_archive_verifier_initialize(
+	          &verifier,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ASSORTED_TEST_ASSERT_IS_NOT_NULL(
+	 "verifier",
+	 verifier );
+
+	ASSORTED_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = zip_archive_member_read_central_directory_entry(
+	          &stored_member,
+	          &( assorted_test_zip_archive_data[ 132 ] ),
+	          113,
+	          &entry_size,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ASSORTED_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = zip_archive_member_read_central_directory_entry(
+	          &deflate_member,
+	          &( assorted_test_zip_archive_data[ 188 ] ),
+	          113 - 56,
+	          &entry_size,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ASSORTED_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	result = assorted_test_zip_archive_verify_member(
+	          verifier,
+	          &stored_member,
+	          &( assorted_test_zip_archive_data[ 40 ] ),
+	          5,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ASSORTED_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = assorted_test_zip_archive_verify_member(
+	          verifier,
+	          &deflate_member,
+	          &( assorted_test_zip_archive_data[ 98 ] ),
+	          34,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ASSORTED_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test the deflate compressed data added per byte
+	 */
+	result = assorted_test_zip_archive_verify_member(
+	          verifier,
+	          &deflate_member,
+	          &( assorted_test_zip_archive_data[ 98 ] ),
+	          1,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ASSORTED_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test a stored member with data that does not match the CRC-32
+	 */
+	memory_copy(
+	 compressed_data,
+	 &( assorted_test_zip_archive_data[ 40 ] ),
+	 17 );
+
+	compressed_data[ 4 ] ^= 0x01;
+
+	result = assorted_test_zip_archive_verify_member(
+	          verifier,
+	          &stored_member,
+	          compressed_data,
+	          17,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	ASSORTED_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test a member of which not all compressed data was added
+	 */
+	result = zip_archive_verifier_start(
+	          verifier,
+	          &deflate_member,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ASSORTED_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = zip_archive_verifier_update(
+	          verifier,
+	          &( assorted_test_zip_archive_data[ 98 ] ),
+	          20,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ASSORTED_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = zip_archive_verifier_finish(
+	          verifier,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	ASSORTED_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test members that are not supported
+	 */
+	memory_copy(
+	 &unsupported_member,
+	 &stored_member,
+	 sizeof( zip_archive_member_t ) );
+
+	unsupported_member.compression_method = 12;
+
+	result = zip_archive_verifier_start(
+	          verifier,
+	          &unsupported_member,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	ASSORTED_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	unsupported_member.compression_method = ZIP_ARCHIVE_COMPRESSION_METHOD_STORED;
+	unsupported_member.flags              = ZIP_ARCHIVE_FLAG_ENCRYPTED;
+
+	result = zip_archive_verifier_start(
+	          verifier,
+	          &unsupported_member,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	ASSORTED_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = zip_archive_verifier_start(
+	          NULL,
+	          &stored_member,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ASSORTED_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = zip_archive_verifier_start(
+	          verifier,
+	          NULL,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ASSORTED_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Test adding data without a member that is verified
+	 */
+	result = zip_archive_verifier_update(
+	          verifier,
+	          &( assorted_test_zip_archive_data[ 40 ] ),
+	          17,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ASSORTED_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = zip_archive_verifier_finish(
+	          verifier,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ASSORTED_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Test adding more data than the compressed size of the member
+	 */
+	result = zip_archive_verifier_start(
+	          verifier,
+	          &stored_member,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ASSORTED_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = zip_archive_verifier_update(
+	          verifier,
+	          &( assorted_test_zip_archive_data[ 40 ] ),
+	          18,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ASSORTED_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Test corrupted deflate compressed data
+	 */
+	memory_set(
+	 compressed_data,
+	 0xff,
+	 34 );
+
+	result = assorted_test_zip_archive_verify_member(
+	          verifier,
+	          &deflate_member,
+	          compressed_data,
+	          34,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ASSORTED_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = zip_archive_verifier_free(
+	          &verifier,
+	          &error );
+
+	ASSORTED_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ASSORTED_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( verifier != NULL )
+	{
+		zip_archive_verifier_free(
+		 &verifier,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* The main program
+ */
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+int wmain(
+     int argc ASSORTED_TEST_ATTRIBUTE_UNUSED,
+     wchar_t * const argv[] ASSORTED_TEST_ATTRIBUTE_UNUSED )
+#else
+int main(
+     int argc ASSORTED_TEST_ATTRIBUTE_UNUSED,
+     char * const argv[] ASSORTED_TEST_ATTRIBUTE_UNUSED )
+#endif
+{
+	ASSORTED_TEST_UNREFERENCED_PARAMETER( argc )
+	ASSORTED_TEST_UNREFERENCED_PARAMETER( argv )
+
+	ASSORTED_TEST_RUN(
+	 "zip_archive_read_end_of_central_directory",
+	 assorted_test_zip_archive_read_end_of_central_directory );
+
+	ASSORTED_TEST_RUN(
+	 "zip_archive_member_read_central_directory_entry",
+	 assorted_test_zip_archive_member_read_central_directory_entry );
+
+	ASSORTED_TEST_RUN(
+	 "zip_archive_get_local_file_header_size",
+	 assorted_test_zip_archive_get_local_file_header_size );
+
+	ASSORTED_TEST_RUN(
+	 "zip_archive_verifier_initialize",
+	 assorted_test_zip_archive_verifier_initialize );
+
+	/* TODO: add tests for zip_archive_verifier_free */
+
+	ASSORTED_TEST_RUN(
+	 "zip_archive_verifier_verify",
+	 assorted_test_zip_archive_verifier_verify );
+
+	return( EXIT_SUCCESS );
+
+on_error:
+	return( EXIT_FAILURE );
+}
+
@@ -0,0 +1,518 @@
+#!/bin/bash
+# Tests tools performance.
+#
+# Version: 20190101
+#
+# Times every tool end to end on generated corpora and compares the
+# results against a stored baseline.
+#
+# PERF_CORPUS_SIZE contains the size of the corpora in bytes, which
+# must be a multiple of 65536 (default is 16777216).
+#
+# PERF_BASELINE contains the path of the baseline file (default is
+# perf_baseline.txt). When the baseline file does not exist or
+# PERF_UPDATE_BASELINE is set to a non-empty value the results are
+# written to the baseline file instead of being compared against it.
+#
+# PERF_TOLERANCE contains the percentage the throughput can be lower
+# and the maximum RSS can be higher than the baseline (default is 20).
+#
+# PERF_INPUT_DIRECTORY contains the path of a directory with compressed
+# samples for the decompression tools that have no compressor, cabinet
+# files for mszipdecompress, SQLite WAL files for walsum and ZIP archives
+# for zipverify, where the samples of a tool are named after the tool,
+# e.g. lznt1decompress.1 (default is input/perf).
+
+EXIT_SUCCESS=0;
+EXIT_FAILURE=1;
+EXIT_IGNORE=77;
+
+CORPORA="random text zeros mixed";
+
+CORPUS_TOOLS="adler32sum ascii7compress ascii7decompress blocksum crc32sum crc64sum crcsum deflatecarve fletcher32sum fletcher64sum lznt1compress multisum rc4crypt serpentcrypt xor32sum xor64sum zcompress zdecompress decompressbench";
+INPUT_TOOLS="lzfsedecompress lzfudecompress lznt1decompress lzvndecompress lzxpressdecompress mssearchdecode mszipdecompress walsum zipverify";
+OTHER_TOOLS="checksumbench prefetchhash";
+
+PERF_CORPUS_SIZE=${PERF_CORPUS_SIZE:-16777216};
+PERF_BASELINE=${PERF_BASELINE:-perf_baseline.txt};
+PERF_TOLERANCE=${PERF_TOLERANCE:-20};
+PERF_INPUT_DIRECTORY=${PERF_INPUT_DIRECTORY:-input/perf};
+
+PERF_BLOCK_SIZE=65536;
+
+# Determines the path of a tool executable.
+#
+# Arguments:
+#   a string containing the name of the tool
+#
+# Returns:
+#   a string containing the path of the tool executable or an empty string if not available
+#
+get_tool_executable()
+{
+	local TOOL_NAME=$1;
+
+	local TOOL_EXECUTABLE="${TOOLS_DIRECTORY}/${TOOL_NAME}";
+
+	if ! test -x "${TOOL_EXECUTABLE}";
+	then
+		TOOL_EXECUTABLE="${TOOL_EXECUTABLE}.exe";
+	fi
+	if ! test -x "${TOOL_EXECUTABLE}";
+	then
+		TOOL_EXECUTABLE="";
+	fi
+	echo "${TOOL_EXECUTABLE}";
+}
+
+# Generates the corpora.
+#
+# The corpora are deterministic: the random corpus is the RC4 keystream
+# of a fixed key, the text corpus is generated using a linear congruential
+# generator and the mixed corpus interleaves blocks of the other corpora.
+#
+# Arguments:
+#   a string containing the path of the corpora directory
+#
+# Returns:
+#   an integer containing the exit status
+#
+generate_corpora()
+{
+	local CORPORA_DIRECTORY=$1;
+
+	local NUMBER_OF_BLOCKS=$(( ${PERF_CORPUS_SIZE} / ${PERF_BLOCK_SIZE} ));
+
+	dd if=/dev/zero of="${CORPORA_DIRECTORY}/zeros" bs=${PERF_BLOCK_SIZE} count=${NUMBER_OF_BLOCKS} 2> /dev/null;
+
+	if test $? -ne ${EXIT_SUCCESS};
+	then
+		echo "Unable to generate zeros corpus.";
+
+		return ${EXIT_FAILURE};
+	fi
+	local RC4CRYPT=$(get_tool_executable "rc4crypt");
+
+	if test -z "${RC4CRYPT}";
+	then
+		echo "Missing tool: rc4crypt";
+
+		return ${EXIT_FAILURE};
+	fi
+	${RC4CRYPT} -k 000102030405060708090a0b0c0d0e0f -t "${CORPORA_DIRECTORY}/random" "${CORPORA_DIRECTORY}/zeros" > /dev/null 2>&1;
+
+	if test $? -ne ${EXIT_SUCCESS};
+	then
+		echo "Unable to generate random corpus.";
+
+		return ${EXIT_FAILURE};
+	fi
+	LC_ALL=C awk -v size=${PERF_CORPUS_SIZE} '
+	BEGIN {
+		split("the of and to in is that for it as with was on be by this are from or at an not have which data file block stream chunk offset size value header checksum table buffer", words, " ");
+		number_of_words = length( words );
+		seed = 1;
+		written = 0;
+
+		while( written < size )
+		{
+			line = "";
+			line_length = 0;
+
+			while( line_length < 60 )
+			{
+				seed = ( ( seed * 1103515245 ) + 12345 ) % 2147483648;
+				word = words[ 1 + int( seed / 65536 ) % number_of_words ];
+				line = line word " ";
+				line_length += length( word ) + 1;
+			}
+			print line;
+			written += line_length + 1;
+		}
+	}' | head -c ${PERF_CORPUS_SIZE} > "${CORPORA_DIRECTORY}/text";
+
+	if test $? -ne ${EXIT_SUCCESS};
+	then
+		echo "Unable to generate text corpus.";
+
+		return ${EXIT_FAILURE};
+	fi
+	local BLOCK_INDEX=0;
+	local BLOCK_CORPUS="";
+
+	rm -f "${CORPORA_DIRECTORY}/mixed";
+
+	while test ${BLOCK_INDEX} -lt ${NUMBER_OF_BLOCKS};
+	do
+		case $(( ${BLOCK_INDEX} % 3 )) in
+		0)
+			BLOCK_CORPUS="text";
+			;;
+		1)
+			BLOCK_CORPUS="random";
+			;;
+		*)
+			BLOCK_CORPUS="zeros";
+			;;
+		esac
+
+		dd if="${CORPORA_DIRECTORY}/${BLOCK_CORPUS}" bs=${PERF_BLOCK_SIZE} skip=${BLOCK_INDEX} count=1 >> "${CORPORA_DIRECTORY}/mixed" 2> /dev/null;
+
+		if test $? -ne ${EXIT_SUCCESS};
+		then
+			echo "Unable to generate mixed corpus.";
+
+			return ${EXIT_FAILURE};
+		fi
+		BLOCK_INDEX=$(( ${BLOCK_INDEX} + 1 ));
+	done
+
+	return ${EXIT_SUCCESS};
+}
+
+# Runs a command and measures its wall time and maximum RSS.
+#
+# The maximum RSS is only measured when GNU time is available.
+#
+# Arguments:
+#   a string containing the command
+#
+# Returns:
+#   an integer containing the exit status of the command
+#   and prints the wall time in seconds followed by the maximum RSS in KiB or -
+#
+measure_command()
+{
+	local COMMAND=$@;
+	local MEASUREMENT_FILE="${PERF_TMPDIR}/measurement";
+	local RESULT=${EXIT_SUCCESS};
+
+	if test -x /usr/bin/time && /usr/bin/time -f "%e" true > /dev/null 2>&1;
+	then
+		/usr/bin/time -o "${MEASUREMENT_FILE}" -f "%e %M" ${COMMAND[@]} > /dev/null 2>&1;
+		RESULT=$?;
+
+		tail -n 1 "${MEASUREMENT_FILE}";
+	else
+		local START_TIME=$(date +%s.%N);
+
+		${COMMAND[@]} > /dev/null 2>&1;
+		RESULT=$?;
+
+		local END_TIME=$(date +%s.%N);
+
+		LC_ALL=C awk -v start=${START_TIME} -v end=${END_TIME} 'BEGIN { printf( "%.2f -\n", end - start ); }';
+	fi
+	return ${RESULT};
+}
+
+# Runs a tool on an input file and adds the measurement to the results.
+#
+# Arguments:
+#   a string containing the name of the tool
+#   a string containing the name of the input
+#   a string containing the number of bytes processed
+#   a string containing the command
+#
+# Returns:
+#   an integer containing the exit status
+#
+run_perf_test()
+{
+	local TOOL_NAME=$1;
+	local INPUT_NAME=$2;
+	local PROCESSED_SIZE=$3;
+	shift 3;
+	local COMMAND=$@;
+	local MEASUREMENT="";
+	local RESULT=${EXIT_SUCCESS};
+
+	MEASUREMENT=$(measure_command ${COMMAND[@]});
+	RESULT=$?;
+
+	if test ${RESULT} -ne ${EXIT_SUCCESS};
+	then
+		echo "Testing performance: ${TOOL_NAME} with input: ${INPUT_NAME} (FAIL)";
+
+		return ${EXIT_FAILURE};
+	fi
+	echo "${TOOL_NAME} ${INPUT_NAME} ${PROCESSED_SIZE} ${MEASUREMENT}" | LC_ALL=C awk '{
+		seconds = $4;
+
+		if( seconds < 0.01 )
+		{
+			seconds = 0.01;
+		}
+		printf( "%s %s %.2f %.2f %s\n", $1, $2, $4, $3 / seconds / 1048576, $5 );
+	}' >> "${PERF_RESULTS}";
+
+	return ${EXIT_SUCCESS};
+}
+
+# Runs a tool on every corpus.
+#
+# Arguments:
+#   a string containing the name of the tool
+#   a string containing the path of the tool executable
+#   a string containing the path of the corpora directory
+#
+# Returns:
+#   an integer containing the exit status
+#
+run_perf_test_with_corpora()
+{
+	local TOOL_NAME=$1;
+	local TOOL_EXECUTABLE=$2;
+	local CORPORA_DIRECTORY=$3;
+	local RESULT=${EXIT_SUCCESS};
+
+	for CORPUS in ${CORPORA};
+	do
+		local CORPUS_FILE="${CORPORA_DIRECTORY}/${CORPUS}";
+
+		case "${TOOL_NAME}" in
+		ascii7compress)
+			run_perf_test "${TOOL_NAME}" "${CORPUS}" ${PERF_CORPUS_SIZE} ${TOOL_EXECUTABLE} -t "${PERF_TMPDIR}/target" "${CORPUS_FILE}";
+			RESULT=$?;
+			;;
+		blocksum)
+			run_perf_test "${TOOL_NAME}" "${CORPUS}" ${PERF_CORPUS_SIZE} ${TOOL_EXECUTABLE} -m "${PERF_TMPDIR}/manifest" "${CORPUS_FILE}";
+			RESULT=$?;
+			;;
+		decompressbench)
+			run_perf_test "${TOOL_NAME}" "${CORPUS}" ${PERF_CORPUS_SIZE} ${TOOL_EXECUTABLE} -n 1 "${CORPUS_FILE}";
+			RESULT=$?;
+			;;
+		lznt1compress)
+			run_perf_test "${TOOL_NAME}" "${CORPUS}" ${PERF_CORPUS_SIZE} ${TOOL_EXECUTABLE} -t "${PERF_TMPDIR}/target" "${CORPUS_FILE}";
+			RESULT=$?;
+			;;
+		rc4crypt)
+			run_perf_test "${TOOL_NAME}" "${CORPUS}" ${PERF_CORPUS_SIZE} ${TOOL_EXECUTABLE} -k 000102030405060708090a0b0c0d0e0f -t "${PERF_TMPDIR}/target" "${CORPUS_FILE}";
+			RESULT=$?;
+			;;
+		serpentcrypt)
+			run_perf_test "${TOOL_NAME}" "${CORPUS}" ${PERF_CORPUS_SIZE} ${TOOL_EXECUTABLE} -k 000102030405060708090a0b0c0d0e0f -t "${PERF_TMPDIR}/target" "${CORPUS_FILE}";
+			RESULT=$?;
+			;;
+		zdecompress)
+			# zcompress writes the compressed data to: source.zcompressed
+			if ! test -f "${CORPUS_FILE}.zcompressed";
+			then
+				echo "Testing performance: ${TOOL_NAME} with input: ${CORPUS} (SKIP)";
+
+				continue;
+			fi
+			run_perf_test "${TOOL_NAME}" "${CORPUS}" ${PERF_CORPUS_SIZE} ${TOOL_EXECUTABLE} "${CORPUS_FILE}.zcompressed";
+			RESULT=$?;
+			;;
+		*)
+			run_perf_test "${TOOL_NAME}" "${CORPUS}" ${PERF_CORPUS_SIZE} ${TOOL_EXECUTABLE} "${CORPUS_FILE}";
+			RESULT=$?;
+			;;
+		esac
+
+		if test ${RESULT} -ne ${EXIT_SUCCESS};
+		then
+			break;
+		fi
+	done
+	return ${RESULT};
+}
+
+# Runs a tool on its compressed samples in the input directory.
+#
+# The throughput is relative to the size of the compressed sample.
+#
+# Arguments:
+#   a string containing the name of the tool
+#   a string containing the path of the tool executable
+#
+# Returns:
+#   an integer containing the exit status
+#
+run_perf_test_with_input()
+{
+	local TOOL_NAME=$1;
+	local TOOL_EXECUTABLE=$2;
+	local RESULT=${EXIT_SUCCESS};
+	local NUMBER_OF_SAMPLES=0;
+
+	if test -d "${PERF_INPUT_DIRECTORY}";
+	then
+		for INPUT_FILE in "${PERF_INPUT_DIRECTORY}/${TOOL_NAME}".*;
+		do
+			if ! test -f "${INPUT_FILE}";
+			then
+				continue;
+			fi
+			local INPUT_SIZE=$(wc -c < "${INPUT_FILE}" | tr -d ' ');
+
+			run_perf_test "${TOOL_NAME}" "$(basename ${INPUT_FILE})" ${INPUT_SIZE} ${TOOL_EXECUTABLE} "${INPUT_FILE}";
+			RESULT=$?;
+
+			if test ${RESULT} -ne ${EXIT_SUCCESS};
+			then
+				break;
+			fi
+			NUMBER_OF_SAMPLES=$(( ${NUMBER_OF_SAMPLES} + 1 ));
+		done
+	fi
+	if test ${NUMBER_OF_SAMPLES} -eq 0 && test ${RESULT} -eq ${EXIT_SUCCESS};
+	then
+		echo "Testing performance: ${TOOL_NAME} (SKIP) no samples in: ${PERF_INPUT_DIRECTORY}";
+	fi
+	return ${RESULT};
+}
+
+# Compares the results against the baseline.
+#
+# Arguments:
+#   a string containing the path of the results file
+#   a string containing the path of the baseline file
+#
+# Returns:
+#   an integer containing the exit status
+#
+compare_with_baseline()
+{
+	local RESULTS_FILE=$1;
+	local BASELINE_FILE=$2;
+
+	LC_ALL=C awk -v tolerance=${PERF_TOLERANCE} '
+	FNR == NR {
+		baseline_throughput[ $1 " " $2 ] = $4;
+		baseline_rss[ $1 " " $2 ] = $5;
+		next;
+	}
+	{
+		key = $1 " " $2;
+		status = "PASS";
+
+		if( !( key in baseline_throughput ) )
+		{
+			status = "NEW";
+		}
+		else
+		{
+			if( $4 < baseline_throughput[ key ] * ( 100 - tolerance ) / 100 )
+			{
+				status = "FAIL";
+			}
+			if( ( $5 != "-" ) && ( baseline_rss[ key ] != "-" ) && ( $5 > baseline_rss[ key ] * ( 100 + tolerance ) / 100 ) )
+			{
+				status = "FAIL";
+			}
+		}
+		if( status == "FAIL" )
+		{
+			result = 1;
+		}
+		printf( "%-20s %-20s %8s s %10s MB/s (baseline: %s) %10s KiB (baseline: %s) (%s)\n", $1, $2, $3, $4, baseline_throughput[ key ], $5, baseline_rss[ key ], status );
+	}
+	END {
+		exit result;
+	}' "${BASELINE_FILE}" "${RESULTS_FILE}";
+
+	return $?;
+}
+
+if ! test -z ${SKIP_PERF_TESTS};
+then
+	exit ${EXIT_IGNORE};
+fi
+
+if test $(( ${PERF_CORPUS_SIZE} % ${PERF_BLOCK_SIZE} )) -ne 0 || test ${PERF_CORPUS_SIZE} -eq 0;
+then
+	echo "Unsupported corpus size: ${PERF_CORPUS_SIZE}, value must be a multiple of ${PERF_BLOCK_SIZE}.";
+
+	exit ${EXIT_FAILURE};
+fi
+
+TOOLS_DIRECTORY="../src";
+
+if ! test -d "${TOOLS_DIRECTORY}";
+then
+	TOOLS_DIRECTORY="src";
+fi
+
+PERF_TMPDIR=$(mktemp -d "${TMPDIR:-/tmp}/test_perf.XXXXXX");
+
+if test $? -ne ${EXIT_SUCCESS};
+then
+	echo "Unable to create temporary directory.";
+
+	exit ${EXIT_FAILURE};
+fi
+
+PERF_RESULTS="${PERF_TMPDIR}/results";
+
+mkdir "${PERF_TMPDIR}/corpora";
+
+generate_corpora "${PERF_TMPDIR}/corpora";
+RESULT=$?;
+
+if test ${RESULT} -eq ${EXIT_SUCCESS};
+then
+	: > "${PERF_RESULTS}";
+
+	for TOOL_NAME in ${CORPUS_TOOLS} ${INPUT_TOOLS} ${OTHER_TOOLS};
+	do
+		TOOL_EXECUTABLE=$(get_tool_executable "${TOOL_NAME}");
+
+		if test -z "${TOOL_EXECUTABLE}";
+		then
+			echo "Testing performance: ${TOOL_NAME} (SKIP) missing tool";
+
+			continue;
+		fi
+		case " ${INPUT_TOOLS} " in
+		*" ${TOOL_NAME} "*)
+			run_perf_test_with_input "${TOOL_NAME}" "${TOOL_EXECUTABLE}";
+			RESULT=$?;
+			;;
+		*)
+			case "${TOOL_NAME}" in
+			checksumbench)
+				run_perf_test "${TOOL_NAME}" "none" ${PERF_CORPUS_SIZE} ${TOOL_EXECUTABLE} -s 1048576 -t ${PERF_CORPUS_SIZE};
+				RESULT=$?;
+				;;
+			prefetchhash)
+				run_perf_test "${TOOL_NAME}" "text" ${PERF_CORPUS_SIZE} ${TOOL_EXECUTABLE} -f "${PERF_TMPDIR}/corpora/text";
+				RESULT=$?;
+				;;
+			*)
+				run_perf_test_with_corpora "${TOOL_NAME}" "${TOOL_EXECUTABLE}" "${PERF_TMPDIR}/corpora";
+				RESULT=$?;
+				;;
+			esac
+			;;
+		esac
+
+		if test ${RESULT} -ne ${EXIT_SUCCESS};
+		then
+			break;
+		fi
+	done
+fi
+
+if test ${RESULT} -eq ${EXIT_SUCCESS};
+then
+	if test -n "${PERF_UPDATE_BASELINE}" || ! test -f "${PERF_BASELINE}";
+	then
+		cat "${PERF_RESULTS}";
+
+		cp "${PERF_RESULTS}" "${PERF_BASELINE}";
+		RESULT=$?;
+
+		echo "Baseline written to: ${PERF_BASELINE}";
+	else
+		compare_with_baseline "${PERF_RESULTS}" "${PERF_BASELINE}";
+		RESULT=$?;
+	fi
+fi
+
+rm -rf "${PERF_TMPDIR}";
+
+exit ${RESULT};
+
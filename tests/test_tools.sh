@@ -7,7 +7,7 @@ EXIT_SUCCESS=0;
 EXIT_FAILURE=1;
 EXIT_IGNORE=77;
 
-LIBRARY_TESTS="deflate";
+LIBRARY_TESTS="adler32 ascii7 cab_archive crc crc32 crc64 deflate deflate_carve deflate_index deflate_parallel fletcher32 fletcher64 gzip lzfse lzfu lznt1 lzvn lzxpress memory_arena mssearch mszip prefetch_hash serpent sqlite_wal unicode xor32 xor64 zip_archive";
 LIBRARY_TESTS_WITH_INPUT="";
 OPTION_SETS="";
 